@@ -0,0 +1,99 @@
+#! /usr/bin/env python2
+from __future__ import print_function
+
+# Generates src/modules/roc_audio/sinc_table_data.cpp with precomputed
+# sinc tables for the default resampler profiles (resampler_profile.cpp).
+# The math replicates SincTableCache::fill_(); keep them in sync.
+
+import math
+import struct
+import os
+
+PROFILES = [
+    (16, 64),    # ResamplerProfile_Low
+    (32, 128),   # ResamplerProfile_Medium
+    (64, 512),   # ResamplerProfile_High
+]
+
+def to_float32(x):
+    return struct.unpack('f', struct.pack('f', x))[0]
+
+def make_table(window_size, window_interp):
+    size = window_size * window_interp + 2
+    table = [0.0] * size
+
+    sinc_step = 1.0 / window_interp
+    sinc_t = sinc_step
+
+    table[0] = 1.0
+    for i in range(1, size):
+        window = 0.54 - 0.46 * math.cos(
+            2 * math.pi * ((i - 1) / 2.0 / size + 0.5))
+        table[i] = to_float32(
+            math.sin(math.pi * sinc_t) / math.pi / sinc_t * window)
+        sinc_t += sinc_step
+
+    table[size - 2] = 0.0
+    table[size - 1] = 0.0
+    return table
+
+def format_value(v):
+    s = '%.9g' % v
+    if '.' not in s and 'e' not in s:
+        s += '.0'
+    return s + 'f'
+
+def format_table(out, name, table):
+    out.write('static const float %s[%d] = {\n' % (name, len(table)))
+    for n in range(0, len(table), 8):
+        row = table[n:n + 8]
+        out.write('    %s,\n' % ', '.join(format_value(v) for v in row))
+    out.write('};\n\n')
+
+def main():
+    path = os.path.join(
+        os.path.dirname(__file__), '..',
+        'src', 'modules', 'roc_audio', 'sinc_table_data.cpp')
+
+    with open(path, 'w') as out:
+        out.write('''/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Generated by scripts/generate_sinc_tables.py; do not edit.
+//
+// Precomputed sinc tables for the default resampler profiles. Keeping
+// them in read-only data avoids recomputation at session start and lets
+// the OS share one copy across processes.
+
+#include "roc_audio/sinc_table_data.h"
+
+namespace roc {
+namespace audio {
+
+''')
+        names = []
+        for window_size, window_interp in PROFILES:
+            name = 'sinc_table_%d_%d' % (window_size, window_interp)
+            names.append((name, window_size, window_interp))
+            format_table(out, name, make_table(window_size, window_interp))
+
+        out.write('const float* sinc_table_lookup(size_t window_size,'
+                  ' size_t window_interp) {\n')
+        for name, window_size, window_interp in names:
+            out.write('    if (window_size == %d && window_interp == %d) {\n'
+                      '        return %s;\n'
+                      '    }\n' % (window_size, window_interp, name))
+        out.write('''    return NULL;
+}
+
+} // namespace audio
+} // namespace roc
+''')
+
+if __name__ == '__main__':
+    main()
@@ -1,3 +1,4 @@
+import roc.benchmarks
 import roc.commands
 import roc.config
 import roc.distfiles
@@ -18,6 +19,7 @@ except:
 
 def generate(env):
     modules = [
+        benchmarks,
         commands,
         config,
         distfiles,
@@ -0,0 +1,62 @@
+import SCons.Script
+import re
+
+def _is_bench_enabled(benchname):
+    for target in ['bench', benchname]:
+        if target in SCons.Script.COMMAND_LINE_TARGETS:
+            return True
+
+def _get_non_bench_targets(env):
+    if SCons.Script.COMMAND_LINE_TARGETS:
+        for target in SCons.Script.COMMAND_LINE_TARGETS:
+            if target == 'bench':
+                yield env.Dir('#')
+            elif not re.match('^bench/.+', target):
+                yield target
+    else:
+        yield env.Dir('#')
+
+def _with_timeout(env, cmd, timeout):
+    return '%s scripts/wrappers/timeout.py %s %s' % (
+        env.PythonExecutable(),
+        timeout,
+        cmd)
+
+def AddBench(env, name, exe, cmd=None, timeout=15*60):
+    benchname = 'bench/%s' % name
+
+    if not _is_bench_enabled(benchname):
+        return
+
+    if not cmd:
+        cmd = env.File(exe).path
+
+    cmd = _with_timeout(env, cmd, timeout)
+
+    comstr = env.PrettyCommand('BENCH', name, 'green')
+    target = env.Alias(benchname, [], env.Action(cmd, comstr))
+
+    # This target produces no files.
+    env.AlwaysBuild(target)
+
+    # This target depends on benchmark executable that it should run.
+    env.Depends(target, env.File(exe))
+
+    # This target should be run after all build targets.
+    for t in _get_non_bench_targets(env):
+        env.Requires(target, t)
+
+    # This target should be run after all previous benchmarks.
+    for t in env['_ROC_BENCHES']:
+        env.Requires(target, t)
+
+    # Add target to benchmark list.
+    env['_ROC_BENCHES'] += [benchname]
+
+    # 'bench' target depends on this target.
+    env.Depends('bench', target)
+
+def init(env):
+    env['_ROC_BENCHES'] = []
+    env.AlwaysBuild(env.Alias('bench', [], env.Action('')))
+    env.AddMethod(AddBench, 'AddBench')
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ROC_BENCH_BENCH_H_
+#define ROC_BENCH_BENCH_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace bench {
+
+// Base class for micro-benchmarks.
+//
+// A benchmark runs the measured operation the requested number of times.
+// The runner calibrates the iteration count until the run takes long
+// enough to measure reliably and reports the average time per operation.
+//
+// Per-benchmark state that should not be measured (pools, buffers, etc.)
+// lives at file scope in the benchmark file, the same way test fixtures do.
+class Benchmark {
+public:
+    explicit Benchmark(const char* name);
+    virtual ~Benchmark();
+
+    // Run the measured operation n_iters times.
+    virtual void run(size_t n_iters) = 0;
+
+    // Bytes processed by a single operation, used for throughput
+    // reporting; zero disables throughput reporting.
+    virtual size_t bytes_per_iter() const;
+
+    const char* name() const;
+    Benchmark* next() const;
+
+    // Head of the global benchmark list, in reverse registration order.
+    static Benchmark* first();
+
+private:
+    const char* name_;
+    Benchmark* next_;
+};
+
+// Run all registered benchmarks and print a report.
+int run_benchmarks();
+
+} // namespace bench
+} // namespace roc
+
+// Define and register a benchmark:
+//   ROC_BENCHMARK(name) {
+//       for (size_t n = 0; n < n_iters; n++) {
+//           ... one operation ...
+//       }
+//   }
+#define ROC_BENCHMARK(Name)                                                              \
+    class Benchmark_##Name : public ::roc::bench::Benchmark {                            \
+    public:                                                                              \
+        Benchmark_##Name()                                                               \
+            : Benchmark(#Name) {                                                         \
+        }                                                                                \
+        virtual void run(size_t n_iters);                                                \
+    };                                                                                   \
+    static Benchmark_##Name benchmark_##Name##_instance;                                 \
+    void Benchmark_##Name::run(size_t n_iters)
+
+// Same, with a throughput report of Bytes per operation.
+#define ROC_BENCHMARK_BYTES(Name, Bytes)                                                 \
+    class Benchmark_##Name : public ::roc::bench::Benchmark {                            \
+    public:                                                                              \
+        Benchmark_##Name()                                                               \
+            : Benchmark(#Name) {                                                         \
+        }                                                                                \
+        virtual void run(size_t n_iters);                                                \
+        virtual size_t bytes_per_iter() const {                                          \
+            return (Bytes);                                                              \
+        }                                                                                \
+    };                                                                                   \
+    static Benchmark_##Name benchmark_##Name##_instance;                                 \
+    void Benchmark_##Name::run(size_t n_iters)
+
+#endif // ROC_BENCH_BENCH_H_
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+
+#include "bench.h"
+
+#include "roc_core/crash.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace bench {
+
+namespace {
+
+Benchmark* first_benchmark = NULL;
+
+// Minimum duration of a measured run. Shorter runs are re-done with a
+// larger iteration count.
+const core::nanoseconds_t MinDuration = 300 * core::Millisecond;
+
+void run_benchmark(Benchmark& b) {
+    size_t n_iters = 1;
+    core::nanoseconds_t elapsed = 0;
+
+    for (;;) {
+        const core::nanoseconds_t started = core::timestamp();
+        b.run(n_iters);
+        elapsed = core::timestamp() - started;
+
+        if (elapsed >= MinDuration) {
+            break;
+        }
+
+        size_t next_iters = n_iters * 10;
+        if (elapsed > core::Millisecond) {
+            next_iters =
+                (size_t)((double)n_iters * (double)MinDuration / (double)elapsed * 1.5);
+            if (next_iters <= n_iters) {
+                next_iters = n_iters * 2;
+            }
+        }
+        n_iters = next_iters;
+    }
+
+    const double ns_per_op = (double)elapsed / (double)n_iters;
+
+    printf("%-40s %12lu iters %14.1f ns/op", b.name(), (unsigned long)n_iters,
+           ns_per_op);
+
+    if (b.bytes_per_iter() != 0) {
+        printf(" %10.1f MB/s", (double)b.bytes_per_iter() * 1000.0 / ns_per_op);
+    }
+
+    printf("\n");
+    fflush(stdout);
+}
+
+} // namespace
+
+Benchmark::Benchmark(const char* name)
+    : name_(name)
+    , next_(first_benchmark) {
+    first_benchmark = this;
+}
+
+Benchmark::~Benchmark() {
+}
+
+size_t Benchmark::bytes_per_iter() const {
+    return 0;
+}
+
+const char* Benchmark::name() const {
+    return name_;
+}
+
+Benchmark* Benchmark::next() const {
+    return next_;
+}
+
+Benchmark* Benchmark::first() {
+    return first_benchmark;
+}
+
+int run_benchmarks() {
+    size_t n_benchmarks = 0;
+
+    for (Benchmark* b = Benchmark::first(); b; b = b->next()) {
+        run_benchmark(*b);
+        n_benchmarks++;
+    }
+
+    if (n_benchmarks == 0) {
+        fprintf(stderr, "no benchmarks registered\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace bench
+} // namespace roc
+
+int main() {
+    roc::core::CrashHandler crash_handler;
+
+    roc::core::Logger::instance().set_level(roc::LogNone);
+
+    return roc::bench::run_benchmarks();
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bench.h"
+
+#include "roc_audio/mixer.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { FrameSize = 1024, NumReaders = 4 };
+
+core::HeapAllocator allocator;
+core::BufferPool<sample_t> sample_pool(allocator, FrameSize, true);
+
+// Produces a constant signal without any overhead, so that the
+// measurement is dominated by the mixing itself.
+class ConstReader : public IReader {
+public:
+    virtual void read(Frame& frame) {
+        sample_t* data = frame.data();
+        for (size_t n = 0; n < frame.size(); n++) {
+            data[n] = 0.1f;
+        }
+    }
+};
+
+} // namespace
+
+ROC_BENCHMARK_BYTES(mixer_read_4_inputs, FrameSize * sizeof(sample_t)) {
+    Mixer mixer(sample_pool, FrameSize);
+
+    ConstReader readers[NumReaders];
+    for (size_t n = 0; n < NumReaders; n++) {
+        mixer.add(readers[n]);
+    }
+
+    sample_t samples[FrameSize];
+
+    for (size_t n = 0; n < n_iters; n++) {
+        Frame frame(samples, FrameSize);
+        mixer.read(frame);
+    }
+
+    for (size_t n = 0; n < NumReaders; n++) {
+        mixer.remove(readers[n]);
+    }
+}
+
+} // namespace audio
+} // namespace roc
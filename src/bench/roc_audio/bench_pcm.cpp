@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bench.h"
+
+#include "roc_audio/pcm_funcs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { ChMask = 0x3, NumSamples = 320 };
+
+} // namespace
+
+ROC_BENCHMARK_BYTES(pcm_encode_int16_2ch, NumSamples * 2 * sizeof(int16_t)) {
+    sample_t samples[NumSamples * 2];
+    uint8_t payload[NumSamples * 2 * sizeof(int16_t)];
+
+    for (size_t i = 0; i < NumSamples * 2; i++) {
+        samples[i] = 0.5f;
+    }
+
+    for (size_t n = 0; n < n_iters; n++) {
+        PCM_int16_2ch.encode_samples(payload, sizeof(payload), 0, samples, NumSamples,
+                                     ChMask);
+    }
+}
+
+ROC_BENCHMARK_BYTES(pcm_decode_int16_2ch, NumSamples * 2 * sizeof(int16_t)) {
+    sample_t samples[NumSamples * 2];
+    uint8_t payload[NumSamples * 2 * sizeof(int16_t)];
+
+    memset(payload, 0x55, sizeof(payload));
+
+    for (size_t n = 0; n < n_iters; n++) {
+        PCM_int16_2ch.decode_samples(payload, sizeof(payload), 0, samples, NumSamples,
+                                     ChMask);
+    }
+}
+
+} // namespace audio
+} // namespace roc
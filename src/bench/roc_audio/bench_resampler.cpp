@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bench.h"
+
+#include "roc_audio/resampler_profile.h"
+#include "roc_audio/resampler_reader.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { ChMask = 0x3, NumCh = 2, FrameSize = 640 };
+
+core::HeapAllocator allocator;
+core::BufferPool<sample_t> sample_pool(allocator, FrameSize, true);
+
+class SineReader : public IReader {
+public:
+    SineReader()
+        : pos_(0) {
+    }
+
+    virtual void read(Frame& frame) {
+        sample_t* data = frame.data();
+        for (size_t n = 0; n < frame.size(); n += NumCh) {
+            const sample_t s = (sample_t)sin(2 * M_PI * 440 * pos_++ / 44100.0);
+            for (size_t ch = 0; ch < NumCh; ch++) {
+                data[n + ch] = s;
+            }
+        }
+    }
+
+private:
+    size_t pos_;
+};
+
+void resample(float scaling, size_t n_iters) {
+    SineReader input;
+
+    ResamplerReader reader(input, sample_pool, allocator, resampler_profile(ResamplerProfile_Medium),
+                           ChMask, FrameSize);
+    roc_panic_if_not(reader.valid());
+    roc_panic_if_not(reader.set_scaling(scaling));
+
+    sample_t samples[FrameSize];
+
+    for (size_t n = 0; n < n_iters; n++) {
+        Frame frame(samples, FrameSize);
+        reader.read(frame);
+    }
+}
+
+} // namespace
+
+ROC_BENCHMARK_BYTES(resampler_read_upscale, FrameSize * sizeof(sample_t)) {
+    resample(0.97f, n_iters);
+}
+
+ROC_BENCHMARK_BYTES(resampler_read_downscale, FrameSize * sizeof(sample_t)) {
+    resample(1.03f, n_iters);
+}
+
+} // namespace audio
+} // namespace roc
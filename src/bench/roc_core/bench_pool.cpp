@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bench.h"
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/pool.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { ObjectSize = 256, BatchSize = 16 };
+
+struct Object {
+    char bytes[ObjectSize];
+};
+
+HeapAllocator allocator;
+Pool<Object> object_pool(allocator, sizeof(Object), true);
+
+} // namespace
+
+ROC_BENCHMARK(pool_allocate_deallocate) {
+    for (size_t n = 0; n < n_iters; n++) {
+        void* mem = object_pool.allocate();
+        object_pool.deallocate(mem);
+    }
+}
+
+ROC_BENCHMARK(pool_allocate_deallocate_batch) {
+    void* mem[BatchSize];
+
+    for (size_t n = 0; n < n_iters; n++) {
+        for (size_t i = 0; i < BatchSize; i++) {
+            mem[i] = object_pool.allocate();
+        }
+        for (size_t i = 0; i < BatchSize; i++) {
+            object_pool.deallocate(mem[i]);
+        }
+    }
+}
+
+ROC_BENCHMARK(heap_allocate_deallocate) {
+    for (size_t n = 0; n < n_iters; n++) {
+        void* mem = allocator.allocate(ObjectSize);
+        allocator.deallocate(mem);
+    }
+}
+
+} // namespace core
+} // namespace roc
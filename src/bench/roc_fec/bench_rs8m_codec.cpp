@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "bench.h"
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_fec/rs8m_encoder.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 1000 };
+
+core::HeapAllocator allocator;
+core::BufferPool<uint8_t> buffer_pool(allocator, PayloadSize, true);
+
+CodecConfig make_config() {
+    CodecConfig config;
+    config.scheme = packet::FEC_ReedSolomon_M8;
+    config.backend = CodecBackendRs8m;
+    return config;
+}
+
+core::Slice<uint8_t> make_buffer(uint8_t filler) {
+    core::Slice<uint8_t> buf = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    roc_panic_if_not(buf);
+    buf.resize(PayloadSize);
+    memset(buf.data(), filler, buf.size());
+    return buf;
+}
+
+} // namespace
+
+ROC_BENCHMARK_BYTES(rs8m_encode_block, NumSourcePackets* PayloadSize) {
+    Rs8mEncoder encoder(make_config(), buffer_pool, allocator);
+    roc_panic_if_not(encoder.valid());
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer((uint8_t)i);
+    }
+
+    for (size_t n = 0; n < n_iters; n++) {
+        roc_panic_if_not(
+            encoder.begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+            encoder.set(i, buffers[i]);
+        }
+        encoder.fill();
+        encoder.end();
+    }
+}
+
+ROC_BENCHMARK_BYTES(rs8m_decode_block_max_losses, NumSourcePackets* PayloadSize) {
+    Rs8mEncoder encoder(make_config(), buffer_pool, allocator);
+    roc_panic_if_not(encoder.valid());
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer((uint8_t)i);
+    }
+
+    roc_panic_if_not(encoder.begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        encoder.set(i, buffers[i]);
+    }
+    encoder.fill();
+    encoder.end();
+
+    Rs8mDecoder decoder(make_config(), buffer_pool, allocator);
+    roc_panic_if_not(decoder.valid());
+
+    for (size_t n = 0; n < n_iters; n++) {
+        roc_panic_if_not(
+            decoder.begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        // drop as many source packets as the code can repair
+        for (size_t i = NumRepairPackets; i < NumSourcePackets + NumRepairPackets;
+             i++) {
+            decoder.set(i, buffers[i]);
+        }
+
+        for (size_t i = 0; i < NumSourcePackets; i++) {
+            roc_panic_if_not(decoder.repair(i));
+        }
+
+        decoder.end();
+    }
+}
+
+} // namespace fec
+} // namespace roc
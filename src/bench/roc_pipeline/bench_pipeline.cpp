@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// End-to-end pipeline benchmarks.
+//
+// The sender is wired directly to the receiver through an in-memory queue,
+// so the whole chain (packetizer, FEC, parser, depacketizer, resampler,
+// mixer) runs flat-out, without sockets and without timing.
+//
+// One operation is one frame pushed through the pipeline. The sender-only
+// benchmark covers the sending half of the chain, so the receiving half
+// cost is the difference between it and the full-pipeline numbers;
+// finer-grained stage costs are covered by the per-module benchmarks.
+
+#include "bench.h"
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/panic.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_packet/queue.h"
+#include "roc_pipeline/receiver.h"
+#include "roc_pipeline/sender.h"
+#include "roc_rtp/format_map.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum {
+    MaxBufSize = 1000,
+
+    SampleRate = 44100,
+    ChMask = 0x3,
+    NumCh = 2,
+
+    SamplesPerFrame = 160,
+    SamplesPerPacket = 160,
+
+    SourcePackets = 20,
+    RepairPackets = 10,
+
+    Latency = SamplesPerPacket * SourcePackets,
+    Timeout = Latency * 100,
+
+    FrameBytes = SamplesPerFrame * NumCh * sizeof(audio::sample_t)
+};
+
+enum {
+    // default flags
+    FlagNone = 0,
+
+    // enable resampling on receiver
+    FlagResampling = (1 << 0),
+
+    // enable Reed-Solomon FEC scheme
+    FlagReedSolomon = (1 << 1)
+};
+
+core::HeapAllocator allocator;
+core::BufferPool<audio::sample_t> sample_buffer_pool(allocator, MaxBufSize, false);
+core::BufferPool<uint8_t> byte_buffer_pool(allocator, MaxBufSize, false);
+packet::PacketPool packet_pool(allocator, false);
+fec::CodecMap codec_map;
+rtp::FormatMap format_map;
+
+packet::Address new_address(int port) {
+    packet::Address addr;
+    roc_panic_if_not(addr.set_ipv4("127.0.0.1", port));
+    return addr;
+}
+
+SenderConfig sender_config(int flags) {
+    SenderConfig config;
+
+    config.input_channels = ChMask;
+    config.packet_length = SamplesPerPacket * core::Second / SampleRate;
+    config.internal_frame_size = MaxBufSize;
+
+    if (flags & FlagReedSolomon) {
+        config.fec_encoder.scheme = packet::FEC_ReedSolomon_M8;
+    }
+
+    config.fec_writer.n_source_packets = SourcePackets;
+    config.fec_writer.n_repair_packets = RepairPackets;
+
+    config.timing = false;
+    config.poisoning = false;
+
+    return config;
+}
+
+ReceiverConfig receiver_config(int flags) {
+    ReceiverConfig config;
+
+    config.common.output_sample_rate = SampleRate;
+    config.common.output_channels = ChMask;
+    config.common.internal_frame_size = MaxBufSize;
+
+    config.common.resampling = (flags & FlagResampling);
+    config.common.timing = false;
+    config.common.poisoning = false;
+
+    config.default_session.channels = ChMask;
+
+    config.default_session.target_latency = Latency * core::Second / SampleRate;
+    config.default_session.watchdog.no_playback_timeout =
+        Timeout * core::Second / SampleRate;
+
+    return config;
+}
+
+PortConfig source_port(int flags) {
+    PortConfig port_config;
+    if (flags & FlagReedSolomon) {
+        port_config.address = new_address(20);
+        port_config.protocol = Proto_RTP_RSm8_Source;
+    } else {
+        port_config.address = new_address(10);
+        port_config.protocol = Proto_RTP;
+    }
+    return port_config;
+}
+
+PortConfig repair_port(int flags) {
+    PortConfig port_config;
+    if (flags & FlagReedSolomon) {
+        port_config.address = new_address(21);
+        port_config.protocol = Proto_RSm8_Repair;
+    } else {
+        port_config.protocol = Proto_None;
+    }
+    return port_config;
+}
+
+// Sender wired to receiver through an in-memory packet queue.
+class Pipeline {
+public:
+    explicit Pipeline(int flags)
+        : sender_(sender_config(flags),
+                  source_port(flags),
+                  queue_,
+                  repair_port(flags),
+                  queue_,
+                  codec_map,
+                  format_map,
+                  packet_pool,
+                  byte_buffer_pool,
+                  sample_buffer_pool,
+                  allocator)
+        , receiver_(receiver_config(flags),
+                    codec_map,
+                    format_map,
+                    packet_pool,
+                    byte_buffer_pool,
+                    sample_buffer_pool,
+                    allocator) {
+        roc_panic_if_not(sender_.valid());
+        roc_panic_if_not(receiver_.valid());
+
+        receiver_.add_port(source_port(flags));
+        if (flags & FlagReedSolomon) {
+            receiver_.add_port(repair_port(flags));
+        }
+
+        memset(samples_, 0, sizeof(samples_));
+
+        // fill the receiver up to the target latency
+        for (size_t n = 0; n < Latency / SamplesPerFrame; n++) {
+            write_frame();
+            deliver_packets();
+        }
+    }
+
+    void write_frame() {
+        audio::Frame frame(samples_, SamplesPerFrame * NumCh);
+        sender_.write(frame);
+    }
+
+    void deliver_packets() {
+        while (packet::PacketPtr pp = queue_.read()) {
+            // deliver a copy, as if the packet was received from the network
+            packet::PacketPtr copy = new (packet_pool) packet::Packet(packet_pool);
+            roc_panic_if_not(copy);
+
+            copy->add_flags(packet::Packet::FlagUDP);
+            *copy->udp() = *pp->udp();
+            copy->set_data(pp->data());
+
+            receiver_.write(copy);
+        }
+    }
+
+    void read_frame() {
+        audio::Frame frame(samples_, SamplesPerFrame * NumCh);
+        receiver_.read(frame);
+    }
+
+private:
+    packet::Queue queue_;
+
+    Sender sender_;
+    Receiver receiver_;
+
+    audio::sample_t samples_[SamplesPerFrame * NumCh];
+};
+
+void run_pipeline(int flags, size_t n_iters) {
+    Pipeline pipeline(flags);
+
+    for (size_t n = 0; n < n_iters; n++) {
+        pipeline.write_frame();
+        pipeline.deliver_packets();
+        pipeline.read_frame();
+    }
+}
+
+} // namespace
+
+ROC_BENCHMARK_BYTES(pipeline_sender_write, FrameBytes) {
+    packet::Queue queue;
+
+    Sender sender(sender_config(FlagNone), source_port(FlagNone), queue,
+                  repair_port(FlagNone), queue, codec_map, format_map, packet_pool,
+                  byte_buffer_pool, sample_buffer_pool, allocator);
+    roc_panic_if_not(sender.valid());
+
+    audio::sample_t samples[SamplesPerFrame * NumCh];
+    memset(samples, 0, sizeof(samples));
+
+    for (size_t n = 0; n < n_iters; n++) {
+        audio::Frame frame(samples, SamplesPerFrame * NumCh);
+        sender.write(frame);
+
+        while (queue.read()) {
+        }
+    }
+}
+
+ROC_BENCHMARK_BYTES(pipeline_send_receive, FrameBytes) {
+    run_pipeline(FlagNone, n_iters);
+}
+
+ROC_BENCHMARK_BYTES(pipeline_send_receive_resampling, FrameBytes) {
+    run_pipeline(FlagResampling, n_iters);
+}
+
+#ifdef ROC_TARGET_OPENFEC
+ROC_BENCHMARK_BYTES(pipeline_send_receive_rs_fec, FrameBytes) {
+    run_pipeline(FlagReedSolomon, n_iters);
+}
+#endif // ROC_TARGET_OPENFEC
+
+} // namespace pipeline
+} // namespace roc
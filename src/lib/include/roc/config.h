@@ -94,11 +94,34 @@ typedef enum roc_packet_encoding {
 typedef enum roc_frame_encoding {
     /** PCM floats.
      * Uncompressed samples coded as floats in range [-1; 1].
-     * Channels are interleaved, e.g. two channels are encoded as "L R L R ...".
      */
-    ROC_FRAME_ENCODING_PCM_FLOAT = 1
+    ROC_FRAME_ENCODING_PCM_FLOAT = 1,
+
+    /** PCM 16-bit integers.
+     * Uncompressed samples coded as native-endian signed 16-bit integers.
+     * The conversion from the pipeline's native floats is performed by the
+     * library, so the application doesn't need its own conversion pass.
+     */
+    ROC_FRAME_ENCODING_PCM_INT16 = 2
 } roc_frame_encoding;
 
+/** Frame sample layout. */
+typedef enum roc_frame_layout {
+    /** Interleaved.
+     * Channels alternate within one buffer, e.g. two channels are laid
+     * out as "L R L R ...". This is the default.
+     */
+    ROC_FRAME_LAYOUT_INTERLEAVED = 0,
+
+    /** Planar.
+     * Each channel occupies its own contiguous plane inside the frame
+     * buffer, e.g. two channels are laid out as "L L ... R R ...". The
+     * deinterleaving is performed by the library during the final sample
+     * conversion, so the application doesn't need its own pass.
+     */
+    ROC_FRAME_LAYOUT_PLANAR = 1
+} roc_frame_layout;
+
 /** Channel set. */
 typedef enum roc_channel_set {
     /** Stereo.
@@ -144,6 +167,72 @@ typedef struct roc_context_config {
      * If zero, default value is used.
      */
     unsigned int max_frame_size;
+
+    /** Number of network packets to pre-allocate at context creation.
+     * Defines how many packets (and the byte buffers backing them) are reserved
+     * in the context pools up front, so that the pools don't grow on the live
+     * audio path during the first seconds of a stream. A reasonable value is
+     * the number of packets in flight across all expected sessions, e.g.
+     * packets per FEC block times the number of sessions.
+     * If zero, no packets are pre-allocated.
+     */
+    unsigned int prealloc_packets;
+
+    /** Number of audio frame buffers to pre-allocate at context creation.
+     * Defines how many intermediate internal frames are reserved in the context
+     * pools up front. A few frames per expected session is enough.
+     * If zero, no frames are pre-allocated.
+     */
+    unsigned int prealloc_frames;
+
+    /** Enable single-threaded mode.
+     * If non-zero, the context doesn't start the network thread. Instead, the
+     * user should regularly call roc_context_poll() to drive network I/O, and
+     * should use the context and all attached senders and receivers from the
+     * polling thread only. This removes a thread, its stack, and the
+     * cross-thread handoff of packets, which is useful on embedded devices
+     * where the application already has an event loop.
+     * Supported only with the default network backend.
+     * If zero, the network thread is started as usual.
+     */
+    unsigned int threadless;
+
+    /** Enable lazy network thread startup.
+     * If non-zero, the context doesn't start the network thread at creation.
+     * Instead, the thread is spawned when the first sender or receiver is
+     * bound to the network, and stopped again when the last one is closed.
+     * This removes the idle thread and its periodic wakeups from
+     * applications that open a context at initialization but stream only
+     * occasionally, e.g. plugin hosts.
+     * Supported only with the default network backend; ignored otherwise,
+     * and ignored in threadless mode.
+     * If zero, the network thread runs for the whole lifetime of the context.
+     */
+    unsigned int lazy_start;
+
+    /** Maximum memory in bytes for network packets.
+     * Caps the total amount of memory used by the packet pools of the context,
+     * shared by all attached senders and receivers. When the cap is reached,
+     * incoming packets are dropped instead of growing the pools, so a packet
+     * flood can't exhaust the memory of the whole process.
+     * If zero, the packet pools grow on demand without limit.
+     */
+    unsigned long long max_packet_memory;
+
+    /** Maximum memory in bytes for audio frames.
+     * Caps the total amount of memory used by the frame pool of the context.
+     * If zero, the frame pool grows on demand without limit.
+     */
+    unsigned long long max_frame_memory;
+
+    /** Maximum memory in bytes for everything else.
+     * Caps the total amount of memory used for sender and receiver sessions
+     * and other non-realtime allocations of the context. When the cap is
+     * reached, creation of new senders, receivers, and receiver sessions
+     * fails instead of growing the memory usage.
+     * If zero, the memory usage is not limited.
+     */
+    unsigned long long max_arena_memory;
 } roc_context_config;
 
 /** Sender configuration.
@@ -193,6 +282,15 @@ typedef struct roc_sender_config {
      */
     unsigned long long packet_length;
 
+    /** DSCP value for outgoing packets.
+     * If non-zero, outgoing packets are marked with this DSCP value (via
+     * IPv4 TOS and IPv6 traffic class), so that DiffServ-aware networks
+     * can prioritize them, e.g. 46 (EF) for low-latency audio.
+     * Should be in range [0; 63].
+     * If zero, the default traffic class is used.
+     */
+    unsigned int packet_dscp;
+
     /** Enable packet interleaving.
      * If non-zero, the sender shuffles packets before sending them. This
      * may increase robustness but also increases latency.
@@ -231,6 +329,14 @@ typedef struct roc_sender_config {
      * If zero, default value is used.
      */
     unsigned int fec_block_repair_packets;
+
+    /** The sample layout of the frames passed to sender.
+     * If @c ROC_FRAME_LAYOUT_PLANAR, each frame carries one plane per
+     * channel instead of interleaved samples; see roc_frame_layout.
+     * Applied to roc_sender_write() and roc_sender_write_batch().
+     * If zero (@c ROC_FRAME_LAYOUT_INTERLEAVED), the default layout is used.
+     */
+    roc_frame_layout frame_layout;
 } roc_sender_config;
 
 /** Receiver configuration.
@@ -313,8 +419,111 @@ typedef struct roc_receiver_config {
      * @see broken_playback_timeout.
      */
     unsigned long long breakage_detection_window;
+
+    /** Enable per-session CPU accounting.
+     * If non-zero, the receiver measures the CPU time consumed by every session
+     * pipeline and reports it via roc_receiver_get_stats(). Adds two clock
+     * queries per session per frame.
+     */
+    unsigned int enable_profiling;
+
+    /** Enable unmixed mode.
+     * If non-zero, the receiver doesn't mix sessions into a single stream.
+     * Instead, every connected sender is exposed as an individually readable
+     * stream via roc_receiver_read_sessions(), and roc_receiver_read() may
+     * not be used. Useful for multi-track capture of several senders over a
+     * single port. Clock drift is still compensated per stream if resampling
+     * is enabled.
+     */
+    unsigned int unmixed_mode;
+
+    /** The sample layout of the frames returned to the user.
+     * If @c ROC_FRAME_LAYOUT_PLANAR, each frame carries one plane per
+     * channel instead of interleaved samples; see roc_frame_layout.
+     * Applied to roc_receiver_read() and roc_receiver_try_read().
+     * If zero (@c ROC_FRAME_LAYOUT_INTERLEAVED), the default layout is used.
+     */
+    roc_frame_layout frame_layout;
 } roc_receiver_config;
 
+/** Statistics structure version filled by the library.
+ * @see roc_sender_stats, roc_receiver_stats.
+ */
+#define ROC_STATS_VERSION 2
+
+/** Sender statistics.
+ * Filled by roc_sender_get_stats(). New fields may be appended to this structure
+ * in future versions; check the @c version field to learn which fields are filled.
+ */
+typedef struct roc_sender_stats {
+    /** Version of the structure layout filled by the library.
+     * Set to @c ROC_STATS_VERSION.
+     */
+    unsigned int version;
+
+    /** Number of packets composed and sent since the sender was opened. */
+    unsigned long long num_packets;
+
+    /** Number of samples encoded since the sender was opened.
+     * Counted per channel, i.e. one stereo frame of N samples adds N / 2.
+     */
+    unsigned long long num_samples;
+} roc_sender_stats;
+
+/** Receiver statistics.
+ * Filled by roc_receiver_get_stats(). Counters are aggregated over the currently
+ * connected sessions. New fields may be appended to this structure in future
+ * versions; check the @c version field to learn which fields are filled.
+ */
+typedef struct roc_receiver_stats {
+    /** Version of the structure layout filled by the library.
+     * Set to @c ROC_STATS_VERSION.
+     */
+    unsigned int version;
+
+    /** Number of currently connected sessions. */
+    unsigned int num_sessions;
+
+    /** Network incoming queue latency, in samples per channel.
+     * The maximum over the connected sessions. Zero if there are no sessions.
+     */
+    unsigned long long niq_latency;
+
+    /** Number of source packets lost in the network, as observed by the
+     * FEC decoders of the connected sessions.
+     */
+    unsigned long long lost_packets;
+
+    /** Number of lost source packets that were restored by the FEC decoders
+     * of the connected sessions.
+     */
+    unsigned long long recovered_packets;
+
+    /** Number of samples that were missing at the time of decoding and were
+     * replaced with zeros, counted per channel over the connected sessions.
+     */
+    unsigned long long missing_samples;
+
+    /** Resampler scaling factor, averaged over the connected sessions.
+     * Values below one mean that the senders clocks run slower than the
+     * receiver clock, and vice versa. Zero if resampling is disabled or
+     * there are no sessions.
+     */
+    float resampler_scaling;
+
+    /** CPU time consumed by the session pipelines, in nanoseconds, summed
+     * over the connected sessions. Zero unless @c enable_profiling was set.
+     * Present since version 2.
+     */
+    unsigned long long session_cpu_time;
+
+    /** CPU time consumed by the most expensive connected session, in
+     * nanoseconds. Zero unless @c enable_profiling was set.
+     * Present since version 2.
+     */
+    unsigned long long max_session_cpu_time;
+} roc_receiver_stats;
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -71,6 +71,32 @@ ROC_API roc_context* roc_context_open(const roc_context_config* config);
  */
 ROC_API int roc_context_close(roc_context* context);
 
+/** Poll the context network event loop.
+ *
+ * Runs one non-blocking iteration of the network event loop on the calling
+ * thread: receives pending packets and passes them to the attached receivers,
+ * and sends packets queued by the attached senders.
+ *
+ * Should be called only if the context was opened with the @c threadless field
+ * of @c roc_context_config set. In that mode no network thread exists, so the
+ * user should call this function regularly, e.g. once per frame period from
+ * the application event loop; the sender and receiver pipelines already run
+ * inside the write and read operations, hence the whole stack runs on the
+ * user thread.
+ *
+ * In threadless mode the context and all attached senders and receivers
+ * should be used from the same thread that calls this function.
+ *
+ * @b Parameters
+ *  - @p context should point to an opened context in threadless mode
+ *
+ * @b Returns
+ *  - returns zero if the iteration was performed
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the context is not in threadless mode
+ */
+ROC_API int roc_context_poll(roc_context* context);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -30,8 +30,8 @@ extern "C" {
  */
 typedef struct roc_frame {
     /** Audio samples.
-     * Sample rate, channel set, and encoding are defined by the sender or
-     * receiver parameters.
+     * Sample rate, channel set, encoding, and layout are defined by the
+     * sender or receiver parameters.
      */
     void* samples;
 
@@ -164,6 +164,9 @@ ROC_API int roc_receiver_bind(roc_receiver* receiver,
  * packets, decodes samples, resamples and mixes them, and finally stores samples into the
  * provided frame.
  *
+ * The operation is zero-copy with respect to the provided buffer: the session streams
+ * are decoded and mixed directly into it, without an intermediate library-side frame.
+ *
  * If the automatic timing is enabled, the function blocks until it's time to decode the
  * samples according to the configured sample rate.
  *
@@ -179,6 +182,135 @@ ROC_API int roc_receiver_bind(roc_receiver* receiver,
  */
 ROC_API int roc_receiver_read(roc_receiver* receiver, roc_frame* frame);
 
+/** Try to read samples from the receiver without blocking on the stream.
+ *
+ * Behaves like roc_receiver_read() if the receiver is active, i.e. at least one
+ * session is connected or packets are waiting to be routed. If the receiver is
+ * inactive and roc_receiver_read() would only produce silence, returns without
+ * touching the frame.
+ *
+ * Intended for applications that multiplex many streams on one thread: inactive
+ * receivers are skipped cheaply, and roc_receiver_set_ready_callback() tells when
+ * to start polling one again. Automatic timing should be disabled, otherwise the
+ * function still blocks on the configured sample rate when the receiver is active.
+ *
+ * @b Parameters
+ *  - @p receiver should point to an opened receiver
+ *  - @p frame should point to an initialized frame which will be filled with samples;
+ *    the number of samples is defined by the frame size
+ *
+ * @b Returns
+ *  - returns one if the frame was filled with samples
+ *  - returns zero if the receiver is inactive and the frame was not touched
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_receiver_try_read(roc_receiver* receiver, roc_frame* frame);
+
+/** Frame readiness callback.
+ * @see roc_receiver_set_ready_callback.
+ */
+typedef void (*roc_receiver_ready_callback)(void* arg);
+
+/** Set a callback invoked when the receiver becomes active.
+ *
+ * The callback is invoked with the given argument whenever the receiver transitions
+ * from inactive to active, i.e. a packet arrives while there were no sessions and no
+ * queued packets. Together with roc_receiver_try_read(), it allows one application
+ * thread to multiplex many receivers: park a receiver when roc_receiver_try_read()
+ * returns zero and resume reading it when the callback fires.
+ *
+ * The callback is dispatched from the context network worker thread and should not
+ * block. May be called at any time; passing NULL removes the callback.
+ *
+ * @b Parameters
+ *  - @p receiver should point to an opened receiver
+ *  - @p callback is the function to invoke, or NULL
+ *  - @p callback_arg is an opaque argument passed to the callback
+ *
+ * @b Returns
+ *  - returns zero if the callback was successfully set
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_receiver_set_ready_callback(roc_receiver* receiver,
+                                            roc_receiver_ready_callback callback,
+                                            void* callback_arg);
+
+/** Read multiple frames from the receiver.
+ *
+ * Behaves like a sequence of roc_receiver_read() calls, one per frame, but acquires
+ * the receiver pipeline lock once for the whole batch instead of once per frame,
+ * which reduces the locking overhead when the user reads many small frames.
+ *
+ * If the automatic timing is enabled, the function blocks until it's time to decode
+ * every next frame according to the configured sample rate.
+ *
+ * The frames are validated before any of them is decoded: if some frame in the array
+ * is invalid, the function fails without reading anything.
+ *
+ * @b Parameters
+ *  - @p receiver should point to an opened receiver
+ *  - @p frames should point to an array of initialized frames which will be filled
+ *    with samples; frames with zero size are skipped
+ *  - @p n_frames defines the number of frames in the array
+ *
+ * @b Returns
+ *  - returns zero if all samples were successfully decoded
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if there are not enough resources
+ */
+ROC_API int
+roc_receiver_read_batch(roc_receiver* receiver, roc_frame* frames, size_t n_frames);
+
+/** Read one frame from each session, without mixing.
+ *
+ * May be used instead of roc_receiver_read() when the unmixed mode is enabled in the
+ * receiver configuration. Runs one decoding cycle and fills up to @p n_frames frames,
+ * one per connected session, so that every sender is captured as a separate track.
+ * If @p addresses is not NULL, its n-th element is set to the address of the sender
+ * the n-th frame came from, which allows to associate frames with senders as sessions
+ * come and go.
+ *
+ * If there are more sessions than frames, the extra sessions are still decoded, so
+ * that their streams keep advancing, but their samples are dropped. All frames should
+ * have the same size.
+ *
+ * If the automatic timing is enabled, the function blocks until it's time to decode
+ * the next frame according to the configured sample rate.
+ *
+ * @b Parameters
+ *  - @p receiver should point to an opened receiver with the unmixed mode enabled
+ *  - @p frames should point to an array of initialized equally sized frames which
+ *    will be filled with samples; may be NULL if @p n_frames is zero
+ *  - @p addresses should point to an array of @p n_frames address structs which will
+ *    be filled with the sender addresses, or be NULL if they are not needed
+ *  - @p n_frames defines the number of frames in the array
+ *
+ * @b Returns
+ *  - returns the non-negative number of frames actually filled if no error occurred
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the unmixed mode is not enabled
+ */
+ROC_API int roc_receiver_read_sessions(roc_receiver* receiver,
+                                       roc_frame* frames,
+                                       roc_address* addresses,
+                                       size_t n_frames);
+
+/** Get receiver statistics.
+ *
+ * Fills the provided structure with counters aggregated over the currently connected
+ * sessions. The function is cheap and may be polled frequently, e.g. every 100 ms;
+ * it doesn't block the decoding.
+ *
+ * @b Parameters
+ *  - @p receiver should point to an opened receiver
+ *  - @p stats should point to a statistics structure which will be filled
+ *
+ * @b Returns
+ *  - returns zero if the statistics were successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_receiver_get_stats(roc_receiver* receiver, roc_receiver_stats* stats);
+
 /** Close the receiver.
  *
  * Deinitializes and deallocates the receiver, and detaches it from the context. The user
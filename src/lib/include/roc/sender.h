@@ -139,6 +139,12 @@ ROC_API int roc_sender_bind(roc_sender* sender, roc_address* address);
  * before calling roc_sender_write() first time. The @p type and @p proto should be
  * the same as they are set at the receiver for this port.
  *
+ * Calling it multiple times with the same port type adds extra destinations for
+ * that port: the stream is encoded only once and every packet is sent to all
+ * connected receivers. Extra destinations should use the same protocol as the
+ * first one, and, when FEC is enabled, the same number of source and repair
+ * ports should be connected.
+ *
  * @b Parameters
  *  - @p sender should point to an opened sender
  *  - @p type specifies the receiver port type
@@ -164,6 +170,9 @@ ROC_API int roc_sender_connect(roc_sender* sender,
  * samples according to the configured sample rate. The function returns after encoding
  * and enqueuing the packets, without waiting when the packets are actually transmitted.
  *
+ * The operation is zero-copy with respect to the provided buffer: samples are encoded
+ * into packets directly from it, without an intermediate library-side frame.
+ *
  * @b Parameters
  *  - @p sender should point to an opened, bound, and connected sender
  *  - @p frame should point to a valid frame with an array of samples to send
@@ -176,6 +185,48 @@ ROC_API int roc_sender_connect(roc_sender* sender,
  */
 ROC_API int roc_sender_write(roc_sender* sender, const roc_frame* frame);
 
+/** Encode multiple frames to packets and transmit them to the receiver.
+ *
+ * Behaves like a sequence of roc_sender_write() calls, one per frame, but acquires
+ * the sender lock once for the whole batch instead of once per frame, which reduces
+ * the locking overhead when the user writes many small frames.
+ *
+ * If the automatic timing is enabled, the function blocks until it's time to encode
+ * every next frame according to the configured sample rate.
+ *
+ * The frames are validated before any of them is encoded: if some frame in the array
+ * is invalid, the function fails without writing anything.
+ *
+ * @b Parameters
+ *  - @p sender should point to an opened, bound, and connected sender
+ *  - @p frames should point to an array of valid frames with samples to send;
+ *    frames with zero size are skipped
+ *  - @p n_frames defines the number of frames in the array
+ *
+ * @b Returns
+ *  - returns zero if all samples were successfully encoded and enqueued
+ *  - returns a negative value if the arguments are invalid
+ *  - returns a negative value if the sender is not bound or connected
+ *  - returns a negative value if there are not enough resources
+ */
+ROC_API int
+roc_sender_write_batch(roc_sender* sender, const roc_frame* frames, size_t n_frames);
+
+/** Get sender statistics.
+ *
+ * Fills the provided structure with the sender counters. The function is cheap and
+ * may be polled frequently, e.g. every 100 ms; it doesn't block the encoding.
+ *
+ * @b Parameters
+ *  - @p sender should point to an opened sender
+ *  - @p stats should point to a statistics structure which will be filled
+ *
+ * @b Returns
+ *  - returns zero if the statistics were successfully retrieved
+ *  - returns a negative value if the arguments are invalid
+ */
+ROC_API int roc_sender_get_stats(roc_sender* sender, roc_sender_stats* stats);
+
 /** Close the sender.
  *
  * Deinitializes and deallocates the sender, and detaches it from the context. The user
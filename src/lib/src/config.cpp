@@ -27,6 +27,23 @@ bool make_context_config(roc_context_config& out, const roc_context_config& in)
         out.max_frame_size = 4096;
     }
 
+    out.prealloc_packets = in.prealloc_packets;
+    out.prealloc_frames = in.prealloc_frames;
+
+#if defined(ROC_TARGET_IO_URING) || defined(ROC_TARGET_AFXDP)
+    if (in.threadless) {
+        roc_log(LogError,
+                "roc_config: threadless mode is not supported by this network backend");
+        return false;
+    }
+#endif
+    out.threadless = in.threadless;
+    out.lazy_start = in.lazy_start;
+
+    out.max_packet_memory = in.max_packet_memory;
+    out.max_frame_memory = in.max_frame_memory;
+    out.max_arena_memory = in.max_arena_memory;
+
     return true;
 }
 
@@ -43,7 +60,8 @@ bool make_sender_config(pipeline::SenderConfig& out, const roc_sender_config& in
         return false;
     }
 
-    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT
+        && in.frame_encoding != ROC_FRAME_ENCODING_PCM_INT16) {
         roc_log(LogError, "roc_config: invalid frame_encoding");
         return false;
     }
@@ -69,6 +87,12 @@ bool make_sender_config(pipeline::SenderConfig& out, const roc_sender_config& in
         out.packet_length = (core::nanoseconds_t)in.packet_length;
     }
 
+    if (in.packet_dscp > 63) {
+        roc_log(LogError, "roc_config: invalid packet_dscp, should be in range [0; 63]");
+        return false;
+    }
+    out.dscp = in.packet_dscp;
+
     out.interleaving = in.packet_interleaving;
     out.timing = in.automatic_timing;
 
@@ -129,13 +153,18 @@ bool make_receiver_config(pipeline::ReceiverConfig& out, const roc_receiver_conf
         return false;
     }
 
-    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT) {
+    if (in.frame_encoding != ROC_FRAME_ENCODING_PCM_FLOAT
+        && in.frame_encoding != ROC_FRAME_ENCODING_PCM_INT16) {
         roc_log(LogError, "roc_config: invalid frame_encoding");
         return false;
     }
 
     out.common.timing = in.automatic_timing;
 
+    out.common.profiling = (in.enable_profiling != 0);
+
+    out.common.unmixed = (in.unmixed_mode != 0);
+
     out.common.resampling = (in.resampler_profile != ROC_RESAMPLER_DISABLE);
 
     switch ((int)in.resampler_profile) {
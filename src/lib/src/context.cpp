@@ -13,11 +13,39 @@
 using namespace roc;
 
 roc_context::roc_context(const roc_context_config& cfg)
-    : packet_pool(allocator, false)
-    , byte_buffer_pool(allocator, cfg.max_packet_size, false)
-    , sample_buffer_pool(allocator, cfg.max_frame_size / sizeof(audio::sample_t), false)
-    , trx(packet_pool, byte_buffer_pool, allocator)
+    : packet_quota((size_t)cfg.max_packet_memory)
+    , frame_quota((size_t)cfg.max_frame_memory)
+    , arena_quota((size_t)cfg.max_arena_memory)
+    , allocator(heap_allocator)
+    , packet_allocator(allocator, "packets")
+    , audio_allocator(allocator, "audio")
+    , netio_allocator(allocator, "netio")
+    , pipeline_allocator(allocator, "pipeline")
+    , packet_pool(packet_allocator, false)
+    , byte_buffer_pool(packet_allocator, cfg.max_packet_size, false)
+    , sample_buffer_pool(audio_allocator,
+                         cfg.max_frame_size / sizeof(audio::sample_t),
+                         false)
+#if defined(ROC_TARGET_IO_URING) || defined(ROC_TARGET_AFXDP)
+    // threadless mode is rejected for these backends in make_context_config(),
+    // and lazy startup is not supported by them, so it's ignored
+    , trx(packet_pool, byte_buffer_pool, netio_allocator)
+#else
+    , trx(packet_pool,
+          byte_buffer_pool,
+          netio_allocator,
+          -1,
+          cfg.threadless != 0,
+          cfg.lazy_start != 0)
+#endif
+    , threadless(cfg.threadless != 0)
     , counter(0) {
+    // the packet pool and the byte buffer pool back the same packets, so
+    // they share one quota covering both
+    allocator.set_quota(arena_quota);
+    packet_pool.set_quota(packet_quota);
+    byte_buffer_pool.set_quota(packet_quota);
+    sample_buffer_pool.set_quota(frame_quota);
 }
 
 roc_context* roc_context_open(const roc_context_config* config) {
@@ -47,9 +75,51 @@ roc_context* roc_context_open(const roc_context_config* config) {
         return NULL;
     }
 
+    // reserve pool chunks up front, so that pools don't grow on the live
+    // audio path once streaming has started
+    if (private_config.prealloc_packets != 0) {
+        if (!context->packet_pool.reserve(private_config.prealloc_packets)
+            || !context->byte_buffer_pool.reserve(private_config.prealloc_packets)) {
+            roc_log(LogError, "roc_context_open: can't pre-allocate packets");
+
+            delete context;
+            return NULL;
+        }
+    }
+
+    if (private_config.prealloc_frames != 0) {
+        if (!context->sample_buffer_pool.reserve(private_config.prealloc_frames)) {
+            roc_log(LogError, "roc_context_open: can't pre-allocate frames");
+
+            delete context;
+            return NULL;
+        }
+    }
+
     return context;
 }
 
+int roc_context_poll(roc_context* context) {
+    if (!context) {
+        roc_log(LogError, "roc_context_poll: invalid arguments: context is null");
+        return -1;
+    }
+
+    if (!context->threadless) {
+        roc_log(LogError, "roc_context_poll: context is not in threadless mode");
+        return -1;
+    }
+
+#if defined(ROC_TARGET_IO_URING) || defined(ROC_TARGET_AFXDP)
+    // unreachable: threadless mode is rejected for these backends
+    return -1;
+#else
+    context->trx.poll();
+
+    return 0;
+#endif
+}
+
 int roc_context_close(roc_context* context) {
     if (!context) {
         roc_log(LogError, "roc_context_close: invalid arguments: context is null");
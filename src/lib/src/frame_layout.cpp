@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "frame_layout.h"
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+using namespace roc;
+
+namespace {
+
+inline int16_t sample_to_int16(audio::sample_t s) {
+    s *= 32768.0f;
+    s = std::min(s, +32767.0f);
+    s = std::max(s, -32768.0f);
+    return (int16_t)s;
+}
+
+inline audio::sample_t sample_from_int16(int16_t s) {
+    return audio::sample_t(s) / 32768.0f;
+}
+
+} // namespace
+
+bool make_frame_layout(frame_layout& out,
+                       roc_frame_encoding encoding,
+                       roc_frame_layout layout,
+                       size_t num_channels) {
+    if (encoding != ROC_FRAME_ENCODING_PCM_FLOAT
+        && encoding != ROC_FRAME_ENCODING_PCM_INT16) {
+        roc_log(LogError, "roc_config: invalid frame_encoding");
+        return false;
+    }
+
+    if (layout != ROC_FRAME_LAYOUT_INTERLEAVED && layout != ROC_FRAME_LAYOUT_PLANAR) {
+        roc_log(LogError, "roc_config: invalid frame_layout");
+        return false;
+    }
+
+    out.encoding = encoding;
+    out.layout = layout;
+    out.num_channels = num_channels;
+
+    return true;
+}
+
+bool frame_layout_is_native(const frame_layout& fl) {
+    return fl.encoding == ROC_FRAME_ENCODING_PCM_FLOAT
+        && fl.layout == ROC_FRAME_LAYOUT_INTERLEAVED;
+}
+
+size_t frame_layout_sample_size(const frame_layout& fl) {
+    switch ((int)fl.encoding) {
+    case ROC_FRAME_ENCODING_PCM_FLOAT:
+        return sizeof(float);
+    case ROC_FRAME_ENCODING_PCM_INT16:
+        return sizeof(int16_t);
+    }
+
+    roc_panic("frame layout: unexpected encoding");
+}
+
+void frame_layout_export(const frame_layout& fl,
+                         const audio::sample_t* in,
+                         void* out_frame,
+                         size_t frame_sz,
+                         size_t chunk_off,
+                         size_t chunk_sz) {
+    const bool int16 = (fl.encoding == ROC_FRAME_ENCODING_PCM_INT16);
+
+    if (fl.layout == ROC_FRAME_LAYOUT_INTERLEAVED) {
+        if (int16) {
+            int16_t* out = (int16_t*)out_frame + chunk_off;
+            for (size_t n = 0; n < chunk_sz; n++) {
+                out[n] = sample_to_int16(in[n]);
+            }
+        } else {
+            float* out = (float*)out_frame + chunk_off;
+            for (size_t n = 0; n < chunk_sz; n++) {
+                out[n] = in[n];
+            }
+        }
+        return;
+    }
+
+    const size_t plane_sz = frame_sz / fl.num_channels;
+
+    size_t ch = chunk_off % fl.num_channels;
+    size_t pos = chunk_off / fl.num_channels;
+
+    for (size_t n = 0; n < chunk_sz; n++) {
+        const size_t index = ch * plane_sz + pos;
+
+        if (int16) {
+            ((int16_t*)out_frame)[index] = sample_to_int16(in[n]);
+        } else {
+            ((float*)out_frame)[index] = in[n];
+        }
+
+        if (++ch == fl.num_channels) {
+            ch = 0;
+            pos++;
+        }
+    }
+}
+
+void frame_layout_import(const frame_layout& fl,
+                         const void* in_frame,
+                         audio::sample_t* out,
+                         size_t frame_sz,
+                         size_t chunk_off,
+                         size_t chunk_sz) {
+    const bool int16 = (fl.encoding == ROC_FRAME_ENCODING_PCM_INT16);
+
+    if (fl.layout == ROC_FRAME_LAYOUT_INTERLEAVED) {
+        if (int16) {
+            const int16_t* in = (const int16_t*)in_frame + chunk_off;
+            for (size_t n = 0; n < chunk_sz; n++) {
+                out[n] = sample_from_int16(in[n]);
+            }
+        } else {
+            const float* in = (const float*)in_frame + chunk_off;
+            for (size_t n = 0; n < chunk_sz; n++) {
+                out[n] = in[n];
+            }
+        }
+        return;
+    }
+
+    const size_t plane_sz = frame_sz / fl.num_channels;
+
+    size_t ch = chunk_off % fl.num_channels;
+    size_t pos = chunk_off / fl.num_channels;
+
+    for (size_t n = 0; n < chunk_sz; n++) {
+        const size_t index = ch * plane_sz + pos;
+
+        if (int16) {
+            out[n] = sample_from_int16(((const int16_t*)in_frame)[index]);
+        } else {
+            out[n] = ((const float*)in_frame)[index];
+        }
+
+        if (++ch == fl.num_channels) {
+            ch = 0;
+            pos++;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ROC_FRAME_LAYOUT_H_
+#define ROC_FRAME_LAYOUT_H_
+
+#include "roc/config.h"
+
+#include "roc_audio/units.h"
+#include "roc_core/stddefs.h"
+
+// Describes the sample format of the frames exchanged with the user and
+// converts between it and the pipeline's native format (interleaved floats).
+// The conversion is the single pass that lands the samples exactly as the
+// application needs them, instead of the application converting afterwards.
+struct frame_layout {
+    roc_frame_encoding encoding;
+    roc_frame_layout layout;
+    size_t num_channels;
+};
+
+// Validate and fill the layout; returns false on unknown encoding or layout.
+bool make_frame_layout(frame_layout& out,
+                       roc_frame_encoding encoding,
+                       roc_frame_layout layout,
+                       size_t num_channels);
+
+// Check if user frames match the pipeline format and need no conversion.
+bool frame_layout_is_native(const frame_layout& fl);
+
+// Get the size of one user sample in bytes.
+size_t frame_layout_sample_size(const frame_layout& fl);
+
+// Convert a chunk of pipeline samples into a user frame.
+// The user frame holds frame_sz samples in total; the chunk covers positions
+// [chunk_off; chunk_off + chunk_sz) in pipeline (interleaved) order. For
+// planar layouts the chunk is scattered into the per-channel planes.
+void frame_layout_export(const frame_layout& fl,
+                         const roc::audio::sample_t* in,
+                         void* out_frame,
+                         size_t frame_sz,
+                         size_t chunk_off,
+                         size_t chunk_sz);
+
+// Convert a chunk of a user frame into pipeline samples; the inverse of
+// frame_layout_export().
+void frame_layout_import(const frame_layout& fl,
+                         const void* in_frame,
+                         roc::audio::sample_t* out,
+                         size_t frame_sz,
+                         size_t chunk_off,
+                         size_t chunk_sz);
+
+#endif // ROC_FRAME_LAYOUT_H_
@@ -14,12 +14,20 @@
 #include "roc/receiver.h"
 #include "roc/sender.h"
 
+#include "frame_layout.h"
+
 #include "roc_audio/units.h"
+#include "roc_core/array.h"
 #include "roc_core/atomic.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/mem_quota.h"
 #include "roc_core/mutex.h"
+#include "roc_core/profiled_allocator.h"
+#include "roc_core/slab_allocator.h"
+#include "roc_core/slice.h"
 #include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
 #include "roc_netio/transceiver.h"
 #include "roc_packet/address.h"
 #include "roc_packet/iwriter.h"
@@ -45,7 +53,32 @@ bool make_port_config(roc::pipeline::PortConfig& out,
 struct roc_context {
     roc_context(const roc_context_config& cfg);
 
-    roc::core::HeapAllocator allocator;
+    roc::core::HeapAllocator heap_allocator;
+
+    // byte caps for the pools and the arena allocator, zero if unlimited
+    // (see roc_context_config); declared before their consumers so that
+    // they're destroyed last
+    roc::core::MemQuota packet_quota;
+    roc::core::MemQuota frame_quota;
+    roc::core::MemQuota arena_quota;
+
+    // serves all mixed-size allocations made during sender/receiver setup
+    // and teardown from size-class free lists, so that session churn
+    // doesn't fragment the heap during long uptimes
+    roc::core::SlabAllocator allocator;
+
+    // tagged per-subsystem views of the allocator, so that memory usage
+    // is attributable; pure passthrough unless the ROC_MEMORY_PROFILING
+    // environment variable is set (see core::ProfiledAllocator)
+    roc::core::ProfiledAllocator packet_allocator;
+    roc::core::ProfiledAllocator audio_allocator;
+    roc::core::ProfiledAllocator netio_allocator;
+    roc::core::ProfiledAllocator pipeline_allocator;
+
+    // shared by all senders and receivers attached to the context;
+    // immutable after construction, so no locking is needed
+    roc::fec::CodecMap codec_map;
+    roc::rtp::FormatMap format_map;
 
     roc::packet::PacketPool packet_pool;
     roc::core::BufferPool<uint8_t> byte_buffer_pool;
@@ -53,6 +86,10 @@ struct roc_context {
 
     roc::netio::Transceiver trx;
 
+    // in threadless mode no network thread is started and the user drives
+    // the transceiver event loop via roc_context_poll()
+    const bool threadless;
+
     roc::core::Atomic counter;
 };
 
@@ -61,14 +98,14 @@ struct roc_sender {
 
     roc_context& context;
 
-    roc::fec::CodecMap codec_map;
-    roc::rtp::FormatMap format_map;
-
     roc::pipeline::SenderConfig config;
 
     roc::pipeline::PortConfig source_port;
     roc::pipeline::PortConfig repair_port;
 
+    roc::core::Array<roc::pipeline::PortConfig> extra_source_ports;
+    roc::core::Array<roc::pipeline::PortConfig> extra_repair_ports;
+
     roc::core::UniquePtr<roc::pipeline::Sender> sender;
     roc::packet::IWriter* writer;
 
@@ -77,6 +114,11 @@ struct roc_sender {
     roc::core::Mutex mutex;
 
     size_t num_channels;
+
+    // layout of the frames passed by the user; non-native layouts are
+    // converted into conv_frame before entering the pipeline
+    frame_layout layout;
+    roc::core::Slice<roc::audio::sample_t> conv_frame;
 };
 
 struct roc_receiver {
@@ -84,12 +126,18 @@ struct roc_receiver {
 
     roc_context& context;
 
-    roc::fec::CodecMap codec_map;
-    roc::rtp::FormatMap format_map;
-
     roc::pipeline::Receiver receiver;
 
     size_t num_channels;
+
+    // reads go through roc_receiver_read_sessions() instead of
+    // roc_receiver_read() (see roc_receiver_config::unmixed_mode)
+    const bool unmixed;
+
+    // layout of the frames returned to the user; non-native layouts are
+    // read into conv_frame and converted on the way out
+    frame_layout layout;
+    roc::core::Slice<roc::audio::sample_t> conv_frame;
 };
 
 #endif // ROC_PRIVATE_H_
@@ -22,18 +22,52 @@ void receiver_close_port(void* arg, const pipeline::PortConfig& port) {
     receiver->context.trx.remove_port(port.address);
 }
 
+void receiver_read_frame(roc_receiver* receiver, roc_frame* frame) {
+    const size_t total = frame->samples_size / frame_layout_sample_size(receiver->layout);
+
+    if (frame_layout_is_native(receiver->layout)) {
+        audio::Frame audio_frame((audio::sample_t*)frame->samples, total);
+        receiver->receiver.read(audio_frame);
+        return;
+    }
+
+    // read into the scratch frame and let the final conversion land the
+    // samples in the user's layout, without an app-side pass
+    size_t off = 0;
+
+    while (off < total) {
+        size_t chunk = receiver->conv_frame.size();
+        if (chunk > total - off) {
+            chunk = total - off;
+        }
+
+        audio::Frame audio_frame(receiver->conv_frame.data(), chunk);
+        receiver->receiver.read(audio_frame);
+
+        frame_layout_export(receiver->layout, receiver->conv_frame.data(),
+                            frame->samples, total, off, chunk);
+
+        off += chunk;
+    }
+}
+
 } // namespace
 
 roc_receiver::roc_receiver(roc_context& ctx, pipeline::ReceiverConfig& cfg)
     : context(ctx)
     , receiver(cfg,
-               codec_map,
-               format_map,
+               ctx.codec_map,
+               ctx.format_map,
                context.packet_pool,
                context.byte_buffer_pool,
                context.sample_buffer_pool,
-               context.allocator)
-    , num_channels(packet::num_channels(cfg.common.output_channels)) {
+               context.pipeline_allocator)
+    , num_channels(packet::num_channels(cfg.common.output_channels))
+    , unmixed(cfg.common.unmixed) {
+    // native layout until negotiated in roc_receiver_open()
+    layout.encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+    layout.layout = ROC_FRAME_LAYOUT_INTERLEAVED;
+    layout.num_channels = num_channels;
 }
 
 roc_receiver* roc_receiver_open(roc_context* context, const roc_receiver_config* config) {
@@ -55,9 +89,16 @@ roc_receiver* roc_receiver_open(roc_context* context, const roc_receiver_config*
         return NULL;
     }
 
-    core::UniquePtr<roc_receiver> receiver(new (context->allocator)
+    frame_layout layout;
+    if (!make_frame_layout(layout, config->frame_encoding, config->frame_layout,
+                           packet::num_channels(private_config.common.output_channels))) {
+        roc_log(LogError, "roc_receiver_open: invalid arguments: bad config");
+        return NULL;
+    }
+
+    core::UniquePtr<roc_receiver> receiver(new (context->pipeline_allocator)
                                                roc_receiver(*context, private_config),
-                                           context->allocator);
+                                           context->pipeline_allocator);
 
     if (!receiver) {
         roc_log(LogError, "roc_receiver_open: can't allocate receiver pipeline");
@@ -69,6 +110,24 @@ roc_receiver* roc_receiver_open(roc_context* context, const roc_receiver_config*
         return NULL;
     }
 
+    receiver->layout = layout;
+
+    if (!frame_layout_is_native(layout)) {
+        // non-native frames are read into a scratch frame first and the
+        // final conversion lands them in the user's layout in one pass
+        receiver->conv_frame = core::Slice<audio::sample_t>(
+            new (context->sample_buffer_pool)
+                core::Buffer<audio::sample_t>(context->sample_buffer_pool));
+
+        if (!receiver->conv_frame) {
+            roc_log(LogError, "roc_receiver_open: can't allocate conversion frame");
+            return NULL;
+        }
+
+        receiver->conv_frame.resize(context->sample_buffer_pool.buffer_size()
+                                    / receiver->num_channels * receiver->num_channels);
+    }
+
     ++context->counter;
 
     return receiver.release();
@@ -122,6 +181,13 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return -1;
     }
 
+    if (receiver->unmixed) {
+        roc_log(LogError,
+                "roc_receiver_read: receiver is in unmixed mode, use "
+                "roc_receiver_read_sessions()");
+        return -1;
+    }
+
     if (!frame) {
         roc_log(LogError, "roc_receiver_read: invalid arguments: frame is null");
         return -1;
@@ -131,7 +197,8 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return 0;
     }
 
-    const size_t step = receiver->num_channels * sizeof(float);
+    const size_t step =
+        receiver->num_channels * frame_layout_sample_size(receiver->layout);
 
     if (frame->samples_size % step != 0) {
         roc_log(LogError,
@@ -146,8 +213,270 @@ int roc_receiver_read(roc_receiver* receiver, roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame audio_frame((float*)frame->samples, frame->samples_size / sizeof(float));
-    receiver->receiver.read(audio_frame);
+    receiver_read_frame(receiver, frame);
+
+    return 0;
+}
+
+int roc_receiver_try_read(roc_receiver* receiver, roc_frame* frame) {
+    if (!receiver) {
+        roc_log(LogError, "roc_receiver_try_read: invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (receiver->unmixed) {
+        roc_log(LogError,
+                "roc_receiver_try_read: receiver is in unmixed mode, use "
+                "roc_receiver_read_sessions()");
+        return -1;
+    }
+
+    if (!frame) {
+        roc_log(LogError, "roc_receiver_try_read: invalid arguments: frame is null");
+        return -1;
+    }
+
+    if (frame->samples_size == 0) {
+        return 0;
+    }
+
+    const size_t step =
+        receiver->num_channels * frame_layout_sample_size(receiver->layout);
+
+    if (frame->samples_size % step != 0) {
+        roc_log(LogError,
+                "roc_receiver_try_read: invalid arguments: # of samples should be "
+                "multiple of # of %u",
+                (unsigned)step);
+        return -1;
+    }
+
+    if (!frame->samples) {
+        roc_log(LogError, "roc_receiver_try_read: invalid arguments: samples is null");
+        return -1;
+    }
+
+    // the state may change to active just after the check, in which case the
+    // caller reads the first frame on the next poll or callback; it may not
+    // change back to inactive, since only read() removes sessions and packets
+    if (receiver->receiver.state() != sndio::ISource::Active) {
+        return 0;
+    }
+
+    receiver_read_frame(receiver, frame);
+
+    return 1;
+}
+
+int roc_receiver_set_ready_callback(roc_receiver* receiver,
+                                    roc_receiver_ready_callback callback,
+                                    void* callback_arg) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_set_ready_callback: invalid arguments: receiver is null");
+        return -1;
+    }
+
+    receiver->receiver.set_ready_callback(callback, callback_arg);
+
+    return 0;
+}
+
+int roc_receiver_read_batch(roc_receiver* receiver, roc_frame* frames, size_t n_frames) {
+    if (!receiver) {
+        roc_log(LogError, "roc_receiver_read_batch: invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (receiver->unmixed) {
+        roc_log(LogError,
+                "roc_receiver_read_batch: receiver is in unmixed mode, use "
+                "roc_receiver_read_sessions()");
+        return -1;
+    }
+
+    if (!frame_layout_is_native(receiver->layout)) {
+        roc_log(LogError,
+                "roc_receiver_read_batch: not supported with non-native frame layout, "
+                "use roc_receiver_read()");
+        return -1;
+    }
+
+    if (!frames && n_frames != 0) {
+        roc_log(LogError, "roc_receiver_read_batch: invalid arguments: frames is null");
+        return -1;
+    }
+
+    const size_t step = receiver->num_channels * sizeof(audio::sample_t);
+
+    for (size_t n = 0; n < n_frames; n++) {
+        if (frames[n].samples_size == 0) {
+            continue;
+        }
+
+        if (frames[n].samples_size % step != 0) {
+            roc_log(LogError,
+                    "roc_receiver_read_batch: invalid arguments: # of samples should be "
+                    "multiple of # of %u",
+                    (unsigned)step);
+            return -1;
+        }
+
+        if (!frames[n].samples) {
+            roc_log(LogError,
+                    "roc_receiver_read_batch: invalid arguments: samples is null");
+            return -1;
+        }
+    }
+
+    enum { BatchSize = 32 };
+
+    audio::sample_t* batch_data[BatchSize];
+    size_t batch_sizes[BatchSize];
+
+    size_t pos = 0;
+
+    while (pos < n_frames) {
+        size_t n_batch = 0;
+
+        while (pos < n_frames && n_batch < BatchSize) {
+            if (frames[pos].samples_size != 0) {
+                batch_data[n_batch] = (audio::sample_t*)frames[pos].samples;
+                batch_sizes[n_batch] = frames[pos].samples_size / sizeof(audio::sample_t);
+                n_batch++;
+            }
+            pos++;
+        }
+
+        if (n_batch != 0) {
+            receiver->receiver.read_batch(batch_data, batch_sizes, n_batch);
+        }
+    }
+
+    return 0;
+}
+
+int roc_receiver_read_sessions(roc_receiver* receiver,
+                               roc_frame* frames,
+                               roc_address* addresses,
+                               size_t n_frames) {
+    if (!receiver) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions: invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (!receiver->unmixed) {
+        roc_log(LogError, "roc_receiver_read_sessions: unmixed mode is not enabled");
+        return -1;
+    }
+
+    if (!frame_layout_is_native(receiver->layout)) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions: not supported with non-native frame layout");
+        return -1;
+    }
+
+    if (!frames && n_frames != 0) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions: invalid arguments: frames is null");
+        return -1;
+    }
+
+    // all streams advance by the same amount per cycle, so unlike
+    // roc_receiver_read_batch(), the frames can't be split into chunks and
+    // should be passed to the pipeline in one call
+    enum { MaxFrames = 64 };
+
+    if (n_frames > MaxFrames) {
+        roc_log(LogError,
+                "roc_receiver_read_sessions: invalid arguments: too many frames: "
+                "n_frames=%lu max_frames=%d",
+                (unsigned long)n_frames, (int)MaxFrames);
+        return -1;
+    }
+
+    if (addresses && sizeof(roc_address) < sizeof(packet::Address)) {
+        roc_log(LogError, "roc_receiver_read_sessions: address struct is too small");
+        return -1;
+    }
+
+    const size_t step = receiver->num_channels * sizeof(audio::sample_t);
+
+    audio::sample_t* frame_data[MaxFrames];
+    size_t frame_sizes[MaxFrames];
+
+    for (size_t n = 0; n < n_frames; n++) {
+        if (frames[n].samples_size % step != 0) {
+            roc_log(LogError,
+                    "roc_receiver_read_sessions: invalid arguments: # of samples should "
+                    "be multiple of # of %u",
+                    (unsigned)step);
+            return -1;
+        }
+
+        if (frames[n].samples_size != frames[0].samples_size) {
+            roc_log(LogError,
+                    "roc_receiver_read_sessions: invalid arguments: frames should be "
+                    "equally sized");
+            return -1;
+        }
+
+        if (!frames[n].samples) {
+            roc_log(LogError,
+                    "roc_receiver_read_sessions: invalid arguments: samples is null");
+            return -1;
+        }
+
+        frame_data[n] = (audio::sample_t*)frames[n].samples;
+        frame_sizes[n] = frames[n].samples_size / sizeof(audio::sample_t);
+    }
+
+    packet::Address session_addrs[MaxFrames];
+
+    const size_t n_streams = receiver->receiver.read_sessions(
+        frame_data, frame_sizes, n_frames, addresses ? session_addrs : NULL);
+
+    if (addresses) {
+        for (size_t n = 0; n < n_streams; n++) {
+            packet::Address& pa = get_address(&addresses[n]);
+            new (&pa) packet::Address(session_addrs[n]);
+        }
+    }
+
+    return (int)n_streams;
+}
+
+int roc_receiver_get_stats(roc_receiver* receiver, roc_receiver_stats* stats) {
+    if (!receiver) {
+        roc_log(LogError, "roc_receiver_get_stats: invalid arguments: receiver is null");
+        return -1;
+    }
+
+    if (!stats) {
+        roc_log(LogError, "roc_receiver_get_stats: invalid arguments: stats is null");
+        return -1;
+    }
+
+    pipeline::ReceiverStats pipeline_stats;
+    receiver->receiver.get_stats(pipeline_stats);
+
+    memset(stats, 0, sizeof(*stats));
+
+    stats->version = ROC_STATS_VERSION;
+    stats->num_sessions = (unsigned int)pipeline_stats.num_sessions;
+    stats->niq_latency = pipeline_stats.niq_latency;
+    stats->lost_packets = pipeline_stats.lost_packets;
+    stats->recovered_packets = pipeline_stats.recovered_packets;
+    stats->missing_samples = pipeline_stats.missing_samples;
+
+    if (pipeline_stats.scaling_count != 0) {
+        stats->resampler_scaling =
+            pipeline_stats.scaling_sum / (float)pipeline_stats.scaling_count;
+    }
+
+    stats->session_cpu_time = (unsigned long long)pipeline_stats.cpu_time_sum;
+    stats->max_session_cpu_time = (unsigned long long)pipeline_stats.cpu_time_max;
 
     return 0;
 }
@@ -161,7 +490,7 @@ int roc_receiver_close(roc_receiver* receiver) {
     roc_context& context = receiver->context;
 
     receiver->receiver.iterate_ports(receiver_close_port, receiver);
-    receiver->context.allocator.destroy(*receiver);
+    receiver->context.pipeline_allocator.destroy(*receiver);
     --context.counter;
 
     roc_log(LogInfo, "roc_receiver: closed receiver");
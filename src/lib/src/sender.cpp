@@ -19,12 +19,12 @@ namespace {
 
 bool sender_init_pipeline(roc_sender* sender) {
     sender->sender.reset(
-        new (sender->context.allocator) pipeline::Sender(
+        new (sender->context.pipeline_allocator) pipeline::Sender(
             sender->config, sender->source_port, *sender->writer, sender->repair_port,
-            *sender->writer, sender->codec_map, sender->format_map,
+            *sender->writer, sender->context.codec_map, sender->context.format_map,
             sender->context.packet_pool, sender->context.byte_buffer_pool,
-            sender->context.sample_buffer_pool, sender->context.allocator),
-        sender->context.allocator);
+            sender->context.sample_buffer_pool, sender->context.pipeline_allocator),
+        sender->context.pipeline_allocator);
 
     if (!sender->sender) {
         roc_log(LogError, "roc_sender: can't allocate sender pipeline");
@@ -36,6 +36,33 @@ bool sender_init_pipeline(roc_sender* sender) {
         return false;
     }
 
+    for (size_t n = 0; n < sender->extra_source_ports.size(); n++) {
+        pipeline::PortConfig repair_port;
+        if (n < sender->extra_repair_ports.size()) {
+            repair_port = sender->extra_repair_ports[n];
+        }
+
+        if (!sender->sender->add_destination(sender->extra_source_ports[n],
+                                             *sender->writer, repair_port,
+                                             *sender->writer)) {
+            roc_log(LogError, "roc_sender: can't add extra destination");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool sender_push_port(core::Array<pipeline::PortConfig>& ports,
+                      const pipeline::PortConfig& port_config) {
+    if (ports.size() == ports.max_size()) {
+        if (!ports.grow(ports.size() + 1)) {
+            return false;
+        }
+    }
+
+    ports.push_back(port_config);
+
     return true;
 }
 
@@ -45,8 +72,24 @@ bool sender_set_port(roc_sender* sender,
     switch ((int)type) {
     case ROC_PORT_AUDIO_SOURCE:
         if (sender->source_port.protocol != pipeline::Proto_None) {
-            roc_log(LogError, "roc_sender: audio source port is already set");
-            return false;
+            // primary port is already set; further connects add extra
+            // fan-out destinations that share one encoding pass
+            if (port_config.protocol != sender->source_port.protocol) {
+                roc_log(LogError,
+                        "roc_sender:"
+                        " extra audio source port protocol doesn't match primary port");
+                return false;
+            }
+
+            if (!sender_push_port(sender->extra_source_ports, port_config)) {
+                roc_log(LogError, "roc_sender: can't add extra audio source port");
+                return false;
+            }
+
+            roc_log(LogInfo, "roc_sender: added extra audio source port %s",
+                    pipeline::port_to_str(port_config).c_str());
+
+            return true;
         }
 
         if (!pipeline::validate_port(sender->config.fec_encoder.scheme,
@@ -71,8 +114,22 @@ bool sender_set_port(roc_sender* sender,
 
     case ROC_PORT_AUDIO_REPAIR:
         if (sender->repair_port.protocol != pipeline::Proto_None) {
-            roc_log(LogError, "roc_sender: audio repair port is already set");
-            return false;
+            if (port_config.protocol != sender->repair_port.protocol) {
+                roc_log(LogError,
+                        "roc_sender:"
+                        " extra audio repair port protocol doesn't match primary port");
+                return false;
+            }
+
+            if (!sender_push_port(sender->extra_repair_ports, port_config)) {
+                roc_log(LogError, "roc_sender: can't add extra audio repair port");
+                return false;
+            }
+
+            roc_log(LogInfo, "roc_sender: added extra audio repair port %s",
+                    pipeline::port_to_str(port_config).c_str());
+
+            return true;
         }
 
         if (!pipeline::validate_port(sender->config.fec_encoder.scheme,
@@ -112,16 +169,59 @@ bool sender_check_connected(roc_sender* sender) {
         return false;
     }
 
+    if (sender->config.fec_encoder.scheme != packet::FEC_None
+        && sender->extra_source_ports.size() != sender->extra_repair_ports.size()) {
+        roc_log(LogError,
+                "roc_sender:"
+                " numbers of extra source and repair ports don't match");
+        return false;
+    }
+
     return true;
 }
 
+void sender_write_frame(roc_sender* sender, const roc_frame* frame) {
+    const size_t total = frame->samples_size / frame_layout_sample_size(sender->layout);
+
+    if (frame_layout_is_native(sender->layout)) {
+        audio::Frame audio_frame((audio::sample_t*)frame->samples, total);
+        sender->sender->write(audio_frame);
+        return;
+    }
+
+    // convert the user's layout into the scratch frame in one pass and
+    // feed the pipeline from there
+    size_t off = 0;
+
+    while (off < total) {
+        size_t chunk = sender->conv_frame.size();
+        if (chunk > total - off) {
+            chunk = total - off;
+        }
+
+        frame_layout_import(sender->layout, frame->samples, sender->conv_frame.data(),
+                            total, off, chunk);
+
+        audio::Frame audio_frame(sender->conv_frame.data(), chunk);
+        sender->sender->write(audio_frame);
+
+        off += chunk;
+    }
+}
+
 } // namespace
 
 roc_sender::roc_sender(roc_context& ctx, pipeline::SenderConfig& cfg)
     : context(ctx)
     , config(cfg)
+    , extra_source_ports(ctx.allocator)
+    , extra_repair_ports(ctx.allocator)
     , writer(NULL)
     , num_channels(packet::num_channels(cfg.input_channels)) {
+    // native layout until negotiated in roc_sender_open()
+    layout.encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+    layout.layout = ROC_FRAME_LAYOUT_INTERLEAVED;
+    layout.num_channels = num_channels;
 }
 
 roc_sender* roc_sender_open(roc_context* context, const roc_sender_config* config) {
@@ -143,15 +243,42 @@ roc_sender* roc_sender_open(roc_context* context, const roc_sender_config* confi
         return NULL;
     }
 
-    roc_sender* sender = new (context->allocator) roc_sender(*context, private_config);
+    frame_layout layout;
+    if (!make_frame_layout(layout, config->frame_encoding, config->frame_layout,
+                           packet::num_channels(private_config.input_channels))) {
+        roc_log(LogError, "roc_sender_open: invalid arguments: bad config");
+        return NULL;
+    }
+
+    core::UniquePtr<roc_sender> sender(new (context->pipeline_allocator)
+                                           roc_sender(*context, private_config),
+                                       context->pipeline_allocator);
     if (!sender) {
         roc_log(LogError, "roc_sender_open: can't allocate roc_sender");
         return NULL;
     }
 
+    sender->layout = layout;
+
+    if (!frame_layout_is_native(layout)) {
+        // non-native frames are converted into a scratch frame before
+        // entering the pipeline, in one pass
+        sender->conv_frame = core::Slice<audio::sample_t>(
+            new (context->sample_buffer_pool)
+                core::Buffer<audio::sample_t>(context->sample_buffer_pool));
+
+        if (!sender->conv_frame) {
+            roc_log(LogError, "roc_sender_open: can't allocate conversion frame");
+            return NULL;
+        }
+
+        sender->conv_frame.resize(context->sample_buffer_pool.buffer_size()
+                                  / sender->num_channels * sender->num_channels);
+    }
+
     ++context->counter;
 
-    return sender;
+    return sender.release();
 }
 
 int roc_sender_bind(roc_sender* sender, roc_address* address) {
@@ -183,7 +310,8 @@ int roc_sender_bind(roc_sender* sender, roc_address* address) {
         return -1;
     }
 
-    sender->writer = sender->context.trx.add_udp_sender(addr);
+    sender->writer =
+        sender->context.trx.add_udp_sender(addr, 0, sender->config.dscp);
     if (!sender->writer) {
         roc_log(LogError, "roc_sender_bind: bind failed");
         return -1;
@@ -276,7 +404,7 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return 0;
     }
 
-    const size_t step = sender->num_channels * sizeof(float);
+    const size_t step = sender->num_channels * frame_layout_sample_size(sender->layout);
 
     if (frame->samples_size % step != 0) {
         roc_log(LogError,
@@ -291,8 +419,103 @@ int roc_sender_write(roc_sender* sender, const roc_frame* frame) {
         return -1;
     }
 
-    audio::Frame audio_frame((float*)frame->samples, frame->samples_size / sizeof(float));
-    sender->sender->write(audio_frame);
+    sender_write_frame(sender, frame);
+
+    return 0;
+}
+
+int roc_sender_write_batch(roc_sender* sender, const roc_frame* frames, size_t n_frames) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_write_batch: invalid arguments: sender is null");
+        return -1;
+    }
+
+    core::Mutex::Lock lock(sender->mutex);
+
+    if (!sender->writer) {
+        roc_log(LogError, "roc_sender_write_batch: sender is not properly bound");
+        return -1;
+    }
+
+    if (!sender_check_connected(sender)) {
+        roc_log(LogError, "roc_sender_write_batch: sender is not properly connected");
+        return -1;
+    }
+
+    if (!sender->sender) {
+        if (!sender_init_pipeline(sender)) {
+            roc_log(LogError, "roc_sender_write_batch: lazy initialization failed");
+            return -1;
+        }
+    }
+
+    if (!sender->sender->valid()) {
+        roc_log(LogError, "roc_sender_write_batch: sender is not properly initialized");
+        return -1;
+    }
+
+    if (!frames && n_frames != 0) {
+        roc_log(LogError, "roc_sender_write_batch: invalid arguments: frames is null");
+        return -1;
+    }
+
+    const size_t step = sender->num_channels * frame_layout_sample_size(sender->layout);
+
+    for (size_t n = 0; n < n_frames; n++) {
+        if (frames[n].samples_size == 0) {
+            continue;
+        }
+
+        if (frames[n].samples_size % step != 0) {
+            roc_log(LogError,
+                    "roc_sender_write_batch: invalid arguments: # of samples should be "
+                    "multiple of # of %u",
+                    (unsigned)step);
+            return -1;
+        }
+
+        if (!frames[n].samples) {
+            roc_log(LogError,
+                    "roc_sender_write_batch: invalid arguments: samples is null");
+            return -1;
+        }
+    }
+
+    for (size_t n = 0; n < n_frames; n++) {
+        if (frames[n].samples_size == 0) {
+            continue;
+        }
+
+        sender_write_frame(sender, &frames[n]);
+    }
+
+    return 0;
+}
+
+int roc_sender_get_stats(roc_sender* sender, roc_sender_stats* stats) {
+    if (!sender) {
+        roc_log(LogError, "roc_sender_get_stats: invalid arguments: sender is null");
+        return -1;
+    }
+
+    if (!stats) {
+        roc_log(LogError, "roc_sender_get_stats: invalid arguments: stats is null");
+        return -1;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+
+    stats->version = ROC_STATS_VERSION;
+
+    // the pipeline is created lazily on the first write; report
+    // zero counters until then
+    if (sender->sender) {
+        pipeline::SenderStats pipeline_stats;
+        sender->sender->get_stats(pipeline_stats);
+
+        stats->num_packets = pipeline_stats.num_packets;
+        stats->num_samples = pipeline_stats.num_samples;
+    }
 
     return 0;
 }
@@ -309,7 +532,7 @@ int roc_sender_close(roc_sender* sender) {
 
     roc_context& context = sender->context;
 
-    sender->context.allocator.destroy(*sender);
+    sender->context.pipeline_allocator.destroy(*sender);
     --context.counter;
 
     roc_log(LogInfo, "roc_sender: closed sender");
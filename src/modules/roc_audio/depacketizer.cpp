@@ -9,7 +9,9 @@
 #include "roc_audio/depacketizer.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/prefetch.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/trace.h"
 
 namespace roc {
 namespace audio {
@@ -24,7 +26,7 @@ inline void write_zeros(sample_t* buf, size_t bufsz) {
 
 inline void write_beep(sample_t* buf, size_t bufsz) {
     for (size_t n = 0; n < bufsz; n++) {
-        buf[n] = (sample_t)std::sin(2 * M_PI / 44100 * 880 * n);
+        buf[n] = (sample_t)(std::sin(2 * M_PI / 44100 * 880 * n) * SampleMax);
     }
 }
 
@@ -38,14 +40,18 @@ Depacketizer::Depacketizer(packet::IReader& reader,
     , payload_decoder_(payload_decoder)
     , channels_(channels)
     , num_channels_(packet::num_channels(channels))
+    , batch_head_(0)
+    , batch_size_(0)
     , timestamp_(0)
     , zero_samples_(0)
     , missing_samples_(0)
     , packet_samples_(0)
+    , pending_slip_(0)
     , rate_limiter_(LogInterval)
     , first_packet_(true)
     , beep_(beep)
-    , dropped_packets_(0) {
+    , dropped_packets_(0)
+    , blank_frames_(0) {
     roc_log(LogDebug, "depacketizer: initializing: n_channels=%lu",
             (unsigned long)num_channels_);
 }
@@ -54,6 +60,10 @@ bool Depacketizer::started() const {
     return !first_packet_;
 }
 
+size_t Depacketizer::n_blank_frames() const {
+    return blank_frames_;
+}
+
 packet::timestamp_t Depacketizer::timestamp() const {
     if (first_packet_) {
         return 0;
@@ -61,15 +71,36 @@ packet::timestamp_t Depacketizer::timestamp() const {
     return timestamp_;
 }
 
+packet::timestamp_t Depacketizer::n_missing_samples() const {
+    return missing_samples_;
+}
+
+void Depacketizer::slip(packet::timestamp_diff_t n_samples) {
+    pending_slip_ += n_samples;
+
+    roc_log(LogDebug, "depacketizer: slip requested: n_samples=%ld pending=%ld",
+            (long)n_samples, (long)pending_slip_);
+}
+
 void Depacketizer::read(Frame& frame) {
     const size_t prev_dropped_packets = dropped_packets_;
     const packet::timestamp_t prev_packet_samples = packet_samples_;
 
+    ROC_TRACE1(depacketizer_read_begin, (unsigned long)timestamp_);
+
     read_frame_(frame);
 
     set_frame_flags_(frame, prev_dropped_packets, prev_packet_samples);
 
-    if (rate_limiter_.allow()) {
+    ROC_TRACE2(depacketizer_read_end, (unsigned long)timestamp_, frame.size());
+
+    if (frame.flags() & Frame::FlagBlank) {
+        blank_frames_++;
+    } else {
+        blank_frames_ = 0;
+    }
+
+    if (rate_limiter_.allow(frame.cycle_time())) {
         const size_t total_samples = missing_samples_ + packet_samples_;
         const double loss_ratio =
             total_samples != 0 ? (double)missing_samples_ / total_samples : 0.;
@@ -84,17 +115,75 @@ void Depacketizer::read_frame_(Frame& frame) {
         roc_panic("depacketizer: unexpected frame size");
     }
 
+    if (pending_slip_ != 0) {
+        apply_slip_();
+    }
+
+    fetch_frame_packets_(frame);
+
+    // declare that the dirty region is tracked: ranges actually covered
+    // by packet samples are reported below, so that consumers can skip
+    // the zero-filled remainder
+    frame.add_dirty_region(0, 0);
+
     sample_t* buff_ptr = frame.data();
     sample_t* buff_end = frame.data() + frame.size();
 
+    if (pending_slip_ < 0) {
+        buff_ptr = insert_slip_silence_(buff_ptr, buff_end);
+    }
+
     while (buff_ptr < buff_end) {
-        buff_ptr = read_samples_(buff_ptr, buff_end);
+        buff_ptr = read_samples_(frame, buff_ptr, buff_end);
     }
 
     roc_panic_if(buff_ptr != buff_end);
 }
 
-sample_t* Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+void Depacketizer::apply_slip_() {
+    if (first_packet_) {
+        // the stream position is not established yet, nothing to shift
+        pending_slip_ = 0;
+        return;
+    }
+
+    if (pending_slip_ > 0) {
+        // the packet being decoded may fall behind the shifted position;
+        // update_packet_() re-fetches and shifts or drops it as needed
+        if (packet_) {
+            payload_decoder_.end();
+            packet_ = NULL;
+        }
+
+        // declare the skipped range as already rendered; the packets
+        // covering it become late and are dropped in update_packet_()
+        timestamp_ += (packet::timestamp_t)pending_slip_;
+
+        roc_log(LogDebug, "depacketizer: slipped forward: n_samples=%ld ts=%lu",
+                (long)pending_slip_, (unsigned long)timestamp_);
+
+        pending_slip_ = 0;
+    }
+}
+
+sample_t* Depacketizer::insert_slip_silence_(sample_t* buff_ptr, sample_t* buff_end) {
+    const size_t max_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
+    const size_t num_samples = std::min(max_samples, (size_t)-pending_slip_);
+
+    write_zeros(buff_ptr, num_samples * num_channels_);
+
+    pending_slip_ += (packet::timestamp_diff_t)num_samples;
+
+    if (pending_slip_ == 0) {
+        roc_log(LogDebug, "depacketizer: slipped backward: ts=%lu",
+                (unsigned long)timestamp_);
+    }
+
+    return (buff_ptr + num_samples * num_channels_);
+}
+
+sample_t* Depacketizer::read_samples_(Frame& frame, sample_t* buff_ptr,
+                                      sample_t* buff_end) {
     update_packet_();
 
     if (packet_) {
@@ -109,24 +198,30 @@ sample_t* Depacketizer::read_samples_(sample_t* buff_ptr, sample_t* buff_end) {
             const size_t max_samples = (size_t)(buff_end - buff_ptr);
 
             buff_ptr = read_missing_samples_(
-                buff_ptr, buff_ptr + std::min(mis_samples, max_samples));
+                frame, buff_ptr, buff_ptr + std::min(mis_samples, max_samples));
         }
 
         if (buff_ptr < buff_end) {
-            buff_ptr = read_packet_samples_(buff_ptr, buff_end);
+            buff_ptr = read_packet_samples_(frame, buff_ptr, buff_end);
         }
 
         return buff_ptr;
     } else {
-        return read_missing_samples_(buff_ptr, buff_end);
+        return read_missing_samples_(frame, buff_ptr, buff_end);
     }
 }
 
-sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+sample_t* Depacketizer::read_packet_samples_(Frame& frame, sample_t* buff_ptr,
+                                             sample_t* buff_end) {
     const size_t max_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
 
     const size_t num_samples = payload_decoder_.read(buff_ptr, max_samples, channels_);
 
+    if (num_samples != 0) {
+        const size_t frame_pos = (size_t)(buff_ptr - frame.data());
+        frame.add_dirty_region(frame_pos, frame_pos + num_samples * num_channels_);
+    }
+
     timestamp_ += packet::timestamp_t(num_samples);
     packet_samples_ += num_samples;
 
@@ -138,11 +233,16 @@ sample_t* Depacketizer::read_packet_samples_(sample_t* buff_ptr, sample_t* buff_
     return (buff_ptr + num_samples * num_channels_);
 }
 
-sample_t* Depacketizer::read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end) {
+sample_t* Depacketizer::read_missing_samples_(Frame& frame, sample_t* buff_ptr,
+                                              sample_t* buff_end) {
     const size_t num_samples = (size_t)(buff_end - buff_ptr) / num_channels_;
 
     if (beep_) {
         write_beep(buff_ptr, num_samples * num_channels_);
+
+        // beeps are not silence
+        const size_t frame_pos = (size_t)(buff_ptr - frame.data());
+        frame.add_dirty_region(frame_pos, frame_pos + num_samples * num_channels_);
     } else {
         write_zeros(buff_ptr, num_samples * num_channels_);
     }
@@ -219,6 +319,16 @@ void Depacketizer::update_packet_() {
 }
 
 packet::PacketPtr Depacketizer::read_packet_() {
+    if (batch_size_ != 0) {
+        packet::PacketPtr pp = batch_[batch_head_];
+        batch_[batch_head_] = NULL;
+
+        batch_head_ = (batch_head_ + 1) % MaxBatchPackets;
+        batch_size_--;
+
+        return pp;
+    }
+
     packet::PacketPtr pp = reader_.read();
     if (!pp) {
         return NULL;
@@ -231,6 +341,51 @@ packet::PacketPtr Depacketizer::read_packet_() {
     return pp;
 }
 
+void Depacketizer::fetch_frame_packets_(const Frame& frame) {
+    if (first_packet_) {
+        // the stream position is unknown until the first packet is
+        // decoded, so there is no frame range to fetch against yet
+        return;
+    }
+
+    // one pass over the packet queue: fetch every packet that may overlap
+    // the requested frame, prefetching its payload so that the decode loop
+    // runs over warm cache lines instead of alternating between queue
+    // traversal and decoding
+    const packet::timestamp_t frame_end =
+        timestamp_ + packet::timestamp_t(frame.size() / num_channels_);
+
+    while (batch_size_ < MaxBatchPackets) {
+        if (batch_size_ != 0) {
+            const packet::PacketPtr& last =
+                batch_[(batch_head_ + batch_size_ - 1) % MaxBatchPackets];
+
+            if (!packet::timestamp_lt(last->rtp()->timestamp, frame_end)) {
+                // this packet already starts beyond the frame; keep it
+                // batched for the next frame and stop fetching
+                break;
+            }
+        }
+
+        packet::PacketPtr pp = reader_.read();
+        if (!pp) {
+            break;
+        }
+
+        if (!pp->rtp()) {
+            roc_panic("depacketizer: unexpected non-rtp packet");
+        }
+
+        if (pp->rtp()->payload) {
+            core::prefetch_read(pp->rtp()->payload.data(),
+                                pp->rtp()->payload.size());
+        }
+
+        batch_[(batch_head_ + batch_size_) % MaxBatchPackets] = pp;
+        batch_size_++;
+    }
+}
+
 void Depacketizer::set_frame_flags_(Frame& frame,
                                     const size_t prev_dropped_packets,
                                     const packet::timestamp_t prev_packet_samples) {
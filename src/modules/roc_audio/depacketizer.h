@@ -26,6 +26,15 @@ namespace audio {
 //! @remarks
 //!  Reads packets from a packet reader, decodes samples from packets using a
 //!  decoder, and produces an audio stream.
+//!
+//!  The decoder writes decoded samples directly into the frame passed to
+//!  read(), and the packet payload it decodes from is a slice of the received
+//!  network buffer, so building a frame performs a single pass over the
+//!  audio data (the wire-to-native sample conversion) and no extra copies.
+//!
+//!  Packets covering a frame are fetched from the reader in one batch before
+//!  decoding, with their payloads prefetched into the cache, so that frame
+//!  assembly does one queue pass followed by one tight decode pass.
 class Depacketizer : public IReader, public core::NonCopyable<> {
 public:
     //! Initialization.
@@ -46,18 +55,44 @@ public:
     //! Did depacketizer catch first packet?
     bool started() const;
 
+    //! Get number of consecutive blank frames produced at the stream end.
+    //! @remarks
+    //!  Reset to zero every time samples from packets get into a frame.
+    size_t n_blank_frames() const;
+
     //! Get next timestamp to be rendered.
     //! @pre
     //!  started() should return true
     packet::timestamp_t timestamp() const;
 
+    //! Get cumulative number of samples per channel rendered as silence
+    //! because the packets were missing.
+    packet::timestamp_t n_missing_samples() const;
+
+    //! Request a packet-level slip of the stream position.
+    //! @remarks
+    //!  A positive @p n_samples advances the stream position by that many
+    //!  samples per channel without rendering them, so that the packets
+    //!  covering the skipped range are dropped as late and the queue
+    //!  latency decreases. A negative @p n_samples inserts that much
+    //!  silence before the next rendered sample, increasing the latency.
+    //!  The slip is applied at the beginning of the next read().
+    void slip(packet::timestamp_diff_t n_samples);
+
 private:
+    enum { MaxBatchPackets = 32 };
+
     void read_frame_(Frame& frame);
 
-    sample_t* read_samples_(sample_t* buff_ptr, sample_t* buff_end);
+    void apply_slip_();
+    sample_t* insert_slip_silence_(sample_t* buff_ptr, sample_t* buff_end);
 
-    sample_t* read_packet_samples_(sample_t* buff_ptr, sample_t* buff_end);
-    sample_t* read_missing_samples_(sample_t* buff_ptr, sample_t* buff_end);
+    void fetch_frame_packets_(const Frame& frame);
+
+    sample_t* read_samples_(Frame& frame, sample_t* buff_ptr, sample_t* buff_end);
+
+    sample_t* read_packet_samples_(Frame& frame, sample_t* buff_ptr, sample_t* buff_end);
+    sample_t* read_missing_samples_(Frame& frame, sample_t* buff_ptr, sample_t* buff_end);
 
     void set_frame_flags_(Frame& frame,
                           size_t prev_dropped_packets,
@@ -74,18 +109,29 @@ private:
 
     packet::PacketPtr packet_;
 
+    // read-ahead batch: packets covering the current frame, fetched from
+    // the queue in one pass before decoding (see fetch_frame_packets_())
+    packet::PacketPtr batch_[MaxBatchPackets];
+    size_t batch_head_;
+    size_t batch_size_;
+
     packet::timestamp_t timestamp_;
 
     packet::timestamp_t zero_samples_;
     packet::timestamp_t missing_samples_;
     packet::timestamp_t packet_samples_;
 
+    // pending slip requested via slip(); positive skips samples,
+    // negative inserts silence
+    packet::timestamp_diff_t pending_slip_;
+
     core::RateLimiter rate_limiter_;
 
     bool first_packet_;
     bool beep_;
 
     size_t dropped_packets_;
+    size_t blank_frames_;
 };
 
 } // namespace audio
@@ -15,7 +15,11 @@ namespace audio {
 Frame::Frame(sample_t* data, size_t size)
     : data_(data)
     , size_(size)
-    , flags_(0) {
+    , flags_(0)
+    , dirty_begin_(0)
+    , dirty_end_(size)
+    , has_dirty_region_(false)
+    , cycle_time_(0) {
     if (!data) {
         roc_panic("frame: can't create frame for null data");
     }
@@ -40,5 +44,53 @@ size_t Frame::size() const {
     return size_;
 }
 
+void Frame::add_dirty_region(size_t begin, size_t end) {
+    if (begin > end || end > size_) {
+        roc_panic("frame: invalid dirty region: begin=%lu end=%lu size=%lu",
+                  (unsigned long)begin, (unsigned long)end, (unsigned long)size_);
+    }
+
+    if (!has_dirty_region_) {
+        // the first report replaces the whole-frame default
+        has_dirty_region_ = true;
+        dirty_begin_ = begin;
+        dirty_end_ = end;
+        return;
+    }
+
+    if (begin == end) {
+        return;
+    }
+
+    if (dirty_begin_ == dirty_end_) {
+        dirty_begin_ = begin;
+        dirty_end_ = end;
+        return;
+    }
+
+    if (begin < dirty_begin_) {
+        dirty_begin_ = begin;
+    }
+    if (end > dirty_end_) {
+        dirty_end_ = end;
+    }
+}
+
+size_t Frame::dirty_begin() const {
+    return dirty_begin_;
+}
+
+size_t Frame::dirty_end() const {
+    return dirty_end_;
+}
+
+core::nanoseconds_t Frame::cycle_time() const {
+    return cycle_time_;
+}
+
+void Frame::set_cycle_time(core::nanoseconds_t cycle_time) {
+    cycle_time_ = cycle_time;
+}
+
 } // namespace audio
 } // namespace roc
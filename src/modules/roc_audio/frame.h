@@ -14,6 +14,7 @@
 
 #include "roc_audio/units.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
 
 namespace roc {
 namespace audio {
@@ -50,10 +51,43 @@ public:
     //! Get frame data size.
     size_t size() const;
 
+    //! Extend the dirty region of the frame.
+    //! @remarks
+    //!  The dirty region is the sample range [begin; end) that may contain
+    //!  non-zero data; samples outside of it are guaranteed to be zero.
+    //!  By default the whole frame is considered dirty. A producer that
+    //!  tracks which parts of the frame it actually fills reports every
+    //!  filled range with this method (starting with an empty range to
+    //!  declare that it tracks dirtiness); the reported ranges are merged.
+    //!  Consumers like the mixer may then skip the known-zero remainder.
+    void add_dirty_region(size_t begin, size_t end);
+
+    //! Get the beginning of the dirty region.
+    size_t dirty_begin() const;
+
+    //! Get the end of the dirty region.
+    size_t dirty_end() const;
+
+    //! Get the pipeline cycle time of the frame.
+    //! @remarks
+    //!  Time when the pipeline cycle processing the frame started, in the
+    //!  core::timestamp() clock domain. The driving caller samples the
+    //!  clock once per cycle, so that all per-frame consumers agree on
+    //!  "now" instead of each reading the clock again. Zero if the caller
+    //!  didn't sample the clock; consumers then read it themselves.
+    core::nanoseconds_t cycle_time() const;
+
+    //! Set the pipeline cycle time of the frame.
+    void set_cycle_time(core::nanoseconds_t);
+
 private:
     sample_t* data_;
     size_t size_;
     unsigned flags_;
+    size_t dirty_begin_;
+    size_t dirty_end_;
+    bool has_dirty_region_;
+    core::nanoseconds_t cycle_time_;
 };
 
 } // namespace audio
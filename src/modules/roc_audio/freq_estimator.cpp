@@ -7,8 +7,19 @@
  */
 
 #include "roc_audio/freq_estimator.h"
+#include "roc_core/cpu_features.h"
 #include "roc_core/panic.h"
 
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ROC_FE_X86_64 1
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ROC_FE_NEON 1
+#endif
+
 namespace roc {
 namespace audio {
 
@@ -17,31 +28,95 @@ namespace {
 const float P = 100e-8f; // Proportional gain of PI-controller.
 const float I = 0.5e-8f; // Integral gain of PI-controller.
 
-// Calculates dot product of arrays IR of filter (@p coeff) and input array (@p samples).
-//
-// - @p coeff Filter impulse response.
-// - @p samples Array with sample values.
-// - @p sample_ind index in input array to start from.
-// - @p len How many samples do we need at output.
-// - @p len_mask Bit mask of input array length.
-float dot_prod(const float* coeff,
-               const float* samples,
-               const size_t sample_ind,
-               const size_t len,
-               const size_t len_mask) {
-    double accum = 0;
-
-    for (size_t i = sample_ind, j = 0; j < len; i = (i - 1) & len_mask, ++j) {
-        accum += (double)coeff[j] * (double)samples[i];
+// Dot-product kernels. Each kernel computes the dot product of two
+// contiguous arrays; the circular decimator buffers are handled by the
+// caller by splitting the convolution at the wraparound point.
+
+float dot_scalar(const float* a, const float* b, size_t len) {
+    float accum = 0;
+
+    for (size_t n = 0; n < len; n++) {
+        accum += a[n] * b[n];
     }
 
-    return (float)accum;
+    return accum;
+}
+
+#ifdef ROC_FE_X86_64
+
+// SSE2 is part of the x86_64 baseline, no runtime check needed.
+float dot_sse2(const float* a, const float* b, size_t len) {
+    size_t n = 0;
+
+    __m128 vacc = _mm_setzero_ps();
+
+    for (; n + 4 <= len; n += 4) {
+        vacc = _mm_add_ps(vacc, _mm_mul_ps(_mm_loadu_ps(a + n), _mm_loadu_ps(b + n)));
+    }
+
+    float tmp[4];
+    _mm_storeu_ps(tmp, vacc);
+
+    return tmp[0] + tmp[1] + tmp[2] + tmp[3] + dot_scalar(a + n, b + n, len - n);
+}
+
+__attribute__((target("avx2,fma"))) float
+dot_avx2(const float* a, const float* b, size_t len) {
+    size_t n = 0;
+
+    __m256 vacc = _mm256_setzero_ps();
+
+    for (; n + 8 <= len; n += 8) {
+        vacc = _mm256_fmadd_ps(_mm256_loadu_ps(a + n), _mm256_loadu_ps(b + n), vacc);
+    }
+
+    float tmp[8];
+    _mm256_storeu_ps(tmp, vacc);
+
+    return tmp[0] + tmp[1] + tmp[2] + tmp[3] + tmp[4] + tmp[5] + tmp[6] + tmp[7]
+        + dot_scalar(a + n, b + n, len - n);
+}
+
+#endif // ROC_FE_X86_64
+
+#ifdef ROC_FE_NEON
+
+float dot_neon(const float* a, const float* b, size_t len) {
+    size_t n = 0;
+
+    float32x4_t vacc = vdupq_n_f32(0);
+
+    for (; n + 4 <= len; n += 4) {
+        vacc = vmlaq_f32(vacc, vld1q_f32(a + n), vld1q_f32(b + n));
+    }
+
+    return vgetq_lane_f32(vacc, 0) + vgetq_lane_f32(vacc, 1) + vgetq_lane_f32(vacc, 2)
+        + vgetq_lane_f32(vacc, 3) + dot_scalar(a + n, b + n, len - n);
+}
+
+#endif // ROC_FE_NEON
+
+typedef float (*dot_fn_t)(const float* a, const float* b, size_t len);
+
+dot_fn_t select_dot_fn() {
+#ifdef ROC_FE_X86_64
+    core::CpuFeatures& cpu = core::CpuFeatures::instance();
+    if (cpu.has_avx2() && cpu.has_fma()) {
+        return &dot_avx2;
+    }
+    return &dot_sse2;
+#elif defined(ROC_FE_NEON)
+    return &dot_neon;
+#else
+    return &dot_scalar;
+#endif
 }
 
 } // namespace
 
 FreqEstimator::FreqEstimator(packet::timestamp_t target_latency)
-    : target_(target_latency)
+    : dot_fn_(select_dot_fn())
+    , target_(target_latency)
     , dec1_ind_(0)
     , dec2_ind_(0)
     , samples_counter_(0)
@@ -53,6 +128,8 @@ FreqEstimator::FreqEstimator(packet::timestamp_t target_latency)
     for (size_t i = 0; i < fe_decim_len; i++) {
         dec1_casc_buff_[i] = target_;
         dec2_casc_buff_[i] = target_;
+
+        decim_h_rev_[i] = fe_decim_h[fe_decim_len - 1 - i];
     }
 }
 
@@ -75,17 +152,13 @@ bool FreqEstimator::run_decimators_(packet::timestamp_t current, float& filtered
 
     if ((samples_counter_ % fe_decim_factor) == 0) {
         // Time to calculate first decimator's samples.
-        dec2_casc_buff_[dec2_ind_] = dot_prod(fe_decim_h, dec1_casc_buff_, dec1_ind_,
-                                              fe_decim_len, fe_decim_len_mask)
-            / fe_decim_h_gain;
+        dec2_casc_buff_[dec2_ind_] = filter_(dec1_casc_buff_, dec1_ind_);
 
         if (((samples_counter_ % (fe_decim_factor * fe_decim_factor)) == 0)) {
             samples_counter_ = 0;
 
             // Time to calculate second decimator (and freq estimator's) output.
-            filtered = dot_prod(fe_decim_h, dec2_casc_buff_, dec2_ind_, fe_decim_len,
-                                fe_decim_len_mask)
-                / fe_decim_h_gain;
+            filtered = filter_(dec2_casc_buff_, dec2_ind_);
 
             return true;
         }
@@ -98,6 +171,23 @@ bool FreqEstimator::run_decimators_(packet::timestamp_t current, float& filtered
     return false;
 }
 
+// Convolves the whole circular buffer with the filter impulse response,
+// with @p ind being the position of the newest sample. The impulse
+// response is stored reversed, so the buffer is walked in forward order,
+// split at the wraparound point into two contiguous runs.
+float FreqEstimator::filter_(const float* buff, size_t ind) const {
+    const size_t start = (ind + 1) & fe_decim_len_mask;
+    const size_t tail = fe_decim_len - start;
+
+    return (dot_fn_(decim_h_rev_, buff + start, tail)
+            + dot_fn_(decim_h_rev_ + tail, buff, start))
+        / fe_decim_h_gain;
+}
+
+void FreqEstimator::set_target(packet::timestamp_t target_latency) {
+    target_ = (float)target_latency;
+}
+
 float FreqEstimator::run_controller_(float current) {
     const float error = (current - target_);
 
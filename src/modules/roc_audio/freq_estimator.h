@@ -35,11 +35,26 @@ public:
     //! Compute new value of frequency coefficient.
     void update(packet::timestamp_t current_latency);
 
+    //! Set new target latency.
+    //! @remarks
+    //!  The controller gradually drives the frequency coefficient so that
+    //!  the queue approaches the new target.
+    void set_target(packet::timestamp_t target_latency);
+
 private:
     bool run_decimators_(packet::timestamp_t current, float& filtered);
     float run_controller_(float current);
 
-    const float target_; // Target latency.
+    float filter_(const float* buff, size_t ind) const;
+
+    // Dot-product kernel, selected at construction based on CPU features.
+    float (*const dot_fn_)(const float* a, const float* b, size_t len);
+
+    float target_; // Target latency.
+
+    // Filter impulse response in reversed order, so that the circular
+    // buffer can be convolved in forward order.
+    float decim_h_rev_[fe_decim_len];
 
     float dec1_casc_buff_[fe_decim_len];
     size_t dec1_ind_;
@@ -8,9 +8,9 @@
 
 #include "roc_audio/freq_estimator_decim.h"
 
-const roc::audio::sample_t roc::audio::fe_decim_h_gain = 1.041106363770361f;
+const float roc::audio::fe_decim_h_gain = 1.041106363770361f;
 
-const roc::audio::sample_t roc::audio::fe_decim_h[fe_decim_len] = {
+const float roc::audio::fe_decim_h[fe_decim_len] = {
     2.171816595e-05f,  0.001551611349f,   0.0005492189666f,  0.0006585246301f,
     0.0007556059863f,  0.0008557052352f,  0.0009566077497f,  0.00105746265f,
     0.001156042097f,   0.001251217443f,   0.001340582385f,   0.001422821078f,
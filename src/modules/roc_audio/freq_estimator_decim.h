@@ -30,10 +30,10 @@ static const size_t fe_decim_len = 256;
 static const uint32_t fe_decim_len_mask = fe_decim_len - 1;
 
 //! Impulse response of decimation filter with factor of 10.
-extern const sample_t fe_decim_h[fe_decim_len];
+extern const float fe_decim_h[fe_decim_len];
 
 //! Filters gain, sum(fe_decim_h).
-extern const sample_t fe_decim_h_gain;
+extern const float fe_decim_h_gain;
 
 } // namespace audio
 } // namespace roc
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/fused_reader.h
+//! @brief Fused reader.
+
+#ifndef ROC_AUDIO_FUSED_READER_H_
+#define ROC_AUDIO_FUSED_READER_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/ireader.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace audio {
+
+//! Fused reader.
+//!
+//! Compile-time composed variant of a reader chain. A conventional chain
+//! connects stages through IReader references, so every frame traverses
+//! one indirect call per stage that the compiler can't inline. When the
+//! chain shape is known at build time, this template drives the concrete
+//! stages with qualified (non-virtual) calls instead, so the only
+//! indirect call per frame is the one into the fused reader itself and
+//! the compiler is free to inline across stages.
+//!
+//! @b Parameters
+//!  - @p Source is a concrete reader type filling frames (e.g.
+//!    Depacketizer)
+//!  - @p Filter is a concrete frame-observing stage providing
+//!    begin_read() and end_read() (e.g. Watchdog)
+template <class Source, class Filter>
+class FusedReader : public IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p filter may be NULL, in which case frames are read from
+    //!  @p source directly.
+    FusedReader(Source& source, Filter* filter)
+        : source_(source)
+        , filter_(filter) {
+    }
+
+    //! Read audio frame through the fused chain.
+    virtual void read(Frame& frame) {
+        if (filter_) {
+            if (!filter_->Filter::begin_read(frame)) {
+                return;
+            }
+            source_.Source::read(frame);
+            filter_->Filter::end_read(frame);
+        } else {
+            source_.Source::read(frame);
+        }
+    }
+
+private:
+    Source& source_;
+    Filter* filter_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_FUSED_READER_H_
@@ -7,6 +7,7 @@
  */
 
 #include "roc_audio/latency_monitor.h"
+#include "roc_core/helpers.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 
@@ -20,7 +21,7 @@ const core::nanoseconds_t LogInterval = 5 * core::Second;
 } // namespace
 
 LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
-                               const Depacketizer& depacketizer,
+                               Depacketizer& depacketizer,
                                ResamplerReader* resampler,
                                const LatencyMonitorConfig& config,
                                core::nanoseconds_t target_latency,
@@ -32,14 +33,38 @@ LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
     , fe_((packet::timestamp_t)packet::timestamp_from_ns(target_latency,
                                                          input_sample_rate))
     , rate_limiter_(LogInterval)
+    , cycle_time_(0)
     , update_interval_((packet::timestamp_t)packet::timestamp_from_ns(
           config.fe_update_interval, input_sample_rate))
     , update_pos_(0)
     , has_update_pos_(false)
+    , input_sample_rate_(input_sample_rate)
     , target_latency_((packet::timestamp_t)packet::timestamp_from_ns(target_latency,
                                                                      input_sample_rate))
     , min_latency_(packet::timestamp_from_ns(config.min_latency, input_sample_rate))
     , max_latency_(packet::timestamp_from_ns(config.max_latency, input_sample_rate))
+    , standalone_estimator_(config.standalone_estimator)
+    , slip_compensation_(config.slip_compensation)
+    , slip_threshold_(
+          packet::timestamp_from_ns(config.slip_threshold, input_sample_rate))
+    , slip_pos_(0)
+    , has_slip_pos_(false)
+    , arrival_estimation_(config.arrival_estimation)
+    , arrival_window_size_(0)
+    , arrival_window_pos_(0)
+    , arrival_epoch_(0)
+    , last_arrival_ts_(0)
+    , has_last_arrival_ts_(false)
+    , adaptive_(config.adaptive_latency)
+    , max_target_latency_(target_latency_)
+    , min_target_latency_((packet::timestamp_t)packet::timestamp_from_ns(
+          config.min_target_latency, input_sample_rate))
+    , adapt_interval_((packet::timestamp_t)packet::timestamp_from_ns(
+          config.adapt_interval, input_sample_rate))
+    , jitter_headroom_(config.jitter_headroom)
+    , jitter_window_pos_(0)
+    , adapt_pos_(0)
+    , has_adapt_pos_(false)
     , max_scaling_delta_(config.max_scaling_delta)
     , sample_rate_coeff_(0.f)
     , valid_(false) {
@@ -63,6 +88,51 @@ LatencyMonitor::LatencyMonitor(const packet::SortedQueue& queue,
         return;
     }
 
+    if (slip_compensation_) {
+        if (resampler_ || standalone_estimator_) {
+            roc_log(LogError,
+                    "latency monitor: slip compensation can't be combined"
+                    " with resampling");
+            return;
+        }
+
+        if (config.slip_threshold <= 0) {
+            roc_log(LogError, "latency monitor: invalid config: slip_threshold=%ld",
+                    (long)config.slip_threshold);
+            return;
+        }
+    }
+
+    if (adaptive_) {
+        if (!resampler_ && !standalone_estimator_) {
+            roc_log(LogError,
+                    "latency monitor: adaptive latency requires resampling"
+                    " to be enabled");
+            return;
+        }
+
+        if (config.min_target_latency <= 0
+            || config.min_target_latency > target_latency) {
+            roc_log(LogError,
+                    "latency monitor: invalid config: "
+                    "min_target_latency=%ld target_latency=%ld",
+                    (long)config.min_target_latency, (long)target_latency);
+            return;
+        }
+
+        if (config.adapt_interval <= 0 || config.jitter_headroom < 1.0f) {
+            roc_log(LogError,
+                    "latency monitor: invalid config: "
+                    "adapt_interval=%ld jitter_headroom=%.3f",
+                    (long)config.adapt_interval, (double)config.jitter_headroom);
+            return;
+        }
+
+        for (size_t n = 0; n < NumJitterWindows; n++) {
+            jitter_window_[n] = 0;
+        }
+    }
+
     if (resampler_) {
         if (!init_resampler_(input_sample_rate, output_sample_rate)) {
             return;
@@ -84,10 +154,16 @@ bool LatencyMonitor::valid() const {
     return valid_;
 }
 
-bool LatencyMonitor::update(packet::timestamp_t pos) {
+bool LatencyMonitor::update(packet::timestamp_t pos, core::nanoseconds_t cycle_time) {
+    cycle_time_ = cycle_time;
+
+    if (arrival_estimation_) {
+        record_arrival_();
+    }
+
     packet::timestamp_diff_t latency = 0;
 
-    if (!get_latency_(latency)) {
+    if (!get_latency_(latency, cycle_time_)) {
         return true;
     }
 
@@ -99,17 +175,78 @@ bool LatencyMonitor::update(packet::timestamp_t pos) {
         if (latency < 0) {
             latency = 0;
         }
+        if (adaptive_) {
+            record_jitter_((packet::timestamp_t)latency);
+            update_target_(pos);
+        }
         if (!update_resampler_(pos, (packet::timestamp_t)latency)) {
             return false;
         }
+    } else if (standalone_estimator_) {
+        if (latency < 0) {
+            latency = 0;
+        }
+        if (adaptive_) {
+            record_jitter_((packet::timestamp_t)latency);
+            update_target_(pos);
+        }
+        update_estimator_(pos, (packet::timestamp_t)latency);
+        report_latency_((packet::timestamp_t)latency);
     } else {
+        if (slip_compensation_) {
+            apply_slip_(pos, latency);
+        }
         report_latency_((packet::timestamp_t)latency);
     }
 
     return true;
 }
 
-bool LatencyMonitor::get_latency_(packet::timestamp_diff_t& latency) const {
+void LatencyMonitor::apply_slip_(packet::timestamp_t pos,
+                                 packet::timestamp_diff_t latency) {
+    if (has_slip_pos_ && packet::timestamp_lt(pos, slip_pos_)) {
+        // the previous slip hasn't fully propagated into the latency
+        // estimate yet
+        return;
+    }
+
+    const packet::timestamp_diff_t deviation =
+        latency - (packet::timestamp_diff_t)target_latency_;
+
+    if (deviation > -slip_threshold_ && deviation < slip_threshold_) {
+        return;
+    }
+
+    roc_log(LogInfo,
+            "latency monitor: drift slip: latency=%ld target=%lu deviation=%ld",
+            (long)latency, (unsigned long)target_latency_, (long)deviation);
+
+    // a positive deviation skips packets, a negative one inserts silence
+    depacketizer_.slip(deviation);
+
+    // wait for a target latency worth of stream before the next slip
+    slip_pos_ = pos + target_latency_;
+    has_slip_pos_ = true;
+}
+
+bool LatencyMonitor::get_latency(packet::timestamp_diff_t& latency) const {
+    return get_latency_(latency, 0);
+}
+
+float LatencyMonitor::freq_coeff() const {
+    return fe_.freq_coeff();
+}
+
+packet::timestamp_t LatencyMonitor::target_latency() const {
+    return target_latency_;
+}
+
+bool LatencyMonitor::get_latency_(packet::timestamp_diff_t& latency,
+                                  core::nanoseconds_t now) const {
+    if (arrival_estimation_ && arrival_latency_(latency, now)) {
+        return true;
+    }
+
     if (!depacketizer_.started()) {
         return false;
     }
@@ -121,12 +258,105 @@ bool LatencyMonitor::get_latency_(packet::timestamp_diff_t& latency) const {
         return false;
     }
 
-    const packet::timestamp_t tail = latest->end();
+    packet::timestamp_t tail = latest->end();
+
+    // the latest packet in the queue was received some time ago and could
+    // spend some of it in inter-thread queues before we observed it;
+    // assuming the sender keeps the nominal rate, advance the queue tail
+    // by the elapsed time to cancel this queueing noise from the estimate
+    if (latest->receive_timestamp() != 0) {
+        if (now == 0) {
+            now = core::timestamp();
+        }
+        const core::nanoseconds_t age = now - latest->receive_timestamp();
+        if (age > 0) {
+            tail += (packet::timestamp_t)packet::timestamp_from_ns(age,
+                                                                   input_sample_rate_);
+        }
+    }
 
     latency = packet::timestamp_diff(tail, head);
     return true;
 }
 
+void LatencyMonitor::record_arrival_() {
+    packet::PacketPtr latest = queue_.latest();
+    if (!latest || latest->receive_timestamp() == 0) {
+        return;
+    }
+
+    const packet::timestamp_t ts = latest->end();
+
+    if (has_last_arrival_ts_ && ts == last_arrival_ts_) {
+        return;
+    }
+    last_arrival_ts_ = ts;
+    has_last_arrival_ts_ = true;
+
+    if (arrival_epoch_ == 0) {
+        arrival_epoch_ = latest->receive_timestamp();
+    }
+
+    const packet::timestamp_t arrival = (packet::timestamp_t)packet::timestamp_from_ns(
+        latest->receive_timestamp() - arrival_epoch_, input_sample_rate_);
+
+    arrival_window_[arrival_window_pos_] = packet::timestamp_diff(ts, arrival);
+    arrival_window_pos_ = (arrival_window_pos_ + 1) % ArrivalWindow;
+
+    if (arrival_window_size_ < ArrivalWindow) {
+        arrival_window_size_++;
+    }
+}
+
+bool LatencyMonitor::arrival_latency_(packet::timestamp_diff_t& latency,
+                                      core::nanoseconds_t now) const {
+    if (arrival_window_size_ < MinArrivalSamples) {
+        return false;
+    }
+
+    if (!depacketizer_.started()) {
+        return false;
+    }
+
+    if (now == 0) {
+        now = core::timestamp();
+    }
+
+    // The largest offset corresponds to the packet that took the fastest
+    // path from the sender clock to us: jitter and queueing can only delay
+    // an arrival, i.e. lower its offset. A few top values are discarded,
+    // so that a bogus timestamp can't skew the estimate.
+    packet::timestamp_diff_t top[ArrivalOutliers + 1];
+    size_t n_top = 0;
+
+    for (size_t n = 0; n < arrival_window_size_; n++) {
+        const packet::timestamp_diff_t off = arrival_window_[n];
+
+        if (n_top == ROC_ARRAY_SIZE(top) && off <= top[n_top - 1]) {
+            continue;
+        }
+
+        size_t pos = (n_top < ROC_ARRAY_SIZE(top) ? n_top++ : n_top - 1);
+        while (pos > 0 && top[pos - 1] < off) {
+            top[pos] = top[pos - 1];
+            pos--;
+        }
+        top[pos] = off;
+    }
+
+    const packet::timestamp_diff_t offset = top[n_top - 1];
+
+    // reconstruct where the queue tail would be if the last packets had
+    // taken the fastest path, and derive the latency from that
+    const packet::timestamp_t tail = (packet::timestamp_t)(
+        (packet::timestamp_t)packet::timestamp_from_ns(now - arrival_epoch_,
+                                                       input_sample_rate_)
+        + (packet::timestamp_t)offset);
+
+    latency = packet::timestamp_diff(tail, depacketizer_.timestamp());
+    return true;
+}
+
 bool LatencyMonitor::check_latency_(packet::timestamp_diff_t latency) const {
     if (latency < min_latency_) {
         roc_log(LogDebug, "latency monitor: latency out of bounds: latency=%ld min=%ld",
@@ -143,6 +373,82 @@ bool LatencyMonitor::check_latency_(packet::timestamp_diff_t latency) const {
     return true;
 }
 
+void LatencyMonitor::record_jitter_(packet::timestamp_t latency) {
+    packet::timestamp_t dev;
+
+    if (latency > target_latency_) {
+        dev = latency - target_latency_;
+    } else {
+        dev = target_latency_ - latency;
+    }
+
+    if (dev > jitter_window_[jitter_window_pos_]) {
+        jitter_window_[jitter_window_pos_] = dev;
+    }
+}
+
+void LatencyMonitor::update_target_(packet::timestamp_t pos) {
+    if (!has_adapt_pos_) {
+        has_adapt_pos_ = true;
+        adapt_pos_ = pos + adapt_interval_;
+        return;
+    }
+
+    while (packet::timestamp_diff(pos, adapt_pos_) >= 0) {
+        adapt_target_();
+        adapt_pos_ += adapt_interval_;
+    }
+}
+
+void LatencyMonitor::adapt_target_() {
+    packet::timestamp_t jitter = 0;
+    for (size_t n = 0; n < NumJitterWindows; n++) {
+        if (jitter_window_[n] > jitter) {
+            jitter = jitter_window_[n];
+        }
+    }
+
+    packet::timestamp_t desired = (packet::timestamp_t)(jitter * jitter_headroom_);
+    if (desired < min_target_latency_) {
+        desired = min_target_latency_;
+    }
+    if (desired > max_target_latency_) {
+        desired = max_target_latency_;
+    }
+
+    const packet::timestamp_t old_target = target_latency_;
+
+    if (desired > target_latency_) {
+        // a jitter spike: jump straight to the desired target, so that
+        // the buffer is refilled before it underruns
+        target_latency_ = desired;
+    } else if (desired < target_latency_) {
+        // a stable period: glide down a fraction of the gap per tick, so
+        // that the correction stays inaudible and a single quiet window
+        // doesn't discard the provisioned headroom at once
+        packet::timestamp_t step = target_latency_ / 8;
+        if (step > target_latency_ - desired) {
+            step = target_latency_ - desired;
+        }
+        target_latency_ -= step;
+    }
+
+    if (target_latency_ != old_target) {
+        roc_log(LogDebug,
+                "latency monitor:"
+                " adapting target latency: old=%lu new=%lu jitter=%lu",
+                (unsigned long)old_target, (unsigned long)target_latency_,
+                (unsigned long)jitter);
+
+        fe_.set_target(target_latency_);
+    }
+
+    // rotate the sub-windows: the oldest slot is recycled for the
+    // measurements of the upcoming interval
+    jitter_window_pos_ = (jitter_window_pos_ + 1) % NumJitterWindows;
+    jitter_window_[jitter_window_pos_] = 0;
+}
+
 float LatencyMonitor::trim_scaling_(float freq_coeff) const {
     const float min_coeff = 1.0f - max_scaling_delta_;
     const float max_coeff = 1.0f + max_scaling_delta_;
@@ -177,7 +483,7 @@ bool LatencyMonitor::init_resampler_(size_t input_sample_rate,
     return true;
 }
 
-bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
+void LatencyMonitor::update_estimator_(packet::timestamp_t pos,
                                        packet::timestamp_t latency) {
     if (!has_update_pos_) {
         has_update_pos_ = true;
@@ -188,12 +494,17 @@ bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
         fe_.update(latency);
         update_pos_ += update_interval_;
     }
+}
+
+bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
+                                       packet::timestamp_t latency) {
+    update_estimator_(pos, latency);
 
     const float freq_coeff = fe_.freq_coeff();
     const float trimmed_coeff = trim_scaling_(freq_coeff);
     const float adjusted_coeff = sample_rate_coeff_ * trimmed_coeff;
 
-    if (rate_limiter_.allow()) {
+    if (rate_limiter_.allow(cycle_time_)) {
         roc_log(
             LogDebug,
             "latency monitor: latency=%lu target=%lu fe=%.5f trim_fe=%.5f adj_fe=%.5f",
@@ -212,7 +523,7 @@ bool LatencyMonitor::update_resampler_(packet::timestamp_t pos,
 }
 
 void LatencyMonitor::report_latency_(packet::timestamp_t latency) {
-    if (rate_limiter_.allow()) {
+    if (rate_limiter_.allow(cycle_time_)) {
         roc_log(LogDebug, "latency monitor: latency=%lu target=%lu",
                 (unsigned long)latency, (unsigned long)target_latency_);
     }
@@ -43,11 +43,70 @@ struct LatencyMonitorConfig {
     //! For example, 0.01 allows freq_coeff values in range [0.99; 1.01].
     float max_scaling_delta;
 
+    //! Enable adaptive target latency.
+    //! Instead of sticking to the configured target latency forever, track
+    //! the jitter of the incoming queue, glide the target down during stable
+    //! periods, and raise it back quickly on jitter spikes. The target stays
+    //! within [min_target_latency; configured target latency]. Requires
+    //! resampling to be enabled.
+    bool adaptive_latency;
+
+    //! Minimum target latency for adaptive mode, nanoseconds.
+    //! The target latency is never lowered below this value.
+    core::nanoseconds_t min_target_latency;
+
+    //! Interval between adaptive target latency updates, nanoseconds.
+    //! Also defines the length of one jitter measurement sub-window.
+    core::nanoseconds_t adapt_interval;
+
+    //! Safety multiplier applied to the measured jitter peak in adaptive
+    //! mode. The target latency is steered towards jitter * headroom.
+    float jitter_headroom;
+
+    //! Run the FreqEstimator even when the monitor doesn't drive a
+    //! resampler, so that an external stage can consume freq_coeff().
+    //! Used when several sessions share one post-mix resampler.
+    bool standalone_estimator;
+
+    //! Compensate clock drift with packet-level slips instead of
+    //! resampling. When the latency deviates from the target by more than
+    //! slip_threshold, the depacketizer stream position is shifted by the
+    //! deviation: a backward shift drops packets, a forward shift inserts
+    //! silence. Between slips samples flow through untouched, so the
+    //! output stays bit-exact; for setups with external clock sync where
+    //! drift is marginal. Can't be combined with resampling.
+    bool slip_compensation;
+
+    //! Latency deviation that triggers a slip, nanoseconds.
+    core::nanoseconds_t slip_threshold;
+
+    //! Estimate latency from per-packet arrival times instead of the
+    //! instantaneous queue fill. The monitor collects (arrival time, RTP
+    //! timestamp) pairs from packets carrying kernel receive timestamps
+    //! and reconstructs the queue tail from the clock offsets over a
+    //! sliding window. Network jitter and inter-thread queueing can only
+    //! delay an arrival, i.e. lower an offset, so the window maximum
+    //! tracks the fastest delivery path; a few top offsets are discarded
+    //! to reject bogus timestamps. The result feeds FreqEstimator with
+    //! less noise than the queue fill, so convergence is faster and
+    //! smaller target latencies are sustainable. Until the window is
+    //! warmed up, or when packets don't carry receive timestamps, the
+    //! queue-fill estimate is used.
+    bool arrival_estimation;
+
     LatencyMonitorConfig()
         : fe_update_interval(5 * core::Millisecond)
         , min_latency(0)
         , max_latency(0)
-        , max_scaling_delta(0.005f) {
+        , max_scaling_delta(0.005f)
+        , adaptive_latency(false)
+        , min_target_latency(0)
+        , adapt_interval(core::Second)
+        , jitter_headroom(3.0f)
+        , standalone_estimator(false)
+        , slip_compensation(false)
+        , slip_threshold(5 * core::Millisecond)
+        , arrival_estimation(false) {
     }
 };
 
@@ -56,6 +115,7 @@ struct LatencyMonitorConfig {
 //!  - calculates session scaling factor
 //!  - trims scaling factor to the allowed range
 //!  - updates resampler scaling
+//!  - optionally adapts the target latency to the observed jitter
 //!  - shutdowns session if the latency goes out of bounds
 class LatencyMonitor : public core::NonCopyable<> {
 public:
@@ -69,7 +129,7 @@ public:
     //!  - @p input_sample_rate is the sample rate of the input packets
     //!  - @p output_sample_rate is the sample rate of the output frames
     LatencyMonitor(const packet::SortedQueue& queue,
-                   const Depacketizer& depacketizer,
+                   Depacketizer& depacketizer,
                    ResamplerReader* resampler,
                    const LatencyMonitorConfig& config,
                    core::nanoseconds_t target_latency,
@@ -80,36 +140,127 @@ public:
     bool valid() const;
 
     //! Update latency.
+    //! @remarks
+    //!  @p cycle_time is the clock value sampled once by the driving
+    //!  caller for this pipeline cycle, or zero if it wasn't sampled.
     //! @returns
     //!  false if the session should be terminated.
-    bool update(packet::timestamp_t time);
+    bool update(packet::timestamp_t time, core::nanoseconds_t cycle_time = 0);
+
+    //! Get current network incoming queue latency, in samples.
+    //! @returns
+    //!  false if the latency can't be calculated yet.
+    bool get_latency(packet::timestamp_diff_t& latency) const;
+
+    //! Get current frequency coefficient, i.e. the scaling factor applied
+    //! to the resampler.
+    //! @remarks
+    //!  Meaningful only when the monitor drives a resampler or runs a
+    //!  standalone estimator.
+    float freq_coeff() const;
+
+    //! Get current target latency, in samples.
+    //! @remarks
+    //!  Equal to the configured target latency unless adaptive mode
+    //!  has moved it.
+    packet::timestamp_t target_latency() const;
 
 private:
-    bool get_latency_(packet::timestamp_diff_t& latency) const;
+    enum {
+        NumJitterWindows = 4,
+
+        // Size of the arrival offset window; at typical packet rates it
+        // spans a few hundred milliseconds of traffic.
+        ArrivalWindow = 32,
+
+        // How many of the largest offsets are discarded as outliers.
+        ArrivalOutliers = 2,
+
+        // How many offsets should be collected before the arrival
+        // estimate is trusted.
+        MinArrivalSamples = 8
+    };
+
+    bool get_latency_(packet::timestamp_diff_t& latency,
+                      core::nanoseconds_t now) const;
     bool check_latency_(packet::timestamp_diff_t latency) const;
 
+    void record_arrival_();
+    bool arrival_latency_(packet::timestamp_diff_t& latency,
+                          core::nanoseconds_t now) const;
+
+    void apply_slip_(packet::timestamp_t pos, packet::timestamp_diff_t latency);
+
+    void record_jitter_(packet::timestamp_t latency);
+    void update_target_(packet::timestamp_t pos);
+    void adapt_target_();
+
     float trim_scaling_(float scaling) const;
 
     bool init_resampler_(size_t input_sample_rate, size_t output_sample_rate);
+    void update_estimator_(packet::timestamp_t time, packet::timestamp_t latency);
     bool update_resampler_(packet::timestamp_t time, packet::timestamp_t latency);
 
     void report_latency_(packet::timestamp_t latency);
 
     const packet::SortedQueue& queue_;
-    const Depacketizer& depacketizer_;
+    Depacketizer& depacketizer_;
     ResamplerReader* resampler_;
     FreqEstimator fe_;
 
     core::RateLimiter rate_limiter_;
 
+    // clock value passed to the last update(), shared by the rate-limited
+    // reports of that cycle; zero if the caller didn't sample the clock
+    core::nanoseconds_t cycle_time_;
+
     const packet::timestamp_t update_interval_;
     packet::timestamp_t update_pos_;
     bool has_update_pos_;
 
-    const packet::timestamp_t target_latency_;
+    const size_t input_sample_rate_;
+
+    packet::timestamp_t target_latency_;
     const packet::timestamp_diff_t min_latency_;
     const packet::timestamp_diff_t max_latency_;
 
+    const bool standalone_estimator_;
+
+    const bool slip_compensation_;
+    const packet::timestamp_diff_t slip_threshold_;
+
+    // position after which the next slip may be issued; prevents
+    // re-issuing a slip before the previous one has taken effect
+    packet::timestamp_t slip_pos_;
+    bool has_slip_pos_;
+
+    const bool arrival_estimation_;
+
+    // sliding window of offsets between packet RTP end timestamps and
+    // arrival times converted to samples since arrival_epoch_
+    packet::timestamp_diff_t arrival_window_[ArrivalWindow];
+    size_t arrival_window_size_;
+    size_t arrival_window_pos_;
+
+    core::nanoseconds_t arrival_epoch_;
+
+    packet::timestamp_t last_arrival_ts_;
+    bool has_last_arrival_ts_;
+
+    const bool adaptive_;
+    const packet::timestamp_t max_target_latency_;
+    const packet::timestamp_t min_target_latency_;
+    const packet::timestamp_t adapt_interval_;
+    const float jitter_headroom_;
+
+    // Peak deviation of the latency from the target, one slot per
+    // sub-window; the jitter estimate is the maximum across all slots.
+    packet::timestamp_t jitter_window_[NumJitterWindows];
+    size_t jitter_window_pos_;
+
+    packet::timestamp_t adapt_pos_;
+    bool has_adapt_pos_;
+
     const float max_scaling_delta_;
     float sample_rate_coeff_;
 
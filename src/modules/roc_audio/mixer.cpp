@@ -7,15 +7,48 @@
  */
 
 #include "roc_audio/mixer.h"
+#include "roc_core/cpu_features.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
 
+// the vector kernels below operate on float samples, so they don't
+// apply in fixed-point builds
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(ROC_FIXED_POINT)
+#include <immintrin.h>
+#define ROC_MIXER_X86_64 1
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_NEON) && !defined(ROC_FIXED_POINT)
+#include <arm_neon.h>
+#define ROC_MIXER_NEON 1
+#endif
+
 namespace roc {
 namespace audio {
 
 namespace {
 
+#ifdef ROC_FIXED_POINT
+
+// Accumulate-and-saturate kernel for Q15 samples: the sum is formed in
+// 32 bits and saturated back to [SampleMin; SampleMax].
+void mix_scalar(sample_t* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        int32_t acc = (int32_t)out[n] + (int32_t)in[n];
+
+        if (acc > SampleMax) {
+            acc = SampleMax;
+        } else if (acc < SampleMin) {
+            acc = SampleMin;
+        }
+
+        out[n] = (sample_t)acc;
+    }
+}
+
+#else // !ROC_FIXED_POINT
+
 sample_t clamp(const sample_t x) {
     if (x > SampleMax) {
         return SampleMax;
@@ -26,23 +59,158 @@ sample_t clamp(const sample_t x) {
     }
 }
 
+// Accumulate-and-saturate kernels. Each kernel adds @p in to @p out
+// and clamps the result to [SampleMin; SampleMax].
+
+void mix_scalar(sample_t* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        out[n] = clamp(out[n] + in[n]);
+    }
+}
+
+#endif // ROC_FIXED_POINT
+
+#ifdef ROC_MIXER_X86_64
+
+// SSE2 is part of the x86_64 baseline, no runtime check needed.
+void mix_sse2(sample_t* out, const sample_t* in, size_t n_samples) {
+    const __m128 max_val = _mm_set1_ps(SampleMax);
+    const __m128 min_val = _mm_set1_ps(SampleMin);
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        __m128 acc = _mm_add_ps(_mm_loadu_ps(out + n), _mm_loadu_ps(in + n));
+        acc = _mm_max_ps(_mm_min_ps(acc, max_val), min_val);
+        _mm_storeu_ps(out + n, acc);
+    }
+
+    mix_scalar(out + n, in + n, n_samples - n);
+}
+
+__attribute__((target("avx2"))) void
+mix_avx2(sample_t* out, const sample_t* in, size_t n_samples) {
+    const __m256 max_val = _mm256_set1_ps(SampleMax);
+    const __m256 min_val = _mm256_set1_ps(SampleMin);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        __m256 acc = _mm256_add_ps(_mm256_loadu_ps(out + n), _mm256_loadu_ps(in + n));
+        acc = _mm256_max_ps(_mm256_min_ps(acc, max_val), min_val);
+        _mm256_storeu_ps(out + n, acc);
+    }
+
+    mix_scalar(out + n, in + n, n_samples - n);
+}
+
+#endif // ROC_MIXER_X86_64
+
+#ifdef ROC_MIXER_NEON
+
+void mix_neon(sample_t* out, const sample_t* in, size_t n_samples) {
+    const float32x4_t max_val = vdupq_n_f32(SampleMax);
+    const float32x4_t min_val = vdupq_n_f32(SampleMin);
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        float32x4_t acc = vaddq_f32(vld1q_f32(out + n), vld1q_f32(in + n));
+        acc = vmaxq_f32(vminq_f32(acc, max_val), min_val);
+        vst1q_f32(out + n, acc);
+    }
+
+    mix_scalar(out + n, in + n, n_samples - n);
+}
+
+#endif // ROC_MIXER_NEON
+
+// Minimum number of input streams for the tree reduction. Below this the
+// scheduling overhead of the reduction rounds outweighs the serial sum.
+enum { MinTreeReaders = 8 };
+
+typedef void (*mix_fn_t)(sample_t* out, const sample_t* in, size_t n_samples);
+
+mix_fn_t select_mix_fn() {
+#ifdef ROC_MIXER_X86_64
+    if (core::CpuFeatures::instance().has_avx2()) {
+        return &mix_avx2;
+    }
+    return &mix_sse2;
+#elif defined(ROC_MIXER_NEON)
+    return &mix_neon;
+#else
+    return &mix_scalar;
+#endif
+}
+
 } // namespace
 
+void Mixer::ReadTask::run() {
+    Frame frame(buf.data(), n_samples);
+    frame.set_cycle_time(cycle_time);
+    reader->read(frame);
+
+    dirty_begin = frame.dirty_begin();
+    dirty_end = frame.dirty_end();
+}
+
+void Mixer::MixTask::run() {
+    mix_fn(dst, src, n_samples);
+}
+
 Mixer::Mixer(core::BufferPool<sample_t>& pool, size_t frame_size)
-    : valid_(false) {
+    : mix_fn_(select_mix_fn())
+    , buffer_pool_(pool)
+    , frame_size_(frame_size)
+    , thread_pool_(NULL)
+    , cycle_time_(0)
+    , valid_(false) {
     roc_log(LogDebug, "mixer: initializing: frame_size=%lu", (unsigned long)frame_size);
 
-    temp_buf_ = new (pool) core::Buffer<sample_t>(pool);
+    init_();
+}
+
+Mixer::Mixer(core::BufferPool<sample_t>& pool,
+             size_t frame_size,
+             core::ThreadPool& thread_pool,
+             core::IAllocator& allocator)
+    : mix_fn_(select_mix_fn())
+    , buffer_pool_(pool)
+    , frame_size_(frame_size)
+    , thread_pool_(&thread_pool)
+    , cycle_time_(0)
+    , valid_(false) {
+    roc_log(LogDebug, "mixer: initializing: frame_size=%lu n_threads=%lu",
+            (unsigned long)frame_size, (unsigned long)thread_pool.num_threads());
+
+    tasks_.reset(new (allocator) core::Array<ReadTask>(allocator), allocator);
+    if (!tasks_) {
+        roc_log(LogError, "mixer: can't allocate task array");
+        return;
+    }
+
+    mix_tasks_.reset(new (allocator) core::Array<MixTask>(allocator), allocator);
+    if (!mix_tasks_) {
+        roc_log(LogError, "mixer: can't allocate mix task array");
+        return;
+    }
+
+    init_();
+}
+
+void Mixer::init_() {
+    temp_buf_ = new (buffer_pool_) core::Buffer<sample_t>(buffer_pool_);
     if (!temp_buf_) {
         roc_log(LogError, "mixer: can't allocate temporary buffer");
         return;
     }
 
-    if (temp_buf_.capacity() < frame_size) {
+    if (temp_buf_.capacity() < frame_size_) {
         roc_log(LogError, "mixer: allocated buffer is too small");
         return;
     }
-    temp_buf_.resize(frame_size);
+    temp_buf_.resize(frame_size_);
 
     valid_ = true;
 }
@@ -66,6 +234,8 @@ void Mixer::remove(IReader& reader) {
 void Mixer::read(Frame& frame) {
     roc_panic_if(!valid_);
 
+    cycle_time_ = frame.cycle_time();
+
     if (readers_.size() == 1) {
         readers_.front()->read(frame);
         return;
@@ -93,18 +263,159 @@ void Mixer::read_(sample_t* data, size_t size) {
     roc_panic_if(!data);
     roc_panic_if(size == 0);
 
+    if (thread_pool_ && readers_.size() > 1) {
+        if (read_parallel_(data, size)) {
+            return;
+        }
+    }
+
     memset(data, 0, size * sizeof(sample_t));
 
     for (IReader* rp = readers_.front(); rp; rp = readers_.nextof(*rp)) {
         sample_t* temp_data = temp_buf_.data();
 
         Frame temp_frame(temp_data, size);
+        temp_frame.set_cycle_time(cycle_time_);
         rp->read(temp_frame);
 
-        for (size_t n = 0; n < size; n++) {
-            data[n] = clamp(data[n] + temp_data[n]);
+        // everything outside of the dirty region is guaranteed to be
+        // zero, and adding zeros is a no-op
+        const size_t dirty_begin = temp_frame.dirty_begin();
+        const size_t dirty_end = temp_frame.dirty_end();
+
+        if (dirty_begin < dirty_end) {
+            mix_fn_(data + dirty_begin, temp_data + dirty_begin,
+                    dirty_end - dirty_begin);
+        }
+    }
+}
+
+// Read all input streams in parallel on the thread pool and mix their
+// outputs as the tasks complete.
+//
+// Returns false if the per-reader buffers can't be allocated, in which
+// case the caller falls back to sequential mixing.
+bool Mixer::read_parallel_(sample_t* data, size_t size) {
+    const size_t n_readers = readers_.size();
+
+    if (!setup_tasks_(n_readers)) {
+        return false;
+    }
+
+    core::Array<ReadTask>& tasks = *tasks_;
+
+    size_t n = 0;
+    for (IReader* rp = readers_.front(); rp; rp = readers_.nextof(*rp)) {
+        tasks[n].reader = rp;
+        tasks[n].n_samples = size;
+        tasks[n].cycle_time = cycle_time_;
+        thread_pool_->schedule(tasks[n]);
+        n++;
+    }
+
+    memset(data, 0, size * sizeof(sample_t));
+
+    // With many streams the serial sum below becomes the bottleneck, so
+    // the per-reader buffers are instead pairwise-summed in a tree across
+    // the worker pool, and only the root is summed here. On failure the
+    // tasks are untouched and the serial path still applies.
+    if (n_readers >= MinTreeReaders && reduce_tree_(n_readers, size)) {
+        mix_fn_(data, tasks[0].buf.data(), size);
+        return true;
+    }
+
+    for (n = 0; n < n_readers; n++) {
+        thread_pool_->wait(tasks[n]);
+
+        // skip the known-zero parts of the per-reader buffer
+        if (tasks[n].dirty_begin < tasks[n].dirty_end) {
+            mix_fn_(data + tasks[n].dirty_begin,
+                    tasks[n].buf.data() + tasks[n].dirty_begin,
+                    tasks[n].dirty_end - tasks[n].dirty_begin);
         }
     }
+
+    return true;
+}
+
+// Pairwise-sums the per-reader buffers in a tree across the worker pool,
+// leaving the result in the buffer of the first task. Each round sums
+// independent buffer pairs in parallel, halving the number of partial
+// sums, so the reduction takes ceil(log2(n)) rounds instead of n serial
+// additions.
+//
+// The worker pool has no inter-task dependencies, so the rounds are
+// driven from here: a round is scheduled only after the previous one
+// (and, for the first round, all reads) completed.
+bool Mixer::reduce_tree_(size_t n_readers, size_t size) {
+    core::Array<ReadTask>& tasks = *tasks_;
+    core::Array<MixTask>& mix_tasks = *mix_tasks_;
+
+    if (mix_tasks.size() < n_readers / 2) {
+        if (!mix_tasks.resize(n_readers / 2)) {
+            roc_log(LogError, "mixer: can't allocate mix tasks");
+            return false;
+        }
+    }
+
+    for (size_t n = 0; n < n_readers; n++) {
+        thread_pool_->wait(tasks[n]);
+    }
+
+    for (size_t stride = 1; stride < n_readers; stride *= 2) {
+        size_t n_mix = 0;
+
+        for (size_t i = 0; i + stride < n_readers; i += stride * 2) {
+            MixTask& task = mix_tasks[n_mix++];
+
+            task.mix_fn = mix_fn_;
+            task.dst = tasks[i].buf.data();
+            task.src = tasks[i + stride].buf.data();
+            task.n_samples = size;
+
+            thread_pool_->schedule(task);
+        }
+
+        for (size_t n = 0; n < n_mix; n++) {
+            thread_pool_->wait(mix_tasks[n]);
+        }
+    }
+
+    return true;
+}
+
+bool Mixer::setup_tasks_(size_t n_readers) {
+    core::Array<ReadTask>& tasks = *tasks_;
+
+    if (tasks.size() < n_readers) {
+        if (!tasks.resize(n_readers)) {
+            roc_log(LogError, "mixer: can't allocate tasks");
+            return false;
+        }
+    }
+
+    for (size_t n = 0; n < n_readers; n++) {
+        if (tasks[n].buf) {
+            continue;
+        }
+
+        core::Slice<sample_t> buf = new (buffer_pool_)
+            core::Buffer<sample_t>(buffer_pool_);
+        if (!buf) {
+            roc_log(LogError, "mixer: can't allocate per-reader buffer");
+            return false;
+        }
+
+        if (buf.capacity() < frame_size_) {
+            roc_log(LogError, "mixer: allocated buffer is too small");
+            return false;
+        }
+        buf.resize(frame_size_);
+
+        tasks[n].buf = buf;
+    }
+
+    return true;
 }
 
 } // namespace audio
@@ -14,10 +14,14 @@
 
 #include "roc_audio/ireader.h"
 #include "roc_audio/units.h"
+#include "roc_core/array.h"
 #include "roc_core/list.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/pool.h"
 #include "roc_core/slice.h"
+#include "roc_core/thread_pool.h"
+#include "roc_core/time.h"
+#include "roc_core/unique_ptr.h"
 
 namespace roc {
 namespace audio {
@@ -45,6 +49,19 @@ public:
     //!    attached readers
     explicit Mixer(core::BufferPool<sample_t>& pool, size_t frame_size);
 
+    //! Initialize mixer that reads input streams in parallel.
+    //!
+    //! @b Parameters
+    //!  - @p pool is used to allocate temporary buffers of samples
+    //!  - @p frame_size defines the temporary buffer size used to read from
+    //!    attached readers
+    //!  - @p thread_pool is used to read from the attached readers in parallel
+    //!  - @p allocator is used to allocate per-reader tasks
+    Mixer(core::BufferPool<sample_t>& pool,
+          size_t frame_size,
+          core::ThreadPool& thread_pool,
+          core::IAllocator& allocator);
+
     //! Check if the mixer was succefully constructed.
     bool valid() const;
 
@@ -61,11 +78,71 @@ public:
     virtual void read(Frame& frame);
 
 private:
+    //! Task reading one input stream into a private buffer.
+    struct ReadTask : core::ThreadPool::Task {
+        IReader* reader;              //!< Input stream.
+        core::Slice<sample_t> buf;    //!< Private output buffer.
+        size_t n_samples;             //!< Number of samples to read.
+        size_t dirty_begin;           //!< Dirty region of the frame read.
+        size_t dirty_end;             //!< See dirty_begin.
+        core::nanoseconds_t cycle_time; //!< Cycle time of the outer frame.
+
+        ReadTask()
+            : reader(NULL)
+            , n_samples(0)
+            , dirty_begin(0)
+            , dirty_end(0)
+            , cycle_time(0) {
+        }
+
+        virtual void run();
+    };
+
+    //! Task summing one per-reader buffer into another.
+    struct MixTask : core::ThreadPool::Task {
+        //! Accumulate-and-saturate kernel.
+        void (*mix_fn)(sample_t* out, const sample_t* in, size_t n_samples);
+
+        sample_t* dst;     //!< Accumulator buffer.
+        const sample_t* src; //!< Buffer summed into the accumulator.
+        size_t n_samples;  //!< Number of samples to sum.
+
+        MixTask()
+            : mix_fn(NULL)
+            , dst(NULL)
+            , src(NULL)
+            , n_samples(0) {
+        }
+
+        virtual void run();
+    };
+
+    void init_();
+
     void read_(sample_t* out_data, size_t out_sz);
 
+    bool read_parallel_(sample_t* out_data, size_t out_sz);
+    bool setup_tasks_(size_t n_readers);
+
+    bool reduce_tree_(size_t n_readers, size_t out_sz);
+
+    //! Accumulate-and-saturate kernel selected for this CPU at runtime.
+    void (*const mix_fn_)(sample_t* out, const sample_t* in, size_t n_samples);
+
+    core::BufferPool<sample_t>& buffer_pool_;
+    const size_t frame_size_;
+
     core::List<IReader, core::NoOwnership> readers_;
     core::Slice<sample_t> temp_buf_;
 
+    core::ThreadPool* thread_pool_;
+    core::UniquePtr<core::Array<ReadTask> > tasks_;
+    core::UniquePtr<core::Array<MixTask> > mix_tasks_;
+
+    // cycle time of the frame being read, propagated to the per-reader
+    // sub-frames so that downstream consumers agree on "now"
+    core::nanoseconds_t cycle_time_;
+
     bool valid_;
 };
 
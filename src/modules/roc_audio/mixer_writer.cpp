@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/mixer_writer.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+const core::nanoseconds_t DropLogInterval = 5 * core::Second;
+
+#ifdef ROC_FIXED_POINT
+
+// Like the mixer kernel: the sum is formed in 32 bits and saturated
+// back to [SampleMin; SampleMax].
+void mix_samples(sample_t* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        int32_t acc = (int32_t)out[n] + (int32_t)in[n];
+
+        if (acc > SampleMax) {
+            acc = SampleMax;
+        } else if (acc < SampleMin) {
+            acc = SampleMin;
+        }
+
+        out[n] = (sample_t)acc;
+    }
+}
+
+#else // !ROC_FIXED_POINT
+
+void mix_samples(sample_t* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        const sample_t acc = out[n] + in[n];
+
+        if (acc > SampleMax) {
+            out[n] = SampleMax;
+        } else if (acc < SampleMin) {
+            out[n] = SampleMin;
+        } else {
+            out[n] = acc;
+        }
+    }
+}
+
+#endif // ROC_FIXED_POINT
+
+} // namespace
+
+MixerWriter::Input::Input(MixerWriter& mixer, core::IAllocator& allocator)
+    : mixer_(mixer)
+    , fifo_(allocator)
+    , fill_(0) {
+}
+
+bool MixerWriter::Input::valid() const {
+    return fifo_.size() == mixer_.max_buffering_;
+}
+
+void MixerWriter::Input::write(Frame& frame) {
+    mixer_.write_(*this, frame);
+}
+
+MixerWriter::MixerWriter(IWriter& output,
+                         core::BufferPool<sample_t>& buffer_pool,
+                         size_t frame_size,
+                         size_t max_buffering,
+                         core::IAllocator& allocator)
+    : output_(output)
+    , frame_size_(frame_size)
+    , max_buffering_(max_buffering)
+    , allocator_(allocator)
+    , drop_limiter_(DropLogInterval)
+    , valid_(false) {
+    if (frame_size == 0 || max_buffering < frame_size) {
+        roc_panic("mixer writer: bad parameters: frame_size=%lu max_buffering=%lu",
+                  (unsigned long)frame_size, (unsigned long)max_buffering);
+    }
+
+    if (frame_size > buffer_pool.buffer_size()) {
+        roc_log(LogError, "mixer writer: frame size too large: frame_size=%lu max=%lu",
+                (unsigned long)frame_size, (unsigned long)buffer_pool.buffer_size());
+        return;
+    }
+
+    mix_buf_ = core::Slice<sample_t>(new (buffer_pool) core::Buffer<sample_t>(buffer_pool));
+    if (!mix_buf_) {
+        roc_log(LogError, "mixer writer: can't allocate mix buffer");
+        return;
+    }
+    mix_buf_.resize(frame_size);
+
+    roc_log(LogDebug, "mixer writer: initializing: frame_size=%lu max_buffering=%lu",
+            (unsigned long)frame_size, (unsigned long)max_buffering);
+
+    valid_ = true;
+}
+
+MixerWriter::~MixerWriter() {
+    while (Input* input = inputs_.front()) {
+        inputs_.remove(*input);
+        allocator_.destroy(*input);
+    }
+}
+
+bool MixerWriter::valid() const {
+    return valid_;
+}
+
+IWriter* MixerWriter::create_input() {
+    core::Mutex::Lock lock(mutex_);
+
+    Input* input = new (allocator_) Input(*this, allocator_);
+    if (!input) {
+        roc_log(LogError, "mixer writer: can't allocate input");
+        return NULL;
+    }
+
+    if (!input->fifo_.resize(max_buffering_)) {
+        roc_log(LogError, "mixer writer: can't allocate input buffer");
+        allocator_.destroy(*input);
+        return NULL;
+    }
+
+    inputs_.push_back(*input);
+
+    roc_log(LogDebug, "mixer writer: added input: n_inputs=%lu",
+            (unsigned long)inputs_.size());
+
+    return input;
+}
+
+void MixerWriter::write_(Input& input, Frame& frame) {
+    core::Mutex::Lock lock(mutex_);
+
+    append_(input, frame.data(), frame.size());
+    flush_();
+}
+
+void MixerWriter::append_(Input& input, const sample_t* data, size_t size) {
+    if (size > max_buffering_) {
+        data += size - max_buffering_;
+        size = max_buffering_;
+    }
+
+    if (input.fill_ + size > max_buffering_) {
+        // this input ran too far ahead of the others; drop its oldest
+        // samples, so that the backlog (and thus the latency the laggards
+        // would impose on it) stays bounded
+        const size_t dropped = input.fill_ + size - max_buffering_;
+
+        memmove(&input.fifo_[0], &input.fifo_[dropped],
+                (input.fill_ - dropped) * sizeof(sample_t));
+        input.fill_ -= dropped;
+
+        if (drop_limiter_.allow()) {
+            roc_log(LogDebug, "mixer writer: input overrun: dropped=%lu",
+                    (unsigned long)dropped);
+        }
+    }
+
+    memcpy(&input.fifo_[input.fill_], data, size * sizeof(sample_t));
+    input.fill_ += size;
+}
+
+void MixerWriter::flush_() {
+    for (;;) {
+        for (Input* input = inputs_.front(); input; input = inputs_.nextof(*input)) {
+            if (input->fill_ < frame_size_) {
+                return;
+            }
+        }
+
+        memset(mix_buf_.data(), 0, frame_size_ * sizeof(sample_t));
+
+        for (Input* input = inputs_.front(); input; input = inputs_.nextof(*input)) {
+            mix_samples(mix_buf_.data(), &input->fifo_[0], frame_size_);
+
+            memmove(&input->fifo_[0], &input->fifo_[frame_size_],
+                    (input->fill_ - frame_size_) * sizeof(sample_t));
+            input->fill_ -= frame_size_;
+        }
+
+        Frame frame(mix_buf_.data(), frame_size_);
+        output_.write(frame);
+    }
+}
+
+} // namespace audio
+} // namespace roc
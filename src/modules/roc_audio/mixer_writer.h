@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/mixer_writer.h
+//! @brief Mixer writer.
+
+#ifndef ROC_AUDIO_MIXER_WRITER_H_
+#define ROC_AUDIO_MIXER_WRITER_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/iwriter.h"
+#include "roc_audio/units.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Mixer writer.
+//! Push-side counterpart of Mixer: mixes multiple input streams, each
+//! fed by its own writer, into one output stream.
+//!
+//! Every input buffers the samples pushed into it; whenever all inputs
+//! have accumulated a full frame, the frames are summed with saturation
+//! and the mix is pushed to the output writer, from the thread that
+//! completed the frame. Inputs are expected to produce the same rate and
+//! channel layout; an input that stalls stalls the mix, and an input
+//! that runs ahead of the others by more than the buffering limit has
+//! its oldest samples dropped, so a dead input delays the stream but a
+//! slightly drifting one doesn't grow the buffers without bound.
+//!
+//! All inputs should be created before the streaming starts, since a
+//! newly created input is empty and the mix waits for it.
+class MixerWriter : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p output specifies the stream to which mixed frames are written
+    //!  - @p buffer_pool is used to allocate the mix buffer
+    //!  - @p frame_size is the number of samples per mixed frame
+    //!  - @p max_buffering is the maximum number of samples buffered per
+    //!    input; when exceeded, the oldest samples of that input are dropped
+    //!  - @p allocator is used to allocate inputs
+    MixerWriter(IWriter& output,
+                core::BufferPool<sample_t>& buffer_pool,
+                size_t frame_size,
+                size_t max_buffering,
+                core::IAllocator& allocator);
+
+    ~MixerWriter();
+
+    //! Check if the mixer was successfully constructed.
+    bool valid() const;
+
+    //! Create input.
+    //! @returns
+    //!  a writer feeding the new input stream, valid until the mixer is
+    //!  destroyed, or null if allocation failed.
+    IWriter* create_input();
+
+private:
+    //! One input stream with its backlog of pushed samples.
+    class Input : public IWriter, public core::ListNode, public core::NonCopyable<> {
+    public:
+        Input(MixerWriter& mixer, core::IAllocator& allocator);
+
+        bool valid() const;
+
+        virtual void write(Frame& frame);
+
+    private:
+        friend class MixerWriter;
+
+        MixerWriter& mixer_;
+
+        core::Array<sample_t> fifo_;
+        size_t fill_;
+    };
+
+    void write_(Input& input, Frame& frame);
+    void append_(Input& input, const sample_t* data, size_t size);
+    void flush_();
+
+    IWriter& output_;
+
+    const size_t frame_size_;
+    const size_t max_buffering_;
+
+    core::IAllocator& allocator_;
+
+    core::List<Input, core::NoOwnership> inputs_;
+
+    core::Slice<sample_t> mix_buf_;
+
+    core::Mutex mutex_;
+    core::RateLimiter drop_limiter_;
+
+    bool valid_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_MIXER_WRITER_H_
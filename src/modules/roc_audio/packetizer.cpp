@@ -14,6 +14,13 @@
 namespace roc {
 namespace audio {
 
+namespace {
+
+// anything below the smallest 16-bit PCM level is digital silence
+const sample_t SilenceThreshold = 1.0f / 32768.0f;
+
+} // namespace
+
 Packetizer::Packetizer(packet::IWriter& writer,
                        packet::IComposer& composer,
                        IFrameEncoder& payload_encoder,
@@ -21,8 +28,10 @@ Packetizer::Packetizer(packet::IWriter& writer,
                        core::BufferPool<uint8_t>& buffer_pool,
                        packet::channel_mask_t channels,
                        core::nanoseconds_t packet_length,
+                       core::nanoseconds_t dtx_keepalive,
                        size_t sample_rate,
-                       unsigned int payload_type)
+                       unsigned int payload_type,
+                       core::nanoseconds_t flush_deadline)
     : writer_(writer)
     , composer_(composer)
     , payload_encoder_(payload_encoder)
@@ -30,11 +39,24 @@ Packetizer::Packetizer(packet::IWriter& writer,
     , buffer_pool_(buffer_pool)
     , channels_(channels)
     , num_channels_(packet::num_channels(channels))
-    , samples_per_packet_(
+    , base_samples_per_packet_(
           (packet::timestamp_t)packet::timestamp_from_ns(packet_length, sample_rate))
+    , keepalive_samples_(
+          (packet::timestamp_t)packet::timestamp_from_ns(dtx_keepalive, sample_rate))
     , payload_type_(payload_type)
-    , payload_size_(payload_encoder.encoded_size(samples_per_packet_))
+    , base_payload_size_(payload_encoder.encoded_size(base_samples_per_packet_))
+    , flush_deadline_(flush_deadline)
+    , samples_per_packet_(base_samples_per_packet_)
+    , payload_size_(base_payload_size_)
+    , next_samples_per_packet_(base_samples_per_packet_)
+    , next_payload_size_(base_payload_size_)
     , packet_pos_(0)
+    , packet_start_(0)
+    , packet_cnt_(0)
+    , sample_cnt_(0)
+    , silence_samples_(0)
+    , dtx_active_(false)
+    , marker_pending_(false)
     , source_((packet::source_t)core::random(packet::source_t(-1)))
     , seqnum_((packet::seqnum_t)core::random(packet::seqnum_t(-1)))
     , timestamp_((packet::timestamp_t)core::random(packet::timestamp_t(-1))) {
@@ -50,11 +72,47 @@ void Packetizer::write(Frame& frame) {
     const sample_t* buffer_ptr = frame.data();
     size_t buffer_samples = frame.size() / num_channels_;
 
+    if (keepalive_samples_ != 0) {
+        if (frame_is_silent_(frame)) {
+            silence_samples_ += buffer_samples;
+
+            if (!packet_ && silence_samples_ < keepalive_samples_) {
+                if (!dtx_active_) {
+                    roc_log(LogDebug, "packetizer: suppressing silent stream");
+                    dtx_active_ = true;
+                }
+                // the stream position keeps advancing, so the receiver treats
+                // the gap as silence; the sequence number doesn't, so the gap
+                // is not accounted as packet loss
+                timestamp_ += (packet::timestamp_t)buffer_samples;
+                marker_pending_ = true;
+                return;
+            }
+            // either a packet is already underway and should be completed, or
+            // it is time to emit a keepalive packet, so that the receiver's
+            // watchdog and validator see a live stream; in both cases the
+            // frame takes the normal path below
+        } else {
+            silence_samples_ = 0;
+
+            if (dtx_active_) {
+                roc_log(LogDebug, "packetizer: resuming on signal");
+                dtx_active_ = false;
+            }
+        }
+    }
+
+    core::nanoseconds_t now = 0;
+    if (flush_deadline_ != 0) {
+        now = frame.cycle_time() ? frame.cycle_time() : core::timestamp();
+    }
+
     while (buffer_samples != 0) {
         if (!packet_) {
             if (!begin_packet_()) {
                 return;
             }
+            packet_start_ = now;
         }
 
         size_t ns = buffer_samples;
@@ -74,6 +132,13 @@ void Packetizer::write(Frame& frame) {
             end_packet_();
         }
     }
+
+    // emit the in-progress packet with a shorter payload instead of letting
+    // its oldest samples age by the full packet duration; trades a little
+    // header overhead for lower sender-side latency
+    if (flush_deadline_ != 0 && packet_ && now - packet_start_ >= flush_deadline_) {
+        end_packet_();
+    }
 }
 
 void Packetizer::flush() {
@@ -82,7 +147,62 @@ void Packetizer::flush() {
     }
 }
 
+void Packetizer::set_payload_limit(size_t max_payload_size) {
+    size_t mult = base_payload_size_ != 0 ? max_payload_size / base_payload_size_ : 1;
+
+    // the encoding is not necessarily linear in the sample count, so walk
+    // the multiple down until the encoded payload actually fits
+    while (mult > 1
+           && payload_encoder_.encoded_size(base_samples_per_packet_ * mult)
+               > max_payload_size) {
+        mult--;
+    }
+
+    if (mult < 1) {
+        // never shrink below one configured packet
+        mult = 1;
+    }
+
+    const size_t samples = base_samples_per_packet_ * mult;
+
+    if (samples == next_samples_per_packet_) {
+        return;
+    }
+
+    next_samples_per_packet_ = samples;
+    next_payload_size_ = payload_encoder_.encoded_size(samples);
+
+    roc_log(LogDebug,
+            "packetizer: packet sizing changed:"
+            " samples_per_packet=%lu payload_size=%lu",
+            (unsigned long)next_samples_per_packet_,
+            (unsigned long)next_payload_size_);
+}
+
+size_t Packetizer::n_packets() const {
+    return packet_cnt_;
+}
+
+size_t Packetizer::n_samples() const {
+    return sample_cnt_;
+}
+
+bool Packetizer::frame_is_silent_(const Frame& frame) const {
+    const sample_t* data = frame.data();
+
+    for (size_t n = 0; n < frame.size(); n++) {
+        if (data[n] >= SilenceThreshold || data[n] <= -SilenceThreshold) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool Packetizer::begin_packet_() {
+    samples_per_packet_ = next_samples_per_packet_;
+    payload_size_ = next_payload_size_;
+
     packet::PacketPtr pp = create_packet_();
     if (!pp) {
         return false;
@@ -100,6 +220,10 @@ bool Packetizer::begin_packet_() {
     rtp->timestamp = timestamp_;
     rtp->payload_type = payload_type_;
 
+    // mark the first packet after a suppressed gap
+    rtp->marker = marker_pending_;
+    marker_pending_ = false;
+
     packet_ = pp;
 
     return true;
@@ -116,11 +240,17 @@ void Packetizer::end_packet_() {
 
     writer_.write(packet_);
 
+    packet_cnt_++;
+    sample_cnt_ += packet_pos_;
+
     seqnum_++;
     timestamp_ += (packet::timestamp_t)packet_pos_;
 
     packet_ = NULL;
     packet_pos_ = 0;
+
+    // any emitted packet restarts the keepalive interval
+    silence_samples_ = 0;
 }
 
 void Packetizer::pad_packet_() {
@@ -42,8 +42,13 @@ public:
     //!  - @p buffer_pool is used to allocate buffers for packets
     //!  - @p channels defines a set of channels in the input frames
     //!  - @p packet_length defines packet length in nanoseconds
+    //!  - @p dtx_keepalive defines how often to emit a packet while the
+    //!    stream is silent, or zero to disable silence suppression
     //!  - @p sample_rate defines number of samples per channel per second
     //!  - @p payload_type defines packet payload type
+    //!  - @p flush_deadline defines the maximum age of a buffered sample
+    //!    before the in-progress packet is emitted with a shorter payload,
+    //!    or zero to always wait for a full packet
     Packetizer(packet::IWriter& writer,
                packet::IComposer& composer,
                IFrameEncoder& payload_encoder,
@@ -51,18 +56,38 @@ public:
                core::BufferPool<uint8_t>& buffer_pool,
                packet::channel_mask_t channels,
                core::nanoseconds_t packet_length,
+               core::nanoseconds_t dtx_keepalive,
                size_t sample_rate,
-               unsigned int payload_type);
+               unsigned int payload_type,
+               core::nanoseconds_t flush_deadline = 0);
 
     //! Write audio frame.
     virtual void write(Frame& frame);
 
+    //! Limit payload size to the given transport budget.
+    //! @remarks
+    //!  Re-sizes packets to the largest whole multiple of the configured
+    //!  packet length whose payload fits @p max_payload_size, e.g. to
+    //!  grow packets up to a discovered path MTU. Never shrinks below
+    //!  one configured packet. Takes effect when the next packet is
+    //!  started; the receiver picks up the new size from the packets
+    //!  themselves.
+    void set_payload_limit(size_t max_payload_size);
+
     //! Flush buffered packet, if any.
     //! @remarks
     //!  Packet is padded to match fixed size.
     void flush();
 
+    //! Get cumulative number of packets written to the output writer.
+    size_t n_packets() const;
+
+    //! Get cumulative number of samples per channel written to packets.
+    size_t n_samples() const;
+
 private:
+    bool frame_is_silent_(const Frame& frame) const;
+
     bool begin_packet_();
     void end_packet_();
 
@@ -79,12 +104,32 @@ private:
 
     const packet::channel_mask_t channels_;
     const size_t num_channels_;
-    const size_t samples_per_packet_;
+    const size_t base_samples_per_packet_;
+    const size_t keepalive_samples_;
     const unsigned int payload_type_;
-    const size_t payload_size_;
+    const size_t base_payload_size_;
+    const core::nanoseconds_t flush_deadline_;
+
+    // current and pending packet sizing: a whole multiple of the base
+    // sizing when the payload limit allows larger packets; the pending
+    // values are applied when the next packet is started, so that the
+    // packet in progress keeps the size it was prepared with (see
+    // set_payload_limit)
+    size_t samples_per_packet_;
+    size_t payload_size_;
+    size_t next_samples_per_packet_;
+    size_t next_payload_size_;
 
     packet::PacketPtr packet_;
     size_t packet_pos_;
+    core::nanoseconds_t packet_start_;
+
+    size_t packet_cnt_;
+    size_t sample_cnt_;
+
+    size_t silence_samples_;
+    bool dtx_active_;
+    bool marker_pending_;
 
     const packet::source_t source_;
     packet::seqnum_t seqnum_;
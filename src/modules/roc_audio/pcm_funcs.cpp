@@ -9,6 +9,19 @@
 #include "roc_audio/pcm_funcs.h"
 #include "roc_core/endian.h"
 
+// the vector kernels below convert between float samples and the wire
+// formats, so they don't apply in fixed-point builds
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(ROC_FIXED_POINT)
+#include <emmintrin.h>
+#define ROC_PCM_SSE2 1
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_NEON) && defined(__ORDER_LITTLE_ENDIAN__)       \
+    && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && !defined(ROC_FIXED_POINT)
+#include <arm_neon.h>
+#define ROC_PCM_NEON 1
+#endif
+
 namespace roc {
 namespace audio {
 
@@ -26,6 +39,20 @@ size_t pcm_payload_size_from_samples(size_t num_samples) {
 
 template <class T> T pcm_encode_one_sample(sample_t);
 
+#ifdef ROC_FIXED_POINT
+
+// Q15 samples match the 16-bit wire format exactly, so the conversion is
+// just a byte swap to network order.
+template <> int16_t inline pcm_encode_one_sample(sample_t s) {
+    return (int16_t)core::hton16((uint16_t)s);
+}
+
+inline sample_t pcm_decode_one_sample(int16_t s) {
+    return (sample_t)core::ntoh16((uint16_t)s);
+}
+
+#else // !ROC_FIXED_POINT
+
 template <> int16_t inline pcm_encode_one_sample(float s) {
     s *= 32768.0f;
     s = std::min(s, +32767.0f);
@@ -37,6 +64,468 @@ inline float pcm_decode_one_sample(int16_t s) {
     return float((int16_t)core::ntoh16((uint16_t)s)) / 32768.0f;
 }
 
+#endif // ROC_FIXED_POINT
+
+// 24-bit network-endian sample, packed to 3 bytes on the wire.
+struct int24_t {
+    uint8_t octets[3]; // most significant octet first
+};
+
+// the conversion templates derive the wire size from sizeof(Sample)
+typedef char int24_size_check[sizeof(int24_t) == 3 ? 1 : -1];
+
+#ifdef ROC_FIXED_POINT
+
+// Q15 to 24-bit is a left shift; the eight extra wire bits carry zeros.
+template <> int24_t inline pcm_encode_one_sample(sample_t s) {
+    const int32_t v = (int32_t)s << 8;
+
+    int24_t out;
+    out.octets[0] = (uint8_t)(v >> 16);
+    out.octets[1] = (uint8_t)(v >> 8);
+    out.octets[2] = (uint8_t)v;
+
+    return out;
+}
+
+inline sample_t pcm_decode_one_sample(int24_t s) {
+    // shift up and back down to sign-extend the 24-bit value, then
+    // drop the eight bits that don't fit into Q15
+    const int32_t v = (int32_t)(((uint32_t)s.octets[0] << 24)
+                                | ((uint32_t)s.octets[1] << 16)
+                                | ((uint32_t)s.octets[2] << 8))
+        >> 8;
+
+    return (sample_t)(v >> 8);
+}
+
+#else // !ROC_FIXED_POINT
+
+template <> int24_t inline pcm_encode_one_sample(float s) {
+    s *= 8388608.0f;
+    s = std::min(s, +8388607.0f);
+    s = std::max(s, -8388608.0f);
+
+    const int32_t v = (int32_t)s;
+
+    int24_t out;
+    out.octets[0] = (uint8_t)(v >> 16);
+    out.octets[1] = (uint8_t)(v >> 8);
+    out.octets[2] = (uint8_t)v;
+
+    return out;
+}
+
+inline float pcm_decode_one_sample(int24_t s) {
+    // shift up and back down to sign-extend the 24-bit value
+    const int32_t v = (int32_t)(((uint32_t)s.octets[0] << 24)
+                                | ((uint32_t)s.octets[1] << 16)
+                                | ((uint32_t)s.octets[2] << 8))
+        >> 8;
+
+    return float(v) / 8388608.0f;
+}
+
+#endif // ROC_FIXED_POINT
+
+// 32-bit network-endian IEEE 754 float on the wire.
+struct float32_t {
+    uint32_t bits;
+};
+
+#ifdef ROC_FIXED_POINT
+
+// The float wire format still goes through floating point; on FPU-less
+// targets it falls back to soft-float and should be avoided in favor of
+// the integer formats.
+template <> float32_t inline pcm_encode_one_sample(sample_t s) {
+    const float f = (float)s / 32768.0f;
+
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+
+    float32_t out;
+    out.bits = core::hton32(u);
+
+    return out;
+}
+
+inline sample_t pcm_decode_one_sample(float32_t s) {
+    const uint32_t u = core::ntoh32(s.bits);
+
+    float f;
+    memcpy(&f, &u, sizeof(f));
+
+    f *= 32768.0f;
+    f = std::min(f, +32767.0f);
+    f = std::max(f, -32768.0f);
+
+    return (sample_t)f;
+}
+
+#else // !ROC_FIXED_POINT
+
+template <> float32_t inline pcm_encode_one_sample(float s) {
+    uint32_t u;
+    memcpy(&u, &s, sizeof(u));
+
+    float32_t out;
+    out.bits = core::hton32(u);
+
+    return out;
+}
+
+inline float pcm_decode_one_sample(float32_t s) {
+    const uint32_t u = core::ntoh32(s.bits);
+
+    float f;
+    memcpy(&f, &u, sizeof(f));
+
+    return f;
+}
+
+#endif // ROC_FIXED_POINT
+
+// Contiguous conversion kernels. When the input and output channel masks are
+// equal, the channel loop in the generic encoder and decoder degenerates into
+// a plain array conversion, which these kernels vectorize: float to the wire
+// sample format (saturation plus a byte swap to network order), and back.
+
+template <class Sample>
+void pcm_encode_array(Sample* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<Sample>(in[n]);
+    }
+}
+
+template <class Sample>
+void pcm_decode_array(sample_t* out, const Sample* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+#ifdef ROC_PCM_SSE2
+
+// SSE2 is part of the x86_64 baseline, no runtime check needed.
+void pcm_encode_array(int16_t* out, const sample_t* in, size_t n_samples) {
+    const __m128 scale = _mm_set1_ps(32768.0f);
+    const __m128 max_val = _mm_set1_ps(+32767.0f);
+    const __m128 min_val = _mm_set1_ps(-32768.0f);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        __m128 lo = _mm_mul_ps(_mm_loadu_ps(in + n), scale);
+        __m128 hi = _mm_mul_ps(_mm_loadu_ps(in + n + 4), scale);
+
+        lo = _mm_max_ps(_mm_min_ps(lo, max_val), min_val);
+        hi = _mm_max_ps(_mm_min_ps(hi, max_val), min_val);
+
+        // truncate towards zero, as the scalar cast does
+        __m128i v = _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+
+        // swap bytes in every 16-bit lane (x86_64 is little-endian)
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+        _mm_storeu_si128((__m128i*)(out + n), v);
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<int16_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const int16_t* in, size_t n_samples) {
+    const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(in + n));
+
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+
+        // sign-extend 16-bit lanes to 32 bits
+        const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+
+        _mm_storeu_ps(out + n, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+        _mm_storeu_ps(out + n + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+// byte swap in every 32-bit lane (x86_64 is little-endian); SSE2 has no
+// byte shuffle, so the swap is composed from 16-bit operations
+inline __m128i mm_bswap32(__m128i v) {
+    v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    v = _mm_or_si128(_mm_slli_epi32(v, 16), _mm_srli_epi32(v, 16));
+    return v;
+}
+
+void pcm_encode_array(float32_t* out, const sample_t* in, size_t n_samples) {
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        const __m128i v = _mm_castps_si128(_mm_loadu_ps(in + n));
+        _mm_storeu_si128((__m128i*)(out + n), mm_bswap32(v));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<float32_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const float32_t* in, size_t n_samples) {
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(in + n));
+        _mm_storeu_ps(out + n, _mm_castsi128_ps(mm_bswap32(v)));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+// The packed 3-byte layout doesn't map to lane-wise vector stores, so only
+// the scale-clamp-convert part is vectorized and the octets are packed with
+// scalar stores, which is still a sizable win since the float work dominates.
+void pcm_encode_array(int24_t* out, const sample_t* in, size_t n_samples) {
+    const __m128 scale = _mm_set1_ps(8388608.0f);
+    const __m128 max_val = _mm_set1_ps(+8388607.0f);
+    const __m128 min_val = _mm_set1_ps(-8388608.0f);
+
+    uint8_t* p = (uint8_t*)out;
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(in + n), scale);
+        x = _mm_max_ps(_mm_min_ps(x, max_val), min_val);
+
+        int32_t v[4];
+        _mm_storeu_si128((__m128i*)v, _mm_cvttps_epi32(x));
+
+        for (size_t i = 0; i < 4; i++) {
+            *p++ = (uint8_t)(v[i] >> 16);
+            *p++ = (uint8_t)(v[i] >> 8);
+            *p++ = (uint8_t)v[i];
+        }
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<int24_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const int24_t* in, size_t n_samples) {
+    const __m128 scale = _mm_set1_ps(1.0f / 8388608.0f);
+
+    const uint8_t* p = (const uint8_t*)in;
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        int32_t v[4];
+
+        for (size_t i = 0; i < 4; i++) {
+            v[i] = (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+                             | ((uint32_t)p[2] << 8))
+                >> 8;
+            p += 3;
+        }
+
+        const __m128i x = _mm_loadu_si128((const __m128i*)v);
+        _mm_storeu_ps(out + n, _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+#endif // ROC_PCM_SSE2
+
+#ifdef ROC_PCM_NEON
+
+void pcm_encode_array(int16_t* out, const sample_t* in, size_t n_samples) {
+    const float32x4_t scale = vdupq_n_f32(32768.0f);
+    const float32x4_t max_val = vdupq_n_f32(+32767.0f);
+    const float32x4_t min_val = vdupq_n_f32(-32768.0f);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        float32x4_t lo = vmulq_f32(vld1q_f32(in + n), scale);
+        float32x4_t hi = vmulq_f32(vld1q_f32(in + n + 4), scale);
+
+        lo = vmaxq_f32(vminq_f32(lo, max_val), min_val);
+        hi = vmaxq_f32(vminq_f32(hi, max_val), min_val);
+
+        // vcvtq truncates towards zero, as the scalar cast does
+        const int16x8_t v = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(lo)),
+                                         vqmovn_s32(vcvtq_s32_f32(hi)));
+
+        // swap bytes in every 16-bit lane
+        vst1q_s16(out + n,
+                  vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(v))));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<int16_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const int16_t* in, size_t n_samples) {
+    const float32x4_t scale = vdupq_n_f32(1.0f / 32768.0f);
+
+    size_t n = 0;
+
+    for (; n + 8 <= n_samples; n += 8) {
+        int16x8_t v = vld1q_s16(in + n);
+
+        v = vreinterpretq_s16_u8(vrev16q_u8(vreinterpretq_u8_s16(v)));
+
+        const int32x4_t lo = vmovl_s16(vget_low_s16(v));
+        const int32x4_t hi = vmovl_s16(vget_high_s16(v));
+
+        vst1q_f32(out + n, vmulq_f32(vcvtq_f32_s32(lo), scale));
+        vst1q_f32(out + n + 4, vmulq_f32(vcvtq_f32_s32(hi), scale));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+void pcm_encode_array(float32_t* out, const sample_t* in, size_t n_samples) {
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        const uint8x16_t v = vreinterpretq_u8_f32(vld1q_f32(in + n));
+        vst1q_u8((uint8_t*)(out + n), vrev32q_u8(v));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<float32_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const float32_t* in, size_t n_samples) {
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        const uint8x16_t v = vld1q_u8((const uint8_t*)(in + n));
+        vst1q_f32(out + n, vreinterpretq_f32_u8(vrev32q_u8(v)));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+// see the note on the SSE2 kernel: only the float work is vectorized,
+// the 3-byte octets are packed with scalar stores
+void pcm_encode_array(int24_t* out, const sample_t* in, size_t n_samples) {
+    const float32x4_t scale = vdupq_n_f32(8388608.0f);
+    const float32x4_t max_val = vdupq_n_f32(+8388607.0f);
+    const float32x4_t min_val = vdupq_n_f32(-8388608.0f);
+
+    uint8_t* p = (uint8_t*)out;
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        float32x4_t x = vmulq_f32(vld1q_f32(in + n), scale);
+        x = vmaxq_f32(vminq_f32(x, max_val), min_val);
+
+        int32_t v[4];
+        vst1q_s32(v, vcvtq_s32_f32(x));
+
+        for (size_t i = 0; i < 4; i++) {
+            *p++ = (uint8_t)(v[i] >> 16);
+            *p++ = (uint8_t)(v[i] >> 8);
+            *p++ = (uint8_t)v[i];
+        }
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_encode_one_sample<int24_t>(in[n]);
+    }
+}
+
+void pcm_decode_array(sample_t* out, const int24_t* in, size_t n_samples) {
+    const float32x4_t scale = vdupq_n_f32(1.0f / 8388608.0f);
+
+    const uint8_t* p = (const uint8_t*)in;
+
+    size_t n = 0;
+
+    for (; n + 4 <= n_samples; n += 4) {
+        int32_t v[4];
+
+        for (size_t i = 0; i < 4; i++) {
+            v[i] = (int32_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+                             | ((uint32_t)p[2] << 8))
+                >> 8;
+            p += 3;
+        }
+
+        vst1q_f32(out + n, vmulq_f32(vcvtq_f32_s32(vld1q_s32(v)), scale));
+    }
+
+    for (; n < n_samples; n++) {
+        out[n] = pcm_decode_one_sample(in[n]);
+    }
+}
+
+#endif // ROC_PCM_NEON
+
+// Remap kernels for the common mono/stereo conversions. The generic
+// encoder and decoder walk the channel mask bit by bit for every sample;
+// for the canonical mono (0x1) and stereo (0x3) masks the remap is known
+// at compile time, so these unrolled loops are used instead. NumCh is a
+// template parameter, hence the dispatch branches below are resolved at
+// compile time.
+
+template <class Sample>
+void pcm_encode_mono_to_stereo(Sample* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        *out++ = pcm_encode_one_sample<Sample>(*in++);
+        *out++ = pcm_encode_one_sample<Sample>(0);
+    }
+}
+
+template <class Sample>
+void pcm_encode_stereo_to_mono(Sample* out, const sample_t* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        *out++ = pcm_encode_one_sample<Sample>(in[0]);
+        in += 2;
+    }
+}
+
+template <class Sample>
+void pcm_decode_mono_to_stereo(sample_t* out, const Sample* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        *out++ = pcm_decode_one_sample(*in++);
+        *out++ = 0;
+    }
+}
+
+template <class Sample>
+void pcm_decode_stereo_to_mono(sample_t* out, const Sample* in, size_t n_samples) {
+    for (size_t n = 0; n < n_samples; n++) {
+        *out++ = pcm_decode_one_sample(in[0]);
+        in += 2;
+    }
+}
+
 template <class Sample, size_t NumCh>
 size_t pcm_encode_samples(void* out_data,
                           size_t out_size,
@@ -59,6 +548,21 @@ size_t pcm_encode_samples(void* out_data,
 
     Sample* out_samples = (Sample*)out_data + (off * NumCh);
 
+    if (in_chan_mask == out_chan_mask) {
+        pcm_encode_array(out_samples, in_samples, in_n_samples * NumCh);
+        return in_n_samples;
+    }
+
+    if (NumCh == 2 && in_chan_mask == 0x1) {
+        pcm_encode_mono_to_stereo(out_samples, in_samples, in_n_samples);
+        return in_n_samples;
+    }
+
+    if (NumCh == 1 && in_chan_mask == 0x3) {
+        pcm_encode_stereo_to_mono(out_samples, in_samples, in_n_samples);
+        return in_n_samples;
+    }
+
     for (size_t ns = 0; ns < in_n_samples; ns++) {
         for (packet::channel_mask_t ch = 1; ch <= inout_chan_mask && ch != 0; ch <<= 1) {
             if (in_chan_mask & ch) {
@@ -68,7 +572,7 @@ size_t pcm_encode_samples(void* out_data,
                 in_samples++;
             } else {
                 if (out_chan_mask & ch) {
-                    *out_samples++ = 0;
+                    *out_samples++ = pcm_encode_one_sample<Sample>(0);
                 }
             }
         }
@@ -99,6 +603,21 @@ size_t pcm_decode_samples(const void* in_data,
 
     const Sample* in_samples = (const Sample*)in_data + (off * NumCh);
 
+    if (in_chan_mask == out_chan_mask) {
+        pcm_decode_array(out_samples, in_samples, out_n_samples * NumCh);
+        return out_n_samples;
+    }
+
+    if (NumCh == 1 && out_chan_mask == 0x3) {
+        pcm_decode_mono_to_stereo(out_samples, in_samples, out_n_samples);
+        return out_n_samples;
+    }
+
+    if (NumCh == 2 && out_chan_mask == 0x1) {
+        pcm_decode_stereo_to_mono(out_samples, in_samples, out_n_samples);
+        return out_n_samples;
+    }
+
     for (size_t ns = 0; ns < out_n_samples; ns++) {
         for (packet::channel_mask_t ch = 1; ch <= inout_chan_mask && ch != 0; ch <<= 1) {
             sample_t s = 0;
@@ -130,5 +649,33 @@ const PCMFuncs PCM_int16_2ch = {
     pcm_decode_samples<int16_t, 2>,
 };
 
+const PCMFuncs PCM_int24_1ch = {
+    pcm_samples_from_payload_size<int24_t, 1>,
+    pcm_payload_size_from_samples<int24_t, 1>,
+    pcm_encode_samples<int24_t, 1>,
+    pcm_decode_samples<int24_t, 1>,
+};
+
+const PCMFuncs PCM_int24_2ch = {
+    pcm_samples_from_payload_size<int24_t, 2>,
+    pcm_payload_size_from_samples<int24_t, 2>,
+    pcm_encode_samples<int24_t, 2>,
+    pcm_decode_samples<int24_t, 2>,
+};
+
+const PCMFuncs PCM_float32_1ch = {
+    pcm_samples_from_payload_size<float32_t, 1>,
+    pcm_payload_size_from_samples<float32_t, 1>,
+    pcm_encode_samples<float32_t, 1>,
+    pcm_decode_samples<float32_t, 1>,
+};
+
+const PCMFuncs PCM_float32_2ch = {
+    pcm_samples_from_payload_size<float32_t, 2>,
+    pcm_payload_size_from_samples<float32_t, 2>,
+    pcm_encode_samples<float32_t, 2>,
+    pcm_decode_samples<float32_t, 2>,
+};
+
 } // namespace audio
 } // namespace roc
@@ -50,6 +50,18 @@ extern const PCMFuncs PCM_int16_1ch;
 //! PCM functions for 16-bit 2-channel audio.
 extern const PCMFuncs PCM_int16_2ch;
 
+//! PCM functions for 24-bit 1-channel audio.
+extern const PCMFuncs PCM_int24_1ch;
+
+//! PCM functions for 24-bit 2-channel audio.
+extern const PCMFuncs PCM_int24_2ch;
+
+//! PCM functions for 32-bit float 1-channel audio.
+extern const PCMFuncs PCM_float32_1ch;
+
+//! PCM functions for 32-bit float 2-channel audio.
+extern const PCMFuncs PCM_float32_2ch;
+
 } // namespace audio
 } // namespace roc
 
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/profiling_reader.h"
+
+namespace roc {
+namespace audio {
+
+ProfilingReader::ProfilingReader(IReader& reader)
+    : reader_(reader)
+    , cpu_time_(0) {
+}
+
+void ProfilingReader::read(Frame& frame) {
+    const core::nanoseconds_t start = core::thread_cputime();
+
+    reader_.read(frame);
+
+    cpu_time_ += core::thread_cputime() - start;
+}
+
+core::nanoseconds_t ProfilingReader::cpu_time() const {
+    return cpu_time_;
+}
+
+} // namespace audio
+} // namespace roc
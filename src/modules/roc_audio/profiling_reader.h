@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/profiling_reader.h
+//! @brief Profiling reader.
+
+#ifndef ROC_AUDIO_PROFILING_READER_H_
+#define ROC_AUDIO_PROFILING_READER_H_
+
+#include "roc_audio/frame.h"
+#include "roc_audio/ireader.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace audio {
+
+//! Accumulates CPU time spent reading from the underlying reader.
+//! @remarks
+//!  Measures the thread CPU time of every read() call, so sleeping and
+//!  preemption inside the call are not accounted. Placed at the top of a
+//!  pipeline chain, it gives the CPU cost of the whole chain.
+class ProfilingReader : public IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    ProfilingReader(IReader& reader);
+
+    //! Read audio frame.
+    virtual void read(Frame&);
+
+    //! Get CPU time consumed by read() calls, in nanoseconds.
+    //! @remarks
+    //!  May be called from another thread; the unsynchronized read is
+    //!  acceptable for an accounting counter.
+    core::nanoseconds_t cpu_time() const;
+
+private:
+    IReader& reader_;
+
+    core::nanoseconds_t cpu_time_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_PROFILING_READER_H_
@@ -26,6 +26,7 @@ ProfilingWriter::ProfilingWriter(IWriter& writer,
     , rate_limiter_(LogInterval)
     , avg_speed_(0)
     , avg_len_(0)
+    , last_write_start_(0)
     , sample_rate_(sample_rate)
     , num_channels_(packet::num_channels(channels)) {
     if (num_channels_ == 0) {
@@ -45,22 +46,58 @@ void ProfilingWriter::write(Frame& frame) {
 
     const double speed = (double)frame.size() / num_channels_ / elapsed * core::Second;
 
-    update_(speed);
+    update_(speed, frame.cycle_time());
+}
+
+const core::Histogram& ProfilingWriter::frame_time_histogram() const {
+    return frame_time_hist_;
+}
+
+const core::Histogram& ProfilingWriter::frame_gap_histogram() const {
+    return frame_gap_hist_;
+}
+
+void ProfilingWriter::dump() const {
+    roc_log(LogInfo,
+            "profiling writer: frame time: n=%lu p50=%ld p90=%ld p99=%ld p99.9=%ld"
+            " max=%ld",
+            (unsigned long)frame_time_hist_.total(),
+            (long)frame_time_hist_.percentile(50), (long)frame_time_hist_.percentile(90),
+            (long)frame_time_hist_.percentile(99),
+            (long)frame_time_hist_.percentile(99.9),
+            (long)frame_time_hist_.percentile(100));
+
+    roc_log(LogInfo,
+            "profiling writer: frame gap: n=%lu p50=%ld p90=%ld p99=%ld p99.9=%ld"
+            " max=%ld",
+            (unsigned long)frame_gap_hist_.total(),
+            (long)frame_gap_hist_.percentile(50), (long)frame_gap_hist_.percentile(90),
+            (long)frame_gap_hist_.percentile(99), (long)frame_gap_hist_.percentile(99.9),
+            (long)frame_gap_hist_.percentile(100));
 }
 
 core::nanoseconds_t ProfilingWriter::write_(Frame& frame) {
     const core::nanoseconds_t start = core::timestamp();
 
+    if (last_write_start_ != 0) {
+        frame_gap_hist_.add(start - last_write_start_);
+    }
+    last_write_start_ = start;
+
     writer_.write(frame);
 
-    return core::timestamp() - start;
+    const core::nanoseconds_t elapsed = core::timestamp() - start;
+
+    frame_time_hist_.add(elapsed);
+
+    return elapsed;
 }
 
-void ProfilingWriter::update_(double speed) {
+void ProfilingWriter::update_(double speed, core::nanoseconds_t cycle_time) {
     avg_len_ += 1;
     avg_speed_ += (speed - avg_speed_) / avg_len_;
 
-    if (rate_limiter_.allow()) {
+    if (rate_limiter_.allow(cycle_time)) {
         roc_log(LogDebug, "profiling writer: %lu sample/sec (%.2f sec/sec)",
                 (unsigned long)avg_speed_, avg_speed_ / sample_rate_);
     }
@@ -13,6 +13,7 @@
 #define ROC_AUDIO_PROFILING_WRITER_H_
 
 #include "roc_audio/iwriter.h"
+#include "roc_core/histogram.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/rate_limiter.h"
 #include "roc_core/time.h"
@@ -30,9 +31,24 @@ public:
     //! Write audio frame.
     virtual void write(Frame& frame);
 
+    //! Get histogram of per-frame write durations.
+    //! @remarks
+    //!  May be queried from another thread while write() is running.
+    const core::Histogram& frame_time_histogram() const;
+
+    //! Get histogram of gaps between consecutive frames.
+    //! @remarks
+    //!  A gap is the time between the beginnings of two successive
+    //!  write() calls. May be queried from another thread while write()
+    //!  is running.
+    const core::Histogram& frame_gap_histogram() const;
+
+    //! Dump histogram percentiles to log.
+    void dump() const;
+
 private:
     core::nanoseconds_t write_(Frame& frame);
-    void update_(double speed);
+    void update_(double speed, core::nanoseconds_t cycle_time);
 
     IWriter& writer_;
 
@@ -41,6 +57,11 @@ private:
     double avg_speed_;
     double avg_len_;
 
+    core::Histogram frame_time_hist_;
+    core::Histogram frame_gap_hist_;
+
+    core::nanoseconds_t last_write_start_;
+
     const size_t sample_rate_;
     const size_t num_channels_;
 };
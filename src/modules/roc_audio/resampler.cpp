@@ -7,9 +7,24 @@
  */
 
 #include "roc_audio/resampler.h"
+#include "roc_audio/sinc_table_cache.h"
+#include "roc_core/cpu_features.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/trace.h"
+
+// the vector kernels below operate on float samples, so they don't
+// apply in fixed-point builds
+#if defined(__GNUC__) && defined(__x86_64__) && !defined(ROC_FIXED_POINT)
+#include <immintrin.h>
+#define ROC_RESAMPLER_X86_64 1
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_NEON) && !defined(ROC_FIXED_POINT)
+#include <arm_neon.h>
+#define ROC_RESAMPLER_NEON 1
+#endif
 
 namespace roc {
 namespace audio {
@@ -31,6 +46,18 @@ const uint32_t FRACT_BIT_COUNT = 20;
 // One in terms of Q8.24.
 const fixedpoint_t qt_one = 1 << FRACT_BIT_COUNT;
 
+// Limits for the fixed-ratio polyphase fast path: maximum denominator of
+// the detected rational ratio (44100/48000 reduces to 147/160), and the
+// maximum total size of the per-phase weight cache, in samples.
+const size_t MAX_POLY_PHASES = 256;
+const size_t MAX_POLY_CACHE = 32768;
+
+// Maximum difference between the scaling factor and the nearest rational
+// for the fixed-ratio fast path to engage. Tight enough that dynamically
+// adjusted scaling practically never matches, and snapping a genuinely
+// fixed ratio to the exact rational is below any hearing threshold.
+const float POLY_RATIO_EPSILON = 1e-7f;
+
 // Convert float to fixed-point.
 inline fixedpoint_t float_to_fixedpoint(const float t) {
     return (fixedpoint_t)(t * (float)qt_one);
@@ -70,6 +97,146 @@ inline size_t calc_bits(size_t n) {
     return c;
 }
 
+// Dot-product kernels. Each kernel convolves n_taps positions of an
+// interleaved frame with per-position weights, accumulating one sum per
+// channel into acc. Since the input is interleaved, samples of all
+// channels belonging to one tap are contiguous, so both (all) channels
+// are convolved in a single vector pass.
+
+void dot_scalar(
+    const sample_t* frame, const sample_t* weights, size_t n_taps, size_t n_ch, sample_t* acc) {
+    for (size_t t = 0; t < n_taps; t++) {
+        for (size_t ch = 0; ch < n_ch; ch++) {
+            acc[ch] += weights[t] * frame[t * n_ch + ch];
+        }
+    }
+}
+
+#ifdef ROC_RESAMPLER_X86_64
+
+// SSE2 is part of the x86_64 baseline, no runtime check needed.
+void dot_sse2(
+    const sample_t* frame, const sample_t* weights, size_t n_taps, size_t n_ch, sample_t* acc) {
+    size_t t = 0;
+
+    if (n_ch == 2) {
+        __m128 vacc = _mm_setzero_ps();
+
+        for (; t + 4 <= n_taps; t += 4) {
+            const __m128 w = _mm_loadu_ps(weights + t);
+            vacc = _mm_add_ps(
+                vacc, _mm_mul_ps(_mm_unpacklo_ps(w, w), _mm_loadu_ps(frame + t * 2)));
+            vacc = _mm_add_ps(
+                vacc, _mm_mul_ps(_mm_unpackhi_ps(w, w), _mm_loadu_ps(frame + t * 2 + 4)));
+        }
+
+        float tmp[4];
+        _mm_storeu_ps(tmp, vacc);
+        acc[0] += tmp[0] + tmp[2];
+        acc[1] += tmp[1] + tmp[3];
+    } else if (n_ch == 1) {
+        __m128 vacc = _mm_setzero_ps();
+
+        for (; t + 4 <= n_taps; t += 4) {
+            vacc = _mm_add_ps(
+                vacc, _mm_mul_ps(_mm_loadu_ps(weights + t), _mm_loadu_ps(frame + t)));
+        }
+
+        float tmp[4];
+        _mm_storeu_ps(tmp, vacc);
+        acc[0] += tmp[0] + tmp[1] + tmp[2] + tmp[3];
+    }
+
+    dot_scalar(frame + t * n_ch, weights + t, n_taps - t, n_ch, acc);
+}
+
+__attribute__((target("avx2,fma"))) void dot_avx2(
+    const sample_t* frame, const sample_t* weights, size_t n_taps, size_t n_ch, sample_t* acc) {
+    size_t t = 0;
+
+    if (n_ch == 2) {
+        __m256 vacc = _mm256_setzero_ps();
+
+        for (; t + 4 <= n_taps; t += 4) {
+            const __m128 w = _mm_loadu_ps(weights + t);
+            const __m256 wd = _mm256_insertf128_ps(
+                _mm256_castps128_ps256(_mm_unpacklo_ps(w, w)), _mm_unpackhi_ps(w, w), 1);
+            vacc = _mm256_fmadd_ps(wd, _mm256_loadu_ps(frame + t * 2), vacc);
+        }
+
+        float tmp[8];
+        _mm256_storeu_ps(tmp, vacc);
+        acc[0] += tmp[0] + tmp[2] + tmp[4] + tmp[6];
+        acc[1] += tmp[1] + tmp[3] + tmp[5] + tmp[7];
+    } else if (n_ch == 1) {
+        __m256 vacc = _mm256_setzero_ps();
+
+        for (; t + 8 <= n_taps; t += 8) {
+            vacc = _mm256_fmadd_ps(_mm256_loadu_ps(weights + t),
+                                   _mm256_loadu_ps(frame + t), vacc);
+        }
+
+        float tmp[8];
+        _mm256_storeu_ps(tmp, vacc);
+        acc[0] += tmp[0] + tmp[1] + tmp[2] + tmp[3] + tmp[4] + tmp[5] + tmp[6] + tmp[7];
+    }
+
+    dot_scalar(frame + t * n_ch, weights + t, n_taps - t, n_ch, acc);
+}
+
+#endif // ROC_RESAMPLER_X86_64
+
+#ifdef ROC_RESAMPLER_NEON
+
+void dot_neon(
+    const sample_t* frame, const sample_t* weights, size_t n_taps, size_t n_ch, sample_t* acc) {
+    size_t t = 0;
+
+    if (n_ch == 2) {
+        float32x4_t vacc = vdupq_n_f32(0);
+
+        for (; t + 4 <= n_taps; t += 4) {
+            const float32x4_t w = vld1q_f32(weights + t);
+            const float32x4x2_t wd = vzipq_f32(w, w);
+            vacc = vmlaq_f32(vacc, wd.val[0], vld1q_f32(frame + t * 2));
+            vacc = vmlaq_f32(vacc, wd.val[1], vld1q_f32(frame + t * 2 + 4));
+        }
+
+        acc[0] += vgetq_lane_f32(vacc, 0) + vgetq_lane_f32(vacc, 2);
+        acc[1] += vgetq_lane_f32(vacc, 1) + vgetq_lane_f32(vacc, 3);
+    } else if (n_ch == 1) {
+        float32x4_t vacc = vdupq_n_f32(0);
+
+        for (; t + 4 <= n_taps; t += 4) {
+            vacc = vmlaq_f32(vacc, vld1q_f32(weights + t), vld1q_f32(frame + t));
+        }
+
+        acc[0] += vgetq_lane_f32(vacc, 0) + vgetq_lane_f32(vacc, 1)
+            + vgetq_lane_f32(vacc, 2) + vgetq_lane_f32(vacc, 3);
+    }
+
+    dot_scalar(frame + t * n_ch, weights + t, n_taps - t, n_ch, acc);
+}
+
+#endif // ROC_RESAMPLER_NEON
+
+typedef void (*dot_fn_t)(
+    const sample_t* frame, const sample_t* weights, size_t n_taps, size_t n_ch, sample_t* acc);
+
+dot_fn_t select_dot_fn() {
+#ifdef ROC_RESAMPLER_X86_64
+    core::CpuFeatures& cpu = core::CpuFeatures::instance();
+    if (cpu.has_avx2() && cpu.has_fma()) {
+        return &dot_avx2;
+    }
+    return &dot_sse2;
+#elif defined(ROC_RESAMPLER_NEON)
+    return &dot_neon;
+#else
+    return &dot_scalar;
+#endif
+}
+
 } // namespace
 
 Resampler::Resampler(core::IAllocator& allocator,
@@ -85,12 +252,29 @@ Resampler::Resampler(core::IAllocator& allocator,
     , scaling_(1.0)
     , frame_size_(frame_size)
     , frame_size_ch_(channels_num_ ? frame_size / channels_num_ : 0)
+    , planar_(config.planar && !config.cubic && channels_num_ > 1)
+    , cubic_(config.cubic)
     , window_size_(config.window_size)
     , qt_half_sinc_window_size_(float_to_fixedpoint(window_size_))
     , window_interp_(config.window_interp)
     , window_interp_bits_(calc_bits(config.window_interp))
-    , sinc_table_(allocator)
     , sinc_table_ptr_(NULL)
+    , sinc_table_q15_ptr_(NULL)
+    , window_buf_(allocator)
+    , accum_buf_(allocator)
+    , planar_buf_(allocator)
+    , planar_head_(0)
+    , last_cur_data_(NULL)
+    , last_next_data_(NULL)
+    , fixed_ratio_(false)
+    , ratio_num_(0)
+    , ratio_den_(0)
+    , phase_index_(0)
+    , poly_stride_(0)
+    , phase_table_(allocator)
+    , poly_weights_(allocator)
+    , poly_taps_(allocator)
+    , dot_fn_(select_dot_fn())
     , qt_half_window_size_(float_to_fixedpoint((float)window_size_ / scaling_))
     , qt_epsilon_(float_to_fixedpoint(5e-8f))
     , qt_frame_size_(fixedpoint_t(frame_size_ch_ << FRACT_BIT_COUNT))
@@ -101,15 +285,66 @@ Resampler::Resampler(core::IAllocator& allocator,
     if (!check_config_()) {
         return;
     }
-    if (!fill_sinc_()) {
+
+    if (cubic_) {
+        // The interpolation needs no tables and no scratch buffers.
+        roc_log(LogDebug,
+                "resampler: initializing: cubic interpolation mode:"
+                " frame_size=%lu channels_num=%lu",
+                (unsigned long)frame_size_, (unsigned long)channels_num_);
+
+        valid_ = true;
+        return;
+    }
+
+#ifdef ROC_FIXED_POINT
+    // the sinc filter accumulates in floating point and its table would
+    // collapse to a few integer levels in Q15; fixed-point builds should
+    // use the cubic interpolation profile instead
+    roc_log(LogError,
+            "resampler: sinc filter is not supported in fixed-point mode,"
+            " use cubic interpolation profile");
+    return;
+#endif
+
+    // Sinc table contents depend only on window_size and window_interp,
+    // so it is shared between all resamplers with the same config.
+    if (config.int16_table) {
+        sinc_table_q15_ptr_ =
+            SincTableCache::instance().get_int16(window_size_, window_interp_);
+        if (!sinc_table_q15_ptr_) {
+            return;
+        }
+    } else {
+        sinc_table_ptr_ = SincTableCache::instance().get(window_size_, window_interp_);
+        if (!sinc_table_ptr_) {
+            return;
+        }
+    }
+
+    // The window may span up to the whole previous and current frames.
+    if (!window_buf_.resize(frame_size_ch_ * 2 + 2)) {
+        roc_log(LogError, "resampler: can't allocate window buffer");
+        return;
+    }
+    if (!accum_buf_.resize(channels_num_)) {
+        roc_log(LogError, "resampler: can't allocate accumulators");
+        return;
+    }
+
+    // One plane per channel for each of the three input frames.
+    if (planar_ && !planar_buf_.resize(frame_size_ * 3)) {
+        roc_log(LogError, "resampler: can't allocate planar buffer");
         return;
     }
 
     roc_log(LogDebug,
             "resampler: initializing: "
-            "window_interp=%lu window_size=%lu frame_size=%lu channels_num=%lu",
+            "window_interp=%lu window_size=%lu frame_size=%lu channels_num=%lu planar=%d"
+            " int16_table=%d",
             (unsigned long)window_interp_, (unsigned long)window_size_,
-            (unsigned long)frame_size_, (unsigned long)channels_num_);
+            (unsigned long)frame_size_, (unsigned long)channels_num_, (int)planar_,
+            (int)config.int16_table);
 
     valid_ = true;
 }
@@ -130,6 +365,13 @@ bool Resampler::set_scaling(float new_scaling) {
         return false;
     }
 
+    if (cubic_) {
+        // The interpolation always uses one sample on the left and two on
+        // the right; there is no window to adjust and no phases to cache.
+        scaling_ = new_scaling;
+        return true;
+    }
+
     // In case of upscaling one should properly shift the edge frequency
     // of the digital filter. In both cases it's sensible to decrease the
     // edge frequency to leave some.
@@ -162,16 +404,92 @@ bool Resampler::set_scaling(float new_scaling) {
 
     scaling_ = new_scaling;
 
+    update_fixed_ratio_(new_scaling);
+
     return true;
 }
 
+// Checks whether the scaling factor is a rational with a small denominator
+// and if so, enables the polyphase fast path: with scaling num/den, the
+// fractional phase of the output grid takes only den distinct values, so
+// the window weights may be cached per phase instead of being recomputed
+// for every output sample.
+void Resampler::update_fixed_ratio_(float new_scaling) {
+    size_t num = 0;
+    size_t den = 0;
+
+    for (size_t m = 1; m <= MAX_POLY_PHASES; m++) {
+        const float l = new_scaling * (float)m;
+        const size_t l_round = (size_t)(l + 0.5f);
+
+        const float diff = l > (float)l_round ? l - (float)l_round : (float)l_round - l;
+
+        if (l_round != 0 && diff < POLY_RATIO_EPSILON * (float)m) {
+            num = l_round;
+            den = m;
+            break;
+        }
+    }
+
+    if (den == 0) {
+        fixed_ratio_ = false;
+        return;
+    }
+
+    // Upper bound of the window length for the current scaling.
+    const size_t max_taps = fixedpoint_to_size(qt_half_window_size_) * 2 + 4;
+
+    if (den * max_taps > MAX_POLY_CACHE) {
+        fixed_ratio_ = false;
+        return;
+    }
+
+    const bool ratio_changed = !fixed_ratio_ || num != ratio_num_ || den != ratio_den_
+        || max_taps > poly_stride_;
+
+    if (ratio_changed) {
+        if (!phase_table_.resize(den) || !poly_taps_.resize(den)
+            || !poly_weights_.resize(den * max_taps)) {
+            roc_log(LogError, "resampler: can't allocate polyphase cache");
+            fixed_ratio_ = false;
+            return;
+        }
+
+        for (size_t k = 0; k < den; k++) {
+            phase_table_[k] =
+                (fixedpoint_t)(((long_fixedpoint_t)k << FRACT_BIT_COUNT) / den);
+            poly_taps_[k] = 0;
+        }
+
+        ratio_num_ = num;
+        ratio_den_ = den;
+        poly_stride_ = max_taps;
+
+        roc_log(LogDebug,
+                "resampler: fixed ratio polyphase mode:"
+                " ratio=%lu/%lu max_taps=%lu scaling=%.9f",
+                (unsigned long)num, (unsigned long)den, (unsigned long)max_taps,
+                (double)new_scaling);
+    }
+
+    // Snap the current time position to the phase grid. The snap is at most
+    // half a phase step, done once when the mode engages.
+    phase_index_ = (((qt_sample_ & FRACT_PART_MASK) * den + qt_one / 2) / qt_one) % den;
+    qt_sample_ = (qt_sample_ & INTEGER_PART_MASK) + phase_table_[phase_index_];
+
+    fixed_ratio_ = true;
+}
+
 bool Resampler::resample_buff(Frame& out) {
     roc_panic_if(!prev_frame_);
     roc_panic_if(!curr_frame_);
     roc_panic_if(!next_frame_);
 
+    ROC_TRACE2(resampler_resample_begin, out.size(), out_frame_pos_);
+
     for (; out_frame_pos_ < out.size(); out_frame_pos_ += channels_num_) {
         if (qt_sample_ >= qt_frame_size_) {
+            ROC_TRACE2(resampler_resample_end, out.size(), out_frame_pos_);
             return false;
         }
 
@@ -183,12 +501,27 @@ bool Resampler::resample_buff(Frame& out) {
         }
 
         sample_t* out_data = out.data();
-        for (size_t channel = 0; channel < channels_num_; ++channel) {
-            out_data[out_frame_pos_ + channel] = resample_(channel);
+        if (cubic_) {
+            resample_cubic_(out_data + out_frame_pos_);
+        } else {
+            resample_(out_data + out_frame_pos_);
+        }
+
+        if (fixed_ratio_) {
+            // advance the phase on the exact rational grid, so that the
+            // fractional part always hits a cached phase
+            phase_index_ += ratio_num_;
+            qt_sample_ = (qt_sample_ & INTEGER_PART_MASK)
+                + ((fixedpoint_t)(phase_index_ / ratio_den_) << FRACT_BIT_COUNT)
+                + phase_table_[phase_index_ % ratio_den_];
+            phase_index_ %= ratio_den_;
+        } else {
+            qt_sample_ += qt_dt_;
         }
-        qt_sample_ += qt_dt_;
     }
     out_frame_pos_ = 0;
+
+    ROC_TRACE2(resampler_resample_end, out.size(), out_frame_pos_);
     return true;
 }
 
@@ -244,39 +577,130 @@ void Resampler::renew_buffers(core::Slice<sample_t>& prev,
     // scaling_ may change every frame so it have to be smooth
     qt_dt_ = float_to_fixedpoint(scaling_);
 
-    prev_frame_ = prev.data();
-    curr_frame_ = cur.data();
-    next_frame_ = next.data();
+    if (planar_) {
+        // In the steady state the caller slides the window by rotating the
+        // same three buffers, so the previous and current frames were
+        // already deinterleaved on earlier renews and still sit in the
+        // ring; only the new next frame is scattered, and the ring head
+        // advances by one segment. Any other staging pattern falls back to
+        // deinterleaving the whole window.
+        if (prev.data() == last_cur_data_ && cur.data() == last_next_data_) {
+            planar_head_ = (planar_head_ + 1) % 3;
+        } else {
+            planar_head_ = 0;
+            deinterleave_(&planar_buf_[0], prev.data());
+            deinterleave_(&planar_buf_[frame_size_], cur.data());
+        }
+
+        const size_t seg_next = (planar_head_ + 2) % 3;
+        deinterleave_(&planar_buf_[seg_next * frame_size_], next.data());
+
+        prev_frame_ = &planar_buf_[planar_head_ * frame_size_];
+        curr_frame_ = &planar_buf_[(planar_head_ + 1) % 3 * frame_size_];
+        next_frame_ = &planar_buf_[seg_next * frame_size_];
+
+        last_cur_data_ = cur.data();
+        last_next_data_ = next.data();
+    } else {
+        prev_frame_ = prev.data();
+        curr_frame_ = cur.data();
+        next_frame_ = next.data();
+    }
 }
 
-bool Resampler::fill_sinc_() {
-    if (!sinc_table_.resize(window_size_ * window_interp_ + 2)) {
-        roc_log(LogError, "resampler: can't allocate sinc table");
-        return false;
+void Resampler::reset_window() {
+    last_cur_data_ = NULL;
+    last_next_data_ = NULL;
+}
+
+// Fetches one input sample at logical position i relative to the start of
+// the current frame; negative positions fall into the previous frame and
+// positions past the frame end into the next one.
+inline sample_t Resampler::tap_(const ssize_t i, const size_t ch_offset) const {
+    if (i < 0) {
+        return prev_frame_[channelize_index((size_t)((ssize_t)frame_size_ch_ + i),
+                                            ch_offset)];
+    }
+    if ((size_t)i >= frame_size_ch_) {
+        return next_frame_[channelize_index((size_t)i - frame_size_ch_, ch_offset)];
     }
+    return curr_frame_[channelize_index((size_t)i, ch_offset)];
+}
 
-    const double sinc_step = 1.0 / (double)window_interp_;
-    double sinc_t = sinc_step;
+// Catmull-Rom cubic interpolation over the four samples around the current
+// time position.
+#ifdef ROC_FIXED_POINT
+
+void Resampler::resample_cubic_(sample_t* out_data) {
+    const ssize_t i = (ssize_t)fixedpoint_to_size(qfloor(qt_sample_));
+
+    // fractional position quantized to Q15
+    const int32_t t =
+        (int32_t)((qt_sample_ & FRACT_PART_MASK) >> (FRACT_BIT_COUNT - 15));
+
+    for (size_t ch = 0; ch < channels_num_; ch++) {
+        const int32_t p0 = tap_(i - 1, ch);
+        const int32_t p1 = tap_(i, ch);
+        const int32_t p2 = tap_(i + 1, ch);
+        const int32_t p3 = tap_(i + 2, ch);
+
+        // Horner evaluation of the polynomial; intermediate products of a
+        // Q15 position and a Q15 sum are formed in 64 bits (one widening
+        // multiply per step) and shifted back down to Q15, with the final
+        // shift also folding in the 0.5 factor
+        int32_t acc = 3 * (p1 - p2) + p3 - p0;
+        acc = (2 * p0 - 5 * p1 + 4 * p2 - p3) + (int32_t)(((int64_t)t * acc) >> 15);
+        acc = (p2 - p0) + (int32_t)(((int64_t)t * acc) >> 15);
+        acc = p1 + (int32_t)(((int64_t)t * acc) >> 16);
+
+        if (acc > SampleMax) {
+            acc = SampleMax;
+        } else if (acc < SampleMin) {
+            acc = SampleMin;
+        }
 
-    sinc_table_[0] = 1.0f;
-    for (size_t i = 1; i < sinc_table_.size(); ++i) {
-        const double window = 0.54
-            - 0.46
-                * std::cos(2 * M_PI
-                           * ((double)(i - 1) / 2.0 / (double)sinc_table_.size() + 0.5));
-        sinc_table_[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
-        sinc_t += sinc_step;
+        out_data[ch] = (sample_t)acc;
     }
-    sinc_table_[sinc_table_.size() - 2] = 0;
-    sinc_table_[sinc_table_.size() - 1] = 0;
+}
 
-    sinc_table_ptr_ = &sinc_table_[0];
+#else // !ROC_FIXED_POINT
 
-    return true;
+void Resampler::resample_cubic_(sample_t* out_data) {
+    const ssize_t i = (ssize_t)fixedpoint_to_size(qfloor(qt_sample_));
+    const sample_t t = (sample_t)fractional(qt_sample_);
+
+    for (size_t ch = 0; ch < channels_num_; ch++) {
+        const sample_t p0 = tap_(i - 1, ch);
+        const sample_t p1 = tap_(i, ch);
+        const sample_t p2 = tap_(i + 1, ch);
+        const sample_t p3 = tap_(i + 2, ch);
+
+        out_data[ch] = p1
+            + 0.5f * t
+                * ((p2 - p0)
+                   + t * ((2 * p0 - 5 * p1 + 4 * p2 - p3)
+                          + t * (3 * (p1 - p2) + p3 - p0)));
+    }
+}
+
+#endif // ROC_FIXED_POINT
+
+// Scatters an interleaved frame into per-channel contiguous planes, so
+// that the convolution in resample_() can run on unit-stride data.
+void Resampler::deinterleave_(sample_t* planes, const sample_t* frame) const {
+    for (size_t ch = 0; ch < channels_num_; ch++) {
+        sample_t* plane = planes + ch * frame_size_ch_;
+        const sample_t* in = frame + ch;
+
+        for (size_t i = 0; i < frame_size_ch_; i++) {
+            plane[i] = *in;
+            in += channels_num_;
+        }
+    }
 }
 
 // Computes sinc value in x position using linear interpolation between
-// table values from sinc_table.h
+// table values from the shared sinc table.
 //
 // During going through input signal window only integer part of argument changes,
 // that's why there are two arguments in this function: integer part and fractional
@@ -284,114 +708,178 @@ bool Resampler::fill_sinc_() {
 sample_t Resampler::sinc_(const fixedpoint_t x, const float fract_x) {
     const size_t index = (x >> (FRACT_BIT_COUNT - window_interp_bits_));
 
-    const sample_t hl = sinc_table_ptr_[index];     // table index smaller than x
-    const sample_t hh = sinc_table_ptr_[index + 1]; // table index next to x
+    float hl; // table index smaller than x
+    float hh; // table index next to x
 
-    const sample_t result = hl + fract_x * (hh - hl);
+    if (sinc_table_q15_ptr_) {
+        // the quantized table is dequantized on lookup; the branch never
+        // changes direction at runtime, so it predicts perfectly
+        hl = (float)sinc_table_q15_ptr_[index] * (1.0f / 32767.0f);
+        hh = (float)sinc_table_q15_ptr_[index + 1] * (1.0f / 32767.0f);
+    } else {
+        hl = sinc_table_ptr_[index];
+        hh = sinc_table_ptr_[index + 1];
+    }
+
+    const float result = hl + fract_x * (hh - hl);
 
     return scaling_ > 1.0f ? result / scaling_ : result;
 }
 
-sample_t Resampler::resample_(const size_t channel_offset) {
+void Resampler::resample_(sample_t* out_data) {
     // Index of first input sample in window.
     size_t ind_begin_prev;
 
     // Window lasts till that index.
-    const size_t ind_end_prev = channelize_index(frame_size_ch_, channel_offset);
+    const size_t ind_end_prev = frame_size_ch_;
 
     size_t ind_begin_cur;
     size_t ind_end_cur;
 
-    const size_t ind_begin_next = channelize_index(0, channel_offset);
     size_t ind_end_next;
 
+    // All indices below are positions inside a single channel; the sinc
+    // weights are the same for every channel, so they are computed once
+    // into window_buf_ and then the interleaved frames are convolved
+    // with them for all channels in one pass.
+
     ind_begin_prev = (qt_sample_ >= qt_half_window_size_)
         ? frame_size_ch_
         : fixedpoint_to_size(qceil(qt_sample_ + (qt_frame_size_ - qt_half_window_size_)));
-    // ind_begin_prev is comparable with channel_len_ till we'll convert it to channalyzed
-    // presentation.
     roc_panic_if(ind_begin_prev > frame_size_ch_);
-    ind_begin_prev = channelize_index(ind_begin_prev, channel_offset);
 
     ind_begin_cur = (qt_sample_ >= qt_half_window_size_)
         ? fixedpoint_to_size(qceil(qt_sample_ - qt_half_window_size_))
         : 0;
     roc_panic_if(ind_begin_cur > frame_size_ch_);
-    ind_begin_cur = channelize_index(ind_begin_cur, channel_offset);
 
     ind_end_cur = ((qt_sample_ + qt_half_window_size_) > qt_frame_size_)
         ? frame_size_ch_ - 1
         : fixedpoint_to_size(qfloor(qt_sample_ + qt_half_window_size_));
     roc_panic_if(ind_end_cur > frame_size_ch_);
-    ind_end_cur = channelize_index(ind_end_cur, channel_offset);
 
     ind_end_next = ((qt_sample_ + qt_half_window_size_) > qt_frame_size_)
         ? fixedpoint_to_size(qfloor(qt_sample_ + qt_half_window_size_ - qt_frame_size_))
             + 1
         : 0;
     roc_panic_if(ind_end_next > frame_size_ch_);
-    ind_end_next = channelize_index(ind_end_next, channel_offset);
 
-    // Counter inside window.
-    // t_sinc = (t_sample - ceil( t_sample - window_len/cutoff*scale )) * sinc_step
-    const long_fixedpoint_t qt_cur_ = qt_frame_size_ + qt_sample_
-        - qceil(qt_frame_size_ + qt_sample_ - qt_half_window_size_);
-    fixedpoint_t qt_sinc_cur =
-        (fixedpoint_t)((qt_cur_ * (long_fixedpoint_t)qt_sinc_step_) >> FRACT_BIT_COUNT);
+    sample_t* weights = &window_buf_[0];
+    size_t n_taps = 0;
+    size_t n_cur = 0;
+    size_t n_next = 0;
+
+    const size_t n_prev = ind_end_prev - ind_begin_prev;
+
+    // In fixed ratio mode the weights depend only on the phase, so they
+    // are looked up in the per-phase cache, and only the very first output
+    // sample of each phase pays for the window generation below.
+    sample_t* cache_slot = NULL;
+    if (fixed_ratio_) {
+        cache_slot = &poly_weights_[phase_index_ * poly_stride_];
+
+        if (poly_taps_[phase_index_] != 0) {
+            weights = cache_slot;
+            n_taps = poly_taps_[phase_index_];
+            n_next = ind_end_next;
+            roc_panic_if(n_prev + n_next > n_taps);
+            n_cur = n_taps - n_prev - n_next;
+        }
+    }
 
-    // sinc_table defined in positive half-plane, so at the begining of the window
-    // qt_sinc_cur starts decreasing and after we cross 0 it will be increasing
-    // till the end of the window.
-    fixedpoint_t qt_sinc_inc = qt_sinc_step_;
+    if (n_taps == 0) {
+        // Counter inside window.
+        // t_sinc = (t_sample - ceil( t_sample - window_len/cutoff*scale )) * sinc_step
+        const long_fixedpoint_t qt_cur_ = qt_frame_size_ + qt_sample_
+            - qceil(qt_frame_size_ + qt_sample_ - qt_half_window_size_);
+        fixedpoint_t qt_sinc_cur = (fixedpoint_t)(
+            (qt_cur_ * (long_fixedpoint_t)qt_sinc_step_) >> FRACT_BIT_COUNT);
+
+        // sinc_table defined in positive half-plane, so at the begining of the window
+        // qt_sinc_cur starts decreasing and after we cross 0 it will be increasing
+        // till the end of the window.
+        const fixedpoint_t qt_sinc_inc = qt_sinc_step_;
+
+        // Compute fractional part of time position at the begining. It wont change
+        // during the run.
+        float f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
+
+        // Run through previous frame.
+        for (size_t n = 0; n < n_prev; n++) {
+            weights[n_taps++] = sinc_(qt_sinc_cur, f_sinc_cur_fract);
+            qt_sinc_cur -= qt_sinc_inc;
+        }
 
-    // Compute fractional part of time position at the begining. It wont change during
-    // the run.
-    float f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
-    sample_t accumulator = 0;
+        // Run through current frame through the left windows side. qt_sinc_cur is
+        // decreasing.
+        size_t i = ind_begin_cur;
 
-    size_t i;
+        weights[n_taps++] = sinc_(qt_sinc_cur, f_sinc_cur_fract);
+        while (qt_sinc_cur >= qt_sinc_step_) {
+            i++;
+            qt_sinc_cur -= qt_sinc_inc;
+            weights[n_taps++] = sinc_(qt_sinc_cur, f_sinc_cur_fract);
+        }
 
-    // Run through previous frame.
-    for (i = ind_begin_prev; i < ind_end_prev; i += channels_num_) {
-        accumulator += prev_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur -= qt_sinc_inc;
-    }
+        i++;
 
-    // Run through current frame through the left windows side. qt_sinc_cur is decreasing.
-    i = ind_begin_cur;
+        roc_panic_if(i > frame_size_ch_);
 
-    accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-    while (qt_sinc_cur >= qt_sinc_step_) {
-        i += channels_num_;
-        qt_sinc_cur -= qt_sinc_inc;
-        accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-    }
+        // Crossing zero -- we just need to switch qt_sinc_cur.
+        // -1 ------------ 0 ------------- +1
+        //      ^                  ^
+        //      |                  |
+        //   -qt_sinc_cur  ->  +qt_sinc_cur     <=> qt_sinc_cur = 1 - qt_sinc_cur
+        qt_sinc_cur = qt_sinc_step_ - qt_sinc_cur; // qt_sinc_cur = -qt_sinc_cur + 1;
+        f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
 
-    i += channels_num_;
+        // Run through right side of the window, increasing qt_sinc_cur.
+        for (; i <= ind_end_cur; i++) {
+            weights[n_taps++] = sinc_(qt_sinc_cur, f_sinc_cur_fract);
+            qt_sinc_cur += qt_sinc_inc;
+        }
+        n_cur = n_taps - n_prev;
 
-    roc_panic_if(i > channelize_index(frame_size_ch_, channel_offset));
+        // Next frames run.
+        for (i = 0; i < ind_end_next; i++) {
+            weights[n_taps++] = sinc_(qt_sinc_cur, f_sinc_cur_fract);
+            qt_sinc_cur += qt_sinc_inc;
+        }
+        n_next = n_taps - n_prev - n_cur;
 
-    // Crossing zero -- we just need to switch qt_sinc_cur.
-    // -1 ------------ 0 ------------- +1
-    //      ^                  ^
-    //      |                  |
-    //   -qt_sinc_cur  ->  +qt_sinc_cur     <=> qt_sinc_cur = 1 - qt_sinc_cur
-    qt_sinc_cur = qt_sinc_step_ - qt_sinc_cur; // qt_sinc_cur = -qt_sinc_cur + 1;
-    f_sinc_cur_fract = fractional(qt_sinc_cur << window_interp_bits_);
+        roc_panic_if(n_taps > window_buf_.size());
 
-    // Run through right side of the window, increasing qt_sinc_cur.
-    for (; i <= ind_end_cur; i += channels_num_) {
-        accumulator += curr_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += qt_sinc_inc;
+        if (cache_slot && n_taps <= poly_stride_) {
+            memcpy(cache_slot, weights, n_taps * sizeof(sample_t));
+            poly_taps_[phase_index_] = n_taps;
+        }
     }
 
-    // Next frames run.
-    for (i = ind_begin_next; i < ind_end_next; i += channels_num_) {
-        accumulator += next_frame_[i] * sinc_(qt_sinc_cur, f_sinc_cur_fract);
-        qt_sinc_cur += qt_sinc_inc;
+    sample_t* acc = &accum_buf_[0];
+    memset(acc, 0, channels_num_ * sizeof(sample_t));
+
+    if (planar_) {
+        // Convolve each channel plane separately; the kernels take their
+        // unit-stride (n_ch == 1) path.
+        for (size_t ch = 0; ch < channels_num_; ch++) {
+            const size_t plane = ch * frame_size_ch_;
+
+            dot_fn_(prev_frame_ + plane + ind_begin_prev, weights, n_prev, 1, acc + ch);
+            dot_fn_(curr_frame_ + plane + ind_begin_cur, weights + n_prev, n_cur, 1,
+                    acc + ch);
+            dot_fn_(next_frame_ + plane, weights + n_prev + n_cur, n_next, 1, acc + ch);
+        }
+    } else {
+        dot_fn_(prev_frame_ + channelize_index(ind_begin_prev, 0), weights, n_prev,
+                channels_num_, acc);
+        dot_fn_(curr_frame_ + channelize_index(ind_begin_cur, 0), weights + n_prev, n_cur,
+                channels_num_, acc);
+        dot_fn_(next_frame_, weights + n_prev + n_cur, n_next, channels_num_, acc);
     }
 
-    return accumulator;
+    for (size_t ch = 0; ch < channels_num_; ch++) {
+        out_data[ch] = acc[ch];
+    }
 }
 
 } // namespace audio
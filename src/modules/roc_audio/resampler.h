@@ -38,9 +38,51 @@ struct ResamplerConfig {
     //!  Lower values give lower quality but higher speed and also rarer cache misses.
     size_t window_size;
 
+    //! Deinterleave input frames into per-channel planes.
+    //! @remarks
+    //!  Trades one deinterleave pass per input frame for unit-stride
+    //!  convolution. Pays off for multi-channel streams whose channel
+    //!  count has no specialized dot-product kernel. Ignored for mono,
+    //!  which is already unit-stride.
+    bool planar;
+
+    //! Store the shared sinc table in 16-bit fixed point.
+    //! @remarks
+    //!  Halves the table footprint, so on small-cache CPUs the table
+    //!  competes less with sample data for cache in the convolution
+    //!  loop. Coefficients are dequantized on lookup. Quantization
+    //!  limits the filter SNR to roughly 90 dB, below the stopband
+    //!  attenuation of the larger windows. Ignored when @p cubic is set.
+    bool int16_table;
+
+    //! Use cheap cubic interpolation instead of the sinc filter.
+    //! @remarks
+    //!  Replaces the windowed-sinc convolution with Catmull-Rom
+    //!  interpolation over the four samples around each output position.
+    //!  Roughly an order of magnitude cheaper, but performs no
+    //!  band-limiting, so quality degrades as the scaling factor moves
+    //!  away from one. Intended for CPU-constrained devices running many
+    //!  sessions. When set, @p window_interp, @p window_size and @p planar
+    //!  are ignored.
+    bool cubic;
+
+    //! Near-unity bypass epsilon.
+    //! @remarks
+    //!  When non-zero and the scaling factor stays within epsilon of one,
+    //!  ResamplerReader and ResamplerWriter pass frames through untouched
+    //!  and correct the residual drift by occasional single-sample
+    //!  insertions and drops, instead of running the full convolution.
+    //!  Useful when sender and receiver clocks are externally synchronized.
+    //!  Zero disables bypassing.
+    float bypass_epsilon;
+
     ResamplerConfig()
         : window_interp(128)
-        , window_size(32) {
+        , window_size(32)
+        , planar(false)
+        , int16_table(false)
+        , cubic(false)
+        , bypass_epsilon(0) {
     }
 };
 
@@ -73,6 +115,13 @@ public:
                        core::Slice<sample_t>& cur,
                        core::Slice<sample_t>& next);
 
+    //! Forget previously staged input frames.
+    //! @remarks
+    //!  Should be called when the caller refills its window buffers from
+    //!  scratch instead of sliding them, so that the next renew_buffers()
+    //!  doesn't reuse stale per-channel planes.
+    void reset_window();
+
 private:
     typedef uint32_t fixedpoint_t;
     typedef uint64_t long_fixedpoint_t;
@@ -86,15 +135,26 @@ private:
         return i * channels_num_ + ch_offset;
     }
 
-    //! Computes single sample of the particular audio channel.
+    //! Computes current output sample for all audio channels at once.
     //!
-    //! @param channel_offset a serial number of the channel
-    //!  (e.g. left -- 0, right -- 1, etc.).
-    sample_t resample_(size_t channel_offset);
+    //! Fills the sinc window weights (identical for all channels) into
+    //! window_buf_ and convolves the input frames with them using the
+    //! platform-selected dot-product kernel. In planar mode each channel
+    //! plane is convolved separately on unit-stride data.
+    void resample_(sample_t* out_data);
+
+    //! Computes current output sample with cubic interpolation, without
+    //! touching the sinc machinery.
+    void resample_cubic_(sample_t* out_data);
+
+    sample_t tap_(ssize_t index, size_t ch_offset) const;
+
+    void deinterleave_(sample_t* planes, const sample_t* frame) const;
+
+    void update_fixed_ratio_(float new_scaling);
 
     bool check_config_() const;
 
-    bool fill_sinc_();
     sample_t sinc_(fixedpoint_t x, float fract_x);
 
     sample_t* prev_frame_;
@@ -108,14 +168,69 @@ private:
     const size_t frame_size_;
     const size_t frame_size_ch_;
 
+    const bool planar_;
+    const bool cubic_;
+
     const size_t window_size_;
     const fixedpoint_t qt_half_sinc_window_size_;
 
     const size_t window_interp_;
     const size_t window_interp_bits_;
 
-    core::Array<sample_t> sinc_table_;
-    const sample_t* sinc_table_ptr_;
+    //! Shared immutable sinc table, obtained from SincTableCache.
+    const float* sinc_table_ptr_;
+
+    //! Quantized variant of the shared sinc table (int16_table mode);
+    //! exactly one of the two table pointers is set.
+    const int16_t* sinc_table_q15_ptr_;
+
+    //! Per-output-sample sinc window weights, shared between channels.
+    core::Array<sample_t> window_buf_;
+
+    //! Per-channel convolution accumulators.
+    core::Array<sample_t> accum_buf_;
+
+    //! Per-channel planes of the three input frames (planar mode only),
+    //! organized as a ring of three frame-sized segments.
+    core::Array<sample_t> planar_buf_;
+
+    //! Ring segment (0-2) holding the planes of the previous frame.
+    size_t planar_head_;
+
+    //! Data pointers of the frames staged at the last renew, for detecting
+    //! the steady-state rotation where only the next frame is new.
+    const sample_t* last_cur_data_;
+    const sample_t* last_next_data_;
+
+    // Fixed-ratio polyphase fast path. When the scaling factor is (within
+    // float precision) a rational num/den with a small denominator, the
+    // fractional phase of the output grid cycles through den values, so
+    // the sinc window weights for each phase are computed once and then
+    // reused as pure table lookups, skipping the per-sample window
+    // generation entirely.
+    bool fixed_ratio_;
+    size_t ratio_num_;
+    size_t ratio_den_;
+    size_t phase_index_;
+    size_t poly_stride_;
+
+    //! Per-phase fractional time positions, in fixed point.
+    core::Array<fixedpoint_t> phase_table_;
+
+    //! Per-phase cached window weights, poly_stride_ samples per phase.
+    core::Array<sample_t> poly_weights_;
+
+    //! Per-phase cached window lengths; zero means not cached yet.
+    core::Array<size_t> poly_taps_;
+
+    //! Dot-product kernel selected for this CPU at runtime. Convolves
+    //! @p n_taps interleaved frames of @p n_ch channels with @p weights,
+    //! accumulating into @p acc (one accumulator per channel).
+    void (*const dot_fn_)(const sample_t* frame,
+                          const sample_t* weights,
+                          size_t n_taps,
+                          size_t n_ch,
+                          sample_t* acc);
 
     // half window len in Q8.24 in terms of input signal
     fixedpoint_t qt_half_window_size_;
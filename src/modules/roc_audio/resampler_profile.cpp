@@ -15,6 +15,10 @@ ResamplerConfig resampler_profile(ResamplerProfile profile) {
     ResamplerConfig config;
 
     switch (profile) {
+    case ResamplerProfile_UltraLow:
+        config.cubic = true;
+        break;
+
     case ResamplerProfile_Low:
         config.window_interp = 64;
         config.window_size = 16;
@@ -19,6 +19,12 @@ namespace audio {
 
 //! Resampler parameters presets.
 enum ResamplerProfile {
+    //! Lowest quality, ultra fast speed.
+    //! @remarks
+    //!  Uses cubic interpolation instead of the sinc filter. For
+    //!  CPU-constrained devices running many sessions.
+    ResamplerProfile_UltraLow,
+
     //! Low quality, fast speed.
     ResamplerProfile_Low,
 
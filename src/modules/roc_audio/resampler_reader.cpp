@@ -25,6 +25,14 @@ ResamplerReader::ResamplerReader(IReader& reader,
     , reader_(reader)
     , frame_size_(frame_size)
     , frames_empty_(true)
+    , channels_num_(packet::num_channels(channels))
+    , bypass_epsilon_(config.bypass_epsilon)
+    , scaling_(1.0f)
+    , bypass_(false)
+    , debt_(0)
+    , has_last_group_(false)
+    , last_group_(allocator)
+    , scratch_group_(allocator)
     , valid_(false) {
     if (!resampler_.valid()) {
         return;
@@ -32,6 +40,12 @@ ResamplerReader::ResamplerReader(IReader& reader,
     if (!init_frames_(buffer_pool)) {
         return;
     }
+    if (bypass_epsilon_ > 0) {
+        if (!last_group_.resize(channels_num_) || !scratch_group_.resize(channels_num_)) {
+            roc_log(LogError, "resampler reader: can't allocate bypass buffers");
+            return;
+        }
+    }
     valid_ = true;
 }
 
@@ -42,12 +56,27 @@ bool ResamplerReader::valid() const {
 bool ResamplerReader::set_scaling(float scaling) {
     roc_panic_if_not(valid());
 
-    return resampler_.set_scaling(scaling);
+    if (!resampler_.set_scaling(scaling)) {
+        return false;
+    }
+
+    scaling_ = scaling;
+
+    if (bypass_epsilon_ > 0) {
+        update_bypass_();
+    }
+
+    return true;
 }
 
 void ResamplerReader::read(Frame& frame) {
     roc_panic_if_not(valid());
 
+    if (bypass_) {
+        read_bypass_(frame);
+        return;
+    }
+
     if (frames_empty_) {
         renew_frames_();
     }
@@ -57,6 +86,61 @@ void ResamplerReader::read(Frame& frame) {
     }
 }
 
+// Enter bypass mode when the drift is within epsilon and leave it when the
+// drift exceeds twice the epsilon; the dead band in between prevents
+// flapping when the estimate hovers around the threshold.
+void ResamplerReader::update_bypass_() {
+    const float drift = scaling_ > 1.0f ? scaling_ - 1.0f : 1.0f - scaling_;
+
+    if (!bypass_ && drift <= bypass_epsilon_) {
+        roc_log(LogDebug,
+                "resampler reader: drift within epsilon, entering bypass mode:"
+                " scaling=%.9f",
+                (double)scaling_);
+        bypass_ = true;
+        debt_ = 0;
+        has_last_group_ = false;
+    } else if (bypass_ && drift > bypass_epsilon_ * 2) {
+        roc_log(LogDebug,
+                "resampler reader: drift exceeds epsilon, leaving bypass mode:"
+                " scaling=%.9f",
+                (double)scaling_);
+        bypass_ = false;
+        // refill the resampler window from the live stream position
+        frames_empty_ = true;
+    }
+}
+
+void ResamplerReader::read_bypass_(Frame& frame) {
+    size_t off = 0;
+
+    // the stream is owed a sample: repeat the last sample group once
+    // instead of consuming input
+    if (debt_ <= -1.0f && has_last_group_ && frame.size() > channels_num_) {
+        memcpy(frame.data(), &last_group_[0], channels_num_ * sizeof(sample_t));
+        off = channels_num_;
+        debt_ += 1.0f;
+    }
+
+    Frame sub_frame(frame.data() + off, frame.size() - off);
+    reader_.read(sub_frame);
+
+    if (frame.size() >= channels_num_) {
+        memcpy(&last_group_[0], frame.data() + frame.size() - channels_num_,
+               channels_num_ * sizeof(sample_t));
+        has_last_group_ = true;
+    }
+
+    // running ahead of the stream: consume and discard one sample group
+    if (debt_ >= 1.0f) {
+        Frame drop_frame(&scratch_group_[0], channels_num_);
+        reader_.read(drop_frame);
+        debt_ -= 1.0f;
+    }
+
+    debt_ += (float)(frame.size() / channels_num_) * (scaling_ - 1.0f);
+}
+
 bool ResamplerReader::init_frames_(core::BufferPool<sample_t>& buffer_pool) {
     for (size_t n = 0; n < ROC_ARRAY_SIZE(frames_); n++) {
         frames_[n] = new (buffer_pool) core::Buffer<sample_t>(buffer_pool);
@@ -74,6 +158,9 @@ bool ResamplerReader::init_frames_(core::BufferPool<sample_t>& buffer_pool) {
 
 void ResamplerReader::renew_frames_() {
     if (frames_empty_) {
+        // the whole window is refilled in place, without rotation
+        resampler_.reset_window();
+
         for (size_t n = 0; n < ROC_ARRAY_SIZE(frames_); ++n) {
             Frame frame(frames_[n].data(), frames_[n].size());
             reader_.read(frame);
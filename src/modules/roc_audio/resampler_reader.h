@@ -65,6 +65,9 @@ private:
     bool init_frames_(core::BufferPool<sample_t>&);
     void renew_frames_();
 
+    void update_bypass_();
+    void read_bypass_(Frame& frame);
+
     Resampler resampler_;
     IReader& reader_;
 
@@ -72,6 +75,19 @@ private:
     const size_t frame_size_;
     bool frames_empty_;
 
+    // Near-unity bypass mode: when the scaling stays within
+    // bypass_epsilon_ of one, frames are passed through untouched and the
+    // residual drift is corrected by duplicating or dropping single
+    // sample groups at frame boundaries.
+    const size_t channels_num_;
+    const float bypass_epsilon_;
+    float scaling_;
+    bool bypass_;
+    float debt_;
+    bool has_last_group_;
+    core::Array<sample_t> last_group_;
+    core::Array<sample_t> scratch_group_;
+
     bool valid_;
 };
 
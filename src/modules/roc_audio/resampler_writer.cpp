@@ -25,6 +25,13 @@ ResamplerWriter::ResamplerWriter(IWriter& writer,
     , writer_(writer)
     , frame_pos_(0)
     , frame_size_(frame_size)
+    , channels_num_(packet::num_channels(channels))
+    , bypass_epsilon_(config.bypass_epsilon)
+    , scaling_(1.0f)
+    , bypass_(false)
+    , debt_(0)
+    , has_last_group_(false)
+    , last_group_(allocator)
     , valid_(false) {
     if (!resampler_.valid()) {
         return;
@@ -32,6 +39,12 @@ ResamplerWriter::ResamplerWriter(IWriter& writer,
     if (!init_(buffer_pool)) {
         return;
     }
+    if (bypass_epsilon_ > 0) {
+        if (!last_group_.resize(channels_num_)) {
+            roc_log(LogError, "resampler writer: can't allocate bypass buffer");
+            return;
+        }
+    }
     valid_ = true;
 }
 
@@ -42,37 +55,109 @@ bool ResamplerWriter::valid() const {
 bool ResamplerWriter::set_scaling(float scaling) {
     roc_panic_if_not(valid());
 
-    return resampler_.set_scaling(scaling);
+    if (!resampler_.set_scaling(scaling)) {
+        return false;
+    }
+
+    scaling_ = scaling;
+
+    if (bypass_epsilon_ > 0) {
+        update_bypass_();
+    }
+
+    return true;
+}
+
+// Enter bypass mode when the drift is within epsilon and leave it when the
+// drift exceeds twice the epsilon; the dead band in between prevents
+// flapping when the estimate hovers around the threshold.
+void ResamplerWriter::update_bypass_() {
+    const float drift = scaling_ > 1.0f ? scaling_ - 1.0f : 1.0f - scaling_;
+
+    if (!bypass_ && drift <= bypass_epsilon_) {
+        roc_log(LogDebug,
+                "resampler writer: drift within epsilon, entering bypass mode:"
+                " scaling=%.9f",
+                (double)scaling_);
+        bypass_ = true;
+        debt_ = 0;
+        has_last_group_ = false;
+    } else if (bypass_ && drift > bypass_epsilon_ * 2) {
+        roc_log(LogDebug,
+                "resampler writer: drift exceeds epsilon, leaving bypass mode:"
+                " scaling=%.9f",
+                (double)scaling_);
+        bypass_ = false;
+        // refill the resampler window from the live stream position
+        frame_pos_ = 0;
+        resampler_.reset_window();
+    }
+}
+
+void ResamplerWriter::write_bypass_(Frame& frame) {
+    if (frame.size() < channels_num_) {
+        writer_.write(frame);
+        return;
+    }
+
+    size_t off = 0;
+
+    if (debt_ >= 1.0f) {
+        // an extra output sample is owed: emit the last sample group once more
+        if (has_last_group_) {
+            Frame dup_frame(&last_group_[0], channels_num_);
+            writer_.write(dup_frame);
+            debt_ -= 1.0f;
+        }
+    } else if (debt_ <= -1.0f) {
+        // running ahead of the stream: swallow the first sample group
+        off = channels_num_;
+        debt_ += 1.0f;
+    }
+
+    Frame sub_frame(frame.data() + off, frame.size() - off);
+    writer_.write(sub_frame);
+
+    memcpy(&last_group_[0], frame.data() + frame.size() - channels_num_,
+           channels_num_ * sizeof(sample_t));
+    has_last_group_ = true;
+
+    debt_ += (float)(frame.size() / channels_num_) * (1.0f - scaling_);
 }
 
 void ResamplerWriter::write(Frame& input) {
     roc_panic_if_not(valid());
 
+    if (bypass_) {
+        write_bypass_(input);
+        return;
+    }
+
     const sample_t* input_data = input.data();
     const size_t input_size = input.size();
     size_t input_pos = 0;
 
-    sample_t* frame0_data = frames_[0].data();
-    for (; frame_pos_ < frame_size_ && input_pos < input_size;
-         ++frame_pos_, ++input_pos) {
-        frame0_data[frame_pos_] = input_data[input_pos];
-    }
-
-    sample_t* frame1_data = frames_[1].data();
-    for (; frame_pos_ < frame_size_ * 2 && input_pos < input_size;
-         ++frame_pos_, ++input_pos) {
-        frame1_data[frame_pos_ - frame_size_] = input_data[input_pos];
-    }
-
+    // Stage input into the window buffers with bulk copies. The input can't
+    // be borrowed in place: window samples must stay alive across several
+    // write() calls while the window slides over them, but the caller may
+    // reuse the input buffer as soon as write() returns.
     while (input_pos < input_size) {
-        sample_t* frame2_data = frames_[2].data();
-        for (; frame_pos_ < frame_size_ * 3 && input_pos < input_size;
-             ++frame_pos_, ++input_pos) {
-            frame2_data[frame_pos_ - frame_size_ * 2] = input_data[input_pos];
+        const size_t frame_index = frame_pos_ / frame_size_;
+        const size_t frame_off = frame_pos_ - frame_index * frame_size_;
+
+        size_t n_copy = frame_size_ - frame_off;
+        if (n_copy > input_size - input_pos) {
+            n_copy = input_size - input_pos;
         }
 
+        memcpy(frames_[frame_index].data() + frame_off, input_data + input_pos,
+               n_copy * sizeof(sample_t));
+
+        frame_pos_ += n_copy;
+        input_pos += n_copy;
+
         // All three slices are full, resampling frame_size_ samples.
-        if (frame_pos_ >= frame_size_ * 3) {
+        if (frame_pos_ == frame_size_ * 3) {
             resampler_.renew_buffers(frames_[0], frames_[1], frames_[2]);
 
             Frame out_frame(output_.data(), output_.size());
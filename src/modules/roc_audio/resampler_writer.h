@@ -64,6 +64,9 @@ public:
 private:
     bool init_(core::BufferPool<sample_t>&);
 
+    void update_bypass_();
+    void write_bypass_(Frame& frame);
+
     Resampler resampler_;
     IWriter& writer_;
 
@@ -73,6 +76,18 @@ private:
     size_t frame_pos_;
     const size_t frame_size_;
 
+    // Near-unity bypass mode: when the scaling stays within
+    // bypass_epsilon_ of one, frames are passed through untouched and the
+    // residual drift is corrected by duplicating or dropping single
+    // sample groups at frame boundaries.
+    const size_t channels_num_;
+    const float bypass_epsilon_;
+    float scaling_;
+    bool bypass_;
+    float debt_;
+    bool has_last_group_;
+    core::Array<sample_t> last_group_;
+
     bool valid_;
 };
 
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/sinc_table_cache.h"
+#include "roc_audio/sinc_table_data.h"
+#include "roc_core/log.h"
+#include "roc_core/scoped_lock.h"
+
+namespace roc {
+namespace audio {
+
+SincTableCache::SincTableCache() {
+}
+
+const float* SincTableCache::get(size_t window_size, size_t window_interp) {
+    // the default profiles have their tables precomputed at build time
+    // and placed in read-only data; only custom configs pay for runtime
+    // generation
+    if (const float* table = sinc_table_lookup(window_size, window_interp)) {
+        return table;
+    }
+
+    core::Mutex::Lock lock(mutex_);
+
+    Entry* entry = find_or_create_entry_(window_size, window_interp);
+    if (!entry) {
+        return NULL;
+    }
+
+    if (entry->table.size() == 0) {
+        if (!entry->table.resize(window_size * window_interp + 2)) {
+            roc_log(LogError, "sinc table cache: can't allocate sinc table");
+            return NULL;
+        }
+
+        fill_(*entry);
+
+        roc_log(LogDebug,
+                "sinc table cache: filled new table:"
+                " window_size=%lu window_interp=%lu n_tables=%lu",
+                (unsigned long)window_size, (unsigned long)window_interp,
+                (unsigned long)entries_.size());
+    }
+
+    return &entry->table[0];
+}
+
+const int16_t* SincTableCache::get_int16(size_t window_size, size_t window_interp) {
+    core::Mutex::Lock lock(mutex_);
+
+    Entry* entry = find_or_create_entry_(window_size, window_interp);
+    if (!entry) {
+        return NULL;
+    }
+
+    if (entry->table_int16.size() == 0) {
+        // nothing is precomputed in Q15; quantize from the float table,
+        // either the build-time one or a runtime-filled entry
+        const float* src = sinc_table_lookup(window_size, window_interp);
+
+        if (!src) {
+            if (entry->table.size() == 0) {
+                if (!entry->table.resize(window_size * window_interp + 2)) {
+                    roc_log(LogError, "sinc table cache: can't allocate sinc table");
+                    return NULL;
+                }
+                fill_(*entry);
+            }
+            src = &entry->table[0];
+        }
+
+        if (!entry->table_int16.resize(window_size * window_interp + 2)) {
+            roc_log(LogError, "sinc table cache: can't allocate quantized sinc table");
+            return NULL;
+        }
+
+        for (size_t i = 0; i < entry->table_int16.size(); ++i) {
+            // the coefficients are within [-1; 1], so Q15 never overflows
+            const float v = src[i] * 32767.0f;
+            entry->table_int16[i] = (int16_t)(v >= 0 ? v + 0.5f : v - 0.5f);
+        }
+
+        roc_log(LogDebug,
+                "sinc table cache: quantized table:"
+                " window_size=%lu window_interp=%lu n_tables=%lu",
+                (unsigned long)window_size, (unsigned long)window_interp,
+                (unsigned long)entries_.size());
+    }
+
+    return &entry->table_int16[0];
+}
+
+SincTableCache::Entry* SincTableCache::find_or_create_entry_(size_t window_size,
+                                                             size_t window_interp) {
+    for (Entry* entry = entries_.front(); entry; entry = entries_.nextof(*entry)) {
+        if (entry->window_size == window_size && entry->window_interp == window_interp) {
+            return entry;
+        }
+    }
+
+    void* memory = allocator_.allocate(sizeof(Entry));
+    if (!memory) {
+        roc_log(LogError, "sinc table cache: can't allocate table entry");
+        return NULL;
+    }
+
+    Entry* entry = new (memory) Entry(allocator_);
+    entry->window_size = window_size;
+    entry->window_interp = window_interp;
+
+    entries_.push_back(*entry);
+
+    return entry;
+}
+
+void SincTableCache::fill_(Entry& entry) {
+    core::Array<float>& sinc_table = entry.table;
+
+    const double sinc_step = 1.0 / (double)entry.window_interp;
+    double sinc_t = sinc_step;
+
+    sinc_table[0] = 1.0f;
+    for (size_t i = 1; i < sinc_table.size(); ++i) {
+        const double window = 0.54
+            - 0.46
+                * std::cos(2 * M_PI
+                           * ((double)(i - 1) / 2.0 / (double)sinc_table.size() + 0.5));
+        sinc_table[i] = (float)(std::sin(M_PI * sinc_t) / M_PI / sinc_t * window);
+        sinc_t += sinc_step;
+    }
+    sinc_table[sinc_table.size() - 2] = 0;
+    sinc_table[sinc_table.size() - 1] = 0;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_table_cache.h
+//! @brief Sinc table cache.
+
+#ifndef ROC_AUDIO_SINC_TABLE_CACHE_H_
+#define ROC_AUDIO_SINC_TABLE_CACHE_H_
+
+#include "roc_core/array.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Sinc table cache.
+//!
+//! The sinc table contents depend only on the window size and window
+//! interpolation factor, so all resamplers created with the same config
+//! can share one immutable table instead of each computing its own.
+//! Tables are computed once on first request and retained for the
+//! lifetime of the process.
+class SincTableCache : public core::NonCopyable<> {
+public:
+    //! Get singleton instance.
+    static SincTableCache& instance() {
+        return core::Singleton<SincTableCache>::instance();
+    }
+
+    //! Get shared sinc table for given parameters.
+    //!
+    //! The table is float regardless of the sample_t type, since the sinc
+    //! filter is float-only and is not available in fixed-point builds.
+    //!
+    //! @returns a pointer to an immutable table of (window_size * window_interp + 2)
+    //! entries, valid until the end of the process, or NULL if the table can't
+    //! be allocated.
+    const float* get(size_t window_size, size_t window_interp);
+
+    //! Get shared quantized sinc table for given parameters.
+    //!
+    //! The coefficients are quantized to Q15 fixed point, halving the table
+    //! footprint at the cost of quantizing the filter response (see
+    //! ResamplerConfig::int16_table).
+    //!
+    //! @returns a pointer to an immutable table of (window_size * window_interp + 2)
+    //! entries, valid until the end of the process, or NULL if the table can't
+    //! be allocated.
+    const int16_t* get_int16(size_t window_size, size_t window_interp);
+
+private:
+    friend class core::Singleton<SincTableCache>;
+
+    struct Entry : core::ListNode {
+        explicit Entry(core::IAllocator& allocator)
+            : window_size(0)
+            , window_interp(0)
+            , table(allocator)
+            , table_int16(allocator) {
+        }
+
+        size_t window_size;
+        size_t window_interp;
+
+        // either array may be empty if only the other representation
+        // was requested so far
+        core::Array<float> table;
+        core::Array<int16_t> table_int16;
+    };
+
+    SincTableCache();
+
+    Entry* find_or_create_entry_(size_t window_size, size_t window_interp);
+
+    static void fill_(Entry& entry);
+
+    core::Mutex mutex_;
+    core::HeapAllocator allocator_;
+    core::List<Entry, core::NoOwnership> entries_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLE_CACHE_H_
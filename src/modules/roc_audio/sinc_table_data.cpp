@@ -0,0 +1,4782 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Generated by scripts/generate_sinc_tables.py; do not edit.
+//
+// Precomputed sinc tables for the default resampler profiles. Keeping
+// them in read-only data avoids recomputation at session start and lets
+// the OS share one copy across processes.
+
+#include "roc_audio/sinc_table_data.h"
+
+namespace roc {
+namespace audio {
+
+static const float sinc_table_16_64[1026] = {
+    1.0f, 0.999598444f, 0.998392224f, 0.996380985f, 0.993567586f, 0.989956141f, 0.985552013f, 0.980361581f,
+    0.974392414f, 0.967653215f, 0.960153818f, 0.951905191f, 0.942919254f, 0.933209121f, 0.922788918f, 0.911673665f,
+    0.899879575f, 0.887423575f, 0.874323785f, 0.860598922f, 0.846268892f, 0.831354141f, 0.815876007f, 0.799856722f,
+    0.783319116f, 0.766286552f, 0.74878335f, 0.730834186f, 0.712464333f, 0.693699658f, 0.674566448f, 0.655091345f,
+    0.635301471f, 0.615224242f, 0.594887257f, 0.574318588f, 0.55354619f, 0.532598436f, 0.511503637f, 0.490290225f,
+    0.468986511f, 0.447620928f, 0.426221699f, 0.404816926f, 0.383434534f, 0.36210224f, 0.340847433f, 0.319697231f,
+    0.298678339f, 0.27781707f, 0.257139325f, 0.23667042f, 0.216435224f, 0.196458027f, 0.176762462f, 0.157371551f,
+    0.138307661f, 0.119592384f, 0.101246618f, 0.0832904726f, 0.0657432526f, 0.0486234203f, 0.0319485962f, 0.0157355145f,
+    3.86491141e-17f, -0.0152430385f, -0.0299796406f, -0.0441968031f, -0.0578824989f, -0.0710256845f, -0.0836163238f, -0.0956453905f,
+    -0.10710486f, -0.117987752f, -0.12828809f, -0.138000935f, -0.147122383f, -0.155649543f, -0.163580552f, -0.170914561f,
+    -0.177651733f, -0.183793232f, -0.189341187f, -0.194298759f, -0.19867f, -0.202459946f, -0.205674544f, -0.208320677f,
+    -0.21040608f, -0.21193935f, -0.212929964f, -0.21338816f, -0.213325009f, -0.212752298f, -0.211682573f, -0.210129097f,
+    -0.208105743f, -0.205627054f, -0.2027082f, -0.199364871f, -0.19561331f, -0.191470265f, -0.186952949f, -0.182078958f,
+    -0.176866323f, -0.171333402f, -0.165498853f, -0.159381613f, -0.153000876f, -0.146375984f, -0.139526457f, -0.132471934f,
+    -0.125232145f, -0.117826812f, -0.110275708f, -0.102598533f, -0.0948149338f, -0.0869444236f, -0.0790064037f, -0.0710200444f,
+    -0.0630043298f, -0.0549779832f, -0.0469594337f, -0.038966801f, -0.031017838f, -0.0231299326f, -0.0153200496f, -0.00760471914f,
+    -3.76429019e-17f, 0.0074785403f, 0.014815853f, 0.021997435f, 0.0290093403f, 0.0358382203f, 0.0424713194f, 0.0488965102f,
+    0.0551023073f, 0.0610778816f, 0.0668130666f, 0.0722983852f, 0.0775250345f, 0.0824849457f, 0.0871707276f, 0.091575712f,
+    0.0956939682f, 0.0995202586f, 0.103050098f, 0.106279701f, 0.109206036f, 0.111826748f, 0.114140242f, 0.116145611f,
+    0.117842644f, 0.119231842f, 0.120314382f, 0.121092111f, 0.12156754f, 0.121743821f, 0.121624745f, 0.121214718f,
+    0.120518737f, 0.119542383f, 0.118291795f, 0.116773658f, 0.114995167f, 0.112964012f, 0.110688359f, 0.108176827f,
+    0.105438463f, 0.102482691f, 0.0993193388f, 0.0959585607f, 0.0924108401f, 0.0886869505f, 0.0847979337f, 0.0807550699f,
+    0.0765698478f, 0.0722539276f, 0.0678191558f, 0.0632774606f, 0.0586409084f, 0.0539216027f, 0.0491317138f, 0.0442834012f,
+    0.0393888317f, 0.0344601199f, 0.0295093097f, 0.0245483574f, 0.0195890963f, 0.0146432118f, 0.00972222351f, 0.0048374515f,
+    3.60015108e-17f, -0.00477926759f, -0.00948975142f, -0.0141211348f, -0.0186634045f, -0.023106873f, -0.0274421927f, -0.0316603743f,
+    -0.0357528105f, -0.0397112742f, -0.0435279608f, -0.0471954644f, -0.0507068299f, -0.0540555306f, -0.057235498f, -0.060241133f,
+    -0.0630672947f, -0.0657093227f, -0.0681630298f, -0.070424743f, -0.0724912509f, -0.0743598342f, -0.0760282874f, -0.0774948746f,
+    -0.0787583739f, -0.0798180252f, -0.0806735829f, -0.0813252628f, -0.0817737579f, -0.0820202306f, -0.0820663199f, -0.0819140896f,
+    -0.081566073f, -0.0810252205f, -0.0802949145f, -0.0793789253f, -0.0782814473f, -0.0770070329f, -0.0755606219f, -0.0739474967f,
+    -0.0721732751f, -0.0702438951f, -0.0681656078f, -0.0659449324f, -0.0635886714f, -0.061103873f, -0.0584978051f, -0.0557779558f,
+    -0.0529520065f, -0.0500277989f, -0.0470133349f, -0.043916747f, -0.0407462716f, -0.037510246f, -0.0342170671f, -0.0308751874f,
+    -0.0274930876f, -0.0240792576f, -0.0206421781f, -0.0171902962f, -0.0137320096f, -0.0102756508f, -0.00682946015f, -0.00340157282f,
+    -3.37877803e-17f, 0.00336738932f, 0.00669288589f, 0.00996895507f, 0.013188256f, 0.0163436513f, 0.0194282308f, 0.022435315f,
+    0.0253584757f, 0.0281915497f, 0.0309286416f, 0.0335641503f, 0.0360927619f, 0.0385094732f, 0.0408095941f, 0.0429887548f,
+    0.0450429209f, 0.0469683856f, 0.0487617962f, 0.0504201315f, 0.0519407317f, 0.0533212908f, 0.0545598418f, 0.0556547977f,
+    0.0566049144f, 0.0574093051f, 0.0580674447f, 0.0585791506f, 0.0589446016f, 0.0591643229f, 0.0592391714f, 0.0591703504f,
+    0.0589593947f, 0.0586081557f, 0.0581188127f, 0.0574938431f, 0.0567360297f, 0.0558484495f, 0.0548344515f, 0.0536976643f,
+    0.0524419695f, 0.0510714985f, 0.0495906211f, 0.0480039231f, 0.0463162065f, 0.0445324704f, 0.0426578894f, 0.0406978168f,
+    0.0386577547f, 0.0365433507f, 0.0343603715f, 0.0321146958f, 0.0298123043f, 0.0274592545f, 0.0250616651f, 0.0226257145f,
+    0.0201576073f, 0.0176635757f, 0.0151498513f, 0.0126226591f, 0.0100881979f, 0.0075526298f, 0.00502206106f, 0.00250253151f,
+    3.10864467e-17f, -0.00247966987f, -0.00493072253f, -0.0073475223f, -0.00972456764f, -0.0120565007f, -0.0143381208f, -0.0165643953f,
+    -0.018730469f, -0.0208316743f, -0.0228635427f, -0.0248218086f, -0.0267024264f, -0.0285015702f, -0.0302156415f, -0.0318412818f,
+    -0.033375375f, -0.0348150507f, -0.03615769f, -0.0374009348f, -0.0385426804f, -0.0395810865f, -0.0405145846f, -0.0413418598f,
+    -0.0420618691f, -0.0426738448f, -0.0431772731f, -0.0435719118f, -0.0438577831f, -0.0440351628f, -0.0441045985f, -0.0440668762f,
+    -0.0439230502f, -0.0436744019f, -0.0433224663f, -0.0428690128f, -0.0423160344f, -0.041665744f, -0.0409205742f, -0.0400831662f,
+    -0.0391563512f, -0.0381431617f, -0.0370467976f, -0.0358706452f, -0.0346182473f, -0.0332932919f, -0.0318996198f, -0.0304411966f,
+    -0.0289221164f, -0.0273465738f, -0.0257188696f, -0.0240433905f, -0.0223245993f, -0.0205670223f, -0.0187752452f, -0.0169538911f,
+    -0.0151076159f, -0.0132410917f, -0.0113590043f, -0.0094660297f, -0.0075668348f, -0.00566605711f, -0.00376829854f, -0.00187811407f,
+    -2.8000924e-17f, 0.00186161546f, 0.00370238279f, 0.00551804015f, 0.00730442349f, 0.00905747619f, 0.0107732574f, 0.0124479504f,
+    0.0140778692f, 0.0156594701f, 0.0171893574f, 0.0186642874f, 0.0200811792f, 0.021437116f, 0.0227293577f, 0.0239553396f,
+    0.0251126774f, 0.026199175f, 0.0272128303f, 0.0281518269f, 0.0290145501f, 0.0297995824f, 0.0305057056f, 0.0311319008f,
+    0.0316773541f, 0.0321414545f, 0.0325237885f, 0.0328241475f, 0.0330425203f, 0.0331790969f, 0.033234261f, 0.03320859f,
+    0.0331028514f, 0.0329180025f, 0.0326551795f, 0.0323157012f, 0.0319010541f, 0.0314129032f, 0.0308530647f, 0.0302235242f,
+    0.0295264125f, 0.028764002f, 0.0279387124f, 0.0270530879f, 0.026109796f, 0.025111625f, 0.0240614675f, 0.0229623206f,
+    0.0218172725f, 0.0206294917f, 0.0194022283f, 0.018138798f, 0.016842572f, 0.015516975f, 0.0141654732f, 0.0127915628f,
+    0.0113987653f, 0.0099906167f, 0.00857066177f, 0.00714243855f, 0.0057094777f, 0.00427528936f, 0.00284335646f, 0.00141712581f,
+    2.46493205e-17f, -0.0014046696f, -0.00279359124f, -0.00416353997f, -0.00551136537f, -0.00683399802f, -0.00812845584f, -0.00939185172f,
+    -0.0106213996f, -0.0118144173f, -0.012968339f, -0.0140807116f, -0.0151492078f, -0.0161716249f, -0.0171458907f, -0.0180700719f,
+    -0.0189423691f, -0.0197611265f, -0.0205248315f, -0.0212321207f, -0.0218817778f, -0.0224727374f, -0.0230040867f, -0.0234750621f,
+    -0.0238850582f, -0.0242336206f, -0.0245204456f, -0.024745388f, -0.0249084458f, -0.0250097755f, -0.0250496771f, -0.0250285976f,
+    -0.0249471311f, -0.0248060077f, -0.0246061031f, -0.024348421f, -0.0240340997f, -0.0236644056f, -0.0232407264f, -0.022764571f,
+    -0.0222375616f, -0.0216614287f, -0.021038007f, -0.0203692298f, -0.0196571238f, -0.0189038031f, -0.0181114636f, -0.0172823742f,
+    -0.0164188761f, -0.0155233713f, -0.0145983184f, -0.0136462264f, -0.012669648f, -0.0116711715f, -0.0106534157f, -0.00961902365f,
+    -0.00857065432f, -0.0075109778f, -0.00644266652f, -0.00536839152f, -0.00429081358f, -0.00321257696f, -0.00213630521f, -0.00106459286f,
+    -2.11599402e-17f, 0.00105495343f, 0.00209779362f, 0.00312609877f, 0.00413750345f, 0.00512970611f, 0.00610047067f, 0.0070476355f,
+    0.007969114f, 0.00886290334f, 0.00972708315f, 0.0105598243f, 0.0113593917f, 0.0121241445f, 0.0128525421f, 0.0135431485f,
+    0.0141946292f, 0.0148057602f, 0.015375426f, 0.0159026198f, 0.0163864531f, 0.0168261435f, 0.0172210298f, 0.0175705645f,
+    0.0178743117f, 0.0181319546f, 0.0183432903f, 0.018508235f, 0.0186268091f, 0.0186991561f, 0.0187255256f, 0.018706277f,
+    0.0186418761f, 0.0185329001f, 0.0183800254f, 0.0181840286f, 0.0179457869f, 0.017666271f, 0.0173465405f, 0.0169877503f,
+    0.0165911317f, 0.0161580052f, 0.0156897604f, 0.0151878623f, 0.0146538485f, 0.0140893143f, 0.0134959193f, 0.0128753763f,
+    0.0122294463f, 0.0115599409f, 0.0108687067f, 0.0101576308f, 0.00942862779f, 0.00868363958f, 0.00792462938f, 0.00715357484f,
+    0.00637246529f, 0.00558329606f, 0.004788063f, 0.0039887582f, 0.0031873649f, 0.00238585286f, 0.00158617366f, 0.00079025561f,
+    1.76663544e-17f, -0.000782723888f, -0.00155608275f, -0.00231828354f, -0.00306757772f, -0.00380226411f, -0.00452069426f, -0.00522127468f,
+    -0.00590247056f, -0.00656280899f, -0.00720088277f, -0.00781535171f, -0.00840494595f, -0.00896846969f, -0.00950480066f, -0.0100128967f,
+    -0.0104917902f, -0.0109405983f, -0.0113585182f, -0.0117448308f, -0.012098901f, -0.0124201775f, -0.0127081983f, -0.0129625816f,
+    -0.0131830368f, -0.0133693563f, -0.013521418f, -0.0136391856f, -0.0137227066f, -0.0137721114f, -0.0137876142f, -0.0137695083f,
+    -0.0137181664f, -0.013634041f, -0.0135176564f, -0.0133696161f, -0.0131905898f, -0.0129813198f, -0.0127426144f, -0.0124753453f,
+    -0.0121804466f, -0.0118589103f, -0.0115117831f, -0.0111401649f, -0.010745205f, -0.0103280982f, -0.00989008043f, -0.00943242945f,
+    -0.00895645469f, -0.00846350007f, -0.00795493834f, -0.00743216369f, -0.00689659407f, -0.00634966418f, -0.00579282083f, -0.00522752153f,
+    -0.00465523079f, -0.00407741452f, -0.00349553721f, -0.00291105965f, -0.00232543354f, -0.00174009916f, -0.00115648145f, -0.000575986865f,
+    -1.43023019e-17f, 0.000570119708f, 0.00113304076f, 0.00168746291f, 0.00223211991f, 0.00276578241f, 0.00328725995f, 0.00379540469f,
+    0.00428911299f, 0.00476732804f, 0.00522904098f, 0.00567329442f, 0.00609918358f, 0.00650585815f, 0.0068925228f, 0.00725844083f,
+    0.00760293193f, 0.00792537723f, 0.00822521839f, 0.00850195624f, 0.00875515491f, 0.00898444187f, 0.0091895042f, 0.0093700951f,
+    0.00952602644f, 0.00965717621f, 0.00976348296f, 0.00984494668f, 0.0099016279f, 0.0099336477f, 0.00994118769f, 0.00992448721f,
+    0.00988383964f, 0.00981959887f, 0.0097321691f, 0.00962200947f, 0.00948962849f, 0.00933558587f, 0.00916048605f, 0.00896498095f,
+    0.00874976534f, 0.00851557404f, 0.00826318096f, 0.00799339637f, 0.00770706637f, 0.00740506686f, 0.00708830357f, 0.00675770827f,
+    0.00641423743f, 0.00605886849f, 0.00569259794f, 0.00531643862f, 0.00493141636f, 0.00453856727f, 0.00413893675f, 0.00373357488f,
+    0.0033235345f, 0.00290986872f, 0.00249362807f, 0.00207585841f, 0.00165759749f, 0.00123987335f, 0.000823701499f, 0.000410082546f,
+    4.07250463e-17f, -0.000405582134f, -0.000805721327f, -0.00119949889f, -0.00158602151f, -0.00196442381f, -0.00233386992f, -0.00269355462f,
+    -0.00304270629f, -0.00338058686f, -0.00370649481f, -0.00401976565f, -0.00431977306f, -0.0046059303f, -0.00487769162f, -0.00513455179f,
+    -0.00537604839f, -0.00560176279f, -0.00581131829f, -0.00600438286f, -0.00618066825f, -0.00633993233f, -0.00648197485f, -0.00660664262f,
+    -0.00671382574f, -0.00680345856f, -0.00687551918f, -0.00693002995f, -0.00696705515f, -0.00698670233f, -0.00698911957f, -0.00697449641f,
+    -0.00694306195f, -0.00689508393f, -0.00683086738f, -0.00675075501f, -0.00665512355f, -0.00654438371f, -0.00641897926f, -0.00627938518f,
+    -0.00612610485f, -0.00595967006f, -0.00578063913f, -0.00558959506f, -0.00538714277f, -0.00517390994f, -0.00495054154f, -0.00471770158f,
+    -0.00447606947f, -0.00422633719f, -0.00396921067f, -0.00370540377f, -0.00343564013f, -0.00316064851f, -0.00288116303f, -0.00259791967f,
+    -0.00231165532f, -0.00202310528f, -0.00173300283f, -0.00144207559f, -0.0011510452f, -0.000860624888f, -0.000571518147f, -0.000284416892f,
+    -8.46801089e-18f, 0.000281068176f, 0.000558139407f, 0.000830582867f, 0.00109778659f, 0.00135915878f, 0.00161412894f, 0.00186214887f,
+    0.00210269424f, 0.00233526505f, 0.00255938713f, 0.00277461251f, 0.00298052025f, 0.00317671802f, 0.00336284097f, 0.0035385543f,
+    0.0037035523f, 0.00385755929f, 0.00400032988f, 0.00413164962f, 0.00425133435f, 0.00435923086f, 0.00445521623f, 0.00453919871f,
+    0.00461111777f, 0.0046709422f, 0.00471867109f, 0.00475433329f, 0.00477798749f, 0.00478972029f, 0.00478964671f, 0.00477791019f,
+    0.00475467974f, 0.00472015142f, 0.00467454595f, 0.0046181092f, 0.00455111032f, 0.00447384082f, 0.00438661454f, 0.00428976538f,
+    0.00418364629f, 0.00406862982f, 0.00394510478f, 0.0038134763f, 0.00367416441f, 0.00352760288f, 0.00337423827f, 0.00321452739f,
+    0.003048938f, 0.00287794555f, 0.00270203361f, 0.00252169115f, 0.00233741291f, 0.002149696f, 0.00195904053f, 0.00176594732f,
+    0.00157091732f, 0.00137444958f, 0.00117704063f, 0.000979183242f, 0.000781365146f, 0.000584067719f, 0.000387765322f, 0.000192923879f,
+    -7.66158754e-18f, -0.00019056008f, -0.000378321449f, -0.000562861504f, -0.000743770564f, -0.000920653169f, -0.00109312846f, -0.00126083102f,
+    -0.00142341177f, -0.00158053846f, -0.00173189596f, -0.00187718763f, -0.00201613479f, -0.00214847806f, -0.00227397727f, -0.00239241193f,
+    -0.00250358111f, -0.0026073046f, -0.00270342221f, -0.00279179402f, -0.0028723015f, -0.00294484594f, -0.00300934911f, -0.00306575373f,
+    -0.00311402255f, -0.00315413903f, -0.00318610575f, -0.00320994575f, -0.0032257007f, -0.0032334323f, -0.00323321996f, -0.00322516169f,
+    -0.00320937345f, -0.00318598817f, -0.00315515511f, -0.0031170405f, -0.00307182525f, -0.00301970565f, -0.00296089193f, -0.00289560785f,
+    -0.00282408996f, -0.00274658692f, -0.00266335858f, -0.00257467548f, -0.00248081796f, -0.00238207472f, -0.00227874331f, -0.00217112829f,
+    -0.00205954048f, -0.00194429688f, -0.00182571867f, -0.0017041316f, -0.0015798643f, -0.00145324762f, -0.00132461428f, -0.00119429734f,
+    -0.00106262998f, -0.000929944334f, -0.000796571025f, -0.000662838167f, -0.000529070618f, -0.000395589363f, -0.000262710819f, -0.000130746019f,
+    -4.54186718e-18f, 0.000129228793f, 0.00025664916f, 0.000381977792f, 0.000504939759f, 0.000625269138f, 0.000742709381f, 0.000857013918f,
+    0.000967946602f, 0.00107528211f, 0.0011788063f, 0.00127831672f, 0.00137362245f, 0.00146454526f, 0.00155091903f, 0.00163259043f,
+    0.00170941884f, 0.00178127713f, 0.00184805063f, 0.00190963876f, 0.0019659535f, 0.00201692083f, 0.0020624795f, 0.00210258225f,
+    0.00213719462f, 0.00216629566f, 0.00218987721f, 0.00220794417f, 0.00222051446f, 0.00222761813f, 0.00222929777f, 0.0022256081f,
+    0.00221661571f, 0.00220239838f, 0.00218304573f, 0.00215865765f, 0.0021293445f, 0.00209522736f, 0.00205643615f, 0.00201311102f,
+    0.00196540053f, 0.00191346148f, 0.00185745908f, 0.00179756584f, 0.00173396128f, 0.00166683155f, 0.00159636873f, 0.00152277073f,
+    0.00144624023f, 0.00136698456f, 0.00128521514f, 0.00120114663f, 0.00111499697f, 0.00102698652f, 0.000937337347f, 0.000846273266f,
+    0.000754018896f, 0.000660799327f, 0.000566839415f, 0.000472363579f, 0.00037759525f, 0.000282756169f, 0.000188066173f, 9.37426375e-05f,
+    1.02530791e-17f, -9.29506205e-05f, -0.000184901874f, -0.000275650556f, -0.000364998094f, -0.000452750799f, -0.000538720342f, -0.00062272395f,
+    -0.000704585051f, -0.00078413327f, -0.000861204811f, -0.000935642864f, -0.00100729777f, -0.00107602729f, -0.00114169682f, -0.0012041796f,
+    -0.00126335712f, -0.00131911878f, -0.0013713626f, -0.00141999521f, -0.00146493153f, -0.00150609564f, -0.00154342025f, -0.00157684693f,
+    -0.00160632632f, -0.0016318179f, -0.00165329035f, -0.00167072122f, -0.00168409676f, -0.00169341243f, -0.00169867254f, -0.00169988989f,
+    -0.00169708626f, -0.00169029192f, -0.00167954527f, -0.00166489359f, -0.0016463917f, -0.00162410282f, -0.00159809762f, -0.00156845478f,
+    -0.00153526f, -0.00149860629f, -0.00145859353f, -0.00141532836f, -0.00136892369f, -0.00131949876f, -0.00126717868f, -0.00121209386f,
+    -0.0011543805f, -0.00109417946f, -0.00103163626f, -0.00096690096f, -0.000900127634f, -0.000831473968f, -0.000761101081f, -0.000689173234f,
+    -0.000615857309f, -0.000541322457f, -0.000465740013f, -0.000389282854f, -0.000312125223f, -0.000234442254f, -0.000156409733f, -7.82036805e-05f,
+    0.0f, 0.0f,
+};
+
+static const float sinc_table_32_128[4098] = {
+    1.0f, 0.999899626f, 0.999598324f, 0.999096096f, 0.998393178f, 0.99748975f, 0.99638617f, 0.995082855f,
+    0.993580282f, 0.991878927f, 0.989979506f, 0.987882614f, 0.985589027f, 0.983099639f, 0.980415285f, 0.977536976f,
+    0.974465728f, 0.971202672f, 0.96774894f, 0.964105844f, 0.960274696f, 0.956256807f, 0.952053726f, 0.947666883f,
+    0.943097889f, 0.938348413f, 0.933420122f, 0.928314805f, 0.92303431f, 0.917580545f, 0.911955416f, 0.90616101f,
+    0.900199354f, 0.894072652f, 0.887782991f, 0.881332695f, 0.87472403f, 0.86795938f, 0.861041129f, 0.853971839f,
+    0.846753895f, 0.83938992f, 0.831882536f, 0.824234426f, 0.816448271f, 0.808526874f, 0.800472975f, 0.792289436f,
+    0.783979177f, 0.775545061f, 0.766990125f, 0.758317411f, 0.749529839f, 0.740630567f, 0.731622696f, 0.722509325f,
+    0.713293731f, 0.703979075f, 0.694568634f, 0.685065567f, 0.675473273f, 0.665795088f, 0.656034231f, 0.64619422f,
+    0.636278272f, 0.626289964f, 0.616232634f, 0.606109679f, 0.595924616f, 0.585680962f, 0.575382113f, 0.565031528f,
+    0.554632843f, 0.544189453f, 0.533704937f, 0.523182809f, 0.512626588f, 0.50203979f, 0.491425902f, 0.480788529f,
+    0.470131159f, 0.459457338f, 0.448770523f, 0.438074291f, 0.427372098f, 0.416667461f, 0.405963838f, 0.395264715f,
+    0.384573549f, 0.373893768f, 0.363228828f, 0.352582067f, 0.341956943f, 0.331356794f, 0.320784956f, 0.310244769f,
+    0.29973951f, 0.289272428f, 0.27884683f, 0.268465906f, 0.258132815f, 0.247850731f, 0.237622783f, 0.22745204f,
+    0.217341572f, 0.207294405f, 0.197313502f, 0.187401816f, 0.177562267f, 0.167797685f, 0.158110932f, 0.148504749f,
+    0.138981909f, 0.129545093f, 0.120196939f, 0.110940062f, 0.101777002f, 0.0927102864f, 0.0837423503f, 0.0748756081f,
+    0.0661124215f, 0.0574550852f, 0.0489058569f, 0.0404669344f, 0.0321404561f, 0.0239285212f, 0.0158331562f, 0.00785634294f,
+    3.88967985e-17f, -0.00773400767f, -0.0153438738f, -0.0228278525f, -0.0301842541f, -0.0374114513f, -0.044507876f, -0.0514720194f,
+    -0.0583024323f, -0.0649977326f, -0.0715565905f, -0.0779777542f, -0.0842600167f, -0.0904022455f, -0.0964033604f, -0.102262348f,
+    -0.107978269f, -0.113550238f, -0.118977435f, -0.124259092f, -0.129394531f, -0.134383112f, -0.139224261f, -0.143917501f,
+    -0.14846237f, -0.152858511f, -0.157105595f, -0.161203399f, -0.165151715f, -0.168950424f, -0.17259948f, -0.176098883f,
+    -0.179448709f, -0.182649061f, -0.185700148f, -0.188602209f, -0.191355586f, -0.193960622f, -0.196417764f, -0.198727503f,
+    -0.200890377f, -0.202907026f, -0.204778105f, -0.206504345f, -0.208086535f, -0.209525496f, -0.210822135f, -0.211977407f,
+    -0.212992311f, -0.213867933f, -0.214605346f, -0.215205744f, -0.215670332f, -0.216000378f, -0.216197193f, -0.216262162f,
+    -0.216196686f, -0.216002241f, -0.215680316f, -0.215232477f, -0.214660332f, -0.213965505f, -0.213149682f, -0.212214604f,
+    -0.211162031f, -0.20999378f, -0.208711669f, -0.207317621f, -0.205813527f, -0.20420137f, -0.202483118f, -0.200660795f,
+    -0.198736474f, -0.196712241f, -0.194590196f, -0.192372516f, -0.190061346f, -0.187658906f, -0.185167417f, -0.182589129f,
+    -0.179926321f, -0.177181289f, -0.174356341f, -0.171453834f, -0.168476105f, -0.165425539f, -0.162304521f, -0.159115463f,
+    -0.155860767f, -0.152542859f, -0.149164215f, -0.145727247f, -0.142234445f, -0.138688251f, -0.135091156f, -0.131445631f,
+    -0.127754167f, -0.12401925f, -0.120243363f, -0.116428994f, -0.11257863f, -0.108694762f, -0.104779869f, -0.100836426f,
+    -0.0968669131f, -0.0928737894f, -0.0888595209f, -0.0848265439f, -0.0807773098f, -0.0767142475f, -0.0726397634f, -0.0685562715f,
+    -0.0644661486f, -0.0603717715f, -0.0562755018f, -0.0521796755f, -0.0480866097f, -0.0439986065f, -0.0399179459f, -0.0358468853f,
+    -0.0317876637f, -0.0277424864f, -0.0237135459f, -0.0197030008f, -0.0157129895f, -0.0117456187f, -0.00780296745f, -0.00388708757f,
+    -3.86401773e-17f, 0.0038563048f, 0.00767986802f, 0.0114687625f, 0.0152210956f, 0.018935008f, 0.0226086732f, 0.0262403022f,
+    0.0298281386f, 0.0333704688f, 0.0368656106f, 0.0403119214f, 0.0437077954f, 0.0470516719f, 0.0503420196f, 0.0535773598f,
+    0.0567562468f, 0.0598772727f, 0.0629390776f, 0.0659403428f, 0.0688797906f, 0.0717561916f, 0.0745683387f, 0.0773150995f,
+    0.079995364f, 0.0826080739f, 0.0851522088f, 0.0876268074f, 0.0900309384f, 0.0923637152f, 0.0946243182f, 0.0968119428f,
+    0.0989258513f, 0.100965343f, 0.102929771f, 0.104818523f, 0.106631041f, 0.10836681f, 0.110025354f, 0.111606263f,
+    0.113109156f, 0.114533693f, 0.115879603f, 0.117146626f, 0.118334591f, 0.119443327f, 0.120472744f, 0.121422783f,
+    0.122293413f, 0.123084679f, 0.123796649f, 0.124429449f, 0.124983221f, 0.125458181f, 0.125854582f, 0.126172692f,
+    0.126412868f, 0.12657547f, 0.126660898f, 0.126669616f, 0.126602128f, 0.126458973f, 0.126240686f, 0.125947922f,
+    0.125581309f, 0.125141531f, 0.124629319f, 0.124045439f, 0.123390675f, 0.12266586f, 0.121871866f, 0.121009588f,
+    0.120079949f, 0.119083934f, 0.118022516f, 0.116896734f, 0.115707643f, 0.114456333f, 0.113143906f, 0.111771524f,
+    0.110340334f, 0.108851552f, 0.107306391f, 0.105706103f, 0.104051948f, 0.102345221f, 0.100587241f, 0.0987793505f,
+    0.0969228968f, 0.095019266f, 0.0930698439f, 0.0910760537f, 0.0890393183f, 0.0869610906f, 0.0848428309f, 0.0826860145f,
+    0.0804921314f, 0.0782626793f, 0.075999178f, 0.0737031624f, 0.0713761449f, 0.0690196902f, 0.066635333f, 0.0642246529f,
+    0.0617891923f, 0.0593305379f, 0.056850262f, 0.0543499403f, 0.051831156f, 0.0492954887f, 0.0467445292f, 0.0441798605f,
+    0.0416030586f, 0.0390157141f, 0.0364193991f, 0.0338156931f, 0.0312061664f, 0.0285923835f, 0.0259759054f, 0.0233582836f,
+    0.0207410641f, 0.0181257837f, 0.0155139696f, 0.0129071372f, 0.0103067942f, 0.00771443406f, 0.00513153849f, 0.00255957549f,
+    3.82143215e-17f, -0.00254574884f, -0.00507624727f, -0.0075900876f, -0.0100858789f, -0.0125622489f, -0.0150178429f, -0.0174513254f,
+    -0.0198613796f, -0.022246711f, -0.0246060435f, -0.0269381274f, -0.0292417277f, -0.0315156393f, -0.0337586775f, -0.035969682f,
+    -0.0381475128f, -0.0402910635f, -0.0423992425f, -0.0444709957f, -0.0465052873f, -0.0485011078f, -0.0504574776f, -0.052373454f,
+    -0.054248102f, -0.0560805313f, -0.0578698777f, -0.0596153028f, -0.0613159984f, -0.0629711896f, -0.0645801276f, -0.0661420971f,
+    -0.0676564053f, -0.0691224113f, -0.0705394745f, -0.0719070137f, -0.07322447f, -0.0744913071f, -0.0757070258f, -0.0768711716f,
+    -0.0779833049f, -0.0790430307f, -0.0800499693f, -0.0810038f, -0.0819042102f, -0.0827509314f, -0.0835437179f, -0.0842823833f,
+    -0.0849667341f, -0.0855966359f, -0.0861719847f, -0.0866926983f, -0.0871587321f, -0.0875700787f, -0.0879267529f, -0.0882288143f,
+    -0.08847633f, -0.0886694267f, -0.088808246f, -0.0888929665f, -0.0889237896f, -0.0889009535f, -0.0888247266f, -0.0886954144f,
+    -0.0885133296f, -0.0882788301f, -0.0879923105f, -0.0876541808f, -0.0872648805f, -0.0868248716f, -0.0863346681f, -0.0857947767f,
+    -0.0852057561f, -0.0845681801f, -0.0838826597f, -0.0831498057f, -0.0823702887f, -0.0815447643f, -0.0806739554f, -0.0797585696f,
+    -0.0787993595f, -0.0777970925f, -0.0767525584f, -0.0756665692f, -0.074539952f, -0.073373571f, -0.0721682906f, -0.0709249973f,
+    -0.0696446076f, -0.0683280379f, -0.0669762418f, -0.065590173f, -0.0641708076f, -0.0627191365f, -0.0612361729f, -0.0597229265f,
+    -0.058180429f, -0.0566097349f, -0.0550118908f, -0.0533879735f, -0.0517390594f, -0.0500662364f, -0.0483705997f, -0.0466532633f,
+    -0.0449153371f, -0.0431579463f, -0.0413822159f, -0.0395892859f, -0.0377802886f, -0.0359563753f, -0.0341186933f, -0.0322683901f,
+    -0.0304066204f, -0.0285345446f, -0.026653314f, -0.0247640908f, -0.0228680279f, -0.020966284f, -0.0190600138f, -0.0171503704f,
+    -0.0152385021f, -0.0133255562f, -0.0114126746f, -0.00950099435f, -0.00759164663f, -0.00568575831f, -0.00378444791f, -0.00188882719f,
+    -3.76233242e-17f, 0.00188093842f, 0.00375290215f, 0.00561481481f, 0.00746561028f, 0.00930423383f, 0.0111296419f, 0.0129408017f,
+    0.0147366961f, 0.0165163185f, 0.018278677f, 0.0200227927f, 0.0217477046f, 0.0234524608f, 0.0251361318f, 0.0267978013f,
+    0.0284365695f, 0.0300515536f, 0.0316418894f, 0.0332067274f, 0.0347452424f, 0.0362566262f, 0.0377400815f, 0.0391948447f,
+    0.0406201594f, 0.0420152955f, 0.0433795489f, 0.0447122268f, 0.0460126586f, 0.0472802036f, 0.048514232f, 0.0497141518f,
+    0.0508793741f, 0.0520093441f, 0.0531035326f, 0.054161422f, 0.0551825352f, 0.0561663993f, 0.057112582f, 0.0580206625f,
+    0.0588902496f, 0.0597209781f, 0.0605125017f, 0.0612645075f, 0.0619766936f, 0.0626487955f, 0.063280575f, 0.0638717934f,
+    0.0644222796f, 0.0649318397f, 0.0654003471f, 0.0658276677f, 0.0662137121f, 0.0665584058f, 0.066861704f, 0.0671235844f,
+    0.0673440546f, 0.0675231293f, 0.0676608682f, 0.0677573532f, 0.0678126663f, 0.0678269491f, 0.0678003356f, 0.0677330047f,
+    0.0676251501f, 0.0674769878f, 0.0672887564f, 0.0670607239f, 0.0667931736f, 0.0664864108f, 0.0661407709f, 0.0657566041f,
+    0.0653342828f, 0.064874202f, 0.0643767789f, 0.0638424531f, 0.0632716715f, 0.0626649112f, 0.0620226786f, 0.0613454804f,
+    0.0606338531f, 0.059888348f, 0.0591095313f, 0.0582979992f, 0.0574543476f, 0.0565792061f, 0.0556732081f, 0.0547370054f,
+    0.053771276f, 0.052776698f, 0.0517539717f, 0.0507038124f, 0.0496269464f, 0.0485241115f, 0.0473960638f, 0.046243567f,
+    0.0450673997f, 0.043868348f, 0.042647209f, 0.0414047986f, 0.0401419289f, 0.038859427f, 0.0375581384f, 0.0362389013f,
+    0.0349025652f, 0.033549998f, 0.0321820602f, 0.0307996236f, 0.0294035692f, 0.027994778f, 0.0265741386f, 0.0251425374f,
+    0.0237008743f, 0.0222500432f, 0.0207909439f, 0.0193244796f, 0.0178515501f, 0.0163730588f, 0.0148899108f, 0.0134030068f,
+    0.0119132511f, 0.0104215415f, 0.00892877858f, 0.00743585778f, 0.00594367133f, 0.00445310911f, 0.00296505704f, 0.00148039532f,
+    3.68728761e-17f, -0.00147525861f, -0.00294451625f, -0.00440691551f, -0.00586160552f, -0.00730774319f, -0.00874449313f, -0.0101710288f,
+    -0.011586532f, -0.0129901953f, -0.0143812178f, -0.0157588124f, -0.0171222035f, -0.0184706189f, -0.019803308f, -0.0211195257f,
+    -0.02241854f, -0.0236996338f, -0.0249621011f, -0.026205251f, -0.0274284054f, -0.0286308993f, -0.0298120826f, -0.0309713241f,
+    -0.0321080014f, -0.0332215093f, -0.0343112648f, -0.0353766903f, -0.0364172347f, -0.0374323539f, -0.038421534f, -0.0393842608f,
+    -0.04032005f, -0.0412284359f, -0.0421089604f, -0.0429611914f, -0.0437847152f, -0.0445791334f, -0.0453440659f, -0.0460791551f,
+    -0.0467840582f, -0.047458455f, -0.0481020361f, -0.0487145297f, -0.0492956638f, -0.0498451926f, -0.0503628962f, -0.0508485697f,
+    -0.0513020232f, -0.0517230928f, -0.0521116331f, -0.0524675213f, -0.0527906455f, -0.0530809201f, -0.0533382818f, -0.0535626821f,
+    -0.0537540913f, -0.0539125055f, -0.054037936f, -0.0541304164f, -0.0541899987f, -0.05421675f, -0.0542107597f, -0.0541721433f,
+    -0.0541010238f, -0.0539975502f, -0.05386189f, -0.0536942258f, -0.0534947626f, -0.0532637201f, -0.0530013405f, -0.0527078807f,
+    -0.0523836128f, -0.0520288348f, -0.0516438521f, -0.0512289926f, -0.0507846028f, -0.0503110364f, -0.0498086773f, -0.0492779166f,
+    -0.0487191565f, -0.0481328294f, -0.0475193635f, -0.0468792208f, -0.0462128669f, -0.0455207787f, -0.0448034592f, -0.0440614112f,
+    -0.0432951637f, -0.0425052457f, -0.0416922085f, -0.040856611f, -0.0399990268f, -0.0391200334f, -0.0382202268f, -0.0373002104f,
+    -0.0363606028f, -0.0354020223f, -0.0344251059f, -0.0334304944f, -0.0324188396f, -0.0313908011f, -0.0303470474f, -0.0292882472f,
+    -0.028215088f, -0.0271282531f, -0.0260284375f, -0.0249163397f, -0.0237926655f, -0.0226581227f, -0.0215134267f, -0.0203592908f,
+    -0.0191964395f, -0.0180255957f, -0.0168474857f, -0.0156628378f, -0.0144723803f, -0.0132768461f, -0.0120769683f, -0.010873477f,
+    -0.0096671069f, -0.0084585892f, -0.00724865403f, -0.00603803201f, -0.0048274505f, -0.003617635f, -0.00240930892f, -0.0012031917f,
+    -3.59701938e-17f, 0.00119955372f, 0.00239476142f, 0.0035849195f, 0.00476932991f, 0.0059472993f, 0.00711814128f, 0.00828117505f,
+    0.00943572726f, 0.0105811302f, 0.0117167244f, 0.0128418598f, 0.0139558921f, 0.0150581859f, 0.0161481164f, 0.0172250662f,
+    0.018288428f, 0.0193376057f, 0.0203720126f, 0.0213910714f, 0.0223942157f, 0.0233808924f, 0.0243505575f, 0.0253026821f,
+    0.0262367465f, 0.0271522421f, 0.0280486755f, 0.028925566f, 0.0297824461f, 0.0306188595f, 0.0314343646f, 0.0322285369f,
+    0.0330009572f, 0.0337512307f, 0.0344789699f, 0.035183806f, 0.0358653814f, 0.0365233608f, 0.0371574126f, 0.0377672277f,
+    0.0383525118f, 0.0389129855f, 0.0394483842f, 0.0399584584f, 0.0404429808f, 0.0409017317f, 0.0413345098f, 0.0417411327f,
+    0.0421214327f, 0.0424752571f, 0.0428024717f, 0.0431029536f, 0.0433766022f, 0.0436233282f, 0.0438430682f, 0.0440357625f,
+    0.0442013741f, 0.0443398841f, 0.0444512814f, 0.0445355847f, 0.0445928164f, 0.0446230248f, 0.044626262f, 0.0446026064f,
+    0.0445521548f, 0.0444750041f, 0.0443712845f, 0.0442411341f, 0.0440847017f, 0.0439021587f, 0.0436936878f, 0.0434594899f,
+    0.0431997813f, 0.0429147854f, 0.0426047444f, 0.0422699191f, 0.0419105813f, 0.0415270142f, 0.0411195159f, 0.0406883992f,
+    0.040233992f, 0.0397566296f, 0.0392566659f, 0.0387344621f, 0.0381903946f, 0.0376248546f, 0.0370382406f, 0.0364309624f,
+    0.0358034447f, 0.0351561233f, 0.0344894342f, 0.0338038392f, 0.0330998003f, 0.0323777907f, 0.0316382982f, 0.0308818109f,
+    0.0301088318f, 0.0293198731f, 0.0285154507f, 0.0276960917f, 0.0268623289f, 0.0260147043f, 0.0251537636f, 0.0242800619f,
+    0.0233941581f, 0.0224966183f, 0.0215880144f, 0.0206689239f, 0.019739924f, 0.0188016016f, 0.0178545471f, 0.0168993529f,
+    0.0159366131f, 0.0149669275f, 0.0139908986f, 0.0130091291f, 0.0120222252f, 0.0110307923f, 0.0100354385f, 0.00903677288f,
+    0.00803540368f, 0.00703193992f, 0.00602698978f, 0.00502116047f, 0.00401505968f, 0.0030092909f, 0.00200445787f, 0.00100116152f,
+    3.49239625e-17f, -0.000998431118f, -0.00199353974f, -0.00298473728f, -0.00397143932f, -0.00495306496f, -0.00592903886f, -0.00689879013f,
+    -0.00786175299f, -0.00881736819f, -0.00976508111f, -0.0107043441f, -0.0116346152f, -0.0125553617f, -0.0134660546f, -0.0143661741f,
+    -0.01525521f, -0.0161326565f, -0.0169980172f, -0.0178508069f, -0.018690547f, -0.0195167661f, -0.020329006f, -0.021126816f,
+    -0.0219097547f, -0.0226773936f, -0.0234293099f, -0.0241650976f, -0.0248843543f, -0.0255866945f, -0.0262717418f, -0.0269391295f,
+    -0.0275885034f, -0.0282195229f, -0.0288318582f, -0.0294251889f, -0.0299992114f, -0.0305536315f, -0.0310881697f, -0.031602554f,
+    -0.032096535f, -0.0325698629f, -0.0330223106f, -0.0334536657f, -0.0338637233f, -0.0342522897f, -0.0346191898f, -0.0349642634f,
+    -0.0352873579f, -0.035588339f, -0.0358670838f, -0.0361234806f, -0.0363574401f, -0.0365688764f, -0.0367577225f, -0.0369239263f,
+    -0.0370674469f, -0.0371882543f, -0.0372863412f, -0.0373617038f, -0.0374143608f, -0.0374443345f, -0.0374516696f, -0.037436422f,
+    -0.0373986587f, -0.0373384617f, -0.0372559242f, -0.0371511541f, -0.0370242782f, -0.036875423f, -0.0367047377f, -0.0365123861f,
+    -0.0362985358f, -0.0360633694f, -0.035807088f, -0.0355299003f, -0.0352320261f, -0.0349136963f, -0.0345751569f, -0.0342166647f,
+    -0.0338384882f, -0.0334409028f, -0.0330241993f, -0.0325886756f, -0.0321346447f, -0.0316624232f, -0.0311723482f, -0.0306647569f,
+    -0.0301400013f, -0.0295984372f, -0.0290404372f, -0.0284663793f, -0.0278766472f, -0.0272716377f, -0.0266517513f, -0.0260174032f,
+    -0.025369009f, -0.0247069933f, -0.0240317918f, -0.0233438425f, -0.0226435941f, -0.0219314955f, -0.0212080069f, -0.020473592f,
+    -0.0197287202f, -0.0189738683f, -0.0182095114f, -0.0174361356f, -0.0166542307f, -0.0158642847f, -0.015066796f, -0.0142622609f,
+    -0.0134511832f, -0.0126340659f, -0.0118114157f, -0.0109837409f, -0.010151553f, -0.00931536313f, -0.00847568456f, -0.00763302995f,
+    -0.00678791432f, -0.00594085176f, -0.00509235682f, -0.00424294267f, -0.00339312246f, -0.00254340842f, -0.00169431092f, -0.000846339157f,
+    -3.37442508e-17f, 0.00084420183f, 0.00168576417f, 0.00252418756f, 0.00335897598f, 0.00418963656f, 0.00501568057f, 0.00583662232f,
+    0.00665198127f, 0.00746128149f, 0.00826405175f, 0.00905982498f, 0.00984814018f, 0.0106285429f, 0.0114005841f, 0.0121638188f,
+    0.012917812f, 0.0136621324f, 0.0143963564f, 0.0151200686f, 0.01583286f, 0.0165343285f, 0.0172240809f, 0.0179017317f,
+    0.0185669046f, 0.019219229f, 0.0198583454f, 0.0204839036f, 0.021095559f, 0.0216929801f, 0.0222758427f, 0.0228438322f,
+    0.0233966429f, 0.0239339825f, 0.024455566f, 0.0249611158f, 0.0254503712f, 0.025923077f, 0.0263789892f, 0.0268178768f,
+    0.0272395164f, 0.0276436992f, 0.0280302223f, 0.0283988994f, 0.0287495516f, 0.0290820152f, 0.0293961316f, 0.0296917595f,
+    0.0299687646f, 0.0302270278f, 0.0304664411f, 0.0306869056f, 0.0308883339f, 0.0310706552f, 0.0312338024f, 0.031377729f,
+    0.0315023959f, 0.0316077694f, 0.0316938385f, 0.0317605995f, 0.0318080559f, 0.0318362303f, 0.0318451524f, 0.0318348594f,
+    0.031805411f, 0.0317568704f, 0.0316893086f, 0.0316028185f, 0.0314974971f, 0.0313734524f, 0.0312308036f, 0.0310696866f,
+    0.0308902394f, 0.0306926165f, 0.0304769799f, 0.0302435029f, 0.0299923718f, 0.0297237802f, 0.0294379313f, 0.0291350372f,
+    0.0288153253f, 0.0284790266f, 0.0281263851f, 0.0277576521f, 0.0273730867f, 0.0269729607f, 0.0265575536f, 0.0261271503f,
+    0.025682047f, 0.0252225455f, 0.0247489605f, 0.0242616087f, 0.0237608161f, 0.0232469179f, 0.022720255f, 0.0221811738f,
+    0.021630032f, 0.0210671853f, 0.0204930045f, 0.0199078619f, 0.019312134f, 0.0187062062f, 0.0180904679f, 0.0174653139f,
+    0.016831141f, 0.0161883533f, 0.0155373579f, 0.0148785673f, 0.0142123969f, 0.013539264f, 0.0128595904f, 0.0121738017f,
+    0.0114823254f, 0.0107855899f, 0.0100840274f, 0.00937807281f, 0.00866816007f, 0.00795472693f, 0.00723821018f, 0.00651904894f,
+    0.00579768186f, 0.00507454854f, 0.00435008807f, 0.00362474006f, 0.00289894268f, 0.00217313389f, 0.00144775049f, 0.000723227859f,
+    3.24424041e-17f, -0.000721501012f, -0.0014408452f, -0.00215760479f, -0.00287135434f, -0.00358167221f, -0.00428813836f, -0.00499033742f,
+    -0.00568785658f, -0.00638028746f, -0.00706722541f, -0.00774827041f, -0.00842302572f, -0.00909110159f, -0.00975211058f, -0.0104056727f,
+    -0.0110514117f, -0.011688957f, -0.0123179462f, -0.0129380189f, -0.0135488249f, -0.0141500169f, -0.0147412578f, -0.015322214f,
+    -0.0158925597f, -0.0164519791f, -0.0170001574f, -0.0175367966f, -0.0180615969f, -0.0185742714f, -0.0190745406f, -0.0195621327f,
+    -0.0200367849f, -0.0204982404f, -0.0209462531f, -0.0213805865f, -0.0218010098f, -0.022207303f, -0.0225992557f, -0.0229766667f,
+    -0.0233393405f, -0.0236870944f, -0.0240197554f, -0.0243371576f, -0.0246391464f, -0.0249255747f, -0.0251963101f, -0.0254512224f,
+    -0.0256901998f, -0.0259131324f, -0.0261199232f, -0.0263104886f, -0.0264847521f, -0.0266426429f, -0.026784109f, -0.0269090999f,
+    -0.0270175822f, -0.027109528f, -0.0271849185f, -0.0272437502f, -0.0272860266f, -0.0273117591f, -0.0273209698f, -0.0273136962f,
+    -0.0272899773f, -0.0272498652f, -0.0271934271f, -0.0271207299f, -0.0270318594f, -0.0269269031f, -0.0268059652f, -0.0266691539f,
+    -0.0265165884f, -0.026348399f, -0.0261647217f, -0.0259657018f, -0.0257514976f, -0.025522273f, -0.0252781995f, -0.0250194613f,
+    -0.0247462448f, -0.0244587492f, -0.0241571814f, -0.0238417573f, -0.023512695f, -0.023170229f, -0.0228145923f, -0.0224460326f,
+    -0.0220647994f, -0.0216711536f, -0.0212653596f, -0.0208476894f, -0.0204184242f, -0.019977849f, -0.0195262525f, -0.0190639347f,
+    -0.0185911991f, -0.018108353f, -0.0176157095f, -0.0171135906f, -0.0166023187f, -0.0160822216f, -0.0155536365f, -0.0150168985f,
+    -0.0144723505f, -0.0139203379f, -0.0133612109f, -0.0127953216f, -0.0122230276f, -0.0116446875f, -0.0110606635f, -0.0104713198f,
+    -0.00987702515f, -0.00927814655f, -0.00867505651f, -0.00806812849f, -0.00745773502f, -0.00684425281f, -0.00622805813f, -0.0056095277f,
+    -0.00498904008f, -0.00436697295f, -0.00374370464f, -0.00311961304f, -0.00249507604f, -0.00187047047f, -0.0012461727f, -0.000622557884f,
+    -3.10309528e-17f, 0.000621128536f, 0.00124045694f, 0.00185761659f, 0.00247224071f, 0.00308396504f, 0.00369242788f, 0.00429727044f,
+    0.00489813648f, 0.00549467374f, 0.00608653249f, 0.00667336769f, 0.00725483662f, 0.00783060212f, 0.00840033032f, 0.008963692f,
+    0.00952036213f, 0.0100700213f, 0.0106123537f, 0.0111470502f, 0.0116738072f, 0.0121923238f, 0.0127023077f, 0.013203471f,
+    0.0136955315f, 0.0141782146f, 0.0146512501f, 0.0151143763f, 0.0155673362f, 0.0160098802f, 0.0164417643f, 0.0168627556f,
+    0.0172726233f, 0.0176711474f, 0.0180581119f, 0.0184333101f, 0.0187965445f, 0.0191476233f, 0.0194863621f, 0.0198125839f,
+    0.020126123f, 0.0204268172f, 0.0207145177f, 0.0209890772f, 0.0212503634f, 0.0214982461f, 0.0217326079f, 0.0219533388f,
+    0.0221603364f, 0.0223535076f, 0.0225327667f, 0.0226980373f, 0.0228492524f, 0.0229863524f, 0.0231092852f, 0.0232180133f,
+    0.0233124979f, 0.0233927183f, 0.0234586578f, 0.0235103071f, 0.0235476699f, 0.0235707536f, 0.0235795788f, 0.0235741735f,
+    0.0235545691f, 0.0235208124f, 0.0234729555f, 0.0234110579f, 0.0233351905f, 0.0232454296f, 0.0231418591f, 0.0230245758f,
+    0.0228936784f, 0.0227492787f, 0.022591494f, 0.0224204473f, 0.0222362746f, 0.0220391136f, 0.0218291134f, 0.0216064304f,
+    0.0213712286f, 0.0211236738f, 0.0208639465f, 0.0205922276f, 0.0203087106f, 0.0200135931f, 0.0197070763f, 0.0193893723f,
+    0.0190606974f, 0.0187212732f, 0.0183713306f, 0.0180111025f, 0.0176408309f, 0.0172607582f, 0.0168711375f, 0.0164722241f,
+    0.0160642806f, 0.0156475715f, 0.0152223688f, 0.0147889471f, 0.0143475858f, 0.0138985692f, 0.0134421838f, 0.0129787223f,
+    0.0125084799f, 0.0120317535f, 0.011548847f, 0.0110600628f, 0.0105657112f, 0.0100661004f, 0.00956154428f, 0.00905235671f,
+    0.00853885617f, 0.00802136119f, 0.00750019215f, 0.00697567128f, 0.00644812267f, 0.00591787044f, 0.00538524007f, 0.00485055754f,
+    0.0043141502f, 0.0037763447f, 0.00323746819f, 0.00269784755f, 0.00215780968f, 0.001617681f, 0.00107778679f, 0.000538451888f,
+    1.07385216e-16f, -0.000537246466f, -0.00107296661f, -0.00160684099f, -0.00213855226f, -0.00266778469f, -0.00319422525f, -0.00371756288f,
+    -0.00423748931f, -0.00475369906f, -0.00526588922f, -0.00577375991f, -0.00627701543f, -0.00677536242f, -0.00726851216f, -0.00775617873f,
+    -0.00823807996f, -0.00871394016f, -0.00918348413f, -0.00964644458f, -0.010102557f, -0.0105515607f, -0.0109932022f, -0.0114272311f,
+    -0.0118534043f, -0.0122714806f, -0.0126812281f, -0.0130824167f, -0.0134748248f, -0.0138582354f, -0.0142324381f, -0.0145972269f,
+    -0.0149524035f, -0.0152977752f, -0.0156331565f, -0.0159583651f, -0.0162732322f, -0.0165775865f, -0.0168712698f, -0.0171541292f,
+    -0.0174260195f, -0.0176867992f, -0.0179363377f, -0.0181745086f, -0.0184011925f, -0.0186162796f, -0.0188196674f, -0.0190112591f,
+    -0.0191909615f, -0.0193586983f, -0.0195143912f, -0.0196579751f, -0.0197893903f, -0.0199085847f, -0.0200155117f, -0.0201101359f,
+    -0.0201924276f, -0.0202623643f, -0.0203199312f, -0.0203651208f, -0.0203979351f, -0.0204183795f, -0.0204264689f, -0.0204222277f,
+    -0.0204056874f, -0.0203768816f, -0.020335855f, -0.0202826615f, -0.0202173609f, -0.0201400165f, -0.0200507045f, -0.0199495032f,
+    -0.0198365003f, -0.0197117906f, -0.0195754748f, -0.0194276609f, -0.0192684624f, -0.0190980043f, -0.0189164095f, -0.0187238157f,
+    -0.0185203608f, -0.018306192f, -0.0180814639f, -0.0178463329f, -0.0176009666f, -0.0173455328f, -0.0170802083f, -0.0168051757f,
+    -0.0165206231f, -0.0162267406f, -0.0159237273f, -0.0156117855f, -0.0152911237f, -0.0149619542f, -0.0146244951f, -0.014278966f,
+    -0.0139255943f, -0.0135646109f, -0.0131962486f, -0.0128207467f, -0.0124383466f, -0.0120492959f, -0.0116538415f, -0.0112522366f,
+    -0.0108447373f, -0.0104316026f, -0.0100130923f, -0.00958947185f, -0.00916100759f, -0.00872796867f, -0.00829062611f, -0.00784925185f,
+    -0.00740412204f, -0.0069555128f, -0.00650370214f, -0.00604896992f, -0.00559159601f, -0.00513186259f, -0.00467005139f, -0.00420644507f,
+    -0.00374132767f, -0.0032749828f, -0.00280769379f, -0.00233974447f, -0.00187141867f, -0.00140299904f, -0.00093476841f, -0.000467008445f,
+    -2.79344683e-17f, 0.000465977093f, 0.000930644281f, 0.00139372435f, 0.00185494171f, 0.00231402251f, 0.0027706949f, 0.00322468881f,
+    0.00367573649f, 0.00412357273f, 0.00456793467f, 0.005008562f, 0.00544519722f, 0.00587758655f, 0.00630547851f, 0.00672862493f,
+    0.00714678131f, 0.00755970692f, 0.00796716381f, 0.00836891867f, 0.00876474194f, 0.00915440917f, 0.00953769684f, 0.00991439074f,
+    0.0102842757f, 0.0106471451f, 0.0110027958f, 0.0113510294f, 0.0116916522f, 0.0120244743f, 0.012349315f, 0.0126659935f,
+    0.0129743386f, 0.0132741816f, 0.0135653624f, 0.0138477217f, 0.0141211115f, 0.0143853854f, 0.0146404039f, 0.0148860347f,
+    0.0151221491f, 0.0153486272f, 0.0155653534f, 0.0157722179f, 0.0159691181f, 0.0161559563f, 0.0163326431f, 0.0164990947f,
+    0.0166552328f, 0.0168009847f, 0.0169362891f, 0.0170610826f, 0.0171753168f, 0.0172789451f, 0.0173719265f, 0.0174542312f,
+    0.0175258331f, 0.0175867099f, 0.0176368505f, 0.0176762473f, 0.0177049004f, 0.0177228171f, 0.0177300088f, 0.0177264977f,
+    0.0177123062f, 0.017687466f, 0.0176520199f, 0.0176060069f, 0.0175494831f, 0.0174825024f, 0.01740513f, 0.0173174329f,
+    0.0172194894f, 0.0171113815f, 0.0169931948f, 0.0168650225f, 0.0167269632f, 0.0165791251f, 0.0164216179f, 0.0162545554f,
+    0.0160780624f, 0.0158922635f, 0.0156972911f, 0.0154932858f, 0.0152803883f, 0.0150587466f, 0.0148285143f, 0.0145898489f,
+    0.0143429115f, 0.0140878716f, 0.0138248987f, 0.0135541698f, 0.0132758645f, 0.0129901674f, 0.0126972683f, 0.0123973573f,
+    0.0120906327f, 0.0117772929f, 0.0114575429f, 0.0111315884f, 0.0107996399f, 0.0104619106f, 0.0101186167f, 0.009769978f,
+    0.00941621605f, 0.00905755535f, 0.00869422313f, 0.00832644757f, 0.00795446243f, 0.00757849915f, 0.00719879381f, 0.00681558391f,
+    0.00642910833f, 0.00603960641f, 0.0056473203f, 0.00525249261f, 0.00485536689f, 0.00445618713f, 0.00405519921f, 0.00365264877f,
+    0.00324878166f, 0.00284384424f, 0.00243808329f, 0.00203174516f, 0.00162507594f, 0.00121832173f, 0.000811728009f, 0.000405539409f,
+    -3.23641032e-17f, -0.000404647115f, -0.000808159937f, -0.00121029769f, -0.001610821f, -0.00200949167f, -0.00240607373f, -0.00280033238f,
+    -0.00319203525f, -0.0035809516f, -0.00396685349f, -0.00434951391f, -0.00472871028f, -0.0051042214f, -0.00547582842f, -0.0058433162f,
+    -0.0062064724f, -0.00656508701f, -0.00691895466f, -0.00726787187f, -0.00761163887f, -0.00795006007f, -0.00828294363f, -0.00861010049f,
+    -0.00893134624f, -0.00924649928f, -0.00955538452f, -0.0098578278f, -0.0101536624f, -0.0104427235f, -0.0107248528f, -0.0109998938f,
+    -0.0112676974f, -0.0115281185f, -0.0117810154f, -0.0120262513f, -0.0122636976f, -0.0124932267f, -0.0127147175f, -0.0129280547f,
+    -0.0131331272f, -0.0133298291f, -0.0135180615f, -0.0136977294f, -0.0138687426f, -0.0140310163f, -0.0141844731f, -0.0143290404f,
+    -0.0144646484f, -0.0145912375f, -0.0147087499f, -0.0148171345f, -0.0149163464f, -0.0150063466f, -0.0150871007f, -0.0151585797f,
+    -0.0152207613f, -0.0152736288f, -0.0153171699f, -0.0153513802f, -0.0153762596f, -0.0153918127f, -0.0153980507f, -0.0153949903f,
+    -0.015382655f, -0.0153610716f, -0.0153302727f, -0.0152902994f, -0.0152411945f, -0.0151830083f, -0.0151157947f, -0.0150396153f,
+    -0.0149545362f, -0.0148606272f, -0.0147579648f, -0.0146466307f, -0.0145267099f, -0.0143982945f, -0.0142614814f, -0.0141163701f,
+    -0.013963067f, -0.0138016827f, -0.013632332f, -0.0134551357f, -0.0132702161f, -0.0130777033f, -0.0128777297f, -0.0126704322f,
+    -0.0124559524f, -0.0122344345f, -0.0120060286f, -0.0117708864f, -0.0115291663f, -0.0112810275f, -0.0110266339f, -0.0107661523f,
+    -0.0104997549f, -0.0102276132f, -0.00994990487f, -0.00966681074f, -0.00937851146f, -0.00908519421f, -0.00878704619f, -0.00848425739f,
+    -0.00817702059f, -0.0078655323f, -0.00754998857f, -0.00723058917f, -0.00690753479f, -0.00658102846f, -0.00625127507f, -0.00591847999f,
+    -0.00558285136f, -0.00524459779f, -0.00490392838f, -0.00456105499f, -0.0042161881f, -0.00386954099f, -0.00352132646f, -0.00317175756f,
+    -0.00282104872f, -0.00246941368f, -0.00211706641f, -0.00176422135f, -0.00141109223f, -0.00105789257f, -0.000704835751f, -0.000352134201f,
+    -2.45736831e-17f, 0.000351355789f, 0.000701722922f, 0.00105089229f, 0.00139865594f, 0.00174480723f, 0.00208914094f, 0.00243145344f,
+    0.00277154264f, 0.00310920831f, 0.0034442523f, 0.00377647835f, 0.00410569226f, 0.00443170173f, 0.00475431792f, 0.00507335318f,
+    0.0053886231f, 0.00569994608f, 0.00600714283f, 0.00631003734f, 0.00660845637f, 0.00690222997f, 0.00719119096f, 0.00747517589f,
+    0.00775402412f, 0.00802757964f, 0.00829568785f, 0.00855820067f, 0.00881497096f, 0.00906585716f, 0.00931072049f, 0.00954942685f,
+    0.00978184678f, 0.0100078518f, 0.0102273226f, 0.0104401382f, 0.0106461877f, 0.0108453603f, 0.0110375518f, 0.0112226605f,
+    0.0114005916f, 0.0115712546f, 0.0117345601f, 0.0118904281f, 0.0120387794f, 0.0121795423f, 0.0123126488f, 0.0124380356f,
+    0.012555643f, 0.0126654189f, 0.012767313f, 0.0128612816f, 0.0129472865f, 0.0130252931f, 0.0130952718f, 0.0131571991f,
+    0.0132110538f, 0.0132568227f, 0.0132944956f, 0.013324067f, 0.0133455396f, 0.0133589152f, 0.0133642061f, 0.0133614261f,
+    0.0133505948f, 0.0133317364f, 0.0133048808f, 0.0132700624f, 0.0132273175f, 0.0131766917f, 0.0131182326f, 0.0130519932f,
+    0.0129780294f, 0.0128964046f, 0.012807183f, 0.0127104381f, 0.0126062427f, 0.0124946767f, 0.0123758251f, 0.0122497743f,
+    0.0121166166f, 0.0119764479f, 0.0118293697f, 0.0116754854f, 0.0115149021f, 0.0113477334f, 0.011174093f, 0.0109941f,
+    0.0108078793f, 0.0106155546f, 0.0104172574f, 0.010213119f, 0.0100032771f, 0.00978787057f, 0.00956704095f, 0.00934093352f,
+    0.00910969824f, 0.0088734841f, 0.00863244478f, 0.00838673767f, 0.00813652109f, 0.00788195524f, 0.00762320403f, 0.00736043323f,
+    0.00709380908f, 0.00682350248f, 0.0065496834f, 0.00627252599f, 0.00599220442f, 0.00570889469f, 0.0054227747f, 0.00513402326f,
+    0.00484282011f, 0.00454934686f, 0.00425378559f, 0.0039563193f, 0.00365713146f, 0.00335640647f, 0.00305432919f, 0.00275108521f,
+    0.00244685961f, 0.00214183843f, 0.00183620746f, 0.0015301524f, 0.0012238588f, 0.000917512109f, 0.000611297204f, 0.000305398542f,
+    6.69958129e-17f, -0.0003047153f, -0.000608565053f, -0.000911367824f, -0.00121294335f, -0.00151311234f, -0.0018116968f, -0.00210852013f,
+    -0.00240340736f, -0.00269618491f, -0.00298668048f, -0.00327472412f, -0.00356014771f, -0.00384278479f, -0.00412247097f, -0.00439904397f,
+    -0.00467234431f, -0.00494221412f, -0.00520849833f, -0.00547104469f, -0.0057297023f, -0.0059843245f, -0.00623476645f, -0.00648088614f,
+    -0.00672254572f, -0.00695960829f, -0.00719194161f, -0.00741941622f, -0.00764190545f, -0.00785928685f, -0.00807144027f, -0.00827824883f,
+    -0.00847960077f, -0.0086753862f, -0.00886549987f, -0.00904983934f, -0.00922830682f, -0.00940080732f, -0.00956725143f, -0.00972755067f,
+    -0.00988162309f, -0.0100293886f, -0.0101707745f, -0.0103057073f, -0.0104341218f, -0.0105559537f, -0.0106711462f, -0.0107796425f,
+    -0.0108813941f, -0.0109763537f, -0.0110644801f, -0.0111457342f, -0.0112200836f, -0.0112874992f, -0.0113479542f, -0.0114014298f,
+    -0.0114479084f, -0.0114873778f, -0.0115198297f, -0.0115452614f, -0.0115636727f, -0.0115750674f, -0.0115794558f, -0.0115768509f,
+    -0.0115672695f, -0.0115507329f, -0.0115272673f, -0.0114969024f, -0.0114596719f, -0.0114156138f, -0.0113647701f, -0.0113071874f,
+    -0.0112429149f, -0.0111720068f, -0.0110945208f, -0.0110105183f, -0.0109200645f, -0.0108232293f, -0.0107200854f, -0.010610709f,
+    -0.0104951803f, -0.0103735831f, -0.010246004f, -0.0101125333f, -0.00997326616f, -0.00982829928f, -0.00967773143f, -0.00952166878f,
+    -0.00936021563f, -0.00919348281f, -0.00902158208f, -0.00884463079f, -0.00866274443f, -0.00847604591f, -0.00828465819f, -0.00808870699f,
+    -0.00788832176f, -0.0076836329f, -0.00747477356f, -0.00726187974f, -0.00704508834f, -0.00682453997f, -0.00660037529f, -0.00637273863f,
+    -0.00614177482f, -0.00590763055f, -0.00567045482f, -0.00543039711f, -0.0051876097f, -0.00494224438f, -0.0046944553f, -0.00444439799f,
+    -0.00419222843f, -0.00393810309f, -0.00368217984f, -0.00342461769f, -0.00316557544f, -0.00290521281f, -0.00264369021f, -0.00238116784f,
+    -0.00211780658f, -0.0018537672f, -0.00158921047f, -0.00132429739f, -0.00105918874f, -0.000794044696f, -0.000529025565f, -0.000264290953f,
+    -2.10776208e-17f, 0.000263688824f, 0.000526617747f, 0.000788629754f, 0.00104956888f, 0.00130927993f, 0.00156760926f, 0.00182440376f,
+    0.00207951223f, 0.00233278424f, 0.00258407136f, 0.00283322623f, 0.00308010378f, 0.00332455966f, 0.0035664523f, 0.00380564108f,
+    0.0040419884f, 0.00427535735f, 0.00450561475f, 0.00473262789f, 0.00495626777f, 0.00517640729f, 0.00539292069f, 0.00560568599f,
+    0.00581458397f, 0.00601949636f, 0.00622030906f, 0.00641691033f, 0.00660919119f, 0.00679704547f, 0.00698036933f, 0.00715906359f,
+    0.00733302953f, 0.00750217447f, 0.00766640622f, 0.00782563724f, 0.00797978323f, 0.00812876318f, 0.00827249791f, 0.00841091294f,
+    0.00854393654f, 0.00867150258f, 0.00879354496f, 0.00891000219f, 0.0090208184f, 0.00912593864f, 0.00922531355f, 0.00931889471f,
+    0.00940664019f, 0.00948850997f, 0.00956446864f, 0.00963448267f, 0.00969852507f, 0.00975656882f, 0.00980859529f, 0.00985458493f,
+    0.0098945247f, 0.00992840342f, 0.00995621644f, 0.0099779591f, 0.00999363326f, 0.0100032426f, 0.0100067966f, 0.0100043053f,
+    0.00999578554f, 0.00998125598f, 0.00996073894f, 0.00993426144f, 0.00990185142f, 0.00986354332f, 0.00981937442f, 0.00976938382f,
+    0.00971361529f, 0.00965211634f, 0.00958493724f, 0.0095121311f, 0.00943375472f, 0.00934986956f, 0.00926053803f, 0.00916582625f,
+    0.00906580407f, 0.00896054506f, 0.00885012373f, 0.00873461924f, 0.00861411262f, 0.00848868862f, 0.00835843384f, 0.00822343864f,
+    0.0080837952f, 0.00793959852f, 0.00779094594f, 0.00763793848f, 0.00748067722f, 0.0073192683f, 0.00715381745f, 0.00698443502f,
+    0.00681123137f, 0.00663432106f, 0.00645381864f, 0.00626984145f, 0.00608250871f, 0.00589194149f, 0.00569826225f, 0.00550159486f,
+    0.00530206552f, 0.00509980088f, 0.00489492901f, 0.00468758075f, 0.00447788602f, 0.00426597754f, 0.00405198801f, 0.00383605133f,
+    0.00361830252f, 0.00339887757f, 0.00317791244f, 0.00295554427f, 0.00273191067f, 0.00250714924f, 0.00228139875f, 0.00205479749f,
+    0.00182748411f, 0.00159959798f, 0.00137127761f, 0.0011426619f, 0.000913889788f, 0.000685099512f, 0.000456429378f, 0.000228017103f,
+    -1.36496605e-17f, -0.000227485201f, -0.000454302412f, -0.000680316181f, -0.000905392051f, -0.00112939626f, -0.00135219598f, -0.00157365971f,
+    -0.00179365661f, -0.00201205746f, -0.00222873432f, -0.00244355993f, -0.00265640905f, -0.00286715804f, -0.00307568442f, -0.0032818676f,
+    -0.00348558836f, -0.00368672959f, -0.0038851758f, -0.00408081384f, -0.00427353149f, -0.00446321955f, -0.00464977091f, -0.00483307987f,
+    -0.00501304353f, -0.00518956129f, -0.00536253396f, -0.0055318661f, -0.00569746364f, -0.00585923577f, -0.00601709308f, -0.0061709499f,
+    -0.00632072287f, -0.00646633049f, -0.00660769548f, -0.00674474193f, -0.00687739719f, -0.00700559188f, -0.00712925848f, -0.00724833366f,
+    -0.00736275595f, -0.00747246714f, -0.00757741183f, -0.00767753832f, -0.00777279725f, -0.00786314253f, -0.00794853177f, -0.00802892447f,
+    -0.00810428336f, -0.00817457587f, -0.00823977124f, -0.00829984155f, -0.00835476257f, -0.00840451382f, -0.00844907761f, -0.00848843809f,
+    -0.00852258597f, -0.00855151005f, -0.00857520755f, -0.00859367568f, -0.00860691536f, -0.00861493126f, -0.00861772988f, -0.00861532427f,
+    -0.00860772561f, -0.00859495159f, -0.0085770227f, -0.00855396222f, -0.00852579437f, -0.00849255081f, -0.00845426135f, -0.0084109623f,
+    -0.00836269092f, -0.00830948912f, -0.00825139973f, -0.00818847027f, -0.00812074915f, -0.00804828946f, -0.00797114521f, -0.00788937509f,
+    -0.00780303963f, -0.00771220122f, -0.00761692552f, -0.00751728006f, -0.00741333608f, -0.00730516622f, -0.00719284639f, -0.00707645342f,
+    -0.00695606787f, -0.00683177123f, -0.00670364872f, -0.00657178648f, -0.00643627299f, -0.00629719859f, -0.00615465548f, -0.00600873912f,
+    -0.0058595445f, -0.00570716988f, -0.00555171492f, -0.00539328111f, -0.00523197046f, -0.00506788818f, -0.00490113907f, -0.00473183114f,
+    -0.00456007151f, -0.004385971f, -0.0042096395f, -0.00403118879f, -0.00385073223f, -0.00366838323f, -0.00348425657f, -0.00329846772f,
+    -0.00311113265f, -0.00292236847f, -0.00273229228f, -0.00254102214f, -0.00234867632f, -0.0021553738f, -0.00196123333f, -0.00176637445f,
+    -0.00157091627f, -0.00137497846f, -0.00117868034f, -0.000982141355f, -0.000785480894f, -0.000588817929f, -0.000392271264f, -0.000195959277f,
+    -1.7580503e-17f, 0.00019548909f, 0.00039039104f, 0.00058458955f, 0.000777969079f, 0.000970414723f, 0.00116181257f, 0.00135204941f,
+    0.00154101336f, 0.00172859314f, 0.00191467896f, 0.00209916197f, 0.00228193449f, 0.00246289023f, 0.00264192466f, 0.00281893369f,
+    0.00299381581f, 0.00316647021f, 0.00333679817f, 0.00350470212f, 0.00367008685f, 0.00383285829f, 0.00399292447f, 0.00415019551f,
+    0.00430458272f, 0.0044560004f, 0.00460436381f, 0.00474959053f, 0.00489160046f, 0.0050303163f, 0.00516566169f, 0.00529756257f,
+    0.00542594865f, 0.00555075007f, 0.0056719007f, 0.00578933535f, 0.00590299303f, 0.00601281319f, 0.00611873996f, 0.00622071791f,
+    0.00631869538f, 0.00641262298f, 0.00650245324f, 0.00658814237f, 0.00666964846f, 0.0067469324f, 0.0068199574f, 0.0068886904f,
+    0.00695309974f, 0.00701315748f, 0.00706883753f, 0.00712011661f, 0.00716697518f, 0.00720939506f, 0.00724736182f, 0.00728086289f,
+    0.00730988896f, 0.00733443396f, 0.00735449325f, 0.00737006636f, 0.00738115376f, 0.00738776056f, 0.00738989329f, 0.00738756172f,
+    0.00738077797f, 0.0073695574f, 0.00735391676f, 0.00733387703f, 0.00730946055f, 0.00728069292f, 0.0072476021f, 0.00721021881f,
+    0.00716857566f, 0.00712270895f, 0.00707265595f, 0.00701845763f, 0.00696015637f, 0.00689779734f, 0.00683142897f, 0.00676110061f,
+    0.00668686396f, 0.00660877442f, 0.00652688788f, 0.00644126302f, 0.00635196129f, 0.0062590451f, 0.00616257964f, 0.00606263196f,
+    0.00595927052f, 0.00585256657f, 0.00574259274f, 0.00562942354f, 0.00551313441f, 0.00539380452f, 0.00527151255f, 0.00514633954f,
+    0.00501836883f, 0.00488768378f, 0.00475437054f, 0.00461851619f, 0.00448020874f, 0.00433953805f, 0.00419659447f, 0.0040514702f,
+    0.0039042586f, 0.00375505304f, 0.00360394898f, 0.00345104258f, 0.00329642999f, 0.00314020948f, 0.00298247905f, 0.00282333768f,
+    0.002662885f, 0.00250122137f, 0.00233844738f, 0.00217466382f, 0.00200997246f, 0.00184447493f, 0.00167827308f, 0.00151146913f,
+    0.00134416542f, 0.00117646414f, 0.00100846763f, 0.00084027811f, 0.000671997666f, 0.000503728166f, 0.00033557124f, 0.000167628212f,
+    4.01102857e-17f, -0.0001672129f, -0.000333910517f, -0.000499993388f, -0.000665362692f, -0.000829920347f, -0.000993568916f, -0.00115621183f,
+    -0.00131775322f, -0.00147809833f, -0.00163715321f, -0.00179482496f, -0.00195102172f, -0.00210565282f, -0.00225862884f, -0.00240986142f,
+    -0.00255926349f, -0.00270674936f, -0.00285223452f, -0.00299563631f, -0.00313687301f, -0.00327586499f, -0.00341253378f, -0.00354680233f,
+    -0.00367859588f, -0.00380784064f, -0.00393446488f, -0.00405839924f, -0.00417957455f, -0.00429792516f, -0.00441338681f, -0.00452589616f,
+    -0.00463539315f, -0.00474181911f, -0.00484511722f, -0.00494523346f, -0.0050421143f, -0.00513570989f, -0.00522597181f, -0.00531285396f,
+    -0.00539631257f, -0.0054763048f, -0.00555279199f, -0.00562573643f, -0.00569510227f, -0.00576085784f, -0.00582297146f, -0.00588141475f,
+    -0.00593616208f, -0.00598718924f, -0.00603447482f, -0.00607800018f, -0.00611774763f, -0.00615370274f, -0.00618585385f, -0.00621419121f,
+    -0.00623870641f, -0.00625939481f, -0.00627625315f, -0.00628928142f, -0.00629848102f, -0.00630385615f, -0.00630541285f, -0.00630316045f,
+    -0.00629710965f, -0.00628727302f, -0.00627366686f, -0.00625630887f, -0.00623521814f, -0.00621041795f, -0.00618193159f, -0.00614978652f,
+    -0.0061140107f, -0.00607463531f, -0.00603169296f, -0.00598521903f, -0.00593524985f, -0.005881825f, -0.00582498545f, -0.00576477358f,
+    -0.00570123503f, -0.00563441636f, -0.005564366f, -0.00549113518f, -0.00541477511f, -0.00533534074f, -0.00525288749f, -0.00516747311f,
+    -0.00507915625f, -0.00498799793f, -0.00489406055f, -0.00479740743f, -0.00469810423f, -0.004596218f, -0.00449181627f, -0.0043849689f,
+    -0.00427574664f, -0.00416422123f, -0.00405046623f, -0.00393455569f, -0.0038165655f, -0.00369657204f, -0.00357465306f, -0.00345088704f,
+    -0.00332535338f, -0.00319813262f, -0.00306930603f, -0.00293895509f, -0.00280716293f, -0.00267401268f, -0.00253958837f, -0.0024039743f,
+    -0.00226725545f, -0.00212951726f, -0.00199084589f, -0.00185132725f, -0.00171104772f, -0.00157009426f, -0.0014285536f, -0.00128651282f,
+    -0.00114405912f, -0.00100127957f, -0.000858261192f, -0.000715091184f, -0.000571856392f, -0.000428643514f, -0.000285539078f, -0.000142629302f,
+    -1.42165911e-17f, 0.000142263321f, 0.00028407565f, 0.000425352395f, 0.000566009607f, 0.000705963874f, 0.000845132337f, 0.000983432983f,
+    0.00112078455f, 0.0012571062f, 0.00139231852f, 0.00152634236f, 0.00165910006f, 0.00179051445f, 0.0019205095f, 0.00204901048f,
+    0.00217594369f, 0.00230123615f, 0.00242481637f, 0.00254661427f, 0.00266656093f, 0.00278458837f, 0.00290063024f, 0.00301462179f,
+    0.00312649901f, 0.00323620019f, 0.00334366411f, 0.00344883208f, 0.00355164637f, 0.00365205086f, 0.00374999107f, 0.00384541415f,
+    0.00393826934f, 0.00402850611f, 0.00411607791f, 0.00420093816f, 0.00428304262f, 0.00436234893f, 0.0044388161f, 0.00451240595f,
+    0.0045830803f, 0.00465080515f, 0.0047155465f, 0.00477727363f, 0.00483595626f, 0.0048915674f, 0.00494408095f, 0.00499347411f,
+    0.00503972406f, 0.00508281123f, 0.0051227184f, 0.00515942974f, 0.00519293034f, 0.00522320904f, 0.00525025604f, 0.00527406344f,
+    0.00529462472f, 0.00531193661f, 0.00532599632f, 0.00533680478f, 0.00534436293f, 0.00534867542f, 0.00534974784f, 0.00534758763f,
+    0.00534220552f, 0.00533361221f, 0.00532182166f, 0.00530684972f, 0.00528871315f, 0.00526743103f, 0.00524302525f, 0.00521551818f,
+    0.00518493494f, 0.00515130162f, 0.00511464663f, 0.00507500023f, 0.00503239408f, 0.00498686172f, 0.00493843853f, 0.00488716085f,
+    0.00483306777f, 0.00477619888f, 0.0047165961f, 0.00465430273f, 0.00458936347f, 0.00452182395f, 0.00445173262f, 0.00437913788f,
+    0.00430409051f, 0.00422664266f, 0.00414684694f, 0.00406475784f, 0.00398043124f, 0.00389392395f, 0.00380529393f, 0.00371460011f,
+    0.00362190302f, 0.00352726411f, 0.00343074533f, 0.00333241024f, 0.0032323231f, 0.00313054887f, 0.00302715367f, 0.00292220409f,
+    0.00281576766f, 0.00270791305f, 0.00259870873f, 0.00248822453f, 0.00237653055f, 0.00226369756f, 0.00214979681f, 0.00203489978f,
+    0.00191907864f, 0.00180240592f, 0.00168495439f, 0.00156679715f, 0.0014480073f, 0.00132865866f, 0.00120882457f, 0.00108857884f,
+    0.000967995205f, 0.000847147603f, 0.000726109662f, 0.000604955072f, 0.000483757409f, 0.000362590043f, 0.000241526126f, 0.000120638579f,
+    -4.81570904e-18f, -0.000120317338f, -0.000240241556f, -0.000359701226f, -0.000478625327f, -0.000596943428f, -0.000714585593f, -0.000831482583f,
+    -0.000947565597f, -0.00106276677f, -0.00117701862f, -0.00129025476f, -0.00140240951f, -0.00151341781f, -0.00162321562f, -0.00173173996f,
+    -0.00183892844f, -0.00194471993f, -0.00204905402f, -0.00215187203f, -0.00225311518f, -0.00235272711f, -0.00245065149f, -0.00254683406f,
+    -0.00264122081f, -0.00273376005f, -0.00282440032f, -0.00291309226f, -0.00299978745f, -0.00308443862f, -0.00316700013f, -0.00324742799f,
+    -0.00332567887f, -0.00340171135f, -0.00347548584f, -0.00354696345f, -0.00361610716f, -0.00368288136f, -0.00374725251f, -0.00380918779f,
+    -0.00386865623f, -0.00392562896f, -0.0039800778f, -0.00403197668f, -0.00408130093f, -0.00412802864f, -0.00417213747f, -0.00421360834f,
+    -0.00425242307f, -0.00428856537f, -0.0043220208f, -0.00435277633f, -0.00438082078f, -0.00440614391f, -0.00442873826f, -0.00444859779f,
+    -0.00446571736f, -0.00448009465f, -0.0044917278f, -0.00450061727f, -0.00450676493f, -0.00451017544f, -0.00451085297f, -0.00450880546f,
+    -0.00450404081f, -0.00449657021f, -0.00448640436f, -0.00447355723f, -0.00445804419f, -0.00443988107f, -0.00441908697f, -0.00439568097f,
+    -0.0043696845f, -0.00434112083f, -0.00431001326f, -0.00427638786f, -0.0042402721f, -0.00420169439f, -0.00416068453f, -0.00411727466f,
+    -0.00407149689f, -0.00402338523f, -0.003972976f, -0.00392030505f, -0.00386541057f, -0.00380833214f, -0.00374911027f, -0.00368778617f,
+    -0.00362440292f, -0.00355900428f, -0.00349163567f, -0.00342234294f, -0.00335117336f, -0.0032781749f, -0.00320339692f, -0.00312688923f,
+    -0.00304870307f, -0.00296889036f, -0.00288750371f, -0.00280459644f, -0.00272022304f, -0.00263443845f, -0.00254729856f, -0.0024588597f,
+    -0.00236917892f, -0.00227831374f, -0.00218632258f, -0.0020932639f, -0.00199919706f, -0.00190418167f, -0.00180827768f, -0.00171154563f,
+    -0.00161404628f, -0.00151584076f, -0.00141699018f, -0.00131755637f, -0.00121760077f, -0.00111718546f, -0.00101637235f, -0.000915223442f,
+    -0.0008138009f, -0.000712166773f, -0.000610383111f, -0.000508511905f, -0.000406614883f, -0.000304753834f, -0.000202990195f, -0.000101385252f,
+    -4.04285153e-17f, 0.000101104866f, 0.000201868985f, 0.000302232365f, 0.000402135454f, 0.000501519069f, 0.000600324594f, 0.00069849391f,
+    0.000795969332f, 0.000892693934f, 0.000988611253f, 0.00108366553f, 0.00117780163f, 0.00127096532f, 0.00136310293f, 0.00145416148f,
+    0.00154408894f, 0.00163283409f, 0.00172034663f, 0.00180657697f, 0.00189147657f, 0.00197499781f, 0.00205709389f, 0.00213771942f,
+    0.00221682945f, 0.00229438045f, 0.00237033004f, 0.00244463631f, 0.00251725945f, 0.00258815964f, 0.0026572994f, 0.00272464147f,
+    0.00279015047f, 0.00285379146f, 0.0029155314f, 0.00297533814f, 0.00303318119f, 0.00308903074f, 0.00314285886f, 0.00319463853f,
+    0.00324434415f, 0.00329195126f, 0.00333743729f, 0.00338078057f, 0.00342196086f, 0.00346095907f, 0.00349775818f, 0.00353234191f,
+    0.00356469536f, 0.00359480525f, 0.00362265995f, 0.00364824873f, 0.00367156253f, 0.00369259366f, 0.00371133559f, 0.00372778368f,
+    0.00374193443f, 0.00375378551f, 0.00376333646f, 0.00377058773f, 0.00377554167f, 0.00377820153f, 0.00377857219f, 0.00377665996f,
+    0.00377247226f, 0.0037660182f, 0.00375730777f, 0.00374635309f, 0.00373316673f, 0.00371776312f, 0.00370015786f, 0.00368036749f,
+    0.00365841063f, 0.00363430614f, 0.0036080752f, 0.00357973925f, 0.00354932155f, 0.00351684634f, 0.00348233921f, 0.00344582647f,
+    0.00340733607f, 0.00336689688f, 0.00332453893f, 0.0032802932f, 0.0032341918f, 0.0031862678f, 0.0031365552f, 0.00308508961f,
+    0.00303190667f, 0.00297704362f, 0.00292053819f, 0.00286242948f, 0.00280275708f, 0.0027415615f, 0.00267888419f, 0.00261476706f,
+    0.00254925317f, 0.00248238584f, 0.00241420954f, 0.00234476919f, 0.00227411045f, 0.0022022794f, 0.00212932285f, 0.00205528829f,
+    0.00198022323f, 0.00190417632f, 0.0018271961f, 0.00174933195f, 0.00167063344f, 0.00159115042f, 0.00151093339f, 0.00143003277f,
+    0.00134849967f, 0.00126638496f, 0.0011837401f, 0.00110061653f, 0.00101706584f, 0.000933139934f, 0.000848890457f, 0.000764369441f,
+    0.000679628632f, 0.00059472007f, 0.000509695441f, 0.000424606522f, 0.000339505001f, 0.000254442362f, 0.000169469946f, 8.46388502e-05f,
+    2.19355328e-17f, -8.43959861e-05f, -0.000168498751f, -0.000252258294f, -0.000335624936f, -0.000418549374f, -0.000500982744f, -0.000582876615f,
+    -0.000664182997f, -0.000744854391f, -0.000824843883f, -0.000904105022f, -0.000982591999f, -0.00106025953f, -0.00113706302f, -0.00121295848f,
+    -0.00128790271f, -0.00136185309f, -0.00143476774f, -0.00150660553f, -0.00157732621f, -0.00164689007f, -0.00171525858f, -0.00178239367f,
+    -0.00184825843f, -0.00191281666f, -0.00197603297f, -0.00203787303f, -0.00209830375f, -0.0021572921f, -0.00221480709f, -0.00227081776f,
+    -0.002325295f, -0.00237821019f, -0.00242953561f, -0.00247924495f, -0.00252731284f, -0.00257371506f, -0.00261842809f, -0.00266143028f,
+    -0.00270269997f, -0.00274221785f, -0.00277996459f, -0.00281592272f, -0.00285007572f, -0.00288240821f, -0.00291290553f, -0.00294155511f,
+    -0.00296834484f, -0.00299326354f, -0.00301630213f, -0.00303745177f, -0.00305670523f, -0.00307405647f, -0.00308950059f, -0.00310303364f,
+    -0.00311465282f, -0.0031243572f, -0.00313214608f, -0.00313802063f, -0.00314198248f, -0.00314403512f, -0.00314418273f, -0.00314243091f,
+    -0.00313878595f, -0.00313325599f, -0.00312584965f, -0.00311657693f, -0.00310544902f, -0.0030924778f, -0.00307767675f, -0.00306105986f,
+    -0.00304264296f, -0.00302244187f, -0.00300047453f, -0.0029767591f, -0.00295131514f, -0.00292416313f, -0.00289532449f, -0.00286482158f,
+    -0.00283267768f, -0.002798917f, -0.0027635647f, -0.00272664684f, -0.00268819067f, -0.00264822342f, -0.00260677398f, -0.00256387168f,
+    -0.00251954701f, -0.00247383048f, -0.00242675422f, -0.00237835036f, -0.00232865242f, -0.00227769394f, -0.00222550984f, -0.00217213482f,
+    -0.00211760495f, -0.00206195656f, -0.00200522644f, -0.00194745243f, -0.00188867224f, -0.0018289244f, -0.00176824804f, -0.00170668249f,
+    -0.00164426758f, -0.00158104359f, -0.00151705125f, -0.00145233131f, -0.00138692523f, -0.00132087455f, -0.00125422108f, -0.00118700694f,
+    -0.00111927441f, -0.00105106598f, -0.000982424361f, -0.000913392229f, -0.000844012597f, -0.000774328422f, -0.000704382721f, -0.000634218566f,
+    -0.000563879032f, -0.000493407191f, -0.000422846089f, -0.000352238596f, -0.000281627581f, -0.000211055725f, -0.000140565637f, -7.01996614e-05f,
+    -8.39490301e-18f, 6.99913871e-05f, 0.000139732801f, 0.000209182792f, 0.000278300256f, 0.000347044348f, 0.000415374612f, 0.000483250973f,
+    0.000550633762f, 0.000617483631f, 0.000683761726f, 0.000749429746f, 0.000814449799f, 0.000878784398f, 0.000942396757f, 0.00100525049f,
+    0.00106730999f, 0.00112853991f, 0.00118890579f, 0.00124837365f, 0.0013069103f, 0.00136448303f, 0.00142105995f, 0.00147660973f,
+    0.001531102f, 0.00158450683f, 0.00163679512f, 0.0016879387f, 0.00173791009f, 0.00178668241f, 0.00183422992f, 0.00188052747f,
+    0.00192555075f, 0.00196927646f, 0.00201168167f, 0.00205274532f, 0.00209244597f, 0.00213076407f, 0.00216768053f, 0.00220317696f,
+    0.00223723659f, 0.00226984266f, 0.00230098004f, 0.00233063451f, 0.00235879212f, 0.00238544075f, 0.00241056853f, 0.00243416475f,
+    0.0024562201f, 0.00247672573f, 0.00249567372f, 0.00251305732f, 0.00252887094f, 0.00254310947f, 0.00255576917f, 0.00256684702f,
+    0.00257634115f, 0.00258425064f, 0.00259057549f, 0.00259531639f, 0.00259847543f, 0.00260005519f, 0.00260005984f, 0.00259849406f,
+    0.00259536342f, 0.00259067444f, 0.00258443481f, 0.00257665268f, 0.00256733783f, 0.00255650003f, 0.00254415092f, 0.00253030215f,
+    0.00251496676f, 0.00249815849f, 0.00247989199f, 0.00246018264f, 0.00243904651f, 0.00241650105f, 0.00239256397f, 0.00236725388f,
+    0.00234059035f, 0.00231259363f, 0.00228328444f, 0.00225268467f, 0.00222081644f, 0.00218770327f, 0.00215336867f, 0.00211783731f,
+    0.00208113389f, 0.00204328448f, 0.00200431538f, 0.00196425337f, 0.00192312628f, 0.00188096182f, 0.00183778896f, 0.00179363671f,
+    0.00174853462f, 0.00170251308f, 0.00165560248f, 0.0016078339f, 0.001559239f, 0.00150984945f, 0.00145969773f, 0.0014088162f,
+    0.00135723804f, 0.00130499655f, 0.00125212525f, 0.00119865802f, 0.00114462897f, 0.00109007244f, 0.00103502313f, 0.00097951584f,
+    0.000923585379f, 0.000867266848f, 0.000810595579f, 0.000753606844f, 0.000696336094f, 0.000638818718f, 0.000581090339f, 0.000523186463f,
+    0.000465142599f, 0.00040699431f, 0.000348777015f, 0.000290526164f, 0.000232277031f, 0.000174064859f, 0.000115924704f, 5.78914987e-05f,
+    -1.15670703e-18f, -5.77152314e-05f, -0.000115219838f, -0.000172479704f, -0.000229460973f, -0.000286130031f, -0.000342453568f, -0.00039839861f,
+    -0.000453932502f, -0.00050902291f, -0.000563637877f, -0.000617745856f, -0.000671315705f, -0.000724316633f, -0.000776718429f, -0.000828491116f,
+    -0.000879605417f, -0.00093003246f, -0.000979743781f, -0.00102871156f, -0.00107690843f, -0.00112430775f, -0.00117088319f, -0.00121660915f,
+    -0.00126146048f, -0.00130541297f, -0.00134844263f, -0.0013905263f, -0.0014316414f, -0.00147176615f, -0.00151087926f, -0.00154896022f,
+    -0.00158598914f, -0.00162194693f, -0.00165681494f, -0.00169057562f, -0.00172321196f, -0.00175470754f, -0.001785047f, -0.00181421533f,
+    -0.00184219866f, -0.00186898373f, -0.00189455785f, -0.00191890937f, -0.00194202724f, -0.00196390157f, -0.00198452245f, -0.00200388185f,
+    -0.00202197139f, -0.00203878433f, -0.00205431436f, -0.00206855615f, -0.00208150479f, -0.00209315657f, -0.00210350845f, -0.00211255811f,
+    -0.00212030415f, -0.00212674588f, -0.00213188329f, -0.00213571731f, -0.00213824981f, -0.00213948311f, -0.00213942048f, -0.00213806587f,
+    -0.00213542418f, -0.00213150075f, -0.0021263021f, -0.00211983547f, -0.00211210828f, -0.00210312917f, -0.00209290744f, -0.00208145333f,
+    -0.0020687771f, -0.00205489038f, -0.00203980552f, -0.00202353508f, -0.00200609234f, -0.00198749197f, -0.00196774816f, -0.00194687687f,
+    -0.00192489394f, -0.00190181599f, -0.00187766051f, -0.00185244542f, -0.00182618911f, -0.00179891067f, -0.00177062978f, -0.00174136646f,
+    -0.00171114167f, -0.00167997635f, -0.00164789252f, -0.00161491206f, -0.00158105802f, -0.00154635322f, -0.0015108214f, -0.00147448666f,
+    -0.00143737323f, -0.001399506f, -0.00136091025f, -0.00132161146f, -0.0012816356f, -0.00124100875f, -0.00119975768f, -0.00115790905f,
+    -0.0011154901f, -0.00107252819f, -0.00102905091f, -0.000985086081f, -0.000940661877f, -0.000895806414f, -0.000850548269f, -0.00080491585f,
+    -0.000758938026f, -0.000712643494f, -0.000666061358f, -0.000619220489f, -0.000572150049f, -0.0005248792f, -0.000477437075f, -0.000429852837f,
+    -0.000382155704f, -0.00033437481f, -0.000286539289f, -0.0002386782f, -0.000190820516f, -0.000142995137f, -9.52308401e-05f, -4.75562883e-05f,
+    7.5871082e-18f, 4.74096705e-05f, 9.46445434e-05f, 0.000141676632f, 0.000188478167f, 0.00023502158f, 0.000281279586f, 0.000327225105f,
+    0.00037283136f, 0.000418071868f, 0.000462920434f, 0.000507351186f, 0.000551338599f, 0.00059485744f, 0.000637882855f, 0.000680390513f,
+    0.000722356199f, 0.000763756339f, 0.00080456771f, 0.000844767375f, 0.000884332985f, 0.000923242653f, 0.000961474841f, 0.000999008655f,
+    0.00103582349f, 0.00107189943f, 0.00110721693f, 0.00114175701f, 0.00117550115f, 0.00120843155f, 0.00124053075f, 0.00127178198f,
+    0.00130216905f, 0.00133167615f, 0.00136028824f, 0.00138799089f, 0.00141477003f, 0.00144061248f, 0.00146550545f, 0.00148943695f,
+    0.00151239533f, 0.00153436989f, 0.00155535038f, 0.00157532713f, 0.00159429119f, 0.00161223428f, 0.00162914861f, 0.00164502731f,
+    0.00165986398f, 0.00167365279f, 0.00168638863f, 0.00169806706f, 0.00170868449f, 0.00171823753f, 0.00172672386f, 0.00173414161f,
+    0.00174048962f, 0.00174576719f, 0.00174997468f, 0.00175311277f, 0.00175518275f, 0.00175618683f, 0.00175612757f, 0.00175500836f,
+    0.00175283314f, 0.00174960634f, 0.00174533343f, 0.00174001988f, 0.00173367234f, 0.00172629778f, 0.00171790377f, 0.00170849846f,
+    0.00169809081f, 0.00168669014f, 0.00167430623f, 0.00166094978f, 0.00164663175f, 0.00163136376f, 0.00161515793f, 0.00159802695f,
+    0.00157998409f, 0.00156104285f, 0.00154121744f, 0.00152052275f, 0.00149897381f, 0.00147658621f, 0.00145337614f, 0.00142936001f,
+    0.00140455482f, 0.00137897814f, 0.00135264744f, 0.00132558122f, 0.00129779801f, 0.00126931665f, 0.00124015659f, 0.00121033739f,
+    0.00117987918f, 0.00114880223f, 0.00111712725f, 0.00108487508f, 0.00105206703f, 0.00101872452f, 0.000984869432f, 0.000950523594f,
+    0.000915709359f, 0.000880449079f, 0.000844765455f, 0.000808681245f, 0.000772219501f, 0.00073540333f, 0.000698256015f, 0.000660800957f,
+    0.000623061787f, 0.000585062022f, 0.000546825409f, 0.000508375757f, 0.000469736871f, 0.000430932647f, 0.000391986978f, 0.000352923787f,
+    0.000313766999f, 0.000274540507f, 0.000235268148f, 0.000195973756f, 0.000156681097f, 0.000117413852f, 7.81956041e-05f, 3.90498644e-05f,
+    1.08977538e-17f, -3.89307388e-05f, -7.77192472e-05f, -0.000116342577f, -0.000154777954f, -0.000193002779f, -0.000230994658f, -0.000268731383f,
+    -0.000306191039f, -0.000343351829f, -0.000380192301f, -0.000416691211f, -0.000452827604f, -0.000488580845f, -0.000523930474f, -0.000558856525f,
+    -0.000593339151f, -0.000627358968f, -0.000660896825f, -0.000693934096f, -0.000726452272f, -0.000758433365f, -0.000789859798f, -0.000820714282f,
+    -0.000850979937f, -0.000880640408f, -0.000909679569f, -0.000938081823f, -0.000965832034f, -0.000992915477f, -0.00101931777f, -0.00104502519f,
+    -0.00107002421f, -0.00109430205f, -0.00111784623f, -0.00114064477f, -0.00116268627f, -0.00118395977f, -0.00120445457f, -0.00122416089f,
+    -0.00124306919f, -0.00126117037f, -0.00127845618f, -0.00129491859f, -0.00131055026f, -0.00132534408f, -0.00133929378f, -0.00135239353f,
+    -0.0013646381f, -0.00137602247f, -0.00138654257f, -0.00139619468f, -0.00140497542f, -0.00141288235f, -0.00141991326f, -0.0014260665f,
+    -0.00143134105f, -0.00143573631f, -0.00143925252f, -0.00144189002f, -0.00144364976f, -0.00144453358f, -0.00144454348f, -0.00144368201f,
+    -0.00144195242f, -0.00143935822f, -0.00143590372f, -0.00143159356f, -0.00142643275f, -0.00142042723f, -0.00141358282f, -0.0014059064f,
+    -0.00139740494f, -0.00138808612f, -0.00137795799f, -0.00136702892f, -0.00135530811f, -0.00134280499f, -0.0013295291f, -0.00131549116f,
+    -0.00130070152f, -0.0012851716f, -0.00126891292f, -0.00125193724f, -0.00123425713f, -0.00121588528f, -0.00119683472f, -0.00117711897f,
+    -0.001156752f, -0.00113574788f, -0.00111412106f, -0.00109188666f, -0.0010690596f, -0.00104565558f, -0.0010216902f, -0.00099717977f,
+    -0.000972140406f, -0.000946588931f, -0.000920542167f, -0.000894017285f, -0.000867031573f, -0.000839602726f, -0.000811748439f, -0.000783486874f,
+    -0.000754836074f, -0.000725814549f, -0.000696440809f, -0.00066673354f, -0.0006367116f, -0.000606394024f, -0.000575799844f, -0.000544948271f,
+    -0.000513858628f, -0.000482550386f, -0.000451042928f, -0.000419355783f, -0.000387508597f, -0.000355520955f, -0.000323412474f, -0.000291202858f,
+    -0.000258911721f, -0.000226558768f, -0.000194163615f, -0.000161745833f, -0.00012932501f, -9.69206158e-05f, -6.45520995e-05f, -3.22388041e-05f,
+    -4.4980022e-18f, 3.21451589e-05f, 6.41776205e-05f, 9.60784673e-05f, 0.000127828898f, 0.00015941028f, 0.000190804116f, 0.000221992101f,
+    0.000252956088f, 0.000283678091f, 0.000314140372f, 0.000344325381f, 0.000374215801f, 0.000403794489f, 0.000433044595f, 0.000461949501f,
+    0.00049049285f, 0.000518658489f, 0.000546430645f, 0.000573793717f, 0.000600732514f, 0.000627232017f, 0.000653277559f, 0.000678854878f,
+    0.000703949889f, 0.00072854897f, 0.000752638734f, 0.000776206143f, 0.000799238565f, 0.000821723719f, 0.000843649672f, 0.00086500484f,
+    0.00088577799f, 0.000905958412f, 0.000925535627f, 0.000944499567f, 0.000962840684f, 0.000980549608f, 0.000997617608f, 0.00101403636f,
+    0.0010297976f, 0.00104489387f, 0.00105931808f, 0.00107306335f, 0.0010861234f, 0.00109849242f, 0.0011101648f, 0.00112113554f,
+    0.0011314f, 0.00114095421f, 0.0011497942f, 0.00115791685f, 0.00116531923f, 0.00117199891f, 0.00117795402f, 0.00118318282f,
+    0.00118768448f, 0.0011914582f, 0.00119450362f, 0.00119682122f, 0.00119841157f, 0.0011992756f, 0.00119941507f, 0.00119883171f,
+    0.00119752798f, 0.00119550666f, 0.0011927709f, 0.00118932442f, 0.00118517119f, 0.00118031574f, 0.00117476296f, 0.00116851798f,
+    0.00116158661f, 0.00115397479f, 0.00114568905f, 0.00113673625f, 0.00112712348f, 0.00111685845f, 0.00110594893f, 0.00109440344f,
+    0.00108223059f, 0.00106943934f, 0.00105603924f, 0.00104203972f, 0.00102745101f, 0.00101228349f, 0.000996547635f, 0.000980254728f,
+    0.000963415776f, 0.000946042477f, 0.000928146765f, 0.000909740687f, 0.00089083676f, 0.000871447613f, 0.00085158617f, 0.000831265585f,
+    0.000810499361f, 0.000789301179f, 0.000767684774f, 0.000745664292f, 0.000723254052f, 0.000700468547f, 0.000677322329f, 0.000653830357f,
+    0.000630007533f, 0.000605869107f, 0.000581430388f, 0.000556706684f, 0.000531713769f, 0.000506467128f, 0.000480982708f, 0.000455276371f,
+    0.000429364067f, 0.000403261889f, 0.00037698599f, 0.000350552553f, 0.000323977816f, 0.000297278049f, 0.000270469609f, 0.000243568837f,
+    0.00021659206f, 0.000189555634f, 0.000162475902f, 0.000135369206f, 0.000108251821f, 8.11400241e-05f, 5.40500296e-05f, 2.69979901e-05f,
+    -1.360121e-21f, -2.69279208e-05f, -5.37698397e-05f, -8.05099189e-05f, -0.000107132415f, -0.000133621696f, -0.000159962277f, -0.000186138757f,
+    -0.000212135914f, -0.000237938657f, -0.000263532042f, -0.000288901298f, -0.000314031815f, -0.000338909216f, -0.000363519212f, -0.000387847802f,
+    -0.000411881134f, -0.000435605587f, -0.000459007802f, -0.000482074567f, -0.000504792959f, -0.00052715023f, -0.000549133983f, -0.000570732052f,
+    -0.000591932388f, -0.000612723466f, -0.000633093761f, -0.000653032155f, -0.000672527938f, -0.000691570458f, -0.000710149528f, -0.000728255196f,
+    -0.000745877798f, -0.00076300808f, -0.000779636961f, -0.00079575571f, -0.00081135612f, -0.000826430041f, -0.000840969791f, -0.000854968035f,
+    -0.00086841773f, -0.000881312182f, -0.000893645105f, -0.000905410503f, -0.00091660273f, -0.00092721649f, -0.00093724695f, -0.000946689455f,
+    -0.000955539814f, -0.000963794242f, -0.00097144919f, -0.00097850163f, -0.000984948827f, -0.000990788219f, -0.000996018061f, -0.00100063649f,
+    -0.00100464246f, -0.0010080348f, -0.00101081305f, -0.0010129771f, -0.00101452717f, -0.00101546361f, -0.00101578759f, -0.00101550017f,
+    -0.00101460307f, -0.00101309828f, -0.00101098814f, -0.00100827531f, -0.00100496295f, -0.00100105442f, -0.000996553339f, -0.000991463894f,
+    -0.00098579051f, -0.000979537959f, -0.000972711365f, -0.000965316023f, -0.000957357814f, -0.000948842673f, -0.000939777121f, -0.000930167735f,
+    -0.000920021557f, -0.000909345923f, -0.000898148341f, -0.000886436785f, -0.000874219404f, -0.000861504639f, -0.000848301221f, -0.000834618171f,
+    -0.000820464687f, -0.000805850374f, -0.000790784892f, -0.000775278371f, -0.000759340997f, -0.000742983248f, -0.000726215891f, -0.000709049811f,
+    -0.000691496069f, -0.00067356613f, -0.00065527152f, -0.000636623881f, -0.000617635145f, -0.000598317478f, -0.000578682986f, -0.000558744243f,
+    -0.000538513705f, -0.000518004061f, -0.000497228233f, -0.000476199173f, -0.000454929948f, -0.000433433772f, -0.000411723944f, -0.000389813882f,
+    -0.00036771709f, -0.000345447101f, -0.000323017623f, -0.000300442334f, -0.000277735002f, -0.00025490945f, -0.000231979546f, -0.000208959143f,
+    -0.000185862169f, -0.000162702549f, -0.000139494208f, -0.000116251074f, -9.29870803e-05f, -6.97161158e-05f, -4.64520563e-05f, -2.32087532e-05f,
+    -1.01834726e-17f, 2.31604536e-05f, 4.62589123e-05f, 6.92817557e-05f, 9.22154286e-05f, 0.00011504646f, 0.000137761468f, 0.000160347161f,
+    0.000182790376f, 0.000205078031f, 0.000227197175f, 0.000249134988f, 0.000270878809f, 0.000292416051f, 0.000313734316f, 0.00033482138f,
+    0.000355665165f, 0.000376253738f, 0.000396575371f, 0.000416618481f, 0.000436371745f, 0.00045582396f, 0.000474964152f, 0.000493781583f,
+    0.0005122656f, 0.000530406018f, 0.000548192591f, 0.000565615483f, 0.00058266503f, 0.000599331863f, 0.000615606783f, 0.000631480885f,
+    0.000646945497f, 0.000661992177f, 0.000676612894f, 0.000690799614f, 0.000704544887f, 0.000717841322f, 0.000730681815f, 0.000743059674f,
+    0.000754968438f, 0.000766401819f, 0.000777353998f, 0.000787819328f, 0.000797792571f, 0.000807268603f, 0.000816242828f, 0.000824710762f,
+    0.000832668389f, 0.000840111868f, 0.000847037765f, 0.000853442878f, 0.000859324413f, 0.000864679809f, 0.000869506795f, 0.00087380351f,
+    0.000877568324f, 0.000880800013f, 0.000883497647f, 0.000885660469f, 0.000887288246f, 0.000888380921f, 0.000888938841f, 0.00088896259f,
+    0.000888453156f, 0.000887411705f, 0.000885839807f, 0.000883739325f, 0.000881112472f, 0.000877961691f, 0.000874289835f, 0.000870099873f,
+    0.000865395239f, 0.000860179658f, 0.00085445703f, 0.000848231663f, 0.000841508096f, 0.000834291161f, 0.00082658598f, 0.000818397966f,
+    0.000809732766f, 0.000800596375f, 0.000790994964f, 0.00078093505f, 0.00077042327f, 0.000759466726f, 0.000748072518f, 0.000736248272f,
+    0.000724001671f, 0.000711340574f, 0.000698273303f, 0.000684808183f, 0.000670953887f, 0.000656719261f, 0.000642113329f, 0.000627145404f,
+    0.000611824857f, 0.000596161466f, 0.000580164953f, 0.000563845388f, 0.000547212956f, 0.000530277961f, 0.000513050996f, 0.000495542714f,
+    0.000477763911f, 0.00045972559f, 0.00044143881f, 0.000422914833f, 0.000404164981f, 0.000385200721f, 0.000366033637f, 0.000346675399f,
+    0.000327137794f, 0.000307432638f, 0.000287571893f, 0.000267567579f, 0.000247431773f, 0.000227176584f, 0.000206814235f, 0.00018635692f,
+    0.000165816935f, 0.000145206577f, 0.000124538172f, 0.000103824059f, 8.30765857e-05f, 6.23080996e-05f, 4.15309551e-05f, 2.07574849e-05f,
+    6.21179387e-18f, -2.07292105e-05f, -4.1417894e-05f, -6.20538412e-05f, -8.26248797e-05f, -0.000103118909f, -0.000123523874f, -0.000143827798f,
+    -0.000164018769f, -0.000184084987f, -0.000204014708f, -0.000223796291f, -0.00024341821f, -0.000262869027f, -0.00028213748f, -0.000301212305f,
+    -0.000320082501f, -0.000338737125f, -0.000357165409f, -0.0003753567f, -0.000393300492f, -0.000410986511f, -0.000428404543f, -0.000445544632f,
+    -0.000462396943f, -0.000478951843f, -0.000495199929f, -0.000511131831f, -0.000526738586f, -0.000542011345f, -0.000556941377f, -0.000571520301f,
+    -0.00058573985f, -0.000599592051f, -0.000613069162f, -0.000626163499f, -0.000638867903f, -0.000651175156f, -0.000663078565f, -0.000674571376f,
+    -0.000685647363f, -0.000696300354f, -0.000706524588f, -0.00071631436f, -0.000725664489f, -0.000734569796f, -0.000743025565f, -0.000751027255f,
+    -0.000758570561f, -0.000765651581f, -0.000772266591f, -0.000778412097f, -0.000784085074f, -0.000789282494f, -0.000794001913f, -0.000798240944f,
+    -0.000801997609f, -0.000805270101f, -0.000808057026f, -0.000810357218f, -0.000812169805f, -0.000813494145f, -0.000814330007f, -0.000814677274f,
+    -0.000814536295f, -0.000813907594f, -0.000812791986f, -0.000811190577f, -0.000809104822f, -0.000806536409f, -0.000803487259f, -0.000799959642f,
+    -0.000795956061f, -0.000791479368f, -0.00078653259f, -0.000781119103f, -0.000775242457f, -0.00076890667f, -0.000762115757f, -0.0007548742f,
+    -0.000747186656f, -0.000739058072f, -0.00073049363f, -0.000721498742f, -0.000712079112f, -0.000702240621f, -0.000691989495f, -0.00068133208f,
+    -0.000670275069f, -0.000658825331f, -0.000646989851f, -0.000634776079f, -0.000622191408f, -0.000609243638f, -0.000595940743f, -0.000582290813f,
+    -0.000568302174f, -0.00055398338f, -0.000539343164f, -0.000524390431f, -0.000509134203f, -0.000493583793f, -0.000477748603f, -0.000461638178f,
+    -0.000445262238f, -0.000428630708f, -0.000411753543f, -0.000394640956f, -0.000377303193f, -0.000359750673f, -0.00034199396f, -0.000324043649f,
+    -0.000305910507f, -0.000287605391f, -0.000269139244f, -0.000250523095f, -0.000231768034f, -0.000212885265f, -0.000193886051f, -0.000174781686f,
+    -0.000155583562f, -0.000136303075f, -0.000116951698f, -9.75409203e-05f, -7.80822738e-05f, -5.85872913e-05f, -3.90675414e-05f, -1.95345856e-05f,
+    0.0f, 0.0f,
+};
+
+static const float sinc_table_64_512[32770] = {
+    1.0f, 0.999993742f, 0.999974906f, 0.999943495f, 0.999899566f, 0.999843121f, 0.999774039f, 0.9996925f,
+    0.999598324f, 0.999491692f, 0.999372482f, 0.999240696f, 0.999096394f, 0.998939574f, 0.998770237f, 0.998588324f,
+    0.998393893f, 0.998187006f, 0.997967541f, 0.99773562f, 0.997491181f, 0.997234225f, 0.996964753f, 0.996682823f,
+    0.996388435f, 0.996081591f, 0.995762229f, 0.99543041f, 0.995086193f, 0.994729459f, 0.994360387f, 0.993978798f,
+    0.993584812f, 0.993178427f, 0.992759645f, 0.992328525f, 0.991884947f, 0.991429031f, 0.990960717f, 0.990480125f,
+    0.989987135f, 0.989481807f, 0.9889642f, 0.988434315f, 0.987892091f, 0.987337589f, 0.986770809f, 0.986191809f,
+    0.985600531f, 0.984997034f, 0.984381378f, 0.983753443f, 0.983113348f, 0.982461095f, 0.981796682f, 0.98112011f,
+    0.980431378f, 0.979730606f, 0.979017675f, 0.978292704f, 0.977555692f, 0.976806581f, 0.97604543f, 0.975272298f,
+    0.974487185f, 0.973690093f, 0.972881019f, 0.972059965f, 0.97122705f, 0.970382214f, 0.969525456f, 0.968656898f,
+    0.967776418f, 0.966884196f, 0.965980113f, 0.965064228f, 0.9641366f, 0.963197231f, 0.96224618f, 0.961283326f,
+    0.96030885f, 0.959322751f, 0.958324969f, 0.957315564f, 0.956294596f, 0.955262065f, 0.95421797f, 0.953162372f,
+    0.952095211f, 0.951016665f, 0.949926615f, 0.948825121f, 0.947712302f, 0.946588039f, 0.945452452f, 0.944305539f,
+    0.943147302f, 0.941977859f, 0.940797091f, 0.939605176f, 0.938401997f, 0.937187672f, 0.93596226f, 0.934725702f,
+    0.933478057f, 0.932219326f, 0.930949569f, 0.929668844f, 0.928377151f, 0.927074492f, 0.925760984f, 0.92443651f,
+    0.923101246f, 0.921755135f, 0.920398235f, 0.919030547f, 0.91765213f, 0.916263044f, 0.914863229f, 0.913452804f,
+    0.912031829f, 0.910600185f, 0.909158051f, 0.907705426f, 0.906242311f, 0.904768705f, 0.903284729f, 0.901790321f,
+    0.900285602f, 0.898770571f, 0.897245288f, 0.895709693f, 0.894163966f, 0.892607987f, 0.891041934f, 0.889465749f,
+    0.887879491f, 0.886283159f, 0.884676874f, 0.883060575f, 0.881434381f, 0.879798293f, 0.87815237f, 0.876496613f,
+    0.87483108f, 0.873155773f, 0.871470749f, 0.86977607f, 0.868071795f, 0.866357863f, 0.864634395f, 0.862901449f,
+    0.861158967f, 0.859407067f, 0.85764581f, 0.855875134f, 0.854095161f, 0.852305889f, 0.850507319f, 0.848699629f,
+    0.846882761f, 0.845056713f, 0.843221605f, 0.841377497f, 0.839524329f, 0.83766222f, 0.83579123f, 0.8339113f,
+    0.832022548f, 0.830125034f, 0.828218699f, 0.82630372f, 0.82438004f, 0.822447777f, 0.820506871f, 0.818557441f,
+    0.816599548f, 0.814633131f, 0.81265837f, 0.810675204f, 0.808683693f, 0.806683958f, 0.804675937f, 0.80265975f,
+    0.800635457f, 0.798602998f, 0.796562493f, 0.794514f, 0.792457521f, 0.790393114f, 0.788320839f, 0.786240697f,
+    0.784152806f, 0.782057166f, 0.779953837f, 0.777842879f, 0.775724292f, 0.773598194f, 0.771464527f, 0.769323409f,
+    0.7671749f, 0.765019f, 0.762855828f, 0.760685325f, 0.758507609f, 0.756322742f, 0.754130721f, 0.751931608f,
+    0.749725461f, 0.7475124f, 0.745292306f, 0.743065357f, 0.740831614f, 0.738591015f, 0.736343682f, 0.734089673f,
+    0.731829047f, 0.729561746f, 0.727287948f, 0.725007653f, 0.722720921f, 0.720427811f, 0.718128324f, 0.715822518f,
+    0.713510454f, 0.71119225f, 0.708867848f, 0.706537426f, 0.704200864f, 0.701858342f, 0.699509919f, 0.697155535f,
+    0.69479537f, 0.692429364f, 0.690057635f, 0.687680244f, 0.685297191f, 0.682908535f, 0.680514395f, 0.678114712f,
+    0.675709605f, 0.673299193f, 0.670883358f, 0.668462336f, 0.66603601f, 0.663604558f, 0.661167979f, 0.658726335f,
+    0.656279683f, 0.653828084f, 0.651371539f, 0.648910165f, 0.646443963f, 0.643973053f, 0.641497433f, 0.639017105f,
+    0.636532247f, 0.634042859f, 0.631549001f, 0.629050672f, 0.626547992f, 0.624040961f, 0.621529698f, 0.619014204f,
+    0.616494536f, 0.613970757f, 0.611442924f, 0.608911097f, 0.606375337f, 0.603835642f, 0.601292133f, 0.59874481f,
+    0.59619379f, 0.593639135f, 0.591080785f, 0.588518918f, 0.585953474f, 0.583384633f, 0.580812335f, 0.578236699f,
+    0.575657785f, 0.573075652f, 0.570490301f, 0.56790179f, 0.56531024f, 0.56271565f, 0.560118079f, 0.557517648f,
+    0.554914296f, 0.552308202f, 0.549699306f, 0.547087729f, 0.544473529f, 0.541856706f, 0.53923738f, 0.536615551f,
+    0.533991337f, 0.531364739f, 0.528735816f, 0.526104689f, 0.523471296f, 0.520835817f, 0.518198252f, 0.5155586f,
+    0.512916982f, 0.510273457f, 0.507628024f, 0.504980803f, 0.502331853f, 0.499681145f, 0.497028798f, 0.494374871f,
+    0.491719395f, 0.489062458f, 0.486404061f, 0.483744293f, 0.481083214f, 0.478420854f, 0.475757301f, 0.473092586f,
+    0.470426768f, 0.467759907f, 0.465092063f, 0.462423265f, 0.459753603f, 0.457083106f, 0.454411864f, 0.451739877f,
+    0.449067235f, 0.446393967f, 0.443720192f, 0.44104588f, 0.438371122f, 0.435696006f, 0.433020532f, 0.43034479f,
+    0.42766884f, 0.424992681f, 0.422316432f, 0.419640124f, 0.416963786f, 0.414287508f, 0.411611348f, 0.408935308f,
+    0.406259507f, 0.403583944f, 0.400908709f, 0.398233861f, 0.39555943f, 0.392885476f, 0.390212059f, 0.387539208f,
+    0.384867013f, 0.382195532f, 0.379524767f, 0.376854807f, 0.374185711f, 0.371517539f, 0.368850291f, 0.366184086f,
+    0.363518924f, 0.360854894f, 0.358192056f, 0.355530441f, 0.352870077f, 0.350211054f, 0.347553432f, 0.34489724f,
+    0.342242539f, 0.339589357f, 0.336937815f, 0.334287882f, 0.331639647f, 0.328993201f, 0.326348513f, 0.323705703f,
+    0.3210648f, 0.318425864f, 0.315788925f, 0.313154042f, 0.310521275f, 0.307890683f, 0.305262297f, 0.302636176f,
+    0.30001238f, 0.297390968f, 0.294771969f, 0.292155415f, 0.289541394f, 0.286929965f, 0.284321129f, 0.281714976f,
+    0.279111564f, 0.276510894f, 0.273913056f, 0.271318108f, 0.268726051f, 0.266136974f, 0.263550937f, 0.26096797f,
+    0.258388102f, 0.255811423f, 0.253237933f, 0.250667751f, 0.248100847f, 0.245537326f, 0.242977202f, 0.24042055f,
+    0.237867415f, 0.235317826f, 0.232771844f, 0.230229512f, 0.227690876f, 0.225155994f, 0.222624913f, 0.220097661f,
+    0.217574313f, 0.215054885f, 0.212539449f, 0.210028052f, 0.207520723f, 0.205017522f, 0.202518478f, 0.200023666f,
+    0.197533101f, 0.195046842f, 0.192564949f, 0.190087453f, 0.187614396f, 0.185145825f, 0.182681784f, 0.180222332f,
+    0.1777675f, 0.175317332f, 0.172871888f, 0.170431197f, 0.167995289f, 0.165564239f, 0.163138092f, 0.160716861f,
+    0.158300593f, 0.155889362f, 0.153483197f, 0.151082128f, 0.1486862f, 0.146295473f, 0.143909961f, 0.141529739f,
+    0.139154837f, 0.136785284f, 0.134421125f, 0.13206242f, 0.129709199f, 0.127361491f, 0.125019357f, 0.122682825f,
+    0.12035194f, 0.118026748f, 0.115707278f, 0.113393575f, 0.111085676f, 0.108783633f, 0.106487468f, 0.104197234f,
+    0.10191296f, 0.0996346921f, 0.0973624662f, 0.0950963199f, 0.092836298f, 0.0905824304f, 0.0883347541f, 0.086093314f,
+    0.0838581473f, 0.0816292912f, 0.0794067755f, 0.077190645f, 0.0749809295f, 0.0727776736f, 0.0705809072f, 0.0683906749f,
+    0.0662069991f, 0.064029932f, 0.0618594959f, 0.0596957318f, 0.0575386733f, 0.0553883575f, 0.053244818f, 0.0511080883f,
+    0.048978202f, 0.0468551964f, 0.0447391048f, 0.0426299572f, 0.0405277908f, 0.0384326391f, 0.0363445319f, 0.0342635065f,
+    0.0321895927f, 0.0301228222f, 0.0280632302f, 0.0260108449f, 0.0239657015f, 0.0219278298f, 0.0198972598f, 0.0178740267f,
+    0.0158581585f, 0.013849685f, 0.0118486397f, 0.00985505059f, 0.00786894839f, 0.00589036243f, 0.00391932297f, 0.00195585913f,
+    3.89602069e-17f, -0.00194822554f, -0.00388878887f, -0.00582166156f, -0.00774681475f, -0.00966422167f, -0.0115738539f, -0.0134756835f,
+    -0.0153696835f, -0.0172558259f, -0.0191340875f, -0.0210044365f, -0.0228668489f, -0.0247213002f, -0.0265677627f, -0.0284062102f,
+    -0.0302366167f, -0.0320589617f, -0.0338732116f, -0.0356793515f, -0.0374773517f, -0.0392671861f, -0.0410488322f, -0.0428222679f,
+    -0.0445874706f, -0.0463444144f, -0.0480930731f, -0.0498334318f, -0.0515654609f, -0.0532891415f, -0.0550044514f, -0.0567113645f,
+    -0.0584098659f, -0.0600999296f, -0.0617815368f, -0.0634546652f, -0.0651192889f, -0.0667753965f, -0.0684229657f, -0.0700619742f,
+    -0.0716923997f, -0.0733142272f, -0.0749274343f, -0.0765320063f, -0.0781279206f, -0.0797151625f, -0.0812937096f, -0.0828635469f,
+    -0.0844246522f, -0.0859770104f, -0.0875206068f, -0.089055419f, -0.0905814394f, -0.0920986384f, -0.0936070085f, -0.0951065347f,
+    -0.0965971947f, -0.098078981f, -0.099551864f, -0.101015851f, -0.102470905f, -0.103917025f, -0.10535419f, -0.106782392f,
+    -0.108201608f, -0.109611832f, -0.111013047f, -0.112405248f, -0.113788404f, -0.115162522f, -0.11652758f, -0.11788357f,
+    -0.119230472f, -0.120568283f, -0.12189699f, -0.123216577f, -0.124527037f, -0.125828356f, -0.127120525f, -0.128403544f,
+    -0.129677385f, -0.130942062f, -0.132197544f, -0.133443817f, -0.134680897f, -0.135908768f, -0.137127399f, -0.138336807f,
+    -0.139536992f, -0.140727907f, -0.141909584f, -0.143081993f, -0.144245133f, -0.145398989f, -0.146543577f, -0.147678882f,
+    -0.148804888f, -0.149921596f, -0.151028991f, -0.152127087f, -0.15321587f, -0.154295325f, -0.155365467f, -0.156426281f,
+    -0.157477751f, -0.158519894f, -0.159552693f, -0.160576165f, -0.161590278f, -0.162595049f, -0.163590476f, -0.164576545f,
+    -0.165553257f, -0.16652061f, -0.167478621f, -0.168427259f, -0.169366539f, -0.17029646f, -0.171217024f, -0.17212823f,
+    -0.173030078f, -0.173922554f, -0.174805671f, -0.17567943f, -0.176543832f, -0.17739889f, -0.178244576f, -0.179080904f,
+    -0.179907888f, -0.18072553f, -0.181533813f, -0.182332754f, -0.183122352f, -0.183902621f, -0.184673548f, -0.185435146f,
+    -0.186187401f, -0.186930344f, -0.187663972f, -0.188388273f, -0.189103276f, -0.18980898f, -0.19050537f, -0.191192463f,
+    -0.191870272f, -0.192538813f, -0.193198055f, -0.193848044f, -0.194488764f, -0.19512023f, -0.195742443f, -0.196355417f,
+    -0.196959168f, -0.197553679f, -0.198138982f, -0.198715061f, -0.199281946f, -0.199839652f, -0.200388163f, -0.200927496f,
+    -0.201457664f, -0.201978683f, -0.202490568f, -0.202993304f, -0.203486919f, -0.203971416f, -0.204446822f, -0.204913124f,
+    -0.205370367f, -0.205818519f, -0.206257626f, -0.206687674f, -0.207108706f, -0.207520708f, -0.20792371f, -0.208317712f,
+    -0.208702728f, -0.209078774f, -0.209445879f, -0.209804028f, -0.210153252f, -0.210493565f, -0.210824981f, -0.211147517f,
+    -0.211461172f, -0.211765975f, -0.212061942f, -0.212349087f, -0.212627426f, -0.212896973f, -0.213157743f, -0.213409737f,
+    -0.213653013f, -0.213887542f, -0.21411337f, -0.214330509f, -0.214538962f, -0.214738756f, -0.214929923f, -0.215112463f,
+    -0.215286404f, -0.215451747f, -0.215608522f, -0.215756759f, -0.215896472f, -0.216027662f, -0.216150358f, -0.216264591f,
+    -0.216370374f, -0.216467723f, -0.216556653f, -0.216637209f, -0.216709375f, -0.216773197f, -0.216828689f, -0.216875881f,
+    -0.216914788f, -0.216945425f, -0.216967806f, -0.216981977f, -0.216987953f, -0.216985747f, -0.216975391f, -0.216956884f,
+    -0.216930285f, -0.216895595f, -0.216852844f, -0.216802046f, -0.216743246f, -0.216676429f, -0.21660167f, -0.216518953f,
+    -0.21642831f, -0.216329768f, -0.216223374f, -0.216109112f, -0.215987042f, -0.215857163f, -0.215719521f, -0.21557413f,
+    -0.215421021f, -0.215260223f, -0.21509175f, -0.214915633f, -0.214731902f, -0.214540571f, -0.214341685f, -0.214135274f,
+    -0.213921338f, -0.213699922f, -0.213471055f, -0.213234752f, -0.212991059f, -0.212739989f, -0.212481573f, -0.212215841f,
+    -0.211942822f, -0.211662546f, -0.211375028f, -0.211080313f, -0.21077843f, -0.210469395f, -0.210153237f, -0.209830001f,
+    -0.209499717f, -0.209162399f, -0.208818078f, -0.208466783f, -0.208108559f, -0.207743436f, -0.207371414f, -0.206992567f,
+    -0.20660688f, -0.206214428f, -0.205815211f, -0.205409274f, -0.204996631f, -0.204577342f, -0.204151407f, -0.203718886f,
+    -0.203279793f, -0.202834159f, -0.202382028f, -0.201923415f, -0.20145838f, -0.200986922f, -0.200509086f, -0.200024918f,
+    -0.199534431f, -0.199037671f, -0.198534667f, -0.19802545f, -0.197510064f, -0.196988523f, -0.196460873f, -0.195927143f,
+    -0.195387363f, -0.194841579f, -0.194289804f, -0.193732098f, -0.193168476f, -0.192598984f, -0.19202365f, -0.191442505f,
+    -0.190855592f, -0.190262944f, -0.189664572f, -0.189060554f, -0.188450888f, -0.187835634f, -0.187214807f, -0.186588451f,
+    -0.185956597f, -0.18531929f, -0.184676558f, -0.184028432f, -0.183374971f, -0.182716176f, -0.182052106f, -0.18138279f,
+    -0.180708274f, -0.180028573f, -0.17934373f, -0.178653792f, -0.177958801f, -0.17725876f, -0.176553741f, -0.17584376f,
+    -0.175128862f, -0.174409091f, -0.173684463f, -0.172955021f, -0.172220811f, -0.171481863f, -0.17073822f, -0.169989929f,
+    -0.169237003f, -0.168479487f, -0.167717412f, -0.166950837f, -0.166179776f, -0.16540429f, -0.164624393f, -0.163840145f,
+    -0.163051561f, -0.1622587f, -0.161461577f, -0.160660252f, -0.15985474f, -0.1590451f, -0.158231363f, -0.157413572f,
+    -0.156591743f, -0.155765936f, -0.15493618f, -0.154102519f, -0.153264984f, -0.15242362f, -0.151578471f, -0.150729552f,
+    -0.149876922f, -0.149020612f, -0.148160666f, -0.147297114f, -0.146430001f, -0.145559356f, -0.144685239f, -0.143807665f,
+    -0.142926678f, -0.142042324f, -0.141154647f, -0.140263677f, -0.139369443f, -0.138471991f, -0.13757138f, -0.136667609f,
+    -0.135760754f, -0.13485083f, -0.133937895f, -0.133021966f, -0.1321031f, -0.131181329f, -0.130256683f, -0.129329219f,
+    -0.12839897f, -0.127465963f, -0.12653026f, -0.125591874f, -0.124650851f, -0.123707242f, -0.122761078f, -0.121812396f,
+    -0.12086124f, -0.119907647f, -0.118951656f, -0.117993303f, -0.117032625f, -0.116069674f, -0.115104474f, -0.114137076f,
+    -0.113167509f, -0.112195812f, -0.111222036f, -0.110246204f, -0.109268367f, -0.108288556f, -0.107306816f, -0.106323183f,
+    -0.105337702f, -0.104350396f, -0.103361316f, -0.102370501f, -0.101377986f, -0.100383811f, -0.0993880108f, -0.0983906314f,
+    -0.0973917097f, -0.096391283f, -0.0953893811f, -0.0943860561f, -0.0933813378f, -0.092375271f, -0.0913678929f, -0.0903592408f,
+    -0.0893493518f, -0.0883382559f, -0.0873260126f, -0.0863126367f, -0.085298188f, -0.0842826888f, -0.0832661837f, -0.0822487101f,
+    -0.0812303051f, -0.0802110136f, -0.0791908577f, -0.0781698897f, -0.0771481469f, -0.076125659f, -0.0751024634f, -0.0740786046f,
+    -0.0730541199f, -0.0720290467f, -0.0710034221f, -0.069977276f, -0.0689506605f, -0.067923598f, -0.0668961331f, -0.0658683032f,
+    -0.0648401454f, -0.0638116971f, -0.0627829954f, -0.0617540739f, -0.0607249737f, -0.0596957281f, -0.0586663783f, -0.0576369539f,
+    -0.0566074997f, -0.0555780493f, -0.0545486398f, -0.0535193048f, -0.0524900854f, -0.0514610112f, -0.0504321232f, -0.0494034588f,
+    -0.0483750515f, -0.0473469384f, -0.0463191532f, -0.045291733f, -0.0442647152f, -0.0432381332f, -0.0422120243f, -0.0411864258f,
+    -0.0401613675f, -0.0391368903f, -0.0381130278f, -0.0370898098f, -0.0360672809f, -0.035045471f, -0.0340244137f, -0.0330041461f,
+    -0.0319847018f, -0.0309661161f, -0.0299484227f, -0.0289316569f, -0.027915854f, -0.0269010458f, -0.0258872695f, -0.0248745549f,
+    -0.0238629393f, -0.0228524562f, -0.0218431391f, -0.0208350196f, -0.0198281333f, -0.0188225154f, -0.0178181939f, -0.0168152079f,
+    -0.0158135872f, -0.0148133645f, -0.0138145741f, -0.0128172478f, -0.011821419f, -0.0108271204f, -0.00983438361f, -0.00884324219f,
+    -0.00785372686f, -0.00686587067f, -0.00587970531f, -0.00489526289f, -0.00391257508f, -0.00293167331f, -0.00195258937f, -0.000975354458f,
+    -3.88955511e-17f, 0.000973442919f, 0.00194494321f, 0.00291447015f, 0.00388199254f, 0.00484747998f, 0.00581090199f, 0.00677222852f,
+    0.00773142837f, 0.00868847221f, 0.00964332931f, 0.0105959699f, 0.011546365f, 0.012494484f, 0.0134402979f, 0.014383777f,
+    0.0153248925f, 0.0162636153f, 0.0171999149f, 0.0181337651f, 0.0190651342f, 0.0199939962f, 0.0209203232f, 0.0218440834f,
+    0.0227652509f, 0.0236837976f, 0.0245996956f, 0.025512917f, 0.0264234338f, 0.02733122f, 0.0282362457f, 0.0291384868f,
+    0.0300379135f, 0.0309345014f, 0.0318282209f, 0.0327190496f, 0.0336069539f, 0.0344919153f, 0.0353739038f, 0.0362528935f,
+    0.037128862f, 0.0380017757f, 0.0388716161f, 0.0397383571f, 0.0406019688f, 0.0414624326f, 0.0423197187f, 0.0431738049f,
+    0.0440246612f, 0.0448722728f, 0.0457166061f, 0.0465576425f, 0.047395356f, 0.0482297242f, 0.049060721f, 0.049888324f,
+    0.0507125072f, 0.051533252f, 0.0523505323f, 0.0531643294f, 0.0539746135f, 0.0547813661f, 0.0555845648f, 0.0563841872f,
+    0.0571802109f, 0.0579726137f, 0.0587613732f, 0.0595464706f, 0.0603278801f, 0.0611055829f, 0.0618795566f, 0.0626497865f,
+    0.0634162426f, 0.0641789064f, 0.0649377555f, 0.0656927824f, 0.0664439499f, 0.0671912506f, 0.0679346621f, 0.0686741546f,
+    0.0694097206f, 0.0701413378f, 0.0708689839f, 0.0715926439f, 0.0723122954f, 0.0730279237f, 0.0737395063f, 0.0744470209f,
+    0.0751504675f, 0.0758498088f, 0.0765450299f, 0.0772361234f, 0.0779230595f, 0.0786058307f, 0.0792844221f, 0.079958804f,
+    0.0806289688f, 0.0812948942f, 0.0819565654f, 0.0826139748f, 0.0832671002f, 0.0839159191f, 0.0845604241f, 0.0852006003f,
+    0.0858364254f, 0.0864678919f, 0.0870949775f, 0.0877176747f, 0.0883359611f, 0.0889498293f, 0.089559257f, 0.0901642367f,
+    0.090764761f, 0.0913608f, 0.0919523463f, 0.0925393924f, 0.0931219235f, 0.0936999172f, 0.094273366f, 0.0948422626f,
+    0.0954065919f, 0.0959663391f, 0.0965214893f, 0.0970720425f, 0.0976179689f, 0.0981592685f, 0.0986959338f, 0.0992279425f,
+    0.0997552872f, 0.10027796f, 0.100795947f, 0.101309247f, 0.101817831f, 0.102321707f, 0.102820858f, 0.103315264f,
+    0.103804938f, 0.104289845f, 0.104769997f, 0.105245374f, 0.105715968f, 0.106181771f, 0.106642775f, 0.107098974f,
+    0.10755036f, 0.107996918f, 0.108438641f, 0.108875528f, 0.109307565f, 0.109734751f, 0.11015708f, 0.110574536f,
+    0.110987119f, 0.111394815f, 0.111797631f, 0.112195544f, 0.112588562f, 0.11297667f, 0.113359876f, 0.113738157f,
+    0.114111513f, 0.114479944f, 0.114843443f, 0.115202002f, 0.115555622f, 0.115904294f, 0.116248012f, 0.116586775f,
+    0.116920583f, 0.117249429f, 0.117573306f, 0.117892213f, 0.118206151f, 0.118515104f, 0.118819088f, 0.119118087f,
+    0.119412102f, 0.119701132f, 0.119985171f, 0.120264217f, 0.120538279f, 0.120807342f, 0.121071413f, 0.121330485f,
+    0.121584564f, 0.121833637f, 0.122077718f, 0.1223168f, 0.122550875f, 0.122779958f, 0.123004034f, 0.123223118f,
+    0.123437196f, 0.123646274f, 0.123850361f, 0.124049447f, 0.124243535f, 0.124432623f, 0.124616727f, 0.124795832f,
+    0.124969952f, 0.125139073f, 0.125303209f, 0.125462368f, 0.12561655f, 0.125765741f, 0.125909954f, 0.126049206f,
+    0.126183465f, 0.126312777f, 0.126437113f, 0.126556501f, 0.126670927f, 0.126780391f, 0.126884907f, 0.126984492f,
+    0.127079129f, 0.127168819f, 0.127253592f, 0.127333432f, 0.127408355f, 0.127478361f, 0.127543464f, 0.12760365f,
+    0.127658948f, 0.127709344f, 0.127754852f, 0.127795488f, 0.127831236f, 0.127862126f, 0.127888158f, 0.127909333f,
+    0.127925649f, 0.127937138f, 0.127943799f, 0.127945617f, 0.127942637f, 0.127934828f, 0.127922222f, 0.127904832f,
+    0.127882645f, 0.127855688f, 0.127823964f, 0.127787471f, 0.127746224f, 0.127700254f, 0.127649531f, 0.127594098f,
+    0.127533942f, 0.127469093f, 0.127399549f, 0.127325311f, 0.127246395f, 0.127162829f, 0.127074599f, 0.126981735f,
+    0.126884222f, 0.126782104f, 0.126675367f, 0.126564041f, 0.12644811f, 0.126327619f, 0.126202554f, 0.126072928f,
+    0.125938773f, 0.125800073f, 0.125656873f, 0.125509158f, 0.125356957f, 0.125200272f, 0.125039116f, 0.124873504f,
+    0.124703452f, 0.124528967f, 0.124350071f, 0.124166779f, 0.123979092f, 0.123787031f, 0.123590603f, 0.123389833f,
+    0.123184726f, 0.122975305f, 0.122761577f, 0.122543558f, 0.122321263f, 0.122094706f, 0.121863909f, 0.121628873f,
+    0.12138962f, 0.121146172f, 0.12089853f, 0.120646723f, 0.120390765f, 0.120130658f, 0.119866438f, 0.119598106f,
+    0.119325683f, 0.119049177f, 0.118768625f, 0.11848402f, 0.118195392f, 0.117902763f, 0.117606133f, 0.117305532f,
+    0.117000967f, 0.116692461f, 0.116380036f, 0.116063699f, 0.115743481f, 0.11541938f, 0.115091436f, 0.114759646f,
+    0.114424042f, 0.114084639f, 0.11374145f, 0.113394499f, 0.1130438f, 0.112689376f, 0.112331249f, 0.111969426f,
+    0.111603931f, 0.111234784f, 0.110862002f, 0.110485606f, 0.110105619f, 0.109722048f, 0.109334931f, 0.108944267f,
+    0.108550094f, 0.108152419f, 0.107751265f, 0.107346654f, 0.106938601f, 0.106527127f, 0.106112264f, 0.105694018f,
+    0.105272412f, 0.104847476f, 0.104419217f, 0.103987664f, 0.103552833f, 0.103114747f, 0.102673426f, 0.102228895f,
+    0.101781167f, 0.101330273f, 0.100876227f, 0.100419052f, 0.09995877f, 0.0994954035f, 0.0990289673f, 0.0985594913f,
+    0.0980869904f, 0.0976114944f, 0.0971330181f, 0.0966515914f, 0.0961672217f, 0.0956799462f, 0.09518978f, 0.0946967453f,
+    0.0942008644f, 0.0937021598f, 0.0932006538f, 0.0926963687f, 0.0921893269f, 0.0916795582f, 0.09116707f, 0.0906518996f,
+    0.0901340619f, 0.0896135792f, 0.0890904814f, 0.0885647833f, 0.0880365074f, 0.0875056908f, 0.0869723409f, 0.0864364877f,
+    0.0858981535f, 0.0853573605f, 0.0848141313f, 0.084268488f, 0.083720468f, 0.0831700712f, 0.0826173425f, 0.0820622966f,
+    0.0815049559f, 0.0809453428f, 0.080383487f, 0.0798194036f, 0.0792531297f, 0.0786846727f, 0.07811407f, 0.0775413439f,
+    0.0769665092f, 0.0763896033f, 0.0758106336f, 0.0752296373f, 0.0746466368f, 0.0740616545f, 0.0734747201f, 0.0728858411f,
+    0.0722950622f, 0.0717023909f, 0.0711078644f, 0.070511505f, 0.0699133277f, 0.0693133697f, 0.0687116459f, 0.0681081861f,
+    0.0675030053f, 0.066896148f, 0.0662876219f, 0.0656774491f, 0.0650656745f, 0.064452298f, 0.0638373643f, 0.0632208884f,
+    0.0626028925f, 0.061983414f, 0.061362464f, 0.060740076f, 0.0601162687f, 0.0594910681f, 0.0588645041f, 0.058236599f,
+    0.0576073751f, 0.0569768585f, 0.0563450791f, 0.0557120517f, 0.0550778136f, 0.0544423796f, 0.0538057797f, 0.053168036f,
+    0.0525291748f, 0.0518892221f, 0.051248204f, 0.0506061427f, 0.0499630645f, 0.0493189916f, 0.0486739539f, 0.0480279736f,
+    0.047381077f, 0.04673329f, 0.0460846312f, 0.0454351343f, 0.0447848178f, 0.0441337116f, 0.0434818342f, 0.0428292193f,
+    0.0421758853f, 0.0415218584f, 0.0408671647f, 0.0402118303f, 0.0395558774f, 0.0388993323f, 0.0382422209f, 0.0375845656f,
+    0.0369263925f, 0.0362677276f, 0.0356085934f, 0.0349490158f, 0.034289021f, 0.0336286351f, 0.0329678804f, 0.0323067792f,
+    0.0316453576f, 0.0309836455f, 0.0303216632f, 0.0296594352f, 0.0289969873f, 0.0283343419f, 0.0276715271f, 0.027008567f,
+    0.026345484f, 0.0256823041f, 0.0250190496f, 0.0243557487f, 0.0236924235f, 0.0230290983f, 0.0223657992f, 0.0217025485f,
+    0.0210393723f, 0.020376293f, 0.0197133347f, 0.0190505255f, 0.0183878839f, 0.0177254397f, 0.0170632116f, 0.0164012276f,
+    0.0157395117f, 0.0150780845f, 0.0144169731f, 0.0137561997f, 0.0130957896f, 0.012435765f, 0.0117761502f, 0.0111169694f,
+    0.0104582468f, 0.00980000384f, 0.00914226659f, 0.00848505646f, 0.00782839861f, 0.00717231585f, 0.006516831f, 0.00586196827f,
+    0.00520775001f, 0.00455420045f, 0.00390134216f, 0.0032491982f, 0.00259779161f, 0.00194714568f, 0.00129728322f, 0.000648227055f,
+    3.87879117e-17f, -0.000647375127f, -0.00129387563f, -0.00193947891f, -0.00258416217f, -0.00322790327f, -0.00387067953f, -0.00451246835f,
+    -0.00515324809f, -0.00579299591f, -0.00643168949f, -0.00706930691f, -0.00770582631f, -0.0083412258f, -0.00897548255f, -0.00960857514f,
+    -0.0102404831f, -0.0108711822f, -0.0115006529f, -0.0121288728f, -0.0127558205f, -0.0133814747f, -0.0140058128f, -0.0146288155f,
+    -0.0152504612f, -0.0158707276f, -0.0164895933f, -0.0171070397f, -0.0177230444f, -0.0183375869f, -0.0189506449f, -0.0195621997f,
+    -0.0201722309f, -0.0207807161f, -0.0213876367f, -0.0219929703f, -0.0225967001f, -0.023198802f, -0.0237992574f, -0.0243980475f,
+    -0.0249951519f, -0.0255905502f, -0.0261842217f, -0.026776148f, -0.0273663104f, -0.0279546883f, -0.0285412613f, -0.0291260108f,
+    -0.0297089182f, -0.0302899648f, -0.0308691319f, -0.0314463973f, -0.032021746f, -0.0325951576f, -0.0331666097f, -0.0337360911f,
+    -0.0343035795f, -0.0348690562f, -0.0354325026f, -0.0359939039f, -0.0365532339f, -0.0371104851f, -0.0376656316f, -0.0382186621f,
+    -0.0387695506f, -0.0393182896f, -0.039864853f, -0.040409226f, -0.0409513935f, -0.0414913371f, -0.0420290381f, -0.0425644815f,
+    -0.0430976488f, -0.043628525f, -0.0441570915f, -0.0446833298f, -0.0452072322f, -0.0457287729f, -0.0462479368f, -0.0467647128f,
+    -0.0472790822f, -0.0477910303f, -0.0483005382f, -0.0488075912f, -0.0493121743f, -0.0498142727f, -0.0503138676f, -0.050810948f,
+    -0.0513054989f, -0.0517975017f, -0.0522869416f, -0.0527738072f, -0.05325808f, -0.0537397489f, -0.0542187952f, -0.0546952076f,
+    -0.0551689714f, -0.0556400716f, -0.0561084934f, -0.0565742254f, -0.0570372529f, -0.057497561f, -0.0579551347f, -0.0584099665f,
+    -0.0588620342f, -0.0593113303f, -0.0597578436f, -0.0602015555f, -0.0606424548f, -0.0610805303f, -0.0615157671f, -0.0619481541f,
+    -0.0623776801f, -0.0628043339f, -0.0632280931f, -0.0636489615f, -0.0640669167f, -0.0644819438f, -0.0648940429f, -0.0653031915f,
+    -0.0657093823f, -0.0661126003f, -0.0665128455f, -0.0669100955f, -0.067304343f, -0.0676955804f, -0.0680837855f, -0.0684689656f,
+    -0.068851091f, -0.0692301691f, -0.0696061701f, -0.0699791014f, -0.0703489482f, -0.0707156956f, -0.0710793436f, -0.0714398697f,
+    -0.0717972666f, -0.0721515343f, -0.0725026578f, -0.0728506297f, -0.0731954351f, -0.0735370666f, -0.0738755241f, -0.0742107928f,
+    -0.0745428652f, -0.0748717263f, -0.0751973763f, -0.0755198076f, -0.0758390054f, -0.0761549696f, -0.0764676854f, -0.0767771453f,
+    -0.0770833418f, -0.0773862749f, -0.0776859373f, -0.0779823065f, -0.07827539f, -0.0785651803f, -0.0788516626f, -0.0791348368f,
+    -0.0794146955f, -0.0796912313f, -0.0799644366f, -0.0802343041f, -0.0805008337f, -0.080764018f, -0.0810238421f, -0.0812803134f,
+    -0.0815334171f, -0.0817831531f, -0.082029514f, -0.0822724998f, -0.0825120956f, -0.0827483013f, -0.0829811171f, -0.0832105279f,
+    -0.0834365413f, -0.0836591423f, -0.0838783309f, -0.0840941072f, -0.0843064636f, -0.0845153928f, -0.0847209021f, -0.0849229693f,
+    -0.0851216093f, -0.0853168145f, -0.0855085701f, -0.085696891f, -0.0858817548f, -0.0860631764f, -0.0862411484f, -0.0864156559f,
+    -0.0865867138f, -0.0867543072f, -0.0869184434f, -0.0870791152f, -0.087236315f, -0.0873900577f, -0.0875403211f, -0.0876871198f,
+    -0.0878304467f, -0.0879703015f, -0.0881066844f, -0.0882395878f, -0.0883690119f, -0.0884949639f, -0.0886174366f, -0.0887364298f,
+    -0.0888519511f, -0.0889639929f, -0.0890725479f, -0.0891776308f, -0.0892792344f, -0.0893773586f, -0.0894720033f, -0.089563176f,
+    -0.0896508694f, -0.0897350833f, -0.0898158252f, -0.0898930952f, -0.0899668932f, -0.0900372192f, -0.0901040733f, -0.0901674554f,
+    -0.0902273729f, -0.090283826f, -0.090336822f, -0.090386346f, -0.0904324204f, -0.0904750302f, -0.0905141905f, -0.0905498937f,
+    -0.0905821547f, -0.0906109661f, -0.0906363353f, -0.0906582624f, -0.0906767473f, -0.0906918049f, -0.0907034278f, -0.0907116234f,
+    -0.0907163993f, -0.0907177478f, -0.090715684f, -0.0907102078f, -0.0907013267f, -0.0906890407f, -0.0906733498f, -0.0906542689f,
+    -0.0906317979f, -0.0906059369f, -0.0905766934f, -0.0905440748f, -0.0905080885f, -0.0904687345f, -0.0904260203f, -0.0903799534f,
+    -0.0903305337f, -0.0902777687f, -0.0902216658f, -0.0901622325f, -0.0900994688f, -0.0900333822f, -0.0899639875f, -0.0898912847f,
+    -0.0898152739f, -0.0897359774f, -0.0896533802f, -0.0895675123f, -0.0894783661f, -0.0893859491f, -0.0892902762f, -0.0891913399f,
+    -0.0890891701f, -0.0889837518f, -0.0888751075f, -0.088763237f, -0.0886481479f, -0.088529855f, -0.0884083658f, -0.0882836729f,
+    -0.0881558061f, -0.0880247578f, -0.0878905505f, -0.0877531767f, -0.0876126587f, -0.0874689892f, -0.0873221979f, -0.0871722773f,
+    -0.0870192423f, -0.086863108f, -0.0867038667f, -0.0865415484f, -0.0863761455f, -0.0862076804f, -0.0860361531f, -0.0858615786f,
+    -0.0856839716f, -0.0855033249f, -0.0853196681f, -0.0851330012f, -0.0849433318f, -0.0847506747f, -0.0845550448f, -0.0843564421f,
+    -0.084154889f, -0.0839503855f, -0.0837429538f, -0.0835325867f, -0.0833193138f, -0.0831031427f, -0.0828840807f, -0.0826621354f,
+    -0.0824373215f, -0.0822096542f, -0.0819791406f, -0.0817457885f, -0.08150962f, -0.0812706426f, -0.0810288712f, -0.0807843059f,
+    -0.0805369765f, -0.0802868828f, -0.0800340325f, -0.0797784552f, -0.079520151f, -0.0792591348f, -0.0789954141f, -0.0787290111f,
+    -0.0784599409f, -0.0781882033f, -0.0779138207f, -0.0776368007f, -0.0773571581f, -0.0770749077f, -0.076790072f, -0.0765026435f,
+    -0.076212652f, -0.075920105f, -0.0756250173f, -0.0753274038f, -0.0750272721f, -0.0747246444f, -0.0744195282f, -0.0741119459f,
+    -0.0738019049f, -0.0734894127f, -0.073174499f, -0.0728571713f, -0.0725374371f, -0.0722153187f, -0.071890831f, -0.0715639815f,
+    -0.0712347925f, -0.0709032789f, -0.0705694482f, -0.0702333227f, -0.0698949099f, -0.0695542321f, -0.0692113042f, -0.0688661337f,
+    -0.0685187429f, -0.0681691468f, -0.0678173527f, -0.0674633905f, -0.0671072602f, -0.0667489842f, -0.0663885772f, -0.0660260618f,
+    -0.0656614453f, -0.0652947426f, -0.0649259761f, -0.0645551533f, -0.0641823038f, -0.0638074279f, -0.0634305552f, -0.0630516857f,
+    -0.0626708493f, -0.0622880645f, -0.0619033352f, -0.0615166835f, -0.0611281283f, -0.0607376844f, -0.0603453666f, -0.0599511899f,
+    -0.0595551766f, -0.059157338f, -0.0587576963f, -0.0583562627f, -0.0579530559f, -0.0575480945f, -0.0571413934f, -0.0567329675f,
+    -0.0563228391f, -0.0559110232f, -0.0554975346f, -0.0550823919f, -0.0546656139f, -0.0542472154f, -0.053827215f, -0.0534056276f,
+    -0.0529824756f, -0.0525577702f, -0.0521315299f, -0.0517037772f, -0.0512745269f, -0.0508437939f, -0.0504115969f, -0.0499779545f,
+    -0.0495428853f, -0.0491064042f, -0.0486685336f, -0.0482292846f, -0.0477886796f, -0.0473467372f, -0.0469034687f, -0.0464589f,
+    -0.0460130423f, -0.0455659181f, -0.0451175459f, -0.0446679369f, -0.0442171171f, -0.0437651016f, -0.0433119051f, -0.0428575501f,
+    -0.0424020514f, -0.0419454314f, -0.0414877012f, -0.041028887f, -0.0405690037f, -0.0401080661f, -0.0396460965f, -0.0391831137f,
+    -0.0387191325f, -0.0382541716f, -0.0377882533f, -0.0373213887f, -0.036853604f, -0.0363849141f, -0.0359153375f, -0.0354448892f,
+    -0.0349735916f, -0.0345014632f, -0.0340285227f, -0.033554785f, -0.0330802724f, -0.0326049998f, -0.0321289897f, -0.0316522568f,
+    -0.0311748218f, -0.0306967013f, -0.0302179139f, -0.0297384802f, -0.0292584188f, -0.0287777446f, -0.02829648f, -0.0278146397f,
+    -0.0273322463f, -0.0268493146f, -0.026365865f, -0.0258819163f, -0.025397487f, -0.0249125939f, -0.0244272575f, -0.0239414945f,
+    -0.0234553255f, -0.0229687672f, -0.0224818382f, -0.0219945572f, -0.0215069428f, -0.0210190136f, -0.0205307882f, -0.0200422853f,
+    -0.0195535216f, -0.0190645177f, -0.0185752902f, -0.0180858597f, -0.0175962429f, -0.0171064567f, -0.0166165233f, -0.0161264576f,
+    -0.0156362802f, -0.0151460087f, -0.0146556608f, -0.0141652562f, -0.0136748115f, -0.0131843453f, -0.0126938773f, -0.0122034242f,
+    -0.0117130056f, -0.0112226382f, -0.0107323406f, -0.0102421315f, -0.00975202862f, -0.00926204957f, -0.00877221394f, -0.0082825385f,
+    -0.00779304188f, -0.00730374176f, -0.00681465585f, -0.00632580277f, -0.00583720021f, -0.00534886634f, -0.00486081839f, -0.00437307497f,
+    -0.0038856531f, -0.00339857116f, -0.00291184685f, -0.00242549763f, -0.00193954154f, -0.00145399617f, -0.000968878972f, -0.000484207761f,
+    -3.86375435e-17f, 0.000483726733f, 0.000966954976f, 0.00144966715f, 0.00193184591f, 0.00241347379f, 0.00289453357f, 0.003375008f,
+    0.00385487941f, 0.00433413079f, 0.00481274491f, 0.00529070478f, 0.00576799316f, 0.00624459283f, 0.00672048656f, 0.00719565805f,
+    0.0076700896f, 0.00814376492f, 0.00861666724f, 0.00908877887f, 0.00956008304f, 0.0100305639f, 0.0105002047f, 0.0109689878f,
+    0.0114368983f, 0.0119039174f, 0.0123700304f, 0.0128352204f, 0.0132994708f, 0.0137627656f, 0.0142250881f, 0.0146864224f,
+    0.0151467519f, 0.0156060606f, 0.0160643328f, 0.0165215526f, 0.0169777032f, 0.0174327679f, 0.0178867336f, 0.0183395818f,
+    0.0187912993f, 0.0192418676f, 0.0196912736f, 0.0201394986f, 0.0205865316f, 0.0210323539f, 0.0214769486f, 0.0219203047f,
+    0.0223624036f, 0.0228032321f, 0.0232427735f, 0.0236810129f, 0.0241179373f, 0.0245535299f, 0.024987774f, 0.0254206583f,
+    0.0258521661f, 0.0262822825f, 0.0267109945f, 0.0271382872f, 0.0275641438f, 0.0279885512f, 0.0284114946f, 0.0288329609f,
+    0.0292529371f, 0.0296714045f, 0.030088352f, 0.0305037666f, 0.0309176315f, 0.0313299336f, 0.0317406617f, 0.0321497992f,
+    0.032557331f, 0.0329632461f, 0.0333675332f, 0.0337701738f, 0.0341711566f, 0.0345704705f, 0.0349680968f, 0.0353640281f,
+    0.0357582495f, 0.036150746f, 0.0365415066f, 0.0369305201f, 0.0373177677f, 0.0377032422f, 0.0380869284f, 0.0384688154f,
+    0.0388488881f, 0.0392271355f, 0.03960355f, 0.0399781093f, 0.0403508097f, 0.0407216363f, 0.0410905778f, 0.0414576195f,
+    0.0418227501f, 0.0421859622f, 0.0425472409f, 0.0429065749f, 0.0432639532f, 0.0436193608f, 0.0439727902f, 0.0443242304f,
+    0.0446736701f, 0.0450210944f, 0.0453664958f, 0.0457098633f, 0.0460511856f, 0.0463904515f, 0.0467276499f, 0.0470627695f,
+    0.047395803f, 0.0477267355f, 0.0480555631f, 0.0483822674f, 0.0487068444f, 0.0490292832f, 0.0493495725f, 0.0496677011f,
+    0.0499836616f, 0.0502974428f, 0.0506090373f, 0.0509184301f, 0.0512256175f, 0.0515305884f, 0.0518333353f, 0.0521338433f,
+    0.0524321087f, 0.0527281202f, 0.0530218706f, 0.0533133522f, 0.0536025502f, 0.0538894609f, 0.054174073f, 0.054456383f,
+    0.0547363795f, 0.0550140515f, 0.0552893914f, 0.0555623993f, 0.0558330566f, 0.0561013594f, 0.0563673005f, 0.0566308759f,
+    0.0568920709f, 0.057150878f, 0.0574072972f, 0.0576613173f, 0.0579129308f, 0.0581621267f, 0.0584089048f, 0.0586532541f,
+    0.0588951707f, 0.0591346435f, 0.0593716688f, 0.0596062392f, 0.0598383471f, 0.0600679889f, 0.0602951571f, 0.060519848f,
+    0.0607420504f, 0.0609617606f, 0.0611789748f, 0.0613936819f, 0.0616058819f, 0.0618155673f, 0.0620227307f, 0.0622273684f,
+    0.0624294765f, 0.0626290515f, 0.0628260821f, 0.0630205646f, 0.0632124916f, 0.0634018704f, 0.0635886863f, 0.0637729391f,
+    0.0639546141f, 0.0641337261f, 0.0643102527f, 0.0644841939f, 0.0646555498f, 0.0648243204f, 0.0649904907f, 0.0651540607f,
+    0.065315038f, 0.0654734001f, 0.0656291544f, 0.0657822937f, 0.0659328252f, 0.0660807267f, 0.066226013f, 0.0663686693f,
+    0.0665087029f, 0.0666460991f, 0.0667808652f, 0.0669129938f, 0.0670424774f, 0.067169331f, 0.0672935322f, 0.0674150884f,
+    0.0675339922f, 0.0676502511f, 0.0677638575f, 0.0678748116f, 0.0679831058f, 0.0680887476f, 0.068191722f, 0.0682920441f,
+    0.0683896989f, 0.0684846938f, 0.0685770288f, 0.0686666891f, 0.0687536895f, 0.0688380226f, 0.0689196885f, 0.068998687f,
+    0.0690750107f, 0.0691486672f, 0.0692196563f, 0.0692879781f, 0.0693536252f, 0.0694166049f, 0.0694769174f, 0.0695345551f,
+    0.0695895255f, 0.0696418285f, 0.0696914569f, 0.0697384253f, 0.069782719f, 0.0698243454f, 0.0698633119f, 0.0698996112f,
+    0.0699332431f, 0.0699642152f, 0.0699925274f, 0.0700181797f, 0.0700411722f, 0.0700615048f, 0.0700791851f, 0.0700942054f,
+    0.0701065809f, 0.0701163039f, 0.0701233745f, 0.0701278076f, 0.0701295882f, 0.0701287314f, 0.0701252371f, 0.0701190978f,
+    0.0701103359f, 0.0700989291f, 0.0700849071f, 0.0700682476f, 0.070048973f, 0.0700270757f, 0.0700025633f, 0.0699754357f,
+    0.0699457005f, 0.06991335f, 0.0698784068f, 0.0698408559f, 0.0698007122f, 0.0697579831f, 0.0697126538f, 0.0696647465f,
+    0.0696142614f, 0.0695611984f, 0.0695055574f, 0.0694473609f, 0.069386594f, 0.0693232641f, 0.069257386f, 0.0691889599f,
+    0.0691179857f, 0.0690444782f, 0.0689684302f, 0.0688898563f, 0.0688087568f, 0.0687251389f, 0.0686390027f, 0.0685503632f,
+    0.0684592202f, 0.0683655813f, 0.0682694539f, 0.0681708306f, 0.0680697337f, 0.0679661632f, 0.0678601265f, 0.0677516237f,
+    0.0676406696f, 0.0675272644f, 0.0674114153f, 0.0672931299f, 0.0671724156f, 0.0670492798f, 0.0669237226f, 0.0667957589f,
+    0.0666653961f, 0.0665326342f, 0.0663974807f, 0.0662599504f, 0.0661200359f, 0.0659777671f, 0.065833129f, 0.0656861439f,
+    0.0655368119f, 0.0653851405f, 0.065231137f, 0.0650748163f, 0.064916186f, 0.064755246f, 0.0645920038f, 0.0644264743f,
+    0.0642586648f, 0.064088583f, 0.0639162287f, 0.0637416244f, 0.0635647699f, 0.0633856729f, 0.0632043481f, 0.0630207956f,
+    0.0628350377f, 0.062647067f, 0.0624569058f, 0.0622645542f, 0.062070027f, 0.0618733279f, 0.0616744719f, 0.0614734665f,
+    0.0612703189f, 0.0610650368f, 0.060857635f, 0.0606481209f, 0.0604365058f, 0.0602227934f, 0.0600070022f, 0.0597891323f,
+    0.0595692024f, 0.059347216f, 0.0591231883f, 0.0588971265f, 0.0586690418f, 0.0584389456f, 0.0582068451f, 0.0579727516f,
+    0.0577366762f, 0.0574986264f, 0.0572586209f, 0.0570166633f, 0.0567727648f, 0.0565269366f, 0.0562791936f, 0.0560295396f,
+    0.0557779931f, 0.0555245616f, 0.0552692525f, 0.0550120845f, 0.0547530614f, 0.0544921979f, 0.0542295054f, 0.0539649986f,
+    0.0536986813f, 0.0534305684f, 0.0531606749f, 0.0528890081f, 0.0526155829f, 0.0523404069f, 0.0520634949f, 0.0517848581f,
+    0.0515045077f, 0.0512224548f, 0.0509387143f, 0.0506532975f, 0.0503662117f, 0.0500774756f, 0.0497871004f, 0.0494950935f,
+    0.0492014699f, 0.0489062443f, 0.0486094281f, 0.0483110286f, 0.0480110645f, 0.047709547f, 0.0474064872f, 0.0471018963f,
+    0.0467957929f, 0.0464881845f, 0.0461790822f, 0.0458685048f, 0.0455564596f, 0.0452429615f, 0.0449280255f, 0.0446116626f,
+    0.0442938879f, 0.0439747125f, 0.0436541475f, 0.0433322079f, 0.0430089086f, 0.0426842608f, 0.0423582755f, 0.0420309715f,
+    0.0417023599f, 0.0413724519f, 0.0410412662f, 0.0407088101f, 0.0403750986f, 0.0400401466f, 0.0397039652f, 0.0393665731f,
+    0.0390279815f, 0.0386882015f, 0.038347248f, 0.038005136f, 0.0376618765f, 0.0373174883f, 0.0369719826f, 0.0366253704f,
+    0.0362776667f, 0.0359288901f, 0.0355790481f, 0.0352281593f, 0.0348762386f, 0.0345232934f, 0.0341693424f, 0.0338144004f,
+    0.0334584787f, 0.0331015922f, 0.0327437557f, 0.0323849842f, 0.0320252925f, 0.0316646919f, 0.0313031934f, 0.0309408214f,
+    0.0305775814f, 0.030213492f, 0.0298485663f, 0.0294828173f, 0.0291162618f, 0.0287489127f, 0.0283807833f, 0.0280118901f,
+    0.0276422482f, 0.0272718687f, 0.0269007683f, 0.0265289601f, 0.0261564609f, 0.0257832818f, 0.0254094414f, 0.025034951f,
+    0.0246598255f, 0.0242840815f, 0.0239077304f, 0.0235307887f, 0.0231532715f, 0.0227751918f, 0.0223965663f, 0.0220174063f,
+    0.0216377303f, 0.0212575495f, 0.0208768807f, 0.020495737f, 0.0201141331f, 0.019732086f, 0.0193496067f, 0.0189667139f,
+    0.0185834188f, 0.0181997363f, 0.017815683f, 0.0174312741f, 0.0170465205f, 0.016661441f, 0.0162760466f, 0.0158903543f,
+    0.0155043779f, 0.0151181333f, 0.0147316325f, 0.0143448934f, 0.0139579279f, 0.013570752f, 0.0131833795f, 0.0127958264f,
+    0.0124081066f, 0.012020234f, 0.0116322236f, 0.0112440912f, 0.0108558498f, 0.0104675144f, 0.0100790998f, 0.00969062094f,
+    0.00930209178f, 0.00891352631f, 0.00852494128f, 0.0081363488f, 0.00774776423f, 0.00735920295f, 0.00697067799f, 0.00658220472f,
+    0.00619379757f, 0.00580547098f, 0.00541723892f, 0.00502911629f, 0.00464111753f, 0.0042532566f, 0.00386554841f, 0.00347800693f,
+    0.00309064658f, 0.00270348182f, 0.0023165266f, 0.0019297956f, 0.0015433029f, 0.00115706283f, 0.000771089457f, 0.000385397143f,
+    3.84448138e-17f, -0.000385087798f, -0.000769852137f, -0.00115427887f, -0.00153835397f, -0.0019220633f, -0.00230539287f, -0.0026883285f,
+    -0.00307085668f, -0.00345296273f, -0.00383463339f, -0.00421585422f, -0.00459661195f, -0.00497689191f, -0.00535668107f, -0.00573596545f,
+    -0.00611473061f, -0.00649296399f, -0.00687065069f, -0.00724777766f, -0.0076243314f, -0.00800029747f, -0.00837566331f, -0.00875041541f,
+    -0.00912453979f, -0.0094980225f, -0.00987085048f, -0.0102430107f, -0.0106144892f, -0.0109852739f, -0.0113553498f, -0.0117247049f,
+    -0.0120933251f, -0.0124611976f, -0.0128283091f, -0.0131946467f, -0.0135601973f, -0.0139249489f, -0.0142888865f, -0.0146519979f,
+    -0.0150142703f, -0.0153756915f, -0.0157362465f, -0.016095927f, -0.0164547153f, -0.0168126002f, -0.0171695706f, -0.0175256133f,
+    -0.0178807136f, -0.018234862f, -0.0185880456f, -0.0189402495f, -0.0192914624f, -0.0196416751f, -0.0199908707f, -0.0203390382f,
+    -0.0206861664f, -0.021032244f, -0.021377258f, -0.0217211936f, -0.0220640432f, -0.022405792f, -0.0227464307f, -0.0230859444f,
+    -0.0234243236f, -0.0237615537f, -0.024097627f, -0.0244325288f, -0.0247662477f, -0.0250987727f, -0.0254300945f, -0.025760198f,
+    -0.0260890741f, -0.0264167115f, -0.0267430972f, -0.0270682219f, -0.0273920726f, -0.0277146399f, -0.0280359127f, -0.0283558778f,
+    -0.0286745261f, -0.0289918464f, -0.0293078292f, -0.0296224616f, -0.0299357343f, -0.0302476343f, -0.030558154f, -0.0308672823f,
+    -0.031175008f, -0.0314813219f, -0.0317862108f, -0.0320896655f, -0.0323916748f, -0.032692235f, -0.0329913273f, -0.0332889482f,
+    -0.0335850827f, -0.0338797234f, -0.0341728628f, -0.0344644859f, -0.0347545892f, -0.0350431539f, -0.0353301801f, -0.0356156528f,
+    -0.0358995646f, -0.0361819044f, -0.0364626646f, -0.0367418341f, -0.0370194055f, -0.0372953713f, -0.0375697166f, -0.0378424376f,
+    -0.0381135233f, -0.0383829661f, -0.0386507548f, -0.0389168821f, -0.0391813405f, -0.0394441187f, -0.0397052094f, -0.0399646051f,
+    -0.0402222984f, -0.040478278f, -0.0407325365f, -0.0409850664f, -0.0412358604f, -0.0414849073f, -0.0417322032f, -0.0419777371f,
+    -0.0422215015f, -0.0424634926f, -0.0427036956f, -0.0429421104f, -0.043178726f, -0.043413531f, -0.0436465256f, -0.0438776985f,
+    -0.0441070423f, -0.0443345495f, -0.0445602126f, -0.0447840281f, -0.0450059846f, -0.0452260785f, -0.0454443023f, -0.0456606485f,
+    -0.0458751097f, -0.0460876822f, -0.0462983549f, -0.0465071239f, -0.0467139855f, -0.0469189323f, -0.0471219532f, -0.0473230481f,
+    -0.0475222059f, -0.0477194227f, -0.047914695f, -0.0481080152f, -0.0482993796f, -0.0484887771f, -0.0486762077f, -0.0488616601f,
+    -0.0490451343f, -0.049226623f, -0.0494061224f, -0.0495836213f, -0.0497591235f, -0.0499326177f, -0.0501041003f, -0.0502735674f,
+    -0.0504410155f, -0.050606437f, -0.0507698245f, -0.0509311818f, -0.0510904975f, -0.0512477718f, -0.0514029935f, -0.0515561663f,
+    -0.0517072827f, -0.051856339f, -0.0520033278f, -0.052148249f, -0.052291099f, -0.052431874f, -0.0525705665f, -0.0527071767f,
+    -0.0528416969f, -0.052974131f, -0.0531044677f, -0.0532327108f, -0.0533588491f, -0.0534828864f, -0.0536048189f, -0.0537246391f,
+    -0.0538423471f, -0.0539579391f, -0.0540714152f, -0.0541827679f, -0.0542919971f, -0.0543991029f, -0.0545040816f, -0.0546069257f,
+    -0.0547076389f, -0.0548062176f, -0.0549026616f, -0.0549969636f, -0.0550891235f, -0.0551791415f, -0.0552670173f, -0.0553527437f,
+    -0.0554363243f, -0.0555177554f, -0.0555970334f, -0.0556741618f, -0.0557491332f, -0.0558219552f, -0.0558926165f, -0.0559611246f,
+    -0.056027472f, -0.0560916625f, -0.0561536923f, -0.0562135614f, -0.0562712736f, -0.0563268214f, -0.0563802049f, -0.0564314313f,
+    -0.0564804897f, -0.0565273911f, -0.0565721244f, -0.056614697f, -0.0566551089f, -0.0566933528f, -0.0567294396f, -0.0567633584f,
+    -0.0567951202f, -0.0568247177f, -0.0568521544f, -0.0568774305f, -0.056900546f, -0.0569215007f, -0.0569402985f, -0.0569569394f,
+    -0.0569714233f, -0.0569837503f, -0.0569939241f, -0.0570019446f, -0.057007812f, -0.0570115298f, -0.0570130982f, -0.0570125207f,
+    -0.0570097975f, -0.0570049249f, -0.0569979139f, -0.0569887608f, -0.0569774695f, -0.0569640435f, -0.0569484793f, -0.0569307841f,
+    -0.0569109581f, -0.056889005f, -0.0568649247f, -0.056838721f, -0.0568103977f, -0.0567799583f, -0.0567473993f, -0.0567127317f,
+    -0.0566759519f, -0.0566370636f, -0.0565960743f, -0.0565529838f, -0.056507796f, -0.0564605109f, -0.0564111397f, -0.0563596785f,
+    -0.0563061312f, -0.0562505051f, -0.0561928004f, -0.0561330244f, -0.0560711771f, -0.0560072623f, -0.0559412874f, -0.0558732562f,
+    -0.0558031686f, -0.055731032f, -0.0556568466f, -0.0555806234f, -0.0555023625f, -0.0554220676f, -0.0553397462f, -0.0552554019f,
+    -0.0551690347f, -0.055080656f, -0.0549902692f, -0.0548978746f, -0.0548034795f, -0.054707095f, -0.0546087138f, -0.0545083545f,
+    -0.0544060096f, -0.054301694f, -0.0541954115f, -0.054087162f, -0.0539769568f, -0.0538647957f, -0.0537506901f, -0.0536346436f,
+    -0.0535166599f, -0.0533967502f, -0.0532749146f, -0.0531511605f, -0.0530254953f, -0.0528979264f, -0.052768454f, -0.052637089f,
+    -0.0525038391f, -0.052368708f, -0.052231703f, -0.0520928279f, -0.0519520938f, -0.0518095046f, -0.0516650677f, -0.0515187904f,
+    -0.0513706766f, -0.0512207337f, -0.0510689728f, -0.0509153977f, -0.0507600158f, -0.0506028347f, -0.0504438616f, -0.0502831042f,
+    -0.050120566f, -0.0499562584f, -0.0497901887f, -0.0496223606f, -0.0494527891f, -0.0492814742f, -0.049108427f, -0.048933655f,
+    -0.0487571657f, -0.0485789664f, -0.0483990647f, -0.0482174717f, -0.0480341911f, -0.0478492342f, -0.0476626083f, -0.047474321f,
+    -0.0472843796f, -0.0470927916f, -0.046899572f, -0.0467047207f, -0.0465082489f, -0.0463101678f, -0.0461104847f, -0.0459092073f,
+    -0.0457063466f, -0.0455019064f, -0.0452959016f, -0.0450883359f, -0.0448792204f, -0.0446685627f, -0.0444563739f, -0.0442426614f,
+    -0.0440274365f, -0.0438107029f, -0.0435924754f, -0.0433727652f, -0.0431515723f, -0.0429289155f, -0.0427047983f, -0.042479232f,
+    -0.0422522277f, -0.0420237929f, -0.041793935f, -0.041562669f, -0.0413299985f, -0.0410959385f, -0.0408605002f, -0.0406236835f,
+    -0.040385507f, -0.0401459783f, -0.0399051085f, -0.039662905f, -0.0394193791f, -0.0391745418f, -0.0389284007f, -0.0386809669f,
+    -0.0384322554f, -0.0381822661f, -0.0379310176f, -0.0376785211f, -0.0374247804f, -0.0371698067f, -0.0369136184f, -0.0366562158f,
+    -0.0363976173f, -0.0361378267f, -0.035876859f, -0.0356147252f, -0.0353514329f, -0.0350869969f, -0.0348214246f, -0.0345547237f,
+    -0.0342869125f, -0.0340179987f, -0.0337479897f, -0.0334769003f, -0.0332047418f, -0.0329315215f, -0.0326572508f, -0.0323819481f,
+    -0.0321056135f, -0.0318282656f, -0.0315499119f, -0.0312705673f, -0.0309902374f, -0.030708937f, -0.0304266773f, -0.0301434696f,
+    -0.0298593231f, -0.0295742508f, -0.029288264f, -0.0290013738f, -0.0287135914f, -0.028424928f, -0.0281353965f, -0.0278450064f,
+    -0.0275537707f, -0.0272616986f, -0.0269688051f, -0.0266750976f, -0.0263805911f, -0.0260852966f, -0.0257892236f, -0.025492385f,
+    -0.0251947939f, -0.0248964597f, -0.0245973952f, -0.0242976118f, -0.0239971224f, -0.0236959364f, -0.0233940687f, -0.0230915267f,
+    -0.0227883272f, -0.0224844776f, -0.0221799929f, -0.0218748823f, -0.0215691607f, -0.0212628376f, -0.0209559239f, -0.0206484348f,
+    -0.0203403812f, -0.0200317744f, -0.0197226256f, -0.0194129478f, -0.0191027522f, -0.0187920518f, -0.0184808578f, -0.0181691814f,
+    -0.0178570375f, -0.0175444353f, -0.0172313862f, -0.0169179067f, -0.0166040044f, -0.0162896924f, -0.0159749836f, -0.0156598892f,
+    -0.0153444223f, -0.0150285941f, -0.0147124175f, -0.0143959029f, -0.0140790641f, -0.0137619134f, -0.0134444609f, -0.0131267207f,
+    -0.0128087038f, -0.0124904215f, -0.0121718887f, -0.0118531147f, -0.0115341125f, -0.0112148952f, -0.010895473f, -0.0105758598f,
+    -0.0102560669f, -0.00993610639f, -0.00961599033f, -0.00929573085f, -0.00897534005f, -0.00865483005f, -0.00833421294f, -0.00801350083f,
+    -0.00769270584f, -0.0073718396f, -0.00705091469f, -0.00672994321f, -0.00640893728f, -0.00608790806f, -0.00576686859f, -0.00544583006f,
+    -0.0051248055f, -0.00480380608f, -0.00448284391f, -0.00416193111f, -0.00384108f, -0.00352030224f, -0.0031996097f, -0.00287901447f,
+    -0.00255852845f, -0.00223816349f, -0.0019179316f, -0.00159784465f, -0.00127791462f, -0.000958153221f, -0.000638572441f, -0.000319184095f,
+    -3.82101823e-17f, 0.000318968057f, 0.000637708232f, 0.000956208794f, 0.0012744579f, 0.00159244391f, 0.00191015494f, 0.00222757948f,
+    0.00254470576f, 0.00286152191f, 0.00317801652f, 0.00349417794f, 0.00380999455f, 0.00412545446f, 0.0044405465f, 0.00475525903f,
+    0.00506958039f, 0.00538349897f, 0.00569700357f, 0.00601008255f, 0.00632272474f, 0.00663491804f, 0.00694665173f, 0.00725791464f,
+    0.00756869465f, 0.0078789806f, 0.00818876177f, 0.00849802699f, 0.00880676415f, 0.00911496207f, 0.00942261051f, 0.00972969737f,
+    0.0100362124f, 0.0103421444f, 0.0106474813f, 0.0109522128f, 0.0112563279f, 0.0115598151f, 0.0118626645f, 0.0121648647f,
+    0.0124664046f, 0.012767273f, 0.0130674597f, 0.0133669535f, 0.0136657441f, 0.0139638204f, 0.0142611722f, 0.0145577891f,
+    0.0148536591f, 0.0151487719f, 0.0154431183f, 0.0157366861f, 0.0160294678f, 0.0163214486f, 0.016612621f, 0.0169029739f,
+    0.0171924978f, 0.0174811818f, 0.0177690145f, 0.0180559866f, 0.0183420889f, 0.0186273102f, 0.0189116392f, 0.0191950686f,
+    0.0194775872f, 0.0197591837f, 0.0200398508f, 0.0203195754f, 0.0205983501f, 0.0208761636f, 0.0211530086f, 0.0214288719f,
+    0.0217037462f, 0.0219776221f, 0.0222504884f, 0.0225223359f, 0.0227931552f, 0.0230629388f, 0.0233316738f, 0.0235993527f,
+    0.0238659661f, 0.0241315067f, 0.0243959613f, 0.0246593226f, 0.024921583f, 0.0251827296f, 0.0254427567f, 0.0257016551f,
+    0.0259594154f, 0.0262160264f, 0.0264714826f, 0.0267257728f, 0.0269788913f, 0.0272308253f, 0.027481569f, 0.0277311113f,
+    0.0279794466f, 0.0282265656f, 0.0284724589f, 0.0287171174f, 0.0289605353f, 0.0292027015f, 0.0294436105f, 0.0296832509f,
+    0.0299216174f, 0.0301587023f, 0.0303944945f, 0.0306289867f, 0.0308621731f, 0.0310940444f, 0.0313245952f, 0.0315538123f,
+    0.0317816921f, 0.032008227f, 0.0322334096f, 0.0324572287f, 0.0326796807f, 0.0329007544f, 0.0331204459f, 0.0333387479f,
+    0.0335556529f, 0.0337711498f, 0.0339852348f, 0.0341979042f, 0.034409143f, 0.0346189514f, 0.034827318f, 0.0350342356f,
+    0.035239704f, 0.0354437083f, 0.0356462449f, 0.0358473063f, 0.0360468887f, 0.0362449847f, 0.0364415869f, 0.0366366878f,
+    0.0368302837f, 0.0370223671f, 0.0372129306f, 0.0374019705f, 0.0375894792f, 0.0377754495f, 0.0379598774f, 0.0381427556f,
+    0.0383240804f, 0.0385038443f, 0.0386820436f, 0.038858667f, 0.0390337147f, 0.0392071791f, 0.0393790565f, 0.0395493396f,
+    0.0397180207f, 0.0398851f, 0.0400505662f, 0.0402144194f, 0.040376652f, 0.0405372605f, 0.0406962372f, 0.0408535823f,
+    0.0410092846f, 0.0411633439f, 0.041315753f, 0.0414665081f, 0.0416156054f, 0.0417630374f, 0.0419088043f, 0.0420528986f,
+    0.0421953164f, 0.0423360541f, 0.0424751081f, 0.0426124707f, 0.042748142f, 0.0428821146f, 0.0430143885f, 0.04314496f,
+    0.0432738177f, 0.0434009656f, 0.0435263999f, 0.043650113f, 0.0437721014f, 0.0438923687f, 0.0440109f, 0.0441277027f,
+    0.0442427658f, 0.0443560928f, 0.0444676727f, 0.0445775092f, 0.0446855985f, 0.0447919331f, 0.0448965132f, 0.0449993387f,
+    0.0451004021f, 0.0451997034f, 0.045297239f, 0.045393005f, 0.0454870053f, 0.0455792286f, 0.0456696786f, 0.0457583517f,
+    0.0458452441f, 0.0459303558f, 0.0460136831f, 0.046095226f, 0.046174977f, 0.0462529436f, 0.0463291183f, 0.0464034975f,
+    0.0464760847f, 0.0465468764f, 0.0466158688f, 0.0466830619f, 0.0467484556f, 0.0468120463f, 0.046873834f, 0.0469338186f,
+    0.0469919965f, 0.0470483713f, 0.0471029356f, 0.0471556932f, 0.047206644f, 0.0472557805f, 0.0473031104f, 0.047348626f,
+    0.0473923311f, 0.0474342257f, 0.0474743061f, 0.047512576f, 0.0475490317f, 0.0475836731f, 0.0476165004f, 0.0476475134f,
+    0.047676716f, 0.0477041043f, 0.0477296785f, 0.0477534384f, 0.0477753878f, 0.047795523f, 0.0478138439f, 0.0478303544f,
+    0.0478450544f, 0.0478579439f, 0.0478690229f, 0.0478782952f, 0.0478857569f, 0.0478914082f, 0.0478952564f, 0.0478972979f,
+    0.0478975363f, 0.047895968f, 0.0478926003f, 0.0478874296f, 0.0478804596f, 0.0478716902f, 0.0478611253f, 0.0478487648f,
+    0.0478346124f, 0.0478186645f, 0.0478009284f, 0.0477814041f, 0.0477600917f, 0.0477369949f, 0.0477121137f, 0.0476854518f,
+    0.0476570129f, 0.0476268008f, 0.047594808f, 0.0475610495f, 0.0475255176f, 0.04748822f, 0.0474491566f, 0.0474083312f,
+    0.0473657474f, 0.0473214053f, 0.0472753122f, 0.0472274646f, 0.0471778698f, 0.0471265316f, 0.0470734499f, 0.0470186286f,
+    0.0469620712f, 0.0469037816f, 0.0468437634f, 0.0467820168f, 0.046718549f, 0.0466533639f, 0.0465864576f, 0.0465178452f,
+    0.0464475192f, 0.0463754907f, 0.0463017598f, 0.0462263338f, 0.0461492129f, 0.0460704006f, 0.0459899046f, 0.0459077284f,
+    0.0458238721f, 0.0457383431f, 0.0456511453f, 0.0455622859f, 0.0454717651f, 0.0453795865f, 0.0452857576f, 0.0451902822f,
+    0.0450931638f, 0.0449944101f, 0.044894021f, 0.0447920077f, 0.0446883664f, 0.0445831083f, 0.0444762371f, 0.0443677604f,
+    0.0442576781f, 0.0441459976f, 0.0440327227f, 0.0439178646f, 0.0438014194f, 0.0436833985f, 0.0435638092f, 0.0434426479f,
+    0.0433199294f, 0.0431956574f, 0.043069832f, 0.0429424644f, 0.0428135581f, 0.0426831208f, 0.0425511561f, 0.0424176715f,
+    0.0422826707f, 0.0421461612f, 0.0420081504f, 0.041868642f, 0.0417276435f, 0.0415851623f, 0.0414412022f, 0.0412957706f,
+    0.0411488712f, 0.0410005152f, 0.0408507101f, 0.0406994559f, 0.04054676f, 0.0403926335f, 0.0402370803f, 0.0400801115f,
+    0.039921727f, 0.0397619344f, 0.0396007448f, 0.0394381657f, 0.0392742008f, 0.0391088538f, 0.0389421396f, 0.0387740619f,
+    0.0386046246f, 0.0384338386f, 0.0382617116f, 0.0380882472f, 0.0379134566f, 0.0377373435f, 0.0375599191f, 0.0373811908f,
+    0.0372011624f, 0.0370198451f, 0.0368372425f, 0.0366533659f, 0.0364682227f, 0.0362818167f, 0.0360941589f, 0.0359052606f,
+    0.0357151218f, 0.0355237573f, 0.035331171f, 0.0351373702f, 0.0349423662f, 0.0347461663f, 0.0345487744f, 0.0343502052f,
+    0.0341504626f, 0.0339495577f, 0.0337474942f, 0.0335442834f, 0.0333399363f, 0.0331344567f, 0.0329278521f, 0.0327201374f,
+    0.0325113125f, 0.0323013961f, 0.0320903845f, 0.0318782963f, 0.0316651389f, 0.0314509161f, 0.031235639f, 0.0310193188f,
+    0.0308019593f, 0.0305835735f, 0.0303641688f, 0.0301437527f, 0.0299223363f, 0.0296999272f, 0.0294765346f, 0.0292521659f,
+    0.0290268343f, 0.0288005453f, 0.0285733081f, 0.0283451322f, 0.0281160288f, 0.0278860051f, 0.0276550688f, 0.0274232328f,
+    0.0271905027f, 0.0269568916f, 0.0267224051f, 0.0264870543f, 0.0262508485f, 0.0260137971f, 0.0257759094f, 0.0255371928f,
+    0.0252976604f, 0.0250573196f, 0.0248161815f, 0.0245742518f, 0.0243315455f, 0.0240880679f, 0.0238438286f, 0.0235988405f,
+    0.023353111f, 0.0231066495f, 0.0228594653f, 0.0226115715f, 0.0223629735f, 0.0221136827f, 0.0218637101f, 0.0216130652f,
+    0.0213617552f, 0.0211097933f, 0.020857187f, 0.0206039473f, 0.0203500837f, 0.0200956073f, 0.0198405255f, 0.0195848495f,
+    0.0193285886f, 0.0190717559f, 0.018814357f, 0.0185564049f, 0.0182979088f, 0.0180388782f, 0.0177793223f, 0.0175192524f,
+    0.0172586795f, 0.016997613f, 0.0167360622f, 0.0164740365f, 0.0162115488f, 0.0159486067f, 0.0156852212f, 0.0154214017f,
+    0.0151571594f, 0.0148925036f, 0.0146274464f, 0.0143619953f, 0.0140961623f, 0.0138299568f, 0.0135633899f, 0.01329647f,
+    0.0130292093f, 0.0127616171f, 0.0124937035f, 0.0122254798f, 0.0119569544f, 0.0116881393f, 0.0114190429f, 0.0111496774f,
+    0.0108800521f, 0.0106101772f, 0.0103400638f, 0.0100697214f, 0.00979916006f, 0.00952839013f, 0.00925742276f, 0.00898626726f,
+    0.00871493481f, 0.00844343472f, 0.00817177724f, 0.00789997447f, 0.00762803433f, 0.007355968f, 0.00708378665f, 0.00681149913f,
+    0.00653911661f, 0.00626664888f, 0.00599410711f, 0.00572150014f, 0.00544883963f, 0.00517613487f, 0.00490339613f, 0.00463063456f,
+    0.00435785949f, 0.00408508163f, 0.00381231075f, 0.00353955757f, 0.00326683233f, 0.0029941448f, 0.00272150547f, 0.00244892458f,
+    0.00217641215f, 0.00190397853f, 0.00163163373f, 0.001359388f, 0.00108725147f, 0.000815234263f, 0.000543346512f, 0.000271598401f,
+    3.7934215e-17f, -0.000271438621f, -0.000542707334f, -0.000813796069f, -0.00108469476f, -0.00135539344f, -0.001625882f, -0.00189615041f,
+    -0.00216618879f, -0.00243598688f, -0.00270553492f, -0.00297482288f, -0.00324384077f, -0.00351257878f, -0.00378102693f, -0.00404917542f,
+    -0.00431701401f, -0.00458453316f, -0.00485172309f, -0.00511857402f, -0.0053850757f, -0.00565121835f, -0.00591699267f, -0.00618238887f,
+    -0.00644739671f, -0.00671200687f, -0.00697621005f, -0.00723999552f, -0.00750335446f, -0.00776627706f, -0.0080287531f, -0.00829077419f,
+    -0.00855233055f, -0.008813411f, -0.00907400809f, -0.00933411159f, -0.00959371123f, -0.00985279866f, -0.0101113645f, -0.0103693986f,
+    -0.0106268916f, -0.0108838351f, -0.0111402189f, -0.0113960337f, -0.0116512701f, -0.0119059198f, -0.0121599734f, -0.0124134207f,
+    -0.0126662534f, -0.012918463f, -0.0131700383f, -0.013420972f, -0.0136712547f, -0.0139208781f, -0.0141698308f, -0.0144181065f,
+    -0.0146656949f, -0.0149125876f, -0.0151587753f, -0.0154042495f, -0.015649002f, -0.0158930235f, -0.0161363035f, -0.0163788367f,
+    -0.0166206118f, -0.0168616213f, -0.0171018559f, -0.0173413083f, -0.017579969f, -0.0178178307f, -0.0180548821f, -0.0182911176f,
+    -0.018526528f, -0.018761104f, -0.018994838f, -0.0192277227f, -0.0194597486f, -0.0196909066f, -0.019921191f, -0.0201505926f,
+    -0.0203791037f, -0.0206067134f, -0.0208334178f, -0.0210592076f, -0.0212840717f, -0.0215080064f, -0.0217310023f, -0.0219530519f,
+    -0.0221741479f, -0.022394279f, -0.0226134416f, -0.0228316281f, -0.0230488274f, -0.023265034f, -0.0234802421f, -0.0236944407f,
+    -0.0239076242f, -0.0241197851f, -0.0243309159f, -0.0245410092f, -0.0247500595f, -0.0249580555f, -0.0251649935f, -0.0253708661f,
+    -0.0255756639f, -0.0257793814f, -0.025982013f, -0.0261835493f, -0.026383983f, -0.0265833102f, -0.0267815217f, -0.0269786101f,
+    -0.0271745715f, -0.0273693968f, -0.0275630802f, -0.0277556144f, -0.0279469956f, -0.0281372126f, -0.0283262618f, -0.0285141375f,
+    -0.0287008323f, -0.0288863387f, -0.029070653f, -0.0292537659f, -0.0294356737f, -0.0296163689f, -0.029795846f, -0.0299740992f,
+    -0.0301511213f, -0.0303269085f, -0.0305014513f, -0.0306747481f, -0.0308467913f, -0.0310175736f, -0.0311870929f, -0.03135534f,
+    -0.0315223113f, -0.031688001f, -0.0318524018f, -0.0320155099f, -0.0321773216f, -0.0323378295f, -0.032497026f, -0.0326549113f,
+    -0.0328114741f, -0.0329667144f, -0.0331206284f, -0.0332732052f, -0.0334244408f, -0.0335743353f, -0.0337228775f, -0.0338700674f,
+    -0.0340158977f, -0.0341603644f, -0.034303464f, -0.0344451927f, -0.034585543f, -0.0347245112f, -0.0348620899f, -0.0349982828f,
+    -0.0351330787f, -0.0352664776f, -0.0353984684f, -0.0355290584f, -0.0356582329f, -0.0357859917f, -0.0359123312f, -0.0360372476f,
+    -0.0361607336f, -0.0362827927f, -0.0364034139f, -0.0365225971f, -0.0366403386f, -0.0367566347f, -0.036871478f, -0.0369848721f,
+    -0.0370968059f, -0.0372072831f, -0.0373162962f, -0.0374238417f, -0.0375299193f, -0.0376345217f, -0.0377376527f, -0.0378393009f,
+    -0.0379394665f, -0.0380381495f, -0.0381353423f, -0.0382310487f, -0.0383252576f, -0.0384179726f, -0.0385091901f, -0.0385989025f,
+    -0.0386871137f, -0.0387738198f, -0.0388590172f, -0.0389427021f, -0.0390248746f, -0.0391055308f, -0.0391846709f, -0.0392622873f,
+    -0.0393383838f, -0.0394129604f, -0.0394860059f, -0.0395575278f, -0.0396275185f, -0.0396959782f, -0.039762903f, -0.0398282968f,
+    -0.039892152f, -0.0399544686f, -0.0400152467f, -0.0400744863f, -0.0401321799f, -0.0401883349f, -0.0402429402f, -0.0402960032f,
+    -0.0403475203f, -0.0403974876f, -0.0404459052f, -0.0404927731f, -0.0405380912f, -0.0405818559f, -0.0406240709f, -0.0406647325f,
+    -0.0407038368f, -0.0407413915f, -0.040777389f, -0.0408118293f, -0.0408447161f, -0.0408760458f, -0.0409058221f, -0.0409340374f,
+    -0.0409606956f, -0.0409858003f, -0.0410093442f, -0.0410313345f, -0.041051764f, -0.0410706401f, -0.0410879552f, -0.0411037169f,
+    -0.0411179215f, -0.0411305688f, -0.0411416627f, -0.0411511995f, -0.0411591828f, -0.0411656089f, -0.0411704853f, -0.0411738083f,
+    -0.0411755778f, -0.0411757976f, -0.0411744639f, -0.0411715843f, -0.0411671512f, -0.0411611758f, -0.0411536507f, -0.0411445796f,
+    -0.0411339663f, -0.0411218107f, -0.0411081128f, -0.0410928726f, -0.0410760976f, -0.0410577841f, -0.041037932f, -0.0410165489f,
+    -0.0409936309f, -0.0409691818f, -0.0409432054f, -0.0409157015f, -0.0408866704f, -0.0408561192f, -0.0408240445f, -0.0407904498f,
+    -0.040755339f, -0.0407187119f, -0.0406805724f, -0.0406409241f, -0.0405997634f, -0.0405571014f, -0.0405129306f, -0.0404672623f,
+    -0.0404200964f, -0.0403714329f, -0.0403212756f, -0.0402696282f, -0.0402164906f, -0.0401618704f, -0.0401057675f, -0.0400481857f,
+    -0.0399891287f, -0.0399285965f, -0.0398665965f, -0.0398031287f, -0.0397381969f, -0.039671801f, -0.0396039523f, -0.039534647f,
+    -0.0394638926f, -0.0393916927f, -0.0393180475f, -0.0392429605f, -0.0391664393f, -0.0390884839f, -0.0390091017f, -0.0389282927f,
+    -0.0388460606f, -0.038762413f, -0.0386773534f, -0.038590882f, -0.0385030024f, -0.0384137258f, -0.0383230485f, -0.038230978f,
+    -0.0381375179f, -0.0380426757f, -0.0379464515f, -0.0378488488f, -0.0377498753f, -0.0376495384f, -0.0375478342f, -0.0374447741f,
+    -0.0373403579f, -0.0372345969f, -0.0371274874f, -0.0370190404f, -0.0369092561f, -0.0367981456f, -0.0366857089f, -0.0365719497f,
+    -0.0364568792f, -0.0363404974f, -0.0362228081f, -0.0361038223f, -0.0359835401f, -0.035861969f, -0.0357391164f, -0.0356149822f,
+    -0.0354895741f, -0.0353628956f, -0.0352349579f, -0.0351057649f, -0.0349753164f, -0.0348436236f, -0.0347106904f, -0.0345765203f,
+    -0.0344411209f, -0.0343045034f, -0.0341666639f, -0.0340276137f, -0.0338873565f, -0.0337458998f, -0.033603251f, -0.0334594138f,
+    -0.033314392f, -0.0331681967f, -0.0330208316f, -0.0328723043f, -0.0327226184f, -0.0325717814f, -0.032419797f, -0.0322666764f,
+    -0.0321124233f, -0.0319570452f, -0.0318005495f, -0.0316429362f, -0.0314842202f, -0.0313244052f, -0.031163495f, -0.0310014989f,
+    -0.0308384225f, -0.0306742731f, -0.0305090584f, -0.0303427819f, -0.0301754549f, -0.0300070811f, -0.0298376679f, -0.0296672229f,
+    -0.0294957515f, -0.0293232631f, -0.0291497633f, -0.0289752595f, -0.0287997592f, -0.028623268f, -0.0284457933f, -0.0282673445f,
+    -0.028087927f, -0.0279075485f, -0.0277262162f, -0.0275439359f, -0.0273607187f, -0.0271765683f, -0.026991494f, -0.0268055033f,
+    -0.0266186018f, -0.0264308006f, -0.0262421034f, -0.0260525197f, -0.0258620568f, -0.0256707221f, -0.0254785232f, -0.0252854675f,
+    -0.0250915643f, -0.024896821f, -0.0247012433f, -0.0245048404f, -0.0243076198f, -0.0241095889f, -0.0239107572f, -0.0237111319f,
+    -0.0235107206f, -0.0233095307f, -0.0231075715f, -0.0229048505f, -0.0227013733f, -0.0224971529f, -0.022292193f, -0.022086503f,
+    -0.0218800921f, -0.021672966f, -0.0214651357f, -0.0212566089f, -0.021047391f, -0.0208374932f, -0.0206269231f, -0.0204156879f,
+    -0.0202037971f, -0.01999126f, -0.0197780803f, -0.0195642728f, -0.0193498395f, -0.0191347934f, -0.018919142f, -0.0187028926f,
+    -0.0184860528f, -0.0182686336f, -0.0180506427f, -0.0178320874f, -0.0176129751f, -0.0173933189f, -0.0171731226f, -0.0169523973f,
+    -0.0167311523f, -0.0165093932f, -0.0162871312f, -0.0160643738f, -0.0158411302f, -0.0156174079f, -0.0153932162f, -0.0151685635f,
+    -0.01494346f, -0.0147179123f, -0.0144919306f, -0.0142655224f, -0.0140386978f, -0.0138114644f, -0.0135838315f, -0.0133558074f,
+    -0.0131274015f, -0.0128986211f, -0.0126694776f, -0.0124399774f, -0.0122101307f, -0.0119799459f, -0.0117494315f, -0.0115185967f,
+    -0.0112874499f, -0.0110560004f, -0.0108242575f, -0.0105922287f, -0.0103599234f, -0.0101273516f, -0.00989452098f, -0.00966144074f,
+    -0.00942811929f, -0.00919456594f, -0.00896079f, -0.00872679986f, -0.0084926039f, -0.00825821236f, -0.00802363269f, -0.00778887514f,
+    -0.00755394809f, -0.00731885992f, -0.00708361994f, -0.00684823748f, -0.00661272043f, -0.00637707906f, -0.00614132127f, -0.00590545591f,
+    -0.00566949276f, -0.00543343974f, -0.00519730663f, -0.00496110134f, -0.00472483411f, -0.00448851241f, -0.00425214646f, -0.0040157442f,
+    -0.00377931469f, -0.00354286726f, -0.00330641028f, -0.00306995306f, -0.00283350423f, -0.00259707263f, -0.00236066733f, -0.00212429697f,
+    -0.0018879706f, -0.00165169698f, -0.00141548482f, -0.00117934321f, -0.000943280756f, -0.000707306433f, -0.000471429026f, -0.000235657266f,
+    -3.76175802e-17f, 0.000235533982f, 0.00047093592f, 0.000706197054f, 0.000941308565f, 0.00117626181f, 0.00141104788f, 0.00164565828f,
+    0.00188008405f, 0.00211431668f, 0.00234834733f, 0.00258216751f, 0.00281576836f, 0.00304914149f, 0.00328227784f, 0.00351516902f,
+    0.00374780642f, 0.00398018165f, 0.00421228539f, 0.00444410974f, 0.00467564631f, 0.00490688579f, 0.00513782026f, 0.00536844134f,
+    0.00559873972f, 0.00582870794f, 0.0060583367f, 0.00628761761f, 0.00651654322f, 0.00674510375f, 0.00697329175f, 0.00720109884f,
+    0.0074285157f, 0.00765553536f, 0.00788214896f, 0.00810834765f, 0.00833412353f, 0.0085594682f, 0.00878437422f, 0.00900883228f,
+    0.00923283491f, 0.00945637282f, 0.00967943948f, 0.0099020265f, 0.0101241246f, 0.0103457272f, 0.0105668241f, 0.0107874097f,
+    0.0110074747f, 0.0112270107f, 0.0114460113f, 0.0116644669f, 0.0118823703f, 0.0120997131f, 0.0123164887f, 0.0125326877f,
+    0.0127483029f, 0.0129633276f, 0.0131777525f, 0.0133915702f, 0.0136047732f, 0.0138173541f, 0.0140293045f, 0.0142406179f,
+    0.0144512849f, 0.0146613f, 0.0148706548f, 0.0150793409f, 0.0152873518f, 0.01549468f, 0.0157013182f, 0.0159072578f,
+    0.0161124934f, 0.0163170155f, 0.0165208187f, 0.0167238936f, 0.0169262365f, 0.0171278361f, 0.017328687f, 0.0175287835f,
+    0.0177281145f, 0.0179266781f, 0.018124463f, 0.0183214638f, 0.0185176749f, 0.0187130868f, 0.0189076923f, 0.0191014875f,
+    0.0192944631f, 0.0194866136f, 0.0196779333f, 0.0198684111f, 0.0200580452f, 0.0202468261f, 0.0204347465f, 0.0206218027f,
+    0.0208079852f, 0.0209932886f, 0.0211777072f, 0.0213612355f, 0.0215438623f, 0.0217255875f, 0.0219064001f, 0.0220862944f,
+    0.0222652666f, 0.0224433076f, 0.0226204116f, 0.022796575f, 0.0229717903f, 0.0231460501f, 0.0233193487f, 0.0234916806f,
+    0.0236630403f, 0.023833422f, 0.0240028184f, 0.0241712257f, 0.0243386347f, 0.0245050434f, 0.0246704444f, 0.0248348322f,
+    0.0249982011f, 0.0251605436f, 0.025321858f, 0.0254821349f, 0.0256413724f, 0.0257995632f, 0.0259566996f, 0.02611278f,
+    0.0262677986f, 0.0264217481f, 0.0265746247f, 0.0267264228f, 0.0268771369f, 0.0270267632f, 0.0271752942f, 0.0273227282f,
+    0.0274690576f, 0.0276142769f, 0.0277583841f, 0.0279013719f, 0.0280432384f, 0.0281839743f, 0.0283235796f, 0.0284620468f,
+    0.0285993721f, 0.0287355501f, 0.028870577f, 0.029004449f, 0.0291371606f, 0.0292687081f, 0.0293990877f, 0.0295282919f,
+    0.0296563208f, 0.0297831669f, 0.0299088284f, 0.0300332978f, 0.0301565751f, 0.0302786548f, 0.0303995311f, 0.0305192024f,
+    0.0306376647f, 0.0307549126f, 0.0308709443f, 0.0309857521f, 0.0310993381f, 0.0312116947f, 0.0313228182f, 0.0314327069f,
+    0.031541355f, 0.0316487625f, 0.0317549258f, 0.0318598375f, 0.0319634974f, 0.0320658982f, 0.0321670435f, 0.032266926f,
+    0.0323655419f, 0.0324628912f, 0.0325589664f, 0.0326537713f, 0.0327472948f, 0.0328395404f, 0.0329305008f, 0.0330201797f,
+    0.033108566f, 0.0331956632f, 0.0332814641f, 0.0333659723f, 0.0334491804f, 0.0335310847f, 0.0336116888f, 0.0336909853f,
+    0.0337689705f, 0.0338456482f, 0.0339210145f, 0.0339950621f, 0.0340677947f, 0.0341392048f, 0.0342092961f, 0.034278065f,
+    0.0343455076f, 0.0344116241f, 0.0344764106f, 0.0345398635f, 0.0346019901f, 0.0346627794f, 0.0347222313f, 0.0347803496f,
+    0.0348371267f, 0.0348925628f, 0.0349466614f, 0.0349994116f, 0.0350508206f, 0.0351008847f, 0.0351496004f, 0.0351969711f,
+    0.0352429897f, 0.0352876596f, 0.0353309773f, 0.0353729427f, 0.0354135595f, 0.0354528166f, 0.0354907252f, 0.035527274f,
+    0.0355624668f, 0.0355963036f, 0.0356287844f, 0.0356599092f, 0.0356896706f, 0.0357180759f, 0.0357451253f, 0.0357708111f,
+    0.0357951373f, 0.0358181037f, 0.0358397141f, 0.0358599611f, 0.0358788446f, 0.0358963721f, 0.0359125398f, 0.0359273441f,
+    0.0359407887f, 0.0359528735f, 0.0359635986f, 0.0359729677f, 0.0359809734f, 0.035987623f, 0.0359929129f, 0.0359968431f,
+    0.0359994173f, 0.0360006355f, 0.0360004976f, 0.0359990038f, 0.035996154f, 0.0359919518f, 0.0359863974f, 0.0359794907f,
+    0.0359712318f, 0.0359616205f, 0.0359506607f, 0.0359383561f, 0.0359246992f, 0.0359097011f, 0.0358933546f, 0.0358756669f,
+    0.0358566381f, 0.0358362682f, 0.0358145572f, 0.0357915089f, 0.0357671268f, 0.0357414074f, 0.0357143544f, 0.0356859714f,
+    0.0356562585f, 0.0356252193f, 0.0355928503f, 0.0355591588f, 0.0355241448f, 0.035487812f, 0.0354501605f, 0.035411194f,
+    0.0353709124f, 0.0353293158f, 0.0352864154f, 0.0352422036f, 0.035196688f, 0.0351498686f, 0.035101749f, 0.0350523293f,
+    0.0350016169f, 0.0349496119f, 0.0348963141f, 0.0348417312f, 0.034785863f, 0.0347287133f, 0.0346702822f, 0.0346105732f,
+    0.0345495939f, 0.0344873406f, 0.0344238244f, 0.0343590379f, 0.0342929922f, 0.0342256874f, 0.0341571271f, 0.0340873115f,
+    0.0340162516f, 0.0339439437f, 0.0338703915f, 0.0337956026f, 0.0337195769f, 0.0336423181f, 0.0335638337f, 0.0334841199f,
+    0.033403188f, 0.0333210379f, 0.0332376696f, 0.0331530944f, 0.0330673121f, 0.0329803266f, 0.0328921415f, 0.0328027606f,
+    0.0327121876f, 0.03262043f, 0.0325274877f, 0.0324333645f, 0.0323380679f, 0.0322416015f, 0.0321439691f, 0.0320451707f,
+    0.0319452174f, 0.0318441093f, 0.0317418501f, 0.0316384472f, 0.0315339006f, 0.0314282216f, 0.0313214101f, 0.0312134698f,
+    0.0311044082f, 0.030994229f, 0.0308829378f, 0.0307705365f, 0.0306570306f, 0.0305424277f, 0.0304267295f, 0.0303099435f,
+    0.0301920716f, 0.0300731212f, 0.0299530979f, 0.0298320036f, 0.0297098458f, 0.0295866281f, 0.029462358f, 0.0293370374f,
+    0.0292106736f, 0.0290832724f, 0.0289548375f, 0.0288253762f, 0.0286948904f, 0.0285633896f, 0.0284308773f, 0.0282973573f,
+    0.0281628389f, 0.028027324f, 0.0278908201f, 0.0277533326f, 0.0276148673f, 0.0274754297f, 0.0273350254f, 0.0271936581f,
+    0.0270513389f, 0.026908068f, 0.0267638545f, 0.0266187023f, 0.0264726188f, 0.0263256095f, 0.0261776801f, 0.026028838f,
+    0.0258790869f, 0.0257284343f, 0.0255768858f, 0.0254244488f, 0.025271127f, 0.0251169298f, 0.0249618609f, 0.0248059258f,
+    0.0246491339f, 0.0244914889f, 0.0243330002f, 0.0241736695f, 0.0240135062f, 0.0238525178f, 0.023690708f, 0.0235280842f,
+    0.0233646538f, 0.0232004225f, 0.0230353978f, 0.0228695851f, 0.0227029901f, 0.0225356221f, 0.0223674867f, 0.0221985895f,
+    0.0220289398f, 0.0218585413f, 0.0216874015f, 0.0215155277f, 0.0213429276f, 0.0211696066f, 0.0209955741f, 0.0208208319f,
+    0.0206453931f, 0.0204692595f, 0.0202924404f, 0.0201149434f, 0.0199367739f, 0.0197579395f, 0.0195784476f, 0.0193983056f,
+    0.0192175191f, 0.0190360956f, 0.0188540444f, 0.0186713692f, 0.0184880793f, 0.0183041822f, 0.0181196854f, 0.0179345924f,
+    0.0177489147f, 0.0175626576f, 0.0173758306f, 0.0171884373f, 0.0170004871f, 0.0168119874f, 0.0166229438f, 0.0164333675f,
+    0.0162432622f, 0.0160526372f, 0.0158614982f, 0.0156698544f, 0.0154777123f, 0.0152850803f, 0.015091964f, 0.0148983737f,
+    0.0147043141f, 0.0145097943f, 0.014314821f, 0.0141194025f, 0.0139235463f, 0.0137272598f, 0.0135305496f, 0.0133334249f,
+    0.0131358923f, 0.0129379602f, 0.0127396351f, 0.0125409253f, 0.0123418383f, 0.0121423826f, 0.0119425645f, 0.0117423926f,
+    0.0115418741f, 0.0113410167f, 0.0111398287f, 0.0109383175f, 0.0107364897f, 0.0105343554f, 0.0103319203f, 0.0101291928f,
+    0.00992618129f, 0.00972289219f, 0.00951933488f, 0.00931551587f, 0.00911144353f, 0.00890712533f, 0.00870256871f, 0.00849778298f,
+    0.00829277374f, 0.00808755122f, 0.00788212102f, 0.00767649291f, 0.00747067295f, 0.00726466998f, 0.00705849193f, 0.00685214577f,
+    0.00664564036f, 0.00643898267f, 0.0062321811f, 0.00602524308f, 0.00581817701f, 0.00561098987f, 0.00540369051f, 0.0051962859f,
+    0.00498878444f, 0.00478119357f, 0.00457352167f, 0.0043657762f, 0.00415796507f, 0.00395009574f, 0.00374217681f, 0.0035342155f,
+    0.00332621997f, 0.0031181979f, 0.0029101572f, 0.00270210556f, 0.00249405089f, 0.00228600111f, 0.00207796367f, 0.00186994695f,
+    0.00166195829f, 0.00145400572f, 0.00124609692f, 0.00103823969f, 0.000830441888f, 0.000622711261f, 0.000415055547f, 0.000207482546f,
+    3.72610356e-17f, -0.000207384335f, -0.000414662703f, -0.000621827377f, -0.00082887063f, -0.00103578472f, -0.00124256196f, -0.00144919474f,
+    -0.00165567512f, -0.00186199567f, -0.00206814846f, -0.00227412605f, -0.00247992086f, -0.00268552476f, -0.00289093074f, -0.00309613068f,
+    -0.00330111734f, -0.00350588281f, -0.00371041964f, -0.00391472038f, -0.00411877735f, -0.00432258286f, -0.00452612946f, -0.0047294097f,
+    -0.00493241614f, -0.00513514085f, -0.00533757685f, -0.00553971669f, -0.00574155245f, -0.00594307715f, -0.00614428334f, -0.0063451631f,
+    -0.00654570945f, -0.00674591493f, -0.00694577256f, -0.00714527443f, -0.00734441308f, -0.00754318153f, -0.0077415728f, -0.00793957897f,
+    -0.00813719351f, -0.00833440851f, -0.00853121746f, -0.00872761197f, -0.00892358646f, -0.00911913253f, -0.00931424275f, -0.00950891152f,
+    -0.00970313046f, -0.00989689305f, -0.0100901918f, -0.0102830203f, -0.010475371f, -0.0106672375f, -0.0108586112f, -0.0110494876f,
+    -0.0112398574f, -0.0114297159f, -0.0116190538f, -0.0118078664f, -0.0119961454f, -0.0121838851f, -0.0123710781f, -0.012557717f,
+    -0.0127437962f, -0.0129293082f, -0.0131142465f, -0.0132986056f, -0.013482376f, -0.0136655541f, -0.0138481315f, -0.0140301017f,
+    -0.0142114591f, -0.0143921962f, -0.0145723075f, -0.0147517854f, -0.0149306245f, -0.0151088182f, -0.015286359f, -0.0154632414f,
+    -0.0156394597f, -0.0158150066f, -0.0159898754f, -0.0161640607f, -0.0163375568f, -0.0165103562f, -0.0166824535f, -0.0168538429f,
+    -0.0170245171f, -0.0171944704f, -0.0173636992f, -0.017532194f, -0.0176999494f, -0.0178669598f, -0.0180332214f, -0.0181987267f,
+    -0.0183634683f, -0.0185274426f, -0.018690642f, -0.0188530628f, -0.0190146975f, -0.0191755425f, -0.0193355884f, -0.0194948334f,
+    -0.01965327f, -0.0198108926f, -0.0199676957f, -0.0201236755f, -0.0202788245f, -0.0204331372f, -0.0205866098f, -0.020739235f,
+    -0.0208910089f, -0.021041926f, -0.0211919807f, -0.0213411674f, -0.0214894824f, -0.0216369182f, -0.0217834711f, -0.0219291374f,
+    -0.0220739078f, -0.0222177822f, -0.0223607514f, -0.0225028135f, -0.0226439629f, -0.022784194f, -0.0229235031f, -0.0230618827f,
+    -0.023199331f, -0.0233358424f, -0.0234714113f, -0.023606034f, -0.0237397049f, -0.0238724202f, -0.0240041763f, -0.0241349675f,
+    -0.0242647883f, -0.0243936367f, -0.0245215055f, -0.0246483926f, -0.0247742943f, -0.0248992033f, -0.0250231177f, -0.0251460318f,
+    -0.0252679437f, -0.025388848f, -0.0255087391f, -0.0256276149f, -0.0257454719f, -0.0258623045f, -0.0259781089f, -0.0260928832f,
+    -0.02620662f, -0.0263193194f, -0.0264309738f, -0.0265415832f, -0.0266511422f, -0.0267596468f, -0.0268670935f, -0.0269734804f,
+    -0.0270788018f, -0.027183054f, -0.0272862352f, -0.0273883436f, -0.0274893716f, -0.0275893193f, -0.027688181f, -0.027785955f,
+    -0.0278826375f, -0.0279782265f, -0.0280727185f, -0.0281661078f, -0.0282583963f, -0.0283495765f, -0.0284396484f, -0.0285286065f,
+    -0.0286164526f, -0.0287031773f, -0.0287887845f, -0.0288732667f, -0.0289566237f, -0.0290388502f, -0.0291199479f, -0.0291999113f,
+    -0.0292787384f, -0.0293564256f, -0.0294329729f, -0.0295083784f, -0.0295826364f, -0.0296557471f, -0.0297277067f, -0.0297985151f,
+    -0.0298681688f, -0.0299366657f, -0.030004004f, -0.0300701819f, -0.0301351976f, -0.030199049f, -0.0302617326f, -0.0303232502f,
+    -0.0303835962f, -0.0304427706f, -0.0305007715f, -0.0305575989f, -0.0306132492f, -0.0306677204f, -0.0307210125f, -0.0307731237f,
+    -0.0308240522f, -0.030873796f, -0.030922357f, -0.0309697296f, -0.0310159139f, -0.0310609099f, -0.0311047174f, -0.031147331f,
+    -0.0311887544f, -0.0312289838f, -0.0312680192f, -0.031305857f, -0.0313425027f, -0.0313779488f, -0.0314121991f, -0.0314452499f,
+    -0.0314771011f, -0.0315077528f, -0.031537205f, -0.0315654576f, -0.0315925069f, -0.031618353f, -0.0316429995f, -0.0316664428f,
+    -0.031688679f, -0.0317097157f, -0.0317295492f, -0.0317481793f, -0.0317656025f, -0.0317818224f, -0.0317968391f, -0.0318106525f,
+    -0.0318232626f, -0.0318346657f, -0.0318448655f, -0.0318538658f, -0.0318616591f, -0.0318682492f, -0.0318736359f, -0.0318778194f,
+    -0.0318808034f, -0.0318825841f, -0.0318831615f, -0.0318825394f, -0.0318807177f, -0.0318776965f, -0.0318734758f, -0.0318680592f,
+    -0.0318614431f, -0.0318536274f, -0.0318446197f, -0.0318344161f, -0.0318230204f, -0.0318104289f, -0.0317966454f, -0.0317816697f,
+    -0.0317655057f, -0.0317481533f, -0.0317296125f, -0.0317098871f, -0.0316889733f, -0.0316668786f, -0.0316435993f, -0.0316191427f,
+    -0.0315935016f, -0.0315666869f, -0.0315386914f, -0.0315095261f, -0.0314791836f, -0.0314476714f, -0.0314149857f, -0.0313811339f,
+    -0.0313461162f, -0.0313099362f, -0.0312725902f, -0.0312340856f, -0.0311944205f, -0.0311536007f, -0.0311116241f, -0.0310684964f,
+    -0.0310242176f, -0.0309787914f, -0.0309322178f, -0.0308845006f, -0.0308356434f, -0.0307856463f, -0.0307345111f, -0.0306822434f,
+    -0.0306288432f, -0.0305743143f, -0.0305186585f, -0.0304618776f, -0.0304039754f, -0.0303449556f, -0.0302848183f, -0.0302235689f,
+    -0.0301612075f, -0.0300977398f, -0.0300331675f, -0.0299674924f, -0.0299007185f, -0.0298328493f, -0.0297638867f, -0.0296938326f,
+    -0.0296226945f, -0.0295504723f, -0.0294771679f, -0.0294027887f, -0.0293273348f, -0.0292508099f, -0.0291732196f, -0.0290945638f,
+    -0.0290148482f, -0.0289340764f, -0.0288522504f, -0.0287693758f, -0.0286854543f, -0.0286004897f, -0.0285144877f, -0.0284274481f,
+    -0.0283393785f, -0.0282502826f, -0.0281601604f, -0.0280690193f, -0.0279768612f, -0.0278836917f, -0.0277895145f, -0.0276943315f,
+    -0.0275981501f, -0.0275009703f, -0.0274027996f, -0.0273036398f, -0.0272034984f, -0.0271023754f, -0.0270002782f, -0.0268972088f,
+    -0.0267931726f, -0.0266881753f, -0.0265822187f, -0.0264753085f, -0.0263674501f, -0.0262586456f, -0.0261489023f, -0.026038222f,
+    -0.0259266123f, -0.025814075f, -0.0257006157f, -0.0255862381f, -0.0254709497f, -0.0253547523f, -0.0252376534f, -0.0251196548f,
+    -0.0250007641f, -0.0248809848f, -0.0247603208f, -0.0246387795f, -0.0245163646f, -0.0243930798f, -0.0242689308f, -0.0241439249f,
+    -0.0240180641f, -0.0238913558f, -0.0237638038f, -0.0236354135f, -0.0235061906f, -0.0233761407f, -0.0232452676f, -0.0231135767f,
+    -0.0229810756f, -0.0228477661f, -0.0227136575f, -0.0225787517f, -0.0224430542f, -0.0223065745f, -0.0221693143f, -0.0220312793f,
+    -0.0218924768f, -0.0217529126f, -0.0216125902f, -0.0214715153f, -0.0213296954f, -0.0211871359f, -0.0210438408f, -0.0208998155f,
+    -0.0207550693f, -0.0206096042f, -0.0204634275f, -0.0203165468f, -0.0201689638f, -0.020020688f, -0.0198717229f, -0.0197220761f,
+    -0.0195717532f, -0.0194207598f, -0.0192691013f, -0.0191167835f, -0.0189638138f, -0.0188101996f, -0.0186559428f, -0.0185010526f,
+    -0.0183455329f, -0.018189393f, -0.0180326346f, -0.0178752691f, -0.0177172981f, -0.0175587311f, -0.0173995718f, -0.0172398277f,
+    -0.0170795061f, -0.0169186108f, -0.0167571492f, -0.0165951289f, -0.0164325535f, -0.0162694324f, -0.0161057711f, -0.0159415752f,
+    -0.0157768503f, -0.0156116048f, -0.0154458433f, -0.0152795743f, -0.0151128024f, -0.014945535f, -0.0147777786f, -0.0146095399f,
+    -0.0144408243f, -0.0142716393f, -0.0141019924f, -0.0139318882f, -0.0137613341f, -0.0135903368f, -0.0134189036f, -0.0132470401f,
+    -0.0130747529f, -0.0129020503f, -0.012728936f, -0.0125554195f, -0.0123815071f, -0.0122072035f, -0.0120325172f, -0.0118574547f,
+    -0.0116820224f, -0.0115062278f, -0.0113300765f, -0.011153576f, -0.0109767327f, -0.0107995542f, -0.010622046f, -0.0104442164f,
+    -0.0102660712f, -0.0100876167f, -0.00990886148f, -0.00972981099f, -0.00955047365f, -0.00937085412f, -0.00919096079f, -0.00901080016f,
+    -0.00883037876f, -0.00864970405f, -0.00846878253f, -0.00828762166f, -0.00810622796f, -0.00792460889f, -0.00774277002f, -0.00756071927f,
+    -0.00737846317f, -0.00719600962f, -0.00701336423f, -0.0068305349f, -0.00664752815f, -0.00646435143f, -0.00628101081f, -0.00609751418f,
+    -0.00591386762f, -0.00573007902f, -0.00554615492f, -0.00536210183f, -0.0051779272f, -0.00499363849f, -0.00480924174f, -0.00462474441f,
+    -0.00444015348f, -0.00425547548f, -0.00407071831f, -0.00388588803f, -0.00370099233f, -0.00351603748f, -0.00333103118f, -0.00314597995f,
+    -0.00296089076f, -0.00277577084f, -0.00259062694f, -0.00240546605f, -0.00222029514f, -0.00203512143f, -0.00184995157f, -0.00166479265f,
+    -0.00147965166f, -0.00129453547f, -0.00110945094f, -0.000924405234f, -0.000739405164f, -0.000554457656f, -0.000369569694f, -0.000184748176f,
+    -3.68654414e-17f, 0.000184667908f, 0.000369248621f, 0.000553735299f, 0.000738120987f, 0.000922398816f, 0.00110656186f, 0.00129060342f,
+    0.00147451635f, 0.001658294f, 0.00184192951f, 0.00202541612f, 0.00220874674f, 0.0023919146f, 0.00257491297f, 0.00275773532f,
+    0.00294037419f, 0.00312282355f, 0.00330507592f, 0.00348712504f, 0.00366896414f, 0.00385058625f, 0.0040319846f, 0.00421315245f,
+    0.00439408328f, 0.00457477057f, 0.00475520734f, 0.00493538706f, 0.00511530275f, 0.00529494788f, 0.00547431596f, 0.00565340091f,
+    0.00583219482f, 0.0060106921f, 0.00618888577f, 0.00636676978f, 0.00654433668f, 0.00672158087f, 0.00689849537f, 0.0070750732f,
+    0.00725130877f, 0.00742719509f, 0.00760272564f, 0.00777789438f, 0.00795269478f, 0.00812712032f, 0.00830116402f, 0.00847482029f,
+    0.00864808261f, 0.00882094447f, 0.00899339933f, 0.00916544162f, 0.00933706481f, 0.00950826239f, 0.00967902783f, 0.00984935556f,
+    0.010019239f, 0.0101886718f, 0.0103576481f, 0.0105261616f, 0.0106942058f, 0.0108617749f, 0.0110288635f, 0.011195465f,
+    0.0113615729f, 0.0115271816f, 0.0116922846f, 0.0118568772f, 0.0120209521f, 0.0121845035f, 0.0123475259f, 0.0125100128f,
+    0.0126719596f, 0.0128333597f, 0.0129942065f, 0.0131544955f, 0.0133142201f, 0.0134733757f, 0.0136319548f, 0.0137899518f,
+    0.013947363f, 0.01410418f, 0.0142604001f, 0.0144160157f, 0.0145710213f, 0.0147254122f, 0.014879182f, 0.0150323259f,
+    0.0151848383f, 0.0153367128f, 0.0154879456f, 0.0156385303f, 0.0157884602f, 0.0159377325f, 0.0160863418f, 0.0162342805f,
+    0.016381545f, 0.0165281277f, 0.0166740268f, 0.0168192368f, 0.0169637501f, 0.0171075631f, 0.0172506701f, 0.0173930656f,
+    0.0175347459f, 0.0176757053f, 0.0178159401f, 0.0179554429f, 0.01809421f, 0.0182322357f, 0.0183695164f, 0.0185060482f,
+    0.0186418239f, 0.0187768377f, 0.0189110897f, 0.0190445706f, 0.0191772785f, 0.0193092059f, 0.0194403511f, 0.0195707083f,
+    0.0197002739f, 0.0198290404f, 0.0199570078f, 0.0200841669f, 0.0202105157f, 0.0203360505f, 0.0204607658f, 0.0205846578f,
+    0.0207077209f, 0.0208299533f, 0.0209513474f, 0.0210719015f, 0.0211916119f, 0.0213104729f, 0.0214284807f, 0.0215456318f,
+    0.0216619205f, 0.0217773449f, 0.0218918994f, 0.0220055822f, 0.0221183859f, 0.0222303104f, 0.0223413501f, 0.0224515013f,
+    0.0225607604f, 0.0226691235f, 0.0227765869f, 0.0228831451f, 0.0229887981f, 0.0230935402f, 0.0231973697f, 0.0233002808f,
+    0.0234022699f, 0.0235033352f, 0.0236034729f, 0.0237026773f, 0.0238009486f, 0.023898283f, 0.0239946749f, 0.0240901224f,
+    0.0241846219f, 0.0242781714f, 0.0243707672f, 0.0244624056f, 0.0245530847f, 0.0246428009f, 0.0247315504f, 0.0248193312f,
+    0.0249061398f, 0.0249919742f, 0.0250768308f, 0.0251607075f, 0.0252436027f, 0.0253255107f, 0.0254064295f, 0.0254863594f,
+    0.0255652945f, 0.0256432351f, 0.0257201754f, 0.0257961154f, 0.0258710515f, 0.0259449817f, 0.0260179043f, 0.0260898154f,
+    0.0261607151f, 0.0262305997f, 0.0262994654f, 0.0263673142f, 0.0264341384f, 0.0264999419f, 0.0265647173f, 0.0266284663f,
+    0.0266911853f, 0.0267528743f, 0.0268135276f, 0.0268731471f, 0.0269317292f, 0.0269892719f, 0.0270457752f, 0.0271012355f,
+    0.0271556526f, 0.027209023f, 0.0272613466f, 0.0273126233f, 0.0273628477f, 0.0274120215f, 0.027460143f, 0.0275072102f,
+    0.0275532212f, 0.0275981743f, 0.0276420712f, 0.0276849065f, 0.0277266838f, 0.0277673975f, 0.0278070495f, 0.0278456379f,
+    0.0278831609f, 0.0279196184f, 0.0279550105f, 0.0279893335f, 0.0280225873f, 0.0280547738f, 0.0280858893f, 0.0281159356f,
+    0.0281449091f, 0.0281728115f, 0.028199641f, 0.0282253958f, 0.0282500796f, 0.0282736886f, 0.028296221f, 0.0283176806f,
+    0.0283380654f, 0.0283573717f, 0.0283756051f, 0.0283927601f, 0.0284088403f, 0.0284238439f, 0.0284377709f, 0.0284506194f,
+    0.0284623932f, 0.0284730904f, 0.0284827091f, 0.028491253f, 0.0284987204f, 0.0285051111f, 0.0285104252f, 0.0285146646f,
+    0.0285178274f, 0.0285199154f, 0.0285209287f, 0.0285208691f, 0.0285197329f, 0.0285175256f, 0.0285142437f, 0.0285098907f,
+    0.0285044648f, 0.0284979679f, 0.0284904018f, 0.0284817647f, 0.0284720603f, 0.0284612868f, 0.028449446f, 0.0284365397f,
+    0.0284225661f, 0.0284075309f, 0.0283914302f, 0.0283742677f, 0.0283560436f, 0.0283367597f, 0.0283164177f, 0.0282950159f,
+    0.0282725599f, 0.0282490477f, 0.0282244813f, 0.0281988624f, 0.0281721912f, 0.0281444713f, 0.0281157047f, 0.0280858893f,
+    0.028055029f, 0.0280231256f, 0.027990181f, 0.0279561952f, 0.0279211719f, 0.027885111f, 0.0278480146f, 0.0278098863f,
+    0.027770726f, 0.0277305357f, 0.0276893172f, 0.0276470762f, 0.0276038088f, 0.0275595207f, 0.0275142137f, 0.0274678897f,
+    0.0274205506f, 0.0273721982f, 0.0273228362f, 0.0272724647f, 0.0272210892f, 0.0271687079f, 0.0271153264f, 0.0270609446f,
+    0.0270055681f, 0.0269491971f, 0.0268918332f, 0.0268334821f, 0.0267741457f, 0.0267138239f, 0.0266525224f, 0.0265902411f,
+    0.0265269857f, 0.026462758f, 0.0263975598f, 0.0263313949f, 0.026264267f, 0.0261961762f, 0.0261271279f, 0.0260571241f,
+    0.0259861685f, 0.025914263f, 0.0258414131f, 0.0257676188f, 0.0256928857f, 0.0256172158f, 0.0255406108f, 0.0254630782f,
+    0.025384618f, 0.0253052339f, 0.0252249315f, 0.0251437109f, 0.0250615776f, 0.0249785352f, 0.0248945858f, 0.024809733f,
+    0.0247239824f, 0.0246373359f, 0.0245497972f, 0.02446137f, 0.0243720599f, 0.0242818668f, 0.0241907984f, 0.0240988545f,
+    0.0240060426f, 0.0239123646f, 0.0238178261f, 0.0237224288f, 0.0236261785f, 0.0235290769f, 0.0234311298f, 0.0233323406f,
+    0.0232327133f, 0.0231322534f, 0.0230309628f, 0.022928847f, 0.0228259116f, 0.0227221567f, 0.0226175897f, 0.0225122143f,
+    0.022406036f, 0.0222990569f, 0.0221912805f, 0.0220827144f, 0.0219733603f, 0.0218632258f, 0.0217523128f, 0.0216406249f,
+    0.0215281695f, 0.0214149486f, 0.0213009696f, 0.0211862344f, 0.0210707486f, 0.0209545158f, 0.0208375435f, 0.0207198337f,
+    0.0206013937f, 0.0204822235f, 0.0203623343f, 0.0202417262f, 0.0201204047f, 0.0199983772f, 0.0198756456f, 0.0197522156f,
+    0.0196280926f, 0.0195032824f, 0.0193777885f, 0.0192516167f, 0.0191247705f, 0.0189972576f, 0.0188690815f, 0.0187402479f,
+    0.0186107606f, 0.018480625f, 0.0183498487f, 0.0182184335f, 0.0180863868f, 0.0179537144f, 0.0178204179f, 0.0176865067f,
+    0.0175519846f, 0.0174168553f, 0.0172811262f, 0.017144803f, 0.0170078892f, 0.0168703906f, 0.0167323127f, 0.0165936612f,
+    0.0164544433f, 0.0163146611f, 0.0161743239f, 0.0160334334f, 0.0158919971f, 0.0157500189f, 0.0156075079f, 0.0154644661f,
+    0.0153209008f, 0.0151768178f, 0.0150322216f, 0.0148871187f, 0.0147415139f, 0.0145954145f, 0.0144488243f, 0.0143017508f,
+    0.0141541986f, 0.0140061732f, 0.0138576813f, 0.0137087284f, 0.0135593191f, 0.0134094609f, 0.0132591594f, 0.0131084193f,
+    0.012957247f, 0.0128056481f, 0.0126536302f, 0.0125011969f, 0.0123483548f, 0.0121951103f, 0.0120414691f, 0.0118874377f,
+    0.0117330207f, 0.0115782246f, 0.011423056f, 0.0112675205f, 0.0111116236f, 0.0109553728f, 0.0107987719f, 0.0106418291f,
+    0.0104845492f, 0.0103269387f, 0.0101690032f, 0.0100107491f, 0.00985218212f, 0.00969330873f, 0.00953413546f, 0.00937466696f,
+    0.00921491161f, 0.00905487314f, 0.008894559f, 0.0087339757f, 0.00857312791f, 0.00841202307f, 0.00825066771f, 0.00808906648f,
+    0.0079272259f, 0.00776515296f, 0.0076028537f, 0.00744033372f, 0.00727759954f, 0.0071146572f, 0.0069515137f, 0.00678817416f,
+    0.00662464555f, 0.00646093348f, 0.00629704492f, 0.00613298547f, 0.00596876163f, 0.00580437994f, 0.00563984597f, 0.00547516625f,
+    0.00531034777f, 0.00514539564f, 0.00498031639f, 0.00481511699f, 0.00464980258f, 0.0044843806f, 0.00431885663f, 0.00415323675f,
+    0.00398752792f, 0.00382173597f, 0.00365586695f, 0.00348992762f, 0.00332392403f, 0.00315786246f, 0.00299174897f, 0.00282559032f,
+    0.00265939231f, 0.00249316124f, 0.00232690363f, 0.00216062577f, 0.00199433346f, 0.00182803348f, 0.00166173186f, 0.00149543479f,
+    0.00132914865f, 0.00116287963f, 0.000996633898f, 0.000830417906f, 0.000664237712f, 0.000498099544f, 0.000332009775f, 0.000165974503f,
+    1.32512587e-16f, -0.000165907521f, -0.000331741874f, -0.000497496803f, -0.000663166167f, -0.000828743679f, -0.000994223286f, -0.0011595987f,
+    -0.00132486376f, -0.00149001239f, -0.00165503821f, -0.00181993528f, -0.00198469753f, -0.00214931834f, -0.00231379224f, -0.00247811247f,
+    -0.00264227344f, -0.00280626863f, -0.00297009223f, -0.00313373795f, -0.00329719996f, -0.00346047175f, -0.00362354773f, -0.00378642161f,
+    -0.00394908758f, -0.00411153911f, -0.00427377084f, -0.0044357758f, -0.00459754886f, -0.00475908397f, -0.00492037507f, -0.00508141564f,
+    -0.00524220057f, -0.00540272286f, -0.00556297787f, -0.00572295859f, -0.00588265993f, -0.00604207534f, -0.00620119926f, -0.00636002561f,
+    -0.00651854882f, -0.0066767633f, -0.00683466252f, -0.0069922409f, -0.00714949332f, -0.00730641279f, -0.00746299466f, -0.0076192324f,
+    -0.0077751209f, -0.0079306541f, -0.00808582548f, -0.00824063085f, -0.00839506369f, -0.00854911935f, -0.00870279036f, -0.00885607209f,
+    -0.00900895987f, -0.00916144624f, -0.00931352656f, -0.00946519617f, -0.00961644761f, -0.00976727717f, -0.00991767831f, -0.0100676455f,
+    -0.010217174f, -0.0103662573f, -0.0105148908f, -0.0106630698f, -0.0108107869f, -0.0109580383f, -0.0111048184f, -0.0112511208f,
+    -0.0113969417f, -0.0115422755f, -0.0116871158f, -0.0118314587f, -0.0119752986f, -0.0121186301f, -0.0122614475f, -0.0124037461f,
+    -0.0125455214f, -0.0126867667f, -0.0128274783f, -0.0129676517f, -0.0131072793f, -0.0132463584f, -0.0133848833f, -0.0135228485f,
+    -0.0136602502f, -0.013797082f, -0.0139333401f, -0.0140690189f, -0.0142041137f, -0.01433862f, -0.014472533f, -0.0146058481f,
+    -0.0147385588f, -0.0148706622f, -0.0150021529f, -0.015133027f, -0.015263279f, -0.0153929032f, -0.015521897f, -0.0156502556f,
+    -0.0157779735f, -0.015905045f, -0.0160314683f, -0.0161572378f, -0.016282348f, -0.016406795f, -0.0165305752f, -0.0166536849f,
+    -0.0167761166f, -0.0168978702f, -0.0170189366f, -0.0171393156f, -0.0172589999f, -0.0173779894f, -0.0174962748f, -0.0176138543f,
+    -0.0177307259f, -0.0178468823f, -0.0179623198f, -0.0180770364f, -0.0181910247f, -0.0183042847f, -0.0184168108f, -0.0185285974f,
+    -0.0186396427f, -0.0187499411f, -0.0188594908f, -0.018968286f, -0.0190763231f, -0.0191836003f, -0.019290112f, -0.0193958562f,
+    -0.0195008274f, -0.0196050219f, -0.0197084378f, -0.0198110715f, -0.0199129172f, -0.0200139731f, -0.0201142356f, -0.020213699f,
+    -0.0203123633f, -0.0204102248f, -0.0205072779f, -0.0206035208f, -0.0206989478f, -0.0207935609f, -0.0208873507f, -0.020980319f,
+    -0.0210724585f, -0.0211637691f, -0.0212542471f, -0.0213438887f, -0.0214326903f, -0.02152065f, -0.0216077659f, -0.0216940325f,
+    -0.0217794478f, -0.02186401f, -0.0219477154f, -0.0220305603f, -0.0221125446f, -0.0221936628f, -0.022273913f, -0.0223532934f,
+    -0.0224318001f, -0.0225094315f, -0.0225861836f, -0.0226620566f, -0.0227370467f, -0.0228111483f, -0.0228843633f, -0.022956688f,
+    -0.0230281204f, -0.0230986569f, -0.0231682956f, -0.0232370328f, -0.0233048704f, -0.0233718026f, -0.0234378278f, -0.0235029459f,
+    -0.0235671513f, -0.0236304458f, -0.0236928258f, -0.0237542875f, -0.0238148309f, -0.0238744542f, -0.0239331555f, -0.023990931f,
+    -0.0240477808f, -0.024103703f, -0.0241586957f, -0.0242127571f, -0.0242658854f, -0.0243180785f, -0.0243693367f, -0.024419656f,
+    -0.0244690347f, -0.0245174747f, -0.0245649721f, -0.0246115252f, -0.024657134f, -0.0247017946f, -0.024745509f, -0.0247882754f,
+    -0.0248300899f, -0.0248709526f, -0.0249108635f, -0.0249498226f, -0.0249878243f, -0.0250248704f, -0.025060961f, -0.0250960924f,
+    -0.0251302663f, -0.0251634791f, -0.0251957309f, -0.0252270233f, -0.0252573527f, -0.0252867192f, -0.0253151208f, -0.0253425594f,
+    -0.0253690314f, -0.0253945403f, -0.0254190806f, -0.0254426543f, -0.0254652612f, -0.0254869014f, -0.025507573f, -0.0255272742f,
+    -0.0255460087f, -0.0255637728f, -0.0255805664f, -0.0255963914f, -0.025611246f, -0.0256251302f, -0.0256380457f, -0.025649989f,
+    -0.0256609619f, -0.0256709643f, -0.0256799962f, -0.0256880578f, -0.0256951489f, -0.0257012695f, -0.0257064197f, -0.0257105995f,
+    -0.0257138107f, -0.0257160515f, -0.0257173236f, -0.0257176273f, -0.0257169623f, -0.0257153269f, -0.0257127266f, -0.0257091578f,
+    -0.0257046223f, -0.02569912f, -0.0256926548f, -0.025685221f, -0.025676826f, -0.0256674662f, -0.0256571434f, -0.0256458577f,
+    -0.0256336126f, -0.0256204046f, -0.0256062392f, -0.0255911145f, -0.0255750306f, -0.0255579911f, -0.0255399961f, -0.0255210456f,
+    -0.0255011432f, -0.0254802853f, -0.0254584793f, -0.0254357215f, -0.0254120138f, -0.0253873598f, -0.0253617596f, -0.0253352132f,
+    -0.0253077243f, -0.0252792928f, -0.0252499189f, -0.0252196081f, -0.0251883585f, -0.025156172f, -0.0251230504f, -0.0250889976f,
+    -0.0250540115f, -0.025018096f, -0.0249812528f, -0.0249434821f, -0.0249047875f, -0.0248651709f, -0.0248246323f, -0.0247831754f,
+    -0.0247408003f, -0.0246975124f, -0.0246533081f, -0.0246081948f, -0.0245621726f, -0.0245152414f, -0.0244674068f, -0.0244186688f,
+    -0.0243690312f, -0.0243184939f, -0.0242670607f, -0.0242147353f, -0.0241615158f, -0.0241074096f, -0.024052415f, -0.0239965357f,
+    -0.0239397753f, -0.0238821357f, -0.0238236189f, -0.0237642266f, -0.0237039644f, -0.0236428324f, -0.0235808324f, -0.02351797f,
+    -0.0234542452f, -0.0233896635f, -0.0233242251f, -0.0232579336f, -0.0231907908f, -0.0231228024f, -0.0230539683f, -0.0229842942f,
+    -0.0229137819f, -0.0228424314f, -0.0227702502f, -0.0226972401f, -0.022623403f, -0.0225487426f, -0.0224732608f, -0.0223969631f,
+    -0.0223198514f, -0.0222419295f, -0.0221631993f, -0.0220836643f, -0.0220033303f, -0.0219221972f, -0.0218402706f, -0.0217575524f,
+    -0.0216740482f, -0.0215897597f, -0.0215046909f, -0.0214188453f, -0.0213322248f, -0.021244837f, -0.0211566798f, -0.0210677627f,
+    -0.0209780857f, -0.0208876524f, -0.0207964685f, -0.0207045358f, -0.0206118599f, -0.0205184426f, -0.0204242896f, -0.0203294028f,
+    -0.0202337876f, -0.0201374479f, -0.0200403873f, -0.0199426077f, -0.0198441166f, -0.0197449159f, -0.0196450092f, -0.0195444003f,
+    -0.0194430966f, -0.0193410981f, -0.0192384105f, -0.0191350393f, -0.0190309864f, -0.0189262554f, -0.0188208539f, -0.0187147837f,
+    -0.0186080504f, -0.0185006578f, -0.0183926076f, -0.0182839092f, -0.0181745626f, -0.0180645734f, -0.0179539453f, -0.0178426858f,
+    -0.0177307967f, -0.0176182818f, -0.0175051466f, -0.0173913967f, -0.0172770359f, -0.0171620678f, -0.0170464981f, -0.0169303305f,
+    -0.0168135688f, -0.0166962203f, -0.0165782887f, -0.0164597761f, -0.0163406916f, -0.0162210353f, -0.0161008146f, -0.0159800351f,
+    -0.0158586986f, -0.0157368127f, -0.0156143801f, -0.0154914064f, -0.0153678972f, -0.0152438562f, -0.0151192881f, -0.0149941994f,
+    -0.0148685938f, -0.0147424769f, -0.0146158524f, -0.0144887259f, -0.0143611031f, -0.0142329885f, -0.0141043868f, -0.0139753027f,
+    -0.0138457427f, -0.0137157096f, -0.0135852108f, -0.0134542501f, -0.013322833f, -0.0131909652f, -0.0130586503f, -0.012925894f,
+    -0.0127927028f, -0.0126590803f, -0.0125250313f, -0.0123905633f, -0.0122556798f, -0.0121203857f, -0.0119846873f, -0.0118485894f,
+    -0.0117120976f, -0.0115752164f, -0.0114379525f, -0.0113003096f, -0.0111622941f, -0.0110239107f, -0.0108851651f, -0.0107460627f,
+    -0.0106066093f, -0.0104668094f, -0.0103266677f, -0.0101861916f, -0.0100453859f, -0.00990425516f, -0.00976280496f, -0.00962104183f,
+    -0.0094789695f, -0.00933659542f, -0.00919392332f, -0.00905095972f, -0.0089077102f, -0.00876417942f, -0.00862037297f, -0.00847629737f,
+    -0.00833195727f, -0.00818735827f, -0.00804250594f, -0.00789740682f, -0.00775206462f, -0.00760648632f, -0.0074606766f, -0.00731464196f,
+    -0.00716838706f, -0.00702191843f, -0.00687524071f, -0.00672835996f, -0.00658128178f, -0.00643401174f, -0.00628655544f, -0.00613891892f,
+    -0.00599110685f, -0.00584312528f, -0.00569498027f, -0.00554667739f, -0.00539822178f, -0.00524961902f, -0.00510087563f, -0.00495199626f,
+    -0.00480298698f, -0.00465385383f, -0.00450460194f, -0.00435523689f, -0.00420576474f, -0.00405619107f, -0.00390652148f, -0.00375676132f,
+    -0.00360691687f, -0.00345699326f, -0.00330699654f, -0.00315693207f, -0.0030068059f, -0.00285662338f, -0.00270639011f, -0.00255611213f,
+    -0.0024057948f, -0.00225544372f, -0.00210506492f, -0.00195466378f, -0.00180424622f, -0.0016538176f, -0.00150338374f, -0.00135295023f,
+    -0.00120252289f, -0.0010521072f, -0.000901708903f, -0.000751333602f, -0.000600986998f, -0.000450674677f, -0.000300402316f, -0.000150175547f,
+    -3.59610121e-17f, 0.000150118707f, 0.000300174928f, 0.000450163061f, 0.000600077503f, 0.000749912579f, 0.000899662729f, 0.00104932243f,
+    0.00119888596f, 0.00134834775f, 0.00149770221f, 0.00164694386f, 0.00179606711f, 0.00194506627f, 0.00209393585f, 0.00224267039f,
+    0.00239126431f, 0.002539712f, 0.00268800789f, 0.00283614662f, 0.00298412261f, 0.00313193025f, 0.0032795642f, 0.00342701888f,
+    0.00357428892f, 0.00372136873f, 0.00386825297f, 0.00401493581f, 0.00416141236f, 0.00430767704f, 0.00445372425f, 0.00459954841f,
+    0.0047451444f, 0.00489050709f, 0.00503563043f, 0.00518050976f, 0.0053251395f, 0.00546951359f, 0.00561362784f, 0.0057574762f,
+    0.00590105355f, 0.00604435476f, 0.00618737424f, 0.00633010641f, 0.00647254707f, 0.00661469018f, 0.00675653061f, 0.00689806323f,
+    0.00703928294f, 0.00718018413f, 0.00732076215f, 0.00746101141f, 0.00760092679f, 0.00774050364f, 0.0078797359f, 0.00801862031f,
+    0.00815714896f, 0.00829531997f, 0.00843312498f, 0.00857056212f, 0.00870762393f, 0.00884430669f, 0.00898060482f, 0.00911651365f,
+    0.00925202761f, 0.00938714296f, 0.00952185411f, 0.00965615548f, 0.00979004335f, 0.00992351212f, 0.0100565562f, 0.0101891728f,
+    0.0103213554f, 0.0104531003f, 0.010584401f, 0.0107152546f, 0.0108456556f, 0.0109755993f, 0.0111050811f, 0.0112340953f,
+    0.0113626383f, 0.0114907054f, 0.011618292f, 0.0117453933f, 0.0118720047f, 0.0119981216f, 0.0121237384f, 0.0122488532f,
+    0.0123734586f, 0.0124975517f, 0.012621128f, 0.0127441827f, 0.0128667112f, 0.0129887089f, 0.013110172f, 0.0132310968f,
+    0.0133514768f, 0.01347131f, 0.0135905901f, 0.0137093151f, 0.0138274785f, 0.0139450766f, 0.0140621066f, 0.0141785629f,
+    0.0142944409f, 0.0144097386f, 0.0145244496f, 0.0146385711f, 0.0147520984f, 0.0148650287f, 0.0149773555f, 0.0150890779f,
+    0.0152001893f, 0.015310687f, 0.0154205672f, 0.0155298254f, 0.0156384576f, 0.0157464612f, 0.0158538315f, 0.015960563f,
+    0.0160666555f, 0.0161721017f, 0.0162769016f, 0.0163810477f, 0.01648454f, 0.016587371f, 0.016689539f, 0.0167910419f,
+    0.0168918744f, 0.0169920325f, 0.0170915127f, 0.017190313f, 0.0172884297f, 0.017385859f, 0.0174825955f, 0.0175786391f,
+    0.0176739842f, 0.0177686289f, 0.0178625695f, 0.0179558005f, 0.0180483218f, 0.0181401297f, 0.0182312205f, 0.0183215886f,
+    0.0184112359f, 0.0185001548f, 0.0185883436f, 0.0186758004f, 0.0187625214f, 0.0188485049f, 0.0189337451f, 0.0190182403f,
+    0.0191019885f, 0.0191849861f, 0.0192672294f, 0.0193487182f, 0.0194294471f, 0.0195094142f, 0.0195886176f, 0.0196670536f,
+    0.0197447203f, 0.019821614f, 0.0198977329f, 0.019973075f, 0.0200476367f, 0.0201214142f, 0.0201944076f, 0.0202666149f,
+    0.0203380305f, 0.0204086527f, 0.0204784833f, 0.0205475148f, 0.0206157472f, 0.0206831768f, 0.0207498036f, 0.0208156258f,
+    0.0208806377f, 0.0209448393f, 0.0210082289f, 0.0210708044f, 0.0211325623f, 0.0211935025f, 0.0212536212f, 0.0213129167f,
+    0.0213713888f, 0.0214290339f, 0.0214858521f, 0.0215418376f, 0.0215969924f, 0.0216513146f, 0.0217048004f, 0.0217574481f,
+    0.0218092594f, 0.021860227f, 0.0219103545f, 0.0219596382f, 0.0220080782f, 0.0220556688f, 0.0221024137f, 0.0221483074f,
+    0.0221933499f, 0.0222375412f, 0.0222808775f, 0.0223233588f, 0.0223649852f, 0.0224057529f, 0.0224456619f, 0.0224847104f,
+    0.0225229003f, 0.0225602258f, 0.0225966871f, 0.022632286f, 0.0226670187f, 0.0227008853f, 0.0227338839f, 0.0227660146f,
+    0.0227972753f, 0.0228276663f, 0.0228571873f, 0.0228858367f, 0.0229136124f, 0.0229405165f, 0.0229665469f, 0.022991702f,
+    0.0230159815f, 0.0230393857f, 0.0230619144f, 0.0230835658f, 0.0231043398f, 0.0231242366f, 0.0231432561f, 0.0231613964f,
+    0.0231786575f, 0.0231950395f, 0.0232105404f, 0.023225164f, 0.0232389066f, 0.0232517701f, 0.0232637525f, 0.0232748538f,
+    0.0232850742f, 0.0232944153f, 0.0233028755f, 0.0233104546f, 0.0233171545f, 0.0233229715f, 0.0233279094f, 0.0233319681f,
+    0.0233351458f, 0.0233374424f, 0.0233388618f, 0.0233394001f, 0.0233390592f, 0.023337841f, 0.0233357437f, 0.0233327672f,
+    0.0233289134f, 0.0233241841f, 0.0233185776f, 0.0233120956f, 0.0233047362f, 0.0232965034f, 0.0232873969f, 0.023277415f,
+    0.0232665613f, 0.023254836f, 0.0232422389f, 0.0232287701f, 0.0232144333f, 0.0231992267f, 0.0231831521f, 0.0231662113f,
+    0.0231484026f, 0.0231297296f, 0.0231101923f, 0.0230897926f, 0.0230685305f, 0.0230464078f, 0.0230234247f, 0.0229995828f,
+    0.022974886f, 0.0229493305f, 0.0229229201f, 0.0228956584f, 0.0228675436f, 0.0228385776f, 0.0228087623f, 0.0227780975f,
+    0.022746589f, 0.022714233f, 0.0226810351f, 0.0226469953f, 0.0226121135f, 0.0225763954f, 0.0225398391f, 0.0225024465f,
+    0.0224642213f, 0.0224251635f, 0.0223852769f, 0.0223445613f, 0.0223030187f, 0.022260651f, 0.0222174618f, 0.0221734513f,
+    0.0221286211f, 0.0220829751f, 0.0220365152f, 0.0219892412f, 0.0219411552f, 0.0218922626f, 0.0218425617f, 0.0217920579f,
+    0.0217407513f, 0.0216886457f, 0.021635741f, 0.0215820428f, 0.0215275493f, 0.0214722659f, 0.0214161947f, 0.0213593375f,
+    0.0213016961f, 0.0212432742f, 0.0211840738f, 0.0211240966f, 0.0210633464f, 0.0210018251f, 0.0209395364f, 0.0208764803f,
+    0.0208126623f, 0.0207480825f, 0.0206827465f, 0.0206166543f, 0.0205498096f, 0.020482216f, 0.0204138756f, 0.0203447919f,
+    0.020274967f, 0.0202044044f, 0.0201331079f, 0.0200610776f, 0.019988317f, 0.019914832f, 0.0198406242f, 0.0197656956f,
+    0.0196900498f, 0.0196136907f, 0.01953662f, 0.0194588415f, 0.019380359f, 0.0193011761f, 0.0192212947f, 0.0191407185f,
+    0.0190594513f, 0.0189774949f, 0.0188948549f, 0.0188115332f, 0.0187275335f, 0.0186428577f, 0.0185575113f, 0.018471498f,
+    0.0183848199f, 0.0182974823f, 0.0182094853f, 0.0181208365f, 0.0180315375f, 0.0179415904f, 0.0178510007f, 0.017759772f,
+    0.0176679082f, 0.017575413f, 0.0174822882f, 0.0173885394f, 0.0172941703f, 0.0171991847f, 0.0171035845f, 0.0170073751f,
+    0.0169105604f, 0.016813146f, 0.0167151317f, 0.0166165233f, 0.0165173262f, 0.0164175425f, 0.0163171776f, 0.0162162334f,
+    0.0161147173f, 0.0160126295f, 0.0159099754f, 0.0158067606f, 0.0157029871f, 0.0155986603f, 0.0154937841f, 0.0153883621f,
+    0.015282399f, 0.0151758995f, 0.0150688663f, 0.0149613051f, 0.0148532186f, 0.0147446133f, 0.0146354912f, 0.0145258578f,
+    0.0144157168f, 0.0143050728f, 0.0141939307f, 0.014082294f, 0.0139701674f, 0.0138575556f, 0.0137444623f, 0.0136308931f,
+    0.0135168508f, 0.0134023419f, 0.0132873692f, 0.0131719373f, 0.0130560519f, 0.0129397167f, 0.0128229354f, 0.0127057144f,
+    0.0125880577f, 0.0124699688f, 0.0123514533f, 0.012232515f, 0.0121131595f, 0.0119933914f, 0.0118732145f, 0.0117526334f,
+    0.0116316546f, 0.0115102809f, 0.011388517f, 0.0112663684f, 0.0111438408f, 0.011020937f, 0.0108976625f, 0.010774022f,
+    0.010650021f, 0.0105256634f, 0.0104009546f, 0.0102758994f, 0.0101505015f, 0.0100247674f, 0.00989870075f, 0.00977230724f,
+    0.00964559056f, 0.00951855723f, 0.00939121097f, 0.00926355738f, 0.00913560018f, 0.00900734589f, 0.00887879822f, 0.00874996278f,
+    0.00862084422f, 0.0084914472f, 0.00836177729f, 0.00823183917f, 0.00810163841f, 0.00797117874f, 0.00784046669f, 0.00770950597f,
+    0.00757830264f, 0.00744686043f, 0.00731518585f, 0.00718328264f, 0.00705115683f, 0.0069188131f, 0.0067862561f, 0.00665349141f,
+    0.00652052416f, 0.006387359f, 0.00625400152f, 0.00612045638f, 0.00598672871f, 0.00585282361f, 0.00571874669f, 0.00558450213f,
+    0.00545009598f, 0.00531553291f, 0.00518081756f, 0.005045956f, 0.00491095288f, 0.00477581332f, 0.00464054244f, 0.00450514583f,
+    0.00436962768f, 0.00423399406f, 0.0040982496f, 0.00396239944f, 0.00382644893f, 0.00369040319f, 0.00355426734f, 0.00341804652f,
+    0.00328174583f, 0.00314537063f, 0.00300892582f, 0.00287241675f, 0.00273584854f, 0.00259922631f, 0.00246255542f, 0.00232584053f,
+    0.00218908722f, 0.00205230061f, 0.00191548571f, 0.00177864777f, 0.0016417919f, 0.00150492333f, 0.00136804709f, 0.00123116851f,
+    0.00109429262f, 0.00095742452f, 0.000820569461f, 0.000683732505f, 0.000546918891f, 0.000410133682f, 0.000273382058f, 0.000136669114f,
+    -4.36637014e-17f, -0.000136620161f, -0.000273186248f, -0.000409693166f, -0.000546135765f, -0.000682508922f, -0.000818807574f, -0.000955026597f,
+    -0.00109116093f, -0.00122720539f, -0.00136315508f, -0.00149900466f, -0.00163474923f, -0.00177038368f, -0.00190590299f, -0.00204130192f,
+    -0.00217657583f, -0.00231171912f, -0.00244672713f, -0.00258159474f, -0.00271631707f, -0.00285088876f, -0.00298530492f, -0.00311956089f,
+    -0.00325365132f, -0.00338757131f, -0.00352131575f, -0.00365487998f, -0.00378825865f, -0.00392144732f, -0.00405444065f, -0.00418723375f,
+    -0.00431982195f, -0.00445219968f, -0.00458436273f, -0.00471630599f, -0.00484802481f, -0.00497951405f, -0.0051107686f, -0.0052417838f,
+    -0.005372555f, -0.00550307706f, -0.00563334581f, -0.00576335564f, -0.00589310192f, -0.00602257997f, -0.00615178561f, -0.00628071278f,
+    -0.00640935823f, -0.0065377159f, -0.00666578207f, -0.00679355115f, -0.00692101894f, -0.00704818079f, -0.00717503205f, -0.00730156805f,
+    -0.00742778368f, -0.00755367475f, -0.00767923659f, -0.00780446455f, -0.00792935397f, -0.00805390067f, -0.00817809906f, -0.0083019454f,
+    -0.00842543598f, -0.00854856428f, -0.00867132749f, -0.00879372004f, -0.0089157382f, -0.00903737731f, -0.00915863272f, -0.00927949976f,
+    -0.00939997472f, -0.009520052f, -0.00963972975f, -0.0097590005f, -0.00987786241f, -0.00999630895f, -0.0101143382f, -0.0102319438f,
+    -0.0103491228f, -0.0104658697f, -0.0105821816f, -0.0106980531f, -0.0108134812f, -0.0109284613f, -0.0110429889f, -0.0111570591f,
+    -0.0112706693f, -0.0113838147f, -0.0114964917f, -0.0116086956f, -0.0117204217f, -0.0118316682f, -0.0119424285f, -0.0120526999f,
+    -0.0121624786f, -0.012271761f, -0.0123805413f, -0.0124888178f, -0.0125965849f, -0.0127038397f, -0.0128105776f, -0.0129167959f,
+    -0.0130224898f, -0.0131276567f, -0.0132322907f, -0.0133363903f, -0.0134399505f, -0.0135429678f, -0.0136454385f, -0.0137473587f,
+    -0.0138487257f, -0.0139495358f, -0.0140497843f, -0.0141494675f, -0.0142485835f, -0.0143471276f, -0.0144450963f, -0.0145424865f,
+    -0.0146392947f, -0.014735518f, -0.0148311518f, -0.0149261933f, -0.0150206387f, -0.0151144853f, -0.0152077293f, -0.015300368f,
+    -0.0153923975f, -0.0154838152f, -0.0155746173f, -0.015664801f, -0.0157543626f, -0.0158433001f, -0.0159316082f, -0.0160192866f,
+    -0.0161063299f, -0.0161927342f, -0.0162785016f, -0.0163636226f, -0.0164480992f, -0.0165319275f, -0.0166151021f, -0.016697621f,
+    -0.0167794824f, -0.0168606844f, -0.0169412214f, -0.0170210935f, -0.0171002951f, -0.0171788242f, -0.0172566809f, -0.0173338577f,
+    -0.0174103566f, -0.0174861718f, -0.0175613016f, -0.0176357441f, -0.0177094974f, -0.0177825559f, -0.0178549197f, -0.0179265849f,
+    -0.0179975517f, -0.0180678144f, -0.0181373712f, -0.018206222f, -0.0182743631f, -0.0183417909f, -0.0184085052f, -0.0184745006f,
+    -0.0185397789f, -0.0186043363f, -0.0186681692f, -0.0187312774f, -0.0187936574f, -0.0188553091f, -0.0189162288f, -0.0189764127f,
+    -0.0190358628f, -0.0190945752f, -0.0191525463f, -0.0192097779f, -0.0192662645f, -0.019322006f, -0.0193770006f, -0.0194312446f,
+    -0.0194847398f, -0.0195374805f, -0.0195894688f, -0.0196407009f, -0.0196911748f, -0.0197408888f, -0.0197898429f, -0.0198380351f,
+    -0.0198854618f, -0.0199321248f, -0.0199780185f, -0.0200231448f, -0.0200675018f, -0.0201110877f, -0.0201539006f, -0.0201959386f,
+    -0.0202372037f, -0.0202776901f, -0.020317398f, -0.0203563292f, -0.020394478f, -0.0204318482f, -0.0204684325f, -0.0205042362f,
+    -0.020539254f, -0.0205734856f, -0.0206069294f, -0.0206395872f, -0.0206714571f, -0.0207025353f, -0.0207328238f, -0.0207623225f,
+    -0.0207910258f, -0.0208189394f, -0.0208460577f, -0.0208723806f, -0.02089791f, -0.0209226422f, -0.0209465791f, -0.0209697168f,
+    -0.0209920593f, -0.0210136008f, -0.021034345f, -0.0210542902f, -0.0210734345f, -0.0210917797f, -0.0211093239f, -0.0211260654f,
+    -0.0211420078f, -0.0211571474f, -0.0211714841f, -0.02118502f, -0.021197753f, -0.0212096833f, -0.0212208107f, -0.0212311354f,
+    -0.0212406553f, -0.0212493744f, -0.0212572888f, -0.0212644003f, -0.0212707091f, -0.0212762132f, -0.0212809145f, -0.0212848149f,
+    -0.0212879106f, -0.0212902036f, -0.0212916937f, -0.0212923829f, -0.0212922692f, -0.0212913547f, -0.0212896373f, -0.021287119f,
+    -0.0212837998f, -0.0212796815f, -0.0212747622f, -0.0212690439f, -0.0212625265f, -0.0212552119f, -0.0212470982f, -0.0212381873f,
+    -0.0212284811f, -0.0212179776f, -0.0212066788f, -0.0211945847f, -0.021181697f, -0.0211680178f, -0.021153545f, -0.0211382806f,
+    -0.0211222246f, -0.0211053807f, -0.0210877471f, -0.0210693255f, -0.021050116f, -0.0210301224f, -0.0210093427f, -0.0209877789f,
+    -0.0209654327f, -0.0209423043f, -0.0209183954f, -0.0208937079f, -0.0208682418f, -0.020841999f, -0.0208149794f, -0.0207871869f,
+    -0.0207586195f, -0.0207292829f, -0.0206991732f, -0.0206682961f, -0.0206366517f, -0.0206042398f, -0.0205710642f, -0.0205371249f,
+    -0.0205024257f, -0.0204669647f, -0.0204307456f, -0.0203937702f, -0.0203560404f, -0.0203175563f, -0.0202783197f, -0.0202383343f,
+    -0.0201976001f, -0.0201561209f, -0.0201138947f, -0.0200709272f, -0.0200272202f, -0.0199827719f, -0.0199375879f, -0.0198916681f,
+    -0.0198450144f, -0.0197976306f, -0.0197495185f, -0.0197006781f, -0.0196511131f, -0.0196008254f, -0.0195498187f, -0.0194980912f,
+    -0.0194456484f, -0.0193924922f, -0.0193386227f, -0.0192840453f, -0.0192287583f, -0.019172769f, -0.0191160757f, -0.019058682f,
+    -0.0190005917f, -0.0189418048f, -0.0188823249f, -0.0188221559f, -0.0187612996f, -0.0186997559f, -0.0186375305f, -0.0185746234f,
+    -0.0185110401f, -0.0184467826f, -0.0183818508f, -0.0183162503f, -0.018249983f, -0.0181830507f, -0.0181154571f, -0.0180472042f,
+    -0.0179782975f, -0.0179087352f, -0.0178385247f, -0.017767664f, -0.0176961608f, -0.0176240169f, -0.0175512321f, -0.0174778122f,
+    -0.0174037609f, -0.0173290782f, -0.0172537696f, -0.017177837f, -0.0171012841f, -0.0170241147f, -0.0169463288f, -0.0168679338f,
+    -0.0167889297f, -0.0167093202f, -0.0166291092f, -0.0165483002f, -0.0164668951f, -0.0163848996f, -0.0163023155f, -0.0162191447f,
+    -0.0161353927f, -0.0160510615f, -0.0159661546f, -0.0158806778f, -0.0157946311f, -0.01570802f, -0.0156208463f, -0.0155331148f,
+    -0.0154448291f, -0.0153559921f, -0.0152666075f, -0.015176679f, -0.0150862103f, -0.0149952043f, -0.0149036646f, -0.0148115959f,
+    -0.0147190019f, -0.0146258846f, -0.0145322494f, -0.0144380983f, -0.0143434368f, -0.0142482677f, -0.0141525948f, -0.0140564218f,
+    -0.0139597533f, -0.0138625922f, -0.0137649421f, -0.0136668077f, -0.0135681927f, -0.0134691009f, -0.0133695351f, -0.0132695008f,
+    -0.0131690018f, -0.0130680408f, -0.0129666226f, -0.0128647517f, -0.0127624311f, -0.0126596643f, -0.012556457f, -0.0124528129f,
+    -0.0123487348f, -0.0122442283f, -0.0121392962f, -0.0120339431f, -0.0119281728f, -0.0118219908f, -0.0117153991f, -0.0116084032f,
+    -0.0115010077f, -0.0113932155f, -0.0112850312f, -0.0111764595f, -0.0110675041f, -0.0109581696f, -0.0108484598f, -0.0107383793f,
+    -0.0106279328f, -0.0105171241f, -0.0104059568f, -0.0102944365f, -0.010182566f, -0.010070351f, -0.00995779596f, -0.00984490383f,
+    -0.00973168015f, -0.00961812865f, -0.00950425491f, -0.00939006172f, -0.00927555375f, -0.00916073658f, -0.00904561393f, -0.00893018954f,
+    -0.00881446898f, -0.00869845599f, -0.00858215615f, -0.00846557226f, -0.0083487099f, -0.00823157281f, -0.00811416656f, -0.00799649488f,
+    -0.00787856244f, -0.00776037388f, -0.00764193339f, -0.00752324611f, -0.00740431622f, -0.00728514791f, -0.00716574676f, -0.00704611652f,
+    -0.00692626182f, -0.00680618733f, -0.00668589817f, -0.00656539807f, -0.00644469261f, -0.00632378552f, -0.00620268146f, -0.006081386f,
+    -0.00595990242f, -0.00583823677f, -0.0057163923f, -0.00559437508f, -0.00547218835f, -0.00534983771f, -0.00522732735f, -0.00510466238f,
+    -0.00498184701f, -0.00485888636f, -0.00473578461f, -0.00461254688f, -0.00448917784f, -0.00436568167f, -0.0042420635f, -0.00411832798f,
+    -0.00399447931f, -0.00387052307f, -0.00374646345f, -0.00362230535f, -0.00349805318f, -0.0033737116f, -0.00324928574f, -0.00312478025f,
+    -0.00300019956f, -0.00287554832f, -0.00275083166f, -0.00262605399f, -0.00250122021f, -0.00237633474f, -0.00225140271f, -0.00212642853f,
+    -0.0020014171f, -0.00187637284f, -0.00175130076f, -0.00162620551f, -0.00150109176f, -0.00137596426f, -0.0012508278f, -0.0011256868f,
+    -0.00100054638f, -0.000875410857f, -0.000750285224f, -0.000625174027f, -0.000500082038f, -0.000375013944f, -0.000249974459f, -0.000124968239f,
+    -3.49130007e-17f, 0.000124925573f, 0.000249803794f, 0.000374629977f, 0.000499399437f, 0.000624107546f, 0.000748749531f, 0.000873320852f,
+    0.000997816678f, 0.00112223253f, 0.00124656374f, 0.00137080543f, 0.00149495329f, 0.00161900243f, 0.00174294831f, 0.00186678628f,
+    0.00199051178f, 0.00211411994f, 0.00223760656f, 0.00236096676f, 0.0024841961f, 0.0026072897f, 0.00273024314f, 0.00285305199f,
+    0.0029757116f, 0.0030982173f, 0.00322056469f, 0.00334274909f, 0.00346476585f, 0.00358661078f, 0.00370827899f, 0.00382976606f,
+    0.00395106757f, 0.00407217909f, 0.00419309596f, 0.00431381399f, 0.00443432853f, 0.00455463445f, 0.00467472849f, 0.00479460554f,
+    0.00491426094f, 0.00503369095f, 0.00515289046f, 0.00527185574f, 0.00539058167f, 0.00550906453f, 0.00562729919f, 0.0057452824f,
+    0.00586300856f, 0.00598047394f, 0.00609767437f, 0.00621460518f, 0.00633126264f, 0.00644764164f, 0.00656373845f, 0.00667954842f,
+    0.00679506781f, 0.00691029197f, 0.00702521671f, 0.00713983737f, 0.0072541507f, 0.00736815203f, 0.00748183718f, 0.00759520195f,
+    0.00770824263f, 0.00782095362f, 0.00793333258f, 0.00804537442f, 0.00815707538f, 0.00826843176f, 0.00837943796f, 0.00849009119f,
+    0.00860038772f, 0.0087103229f, 0.00881989207f, 0.00892909244f, 0.00903791934f, 0.00914636906f, 0.00925443787f, 0.00936212111f,
+    0.00946941506f, 0.00957631692f, 0.00968282111f, 0.00978892483f, 0.00989462435f, 0.00999991503f, 0.0101047931f, 0.0102092559f,
+    0.0103132986f, 0.0104169175f, 0.010520109f, 0.0106228692f, 0.0107251946f, 0.0108270813f, 0.0109285265f, 0.0110295247f,
+    0.011130074f, 0.0112301707f, 0.0113298101f, 0.0114289885f, 0.0115277041f, 0.0116259512f, 0.0117237279f, 0.0118210297f,
+    0.0119178537f, 0.0120141953f, 0.0121100526f, 0.0122054219f, 0.0123002985f, 0.0123946797f, 0.0124885626f, 0.0125819435f,
+    0.0126748187f, 0.0127671855f, 0.0128590409f, 0.0129503803f, 0.013041201f, 0.0131315002f, 0.0132212741f, 0.01331052f,
+    0.013399234f, 0.0134874145f, 0.0135750566f, 0.0136621576f, 0.0137487147f, 0.0138347251f, 0.0139201861f, 0.0140050929f,
+    0.0140894447f, 0.0141732367f, 0.0142564671f, 0.0143391322f, 0.0144212293f, 0.0145027563f, 0.0145837087f, 0.0146640856f,
+    0.0147438822f, 0.0148230977f, 0.0149017274f, 0.0149797695f, 0.0150572211f, 0.0151340803f, 0.0152103426f, 0.015286007f,
+    0.0153610706f, 0.0154355299f, 0.0155093828f, 0.0155826267f, 0.0156552605f, 0.0157272778f, 0.0157986805f, 0.0158694629f,
+    0.015939625f, 0.0160091631f, 0.0160780735f, 0.0161463562f, 0.0162140075f, 0.0162810273f, 0.0163474102f, 0.0164131541f,
+    0.0164782591f, 0.0165427197f, 0.0166065376f, 0.0166697074f, 0.0167322289f, 0.0167941004f, 0.0168553162f, 0.0169158783f,
+    0.0169757828f, 0.017035028f, 0.0170936119f, 0.0171515308f, 0.0172087867f, 0.0172653738f, 0.0173212904f, 0.0173765384f,
+    0.017431112f, 0.0174850114f, 0.0175382346f, 0.0175907798f, 0.0176426433f, 0.0176938251f, 0.0177443251f, 0.0177941378f,
+    0.0178432651f, 0.017891705f, 0.0179394521f, 0.0179865099f, 0.018032873f, 0.0180785432f, 0.018123515f, 0.01816779f,
+    0.0182113666f, 0.0182542428f, 0.0182964168f, 0.0183378886f, 0.0183786545f, 0.0184187144f, 0.0184580684f, 0.0184967145f,
+    0.0185346492f, 0.0185718741f, 0.0186083876f, 0.0186441876f, 0.0186792742f, 0.0187136456f, 0.0187472999f, 0.0187802371f,
+    0.0188124571f, 0.0188439563f, 0.0188747365f, 0.018904794f, 0.0189341307f, 0.0189627446f, 0.0189906359f, 0.0190178007f,
+    0.0190442409f, 0.0190699548f, 0.0190949421f, 0.0191192031f, 0.0191427357f, 0.0191655383f, 0.0191876125f, 0.0192089565f,
+    0.0192295685f, 0.0192494523f, 0.0192686021f, 0.0192870218f, 0.0193047076f, 0.0193216614f, 0.0193378814f, 0.0193533674f,
+    0.0193681195f, 0.0193821378f, 0.0193954222f, 0.0194079708f, 0.0194197837f, 0.0194308627f, 0.019441206f, 0.0194508135f,
+    0.0194596853f, 0.0194678213f, 0.0194752216f, 0.0194818862f, 0.019487815f, 0.0194930062f, 0.0194974635f, 0.019501185f,
+    0.0195041709f, 0.0195064209f, 0.0195079353f, 0.0195087139f, 0.0195087586f, 0.0195080694f, 0.0195066445f, 0.0195044857f,
+    0.019501593f, 0.0194979683f, 0.0194936097f, 0.0194885172f, 0.0194826946f, 0.0194761399f, 0.0194688533f, 0.0194608346f,
+    0.0194520876f, 0.0194426104f, 0.019432405f, 0.0194214713f, 0.0194098093f, 0.0193974189f, 0.0193843041f, 0.0193704627f,
+    0.0193558969f, 0.0193406064f, 0.0193245932f, 0.0193078592f, 0.0192904025f, 0.019272225f, 0.0192533266f, 0.0192337111f,
+    0.0192133766f, 0.0191923268f, 0.0191705599f, 0.0191480797f, 0.0191248842f, 0.019100979f, 0.0190763604f, 0.0190510321f,
+    0.0190249942f, 0.0189982485f, 0.0189707968f, 0.0189426411f, 0.0189137794f, 0.0188842155f, 0.0188539512f, 0.0188229866f,
+    0.0187913235f, 0.0187589638f, 0.0187259074f, 0.0186921563f, 0.0186577141f, 0.0186225809f, 0.0185867567f, 0.0185502451f,
+    0.0185130481f, 0.0184751656f, 0.0184365995f, 0.0183973517f, 0.0183574259f, 0.0183168203f, 0.0182755385f, 0.0182335842f,
+    0.0181909557f, 0.0181476567f, 0.0181036871f, 0.0180590525f, 0.0180137511f, 0.0179677885f, 0.0179211628f, 0.0178738777f,
+    0.0178259369f, 0.0177773386f, 0.0177280884f, 0.0176781863f, 0.017627636f, 0.0175764374f, 0.0175245944f, 0.0174721088f,
+    0.0174189843f, 0.0173652191f, 0.0173108187f, 0.0172557849f, 0.0172001198f, 0.0171438251f, 0.0170869026f, 0.0170293562f,
+    0.0169711877f, 0.0169123989f, 0.0168529935f, 0.0167929735f, 0.0167323388f, 0.0166710969f, 0.0166092459f, 0.0165467896f,
+    0.0164837334f, 0.0164200757f, 0.01635582f, 0.0162909701f, 0.0162255298f, 0.0161594991f, 0.0160928816f, 0.0160256792f,
+    0.0159578975f, 0.0158895366f, 0.0158206001f, 0.0157510899f, 0.0156810097f, 0.0156103633f, 0.0155391516f, 0.0154673792f,
+    0.0153950471f, 0.01532216f, 0.0152487196f, 0.0151747297f, 0.0151001923f, 0.0150251109f, 0.0149494894f, 0.0148733296f,
+    0.0147966351f, 0.014719408f, 0.0146416528f, 0.0145633724f, 0.0144845685f, 0.0144052459f, 0.0143254073f, 0.0142450547f,
+    0.0141641935f, 0.0140828248f, 0.0140009532f, 0.0139185814f, 0.0138357123f, 0.0137523497f, 0.0136684971f, 0.0135841575f,
+    0.0134993335f, 0.01341403f, 0.0133282496f, 0.0132419951f, 0.0131552713f, 0.0130680799f, 0.0129804257f, 0.0128923114f,
+    0.0128037417f, 0.0127147185f, 0.0126252454f, 0.0125353271f, 0.0124449655f, 0.0123541662f, 0.0122629311f, 0.0121712647f,
+    0.01207917f, 0.0119866505f, 0.0118937111f, 0.0118003543f, 0.0117065832f, 0.0116124032f, 0.0115178162f, 0.0114228269f,
+    0.011327439f, 0.0112316562f, 0.0111354813f, 0.0110389199f, 0.0109419739f, 0.0108446479f, 0.0107469456f, 0.0106488718f,
+    0.0105504282f, 0.0104516204f, 0.0103524514f, 0.0102529246f, 0.0101530459f, 0.0100528169f, 0.00995224249f, 0.00985132717f,
+    0.00975007284f, 0.00964848604f, 0.00954656862f, 0.00944432523f, 0.00934176054f, 0.00923887733f, 0.00913568027f, 0.00903217308f,
+    0.00892836042f, 0.00882424507f, 0.00871983171f, 0.00861512497f, 0.00851012859f, 0.00840484537f, 0.00829928089f, 0.00819343887f,
+    0.00808732212f, 0.00798093714f, 0.0078742858f, 0.00776737276f, 0.00766020315f, 0.00755278021f, 0.00744510815f, 0.00733719068f,
+    0.00722903293f, 0.00712063862f, 0.00701201195f, 0.00690315664f, 0.00679407734f, 0.00668477826f, 0.00657526311f, 0.00646553654f,
+    0.00635560229f, 0.00624546502f, 0.0061351289f, 0.00602459814f, 0.00591387693f, 0.00580296898f, 0.00569187943f, 0.00558061199f,
+    0.00546917086f, 0.00535756024f, 0.00524578476f, 0.00513384864f, 0.00502175558f, 0.00490951072f, 0.00479711732f, 0.00468458049f,
+    0.00457190443f, 0.00445909332f, 0.0043461509f, 0.00423308229f, 0.00411989121f, 0.00400658185f, 0.00389315933f, 0.00377962738f,
+    0.0036659902f, 0.00355225243f, 0.00343841803f, 0.00332449167f, 0.00321047753f, 0.00309638004f, 0.00298220315f, 0.00286795176f,
+    0.00275362958f, 0.00263924128f, 0.00252479129f, 0.00241028355f, 0.00229572272f, 0.002181113f, 0.00206645881f, 0.00195176434f,
+    0.00183703401f, 0.00172227214f, 0.00160748302f, 0.00149267097f, 0.00137784041f, 0.00126299565f, 0.00114814099f, 0.00103328074f,
+    0.000918419159f, 0.000803560717f, 0.00068870961f, 0.00057387026f, 0.000459046889f, 0.00034424389f, 0.000229465513f, 0.000114716124f,
+    1.00748693e-16f, -0.000114678543f, -0.000229315192f, -0.000343905675f, -0.000458445662f, -0.000572930905f, -0.000687357038f, -0.000801719842f,
+    -0.000916015008f, -0.00103023823f, -0.00114438531f, -0.00125845184f, -0.00137243373f, -0.00148632668f, -0.00160012627f, -0.00171382842f,
+    -0.00182742882f, -0.00194092316f, -0.00205430738f, -0.00216757716f, -0.00228072819f, -0.00239375629f, -0.00250665727f, -0.00261942693f,
+    -0.00273206132f, -0.00284455577f, -0.00295690633f, -0.00306910882f, -0.00318115903f, -0.00329305278f, -0.00340478611f, -0.0035163546f,
+    -0.00362775405f, -0.00373898074f, -0.00385003001f, -0.00396089815f, -0.00407158118f, -0.00418207422f, -0.00429237401f, -0.0044024759f,
+    -0.00451237615f, -0.00462207058f, -0.00473155547f, -0.00484082615f, -0.00494987844f, -0.00505870907f, -0.00516731385f, -0.0052756886f,
+    -0.00538382912f, -0.00549173122f, -0.00559939165f, -0.0057068062f, -0.0058139707f, -0.00592088141f, -0.00602753414f, -0.00613392517f,
+    -0.00624005031f, -0.00634590583f, -0.00645148801f, -0.00655679265f, -0.00666181603f, -0.00676655443f, -0.00687100366f, -0.00697516045f,
+    -0.00707902061f, -0.00718257995f, -0.00728583522f, -0.00738878222f, -0.00749141769f, -0.00759373745f, -0.00769573823f, -0.00779741583f,
+    -0.00789876655f, -0.00799978711f, -0.00810047239f, -0.00820082054f, -0.00830082782f, -0.00840048958f, -0.00849980209f, -0.00859876256f,
+    -0.00869736634f, -0.00879561156f, -0.00889349263f, -0.00899100676f, -0.00908815116f, -0.00918492209f, -0.00928131491f, -0.00937732682f,
+    -0.00947295502f, -0.00956819486f, -0.00966304354f, -0.00975749735f, -0.00985155255f, -0.00994520728f, -0.0100384559f, -0.0101312967f,
+    -0.0102237258f, -0.0103157395f, -0.0104073351f, -0.0104985088f, -0.0105892578f, -0.0106795784f, -0.0107694669f, -0.0108589213f,
+    -0.0109479381f, -0.0110365124f, -0.0111246435f, -0.0112123266f, -0.0112995589f, -0.0113863368f, -0.0114726583f, -0.0115585197f,
+    -0.0116439182f, -0.0117288502f, -0.0118133128f, -0.0118973032f, -0.0119808177f, -0.0120638544f, -0.0121464105f, -0.0122284815f,
+    -0.0123100653f, -0.0123911593f, -0.0124717606f, -0.0125518655f, -0.0126314722f, -0.0127105778f, -0.0127891777f, -0.0128672719f,
+    -0.0129448557f, -0.0130219264f, -0.013098482f, -0.0131745199f, -0.0132500362f, -0.01332503f, -0.0133994967f, -0.0134734353f,
+    -0.0135468422f, -0.0136197153f, -0.0136920521f, -0.0137638496f, -0.0138351051f, -0.0139058167f, -0.0139759826f, -0.014045598f,
+    -0.014114663f, -0.0141831739f, -0.0142511278f, -0.0143185239f, -0.0143853584f, -0.0144516295f, -0.0145173352f, -0.0145824729f,
+    -0.0146470405f, -0.0147110354f, -0.0147744557f, -0.0148372985f, -0.014899563f, -0.0149612455f, -0.0150223449f, -0.0150828594f,
+    -0.0151427854f, -0.0152021218f, -0.0152608668f, -0.0153190186f, -0.0153765744f, -0.0154335322f, -0.0154898902f, -0.0155456476f,
+    -0.0156008005f, -0.0156553481f, -0.0157092884f, -0.0157626215f, -0.0158153418f, -0.0158674493f, -0.015918944f, -0.0159698222f,
+    -0.0160200819f, -0.0160697214f, -0.0161187407f, -0.0161671378f, -0.016214909f, -0.0162620544f, -0.016308574f, -0.0163544621f,
+    -0.0163997207f, -0.0164443459f, -0.0164883379f, -0.0165316965f, -0.0165744163f, -0.0166164991f, -0.0166579429f, -0.0166987441f,
+    -0.0167389065f, -0.0167784225f, -0.0168172959f, -0.016855523f, -0.0168931019f, -0.0169300344f, -0.016966315f, -0.0170019474f,
+    -0.017036926f, -0.0170712527f, -0.0171049256f, -0.0171379428f, -0.0171703044f, -0.0172020104f, -0.0172330569f, -0.0172634441f,
+    -0.017293172f, -0.0173222385f, -0.0173506439f, -0.0173783861f, -0.0174054652f, -0.0174318813f, -0.0174576305f, -0.0174827147f,
+    -0.0175071321f, -0.0175308827f, -0.0175539665f, -0.0175763816f, -0.0175981261f, -0.0176192019f, -0.0176396072f, -0.0176593419f,
+    -0.0176784042f, -0.017696796f, -0.0177145135f, -0.0177315604f, -0.017747933f, -0.0177636314f, -0.0177786574f, -0.0177930091f,
+    -0.0178066846f, -0.0178196859f, -0.017832011f, -0.0178436618f, -0.0178546365f, -0.0178649351f, -0.0178745575f, -0.0178835038f,
+    -0.017891774f, -0.017899368f, -0.0179062858f, -0.0179125257f, -0.0179180913f, -0.0179229788f, -0.0179271884f, -0.0179307237f,
+    -0.017933581f, -0.017935764f, -0.0179372691f, -0.0179380998f, -0.0179382544f, -0.0179377329f, -0.0179365352f, -0.0179346632f,
+    -0.017932117f, -0.0179288946f, -0.0179249998f, -0.0179204307f, -0.0179151893f, -0.0179092735f, -0.0179026853f, -0.0178954247f,
+    -0.0178874936f, -0.0178788919f, -0.0178696178f, -0.017859675f, -0.0178490635f, -0.0178377815f, -0.0178258326f, -0.017813215f,
+    -0.0177999325f, -0.0177859813f, -0.017771367f, -0.0177560877f, -0.0177401453f, -0.017723538f, -0.0177062713f, -0.0176883414f,
+    -0.0176697504f, -0.0176505018f, -0.0176305939f, -0.0176100284f, -0.0175888073f, -0.0175669305f, -0.0175443981f, -0.0175212119f,
+    -0.0174973737f, -0.0174728855f, -0.0174477454f, -0.017421959f, -0.0173955224f, -0.0173684396f, -0.0173407122f, -0.0173123404f,
+    -0.0172833242f, -0.017253669f, -0.0172233712f, -0.0171924364f, -0.0171608627f, -0.0171286538f, -0.0170958098f, -0.0170623325f,
+    -0.0170282237f, -0.0169934854f, -0.0169581156f, -0.0169221219f, -0.0168855004f, -0.0168482549f, -0.0168103874f, -0.0167718977f,
+    -0.0167327896f, -0.0166930649f, -0.0166527238f, -0.0166117679f, -0.0165701993f, -0.0165280197f, -0.0164852329f, -0.0164418388f,
+    -0.0163978375f, -0.0163532346f, -0.0163080301f, -0.0162622239f, -0.0162158217f, -0.0161688235f, -0.016121231f, -0.0160730481f,
+    -0.0160242748f, -0.0159749128f, -0.015924966f, -0.0158744343f, -0.0158233214f, -0.0157716293f, -0.0157193597f, -0.0156665146f,
+    -0.0156130958f, -0.0155591071f, -0.0155045493f, -0.0154494252f, -0.0153937377f, -0.0153374877f, -0.0152806779f, -0.0152233103f,
+    -0.0151653886f, -0.0151069146f, -0.0150478892f, -0.0149883172f, -0.0149281994f, -0.0148675386f, -0.0148063367f, -0.0147445975f,
+    -0.0146823227f, -0.0146195153f, -0.014556177f, -0.0144923106f, -0.0144279189f, -0.0143630039f, -0.0142975701f, -0.0142316176f,
+    -0.0141651509f, -0.0140981711f, -0.0140306829f, -0.013962687f, -0.0138941873f, -0.0138251865f, -0.0137556875f, -0.0136856921f,
+    -0.0136152031f, -0.0135442242f, -0.0134727582f, -0.013400808f, -0.0133283753f, -0.0132554639f, -0.0131820776f, -0.0131082172f,
+    -0.0130338874f, -0.0129590901f, -0.012883828f, -0.0128081059f, -0.0127319247f, -0.0126552889f, -0.0125782015f, -0.0125006642f,
+    -0.0124226809f, -0.0123442542f, -0.0122653889f, -0.0121860858f, -0.0121063497f, -0.0120261824f, -0.0119455885f, -0.01186457f,
+    -0.0117831305f, -0.0117012737f, -0.0116190016f, -0.0115363188f, -0.0114532271f, -0.0113697313f, -0.011285834f, -0.0112015381f,
+    -0.0111168474f, -0.0110317646f, -0.0109462943f, -0.0108604385f, -0.0107742008f, -0.010687585f, -0.0106005948f, -0.0105132321f,
+    -0.0104255015f, -0.0103374068f, -0.0102489507f, -0.010160137f, -0.0100709684f, -0.00998144969f, -0.00989158265f, -0.00980137195f,
+    -0.00971082132f, -0.00961993355f, -0.00952871237f, -0.0094371615f, -0.00934528373f, -0.00925308373f, -0.00916056521f, -0.00906773005f,
+    -0.00897458382f, -0.00888112839f, -0.00878736936f, -0.00869330857f, -0.00859894976f, -0.00850429758f, -0.00840935577f, -0.0083141271f,
+    -0.00821861532f, -0.00812282413f, -0.00802675821f, -0.00793042034f, -0.00783381425f, -0.00773694413f, -0.00763981324f, -0.0075424253f,
+    -0.00744478451f, -0.00734689459f, -0.0072487588f, -0.00715038134f, -0.00705176545f, -0.00695291581f, -0.00685383566f, -0.00675452873f,
+    -0.00665499875f, -0.00655525038f, -0.00645528641f, -0.00635511102f, -0.00625472795f, -0.00615414139f, -0.00605335506f, -0.00595237268f,
+    -0.00585119845f, -0.00574983563f, -0.00564828841f, -0.00554656098f, -0.00544465706f, -0.00534257991f, -0.0052403342f, -0.00513792364f,
+    -0.00503535196f, -0.00493262336f, -0.00482974155f, -0.00472671026f, -0.00462353416f, -0.00452021603f, -0.00441676099f, -0.00431317184f,
+    -0.00420945371f, -0.00410560938f, -0.00400164351f, -0.00389756006f, -0.00379336276f, -0.00368905556f, -0.00358464266f, -0.00348012778f,
+    -0.00337551488f, -0.00327080791f, -0.00316601107f, -0.00306112831f, -0.00295616337f, -0.0028511202f, -0.00274600321f, -0.00264081592f,
+    -0.0025355625f, -0.00243024691f, -0.00232487335f, -0.0022194453f, -0.0021139672f, -0.002008443f, -0.00190287631f, -0.00179727154f,
+    -0.00169163244f, -0.00158596318f, -0.0014802675f, -0.00137454958f, -0.00126881339f, -0.00116306287f, -0.001057302f, -0.000951534719f,
+    -0.000845765055f, -0.00073999702f, -0.000634234573f, -0.000528481731f, -0.000422742392f, -0.000317020604f, -0.000211320279f, -0.00010564542f,
+    -3.37314989e-17f, 0.000105612024f, 0.000211186678f, 0.00031671999f, 0.000422208046f, 0.000527646858f, 0.000633032469f, 0.000738360919f,
+    0.00084362831f, 0.000948830624f, 0.00105396402f, 0.00115902442f, 0.00126400811f, 0.00136891089f, 0.00147372915f, 0.0015784587f,
+    0.0016830957f, 0.00178763631f, 0.00189207657f, 0.00199641264f, 0.00210064044f, 0.00220475649f, 0.00230875635f, 0.00241263676f,
+    0.00251639332f, 0.00262002228f, 0.00272351992f, 0.00282688229f, 0.00293010566f, 0.00303318631f, 0.00313612004f, 0.00323890313f,
+    0.00334153185f, 0.00344400224f, 0.00354631082f, 0.00364845339f, 0.00375042646f, 0.00385222607f, 0.0039538485f, 0.00405529002f,
+    0.00415654667f, 0.00425761519f, 0.00435849139f, 0.00445917156f, 0.00455965195f, 0.00465992931f, 0.00475999899f, 0.00485985866f,
+    0.00495950319f, 0.00505892979f, 0.00515813474f, 0.00525711384f, 0.00535586383f, 0.005454381f, 0.00555266207f, 0.0056507024f,
+    0.00574849965f, 0.00584604964f, 0.00594334817f, 0.00604039291f, 0.00613717921f, 0.00623370381f, 0.00632996345f, 0.0064259544f,
+    0.00652167294f, 0.00661711628f, 0.00671227975f, 0.00680716103f, 0.00690175593f, 0.00699606072f, 0.00709007261f, 0.00718378834f,
+    0.00727720372f, 0.00737031549f, 0.00746312039f, 0.00755561516f, 0.00764779653f, 0.0077396608f, 0.00783120468f, 0.007922424f,
+    0.00801331736f, 0.0081038801f, 0.00819410942f, 0.00828400161f, 0.00837355293f, 0.00846276153f, 0.00855162274f, 0.00864013471f,
+    0.00872829277f, 0.00881609507f, 0.00890353695f, 0.00899061654f, 0.00907733012f, 0.0091636749f, 0.00924964715f, 0.00933524407f,
+    0.00942046288f, 0.00950529985f, 0.00958975218f, 0.00967381708f, 0.00975749083f, 0.00984077156f, 0.00992365461f, 0.0100061391f,
+    0.0100882193f, 0.0101698954f, 0.0102511616f, 0.0103320172f, 0.0104124574f, 0.0104924813f, 0.0105720842f, 0.0106512643f,
+    0.0107300179f, 0.0108083431f, 0.010886237f, 0.0109636961f, 0.0110407174f, 0.0111173f, 0.0111934394f, 0.0112691326f,
+    0.0113443788f, 0.0114191733f, 0.0114935152f, 0.0115674008f, 0.0116408272f, 0.0117137916f, 0.0117862932f, 0.0118583273f,
+    0.0119298929f, 0.0120009864f, 0.0120716058f, 0.0121417483f, 0.0122114122f, 0.0122805936f, 0.0123492917f, 0.0124175027f,
+    0.0124852238f, 0.0125524551f, 0.0126191918f, 0.0126854321f, 0.0127511742f, 0.0128164161f, 0.0128811542f, 0.0129453866f,
+    0.0130091123f, 0.0130723277f, 0.0131350309f, 0.0131972199f, 0.0132588921f, 0.0133200465f, 0.0133806793f, 0.0134407897f,
+    0.0135003757f, 0.0135594336f, 0.0136179626f, 0.0136759607f, 0.0137334252f, 0.0137903551f, 0.0138467476f, 0.0139026009f,
+    0.013957913f, 0.0140126823f, 0.0140669066f, 0.0141205853f, 0.0141737144f, 0.0142262932f, 0.0142783197f, 0.0143297929f,
+    0.0143807093f, 0.0144310687f, 0.0144808693f, 0.0145301083f, 0.0145787857f, 0.0146268979f, 0.0146744447f, 0.0147214243f,
+    0.014767834f, 0.0148136737f, 0.0148589406f, 0.0149036348f, 0.0149477525f, 0.0149912946f, 0.0150342584f, 0.0150766419f,
+    0.0151184443f, 0.0151596647f, 0.015200302f, 0.0152403535f, 0.0152798183f, 0.0153186964f, 0.015356984f, 0.0153946821f,
+    0.0154317887f, 0.0154683031f, 0.0155042224f, 0.0155395474f, 0.0155742764f, 0.0156084076f, 0.0156419408f, 0.0156748742f,
+    0.015707206f, 0.015738938f, 0.0157700665f, 0.0158005897f, 0.0158305112f, 0.0158598255f, 0.0158885345f, 0.0159166344f,
+    0.0159441289f, 0.0159710124f, 0.0159972869f, 0.0160229504f, 0.0160480011f, 0.0160724409f, 0.0160962678f, 0.016119482f,
+    0.0161420815f, 0.0161640663f, 0.0161854345f, 0.0162061863f, 0.0162263215f, 0.0162458401f, 0.0162647404f, 0.0162830222f,
+    0.0163006857f, 0.0163177308f, 0.0163341537f, 0.0163499583f, 0.0163651407f, 0.0163797028f, 0.0163936429f, 0.0164069626f,
+    0.0164196603f, 0.016431734f, 0.0164431855f, 0.0164540149f, 0.0164642222f, 0.0164738055f, 0.0164827649f, 0.0164911002f,
+    0.0164988134f, 0.0165059026f, 0.0165123679f, 0.0165182091f, 0.0165234264f, 0.0165280197f, 0.016531989f, 0.0165353362f,
+    0.0165380575f, 0.0165401567f, 0.01654163f, 0.0165424831f, 0.0165427104f, 0.0165423155f, 0.0165412985f, 0.0165396575f,
+    0.0165373962f, 0.016534511f, 0.0165310055f, 0.016526876f, 0.0165221281f, 0.0165167581f, 0.0165107679f, 0.0165041592f,
+    0.0164969284f, 0.0164890811f, 0.0164806135f, 0.0164715294f, 0.0164618269f, 0.0164515078f, 0.0164405722f, 0.0164290201f,
+    0.0164168552f, 0.0164040737f, 0.0163906794f, 0.0163766704f, 0.0163620505f, 0.0163468197f, 0.016330976f, 0.0163145233f,
+    0.0162974615f, 0.0162797924f, 0.0162615143f, 0.0162426289f, 0.0162231382f, 0.016203044f, 0.0161823444f, 0.0161610413f,
+    0.0161391385f, 0.0161166321f, 0.0160935279f, 0.0160698239f, 0.0160455219f, 0.0160206221f, 0.0159951281f, 0.0159690399f,
+    0.0159423593f, 0.0159150846f, 0.0158872195f, 0.0158587657f, 0.0158297233f, 0.0158000924f, 0.0157698765f, 0.0157390758f,
+    0.015707694f, 0.0156757273f, 0.0156431831f, 0.0156100579f, 0.0155763561f, 0.0155420778f, 0.015507224f, 0.0154717984f,
+    0.0154358009f, 0.0153992325f, 0.015362096f, 0.0153243924f, 0.0152861234f, 0.015247291f, 0.015207896f, 0.0151679413f,
+    0.0151274269f, 0.0150863556f, 0.0150447292f, 0.0150025487f, 0.0149598168f, 0.0149165345f, 0.0148727037f, 0.0148283262f,
+    0.0147834048f, 0.0147379395f, 0.014691934f, 0.0146453902f, 0.0145983081f, 0.0145506915f, 0.0145025412f, 0.01445386f,
+    0.0144046498f, 0.0143549116f, 0.0143046491f, 0.0142538631f, 0.0142025556f, 0.0141507294f, 0.0140983872f, 0.0140455291f,
+    0.0139921587f, 0.0139382789f, 0.0138838897f, 0.0138289947f, 0.0137735959f, 0.0137176961f, 0.013661297f, 0.0136044007f,
+    0.0135470089f, 0.0134891253f, 0.0134307519f, 0.0133718904f, 0.0133125437f, 0.0132527146f, 0.0131924041f, 0.0131316157f,
+    0.0130703514f, 0.0130086141f, 0.0129464064f, 0.0128837293f, 0.0128205875f, 0.0127569819f, 0.0126929153f, 0.0126283914f,
+    0.0125634111f, 0.0124979774f, 0.0124320937f, 0.0123657631f, 0.0122989863f, 0.0122317672f, 0.0121641085f, 0.012096012f,
+    0.0120274816f, 0.011958519f, 0.011889128f, 0.0118193105f, 0.0117490692f, 0.011678407f, 0.0116073275f, 0.0115358327f,
+    0.0114639252f, 0.011391608f, 0.0113188848f, 0.0112457573f, 0.0111722285f, 0.0110983029f, 0.0110239815f, 0.010949268f,
+    0.0108741643f, 0.0107986759f, 0.010722803f, 0.01064655f, 0.0105699198f, 0.0104929153f, 0.0104155391f, 0.0103377942f,
+    0.0102596851f, 0.0101812128f, 0.0101023819f, 0.0100231944f, 0.00994365383f, 0.00986376312f, 0.00978352688f, 0.00970294606f,
+    0.00962202437f, 0.00954076555f, 0.00945917238f, 0.00937724859f, 0.00929499697f, 0.00921242032f, 0.00912952237f, 0.0090463059f,
+    0.00896277465f, 0.00887893233f, 0.00879478082f, 0.00871032383f, 0.0086255651f, 0.00854050741f, 0.00845515449f, 0.00836950913f,
+    0.008283576f, 0.00819735695f, 0.00811085477f, 0.00802407507f, 0.00793701969f, 0.00784969144f, 0.00776209543f, 0.00767423352f,
+    0.00758610992f, 0.00749772787f, 0.00740909064f, 0.00732020149f, 0.00723106461f, 0.00714168232f, 0.00705205882f, 0.00696219737f,
+    0.00687210122f, 0.00678177411f, 0.00669121929f, 0.00660044048f, 0.00650944095f, 0.00641822442f, 0.00632679462f, 0.00623515435f,
+    0.00614330731f, 0.00605125725f, 0.00595900789f, 0.00586656248f, 0.00577392429f, 0.00568109751f, 0.00558808492f, 0.00549489073f,
+    0.00540151866f, 0.0053079715f, 0.00521425344f, 0.00512036774f, 0.00502631767f, 0.00493210787f, 0.00483774114f, 0.00474322122f,
+    0.00464855134f, 0.00455373619f, 0.00445877854f, 0.00436368166f, 0.0042684502f, 0.00417308696f, 0.00407759612f, 0.00398198096f,
+    0.00388624542f, 0.00379039277f, 0.00369442697f, 0.0035983515f, 0.00350217009f, 0.00340588624f, 0.00330950366f, 0.0032130261f,
+    0.00311645726f, 0.00301980064f, 0.00292306021f, 0.00282623922f, 0.00272934162f, 0.00263237092f, 0.00253533083f, 0.00243822508f,
+    0.00234105741f, 0.00224383152f, 0.00214655092f, 0.00204921933f, 0.00195184036f, 0.00185441785f, 0.0017569554f, 0.00165945676f,
+    0.00156192551f, 0.0014643654f, 0.00136678014f, 0.00126917334f, 0.00117154862f, 0.00107390981f, 0.000976260519f, 0.00087860442f,
+    0.000780945178f, 0.000683286518f, 0.000585632108f, 0.000487985555f, 0.000390350615f, 0.000292730896f, 0.000195130124f, 9.75519361e-05f,
+    -2.33802898e-17f, -9.75220173e-05f, -0.000195010449f, -0.000292461656f, -0.000389871944f, -0.000487237703f, -0.000584555208f, -0.000681820908f,
+    -0.000779031136f, -0.000876182166f, -0.000973270449f, -0.00107029232f, -0.00116724416f, -0.00126412231f, -0.00136092317f, -0.00145764311f,
+    -0.00155427854f, -0.00165082572f, -0.00174728129f, -0.0018436414f, -0.00193990266f, -0.00203606137f, -0.00213211379f, -0.00222805655f,
+    -0.00232388615f, -0.00241959887f, -0.00251519098f, -0.00261065923f, -0.00270599988f, -0.00280120946f, -0.00289628422f, -0.00299122115f,
+    -0.00308601605f, -0.0031806659f, -0.00327516696f, -0.00336951553f, -0.00346370856f, -0.00355774234f, -0.00365161337f, -0.00374531792f,
+    -0.00383885298f, -0.00393221481f, -0.00402539968f, -0.00411840482f, -0.00421122648f, -0.00430386094f, -0.00439630495f, -0.00448855525f,
+    -0.0045806081f, -0.00467246026f, -0.00476410845f, -0.00485554943f, -0.00494677946f, -0.00503779529f, -0.00512859365f, -0.00521917082f,
+    -0.00530952401f, -0.0053996495f, -0.00548954401f, -0.0055792043f, -0.0056686271f, -0.00575780915f, -0.0058467472f, -0.00593543798f,
+    -0.00602387777f, -0.00611206423f, -0.00619999319f, -0.00628766138f, -0.00637506647f, -0.00646220474f, -0.00654907292f, -0.00663566822f,
+    -0.00672198692f, -0.00680802623f, -0.00689378288f, -0.00697925361f, -0.00706443517f, -0.00714932522f, -0.00723391958f, -0.00731821591f,
+    -0.00740221096f, -0.00748590147f, -0.00756928464f, -0.00765235722f, -0.00773511641f, -0.00781755894f, -0.00789968204f, -0.00798148196f,
+    -0.00806295685f, -0.00814410299f, -0.00822491851f, -0.00830539875f, -0.00838554185f, -0.00846534409f, -0.00854480453f, -0.00862391759f,
+    -0.00870268233f, -0.00878109597f, -0.00885915384f, -0.00893685501f, -0.00901419576f, -0.0090911733f, -0.00916778482f, -0.00924402848f,
+    -0.0093198996f, -0.00939539727f, -0.00947051868f, -0.00954526011f, -0.00961961877f, -0.00969359279f, -0.00976717938f, -0.00984037574f,
+    -0.00991317909f, -0.00998558663f, -0.0100575965f, -0.010129205f, -0.0102004111f, -0.0102712112f, -0.0103416024f, -0.0104115829f,
+    -0.0104811499f, -0.0105503015f, -0.0106190341f, -0.0106873466f, -0.0107552353f, -0.0108226975f, -0.0108897332f, -0.0109563377f,
+    -0.0110225091f, -0.0110882446f, -0.0111535434f, -0.0112184025f, -0.0112828184f, -0.0113467909f, -0.0114103155f, -0.0114733921f,
+    -0.0115360171f, -0.0115981884f, -0.0116599035f, -0.0117211621f, -0.0117819598f, -0.0118422946f, -0.0119021656f, -0.0119615709f,
+    -0.0120205069f, -0.0120789725f, -0.0121369651f, -0.0121944835f, -0.0122515252f, -0.0123080881f, -0.0123641696f, -0.0124197686f,
+    -0.0124748833f, -0.0125295119f, -0.0125836516f, -0.0126373004f, -0.0126904575f, -0.012743121f, -0.0127952881f, -0.012846957f,
+    -0.0128981266f, -0.0129487952f, -0.0129989609f, -0.0130486218f, -0.0130977761f, -0.0131464219f, -0.0131945582f, -0.0132421823f,
+    -0.0132892942f, -0.0133358911f, -0.013381971f, -0.0134275332f, -0.0134725766f, -0.0135170985f, -0.013561097f, -0.013604572f,
+    -0.0136475218f, -0.0136899445f, -0.0137318391f, -0.0137732029f, -0.0138140358f, -0.0138543369f, -0.0138941025f, -0.0139333345f,
+    -0.0139720282f, -0.0140101854f, -0.0140478024f, -0.0140848793f, -0.0141214151f, -0.014157407f, -0.014192855f, -0.0142277582f,
+    -0.0142621147f, -0.0142959235f, -0.0143291848f, -0.0143618947f, -0.0143940551f, -0.0144256633f, -0.0144567182f, -0.01448722f,
+    -0.0145171667f, -0.0145465573f, -0.0145753911f, -0.0146036679f, -0.0146313859f, -0.0146585442f, -0.0146851419f, -0.0147111798f,
+    -0.0147366542f, -0.0147615671f, -0.0147859165f, -0.0148097007f, -0.0148329213f, -0.0148555748f, -0.014877663f, -0.014899184f,
+    -0.0149201378f, -0.0149405226f, -0.0149603393f, -0.014979586f, -0.0149982627f, -0.0150163695f, -0.0150339045f, -0.0150508685f,
+    -0.0150672607f, -0.0150830802f, -0.0150983268f, -0.0151130008f, -0.015127101f, -0.0151406275f, -0.0151535785f, -0.0151659558f,
+    -0.0151777584f, -0.0151889855f, -0.015199638f, -0.015209714f, -0.0152192144f, -0.0152281383f, -0.0152364867f, -0.0152442586f,
+    -0.015251454f, -0.0152580729f, -0.0152641144f, -0.0152695803f, -0.0152744688f, -0.0152787818f, -0.0152825173f, -0.0152856754f,
+    -0.015288258f, -0.015290264f, -0.0152916927f, -0.0152925458f, -0.0152928224f, -0.0152925234f, -0.0152916489f, -0.0152901979f,
+    -0.0152881723f, -0.0152855711f, -0.0152823953f, -0.0152786449f, -0.0152743198f, -0.015269421f, -0.0152639486f, -0.0152579034f,
+    -0.0152512854f, -0.0152440947f, -0.0152363321f, -0.0152279986f, -0.0152190942f, -0.015209619f, -0.0151995737f, -0.0151889594f,
+    -0.0151777761f, -0.0151660247f, -0.0151537051f, -0.0151408194f, -0.0151273664f, -0.0151133491f, -0.0150987664f, -0.0150836194f,
+    -0.0150679089f, -0.015051635f, -0.0150348004f, -0.0150174042f, -0.0149994474f, -0.0149809318f, -0.0149618573f, -0.0149422251f,
+    -0.0149220359f, -0.0149012906f, -0.0148799913f, -0.0148581378f, -0.0148357311f, -0.0148127722f, -0.0147892628f, -0.0147652039f,
+    -0.0147405956f, -0.0147154396f, -0.014689737f, -0.0146634895f, -0.0146366972f, -0.014609362f, -0.0145814857f, -0.0145530673f,
+    -0.0145241106f, -0.0144946147f, -0.0144645823f, -0.0144340144f, -0.014402912f, -0.0143712759f, -0.014339109f, -0.0143064121f,
+    -0.0142731853f, -0.0142394314f, -0.0142051522f, -0.0141703477f, -0.0141350199f, -0.0140991705f, -0.0140628014f, -0.0140259126f,
+    -0.0139885079f, -0.0139505873f, -0.0139121525f, -0.0138732055f, -0.0138337482f, -0.0137937814f, -0.013753308f, -0.0137123279f,
+    -0.013670844f, -0.0136288581f, -0.0135863712f, -0.0135433851f, -0.0134999026f, -0.0134559246f, -0.0134114539f, -0.0133664906f,
+    -0.0133210374f, -0.0132750971f, -0.0132286698f, -0.013181759f, -0.013134365f, -0.0130864913f, -0.0130381398f, -0.0129893105f,
+    -0.0129400082f, -0.0128902327f, -0.012839986f, -0.0127892718f, -0.0127380919f, -0.0126864463f, -0.0126343397f, -0.0125817722f,
+    -0.0125287464f, -0.0124752661f, -0.0124213304f, -0.0123669449f, -0.0123121087f, -0.0122568263f, -0.0122010978f, -0.0121449279f,
+    -0.0120883165f, -0.0120312674f, -0.0119737824f, -0.0119158644f, -0.0118575143f, -0.0117987348f, -0.0117395297f, -0.0116798999f,
+    -0.0116198482f, -0.0115593765f, -0.0114984885f, -0.0114371851f, -0.0113754701f, -0.0113133444f, -0.0112508116f, -0.0111878747f,
+    -0.0111245345f, -0.0110607948f, -0.0109966574f, -0.0109321261f, -0.0108672017f, -0.0108018881f, -0.010736187f, -0.0106701013f,
+    -0.0106036337f, -0.0105367862f, -0.0104695633f, -0.0104019651f, -0.0103339963f, -0.0102656586f, -0.0101969549f, -0.0101278871f,
+    -0.0100584598f, -0.00998867396f, -0.00991853233f, -0.0098480396f, -0.00977719575f, -0.00970600639f, -0.00963447243f, -0.00956259668f,
+    -0.00949038286f, -0.00941783283f, -0.00934495032f, -0.00927173812f, -0.00919819809f, -0.00912433397f, -0.00905014854f, -0.0089756446f,
+    -0.00890082493f, -0.00882569235f, -0.00875025056f, -0.00867450144f, -0.00859844778f, -0.00852209423f, -0.00844544265f, -0.00836849585f,
+    -0.00829125661f, -0.00821372867f, -0.00813591387f, -0.00805781689f, -0.00797943957f, -0.00790078565f, -0.00782185793f, -0.00774265872f,
+    -0.00766319223f, -0.00758346077f, -0.00750346761f, -0.00742321601f, -0.00734270876f, -0.00726194913f, -0.00718094036f, -0.00709968572f,
+    -0.00701818755f, -0.00693645002f, -0.00685447548f, -0.00677226763f, -0.00668982929f, -0.0066071637f, -0.00652427413f, -0.00644116383f,
+    -0.00635783561f, -0.00627429318f, -0.00619053934f, -0.00610657781f, -0.0060224114f, -0.00593804335f, -0.00585347693f, -0.0057687154f,
+    -0.00568376202f, -0.00559862005f, -0.00551329274f, -0.00542778336f, -0.00534209562f, -0.00525623187f, -0.00517019629f, -0.00508399168f,
+    -0.00499762129f, -0.00491108885f, -0.00482439715f, -0.00473754993f, -0.00465054996f, -0.00456340145f, -0.00447610673f, -0.00438866997f,
+    -0.00430109398f, -0.00421338202f, -0.00412553828f, -0.00403756509f, -0.00394946616f, -0.00386124477f, -0.00377290463f, -0.00368444878f,
+    -0.00359588047f, -0.00350720366f, -0.00341842091f, -0.00332953641f, -0.00324055296f, -0.00315147405f, -0.00306230318f, -0.00297304359f,
+    -0.00288369902f, -0.00279427227f, -0.00270476728f, -0.00261518732f, -0.00252553541f, -0.00243581529f, -0.00234603044f, -0.00225618412f,
+    -0.00216627959f, -0.00207632035f, -0.00198630989f, -0.00189625158f, -0.00180614879f, -0.00171600492f, -0.00162582344f, -0.00153560773f,
+    -0.00144536118f, -0.00135508715f, -0.00126478903f, -0.00117447041f, -0.00108413445f, -0.00099378475f, -0.00090342469f, -0.000813057588f,
+    -0.000722686877f, -0.000632315991f, -0.000541948306f, -0.000451587257f, -0.000361236191f, -0.000270898541f, -0.000180577699f, -9.02770553e-05f,
+    -3.24278855e-17f, 9.02500688e-05f, 0.000180469753f, 0.000270655699f, 0.000360804464f, 0.000450912717f, 0.000540977053f, 0.000630994153f,
+    0.000720960496f, 0.00081087288f, 0.000900727813f, 0.000990521978f, 0.00108025211f, 0.00116991461f, 0.00125950645f, 0.00134902389f,
+    0.00143846392f, 0.00152782304f, 0.00161709788f, 0.00170628517f, 0.00179538166f, 0.00188438385f, 0.0019732886f, 0.0020620923f,
+    0.00215079193f, 0.00223938399f, 0.00232786546f, 0.0024162326f, 0.00250448263f, 0.00259261183f, 0.00268061715f, 0.00276849512f,
+    0.0028562427f, 0.00294385664f, 0.00303133344f, 0.00311866985f, 0.00320586306f, 0.00329290912f, 0.00337980548f, 0.00346654863f,
+    0.00355313532f, 0.00363956229f, 0.00372582651f, 0.00381192449f, 0.00389785343f, 0.00398360984f, 0.00406919094f, 0.00415459275f,
+    0.00423981296f, 0.00432484783f, 0.00440969504f, 0.0044943504f, 0.00457881112f, 0.00466307439f, 0.00474713696f, 0.00483099604f,
+    0.0049146479f, 0.00499808975f, 0.00508131832f, 0.00516433083f, 0.00524712401f, 0.00532969506f, 0.00541204074f, 0.00549415825f,
+    0.00557604386f, 0.0056576957f, 0.00573910959f, 0.0058202832f, 0.00590121374f, 0.00598189794f, 0.00606233254f, 0.00614251476f,
+    0.00622244226f, 0.00630211132f, 0.00638151914f, 0.0064606634f, 0.00653954037f, 0.00661814772f, 0.00669648265f, 0.00677454146f,
+    0.00685232226f, 0.00692982227f, 0.00700703776f, 0.0070839664f, 0.0071606054f, 0.00723695196f, 0.00731300283f, 0.00738875614f,
+    0.00746420864f, 0.00753935752f, 0.0076142f, 0.00768873328f, 0.00776295504f, 0.00783686247f, 0.00791045278f, 0.00798372272f,
+    0.00805667043f, 0.00812929403f, 0.00820158888f, 0.0082735531f, 0.00834518485f, 0.00841648132f, 0.00848743878f, 0.00855805632f,
+    0.00862833019f, 0.00869825762f, 0.00876783766f, 0.00883706566f, 0.00890594162f, 0.00897446088f, 0.00904262159f, 0.00911042187f,
+    0.00917785894f, 0.00924493093f, 0.00931163412f, 0.00937796663f, 0.00944392662f, 0.00950951129f, 0.00957471784f, 0.00963954441f,
+    0.00970398914f, 0.00976804923f, 0.00983172283f, 0.00989500713f, 0.00995789934f, 0.0100203976f, 0.010082501f, 0.0101442058f,
+    0.0102055101f, 0.010266412f, 0.0103269089f, 0.0103869988f, 0.0104466807f, 0.0105059501f, 0.0105648069f, 0.0106232483f,
+    0.0106812725f, 0.0107388766f, 0.0107960599f, 0.0108528193f, 0.0109091531f, 0.0109650595f, 0.0110205365f, 0.0110755814f,
+    0.0111301932f, 0.0111843692f, 0.0112381084f, 0.0112914089f, 0.0113442671f, 0.0113966838f, 0.0114486543f, 0.0115001788f,
+    0.0115512554f, 0.0116018811f, 0.0116520552f, 0.0117017757f, 0.0117510408f, 0.0117998486f, 0.0118481973f, 0.0118960859f,
+    0.0119435126f, 0.0119904745f, 0.0120369717f, 0.0120830014f, 0.0121285617f, 0.0121736526f, 0.0122182714f, 0.012262417f,
+    0.0123060877f, 0.0123492824f, 0.0123919984f, 0.0124342358f, 0.0124759916f, 0.012517266f, 0.012558056f, 0.0125983618f,
+    0.0126381805f, 0.0126775112f, 0.0127163539f, 0.0127547057f, 0.0127925649f, 0.0128299324f, 0.0128668053f, 0.0129031828f,
+    0.0129390629f, 0.0129744457f, 0.0130093293f, 0.0130437119f, 0.0130775943f, 0.0131109729f, 0.0131438486f, 0.0131762195f,
+    0.0132080847f, 0.0132394433f, 0.0132702934f, 0.0133006349f, 0.013330467f, 0.0133597879f, 0.0133885965f, 0.0134168928f,
+    0.0134446751f, 0.0134719433f, 0.0134986956f, 0.0135249319f, 0.0135506513f, 0.0135758519f, 0.0136005348f, 0.0136246979f,
+    0.0136483405f, 0.0136714624f, 0.0136940628f, 0.0137161398f, 0.0137376944f, 0.0137587255f, 0.0137792323f, 0.0137992129f,
+    0.0138186691f, 0.0138375992f, 0.0138560021f, 0.0138738779f, 0.0138912257f, 0.0139080454f, 0.0139243361f, 0.0139400978f,
+    0.0139553305f, 0.0139700323f, 0.0139842033f, 0.0139978444f, 0.0140109537f, 0.0140235322f, 0.0140355779f, 0.0140470918f,
+    0.014058074f, 0.0140685225f, 0.0140784392f, 0.0140878223f, 0.0140966717f, 0.0141049875f, 0.0141127706f, 0.014120019f,
+    0.0141267339f, 0.0141329141f, 0.0141385617f, 0.0141436737f, 0.0141482521f, 0.0141522968f, 0.014155807f, 0.0141587825f,
+    0.0141612245f, 0.0141631328f, 0.0141645065f, 0.0141653465f, 0.0141656529f, 0.0141654257f, 0.0141646657f, 0.0141633712f,
+    0.0141615449f, 0.0141591849f, 0.0141562931f, 0.0141528687f, 0.0141489124f, 0.0141444243f, 0.0141394055f, 0.0141338548f,
+    0.0141277742f, 0.0141211627f, 0.0141140213f, 0.014106351f, 0.0140981516f, 0.0140894232f, 0.0140801677f, 0.0140703842f,
+    0.0140600735f, 0.0140492367f, 0.0140378736f, 0.0140259862f, 0.0140135726f, 0.0140006356f, 0.0139871761f, 0.0139731923f,
+    0.013958687f, 0.013943661f, 0.0139281135f, 0.0139120463f, 0.0138954595f, 0.0138783548f, 0.0138607323f, 0.0138425929f,
+    0.0138239386f, 0.0138047682f, 0.0137850838f, 0.0137648853f, 0.0137441754f, 0.0137229534f, 0.0137012219f, 0.0136789801f,
+    0.0136562297f, 0.0136329718f, 0.0136092072f, 0.013584937f, 0.0135601619f, 0.0135348849f, 0.013509104f, 0.013482823f,
+    0.0134560419f, 0.0134287616f, 0.013400984f, 0.01337271f, 0.0133439405f, 0.0133146774f, 0.0132849207f, 0.0132546723f,
+    0.0132239349f, 0.0131927077f, 0.0131609933f, 0.0131287919f, 0.0130961062f, 0.0130629363f, 0.0130292848f, 0.0129951527f,
+    0.0129605411f, 0.0129254516f, 0.0128898853f, 0.0128538441f, 0.0128173297f, 0.0127803432f, 0.0127428873f, 0.012704961f,
+    0.0126665682f, 0.0126277097f, 0.0125883874f, 0.0125486022f, 0.012508356f, 0.0124676507f, 0.0124264881f, 0.0123848692f,
+    0.0123427967f, 0.0123002715f, 0.0122572957f, 0.0122138709f, 0.0121699991f, 0.0121256812f, 0.0120809199f, 0.0120357173f,
+    0.011990075f, 0.0119439941f, 0.0118974773f, 0.0118505256f, 0.0118031418f, 0.0117553277f, 0.0117070843f, 0.0116584143f,
+    0.0116093205f, 0.011559803f, 0.0115098646f, 0.011459508f, 0.0114087351f, 0.0113575468f, 0.0113059459f, 0.0112539344f,
+    0.0112015149f, 0.0111486884f, 0.0110954577f, 0.0110418247f, 0.0109877922f, 0.010933361f, 0.010878535f, 0.010823315f,
+    0.0107677029f, 0.0107117025f, 0.0106553156f, 0.0105985431f, 0.0105413888f, 0.0104838535f, 0.0104259411f, 0.0103676533f,
+    0.0103089912f, 0.0102499593f, 0.0101905577f, 0.0101307901f, 0.0100706592f, 0.0100101661f, 0.00994931348f, 0.00988810509f,
+    0.00982654095f, 0.00976462569f, 0.00970236119f, 0.0096397493f, 0.00957679283f, 0.00951349363f, 0.00944985542f, 0.00938588008f,
+    0.00932156947f, 0.0092569273f, 0.00919195544f, 0.00912665669f, 0.00906103291f, 0.00899508782f, 0.00892882235f, 0.00886224117f,
+    0.0087953452f, 0.00872813724f, 0.00866062101f, 0.00859279837f, 0.00852467213f, 0.00845624506f, 0.00838751905f, 0.0083184978f,
+    0.00824918319f, 0.00817957893f, 0.00810968596f, 0.00803950895f, 0.00796904974f, 0.00789831113f, 0.00782729592f, 0.00775600597f,
+    0.00768444547f, 0.00761261676f, 0.00754052214f, 0.0074681649f, 0.00739554781f, 0.00732267322f, 0.00724954437f, 0.00717616407f,
+    0.00710253464f, 0.00702865981f, 0.0069545419f, 0.0068801837f, 0.00680558849f, 0.00673075859f, 0.00665569725f, 0.00658040727f,
+    0.00650489144f, 0.00642915303f, 0.00635319483f, 0.00627701916f, 0.00620063022f, 0.0061240294f, 0.0060472209f, 0.00597020704f,
+    0.00589299109f, 0.00581557583f, 0.00573796406f, 0.00566015905f, 0.00558216358f, 0.00550398091f, 0.00542561384f, 0.00534706563f,
+    0.00526833907f, 0.00518943695f, 0.00511036254f, 0.0050311191f, 0.00495170942f, 0.00487213628f, 0.00479240343f, 0.00471251318f,
+    0.0046324688f, 0.00455227355f, 0.00447193021f, 0.00439144205f, 0.00431081234f, 0.00423004385f, 0.00414913986f, 0.00406810315f,
+    0.00398693699f, 0.00390564441f, 0.00382422865f, 0.00374269253f, 0.00366103975f, 0.00357927266f, 0.00349739497f, 0.00341540948f,
+    0.00333331944f, 0.0032511279f, 0.00316883787f, 0.00308645284f, 0.00300397561f, 0.00292140944f, 0.00283875735f, 0.00275602262f,
+    0.00267320825f, 0.00259031751f, 0.00250735367f, 0.00242431951f, 0.00234121853f, 0.00225805352f, 0.00217482797f, 0.00209154491f,
+    0.00200820738f, 0.00192481861f, 0.00184138177f, 0.00175790011f, 0.00167437666f, 0.00159081456f, 0.00150721706f, 0.00142358721f,
+    0.00133992825f, 0.00125624344f, 0.0011725357f, 0.00108880829f, 0.00100506446f, 0.000921307248f, 0.000837539847f, 0.000753765402f,
+    0.000669987116f, 0.000586208131f, 0.000502431591f, 0.000418660638f, 0.000334898417f, 0.0002511481f, 0.000167412814f, 8.36957406e-05f,
+    8.01874047e-17f, -8.36712497e-05f, -0.00016731488f, -0.000250927726f, -0.00033450668f, -0.000418048556f, -0.000501550268f, -0.000585008704f,
+    -0.000668420631f, -0.000751783024f, -0.000835092738f, -0.000918346632f, -0.00100154162f, -0.0010846745f, -0.0011677423f, -0.00125074177f,
+    -0.00133366988f, -0.00141652348f, -0.00149929966f, -0.00158199505f, -0.00166460662f, -0.00174713146f, -0.00182956643f, -0.00191190827f,
+    -0.00199415418f, -0.00207630079f, -0.00215834519f, -0.00224028458f, -0.00232211547f, -0.00240383507f, -0.00248544011f, -0.00256692781f,
+    -0.0026482949f, -0.0027295386f, -0.00281065586f, -0.00289164344f, -0.00297249854f, -0.00305321789f, -0.00313379895f, -0.00321423821f,
+    -0.00329453312f, -0.00337468041f, -0.00345467706f, -0.00353452051f, -0.00361420726f, -0.00369373476f, -0.00377309998f, -0.00385229988f,
+    -0.00393133145f, -0.00401019212f, -0.00408887863f, -0.00416738819f, -0.00424571801f, -0.00432386482f, -0.00440182583f, -0.00447959872f,
+    -0.00455718022f, -0.00463456707f, -0.00471175695f, -0.00478874706f, -0.00486553414f, -0.0049421154f, -0.0050184885f, -0.0050946502f,
+    -0.00517059769f, -0.00524632866f, -0.00532183982f, -0.00539712841f, -0.00547219161f, -0.0055470271f, -0.00562163163f, -0.00569600286f,
+    -0.005770138f, -0.00584403379f, -0.00591768837f, -0.00599109847f, -0.00606426131f, -0.00613717455f, -0.00620983541f, -0.00628224108f,
+    -0.00635438925f, -0.0064262771f, -0.00649790186f, -0.0065692612f, -0.00664035184f, -0.00671117194f, -0.00678171916f, -0.00685198978f,
+    -0.00692198193f, -0.00699169328f, -0.00706112059f, -0.00713026198f, -0.00719911465f, -0.00726767629f, -0.0073359441f, -0.00740391575f,
+    -0.00747158891f, -0.00753896078f, -0.00760602904f, -0.00767279137f, -0.00773924543f, -0.00780538842f, -0.00787121803f, -0.00793673284f,
+    -0.00800192915f, -0.00806680508f, -0.00813135784f, -0.00819558557f, -0.00825948641f, -0.00832305755f, -0.00838629715f, -0.0084492024f,
+    -0.00851177052f, -0.00857400056f, -0.00863588881f, -0.00869743433f, -0.00875863433f, -0.00881948601f, -0.00887998845f, -0.00894013885f,
+    -0.00899993442f, -0.00905937422f, -0.00911845546f, -0.00917717628f, -0.00923553389f, -0.00929352734f, -0.00935115386f, -0.00940841064f,
+    -0.00946529768f, -0.00952181034f, -0.0095779486f, -0.00963370968f, -0.0096890917f, -0.00974409375f, -0.00979871117f, -0.00985294487f,
+    -0.00990679115f, -0.00996024907f, -0.0100133158f, -0.0100659905f, -0.0101182703f, -0.0101701543f, -0.0102216396f, -0.0102727255f,
+    -0.010323409f, -0.0103736892f, -0.0104235644f, -0.0104730325f, -0.0105220918f, -0.0105707413f, -0.0106189772f, -0.0106667997f,
+    -0.0107142068f, -0.0107611967f, -0.0108077675f, -0.0108539173f, -0.0108996453f, -0.0109449495f, -0.010989828f, -0.0110342801f,
+    -0.0110783037f, -0.011121897f, -0.0111650592f, -0.0112077873f, -0.0112500815f, -0.0112919398f, -0.0113333613f, -0.0113743432f,
+    -0.0114148846f, -0.0114549855f, -0.0114946421f, -0.0115338545f, -0.0115726218f, -0.011610942f, -0.0116488133f, -0.0116862347f,
+    -0.0117232054f, -0.0117597235f, -0.011795789f, -0.0118313991f, -0.0118665537f, -0.011901251f, -0.0119354893f, -0.0119692693f,
+    -0.0120025882f, -0.0120354453f, -0.0120678395f, -0.0120997699f, -0.0121312356f, -0.0121622356f, -0.012192768f, -0.012222833f,
+    -0.0122524276f, -0.0122815538f, -0.0123102078f, -0.0123383906f, -0.0123661002f, -0.0123933358f, -0.0124200974f, -0.012446383f,
+    -0.0124721928f, -0.0124975247f, -0.0125223789f, -0.0125467544f, -0.0125706503f, -0.0125940656f, -0.0126170004f, -0.0126394527f,
+    -0.0126614226f, -0.0126829091f, -0.0127039123f, -0.0127244303f, -0.012744464f, -0.0127640115f, -0.0127830729f, -0.0128016472f,
+    -0.0128197335f, -0.0128373317f, -0.012854442f, -0.0128710633f, -0.0128871948f, -0.0129028363f, -0.0129179871f, -0.012932647f,
+    -0.0129468162f, -0.0129604936f, -0.0129736783f, -0.0129863713f, -0.0129985707f, -0.0130102774f, -0.0130214915f, -0.013032211f,
+    -0.0130424369f, -0.0130521683f, -0.0130614061f, -0.0130701484f, -0.0130783971f, -0.0130861504f, -0.0130934082f, -0.0131001715f,
+    -0.0131064383f, -0.0131122107f, -0.0131174875f, -0.013122269f, -0.013126554f, -0.0131303445f, -0.0131336385f, -0.0131364372f,
+    -0.0131387413f, -0.013140549f, -0.0131418612f, -0.013142678f, -0.0131430002f, -0.013142827f, -0.0131421592f, -0.013140996f,
+    -0.0131393392f, -0.0131371869f, -0.0131345419f, -0.0131314015f, -0.0131277684f, -0.0131236417f, -0.0131190224f, -0.0131139103f,
+    -0.0131083056f, -0.0131022083f, -0.0130956201f, -0.0130885402f, -0.0130809695f, -0.0130729089f, -0.0130643575f, -0.0130553171f,
+    -0.0130457869f, -0.0130357696f, -0.0130252633f, -0.0130142691f, -0.0130027886f, -0.0129908221f, -0.0129783694f, -0.0129654314f,
+    -0.0129520092f, -0.0129381027f, -0.0129237128f, -0.0129088406f, -0.0128934868f, -0.0128776524f, -0.0128613366f, -0.012844542f,
+    -0.0128272679f, -0.0128095159f, -0.0127912862f, -0.0127725806f, -0.0127534f, -0.0127337435f, -0.0127136139f, -0.0126930112f,
+    -0.0126719363f, -0.0126503902f, -0.0126283737f, -0.0126058878f, -0.0125829345f, -0.0125595136f, -0.012535627f, -0.0125112748f,
+    -0.0124864578f, -0.012461178f, -0.0124354372f, -0.0124092344f, -0.0123825725f, -0.0123554524f, -0.0123278741f, -0.0122998394f,
+    -0.0122713502f, -0.0122424066f, -0.0122130103f, -0.0121831624f, -0.0121528655f, -0.0121221188f, -0.0120909242f, -0.0120592834f,
+    -0.0120271984f, -0.0119946692f, -0.0119616976f, -0.0119282845f, -0.0118944328f, -0.0118601425f, -0.0118254153f, -0.0117902532f,
+    -0.0117546571f, -0.0117186289f, -0.0116821695f, -0.0116452808f, -0.0116079636f, -0.0115702208f, -0.0115320524f, -0.0114934612f,
+    -0.011454449f, -0.0114150159f, -0.0113751646f, -0.0113348961f, -0.0112942122f, -0.0112531157f, -0.0112116067f, -0.0111696869f,
+    -0.0111273592f, -0.0110846246f, -0.0110414848f, -0.0109979417f, -0.0109539973f, -0.0109096523f, -0.0108649097f, -0.0108197713f,
+    -0.010774238f, -0.0107283117f, -0.0106819952f, -0.0106352903f, -0.010588197f, -0.0105407191f, -0.0104928585f, -0.010444616f,
+    -0.0103959944f, -0.0103469957f, -0.0102976207f, -0.0102478722f, -0.0101977531f, -0.0101472633f, -0.0100964066f, -0.0100451838f,
+    -0.00999359787f, -0.00994165055f, -0.00988934375f, -0.00983667932f, -0.00978366006f, -0.00973028783f, -0.00967656355f, -0.00962249096f,
+    -0.00956807192f, -0.00951330829f, -0.00945820194f, -0.00940275472f, -0.00934697036f, -0.00929084979f, -0.00923439488f, -0.00917760935f,
+    -0.00912049413f, -0.00906305201f, -0.00900528487f, -0.00894719549f, -0.00888878666f, -0.00883005932f, -0.00877101626f, -0.00871166028f,
+    -0.00865199231f, -0.00859201699f, -0.00853173435f, -0.00847114902f, -0.00841026101f, -0.00834907405f, -0.00828759093f, -0.00822581258f,
+    -0.00816374272f, -0.00810138416f, -0.00803873688f, -0.00797580648f, -0.00791259296f, -0.00784909911f, -0.00778532913f, -0.00772128394f,
+    -0.00765696634f, -0.00759237912f, -0.00752752414f, -0.00746240467f, -0.00739702303f, -0.00733138155f, -0.00726548303f, -0.00719932979f,
+    -0.00713292463f, -0.00706626987f, -0.00699936831f, -0.00693222228f, -0.00686483458f, -0.00679720752f, -0.00672934437f, -0.00666124746f,
+    -0.00659291865f, -0.00652436167f, -0.00645557884f, -0.00638657296f, -0.00631734589f, -0.00624790089f, -0.00617824122f, -0.00610836828f,
+    -0.00603828579f, -0.00596799608f, -0.00589750148f, -0.00582680572f, -0.00575591018f, -0.00568481861f, -0.00561353378f, -0.00554205757f,
+    -0.00547039369f, -0.00539854402f, -0.00532651227f, -0.00525430031f, -0.00518191094f, -0.00510934787f, -0.00503661297f, -0.00496370951f,
+    -0.0048906398f, -0.00481740711f, -0.00474401424f, -0.00467046397f, -0.00459675863f, -0.00452290149f, -0.00444889534f, -0.00437474297f,
+    -0.00430044718f, -0.00422601076f, -0.00415143697f, -0.00407672767f, -0.00400188705f, -0.00392691651f, -0.00385182025f, -0.00377660035f,
+    -0.00370125985f, -0.00362580176f, -0.0035502289f, -0.0034745438f, -0.00339874998f, -0.00332284975f, -0.00324684614f, -0.00317074242f,
+    -0.00309454091f, -0.0030182451f, -0.00294185732f, -0.00286538084f, -0.00278881844f, -0.00271217292f, -0.00263544754f, -0.00255864486f,
+    -0.00248176791f, -0.00240481971f, -0.00232780282f, -0.00225072075f, -0.00217357581f, -0.00209637149f, -0.00201911014f, -0.00194179523f,
+    -0.00186442933f, -0.00178701547f, -0.00170955656f, -0.00163205562f, -0.00155451545f, -0.00147693895f, -0.00139932928f, -0.00132168911f,
+    -0.00124402158f, -0.00116632949f, -0.00108861586f, -0.0010108836f, -0.000933135569f, -0.00085537479f, -0.000777604117f, -0.000699826574f,
+    -0.000622044958f, -0.000544262351f, -0.000466481579f, -0.000388705579f, -0.000310937321f, -0.000233179715f, -0.000155435671f, -7.77081295e-05f,
+    -3.10147069e-17f, 7.76857923e-05f, 0.000155346337f, 0.000232978709f, 0.000310579984f, 0.00038814728f, 0.000465677644f, 0.000543168222f,
+    0.000620616018f, 0.000698018237f, 0.000775371911f, 0.000852674188f, 0.000929922098f, 0.00100711279f, 0.00108424341f, 0.00116131105f,
+    0.00123831269f, 0.00131524575f, 0.00139210699f, 0.00146889384f, 0.00154560327f, 0.00162223249f, 0.00169877859f, 0.00177523878f,
+    0.00185161014f, 0.00192788977f, 0.00200407486f, 0.00208016275f, 0.00215615029f, 0.00223203492f, 0.00230781361f, 0.00238348357f,
+    0.00245904224f, 0.00253448635f, 0.00260981359f, 0.00268502091f, 0.0027601053f, 0.00283506443f, 0.00290989503f, 0.00298459479f,
+    0.00305916043f, 0.00313358963f, 0.00320787961f, 0.00328202709f, 0.00335602998f, 0.00342988502f, 0.00350358989f, 0.00357714156f,
+    0.00365053746f, 0.0037237748f, 0.0037968508f, 0.00386976288f, 0.00394250825f, 0.00401508436f, 0.00408748863f, 0.00415971782f,
+    0.00423176959f, 0.00430364162f, 0.00437533064f, 0.00444683479f, 0.00451815035f, 0.00458927592f, 0.00466020778f, 0.00473094406f,
+    0.0048014815f, 0.00487181824f, 0.00494195148f, 0.00501187798f, 0.00508159585f, 0.00515110279f, 0.00522039505f, 0.00528947124f,
+    0.00535832858f, 0.00542696426f, 0.00549537595f, 0.00556356087f, 0.00563151669f, 0.00569924107f, 0.00576673122f, 0.00583398482f,
+    0.00590099953f, 0.00596777303f, 0.00603430253f, 0.00610058568f, 0.00616661971f, 0.00623240275f, 0.00629793247f, 0.00636320608f,
+    0.00642822124f, 0.0064929761f, 0.00655746739f, 0.00662169326f, 0.00668565137f, 0.0067493394f, 0.00681275548f, 0.00687589636f,
+    0.00693876017f, 0.00700134458f, 0.00706364773f, 0.00712566637f, 0.00718739955f, 0.00724884402f, 0.00730999792f, 0.00737085892f,
+    0.00743142515f, 0.0074916943f, 0.00755166356f, 0.00761133153f, 0.00767069543f, 0.00772975385f, 0.00778850401f, 0.00784694403f,
+    0.00790507253f, 0.00796288531f, 0.00802038237f, 0.00807756092f, 0.0081344191f, 0.0081909541f, 0.00824716501f, 0.00830304902f,
+    0.00835860427f, 0.00841382891f, 0.00846872013f, 0.00852327794f, 0.00857749861f, 0.00863138027f, 0.00868492201f, 0.00873812102f,
+    0.00879097544f, 0.00884348433f, 0.00889564492f, 0.00894745532f, 0.00899891462f, 0.00905001909f, 0.00910076965f, 0.00915116165f,
+    0.00920119509f, 0.00925086718f, 0.00930017699f, 0.00934912264f, 0.00939770229f, 0.00944591407f, 0.00949375611f, 0.00954122655f,
+    0.0095883254f, 0.00963504799f, 0.00968139526f, 0.00972736441f, 0.00977295451f, 0.00981816277f, 0.00986298919f, 0.00990743097f,
+    0.00995148718f, 0.00999515504f, 0.0100384345f, 0.0100813238f, 0.010123821f, 0.0101659251f, 0.0102076335f, 0.010248946f,
+    0.0102898609f, 0.0103303771f, 0.010370492f, 0.0104102045f, 0.0104495138f, 0.0104884189f, 0.0105269169f, 0.010565008f,
+    0.0106026903f, 0.0106399627f, 0.0106768236f, 0.0107132718f, 0.0107493065f, 0.010784925f, 0.010820128f, 0.0108549139f,
+    0.0108892797f, 0.0109232264f, 0.0109567521f, 0.010989856f, 0.0110225352f, 0.0110547915f, 0.0110866213f, 0.0111180246f,
+    0.0111490004f, 0.0111795468f, 0.0112096639f, 0.0112393508f, 0.0112686055f, 0.0112974271f, 0.0113258157f, 0.0113537693f,
+    0.0113812871f, 0.0114083681f, 0.0114350123f, 0.0114612188f, 0.0114869848f, 0.0115123121f, 0.011537198f, 0.0115616424f,
+    0.0115856444f, 0.0116092032f, 0.0116323177f, 0.0116549879f, 0.011677213f, 0.0116989911f, 0.011720323f, 0.011741207f,
+    0.0117616439f, 0.011781631f, 0.0118011693f, 0.0118202567f, 0.0118388943f, 0.0118570803f, 0.0118748145f, 0.0118920971f,
+    0.0119089261f, 0.0119253024f, 0.0119412253f, 0.0119566927f, 0.0119717065f, 0.011986264f, 0.012000367f, 0.0120140137f,
+    0.012027204f, 0.0120399371f, 0.0120522138f, 0.0120640332f, 0.0120753944f, 0.0120862974f, 0.0120967431f, 0.0121067297f,
+    0.0121162571f, 0.0121253263f, 0.0121339355f, 0.0121420855f, 0.0121497763f, 0.0121570071f, 0.0121637778f, 0.0121700885f,
+    0.012175939f, 0.0121813295f, 0.012186259f, 0.0121907294f, 0.0121947387f, 0.012198288f, 0.0122013763f, 0.0122040045f,
+    0.0122061726f, 0.0122078797f, 0.0122091267f, 0.0122099146f, 0.0122102415f, 0.0122101083f, 0.012209516f, 0.0122084636f,
+    0.0122069521f, 0.0122049805f, 0.0122025507f, 0.0121996617f, 0.0121963136f, 0.0121925082f, 0.0121882437f, 0.0121835219f,
+    0.0121783428f, 0.0121727055f, 0.0121666128f, 0.0121600628f, 0.0121530565f, 0.0121455956f, 0.0121376785f, 0.0121293068f,
+    0.0121204806f, 0.0121112f, 0.0121014668f, 0.01209128f, 0.0120806415f, 0.0120695503f, 0.0120580085f, 0.0120460149f,
+    0.0120335715f, 0.0120206783f, 0.0120073361f, 0.011993546f, 0.011979308f, 0.0119646229f, 0.0119494908f, 0.0119339135f,
+    0.011917891f, 0.0119014243f, 0.0118845142f, 0.0118671609f, 0.0118493661f, 0.0118311308f, 0.0118124541f, 0.0117933378f,
+    0.0117737828f, 0.011753791f, 0.0117333615f, 0.0117124952f, 0.011691195f, 0.0116694598f, 0.0116472915f, 0.0116246911f,
+    0.0116016595f, 0.0115781976f, 0.0115543054f, 0.0115299858f, 0.0115052387f, 0.0114800651f, 0.0114544658f, 0.0114284437f,
+    0.0114019979f, 0.0113751302f, 0.0113478415f, 0.0113201337f, 0.0112920078f, 0.0112634636f, 0.0112345042f, 0.0112051293f,
+    0.0111753419f, 0.011145141f, 0.0111145293f, 0.0110835079f, 0.0110520776f, 0.0110202404f, 0.0109879971f, 0.0109553486f,
+    0.0109222978f, 0.0108888447f, 0.0108549902f, 0.010820738f, 0.0107860873f, 0.0107510397f, 0.0107155982f, 0.0106797628f,
+    0.0106435353f, 0.0106069176f, 0.0105699105f, 0.0105325161f, 0.0104947351f, 0.0104565704f, 0.0104180221f, 0.0103790928f,
+    0.0103397835f, 0.0103000961f, 0.0102600325f, 0.0102195935f, 0.0101787811f, 0.0101375971f, 0.0100960433f, 0.0100541208f,
+    0.0100118313f, 0.00996917672f, 0.00992615987f, 0.00988278072f, 0.00983904116f, 0.00979494397f, 0.00975049101f, 0.00970568322f,
+    0.00966052245f, 0.00961501058f, 0.00956914946f, 0.00952294096f, 0.00947638787f, 0.00942949019f, 0.00938225072f, 0.00933467224f,
+    0.00928675476f, 0.00923850201f, 0.00918991398f, 0.0091409944f, 0.0090917442f, 0.00904216617f, 0.00899226125f, 0.00894203223f,
+    0.00889148004f, 0.00884060841f, 0.00878941733f, 0.00873791054f, 0.00868608803f, 0.00863395445f, 0.00858150981f, 0.00852875784f,
+    0.00847569853f, 0.00842233561f, 0.00836867094f, 0.00831470545f, 0.00826044288f, 0.00820588507f, 0.00815103296f, 0.00809588935f,
+    0.00804045703f, 0.00798473787f, 0.00792873371f, 0.00787244644f, 0.00781587884f, 0.00775903277f, 0.00770191103f, 0.00764451548f,
+    0.00758684799f, 0.00752891134f, 0.00747070787f, 0.00741223898f, 0.00735350791f, 0.00729451654f, 0.00723526767f, 0.00717576267f,
+    0.00711600436f, 0.00705599505f, 0.00699573709f, 0.00693523278f, 0.00687448448f, 0.00681349449f, 0.00675226562f, 0.00669079926f,
+    0.00662909867f, 0.00656716619f, 0.00650500366f, 0.0064426139f, 0.00637999922f, 0.00631716195f, 0.00625410443f, 0.00619082944f,
+    0.00612733979f, 0.00606363686f, 0.00599972392f, 0.00593560282f, 0.00587127684f, 0.00580674782f, 0.00574201811f, 0.00567709096f,
+    0.00561196823f, 0.00554665271f, 0.00548114674f, 0.00541545311f, 0.00534957414f, 0.00528351264f, 0.00521727046f, 0.00515085086f,
+    0.00508425618f, 0.00501748873f, 0.00495055178f, 0.00488344673f, 0.0048161773f, 0.00474874536f, 0.00468115369f, 0.00461340509f,
+    0.00454550143f, 0.00447744643f, 0.00440924196f, 0.00434089079f, 0.00427239574f, 0.00420375867f, 0.00413498329f, 0.00406607147f,
+    0.00399702601f, 0.00392785016f, 0.00385854533f, 0.00378911523f, 0.00371956197f, 0.00364988833f, 0.00358009711f, 0.00351019087f,
+    0.00344017218f, 0.00337004382f, 0.0032998086f, 0.00322946883f, 0.00315902755f, 0.00308848708f, 0.00301785045f, 0.00294712023f,
+    0.00287629897f, 0.0028053897f, 0.00273439474f, 0.0026633169f, 0.00259215897f, 0.0025209235f, 0.0024496133f, 0.00237823115f,
+    0.00230677961f, 0.00223526149f, 0.00216367957f, 0.00209203642f, 0.00202033482f, 0.00194857735f, 0.00187676691f, 0.00180490618f,
+    0.00173299783f, 0.00166104466f, 0.00158904924f, 0.00151701446f, 0.0014449429f, 0.00137283735f, 0.00130070059f, 0.00122853532f,
+    0.00115634419f, 0.00108413002f, 0.00101189548f, 0.000939643302f, 0.00086737622f, 0.000795096916f, 0.00072280824f, 0.000650512753f,
+    0.000578213308f, 0.000505912583f, 0.000433613255f, 0.000361318118f, 0.000289029849f, 0.000216751185f, 0.000144484846f, 7.22335462e-05f,
+    -1.1546476e-17f, -7.2213079e-05f, -0.000144402977f, -0.000216566972f, -0.000288702373f, -0.000360806443f, -0.000432876521f, -0.00050490984f,
+    -0.000576903753f, -0.000648855581f, -0.000720762531f, -0.000792621984f, -0.000864431204f, -0.000936187571f, -0.00100788835f, -0.0010795308f,
+    -0.00115111237f, -0.00122263026f, -0.00129408191f, -0.00136546453f, -0.00143677555f, -0.00150801218f, -0.00157917186f, -0.00165025203f,
+    -0.00172124978f, -0.00179216266f, -0.00186298799f, -0.00193372299f, -0.0020043652f, -0.00207491196f, -0.00214536069f, -0.00221570837f,
+    -0.00228595291f, -0.00235609151f, -0.00242612138f, -0.00249604019f, -0.00256584515f, -0.00263553346f, -0.00270510302f, -0.00277455105f,
+    -0.00284387497f, -0.00291307201f, -0.00298213982f, -0.00305107562f, -0.00311987731f, -0.00318854186f, -0.00325706671f, -0.00332544977f,
+    -0.00339368801f, -0.00346177933f, -0.00352972094f, -0.00359751028f, -0.00366514502f, -0.0037326226f, -0.00379994069f, -0.00386709627f,
+    -0.00393408723f, -0.00400091149f, -0.00406756578f, -0.00413404824f, -0.00420035608f, -0.00426648697f, -0.00433243858f, -0.00439820811f,
+    -0.00446379371f, -0.00452919211f, -0.00459440192f, -0.00465942034f, -0.00472424459f, -0.00478887279f, -0.00485330215f, -0.00491753034f,
+    -0.00498155551f, -0.00504537486f, -0.00510898605f, -0.00517238723f, -0.00523557514f, -0.00529854838f, -0.00536130415f, -0.00542384014f,
+    -0.00548615446f, -0.00554824434f, -0.00561010744f, -0.00567174191f, -0.00573314587f, -0.00579431606f, -0.00585525064f, -0.00591594772f,
+    -0.00597640499f, -0.00603661966f, -0.00609659031f, -0.00615631416f, -0.00621578936f, -0.00627501355f, -0.0063339849f, -0.00639270106f,
+    -0.00645115972f, -0.00650935853f, -0.00656729611f, -0.00662497012f, -0.00668237824f, -0.00673951861f, -0.00679638842f, -0.00685298676f,
+    -0.00690931082f, -0.00696535874f, -0.00702112867f, -0.00707661826f, -0.00713182567f, -0.00718674855f, -0.00724138599f, -0.00729573471f,
+    -0.00734979333f, -0.00740355998f, -0.0074570328f, -0.00751020946f, -0.00756308809f, -0.0076156673f, -0.00766794477f, -0.00771991862f,
+    -0.007771587f, -0.00782294758f, -0.00787399989f, -0.00792474113f, -0.00797516946f, -0.00802528299f, -0.00807507988f, -0.00812455919f,
+    -0.00817371812f, -0.00822255574f, -0.00827106927f, -0.00831925776f, -0.00836712029f, -0.00841465313f, -0.00846185628f, -0.00850872695f,
+    -0.00855526421f, -0.00860146526f, -0.00864733011f, -0.00869285688f, -0.00873804279f, -0.0087828869f, -0.00882738736f, -0.00887154322f,
+    -0.0089153517f, -0.0089588128f, -0.00900192373f, -0.00904468447f, -0.00908709131f, -0.00912914425f, -0.00917084236f, -0.00921218283f,
+    -0.00925316382f, -0.00929378532f, -0.00933404546f, -0.00937394332f, -0.0094134761f, -0.0094526438f, -0.00949144363f, -0.00952987559f,
+    -0.00956793781f, -0.00960562844f, -0.00964294747f, -0.0096798921f, -0.00971646234f, -0.0097526554f, -0.00978847127f, -0.00982390903f,
+    -0.00985896681f, -0.00989364274f, -0.00992793683f, -0.00996184722f, -0.00999537203f, -0.0100285122f, -0.010061265f, -0.0100936294f,
+    -0.0101256045f, -0.0101571893f, -0.0101883821f, -0.0102191828f, -0.0102495905f, -0.0102796033f, -0.0103092203f, -0.0103384405f,
+    -0.0103672631f, -0.010395688f, -0.0104237124f, -0.0104513373f, -0.0104785599f, -0.0105053801f, -0.010531798f, -0.0105578108f,
+    -0.0105834194f, -0.0106086219f, -0.0106334174f, -0.0106578059f, -0.0106817866f, -0.0107053574f, -0.0107285185f, -0.0107512698f,
+    -0.0107736094f, -0.0107955365f, -0.0108170509f, -0.0108381519f, -0.0108588394f, -0.0108791115f, -0.0108989682f, -0.0109184086f,
+    -0.0109374328f, -0.0109560397f, -0.0109742284f, -0.0109919989f, -0.0110093504f, -0.0110262828f, -0.0110427942f, -0.0110588856f,
+    -0.011074556f, -0.0110898055f, -0.0111046322f, -0.0111190369f, -0.0111330189f, -0.0111465771f, -0.0111597124f, -0.0111724231f,
+    -0.0111847091f, -0.0111965714f, -0.011208008f, -0.01121902f, -0.0112296054f, -0.0112397661f, -0.0112494994f, -0.011258807f,
+    -0.0112676881f, -0.0112761417f, -0.0112841688f, -0.0112917684f, -0.0112989405f, -0.0113056852f, -0.0113120023f, -0.011317892f,
+    -0.0113233533f, -0.0113283861f, -0.0113329915f, -0.0113371685f, -0.011340918f, -0.0113442382f, -0.0113471309f, -0.0113495961f,
+    -0.011351632f, -0.0113532403f, -0.0113544213f, -0.0113551728f, -0.0113554979f, -0.0113553945f, -0.0113548636f, -0.0113539053f,
+    -0.0113525195f, -0.0113507062f, -0.0113484664f, -0.0113458f, -0.0113427071f, -0.0113391876f, -0.0113352416f, -0.0113308709f,
+    -0.0113260737f, -0.0113208517f, -0.0113152051f, -0.0113091338f, -0.0113026379f, -0.0112957181f, -0.0112883756f, -0.0112806093f,
+    -0.0112724211f, -0.0112638101f, -0.0112547772f, -0.0112453233f, -0.0112354485f, -0.0112251537f, -0.0112144388f, -0.0112033039f,
+    -0.0111917509f, -0.0111797797f, -0.0111673903f, -0.0111545846f, -0.0111413617f, -0.0111277234f, -0.0111136697f, -0.0110992016f,
+    -0.0110843191f, -0.011069024f, -0.0110533154f, -0.0110371951f, -0.0110206641f, -0.0110037234f, -0.0109863719f, -0.0109686116f,
+    -0.0109504443f, -0.0109318681f, -0.0109128868f, -0.0108934995f, -0.010873707f, -0.0108535103f, -0.0108329114f, -0.01081191f,
+    -0.0107905073f, -0.0107687041f, -0.0107465014f, -0.0107239f, -0.010700902f, -0.0106775071f, -0.0106537165f, -0.010629531f,
+    -0.0106049525f, -0.0105799809f, -0.0105546182f, -0.0105288653f, -0.010502724f, -0.0104761934f, -0.0104492754f, -0.0104219718f,
+    -0.0103942836f, -0.0103662116f, -0.0103377579f, -0.0103089223f, -0.0102797057f, -0.0102501111f, -0.0102201384f, -0.0101897893f,
+    -0.0101590659f, -0.0101279672f, -0.0100964969f, -0.0100646541f, -0.0100324424f, -0.00999986101f, -0.00996691268f, -0.00993359741f,
+    -0.00989991799f, -0.00986587536f, -0.00983147044f, -0.0097967051f, -0.0097615812f, -0.00972609874f, -0.00969026051f, -0.00965406653f,
+    -0.00961751956f, -0.0095806215f, -0.00954337232f, -0.00950577389f, -0.00946782809f, -0.00942953676f, -0.00939090084f, -0.0093519222f,
+    -0.00931260269f, -0.00927294325f, -0.00923294574f, -0.00919261109f, -0.0091519421f, -0.00911093969f, -0.00906960666f, -0.00902794208f,
+    -0.00898595061f, -0.00894363131f, -0.00890098792f, -0.00885802135f, -0.00881473254f, -0.00877112523f, -0.00872719847f, -0.00868295599f,
+    -0.00863839872f, -0.00859352853f, -0.00854834821f, -0.00850285776f, -0.00845705997f, -0.00841095671f, -0.00836454984f, -0.00831784029f,
+    -0.00827083178f, -0.00822352432f, -0.00817591976f, -0.00812802184f, -0.00807983056f, -0.0080313487f, -0.00798257813f, -0.00793352071f,
+    -0.00788417831f, -0.00783455186f, -0.00778464554f, -0.00773445936f, -0.00768399611f, -0.00763325812f, -0.00758224633f, -0.00753096351f,
+    -0.00747941155f, -0.0074275923f, -0.00737550808f, -0.0073231603f, -0.00727055175f, -0.0072176843f, -0.00716455979f, -0.00711118011f,
+    -0.00705754757f, -0.0070036645f, -0.00694953278f, -0.00689515471f, -0.00684053218f, -0.00678566704f, -0.00673056208f, -0.00667521916f,
+    -0.00661964016f, -0.0065638274f, -0.0065077832f, -0.00645150989f, -0.00639500888f, -0.00633828342f, -0.00628133491f, -0.00622416614f,
+    -0.0061667785f, -0.00610917527f, -0.00605135784f, -0.00599332852f, -0.00593509013f, -0.00587664451f, -0.00581799401f, -0.00575914094f,
+    -0.00570008717f, -0.0056408355f, -0.00558138825f, -0.00552174728f, -0.00546191493f, -0.00540189398f, -0.00534168584f, -0.00528129423f,
+    -0.00522072008f, -0.00515996665f, -0.0050990358f, -0.00503792986f, -0.00497665163f, -0.00491520297f, -0.00485358667f, -0.00479180505f,
+    -0.00472986f, -0.00466775382f, -0.00460548978f, -0.00454306975f, -0.00448049605f, -0.00441777101f, -0.00435489742f, -0.00429187762f,
+    -0.00422871346f, -0.0041654082f, -0.00410196325f, -0.00403838186f, -0.00397466635f, -0.00391081907f, -0.00384684233f, -0.0037827387f,
+    -0.0037185105f, -0.00365416054f, -0.00358969066f, -0.00352510391f, -0.00346040237f, -0.00339558884f, -0.00333066541f, -0.00326563488f,
+    -0.00320049957f, -0.00313526206f, -0.00306992466f, -0.00300448993f, -0.00293896068f, -0.00287333876f, -0.0028076272f, -0.00274182856f,
+    -0.00267594471f, -0.0026099789f, -0.00254393299f, -0.00247781002f, -0.00241161231f, -0.00234534219f, -0.00227900245f, -0.00221259543f,
+    -0.00214612368f, -0.00207958976f, -0.00201299624f, -0.00194634544f, -0.00187964016f, -0.00181288272f, -0.00174607581f, -0.00167922175f,
+    -0.00161232334f, -0.0015453829f, -0.00147840299f, -0.00141138618f, -0.00134433503f, -0.0012772521f, -0.00121013983f, -0.00114300079f,
+    -0.00107583753f, -0.00100865262f, -0.000941448554f, -0.000874227844f, -0.000806993048f, -0.000739746727f, -0.000672491384f, -0.000605229579f,
+    -0.000537963817f, -0.000470696687f, -0.000403430662f, -0.000336168305f, -0.000268912147f, -0.00020166469f, -0.000134428497f, -6.72060996e-05f,
+    -1.07320133e-16f, 6.71872622e-05f, 0.000134353162f, 0.000201495175f, 0.000268610776f, 0.000335697463f, 0.000402752717f, 0.000469773979f,
+    0.000536758802f, 0.000603704597f, 0.000670608948f, 0.000737469236f, 0.000804283074f, 0.000871047843f, 0.000937761157f, 0.00100442045f,
+    0.00107102317f, 0.00113756699f, 0.00120404921f, 0.00127046753f, 0.00133681938f, 0.0014031023f, 0.00146931387f, 0.00153545151f,
+    0.00160151278f, 0.00166749523f, 0.00173339632f, 0.0017992137f, 0.00186494493f, 0.00193058758f, 0.00199613906f, 0.00206159684f,
+    0.00212695892f, 0.00219222251f, 0.00225738506f, 0.00232244446f, 0.00238739839f, 0.00245224405f, 0.00251697912f, 0.00258160126f,
+    0.00264610816f, 0.00271049724f, 0.00277476641f, 0.00283891289f, 0.00290293456f, 0.00296682888f, 0.00303059374f, 0.00309422659f,
+    0.00315772486f, 0.00322108669f, 0.00328430929f, 0.00334739056f, 0.00341032818f, 0.00347311958f, 0.00353576266f, 0.00359825511f,
+    0.00366059458f, 0.00372277852f, 0.00378480507f, 0.00384667143f, 0.00390837574f, 0.00396991568f, 0.0040312889f, 0.00409249309f,
+    0.00415352592f, 0.00421438552f, 0.00427506911f, 0.00433557434f, 0.00439589983f, 0.00445604278f, 0.00451600133f, 0.00457577268f,
+    0.00463535497f, 0.00469474634f, 0.004753944f, 0.00481294608f, 0.00487175025f, 0.00493035465f, 0.00498875696f, 0.00504695484f,
+    0.00510494644f, 0.00516272988f, 0.00522030238f, 0.00527766254f, 0.00533480756f, 0.00539173558f, 0.00544844475f, 0.00550493272f,
+    0.00556119764f, 0.00561723765f, 0.00567304995f, 0.00572863361f, 0.00578398537f, 0.0058391043f, 0.0058939876f, 0.00594863342f,
+    0.00600303989f, 0.00605720561f, 0.00611112779f, 0.00616480457f, 0.00621823408f, 0.00627141446f, 0.00632434431f, 0.00637702039f,
+    0.0064294422f, 0.00648160698f, 0.00653351285f, 0.00658515841f, 0.00663654134f, 0.00668766024f, 0.00673851278f, 0.00678909756f,
+    0.00683941226f, 0.00688945502f, 0.0069392249f, 0.00698871911f, 0.00703793624f, 0.00708687492f, 0.0071355328f, 0.00718390802f,
+    0.00723199965f, 0.00727980537f, 0.00732732331f, 0.00737455208f, 0.00742149027f, 0.00746813556f, 0.00751448656f, 0.00756054139f,
+    0.00760629866f, 0.00765175698f, 0.00769691402f, 0.00774176884f, 0.00778631959f, 0.00783056486f, 0.00787450187f, 0.00791813061f,
+    0.00796144921f, 0.00800445583f, 0.00804714859f, 0.00808952656f, 0.00813158788f, 0.00817333162f, 0.00821475592f, 0.00825585891f,
+    0.00829663873f, 0.00833709538f, 0.008377227f, 0.00841703173f, 0.00845650863f, 0.00849565584f, 0.0085344715f, 0.00857295562f,
+    0.00861110631f, 0.0086489208f, 0.00868640002f, 0.00872354116f, 0.00876034424f, 0.00879680645f, 0.00883292686f, 0.00886870548f,
+    0.00890413858f, 0.00893922802f, 0.00897397008f, 0.00900836475f, 0.00904241018f, 0.00907610636f, 0.0091094505f, 0.00914244261f,
+    0.00917508081f, 0.0092073651f, 0.0092392927f, 0.00927086361f, 0.00930207688f, 0.0093329316f, 0.00936342496f, 0.00939355791f,
+    0.00942332856f, 0.00945273601f, 0.0094817793f, 0.00951045752f, 0.00953876972f, 0.00956671406f, 0.00959429052f, 0.00962149817f,
+    0.0096483361f, 0.00967480242f, 0.00970089715f, 0.00972661935f, 0.00975196809f, 0.00977694243f, 0.00980154239f, 0.00982576516f,
+    0.00984961167f, 0.009873081f, 0.00989617128f, 0.00991888251f, 0.00994121376f, 0.00996316411f, 0.00998473354f, 0.0100059211f,
+    0.0100267259f, 0.0100471471f, 0.0100671835f, 0.0100868363f, 0.0101061035f, 0.0101249842f, 0.0101434784f, 0.0101615852f,
+    0.0101793045f, 0.0101966364f, 0.0102135781f, 0.0102301314f, 0.0102462936f, 0.0102620665f, 0.0102774482f, 0.0102924388f,
+    0.0103070373f, 0.0103212437f, 0.010335057f, 0.0103484774f, 0.0103615038f, 0.0103741372f, 0.0103863757f, 0.0103982203f,
+    0.01040967f, 0.0104207238f, 0.0104313828f, 0.010441645f, 0.0104515115f, 0.0104609821f, 0.010470056f, 0.0104787322f,
+    0.0104870126f, 0.0104948943f, 0.0105023794f, 0.0105094668f, 0.0105161564f, 0.0105224485f, 0.0105283419f, 0.0105338376f,
+    0.0105389347f, 0.0105436333f, 0.0105479341f, 0.0105518363f, 0.01055534f, 0.010558445f, 0.0105611514f, 0.0105634592f,
+    0.0105653685f, 0.01056688f, 0.0105679929f, 0.0105687073f, 0.010569023f, 0.010568941f, 0.0105684614f, 0.0105675831f,
+    0.0105663082f, 0.0105646346f, 0.0105625642f, 0.0105600962f, 0.0105572315f, 0.01055397f, 0.0105503118f, 0.0105462568f,
+    0.010541806f, 0.0105369603f, 0.0105317179f, 0.0105260815f, 0.0105200494f, 0.0105136232f, 0.0105068022f, 0.0104995882f,
+    0.0104919802f, 0.0104839792f, 0.0104755862f, 0.0104668001f, 0.0104576228f, 0.0104480544f, 0.0104380948f, 0.0104277451f,
+    0.010417005f, 0.0104058767f, 0.010394359f, 0.010382453f, 0.0103701586f, 0.0103574777f, 0.0103444112f, 0.0103309574f,
+    0.0103171188f, 0.0103028957f, 0.0102882879f, 0.0102732973f, 0.010257924f, 0.0102421679f, 0.0102260318f, 0.0102095138f,
+    0.0101926168f, 0.0101753399f, 0.0101576848f, 0.0101396525f, 0.0101212431f, 0.0101024574f, 0.0100832963f, 0.0100637609f,
+    0.010043853f, 0.0100235716f, 0.0100029176f, 0.00998189393f, 0.00996049959f, 0.00993873551f, 0.0099166045f, 0.00989410467f,
+    0.00987123977f, 0.00984800886f, 0.00982441381f, 0.00980045553f, 0.00977613404f, 0.00975145213f, 0.00972640887f, 0.00970100705f,
+    0.00967524666f, 0.00964912865f, 0.00962265488f, 0.00959582627f, 0.00956864376f, 0.00954110827f, 0.00951322075f, 0.00948498305f,
+    0.0094563961f, 0.00942746084f, 0.00939817913f, 0.00936855096f, 0.00933857821f, 0.00930826273f, 0.00927760452f, 0.00924660638f,
+    0.00921526738f, 0.00918359123f, 0.00915157702f, 0.00911922753f, 0.00908654369f, 0.00905352645f, 0.00902017765f, 0.00898649823f,
+    0.00895249005f, 0.00891815405f, 0.00888349209f, 0.00884850416f, 0.008813194f, 0.00877756067f, 0.00874160789f, 0.00870533474f,
+    0.00866874401f, 0.00863183755f, 0.00859461632f, 0.00855708122f, 0.00851923507f, 0.00848107785f, 0.00844261236f, 0.00840383954f,
+    0.00836476032f, 0.00832537748f, 0.00828569196f, 0.00824570563f, 0.00820542034f, 0.00816483703f, 0.00812395662f, 0.00808278285f,
+    0.00804131571f, 0.00799955707f, 0.00795750879f, 0.00791517273f, 0.00787254982f, 0.00782964285f, 0.00778645277f, 0.00774298143f,
+    0.00769923069f, 0.00765520195f, 0.00761089753f, 0.00756631838f, 0.00752146728f, 0.0074763447f, 0.0074309539f, 0.00738529535f,
+    0.00733937137f, 0.00729318382f, 0.00724673457f, 0.00720002549f, 0.00715305796f, 0.00710583432f, 0.00705835596f, 0.00701062521f,
+    0.00696264347f, 0.00691441307f, 0.00686593587f, 0.00681721326f, 0.00676824758f, 0.00671904068f, 0.00666959444f, 0.00661991071f,
+    0.00656999135f, 0.0065198387f, 0.00646945462f, 0.00641884049f, 0.00636799866f, 0.00631693145f, 0.00626564072f, 0.00621412788f,
+    0.0061623957f, 0.0061104456f, 0.00605827989f, 0.00600590091f, 0.00595330959f, 0.00590050919f, 0.0058475011f, 0.00579428766f,
+    0.00574087072f, 0.00568725262f, 0.00563343521f, 0.00557942037f, 0.00552521041f, 0.00547080766f, 0.005416214f, 0.00536143174f,
+    0.00530646276f, 0.0052513089f, 0.00519597298f, 0.00514045637f, 0.00508476188f, 0.00502889138f, 0.00497284671f, 0.00491663069f,
+    0.00486024516f, 0.00480369246f, 0.00474697398f, 0.00469009299f, 0.00463305134f, 0.00457585044f, 0.00451849354f, 0.00446098251f,
+    0.00440331921f, 0.00434550643f, 0.00428754603f, 0.00422943989f, 0.00417119078f, 0.00411280105f, 0.00405427255f, 0.00399560761f,
+    0.00393680856f, 0.00387787749f, 0.00381881697f, 0.00375962886f, 0.00370031572f, 0.00364087964f, 0.00358132296f, 0.00352164824f,
+    0.00346185709f, 0.00340195256f, 0.00334193627f, 0.00328181102f, 0.0032215789f, 0.00316124223f, 0.00310080312f, 0.00304026413f,
+    0.00297962758f, 0.00291889557f, 0.00285807042f, 0.00279715471f, 0.00273615052f, 0.00267506042f, 0.00261388626f, 0.00255263085f,
+    0.0024912965f, 0.00242988509f, 0.00236839941f, 0.00230684155f, 0.00224521407f, 0.00218351907f, 0.00212175911f, 0.00205993629f,
+    0.00199805317f, 0.00193611195f, 0.00187411497f, 0.00181206479f, 0.00174996362f, 0.00168781367f, 0.00162561762f, 0.00156337745f,
+    0.00150109583f, 0.00143877498f, 0.00137641735f, 0.00131402514f, 0.0012516008f, 0.00118914666f, 0.00112666516f, 0.00106415851f,
+    0.00100162916f, 0.000939079619f, 0.000876511971f, 0.000813928782f, 0.000751332322f, 0.000688724976f, 0.000626109075f, 0.000563487003f,
+    0.000500861148f, 0.000438233808f, 0.0003756074f, 0.000312984252f, 0.000250366749f, 0.000187757192f, 0.000125157996f, 6.25714747e-05f,
+    6.49437631e-17f, -6.25540779e-05f, -0.000125088409f, -0.000187600643f, -0.000250088429f, -0.00031254944f, -0.000374981319f, -0.000437381706f,
+    -0.000499748276f, -0.000562078669f, -0.000624370587f, -0.000686621701f, -0.000748829625f, -0.000810992031f, -0.000873106648f, -0.000935171091f,
+    -0.000997183146f, -0.00105914031f, -0.00112104032f, -0.00118288107f, -0.00124466f, -0.00130637479f, -0.00136802334f, -0.0014296032f,
+    -0.00149111217f, -0.00155254779f, -0.00161390787f, -0.00167519017f, -0.00173639238f, -0.00179751206f, -0.00185854721f, -0.00191949529f,
+    -0.00198035408f, -0.00204112148f, -0.00210179528f, -0.00216237269f, -0.00222285208f, -0.00228323089f, -0.00234350702f, -0.00240367791f,
+    -0.00246374193f, -0.00252369605f, -0.00258353865f, -0.00264326739f, -0.00270287995f, -0.002762374f, -0.00282174768f, -0.00288099865f,
+    -0.00294012437f, -0.00299912319f, -0.00305799255f, -0.00311673037f, -0.00317533454f, -0.00323380274f, -0.0032921331f, -0.00335032307f,
+    -0.00340837077f, -0.00346627389f, -0.00352403056f, -0.00358163845f, -0.00363909523f, -0.00369639928f, -0.00375354802f, -0.00381053961f,
+    -0.00386737171f, -0.00392404245f, -0.00398054952f, -0.00403689127f, -0.00409306539f, -0.00414906954f, -0.00420490187f, -0.00426056003f,
+    -0.00431604264f, -0.00437134737f, -0.00442647189f, -0.0044814148f, -0.00453617331f, -0.00459074555f, -0.00464513013f, -0.00469932426f,
+    -0.004753327f, -0.00480713509f, -0.00486074761f, -0.00491416175f, -0.00496737659f, -0.00502038887f, -0.00507319812f, -0.00512580108f,
+    -0.00517819636f, -0.00523038255f, -0.00528235687f, -0.00533411792f, -0.00538566336f, -0.00543699227f, -0.00548810186f, -0.00553899026f,
+    -0.00558965653f, -0.00564009789f, -0.00569031294f, -0.00574029936f, -0.0057900562f, -0.00583958067f, -0.00588887185f, -0.0059379274f,
+    -0.00598674593f, -0.00603532512f, -0.00608366402f, -0.00613175984f, -0.00617961166f, -0.00622721715f, -0.00627457537f, -0.00632168353f,
+    -0.00636854116f, -0.00641514547f, -0.00646149553f, -0.00650758902f, -0.00655342499f, -0.00659900112f, -0.00664431648f, -0.00668936875f,
+    -0.00673415652f, -0.00677867839f, -0.00682293251f, -0.00686691748f, -0.00691063143f, -0.00695407297f, -0.00699724071f, -0.00704013277f,
+    -0.00708274776f, -0.00712508475f, -0.00716714095f, -0.00720891589f, -0.00725040771f, -0.00729161501f, -0.00733253593f, -0.00737316953f,
+    -0.00741351442f, -0.00745356828f, -0.0074933311f, -0.00753280008f, -0.00757197477f, -0.00761085283f, -0.00764943426f, -0.00768771628f,
+    -0.00772569841f, -0.00776337879f, -0.00780075695f, -0.00783783011f, -0.00787459873f, -0.00791106001f, -0.00794721302f, -0.00798305683f,
+    -0.00801859051f, -0.0080538122f, -0.00808872003f, -0.00812331401f, -0.00815759227f, -0.00819155481f, -0.0082251979f, -0.00825852342f,
+    -0.00829152763f, -0.00832421053f, -0.0083565712f, -0.00838860776f, -0.0084203193f, -0.0084517058f, -0.00848276448f, -0.00851349533f,
+    -0.00854389742f, -0.00857396889f, -0.00860370882f, -0.00863311719f, -0.00866219122f, -0.00869093183f, -0.00871933717f, -0.0087474063f,
+    -0.00877513736f, -0.00880253129f, -0.00882958528f, -0.00885629933f, -0.00888267253f, -0.00890870392f, -0.00893439259f, -0.00895973761f,
+    -0.00898473896f, -0.00900939386f, -0.00903370325f, -0.00905766524f, -0.00908127986f, -0.00910454523f, -0.00912746228f, -0.00915002823f,
+    -0.009172244f, -0.00919410773f, -0.00921561942f, -0.00923677813f, -0.00925758295f, -0.00927803293f, -0.00929812808f, -0.00931786746f,
+    -0.00933725107f, -0.00935627706f, -0.00937494542f, -0.00939325523f, -0.00941120647f, -0.00942879915f, -0.00944603048f, -0.00946290232f,
+    -0.00947941188f, -0.00949556101f, -0.00951134786f, -0.00952677149f, -0.00954183284f, -0.00955653004f, -0.0095708631f, -0.00958483201f,
+    -0.00959843677f, -0.00961167552f, -0.00962454826f, -0.00963705592f, -0.00964919664f, -0.00966097042f, -0.00967237726f, -0.00968341623f,
+    -0.00969408825f, -0.00970439147f, -0.00971432682f, -0.00972389337f, -0.00973309111f, -0.00974192005f, -0.00975037925f, -0.00975846872f,
+    -0.00976618938f, -0.00977353938f, -0.00978051871f, -0.00978712831f, -0.00979336724f, -0.00979923643f, -0.00980473403f, -0.00980986096f,
+    -0.00981461722f, -0.00981900282f, -0.00982301682f, -0.00982666016f, -0.00982993189f, -0.00983283296f, -0.00983536337f, -0.00983752124f,
+    -0.00983930938f, -0.00984072592f, -0.0098417718f, -0.00984244607f, -0.00984274969f, -0.00984268263f, -0.00984224491f, -0.00984143652f,
+    -0.00984025747f, -0.00983870868f, -0.00983679015f, -0.00983450096f, -0.00983184204f, -0.00982881337f, -0.00982541591f, -0.00982164871f,
+    -0.00981751364f, -0.00981300883f, -0.00980813615f, -0.0098028956f, -0.00979728717f, -0.00979131181f, -0.00978496857f, -0.00977825932f,
+    -0.00977118313f, -0.00976374093f, -0.00975593366f, -0.00974776037f, -0.00973922201f, -0.00973032042f, -0.00972105376f, -0.00971142389f,
+    -0.0097014308f, -0.00969107542f, -0.00968035776f, -0.00966927875f, -0.00965783838f, -0.00964603666f, -0.00963387638f, -0.00962135568f,
+    -0.00960847642f, -0.0095952386f, -0.00958164316f, -0.00956769101f, -0.00955338217f, -0.00953871757f, -0.0095236972f, -0.00950832292f,
+    -0.00949259475f, -0.0094765136f, -0.00946007948f, -0.00944329426f, -0.00942615699f, -0.00940867048f, -0.00939083379f, -0.00937264878f,
+    -0.00935411546f, -0.00933523569f, -0.00931600854f, -0.00929643679f, -0.00927651953f, -0.00925625954f, -0.00923565589f, -0.00921470951f,
+    -0.0091934232f, -0.0091717951f, -0.00914982893f, -0.00912752282f, -0.0091048805f, -0.00908190105f, -0.00905858539f, -0.00903493538f,
+    -0.00901095197f, -0.00898663513f, -0.00896198768f, -0.00893700868f, -0.00891169999f, -0.00888606347f, -0.0088600982f, -0.00883380696f,
+    -0.00880719069f, -0.00878024939f, -0.00875298586f, -0.00872539915f, -0.00869749207f, -0.00866926461f, -0.00864071958f, -0.00861185603f,
+    -0.00858267676f, -0.00855318177f, -0.00852337293f, -0.00849325117f, -0.00846281834f, -0.00843207538f, -0.00840102322f, -0.0083696628f,
+    -0.00833799597f, -0.00830602366f, -0.00827374775f, -0.00824116915f, -0.00820828974f, -0.00817510951f, -0.00814163126f, -0.00810785498f,
+    -0.00807378255f, -0.00803941581f, -0.00800475571f, -0.00796980411f, -0.00793456193f, -0.00789903104f, -0.00786321145f, -0.00782710593f,
+    -0.00779071636f, -0.00775404274f, -0.0077170874f, -0.00767985173f, -0.00764233712f, -0.00760454498f, -0.00756647717f, -0.00752813462f,
+    -0.00748951919f, -0.00745063275f, -0.00741147622f, -0.00737205148f, -0.00733235944f, -0.00729240291f, -0.00725218281f, -0.00721170008f,
+    -0.00717095751f, -0.00712995604f, -0.00708869752f, -0.00704718288f, -0.00700541493f, -0.00696339458f, -0.00692112325f, -0.00687860325f,
+    -0.00683583599f, -0.00679282285f, -0.00674956618f, -0.0067060669f, -0.00666232733f, -0.00661834888f, -0.00657413341f, -0.00652968278f,
+    -0.00648499792f, -0.00644008163f, -0.00639493531f, -0.00634956034f, -0.00630395906f, -0.00625813287f, -0.00621208362f, -0.00616581319f,
+    -0.00611932343f, -0.00607261574f, -0.00602569245f, -0.00597855542f, -0.00593120605f, -0.00588364666f, -0.00583587866f, -0.00578790391f,
+    -0.00573972473f, -0.00569134252f, -0.00564275961f, -0.0055939774f, -0.00554499822f, -0.00549582345f, -0.00544645544f, -0.00539689604f,
+    -0.00534714712f, -0.00529721053f, -0.00524708815f, -0.00519678229f, -0.00514629437f, -0.00509562669f, -0.00504478114f, -0.00499375956f,
+    -0.00494256383f, -0.00489119673f, -0.0048396592f, -0.00478795357f, -0.00473608216f, -0.00468404684f, -0.00463184901f, -0.00457949145f,
+    -0.00452697603f, -0.00447430462f, -0.00442147907f, -0.00436850172f, -0.00431537488f, -0.00426209951f, -0.00420867885f, -0.00415511429f,
+    -0.00410140818f, -0.00404756237f, -0.00399357919f, -0.0039394605f, -0.00388520816f, -0.00383082451f, -0.00377631187f, -0.00372167188f,
+    -0.00366690708f, -0.00361201912f, -0.00355701032f, -0.00350188301f, -0.00344663882f, -0.00339128007f, -0.0033358091f, -0.00328022777f,
+    -0.00322453817f, -0.00316874264f, -0.00311284326f, -0.0030568419f, -0.00300074113f, -0.00294454279f, -0.002888249f, -0.00283186208f,
+    -0.00277538411f, -0.00271881721f, -0.00266216369f, -0.00260542543f, -0.00254860474f, -0.00249170372f, -0.00243472471f, -0.00237766979f,
+    -0.00232054107f, -0.00226334063f, -0.00220607105f, -0.00214873394f, -0.00209133187f, -0.00203386694f, -0.00197634124f, -0.0019187571f,
+    -0.00186111662f, -0.001803422f, -0.00174567534f, -0.00168787886f, -0.00163003488f, -0.0015721455f, -0.00151421293f, -0.00145623938f,
+    -0.00139822694f, -0.00134017796f, -0.00128209451f, -0.00122397882f, -0.00116583309f, -0.00110765966f, -0.00104946049f, -0.000991237932f,
+    -0.000932994066f, -0.000874731282f, -0.00081645156f, -0.000758157286f, -0.000699850556f, -0.000641533581f, -0.000583208574f, -0.000524877687f,
+    -0.000466543221f, -0.000408207299f, -0.000349872134f, -0.000291539938f, -0.000233212864f, -0.000174893154f, -0.000116582967f, -5.82845205e-05f,
+    -2.79150296e-17f, 5.82684042e-05f, 0.000116518509f, 0.000174748115f, 0.000232955033f, 0.000291137083f, 0.000349292095f, 0.000407417858f,
+    0.000465512217f, 0.000523572962f, 0.000581597968f, 0.000639585021f, 0.000697531912f, 0.000755436544f, 0.000813296763f, 0.0008711103f,
+    0.000928875059f, 0.00098658877f, 0.00104424951f, 0.00110185496f, 0.00115940289f, 0.00121689134f, 0.00127431797f, 0.0013316808f,
+    0.00138897763f, 0.00144620636f, 0.00150336465f, 0.00156045065f, 0.00161746203f, 0.0016743968f, 0.00173125265f, 0.0017880277f,
+    0.00184471963f, 0.00190132647f, 0.00195784611f, 0.00201427611f, 0.00207061484f, 0.0021268602f, 0.00218300964f, 0.00223906152f,
+    0.00229501352f, 0.00235086353f, 0.00240660948f, 0.00246224971f, 0.00251778145f, 0.0025732033f, 0.00262851291f, 0.00268370798f,
+    0.00273878709f, 0.00279374747f, 0.0028485877f, 0.00290330546f, 0.00295789866f, 0.0030123652f, 0.00306670344f, 0.00312091131f,
+    0.00317498646f, 0.00322892703f, 0.00328273117f, 0.00333639677f, 0.00338992197f, 0.00344330468f, 0.00349654304f, 0.00354963471f,
+    0.0036025783f, 0.00365537149f, 0.0037080124f, 0.00376049918f, 0.00381282973f, 0.00386500219f, 0.00391701469f, 0.00396886514f,
+    0.00402055215f, 0.00407207338f, 0.00412342697f, 0.00417461107f, 0.00422562333f, 0.00427646283f, 0.00432712724f, 0.00437761471f,
+    0.00442792336f, 0.00447805086f, 0.00452799629f, 0.00457775733f, 0.00462733209f, 0.0046767192f, 0.00472591631f, 0.00477492157f,
+    0.00482373405f, 0.00487235095f, 0.00492077088f, 0.00496899197f, 0.00501701282f, 0.00506483158f, 0.00511244638f, 0.00515985535f,
+    0.00520705711f, 0.00525404932f, 0.00530083058f, 0.00534739997f, 0.00539375469f, 0.00543989334f, 0.00548581453f, 0.00553151639f,
+    0.00557699706f, 0.00562225515f, 0.00566728925f, 0.00571209751f, 0.00575667806f, 0.0058010295f, 0.00584515044f, 0.00588903856f,
+    0.00593269337f, 0.00597611209f, 0.00601929426f, 0.00606223755f, 0.00610494055f, 0.00614740187f, 0.00618962012f, 0.00623159343f,
+    0.00627332041f, 0.00631479966f, 0.00635602977f, 0.0063970089f, 0.0064377361f, 0.00647820951f, 0.00651842728f, 0.00655838894f,
+    0.00659809215f, 0.00663753645f, 0.00667671952f, 0.00671564043f, 0.0067542973f, 0.00679268921f, 0.00683081523f, 0.00686867302f,
+    0.00690626167f, 0.00694357976f, 0.00698062638f, 0.00701739965f, 0.00705389818f, 0.00709012151f, 0.0071260673f, 0.00716173509f,
+    0.00719712302f, 0.00723223062f, 0.00726705557f, 0.00730159739f, 0.00733585469f, 0.00736982655f, 0.00740351109f, 0.00743690785f,
+    0.00747001497f, 0.00750283152f, 0.00753535656f, 0.00756758917f, 0.00759952748f, 0.00763117056f, 0.00766251795f, 0.00769356778f,
+    0.00772431958f, 0.0077547715f, 0.00778492354f, 0.00781477336f, 0.00784432143f, 0.00787356496f, 0.00790250488f, 0.00793113839f,
+    0.0079594655f, 0.00798748527f, 0.00801519677f, 0.00804259814f, 0.00806968939f, 0.00809646863f, 0.00812293589f, 0.00814909022f,
+    0.00817492977f, 0.00820045453f, 0.00822566357f, 0.00825055595f, 0.00827513076f, 0.00829938706f, 0.00832332391f, 0.00834694132f,
+    0.00837023649f, 0.00839321129f, 0.00841586292f, 0.00843819138f, 0.00846019667f, 0.00848187599f, 0.00850323029f, 0.00852425862f,
+    0.00854496099f, 0.0085653346f, 0.00858538039f, 0.00860509742f, 0.00862448476f, 0.00864354149f, 0.00866226759f, 0.00868066307f,
+    0.00869872607f, 0.00871645659f, 0.0087338537f, 0.00875091646f, 0.00876764581f, 0.00878403988f, 0.00880009867f, 0.00881582219f,
+    0.00883120857f, 0.00884625874f, 0.00886097085f, 0.00887534581f, 0.00888938271f, 0.0089030806f, 0.00891643949f, 0.00892945845f,
+    0.00894213747f, 0.00895447657f, 0.00896647479f, 0.00897813216f, 0.00898944866f, 0.00900042243f, 0.00901105534f, 0.00902134553f,
+    0.00903129298f, 0.00904089678f, 0.00905015878f, 0.0090590762f, 0.00906765088f, 0.00907588098f, 0.00908376742f, 0.00909130927f,
+    0.00909850746f, 0.00910536014f, 0.00911186822f, 0.00911803171f, 0.00912384968f, 0.00912932213f, 0.00913445f, 0.00913923141f,
+    0.00914366823f, 0.0091477586f, 0.00915150438f, 0.0091549037f, 0.00915795751f, 0.0091606658f, 0.00916302763f, 0.00916504394f,
+    0.00916671474f, 0.00916804001f, 0.00916901976f, 0.00916965306f, 0.00916994177f, 0.00916988403f, 0.00916948169f, 0.00916873384f,
+    0.0091676414f, 0.00916620344f, 0.00916442089f, 0.00916229375f, 0.00915982202f, 0.0091570057f, 0.00915384572f, 0.00915034115f,
+    0.00914649386f, 0.00914230198f, 0.0091377683f, 0.00913289096f, 0.0091276709f, 0.00912210904f, 0.00911620446f, 0.00910995901f,
+    0.00910337176f, 0.00909644272f, 0.00908917375f, 0.00908156484f, 0.00907361507f, 0.0090653263f, 0.00905669853f, 0.00904773176f,
+    0.00903842691f, 0.009028784f, 0.00901880395f, 0.00900848676f, 0.00899783336f, 0.00898684375f, 0.00897551887f, 0.00896385964f,
+    0.00895186514f, 0.00893953722f, 0.00892687589f, 0.00891388208f, 0.00890055578f, 0.00888689794f, 0.00887290947f, 0.00885859039f,
+    0.00884394161f, 0.00882896408f, 0.0088136578f, 0.00879802462f, 0.00878206361f, 0.00876577664f, 0.00874916371f, 0.00873222575f,
+    0.00871496368f, 0.00869737845f, 0.00867947005f, 0.00866124034f, 0.00864268839f, 0.008623817f, 0.00860462617f, 0.00858511589f,
+    0.00856528804f, 0.0085451426f, 0.00852468144f, 0.00850390457f, 0.0084828129f, 0.00846140832f, 0.00843969081f, 0.00841766037f,
+    0.0083953198f, 0.00837267004f, 0.00834971014f, 0.00832644198f, 0.00830286741f, 0.00827898551f, 0.00825479906f, 0.008230309f,
+    0.00820551533f, 0.00818041898f, 0.00815502182f, 0.00812932383f, 0.00810332783f, 0.00807703286f, 0.00805044174f, 0.00802355446f,
+    0.00799637288f, 0.007968897f, 0.00794112869f, 0.00791306887f, 0.00788471848f, 0.00785607938f, 0.0078271525f, 0.00779793877f,
+    0.00776843913f, 0.00773865543f, 0.00770858815f, 0.00767823867f, 0.00764760887f, 0.00761669921f, 0.00758551108f, 0.00755404588f,
+    0.00752230501f, 0.00749028986f, 0.00745800091f, 0.00742544048f, 0.00739260903f, 0.00735950842f, 0.0073261396f, 0.00729250396f,
+    0.00725860288f, 0.00722443825f, 0.00719001051f, 0.00715532154f, 0.00712037273f, 0.00708516547f, 0.00704970118f, 0.00701398076f,
+    0.00697800657f, 0.00694177905f, 0.00690530008f, 0.00686857151f, 0.00683159428f, 0.00679436978f, 0.00675689941f, 0.00671918504f,
+    0.00668122806f, 0.00664303033f, 0.00660459232f, 0.00656591635f, 0.0065270043f, 0.00648785662f, 0.00644847518f, 0.0064088623f,
+    0.00636901846f, 0.00632894598f, 0.00628864625f, 0.00624812068f, 0.00620737113f, 0.00616639899f, 0.00612520566f, 0.00608379301f,
+    0.00604216289f, 0.0060003167f, 0.00595825585f, 0.00591598265f, 0.00587349804f, 0.00583080342f, 0.00578790158f, 0.00574479345f,
+    0.0057014809f, 0.00565796532f, 0.00561424904f, 0.00557033299f, 0.00552621949f, 0.00548190996f, 0.00543740625f, 0.00539270975f,
+    0.00534782279f, 0.00530274678f, 0.00525748311f, 0.0052120341f, 0.00516640162f, 0.00512058707f, 0.00507459184f, 0.00502841873f,
+    0.00498206867f, 0.00493554398f, 0.00488884607f, 0.0048419768f, 0.00479493802f, 0.00474773208f, 0.00470035989f, 0.00465282425f,
+    0.0046051261f, 0.00455726776f, 0.00450925063f, 0.00446107751f, 0.00441274932f, 0.00436426839f, 0.00431563612f, 0.00426685531f,
+    0.00421792688f, 0.00416885316f, 0.00411963556f, 0.00407027686f, 0.00402077846f, 0.00397114223f, 0.00392137002f, 0.00387146394f,
+    0.00382142584f, 0.00377125759f, 0.00372096105f, 0.00367053831f, 0.00361999124f, 0.00356932171f, 0.00351853156f, 0.00346762314f,
+    0.00341659808f, 0.00336545845f, 0.00331420614f, 0.00326284324f, 0.0032113716f, 0.00315979309f, 0.00310810981f, 0.00305632385f,
+    0.00300443685f, 0.00295245112f, 0.00290036853f, 0.00284819119f, 0.00279592071f, 0.00274355942f, 0.00269110943f, 0.00263857236f,
+    0.00258595054f, 0.0025332456f, 0.00248045987f, 0.00242759543f, 0.00237465394f, 0.0023216377f, 0.00226854882f, 0.00221538893f,
+    0.00216216035f, 0.00210886495f, 0.00205550482f, 0.00200208183f, 0.00194859842f, 0.00189505622f, 0.00184145756f, 0.00178780418f,
+    0.0017340983f, 0.0016803419f, 0.00162653707f, 0.0015726859f, 0.00151879014f, 0.00146485225f, 0.00141087396f, 0.00135685736f,
+    0.00130280457f, 0.00124871766f, 0.00119459862f, 0.00114044955f, 0.00108627242f, 0.00103206933f, 0.000977842254f, 0.000923593354f,
+    0.000869324605f, 0.000815038104f, 0.000760735886f, 0.000706419931f, 0.000652092393f, 0.00059775525f, 0.000543410541f, 0.000489060418f,
+    0.000434706802f, 0.000380351819f, 0.000325997506f, 0.000271645869f, 0.000217299021f, 0.000162958953f, 0.000108627733f, 5.4307402e-05f,
+    -4.34599246e-18f, -5.42924317e-05f, -0.000108567852f, -0.000162824217f, -0.000217059496f, -0.000271271652f, -0.000325458619f, -0.000379618432f,
+    -0.000433748995f, -0.000487848301f, -0.000541914313f, -0.000595944992f, -0.00064993836f, -0.00070389238f, -0.000757805014f, -0.000811674225f,
+    -0.000865498034f, -0.000919274346f, -0.000973001297f, -0.00102667673f, -0.00108029868f, -0.00113386521f, -0.00118737435f, -0.00124082388f,
+    -0.00129421195f, -0.00134753669f, -0.00140079588f, -0.00145398767f, -0.00150710996f, -0.00156016089f, -0.00161313848f, -0.00166604063f,
+    -0.00171886547f, -0.00177161105f, -0.00182427536f, -0.00187685643f, -0.00192935229f, -0.00198176107f, -0.00203408068f, -0.00208630948f,
+    -0.00213844515f, -0.00219048583f, -0.00224242965f, -0.00229427498f, -0.00234601926f, -0.0023976611f, -0.00244919839f, -0.00250062929f,
+    -0.00255195168f, -0.00260316394f, -0.00265426398f, -0.00270524994f, -0.00275612017f, -0.00280687236f, -0.00285750488f, -0.00290801586f,
+    -0.00295840343f, -0.00300866552f, -0.00305880047f, -0.00310880668f, -0.00315868179f, -0.0032084242f, -0.00325803203f, -0.00330750342f,
+    -0.00335683674f, -0.00340603013f, -0.00345508149f, -0.0035039892f, -0.00355275162f, -0.00360136665f, -0.00364983268f, -0.00369814807f,
+    -0.00374631048f, -0.00379431876f, -0.00384217105f, -0.00388986524f, -0.00393739995f, -0.00398477307f, -0.0040319832f, -0.00407902803f,
+    -0.00412590662f, -0.0041726171f, -0.00421915716f, -0.00426552584f, -0.00431172084f, -0.00435774075f, -0.00440358371f, -0.00444924878f,
+    -0.00449473318f, -0.00454003597f, -0.00458515482f, -0.00463008927f, -0.00467483653f, -0.00471939519f, -0.00476376433f, -0.00480794162f,
+    -0.00485192519f, -0.00489571458f, -0.00493930699f, -0.00498270197f, -0.00502589671f, -0.00506889075f, -0.00511168176f, -0.00515426835f,
+    -0.00519664912f, -0.00523882266f, -0.00528078713f, -0.00532254158f, -0.00536408368f, -0.00540541206f, -0.00544652576f, -0.00548742292f,
+    -0.00552810216f, -0.00556856208f, -0.00560880126f, -0.00564881787f, -0.00568861049f, -0.00572817819f, -0.00576751912f, -0.00580663234f,
+    -0.00584551552f, -0.0058841682f, -0.00592258852f, -0.00596077507f, -0.00599872693f, -0.00603644224f, -0.00607391959f, -0.00611115806f,
+    -0.00614815624f, -0.00618491229f, -0.00622142572f, -0.00625769421f, -0.00629371731f, -0.0063294936f, -0.00636502169f, -0.00640030019f,
+    -0.0064353277f, -0.00647010328f, -0.00650462555f, -0.00653889356f, -0.00657290546f, -0.00660666078f, -0.00664015766f, -0.00667339563f,
+    -0.00670637283f, -0.00673908833f, -0.0067715412f, -0.00680372957f, -0.00683565345f, -0.00686731096f, -0.00689870073f, -0.00692982227f,
+    -0.00696067419f, -0.00699125556f, -0.00702156546f, -0.00705160201f, -0.00708136475f, -0.00711085275f, -0.00714006508f, -0.00716899987f,
+    -0.00719765713f, -0.00722603546f, -0.00725413347f, -0.00728195067f, -0.00730948616f, -0.00733673852f, -0.00736370683f, -0.00739039062f,
+    -0.00741678895f, -0.00744290045f, -0.00746872416f, -0.00749426009f, -0.00751950638f, -0.0075444621f, -0.00756912725f, -0.00759350043f,
+    -0.00761758117f, -0.00764136808f, -0.00766486069f, -0.00768805807f, -0.00771095976f, -0.00773356436f, -0.00775587186f, -0.00777788088f,
+    -0.00779959094f, -0.00782100111f, -0.0078421114f, -0.00786291994f, -0.00788342673f, -0.00790363085f, -0.00792353135f, -0.00794312824f,
+    -0.00796242151f, -0.00798140839f, -0.00800008979f, -0.00801846478f, -0.00803653337f, -0.00805429369f, -0.00807174575f, -0.0080888886f,
+    -0.00810572226f, -0.00812224671f, -0.00813846011f, -0.00815436244f, -0.00816995371f, -0.00818523206f, -0.00820019841f, -0.00821485277f,
+    -0.00822919235f, -0.008243219f, -0.00825693086f, -0.00827032793f, -0.00828340929f, -0.00829617586f, -0.00830862671f, -0.00832075998f,
+    -0.00833257753f, -0.00834407751f, -0.00835526083f, -0.00836612564f, -0.00837667286f, -0.00838690158f, -0.00839681085f, -0.00840640161f,
+    -0.00841567386f, -0.00842462573f, -0.00843325816f, -0.00844157021f, -0.00844956283f, -0.00845723413f, -0.00846458506f, -0.00847161561f,
+    -0.00847832486f, -0.0084847128f, -0.00849077944f, -0.00849652477f, -0.00850194786f, -0.00850704964f, -0.00851183012f, -0.00851628836f,
+    -0.00852042437f, -0.00852423906f, -0.00852773152f, -0.00853090081f, -0.0085337488f, -0.00853627454f, -0.00853847805f, -0.00854035933f,
+    -0.00854191836f, -0.00854315516f, -0.00854406971f, -0.00854466297f, -0.00854493398f, -0.00854488276f, -0.0085445093f, -0.00854381453f,
+    -0.00854279846f, -0.00854146108f, -0.00853980239f, -0.00853782147f, -0.00853552017f, -0.0085328985f, -0.00852995552f, -0.0085266931f,
+    -0.00852310937f, -0.0085192062f, -0.00851498265f, -0.00851043966f, -0.00850557815f, -0.00850039721f, -0.00849489681f, -0.00848907884f,
+    -0.00848294236f, -0.00847648829f, -0.00846971665f, -0.00846262835f, -0.00845522247f, -0.00844750088f, -0.00843946263f, -0.0084311096f,
+    -0.00842244085f, -0.00841345638f, -0.00840415899f, -0.00839454681f, -0.0083846217f, -0.00837438274f, -0.00836383179f, -0.00835296791f,
+    -0.0083417939f, -0.0083303079f, -0.00831851084f, -0.00830640458f, -0.00829398818f, -0.00828126352f, -0.00826822966f, -0.00825488847f,
+    -0.00824123994f, -0.008227285f, -0.00821302366f, -0.00819845684f, -0.00818358548f, -0.00816841051f, -0.00815293193f, -0.00813714974f,
+    -0.0081210658f, -0.00810468104f, -0.00808799453f, -0.00807100907f, -0.00805372372f, -0.00803613942f, -0.00801825803f, -0.00800007861f,
+    -0.00798160397f, -0.00796283316f, -0.00794376805f, -0.00792440865f, -0.00790475681f, -0.00788481161f, -0.00786457583f, -0.00784404855f,
+    -0.00782323256f, -0.00780212693f, -0.00778073305f, -0.00775905279f, -0.00773708569f, -0.00771483313f, -0.00769229652f, -0.00766947633f,
+    -0.00764637347f, -0.00762298936f, -0.00759932399f, -0.00757537922f, -0.00755115598f, -0.00752665475f, -0.00750187691f, -0.00747682294f,
+    -0.00745149469f, -0.00742589263f, -0.00740001816f, -0.00737387175f, -0.00734745525f, -0.00732076913f, -0.00729381433f, -0.0072665927f,
+    -0.00723910425f, -0.0072113513f, -0.00718333432f, -0.00715505425f, -0.00712651294f, -0.00709771086f, -0.00706864893f, -0.0070393295f,
+    -0.00700975256f, -0.00697991997f, -0.00694983266f, -0.00691949204f, -0.00688889902f, -0.00685805455f, -0.00682696095f, -0.00679561868f,
+    -0.00676402869f, -0.00673219282f, -0.00670011248f, -0.00666778814f, -0.00663522212f, -0.00660241488f, -0.00656936783f, -0.00653608283f,
+    -0.00650256034f, -0.00646880269f, -0.00643481035f, -0.00640058517f, -0.00636612857f, -0.00633144146f, -0.00629652524f, -0.00626138179f,
+    -0.00622601202f, -0.0061904178f, -0.00615460007f, -0.00611856021f, -0.0060823001f, -0.00604582066f, -0.00600912375f, -0.00597221078f,
+    -0.00593508268f, -0.0058977413f, -0.00586018851f, -0.00582242478f, -0.00578445243f, -0.00574627286f, -0.005707887f, -0.00566929718f,
+    -0.00563050434f, -0.00559150986f, -0.00555231562f, -0.00551292347f, -0.00547333388f, -0.00543354964f, -0.00539357122f, -0.00535340095f,
+    -0.00531304022f, -0.00527249044f, -0.00523175299f, -0.00519082975f, -0.00514972256f, -0.00510843238f, -0.00506696152f, -0.00502531137f,
+    -0.00498348288f, -0.00494147884f, -0.0048992997f, -0.00485694781f, -0.00481442502f, -0.00477173226f, -0.0047288714f, -0.00468584476f,
+    -0.00464265281f, -0.00459929835f, -0.00455578277f, -0.00451210747f, -0.00446827384f, -0.00442428468f, -0.00438014045f, -0.00433584349f,
+    -0.00429139566f, -0.00424679834f, -0.00420205342f, -0.00415716227f, -0.00411212724f, -0.00406694971f, -0.00402163109f, -0.00397617416f,
+    -0.00393057941f, -0.00388484937f, -0.00383898569f, -0.00379299f, -0.00374686415f, -0.00370060978f, -0.00365422876f, -0.00360772293f,
+    -0.00356109417f, -0.00351434411f, -0.00346747437f, -0.00342048705f, -0.00337338401f, -0.00332616665f, -0.00327883707f, -0.00323139713f,
+    -0.00318384846f, -0.00313619315f, -0.00308843283f, -0.00304056914f, -0.00299260416f, -0.00294453977f, -0.00289637782f, -0.00284811994f,
+    -0.002799768f, -0.00275132409f, -0.00270278961f, -0.00265416713f, -0.00260545779f, -0.00255666371f, -0.00250778696f, -0.0024588292f,
+    -0.00240979227f, -0.00236067805f, -0.00231148838f, -0.00226222537f, -0.00221289066f, -0.00216348609f, -0.00211401377f, -0.00206447556f,
+    -0.00201487308f, -0.00196520844f, -0.0019154835f, -0.0018657f, -0.00181586004f, -0.00176596537f, -0.00171601796f, -0.00166601967f,
+    -0.00161597237f, -0.00156587805f, -0.00151573855f, -0.00146555575f, -0.00141533162f, -0.00136506802f, -0.00131476682f, -0.00126442988f,
+    -0.0012140593f, -0.00116365682f, -0.00111322443f, -0.00106276397f, -0.00101227744f, -0.000961766636f, -0.000911233539f, -0.000860680069f,
+    -0.000810108089f, -0.00075951952f, -0.000708916283f, -0.000658300298f, -0.000607673486f, -0.000557037711f, -0.000506394892f, -0.00045574698f,
+    -0.000405095838f, -0.000354443386f, -0.000303791545f, -0.000253142236f, -0.000202497322f, -0.000151858738f, -0.00010122839f, -5.06081742e-05f,
+    3.23384176e-17f, 5.05942335e-05f, 0.00010117262f, 0.000151733271f, 0.00020227427f, 0.000252793718f, 0.000303289737f, 0.000353760435f,
+    0.000404203893f, 0.000454618217f, 0.000505001517f, 0.000555351959f, 0.000605667592f, 0.000655946555f, 0.000706186984f, 0.000756386959f,
+    0.000806544616f, 0.000856658036f, 0.000906725414f, 0.000956744887f, 0.00100671453f, 0.00105663249f, 0.00110649678f, 0.00115630578f,
+    0.0012060575f, 0.00125575007f, 0.00130538165f, 0.00135495048f, 0.00140445458f, 0.0014538921f, 0.00150326116f, 0.00155256013f,
+    0.00160178705f, 0.00165094004f, 0.00170001725f, 0.00174901704f, 0.00179793732f, 0.00184677646f, 0.00189553259f, 0.00194420398f,
+    0.00199278863f, 0.00204128493f, 0.00208969088f, 0.00213800487f, 0.00218622503f, 0.00223434949f, 0.0022823764f, 0.00233030436f,
+    0.00237813126f, 0.00242585549f, 0.00247347518f, 0.00252098846f, 0.00256839395f, 0.00261568953f, 0.00266287336f, 0.00270994403f,
+    0.00275689969f, 0.00280373869f, 0.00285045919f, 0.00289705931f, 0.00294353743f, 0.00298989215f, 0.00303612114f, 0.00308222324f,
+    0.00312819658f, 0.0031740393f, 0.00321975001f, 0.00326532684f, 0.00331076793f, 0.00335607212f, 0.00340123707f, 0.00344626186f,
+    0.00349114416f, 0.0035358828f, 0.00358047569f, 0.00362492166f, 0.00366921886f, 0.00371336541f, 0.00375736016f, 0.00380120124f,
+    0.00384488702f, 0.0038884161f, 0.0039317864f, 0.00397499697f, 0.00401804596f, 0.0040609315f, 0.00410365267f, 0.00414620712f,
+    0.00418859394f, 0.00423081126f, 0.00427285722f, 0.00431473134f, 0.00435643084f, 0.00439795526f, 0.00443930225f, 0.00448047044f,
+    0.00452145888f, 0.00456226571f, 0.00460288953f, 0.00464332895f, 0.00468358211f, 0.00472364761f, 0.00476352451f, 0.0048032105f,
+    0.00484270509f, 0.00488200644f, 0.00492111268f, 0.00496002333f, 0.00499873608f, 0.00503725f, 0.00507556368f, 0.00511367526f,
+    0.00515158428f, 0.00518928841f, 0.00522678671f, 0.00526407827f, 0.00530116074f, 0.00533803366f, 0.00537469564f, 0.00541114435f,
+    0.00544737978f, 0.00548340008f, 0.00551920338f, 0.00555478968f, 0.00559015619f, 0.0056253029f, 0.00566022797f, 0.00569493044f,
+    0.00572940847f, 0.00576366158f, 0.00579768792f, 0.00583148655f, 0.00586505607f, 0.00589839602f, 0.00593150407f, 0.00596437976f,
+    0.00599702168f, 0.00602942891f, 0.00606160006f, 0.00609353418f, 0.00612522988f, 0.00615668576f, 0.00618790137f, 0.00621887576f,
+    0.00624960708f, 0.00628009439f, 0.00631033676f, 0.00634033326f, 0.0063700825f, 0.006399584f, 0.00642883591f, 0.00645783776f,
+    0.00648658862f, 0.00651508709f, 0.00654333225f, 0.00657132361f, 0.00659905933f, 0.00662653893f, 0.00665376149f, 0.00668072561f,
+    0.00670743128f, 0.00673387665f, 0.00676006079f, 0.00678598369f, 0.00681164348f, 0.00683703972f, 0.00686217146f, 0.00688703777f,
+    0.00691163819f, 0.00693597086f, 0.00696003623f, 0.00698383246f, 0.00700735906f, 0.00703061558f, 0.00705360062f, 0.00707631372f,
+    0.00709875394f, 0.00712092081f, 0.00714281341f, 0.0071644308f, 0.00718577253f, 0.00720683765f, 0.0072276257f, 0.00724813528f,
+    0.00726836687f, 0.00728831859f, 0.00730799092f, 0.00732738199f, 0.00734649226f, 0.00736531988f, 0.0073838653f, 0.00740212761f,
+    0.00742010633f, 0.00743780006f, 0.0074552088f, 0.00747233257f, 0.00748916948f, 0.00750572002f, 0.00752198324f, 0.00753795868f,
+    0.00755364588f, 0.00756904436f, 0.00758415321f, 0.00759897241f, 0.00761350151f, 0.00762773957f, 0.00764168659f, 0.00765534211f,
+    0.00766870519f, 0.00768177584f, 0.00769455358f, 0.00770703796f, 0.00771922898f, 0.00773112569f, 0.00774272764f, 0.00775403483f,
+    0.00776504725f, 0.00777576398f, 0.00778618501f, 0.00779630942f, 0.00780613814f, 0.00781566929f, 0.00782490429f, 0.00783384126f,
+    0.00784248114f, 0.00785082392f, 0.00785886776f, 0.00786661357f, 0.00787406135f, 0.00788121019f, 0.00788806006f, 0.00789461099f,
+    0.00790086295f, 0.00790681597f, 0.0079124691f, 0.00791782234f, 0.00792287663f, 0.0079276301f, 0.00793208461f, 0.00793623924f,
+    0.00794009306f, 0.00794364698f, 0.00794690102f, 0.00794985518f, 0.00795250852f, 0.00795486197f, 0.0079569146f, 0.00795866735f,
+    0.00796012022f, 0.00796127226f, 0.00796212442f, 0.00796267577f, 0.00796292815f, 0.00796287972f, 0.00796253234f, 0.00796188414f,
+    0.00796093699f, 0.00795968994f, 0.00795814395f, 0.00795629807f, 0.00795415323f, 0.00795170944f, 0.0079489667f, 0.007945925f,
+    0.00794258527f, 0.00793894753f, 0.00793501083f, 0.00793077704f, 0.00792624615f, 0.00792141724f, 0.00791629218f, 0.00791086908f,
+    0.00790515076f, 0.00789913535f, 0.00789282471f, 0.00788621791f, 0.00787931681f, 0.00787212048f, 0.00786462892f, 0.00785684399f,
+    0.0078487657f, 0.00784039311f, 0.00783172809f, 0.00782276969f, 0.0078135198f, 0.0078039784f, 0.00779414549f, 0.00778402155f,
+    0.00777360704f, 0.00776290288f, 0.00775190955f, 0.00774062704f, 0.00772905583f, 0.00771719683f, 0.00770505099f, 0.00769261783f,
+    0.00767989829f, 0.0076668933f, 0.00765360286f, 0.00764002791f, 0.0076261689f, 0.0076120263f, 0.00759760151f, 0.00758289406f,
+    0.00756790489f, 0.00755263539f, 0.0075370851f, 0.00752125541f, 0.00750514725f, 0.00748876017f, 0.00747209601f, 0.00745515479f,
+    0.00743793743f, 0.00742044486f, 0.00740267755f, 0.00738463644f, 0.00736632198f, 0.00734773511f, 0.00732887676f, 0.00730974739f,
+    0.00729034841f, 0.00727067981f, 0.00725074299f, 0.00723053841f, 0.00721006701f, 0.00718932971f, 0.00716832746f, 0.00714706117f,
+    0.00712553132f, 0.00710373931f, 0.00708168559f, 0.0070593711f, 0.00703679677f, 0.007013964f, 0.00699087325f, 0.00696752546f,
+    0.00694392156f, 0.00692006294f, 0.00689595006f, 0.00687158387f, 0.00684696622f, 0.00682209712f, 0.00679697795f, 0.00677160965f,
+    0.00674599316f, 0.00672012987f, 0.0066940207f, 0.0066676666f, 0.0066410685f, 0.00661422731f, 0.00658714492f, 0.00655982178f,
+    0.00653225882f, 0.00650445791f, 0.00647641905f, 0.00644814456f, 0.00641963491f, 0.00639089104f, 0.00636191433f, 0.00633270666f,
+    0.00630326802f, 0.00627360027f, 0.00624370389f, 0.00621358119f, 0.00618323265f, 0.00615265965f, 0.00612186315f, 0.00609084452f,
+    0.00605960516f, 0.00602814648f, 0.00599646894f, 0.0059645744f, 0.00593246426f, 0.00590013945f, 0.00586760091f, 0.00583485095f,
+    0.00580189005f, 0.00576871959f, 0.00573534099f, 0.00570175564f, 0.00566796493f, 0.00563396979f, 0.00559977209f, 0.00556537276f,
+    0.00553077366f, 0.00549597526f, 0.00546097988f, 0.005425788f, 0.00539040193f, 0.00535482215f, 0.00531905098f, 0.00528308889f,
+    0.00524693821f, 0.0052105994f, 0.00517407479f, 0.00513736531f, 0.0051004719f, 0.00506339734f, 0.00502614165f, 0.0049887076f,
+    0.00495109521f, 0.00491330726f, 0.00487534469f, 0.00483720843f, 0.00479890127f, 0.00476042321f, 0.00472177705f, 0.00468296325f,
+    0.00464398414f, 0.00460484065f, 0.00456553418f, 0.00452606706f, 0.00448644022f, 0.00444665551f, 0.00440671435f, 0.00436661765f,
+    0.00432636822f, 0.00428596651f, 0.00424541486f, 0.00420471421f, 0.0041638664f, 0.0041228733f, 0.00408173585f, 0.00404045638f,
+    0.00399903581f, 0.003957476f, 0.00391577883f, 0.00387394568f, 0.00383197819f, 0.00378987775f, 0.00374764646f, 0.00370528549f,
+    0.00366279646f, 0.00362018147f, 0.00357744191f, 0.00353457918f, 0.00349159515f, 0.00344849168f, 0.00340527017f, 0.00336193223f,
+    0.00331847952f, 0.00327491388f, 0.00323123718f, 0.00318745058f, 0.00314355595f, 0.00309955515f, 0.00305544958f, 0.00301124132f,
+    0.00296693179f, 0.0029225226f, 0.00287801563f, 0.00283341249f, 0.00278871506f, 0.00274392497f, 0.00269904383f, 0.00265407329f,
+    0.00260901521f, 0.00256387144f, 0.00251864339f, 0.00247333315f, 0.00242794212f, 0.00238247216f, 0.00233692513f, 0.00229130243f,
+    0.00224560616f, 0.00219983794f, 0.0021539994f, 0.00210809242f, 0.00206211861f, 0.00201608008f, 0.00196997798f, 0.00192381465f,
+    0.00187759148f, 0.00183131034f, 0.00178497308f, 0.00173858122f, 0.00169213687f, 0.0016456414f, 0.00159909693f, 0.00155250495f,
+    0.00150586746f, 0.00145918608f, 0.00141246256f, 0.00136569876f, 0.00131889642f, 0.0012720573f, 0.00122518325f, 0.00117827591f,
+    0.00113133725f, 0.00108436879f, 0.00103737251f, 0.000990350149f, 0.000943303399f, 0.000896234182f, 0.000849144126f, 0.000802035094f,
+    0.000754908833f, 0.000707767147f, 0.00066061184f, 0.000613444601f, 0.000566267292f, 0.000519081717f, 0.000471889565f, 0.000424692669f,
+    0.000377492775f, 0.000330291718f, 0.000283091213f, 0.000235893094f, 0.000188699094f, 0.000141511016f, 9.43306222e-05f, 4.71596941e-05f,
+    5.27122003e-17f, -4.7146681e-05f, -9.42785846e-05f, -0.000141393932f, -0.000188490943f, -0.000235567873f, -0.000282622961f, -0.000329654402f,
+    -0.000376660435f, -0.000423639343f, -0.000470589323f, -0.000517508597f, -0.000564395508f, -0.000611248135f, -0.000658064848f, -0.0007048439f,
+    -0.000751583488f, -0.000798281806f, -0.000844937225f, -0.000891547941f, -0.000938112207f, -0.000984628336f, -0.00103109446f, -0.00107750902f,
+    -0.00112387014f, -0.0011701762f, -0.00121642533f, -0.0012626159f, -0.00130874617f, -0.00135481451f, -0.00140081905f, -0.00144675805f,
+    -0.00149262999f, -0.00153843302f, -0.0015841655f, -0.00162982557f, -0.00167541183f, -0.0017209223f, -0.00176635536f, -0.00181170949f,
+    -0.00185698282f, -0.00190217362f, -0.00194728037f, -0.00199230132f, -0.00203723484f, -0.00208207918f, -0.00212683296f, -0.00217149407f,
+    -0.00221606111f, -0.00226053223f, -0.00230490603f, -0.00234918087f, -0.00239335489f, -0.00243742671f, -0.00248139445f, -0.00252525671f,
+    -0.00256901165f, -0.00261265785f, -0.00265619368f, -0.0026996173f, -0.00274292729f, -0.00278612203f, -0.00282919989f, -0.00287215924f,
+    -0.00291499868f, -0.00295771635f, -0.00300031085f, -0.00304278079f, -0.00308512431f, -0.00312733999f, -0.003169426f, -0.00321138138f,
+    -0.00325320405f, -0.00329489261f, -0.00333644543f, -0.00337786134f, -0.00341913849f, -0.00346027571f, -0.0035012709f, -0.00354212313f,
+    -0.00358283054f, -0.00362339197f, -0.00366380555f, -0.00370407011f, -0.00374418381f, -0.00378414569f, -0.00382395391f, -0.00386360707f,
+    -0.00390310376f, -0.00394244259f, -0.00398162194f, -0.00402064063f, -0.00405949727f, -0.00409818999f, -0.00413671788f, -0.00417507952f,
+    -0.00421327306f, -0.00425129756f, -0.00428915117f, -0.00432683295f, -0.00436434103f, -0.00440167496f, -0.0044388324f, -0.00447581243f,
+    -0.00451261364f, -0.00454923511f, -0.0045856745f, -0.00462193182f, -0.00465800427f, -0.00469389185f, -0.00472959271f, -0.00476510543f,
+    -0.0048004291f, -0.00483556185f, -0.00487050321f, -0.00490525132f, -0.00493980478f, -0.00497416314f, -0.00500832452f, -0.00504228752f,
+    -0.00507605122f, -0.00510961469f, -0.00514297653f, -0.00517613534f, -0.00520909019f, -0.00524183922f, -0.00527438242f, -0.00530671747f,
+    -0.00533884391f, -0.0053707608f, -0.00540246628f, -0.00543395942f, -0.00546523929f, -0.00549630448f, -0.00552715408f, -0.0055577876f,
+    -0.00558820274f, -0.00561839901f, -0.00564837549f, -0.00567813125f, -0.00570766442f, -0.00573697453f, -0.00576606067f, -0.00579492189f,
+    -0.00582355633f, -0.00585196353f, -0.00588014303f, -0.00590809295f, -0.00593581237f, -0.00596330082f, -0.00599055737f, -0.00601758016f,
+    -0.00604436919f, -0.00607092306f, -0.0060972413f, -0.00612332206f, -0.00614916533f, -0.00617476972f, -0.00620013475f, -0.00622525904f,
+    -0.00625014212f, -0.00627478259f, -0.00629917998f, -0.00632333336f, -0.00634724228f, -0.00637090532f, -0.00639432156f, -0.00641749101f,
+    -0.00644041225f, -0.00646308437f, -0.00648550689f, -0.00650767889f, -0.00652959989f, -0.00655126851f, -0.00657268474f, -0.00659384718f,
+    -0.00661475584f, -0.00663540931f, -0.00665580714f, -0.00667594885f, -0.00669583352f, -0.00671546021f, -0.00673482893f, -0.00675393827f,
+    -0.00677278824f, -0.00679137791f, -0.00680970633f, -0.00682777353f, -0.00684557855f, -0.00686312094f, -0.00688039977f, -0.00689741457f,
+    -0.00691416487f, -0.00693065068f, -0.00694687059f, -0.00696282415f, -0.00697851134f, -0.00699393125f, -0.00700908341f, -0.00702396734f,
+    -0.00703858258f, -0.00705292867f, -0.00706700562f, -0.00708081201f, -0.00709434832f, -0.00710761314f, -0.00712060696f, -0.00713332882f,
+    -0.00714577874f, -0.00715795625f, -0.00716986042f, -0.00718149124f, -0.00719284825f, -0.00720393145f, -0.00721474038f, -0.00722527457f,
+    -0.00723553356f, -0.00724551687f, -0.00725522498f, -0.00726465695f, -0.00727381278f, -0.00728269247f, -0.0072912951f, -0.00729962066f,
+    -0.00730766868f, -0.00731543964f, -0.00732293306f, -0.00733014848f, -0.00733708544f, -0.00734374486f, -0.00735012535f, -0.00735622738f,
+    -0.00736205047f, -0.00736759463f, -0.00737285987f, -0.00737784617f, -0.00738255307f, -0.00738698058f, -0.00739112869f, -0.0073949974f,
+    -0.00739858625f, -0.00740189571f, -0.0074049253f, -0.00740767503f, -0.0074101449f, -0.00741233537f, -0.00741424598f, -0.00741587672f,
+    -0.00741722761f, -0.00741829909f, -0.00741909072f, -0.00741960248f, -0.00741983484f, -0.00741978781f, -0.00741946092f, -0.00741885509f,
+    -0.00741796987f, -0.00741680525f, -0.0074153617f, -0.00741363969f, -0.00741163827f, -0.00740935886f, -0.00740680052f, -0.00740396418f,
+    -0.00740084983f, -0.00739745749f, -0.00739378715f, -0.00738983974f, -0.00738561479f, -0.00738111325f, -0.00737633463f, -0.00737127988f,
+    -0.00736594852f, -0.00736034103f, -0.00735445833f, -0.00734829996f, -0.00734186685f, -0.00733515853f, -0.00732817594f, -0.00732091954f,
+    -0.00731338933f, -0.00730558531f, -0.00729750888f, -0.00728915958f, -0.00728053786f, -0.00727164466f, -0.00726247951f, -0.00725304382f,
+    -0.00724333758f, -0.00723336078f, -0.00722311484f, -0.00721259927f, -0.00720181502f, -0.00719076255f, -0.00717944233f, -0.00716785481f,
+    -0.00715600094f, -0.00714388024f, -0.00713149412f, -0.00711884256f, -0.00710592652f, -0.00709274644f, -0.0070793028f, -0.00706559606f,
+    -0.00705162715f, -0.00703739654f, -0.00702290516f, -0.00700815255f, -0.00699314056f, -0.0069778692f, -0.00696233939f, -0.00694655115f,
+    -0.00693050632f, -0.00691420445f, -0.00689764647f, -0.00688083377f, -0.00686376635f, -0.00684644515f, -0.00682887062f, -0.00681104418f,
+    -0.00679296581f, -0.00677463692f, -0.0067560575f, -0.00673722895f, -0.0067181522f, -0.00669882726f, -0.00667925552f, -0.00665943744f,
+    -0.00663937395f, -0.006619066f, -0.0065985145f, -0.0065777204f, -0.00655668415f, -0.00653540622f, -0.00651388848f, -0.00649213139f,
+    -0.00647013588f, -0.00644790241f, -0.0064254324f, -0.00640272675f, -0.00637978595f, -0.00635661138f, -0.00633320399f, -0.00630956423f,
+    -0.0062856935f, -0.00626159227f, -0.00623726239f, -0.00621270388f, -0.00618791813f, -0.00616290653f, -0.00613766955f, -0.00611220859f,
+    -0.00608652411f, -0.00606061751f, -0.00603449019f, -0.00600814261f, -0.0059815757f, -0.00595479133f, -0.00592778996f, -0.00590057252f,
+    -0.00587314041f, -0.00584549503f, -0.00581763685f, -0.00578956725f, -0.00576128718f, -0.00573279848f, -0.00570410118f, -0.00567519711f,
+    -0.00564608769f, -0.00561677339f, -0.00558725558f, -0.00555753522f, -0.00552761415f, -0.00549749285f, -0.00546717318f, -0.00543665607f,
+    -0.00540594198f, -0.00537503324f, -0.0053439308f, -0.0053126351f, -0.00528114848f, -0.0052494714f, -0.00521760527f, -0.00518555148f,
+    -0.00515331142f, -0.00512088602f, -0.00508827716f, -0.00505548529f, -0.00502251182f, -0.0049893586f, -0.00495602656f, -0.00492251711f,
+    -0.00488883164f, -0.00485497108f, -0.00482093729f, -0.00478673121f, -0.00475235423f, -0.00471780775f, -0.00468309317f, -0.00464821188f,
+    -0.00461316528f, -0.0045779543f, -0.00454258081f, -0.00450704619f, -0.00447135139f, -0.00443549827f, -0.00439948775f, -0.0043633217f,
+    -0.00432700105f, -0.00429052766f, -0.00425390294f, -0.0042171278f, -0.00418020412f, -0.00414313329f, -0.00410591625f, -0.00406855531f,
+    -0.00403105142f, -0.00399340596f, -0.00395562034f, -0.00391769642f, -0.00387963559f, -0.0038414388f, -0.00380310812f, -0.00376464473f,
+    -0.00372605026f, -0.0036873261f, -0.00364847365f, -0.00360949454f, -0.0035703904f, -0.00353116263f, -0.00349181262f, -0.00345234177f,
+    -0.00341275218f, -0.00337304478f, -0.00333322142f, -0.00329328352f, -0.00325323245f, -0.0032130701f, -0.00317279785f, -0.0031324171f,
+    -0.00309192971f, -0.00305133709f, -0.00301064062f, -0.00296984217f, -0.00292894291f, -0.00288794492f, -0.00284684938f, -0.00280565792f,
+    -0.00276437216f, -0.00272299373f, -0.00268152426f, -0.00263996539f, -0.0025983185f, -0.00255658501f, -0.00251476699f, -0.00247286586f,
+    -0.00243088324f, -0.00238882052f, -0.00234667957f, -0.00230446178f, -0.00226216903f, -0.00221980247f, -0.00217736443f, -0.00213485584f,
+    -0.0020922788f, -0.00204963447f, -0.00200692494f, -0.00196415163f, -0.00192131614f, -0.00187842012f, -0.00183546531f, -0.00179245311f,
+    -0.0017493855f, -0.00170626375f, -0.00166308973f, -0.00161986495f, -0.00157659117f, -0.00153327f, -0.00148990308f, -0.00144649204f,
+    -0.00140303851f, -0.00135954411f, -0.0013160106f, -0.00127243961f, -0.00122883276f, -0.00118519156f, -0.00114151789f, -0.00109781337f,
+    -0.0010540795f, -0.00101031805f, -0.000966530642f, -0.000922719017f, -0.00087888469f, -0.000835029467f, -0.00079115486f, -0.000747262617f,
+    -0.000703354424f, -0.000659431855f, -0.000615496596f, -0.000571550336f, -0.000527594646f, -0.000483631331f, -0.000439661933f, -0.00039568817f,
+    -0.000351711671f, -0.000307734066f, -0.000263757072f, -0.000219782305f, -0.000175811438f, -0.000131846115f, -8.78880019e-05f, -4.39387477e-05f,
+    -2.45515693e-17f, 4.39265859e-05f, 8.78393548e-05f, 0.000131736655f, 0.000175616849f, 0.000219478286f, 0.000263319322f, 0.000307138282f,
+    0.000350933551f, 0.000394703471f, 0.000438446412f, 0.000482160744f, 0.000525844807f, 0.000569496944f, 0.000613115611f, 0.000656699063f,
+    0.000700245728f, 0.000743753917f, 0.000787222118f, 0.000830648583f, 0.000874031743f, 0.000917370024f, 0.00096066168f, 0.0010039052f,
+    0.00104709901f, 0.00109024125f, 0.00113333063f, 0.0011763653f, 0.00121934386f, 0.00126226456f, 0.00130512577f, 0.00134792598f,
+    0.00139066356f, 0.00143333699f, 0.00147594453f, 0.00151848479f, 0.00156095601f, 0.00160335668f, 0.00164568517f, 0.00168793998f,
+    0.00173011958f, 0.00177222223f, 0.00181424653f, 0.00185619097f, 0.00189805368f, 0.00193983351f, 0.00198152848f, 0.00202313741f,
+    0.00206465856f, 0.00210609054f, 0.00214743172f, 0.00218868046f, 0.00222983537f, 0.00227089506f, 0.00231185765f, 0.00235272199f,
+    0.00239348621f, 0.00243414915f, 0.00247470895f, 0.00251516444f, 0.00255551399f, 0.0025957562f, 0.00263588922f, 0.00267591211f,
+    0.00271582301f, 0.00275562075f, 0.00279530347f, 0.00283487001f, 0.00287431874f, 0.00291364826f, 0.00295285718f, 0.00299194409f,
+    0.00303090736f, 0.00306974584f, 0.00310845789f, 0.00314704212f, 0.00318549713f, 0.00322382152f, 0.0032620139f, 0.00330007263f,
+    0.00333799678f, 0.00337578449f, 0.00341343484f, 0.00345094595f, 0.0034883169f, 0.00352554582f, 0.00356263202f, 0.00359957339f,
+    0.00363636925f, 0.00367301772f, 0.00370951788f, 0.0037458681f, 0.00378206722f, 0.00381811382f, 0.00385400653f, 0.0038897444f,
+    0.00392532581f, 0.00396074913f, 0.00399601366f, 0.00403111801f, 0.00406606076f, 0.004100841f, 0.00413545687f, 0.00416990742f,
+    0.00420419127f, 0.00423830748f, 0.00427225418f, 0.00430603093f, 0.00433963584f, 0.00437306846f, 0.00440632645f, 0.00443940982f,
+    0.00447231671f, 0.00450504571f, 0.00453759637f, 0.00456996681f, 0.00460215658f, 0.00463416381f, 0.00466598757f, 0.00469762692f,
+    0.00472908048f, 0.00476034684f, 0.00479142554f, 0.00482231518f, 0.00485301483f, 0.0048835231f, 0.00491383905f, 0.00494396128f,
+    0.00497388886f, 0.00500362087f, 0.00503315637f, 0.00506249396f, 0.00509163318f, 0.00512057217f, 0.00514930999f, 0.00517784618f,
+    0.00520617934f, 0.00523430901f, 0.00526223332f, 0.00528995181f, 0.00531746307f, 0.00534476666f, 0.00537186163f, 0.00539874658f,
+    0.00542542059f, 0.00545188272f, 0.00547813252f, 0.00550416857f, 0.00552999042f, 0.0055555962f, 0.00558098592f, 0.00560615864f,
+    0.00563111296f, 0.00565584842f, 0.00568036409f, 0.00570465857f, 0.00572873186f, 0.00575258257f, 0.00577620976f, 0.00579961343f,
+    0.00582279172f, 0.00584574416f, 0.0058684703f, 0.00589096919f, 0.0059132399f, 0.00593528152f, 0.00595709356f, 0.00597867509f,
+    0.00600002566f, 0.00602114433f, 0.00604203017f, 0.00606268272f, 0.0060831015f, 0.00610328512f, 0.00612323359f, 0.00614294549f,
+    0.00616242085f, 0.00618165871f, 0.00620065816f, 0.00621941919f, 0.0062379404f, 0.00625622133f, 0.00627426198f, 0.00629206141f,
+    0.00630961871f, 0.00632693339f, 0.006344005f, 0.00636083307f, 0.00637741666f, 0.00639375579f, 0.00640984951f, 0.00642569689f,
+    0.00644129841f, 0.00645665266f, 0.00647175964f, 0.00648661843f, 0.00650122901f, 0.00651559047f, 0.0065297028f, 0.00654356508f,
+    0.00655717729f, 0.00657053851f, 0.00658364873f, 0.00659650704f, 0.00660911389f, 0.00662146788f, 0.00663356902f, 0.00664541684f,
+    0.00665701134f, 0.00666835206f, 0.00667943805f, 0.0066902698f, 0.00670084637f, 0.00671116728f, 0.00672123302f, 0.00673104264f,
+    0.00674059615f, 0.00674989307f, 0.00675893296f, 0.00676771579f, 0.00677624159f, 0.0067845094f, 0.00679251971f, 0.00680027204f,
+    0.00680776592f, 0.00681500137f, 0.00682197791f, 0.00682869554f, 0.00683515426f, 0.00684135407f, 0.00684729405f, 0.00685297465f,
+    0.00685839541f, 0.00686355634f, 0.00686845742f, 0.00687309867f, 0.00687747961f, 0.00688160025f, 0.00688546011f, 0.00688906014f,
+    0.0068923994f, 0.00689547835f, 0.00689829653f, 0.00690085441f, 0.00690315152f, 0.00690518785f, 0.00690696342f, 0.00690847868f,
+    0.00690973317f, 0.00691072689f, 0.00691146031f, 0.00691193342f, 0.00691214576f, 0.00691209733f, 0.00691178907f, 0.00691122049f,
+    0.00691039162f, 0.0069093029f, 0.00690795388f, 0.00690634549f, 0.00690447725f, 0.00690234918f, 0.0068999622f, 0.00689731585f,
+    0.00689441012f, 0.00689124595f, 0.00688782288f, 0.00688414136f, 0.0068802014f, 0.00687600393f, 0.00687154802f, 0.00686683506f,
+    0.00686186412f, 0.00685663661f, 0.00685115205f, 0.00684541138f, 0.00683941413f, 0.00683316076f, 0.00682665221f, 0.00681988802f,
+    0.00681286911f, 0.00680559548f, 0.00679806713f, 0.00679028546f, 0.00678224955f, 0.00677396078f, 0.00676541915f, 0.00675662514f,
+    0.00674757874f, 0.00673828088f, 0.00672873203f, 0.00671893219f, 0.00670888228f, 0.00669858186f, 0.00668803276f, 0.00667723408f,
+    0.0066661872f, 0.00665489212f, 0.00664334977f, 0.00663156016f, 0.00661952421f, 0.00660724193f, 0.00659471471f, 0.00658194209f,
+    0.00656892546f, 0.00655566482f, 0.00654216111f, 0.00652841479f, 0.00651442632f, 0.00650019618f, 0.00648572529f, 0.00647101412f,
+    0.00645606359f, 0.00644087372f, 0.00642544543f, 0.00640977966f, 0.00639387639f, 0.00637773704f, 0.00636136206f, 0.00634475192f,
+    0.00632790709f, 0.00631082896f, 0.006293518f, 0.00627597468f, 0.00625819946f, 0.00624019373f, 0.00622195797f, 0.0062034931f,
+    0.0061847996f, 0.00616587838f, 0.00614672992f, 0.00612735562f, 0.00610775547f, 0.00608793087f, 0.00606788276f, 0.00604761159f,
+    0.00602711784f, 0.00600640336f, 0.00598546816f, 0.00596431317f, 0.00594293931f, 0.005921348f, 0.00589953922f, 0.00587751484f,
+    0.00585527485f, 0.0058328202f, 0.00581015274f, 0.00578727247f, 0.00576418033f, 0.00574087771f, 0.00571736507f, 0.00569364382f,
+    0.00566971488f, 0.00564557873f, 0.00562123675f, 0.00559668988f, 0.00557193905f, 0.00554698519f, 0.00552182924f, 0.00549647259f,
+    0.0054709157f, 0.00544515997f, 0.00541920634f, 0.00539305573f, 0.00536670908f, 0.00534016779f, 0.00531343278f, 0.00528650498f,
+    0.00525938533f, 0.00523207523f, 0.00520457607f, 0.00517688785f, 0.0051490129f, 0.00512095168f, 0.00509270513f, 0.00506427465f,
+    0.00503566163f, 0.00500686653f, 0.00497789076f, 0.0049487357f, 0.00491940277f, 0.00488989195f, 0.00486020558f, 0.00483034458f,
+    0.00480030989f, 0.00477010245f, 0.00473972363f, 0.00470917486f, 0.00467845751f, 0.00464757206f, 0.00461652037f, 0.00458530383f,
+    0.00455392245f, 0.00452237902f, 0.00449067354f, 0.00445880787f, 0.00442678295f, 0.00439460017f, 0.00436226092f, 0.00432976661f,
+    0.00429711817f, 0.00426431652f, 0.004231364f, 0.00419826061f, 0.00416500866f, 0.00413160911f, 0.00409806333f, 0.00406437228f,
+    0.00403053733f, 0.00399656035f, 0.00396244228f, 0.00392818404f, 0.00389378774f, 0.0038592543f, 0.00382458488f, 0.00378978136f,
+    0.00375484442f, 0.00371977594f, 0.0036845773f, 0.00364924944f, 0.00361379399f, 0.00357821211f, 0.00354250567f, 0.0035066756f,
+    0.00347072328f, 0.00343465037f, 0.00339845801f, 0.00336214784f, 0.00332572102f, 0.00328917918f, 0.00325252349f, 0.00321575557f,
+    0.00317887659f, 0.00314188818f, 0.00310479198f, 0.0030675889f, 0.00303028058f, 0.00299286866f, 0.00295535428f, 0.0029177391f,
+    0.00288002449f, 0.00284221186f, 0.00280430261f, 0.00276629836f, 0.00272820052f, 0.00269001047f, 0.00265172962f, 0.0026133596f,
+    0.00257490203f, 0.00253635785f, 0.00249772915f, 0.00245901686f, 0.00242022285f, 0.00238134828f, 0.00234239502f, 0.00230336445f,
+    0.00226425775f, 0.00222507678f, 0.00218582293f, 0.0021464976f, 0.00210710219f, 0.00206763856f, 0.00202810811f, 0.001988512f,
+    0.00194885221f, 0.00190913002f, 0.00186934695f, 0.0018295045f, 0.0017896042f, 0.00174964766f, 0.0017096363f, 0.00166957173f,
+    0.00162945536f, 0.0015892887f, 0.00154907349f, 0.00150881102f, 0.00146850303f, 0.0014281508f, 0.00138775609f, 0.00134732039f,
+    0.00130684511f, 0.00126633188f, 0.00122578221f, 0.00118519762f, 0.00114457973f, 0.00110393006f, 0.00106325001f, 0.00102254131f,
+    0.00098180538f, 0.000941043894f, 0.000900258194f, 0.000859449967f, 0.000818620727f, 0.000777772046f, 0.000736905378f, 0.000696022355f,
+    0.00065512443f, 0.000614213292f, 0.000573290337f, 0.000532357197f, 0.000491415383f, 0.000450466498f, 0.000409511995f, 0.000368553476f,
+    0.000327592454f, 0.0002866305f, 0.000245669158f, 0.000204709941f, 0.000163754419f, 0.000122804122f, 8.18605913e-05f, 4.09253698e-05f,
+    -8.25585543e-21f, -4.0913983e-05f, -8.18150438e-05f, -0.000122701633f, -0.000163572229f, -0.000204425291f, -0.000245259289f, -0.000286072696f,
+    -0.000326863956f, -0.000367631554f, -0.000408373948f, -0.000449089654f, -0.00048977707f, -0.000530434772f, -0.000571061159f, -0.000611654716f,
+    -0.00065221393f, -0.000692737289f, -0.000733223336f, -0.000773670443f, -0.000814077153f, -0.000854441954f, -0.000894763391f, -0.000935039832f,
+    -0.000975269882f, -0.00101545197f, -0.00105558475f, -0.00109566643f, -0.00113569584f, -0.00117567123f, -0.00121559121f, -0.00125545426f,
+    -0.00129525899f, -0.00133500388f, -0.00137468742f, -0.00141430809f, -0.0014538645f, -0.00149335514f, -0.00153277849f, -0.00157213316f,
+    -0.00161141763f, -0.0016506305f, -0.00168977026f, -0.00172883552f, -0.00176782475f, -0.00180673657f, -0.00184556947f, -0.00188432215f,
+    -0.00192299287f, -0.00196158048f, -0.00200008368f, -0.0020385005f, -0.00207683002f, -0.00211507059f, -0.00215322082f, -0.00219127932f,
+    -0.00222924491f, -0.00226711575f, -0.00230489066f, -0.00234256824f, -0.00238014711f, -0.00241762586f, -0.00245500333f, -0.00249227765f,
+    -0.00252944767f, -0.00256651221f, -0.00260346988f, -0.00264031906f, -0.00267705857f, -0.00271368702f, -0.00275020301f, -0.00278660515f,
+    -0.00282289227f, -0.00285906298f, -0.00289511611f, -0.00293104979f, -0.00296686334f, -0.00300255511f, -0.00303812372f, -0.00307356822f,
+    -0.003108887f, -0.00314407866f, -0.00317914225f, -0.00321407639f, -0.00324887969f, -0.00328355073f, -0.00331808883f, -0.00335249212f,
+    -0.00338675943f, -0.00342088984f, -0.00345488172f, -0.00348873413f, -0.00352244568f, -0.0035560152f, -0.0035894413f, -0.00362272304f,
+    -0.0036558588f, -0.00368884788f, -0.00372168887f, -0.00375438039f, -0.0037869215f, -0.0038193108f, -0.00385154714f, -0.00388362957f,
+    -0.00391555671f, -0.00394732784f, -0.00397894112f, -0.00401039561f, -0.00404169038f, -0.00407282403f, -0.00410379609f, -0.00413460471f,
+    -0.00416524895f, -0.00419572741f, -0.0042260401f, -0.00425618468f, -0.00428616069f, -0.00431596674f, -0.00434560189f, -0.00437506521f,
+    -0.00440435577f, -0.00443347218f, -0.00446241349f, -0.00449117832f, -0.0045197662f, -0.00454817619f, -0.00457640644f, -0.00460445695f,
+    -0.00463232584f, -0.00466001267f, -0.00468751602f, -0.00471483544f, -0.00474196952f, -0.00476891734f, -0.00479567796f, -0.00482225092f,
+    -0.00484863436f, -0.00487482781f, -0.0049008308f, -0.00492664194f, -0.00495225983f, -0.00497768447f, -0.00500291446f, -0.00502794888f,
+    -0.00505278679f, -0.00507742772f, -0.00510187028f, -0.005126114f, -0.00515015796f, -0.00517400121f, -0.0051976433f, -0.00522108236f,
+    -0.0052443184f, -0.00526735093f, -0.00529017812f, -0.00531279994f, -0.00533521501f, -0.00535742333f, -0.0053794235f, -0.00540121458f,
+    -0.00542279659f, -0.00544416811f, -0.00546532869f, -0.0054862774f, -0.00550701376f, -0.00552753732f, -0.0055478462f, -0.00556794088f,
+    -0.00558781996f, -0.00560748344f, -0.00562692992f, -0.00564615941f, -0.00566517049f, -0.00568396272f, -0.00570253609f, -0.0057208892f,
+    -0.00573902205f, -0.00575693324f, -0.00577462278f, -0.00579208974f, -0.00580933411f, -0.00582635449f, -0.0058431509f, -0.00585972238f,
+    -0.00587606849f, -0.00589218875f, -0.0059080827f, -0.00592374941f, -0.00593918888f, -0.00595440017f, -0.00596938282f, -0.00598413683f,
+    -0.00599866128f, -0.00601295568f, -0.00602701958f, -0.00604085252f, -0.00605445402f, -0.00606782362f, -0.00608096132f, -0.00609386573f,
+    -0.0061065373f, -0.00611897558f, -0.00613117963f, -0.00614314945f, -0.00615488458f, -0.00616638456f, -0.0061776489f, -0.00618867762f,
+    -0.00619947026f, -0.00621002633f, -0.00622034539f, -0.00623042742f, -0.00624027196f, -0.00624987856f, -0.00625924719f, -0.00626837742f,
+    -0.00627726875f, -0.00628592167f, -0.00629433524f, -0.00630250899f, -0.00631044339f, -0.00631813798f, -0.00632559229f, -0.00633280631f,
+    -0.00633978005f, -0.00634651259f, -0.00635300437f, -0.00635925541f, -0.00636526477f, -0.00637103291f, -0.00637655938f, -0.0063818437f,
+    -0.00638688682f, -0.00639168778f, -0.00639624661f, -0.00640056329f, -0.00640463736f, -0.00640846975f, -0.00641205907f, -0.00641540624f,
+    -0.00641851034f, -0.00642137229f, -0.00642399164f, -0.00642636791f, -0.00642850157f, -0.00643039262f, -0.00643204106f, -0.00643344643f,
+    -0.00643460965f, -0.00643552979f, -0.00643620733f, -0.00643664226f, -0.00643683458f, -0.00643678429f, -0.00643649185f, -0.00643595681f,
+    -0.00643517962f, -0.00643416028f, -0.00643289881f, -0.00643139519f, -0.00642965036f, -0.00642766338f, -0.00642543472f, -0.00642296486f,
+    -0.00642025378f, -0.00641730195f, -0.00641410891f, -0.00641067512f, -0.00640700059f, -0.00640308624f, -0.00639893161f, -0.00639453717f,
+    -0.0063899029f, -0.00638502976f, -0.0063799168f, -0.00637456542f, -0.00636897562f, -0.00636314694f, -0.00635708077f, -0.00635077618f,
+    -0.00634423457f, -0.00633745594f, -0.00633044029f, -0.00632318808f, -0.00631569978f, -0.00630797585f, -0.00630001631f, -0.00629182206f,
+    -0.00628339266f, -0.00627472904f, -0.00626583165f, -0.00625670049f, -0.00624733651f, -0.0062377397f, -0.00622791098f, -0.00621784991f,
+    -0.0062075574f, -0.00619703438f, -0.00618628087f, -0.00617529685f, -0.00616408372f, -0.00615264149f, -0.00614097062f, -0.00612907205f,
+    -0.0061169453f, -0.00610459223f, -0.00609201239f, -0.00607920624f, -0.00606617518f, -0.0060529192f, -0.00603943877f, -0.00602573482f,
+    -0.00601180736f, -0.00599765778f, -0.00598328607f, -0.00596869271f, -0.0059538791f, -0.00593884522f, -0.00592359155f, -0.00590811949f,
+    -0.00589242904f, -0.00587652111f, -0.0058603962f, -0.00584405474f, -0.00582749816f, -0.0058107269f, -0.00579374097f, -0.00577654177f,
+    -0.00575912977f, -0.00574150542f, -0.00572367013f, -0.00570562435f, -0.00568736857f, -0.00566890324f, -0.00565023022f, -0.00563134905f,
+    -0.00561226113f, -0.00559296738f, -0.00557346828f, -0.00555376476f, -0.00553385774f, -0.00551374722f, -0.00549343508f, -0.00547292177f,
+    -0.00545220776f, -0.00543129444f, -0.00541018229f, -0.00538887223f, -0.0053673652f, -0.00534566212f, -0.00532376394f, -0.0053016711f,
+    -0.00527938455f, -0.00525690569f, -0.00523423497f, -0.00521137333f, -0.00518832169f, -0.00516508147f, -0.00514165265f, -0.00511803711f,
+    -0.00509423576f, -0.00507024862f, -0.00504607754f, -0.00502172252f, -0.0049971859f, -0.00497246766f, -0.00494756876f, -0.00492249103f,
+    -0.0048972345f, -0.00487180054f, -0.00484619057f, -0.00482040504f, -0.00479444489f, -0.00476831151f, -0.00474200631f, -0.00471552927f,
+    -0.00468888227f, -0.00466206623f, -0.00463508163f, -0.00460793031f, -0.00458061323f, -0.00455313083f, -0.00452548498f, -0.00449767616f,
+    -0.00446970575f, -0.00444157468f, -0.00441328436f, -0.00438483572f, -0.00435623014f, -0.00432746811f, -0.00429855147f, -0.00426948071f,
+    -0.0042402572f, -0.00421088235f, -0.0041813571f, -0.00415168237f, -0.00412185956f, -0.00409189006f, -0.00406177482f, -0.00403151521f,
+    -0.00400111172f, -0.00397056667f, -0.00393988006f, -0.00390905375f, -0.0038780889f, -0.00384698668f, -0.00381574803f, -0.00378437457f,
+    -0.00375286746f, -0.00372122764f, -0.0036894565f, -0.00365755544f, -0.00362552539f, -0.00359336776f, -0.00356108393f, -0.00352867483f,
+    -0.00349614187f, -0.00346348644f, -0.00343070971f, -0.00339781283f, -0.00336479722f, -0.00333166402f, -0.00329841464f, -0.00326505047f,
+    -0.00323157245f, -0.00319798221f, -0.0031642809f, -0.0031304697f, -0.00309655024f, -0.00306252344f, -0.00302839093f, -0.00299415411f,
+    -0.00295981369f, -0.00292537175f, -0.002890829f, -0.00285618706f, -0.00282144733f, -0.00278661121f, -0.00275167963f, -0.00271665421f,
+    -0.00268153637f, -0.00264632725f, -0.00261102826f, -0.00257564103f, -0.00254016649f, -0.00250460627f, -0.00246896176f, -0.00243323413f,
+    -0.00239742477f, -0.00236153509f, -0.00232556672f, -0.00228952081f, -0.00225339853f, -0.00221720175f, -0.00218093139f, -0.00214458909f,
+    -0.00210817624f, -0.00207169424f, -0.00203514425f, -0.00199852791f, -0.0019618466f, -0.00192510162f, -0.00188829447f, -0.00185142644f,
+    -0.00181449892f, -0.00177751353f, -0.00174047146f, -0.0017033742f, -0.00166622328f, -0.00162901985f, -0.00159176555f, -0.00155446178f,
+    -0.00151710981f, -0.00147971115f, -0.00144226733f, -0.00140477961f, -0.00136724941f, -0.00132967834f, -0.0012920677f, -0.00125441886f,
+    -0.00121673325f, -0.00117901247f, -0.00114125782f, -0.0011034708f, -0.0010656527f, -0.00102780515f, -0.000989929424f, -0.00095202704f,
+    -0.000914099393f, -0.000876147998f, -0.000838174194f, -0.000800179434f, -0.000762165175f, -0.000724132871f, -0.00068608392f, -0.000648019835f,
+    -0.000609941955f, -0.000571851793f, -0.000533750746f, -0.000495640328f, -0.000457521848f, -0.00041939682f, -0.000381266669f, -0.000343132881f,
+    -0.000304996822f, -0.000266859948f, -0.000228723715f, -0.000190589548f, -0.000152458888f, -0.000114333176f, -7.62138297e-05f, -3.81022946e-05f,
+    -6.69277723e-17f, 3.80916172e-05f, 7.61711344e-05f, 0.000114237104f, 0.000152288107f, 0.000190322724f, 0.000228339501f, 0.00026633704f,
+    0.0003043139f, 0.000342268642f, 0.000380199868f, 0.000418106123f, 0.000455986039f, 0.000493838161f, 0.000531661033f, 0.000569453347f,
+    0.000607213588f, 0.000644940359f, 0.000682632322f, 0.000720287964f, 0.000757905946f, 0.000795484812f, 0.000833023165f, 0.000870519667f,
+    0.000907972862f, 0.000945381355f, 0.000982743804f, 0.00102005864f, 0.0010573247f, 0.00109454046f, 0.00113170454f, 0.00116881565f,
+    0.00120587228f, 0.00124287314f, 0.00127981673f, 0.00131670176f, 0.00135352695f, 0.0013902908f, 0.00142699201f, 0.00146362907f,
+    0.00150020083f, 0.00153670576f, 0.00157314271f, 0.00160951004f, 0.00164580659f, 0.00168203108f, 0.00171818188f, 0.00175425794f,
+    0.00179025787f, 0.00182618015f, 0.00186202361f, 0.00189778686f, 0.00193346874f, 0.00196906761f, 0.00200458243f, 0.00204001181f,
+    0.00207535434f, 0.00211060885f, 0.00214577396f, 0.00218084827f, 0.00221583084f, 0.00225072005f, 0.00228551449f, 0.00232021324f,
+    0.0023548149f, 0.00238931808f, 0.00242372183f, 0.0024580243f, 0.0024922248f, 0.00252632168f, 0.00256031402f, 0.0025942002f,
+    0.00262797927f, 0.00266164984f, 0.00269521074f, 0.00272866082f, 0.00276199868f, 0.00279522291f, 0.00282833283f, 0.00286132679f,
+    0.00289420388f, 0.00292696245f, 0.00295960181f, 0.00299212057f, 0.00302451733f, 0.00305679115f, 0.00308894087f, 0.00312096509f,
+    0.00315286289f, 0.00318463286f, 0.00321627408f, 0.00324778515f, 0.00327916513f, 0.00331041287f, 0.00334152696f, 0.0033725067f,
+    0.00340335048f, 0.00343405758f, 0.00346462661f, 0.00349505665f, 0.00352534652f, 0.00355549506f, 0.00358550111f, 0.00361536397f,
+    0.003645082f, 0.00367465452f, 0.00370408036f, 0.00373335835f, 0.00376248755f, 0.00379146682f, 0.00382029498f, 0.00384897133f,
+    0.00387749472f, 0.00390586397f, 0.00393407838f, 0.00396213634f, 0.00399003737f, 0.00401778007f, 0.00404536398f, 0.00407278771f,
+    0.00410005031f, 0.0041271504f, 0.00415408798f, 0.00418086117f, 0.00420746952f, 0.0042339121f, 0.0042601875f, 0.00428629527f,
+    0.004312234f, 0.00433800323f, 0.00436360203f, 0.004389029f, 0.00441428367f, 0.00443936465f, 0.00446427148f, 0.00448900368f,
+    0.0045135594f, 0.00453793816f, 0.00456213905f, 0.00458616158f, 0.00461000483f, 0.00463366741f, 0.00465714885f, 0.00468044821f,
+    0.00470356504f, 0.00472649792f, 0.00474924641f, 0.00477180956f, 0.00479418691f, 0.00481637707f, 0.00483837957f, 0.00486019393f,
+    0.00488181924f, 0.0049032541f, 0.0049244985f, 0.00494555151f, 0.00496641221f, 0.00498708012f, 0.00500755431f, 0.00502783386f,
+    0.00504791876f, 0.00506780762f, 0.00508749997f, 0.00510699535f, 0.00512629282f, 0.00514539191f, 0.00516429171f, 0.00518299174f,
+    0.00520149106f, 0.00521978969f, 0.00523788622f, 0.00525578065f, 0.00527347205f, 0.0052909595f, 0.00530824298f, 0.00532532157f,
+    0.00534219481f, 0.00535886222f, 0.00537532289f, 0.00539157679f, 0.00540762302f, 0.00542346062f, 0.00543909008f, 0.00545450998f,
+    0.00546971988f, 0.00548471976f, 0.0054995087f, 0.00551408622f, 0.00552845234f, 0.00554260612f, 0.00555654662f, 0.00557027431f,
+    0.00558378873f, 0.00559708849f, 0.00561017357f, 0.00562304398f, 0.00563569926f, 0.005648138f, 0.00566036114f, 0.00567236729f,
+    0.00568415644f, 0.00569572812f, 0.00570708234f, 0.00571821816f, 0.00572913559f, 0.00573983369f, 0.00575031294f, 0.00576057285f,
+    0.00577061251f, 0.00578043237f, 0.00579003152f, 0.00579940993f, 0.00580856716f, 0.0058175032f, 0.00582621759f, 0.00583470985f,
+    0.00584298046f, 0.00585102802f, 0.00585885346f, 0.00586645585f, 0.00587383471f, 0.005880991f, 0.0058879233f, 0.00589463208f,
+    0.00590111641f, 0.00590737723f, 0.0059134136f, 0.00591922551f, 0.00592481298f, 0.00593017554f, 0.00593531318f, 0.00594022591f,
+    0.00594491372f, 0.00594937615f, 0.0059536132f, 0.00595762488f, 0.0059614107f, 0.00596497115f, 0.00596830621f, 0.00597141497f,
+    0.00597429834f, 0.00597695587f, 0.00597938709f, 0.00598159293f, 0.00598357245f, 0.00598532613f, 0.00598685397f, 0.00598815596f,
+    0.0059892321f, 0.00599008193f, 0.00599070638f, 0.00599110452f, 0.00599127728f, 0.0059912242f, 0.00599094527f, 0.00599044096f,
+    0.00598971127f, 0.00598875573f, 0.00598757528f, 0.00598616991f, 0.0059845387f, 0.00598268304f, 0.00598060247f, 0.00597829744f,
+    0.0059757675f, 0.00597301312f, 0.00597003475f, 0.0059668324f, 0.00596340606f, 0.00595975621f, 0.00595588284f, 0.00595178641f,
+    0.00594746647f, 0.00594292395f, 0.0059381593f, 0.0059331716f, 0.00592796225f, 0.00592253124f, 0.00591687812f, 0.00591100426f,
+    0.00590490922f, 0.00589859346f, 0.00589205744f, 0.00588530116f, 0.00587832509f, 0.00587112922f, 0.00586371496f, 0.00585608138f,
+    0.0058482294f, 0.00584015995f, 0.00583187211f, 0.00582336728f, 0.00581464544f, 0.00580570707f, 0.00579655217f, 0.00578718213f,
+    0.00577759603f, 0.00576779572f, 0.00575778075f, 0.00574755156f, 0.00573710864f, 0.00572645245f, 0.00571558392f, 0.00570450304f,
+    0.00569321075f, 0.00568170659f, 0.00566999195f, 0.0056580673f, 0.00564593263f, 0.00563358841f, 0.00562103605f, 0.00560827507f,
+    0.0055953064f, 0.00558213098f, 0.00556874881f, 0.00555516081f, 0.00554136746f, 0.00552736875f, 0.00551316608f, 0.00549875991f,
+    0.00548415072f, 0.00546933897f, 0.00545432512f, 0.00543911057f, 0.00542369485f, 0.00540807936f, 0.00539226504f, 0.00537625141f,
+    0.00536004035f, 0.00534363138f, 0.00532702636f, 0.00531022483f, 0.0052932282f, 0.00527603691f, 0.00525865192f, 0.00524107367f,
+    0.0052233031f, 0.00520534068f, 0.00518718734f, 0.00516884355f, 0.00515031023f, 0.00513158832f, 0.00511267828f, 0.00509358104f,
+    0.00507429708f, 0.00505482778f, 0.00503517361f, 0.00501533505f, 0.00499531301f, 0.0049751089f, 0.00495472271f, 0.00493415585f,
+    0.00491340877f, 0.00489248289f, 0.00487137819f, 0.00485009607f, 0.00482863747f, 0.00480700284f, 0.00478519313f, 0.00476320926f,
+    0.00474105263f, 0.00471872324f, 0.00469622249f, 0.0046735513f, 0.00465071062f, 0.0046277009f, 0.00460452354f, 0.004581179f,
+    0.0045576687f, 0.00453399308f, 0.00451015402f, 0.00448615104f, 0.00446198648f, 0.00443766033f, 0.00441317353f, 0.00438852794f,
+    0.00436372403f, 0.00433876226f, 0.00431364449f, 0.00428837119f, 0.00426294375f, 0.00423736265f, 0.00421162928f, 0.00418574456f,
+    0.00415970897f, 0.00413352484f, 0.00410719169f, 0.0040807114f, 0.00405408535f, 0.00402731355f, 0.00400039786f, 0.00397333922f,
+    0.00394613808f, 0.00391879631f, 0.00389131485f, 0.00386369415f, 0.00383593584f, 0.0038080411f, 0.00378001039f, 0.00375184556f,
+    0.0037235471f, 0.00369511638f, 0.00366655458f, 0.00363786286f, 0.00360904215f, 0.00358009338f, 0.00355101819f, 0.00352181727f,
+    0.00349249202f, 0.0034630436f, 0.00343347294f, 0.00340378121f, 0.00337396958f, 0.00334403943f, 0.00331399171f, 0.0032838278f,
+    0.00325354864f, 0.00322315539f, 0.00319264922f, 0.00316203153f, 0.00313130324f, 0.00310046598f, 0.00306952023f, 0.00303846784f,
+    0.00300730974f, 0.00297604711f, 0.00294468133f, 0.00291321333f, 0.00288164453f, 0.00284997607f, 0.00281820912f, 0.00278634508f,
+    0.00275438512f, 0.00272233039f, 0.00269018207f, 0.00265794154f, 0.00262561021f, 0.00259318878f, 0.0025606791f, 0.00252808188f,
+    0.00249539874f, 0.00246263086f, 0.00242977939f, 0.00239684572f, 0.00236383127f, 0.00233073672f, 0.00229756394f, 0.0022643141f,
+    0.00223098812f, 0.00219758763f, 0.00216411357f, 0.00213056779f, 0.00209695101f, 0.00206326484f, 0.00202951021f, 0.001995689f,
+    0.0019618019f, 0.00192785065f, 0.00189383631f, 0.00185976026f, 0.00182562368f, 0.00179142808f, 0.00175717461f, 0.00172286469f,
+    0.00168849947f, 0.00165408035f, 0.00161960872f, 0.00158508576f, 0.00155051285f, 0.00151589129f, 0.00148122245f, 0.00144650752f,
+    0.001411748f, 0.00137694506f, 0.00134210009f, 0.00130721438f, 0.00127228932f, 0.00123732619f, 0.00120232638f, 0.00116729108f,
+    0.00113222178f, 0.00109711965f, 0.00106198608f, 0.0010268226f, 0.000991630252f, 0.000956410484f, 0.000921164698f, 0.000885894115f,
+    0.000850600132f, 0.000815284089f, 0.000779947324f, 0.000744591118f, 0.000709216925f, 0.000673825969f, 0.000638419588f, 0.000602999178f,
+    0.00056756608f, 0.00053212163f, 0.000496667111f, 0.000461203948f, 0.000425733393f, 0.000390256813f, 0.000354775577f, 0.000319290994f,
+    0.000283804402f, 0.000248317141f, 0.000212830564f, 0.000177345995f, 0.000141864759f, 0.000106388215f, 7.0917682e-05f, 3.54545009e-05f,
+    4.24588367e-17f, -3.54444819e-05f, -7.08776133e-05f, -0.000106298066f, -0.000141704513f, -0.000177095601f, -0.00021247004f, -0.000247826451f,
+    -0.000283163565f, -0.000318480015f, -0.000353774492f, -0.000389045686f, -0.00042429223f, -0.000459512841f, -0.000494706212f, -0.000529870973f,
+    -0.000565005874f, -0.000600109517f, -0.000635180681f, -0.000670217967f, -0.000705220096f, -0.000740185846f, -0.00077511376f, -0.000810002617f,
+    -0.000844851136f, -0.000879657979f, -0.000914421806f, -0.000949141395f, -0.000983815407f, -0.00101844256f, -0.00105302152f, -0.00108755112f,
+    -0.00112202996f, -0.00115645688f, -0.00119083037f, -0.00122514938f, -0.0012594125f, -0.00129361846f, -0.00132776611f, -0.00136185403f,
+    -0.00139588106f, -0.00142984581f, -0.00146374712f, -0.00149758381f, -0.00153135438f, -0.00156505778f, -0.00159869273f, -0.00163225795f,
+    -0.00166575215f, -0.00169917417f, -0.00173252274f, -0.00176579668f, -0.00179899461f, -0.00183211546f, -0.00186515786f, -0.00189812062f,
+    -0.00193100271f, -0.00196380261f, -0.00199651928f, -0.00202915166f, -0.00206169835f, -0.00209415797f, -0.00212652981f, -0.00215881225f,
+    -0.00219100411f, -0.00222310447f, -0.00225511193f, -0.00228702556f, -0.00231884397f, -0.00235056598f, -0.00238219043f, -0.0024137164f,
+    -0.00244514225f, -0.00247646729f, -0.00250769011f, -0.00253880979f, -0.00256982492f, -0.00260073459f, -0.00263153738f, -0.00266223238f,
+    -0.00269281841f, -0.00272329454f, -0.00275365915f, -0.00278391177f, -0.00281405076f, -0.00284407521f, -0.00287398417f, -0.00290377648f,
+    -0.00293345074f, -0.00296300626f, -0.00299244164f, -0.00302175619f, -0.00305094849f, -0.00308001786f, -0.00310896267f, -0.00313778245f,
+    -0.00316647557f, -0.00319504156f, -0.00322347903f, -0.00325178704f, -0.00327996444f, -0.00330801052f, -0.00333592389f, -0.00336370384f,
+    -0.00339134922f, -0.00341885886f, -0.00344623206f, -0.00347346766f, -0.00350056496f, -0.00352752232f, -0.00355433952f, -0.00358101516f,
+    -0.00360754831f, -0.00363393803f, -0.0036601834f, -0.00368628348f, -0.00371223735f, -0.00373804406f, -0.0037637027f, -0.00378921232f,
+    -0.00381457177f, -0.00383978058f, -0.00386483758f, -0.00388974184f, -0.00391449267f, -0.0039390889f, -0.00396353006f, -0.00398781477f,
+    -0.00401194207f, -0.00403591199f, -0.00405972265f, -0.00408337405f, -0.0041068648f, -0.00413019396f, -0.00415336154f, -0.00417636568f,
+    -0.0041992059f, -0.00422188174f, -0.00424439181f, -0.0042667361f, -0.00428891275f, -0.00431092223f, -0.00433276268f, -0.00435443362f,
+    -0.0043759346f, -0.00439726468f, -0.0044184234f, -0.00443940936f, -0.00446022209f, -0.00448086113f, -0.00450132508f, -0.00452161441f,
+    -0.00454172725f, -0.00456166314f, -0.00458142208f, -0.00460100221f, -0.00462040398f, -0.00463962601f, -0.00465866784f, -0.00467752898f,
+    -0.00469620852f, -0.00471470552f, -0.00473302044f, -0.00475115143f, -0.00476909801f, -0.0047868602f, -0.00480443705f, -0.0048218281f,
+    -0.00483903242f, -0.00485604955f, -0.00487287901f, -0.00488952035f, -0.00490597216f, -0.00492223538f, -0.00493830815f, -0.00495418999f,
+    -0.00496988138f, -0.00498538092f, -0.00500068814f, -0.00501580257f, -0.00503072375f, -0.00504545169f, -0.00505998498f, -0.00507432362f,
+    -0.00508846715f, -0.0051024151f, -0.00511616655f, -0.00512972195f, -0.00514307991f, -0.00515624043f, -0.00516920304f, -0.00518196728f,
+    -0.00519453222f, -0.00520689879f, -0.00521906512f, -0.00523103168f, -0.00524279755f, -0.00525436271f, -0.00526572671f, -0.00527688907f,
+    -0.00528784981f, -0.00529860798f, -0.00530916359f, -0.00531951617f, -0.00532966573f, -0.00533961132f, -0.00534935296f, -0.00535889063f,
+    -0.00536822341f, -0.00537735177f, -0.00538627477f, -0.00539499195f, -0.00540350424f, -0.00541180978f, -0.00541990949f, -0.00542780291f,
+    -0.00543548958f, -0.00544296904f, -0.00545024173f, -0.00545730675f, -0.00546416454f, -0.00547081418f, -0.00547725614f, -0.00548348995f,
+    -0.00548951514f, -0.00549533218f, -0.00550094061f, -0.00550633995f, -0.00551153067f, -0.00551651185f, -0.00552128442f, -0.00552584743f,
+    -0.0055302009f, -0.00553434482f, -0.00553827919f, -0.00554200355f, -0.00554551836f, -0.00554882316f, -0.00555191841f, -0.00555480318f,
+    -0.00555747841f, -0.00555994315f, -0.00556219788f, -0.00556424214f, -0.00556607684f, -0.00556770107f, -0.00556911482f, -0.00557031902f,
+    -0.00557131274f, -0.00557209598f, -0.00557266967f, -0.00557303289f, -0.00557318656f, -0.00557312975f, -0.00557286339f, -0.00557238702f,
+    -0.00557170063f, -0.00557080517f, -0.00556969969f, -0.00556838466f, -0.00556686055f, -0.00556512689f, -0.00556318462f, -0.0055610328f,
+    -0.00555867236f, -0.00555610331f, -0.00555332564f, -0.00555033935f, -0.00554714538f, -0.00554374279f, -0.00554013252f, -0.00553631457f,
+    -0.00553228939f, -0.00552805699f, -0.00552361738f, -0.00551897101f, -0.00551411789f, -0.00550905894f, -0.00550379325f, -0.00549832219f,
+    -0.00549264578f, -0.00548676355f, -0.00548067689f, -0.00547438487f, -0.0054678889f, -0.0054611885f, -0.0054542846f, -0.00544717722f,
+    -0.00543986633f, -0.00543235289f, -0.00542463688f, -0.00541671878f, -0.00540859904f, -0.00540027767f, -0.00539175514f, -0.00538303237f,
+    -0.00537410891f, -0.00536498567f, -0.00535566313f, -0.00534614129f, -0.00533642061f, -0.00532650203f, -0.00531638553f, -0.0053060716f,
+    -0.0052955607f, -0.00528485328f, -0.00527395029f, -0.00526285125f, -0.0052515571f, -0.00524006877f, -0.00522838579f, -0.00521650957f,
+    -0.00520444009f, -0.0051921783f, -0.00517972419f, -0.00516707823f, -0.00515424181f, -0.00514121447f, -0.00512799714f, -0.00511459075f,
+    -0.0051009953f, -0.00508721173f, -0.00507324049f, -0.0050590816f, -0.0050447369f, -0.00503020594f, -0.00501548965f, -0.00500058848f,
+    -0.00498550339f, -0.00497023435f, -0.00495478278f, -0.00493914913f, -0.00492333388f, -0.00490733748f, -0.00489116088f, -0.00487480452f,
+    -0.00485826936f, -0.00484155584f, -0.00482466444f, -0.00480759656f, -0.00479035219f, -0.00477293227f, -0.00475533772f, -0.00473756855f,
+    -0.00471962662f, -0.00470151147f, -0.00468322495f, -0.0046647666f, -0.00464613829f, -0.00462734001f, -0.00460837316f, -0.00458923774f,
+    -0.00456993468f, -0.00455046538f, -0.00453083031f, -0.00451102993f, -0.00449106516f, -0.00447093695f, -0.00445064623f, -0.00443019345f,
+    -0.00440958003f, -0.00438880594f, -0.00436787261f, -0.00434678048f, -0.00432553096f, -0.00430412451f, -0.0042825616f, -0.00426084409f,
+    -0.00423897197f, -0.00421694666f, -0.00419476815f, -0.00417243876f, -0.00414995803f, -0.00412732735f, -0.00410454767f, -0.00408162037f,
+    -0.00405854546f, -0.00403532432f, -0.00401195744f, -0.00398844667f, -0.00396479201f, -0.00394099485f, -0.00391705567f, -0.00389297609f,
+    -0.00386875682f, -0.00384439854f, -0.00381990243f, -0.00379526941f, -0.00377050042f, -0.00374559639f, -0.00372055848f, -0.00369538739f,
+    -0.00367008452f, -0.00364465057f, -0.00361908646f, -0.00359339337f, -0.00356757222f, -0.00354162394f, -0.0035155497f, -0.00348935043f,
+    -0.0034630273f, -0.00343658123f, -0.00341001316f, -0.00338332425f, -0.00335651543f, -0.00332958787f, -0.00330254249f, -0.00327538047f,
+    -0.00324810296f, -0.00322071067f, -0.00319320499f, -0.00316558662f, -0.00313785719f, -0.00311001716f, -0.00308206817f, -0.00305401091f,
+    -0.00302584656f, -0.00299757649f, -0.00296920142f, -0.00294072251f, -0.00291214092f, -0.00288345804f, -0.00285467436f, -0.00282579171f,
+    -0.00279681059f, -0.00276773237f, -0.00273855822f, -0.00270928931f, -0.00267992681f, -0.0026504714f, -0.00262092473f, -0.00259128772f,
+    -0.00256156153f, -0.00253174733f, -0.00250184629f, -0.00247185957f, -0.00244178833f, -0.0024116335f, -0.00238139648f, -0.00235107844f,
+    -0.00232068053f, -0.0022902037f, -0.00225964934f, -0.0022290186f, -0.00219831266f, -0.00216753269f, -0.0021366796f, -0.00210575503f,
+    -0.00207475992f, -0.00204369565f, -0.00201256294f, -0.0019813634f, -0.00195009832f, -0.00191876851f, -0.00188737537f, -0.00185592007f,
+    -0.00182440388f, -0.00179282797f, -0.0017611935f, -0.00172950164f, -0.00169775379f, -0.00166595099f, -0.0016340944f, -0.00160218542f,
+    -0.00157022523f, -0.00153821497f, -0.00150615594f, -0.00147404929f, -0.00144189619f, -0.00140969804f, -0.00137745589f, -0.00134517113f,
+    -0.0013128448f, -0.00128047832f, -0.00124807283f, -0.00121562951f, -0.00118314975f, -0.00115063461f, -0.00111808535f, -0.00108550338f,
+    -0.00105288974f, -0.00102024572f, -0.000987572595f, -0.000954871648f, -0.000922144041f, -0.000889390998f, -0.000856613799f, -0.000823813665f,
+    -0.000790991879f, -0.000758149661f, -0.000725288235f, -0.000692408881f, -0.000659512822f, -0.000626601279f, -0.000593675533f, -0.000560736808f,
+    -0.000527786382f, -0.000494825479f, -0.000461855321f, -0.00042887716f, -0.000395892275f, -0.000362901861f, -0.000329907227f, -0.000296909537f,
+    -0.0002639101f, -0.00023091014f, -0.000197910878f, -0.000164913596f, -0.0001319195f, -9.89298569e-05f, -6.59458965e-05f, -3.29688628e-05f,
+    -2.10535664e-17f, 3.29594586e-05f, 6.59082652e-05f, 9.88451939e-05f, 0.000131769004f, 0.000164678451f, 0.000197572299f, 0.000230449325f,
+    0.000263308291f, 0.000296147948f, 0.000328967086f, 0.000361764483f, 0.00039453886f, 0.000427289051f, 0.000460013776f, 0.000492711843f,
+    0.000525381998f, 0.000558023108f, 0.000590633834f, 0.000623212953f, 0.000655759359f, 0.000688271772f, 0.000720748969f, 0.000753189786f,
+    0.000785592885f, 0.000817957218f, 0.000850281445f, 0.000882564462f, 0.000914804987f, 0.000947001856f, 0.000979153905f, 0.00101125985f,
+    0.00104331854f, 0.00107532879f, 0.00110728934f, 0.00113919913f, 0.00117105688f, 0.00120286143f, 0.0012346115f, 0.00126630615f,
+    0.00129794388f, 0.00132952386f, 0.00136104459f, 0.00139250513f, 0.00142390421f, 0.00145524077f, 0.00148651341f, 0.00151772122f,
+    0.00154886302f, 0.00157993741f, 0.00161094358f, 0.00164188014f, 0.00167274592f, 0.00170353998f, 0.00173426105f, 0.00176490808f,
+    0.00179547979f, 0.00182597525f, 0.00185639306f, 0.00188673241f, 0.0019169919f, 0.00194717059f, 0.00197726744f, 0.00200728094f,
+    0.00203721039f, 0.00206705462f, 0.00209681247f, 0.00212648278f, 0.00215606438f, 0.00218555657f, 0.00221495773f, 0.00224426738f,
+    0.0022734839f, 0.00230260636f, 0.00233163405f, 0.00236056536f, 0.00238939957f, 0.00241813553f, 0.0024467723f, 0.00247530849f,
+    0.0025037434f, 0.00253207586f, 0.00256030494f, 0.00258842949f, 0.00261644856f, 0.002644361f, 0.00267216563f, 0.002699862f,
+    0.00272744847f, 0.00275492459f, 0.00278228894f, 0.0028095406f, 0.00283667864f, 0.00286370236f, 0.00289061014f, 0.00291740149f,
+    0.00294407527f, 0.00297063054f, 0.00299706636f, 0.00302338158f, 0.00304957549f, 0.00307564717f, 0.00310159544f, 0.00312741939f,
+    0.0031531183f, 0.00317869103f, 0.00320413662f, 0.00322945439f, 0.00325464318f, 0.00327970204f, 0.00330463029f, 0.00332942698f,
+    0.0033540912f, 0.003378622f, 0.00340301846f, 0.00342727988f, 0.00345140533f, 0.00347539363f, 0.00349924434f, 0.00352295628f,
+    0.00354652875f, 0.00356996106f, 0.00359325204f, 0.00361640099f, 0.00363940722f, 0.00366226956f, 0.00368498778f, 0.00370756048f,
+    0.00372998696f, 0.00375226676f, 0.0037743987f, 0.00379638211f, 0.00381821627f, 0.00383990025f, 0.00386143359f, 0.00388281513f,
+    0.0039040444f, 0.00392512046f, 0.00394604262f, 0.00396681065f, 0.00398742268f, 0.00400787871f, 0.00402817829f, 0.00404832f,
+    0.00406830339f, 0.00408812799f, 0.00410779333f, 0.00412729755f, 0.00414664112f, 0.00416582311f, 0.00418484258f, 0.0042036986f,
+    0.00422239117f, 0.00424091937f, 0.00425928272f, 0.00427747983f, 0.00429551117f, 0.00431337534f, 0.00433107186f, 0.00434859982f,
+    0.00436595967f, 0.00438314956f, 0.00440016948f, 0.00441701896f, 0.00443369756f, 0.00445020385f, 0.00446653785f, 0.00448269909f,
+    0.00449868664f, 0.0045145005f, 0.00453013973f, 0.00454560341f, 0.004560892f, 0.00457600411f, 0.00459093973f, 0.00460569793f,
+    0.00462027825f, 0.00463468069f, 0.00464890432f, 0.00466294866f, 0.00467681326f, 0.00469049811f, 0.00470400229f, 0.00471732486f,
+    0.00473046675f, 0.00474342611f, 0.00475620339f, 0.00476879766f, 0.00478120847f, 0.00479343627f, 0.0048054792f, 0.00481733819f,
+    0.00482901232f, 0.00484050112f, 0.00485180458f, 0.00486292178f, 0.00487385225f, 0.00488459645f, 0.00489515346f, 0.00490552327f,
+    0.00491570495f, 0.00492569897f, 0.0049355044f, 0.00494512077f, 0.00495454855f, 0.00496378681f, 0.00497283554f, 0.00498169428f,
+    0.00499036303f, 0.00499884132f, 0.0050071287f, 0.00501522515f, 0.00502313022f, 0.00503084389f, 0.00503836619f, 0.00504569616f,
+    0.00505283382f, 0.00505977962f, 0.00506653264f, 0.00507309288f, 0.00507945986f, 0.00508563407f, 0.00509161456f, 0.00509740179f,
+    0.00510299532f, 0.00510839513f, 0.00511360075f, 0.00511861267f, 0.00512342993f, 0.00512805302f, 0.00513248146f, 0.00513671571f,
+    0.00514075486f, 0.00514459936f, 0.00514824875f, 0.00515170349f, 0.00515496312f, 0.00515802717f, 0.00516089657f, 0.00516357087f,
+    0.00516604958f, 0.00516833318f, 0.00517042121f, 0.00517231366f, 0.00517401146f, 0.00517551322f, 0.00517681986f, 0.00517793139f,
+    0.00517884735f, 0.00517956773f, 0.00518009299f, 0.00518042315f, 0.00518055772f, 0.00518049719f, 0.00518024201f, 0.00517979125f,
+    0.00517914584f, 0.00517830532f, 0.00517727016f, 0.00517603988f, 0.00517461542f, 0.00517299632f, 0.00517118257f, 0.0051691751f,
+    0.00516697299f, 0.00516457716f, 0.00516198715f, 0.00515920389f, 0.00515622692f, 0.00515305623f, 0.00514969276f, 0.00514613651f,
+    0.005142387f, 0.00513844471f, 0.00513431057f, 0.00512998365f, 0.00512546487f, 0.00512075471f, 0.00511585269f, 0.00511075929f,
+    0.00510547496f, 0.00510000018f, 0.00509433448f, 0.00508847833f, 0.00508243265f, 0.00507619698f, 0.00506977225f, 0.00506315799f,
+    0.00505635515f, 0.00504936324f, 0.00504218368f, 0.00503481645f, 0.0050272611f, 0.00501951901f, 0.00501158973f, 0.00500347419f,
+    0.00499517238f, 0.00498668477f, 0.00497801229f, 0.00496915402f, 0.00496011134f, 0.00495088473f, 0.00494147418f, 0.00493188016f,
+    0.00492210267f, 0.00491214311f, 0.00490200147f, 0.00489167776f, 0.00488117291f, 0.00487048691f, 0.00485962117f, 0.00484857475f,
+    0.00483734952f, 0.00482594501f, 0.00481436169f, 0.00480260095f, 0.00479066232f, 0.00477854675f, 0.00476625469f, 0.0047537866f,
+    0.00474114297f, 0.00472832425f, 0.00471533136f, 0.00470216433f, 0.00468882406f, 0.00467531104f, 0.00466162618f, 0.00464776903f,
+    0.00463374099f, 0.00461954251f, 0.00460517453f, 0.00459063658f, 0.00457593007f, 0.00456105545f, 0.0045460132f, 0.00453080423f,
+    0.00451542903f, 0.00449988805f, 0.00448418176f, 0.00446831156f, 0.00445227697f, 0.00443607988f, 0.00441972027f, 0.0044031986f,
+    0.00438651582f, 0.00436967285f, 0.00435267016f, 0.00433550822f, 0.00431818794f, 0.00430070981f, 0.00428307476f, 0.0042652837f,
+    0.00424733711f, 0.00422923546f, 0.00421097968f, 0.00419257069f, 0.00417400897f, 0.00415529544f, 0.00413643103f, 0.00411741575f,
+    0.004098251f, 0.00407893723f, 0.00405947585f, 0.00403986685f, 0.00402011117f, 0.0040002102f, 0.00398016395f, 0.00395997334f,
+    0.00393963978f, 0.00391916325f, 0.0038985454f, 0.00387778645f, 0.00385688734f, 0.003835849f, 0.00381467235f, 0.00379335787f,
+    0.00377190695f, 0.00375031983f, 0.00372859766f, 0.00370674138f, 0.00368475192f, 0.00366262975f, 0.00364037603f, 0.00361799169f,
+    0.00359547744f, 0.00357283419f, 0.00355006289f, 0.00352716446f, 0.00350413984f, 0.00348098972f, 0.00345771527f, 0.00343431719f,
+    0.0034107964f, 0.00338715385f, 0.00336339069f, 0.00333950762f, 0.00331550557f, 0.00329138571f, 0.00326714874f, 0.00324279559f,
+    0.00321832742f, 0.00319374492f, 0.00316904928f, 0.0031442414f, 0.00311932224f, 0.00309429271f, 0.00306915375f, 0.00304390653f,
+    0.00301855174f, 0.00299309078f, 0.00296752434f, 0.00294185337f, 0.00291607901f, 0.00289020222f, 0.00286422414f, 0.00283814571f,
+    0.00281196763f, 0.00278569129f, 0.00275931763f, 0.00273284758f, 0.00270628207f, 0.0026796225f, 0.00265286956f, 0.00262602442f,
+    0.00259908801f, 0.00257206149f, 0.00254494604f, 0.00251774234f, 0.00249045179f, 0.0024630751f, 0.00243561366f, 0.00240806816f,
+    0.00238044024f, 0.00235273037f, 0.00232493994f, 0.00229706988f, 0.00226912135f, 0.0022410953f, 0.0022129931f, 0.00218481547f,
+    0.0021565638f, 0.00212823902f, 0.00209984207f, 0.00207137433f, 0.00204283674f, 0.00201423047f, 0.00198555668f, 0.00195681606f,
+    0.00192801026f, 0.00189914007f, 0.00187020656f, 0.00184121111f, 0.00181215454f, 0.00178303802f, 0.00175386283f, 0.00172463001f,
+    0.00169534062f, 0.00166599581f, 0.00163659663f, 0.00160714437f, 0.00157764007f, 0.00154808478f, 0.00151847966f, 0.001488826f,
+    0.00145912473f, 0.00142937701f, 0.00139958411f, 0.00136974698f, 0.00133986701f, 0.00130994502f, 0.00127998239f, 0.00124998018f,
+    0.00121993956f, 0.00118986156f, 0.00115974748f, 0.00112959847f, 0.00109941547f, 0.00106919988f, 0.00103895261f, 0.00100867497f,
+    0.000978368102f, 0.000948033063f, 0.000917671074f, 0.000887283299f, 0.000856870844f, 0.000826434873f, 0.00079597655f, 0.00076549704f,
+    0.000734997506f, 0.000704479055f, 0.00067394285f, 0.000643390114f, 0.000612821896f, 0.000582239474f, 0.000551643898f, 0.000521036389f,
+    0.000490418053f, 0.000459790084f, 0.000429153646f, 0.000398509874f, 0.000367859931f, 0.000337204983f, 0.000306546164f, 0.000275884639f,
+    0.000245221599f, 0.000214558124f, 0.000183895434f, 0.000153234665f, 0.000122576967f, 9.19235026e-05f, 6.12754156e-05f, 3.06338661e-05f,
+    2.43912381e-18f, -3.06250258e-05f, -6.12400618e-05f, -9.18439546e-05f, -0.000122435551f, -0.000153013709f, -0.000183577285f, -0.000214125132f,
+    -0.000244656083f, -0.000275169004f, -0.000305662776f, -0.000336136203f, -0.00036658821f, -0.000397017575f, -0.000427423249f, -0.00045780401f,
+    -0.000488158781f, -0.000518486369f, -0.000548785727f, -0.000579055632f, -0.000609294977f, -0.000639502658f, -0.000669677509f, -0.000699818425f,
+    -0.000729924301f, -0.000759993971f, -0.00079002633f, -0.000820020272f, -0.000849974691f, -0.000879888423f, -0.000909760362f, -0.000939589401f,
+    -0.000969374436f, -0.00099911436f, -0.00102880807f, -0.00105845439f, -0.00108805241f, -0.00111760083f, -0.00114709861f, -0.00117654458f,
+    -0.00120593782f, -0.00123527716f, -0.00126456143f, -0.00129378971f, -0.00132296071f, -0.00135207351f, -0.00138112693f, -0.00141011993f,
+    -0.00143905147f, -0.00146792049f, -0.00149672583f, -0.00152546645f, -0.00155414129f, -0.0015827493f, -0.00161128945f, -0.00163976068f,
+    -0.00166816195f, -0.00169649208f, -0.00172475027f, -0.00175293523f, -0.00178104592f, -0.00180908153f, -0.00183704088f, -0.00186492293f,
+    -0.00189272664f, -0.00192045106f, -0.00194809516f, -0.00197565788f, -0.00200313819f, -0.00203053514f, -0.00205784757f, -0.00208507455f,
+    -0.00211221538f, -0.00213926868f, -0.00216623349f, -0.0021931089f, -0.00221989397f, -0.00224658777f, -0.00227318914f, -0.00229969737f,
+    -0.00232611108f, -0.00235242955f, -0.00237865187f, -0.0024047771f, -0.00243080407f, -0.00245673186f, -0.00248255976f, -0.00250828662f,
+    -0.00253391173f, -0.00255943392f, -0.00258485205f, -0.00261016563f, -0.00263537373f, -0.00266047521f, -0.00268546911f, -0.00271035451f,
+    -0.00273513095f, -0.0027597968f, -0.00278435182f, -0.00280879484f, -0.00283312495f, -0.00285734143f, -0.00288144313f, -0.00290542934f,
+    -0.00292929914f, -0.00295305159f, -0.00297668623f, -0.00300020166f, -0.00302359741f, -0.00304687233f, -0.00307002594f, -0.00309305708f,
+    -0.00311596529f, -0.00313874916f, -0.00316140847f, -0.00318394206f, -0.00320634898f, -0.00322862878f, -0.00325078075f, -0.0032728035f,
+    -0.0032946968f, -0.00331645971f, -0.00333809131f, -0.00335959089f, -0.00338095776f, -0.00340219098f, -0.00342328986f, -0.00344425393f,
+    -0.00346508203f, -0.00348577369f, -0.00350632798f, -0.0035267442f, -0.00354702165f, -0.00356715964f, -0.00358715747f, -0.00360701443f,
+    -0.00362672959f, -0.00364630274f, -0.00366573269f, -0.00368501875f, -0.00370416068f, -0.00372315757f, -0.00374200847f, -0.00376071315f,
+    -0.00377927069f, -0.00379768061f, -0.00381594198f, -0.00383405434f, -0.00385201722f, -0.00386982947f, -0.00388749107f, -0.0039050011f,
+    -0.00392235862f, -0.00393956387f, -0.00395661546f, -0.00397351338f, -0.00399025623f, -0.00400684401f, -0.00402327627f, -0.00403955206f,
+    -0.00405567139f, -0.00407163287f, -0.00408743648f, -0.0041030813f, -0.00411856733f, -0.00413389364f, -0.00414905977f, -0.00416406523f,
+    -0.00417890958f, -0.00419359235f, -0.0042081126f, -0.00422247034f, -0.00423666462f, -0.00425069546f, -0.00426456193f, -0.00427826401f,
+    -0.00429180032f, -0.00430517178f, -0.004318377f, -0.00433141552f, -0.00434428733f, -0.0043569915f, -0.00436952803f, -0.00438189646f,
+    -0.00439409586f, -0.00440612668f, -0.00441798754f, -0.0044296789f, -0.00444119982f, -0.00445255032f, -0.00446372991f, -0.00447473768f,
+    -0.00448557409f, -0.00449623819f, -0.00450673001f, -0.0045170486f, -0.00452719443f, -0.00453716656f, -0.00454696501f, -0.00455658976f,
+    -0.00456603942f, -0.00457531447f, -0.00458441488f, -0.00459333975f, -0.00460208906f, -0.00461066235f, -0.00461905915f, -0.00462727994f,
+    -0.00463532424f, -0.00464319112f, -0.00465088105f, -0.00465839356f, -0.00466572866f, -0.00467288541f, -0.00467986427f, -0.00468666479f,
+    -0.00469328696f, -0.00469973031f, -0.00470599486f, -0.00471208012f, -0.00471798657f, -0.0047237128f, -0.00472926022f, -0.00473462744f,
+    -0.0047398149f, -0.00474482216f, -0.0047496492f, -0.00475429604f, -0.00475876266f, -0.00476304861f, -0.00476715388f, -0.00477107847f,
+    -0.00477482192f, -0.0047783847f, -0.00478176633f, -0.00478496682f, -0.00478798617f, -0.00479082437f, -0.00479348097f, -0.00479595643f,
+    -0.00479825074f, -0.00480036344f, -0.00480229454f, -0.0048040445f, -0.00480561284f, -0.00480699958f, -0.00480820518f, -0.00480922917f,
+    -0.00481007155f, -0.00481073279f, -0.00481121242f, -0.00481151044f, -0.00481162732f, -0.00481156306f, -0.00481131766f, -0.00481089065f,
+    -0.00481028296f, -0.00480949413f, -0.00480852462f, -0.00480737397f, -0.00480604265f, -0.00480453018f, -0.00480283797f, -0.00480096461f,
+    -0.00479891151f, -0.0047966782f, -0.00479426468f, -0.00479167141f, -0.00478889793f, -0.00478594517f, -0.00478281314f, -0.00477950182f,
+    -0.00477601122f, -0.00477234181f, -0.00476849405f, -0.00476446748f, -0.00476026256f, -0.00475587929f, -0.0047513186f, -0.00474658003f,
+    -0.00474166404f, -0.00473657111f, -0.00473130122f, -0.00472585438f, -0.00472023105f, -0.00471443171f, -0.00470845681f, -0.00470230589f,
+    -0.00469597941f, -0.00468947832f, -0.00468280213f, -0.00467595179f, -0.00466892729f, -0.00466172863f, -0.00465435674f, -0.00464681163f,
+    -0.00463909376f, -0.00463120313f, -0.00462314067f, -0.00461490592f, -0.00460650027f, -0.00459792325f, -0.00458917581f, -0.00458025746f,
+    -0.00457116961f, -0.00456191227f, -0.00455248542f, -0.00454289f, -0.00453312648f, -0.00452319486f, -0.0045130956f, -0.00450282963f,
+    -0.00449239649f, -0.00448179757f, -0.00447103288f, -0.00446010288f, -0.00444900803f, -0.00443774881f, -0.00442632567f, -0.00441473909f,
+    -0.00440298952f, -0.00439107744f, -0.00437900377f, -0.00436676852f, -0.00435437215f, -0.0043418156f, -0.00432909885f, -0.00431622285f,
+    -0.00430318806f, -0.00428999541f, -0.00427664444f, -0.00426313654f, -0.00424947171f, -0.00423565088f, -0.00422167452f, -0.0042075431f,
+    -0.00419325754f, -0.00417881832f, -0.00416422542f, -0.00414948026f, -0.00413458282f, -0.00411953405f, -0.0041043344f, -0.0040889848f,
+    -0.00407348573f, -0.00405783718f, -0.00404204102f, -0.00402609678f, -0.00401000539f, -0.00399376778f, -0.00397738488f, -0.00396085624f,
+    -0.0039441837f, -0.00392736727f, -0.00391040789f, -0.00389330601f, -0.00387606234f, -0.00385867781f, -0.00384115311f, -0.00382348872f,
+    -0.00380568532f, -0.00378774386f, -0.00376966503f, -0.00375144929f, -0.00373309781f, -0.00371461082f, -0.00369598926f, -0.00367723405f,
+    -0.00365834567f, -0.00363932503f, -0.00362017285f, -0.00360088982f, -0.00358147686f, -0.00356193446f, -0.00354226376f, -0.00352246524f,
+    -0.00350253982f, -0.00348248845f, -0.00346231158f, -0.00344201014f, -0.00342158508f, -0.00340103684f, -0.0033803666f, -0.00335957506f,
+    -0.00333866314f, -0.00331763132f, -0.00329648075f, -0.00327521237f, -0.00325382641f, -0.0032323245f, -0.00321070687f, -0.00318897469f,
+    -0.00316712866f, -0.0031451697f, -0.00312309852f, -0.00310091628f, -0.00307862367f, -0.00305622164f, -0.00303371111f, -0.00301109254f,
+    -0.00298836734f, -0.0029655362f, -0.00294260005f, -0.0029195596f, -0.002896416f, -0.00287316996f, -0.0028498224f, -0.00282637449f,
+    -0.0028028267f, -0.00277918042f, -0.00275543635f, -0.00273159519f, -0.00270765834f, -0.00268362626f, -0.00265950011f, -0.00263528083f,
+    -0.00261096936f, -0.00258656684f, -0.00256207376f, -0.00253749127f, -0.00251282053f, -0.00248806225f, -0.00246321736f, -0.00243828702f,
+    -0.00241327216f, -0.00238817371f, -0.00236299238f, -0.00233772956f, -0.00231238594f, -0.0022869627f, -0.00226146076f, -0.00223588105f,
+    -0.00221022451f, -0.0021844923f, -0.00215868512f, -0.00213280437f, -0.00210685073f, -0.00208082516f, -0.00205472903f, -0.00202856306f,
+    -0.00200232817f, -0.00197602552f, -0.00194965629f, -0.00192322116f, -0.00189672131f, -0.00187015778f, -0.0018435315f, -0.00181684364f,
+    -0.001790095f, -0.00176328688f, -0.00173641997f, -0.00170949567f, -0.00168251467f, -0.00165547826f, -0.00162838737f, -0.00160124304f,
+    -0.00157404633f, -0.00154679816f, -0.00151949981f, -0.00149215211f, -0.00146475621f, -0.00143731316f, -0.00140982389f, -0.00138228957f,
+    -0.00135471125f, -0.00132708985f, -0.00129942666f, -0.00127172249f, -0.00124397851f, -0.00121619587f, -0.00118837541f, -0.00116051838f,
+    -0.00113262574f, -0.00110469852f, -0.00107673788f, -0.00104874489f, -0.00102072046f, -0.000992665882f, -0.000964582025f, -0.000936469994f,
+    -0.000908330956f, -0.000880165899f, -0.000851975929f, -0.000823762093f, -0.00079552544f, -0.000767267076f, -0.000738988107f, -0.000710689521f,
+    -0.000682372425f, -0.000654037867f, -0.000625686953f, -0.000597320788f, -0.000568940362f, -0.00054054684f, -0.00051214121f, -0.00048372458f,
+    -0.000455298054f, -0.000426862651f, -0.000398419506f, -0.000369969639f, -0.000341514155f, -0.000313054101f, -0.000284590584f, -0.000256124651f,
+    -0.000227657394f, -0.000199189875f, -0.000170723171f, -0.000142258345f, -0.000113796479f, -8.53386373e-05f, -5.68858995e-05f, -2.843933e-05f,
+    1.36322177e-17f, 2.84310208e-05f, 5.6852663e-05f, 8.52638623e-05f, 0.000113663547f, 0.000142050645f, 0.0001704241f, 0.000198782858f,
+    0.000227125827f, 0.000255451945f, 0.000283760193f, 0.000312049466f, 0.000340318715f, 0.000368566863f, 0.000396792893f, 0.000424995727f,
+    0.000453174318f, 0.000481327588f, 0.000509454519f, 0.000537553977f, 0.000565625029f, 0.000593666569f, 0.000621677551f, 0.000649656868f,
+    0.000677603588f, 0.000705516606f, 0.000733394874f, 0.000761237345f, 0.000789043028f, 0.000816810876f, 0.000844539842f, 0.000872228818f,
+    0.000899876934f, 0.000927483023f, 0.000955046096f, 0.000982565107f, 0.00101003912f, 0.00103746704f, 0.00106484781f, 0.00109218049f,
+    0.00111946405f, 0.00114669744f, 0.0011738796f, 0.00120100973f, 0.00122808665f, 0.00125510932f, 0.00128207682f, 0.0013089882f,
+    0.0013358423f, 0.00136263832f, 0.00138937519f, 0.00141605176f, 0.00144266733f, 0.00146922073f, 0.00149571092f, 0.0015221372f,
+    0.00154849829f, 0.00157479336f, 0.00160102139f, 0.00162718142f, 0.00165327254f, 0.00167929381f, 0.00170524407f, 0.00173112261f,
+    0.00175692828f, 0.00178266026f, 0.00180831761f, 0.0018338993f, 0.00185940438f, 0.00188483205f, 0.00191018113f, 0.00193545094f,
+    0.00196064054f, 0.00198574876f, 0.0020107748f, 0.00203571795f, 0.00206057681f, 0.00208535092f, 0.00211003935f, 0.00213464093f,
+    0.00215915497f, 0.00218358054f, 0.0022079167f, 0.00223216251f, 0.00225631706f, 0.00228037965f, 0.00230434933f, 0.00232822495f,
+    0.00235200627f, 0.00237569166f, 0.0023992809f, 0.00242277258f, 0.00244616624f, 0.00246946095f, 0.00249265577f, 0.00251575001f,
+    0.0025387425f, 0.00256163278f, 0.00258441991f, 0.00260710297f, 0.00262968102f, 0.00265215361f, 0.00267451955f, 0.00269677839f,
+    0.00271892897f, 0.00274097058f, 0.00276290276f, 0.00278472411f, 0.00280643441f, 0.00282803248f, 0.00284951786f, 0.00287088938f,
+    0.00289214659f, 0.00291328877f, 0.00293431478f, 0.00295522413f, 0.00297601614f, 0.00299669011f, 0.00301724486f, 0.00303767994f,
+    0.00305799465f, 0.00307818828f, 0.00309826015f, 0.00311820908f, 0.00313803507f, 0.00315773673f, 0.00317731383f, 0.00319676544f,
+    0.00321609108f, 0.00323528983f, 0.00325436099f, 0.00327330409f, 0.0032921182f, 0.00331080286f, 0.00332935737f, 0.00334778102f,
+    0.00336607313f, 0.00338423299f, 0.00340226013f, 0.00342015387f, 0.00343791349f, 0.0034555383f, 0.00347302784f, 0.00349038164f,
+    0.00350759854f, 0.00352467853f, 0.00354162045f, 0.0035584243f, 0.00357508892f, 0.00359161408f, 0.00360799907f, 0.00362424343f,
+    0.00364034646f, 0.0036563077f, 0.00367212645f, 0.00368780224f, 0.00370333437f, 0.00371872261f, 0.00373396627f, 0.00374906487f,
+    0.00376401772f, 0.00377882435f, 0.0037934843f, 0.0038079971f, 0.00382236205f, 0.00383657916f, 0.00385064725f, 0.00386456633f,
+    0.00387833547f, 0.0038919549f, 0.00390542345f, 0.0039187409f, 0.00393190701f, 0.00394492084f, 0.00395778241f, 0.00397049123f,
+    0.00398304686f, 0.00399544835f, 0.00400769617f, 0.0040197894f, 0.00403172709f, 0.00404350972f, 0.00405513681f, 0.00406660745f,
+    0.00407792162f, 0.00408907887f, 0.00410007872f, 0.00411092117f, 0.00412160531f, 0.00413213111f, 0.00414249813f, 0.00415270636f,
+    0.00416275486f, 0.00417264365f, 0.00418237224f, 0.00419194065f, 0.00420134841f, 0.00421059504f, 0.00421968009f, 0.00422860403f,
+    0.00423736544f, 0.00424596528f, 0.00425440213f, 0.00426267646f, 0.00427078782f, 0.00427873572f, 0.00428652065f, 0.0042941412f,
+    0.00430159783f, 0.00430889055f, 0.00431601889f, 0.00432298193f, 0.00432978058f, 0.00433641439f, 0.00434288243f, 0.00434918515f,
+    0.0043553221f, 0.00436129328f, 0.00436709821f, 0.0043727369f, 0.00437820936f, 0.00438351557f, 0.0043886546f, 0.00439362694f,
+    0.00439843256f, 0.00440307101f, 0.00440754229f, 0.00441184593f, 0.0044159824f, 0.00441995123f, 0.00442375196f, 0.00442738552f,
+    0.00443085097f, 0.00443414878f, 0.00443727849f, 0.00444023963f, 0.00444303313f, 0.00444565853f, 0.00444811536f, 0.00445040409f,
+    0.00445252424f, 0.00445447629f, 0.00445626024f, 0.00445787515f, 0.00445932243f, 0.00446060067f, 0.00446171081f, 0.00446265237f,
+    0.00446342584f, 0.00446403073f, 0.00446446706f, 0.00446473528f, 0.00446483539f, 0.00446476741f, 0.00446453085f, 0.00446412619f,
+    0.00446355389f, 0.00446281349f, 0.00446190499f, 0.00446082884f, 0.00445958506f, 0.00445817318f, 0.00445659412f, 0.00445484789f,
+    0.00445293402f, 0.00445085298f, 0.00444860524f, 0.00444619032f, 0.00444360869f, 0.00444086036f, 0.00443794532f, 0.00443486404f,
+    0.00443161698f, 0.00442820368f, 0.00442462461f, 0.00442088023f, 0.00441697007f, 0.0044128946f, 0.00440865429f, 0.00440424914f,
+    0.00439967914f, 0.00439494522f, 0.00439004647f, 0.00438498426f, 0.00437975861f, 0.00437436905f, 0.0043688165f, 0.00436310098f,
+    0.00435722247f, 0.00435118191f, 0.0043449793f, 0.00433861464f, 0.0043320884f, 0.00432540104f, 0.00431855256f, 0.00431154389f,
+    0.0043043741f, 0.00429704506f, 0.00428955583f, 0.00428190734f, 0.0042740996f, 0.00426613353f, 0.00425800867f, 0.00424972596f,
+    0.00424128585f, 0.00423268834f, 0.00422393391f, 0.00421502255f, 0.00420595566f, 0.00419673277f, 0.00418735435f, 0.00417782087f,
+    0.00416813325f, 0.00415829103f, 0.00414829561f, 0.00413814653f, 0.0041278447f, 0.00411739014f, 0.00410678377f, 0.0040960256f,
+    0.00408511655f, 0.00407405663f, 0.00406284677f, 0.00405148696f, 0.00403997768f, 0.00402832031f, 0.00401651394f, 0.00400455995f,
+    0.00399245881f, 0.00398021052f, 0.00396781601f, 0.00395527575f, 0.00394259021f, 0.00392976031f, 0.00391678559f, 0.00390366721f,
+    0.00389040587f, 0.00387700158f, 0.00386345549f, 0.00384976761f, 0.00383593887f, 0.00382196973f, 0.00380786089f, 0.00379361259f,
+    0.00377922552f, 0.00376470038f, 0.00375003787f, 0.00373523822f, 0.00372030213f, 0.00370523054f, 0.00369002367f, 0.00367468246f,
+    0.00365920737f, 0.00364359887f, 0.00362785766f, 0.00361198443f, 0.00359597988f, 0.00357984472f, 0.00356357917f, 0.0035471844f,
+    0.00353066088f, 0.00351400906f, 0.00349722989f, 0.00348032406f, 0.0034632918f, 0.00344613427f, 0.00342885219f, 0.00341144577f,
+    0.00339391595f, 0.00337626366f, 0.00335848937f, 0.00334059354f, 0.00332257734f, 0.00330444146f, 0.00328618614f, 0.00326781278f,
+    0.00324932137f, 0.00323071331f, 0.00321198883f, 0.00319314888f, 0.00317419437f, 0.00315512577f, 0.00313594402f, 0.00311664981f,
+    0.00309724384f, 0.00307772681f, 0.00305809965f, 0.0030383633f, 0.00301851821f, 0.00299856509f, 0.0029785051f, 0.00295833871f,
+    0.00293806684f, 0.00291769044f, 0.00289720995f, 0.00287662656f, 0.00285594072f, 0.0028351536f, 0.00281426567f, 0.00279327785f,
+    0.00277219107f, 0.00275100605f, 0.0027297237f, 0.00270834495f, 0.00268687028f, 0.00266530085f, 0.00264363736f, 0.00262188073f,
+    0.00260003167f, 0.00257809111f, 0.00255605998f, 0.00253393897f, 0.00251172902f, 0.0024894313f, 0.00246704603f, 0.00244457461f,
+    0.00242201774f, 0.00239937636f, 0.00237665116f, 0.0023538433f, 0.00233095326f, 0.00230798242f, 0.00228493125f, 0.00226180092f,
+    0.00223859213f, 0.00221530604f, 0.00219194335f, 0.00216850475f, 0.00214499165f, 0.00212140474f, 0.00209774473f, 0.00207401277f,
+    0.00205020956f, 0.00202633627f, 0.00200239359f, 0.0019783827f, 0.00195430429f, 0.0019301594f, 0.00190594897f, 0.00188167382f,
+    0.00185733498f, 0.0018329334f, 0.00180847f, 0.00178394571f, 0.00175936148f, 0.00173471821f, 0.00171001686f, 0.00168525847f,
+    0.00166044384f, 0.00163557404f, 0.00161064998f, 0.00158567261f, 0.00156064297f, 0.00153556187f, 0.00151043024f, 0.00148524926f,
+    0.00146001973f, 0.00143474271f, 0.00140941911f, 0.00138404989f, 0.00135863607f, 0.00133317849f, 0.00130767829f, 0.00128213642f,
+    0.00125655381f, 0.00123093138f, 0.00120527006f, 0.00117957103f, 0.00115383521f, 0.00112806342f, 0.00110225694f, 0.00107641646f,
+    0.00105054304f, 0.00102463772f, 0.000998701551f, 0.000972735346f, 0.000946740212f, 0.000920717081f, 0.000894666999f, 0.000868590898f,
+    0.000842489826f, 0.000816364714f, 0.000790216553f, 0.000764046388f, 0.000737855211f, 0.00071164401f, 0.000685413717f, 0.00065916538f,
+    0.00063289993f, 0.000606618472f, 0.000580321939f, 0.00055401132f, 0.000527687604f, 0.000501351838f, 0.000475004927f, 0.000448647974f,
+    0.000422281912f, 0.000395907729f, 0.000369526446f, 0.000343139051f, 0.000316746562f, 0.000290349941f, 0.000263950205f, 0.000237548331f,
+    0.000211145336f, 0.00018474221f, 0.000158339928f, 0.000131939509f, 0.000105541942f, 7.91482089e-05f, 5.27593147e-05f, 2.63762468e-05f,
+    3.36923204e-17f, -2.6368436e-05f, -5.27280681e-05f, -7.90779086e-05f, -0.000105416962f, -0.000131744237f, -0.000158058756f, -0.000184359538f,
+    -0.000210645565f, -0.00023691589f, -0.000263169495f, -0.000289405405f, -0.00031562263f, -0.00034182024f, -0.000367997185f, -0.000394152506f,
+    -0.000420285243f, -0.000446394377f, -0.000472478976f, -0.00049853808f, -0.000524570642f, -0.000550575729f, -0.000576552353f, -0.00060249964f,
+    -0.000628416485f, -0.000654301955f, -0.000680155121f, -0.000705974991f, -0.000731760636f, -0.000757511123f, -0.000783225347f, -0.000808902492f,
+    -0.00083454157f, -0.00086014159f, -0.000885701622f, -0.000911220734f, -0.000936697877f, -0.000962132239f, -0.000987522886f, -0.00101286871f,
+    -0.00103816891f, -0.00106342242f, -0.00108862843f, -0.00111378601f, -0.00113889412f, -0.00116395194f, -0.00118895841f, -0.00121391262f,
+    -0.00123881386f, -0.00126366096f, -0.00128845312f, -0.00131318939f, -0.00133786874f, -0.00136249058f, -0.00138705363f, -0.0014115572f,
+    -0.00143600034f, -0.00146038213f, -0.00148470164f, -0.00150895806f, -0.00153315044f, -0.00155727786f, -0.0015813394f, -0.00160533434f,
+    -0.00162926165f, -0.0016531205f, -0.00167690997f, -0.00170062913f, -0.00172427727f, -0.00174785347f, -0.00177135679f, -0.00179478643f,
+    -0.00181814155f, -0.00184142124f, -0.00186462456f, -0.00188775081f, -0.00191079907f, -0.00193376862f, -0.00195665844f, -0.00197946769f,
+    -0.00200219569f, -0.00202484149f, -0.00204740418f, -0.00206988305f, -0.0020922774f, -0.0021145863f, -0.00213680882f, -0.0021589445f,
+    -0.00218099193f, -0.00220295088f, -0.0022248202f, -0.00224659941f, -0.00226828735f, -0.00228988333f, -0.00231138687f, -0.00233279681f,
+    -0.00235411245f, -0.0023753331f, -0.00239645806f, -0.00241748663f, -0.00243841764f, -0.00245925062f, -0.00247998489f, -0.00250061951f,
+    -0.00252115377f, -0.00254158676f, -0.00256191823f, -0.00258214702f, -0.00260227267f, -0.00262229424f, -0.00264221104f, -0.00266202237f,
+    -0.00268172752f, -0.00270132604f, -0.00272081676f, -0.00274019921f, -0.0027594727f, -0.00277863652f, -0.00279768999f, -0.00281663239f,
+    -0.00283546303f, -0.00285418122f, -0.00287278648f, -0.00289127789f, -0.00290965475f, -0.00292791682f, -0.00294606294f, -0.00296409288f,
+    -0.00298200571f, -0.00299980096f, -0.00301747769f, -0.00303503568f, -0.00305247423f, -0.00306979241f, -0.00308698975f, -0.00310406601f,
+    -0.00312102004f, -0.00313785137f, -0.00315455953f, -0.00317114405f, -0.00318760402f, -0.00320393918f, -0.00322014862f, -0.00323623209f,
+    -0.00325218891f, -0.00326801836f, -0.00328372f, -0.00329929311f, -0.00331473746f, -0.00333005236f, -0.00334523735f, -0.00336029171f,
+    -0.00337521499f, -0.00339000672f, -0.0034046662f, -0.00341919321f, -0.00343358726f, -0.00344784744f, -0.00346197351f, -0.003475965f,
+    -0.00348982145f, -0.00350354239f, -0.00351712713f, -0.00353057543f, -0.00354388659f, -0.00355706038f, -0.0035700961f, -0.00358299376f,
+    -0.00359575241f, -0.00360837183f, -0.00362085155f, -0.00363319134f, -0.00364539027f, -0.00365744857f, -0.00366936531f, -0.00368114025f,
+    -0.00369277317f, -0.00370426336f, -0.00371561083f, -0.00372681464f, -0.00373787503f, -0.00374879106f, -0.00375956274f, -0.00377018959f,
+    -0.00378067116f, -0.00379100745f, -0.00380119751f, -0.00381124159f, -0.00382113899f, -0.00383088971f, -0.00384049304f, -0.00384994876f,
+    -0.00385925686f, -0.00386841665f, -0.00387742789f, -0.00388629059f, -0.00389500405f, -0.00390356849f, -0.00391198322f, -0.00392024778f,
+    -0.00392836239f, -0.0039363266f, -0.00394414039f, -0.00395180285f, -0.00395931443f, -0.00396667467f, -0.00397388311f, -0.00398094021f,
+    -0.00398784457f, -0.00399459712f, -0.00400119694f, -0.00400764402f, -0.00401393836f, -0.0040200795f, -0.00402606744f, -0.00403190171f,
+    -0.00403758278f, -0.00404310971f, -0.00404848298f, -0.00405370211f, -0.00405876664f, -0.00406367704f, -0.00406843284f, -0.00407303404f,
+    -0.00407748017f, -0.00408177171f, -0.00408590818f, -0.00408988912f, -0.00409371546f, -0.0040973858f, -0.00410090107f, -0.00410426082f,
+    -0.00410746457f, -0.00411051326f, -0.00411340548f, -0.00411614217f, -0.00411872333f, -0.00412114803f, -0.00412341719f, -0.00412553037f,
+    -0.00412748707f, -0.00412928825f, -0.00413093297f, -0.00413242169f, -0.00413375441f, -0.00413493067f, -0.00413595093f, -0.0041368152f,
+    -0.00413752347f, -0.00413807528f, -0.00413847156f, -0.00413871137f, -0.00413879566f, -0.00413872348f, -0.00413849577f, -0.00413811207f,
+    -0.00413757283f, -0.0041368776f, -0.0041360273f, -0.00413502101f, -0.00413385918f, -0.00413254183f, -0.00413106941f, -0.00412944192f,
+    -0.00412765937f, -0.00412572175f, -0.00412362954f, -0.00412138226f, -0.00411898037f, -0.00411642436f, -0.00411371375f, -0.004110849f,
+    -0.00410783058f, -0.00410465803f, -0.00410133181f, -0.00409785192f, -0.0040942193f, -0.00409043301f, -0.00408649398f, -0.00408240175f,
+    -0.00407815771f, -0.00407376094f, -0.00406921189f, -0.00406451104f, -0.00405965839f, -0.00405465439f, -0.00404949905f, -0.00404419284f,
+    -0.00403873576f, -0.0040331278f, -0.0040273699f, -0.00402146205f, -0.00401540473f, -0.00400919747f, -0.00400284166f, -0.00399633637f,
+    -0.00398968253f, -0.00398288062f, -0.00397593062f, -0.00396883301f, -0.00396158779f, -0.00395419588f, -0.00394665683f, -0.00393897155f,
+    -0.00393114006f, -0.00392316282f, -0.00391504029f, -0.00390677294f, -0.00389836053f, -0.00388980377f, -0.00388110336f, -0.00387225905f,
+    -0.00386327156f, -0.00385414134f, -0.00384486839f, -0.00383545365f, -0.00382589712f, -0.00381619949f, -0.00380636076f, -0.00379638164f,
+    -0.00378626259f, -0.00377600384f, -0.00376560609f, -0.00375506934f, -0.00374439452f, -0.00373358163f, -0.00372263137f, -0.00371154421f,
+    -0.00370032061f, -0.0036889608f, -0.00367746549f, -0.00366583513f, -0.0036540702f, -0.00364217116f, -0.00363013824f, -0.00361797237f,
+    -0.00360567379f, -0.00359324296f, -0.00358068058f, -0.00356798712f, -0.00355516304f, -0.00354220881f, -0.00352912513f, -0.00351591222f,
+    -0.00350257102f, -0.00348910177f, -0.00347550516f, -0.00346178166f, -0.00344793173f, -0.0034339563f, -0.00341985561f, -0.00340563012f,
+    -0.00339128077f, -0.00337680802f, -0.00336221233f, -0.00334749417f, -0.00333265448f, -0.00331769371f, -0.00330261234f, -0.00328741129f,
+    -0.00327209081f, -0.00325665157f, -0.00324109429f, -0.00322541967f, -0.00320962816f, -0.00319372048f, -0.0031776973f, -0.00316155911f,
+    -0.00314530684f, -0.00312894071f, -0.00311246165f, -0.00309587037f, -0.00307916757f, -0.00306235347f, -0.00304542924f, -0.00302839535f,
+    -0.00301125227f, -0.00299400114f, -0.00297664222f, -0.00295917643f, -0.00294160447f, -0.0029239268f, -0.00290614436f, -0.00288825785f,
+    -0.00287026796f, -0.00285217515f, -0.00283398037f, -0.0028156843f, -0.00279728742f, -0.00277879089f, -0.00276019517f, -0.0027415012f,
+    -0.00272270944f, -0.00270382059f, -0.00268483581f, -0.00266575534f, -0.00264658034f, -0.00262731127f, -0.00260794908f, -0.00258849422f,
+    -0.00256894785f, -0.00254931068f, -0.00252958317f, -0.00250976649f, -0.0024898611f, -0.0024698677f, -0.00244978745f, -0.00242962083f,
+    -0.00240936875f, -0.00238903216f, -0.00236861152f, -0.00234810775f, -0.00232752156f, -0.00230685412f, -0.00228610565f, -0.00226527755f,
+    -0.00224437029f, -0.0022233848f, -0.00220232178f, -0.00218118192f, -0.00215996662f, -0.00213867589f, -0.00211731135f, -0.00209587323f,
+    -0.00207436271f, -0.00205278047f, -0.00203112722f, -0.00200940412f, -0.00198761187f, -0.00196575117f, -0.00194382295f, -0.00192182802f,
+    -0.00189976743f, -0.00187764189f, -0.0018554522f, -0.00183319929f, -0.00181088399f, -0.0017885071f, -0.00176606968f, -0.0017435723f,
+    -0.00172101613f, -0.00169840176f, -0.00167573034f, -0.00165300246f, -0.00163021917f, -0.00160738139f, -0.00158448983f, -0.00156154542f,
+    -0.00153854908f, -0.00151550176f, -0.00149240415f, -0.0014692574f, -0.00144606212f, -0.00142281933f, -0.00139952998f, -0.00137619488f,
+    -0.00135281484f, -0.00132939103f, -0.00130592403f, -0.00128241489f, -0.00125886453f, -0.00123527378f, -0.00121164368f, -0.00118797494f,
+    -0.00116426859f, -0.00114052545f, -0.00111674645f, -0.00109293254f, -0.00106908462f, -0.00104520365f, -0.00102129043f, -0.000997345895f,
+    -0.000973370974f, -0.0009493666f, -0.000925333647f, -0.000901273102f, -0.000877185783f, -0.000853072677f, -0.000828934659f, -0.000804772659f,
+    -0.00078058755f, -0.000756380381f, -0.000732151966f, -0.000707903237f, -0.000683635124f, -0.000659348501f, -0.000635044416f, -0.000610723626f,
+    -0.000586387177f, -0.000562035944f, -0.000537670858f, -0.000513292849f, -0.000488902791f, -0.000464501674f, -0.000440090371f, -0.000415669812f,
+    -0.000391240959f, -0.000366804685f, -0.00034236192f, -0.000317913626f, -0.000293460704f, -0.000269004056f, -0.000244544644f, -0.000220083355f,
+    -0.00019562112f, -0.00017115887f, -0.000146697537f, -0.000122238009f, -9.77812379e-05f, -7.33281267e-05f, -4.88796068e-05f, -2.44365892e-05f,
+    -1.75554312e-17f, 2.4429246e-05f, 4.88502301e-05f, 7.32620319e-05f, 9.76637384e-05f, 0.000122054429f, 0.000146433187f, 0.000170799103f,
+    0.000195151268f, 0.000219488749f, 0.000243810646f, 0.00026811604f, 0.00029240406f, 0.000316673744f, 0.000340924191f, 0.000365154498f,
+    0.000389363791f, 0.000413551112f, 0.000437715586f, 0.000461856311f, 0.000485972385f, 0.000510062848f, 0.000534126943f, 0.000558163621f,
+    0.000582172011f, 0.000606151298f, 0.000630100549f, 0.000654018833f, 0.000677905278f, 0.000701759069f, 0.000725579157f, 0.000749364786f,
+    0.000773115025f, 0.000796829001f, 0.00082050584f, 0.000844144612f, 0.0008677445f, 0.000891304633f, 0.000914824021f, 0.000938301906f,
+    0.000961737416f, 0.00098512962f, 0.00100847764f, 0.00103178062f, 0.00105503784f, 0.00107824826f, 0.00110141106f, 0.00112452533f,
+    0.00114759034f, 0.00117060519f, 0.00119356904f, 0.00121648097f, 0.00123934017f, 0.00126214582f, 0.00128489709f, 0.00130759308f,
+    0.00133023295f, 0.00135281601f, 0.00137534121f, 0.00139780785f, 0.00142021501f, 0.00144256197f, 0.00146484782f, 0.00148707186f,
+    0.00150923315f, 0.00153133087f, 0.00155336433f, 0.00157533248f, 0.00159723486f, 0.00161907042f, 0.00164083834f, 0.00166253792f,
+    0.00168416835f, 0.00170572882f, 0.00172721851f, 0.00174863671f, 0.00176998263f, 0.00179125532f, 0.0018124542f, 0.00183357846f,
+    0.00185462716f, 0.00187559973f, 0.00189649535f, 0.0019173132f, 0.00193805248f, 0.0019587127f, 0.0019792926f, 0.00199979194f,
+    0.00202020979f, 0.00204054546f, 0.002060798f, 0.00208096672f, 0.00210105116f, 0.00212105014f, 0.00214096345f, 0.00216078991f,
+    0.00218052906f, 0.0022001802f, 0.00221974263f, 0.00223921542f, 0.00225859787f, 0.00227788952f, 0.00229708944f, 0.00231619715f,
+    0.00233521173f, 0.00235413271f, 0.0023729594f, 0.00239169085f, 0.00241032662f, 0.00242886599f, 0.00244730827f, 0.00246565277f,
+    0.00248389877f, 0.00250204583f, 0.002520093f, 0.00253804005f, 0.00255588582f, 0.00257363007f, 0.00259127188f, 0.00260881102f,
+    0.00262624631f, 0.00264357752f, 0.00266080396f, 0.00267792493f, 0.00269493973f, 0.00271184812f, 0.00272864918f, 0.00274534221f,
+    0.00276192697f, 0.00277840253f, 0.00279476866f, 0.00281102443f, 0.00282716937f, 0.00284320302f, 0.00285912468f, 0.00287493388f,
+    0.00289062993f, 0.00290621235f, 0.00292168069f, 0.00293703424f, 0.00295227254f, 0.00296739489f, 0.00298240106f, 0.00299729034f,
+    0.00301206205f, 0.00302671595f, 0.00304125156f, 0.00305566797f, 0.00306996494f, 0.00308414199f, 0.00309819868f, 0.00311213429f,
+    0.0031259486f, 0.0031396409f, 0.00315321074f, 0.00316665764f, 0.00317998137f, 0.00319318124f, 0.00320625678f, 0.00321920752f,
+    0.00323203322f, 0.00324473321f, 0.00325730722f, 0.00326975458f, 0.00328207505f, 0.00329426816f, 0.00330633344f, 0.00331827067f,
+    0.00333007914f, 0.00334175886f, 0.00335330889f, 0.00336472923f, 0.00337601919f, 0.00338717876f, 0.00339820725f, 0.00340910465f,
+    0.00341987005f, 0.00343050342f, 0.00344100432f, 0.0034513725f, 0.0034616075f, 0.00347170909f, 0.0034816768f, 0.00349151017f,
+    0.0035012092f, 0.00351077341f, 0.00352020236f, 0.00352949603f, 0.00353865372f, 0.00354767544f, 0.00355656096f, 0.00356530957f,
+    0.00357392128f, 0.00358239585f, 0.00359073281f, 0.00359893194f, 0.00360699324f, 0.003614916f, 0.00362270023f, 0.00363034569f,
+    0.00363785191f, 0.00364521914f, 0.00365244644f, 0.00365953427f, 0.00366648193f, 0.00367328944f, 0.00367995654f, 0.00368648302f,
+    0.0036928684f, 0.00369911292f, 0.00370521634f, 0.0037111782f, 0.0037169985f, 0.00372267677f, 0.00372821349f, 0.00373360771f,
+    0.0037388599f, 0.0037439696f, 0.00374893658f, 0.00375376106f, 0.00375844236f, 0.00376298092f, 0.0037673763f, 0.00377162849f,
+    0.00377573725f, 0.00377970235f, 0.00378352404f, 0.00378720206f, 0.0037907362f, 0.00379412668f, 0.00379737304f, 0.00380047527f,
+    0.00380343362f, 0.00380624761f, 0.00380891748f, 0.00381144299f, 0.00381382415f, 0.00381606095f, 0.00381815317f, 0.00382010126f,
+    0.00382190454f, 0.00382356346f, 0.00382507779f, 0.00382644753f, 0.00382767268f, 0.00382875325f, 0.00382968946f, 0.00383048109f,
+    0.00383112789f, 0.00383163034f, 0.00383198843f, 0.00383220194f, 0.00383227109f, 0.00383219565f, 0.00383197609f, 0.00383161218f,
+    0.00383110391f, 0.00383045175f, 0.00382965524f, 0.00382871483f, 0.00382763031f, 0.00382640213f, 0.00382503006f, 0.00382351433f,
+    0.00382185495f, 0.00382005237f, 0.00381810614f, 0.00381601672f, 0.00381378434f, 0.00381140877f, 0.00380889047f, 0.00380622945f,
+    0.0038034257f, 0.0038004797f, 0.0037973912f, 0.00379416067f, 0.00379078835f, 0.00378727424f, 0.00378361833f, 0.0037798211f,
+    0.00377588253f, 0.00377180311f, 0.00376758259f, 0.00376322167f, 0.00375872012f, 0.00375407841f, 0.00374929677f, 0.00374437519f,
+    0.00373931415f, 0.00373411365f, 0.00372877414f, 0.00372329587f, 0.00371767883f, 0.00371192372f, 0.00370603031f, 0.00369999907f,
+    0.00369383022f, 0.00368752424f, 0.00368108111f, 0.00367450132f, 0.00366778509f, 0.00366093288f, 0.0036539447f, 0.00364682102f,
+    0.00363956206f, 0.00363216829f, 0.00362463994f, 0.00361697725f, 0.00360918068f, 0.00360125047f, 0.00359318708f, 0.00358499051f,
+    0.00357666169f, 0.00356820063f, 0.00355960755f, 0.00355088315f, 0.00354202744f, 0.0035330411f, 0.00352392439f, 0.00351467775f,
+    0.00350530143f, 0.00349579589f, 0.00348616159f, 0.00347639876f, 0.00346650812f, 0.00345648988f, 0.00344634429f, 0.00343607203f,
+    0.00342567358f, 0.00341514917f, 0.00340449926f, 0.00339372433f, 0.00338282483f, 0.00337180123f, 0.00336065399f, 0.00334938336f,
+    0.00333799026f, 0.00332647469f, 0.00331483735f, 0.00330307847f, 0.00329119898f, 0.00327919913f, 0.00326707913f, 0.00325483992f,
+    0.00324248197f, 0.00323000527f, 0.00321741099f, 0.00320469914f, 0.0031918704f, 0.00317892549f, 0.00316586462f, 0.0031526885f,
+    0.0031393976f, 0.0031259926f, 0.00311247376f, 0.00309884176f, 0.0030850973f, 0.00307124062f, 0.00305727264f, 0.0030431936f,
+    0.00302900421f, 0.00301470514f, 0.00300029665f, 0.00298577966f, 0.0029711544f, 0.00295642181f, 0.00294158235f, 0.00292663672f,
+    0.00291158515f, 0.00289642857f, 0.00288116746f, 0.0028658025f, 0.00285033416f, 0.00283476315f, 0.00281909015f, 0.00280331564f,
+    0.00278744032f, 0.00277146487f, 0.00275539001f, 0.00273921597f, 0.0027229439f, 0.00270657404f, 0.0026901071f, 0.00267354399f,
+    0.00265688519f, 0.0026401314f, 0.00262328307f, 0.00260634115f, 0.00258930633f, 0.00257217907f, 0.00255496008f, 0.00253765006f,
+    0.00252024969f, 0.00250275969f, 0.00248518074f, 0.00246751355f, 0.00244975882f, 0.002431917f, 0.00241398904f, 0.00239597587f,
+    0.00237787771f, 0.0023596955f, 0.00234142994f, 0.00232308172f, 0.00230465154f, 0.00228614011f, 0.00226754835f, 0.00224887673f,
+    0.00223012595f, 0.00221129693f, 0.00219239038f, 0.002173407f, 0.00215434749f, 0.00213521277f, 0.00211600331f, 0.00209672004f,
+    0.00207736366f, 0.00205793488f, 0.00203843438f, 0.0020188631f, 0.00199922174f, 0.001979511f, 0.0019597318f, 0.00193988474f,
+    0.00191997061f, 0.00189999025f, 0.00187994435f, 0.00185983372f, 0.00183965918f, 0.00181942154f, 0.0017991215f, 0.00177875976f,
+    0.00175833737f, 0.00173785491f, 0.00171731319f, 0.00169671304f, 0.00167605514f, 0.00165534054f, 0.00163456984f, 0.00161374384f,
+    0.00159286347f, 0.00157192943f, 0.00155094254f, 0.00152990362f, 0.00150881347f, 0.00148767291f, 0.00146648276f, 0.00144524383f,
+    0.00142395694f, 0.00140262279f, 0.00138124241f, 0.00135981652f, 0.00133834581f, 0.00131683133f, 0.00129527377f, 0.00127367396f,
+    0.00125203282f, 0.00123035104f, 0.00120862958f, 0.00118686911f, 0.00116507057f, 0.0011432349f, 0.00112136279f, 0.00109945505f,
+    0.00107751251f, 0.00105553621f, 0.00103352673f, 0.00101148512f, 0.000989412074f, 0.000967308413f, 0.000945175125f, 0.000923013024f,
+    0.000900822808f, 0.000878605526f, 0.000856361818f, 0.000834092731f, 0.000811798964f, 0.00078948139f, 0.000767140882f, 0.000744778314f,
+    0.000722394558f, 0.000699990313f, 0.000677566626f, 0.000655124197f, 0.000632663956f, 0.000610186718f, 0.000587693299f, 0.000565184688f,
+    0.000542661583f, 0.000520124973f, 0.000497575616f, 0.000475014385f, 0.000452442124f, 0.000429859734f, 0.000407268031f, 0.000384667888f,
+    0.000362060149f, 0.000339445658f, 0.000316825288f, 0.000294199883f, 0.000271570287f, 0.000248937402f, 0.000226302014f, 0.000203665011f,
+    0.000181027252f, 0.000158389579f, 0.000135752853f, 0.000113117916f, 9.04856352e-05f, 6.78568467e-05f, 4.5232413e-05f, 2.26131797e-05f,
+    3.60553636e-18f, -2.26062748e-05f, -4.52047971e-05f, -6.77947173e-05f, -9.03751861e-05f, -0.000112945359f, -0.000135504379f, -0.000158051407f,
+    -0.000180585601f, -0.000203106116f, -0.000225612093f, -0.000248102704f, -0.000270577089f, -0.00029303442f, -0.000315473881f, -0.000337894569f,
+    -0.0003602957f, -0.0003826764f, -0.000405035855f, -0.000427373219f, -0.000449687679f, -0.000471978361f, -0.00049424445f, -0.000516485132f,
+    -0.000538699562f, -0.000560886925f, -0.000583046349f, -0.000605177018f, -0.000627278176f, -0.000649348949f, -0.000671388465f, -0.000693396025f,
+    -0.000715370697f, -0.000737311726f, -0.000759218237f, -0.000781089475f, -0.000802924624f, -0.000824722811f, -0.000846483279f, -0.000868205214f,
+    -0.0008898878f, -0.000911530224f, -0.000933131727f, -0.000954691437f, -0.000976208597f, -0.000997682451f, -0.00101911207f, -0.00104049686f,
+    -0.00106183579f, -0.00108312827f, -0.00110437337f, -0.0011255705f, -0.00114671863f, -0.00116781716f, -0.00118886516f, -0.00120986206f,
+    -0.00123080681f, -0.00125169894f, -0.0012725374f, -0.00129332161f, -0.00131405075f, -0.00133472402f, -0.0013553407f, -0.0013759f,
+    -0.0013964012f, -0.0014168435f, -0.00143722619f, -0.00145754847f, -0.00147780974f, -0.00149800896f, -0.00151814567f, -0.00153821905f,
+    -0.00155822828f, -0.00157817279f, -0.00159805163f, -0.00161786424f, -0.00163760979f, -0.00165728759f, -0.00167689705f, -0.00169643725f,
+    -0.00171590759f, -0.00173530728f, -0.00175463571f, -0.00177389209f, -0.00179307582f, -0.00181218609f, -0.00183122221f, -0.00185018359f,
+    -0.00186906941f, -0.00188787899f, -0.00190661172f, -0.00192526693f, -0.0019438439f, -0.00196234207f, -0.00198076037f, -0.00199909857f,
+    -0.00201735576f, -0.00203553145f, -0.00205362495f, -0.00207163556f, -0.00208956236f, -0.0021074051f, -0.0021251631f, -0.00214283541f,
+    -0.00216042181f, -0.00217792136f, -0.00219533336f, -0.00221265736f, -0.00222989288f, -0.002247039f, -0.00226409524f, -0.00228106091f,
+    -0.00229793531f, -0.00231471821f, -0.00233140867f, -0.00234800624f, -0.0023645102f, -0.00238092011f, -0.00239723525f, -0.00241345493f,
+    -0.00242957892f, -0.00244560651f, -0.00246153679f, -0.00247736974f, -0.0024931042f, -0.00250874017f, -0.00252427673f, -0.00253971363f,
+    -0.00255504996f, -0.00257028523f, -0.00258541922f, -0.002600451f, -0.0026153801f, -0.00263020629f, -0.00264492887f, -0.00265954738f,
+    -0.00267406087f, -0.0026884696f, -0.00270277238f, -0.002716969f, -0.00273105875f, -0.00274504162f, -0.00275891647f, -0.00277268328f,
+    -0.00278634159f, -0.00279989047f, -0.00281332992f, -0.00282665901f, -0.00283987774f, -0.0028529854f, -0.00286598154f, -0.00287886569f,
+    -0.00289163762f, -0.00290429639f, -0.002916842f, -0.00292927399f, -0.00294159167f, -0.00295379478f, -0.00296588289f, -0.00297785574f,
+    -0.0029897124f, -0.00300145312f, -0.00301307696f, -0.00302458368f, -0.00303597306f, -0.00304724439f, -0.00305839768f, -0.00306943222f,
+    -0.00308034779f, -0.00309114391f, -0.00310182036f, -0.00311237667f, -0.00312281237f, -0.00313312747f, -0.00314332102f, -0.00315339328f,
+    -0.00316334353f, -0.00317317178f, -0.00318287732f, -0.00319245993f, -0.00320191937f, -0.00321125519f, -0.00322046713f, -0.00322955521f,
+    -0.00323851849f, -0.00324735721f, -0.00325607089f, -0.00326465932f, -0.00327312201f, -0.00328145875f, -0.00328966929f, -0.0032977534f,
+    -0.00330571085f, -0.00331354141f, -0.00332124461f, -0.00332882022f, -0.00333626824f, -0.00334358844f, -0.00335078011f, -0.0033578435f,
+    -0.00336477836f, -0.00337158423f, -0.00337826088f, -0.00338480831f, -0.00339122606f, -0.00339751435f, -0.00340367248f, -0.0034097007f,
+    -0.00341559853f, -0.00342136575f, -0.00342700235f, -0.00343250833f, -0.00343788299f, -0.0034431268f, -0.00344823906f, -0.00345322001f,
+    -0.00345806917f, -0.00346278679f, -0.00346737239f, -0.00347182574f, -0.00347614731f, -0.0034803364f, -0.003484393f, -0.00348831713f,
+    -0.00349210878f, -0.00349576771f, -0.0034992937f, -0.00350268674f, -0.00350594684f, -0.00350907398f, -0.00351206795f, -0.00351492851f,
+    -0.00351765589f, -0.00352024985f, -0.00352271041f, -0.00352503755f, -0.00352723128f, -0.00352929137f, -0.00353121781f, -0.0035330106f,
+    -0.00353466976f, -0.00353619526f, -0.00353758712f, -0.00353884534f, -0.00353996991f, -0.00354096061f, -0.00354181766f, -0.00354254106f,
+    -0.00354313059f, -0.0035435867f, -0.00354390894f, -0.00354409777f, -0.00354415295f, -0.00354407472f, -0.00354386284f, -0.00354351755f,
+    -0.00354303885f, -0.00354242697f, -0.00354168168f, -0.00354080321f, -0.0035397918f, -0.0035386472f, -0.00353736966f, -0.00353595917f,
+    -0.00353441597f, -0.00353274005f, -0.00353093166f, -0.00352899078f, -0.00352691766f, -0.00352471205f, -0.00352237443f, -0.00351990503f,
+    -0.00351730362f, -0.00351457042f, -0.0035117059f, -0.00350870984f, -0.00350558246f, -0.00350232399f, -0.00349893468f, -0.00349541451f,
+    -0.00349176372f, -0.00348798255f, -0.00348407123f, -0.00348002976f, -0.0034758586f, -0.00347155752f, -0.00346712722f, -0.00346256746f,
+    -0.00345787872f, -0.00345306122f, -0.0034481152f, -0.00344304065f, -0.00343783805f, -0.00343250739f, -0.00342704938f, -0.00342146354f,
+    -0.00341575081f, -0.00340991118f, -0.00340394466f, -0.00339785195f, -0.00339163304f, -0.00338528818f, -0.00337881781f, -0.00337222219f,
+    -0.00336550153f, -0.00335865631f, -0.00335168652f, -0.00334459264f, -0.00333737489f, -0.00333003374f, -0.00332256942f, -0.00331498217f,
+    -0.00330727221f, -0.00329944026f, -0.0032914863f, -0.0032834108f, -0.00327521423f, -0.00326689682f, -0.0032584588f, -0.00324990065f,
+    -0.00324122258f, -0.00323242531f, -0.00322350883f, -0.0032144736f, -0.0032053201f, -0.00319604878f, -0.00318665989f, -0.00317715388f,
+    -0.00316753099f, -0.00315779168f, -0.00314793666f, -0.00313796592f, -0.00312788016f, -0.00311767962f, -0.00310736476f, -0.00309693604f,
+    -0.0030863937f, -0.00307573867f, -0.00306497072f, -0.00305409078f, -0.00304309931f, -0.00303199631f, -0.00302078272f, -0.00300945854f,
+    -0.00299802469f, -0.00298648141f, -0.00297482917f, -0.00296306843f, -0.00295119965f, -0.00293922354f, -0.00292714033f, -0.00291495048f,
+    -0.00290265447f, -0.00289025321f, -0.00287774671f, -0.00286513567f, -0.00285242056f, -0.00283960206f, -0.00282668043f, -0.00281365635f,
+    -0.00280053029f, -0.00278730271f, -0.00277397432f, -0.00276054535f, -0.00274701673f, -0.00273338868f, -0.00271966192f, -0.0027058369f,
+    -0.00269191433f, -0.00267789466f, -0.00266377837f, -0.00264956593f, -0.00263525825f, -0.00262085558f, -0.00260635884f, -0.00259176828f,
+    -0.00257708458f, -0.00256230822f, -0.00254744012f, -0.00253248052f, -0.00251743011f, -0.0025022896f, -0.00248705945f, -0.00247174036f,
+    -0.00245633279f, -0.00244083744f, -0.00242525502f, -0.00240958598f, -0.00239383103f, -0.00237799087f, -0.00236206595f, -0.00234605698f,
+    -0.00232996442f, -0.00231378921f, -0.00229753181f, -0.00228119292f, -0.00226477324f, -0.002248273f, -0.00223169336f, -0.00221503479f,
+    -0.002198298f, -0.00218148343f, -0.0021645918f, -0.00214762404f, -0.0021305806f, -0.00211346219f, -0.00209626928f, -0.00207900279f,
+    -0.00206166343f, -0.00204425165f, -0.00202676817f, -0.0020092139f, -0.00199158932f, -0.00197389512f, -0.00195613201f, -0.00193830079f,
+    -0.00192040205f, -0.00190243649f, -0.0018844048f, -0.00186630769f, -0.00184814597f, -0.0018299201f, -0.00181163102f, -0.00179327931f,
+    -0.00177486578f, -0.00175639102f, -0.00173785584f, -0.00171926094f, -0.00170060701f, -0.00168189476f, -0.001663125f, -0.00164429832f,
+    -0.00162541564f, -0.00160647742f, -0.00158748461f, -0.0015684379f, -0.00154933799f, -0.00153018557f, -0.00151098147f, -0.00149172649f,
+    -0.00147242111f, -0.00145306636f, -0.00143366284f, -0.00141421123f, -0.00139471248f, -0.00137516716f, -0.0013555761f, -0.00133594009f,
+    -0.00131625973f, -0.00129653595f, -0.00127676944f, -0.00125696091f, -0.00123711117f, -0.00121722103f, -0.00119729107f, -0.00117732224f,
+    -0.00115731533f, -0.00113727094f, -0.00111718988f, -0.00109707308f, -0.00107692112f, -0.00105673471f, -0.00103651488f, -0.00101626222f,
+    -0.000995977549f, -0.000975661736f, -0.000955315365f, -0.000934939308f, -0.000914534379f, -0.000894101337f, -0.000873640878f, -0.000853153935f,
+    -0.000832641148f, -0.000812103332f, -0.000791541301f, -0.00077095587f, -0.000750347739f, -0.000729717722f, -0.000709066633f, -0.000688395172f,
+    -0.000667704269f, -0.000646994566f, -0.000626266934f, -0.000605522131f, -0.000584760972f, -0.000563984213f, -0.000543192611f, -0.000522387039f,
+    -0.000501568196f, -0.000480736955f, -0.000459894043f, -0.000439040276f, -0.000418176438f, -0.000397303316f, -0.000376421696f, -0.000355532364f,
+    -0.000334636134f, -0.000313733763f, -0.000292826095f, -0.000271913828f, -0.000250997837f, -0.000230078876f, -0.000209157733f, -0.000188235193f,
+    -0.000167312071f, -0.000146389124f, -0.000125467166f, -0.000104546962f, -8.36293111e-05f, -6.27150075e-05f, -4.18048294e-05f, -2.08995643e-05f,
+    -4.0046649e-17f, 2.08930778e-05f, 4.17788833e-05f, 6.26566325e-05f, 8.35255414e-05f, 0.000104384824f, 0.00012523371f, 0.000146071397f,
+    0.000166897109f, 0.000187710073f, 0.000208509504f, 0.000229294616f, 0.000250064651f, 0.000270818797f, 0.000291556324f, 0.000312276388f,
+    0.000332978292f, 0.00035366122f, 0.000374324387f, 0.000394967035f, 0.00041558838f, 0.000436187693f, 0.000456764159f, 0.000477317051f,
+    0.000497845525f, 0.000518348941f, 0.000538826396f, 0.00055927725f, 0.000579700631f, 0.000600095838f, 0.000620462117f, 0.000640798651f,
+    0.000661104801f, 0.000681379694f, 0.00070162263f, 0.000721832796f, 0.00074200955f, 0.000762152078f, 0.000782259624f, 0.000802331429f,
+    0.000822366797f, 0.000842364912f, 0.000862325134f, 0.000882246648f, 0.000902128697f, 0.000921970641f, 0.000941771665f, 0.000961531012f,
+    0.000981247984f, 0.00100092194f, 0.00102055201f, 0.00104013761f, 0.00105967792f, 0.00107917213f, 0.00109861977f, 0.00111801981f,
+    0.00113737187f, 0.00115667493f, 0.00117592851f, 0.00119513168f, 0.00121428398f, 0.00123338448f, 0.0012524327f, 0.00127142773f,
+    0.00129036896f, 0.0013092556f, 0.00132808718f, 0.00134686276f, 0.00136558188f, 0.00138424372f, 0.00140284747f, 0.00142139266f,
+    0.0014398786f, 0.00145830447f, 0.00147666968f, 0.00149497355f, 0.00151321548f, 0.00153139455f, 0.0015495104f, 0.00156756223f,
+    0.00158554944f, 0.00160347123f, 0.00162132701f, 0.00163911621f, 0.00165683811f, 0.00167449214f, 0.00169207749f, 0.00170959369f,
+    0.00172704004f, 0.00174441584f, 0.00176172052f, 0.00177895348f, 0.00179611403f, 0.00181320158f, 0.00183021545f, 0.00184715516f,
+    0.00186402001f, 0.00188080932f, 0.0018975226f, 0.00191415916f, 0.00193071843f, 0.00194719981f, 0.00196360261f, 0.0019799266f,
+    0.00199617073f, 0.00201233453f, 0.00202841754f, 0.00204441929f, 0.00206033885f, 0.00207617576f, 0.00209192978f, 0.00210759998f,
+    0.00212318567f, 0.00213868683f, 0.00215410255f, 0.00216943212f, 0.00218467531f, 0.00219983142f, 0.00221489999f, 0.00222988031f,
+    0.00224477216f, 0.0022595746f, 0.0022742874f, 0.00228890986f, 0.00230344152f, 0.00231788214f, 0.00233223056f, 0.00234648678f,
+    0.00236065034f, 0.00237472029f, 0.00238869665f, 0.00240257848f, 0.00241636555f, 0.00243005715f, 0.00244365307f, 0.00245715282f,
+    0.00247055548f, 0.00248386106f, 0.00249706907f, 0.0025101786f, 0.00252318964f, 0.0025361015f, 0.00254891394f, 0.00256162602f,
+    0.00257423799f, 0.00258674892f, 0.00259915832f, 0.00261146622f, 0.00262367167f, 0.00263577467f, 0.00264777453f, 0.00265967078f,
+    0.00267146318f, 0.00268315128f, 0.00269473484f, 0.00270621292f, 0.00271758577f, 0.00272885244f, 0.00274001295f, 0.00275106682f,
+    0.00276201335f, 0.00277285255f, 0.00278358394f, 0.00279420707f, 0.00280472171f, 0.00281512737f, 0.00282542361f, 0.00283561042f,
+    0.00284568709f, 0.00285565341f, 0.0028655089f, 0.00287525356f, 0.00288488669f, 0.0028944083f, 0.00290381769f, 0.00291311508f,
+    0.00292229955f, 0.0029313711f, 0.00294032949f, 0.00294917426f, 0.00295790494f, 0.00296652177f, 0.00297502405f, 0.00298341154f,
+    0.00299168401f, 0.00299984147f, 0.00300788297f, 0.00301580899f, 0.0030236186f, 0.00303131202f, 0.0030388888f, 0.00304634892f,
+    0.0030536917f, 0.00306091714f, 0.00306802522f, 0.00307501527f, 0.00308188749f, 0.00308864121f, 0.00309527665f, 0.00310179335f,
+    0.0031081913f, 0.00311447005f, 0.00312062935f, 0.00312666944f, 0.00313258963f, 0.00313839014f, 0.00314407051f, 0.0031496305f,
+    0.00315507036f, 0.00316038961f, 0.00316558802f, 0.00317066559f, 0.00317562209f, 0.00318045751f, 0.0031851714f, 0.00318976399f,
+    0.00319423503f, 0.00319858431f, 0.00320281158f, 0.00320691685f, 0.00321090012f, 0.00321476138f, 0.00321849994f, 0.00322211627f,
+    0.00322561013f, 0.00322898151f, 0.00323222997f, 0.00323535572f, 0.00323835853f, 0.00324123842f, 0.00324399536f, 0.00324662914f,
+    0.00324913976f, 0.0032515272f, 0.00325379148f, 0.00325593259f, 0.0032579503f, 0.00325984438f, 0.00326161529f, 0.0032632628f,
+    0.00326478668f, 0.00326618738f, 0.00326746423f, 0.0032686179f, 0.00326964795f, 0.00327055436f, 0.00327133737f, 0.00327199697f,
+    0.00327253318f, 0.00327294576f, 0.00327323494f, 0.00327340071f, 0.00327344309f, 0.00327336229f, 0.00327315787f, 0.00327283051f,
+    0.00327237998f, 0.00327180605f, 0.00327110919f, 0.0032702894f, 0.00326934643f, 0.00326828077f, 0.00326709216f, 0.0032657811f,
+    0.00326434732f, 0.00326279085f, 0.00326111214f, 0.00325931096f, 0.00325738755f, 0.00325534213f, 0.00325317471f, 0.00325088529f,
+    0.0032484741f, 0.00324594136f, 0.00324328733f, 0.00324051175f, 0.00323761487f, 0.00323459692f, 0.00323145837f, 0.00322819874f,
+    0.00322481873f, 0.00322131813f, 0.00321769738f, 0.00321395649f, 0.00321009569f, 0.00320611498f, 0.00320201507f, 0.00319779548f,
+    0.00319345691f, 0.0031889996f, 0.00318442332f, 0.00317972852f, 0.00317491544f, 0.00316998409f, 0.00316493516f, 0.00315976841f,
+    0.00315448409f, 0.00314908288f, 0.00314356457f, 0.0031379296f, 0.00313217822f, 0.00312631042f, 0.0031203269f, 0.00311422767f,
+    0.00310801296f, 0.00310168322f, 0.00309523847f, 0.00308867916f, 0.00308200577f, 0.00307521806f, 0.00306831673f, 0.00306130201f,
+    0.00305417413f, 0.00304693356f, 0.0030395803f, 0.00303211482f, 0.00302453758f, 0.00301684882f, 0.00300904876f, 0.00300113764f,
+    0.00299311592f, 0.00298498408f, 0.00297674234f, 0.00296839117f, 0.00295993057f, 0.00295136124f, 0.00294268341f, 0.00293389731f,
+    0.00292500341f, 0.00291600241f, 0.00290689408f, 0.00289767911f, 0.00288835797f, 0.00287893112f, 0.00286939857f, 0.00285976077f,
+    0.00285001844f, 0.0028401718f, 0.00283022108f, 0.00282016699f, 0.00281000999f, 0.00279975007f, 0.00278938795f, 0.00277892407f,
+    0.00276835868f, 0.00275769224f, 0.00274692546f, 0.00273605855f, 0.00272509176f, 0.00271402602f, 0.00270286133f, 0.00269159838f,
+    0.00268023764f, 0.00266877934f, 0.00265722419f, 0.00264557265f, 0.00263382494f, 0.00262198178f, 0.00261004339f, 0.0025980107f,
+    0.00258588372f, 0.00257366314f, 0.00256134965f, 0.00254894327f, 0.00253644492f, 0.00252385484f, 0.00251117372f, 0.00249840179f,
+    0.00248554f, 0.00247258856f, 0.00245954795f, 0.00244641863f, 0.00243320153f, 0.00241989689f, 0.00240650517f, 0.00239302707f,
+    0.00237946305f, 0.00236581359f, 0.00235207938f, 0.00233826065f, 0.00232435833f, 0.00231037289f, 0.0022963048f, 0.00228215451f,
+    0.00226792274f, 0.00225360994f, 0.00223921682f, 0.00222474383f, 0.00221019168f, 0.00219556084f, 0.00218085176f, 0.00216606515f,
+    0.00215120171f, 0.00213626167f, 0.00212124595f, 0.00210615504f, 0.00209098961f, 0.00207575015f, 0.00206043734f, 0.00204505166f,
+    0.0020295938f, 0.00201406423f, 0.00199846365f, 0.00198279275f, 0.00196705223f, 0.00195124245f, 0.0019353641f, 0.00191941787f,
+    0.00190340425f, 0.00188732403f, 0.00187117781f, 0.00185496616f, 0.00183868967f, 0.00182234903f, 0.00180594495f, 0.001789478f,
+    0.00177294877f, 0.00175635796f, 0.00173970615f, 0.00172299414f, 0.00170622242f, 0.00168939168f, 0.00167250261f, 0.00165555591f,
+    0.00163855206f, 0.00162149197f, 0.00160437601f, 0.0015872051f, 0.00156997982f, 0.00155270076f, 0.00153536862f, 0.00151798408f,
+    0.00150054798f, 0.00148306065f, 0.00146552303f, 0.00144793582f, 0.00143029948f, 0.00141261483f, 0.00139488257f, 0.00137710327f,
+    0.00135927775f, 0.00134140661f, 0.00132349052f, 0.00130553031f, 0.00128752657f, 0.00126947986f, 0.00125139114f, 0.00123326096f,
+    0.00121509004f, 0.00119687896f, 0.00117862865f, 0.00116033969f, 0.00114201265f, 0.00112364849f, 0.00110524776f, 0.00108681107f,
+    0.00106833933f, 0.00104983326f, 0.0010312933f, 0.00101272052f, 0.000994115253f, 0.000975478499f, 0.000956810894f, 0.00093811308f,
+    0.000919385813f, 0.000900629791f, 0.000881845772f, 0.000863034511f, 0.000844196591f, 0.000825332827f, 0.000806443917f, 0.000787530618f,
+    0.000768593571f, 0.000749633531f, 0.000730651256f, 0.000711647444f, 0.000692622794f, 0.000673578063f, 0.000654513948f, 0.000635431206f,
+    0.000616330537f, 0.000597212696f, 0.000578078325f, 0.000558928296f, 0.00053976319f, 0.000520583824f, 0.000501390838f, 0.000482185074f,
+    0.000462967175f, 0.000443737925f, 0.000424497994f, 0.000405248167f, 0.000385989144f, 0.000366721652f, 0.000347446417f, 0.000328164169f,
+    0.000308875664f, 0.0002895816f, 0.000270282704f, 0.000250979734f, 0.000231673388f, 0.000212364408f, 0.000193053536f, 0.000173741471f,
+    0.000154428955f, 0.00013511673f, 0.000115805509f, 9.64960127e-05f, 7.71889827e-05f, 5.78851432e-05f, 3.85852145e-05f, 1.92899242e-05f,
+    2.61799653e-17f, -1.92838324e-05f, -3.8560851e-05f, -5.78303261e-05f, -7.70915431e-05f, -9.63437706e-05f, -0.000115586285f, -0.000134818372f,
+    -0.000154039299f, -0.000173248365f, -0.00019244483f, -0.000211627979f, -0.000230797086f, -0.000249951467f, -0.000269090349f, -0.000288213079f,
+    -0.0003073189f, -0.000326407084f, -0.000345476961f, -0.000364527805f, -0.000383558887f, -0.000402569509f, -0.000421558943f, -0.000440526521f,
+    -0.000459471485f, -0.000478393165f, -0.000497290865f, -0.000516163826f, -0.00053501135f, -0.000553832797f, -0.00057262741f, -0.00059139455f,
+    -0.000610133458f, -0.000628843438f, -0.000647523848f, -0.000666173932f, -0.000684792991f, -0.000703380443f, -0.000721935474f, -0.000740457443f,
+    -0.000758945651f, -0.0007773994f, -0.000795818109f, -0.000814200961f, -0.000832547317f, -0.000850856479f, -0.000869127864f, -0.000887360657f,
+    -0.000905554334f, -0.000923708081f, -0.000941821316f, -0.000959893281f, -0.000977923395f, -0.000995911076f, -0.00101385545f, -0.00103175594f,
+    -0.00104961183f, -0.00106742268f, -0.00108518754f, -0.00110290595f, -0.00112057722f, -0.00113820075f, -0.00115577574f, -0.0011733016f,
+    -0.00119077775f, -0.0012082035f, -0.00122557825f, -0.00124290131f, -0.00126017211f, -0.00127738982f, -0.00129455409f, -0.00131166412f,
+    -0.00132871931f, -0.00134571909f, -0.00136266276f, -0.00137954974f, -0.00139637932f, -0.00141315104f, -0.00142986421f, -0.00144651823f,
+    -0.00146311242f, -0.00147964631f, -0.00149611919f, -0.00151253038f, -0.00152887951f, -0.0015451659f, -0.00156138884f, -0.00157754787f,
+    -0.00159364229f, -0.00160967163f, -0.0016256352f, -0.00164153252f, -0.00165736291f, -0.00167312589f, -0.00168882089f, -0.0017044472f,
+    -0.00172000437f, -0.00173549179f, -0.00175090902f, -0.00176625524f, -0.00178153021f, -0.00179673312f, -0.00181186362f, -0.00182692101f,
+    -0.00184190471f, -0.00185681437f, -0.00187164941f, -0.00188640913f, -0.00190109317f, -0.00191570085f, -0.00193023181f, -0.00194468547f,
+    -0.00195906125f, -0.00197335868f, -0.00198757718f, -0.00200171629f, -0.00201577554f, -0.00202975445f, -0.00204365235f, -0.00205746875f,
+    -0.00207120343f, -0.00208485569f, -0.00209842506f, -0.00211191108f, -0.00212531327f, -0.00213863119f, -0.00215186435f, -0.00216501206f,
+    -0.00217807409f, -0.00219104998f, -0.00220393925f, -0.00221674144f, -0.00222945586f, -0.00224208226f, -0.00225462043f, -0.00226706942f,
+    -0.00227942923f, -0.00229169917f, -0.00230387901f, -0.00231596804f, -0.00232796604f, -0.0023398723f, -0.00235168682f, -0.00236340915f,
+    -0.00237503857f, -0.00238657487f, -0.00239801756f, -0.00240936619f, -0.00242062053f, -0.0024317801f, -0.00244284444f, -0.00245381333f,
+    -0.00246468629f, -0.00247546285f, -0.0024861428f, -0.00249672565f, -0.00250721117f, -0.00251759891f, -0.0025278884f, -0.0025380794f,
+    -0.00254817167f, -0.00255816476f, -0.0025680582f, -0.00257785176f, -0.00258754496f, -0.00259713782f, -0.00260662963f, -0.00261602015f,
+    -0.0026253094f, -0.00263449666f, -0.00264358171f, -0.00265256432f, -0.00266144401f, -0.0026702208f, -0.00267889421f, -0.00268746377f,
+    -0.00269592949f, -0.00270429091f, -0.00271254778f, -0.00272069988f, -0.00272874674f, -0.00273668836f, -0.00274452451f, -0.00275225448f,
+    -0.00275987852f, -0.00276739616f, -0.00277480693f, -0.00278211106f, -0.00278930785f, -0.00279639731f, -0.00280337944f, -0.0028102533f,
+    -0.00281701935f, -0.00282367715f, -0.00283022644f, -0.002836667f, -0.0028429986f, -0.002849221f, -0.0028553342f, -0.00286133797f,
+    -0.00286723184f, -0.00287301582f, -0.00287868991f, -0.00288425363f, -0.00288970699f, -0.00289504952f, -0.00290028146f, -0.00290540257f,
+    -0.00291041238f, -0.00291531114f, -0.00292009837f, -0.00292477407f, -0.00292933802f, -0.00293379044f, -0.00293813064f, -0.00294235884f,
+    -0.00294647506f, -0.00295047858f, -0.00295436988f, -0.00295814872f, -0.00296181487f, -0.0029653681f, -0.00296880864f, -0.00297213625f,
+    -0.00297535071f, -0.00297845225f, -0.0029814404f, -0.00298431539f, -0.00298707676f, -0.00298972498f, -0.0029922598f, -0.00299468078f,
+    -0.00299698836f, -0.00299918232f, -0.00300126267f, -0.00300322915f, -0.00300508179f, -0.0030068208f, -0.00300844572f, -0.00300995703f,
+    -0.00301135448f, -0.00301263784f, -0.00301380735f, -0.003014863f, -0.0030158048f, -0.00301663252f, -0.00301734637f, -0.00301794638f,
+    -0.00301843253f, -0.00301880459f, -0.00301906304f, -0.00301920762f, -0.00301923836f, -0.00301915524f, -0.00301895849f, -0.00301864813f,
+    -0.00301822415f, -0.00301768654f, -0.00301703555f, -0.00301627093f, -0.00301539293f, -0.00301440153f, -0.00301329698f, -0.00301207928f,
+    -0.00301074842f, -0.00300930464f, -0.00300774793f, -0.0030060783f, -0.00300429622f, -0.00300240121f, -0.00300039398f, -0.00299827405f,
+    -0.00299604191f, -0.00299369777f, -0.0029912414f, -0.00298867328f, -0.0029859934f, -0.00298320176f, -0.0029802986f, -0.00297728414f,
+    -0.00297415862f, -0.00297092181f, -0.00296757417f, -0.00296411593f, -0.00296054687f, -0.00295686768f, -0.00295307813f, -0.00294917845f,
+    -0.00294516911f, -0.00294104987f, -0.0029368212f, -0.00293248333f, -0.00292803627f, -0.00292348047f, -0.00291881571f, -0.00291404268f,
+    -0.00290916138f, -0.00290417206f, -0.00289907493f, -0.00289387f, -0.00288855797f, -0.0028831386f, -0.00287761237f, -0.00287197949f,
+    -0.00286624045f, -0.002860395f, -0.00285444362f, -0.00284838676f, -0.00284222444f, -0.0028359571f, -0.00282958476f, -0.00282310788f,
+    -0.00281652692f, -0.00280984165f, -0.00280305278f, -0.00279616052f, -0.00278916513f, -0.00278206682f, -0.00277486607f, -0.00276756287f,
+    -0.00276015792f, -0.00275265123f, -0.00274504349f, -0.00273733446f, -0.00272952486f, -0.0027216149f, -0.00271360506f, -0.00270549534f,
+    -0.00269728643f, -0.00268897857f, -0.00268057175f, -0.00267206691f, -0.00266346405f, -0.00265476364f, -0.0026459659f, -0.0026370713f,
+    -0.00262808031f, -0.00261899293f, -0.00260981009f, -0.00260053156f, -0.00259115826f, -0.00258169021f, -0.00257212808f, -0.0025624719f,
+    -0.00255272235f, -0.00254287967f, -0.00253294455f, -0.002522917f, -0.00251279748f, -0.00250258669f, -0.00249228487f, -0.00248189247f,
+    -0.00247140997f, -0.0024608376f, -0.00245017582f, -0.00243942533f, -0.00242858613f, -0.00241765915f, -0.0024066444f, -0.00239554257f,
+    -0.00238435413f, -0.0023730793f, -0.00236171857f, -0.00235027261f, -0.00233874191f, -0.00232712668f, -0.00231542741f, -0.00230364478f,
+    -0.00229177903f, -0.00227983086f, -0.0022678005f, -0.00225568842f, -0.00224349555f, -0.00223122188f, -0.00221886812f, -0.00220643473f,
+    -0.00219392194f, -0.0021813307f, -0.00216866145f, -0.00215591444f, -0.00214309013f, -0.00213018944f, -0.0021172124f, -0.00210415991f,
+    -0.00209103222f, -0.00207783002f, -0.00206455379f, -0.00205120398f, -0.00203778106f, -0.00202428573f, -0.00201071845f, -0.00199707993f,
+    -0.0019833704f, -0.00196959055f, -0.00195574085f, -0.00194182189f, -0.00192783424f, -0.00191377848f, -0.00189965509f, -0.00188546476f,
+    -0.00187120785f, -0.00185688504f, -0.0018424968f, -0.00182804372f, -0.0018135265f, -0.0017989456f, -0.00178430148f, -0.00176959496f,
+    -0.0017548264f, -0.00173999649f, -0.0017251058f, -0.00171015481f, -0.00169514422f, -0.00168007461f, -0.00166494655f, -0.00164976052f,
+    -0.00163451722f, -0.00161921722f, -0.00160386122f, -0.00158844958f, -0.00157298311f, -0.00155746238f, -0.00154188788f, -0.00152626028f,
+    -0.00151058019f, -0.00149484817f, -0.00147906493f, -0.00146323105f, -0.00144734699f, -0.00143141358f, -0.00141543138f, -0.00139940099f,
+    -0.00138332299f, -0.00136719795f, -0.00135102659f, -0.00133480958f, -0.00131854753f, -0.00130224088f, -0.00128589047f, -0.00126949686f,
+    -0.00125306065f, -0.00123658252f, -0.00122006307f, -0.00120350299f, -0.00118690275f, -0.00117026328f, -0.00115358504f, -0.00113686861f,
+    -0.0011201147f, -0.001103324f, -0.0010864971f, -0.00106963469f, -0.00105273747f, -0.00103580591f, -0.0010188407f, -0.00100184267f,
+    -0.000984812272f, -0.000967750268f, -0.000950657239f, -0.000933533942f, -0.000916380959f, -0.000899198931f, -0.000881988497f, -0.000864750415f,
+    -0.000847485266f, -0.000830193749f, -0.000812876504f, -0.000795534172f, -0.000778167392f, -0.000760776922f, -0.000743363402f, -0.000725927413f,
+    -0.000708469655f, -0.000690990826f, -0.000673491624f, -0.000655972632f, -0.000638434547f, -0.000620878011f, -0.000603303779f, -0.000585712434f,
+    -0.000568104675f, -0.000550481142f, -0.000532842532f, -0.000515189546f, -0.000497522764f, -0.000479842973f, -0.000462150754f, -0.000444446807f,
+    -0.0004267318f, -0.000409006403f, -0.000391271285f, -0.000373527117f, -0.000355774595f, -0.000338014361f, -0.000320247113f, -0.000302473491f,
+    -0.000284694193f, -0.000266909861f, -0.000249121193f, -0.000231328871f, -0.000213533553f, -0.000195735891f, -0.000177936585f, -0.000160136289f,
+    -0.000142335673f, -0.000124535421f, -0.000106736203f, -8.89386793e-05f, -7.11435277e-05f, -5.3351414e-05f, -3.55630109e-05f, -1.77789807e-05f,
+    -1.41915788e-17f, 1.77732654e-05f, 3.55401498e-05f, 5.32999838e-05f, 7.10520981e-05f, 8.87958304e-05f, 0.000106530511f, 0.000124255472f,
+    0.000141970057f, 0.000159673596f, 0.000177365437f, 0.000195044893f, 0.000212711326f, 0.00023036405f, 0.000248002441f, 0.0002656258f,
+    0.000283233472f, 0.000300824817f, 0.000318399194f, 0.000335955905f, 0.00035349431f, 0.000371013739f, 0.000388513581f, 0.000405993138f,
+    0.000423451798f, 0.000440888864f, 0.000458303723f, 0.000475695706f, 0.000493064173f, 0.000510408485f, 0.000527728f, 0.00054502202f,
+    0.000562289963f, 0.00057953113f, 0.00059674494f, 0.000613930752f, 0.000631087867f, 0.000648215704f, 0.000665313622f, 0.000682380924f,
+    0.000699417084f, 0.000716421346f, 0.000733393186f, 0.000750331907f, 0.000767236925f, 0.0007841076f, 0.000800943293f, 0.000817743363f,
+    0.000834507227f, 0.000851234305f, 0.000867923838f, 0.000884575362f, 0.000901188178f, 0.000917761703f, 0.000934295298f, 0.000950788381f,
+    0.00096724031f, 0.000983650563f, 0.00100001844f, 0.00101634325f, 0.00103262463f, 0.00104886189f, 0.00106505433f, 0.00108120148f,
+    0.00109730265f, 0.00111335726f, 0.00112936483f, 0.00114532467f, 0.0011612362f, 0.00117709883f, 0.00119291211f, 0.00120867521f,
+    0.00122438779f, 0.00124004914f, 0.0012556588f, 0.00127121597f, 0.00128672039f, 0.00130217127f, 0.00131756801f, 0.00133291027f,
+    0.00134819734f, 0.00136342866f, 0.00137860375f, 0.00139372202f, 0.0014087829f, 0.00142378581f, 0.00143873028f, 0.00145361561f,
+    0.00146844145f, 0.00148320722f, 0.00149791234f, 0.00151255634f, 0.00152713852f, 0.00154165854f, 0.00155611569f, 0.00157050963f,
+    0.00158483977f, 0.00159910554f, 0.00161330646f, 0.00162744208f, 0.0016415118f, 0.00165551517f, 0.00166945159f, 0.00168332062f,
+    0.00169712177f, 0.00171085447f, 0.00172451837f, 0.00173811289f, 0.00175163744f, 0.00176509167f, 0.00177847513f, 0.00179178722f,
+    0.00180502748f, 0.00181819557f, 0.00183129078f, 0.00184431288f, 0.00185726117f, 0.00187013543f, 0.00188293494f, 0.00189565949f,
+    0.00190830848f, 0.00192088145f, 0.00193337805f, 0.00194579782f, 0.00195814017f, 0.00197040476f, 0.00198259135f, 0.00199469901f,
+    0.00200672774f, 0.00201867707f, 0.00203054631f, 0.00204233546f, 0.00205404358f, 0.00206567068f, 0.00207721628f, 0.0020886797f,
+    0.00210006093f, 0.00211135927f, 0.00212257449f, 0.00213370589f, 0.00214475347f, 0.00215571676f, 0.00216659508f, 0.00217738841f,
+    0.00218809606f, 0.00219871802f, 0.00220925361f, 0.00221970258f, 0.00223006448f, 0.00224033906f, 0.0022505261f, 0.0022606249f,
+    0.00227063522f, 0.0022805566f, 0.00229038903f, 0.00230013207f, 0.00230978522f, 0.00231934828f, 0.00232882076f, 0.00233820267f,
+    0.00234749331f, 0.00235669245f, 0.00236579985f, 0.00237481506f, 0.00238373806f, 0.00239256839f, 0.0024013056f, 0.00240994967f,
+    0.00241849991f, 0.00242695655f, 0.00243531889f, 0.00244358671f, 0.00245175976f, 0.00245983782f, 0.00246782065f, 0.00247570802f,
+    0.00248349947f, 0.00249119475f, 0.00249879388f, 0.00250629615f, 0.00251370179f, 0.00252101035f, 0.00252822135f, 0.00253533502f,
+    0.00254235067f, 0.00254926831f, 0.00255608768f, 0.00256280857f, 0.00256943074f, 0.00257595372f, 0.00258237775f, 0.0025887026f,
+    0.00259492756f, 0.00260105287f, 0.00260707829f, 0.00261300337f, 0.00261882809f, 0.00262455246f, 0.00263017579f, 0.00263569853f,
+    0.00264111999f, 0.00264644017f, 0.00265165907f, 0.00265677623f, 0.00266179163f, 0.00266670529f, 0.00267151673f, 0.00267622597f,
+    0.00268083299f, 0.00268533756f, 0.00268973922f, 0.00269403821f, 0.00269823452f, 0.00270232768f, 0.0027063177f, 0.00271020434f,
+    0.00271398784f, 0.00271766772f, 0.002721244f, 0.00272471667f, 0.0027280855f, 0.00273135048f, 0.00273451163f, 0.00273756846f,
+    0.00274052145f, 0.00274337013f, 0.00274611427f, 0.00274875434f, 0.0027512901f, 0.00275372108f, 0.00275604776f, 0.00275826966f,
+    0.00276038703f, 0.00276239985f, 0.00276430766f, 0.00276611093f, 0.0027678092f, 0.00276940269f, 0.00277089141f, 0.00277227536f,
+    0.0027735543f, 0.00277472823f, 0.00277579739f, 0.00277676154f, 0.00277762068f, 0.00277837506f, 0.00277902442f, 0.00277956901f,
+    0.0027800086f, 0.00278034317f, 0.00278057321f, 0.00278069801f, 0.00278071826f, 0.00278063375f, 0.00278044445f, 0.00278015039f,
+    0.00277975178f, 0.00277924864f, 0.00277864072f, 0.00277792849f, 0.00277711172f, 0.00277619087f, 0.00277516549f, 0.00277403579f,
+    0.00277280202f, 0.00277146418f, 0.00277002249f, 0.00276847673f, 0.00276682735f, 0.00276507414f, 0.00276321732f, 0.00276125711f,
+    0.0027591933f, 0.00275702635f, 0.00275475625f, 0.00275238301f, 0.00274990685f, 0.00274732802f, 0.00274464651f, 0.00274186232f,
+    0.00273897569f, 0.00273598707f, 0.00273289625f, 0.00272970321f, 0.00272640865f, 0.00272301235f, 0.00271951454f, 0.00271591544f,
+    0.00271221506f, 0.00270841387f, 0.00270451186f, 0.00270050927f, 0.0026964061f, 0.00269220257f, 0.00268789916f, 0.00268349587f,
+    0.00267899293f, 0.00267439056f, 0.00266968878f, 0.00266488804f, 0.00265998836f, 0.00265499018f, 0.00264989352f, 0.0026446986f,
+    0.0026394059f, 0.0026340154f, 0.00262852735f, 0.00262294221f, 0.00261725998f, 0.00261148089f, 0.0026056054f, 0.00259963353f,
+    0.00259356597f, 0.00258740224f, 0.00258114329f, 0.0025747891f, 0.00256833993f, 0.00256179622f, 0.00255515799f, 0.00254842569f,
+    0.00254159956f, 0.00253467984f, 0.00252766698f, 0.00252056122f, 0.00251336256f, 0.0025060717f, 0.00249868887f, 0.00249121408f,
+    0.00248364802f, 0.00247599091f, 0.00246824278f, 0.0024604043f, 0.00245247572f, 0.00244445726f, 0.0024363494f, 0.00242815237f,
+    0.00241986639f, 0.00241149217f, 0.00240302971f, 0.00239447947f, 0.00238584168f, 0.00237711682f, 0.00236830534f, 0.00235940749f,
+    0.00235042372f, 0.00234135427f, 0.00233219936f, 0.00232295971f, 0.00231363554f, 0.00230422732f, 0.00229473528f, 0.00228515989f,
+    0.00227550161f, 0.00226576068f, 0.00225593732f, 0.00224603247f, 0.00223604613f, 0.00222597877f, 0.00221583084f, 0.00220560282f,
+    0.00219529495f, 0.00218490767f, 0.00217444147f, 0.0021638968f, 0.0021532739f, 0.00214257347f, 0.00213179598f, 0.00212094141f,
+    0.00211001048f, 0.00209900364f, 0.00208792137f, 0.00207676413f, 0.00206553214f, 0.00205422612f, 0.00204284629f, 0.00203139312f,
+    0.0020198673f, 0.00200826908f, 0.0019965989f, 0.00198485749f, 0.00197304483f, 0.00196116185f, 0.0019492089f, 0.00193718635f,
+    0.00192509475f, 0.00191293459f, 0.00190070632f, 0.0018884103f, 0.00187604735f, 0.00186361757f, 0.00185112166f, 0.0018385601f,
+    0.00182593346f, 0.00181324198f, 0.00180048647f, 0.00178766716f, 0.00177478476f, 0.00176183973f, 0.00174883241f, 0.00173576351f,
+    0.00172263349f, 0.00170944282f, 0.00169619208f, 0.00168288173f, 0.00166951236f, 0.00165608444f, 0.00164259842f, 0.00162905501f,
+    0.00161545456f, 0.00160179776f, 0.00158808508f, 0.00157431699f, 0.00156049407f, 0.0015466169f, 0.00153268594f, 0.00151870179f,
+    0.00150466501f, 0.00149057608f, 0.00147643569f, 0.0014622442f, 0.00144800229f, 0.00143371045f, 0.00141936925f, 0.00140497927f,
+    0.00139054097f, 0.00137605506f, 0.00136152213f, 0.0013469425f, 0.00133231701f, 0.00131764601f, 0.00130293018f, 0.00128816999f,
+    0.00127336616f, 0.00125851925f, 0.00124362961f, 0.00122869806f, 0.00121372519f, 0.00119871134f, 0.00118365732f, 0.00116856361f,
+    0.00115343079f, 0.00113825942f, 0.00112305011f, 0.00110780355f, 0.00109252008f, 0.00107720052f, 0.00106184545f, 0.00104645535f,
+    0.00103103078f, 0.00101557246f, 0.00100008096f, 0.00098455674f, 0.000969000568f, 0.000953412964f, 0.00093779451f, 0.000922145846f,
+    0.000906467554f, 0.000890760217f, 0.000875024474f, 0.000859260908f, 0.000843470101f, 0.000827652693f, 0.000811809266f, 0.000795940403f,
+    0.000780046801f, 0.000764128927f, 0.000748187536f, 0.000732223154f, 0.000716236362f, 0.000700227858f, 0.000684198167f, 0.000668147928f,
+    0.000652077841f, 0.00063598837f, 0.000619880215f, 0.000603753957f, 0.000587610237f, 0.000571449695f, 0.000555272854f, 0.000539080414f,
+    0.000522872957f, 0.000506651064f, 0.000490415434f, 0.00047416662f, 0.000457905262f, 0.000441631972f, 0.00042534736f, 0.000409052038f,
+    0.000392746646f, 0.000376431795f, 0.000360108097f, 0.000343776162f, 0.000327436632f, 0.000311090087f, 0.000294737198f, 0.000278378546f,
+    0.000262014742f, 0.000245646428f, 0.000229274228f, 0.00021289874f, 0.000196520603f, 0.0001801404f, 0.000163758785f, 0.000147376355f,
+    0.000130993751f, 0.000114611554f, 9.82304118e-05f, 8.18509216e-05f, 6.54737159e-05f, 4.90994062e-05f, 3.2728607e-05f, 1.63619316e-05f,
+    4.18032465e-17f, -1.63565746e-05f, -3.27071793e-05f, -4.90511957e-05f, -6.53880124e-05f, -8.17170148e-05f, -9.80375917e-05f, -0.000114349132f,
+    -0.000130651024f, -0.00014694265f, -0.000163223405f, -0.000179492679f, -0.000195749861f, -0.000211994353f, -0.000228225515f, -0.000244442781f,
+    -0.000260645524f, -0.000276833132f, -0.000293004996f, -0.000309160532f, -0.00032529913f, -0.000341420178f, -0.000357523095f, -0.000373607239f,
+    -0.000389672059f, -0.000405716914f, -0.00042174125f, -0.000437744427f, -0.000453725865f, -0.000469684979f, -0.00048562116f, -0.000501533854f,
+    -0.000517422392f, -0.000533286249f, -0.000549124787f, -0.00056493748f, -0.000580723688f, -0.000596482831f, -0.000612214382f, -0.000627917645f,
+    -0.000643592153f, -0.000659237208f, -0.000674852345f, -0.000690436922f, -0.000705990416f, -0.000721512188f, -0.000737001654f, -0.000752458291f,
+    -0.000767881516f, -0.000783270749f, -0.000798625406f, -0.000813944964f, -0.00082922884f, -0.000844476395f, -0.000859687221f, -0.00087486062f,
+    -0.000889996067f, -0.000905093038f, -0.000920150953f, -0.000935169228f, -0.000950147398f, -0.000965084822f, -0.00097998092f, -0.000994835282f,
+    -0.00100964739f, -0.00102441642f, -0.00103914214f, -0.00105382374f, -0.00106846087f, -0.00108305295f, -0.00109759951f, -0.00111209985f,
+    -0.00112655351f, -0.00114096014f, -0.00115531893f, -0.0011696294f, -0.0011838912f, -0.00119810377f, -0.00121226651f, -0.00122637884f,
+    -0.00124044041f, -0.00125445053f, -0.00126840884f, -0.00128231477f, -0.00129616784f, -0.0013099676f, -0.00132371334f, -0.00133740483f,
+    -0.00135104137f, -0.0013646225f, -0.00137814775f, -0.00139161665f, -0.00140502863f, -0.00141838344f, -0.00143168028f, -0.0014449188f,
+    -0.00145809865f, -0.00147121912f, -0.00148427987f, -0.00149728043f, -0.00151022035f, -0.00152309902f, -0.00153591624f, -0.00154867116f,
+    -0.00156136369f, -0.00157399324f, -0.00158655923f, -0.00159906142f, -0.00161149912f, -0.00162387209f, -0.00163617986f, -0.00164842186f,
+    -0.00166059774f, -0.00167270715f, -0.0016847495f, -0.00169672433f, -0.0017086314f, -0.00172047014f, -0.0017322402f, -0.0017439411f,
+    -0.00175557239f, -0.00176713383f, -0.00177862472f, -0.00179004495f, -0.00180139393f, -0.00181267143f, -0.00182387675f, -0.00183500978f,
+    -0.00184606994f, -0.00185705698f, -0.00186797045f, -0.00187880988f, -0.00188957492f, -0.00190026534f, -0.00191088056f, -0.00192142033f,
+    -0.00193188433f, -0.00194227195f, -0.00195258309f, -0.00196281727f, -0.00197297405f, -0.00198305305f, -0.00199305429f, -0.00200297683f,
+    -0.00201282091f, -0.00202258583f, -0.00203227135f, -0.00204187701f, -0.00205140258f, -0.00206084782f, -0.00207021227f, -0.00207949569f,
+    -0.00208869763f, -0.00209781807f, -0.00210685609f, -0.00211581215f, -0.00212468533f, -0.00213347538f, -0.00214218232f, -0.0021508059f,
+    -0.0021593452f, -0.00216780067f, -0.0021761714f, -0.00218445761f, -0.00219265861f, -0.00220077438f, -0.00220880471f, -0.00221674889f,
+    -0.00222460716f, -0.00223237905f, -0.00224006409f, -0.00224766228f, -0.00225517317f, -0.00226259674f, -0.00226993253f, -0.00227718055f,
+    -0.00228434033f, -0.00229141163f, -0.00229839422f, -0.0023052881f, -0.00231209258f, -0.00231880788f, -0.00232543354f, -0.00233196956f,
+    -0.00233841548f, -0.00234477106f, -0.0023510363f, -0.00235721073f, -0.0023632946f, -0.00236928719f, -0.00237518875f, -0.00238099857f,
+    -0.00238671713f, -0.00239234371f, -0.00239787833f, -0.00240332074f, -0.00240867073f, -0.00241392828f, -0.00241909316f, -0.00242416514f,
+    -0.00242914422f, -0.00243402994f, -0.00243882253f, -0.00244352175f, -0.00244812714f, -0.00245263893f, -0.00245705666f, -0.00246138033f,
+    -0.00246560993f, -0.00246974546f, -0.00247378624f, -0.00247773272f, -0.00248158444f, -0.00248534139f, -0.00248900335f, -0.00249257055f,
+    -0.00249604252f, -0.00249941926f, -0.00250270078f, -0.00250588683f, -0.00250897766f, -0.00251197279f, -0.00251487223f, -0.00251767598f,
+    -0.00252038403f, -0.00252299616f, -0.00252551259f, -0.00252793264f, -0.00253025698f, -0.00253248517f, -0.00253461697f, -0.00253665284f,
+    -0.00253859232f, -0.00254043564f, -0.00254218257f, -0.00254383311f, -0.00254538725f, -0.002546845f, -0.00254820636f, -0.0025494711f,
+    -0.00255063944f, -0.0025517114f, -0.00255268672f, -0.00255356566f, -0.0025543482f, -0.00255503412f, -0.00255562342f, -0.00255611632f,
+    -0.00255651283f, -0.00255681295f, -0.00255701644f, -0.00255712355f, -0.00255713449f, -0.00255704881f, -0.00255686697f, -0.00255658897f,
+    -0.00255621457f, -0.00255574402f, -0.00255517731f, -0.00255451445f, -0.00255375565f, -0.00255290093f, -0.00255195028f, -0.00255090371f,
+    -0.00254976144f, -0.00254852348f, -0.00254719006f, -0.00254576094f, -0.00254423637f, -0.00254261657f, -0.0025409013f, -0.00253909105f,
+    -0.00253718556f, -0.00253518531f, -0.00253309007f, -0.00253090006f, -0.00252861553f, -0.00252623647f, -0.00252376311f, -0.00252119522f,
+    -0.00251853326f, -0.00251577748f, -0.00251292763f, -0.00250998419f, -0.00250694714f, -0.0025038165f, -0.00250059273f, -0.00249727559f,
+    -0.00249386556f, -0.00249036285f, -0.00248676725f, -0.00248307944f, -0.00247929897f, -0.00247542653f, -0.00247146212f, -0.00246740575f,
+    -0.00246325787f, -0.00245901849f, -0.00245468784f, -0.00245026639f, -0.0024457539f, -0.0024411506f, -0.00243645697f, -0.00243167323f,
+    -0.00242679939f, -0.00242183567f, -0.00241678231f, -0.00241163978f, -0.00240640785f, -0.0024010872f, -0.00239567761f, -0.00239017978f,
+    -0.00238459348f, -0.00237891939f, -0.0023731573f, -0.0023673079f, -0.00236137141f, -0.00235534762f, -0.00234923721f, -0.00234304019f,
+    -0.00233675702f, -0.00233038794f, -0.00232393318f, -0.00231739297f, -0.00231076777f, -0.00230405736f, -0.00229726266f, -0.00229038345f,
+    -0.00228342041f, -0.00227637356f, -0.00226924336f, -0.0022620298f, -0.00225473358f, -0.00224735471f, -0.00223989389f, -0.00223235087f,
+    -0.00222472637f, -0.00221702037f, -0.00220923359f, -0.00220136624f, -0.00219341833f, -0.00218539056f, -0.00217728317f, -0.00216909638f,
+    -0.00216083042f, -0.00215248601f, -0.00214406312f, -0.00213556224f, -0.00212698383f, -0.00211832812f, -0.00210959534f, -0.00210078596f,
+    -0.00209190045f, -0.00208293903f, -0.00207390217f, -0.00206479011f, -0.00205560331f, -0.00204634224f, -0.0020370069f, -0.00202759798f,
+    -0.00201811595f, -0.00200856081f, -0.00199893326f, -0.00198923354f, -0.0019794621f, -0.00196961942f, -0.00195970573f, -0.00194972148f,
+    -0.00193966716f, -0.00192954298f, -0.00191934954f, -0.00190908706f, -0.00189875625f, -0.00188835722f, -0.00187789043f, -0.00186735648f,
+    -0.00185675558f, -0.00184608821f, -0.00183535495f, -0.00182455603f, -0.00181369204f, -0.0018027632f, -0.0017917701f, -0.00178071321f,
+    -0.00176959287f, -0.00175840943f, -0.00174716359f, -0.00173585559f, -0.00172448601f, -0.00171305519f, -0.0017015636f, -0.00169001182f,
+    -0.00167840009f, -0.00166672899f, -0.00165499898f, -0.00164321053f, -0.00163136411f, -0.00161946018f, -0.00160749909f, -0.00159548142f,
+    -0.00158340775f, -0.00157127832f, -0.00155909371f, -0.0015468545f, -0.00153456104f, -0.0015222138f, -0.00150981336f, -0.00149736006f,
+    -0.00148485461f, -0.00147229736f, -0.00145968876f, -0.0014470293f, -0.00143431965f, -0.00142156007f, -0.00140875124f, -0.00139589363f,
+    -0.0013829876f, -0.00137003383f, -0.00135703268f, -0.00134398486f, -0.00133089058f, -0.00131775066f, -0.00130456535f, -0.00129133533f,
+    -0.00127806095f, -0.00126474292f, -0.00125138171f, -0.00123797765f, -0.00122453156f, -0.00121104368f, -0.00119751471f, -0.00118394522f,
+    -0.00117033545f, -0.00115668622f, -0.00114299799f, -0.00112927111f, -0.0011155064f, -0.0011017042f, -0.00108786498f, -0.00107398944f,
+    -0.00106007815f, -0.00104613148f, -0.00103215f, -0.0010181343f, -0.00100408483f, -0.0009900023f, -0.000975887175f, -0.000961739919f,
+    -0.000947561173f, -0.000933351403f, -0.000919111248f, -0.000904841174f, -0.000890541764f, -0.00087621354f, -0.000861857086f, -0.000847472984f,
+    -0.000833061698f, -0.000818623812f, -0.000804159907f, -0.000789670506f, -0.000775156193f, -0.000760617491f, -0.000746054982f, -0.000731469248f,
+    -0.000716860755f, -0.000702230143f, -0.000687577936f, -0.000672904716f, -0.000658211065f, -0.000643497449f, -0.000628764508f, -0.000614012766f,
+    -0.000599242863f, -0.000584455265f, -0.000569650554f, -0.000554829312f, -0.000539992121f, -0.000525139505f, -0.000510272104f, -0.000495390384f,
+    -0.000480494986f, -0.000465586432f, -0.000450665306f, -0.000435732189f, -0.000420787605f, -0.000405832165f, -0.000390866422f, -0.00037589093f,
+    -0.00036090627f, -0.000345912995f, -0.000330911687f, -0.000315902929f, -0.000300887245f, -0.000285865273f, -0.00027083751f, -0.000255804538f,
+    -0.000240766967f, -0.000225725336f, -0.000210680199f, -0.00019563215f, -0.000180581759f, -0.000165529564f, -0.00015047616f, -0.000135422117f,
+    -0.000120367979f, -0.000105314328f, -9.02617321e-05f, -7.5210759e-05f, -6.01619686e-05f, -4.51159322e-05f, -3.00732136e-05f, -1.50343822e-05f,
+    4.80634784e-18f, 1.50293663e-05f, 3.00531519e-05f, 4.50707921e-05f, 6.00817257e-05f, 7.50853869e-05f, 9.00812083e-05f, 0.000105068633f,
+    0.000120047102f, 0.000135016046f, 0.000149974905f, 0.000164923127f, 0.000179860144f, 0.000194785403f, 0.000209698337f, 0.000224598392f,
+    0.000239485016f, 0.000254357641f, 0.000269215729f, 0.000284058682f, 0.000298886007f, 0.000313697121f, 0.000328491471f, 0.000343268504f,
+    0.000358027639f, 0.00037276838f, 0.000387490174f, 0.000402192411f, 0.000416874624f, 0.000431536202f, 0.000446176622f, 0.00046079536f,
+    0.000475391862f, 0.000489965547f, 0.00050451589f, 0.000519042427f, 0.000533544517f, 0.000548021635f, 0.000562473317f, 0.000576898979f,
+    0.000591298041f, 0.000605670037f, 0.000620014442f, 0.000634330616f, 0.000648618152f, 0.000662876526f, 0.000677105098f, 0.000691303401f,
+    0.000705470913f, 0.000719607167f, 0.000733711524f, 0.000747783517f, 0.000761822681f, 0.000775828434f, 0.000789800251f, 0.000803737668f,
+    0.000817640102f, 0.000831507146f, 0.00084533816f, 0.000859132735f, 0.00087289029f, 0.000886610418f, 0.000900292536f, 0.000913936121f,
+    0.000927540765f, 0.000941105827f, 0.000954630959f, 0.000968115579f, 0.000981559278f, 0.00099496136f, 0.00100832165f, 0.00102163933f,
+    0.00103491417f, 0.00104814547f, 0.00106133288f, 0.00107447593f, 0.00108757417f, 0.00110062689f, 0.00111363386f, 0.00112659449f,
+    0.00113950844f, 0.00115237501f, 0.00116519397f, 0.00117796462f, 0.00119068671f, 0.00120335957f, 0.00121598295f, 0.00122855627f,
+    0.00124107907f, 0.00125355087f, 0.00126597134f, 0.00127834f, 0.00129065628f, 0.00130291982f, 0.00131513015f, 0.00132728682f,
+    0.00133938948f, 0.00135143753f, 0.00136343075f, 0.00137536856f, 0.00138725049f, 0.00139907619f, 0.0014108452f, 0.00142255716f,
+    0.00143421162f, 0.0014458081f, 0.00145734614f, 0.0014688255f, 0.00148024561f, 0.00149160624f, 0.00150290679f, 0.00151414692f,
+    0.00152532628f, 0.00153644441f, 0.00154750084f, 0.00155849534f, 0.00156942743f, 0.00158029678f, 0.00159110292f, 0.00160184538f,
+    0.00161252404f, 0.0016231382f, 0.00163368776f, 0.00164417224f, 0.00165459129f, 0.00166494434f, 0.00167523138f, 0.00168545172f,
+    0.00169560523f, 0.00170569133f, 0.00171570992f, 0.0017256604f, 0.00173554255f, 0.00174535613f, 0.00175510044f, 0.00176477549f,
+    0.0017743808f, 0.00178391603f, 0.00179338083f, 0.00180277484f, 0.00181209785f, 0.00182134937f, 0.00183052931f, 0.00183963706f,
+    0.00184867252f, 0.00185763533f, 0.00186652504f, 0.00187534152f, 0.00188408431f, 0.00189275329f, 0.00190134789f, 0.00190986809f,
+    0.00191831344f, 0.0019266837f, 0.00193497853f, 0.00194319768f, 0.00195134094f, 0.0019594077f, 0.00196739822f, 0.0019753119f,
+    0.00198314828f, 0.00199090736f, 0.00199858891f, 0.00200619269f, 0.00201371824f, 0.00202116533f, 0.00202853372f, 0.00203582342f,
+    0.00204303372f, 0.00205016485f, 0.00205721613f, 0.00206418778f, 0.0020710791f, 0.00207789009f, 0.00208462053f, 0.00209127017f,
+    0.00209783879f, 0.00210432615f, 0.00211073225f, 0.0021170564f, 0.00212329882f, 0.00212945906f, 0.0021355371f, 0.00214153249f,
+    0.00214744522f, 0.00215327507f, 0.00215902179f, 0.0021646854f, 0.00217026542f, 0.00217576185f, 0.00218117423f, 0.0021865028f,
+    0.00219174731f, 0.0021969073f, 0.00220198277f, 0.00220697373f, 0.00221187971f, 0.0022167007f, 0.00222143671f, 0.00222608726f,
+    0.00223065261f, 0.00223513204f, 0.00223952602f, 0.00224383408f, 0.002248056f, 0.002252192f, 0.00225624163f, 0.00226020487f,
+    0.00226408173f, 0.00226787198f, 0.00227157539f, 0.00227519218f, 0.00227872166f, 0.00228216453f, 0.00228551985f, 0.00228878832f,
+    0.00229196926f, 0.00229506264f, 0.00229806872f, 0.00230098702f, 0.00230381778f, 0.00230656075f, 0.00230921595f, 0.00231178314f,
+    0.00231426256f, 0.00231665373f, 0.00231895689f, 0.00232117181f, 0.00232329872f, 0.00232533715f, 0.00232728757f, 0.00232914952f,
+    0.00233092299f, 0.00233260798f, 0.00233420474f, 0.00233571278f, 0.00233713258f, 0.00233846367f, 0.00233970629f, 0.0023408602f,
+    0.00234192563f, 0.00234290259f, 0.00234379061f, 0.00234459038f, 0.00234530121f, 0.00234592357f, 0.00234645745f, 0.00234690262f,
+    0.00234725932f, 0.0023475273f, 0.00234770682f, 0.00234779785f, 0.00234780042f, 0.0023477145f, 0.00234754011f, 0.00234727748f,
+    0.00234692637f, 0.00234648678f, 0.00234595919f, 0.00234534335f, 0.00234463927f, 0.00234384695f, 0.00234296685f, 0.00234199874f,
+    0.00234094262f, 0.00233979872f, 0.00233856705f, 0.0023372476f, 0.0023358406f, 0.00233434583f, 0.00233276398f, 0.00233109458f,
+    0.00232933788f, 0.00232749409f, 0.00232556323f, 0.00232354528f, 0.00232144073f, 0.00231924909f, 0.00231697108f, 0.00231460645f,
+    0.00231215521f, 0.00230961805f, 0.00230699452f, 0.00230428483f, 0.00230148947f, 0.00229860819f, 0.00229564123f, 0.00229258882f,
+    0.00228945119f, 0.00228622835f, 0.00228292029f, 0.00227952749f, 0.00227604969f, 0.00227248762f, 0.00226884102f, 0.00226511015f,
+    0.00226129498f, 0.00225739623f, 0.00225341367f, 0.00224934751f, 0.00224519777f, 0.00224096514f, 0.00223664939f, 0.00223225076f,
+    0.00222776947f, 0.00222320599f, 0.00221856008f, 0.00221383222f, 0.00220902264f, 0.00220413134f, 0.00219915854f, 0.00219410472f,
+    0.00218896987f, 0.00218375423f, 0.00217845803f, 0.00217308174f, 0.00216762535f, 0.00216208911f, 0.00215647323f, 0.00215077796f,
+    0.00214500353f, 0.0021391504f, 0.00213321857f, 0.00212720828f, 0.00212111999f, 0.00211495371f, 0.00210870989f, 0.00210238877f,
+    0.00209599058f, 0.00208951556f, 0.00208296394f, 0.00207633618f, 0.00206963229f, 0.00206285273f, 0.00205599773f, 0.00204906752f,
+    0.00204206258f, 0.00203498313f, 0.00202782918f, 0.00202060142f, 0.00201329985f, 0.00200592494f, 0.00199847692f, 0.00199095602f,
+    0.00198336272f, 0.00197569723f, 0.00196796004f, 0.00196015113f, 0.00195227121f, 0.00194432028f, 0.0019362988f, 0.001928207f,
+    0.00192004535f, 0.00191181409f, 0.00190351368f, 0.00189514423f, 0.00188670622f, 0.00187819998f, 0.00186962588f, 0.00186098425f,
+    0.00185227534f, 0.00184349972f, 0.00183465751f, 0.00182574918f, 0.00181677507f, 0.00180773553f, 0.00179863092f, 0.0017894617f,
+    0.00178022811f, 0.0017709306f, 0.00176156941f, 0.00175214512f, 0.00174265797f, 0.00173310831f, 0.00172349659f, 0.00171382329f,
+    0.00170408865f, 0.00169429299f, 0.00168443692f, 0.00167452067f, 0.00166454469f, 0.00165450934f, 0.00164441508f, 0.00163426227f,
+    0.00162405137f, 0.00161378272f, 0.00160345668f, 0.00159307371f, 0.00158263429f, 0.00157213875f, 0.00156158756f, 0.00155098108f,
+    0.00154031976f, 0.00152960396f, 0.00151883427f, 0.0015080109f, 0.00149713433f, 0.00148620515f, 0.00147522357f, 0.00146419019f,
+    0.00145310536f, 0.00144196954f, 0.00143078319f, 0.00141954666f, 0.00140826055f, 0.00139692507f, 0.00138554093f, 0.00137410837f,
+    0.00136262784f, 0.00135109993f, 0.00133952498f, 0.00132790359f, 0.00131623598f, 0.00130452274f, 0.00129276444f, 0.00128096121f,
+    0.00126911385f, 0.00125722273f, 0.00124528818f, 0.00123331079f, 0.00122129091f, 0.00120922923f, 0.001197126f, 0.00118498167f,
+    0.00117279694f, 0.00116057217f, 0.0011483077f, 0.00113600423f, 0.00112366199f, 0.00111128169f, 0.00109886378f, 0.00108640851f,
+    0.00107391668f, 0.00106138852f, 0.00104882463f, 0.00103622559f, 0.00102359173f, 0.00101092353f, 0.000998221571f, 0.0009854862f,
+    0.000972718175f, 0.000959917728f, 0.0009470855f, 0.000934221956f, 0.000921327563f, 0.000908402784f, 0.000895448204f, 0.000882464286f,
+    0.000869451498f, 0.000856410363f, 0.000843341404f, 0.000830245088f, 0.000817121938f, 0.00080397242f, 0.000790797116f, 0.000777596491f,
+    0.000764371012f, 0.000751121202f, 0.000737847644f, 0.000724550744f, 0.000711231085f, 0.000697889132f, 0.000684525468f, 0.0006711405f,
+    0.000657734752f, 0.000644308806f, 0.000630863127f, 0.000617398298f, 0.000603914727f, 0.000590412994f, 0.000576893566f, 0.000563357025f,
+    0.000549803837f, 0.000536234525f, 0.000522649614f, 0.000509049685f, 0.000495435146f, 0.00048180655f, 0.00046816445f, 0.00045450934f,
+    0.000440841715f, 0.000427162158f, 0.000413471134f, 0.000399769197f, 0.000386056839f, 0.000372334587f, 0.000358602963f, 0.000344862492f,
+    0.000331113726f, 0.000317357131f, 0.000303593231f, 0.000289822608f, 0.000276045728f, 0.000262263115f, 0.00024847532f, 0.000234682841f,
+    0.000220886199f, 0.000207085934f, 0.00019328254f, 0.00017947657f, 0.00016566852f, 0.000151858927f, 0.000138048301f, 0.00012423718f,
+    0.000110426052f, 9.66154694e-05f, 8.28059419e-05f, 6.89979861e-05f, 5.51921221e-05f, 4.13888702e-05f, 2.7588756e-05f, 1.37922925e-05f,
+    1.98193666e-17f, -1.37876032e-05f, -2.75699986e-05f, -4.13466696e-05f, -5.51170997e-05f, -6.88807704e-05f, -8.26371615e-05f, -9.63857601e-05f,
+    -0.000110126057f, -0.000123857535f, -0.000137579671f, -0.000151291941f, -0.000164993864f, -0.000178684917f, -0.000192364561f, -0.000206032317f,
+    -0.000219687659f, -0.000233330065f, -0.00024695904f, -0.000260574103f, -0.000274174672f, -0.000287760311f, -0.000301330496f, -0.000314884674f,
+    -0.000328422408f, -0.000341943145f, -0.000355446391f, -0.000368931651f, -0.00038239843f, -0.000395846204f, -0.000409274508f, -0.000422682817f,
+    -0.000436070608f, -0.000449437444f, -0.000462782773f, -0.000476106128f, -0.000489407044f, -0.000502684969f, -0.000515939377f, -0.00052916992f,
+    -0.000542375958f, -0.000555557082f, -0.00056871277f, -0.000581842614f, -0.000594945974f, -0.000608022499f, -0.000621071667f, -0.000634093012f,
+    -0.00064708601f, -0.000660050195f, -0.000672985043f, -0.000685890205f, -0.0006987651f, -0.00071160926f, -0.00072442228f, -0.000737203634f,
+    -0.0007499528f, -0.000762669428f, -0.000775352935f, -0.000788002973f, -0.00080061896f, -0.000813200488f, -0.000825747091f, -0.000838258304f,
+    -0.000850733661f, -0.000863172754f, -0.000875575002f, -0.000887940114f, -0.000900267507f, -0.000912556832f, -0.000924807508f, -0.000937019242f,
+    -0.000949191453f, -0.000961323793f, -0.000973415736f, -0.000985466875f, -0.000997476745f, -0.00100944506f, -0.00102137111f, -0.00103325478f,
+    -0.00104509527f, -0.00105689245f, -0.00106864586f, -0.00108035491f, -0.00109201926f, -0.00110363844f, -0.00111521222f, -0.00112673989f,
+    -0.00113822124f, -0.00114965579f, -0.00116104307f, -0.00117238273f, -0.00118367444f, -0.0011949176f, -0.00120611186f, -0.001217257f,
+    -0.00122835243f, -0.00123939768f, -0.00125039252f, -0.00126133661f, -0.00127222936f, -0.00128307042f, -0.00129385944f, -0.00130459608f,
+    -0.00131527986f, -0.00132591045f, -0.00133648748f, -0.00134701049f, -0.00135747914f, -0.00136789319f, -0.00137825205f, -0.00138855539f,
+    -0.00139880297f, -0.00140899431f, -0.00141912908f, -0.00142920704f, -0.00143922761f, -0.00144919055f, -0.00145909539f, -0.00146894203f,
+    -0.00147872989f, -0.0014884586f, -0.00149812805f, -0.00150773767f, -0.00151728722f, -0.00152677635f, -0.00153620471f, -0.00154557195f,
+    -0.00155487773f, -0.00156412181f, -0.00157330371f, -0.00158242323f, -0.00159147999f, -0.00160047377f, -0.00160940411f, -0.00161827076f,
+    -0.00162707351f, -0.00163581187f, -0.00164448551f, -0.00165309431f, -0.00166163791f, -0.00167011598f, -0.00167852826f, -0.00168687431f,
+    -0.001695154f, -0.00170336699f, -0.00171151303f, -0.00171959179f, -0.00172760291f, -0.00173554628f, -0.00174342154f, -0.00175122835f,
+    -0.00175896659f, -0.0017666358f, -0.00177423598f, -0.00178176654f, -0.00178922748f, -0.00179661845f, -0.00180393923f, -0.00181118946f,
+    -0.00181836903f, -0.00182547758f, -0.001832515f, -0.00183948094f, -0.00184637518f, -0.00185319746f, -0.00185994757f, -0.00186662527f,
+    -0.00187323045f, -0.00187976274f, -0.00188622193f, -0.00189260789f, -0.0018989204f, -0.00190515909f, -0.00191132398f, -0.0019174146f,
+    -0.00192343106f, -0.0019293729f, -0.00193524f, -0.00194103213f, -0.00194674917f, -0.001952391f, -0.00195795717f, -0.00196344778f,
+    -0.00196886249f, -0.0019742013f, -0.00197946373f, -0.0019846498f, -0.00198975927f, -0.00199479214f, -0.00199974817f, -0.00200462691f,
+    -0.00200942857f, -0.00201415294f, -0.00201879977f, -0.00202336884f, -0.00202786038f, -0.00203227368f, -0.00203660899f, -0.00204086606f,
+    -0.00204504491f, -0.00204914529f, -0.00205316674f, -0.00205710973f, -0.00206097378f, -0.00206475891f, -0.00206846488f, -0.00207209168f,
+    -0.00207563909f, -0.0020791071f, -0.00208249572f, -0.00208580447f, -0.0020890336f, -0.0020921831f, -0.00209525251f, -0.00209824182f,
+    -0.00210115127f, -0.0021039804f, -0.00210672943f, -0.0021093979f, -0.00211198628f, -0.00211449387f, -0.00211692112f, -0.00211926783f,
+    -0.00212153373f, -0.00212371908f, -0.00212582364f, -0.00212784717f, -0.00212979014f, -0.00213165185f, -0.00213343278f, -0.00213513291f,
+    -0.00213675178f, -0.00213828962f, -0.00213974621f, -0.00214112201f, -0.00214241631f, -0.00214362983f, -0.00214476185f, -0.00214581285f,
+    -0.00214678259f, -0.00214767107f, -0.00214847829f, -0.00214920426f, -0.0021498492f, -0.00215041265f, -0.00215089507f, -0.00215129624f,
+    -0.00215161615f, -0.00215185503f, -0.00215201266f, -0.00215208903f, -0.00215208437f, -0.00215199869f, -0.00215183198f, -0.00215158402f,
+    -0.00215125526f, -0.00215084571f, -0.00215035491f, -0.00214978354f, -0.00214913115f, -0.0021483982f, -0.00214758446f, -0.00214669015f,
+    -0.00214571506f, -0.00214465964f, -0.00214352366f, -0.00214230735f, -0.00214101095f, -0.00213963399f, -0.00213817717f, -0.00213664002f,
+    -0.00213502301f, -0.00213332614f, -0.00213154941f, -0.00212969305f, -0.00212775706f, -0.00212574168f, -0.00212364667f, -0.0021214725f,
+    -0.00211921916f, -0.00211688667f, -0.00211447524f, -0.00211198488f, -0.00210941583f, -0.00210676831f, -0.00210404233f, -0.00210123789f,
+    -0.00209835521f, -0.00209539453f, -0.00209235586f, -0.00208923942f, -0.00208604545f, -0.00208277395f, -0.00207942491f, -0.00207599881f,
+    -0.00207249564f, -0.00206891564f, -0.0020652588f, -0.00206152559f, -0.00205771578f, -0.00205382984f, -0.002049868f, -0.00204583001f,
+    -0.00204171659f, -0.00203752751f, -0.00203326298f, -0.00202892348f, -0.00202450901f, -0.00202001957f, -0.00201545586f, -0.00201081764f,
+    -0.00200610515f, -0.00200131885f, -0.00199645874f, -0.00199152506f, -0.00198651804f, -0.0019814379f, -0.0019762849f, -0.00197105925f,
+    -0.00196576095f, -0.00196039048f, -0.00195494806f, -0.00194943382f, -0.00194384798f, -0.00193819089f, -0.00193246268f, -0.00192666356f,
+    -0.0019207939f, -0.00191485393f, -0.00190884387f, -0.00190276385f, -0.00189661433f, -0.00189039542f, -0.00188410736f, -0.00187775062f,
+    -0.00187132519f, -0.00186483155f, -0.0018582698f, -0.00185164029f, -0.00184494338f, -0.00183817919f, -0.00183134805f, -0.00182445033f,
+    -0.00181748613f, -0.00181045593f, -0.00180335995f, -0.00179619843f, -0.00178897171f, -0.00178168016f, -0.00177432387f, -0.00176690333f,
+    -0.00175941875f, -0.00175187038f, -0.00174425868f, -0.00173658389f, -0.00172884623f, -0.00172104617f, -0.00171318394f, -0.00170525978f,
+    -0.00169727427f, -0.00168922741f, -0.00168111967f, -0.0016729515f, -0.00166472304f, -0.00165643473f, -0.00164808682f, -0.00163967966f,
+    -0.0016312137f, -0.00162268907f, -0.00161410635f, -0.00160546578f, -0.00159676769f, -0.00158801232f, -0.00157920027f, -0.00157033163f,
+    -0.001561407f, -0.00155242649f, -0.00154339068f, -0.00153429981f, -0.00152515422f, -0.00151595438f, -0.00150670065f, -0.00149739324f,
+    -0.00148803263f, -0.00147861918f, -0.00146915321f, -0.00145963521f, -0.00145006552f, -0.0014404445f, -0.00143077248f, -0.00142104994f,
+    -0.0014112771f, -0.00140145456f, -0.00139158254f, -0.00138166151f, -0.00137169182f, -0.00136167393f, -0.0013516082f, -0.00134149496f,
+    -0.0013313347f, -0.00132112787f, -0.00131087459f, -0.00130057556f, -0.00129023113f, -0.00127984164f, -0.00126940745f, -0.00125892903f,
+    -0.00124840683f, -0.00123784121f, -0.00122723263f, -0.00121658144f, -0.00120588811f, -0.00119515299f, -0.00118437654f, -0.00117355923f,
+    -0.0011627014f, -0.00115180353f, -0.00114086596f, -0.00112988928f, -0.00111887383f, -0.00110781996f, -0.00109672814f, -0.00108559884f,
+    -0.00107443251f, -0.00106322963f, -0.00105199043f, -0.00104071549f, -0.00102940528f, -0.00101806014f, -0.00100668066f, -0.000995267066f,
+    -0.000983819948f, -0.000972339709f, -0.000960826816f, -0.000949281733f, -0.000937704812f, -0.000926096574f, -0.000914457487f, -0.000902787957f,
+    -0.000891088392f, -0.000879359315f, -0.000867601193f, -0.000855814433f, -0.0008439995f, -0.000832156802f, -0.000820286921f, -0.000808390148f,
+    -0.000796467066f, -0.000784518139f, -0.000772543717f, -0.000760544383f, -0.000748520484f, -0.000736472604f, -0.000724401092f, -0.000712306472f,
+    -0.000700189208f, -0.000688049709f, -0.000675888499f, -0.000663706043f, -0.000651502807f, -0.000639279198f, -0.000627035799f, -0.000614772958f,
+    -0.0006024912f, -0.00059019099f, -0.000577872794f, -0.000565537077f, -0.000553184305f, -0.000540815003f, -0.000528429577f, -0.000516028551f,
+    -0.000503612333f, -0.000491181505f, -0.000478736387f, -0.00046627759f, -0.000453805522f, -0.000441320648f, -0.000428823492f, -0.000416314491f,
+    -0.00040379414f, -0.000391262904f, -0.000378721277f, -0.000366169697f, -0.000353608659f, -0.000341038685f, -0.000328460184f, -0.000315873651f,
+    -0.000303279608f, -0.000290678465f, -0.000278070744f, -0.000265456911f, -0.000252837432f, -0.000240212816f, -0.000227583514f, -0.000214950007f,
+    -0.000202312774f, -0.000189672297f, -0.00017702904f, -0.000164383513f, -0.000151736152f, -0.000139087468f, -0.00012643791f, -0.000113787981f,
+    -0.000101138146f, -8.84888796e-05f, -7.58406532e-05f, -6.3193962e-05f, -5.05492644e-05f, -3.7907048e-05f, -2.52677783e-05f, -1.26319383e-05f,
+    -4.0342065e-17f, 1.26275609e-05f, 2.52502705e-05f, 3.78676559e-05f, 5.04792406e-05f, 6.30845534e-05f, 7.56831214e-05f, 8.82744716e-05f,
+    0.000100858124f, 0.000113433627f, 0.000126000494f, 0.000138558244f, 0.000151106433f, 0.000163644581f, 0.000176172209f, 0.000188688864f,
+    0.000201194052f, 0.000213687337f, 0.000226168238f, 0.00023863629f, 0.000251091027f, 0.000263531983f, 0.000275958708f, 0.000288370706f,
+    0.00030076754f, 0.000313148746f, 0.000325513858f, 0.00033786241f, 0.000350193965f, 0.000362508028f, 0.000374804164f, 0.000387081906f,
+    0.000399340817f, 0.000411580433f, 0.000423800288f, 0.000435999915f, 0.000448178907f, 0.000460336771f, 0.000472473097f, 0.000484587392f,
+    0.000496679218f, 0.00050874817f, 0.000520793721f, 0.000532815466f, 0.000544812996f, 0.000556785788f, 0.000568733492f, 0.000580655586f,
+    0.00059255166f, 0.000604421308f, 0.000616264064f, 0.000628079462f, 0.000639867096f, 0.000651626557f, 0.000663357379f, 0.000675059098f,
+    0.000686731364f, 0.000698373653f, 0.000709985616f, 0.000721566787f, 0.0007331167f, 0.000744635065f, 0.000756121299f, 0.000767575111f,
+    0.000778995978f, 0.00079038355f, 0.00080173742f, 0.000813057064f, 0.000824342191f, 0.000835592335f, 0.00084680703f, 0.000857985986f,
+    0.000869128737f, 0.000880234817f, 0.000891303876f, 0.000902335567f, 0.000913329364f, 0.000924284919f, 0.000935201882f, 0.000946079788f,
+    0.000956918288f, 0.000967716973f, 0.000978475437f, 0.000989193213f, 0.000999870128f, 0.0010105056f, 0.00102109928f, 0.00103165081f,
+    0.00104215974f, 0.00105262583f, 0.00106304861f, 0.00107342773f, 0.00108376273f, 0.00109405338f, 0.0011042991f, 0.00111449976f,
+    0.0011246549f, 0.00113476405f, 0.00114482699f, 0.00115484325f, 0.00116481248f, 0.00117473444f, 0.00118460867f, 0.00119443482f,
+    0.00120421255f, 0.00121394149f, 0.00122362131f, 0.00123325165f, 0.00124283216f, 0.0012523625f, 0.00126184232f, 0.00127127138f,
+    0.00128064922f, 0.00128997548f, 0.00129924994f, 0.00130847225f, 0.00131764205f, 0.001326759f, 0.00133582274f, 0.00134483306f,
+    0.00135378947f, 0.00136269187f, 0.00137153978f, 0.00138033286f, 0.00138907088f, 0.0013977536f, 0.00140638067f, 0.00141495164f,
+    0.00142346637f, 0.00143192441f, 0.00144032564f, 0.0014486697f, 0.00145695615f, 0.00146518496f, 0.00147335557f, 0.00148146786f,
+    0.00148952159f, 0.00149751629f, 0.00150545174f, 0.00151332782f, 0.00152114406f, 0.00152890035f, 0.00153659622f, 0.00154423155f,
+    0.00155180611f, 0.00155931944f, 0.00156677142f, 0.00157416181f, 0.00158149027f, 0.00158875668f, 0.00159596058f, 0.00160310196f,
+    0.00161018036f, 0.00161719567f, 0.00162414752f, 0.00163103582f, 0.0016378602f, 0.00164462056f, 0.00165131653f, 0.00165794801f,
+    0.00166451465f, 0.00167101633f, 0.00167745282f, 0.00168382376f, 0.00169012905f, 0.00169636845f, 0.00170254183f, 0.00170864887f,
+    0.00171468942f, 0.00172066316f, 0.00172657007f, 0.00173240993f, 0.00173818239f, 0.00174388732f, 0.0017495245f, 0.00175509392f,
+    0.00176059525f, 0.00176602823f, 0.00177139288f, 0.00177668885f, 0.00178191601f, 0.00178707426f, 0.00179216336f, 0.00179718318f,
+    0.00180213351f, 0.00180701411f, 0.00181182509f, 0.00181656599f, 0.00182123692f, 0.00182583742f, 0.0018303676f, 0.00183482736f,
+    0.00183921622f, 0.00184353441f, 0.00184778147f, 0.00185195752f, 0.00185606233f, 0.00186009577f, 0.00186405773f, 0.0018679481f,
+    0.00187176664f, 0.00187551335f, 0.00187918812f, 0.00188279082f, 0.00188632123f, 0.00188977935f, 0.00189316506f, 0.00189647835f,
+    0.00189971889f, 0.00190288678f, 0.00190598192f, 0.00190900406f, 0.00191195321f, 0.00191482936f, 0.0019176323f, 0.00192036212f,
+    0.00192301848f, 0.00192560151f, 0.00192811107f, 0.00193054718f, 0.0019329096f, 0.00193519844f, 0.00193741347f, 0.00193955482f,
+    0.00194162223f, 0.00194361585f, 0.00194553554f, 0.00194738118f, 0.00194915291f, 0.00195085048f, 0.00195247401f, 0.00195402326f,
+    0.00195549848f, 0.00195689965f, 0.00195822632f, 0.00195947895f, 0.00196065707f, 0.00196176115f, 0.00196279073f, 0.00196374604f,
+    0.00196462707f, 0.00196543382f, 0.00196616608f, 0.00196682406f, 0.00196740776f, 0.00196791696f, 0.00196835212f, 0.00196871278f,
+    0.00196899916f, 0.00196921127f, 0.00196934887f, 0.00196941243f, 0.00196940196f, 0.00196931697f, 0.00196915795f, 0.00196892465f,
+    0.00196861732f, 0.00196823594f, 0.00196778052f, 0.0019672513f, 0.0019666478f, 0.00196597073f, 0.00196521962f, 0.0019643947f,
+    0.00196349621f, 0.00196252391f, 0.00196147803f, 0.00196035858f, 0.00195916579f, 0.00195789943f, 0.00195655995f, 0.00195514713f,
+    0.00195366098f, 0.00195210194f, 0.0019504698f, 0.00194876466f, 0.00194698677f, 0.00194513611f, 0.00194321293f, 0.00194121711f,
+    0.00193914876f, 0.00193700811f, 0.00193479529f, 0.00193251029f, 0.00193015335f, 0.00192772446f, 0.00192522374f, 0.00192265143f,
+    0.00192000752f, 0.00191729225f, 0.00191450561f, 0.00191164785f, 0.00190871896f, 0.00190571928f, 0.00190264883f, 0.00189950783f,
+    0.00189629628f, 0.00189301441f, 0.00188966235f, 0.00188624021f, 0.00188274833f, 0.0018791866f, 0.00187555538f, 0.00187185477f,
+    0.00186808489f, 0.00186424598f, 0.00186033815f, 0.00185636163f, 0.00185231643f, 0.00184820301f, 0.00184402126f, 0.00183977163f,
+    0.00183545402f, 0.00183106889f, 0.00182661624f, 0.0018220963f, 0.0018175093f, 0.00181285548f, 0.00180813496f, 0.00180334796f,
+    0.00179849472f, 0.00179357536f, 0.0017885901f, 0.00178353931f, 0.00177842297f, 0.00177324144f, 0.00176799495f, 0.00176268374f,
+    0.00175730791f, 0.00175186771f, 0.00174636347f, 0.00174079533f, 0.0017351635f, 0.00172946835f, 0.00172370998f, 0.00171788875f,
+    0.00171200477f, 0.00170605839f, 0.00170004973f, 0.00169397914f, 0.00168784696f, 0.0016816532f, 0.00167539832f, 0.00166908244f,
+    0.00166270591f, 0.00165626907f, 0.00164977193f, 0.00164321496f, 0.00163659849f, 0.00162992254f, 0.00162318756f, 0.0016163938f,
+    0.00160954148f, 0.00160263095f, 0.00159566244f, 0.00158863619f, 0.00158155267f, 0.00157441199f, 0.00156721438f, 0.00155996042f,
+    0.00155265012f, 0.00154528394f, 0.00153786212f, 0.00153038488f, 0.00152285269f, 0.00151526579f, 0.0015076244f, 0.00149992888f,
+    0.00149217946f, 0.00148437673f, 0.00147652067f, 0.00146861176f, 0.00146065035f, 0.00145263656f, 0.00144457095f, 0.00143645378f,
+    0.00142828526f, 0.00142006588f, 0.00141179573f, 0.00140347541f, 0.00139510515f, 0.00138668518f, 0.00137821597f, 0.00136969774f,
+    0.00136113097f, 0.00135251589f, 0.00134385284f, 0.0013351423f, 0.00132638437f, 0.00131757965f, 0.00130872836f, 0.00129983085f,
+    0.00129088748f, 0.0012818987f, 0.00127286464f, 0.00126378587f, 0.00125466264f, 0.0012454954f, 0.00123628438f, 0.00122703006f,
+    0.00121773279f, 0.00120839279f, 0.00119901064f, 0.00118958659f, 0.00118012109f, 0.00117061439f, 0.00116106682f, 0.00115147897f,
+    0.00114185119f, 0.00113218359f, 0.00112247688f, 0.00111273117f, 0.00110294705f, 0.00109312474f, 0.00108326471f, 0.00107336743f,
+    0.00106343313f, 0.00105346215f, 0.00104345509f, 0.00103341229f, 0.00102333399f, 0.00101322064f, 0.00100307271f, 0.000992890564f,
+    0.000982674654f, 0.000972425216f, 0.000962142833f, 0.000951827737f, 0.000941480452f, 0.000931101327f, 0.000920690713f, 0.000910249131f,
+    0.000899776933f, 0.000889274466f, 0.000878742256f, 0.000868180592f, 0.000857589941f, 0.00084697071f, 0.000836323306f, 0.000825648138f,
+    0.000814945612f, 0.000804216194f, 0.000793460174f, 0.000782678078f, 0.000771870313f, 0.000761037227f, 0.000750179344f, 0.000739296956f,
+    0.000728390529f, 0.000717460585f, 0.000706507359f, 0.000695531431f, 0.000684533152f, 0.000673512928f, 0.000662471226f, 0.000651408453f,
+    0.000640325074f, 0.00062922138f, 0.000618097954f, 0.000606955145f, 0.000595793419f, 0.000584613124f, 0.000573414785f, 0.000562198751f,
+    0.000550965487f, 0.00053971546f, 0.000528449018f, 0.000517166685f, 0.000505868811f, 0.000494555861f, 0.000483228243f, 0.000471886422f,
+    0.000460530835f, 0.000449161889f, 0.000437780021f, 0.000426385668f, 0.000414979266f, 0.00040356128f, 0.000392132089f, 0.00038069213f,
+    0.000369241898f, 0.00035778177f, 0.000346312212f, 0.000334833632f, 0.000323346525f, 0.00031185124f, 0.000300348271f, 0.000288838055f,
+    0.000277321f, 0.000265797571f, 0.000254268205f, 0.000242733295f, 0.00023119332f, 0.000219648704f, 0.000208099882f, 0.000196547306f,
+    0.000184991382f, 0.000173432578f, 0.000161871314f, 0.000150308028f, 0.000138743169f, 0.000127177147f, 0.000115610426f, 0.000104043429f,
+    9.24765918e-05f, 8.09103512e-05f, 6.93451439e-05f, 5.77814099e-05f, 4.62195785e-05f, 3.466009e-05f, 2.31033719e-05f, 1.15498642e-05f,
+    3.68535557e-18f, -1.1545786e-05f, -2.3087061e-05f, -3.46233901e-05f, -4.61543423e-05f, -5.76794846e-05f, -6.91983805e-05f, -8.07106044e-05f,
+    -9.22157269e-05f, -0.000103713304f, -0.000115202914f, -0.000126684128f, -0.000138156509f, -0.000149619635f, -0.000161073069f, -0.000172516404f,
+    -0.000183949174f, -0.000195370987f, -0.000206781406f, -0.000218179994f, -0.000229566343f, -0.000240940019f, -0.000252300582f, -0.000263647642f,
+    -0.000274980761f, -0.000286299502f, -0.000297603459f, -0.000308892195f, -0.000320165302f, -0.000331422372f, -0.000342662999f, -0.000353886717f,
+    -0.000365093118f, -0.000376281823f, -0.000387452397f, -0.000398604403f, -0.000409737462f, -0.000420851167f, -0.000431945053f, -0.00044301874f,
+    -0.000454071851f, -0.00046510392f, -0.000476114568f, -0.00048710336f, -0.000498069974f, -0.000509013887f, -0.000519934751f, -0.000530832156f,
+    -0.000541705755f, -0.000552555081f, -0.000563379726f, -0.000574179285f, -0.000584953465f, -0.000595701742f, -0.000606423768f, -0.000617119193f,
+    -0.000627787551f, -0.000638428493f, -0.000649041613f, -0.000659626501f, -0.00067018281f, -0.000680710131f, -0.000691208057f, -0.000701676239f,
+    -0.00071211427f, -0.000722521741f, -0.000732898363f, -0.000743243669f, -0.00075355731f, -0.000763838936f, -0.000774088083f, -0.000784304517f,
+    -0.000794487714f, -0.000804637384f, -0.000814753119f, -0.000824834628f, -0.000834881444f, -0.000844893279f, -0.000854869722f, -0.000864810427f,
+    -0.000874714984f, -0.000884583103f, -0.000894414436f, -0.000904208515f, -0.000913965108f, -0.00092368375f, -0.000933364208f, -0.000943006016f,
+    -0.000952608942f, -0.000962172518f, -0.000971696456f, -0.000981180463f, -0.000990624074f, -0.00100002706f, -0.00100938894f, -0.0010187095f,
+    -0.0010279885f, -0.00103722536f, -0.00104641984f, -0.00105557172f, -0.00106468052f, -0.00107374601f, -0.00108276785f, -0.00109174568f,
+    -0.00110067916f, -0.00110956794f, -0.00111841189f, -0.00112721045f, -0.00113596348f, -0.00114467065f, -0.0011533316f, -0.00116194587f,
+    -0.00117051345f, -0.00117903389f, -0.00118750683f, -0.00119593204f, -0.00120430917f, -0.00121263799f, -0.00122091814f, -0.00122914929f,
+    -0.00123733131f, -0.00124546373f, -0.00125354633f, -0.00126157887f, -0.00126956112f, -0.00127749261f, -0.00128537312f, -0.0012932024f,
+    -0.00130098022f, -0.00130870624f, -0.00131638022f, -0.00132400182f, -0.00133157091f, -0.00133908715f, -0.00134655018f, -0.0013539599f,
+    -0.00136131584f, -0.00136861799f, -0.00137586601f, -0.00138305954f, -0.00139019848f, -0.00139728247f, -0.00140431128f, -0.00141128467f,
+    -0.00141820242f, -0.00142506417f, -0.00143186992f, -0.00143861934f, -0.00144531205f, -0.00145194796f, -0.00145852682f, -0.00146504829f,
+    -0.00147151237f, -0.0014779187f, -0.00148426695f, -0.0014905571f, -0.00149678893f, -0.00150296197f, -0.00150907633f, -0.00151513156f,
+    -0.00152112765f, -0.00152706425f, -0.00153294113f, -0.00153875828f, -0.00154451537f, -0.00155021215f, -0.00155584852f, -0.00156142423f,
+    -0.00156693917f, -0.00157239311f, -0.00157778582f, -0.00158311718f, -0.00158838695f, -0.00159359514f, -0.00159874128f, -0.00160382537f,
+    -0.00160884729f, -0.00161380682f, -0.00161870371f, -0.00162353786f, -0.00162830914f, -0.00163301744f, -0.00163766241f, -0.00164224405f,
+    -0.00164676225f, -0.00165121676f, -0.00165560748f, -0.00165993418f, -0.00166419684f, -0.00166839536f, -0.00167252938f, -0.00167659903f,
+    -0.00168060395f, -0.00168454414f, -0.00168841949f, -0.00169222988f, -0.00169597508f, -0.00169965508f, -0.00170326978f, -0.00170681893f,
+    -0.00171030255f, -0.0017137205f, -0.00171707256f, -0.00172035885f, -0.00172357901f, -0.00172673317f, -0.0017298212f, -0.00173284288f,
+    -0.0017357982f, -0.00173868705f, -0.0017415093f, -0.00174426497f, -0.00174695405f, -0.00174957619f, -0.0017521315f, -0.00175462f,
+    -0.00175704132f, -0.0017593957f, -0.00176168291f, -0.00176390295f, -0.00176605571f, -0.00176814117f, -0.00177015923f, -0.00177210988f,
+    -0.00177399302f, -0.00177580875f, -0.00177755684f, -0.00177923741f, -0.00178085023f, -0.00178239541f, -0.00178387295f, -0.00178528263f,
+    -0.00178662466f, -0.00178789883f, -0.00178910512f, -0.00179024367f, -0.00179131422f, -0.00179231702f, -0.00179325184f, -0.0017941189f,
+    -0.00179491786f, -0.00179564906f, -0.00179631228f, -0.00179690751f, -0.00179743487f, -0.00179789437f, -0.00179828587f, -0.0017986095f,
+    -0.00179886527f, -0.00179905316f, -0.00179917319f, -0.00179922534f, -0.00179920974f, -0.00179912627f, -0.00179897505f, -0.00179875619f,
+    -0.00179846957f, -0.00179811532f, -0.00179769332f, -0.00179720391f, -0.00179664686f, -0.00179602229f, -0.00179533032f, -0.00179457082f,
+    -0.00179374416f, -0.00179285009f, -0.00179188873f, -0.00179086032f, -0.00178976473f, -0.00178860209f, -0.00178737252f, -0.001786076f,
+    -0.00178471266f, -0.0017832825f, -0.00178178574f, -0.00178022229f, -0.00177859236f, -0.00177689595f, -0.00177513319f, -0.00177330431f,
+    -0.00177140906f, -0.00176944793f, -0.00176742068f, -0.00176532764f, -0.00176316872f, -0.00176094426f, -0.00175865414f, -0.00175629871f,
+    -0.00175387773f, -0.00175139168f, -0.00174884056f, -0.00174622436f, -0.00174354331f, -0.00174079754f, -0.00173798704f, -0.00173511216f,
+    -0.00173217291f, -0.00172916951f, -0.00172610197f, -0.0017229704f, -0.00171977514f, -0.0017165161f, -0.00171319372f, -0.00170980778f,
+    -0.00170635874f, -0.00170284661f, -0.00169927161f, -0.00169563375f, -0.00169193337f, -0.00168817048f, -0.00168434542f, -0.0016804582f,
+    -0.00167650904f, -0.00167249818f, -0.00166842574f, -0.00166429183f, -0.00166009669f, -0.00165584043f, -0.0016515234f, -0.00164714572f,
+    -0.00164270739f, -0.00163820887f, -0.00163365016f, -0.0016290315f, -0.00162435311f, -0.00161961524f, -0.001614818f, -0.00160996174f,
+    -0.00160504633f, -0.00160007237f, -0.00159503985f, -0.00158994901f, -0.00158480008f, -0.00157959328f, -0.00157432875f, -0.00156900694f,
+    -0.00156362774f, -0.00155819161f, -0.00155269878f, -0.00154714927f, -0.00154154352f, -0.00153588166f, -0.00153016404f, -0.00152439065f,
+    -0.00151856197f, -0.00151267822f, -0.00150673953f, -0.00150074612f, -0.00149469834f, -0.00148859643f, -0.00148244051f, -0.00147623103f,
+    -0.00146996812f, -0.00146365212f, -0.00145728316f, -0.00145086157f, -0.0014443876f, -0.00143786147f, -0.00143128354f, -0.00142465404f,
+    -0.00141797331f, -0.00141124136f, -0.00140445877f, -0.00139762566f, -0.00139074237f, -0.00138380902f, -0.00137682608f, -0.00136979378f,
+    -0.00136271236f, -0.00135558215f, -0.00134840328f, -0.00134117634f, -0.00133390131f, -0.00132657879f, -0.00131920876f, -0.00131179171f,
+    -0.00130432786f, -0.00129681756f, -0.00128926104f, -0.00128165865f, -0.00127401075f, -0.00126631744f, -0.00125857932f, -0.00125079649f,
+    -0.0012429693f, -0.00123509811f, -0.00122718315f, -0.00121922477f, -0.00121122343f, -0.00120317913f, -0.00119509245f, -0.00118696375f,
+    -0.00117879303f, -0.00117058097f, -0.00116232771f, -0.00115403358f, -0.00114569895f, -0.00113732403f, -0.00112890941f, -0.00112045521f,
+    -0.00111196178f, -0.00110342947f, -0.00109485874f, -0.00108624971f, -0.00107760297f, -0.00106891862f, -0.00106019713f, -0.00105143886f,
+    -0.00104264403f, -0.00103381311f, -0.00102494634f, -0.00101604417f, -0.00100710685f, -0.000998134841f, -0.000989128486f, -0.000980088022f,
+    -0.000971013855f, -0.000961906393f, -0.000952765928f, -0.000943592808f, -0.000934387441f, -0.000925150176f, -0.000915881363f, -0.00090658135f,
+    -0.000897250487f, -0.000887889182f, -0.000878497784f, -0.000869076641f, -0.000859626161f, -0.000850146636f, -0.000840638473f, -0.000831102079f,
+    -0.000821537746f, -0.00081194588f, -0.000802326889f, -0.000792681123f, -0.000783008931f, -0.000773310661f, -0.000763586781f, -0.000753837579f,
+    -0.000744063524f, -0.000734264904f, -0.000724442129f, -0.000714595546f, -0.000704725622f, -0.000694832648f, -0.00068491709f, -0.000674979237f,
+    -0.000665019499f, -0.00065503834f, -0.000645035994f, -0.000635012984f, -0.00062496966f, -0.00061490637f, -0.000604823465f, -0.000594721467f,
+    -0.000584600668f, -0.000574461417f, -0.000564304239f, -0.000554129365f, -0.00054393732f, -0.000533728395f, -0.000523503055f, -0.00051326165f,
+    -0.000503004587f, -0.000492732215f, -0.000482445001f, -0.000472143263f, -0.000461827469f, -0.000451497966f, -0.000441155164f, -0.000430799439f,
+    -0.000420431199f, -0.000410050852f, -0.000399658777f, -0.00038925535f, -0.00037884101f, -0.000368416135f, -0.000357981131f, -0.000347536377f,
+    -0.000337082281f, -0.000326619222f, -0.000316147634f, -0.000305667898f, -0.000295180391f, -0.00028468552f, -0.000274183694f, -0.00026367532f,
+    -0.000253160804f, -0.000242640497f, -0.000232114835f, -0.000221584211f, -0.000211049017f, -0.000200509647f, -0.000189966522f, -0.000179420022f,
+    -0.000168870552f, -0.000158318508f, -0.00014776428f, -0.000137208292f, -0.000126650921f, -0.000116092575f, -0.000105533647f, -9.49745372e-05f,
+    -8.44156457e-05f, -7.38573654e-05f, -6.33000964e-05f, -5.27442426e-05f, -4.21901896e-05f, -3.16383448e-05f, -2.10890994e-05f, -1.05428526e-05f,
+    -2.1884241e-17f, 1.05390627e-05f, 2.10739381e-05f, 3.16042315e-05f, 4.21295481e-05f, 5.2649495e-05f, 6.31636722e-05f, 7.36716902e-05f,
+    8.41731526e-05f, 9.46676664e-05f, 0.000105154839f, 0.000115634277f, 0.000126105588f, 0.000136568386f, 0.000147022263f, 0.000157466842f,
+    0.000167901744f, 0.000178326562f, 0.000188740902f, 0.000199144386f, 0.000209536622f, 0.000219917216f, 0.000230285805f, 0.000240641981f,
+    0.000250985351f, 0.000261315552f, 0.000271632191f, 0.000281934888f, 0.000292223238f, 0.00030249689f, 0.000312755437f, 0.000322998501f,
+    0.000333225704f, 0.000343436695f, 0.00035363104f, 0.000363808416f, 0.000373968389f, 0.000384110637f, 0.000394234754f, 0.000404340361f,
+    0.000414427108f, 0.000424494618f, 0.000434542482f, 0.000444570382f, 0.000454577879f, 0.000464564684f, 0.000474530359f, 0.000484474585f,
+    0.000494396954f, 0.000504297146f, 0.000514174753f, 0.000524029427f, 0.000533860817f, 0.000543668517f, 0.000553452235f, 0.000563211564f,
+    0.000572946155f, 0.000582655659f, 0.000592339667f, 0.00060199789f, 0.000611629977f, 0.000621235522f, 0.000630814233f, 0.000640365644f,
+    0.000649889524f, 0.000659385521f, 0.00066885323f, 0.000678292301f, 0.000687702443f, 0.000697083247f, 0.000706434425f, 0.000715755566f,
+    0.00072504644f, 0.000734306639f, 0.000743535813f, 0.000752733613f, 0.000761899748f, 0.000771033927f, 0.000780135684f, 0.000789204787f,
+    0.000798240944f, 0.00080724369f, 0.000816212792f, 0.000825147901f, 0.000834048726f, 0.000842914858f, 0.000851746066f, 0.000860542001f,
+    0.000869302312f, 0.000878026709f, 0.000886714901f, 0.000895366538f, 0.00090398133f, 0.000912558928f, 0.000921099039f, 0.000929601374f,
+    0.000938065583f, 0.000946491433f, 0.000954878575f, 0.000963226717f, 0.000971535512f, 0.000979804667f, 0.000988034066f, 0.000996223185f,
+    0.00100437179f, 0.00101247954f, 0.0010205463f, 0.00102857174f, 0.00103655539f, 0.00104449724f, 0.00105239684f, 0.00106025382f,
+    0.00106806809f, 0.00107583927f, 0.00108356716f, 0.00109125138f, 0.00109889172f, 0.00110648794f, 0.00111403968f, 0.00112154672f,
+    0.00112900883f, 0.00113642565f, 0.00114379695f, 0.0011511225f, 0.00115840207f, 0.00116563542f, 0.00117282209f, 0.00117996207f,
+    0.00118705491f, 0.00119410059f, 0.00120109867f, 0.0012080489f, 0.00121495116f, 0.00122180523f, 0.00122861064f, 0.00123536738f,
+    0.00124207512f, 0.00124873361f, 0.00125534262f, 0.00126190193f, 0.0012684114f, 0.00127487071f, 0.0012812796f, 0.00128763786f,
+    0.00129394536f, 0.00130020187f, 0.00130640704f, 0.00131256075f, 0.00131866278f, 0.001324713f, 0.00133071106f, 0.00133665674f,
+    0.00134255004f, 0.00134839048f, 0.00135417806f, 0.00135991257f, 0.00136559375f, 0.00137122138f, 0.00137679523f, 0.0013823153f,
+    0.00138778123f, 0.00139319291f, 0.00139855023f, 0.00140385283f, 0.0014091006f, 0.00141429342f, 0.00141943095f, 0.00142451329f,
+    0.00142953999f, 0.00143451104f, 0.00143942633f, 0.0014442855f, 0.00144908857f, 0.00145383517f, 0.00145852542f, 0.00146315887f,
+    0.00146773562f, 0.00147225533f, 0.001476718f, 0.00148112339f, 0.00148547138f, 0.00148976175f, 0.0014939945f, 0.0014981695f,
+    0.00150228641f, 0.00150634523f, 0.00151034584f, 0.00151428813f, 0.00151817198f, 0.00152199704f, 0.00152576354f, 0.00152947113f,
+    0.00153311971f, 0.00153670914f, 0.00154023943f, 0.00154371047f, 0.00154712202f, 0.00155047409f, 0.00155376643f, 0.00155699905f,
+    0.00156017195f, 0.00156328478f, 0.00156633765f, 0.00156933034f, 0.00157226285f, 0.00157513493f, 0.00157794682f, 0.00158069807f,
+    0.00158338877f, 0.00158601895f, 0.00158858835f, 0.00159109698f, 0.00159354473f, 0.00159593148f, 0.00159825734f, 0.00160052208f,
+    0.00160272571f, 0.0016048681f, 0.00160694926f, 0.00160896906f, 0.00161092763f, 0.00161282474f, 0.00161466037f, 0.00161643443f,
+    0.00161814701f, 0.00161979801f, 0.00162138732f, 0.00162291504f, 0.00162438094f, 0.00162578514f, 0.00162712764f, 0.00162840821f,
+    0.00162962708f, 0.00163078401f, 0.00163187913f, 0.00163291232f, 0.00163388369f, 0.00163479312f, 0.00163564051f, 0.00163642608f,
+    0.0016371496f, 0.00163781119f, 0.00163841085f, 0.00163894857f, 0.00163942436f, 0.00163983821f, 0.00164019002f, 0.0016404799f,
+    0.00164070795f, 0.00164087408f, 0.00164097827f, 0.00164102064f, 0.00164100109f, 0.00164091971f, 0.00164077664f, 0.00164057175f,
+    0.00164030504f, 0.00163997663f, 0.00163958664f, 0.00163913495f, 0.00163862156f, 0.0016380467f, 0.00163741037f, 0.00163671258f,
+    0.00163595332f, 0.00163513259f, 0.00163425063f, 0.00163330743f, 0.00163230312f, 0.00163123745f, 0.0016301109f, 0.00162892323f,
+    0.00162767456f, 0.00162636512f, 0.00162499479f, 0.00162356382f, 0.00162207207f, 0.00162051979f, 0.00161890709f, 0.00161723385f,
+    0.00161550031f, 0.00161370658f, 0.00161185267f, 0.00160993868f, 0.00160796475f, 0.00160593085f, 0.00160383724f, 0.00160168402f,
+    0.00159947108f, 0.00159719877f, 0.00159486709f, 0.00159247615f, 0.00159002608f, 0.00158751698f, 0.00158494897f, 0.00158232218f,
+    0.00157963671f, 0.0015768928f, 0.00157409033f, 0.00157122954f, 0.00156831066f, 0.00156533369f, 0.00156229886f, 0.00155920628f,
+    0.00155605609f, 0.00155284826f, 0.00154958328f, 0.0015462609f, 0.0015428816f, 0.00153944537f, 0.00153595232f, 0.0015324027f,
+    0.00152879662f, 0.00152513431f, 0.00152141578f, 0.00151764124f, 0.00151381094f, 0.001509925f, 0.00150598353f, 0.00150198676f,
+    0.00149793492f, 0.00149382802f, 0.00148966641f, 0.00148545008f, 0.00148117938f, 0.00147685432f, 0.00147247524f, 0.00146804238f,
+    0.00146355561f, 0.00145901542f, 0.0014544219f, 0.0014497753f, 0.00144507573f, 0.00144032342f, 0.0014355185f, 0.0014306613f,
+    0.00142575183f, 0.00142079056f, 0.00141577749f, 0.00141071295f, 0.00140559708f, 0.0014004301f, 0.00139521225f, 0.00138994365f,
+    0.00138462463f, 0.00137925544f, 0.00137383607f, 0.001368367f, 0.00136284844f, 0.00135728042f, 0.00135166326f, 0.00134599733f,
+    0.00134028262f, 0.00133451959f, 0.00132870825f, 0.00132284907f, 0.00131694216f, 0.00131098775f, 0.00130498607f, 0.00129893736f,
+    0.00129284197f, 0.00128670014f, 0.00128051196f, 0.00127427792f, 0.00126799801f, 0.00126167259f, 0.00125530199f, 0.00124888646f,
+    0.00124242611f, 0.00123592129f, 0.00122937234f, 0.00122277939f, 0.00121614279f, 0.00120946276f, 0.00120273966f, 0.0011959736f,
+    0.00118916493f, 0.00118231401f, 0.00117542094f, 0.0011684862f, 0.00116150989f, 0.00115449238f, 0.00114743388f, 0.00114033476f,
+    0.00113319512f, 0.00112601556f, 0.00111879606f, 0.0011115371f, 0.00110423891f, 0.00109690172f, 0.00108952587f, 0.00108211173f,
+    0.00107465941f, 0.00106716936f, 0.00105964183f, 0.00105207716f, 0.00104447559f, 0.00103683735f, 0.0010291629f, 0.00102145236f,
+    0.00101370632f, 0.00100592477f, 0.000998108182f, 0.000990256784f, 0.000982371042f, 0.000974451075f, 0.000966497289f, 0.000958509976f,
+    0.000950489484f, 0.000942436105f, 0.00093435013f, 0.000926231849f, 0.000918081671f, 0.000909899885f, 0.000901686784f, 0.000893442717f,
+    0.000885167974f, 0.000876862905f, 0.000868527801f, 0.000860163011f, 0.000851768884f, 0.000843345653f, 0.000834893784f, 0.00082641351f,
+    0.00081790518f, 0.000809369201f, 0.000800805748f, 0.000792215287f, 0.000783598109f, 0.000774954562f, 0.000766284938f, 0.000757589587f,
+    0.000748868857f, 0.000740123156f, 0.000731352717f, 0.000722557888f, 0.000713739078f, 0.000704896578f, 0.000696030736f, 0.000687141961f,
+    0.000678230484f, 0.000669296714f, 0.000660340942f, 0.000651363574f, 0.000642364961f, 0.000633345451f, 0.000624305336f, 0.000615244964f,
+    0.000606164802f, 0.000597065024f, 0.000587946095f, 0.000578808365f, 0.000569652126f, 0.000560477842f, 0.000551285688f, 0.000542076188f,
+    0.000532849575f, 0.000523606257f, 0.000514346641f, 0.000505070959f, 0.000495779677f, 0.000486473058f, 0.000477151538f, 0.000467815436f,
+    0.000458465132f, 0.000449100946f, 0.000439723255f, 0.000430332439f, 0.000420928816f, 0.000411512767f, 0.000402084668f, 0.00039264487f,
+    0.000383193692f, 0.000373731542f, 0.000364258769f, 0.000354775751f, 0.00034528281f, 0.000335780322f, 0.000326268666f, 0.000316748163f,
+    0.000307219219f, 0.000297682185f, 0.000288137438f, 0.000278585299f, 0.000269026146f, 0.000259460357f, 0.000249888282f, 0.000240310314f,
+    0.000230726771f, 0.000221138034f, 0.00021154448f, 0.000201946459f, 0.000192344334f, 0.000182738469f, 0.000173129229f, 0.00016351699f,
+    0.000153902089f, 0.000144284917f, 0.00013466581f, 0.000125045161f, 0.000115423303f, 0.000105800624f, 9.61774713e-05f, 8.6554217e-05f,
+    7.69312173e-05f, 6.73088434e-05f, 5.76874481e-05f, 4.80673989e-05f, 3.84490595e-05f, 2.88327865e-05f, 1.92189455e-05f, 9.60789566e-06f,
+    -7.67488034e-18f, -9.60438047e-06f, -1.92048865e-05f, -2.88011561e-05f, -3.83928309e-05f, -4.7979549e-05f, -5.75609483e-05f, -6.71366797e-05f,
+    -7.67063684e-05f, -8.62696761e-05f, -9.58262244e-05f, -0.000105375671f, -0.000114917646f, -0.000124451806f, -0.000133977781f, -0.000143495228f,
+    -0.00015300377f, -0.000162503085f, -0.000171992782f, -0.00018147254f, -0.000190941981f, -0.000200400769f, -0.000209848542f, -0.000219284935f,
+    -0.000228709629f, -0.000238122244f, -0.000247522432f, -0.000256909872f, -0.000266284187f, -0.000275645027f, -0.000284992042f, -0.000294324913f,
+    -0.000303643261f, -0.000312946795f, -0.000322235079f, -0.00033150785f, -0.000340764731f, -0.000350005372f, -0.000359229423f, -0.000368436595f,
+    -0.000377626478f, -0.000386798783f, -0.00039595316f, -0.00040508926f, -0.000414206734f, -0.00042330529f, -0.000432384521f, -0.000441444165f,
+    -0.000450483843f, -0.000459503237f, -0.000468501996f, -0.000477479829f, -0.000486436358f, -0.000495371292f, -0.000504284282f, -0.000513174979f,
+    -0.00052204309f, -0.000530888326f, -0.00053971028f, -0.000548508659f, -0.000557283114f, -0.000566033414f, -0.000574759149f, -0.000583460031f,
+    -0.000592135708f, -0.000600785948f, -0.000609410345f, -0.000618008606f, -0.00062658044f, -0.0006351255f, -0.000643643551f, -0.000652134186f,
+    -0.000660597114f, -0.000669032102f, -0.000677438744f, -0.000685816805f, -0.000694165938f, -0.000702485791f, -0.000710776192f, -0.000719036791f,
+    -0.000727267179f, -0.000735467242f, -0.000743636512f, -0.000751774758f, -0.000759881746f, -0.000767957128f, -0.000776000554f, -0.000784011791f,
+    -0.000791990606f, -0.000799936592f, -0.000807849574f, -0.000815729145f, -0.00082357513f, -0.00083138718f, -0.000839165063f, -0.000846908486f,
+    -0.000854617101f, -0.000862290733f, -0.000869928976f, -0.000877531711f, -0.000885098591f, -0.000892629323f, -0.000900123618f, -0.0009075813f,
+    -0.00091500202f, -0.000922385545f, -0.000929731585f, -0.000937039906f, -0.000944310217f, -0.000951542286f, -0.00095873588f, -0.000965890649f,
+    -0.000973006419f, -0.000980082899f, -0.000987119856f, -0.000994117116f, -0.00100107421f, -0.00100799114f, -0.00101486745f, -0.00102170301f,
+    -0.00102849759f, -0.00103525096f, -0.00104196277f, -0.0010486329f, -0.001055261f, -0.00106184697f, -0.00106839044f, -0.0010748913f,
+    -0.00108134933f, -0.00108776416f, -0.00109413557f, -0.00110046356f, -0.00110674766f, -0.00111298775f, -0.00111918361f, -0.00112533511f,
+    -0.00113144191f, -0.00113750377f, -0.00114352058f, -0.00114949211f, -0.00115541799f, -0.00116129837f, -0.00116713264f, -0.00117292092f,
+    -0.00117866276f, -0.00118435815f, -0.00119000685f, -0.00119560852f, -0.00120116316f, -0.00120667054f, -0.0012121303f, -0.00121754245f,
+    -0.00122290675f, -0.00122822297f, -0.00123349088f, -0.00123871048f, -0.00124388153f, -0.00124900369f, -0.00125407695f, -0.00125910109f,
+    -0.00126407587f, -0.00126900128f, -0.00127387699f, -0.00127870298f, -0.00128347892f, -0.0012882048f, -0.00129288039f, -0.00129750557f,
+    -0.00130208011f, -0.0013066039f, -0.0013110768f, -0.00131549861f, -0.00131986931f, -0.00132418866f, -0.00132845645f, -0.00133267266f,
+    -0.00133683707f, -0.00134094956f, -0.00134501013f, -0.00134901842f, -0.00135297433f, -0.00135687797f, -0.00136072887f, -0.00136452727f,
+    -0.0013682727f, -0.00137196528f, -0.00137560477f, -0.00137919106f, -0.00138272403f, -0.00138620369f, -0.00138962979f, -0.00139300223f,
+    -0.00139632099f, -0.00139958586f, -0.00140279683f, -0.00140595378f, -0.0014090566f, -0.00141210516f, -0.00141509937f, -0.00141803909f,
+    -0.00142092432f, -0.00142375496f, -0.001426531f, -0.00142925221f, -0.00143191847f, -0.0014345299f, -0.00143708626f, -0.00143958756f,
+    -0.00144203368f, -0.0014444245f, -0.00144676003f, -0.00144904025f, -0.00145126495f, -0.00145343423f, -0.00145554787f, -0.00145760598f,
+    -0.00145960832f, -0.0014615549f, -0.00146344572f, -0.00146528066f, -0.00146705983f, -0.0014687829f, -0.00147045008f, -0.00147206127f,
+    -0.00147361634f, -0.00147511531f, -0.00147655816f, -0.0014779449f, -0.00147927529f, -0.00148054957f, -0.00148176751f, -0.00148292922f,
+    -0.00148403458f, -0.0014850836f, -0.00148607639f, -0.00148701272f, -0.0014878927f, -0.00148871623f, -0.0014894834f, -0.00149019412f,
+    -0.00149084849f, -0.0014914464f, -0.00149198796f, -0.00149247295f, -0.00149290171f, -0.00149327388f, -0.00149358972f, -0.00149384921f,
+    -0.00149405224f, -0.00149419892f, -0.00149428926f, -0.00149432325f, -0.0014943009f, -0.0014942222f, -0.00149408728f, -0.00149389612f,
+    -0.00149364874f, -0.00149334513f, -0.00149298541f, -0.00149256957f, -0.00149209762f, -0.00149156956f, -0.00149098551f, -0.00149034557f,
+    -0.00148964964f, -0.00148889783f, -0.00148809026f, -0.00148722681f, -0.00148630771f, -0.00148533285f, -0.00148430245f, -0.00148321653f,
+    -0.00148207508f, -0.00148087821f, -0.00147962593f, -0.00147831847f, -0.00147695572f, -0.00147553778f, -0.00147406489f, -0.00147253682f,
+    -0.00147095392f, -0.00146931619f, -0.00146762363f, -0.00146587647f, -0.00146407471f, -0.00146221847f, -0.00146030774f, -0.00145834265f,
+    -0.00145632343f, -0.00145425007f, -0.00145212258f, -0.00144994131f, -0.00144770602f, -0.00144541718f, -0.00144307467f, -0.00144067861f,
+    -0.00143822911f, -0.00143572642f, -0.0014331704f, -0.00143056142f, -0.00142789958f, -0.00142518478f, -0.00142241735f, -0.00141959731f,
+    -0.00141672487f, -0.00141380006f, -0.00141082308f, -0.00140779396f, -0.00140471302f, -0.00140158017f, -0.00139839575f, -0.00139515975f,
+    -0.00139187241f, -0.00138853386f, -0.00138514419f, -0.00138170354f, -0.00137821212f, -0.00137467007f, -0.00137107761f, -0.00136743474f,
+    -0.0013637417f, -0.0013599986f, -0.00135620567f, -0.00135236292f, -0.0013484708f, -0.00134452921f, -0.00134053838f, -0.00133649865f,
+    -0.00133240991f, -0.00132827251f, -0.00132408668f, -0.00131985242f, -0.00131556997f, -0.00131123955f, -0.00130686141f, -0.00130243553f,
+    -0.00129796227f, -0.00129344163f, -0.00128887407f, -0.0012842596f, -0.00127959833f, -0.00127489073f, -0.00127013668f, -0.00126533664f,
+    -0.00126049062f, -0.00125559897f, -0.00125066179f, -0.00124567933f, -0.00124065171f, -0.00123557914f, -0.00123046199f, -0.00122530037f,
+    -0.00122009451f, -0.00121484452f, -0.00120955077f, -0.00120421336f, -0.00119883253f, -0.00119340851f, -0.00118794153f, -0.00118243182f,
+    -0.00117687962f, -0.00117128505f, -0.00116564846f, -0.00115997007f, -0.00115425f, -0.00114848861f, -0.00114268612f, -0.00113684265f,
+    -0.00113095844f, -0.00112503383f, -0.00111906906f, -0.00111306435f, -0.00110701984f, -0.00110093597f, -0.00109481276f, -0.00108865055f,
+    -0.00108244969f, -0.00107621029f, -0.00106993259f, -0.00106361695f, -0.00105726358f, -0.00105087273f, -0.00104444462f, -0.00103797961f,
+    -0.00103147782f, -0.00102493947f, -0.00101836503f, -0.00101175462f, -0.00100510858f, -0.000998427044f, -0.000991710462f, -0.000984958955f,
+    -0.000978172757f, -0.000971352274f, -0.00096449774f, -0.000957609387f, -0.000950687448f, -0.000943732273f, -0.000936744153f, -0.000929723319f,
+    -0.000922670006f, -0.000915584562f, -0.00090846722f, -0.00090131833f, -0.000894138066f, -0.000886926835f, -0.000879684812f, -0.000872412289f,
+    -0.000865109672f, -0.000857777079f, -0.000850414915f, -0.000843023474f, -0.000835602928f, -0.000828153687f, -0.000820676039f, -0.000813170162f,
+    -0.00080563646f, -0.000798075227f, -0.000790486636f, -0.000782871153f, -0.000775228953f, -0.000767560385f, -0.000759865739f, -0.000752145308f,
+    -0.000744399382f, -0.00073662831f, -0.000728832325f, -0.000721011776f, -0.000713166955f, -0.000705298153f, -0.000697405718f, -0.000689489942f,
+    -0.000681551115f, -0.000673589529f, -0.000665605534f, -0.000657599361f, -0.000649571419f, -0.000641521998f, -0.000633451389f, -0.000625359884f,
+    -0.000617247832f, -0.000609115465f, -0.000600963249f, -0.000592791359f, -0.000584600144f, -0.000576390012f, -0.000568161136f, -0.000559913926f,
+    -0.000551648671f, -0.000543365721f, -0.000535065366f, -0.000526747899f, -0.000518413668f, -0.000510063022f, -0.000501696253f, -0.000493313652f,
+    -0.000484915625f, -0.000476502406f, -0.000468074344f, -0.000459631789f, -0.00045117503f, -0.000442704448f, -0.000434220303f, -0.000425722916f,
+    -0.000417212694f, -0.00040868987f, -0.000400154822f, -0.000391607871f, -0.000383049308f, -0.00037447951f, -0.000365898799f, -0.000357307465f,
+    -0.000348705857f, -0.000340094295f, -0.000331473129f, -0.00032284265f, -0.000314203236f, -0.000305555179f, -0.000296898826f, -0.0002882345f,
+    -0.000279562519f, -0.000270883233f, -0.000262196962f, -0.000253504026f, -0.000244804774f, -0.000236099542f, -0.00022738862f, -0.000218672387f,
+    -0.000209951133f, -0.000201225223f, -0.000192494961f, -0.000183760698f, -0.000175022753f, -0.000166281447f, -0.000157537128f, -0.000148790132f,
+    -0.000140040764f, -0.000131289373f, -0.000122536294f, -0.000113781847f, -0.00010502636f, -9.62701743e-05f, -8.75136102e-05f, -7.87570098e-05f,
+    -7.00006858e-05f, -6.12449803e-05f, -5.2490228e-05f, -4.37367453e-05f, -3.49848706e-05f, -2.62349276e-05f, -1.74872494e-05f, -8.74216403e-06f,
+    -8.373618e-18f, 8.73891531e-06f, 1.74742527e-05f, 2.62056838e-05f, 3.49328802e-05f, 4.36555201e-05f, 5.2373267e-05f, 6.10858042e-05f,
+    6.97927971e-05f, 7.84939257e-05f, 8.71888551e-05f, 9.58772725e-05f, 0.000104558843f, 0.000113233247f, 0.000121900157f, 0.000130559245f,
+    0.000139210199f, 0.000147852697f, 0.000156486407f, 0.000165111007f, 0.000173726163f, 0.000182331583f, 0.000190926934f, 0.000199511895f,
+    0.00020808613f, 0.00021664935f, 0.000225201205f, 0.000233741404f, 0.000242269612f, 0.000250785524f, 0.00025928882f, 0.000267779164f,
+    0.000276256265f, 0.000284719834f, 0.000293169491f, 0.000301604945f, 0.000310025935f, 0.000318432081f, 0.000326823094f, 0.000335198682f,
+    0.000343558524f, 0.00035190233f, 0.000360229722f, 0.000368540466f, 0.000376834243f, 0.000385110703f, 0.000393369584f, 0.000401610596f,
+    0.000409833359f, 0.000418037642f, 0.000426223123f, 0.000434389483f, 0.000442536431f, 0.000450663705f, 0.000458770926f, 0.000466857862f,
+    0.000474924193f, 0.000482969626f, 0.000490993843f, 0.000498996582f, 0.000506977551f, 0.000514936459f, 0.000522872957f, 0.000530786812f,
+    0.000538677734f, 0.000546545431f, 0.000554389553f, 0.000562209927f, 0.000570006145f, 0.000577777973f, 0.00058552518f, 0.000593247416f,
+    0.000600944448f, 0.000608615926f, 0.000616261619f, 0.000623881235f, 0.000631474541f, 0.000639041187f, 0.000646580942f, 0.000654093572f,
+    0.00066157867f, 0.000669036119f, 0.000676465512f, 0.000683866732f, 0.000691239373f, 0.000698583201f, 0.000705897983f, 0.000713183428f,
+    0.000720439304f, 0.00072766532f, 0.000734861242f, 0.000742026779f, 0.0007491617f, 0.000756265712f, 0.000763338583f, 0.000770380022f,
+    0.000777389854f, 0.00078436773f, 0.000791313476f, 0.0007982268f, 0.000805107527f, 0.000811955309f, 0.000818769913f, 0.000825551164f,
+    0.000832298771f, 0.000839012442f, 0.000845692062f, 0.000852337282f, 0.000858947926f, 0.000865523762f, 0.000872064498f, 0.000878569961f,
+    0.000885039859f, 0.000891474017f, 0.000897872145f, 0.000904234068f, 0.000910559553f, 0.000916848367f, 0.000923100335f, 0.000929315109f,
+    0.000935492571f, 0.00094163249f, 0.000947734632f, 0.000953798764f, 0.000959824712f, 0.000965812244f, 0.000971761183f, 0.00097767124f,
+    0.000983542181f, 0.000989374006f, 0.000995166251f, 0.00100091891f, 0.00100663176f, 0.00101230445f, 0.00101793685f, 0.00102352886f,
+    0.00102908025f, 0.00103459065f, 0.00104006019f, 0.0010454884f, 0.00105087517f, 0.00105622027f, 0.00106152368f, 0.00106678507f,
+    0.00107200432f, 0.00107718119f, 0.00108231558f, 0.00108740723f, 0.00109245605f, 0.00109746179f, 0.00110242434f, 0.00110734347f,
+    0.00111221895f, 0.00111705076f, 0.00112183869f, 0.00112658262f, 0.0011312823f, 0.00113593752f, 0.00114054827f, 0.00114511419f,
+    0.00114963541f, 0.00115411158f, 0.00115854258f, 0.00116292818f, 0.00116726838f, 0.00117156305f, 0.00117581186f, 0.00118001481f,
+    0.00118417176f, 0.00118828251f, 0.00119234691f, 0.00119636499f, 0.00120033638f, 0.00120426109f, 0.00120813888f, 0.00121196976f,
+    0.00121575349f, 0.00121949008f, 0.00122317928f, 0.00122682098f, 0.00123041507f, 0.00123396155f, 0.00123746018f, 0.00124091085f,
+    0.00124431343f, 0.00124766782f, 0.00125097402f, 0.0012542319f, 0.00125744112f, 0.00126060192f, 0.00126371393f, 0.00126677728f,
+    0.00126979162f, 0.00127275707f, 0.00127567339f, 0.00127854059f, 0.00128135853f, 0.00128412712f, 0.00128684635f, 0.00128951599f,
+    0.00129213603f, 0.00129470648f, 0.00129722711f, 0.00129969791f, 0.00130211888f, 0.00130448979f, 0.00130681077f, 0.00130908156f,
+    0.00131130219f, 0.00131347252f, 0.00131559267f, 0.0013176623f, 0.00131968164f, 0.00132165046f, 0.00132356863f, 0.00132543629f,
+    0.0013272533f, 0.00132901967f, 0.00133073528f, 0.00133240002f, 0.001334014f, 0.00133557711f, 0.00133708934f, 0.00133855047f,
+    0.00133996073f, 0.00134131999f, 0.00134262815f, 0.0013438852f, 0.00134509115f, 0.00134624599f, 0.00134734972f, 0.00134840223f,
+    0.00134940352f, 0.00135035359f, 0.00135125231f, 0.00135209993f, 0.00135289622f, 0.00135364127f, 0.00135433499f, 0.00135497737f,
+    0.00135556853f, 0.00135610835f, 0.00135659694f, 0.00135703408f, 0.00135742f, 0.00135775469f, 0.00135803805f, 0.00135827006f,
+    0.00135845086f, 0.00135858043f, 0.00135865866f, 0.00135868578f, 0.00135866157f, 0.00135858625f, 0.00135845982f, 0.00135828217f,
+    0.00135805341f, 0.00135777355f, 0.00135744258f, 0.00135706062f, 0.00135662768f, 0.00135614385f, 0.00135560904f, 0.00135502336f,
+    0.0013543868f, 0.00135369948f, 0.00135296129f, 0.00135217258f, 0.00135133311f, 0.001350443f, 0.00134950236f, 0.00134851132f,
+    0.00134746975f, 0.00134637777f, 0.00134523551f, 0.00134404295f, 0.00134280021f, 0.0013415073f, 0.00134016445f, 0.00133877143f,
+    0.00133732858f, 0.0013358359f, 0.0013342934f, 0.00133270118f, 0.00133105938f, 0.00132936798f, 0.00132762722f, 0.00132583699f,
+    0.00132399751f, 0.00132210879f, 0.00132017094f, 0.00131818419f, 0.00131614844f, 0.00131406379f, 0.00131193048f, 0.00130974851f,
+    0.00130751799f, 0.00130523904f, 0.00130291178f, 0.00130053633f, 0.00129811279f, 0.00129564118f, 0.0012931216f, 0.0012905543f,
+    0.00128793938f, 0.00128527684f, 0.00128256693f, 0.00127980963f, 0.00127700518f, 0.00127415371f, 0.0012712552f, 0.00126830989f,
+    0.0012653179f, 0.00126227934f, 0.00125919445f, 0.00125606311f, 0.00125288579f, 0.00124966237f, 0.00124639296f, 0.00124307792f,
+    0.00123971736f, 0.00123631116f, 0.00123285979f, 0.00122936314f, 0.00122582156f, 0.00122223515f, 0.00121860392f, 0.00121492823f,
+    0.00121120817f, 0.00120744377f, 0.00120363524f, 0.00119978294f, 0.00119588675f, 0.00119194703f, 0.00118796376f, 0.0011839373f,
+    0.00117986777f, 0.00117575529f, 0.00117159996f, 0.00116740214f, 0.00116316183f, 0.00115887937f, 0.00115455477f, 0.00115018827f,
+    0.0011457802f, 0.00114133046f, 0.00113683951f, 0.00113230734f, 0.0011277342f, 0.00112312019f, 0.00111846568f, 0.00111377088f,
+    0.00110903569f, 0.00110426056f, 0.00109944562f, 0.00109459111f, 0.00108969712f, 0.00108476391f, 0.00107979157f, 0.00107478059f,
+    0.00106973085f, 0.0010646428f, 0.00105951645f, 0.00105435215f, 0.00104915001f, 0.00104391039f, 0.00103863329f, 0.00103331916f,
+    0.00102796801f, 0.00102258008f, 0.00101715571f, 0.00101169501f, 0.00100619835f, 0.00100066571f, 0.000995097449f, 0.000989493798f,
+    0.000983854989f, 0.000978181255f, 0.000972472772f, 0.000966729771f, 0.000960952486f, 0.000955141149f, 0.000949296053f, 0.00094341737f,
+    0.000937505334f, 0.000931560178f, 0.000925582135f, 0.000919571496f, 0.000913528434f, 0.000907453243f, 0.000901346153f, 0.000895207399f,
+    0.000889037154f, 0.000882835768f, 0.000876603473f, 0.000870340446f, 0.000864047033f, 0.000857723353f, 0.000851369754f, 0.000844986469f,
+    0.000838573731f, 0.000832131831f, 0.000825661002f, 0.000819161476f, 0.000812633487f, 0.000806077383f, 0.00079949334f, 0.000792881649f,
+    0.000786242541f, 0.000779576367f, 0.000772883301f, 0.000766163575f, 0.00075941754f, 0.000752645428f, 0.00074584753f, 0.000739024021f,
+    0.000732175249f, 0.000725301506f, 0.000718402967f, 0.000711479981f, 0.00070453278f, 0.000697561656f, 0.000690566842f, 0.000683548627f,
+    0.000676507305f, 0.000669443165f, 0.00066235644f, 0.000655247422f, 0.000648116402f, 0.000640963612f, 0.000633789401f, 0.000626593945f,
+    0.00061937765f, 0.000612140691f, 0.00060488336f, 0.000597606006f, 0.00059030886f, 0.000582992216f, 0.000575656362f, 0.000568301592f,
+    0.000560928136f, 0.000553536345f, 0.00054612651f, 0.000538698805f, 0.000531253638f, 0.000523791299f, 0.000516311964f, 0.000508815981f,
+    0.000501303701f, 0.000493775296f, 0.000486231176f, 0.000478671544f, 0.000471096719f, 0.000463507022f, 0.000455902686f, 0.00044828403f,
+    0.000440651376f, 0.000433004956f, 0.000425345119f, 0.000417672156f, 0.0004099863f, 0.000402287929f, 0.000394577277f, 0.000386854663f,
+    0.000379120378f, 0.000371374714f, 0.000363617961f, 0.00035585044f, 0.000348072441f, 0.000340284256f, 0.000332486175f, 0.00032467852f,
+    0.000316861551f, 0.000309035589f, 0.000301200926f, 0.000293357851f, 0.000285506685f, 0.000277647749f, 0.000269781274f, 0.000261907611f,
+    0.000254027051f, 0.000246139854f, 0.000238246386f, 0.000230346908f, 0.000222441726f, 0.00021453113f, 0.000206615441f, 0.000198694936f,
+    0.000190769948f, 0.00018284074f, 0.000174907633f, 0.000166970931f, 0.000159030926f, 0.000151087908f, 0.000143142199f, 0.000135194088f,
+    0.000127243882f, 0.000119291879f, 0.000111338377f, 0.000103383674f, 9.54280695e-05f, 8.74718753e-05f, 7.95153755e-05f, 7.15588831e-05f,
+    6.36026962e-05f, 5.56471059e-05f, 4.76924179e-05f, 3.9738934e-05f, 3.1786949e-05f, 2.38367647e-05f, 1.58886796e-05f, 7.94299194e-06f,
+    2.1561136e-17f, -7.93999698e-06f, -1.58767016e-05f, -2.38098146e-05f, -3.17390404e-05f, -3.96640789e-05f, -4.75846355e-05f, -5.55004117e-05f,
+    -6.34111129e-05f, -7.13164409e-05f, -7.92161009e-05f, -8.71097945e-05f, -9.49972309e-05f, -0.000102878112f, -0.000110752146f, -0.000118619035f,
+    -0.000126478495f, -0.000134330214f, -0.000142173914f, -0.000150009291f, -0.000157836068f, -0.000165653939f, -0.000173462628f, -0.000181261828f,
+    -0.00018905125f, -0.000196830617f, -0.000204599637f, -0.000212358005f, -0.000220105459f, -0.00022784168f, -0.000235566404f, -0.000243279341f,
+    -0.0002509802f, -0.000258668675f, -0.000266344519f, -0.000274007441f, -0.000281657121f, -0.000289293326f, -0.000296915736f, -0.000304524059f,
+    -0.000312118063f, -0.000319697428f, -0.000327261892f, -0.000334811164f, -0.000342344982f, -0.000349863054f, -0.00035736509f, -0.000364850828f,
+    -0.000372320006f, -0.000379772333f, -0.000387207518f, -0.000394625327f, -0.000402025471f, -0.000409407658f, -0.000416771625f, -0.000424117112f,
+    -0.000431443856f, -0.000438751536f, -0.00044603998f, -0.000453308836f, -0.000460557843f, -0.000467786798f, -0.000474995381f, -0.000482183328f,
+    -0.000489350408f, -0.00049649633f, -0.000503620831f, -0.000510723679f, -0.000517804641f, -0.000524863368f, -0.000531899685f, -0.000538913242f,
+    -0.000545903866f, -0.000552871323f, -0.000559815264f, -0.000566735514f, -0.000573631783f, -0.000580503838f, -0.000587351446f, -0.000594174257f,
+    -0.000600972155f, -0.000607744849f, -0.000614492048f, -0.000621213578f, -0.000627909147f, -0.000634578522f, -0.000641221472f, -0.000647837762f,
+    -0.000654427102f, -0.000660989317f, -0.000667524117f, -0.000674031326f, -0.000680510653f, -0.000686961925f, -0.000693384849f, -0.000699779193f,
+    -0.000706144783f, -0.000712481327f, -0.000718788651f, -0.000725066522f, -0.000731314649f, -0.000737532915f, -0.000743720972f, -0.000749878702f,
+    -0.000756005873f, -0.000762102194f, -0.000768167549f, -0.000774201588f, -0.000780204253f, -0.000786175195f, -0.000792114239f, -0.000798021269f,
+    -0.000803895935f, -0.000809738063f, -0.000815547537f, -0.000821324007f, -0.000827067415f, -0.000832777412f, -0.00083845394f, -0.000844096707f,
+    -0.000849705481f, -0.000855280203f, -0.000860820524f, -0.000866326329f, -0.000871797383f, -0.000877233571f, -0.000882634602f, -0.000888000359f,
+    -0.000893330609f, -0.000898625178f, -0.000903883891f, -0.000909106515f, -0.000914292934f, -0.000919442973f, -0.000924556341f, -0.000929632981f,
+    -0.000934672717f, -0.000939675258f, -0.000944640487f, -0.00094956829f, -0.000954458432f, -0.000959310739f, -0.000964125094f, -0.000968901266f,
+    -0.000973639137f, -0.000978338532f, -0.00098299922f, -0.000987621141f, -0.000992204179f, -0.000996747985f, -0.00100125256f, -0.00100571767f,
+    -0.0010101432f, -0.00101452903f, -0.00101887493f, -0.00102318078f, -0.00102744647f, -0.00103167188f, -0.00103585678f, -0.00104000105f,
+    -0.00104410457f, -0.00104816712f, -0.00105218869f, -0.00105616916f, -0.00106010819f, -0.00106400589f, -0.00106786191f, -0.00107167638f,
+    -0.00107544893f, -0.00107917946f, -0.00108286808f, -0.00108651433f, -0.00109011831f, -0.00109367992f, -0.00109719892f, -0.0011006752f,
+    -0.00110410876f, -0.00110749935f, -0.00111084699f, -0.00111415144f, -0.0011174127f, -0.00112063065f, -0.00112380506f, -0.00112693594f,
+    -0.00113002316f, -0.00113306672f, -0.00113606639f, -0.00113902206f, -0.00114193372f, -0.00114480127f, -0.00114762457f, -0.00115040352f,
+    -0.00115313812f, -0.00115582824f, -0.00115847378f, -0.00116107462f, -0.00116363075f, -0.00116614206f, -0.00116860843f, -0.00117102987f,
+    -0.00117340626f, -0.00117573759f, -0.00117802364f, -0.00118026452f, -0.00118245999f, -0.00118461018f, -0.00118671486f, -0.00118877401f,
+    -0.00119078753f, -0.00119275553f, -0.00119467778f, -0.00119655428f, -0.00119838503f, -0.00120016979f, -0.0012019088f, -0.00120360171f,
+    -0.00120524876f, -0.0012068497f, -0.00120840466f, -0.0012099134f, -0.00121137593f, -0.00121279235f, -0.00121416245f, -0.00121548632f,
+    -0.00121676398f, -0.00121799519f, -0.00121918006f, -0.00122031849f, -0.00122141058f, -0.00122245622f, -0.00122345542f, -0.00122440804f,
+    -0.00122531422f, -0.00122617395f, -0.00122698699f, -0.00122775359f, -0.00122847361f, -0.00122914708f, -0.00122977397f, -0.0012303543f,
+    -0.00123088807f, -0.00123137515f, -0.00123181578f, -0.00123220973f, -0.00123255712f, -0.00123285793f, -0.00123311218f, -0.00123331987f,
+    -0.00123348099f, -0.00123359554f, -0.00123366364f, -0.00123368518f, -0.00123366027f, -0.00123358879f, -0.00123347098f, -0.0012333066f,
+    -0.00123309589f, -0.00123283872f, -0.00123253523f, -0.0012321854f, -0.00123178936f, -0.00123134698f, -0.00123085838f, -0.00123032357f,
+    -0.00122974254f, -0.00122911553f, -0.0012284423f, -0.00122772309f, -0.00122695789f, -0.00122614682f, -0.00122528977f, -0.00122438686f,
+    -0.00122343819f, -0.00122244377f, -0.00122140371f, -0.00122031802f, -0.0012191867f, -0.00121800986f, -0.00121678761f, -0.00121551997f,
+    -0.00121420692f, -0.0012128487f, -0.00121144531f, -0.00120999676f, -0.00120850315f, -0.0012069646f, -0.00120538112f, -0.00120375282f,
+    -0.00120207982f, -0.00120036211f, -0.00119859981f, -0.00119679305f, -0.00119494193f, -0.00119304645f, -0.00119110674f, -0.00118912279f,
+    -0.00118709484f, -0.00118502299f, -0.00118290714f, -0.00118074764f, -0.00117854448f, -0.00117629766f, -0.00117400743f, -0.00117167376f,
+    -0.0011692968f, -0.00116687675f, -0.00116441364f, -0.00116190757f, -0.00115935877f, -0.00115676713f, -0.00115413289f, -0.00115145626f,
+    -0.00114873715f, -0.00114597578f, -0.00114317238f, -0.00114032684f, -0.00113743951f, -0.00113451038f, -0.00113153958f, -0.00112852734f,
+    -0.00112547365f, -0.00112237874f, -0.00111924275f, -0.00111606577f, -0.00111284782f, -0.00110958924f, -0.00110629015f, -0.00110295054f,
+    -0.00109957065f, -0.00109615061f, -0.00109269063f, -0.00108919071f, -0.00108565111f, -0.00108207192f, -0.00107845338f, -0.00107479549f,
+    -0.00107109849f, -0.00106736261f, -0.00106358784f, -0.00105977454f, -0.00105592271f, -0.00105203246f, -0.00104810414f, -0.00104413775f,
+    -0.00104013365f, -0.00103609182f, -0.0010320124f, -0.00102789572f, -0.00102374179f, -0.00101955095f, -0.00101532333f, -0.00101105892f,
+    -0.00100675807f, -0.00100242102f, -0.000998047763f, -0.000993638532f, -0.000989193562f, -0.000984713086f, -0.000980197103f, -0.000975645904f,
+    -0.000971059722f, -0.000966438674f, -0.000961782935f, -0.000957092736f, -0.000952368311f, -0.000947609718f, -0.000942817249f, -0.000937991077f,
+    -0.000933131436f, -0.000928238442f, -0.000923312327f, -0.000918353326f, -0.000913361553f, -0.000908337301f, -0.000903280685f, -0.000898191996f,
+    -0.00089307141f, -0.000887919101f, -0.000882735301f, -0.000877520186f, -0.000872273988f, -0.000866996939f, -0.000861689216f, -0.000856351049f,
+    -0.000850982615f, -0.000845584145f, -0.000840155932f, -0.00083469809f, -0.000829210854f, -0.000823694456f, -0.000818149128f, -0.000812575105f,
+    -0.000806972559f, -0.000801341783f, -0.000795682892f, -0.000789996178f, -0.000784281874f, -0.000778540212f, -0.000772771367f, -0.000766975572f,
+    -0.000761153118f, -0.000755304238f, -0.000749429048f, -0.000743527897f, -0.00073760096f, -0.00073164847f, -0.000725670718f, -0.00071966782f,
+    -0.000713640184f, -0.000707587868f, -0.000701511221f, -0.000695410476f, -0.000689285807f, -0.000683137565f, -0.000676965865f, -0.000670770998f,
+    -0.000664553256f, -0.000658312754f, -0.000652049901f, -0.000645764871f, -0.000639457838f, -0.000633129152f, -0.000626778987f, -0.000620407634f,
+    -0.000614015327f, -0.000607602356f, -0.000601168897f, -0.000594715239f, -0.000588241615f, -0.000581748318f, -0.000575235521f, -0.000568703574f,
+    -0.000562152651f, -0.000555583043f, -0.000548995042f, -0.000542388821f, -0.000535764673f, -0.000529122888f, -0.000522463699f, -0.000515787338f,
+    -0.000509094098f, -0.00050238421f, -0.000495657965f, -0.000488915597f, -0.000482157338f, -0.000475383509f, -0.000468594371f, -0.000461790129f,
+    -0.000454971101f, -0.000448137522f, -0.000441289652f, -0.000434427755f, -0.000427552091f, -0.000420662953f, -0.000413760601f, -0.000406845269f,
+    -0.000399917248f, -0.000392976799f, -0.000386024185f, -0.000379059667f, -0.000372083508f, -0.000365096028f, -0.000358097401f, -0.000351087976f,
+    -0.000344067987f, -0.000337037724f, -0.00032999742f, -0.000322947366f, -0.000315887824f, -0.000308819086f, -0.000301741384f, -0.000294655008f,
+    -0.000287560251f, -0.000280457345f, -0.000273346581f, -0.00026622825f, -0.000259102584f, -0.000251969846f, -0.000244830357f, -0.000237684362f,
+    -0.00023053214f, -0.000223373951f, -0.000216210057f, -0.000209040765f, -0.000201866322f, -0.000194687018f, -0.000187503101f, -0.000180314863f,
+    -0.000173122578f, -0.000165926496f, -0.000158726922f, -0.000151524102f, -0.000144318314f, -0.000137109833f, -0.000129898952f, -0.000122685917f,
+    -0.000115471004f, -0.000108254491f, -0.000101036654f, -9.38177618e-05f, -8.65980837e-05f, -7.93778963e-05f, -7.21574761e-05f, -6.4937085e-05f,
+    -5.77170067e-05f, -5.04975033e-05f, -4.32788511e-05f, -3.60613194e-05f, -2.88451829e-05f, -2.16307108e-05f, -1.44181759e-05f, -7.20784874e-06f,
+    1.15356644e-18f, 7.20509934e-06f, 1.44071792e-05f, 2.16059689e-05f, 2.88011979e-05f, 3.5992598e-05f, 4.31798981e-05f, 5.03628289e-05f,
+    5.75411214e-05f, 6.47145062e-05f, 7.18827214e-05f, 7.90454869e-05f, 8.62025408e-05f, 9.33536212e-05f, 0.000100498452f, 0.00010763677f,
+    0.000114768307f, 0.000121892801f, 0.000129009975f, 0.00013611959f, 0.000143221347f, 0.000150314998f, 0.000157400282f, 0.000164476936f,
+    0.000171544685f, 0.000178603281f, 0.000185652447f, 0.000192691921f, 0.000199721457f, 0.000206740777f, 0.000213749634f, 0.000220747752f,
+    0.000227734898f, 0.00023471078f, 0.000241675152f, 0.000248627766f, 0.00025556836f, 0.000262496673f, 0.000269412441f, 0.000276315433f,
+    0.000283205387f, 0.000290082011f, 0.000296945102f, 0.000303794368f, 0.000310629577f, 0.000317450467f, 0.000324256776f, 0.000331048301f,
+    0.000337824749f, 0.00034458586f, 0.00035133143f, 0.000358061166f, 0.000364774838f, 0.000371472212f, 0.000378153025f, 0.000384817045f,
+    0.000391464011f, 0.000398093718f, 0.000404705846f, 0.000411300221f, 0.000417876581f, 0.000424434693f, 0.000430974294f, 0.000437495153f,
+    0.000443997036f, 0.000450479711f, 0.000456942944f, 0.000463386474f, 0.000469810097f, 0.00047621355f, 0.000482596603f, 0.000488959078f,
+    0.000495300628f, 0.000501621165f, 0.00050792034f, 0.000514197978f, 0.000520453847f, 0.000526687712f, 0.000532899343f, 0.000539088505f,
+    0.000545255025f, 0.000551398611f, 0.000557519088f, 0.000563616224f, 0.000569689786f, 0.000575739541f, 0.000581765315f, 0.000587766874f,
+    0.000593743986f, 0.000599696417f, 0.000605623994f, 0.000611526484f, 0.000617403653f, 0.000623255328f, 0.000629081274f, 0.000634881319f,
+    0.000640655169f, 0.00064640271f, 0.000652123708f, 0.000657817931f, 0.000663485145f, 0.000669125235f, 0.000674737967f, 0.000680323108f,
+    0.000685880485f, 0.000691409921f, 0.000696911127f, 0.000702384044f, 0.000707828323f, 0.000713243906f, 0.000718630501f, 0.000723987992f,
+    0.000729316147f, 0.00073461479f, 0.00073988369f, 0.000745122728f, 0.000750331674f, 0.000755510351f, 0.000760658586f, 0.000765776203f,
+    0.000770862971f, 0.000775918772f, 0.000780943432f, 0.000785936718f, 0.000790898455f, 0.000795828528f, 0.000800726702f, 0.000805592805f,
+    0.000810426718f, 0.000815228268f, 0.000819997222f, 0.000824733463f, 0.000829436874f, 0.000834107166f, 0.000838744221f, 0.000843347982f,
+    0.000847918156f, 0.000852454628f, 0.000856957224f, 0.000861425826f, 0.00086586026f, 0.000870260352f, 0.000874625985f, 0.000878956984f,
+    0.000883253233f, 0.000887514558f, 0.000891740783f, 0.000895931793f, 0.000900087412f, 0.000904207584f, 0.000908292073f, 0.000912340765f,
+    0.000916353543f, 0.000920330232f, 0.000924270716f, 0.000928174937f, 0.000932042603f, 0.000935873715f, 0.000939668098f, 0.000943425577f,
+    0.000947146094f, 0.000950829533f, 0.000954475719f, 0.000958084478f, 0.000961655809f, 0.000965189538f, 0.000968685548f, 0.000972143724f,
+    0.000975563889f, 0.000978945987f, 0.000982290017f, 0.00098559563f, 0.000988862943f, 0.000992091605f, 0.000995281735f, 0.000998433097f,
+    0.00100154569f, 0.00100461929f, 0.00100765389f, 0.00101064937f, 0.00101360562f, 0.00101652252f, 0.00101940008f, 0.00102223805f,
+    0.00102503644f, 0.00102779502f, 0.0010305139f, 0.00103319297f, 0.00103583199f, 0.00103843107f, 0.00104098988f, 0.00104350864f,
+    0.00104598701f, 0.0010484251f, 0.00105082267f, 0.00105317973f, 0.00105549616f, 0.00105777208f, 0.00106000714f, 0.00106220145f,
+    0.0010643549f, 0.00106646738f, 0.00106853887f, 0.00107056927f, 0.00107255869f, 0.00107450678f, 0.00107641367f, 0.00107827934f,
+    0.00108010368f, 0.00108188647f, 0.00108362793f, 0.00108532782f, 0.00108698627f, 0.00108860305f, 0.00109017815f, 0.00109171169f,
+    0.00109320343f, 0.00109465339f, 0.00109606155f, 0.0010974278f, 0.00109875225f, 0.0011000348f, 0.00110127544f, 0.00110247405f,
+    0.00110363064f, 0.00110474532f, 0.00110581785f, 0.00110684824f, 0.00110783661f, 0.00110878283f, 0.00110968691f, 0.00111054885f,
+    0.00111136853f, 0.00111214607f, 0.00111288147f, 0.0011135746f, 0.00111422548f, 0.00111483422f, 0.00111540058f, 0.0011159248f,
+    0.00111640664f, 0.00111684634f, 0.00111724378f, 0.00111759896f, 0.00111791189f, 0.00111818255f, 0.00111841096f, 0.00111859711f,
+    0.00111874111f, 0.00111884286f, 0.00111890247f, 0.00111891981f, 0.00111889502f, 0.00111882808f, 0.001118719f, 0.00111856789f,
+    0.00111837452f, 0.00111813925f, 0.00111786183f, 0.00111754239f, 0.00111718103f, 0.00111677765f, 0.00111633237f, 0.00111584517f,
+    0.00111531606f, 0.00111474528f, 0.00111413258f, 0.00111347821f, 0.00111278205f, 0.00111204432f, 0.00111126492f, 0.00111044396f,
+    0.00110958144f, 0.00110867748f, 0.00110773207f, 0.00110674521f, 0.00110571715f, 0.00110464776f, 0.00110353716f, 0.00110238534f,
+    0.00110119255f, 0.00109995855f, 0.00109868369f, 0.00109736796f, 0.00109601126f, 0.00109461392f, 0.00109317573f, 0.00109169702f,
+    0.00109017768f, 0.00108861784f, 0.00108701759f, 0.00108537695f, 0.00108369614f, 0.00108197506f, 0.00108021381f, 0.00107841264f,
+    0.00107657153f, 0.00107469049f, 0.00107276964f, 0.0010708092f, 0.00106880907f, 0.00106676959f, 0.00106469053f, 0.00106257224f,
+    0.00106041471f, 0.00105821795f, 0.00105598231f, 0.00105370767f, 0.00105139415f, 0.00104904198f, 0.00104665104f, 0.00104422169f,
+    0.00104175392f, 0.00103924784f, 0.00103670359f, 0.00103412115f, 0.00103150087f, 0.00102884264f, 0.0010261467f, 0.00102341303f,
+    0.00102064188f, 0.00101783336f, 0.00101498759f, 0.00101210468f, 0.00100918475f, 0.0010062278f, 0.00100323418f, 0.00100020377f,
+    0.000997136929f, 0.000994033762f, 0.000990894157f, 0.00098771858f, 0.000984506914f, 0.000981259393f, 0.000977976131f, 0.000974657305f,
+    0.00097130303f, 0.000967913424f, 0.00096448866f, 0.000961028796f, 0.000957534125f, 0.000954004703f, 0.000950440648f, 0.000946842192f,
+    0.000943209394f, 0.000939542486f, 0.000935841585f, 0.000932106806f, 0.000928338384f, 0.000924536376f, 0.000920701015f, 0.000916832418f,
+    0.000912930758f, 0.000908996211f, 0.000905028894f, 0.000901029038f, 0.00089699676f, 0.000892932178f, 0.000888835581f, 0.000884707028f,
+    0.000880546693f, 0.00087635481f, 0.000872131495f, 0.000867876923f, 0.000863591325f, 0.00085927482f, 0.000854927581f, 0.000850549783f,
+    0.0008461416f, 0.000841703266f, 0.000837234897f, 0.000832736725f, 0.000828208867f, 0.000823651557f, 0.000819064968f, 0.000814449275f,
+    0.000809804595f, 0.000805131276f, 0.000800429378f, 0.000795699132f, 0.000790940656f, 0.000786154298f, 0.000781340059f, 0.000776498287f,
+    0.0007716291f, 0.00076673273f, 0.000761809351f, 0.000756859139f, 0.000751882268f, 0.000746879028f, 0.000741849537f, 0.000736794027f,
+    0.000731712731f, 0.000726605766f, 0.000721473363f, 0.000716315815f, 0.000711133238f, 0.000705925806f, 0.00070069381f, 0.000695437426f,
+    0.000690156827f, 0.000684852246f, 0.000679523917f, 0.000674172072f, 0.000668796827f, 0.000663398416f, 0.000657977129f, 0.000652533141f,
+    0.000647066627f, 0.000641577819f, 0.00063606695f, 0.000630534254f, 0.000624979904f, 0.000619404134f, 0.000613807177f, 0.000608189264f,
+    0.000602550572f, 0.000596891332f, 0.000591211778f, 0.000585512083f, 0.000579792599f, 0.000574053382f, 0.000568294781f, 0.000562516972f,
+    0.000556720188f, 0.00055090466f, 0.000545070623f, 0.00053921825f, 0.000533347833f, 0.000527459546f, 0.00052155368f, 0.000515630411f,
+    0.000509689969f, 0.000503732648f, 0.000497758621f, 0.000491768122f, 0.000485761382f, 0.000479738665f, 0.000473700173f, 0.000467646169f,
+    0.000461576856f, 0.000455492467f, 0.000449393265f, 0.000443279481f, 0.00043715135f, 0.000431009074f, 0.000424852944f, 0.000418683165f,
+    0.000412499969f, 0.000406303618f, 0.000400094315f, 0.000393872353f, 0.000387637905f, 0.000381391292f, 0.000375132659f, 0.000368862326f,
+    0.000362580497f, 0.000356287434f, 0.00034998334f, 0.000343668478f, 0.00033734311f, 0.000331007468f, 0.000324661785f, 0.000318306295f,
+    0.000311941258f, 0.000305566908f, 0.000299183506f, 0.000292791257f, 0.000286390452f, 0.000279981323f, 0.000273564103f, 0.000267139054f,
+    0.00026070638f, 0.000254266371f, 0.000247819262f, 0.000241365269f, 0.000234904684f, 0.000228437726f, 0.000221964641f, 0.000215485692f,
+    0.000209001097f, 0.000202511132f, 0.00019601603f, 0.000189516039f, 0.000183011405f, 0.000176502377f, 0.000169989202f, 0.000163472112f,
+    0.000156951384f, 0.000150427251f, 0.000143899946f, 0.000137369731f, 0.000130836852f, 0.000124301558f, 0.000117764088f, 0.000111224697f,
+    0.000104683626f, 9.81411285e-05f, 9.15974524e-05f, 8.50528377e-05f, 7.85075317e-05f, 7.19617892e-05f, 6.54158503e-05f, 5.88699622e-05f,
+    5.23243762e-05f, 4.57793321e-05f, 3.92350848e-05f, 3.26918707e-05f, 2.61499445e-05f, 1.9609548e-05f, 1.30709277e-05f, 6.53433017e-06f,
+    1.0432684e-17f, -6.53181678e-06f, -1.3060876e-05f, -1.95869306e-05f, -2.61097375e-05f, -3.26290537e-05f, -3.91446301e-05f, -4.56562266e-05f,
+    -5.21635993e-05f, -5.8666501e-05f, -6.51646915e-05f, -7.16579234e-05f, -7.81459676e-05f, -8.4628562e-05f, -9.1105474e-05f, -9.75764706e-05f,
+    -0.00010404129f, -0.000110499706f, -0.00011695148f, -0.000123396356f, -0.000129834109f, -0.000136264483f, -0.000142687262f, -0.000149102183f,
+    -0.000155509028f, -0.000161907548f, -0.000168297498f, -0.000174678644f, -0.000181050767f, -0.000187413607f, -0.000193766929f, -0.000200110517f,
+    -0.000206444121f, -0.000212767511f, -0.000219080452f, -0.000225382712f, -0.000231674043f, -0.000237954227f, -0.000244223018f, -0.000250480225f,
+    -0.000256725558f, -0.000262958813f, -0.000269179785f, -0.000275388215f, -0.000281583867f, -0.00028776651f, -0.00029393594f, -0.000300091953f,
+    -0.000306234258f, -0.000312362652f, -0.00031847693f, -0.00032457686f, -0.000330662209f, -0.000336732744f, -0.000342788262f, -0.000348828558f,
+    -0.000354853342f, -0.000360862468f, -0.000366855675f, -0.000372832757f, -0.000378793455f, -0.000384737621f, -0.000390664994f, -0.000396575371f,
+    -0.000402468519f, -0.000408344233f, -0.00041420231f, -0.000420042517f, -0.000425864651f, -0.000431668479f, -0.000437453826f, -0.000443220459f,
+    -0.000448968174f, -0.000454696739f, -0.00046040598f, -0.000466095691f, -0.000471765612f, -0.000477415597f, -0.000483045413f, -0.000488654885f,
+    -0.000494243752f, -0.000499811838f, -0.00050535897f, -0.000510884915f, -0.000516389497f, -0.000521872484f, -0.000527333701f, -0.000532772916f,
+    -0.000538190012f, -0.000543584698f, -0.000548956858f, -0.000554306258f, -0.000559632725f, -0.000564936025f, -0.000570215983f, -0.000575472426f,
+    -0.000580705178f, -0.000585914066f, -0.000591098797f, -0.000596259313f, -0.000601395383f, -0.000606506772f, -0.000611593365f, -0.000616654928f,
+    -0.000621691346f, -0.000626702385f, -0.000631687872f, -0.00063664763f, -0.000641581486f, -0.000646489265f, -0.000651370792f, -0.000656225893f,
+    -0.000661054451f, -0.000665856176f, -0.000670631009f, -0.000675378658f, -0.000680099125f, -0.000684792059f, -0.000689457462f, -0.000694095041f,
+    -0.00069870468f, -0.000703286205f, -0.000707839499f, -0.00071236433f, -0.000716860639f, -0.000721328135f, -0.00072576676f, -0.00073017634f,
+    -0.000734556699f, -0.000738907664f, -0.000743229175f, -0.000747520942f, -0.000751782907f, -0.000756014953f, -0.000760216848f, -0.000764388475f,
+    -0.000768529659f, -0.000772640342f, -0.000776720291f, -0.000780769449f, -0.000784787582f, -0.000788774574f, -0.000792730367f, -0.000796654727f,
+    -0.000800547597f, -0.000804408744f, -0.00080823811f, -0.000812035578f, -0.000815800973f, -0.00081953418f, -0.000823235023f, -0.000826903502f,
+    -0.000830539328f, -0.000834142498f, -0.00083771284f, -0.000841250236f, -0.00084475457f, -0.000848225725f, -0.000851663586f, -0.000855068036f,
+    -0.000858438958f, -0.000861776236f, -0.000865079754f, -0.000868349394f, -0.000871585042f, -0.00087478658f, -0.000877953949f, -0.000881087035f,
+    -0.00088418572f, -0.000887249829f, -0.000890279363f, -0.000893274206f, -0.00089623424f, -0.000899159291f, -0.000902049418f, -0.000904904387f,
+    -0.000907724199f, -0.000910508679f, -0.000913257769f, -0.00091597141f, -0.000918649486f, -0.000921291939f, -0.000923898653f, -0.000926469511f,
+    -0.000929004513f, -0.000931503542f, -0.000933966425f, -0.000936393277f, -0.000938783807f, -0.000941138132f, -0.00094345602f, -0.000945737469f,
+    -0.000947982422f, -0.000950190821f, -0.00095236249f, -0.000954497489f, -0.000956595701f, -0.000958657009f, -0.000960681471f, -0.000962668913f,
+    -0.000964619278f, -0.000966532622f, -0.000968408771f, -0.000970247667f, -0.000972049369f, -0.000973813701f, -0.000975540665f, -0.000977230258f,
+    -0.000978882308f, -0.000980496872f, -0.000982073834f, -0.000983613194f, -0.000985114835f, -0.000986578874f, -0.000988005195f, -0.00098939368f,
+    -0.000990744331f, -0.000992057147f, -0.000993332127f, -0.00099456904f, -0.000995768118f, -0.000996929244f, -0.000998052303f, -0.000999137294f,
+    -0.00100018433f, -0.00100119319f, -0.00100216386f, -0.00100309646f, -0.001003991f, -0.00100484723f, -0.00100566528f, -0.00100644527f,
+    -0.00100718683f, -0.00100789033f, -0.00100855541f, -0.00100918231f, -0.00100977102f, -0.00101032131f, -0.00101083342f, -0.00101130723f,
+    -0.00101174274f, -0.00101213995f, -0.00101249886f, -0.00101281947f, -0.00101310178f, -0.0010133459f, -0.00101355161f, -0.00101371913f,
+    -0.00101384846f, -0.00101393939f, -0.00101399212f, -0.00101400667f, -0.00101398304f, -0.00101392111f, -0.00101382111f, -0.00101368281f,
+    -0.00101350644f, -0.001013292f, -0.00101303938f, -0.00101274869f, -0.00101241993f, -0.00101205322f, -0.00101164845f, -0.00101120584f,
+    -0.00101072516f, -0.00101020664f, -0.00100965018f, -0.001009056f, -0.00100842398f, -0.00100775424f, -0.00100704667f, -0.00100630161f,
+    -0.00100551872f, -0.00100469834f, -0.00100384047f, -0.00100294501f, -0.00100201217f, -0.00100104196f, -0.00100003427f, -0.000998989446f,
+    -0.000997907249f, -0.000996787916f, -0.000995631563f, -0.000994437956f, -0.000993207446f, -0.000991940033f, -0.000990635599f, -0.000989294378f,
+    -0.000987916486f, -0.000986501807f, -0.000985050574f, -0.00098356267f, -0.000982038444f, -0.000980477664f, -0.000978880562f, -0.000977247255f,
+    -0.000975577685f, -0.000973872025f, -0.000972130336f, -0.000970352674f, -0.000968539156f, -0.00096668984f, -0.000964804785f, -0.000962884107f,
+    -0.000960927922f, -0.000958936231f, -0.000956909207f, -0.00095484691f, -0.000952749397f, -0.000950616843f, -0.000948449248f, -0.000946246786f,
+    -0.000944009516f, -0.000941737497f, -0.000939430902f, -0.00093708979f, -0.000934714277f, -0.00093230448f, -0.000929860456f, -0.000927382323f,
+    -0.000924870197f, -0.000922324252f, -0.000919744489f, -0.000917131081f, -0.000914484088f, -0.000911803683f, -0.000909089984f, -0.000906343048f,
+    -0.000903562992f, -0.00090074999f, -0.00089790416f, -0.000895025558f, -0.00089211436f, -0.000889170624f, -0.000886194583f, -0.000883186236f,
+    -0.000880145817f, -0.000877073384f, -0.000873969111f, -0.000870833115f, -0.000867665454f, -0.000864466361f, -0.000861235952f, -0.000857974286f,
+    -0.000854681595f, -0.000851357938f, -0.000848003488f, -0.000844618422f, -0.000841202796f, -0.000837756786f, -0.000834280567f, -0.000830774195f,
+    -0.000827237964f, -0.000823671871f, -0.000820076093f, -0.000816450862f, -0.000812796236f, -0.000809112389f, -0.000805399439f, -0.000801657618f,
+    -0.000797887042f, -0.000794087828f, -0.00079026015f, -0.000786404242f, -0.000782520103f, -0.000778608024f, -0.000774668122f, -0.000770700513f,
+    -0.000766705431f, -0.00076268299f, -0.000758633367f, -0.000754556735f, -0.000750453211f, -0.000746323029f, -0.000742166245f, -0.000737983151f,
+    -0.000733773864f, -0.000729538559f, -0.000725277408f, -0.000720990531f, -0.000716678216f, -0.000712340465f, -0.000707977626f, -0.000703589758f,
+    -0.000699177093f, -0.000694739749f, -0.000690277957f, -0.000685791892f, -0.000681281672f, -0.000676747586f, -0.000672189693f, -0.000667608285f,
+    -0.000663003419f, -0.000658375386f, -0.000653724361f, -0.00064905046f, -0.000644353917f, -0.000639634905f, -0.0006348936f, -0.000630130235f,
+    -0.000625344925f, -0.000620537903f, -0.000615709403f, -0.000610859541f, -0.000605988491f, -0.000601096544f, -0.000596183818f, -0.000591250544f,
+    -0.000586296839f, -0.000581322995f, -0.000576329185f, -0.000571315526f, -0.00056628231f, -0.00056122971f, -0.000556157902f, -0.00055106706f,
+    -0.000545957475f, -0.000540829264f, -0.000535682659f, -0.000530517835f, -0.000525335025f, -0.000520134461f, -0.000514916261f, -0.000509680714f,
+    -0.000504427939f, -0.000499158166f, -0.000493871688f, -0.000488568563f, -0.00048324914f, -0.000477913534f, -0.00047256198f, -0.00046719471f,
+    -0.000461811869f, -0.000456413749f, -0.000451000466f, -0.00044557231f, -0.000440129457f, -0.000434672111f, -0.000429200503f, -0.000423714839f,
+    -0.000418215321f, -0.000412702153f, -0.000407175568f, -0.000401635771f, -0.000396082993f, -0.000390517438f, -0.000384939311f, -0.000379348814f,
+    -0.00037374621f, -0.000368131674f, -0.000362505409f, -0.000356867706f, -0.000351218681f, -0.000345558627f, -0.000339887745f, -0.000334206241f,
+    -0.000328514347f, -0.000322812237f, -0.000317100203f, -0.00031137839f, -0.000305647089f, -0.000299906475f, -0.000294156751f, -0.00028839818f,
+    -0.000282630965f, -0.000276855339f, -0.000271071505f, -0.000265279668f, -0.00025948009f, -0.000253672973f, -0.000247858552f, -0.000242037015f,
+    -0.000236208609f, -0.000230373553f, -0.000224532079f, -0.000218684392f, -0.000212830724f, -0.000206971294f, -0.000201106333f, -0.000195236047f,
+    -0.000189360682f, -0.000183480443f, -0.000177595561f, -0.00017170627f, -0.000165812773f, -0.000159915304f, -0.000154014095f, -0.00014810935f,
+    -0.000142201316f, -0.000136290197f, -0.000130376226f, -0.000124459621f, -0.000118540607f, -0.000112619426f, -0.00010669628f, -0.000100771395f,
+    -9.48450106e-05f, -8.89173316e-05f, -8.29885976e-05f, -7.70590268e-05f, -7.11288376e-05f, -6.51982555e-05f, -5.92675096e-05f, -5.3336822e-05f,
+    -4.74064109e-05f, -4.14765054e-05f, -3.55473276e-05f, -2.96190974e-05f, -2.36920423e-05f, -1.77663806e-05f, -1.18423386e-05f, -5.92013748e-06f,
+    7.56546916e-18f, 5.91785192e-06f, 1.18331964e-05f, 1.77458096e-05f, 2.36554733e-05f, 2.95619629e-05f, 3.54650583e-05f, 4.13645357e-05f,
+    4.72601787e-05f, 5.31517653e-05f, 5.90390737e-05f, 6.49218855e-05f, 7.07999789e-05f, 7.66731318e-05f, 8.25411335e-05f, 8.84037581e-05f,
+    9.42607876e-05f, 0.000100111996f, 0.00010595718f, 0.000111796115f, 0.000117628588f, 0.000123454374f, 0.000129273249f, 0.000135085007f,
+    0.000140889446f, 0.000146686318f, 0.000152475433f, 0.000158256575f, 0.000164029509f, 0.000169794046f, 0.00017554994f, 0.000181297015f,
+    0.000187035039f, 0.000192763793f, 0.000198483074f, 0.000204192664f, 0.000209892358f, 0.000215581938f, 0.000221261202f, 0.000226929944f,
+    0.000232587932f, 0.000238234978f, 0.000243870862f, 0.000249495381f, 0.000255108345f, 0.000260709523f, 0.00026629871f, 0.000271875702f,
+    0.000277440296f, 0.000282992289f, 0.000288531475f, 0.000294057652f, 0.000299570587f, 0.000305070134f, 0.000310556061f, 0.000316028163f,
+    0.000321486266f, 0.000326930138f, 0.000332359574f, 0.0003377744f, 0.000343174383f, 0.000348559377f, 0.00035392915f, 0.000359283527f,
+    0.000364622305f, 0.00036994525f, 0.000375252217f, 0.000380543002f, 0.000385817402f, 0.000391075213f, 0.00039631626f, 0.000401540368f,
+    0.000406747335f, 0.000411936926f, 0.000417109026f, 0.000422263402f, 0.000427399878f, 0.000432518253f, 0.000437618379f, 0.000442700024f,
+    0.000447763043f, 0.000452807231f, 0.000457832415f, 0.00046283839f, 0.000467825012f, 0.000472792075f, 0.000477739377f, 0.000482666801f,
+    0.000487574143f, 0.0004924612f, 0.000497327826f, 0.000502173789f, 0.000506999029f, 0.000511803257f, 0.000516586355f, 0.000521348149f,
+    0.000526088406f, 0.000530807069f, 0.000535503903f, 0.000540178735f, 0.000544831448f, 0.000549461751f, 0.000554069644f, 0.000558654836f,
+    0.000563217211f, 0.000567756651f, 0.000572272867f, 0.0005767658f, 0.000581235334f, 0.000585681177f, 0.000590103213f, 0.000594501384f,
+    0.000598875398f, 0.00060322514f, 0.000607550552f, 0.000611851341f, 0.000616127392f, 0.000620378647f, 0.000624604814f, 0.000628805894f,
+    0.000632981595f, 0.00063713186f, 0.000641256513f, 0.00064535538f, 0.000649428403f, 0.000653475348f, 0.000657496101f, 0.000661490543f,
+    0.000665458501f, 0.000669399917f, 0.000673314498f, 0.000677202246f, 0.000681062986f, 0.000684896542f, 0.000688702799f, 0.000692481699f,
+    0.000696233008f, 0.00069995661f, 0.000703652448f, 0.000707320345f, 0.000710960128f, 0.000714571739f, 0.000718155061f, 0.000721709919f,
+    0.000725236197f, 0.000728733779f, 0.000732202549f, 0.000735642447f, 0.000739053241f, 0.000742434931f, 0.000745787285f, 0.000749110244f,
+    0.000752403692f, 0.00075566757f, 0.000758901646f, 0.000762105919f, 0.000765280274f, 0.000768424536f, 0.000771538587f, 0.000774622429f,
+    0.000777675828f, 0.000780698785f, 0.000783691183f, 0.000786652847f, 0.000789583777f, 0.000792483799f, 0.000795352797f, 0.000798190769f,
+    0.000800997543f, 0.000803773117f, 0.000806517259f, 0.000809229969f, 0.000811911188f, 0.000814560743f, 0.000817178574f, 0.000819764624f,
+    0.000822318776f, 0.000824840914f, 0.000827331038f, 0.000829789031f, 0.000832214835f, 0.000834608334f, 0.000836969411f, 0.000839298125f,
+    0.000841594243f, 0.000843857764f, 0.000846088689f, 0.000848286785f, 0.00085045211f, 0.000852584548f, 0.00085468404f, 0.000856750528f,
+    0.000858783955f, 0.000860784203f, 0.000862751273f, 0.000864685047f, 0.000866585469f, 0.000868452538f, 0.000870286196f, 0.000872086326f,
+    0.00087385287f, 0.000875585829f, 0.000877285143f, 0.000878950756f, 0.000880582607f, 0.000882180582f, 0.000883744797f, 0.000885275018f,
+    0.000886771362f, 0.000888233655f, 0.000889661955f, 0.000891056203f, 0.000892416283f, 0.000893742254f, 0.000895034056f, 0.000896291574f,
+    0.000897514867f, 0.000898703875f, 0.00089985854f, 0.000900978863f, 0.000902064843f, 0.000903116364f, 0.000904133485f, 0.000905116147f,
+    0.000906064291f, 0.000906977919f, 0.000907857087f, 0.000908701681f, 0.000909511698f, 0.000910287083f, 0.00091102795f, 0.000911734183f,
+    0.000912405783f, 0.00091304275f, 0.000913645024f, 0.000914212724f, 0.000914745673f, 0.000915244047f, 0.000915707671f, 0.000916136603f,
+    0.000916530902f, 0.000916890509f, 0.000917215366f, 0.000917505589f, 0.000917761121f, 0.000917982019f, 0.000918168167f, 0.000918319682f,
+    0.000918436563f, 0.000918518752f, 0.000918566308f, 0.00091857923f, 0.000918557576f, 0.00091850129f, 0.000918410427f, 0.00091828499f,
+    0.000918124977f, 0.000917930447f, 0.000917701458f, 0.000917437894f, 0.000917139929f, 0.000916807505f, 0.000916440622f, 0.000916039397f,
+    0.000915603829f, 0.000915133918f, 0.000914629665f, 0.000914091186f, 0.000913518423f, 0.000912911491f, 0.00091227045f, 0.000911595242f,
+    0.000910885923f, 0.000910142553f, 0.00090936519f, 0.000908553891f, 0.000907708658f, 0.000906829548f, 0.000905916619f, 0.000904969871f,
+    0.000903989421f, 0.000902975269f, 0.000901927531f, 0.000900846149f, 0.000899731298f, 0.000898582919f, 0.000897401187f, 0.000896186044f,
+    0.000894937664f, 0.00089365599f, 0.000892341195f, 0.000890993222f, 0.000889612245f, 0.000888198265f, 0.000886751339f, 0.000885271584f,
+    0.000883759058f, 0.000882213819f, 0.000880635926f, 0.000879025436f, 0.000877382467f, 0.000875707075f, 0.000873999379f, 0.000872259319f,
+    0.000870487129f, 0.000868682808f, 0.000866846472f, 0.000864978123f, 0.000863077992f, 0.000861146022f, 0.000859182328f, 0.000857187086f,
+    0.000855160237f, 0.000853102014f, 0.000851012417f, 0.000848891563f, 0.000846739567f, 0.000844556431f, 0.000842342386f, 0.000840097433f,
+    0.000837821688f, 0.000835515268f, 0.00083317823f, 0.000830810692f, 0.000828412827f, 0.000825984636f, 0.000823526236f, 0.0008210378f,
+    0.000818519329f, 0.000815971056f, 0.00081339298f, 0.000810785277f, 0.000808148005f, 0.000805481337f, 0.000802785333f, 0.000800060108f,
+    0.00079730578f, 0.000794522522f, 0.000791710394f, 0.000788869453f, 0.000785999931f, 0.000783101947f, 0.000780175498f, 0.000777220819f,
+    0.000774238026f, 0.000771227176f, 0.000768188387f, 0.000765121891f, 0.000762027747f, 0.00075890607f, 0.000755756977f, 0.000752580643f,
+    0.000749377185f, 0.000746146718f, 0.000742889417f, 0.000739605341f, 0.000736294722f, 0.00073295756f, 0.000729594147f, 0.000726204482f,
+    0.000722788798f, 0.000719347154f, 0.000715879782f, 0.00071238674f, 0.000708868261f, 0.000705324346f, 0.000701755285f, 0.000698161137f,
+    0.000694542076f, 0.000690898276f, 0.000687229796f, 0.000683536869f, 0.000679819612f, 0.00067607814f, 0.000672312686f, 0.000668523309f,
+    0.000664710242f, 0.0006608736f, 0.000657013501f, 0.000653130177f, 0.000649223686f, 0.00064529432f, 0.000641342078f, 0.000637367251f,
+    0.000633369957f, 0.00062935031f, 0.000625308487f, 0.000621244661f, 0.000617159007f, 0.000613051699f, 0.000608922855f, 0.000604772649f,
+    0.000600601314f, 0.000596408907f, 0.000592195662f, 0.000587961695f, 0.000583707239f, 0.000579432468f, 0.000575137441f, 0.000570822449f,
+    0.000566487608f, 0.000562133093f, 0.000557759078f, 0.000553365739f, 0.00054895319f, 0.000544521725f, 0.000540071458f, 0.000535602507f,
+    0.000531115162f, 0.000526609481f, 0.000522085698f, 0.000517544046f, 0.000512984581f, 0.000508407596f, 0.000503813208f, 0.000499201589f,
+    0.000494572916f, 0.000489927421f, 0.000485265278f, 0.000480586663f, 0.00047589172f, 0.000471180654f, 0.000466453639f, 0.000461710908f,
+    0.000456952577f, 0.00045217888f, 0.00044738999f, 0.000442586082f, 0.000437767361f, 0.000432933972f, 0.000428086176f, 0.00042322409f,
+    0.000418347947f, 0.000413457921f, 0.000408554217f, 0.000403637008f, 0.00039870647f, 0.000393762806f, 0.000388806249f, 0.000383836916f,
+    0.000378855068f, 0.00037386085f, 0.000368854468f, 0.000363836123f, 0.000358805992f, 0.000353764306f, 0.000348711212f, 0.000343646941f,
+    0.00033857167f, 0.000333485601f, 0.000328388938f, 0.000323281856f, 0.000318164559f, 0.000313037279f, 0.000307900133f, 0.000302753411f,
+    0.000297597231f, 0.000292431854f, 0.000287257426f, 0.000282074208f, 0.000276882318f, 0.000271682016f, 0.000266473478f, 0.000261256908f,
+    0.000256032537f, 0.000250800484f, 0.000245561037f, 0.00024031433f, 0.000235060608f, 0.000229800047f, 0.000224532865f, 0.000219259251f,
+    0.000213979409f, 0.000208693527f, 0.00020340184f, 0.000198104521f, 0.000192801774f, 0.000187493817f, 0.00018218084f, 0.000176863046f,
+    0.000171540625f, 0.000166213809f, 0.000160882773f, 0.00015554775f, 0.0001502089f, 0.00014486647f, 0.00013952062f, 0.000134171583f,
+    0.000128819564f, 0.000123464735f, 0.000118107331f, 0.000112747533f, 0.00010738556f, 0.000102021608f, 9.665588e-05f, 9.12885735e-05f,
+    8.5919899e-05f, 8.05500604e-05f, 7.51792468e-05f, 6.98076765e-05f, 6.44355532e-05f, 5.90630625e-05f, 5.36904226e-05f, 4.83178264e-05f,
+    4.29454849e-05f, 3.75735945e-05f, 3.22023589e-05f, 2.68319782e-05f, 2.1462658e-05f, 1.60945983e-05f, 1.07280011e-05f, 5.36306788e-06f,
+    2.56738809e-18f, -5.36100106e-06f, -1.07197338e-05f, -1.60759973e-05f, -2.14295924e-05f, -2.67803152e-05f, -3.21279658e-05f, -3.74723495e-05f,
+    -4.28132589e-05f, -4.81504976e-05f, -5.34838655e-05f, -5.88131625e-05f, -6.41381921e-05f, -6.94587507e-05f, -7.47746381e-05f, -8.00856651e-05f,
+    -8.53916281e-05f, -9.06923306e-05f, -9.59875761e-05f, -0.000101277154f, -0.000106560889f, -0.00011183857f, -0.000117110001f, -0.000122374986f,
+    -0.000127633335f, -0.000132884859f, -0.00013812934f, -0.000143366604f, -0.000148596431f, -0.000153818663f, -0.000159033079f, -0.000164239507f,
+    -0.000169437728f, -0.000174627567f, -0.00017980882f, -0.000184981312f, -0.000190144841f, -0.000195299217f, -0.000200444236f, -0.000205579738f,
+    -0.000210705504f, -0.000215821361f, -0.000220927119f, -0.000226022588f, -0.000231107566f, -0.000236181892f, -0.000241245361f, -0.000246297772f,
+    -0.000251338992f, -0.000256368774f, -0.000261386973f, -0.000266393385f, -0.000271387835f, -0.00027637012f, -0.000281340093f, -0.000286297553f,
+    -0.000291242293f, -0.00029617417f, -0.000301092979f, -0.000305998576f, -0.000310890726f, -0.000315769284f, -0.000320634077f, -0.000325484929f,
+    -0.000330321636f, -0.000335144025f, -0.000339951919f, -0.000344745175f, -0.000349523587f, -0.000354287011f, -0.000359035213f, -0.000363768107f,
+    -0.000368485431f, -0.000373187067f, -0.000377872842f, -0.000382542581f, -0.00038719608f, -0.000391833222f, -0.000396453805f, -0.000401057681f,
+    -0.000405644678f, -0.000410214619f, -0.000414767332f, -0.000419302669f, -0.000423820486f, -0.000428320578f, -0.000432802801f, -0.000437266979f,
+    -0.000441712968f, -0.000446140621f, -0.000450549735f, -0.000454940193f, -0.000459311821f, -0.000463664474f, -0.000467997947f, -0.000472312153f,
+    -0.000476606889f, -0.000480882009f, -0.000485137367f, -0.000489372818f, -0.000493588159f, -0.00049778336f, -0.000501958129f, -0.00050611241f,
+    -0.000510245969f, -0.000514358748f, -0.000518450572f, -0.000522521324f, -0.000526570773f, -0.000530598802f, -0.000534605351f, -0.00053859019f,
+    -0.0005425532f, -0.000546494208f, -0.000550413155f, -0.000554309867f, -0.000558184169f, -0.000562035944f, -0.000565865077f, -0.000569671392f,
+    -0.000573454832f, -0.000577215164f, -0.000580952328f, -0.000584666152f, -0.000588356459f, -0.000592023251f, -0.000595666352f, -0.000599285529f,
+    -0.000602880784f, -0.00060645194f, -0.000609998882f, -0.000613521435f, -0.000617019541f, -0.000620493025f, -0.000623941829f, -0.000627365836f,
+    -0.000630764815f, -0.000634138763f, -0.000637487508f, -0.000640810933f, -0.000644108979f, -0.000647381414f, -0.000650628295f, -0.000653849333f,
+    -0.000657044526f, -0.000660213758f, -0.000663356856f, -0.000666473759f, -0.000669564353f, -0.000672628579f, -0.000675666204f, -0.000678677286f,
+    -0.000681661593f, -0.000684619066f, -0.000687549647f, -0.000690453162f, -0.000693329552f, -0.0006961787f, -0.00069900055f, -0.000701794925f,
+    -0.000704561826f, -0.000707301137f, -0.00071001274f, -0.000712696521f, -0.00071535242f, -0.00071798038f, -0.000720580225f, -0.000723151956f,
+    -0.000725695456f, -0.000728210667f, -0.000730697415f, -0.000733155699f, -0.000735585403f, -0.000737986469f, -0.000740358839f, -0.000742702337f,
+    -0.000745017023f, -0.000747302664f, -0.000749559375f, -0.000751786924f, -0.000753985252f, -0.000756154361f, -0.000758294191f, -0.000760404568f,
+    -0.000762485492f, -0.000764536904f, -0.000766558747f, -0.000768550904f, -0.000770513318f, -0.000772445987f, -0.000774348795f, -0.000776221685f,
+    -0.000778064656f, -0.000779877533f, -0.000781660376f, -0.000783413067f, -0.000785135606f, -0.000786827819f, -0.000788489822f, -0.000790121441f,
+    -0.000791722676f, -0.000793293468f, -0.000794833759f, -0.000796343491f, -0.000797822664f, -0.00079927122f, -0.0008006891f, -0.000802076247f,
+    -0.00080343266f, -0.000804758281f, -0.000806053053f, -0.000807316974f, -0.000808549987f, -0.000809752091f, -0.000810923229f, -0.000812063343f,
+    -0.000813172373f, -0.000814250438f, -0.000815297361f, -0.000816313142f, -0.000817297783f, -0.000818251283f, -0.000819173583f, -0.000820064626f,
+    -0.00082092447f, -0.000821753056f, -0.000822550384f, -0.000823316339f, -0.000824051036f, -0.000824754417f, -0.000825426425f, -0.000826067058f,
+    -0.000826676376f, -0.000827254262f, -0.000827800774f, -0.000828315911f, -0.000828799617f, -0.000829251949f, -0.000829672848f, -0.000830062316f,
+    -0.000830420351f, -0.000830746954f, -0.000831042184f, -0.000831305922f, -0.000831538287f, -0.00083173922f, -0.000831908721f, -0.000832046848f,
+    -0.000832153542f, -0.000832228863f, -0.00083227281f, -0.000832285383f, -0.000832266582f, -0.000832216465f, -0.000832134974f, -0.000832022168f,
+    -0.000831878046f, -0.000831702666f, -0.00083149597f, -0.000831258076f, -0.000830988924f, -0.00083068863f, -0.000830357079f, -0.000829994387f,
+    -0.000829600613f, -0.000829175697f, -0.000828719698f, -0.000828232674f, -0.000827714568f, -0.000827165553f, -0.000826585572f, -0.000825974625f,
+    -0.000825332827f, -0.000824660179f, -0.00082395674f, -0.000823222508f, -0.000822457543f, -0.000821661903f, -0.000820835587f, -0.000819978653f,
+    -0.000819091161f, -0.000818173168f, -0.000817224733f, -0.000816245796f, -0.000815236534f, -0.000814196945f, -0.000813127088f, -0.000812026963f,
+    -0.000810896687f, -0.000809736317f, -0.000808545854f, -0.000807325414f, -0.000806074997f, -0.000804794661f, -0.000803484581f, -0.000802144699f,
+    -0.000800775073f, -0.000799375819f, -0.000797946996f, -0.000796488661f, -0.000795000873f, -0.00079348369f, -0.000791937229f, -0.00079036149f,
+    -0.000788756588f, -0.000787122641f, -0.00078545959f, -0.000783767609f, -0.000782046758f, -0.000780297094f, -0.000778518675f, -0.000776711677f,
+    -0.00077487604f, -0.00077301194f, -0.000771119434f, -0.000769198639f, -0.000767249556f, -0.0007652723f, -0.000763266988f, -0.000761233736f,
+    -0.000759172544f, -0.00075708353f, -0.000754966808f, -0.000752822438f, -0.000750650535f, -0.000748451159f, -0.000746224483f, -0.000743970508f,
+    -0.000741689408f, -0.000739381183f, -0.000737046008f, -0.000734683999f, -0.000732295157f, -0.000729879714f, -0.000727437669f, -0.000724969141f,
+    -0.000722474244f, -0.000719953037f, -0.000717405754f, -0.000714832393f, -0.000712233072f, -0.000709607906f, -0.000706957071f, -0.000704280566f,
+    -0.000701578567f, -0.00069885113f, -0.00069609849f, -0.000693320646f, -0.000690517714f, -0.00068768987f, -0.00068483717f, -0.000681959791f,
+    -0.000679057848f, -0.0006761314f, -0.000673180621f, -0.000670205569f, -0.000667206419f, -0.000664183346f, -0.00066113635f, -0.000658065605f,
+    -0.000654971285f, -0.00065185345f, -0.000648712215f, -0.000645547814f, -0.000642360246f, -0.000639149745f, -0.000635916367f, -0.000632660289f,
+    -0.000629381626f, -0.000626080495f, -0.000622757012f, -0.000619411352f, -0.00061604369f, -0.000612654083f, -0.000609242648f, -0.000605809619f,
+    -0.000602355052f, -0.000598879124f, -0.000595382007f, -0.000591863762f, -0.000588324561f, -0.000584764523f, -0.000581183878f, -0.000577582628f,
+    -0.000573961064f, -0.000570319244f, -0.000566657342f, -0.000562975474f, -0.000559273816f, -0.000555552542f, -0.00055181171f, -0.000548051554f,
+    -0.000544272189f, -0.000540473731f, -0.000536656415f, -0.000532820297f, -0.000528965611f, -0.000525092473f, -0.000521201f, -0.000517291424f,
+    -0.000513363804f, -0.000509418373f, -0.000505455246f, -0.000501474657f, -0.000497476605f, -0.000493461383f, -0.000489429163f, -0.000485379976f,
+    -0.000481314055f, -0.000477231602f, -0.000473132706f, -0.000469017541f, -0.000464886311f, -0.000460739131f, -0.000456576177f, -0.000452397624f,
+    -0.000448203617f, -0.00044399433f, -0.000439769938f, -0.000435530586f, -0.00043127645f, -0.000427007675f, -0.000422724464f, -0.000418426993f,
+    -0.000414115377f, -0.000409789791f, -0.000405450439f, -0.000401097495f, -0.000396731077f, -0.000392351387f, -0.0003879586f, -0.000383552862f,
+    -0.000379134377f, -0.00037470329f, -0.000370259775f, -0.000365804037f, -0.000361336191f, -0.000356856472f, -0.000352364994f, -0.000347861962f,
+    -0.00034334755f, -0.000338821934f, -0.000334285287f, -0.000329737784f, -0.000325179601f, -0.00032061091f, -0.000316031859f, -0.00031144268f,
+    -0.000306843518f, -0.000302234577f, -0.000297615974f, -0.000292987941f, -0.000288350653f, -0.000283704256f, -0.000279048953f, -0.000274384918f,
+    -0.000269712327f, -0.000265031355f, -0.000260342204f, -0.00025564502f, -0.000250940007f, -0.000246227341f, -0.000241507209f, -0.000236779786f,
+    -0.000232045233f, -0.000227303753f, -0.000222555522f, -0.000217800727f, -0.000213039544f, -0.000208272148f, -0.000203498741f, -0.00019871947f,
+    -0.000193934553f, -0.000189144164f, -0.000184348479f, -0.000179547671f, -0.000174741945f, -0.00016993146f, -0.00016511642f, -0.000160297001f,
+    -0.000155473375f, -0.000150645748f, -0.00014581428f, -0.000140979173f, -0.000136140588f, -0.000131298744f, -0.000126453786f, -0.000121605925f,
+    -0.000116755327f, -0.000111902191f, -0.00010704669f, -0.000102189013f, -9.73293427e-05f, -9.24678607e-05f, -8.76047488e-05f, -8.27401964e-05f,
+    -7.78743852e-05f, -7.30075044e-05f, -6.81397214e-05f, -6.32712399e-05f, -5.84022309e-05f, -5.353288e-05f, -4.86633762e-05f, -4.37938943e-05f,
+    -3.8924627e-05f, -3.4055749e-05f, -2.91874494e-05f, -2.43199083e-05f, -1.94533095e-05f, -1.45878375e-05f, -9.72367252e-06f, -4.86099952e-06f,
+    -1.08660761e-17f, 4.8591437e-06f, 9.71624922e-06f, 1.45711338e-05f, 1.94236163e-05f, 2.42735132e-05f, 2.91206452e-05f, 3.39648286e-05f,
+    3.88058834e-05f, 4.36436312e-05f, 4.8477883e-05f, 5.33084676e-05f, 5.8135196e-05f, 6.29578935e-05f, 6.77763819e-05f, 7.25904756e-05f,
+    7.73999927e-05f, 8.22047659e-05f, 8.70045988e-05f, 9.17993311e-05f, 9.65887739e-05f, 0.000101372745f, 0.000106151077f, 0.000110923582f,
+    0.000115690091f, 0.000120450415f, 0.000125204388f, 0.000129951834f, 0.000134692571f, 0.000139426425f, 0.000144153222f, 0.000148872787f,
+    0.000153584944f, 0.000158289506f, 0.000162986325f, 0.0001676752f, 0.000172355969f, 0.000177028473f, 0.000181692507f, 0.000186347927f,
+    0.000190994557f, 0.000195632208f, 0.000200260722f, 0.000204879936f, 0.000209489663f, 0.000214089741f, 0.000218679997f, 0.000223260256f,
+    0.000227830373f, 0.000232390157f, 0.00023693945f, 0.000241478076f, 0.000246005889f, 0.000250522688f, 0.000255028339f, 0.000259522669f,
+    0.000264005503f, 0.000268476666f, 0.000272936013f, 0.000277383398f, 0.000281818648f, 0.000286241557f, 0.000290652009f, 0.000295049831f,
+    0.000299434876f, 0.000303806941f, 0.000308165909f, 0.000312511605f, 0.000316843885f, 0.000321162544f, 0.000325467496f, 0.000329758535f,
+    0.000334035489f, 0.000338298269f, 0.000342546642f, 0.000346780522f, 0.000350999704f, 0.000355204073f, 0.000359393453f, 0.000363567699f,
+    0.000367726636f, 0.000371870148f, 0.00037599809f, 0.000380110287f, 0.000384206593f, 0.000388286862f, 0.00039235095f, 0.000396398682f,
+    0.00040042997f, 0.00040444464f, 0.000408442545f, 0.000412423542f, 0.000416387455f, 0.000420334196f, 0.000424263591f, 0.000428175525f,
+    0.000432069821f, 0.000435946364f, 0.000439805008f, 0.000443645607f, 0.000447468046f, 0.00045127215f, 0.000455057801f, 0.000458824885f,
+    0.000462573254f, 0.000466302765f, 0.00047001327f, 0.000473704684f, 0.000477376831f, 0.000481029623f, 0.000484662858f, 0.000488276477f,
+    0.000491870334f, 0.000495444285f, 0.000498998212f, 0.000502531999f, 0.000506045471f, 0.000509538571f, 0.000513011124f, 0.000516463071f,
+    0.00051989418f, 0.00052330445f, 0.000526693708f, 0.000530061836f, 0.000533408718f, 0.00053673418f, 0.000540038222f, 0.00054332061f,
+    0.000546581345f, 0.000549820194f, 0.000553037098f, 0.000556231942f, 0.000559404667f, 0.00056255504f, 0.000565683062f, 0.000568788615f,
+    0.000571871526f, 0.000574931735f, 0.000577969069f, 0.000580983527f, 0.000583974936f, 0.000586943177f, 0.000589888252f, 0.000592809927f,
+    0.000595708145f, 0.000598582847f, 0.000601433916f, 0.000604261237f, 0.000607064751f, 0.000609844283f, 0.000612599775f, 0.00061533117f,
+    0.00061803835f, 0.000620721199f, 0.000623379659f, 0.000626013614f, 0.000628623005f, 0.000631207658f, 0.000633767631f, 0.000636302691f,
+    0.000638812839f, 0.000641298015f, 0.000643758045f, 0.000646192871f, 0.000648602436f, 0.00065098668f, 0.000653345487f, 0.000655678799f,
+    0.0006579865f, 0.000660268532f, 0.000662524835f, 0.000664755295f, 0.000666959852f, 0.000669138506f, 0.000671291084f, 0.000673417584f,
+    0.000675517891f, 0.000677591946f, 0.000679639692f, 0.000681661069f, 0.000683656021f, 0.000685624429f, 0.000687566237f, 0.000689481443f,
+    0.000691369933f, 0.000693231646f, 0.000695066527f, 0.000696874573f, 0.000698655669f, 0.000700409757f, 0.000702136778f, 0.000703836733f,
+    0.000705509505f, 0.000707155035f, 0.000708773383f, 0.000710364315f, 0.000711927947f, 0.000713464164f, 0.000714972906f, 0.000716454117f,
+    0.000717907795f, 0.000719333882f, 0.000720732321f, 0.000722103112f, 0.000723446137f, 0.000724761398f, 0.000726048893f, 0.000727308507f,
+    0.000728540297f, 0.000729744148f, 0.000730920059f, 0.000732067972f, 0.00073318783f, 0.000734279689f, 0.000735343492f, 0.000736379181f,
+    0.000737386697f, 0.0007383661f, 0.000739317329f, 0.00074024027f, 0.000741135038f, 0.000742001517f, 0.000742839708f, 0.000743649609f,
+    0.000744431221f, 0.000745184487f, 0.000745909347f, 0.00074660586f, 0.000747273967f, 0.000747913728f, 0.000748525024f, 0.000749107858f,
+    0.000749662286f, 0.000750188308f, 0.000750685809f, 0.000751154847f, 0.00075159542f, 0.000752007531f, 0.000752391119f, 0.000752746244f,
+    0.000753072905f, 0.000753371045f, 0.000753640663f, 0.000753881817f, 0.00075409445f, 0.000754278619f, 0.000754434324f, 0.000754561508f,
+    0.000754660286f, 0.000754730543f, 0.000754772336f, 0.000754785724f, 0.000754770648f, 0.000754727109f, 0.000754655164f, 0.000754554872f,
+    0.000754426175f, 0.000754269073f, 0.000754083623f, 0.000753869885f, 0.000753627741f, 0.000753357366f, 0.000753058703f, 0.000752731808f,
+    0.000752376625f, 0.00075199327f, 0.000751581683f, 0.000751141983f, 0.000750674168f, 0.000750178238f, 0.000749654253f, 0.000749102153f,
+    0.000748522114f, 0.000747914077f, 0.0007472781f, 0.000746614183f, 0.000745922443f, 0.000745202822f, 0.000744455436f, 0.000743680226f,
+    0.000742877368f, 0.000742046803f, 0.000741188589f, 0.000740302785f, 0.00073938939f, 0.000738448522f, 0.000737480179f, 0.000736484479f,
+    0.000735461363f, 0.000734410889f, 0.000733333232f, 0.000732228276f, 0.000731096196f, 0.00072993699f, 0.000728750776f, 0.000727537496f,
+    0.000726297323f, 0.000725030201f, 0.000723736244f, 0.000722415571f, 0.000721068121f, 0.000719694071f, 0.000718293421f, 0.000716866227f,
+    0.000715412549f, 0.000713932503f, 0.000712426088f, 0.000710893422f, 0.000709334563f, 0.000707749568f, 0.000706138497f, 0.000704501464f,
+    0.000702838472f, 0.000701149635f, 0.00069943507f, 0.000697694777f, 0.000695928873f, 0.000694137416f, 0.000692320464f, 0.000690478133f,
+    0.000688610482f, 0.000686717569f, 0.000684799568f, 0.000682856422f, 0.000680888363f, 0.000678895332f, 0.000676877506f, 0.000674834941f,
+    0.000672767754f, 0.000670676003f, 0.000668559747f, 0.000666419102f, 0.000664254185f, 0.000662065053f, 0.000659851765f, 0.000657614495f,
+    0.000655353302f, 0.000653068302f, 0.000650759495f, 0.000648427114f, 0.000646071159f, 0.000643691747f, 0.000641288992f, 0.000638863014f,
+    0.00063641381f, 0.000633941614f, 0.000631446484f, 0.000628928479f, 0.000626387715f, 0.000623824366f, 0.000621238432f, 0.000618630089f,
+    0.000615999452f, 0.000613346579f, 0.000610671588f, 0.000607974653f, 0.000605255773f, 0.000602515182f, 0.000599752879f, 0.000596969039f,
+    0.000594163779f, 0.000591337157f, 0.000588489347f, 0.000585620466f, 0.000582730572f, 0.00057981984f, 0.000576888327f, 0.00057393621f,
+    0.000570963603f, 0.000567970565f, 0.000564957329f, 0.000561923895f, 0.000558870437f, 0.000555797073f, 0.000552703976f, 0.000549591205f,
+    0.000546458876f, 0.000543307164f, 0.000540136185f, 0.000536946056f, 0.000533736835f, 0.000530508813f, 0.000527261989f, 0.000523996481f,
+    0.000520712521f, 0.000517410168f, 0.000514089537f, 0.000510750862f, 0.000507394143f, 0.000504019612f, 0.000500627328f, 0.000497217523f,
+    0.000493790198f, 0.000490345643f, 0.000486883859f, 0.000483405049f, 0.000479909329f, 0.000476396875f, 0.000472867774f, 0.0004693222f,
+    0.000465760269f, 0.000462182157f, 0.00045858798f, 0.000454977853f, 0.000451351982f, 0.000447710452f, 0.000444053439f, 0.00044038106f,
+    0.000436693488f, 0.00043299087f, 0.000429273321f, 0.000425540988f, 0.000421794044f, 0.000418032607f, 0.00041425685f, 0.000410466921f,
+    0.000406662934f, 0.000402845064f, 0.000399013457f, 0.000395168259f, 0.000391309644f, 0.000387437729f, 0.000383552659f, 0.000379654608f,
+    0.000375743752f, 0.000371820177f, 0.000367884088f, 0.000363935629f, 0.000359974918f, 0.000356002158f, 0.000352017465f, 0.000348021043f,
+    0.00034401298f, 0.000339993479f, 0.000335962686f, 0.000331920775f, 0.000327867834f, 0.000323804095f, 0.000319729676f, 0.000315644749f,
+    0.000311549491f, 0.000307443988f, 0.000303328474f, 0.000299203093f, 0.000295067992f, 0.000290923315f, 0.000286769238f, 0.000282605906f,
+    0.000278433523f, 0.000274252205f, 0.000270062126f, 0.000265863433f, 0.000261656329f, 0.00025744093f, 0.00025321744f, 0.000248985976f,
+    0.000244746741f, 0.000240499867f, 0.000236245542f, 0.000231983897f, 0.000227715122f, 0.000223439376f, 0.00021915682f, 0.000214867614f,
+    0.000210571932f, 0.00020626992f, 0.000201961753f, 0.000197647605f, 0.000193327636f, 0.000189001992f, 0.000184670862f, 0.000180334391f,
+    0.000175992769f, 0.000171646141f, 0.000167294682f, 0.000162938552f, 0.000158577925f, 0.000154212947f, 0.000149843807f, 0.000145470665f,
+    0.000141093682f, 0.000136713017f, 0.00013232886f, 0.000127941355f, 0.000123550679f, 0.000119157005f, 0.000114760478f, 0.000110361289f,
+    0.000105959582f, 0.000101555546f, 9.71493282e-05f, 9.2741102e-05f, 8.83310422e-05f, 8.3919309e-05f, 7.95060623e-05f, 7.50914842e-05f,
+    7.06757273e-05f, 6.62589664e-05f, 6.18413687e-05f, 5.74230908e-05f, 5.30043108e-05f, 4.85851888e-05f, 4.41658958e-05f, 3.97465956e-05f,
+    3.53274518e-05f, 3.09086354e-05f, 2.64903119e-05f, 2.2072647e-05f, 1.7655806e-05f, 1.32399537e-05f, 8.8252591e-06f, 4.41188558e-06f,
+    -2.81992716e-18f, -4.41023258e-06f, -8.81864617e-06f, -1.32250761e-05f, -1.76293579e-05f, -2.2031325e-05f, -2.64308128e-05f, -3.08276576e-05f,
+    -3.52216921e-05f, -3.9612758e-05f, -4.40006843e-05f, -4.83853109e-05f, -5.27664706e-05f, -5.71440069e-05f, -6.15177487e-05f, -6.5887536e-05f,
+    -7.02531979e-05f, -7.46145888e-05f, -7.89715341e-05f, -8.33238737e-05f, -8.76714403e-05f, -9.2014081e-05f, -9.63516286e-05f, -0.000100683923f,
+    -0.000105010804f, -0.000109332112f, -0.000113647686f, -0.000117957359f, -0.000122260986f, -0.000126558385f, -0.00013084941f, -0.000135133901f,
+    -0.000139411699f, -0.000143682657f, -0.000147946586f, -0.000152203371f, -0.000156452807f, -0.000160694777f, -0.000164929093f, -0.000169155624f,
+    -0.000173374196f, -0.000177584661f, -0.000181786862f, -0.000185980651f, -0.000190165854f, -0.000194342341f, -0.000198509937f, -0.000202668496f,
+    -0.000206817873f, -0.000210957907f, -0.000215088454f, -0.000219209338f, -0.000223320443f, -0.000227421595f, -0.000231512633f, -0.000235593441f,
+    -0.00023966383f, -0.000243723684f, -0.000247772841f, -0.000251811143f, -0.000255838473f, -0.000259854627f, -0.000263859518f, -0.000267852971f,
+    -0.000271834841f, -0.000275804981f, -0.000279763248f, -0.000283709494f, -0.000287643605f, -0.000291565375f, -0.000295474718f, -0.000299371459f,
+    -0.000303255481f, -0.00030712664f, -0.00031098476f, -0.000314829755f, -0.000318661419f, -0.000322479696f, -0.000326284353f, -0.000330075331f,
+    -0.000333852455f, -0.00033761558f, -0.00034136459f, -0.000345099339f, -0.000348819711f, -0.00035252556f, -0.000356216711f, -0.000359893107f,
+    -0.000363554544f, -0.000367200933f, -0.00037083216f, -0.00037444802f, -0.000378048455f, -0.00038163329f, -0.000385202409f, -0.000388755696f,
+    -0.000392293034f, -0.000395814248f, -0.000399319251f, -0.000402807898f, -0.000406280073f, -0.000409735658f, -0.000413174508f, -0.000416596537f,
+    -0.000420001568f, -0.000423389545f, -0.000426760264f, -0.000430113694f, -0.000433449663f, -0.000436768052f, -0.000440068747f, -0.000443351659f,
+    -0.000446616643f, -0.000449863554f, -0.000453092362f, -0.000456302863f, -0.000459495001f, -0.000462668628f, -0.000465823658f, -0.000468959945f,
+    -0.000472077401f, -0.000475175941f, -0.000478255417f, -0.000481315714f, -0.000484356773f, -0.00048737842f, -0.000490380626f, -0.000493363186f,
+    -0.000496326131f, -0.000499269227f, -0.000502192415f, -0.000505095581f, -0.000507978722f, -0.00051084155f, -0.000513684179f, -0.000516506319f,
+    -0.000519307971f, -0.000522089016f, -0.000524849398f, -0.000527588942f, -0.000530307647f, -0.000533005339f, -0.000535681902f, -0.000538337335f,
+    -0.000540971523f, -0.000543584349f, -0.000546175695f, -0.000548745506f, -0.00055129372f, -0.000553820224f, -0.0005563249f, -0.000558807689f,
+    -0.000561268535f, -0.000563707319f, -0.000566123927f, -0.000568518357f, -0.000570890435f, -0.000573240162f, -0.000575567421f, -0.000577872153f,
+    -0.000580154243f, -0.000582413631f, -0.000584650261f, -0.000586864015f, -0.000589054835f, -0.000591222662f, -0.00059336744f, -0.000595489051f,
+    -0.000597587437f, -0.00059966254f, -0.000601714244f, -0.000603742606f, -0.000605747395f, -0.000607728667f, -0.000609686307f, -0.000611620257f,
+    -0.000613530457f, -0.000615416793f, -0.000617279264f, -0.000619117811f, -0.000620932376f, -0.000622722844f, -0.000624489214f, -0.000626231427f,
+    -0.000627949368f, -0.000629643037f, -0.000631312316f, -0.000632957264f, -0.000634577707f, -0.000636173645f, -0.000637745077f, -0.000639291888f,
+    -0.000640814018f, -0.000642311468f, -0.00064378418f, -0.000645232096f, -0.000646655157f, -0.000648053305f, -0.00064942654f, -0.000650774862f,
+    -0.000652098097f, -0.000653396302f, -0.00065466942f, -0.000655917451f, -0.000657140277f, -0.000658337842f, -0.00065951026f, -0.000660657359f,
+    -0.000661779137f, -0.000662875595f, -0.000663946674f, -0.000664992316f, -0.00066601258f, -0.000667007349f, -0.000667976623f, -0.000668920344f,
+    -0.00066983857f, -0.000670731242f, -0.000671598245f, -0.000672439695f, -0.000673255476f, -0.000674045645f, -0.000674810086f, -0.000675548799f,
+    -0.000676261843f, -0.000676949159f, -0.000677610689f, -0.000678246433f, -0.00067885645f, -0.00067944068f, -0.000679999066f, -0.000680531608f,
+    -0.000681038364f, -0.000681519276f, -0.000681974285f, -0.000682403508f, -0.000682806829f, -0.000683184306f, -0.00068353588f, -0.00068386161f,
+    -0.000684161438f, -0.000684435421f, -0.000684683502f, -0.000684905681f, -0.000685102015f, -0.000685272447f, -0.000685417035f, -0.000685535721f,
+    -0.000685628562f, -0.000685695501f, -0.000685736653f, -0.000685751904f, -0.000685741368f, -0.000685704988f, -0.000685642823f, -0.000685554813f,
+    -0.000685441017f, -0.000685301435f, -0.000685136125f, -0.000684945029f, -0.000684728264f, -0.000684485771f, -0.00068421755f, -0.000683923659f,
+    -0.000683604158f, -0.000683258986f, -0.000682888262f, -0.000682491926f, -0.000682069978f, -0.000681622536f, -0.000681149599f, -0.000680651166f,
+    -0.000680127298f, -0.000679577992f, -0.000679003308f, -0.000678403245f, -0.000677777862f, -0.000677127158f, -0.000676451193f, -0.000675750023f,
+    -0.00067502365f, -0.000674272131f, -0.000673495466f, -0.000672693714f, -0.000671866932f, -0.000671015179f, -0.000670138455f, -0.000669236819f,
+    -0.000668310269f, -0.000667358923f, -0.000666382781f, -0.0006653819f, -0.000664356339f, -0.000663306098f, -0.000662231294f, -0.000661131926f,
+    -0.000660008052f, -0.00065885979f, -0.00065768708f, -0.00065649004f, -0.000655268726f, -0.000654023141f, -0.000652753457f, -0.000651459617f,
+    -0.000650141679f, -0.00064879976f, -0.000647433917f, -0.000646044209f, -0.000644630636f, -0.000643193373f, -0.00064173236f, -0.000640247716f,
+    -0.000638739497f, -0.000637207762f, -0.000635652628f, -0.000634074153f, -0.000632472336f, -0.000630847237f, -0.000629199028f, -0.00062752777f,
+    -0.000625833403f, -0.000624116161f, -0.000622376043f, -0.000620613049f, -0.000618827413f, -0.000617019075f, -0.000615188153f, -0.000613334763f,
+    -0.000611458963f, -0.000609560811f, -0.000607640366f, -0.000605697802f, -0.000603733119f, -0.000601746375f, -0.000599737745f, -0.000597707287f,
+    -0.000595655001f, -0.000593581062f, -0.000591485528f, -0.000589368457f, -0.000587230024f, -0.000585070229f, -0.000582889188f, -0.000580687018f,
+    -0.000578463776f, -0.000576219521f, -0.000573954429f, -0.000571668555f, -0.000569361961f, -0.000567034818f, -0.000564687129f, -0.000562319066f,
+    -0.000559930631f, -0.000557522057f, -0.000555093342f, -0.000552644604f, -0.000550175959f, -0.000547687523f, -0.000545179355f, -0.000542651513f,
+    -0.000540104229f, -0.000537537562f, -0.000534951512f, -0.000532346312f, -0.00052972202f, -0.000527078693f, -0.000524416566f, -0.000521735579f,
+    -0.000519035966f, -0.000516317785f, -0.00051358121f, -0.000510826241f, -0.000508053054f, -0.000505261705f, -0.000502452429f, -0.000499625225f,
+    -0.000496780209f, -0.000493917556f, -0.000491037325f, -0.000488139689f, -0.000485224737f, -0.000482292555f, -0.000479343289f, -0.000476377027f,
+    -0.000473393942f, -0.000470394094f, -0.000467377657f, -0.000464344717f, -0.000461295393f, -0.000458229799f, -0.000455148082f, -0.000452050357f,
+    -0.000448936742f, -0.000445807353f, -0.000442662305f, -0.000439501775f, -0.000436325819f, -0.000433134584f, -0.000429928245f, -0.000426706858f,
+    -0.00042347057f, -0.000420219527f, -0.000416953873f, -0.000413673668f, -0.000410379114f, -0.0004070703f, -0.00040374737f, -0.000400410441f,
+    -0.000397059659f, -0.00039369514f, -0.000390317029f, -0.000386925443f, -0.000383520557f, -0.000380102458f, -0.000376671262f, -0.000373227173f,
+    -0.000369770278f, -0.000366300723f, -0.000362818624f, -0.000359324127f, -0.000355817407f, -0.00035229855f, -0.000348767702f, -0.000345225038f,
+    -0.000341670646f, -0.00033810467f, -0.000334527285f, -0.000330938608f, -0.000327338756f, -0.000323727931f, -0.000320106192f, -0.000316473743f,
+    -0.0003128307f, -0.000309177209f, -0.000305513386f, -0.000301839435f, -0.000298155413f, -0.000294461526f, -0.000290757918f, -0.000287044677f,
+    -0.000283322006f, -0.000279590022f, -0.000275848841f, -0.000272098667f, -0.000268339616f, -0.000264571805f, -0.000260795408f, -0.000257010601f,
+    -0.000253217469f, -0.000249416189f, -0.000245606905f, -0.000241789749f, -0.000237964879f, -0.000234132458f, -0.0002302926f, -0.000226445482f,
+    -0.000222591232f, -0.000218730012f, -0.000214861953f, -0.000210987215f, -0.000207105957f, -0.000203218297f, -0.000199324408f, -0.000195424422f,
+    -0.000191518513f, -0.000187606798f, -0.000183689452f, -0.000179766619f, -0.000175838431f, -0.000171905063f, -0.00016796666f, -0.000164023353f,
+    -0.000160075317f, -0.000156122682f, -0.000152165609f, -0.000148204243f, -0.000144238744f, -0.000140269243f, -0.000136295916f, -0.000132318906f,
+    -0.000128338361f, -0.000124354425f, -0.000120367251f, -0.000116377007f, -0.000112383823f, -0.000108387867f, -0.000104389277f, -0.000100388213f,
+    -9.63848288e-05f, -9.23792686e-05f, -8.83716784e-05f, -8.43622256e-05f, -8.03510557e-05f, -7.63383141e-05f, -7.2324161e-05f, -6.83087419e-05f,
+    -6.42922096e-05f, -6.02747168e-05f, -5.62564164e-05f, -5.22374576e-05f, -4.8217993e-05f, -4.4198172e-05f, -4.01781472e-05f, -3.61580715e-05f,
+    -3.21380976e-05f, -2.81183711e-05f, -2.40990485e-05f, -2.0080277e-05f, -1.60622094e-05f, -1.20449977e-05f, -8.02879185e-06f, -4.01374245e-06f,
+    -4.48530829e-18f, 4.01228453e-06f, 8.02296017e-06f, 1.20318782e-05f, 1.60388863e-05f, 2.00438353e-05f, 2.40465761e-05f, 2.80469576e-05f,
+    3.20448307e-05f, 3.60400481e-05f, 4.00324534e-05f, 4.40219046e-05f, 4.8008249e-05f, 5.1991341e-05f, 5.59710279e-05f, 5.99471641e-05f,
+    6.39196005e-05f, 6.78881843e-05f, 7.18527735e-05f, 7.58132228e-05f, 7.9769372e-05f, 8.372109e-05f, 8.7668217e-05f, 9.16106146e-05f,
+    9.554813e-05f, 9.94806251e-05f, 0.00010340794f, 0.000107329943f, 0.000111246474f, 0.000115157403f, 0.000119062577f, 0.00012296185f,
+    0.000126855084f, 0.000130742119f, 0.000134622824f, 0.000138497067f, 0.000142364675f, 0.000146225531f, 0.000150079475f, 0.000153926376f,
+    0.000157766073f, 0.000161598451f, 0.000165423349f, 0.000169240637f, 0.000173050168f, 0.000176851812f, 0.000180645409f, 0.000184430828f,
+    0.000188207938f, 0.000191976578f, 0.000195736648f, 0.000199487971f, 0.000203230418f, 0.000206963872f, 0.000210688173f, 0.00021440319f,
+    0.000218108791f, 0.000221804832f, 0.000225491196f, 0.000229167723f, 0.000232834296f, 0.00023649077f, 0.000240137029f, 0.000243772913f,
+    0.000247398304f, 0.000251013058f, 0.000254617073f, 0.000258210173f, 0.000261792273f, 0.000265363225f, 0.000268922857f, 0.000272471108f,
+    0.000276007806f, 0.000279532833f, 0.000283046043f, 0.000286547351f, 0.00029003658f, 0.000293513644f, 0.000296978396f, 0.000300430693f,
+    0.000303870445f, 0.000307297509f, 0.000310711766f, 0.000314113073f, 0.000317501341f, 0.000320876425f, 0.000324238208f, 0.000327586575f,
+    0.000330921379f, 0.000334242533f, 0.000337549893f, 0.00034084334f, 0.00034412276f, 0.000347388064f, 0.000350639079f, 0.000353875745f,
+    0.000357097888f, 0.00036030545f, 0.000363498257f, 0.00036667625f, 0.000369839254f, 0.000372987211f, 0.000376120006f, 0.000379237492f,
+    0.000382339553f, 0.00038542613f, 0.00038849705f, 0.000391552254f, 0.000394591596f, 0.000397614989f, 0.000400622317f, 0.000403613492f,
+    0.00040658837f, 0.000409546861f, 0.00041248888f, 0.00041541431f, 0.000418323005f, 0.000421214936f, 0.000424089958f, 0.000426947954f,
+    0.000429788866f, 0.000432612549f, 0.000435418944f, 0.000438207935f, 0.000440979406f, 0.000443733268f, 0.000446469436f, 0.000449187792f,
+    0.000451888278f, 0.000454570749f, 0.000457235146f, 0.000459881383f, 0.000462509342f, 0.000465118937f, 0.000467710051f, 0.000470282655f,
+    0.000472836604f, 0.000475371839f, 0.000477888272f, 0.000480385788f, 0.0004828643f, 0.000485323748f, 0.000487764046f, 0.000490185106f,
+    0.000492586812f, 0.000494969136f, 0.000497331959f, 0.000499675167f, 0.000501998758f, 0.000504302559f, 0.00050658657f, 0.000508850673f,
+    0.000511094811f, 0.000513318926f, 0.000515522901f, 0.00051770662f, 0.000519870082f, 0.00052201323f, 0.000524135947f, 0.000526238116f,
+    0.000528319739f, 0.000530380697f, 0.000532420992f, 0.000534440449f, 0.000536439067f, 0.000538416789f, 0.000540373498f, 0.000542309193f,
+    0.00054422376f, 0.000546117139f, 0.000547989272f, 0.000549840101f, 0.000551669509f, 0.000553477556f, 0.000555264065f, 0.000557029096f,
+    0.000558772474f, 0.00056049414f, 0.000562194153f, 0.000563872338f, 0.000565528695f, 0.000567163166f, 0.000568775693f, 0.000570366217f,
+    0.000571934739f, 0.000573481084f, 0.00057500531f, 0.000576507358f, 0.000577987172f, 0.000579444633f, 0.000580879801f, 0.00058229256f,
+    0.00058368285f, 0.00058505073f, 0.000586396025f, 0.000587718794f, 0.000589018979f, 0.000590296462f, 0.000591551303f, 0.000592783384f,
+    0.000593992707f, 0.00059517927f, 0.000596342958f, 0.00059748377f, 0.000598601648f, 0.00059969665f, 0.000600768602f, 0.000601817621f,
+    0.000602843589f, 0.000603846449f, 0.0006048262f, 0.000605782901f, 0.000606716378f, 0.000607626687f, 0.00060851383f, 0.00060937769f,
+    0.000610218325f, 0.000611035677f, 0.000611829688f, 0.000612600415f, 0.000613347802f, 0.000614071789f, 0.000614772376f, 0.000615449622f,
+    0.000616103411f, 0.0006167338f, 0.000617340731f, 0.000617924146f, 0.000618484162f, 0.000619020604f, 0.000619533588f, 0.000620023056f,
+    0.000620489009f, 0.000620931445f, 0.000621350307f, 0.000621745596f, 0.000622117368f, 0.000622465624f, 0.000622790249f, 0.000623091299f,
+    0.000623368833f, 0.000623622735f, 0.00062385312f, 0.000624059874f, 0.000624243054f, 0.000624402717f, 0.000624538749f, 0.000624651264f,
+    0.000624740205f, 0.000624805572f, 0.000624847366f, 0.000624865643f, 0.000624860346f, 0.000624831591f, 0.000624779263f, 0.000624703418f,
+    0.000624604116f, 0.000624481298f, 0.000624335022f, 0.000624165288f, 0.000623972097f, 0.000623755506f, 0.000623515458f, 0.00062325201f,
+    0.000622965221f, 0.00062265509f, 0.000622321561f, 0.000621964748f, 0.000621584652f, 0.000621181272f, 0.000620754668f, 0.000620304781f,
+    0.000619831728f, 0.000619335508f, 0.000618816179f, 0.000618273683f, 0.00061770808f, 0.000617119425f, 0.000616507779f, 0.000615873083f,
+    0.000615215453f, 0.000614534889f, 0.000613831391f, 0.000613105076f, 0.000612355885f, 0.000611583935f, 0.000610789226f, 0.000609971758f,
+    0.000609131646f, 0.000608268892f, 0.000607383496f, 0.000606475631f, 0.000605545181f, 0.000604592264f, 0.000603616936f, 0.000602619199f,
+    0.000601599109f, 0.000600556785f, 0.000599492167f, 0.000598405371f, 0.000597296399f, 0.000596165366f, 0.000595012272f, 0.000593837118f,
+    0.000592640077f, 0.000591421151f, 0.000590180396f, 0.000588917814f, 0.00058763352f, 0.000586327573f, 0.000584999972f, 0.000583650835f,
+    0.000582280161f, 0.000580888067f, 0.00057947461f, 0.000578039791f, 0.000576583727f, 0.000575106475f, 0.000573608093f, 0.00057208864f,
+    0.000570548174f, 0.000568986812f, 0.000567404495f, 0.000565801398f, 0.000564177579f, 0.000562533096f, 0.000560868008f, 0.000559182372f,
+    0.000557476247f, 0.000555749808f, 0.000554002996f, 0.000552235928f, 0.00055044872f, 0.000548641372f, 0.000546814059f, 0.000544966781f,
+    0.000543099595f, 0.000541212677f, 0.000539306027f, 0.000537379703f, 0.000535433879f, 0.000533468497f, 0.000531483791f, 0.000529479759f,
+    0.000527456461f, 0.000525414071f, 0.000523352588f, 0.00052127213f, 0.000519172754f, 0.000517054577f, 0.000514917658f, 0.00051276217f,
+    0.000510588055f, 0.000508395548f, 0.000506184588f, 0.000503955409f, 0.000501708011f, 0.000499442511f, 0.000497159024f, 0.00049485761f,
+    0.000492538384f, 0.000490201404f, 0.000487846788f, 0.000485474622f, 0.000483085052f, 0.000480678107f, 0.000478253904f, 0.000475812529f,
+    0.000473354128f, 0.00047087876f, 0.000468386512f, 0.0004658775f, 0.000463351869f, 0.00046080965f, 0.000458250957f, 0.000455675938f,
+    0.000453084649f, 0.000450477208f, 0.00044785373f, 0.000445214304f, 0.000442559045f, 0.000439888041f, 0.000437201408f, 0.000434499292f,
+    0.000431781722f, 0.000429048872f, 0.000426300801f, 0.000423537684f, 0.000420759548f, 0.00041796657f, 0.000415158807f, 0.000412336405f,
+    0.00040949948f, 0.00040664812f, 0.000403782469f, 0.000400902587f, 0.000398008648f, 0.000395100709f, 0.000392178947f, 0.000389243418f,
+    0.000386294269f, 0.000383331586f, 0.000380355516f, 0.000377366203f, 0.000374363677f, 0.000371348142f, 0.000368319656f, 0.000365278393f,
+    0.000362224411f, 0.000359157886f, 0.000356078875f, 0.000352987554f, 0.000349884038f, 0.000346768415f, 0.00034364083f, 0.000340501399f,
+    0.00033735027f, 0.000334187498f, 0.000331013289f, 0.0003278277f, 0.000324630877f, 0.000321422965f, 0.000318204082f, 0.000314974313f,
+    0.000311733835f, 0.000308482762f, 0.000305221183f, 0.000301949272f, 0.000298667117f, 0.000295374863f, 0.000292072655f, 0.00028876061f,
+    0.000285438815f, 0.000282107474f, 0.000278766645f, 0.000275416503f, 0.000272057136f, 0.000268688716f, 0.000265311362f, 0.00026192519f,
+    0.000258530345f, 0.000255126943f, 0.00025171513f, 0.000248295022f, 0.000244866736f, 0.000241430462f, 0.000237986285f, 0.000234534353f,
+    0.00023107478f, 0.000227607728f, 0.000224133313f, 0.000220651666f, 0.000217162917f, 0.000213667226f, 0.000210164697f, 0.000206655473f,
+    0.000203139702f, 0.000199617498f, 0.000196089008f, 0.000192554362f, 0.000189013706f, 0.000185467157f, 0.00018191486f, 0.000178356961f,
+    0.000174793575f, 0.000171224849f, 0.000167650927f, 0.000164071927f, 0.000160488009f, 0.000156899288f, 0.000153305897f, 0.000149708008f,
+    0.000146105711f, 0.000142499179f, 0.000138888528f, 0.00013527392f, 0.000131655455f, 0.000128033309f, 0.000124407597f, 0.000120778459f,
+    0.000117146039f, 0.000113510469f, 0.000109871886f, 0.000106230429f, 0.000102586244f, 9.89394612e-05f, 9.52902192e-05f, 9.16386634e-05f,
+    8.79849176e-05f, 8.43291346e-05f, 8.06714379e-05f, 7.70119805e-05f, 7.33508932e-05f, 6.96883144e-05f, 6.60243895e-05f, 6.23592423e-05f,
+    5.86930255e-05f, 5.50258701e-05f, 5.13579143e-05f, 4.76892965e-05f, 4.40201584e-05f, 4.03506347e-05f, 3.66808672e-05f, 3.30109906e-05f,
+    2.93411431e-05f, 2.56714648e-05f, 2.20020902e-05f, 1.83331613e-05f, 1.46648154e-05f, 1.09971879e-05f, 7.3304177e-06f, 3.66464246e-06f,
+    1.05328026e-17f, -3.66337258e-06f, -7.32533772e-06f, -1.09857583e-05f, -1.46444972e-05f, -1.83014181e-05f, -2.19563826e-05f, -2.56092535e-05f,
+    -2.92598961e-05f, -3.2908174e-05f, -3.6553949e-05f, -4.01970829e-05f, -4.38374445e-05f, -4.74748958e-05f, -5.11093021e-05f, -5.47405252e-05f,
+    -5.83684305e-05f, -6.19928833e-05f, -6.5613749e-05f, -6.92308895e-05f, -7.28441737e-05f, -7.64534634e-05f, -8.00586276e-05f, -8.36595354e-05f,
+    -8.72560413e-05f, -9.08480215e-05f, -9.44353451e-05f, -9.80178665e-05f, -0.000101595462f, -0.000105167994f, -0.00010873533f, -0.000112297348f,
+    -0.000115853902f, -0.000119404867f, -0.000122950107f, -0.000126489496f, -0.000130022905f, -0.000133550187f, -0.000137071227f, -0.000140585893f,
+    -0.000144094054f, -0.00014759558f, -0.000151090338f, -0.0001545782f, -0.000158059047f, -0.000161532735f, -0.000164999146f, -0.000168458151f,
+    -0.000171909618f, -0.000175353416f, -0.000178789429f, -0.000182217525f, -0.000185637589f, -0.000189049475f, -0.000192453066f, -0.000195848246f,
+    -0.00019923487f, -0.000202612835f, -0.000205982011f, -0.000209342266f, -0.000212693485f, -0.000216035536f, -0.000219368303f, -0.000222691669f,
+    -0.000226005504f, -0.000229309691f, -0.000232604099f, -0.000235888627f, -0.000239163128f, -0.000242427515f, -0.000245681644f, -0.000248925411f,
+    -0.000252158672f, -0.000255381339f, -0.000258593267f, -0.000261794368f, -0.000264984526f, -0.000268163596f, -0.00027133149f, -0.000274488062f,
+    -0.000277633226f, -0.000280766835f, -0.000283888803f, -0.000286999042f, -0.000290097378f, -0.000293183723f, -0.000296257989f, -0.000299320032f,
+    -0.000302369765f, -0.00030540704f, -0.000308431801f, -0.000311443902f, -0.000314443256f, -0.000317429716f, -0.000320403225f, -0.000323363638f,
+    -0.000326310867f, -0.000329244795f, -0.000332165335f, -0.000335072342f, -0.000337965757f, -0.000340845436f, -0.000343711319f, -0.000346563262f,
+    -0.000349401176f, -0.000352224975f, -0.000355034543f, -0.000357829762f, -0.000360610575f, -0.000363376836f, -0.000366128486f, -0.000368865411f,
+    -0.000371587521f, -0.000374294672f, -0.000376986834f, -0.000379663863f, -0.000382325699f, -0.000384972227f, -0.00038760333f, -0.000390218978f,
+    -0.000392819027f, -0.000395403389f, -0.000397971977f, -0.000400524703f, -0.00040306148f, -0.000405582221f, -0.000408086809f, -0.000410575187f,
+    -0.000413047266f, -0.000415502931f, -0.000417942152f, -0.000420364755f, -0.00042277074f, -0.00042515996f, -0.000427532388f, -0.000429887878f,
+    -0.000432226399f, -0.000434547837f, -0.000436852104f, -0.00043913917f, -0.00044140892f, -0.000443661265f, -0.000445896119f, -0.000448113453f,
+    -0.000450313149f, -0.000452495122f, -0.000454659341f, -0.00045680569f, -0.000458934112f, -0.000461044547f, -0.000463136879f, -0.00046521108f,
+    -0.000467267033f, -0.000469304709f, -0.00047132402f, -0.000473324908f, -0.000475307286f, -0.000477271096f, -0.000479216251f, -0.000481142721f,
+    -0.000483050419f, -0.000484939257f, -0.000486809207f, -0.000488660182f, -0.000490492152f, -0.000492305029f, -0.000494098756f, -0.000495873275f,
+    -0.000497628469f, -0.000499364396f, -0.000501080882f, -0.000502777984f, -0.000504455529f, -0.000506113516f, -0.000507751887f, -0.000509370584f,
+    -0.000510969548f, -0.000512548722f, -0.000514108106f, -0.000515647582f, -0.000517167093f, -0.000518666639f, -0.000520146161f, -0.000521605543f,
+    -0.000523044844f, -0.000524463947f, -0.000525862852f, -0.000527241442f, -0.000528599718f, -0.000529937679f, -0.000531255209f, -0.000532552251f,
+    -0.000533828861f, -0.000535084866f, -0.000536320382f, -0.000537535234f, -0.000538729422f, -0.000539903005f, -0.000541055808f, -0.00054218783f,
+    -0.000543299073f, -0.000544389477f, -0.000545459043f, -0.000546507712f, -0.000547535426f, -0.000548542186f, -0.000549527933f, -0.000550492667f,
+    -0.000551436329f, -0.000552358979f, -0.000553260441f, -0.000554140832f, -0.000555000035f, -0.000555838051f, -0.000556654879f, -0.000557450403f,
+    -0.00055822474f, -0.000558977772f, -0.000559709501f, -0.000560419925f, -0.000561108987f, -0.000561776746f, -0.000562423083f, -0.000563048001f,
+    -0.000563651556f, -0.000564233691f, -0.000564794347f, -0.000565333583f, -0.00056585134f, -0.000566347619f, -0.00056682236f, -0.000567275682f,
+    -0.000567707466f, -0.000568117714f, -0.000568506424f, -0.000568873598f, -0.000569219294f, -0.000569543394f, -0.000569845899f, -0.000570126926f,
+    -0.000570386357f, -0.000570624194f, -0.000570840552f, -0.000571035256f, -0.000571208424f, -0.000571360055f, -0.000571490091f, -0.00057159859f,
+    -0.000571685552f, -0.000571750919f, -0.00057179475f, -0.000571817043f, -0.0005718178f, -0.00057179702f, -0.000571754761f, -0.000571690907f,
+    -0.000571605633f, -0.000571498822f, -0.000571370532f, -0.000571220822f, -0.000571049575f, -0.000570856966f, -0.000570642878f, -0.00057040737f,
+    -0.0005701505f, -0.000569872209f, -0.000569572614f, -0.000569251657f, -0.000568909338f, -0.000568545773f, -0.000568160904f, -0.000567754731f,
+    -0.00056732737f, -0.000566878763f, -0.000566408969f, -0.000565917988f, -0.000565405935f, -0.000564872695f, -0.000564318383f, -0.000563743059f,
+    -0.000563146663f, -0.000562529254f, -0.000561890891f, -0.000561231573f, -0.000560551358f, -0.000559850305f, -0.000559128355f, -0.000558385625f,
+    -0.000557622057f, -0.000556837826f, -0.000556032872f, -0.000555207254f, -0.000554360973f, -0.000553494145f, -0.000552606769f, -0.000551698904f,
+    -0.000550770492f, -0.000549821707f, -0.000548852549f, -0.000547863077f, -0.000546853233f, -0.00054582319f, -0.000544772949f, -0.00054370251f,
+    -0.00054261199f, -0.000541501387f, -0.000540370762f, -0.000539220171f, -0.000538049673f, -0.000536859327f, -0.000535649189f, -0.000534419203f,
+    -0.000533169601f, -0.000531900267f, -0.000530611374f, -0.000529302924f, -0.000527974975f, -0.000526627584f, -0.00052526081f, -0.000523874769f,
+    -0.000522469403f, -0.000521044887f, -0.000519601221f, -0.000518138462f, -0.00051665667f, -0.000515155902f, -0.000513636274f, -0.000512097846f,
+    -0.000510540558f, -0.000508964644f, -0.000507370103f, -0.000505756936f, -0.000504125259f, -0.000502475188f, -0.000500806724f, -0.000499119982f,
+    -0.000497415022f, -0.0004956919f, -0.000493950618f, -0.000492191408f, -0.000490414212f, -0.000488619145f, -0.000486806268f, -0.000484975695f,
+    -0.000483127456f, -0.000481261639f, -0.000479378301f, -0.000477477588f, -0.0004755595f, -0.000473624154f, -0.000471671607f, -0.000469701976f,
+    -0.00046771529f, -0.000465711666f, -0.000463691162f, -0.000461653894f, -0.00045959992f, -0.000457529299f, -0.000455442147f, -0.000453338551f,
+    -0.00045121857f, -0.000449082319f, -0.000446929887f, -0.000444761303f, -0.000442576711f, -0.0004403762f, -0.000438159797f, -0.00043592765f,
+    -0.000433679845f, -0.00043141644f, -0.000429137552f, -0.000426843268f, -0.000424533675f, -0.000422208832f, -0.000419868884f, -0.000417513918f,
+    -0.000415143993f, -0.000412759226f, -0.000410359702f, -0.000407945539f, -0.000405516796f, -0.000403073616f, -0.000400616031f, -0.000398144213f,
+    -0.000395658193f, -0.000393158116f, -0.000390644069f, -0.00038811611f, -0.000385574414f, -0.000383019011f, -0.000380450045f, -0.000377867604f,
+    -0.000375271804f, -0.000372662733f, -0.000370040478f, -0.000367405155f, -0.000364756852f, -0.000362095714f, -0.000359421829f, -0.000356735283f,
+    -0.000354036194f, -0.000351324648f, -0.000348600792f, -0.000345864712f, -0.000343116495f, -0.000340356259f, -0.000337584148f, -0.000334800221f,
+    -0.000332004623f, -0.000329197414f, -0.000326378766f, -0.000323548738f, -0.000320707477f, -0.000317855069f, -0.00031499163f, -0.000312117278f,
+    -0.000309232128f, -0.000306336267f, -0.000303429842f, -0.00030051294f, -0.000297585677f, -0.000294648198f, -0.000291700562f, -0.000288742944f,
+    -0.000285775401f, -0.000282798079f, -0.000279811095f, -0.000276814535f, -0.000273808575f, -0.000270793273f, -0.000267768744f, -0.000264735165f,
+    -0.000261692592f, -0.000258641172f, -0.000255581021f, -0.000252512255f, -0.000249434961f, -0.000246349315f, -0.000243255388f, -0.000240153327f,
+    -0.000237043234f, -0.000233925239f, -0.000230799458f, -0.000227666023f, -0.000224525036f, -0.000221376613f, -0.000218220899f, -0.000215057997f,
+    -0.000211888037f, -0.000208711135f, -0.000205527424f, -0.000202337003f, -0.00019914002f, -0.000195936576f, -0.000192726802f, -0.000189510829f,
+    -0.000186288773f, -0.000183060751f, -0.000179826893f, -0.000176587331f, -0.000173342167f, -0.000170091545f, -0.000166835584f, -0.000163574397f,
+    -0.000160308118f, -0.000157036877f, -0.000153760775f, -0.000150479973f, -0.000147194572f, -0.00014390469f, -0.000140610471f, -0.000137312032f,
+    -0.000134009504f, -0.000130703003f, -0.000127392661f, -0.000124078593f, -0.000120760946f, -0.000117439828f, -0.00011411537f, -0.000110787703f,
+    -0.000107456945f, -0.000104123232f, -0.000100786674f, -9.74474169e-05f, -9.41055769e-05f, -9.07612775e-05f, -8.74146499e-05f, -8.40658176e-05f,
+    -8.0714919e-05f, -7.73620632e-05f, -7.40073883e-05f, -7.06510182e-05f, -6.72930764e-05f, -6.3933694e-05f, -6.05729983e-05f, -5.7211113e-05f,
+    -5.38481654e-05f, -5.04842828e-05f, -4.71195926e-05f, -4.37542221e-05f, -4.0388295e-05f, -3.70219386e-05f, -3.36552839e-05f, -3.02884528e-05f,
+    -2.69215743e-05f, -2.35547741e-05f, -2.01881794e-05f, -1.68219176e-05f, -1.34561124e-05f, -1.00908919e-05f, -6.7263818e-06f, -3.36270932e-06f,
+    1.35668445e-21f, 3.36161997e-06f, 6.72202441e-06f, 1.00810876e-05f, 1.34386837e-05f, 1.67946873e-05f, 2.01489711e-05f, 2.35014122e-05f,
+    2.68518834e-05f, 3.02002591e-05f, 3.35464138e-05f, 3.68902256e-05f, 4.02315673e-05f, 4.35703114e-05f, 4.6906338e-05f, 5.02395233e-05f,
+    5.35697363e-05f, 5.68968571e-05f, 6.0220762e-05f, 6.35413235e-05f, 6.68584253e-05f, 7.01719327e-05f, 7.34817368e-05f, 7.67876991e-05f,
+    8.00897033e-05f, 8.33876329e-05f, 8.66813571e-05f, 8.9970752e-05f, 9.32557014e-05f, 9.65360814e-05f, 9.98117685e-05f, 0.000103082646f,
+    0.000106348583f, 0.000109609471f, 0.000112865178f, 0.000116115581f, 0.000119360571f, 0.000122600031f, 0.000125833816f, 0.000129061838f,
+    0.000132283953f, 0.000135500057f, 0.00013871002f, 0.000141913726f, 0.000145111073f, 0.000148301915f, 0.000151486151f, 0.000154663663f,
+    0.000157834322f, 0.000160998039f, 0.000164154655f, 0.000167304097f, 0.000170446219f, 0.00017358092f, 0.000176708083f, 0.000179827577f,
+    0.000182939315f, 0.000186043151f, 0.000189138998f, 0.000192226726f, 0.000195306231f, 0.000198377398f, 0.000201440111f, 0.000204494252f,
+    0.000207539721f, 0.0002105764f, 0.000213604188f, 0.000216622953f, 0.000219632595f, 0.000222633011f, 0.000225624084f, 0.000228605699f,
+    0.000231577767f, 0.000234540159f, 0.000237492772f, 0.000240435504f, 0.000243368238f, 0.000246290874f, 0.000249203295f, 0.000252105412f,
+    0.00025499711f, 0.000257878302f, 0.000260748842f, 0.000263608643f, 0.000266457617f, 0.000269295648f, 0.000272122648f, 0.000274938502f,
+    0.000277743093f, 0.000280536333f, 0.000283318135f, 0.000286088354f, 0.000288846961f, 0.00029159378f, 0.000294328755f, 0.000297051796f,
+    0.00029976276f, 0.000302461587f, 0.000305148191f, 0.000307822425f, 0.000310484204f, 0.000313133467f, 0.000315770099f, 0.000318394013f,
+    0.000321005093f, 0.00032360325f, 0.000326188427f, 0.000328760478f, 0.000331319345f, 0.000333864911f, 0.000336397119f, 0.000338915852f,
+    0.000341421022f, 0.000343912543f, 0.000346390327f, 0.000348854286f, 0.000351304334f, 0.000353740383f, 0.000356162316f, 0.000358570105f,
+    0.000360963604f, 0.000363342755f, 0.000365707499f, 0.000368057721f, 0.000370393333f, 0.000372714247f, 0.000375020405f, 0.000377311721f,
+    0.000379588106f, 0.000381849473f, 0.000384095765f, 0.000386326865f, 0.000388542743f, 0.000390743284f, 0.000392928399f, 0.000395098032f,
+    0.000397252123f, 0.000399390585f, 0.000401513331f, 0.000403620274f, 0.000405711355f, 0.000407786516f, 0.00040984567f, 0.00041188873f,
+    0.000413915666f, 0.000415926363f, 0.000417920761f, 0.000419898803f, 0.00042186043f, 0.000423805555f, 0.000425734092f, 0.000427646009f,
+    0.000429541222f, 0.00043141967f, 0.000433281268f, 0.000435125985f, 0.000436953735f, 0.000438764459f, 0.000440558098f, 0.000442334596f,
+    0.000444093865f, 0.000445835874f, 0.000447560538f, 0.000449267827f, 0.000450957683f, 0.000452629989f, 0.000454284775f, 0.000455921894f,
+    0.000457541377f, 0.000459143106f, 0.000460727053f, 0.000462293159f, 0.000463841367f, 0.000465371617f, 0.000466883881f, 0.000468378101f,
+    0.000469854218f, 0.000471312174f, 0.000472751941f, 0.000474173459f, 0.000475576671f, 0.000476961548f, 0.00047832806f, 0.000479676091f,
+    0.000481005671f, 0.00048231674f, 0.000483609212f, 0.000484883087f, 0.000486138306f, 0.00048737484f, 0.000488592661f, 0.000489791681f,
+    0.000490971899f, 0.000492133258f, 0.0004932757f, 0.000494399283f, 0.000495503889f, 0.000496589462f, 0.000497656001f, 0.000498703506f,
+    0.000499731919f, 0.000500741124f, 0.000501731236f, 0.00050270214f, 0.000503653835f, 0.000504586205f, 0.000505499367f, 0.000506393204f,
+    0.000507267658f, 0.000508122786f, 0.000508958474f, 0.000509774778f, 0.000510571641f, 0.000511349062f, 0.000512106926f, 0.000512845349f,
+    0.000513564155f, 0.000514263462f, 0.000514943211f, 0.000515603344f, 0.000516243861f, 0.000516864704f, 0.000517465931f, 0.000518047542f,
+    0.00051860942f, 0.000519151567f, 0.000519674097f, 0.000520176836f, 0.000520659843f, 0.000521123118f, 0.000521566661f, 0.000521990412f,
+    0.000522394374f, 0.000522778544f, 0.000523142924f, 0.000523487455f, 0.000523812254f, 0.000524117204f, 0.000524402305f, 0.000524667616f,
+    0.000524913077f, 0.00052513869f, 0.000525344512f, 0.000525530486f, 0.000525696611f, 0.000525842886f, 0.000525969313f, 0.000526075892f,
+    0.000526162679f, 0.000526229618f, 0.000526276766f, 0.000526304008f, 0.000526311516f, 0.000526299176f, 0.000526266987f, 0.000526215066f,
+    0.000526143354f, 0.000526051794f, 0.000525940501f, 0.000525809475f, 0.000525658659f, 0.000525488169f, 0.000525297888f, 0.000525087875f,
+    0.000524858246f, 0.000524608884f, 0.000524339848f, 0.000524051138f, 0.000523742812f, 0.000523414928f, 0.000523067371f, 0.000522700255f,
+    0.000522313581f, 0.00052190735f, 0.000521481619f, 0.000521036389f, 0.000520571717f, 0.000520087546f, 0.000519583991f, 0.000519060995f,
+    0.000518518616f, 0.000517956913f, 0.000517375884f, 0.000516775588f, 0.000516156026f, 0.000515517197f, 0.000514859159f, 0.000514181971f,
+    0.000513485633f, 0.000512770144f, 0.000512035622f, 0.000511282007f, 0.000510509417f, 0.000509717851f, 0.000508907367f, 0.000508077908f,
+    0.000507229648f, 0.000506362529f, 0.000505476608f, 0.000504571944f, 0.000503648596f, 0.000502706564f, 0.000501745846f, 0.000500766619f,
+    0.000499768765f, 0.000498752459f, 0.000497717701f, 0.000496664492f, 0.000495592947f, 0.000494503067f, 0.000493394909f, 0.000492268475f,
+    0.000491123938f, 0.00048996124f, 0.000488780439f, 0.000487581594f, 0.000486364792f, 0.000485130033f, 0.000483877433f, 0.000482606963f,
+    0.000481318741f, 0.000480012794f, 0.00047868918f, 0.00047734796f, 0.000475989189f, 0.000474612898f, 0.000473219174f, 0.000471808075f,
+    0.000470379629f, 0.000468933926f, 0.000467471022f, 0.000465990975f, 0.000464493845f, 0.000462979689f, 0.000461448566f, 0.000459900533f,
+    0.000458335679f, 0.000456754031f, 0.000455155678f, 0.000453540706f, 0.000451909145f, 0.000450261083f, 0.000448596547f, 0.000446915656f,
+    0.000445218466f, 0.000443505036f, 0.000441775424f, 0.000440029718f, 0.000438267976f, 0.000436490285f, 0.000434696703f, 0.000432887289f,
+    0.000431062159f, 0.000429221371f, 0.000427364954f, 0.000425493054f, 0.00042360567f, 0.000421702949f, 0.000419784919f, 0.000417851697f,
+    0.000415903312f, 0.000413939881f, 0.00041196146f, 0.00040996811f, 0.000407959975f, 0.000405937084f, 0.000403899525f, 0.000401847385f,
+    0.000399780751f, 0.000397699681f, 0.000395604293f, 0.000393494644f, 0.000391370821f, 0.000389232911f, 0.000387081032f, 0.000384915213f,
+    0.000382735539f, 0.000380542158f, 0.000378335099f, 0.000376114476f, 0.000373880379f, 0.000371632894f, 0.000369372079f, 0.000367098051f,
+    0.000364810898f, 0.000362510706f, 0.000360197591f, 0.000357871584f, 0.000355532829f, 0.000353181415f, 0.000350817398f, 0.000348440895f,
+    0.000346051995f, 0.000343650812f, 0.000341237406f, 0.000338811864f, 0.000336374331f, 0.000333924865f, 0.000331463583f, 0.000328990573f,
+    0.000326505891f, 0.000324009714f, 0.00032150207f, 0.000318983075f, 0.000316452846f, 0.000313911471f, 0.000311359065f, 0.000308795687f,
+    0.000306221482f, 0.000303636509f, 0.000301040884f, 0.000298434723f, 0.000295818085f, 0.000293191144f, 0.00029055393f, 0.000287906587f,
+    0.000285249203f, 0.000282581896f, 0.000279904722f, 0.000277217856f, 0.000274521328f, 0.000271815312f, 0.000269099866f, 0.000266375107f,
+    0.000263641123f, 0.000260898058f, 0.000258145999f, 0.000255385065f, 0.000252615311f, 0.000249836914f, 0.000247049931f, 0.000244254479f,
+    0.000241450689f, 0.000238638648f, 0.000235818457f, 0.000232990249f, 0.000230154124f, 0.000227310171f, 0.000224458534f, 0.000221599286f,
+    0.000218732559f, 0.000215858468f, 0.000212977102f, 0.00021008859f, 0.000207193021f, 0.00020429054f, 0.000201381219f, 0.000198465204f,
+    0.000195542583f, 0.000192613486f, 0.000189678001f, 0.000186736259f, 0.000183788376f, 0.000180834453f, 0.000177874608f, 0.000174908942f,
+    0.000171937587f, 0.000168960643f, 0.000165978228f, 0.000162990458f, 0.000159997449f, 0.000156999304f, 0.000153996138f, 0.000150988082f,
+    0.000147975239f, 0.000144957725f, 0.000141935656f, 0.000138909134f, 0.00013587829f, 0.000132843241f, 0.000129804088f, 0.000126760962f,
+    0.000123713966f, 0.000120663215f, 0.000117608834f, 0.000114550938f, 0.000111489637f, 0.000108425047f, 0.000105357285f, 0.000102286474f,
+    9.92127243e-05f, 9.61361511e-05f, 9.30568785e-05f, 8.99750157e-05f, 8.68906791e-05f, 8.3803985e-05f, 8.07150573e-05f, 7.76240049e-05f,
+    7.45309444e-05f, 7.14359994e-05f, 6.83392864e-05f, 6.52409144e-05f, 6.21410072e-05f, 5.90396739e-05f, 5.59370419e-05f, 5.28332203e-05f,
+    4.9728329e-05f, 4.66224883e-05f, 4.35158072e-05f, 4.04084094e-05f, 3.73004113e-05f, 3.41919258e-05f, 3.10830728e-05f, 2.7973967e-05f,
+    2.48647284e-05f, 2.17554734e-05f, 1.86463167e-05f, 1.55373764e-05f, 1.24287681e-05f, 9.32060993e-06f, 6.21301842e-06f, 3.10610949e-06f,
+    5.45530412e-18f, -3.10519385e-06f, -6.20935543e-06f, -9.31236809e-06f, -1.24141161e-05f, -1.55144844e-05f, -1.86133548e-05f, -2.17106117e-05f,
+    -2.48061406e-05f, -2.78998232e-05f, -3.09915486e-05f, -3.4081193e-05f, -3.7168651e-05f, -4.02537989e-05f, -4.33365276e-05f, -4.64167169e-05f,
+    -4.94942542e-05f, -5.25690266e-05f, -5.56409177e-05f, -5.87098111e-05f, -6.17755941e-05f, -6.48381538e-05f, -6.78973738e-05f, -7.09531378e-05f,
+    -7.40053365e-05f, -7.70538536e-05f, -8.00985799e-05f, -8.31393991e-05f, -8.61761946e-05f, -8.92088647e-05f, -9.22372783e-05f, -9.52613409e-05f,
+    -9.82809361e-05f, -0.00010129594f, -0.000104306251f, -0.00010731176f, -0.00011031235f, -0.000113307906f, -0.000116298324f, -0.000119283497f,
+    -0.0001222633f, -0.000125237639f, -0.000128206389f, -0.00013116945f, -0.000134126705f, -0.000137078052f, -0.000140023374f, -0.000142962585f,
+    -0.000145895538f, -0.000148822146f, -0.000151742308f, -0.000154655907f, -0.000157562841f, -0.00016046298f, -0.00016335625f, -0.00016624252f,
+    -0.000169121704f, -0.000171993684f, -0.000174858345f, -0.000177715599f, -0.00018056533f, -0.00018340745f, -0.000186241828f, -0.000189068363f,
+    -0.000191886982f, -0.000194697554f, -0.000197499976f, -0.000200294147f, -0.000203079981f, -0.000205857359f, -0.000208626181f, -0.000211386345f,
+    -0.000214137763f, -0.000216880318f, -0.00021961391f, -0.000222338451f, -0.000225053838f, -0.000227759971f, -0.000230456732f, -0.000233144048f,
+    -0.000235821819f, -0.000238489927f, -0.0002411483f, -0.000243796821f, -0.000246435404f, -0.000249063945f, -0.000251682359f, -0.000254290528f,
+    -0.000256888394f, -0.000259475841f, -0.000262052752f, -0.00026461907f, -0.000267174706f, -0.000269719516f, -0.00027225347f, -0.000274776423f,
+    -0.000277288316f, -0.000279789063f, -0.000282278546f, -0.000284756708f, -0.000287223404f, -0.000289678603f, -0.000292122189f, -0.000294554076f,
+    -0.000296974176f, -0.000299382402f, -0.000301778695f, -0.00030416291f, -0.000306534988f, -0.000308894872f, -0.000311242446f, -0.000313577621f,
+    -0.000315900339f, -0.000318210485f, -0.000320507999f, -0.000322792795f, -0.000325064786f, -0.000327323884f, -0.00032957003f, -0.000331803109f,
+    -0.000334023061f, -0.00033622983f, -0.000338423299f, -0.000340603408f, -0.000342770072f, -0.000344923203f, -0.000347062742f, -0.000349188631f,
+    -0.000351300754f, -0.000353399053f, -0.00035548344f, -0.000357553858f, -0.000359610247f, -0.000361652492f, -0.000363680563f, -0.000365694345f,
+    -0.000367693807f, -0.000369678863f, -0.000371649425f, -0.000373605435f, -0.000375546835f, -0.000377473567f, -0.000379385514f, -0.000381282647f,
+    -0.000383164908f, -0.000385032181f, -0.000386884465f, -0.000388721644f, -0.00039054369f, -0.000392350485f, -0.000394142029f, -0.000395918207f,
+    -0.000397679018f, -0.000399424316f, -0.000401154131f, -0.000402868318f, -0.000404566876f, -0.000406249746f, -0.000407916814f, -0.000409568078f,
+    -0.000411203451f, -0.000412822876f, -0.000414426322f, -0.000416013732f, -0.000417585019f, -0.000419140124f, -0.000420679047f, -0.000422201701f,
+    -0.000423708028f, -0.00042519797f, -0.000426671497f, -0.000428128551f, -0.000429569103f, -0.000430993037f, -0.000432400382f, -0.00043379105f,
+    -0.000435165013f, -0.000436522183f, -0.00043786256f, -0.000439186086f, -0.000440492702f, -0.000441782351f, -0.000443055033f, -0.000444310688f,
+    -0.00044554926f, -0.000446770719f, -0.000447975035f, -0.000449162122f, -0.000450332009f, -0.000451484579f, -0.000452619861f, -0.000453737797f,
+    -0.000454838329f, -0.000455921429f, -0.000456987065f, -0.000458035211f, -0.000459065835f, -0.000460078882f, -0.000461074349f, -0.00046205218f,
+    -0.000463012344f, -0.000463954784f, -0.000464879529f, -0.000465786521f, -0.00046667573f, -0.000467547128f, -0.000468400685f, -0.000469236373f,
+    -0.00047005419f, -0.00047085408f, -0.000471636013f, -0.000472399988f, -0.000473145978f, -0.000473873923f, -0.000474583852f, -0.000475275738f,
+    -0.00047594955f, -0.00047660523f, -0.000477242807f, -0.000477862253f, -0.000478463538f, -0.000479046663f, -0.000479611568f, -0.000480158313f,
+    -0.000480686809f, -0.000481197058f, -0.000481689087f, -0.00048216281f, -0.000482618285f, -0.000483055483f, -0.000483474374f, -0.000483874959f,
+    -0.000484257209f, -0.000484621123f, -0.000484966731f, -0.000485293975f, -0.000485602854f, -0.000485893397f, -0.000486165576f, -0.000486419362f,
+    -0.000486654782f, -0.000486871839f, -0.000487070502f, -0.000487250771f, -0.000487412675f, -0.000487556186f, -0.000487681333f, -0.000487788056f,
+    -0.000487876416f, -0.000487946381f, -0.000487997982f, -0.00048803119f, -0.000488046033f, -0.000488042511f, -0.000488020625f, -0.000487980375f,
+    -0.000487921789f, -0.000487844838f, -0.000487749581f, -0.00048763596f, -0.000487504061f, -0.000487353827f, -0.000487185287f, -0.000486998499f,
+    -0.000486793404f, -0.000486570061f, -0.00048632847f, -0.00048606866f, -0.000485790602f, -0.000485494384f, -0.000485179946f, -0.000484847347f,
+    -0.000484496588f, -0.000484127697f, -0.000483740703f, -0.000483335607f, -0.000482912437f, -0.000482471223f, -0.000482011965f, -0.000481534691f,
+    -0.00048103946f, -0.000480526243f, -0.000479995069f, -0.000479445996f, -0.000478879054f, -0.000478294212f, -0.000477691559f, -0.000477071095f,
+    -0.000476432848f, -0.000475776847f, -0.000475103123f, -0.000474411732f, -0.000473702647f, -0.000472975953f, -0.000472231652f, -0.000471469772f,
+    -0.0004706904f, -0.000469893508f, -0.000469079154f, -0.000468247366f, -0.000467398204f, -0.000466531666f, -0.000465647841f, -0.000464746729f,
+    -0.000463828357f, -0.000462892785f, -0.000461940072f, -0.000460970245f, -0.000459983305f, -0.000458979368f, -0.000457958406f, -0.000456920505f,
+    -0.000455865695f, -0.000454794004f, -0.000453705521f, -0.000452600245f, -0.000451478263f, -0.000450339576f, -0.00044918427f, -0.000448012375f,
+    -0.00044682392f, -0.000445618993f, -0.00044439765f, -0.000443159894f, -0.00044190581f, -0.000440635427f, -0.000439348834f, -0.00043804606f,
+    -0.000436727132f, -0.000435392139f, -0.00043404114f, -0.000432674191f, -0.000431291293f, -0.000429892592f, -0.000428478059f, -0.000427047809f,
+    -0.000425601873f, -0.000424140308f, -0.000422663201f, -0.000421170553f, -0.000419662509f, -0.000418139069f, -0.000416600291f, -0.000415046263f,
+    -0.000413477072f, -0.000411892717f, -0.000410293287f, -0.000408678869f, -0.00040704952f, -0.000405405299f, -0.000403746264f, -0.000402072474f,
+    -0.000400384015f, -0.000398680946f, -0.000396963354f, -0.000395231269f, -0.000393484806f, -0.000391723996f, -0.000389948924f, -0.000388159649f,
+    -0.00038635626f, -0.000384538813f, -0.000382707425f, -0.000380862097f, -0.000379002944f, -0.000377130025f, -0.000375243428f, -0.000373343239f,
+    -0.000371429487f, -0.00036950229f, -0.000367561734f, -0.000365607848f, -0.00036364072f, -0.000361660437f, -0.000359667116f, -0.000357660756f,
+    -0.000355641503f, -0.000353609415f, -0.000351564551f, -0.000349507027f, -0.0003474369f, -0.000345354259f, -0.000343259191f, -0.000341151754f,
+    -0.000339032063f, -0.000336900179f, -0.000334756187f, -0.000332600175f, -0.000330432231f, -0.000328252412f, -0.000326060865f, -0.000323857617f,
+    -0.000321642787f, -0.000319416431f, -0.000317178667f, -0.000314929552f, -0.000312669203f, -0.000310397678f, -0.000308115123f, -0.000305821537f,
+    -0.000303517096f, -0.000301201828f, -0.00029887585f, -0.000296539249f, -0.000294192112f, -0.000291834556f, -0.00028946664f, -0.000287088449f,
+    -0.000284700101f, -0.000282301655f, -0.000279893255f, -0.000277474959f, -0.000275046885f, -0.00027260909f, -0.00027016169f, -0.000267704774f,
+    -0.000265238428f, -0.000262762769f, -0.000260277884f, -0.00025778389f, -0.000255280844f, -0.000252768834f, -0.000250248006f, -0.000247718446f,
+    -0.000245180214f, -0.000242633439f, -0.00024007821f, -0.000237514614f, -0.000234942781f, -0.000232362785f, -0.000229774727f, -0.000227178709f,
+    -0.000224574847f, -0.000221963201f, -0.000219343914f, -0.000216717061f, -0.000214082756f, -0.000211441089f, -0.00020879216f, -0.000206136086f,
+    -0.000203472955f, -0.000200802868f, -0.000198125941f, -0.000195442262f, -0.000192751933f, -0.000190055071f, -0.000187351761f, -0.000184642122f,
+    -0.000181926254f, -0.00017920426f, -0.000176476227f, -0.000173742286f, -0.000171002524f, -0.000168257058f, -0.000165505975f, -0.000162749391f,
+    -0.000159987409f, -0.000157220144f, -0.000154447684f, -0.00015167013f, -0.000148887615f, -0.000146100225f, -0.000143308076f, -0.000140511271f,
+    -0.000137709911f, -0.000134904098f, -0.000132093948f, -0.000129279579f, -0.000126461076f, -0.000123638543f, -0.000120812118f, -0.000117981879f,
+    -0.000115147945f, -0.000112310416f, -0.000109469409f, -0.000106625026f, -0.000103777376f, -0.000100926569f, -9.80727054e-05f, -9.52159025e-05f,
+    -9.2356262e-05f, -8.94939003e-05f, -8.6628912e-05f, -8.37614134e-05f, -8.08915138e-05f, -7.80193222e-05f, -7.51449479e-05f, -7.22684927e-05f,
+    -6.93900656e-05f, -6.65097832e-05f, -6.36277473e-05f, -6.07440707e-05f, -5.78588588e-05f, -5.49722208e-05f, -5.20842659e-05f, -4.91951032e-05f,
+    -4.63048455e-05f, -4.34135945e-05f, -4.05214596e-05f, -3.7628557e-05f, -3.47349887e-05f, -3.18408675e-05f, -2.89462969e-05f, -2.60513898e-05f,
+    -2.31562553e-05f, -2.02610008e-05f, -1.73657372e-05f, -1.44705691e-05f, -1.15756075e-05f, -8.6809614e-06f, -5.78673962e-06f, -2.89304944e-06f,
+    -1.01635558e-17f, 2.89230002e-06f, 5.78374284e-06f, 8.67421932e-06f, 1.15636212e-05f, 1.44518417e-05f, 1.73387707e-05f, 2.02243009e-05f,
+    2.3108325e-05f, 2.59907356e-05f, 2.88714218e-05f, 3.17502781e-05f, 3.46271991e-05f, 3.75020718e-05f, 4.03747945e-05f, 4.3245258e-05f,
+    4.61133532e-05f, 4.89789745e-05f, 5.18420129e-05f, 5.47023665e-05f, 5.75599224e-05f, 6.04145789e-05f, 6.32662268e-05f, 6.61147642e-05f,
+    6.89600784e-05f, 7.18020674e-05f, 7.46406222e-05f, 7.74756409e-05f, 8.03070143e-05f, 8.31346406e-05f, 8.59584179e-05f, 8.87782298e-05f,
+    9.15939818e-05f, 9.44055646e-05f, 9.72128764e-05f, 0.000100015808f, 0.000102814265f, 0.000105608131f, 0.000108397304f, 0.000111181696f,
+    0.000113961185f, 0.000116735675f, 0.000119505065f, 0.000122269252f, 0.000125028135f, 0.000127781605f, 0.000130529559f, 0.000133271911f,
+    0.000136008544f, 0.000138739357f, 0.000141464261f, 0.000144183141f, 0.000146895909f, 0.000149602449f, 0.000152302688f, 0.000154996495f,
+    0.000157683797f, 0.000160364463f, 0.000163038436f, 0.000165705569f, 0.000168365805f, 0.000171019041f, 0.000173665147f, 0.000176304064f,
+    0.000178935661f, 0.000181559866f, 0.000184176577f, 0.000186785692f, 0.000189387123f, 0.000191980755f, 0.000194566528f, 0.000197144313f,
+    0.000199714021f, 0.000202275565f, 0.000204828859f, 0.0002073738f, 0.0002099103f, 0.000212438244f, 0.000214957574f, 0.000217468172f,
+    0.000219969952f, 0.000222462826f, 0.000224946692f, 0.000227421478f, 0.000229887082f, 0.000232343416f, 0.000234790394f, 0.000237227912f,
+    0.000239655885f, 0.000242074238f, 0.000244482886f, 0.000246881711f, 0.000249270641f, 0.000251649617f, 0.000254018494f, 0.000256377243f,
+    0.000258725748f, 0.00026106392f, 0.000263391703f, 0.000265708979f, 0.000268015661f, 0.000270311692f, 0.000272596983f, 0.000274871447f,
+    0.000277134997f, 0.000279387546f, 0.000281629036f, 0.00028385935f, 0.00028607843f, 0.000288286188f, 0.000290482567f, 0.00029266745f,
+    0.000294840778f, 0.000297002465f, 0.000299152452f, 0.000301290653f, 0.000303416979f, 0.000305531343f, 0.000307633687f, 0.000309723953f,
+    0.000311802025f, 0.000313867844f, 0.000315921352f, 0.000317962462f, 0.000319991115f, 0.000322007196f, 0.000324010674f, 0.000326001464f,
+    0.000327979506f, 0.000329944683f, 0.000331896998f, 0.000333836302f, 0.000335762597f, 0.000337675767f, 0.000339575752f, 0.000341462495f,
+    0.000343335938f, 0.000345195993f, 0.000347042602f, 0.000348875677f, 0.000350695191f, 0.000352501054f, 0.00035429321f, 0.0003560716f,
+    0.000357836136f, 0.000359586789f, 0.000361323473f, 0.000363046129f, 0.000364754727f, 0.000366449152f, 0.000368129375f, 0.000369795365f,
+    0.000371447008f, 0.000373084244f, 0.000374707073f, 0.000376315409f, 0.000377909164f, 0.000379488338f, 0.000381052843f, 0.000382602593f,
+    0.000384137616f, 0.000385657768f, 0.000387163047f, 0.000388653396f, 0.000390128786f, 0.000391589099f, 0.000393034337f, 0.000394464412f,
+    0.000395879324f, 0.000397278985f, 0.000398663367f, 0.000400032382f, 0.000401386031f, 0.000402724254f, 0.000404046994f, 0.000405354192f,
+    0.00040664585f, 0.000407921878f, 0.000409182248f, 0.000410426903f, 0.000411655841f, 0.000412868976f, 0.000414066279f, 0.00041524772f,
+    0.000416413241f, 0.000417562842f, 0.000418696436f, 0.000419813994f, 0.000420915487f, 0.000422000885f, 0.000423070131f, 0.000424123195f,
+    0.000425160077f, 0.00042618069f, 0.000427185005f, 0.000428173022f, 0.000429144711f, 0.000430099986f, 0.000431038876f, 0.000431961322f,
+    0.000432867266f, 0.000433756737f, 0.000434629648f, 0.000435486028f, 0.00043632579f, 0.000437148934f, 0.000437955459f, 0.000438745279f,
+    0.000439518422f, 0.00044027486f, 0.000441014534f, 0.000441737415f, 0.000442443532f, 0.000443132827f, 0.0004438053f, 0.000444460893f,
+    0.000445099606f, 0.000445721438f, 0.000446326332f, 0.000446914317f, 0.000447485334f, 0.000448039384f, 0.000448576437f, 0.000449096493f,
+    0.000449599524f, 0.000450085499f, 0.000450554449f, 0.000451006345f, 0.000451441156f, 0.000451858883f, 0.000452259497f, 0.000452643028f,
+    0.000453009416f, 0.000453358691f, 0.000453690795f, 0.000454005785f, 0.000454303605f, 0.000454584282f, 0.000454847788f, 0.000455094094f,
+    0.000455323228f, 0.000455535192f, 0.000455729984f, 0.000455907546f, 0.000456067937f, 0.000456211157f, 0.000456337148f, 0.000456445938f,
+    0.000456537557f, 0.000456611975f, 0.000456669193f, 0.000456709211f, 0.000456732028f, 0.000456737675f, 0.000456726149f, 0.000456697424f,
+    0.000456651556f, 0.000456588488f, 0.000456508278f, 0.000456410897f, 0.000456296402f, 0.000456164737f, 0.000456015958f, 0.000455850066f,
+    0.000455667061f, 0.000455466943f, 0.000455249741f, 0.000455015484f, 0.000454764173f, 0.000454495777f, 0.000454210385f, 0.000453907967f,
+    0.000453588524f, 0.000453252112f, 0.000452898734f, 0.000452528388f, 0.000452141103f, 0.000451736909f, 0.000451315835f, 0.00045087788f,
+    0.000450423046f, 0.000449951389f, 0.00044946291f, 0.000448957639f, 0.000448435603f, 0.000447896833f, 0.000447341328f, 0.000446769118f,
+    0.00044618026f, 0.000445574755f, 0.000444952602f, 0.00044431389f, 0.000443658617f, 0.000442986784f, 0.000442298449f, 0.000441593642f,
+    0.000440872391f, 0.000440134725f, 0.000439380703f, 0.000438610296f, 0.00043782359f, 0.000437020586f, 0.000436201313f, 0.000435365859f,
+    0.000434514222f, 0.000433646404f, 0.000432762521f, 0.000431862543f, 0.000430946529f, 0.000430014537f, 0.000429066567f, 0.000428102678f,
+    0.000427122926f, 0.000426127313f, 0.000425115926f, 0.000424088794f, 0.000423045916f, 0.000421987381f, 0.000420913217f, 0.000419823482f,
+    0.000418718206f, 0.000417597446f, 0.000416461233f, 0.000415309594f, 0.000414142618f, 0.000412960333f, 0.000411762798f, 0.000410550041f,
+    0.000409322151f, 0.000408079126f, 0.000406821026f, 0.000405547937f, 0.000404259888f, 0.00040295691f, 0.000401639118f, 0.000400306482f,
+    0.000398959121f, 0.000397597061f, 0.000396220334f, 0.000394829054f, 0.000393423252f, 0.000392002956f, 0.000390568224f, 0.000389119174f,
+    0.000387655804f, 0.000386178173f, 0.000384686369f, 0.00038318045f, 0.000381660473f, 0.000380126468f, 0.000378578523f, 0.000377016695f,
+    0.000375441043f, 0.000373851624f, 0.000372248527f, 0.000370631809f, 0.0003690015f, 0.000367357687f, 0.000365700427f, 0.000364029809f,
+    0.000362345862f, 0.000360648701f, 0.000358938327f, 0.000357214856f, 0.000355478376f, 0.000353728887f, 0.000351966504f, 0.000350191287f,
+    0.000348403293f, 0.00034660261f, 0.000344789325f, 0.000342963467f, 0.000341125124f, 0.000339274353f, 0.000337411271f, 0.000335535908f,
+    0.000333648379f, 0.000331748684f, 0.00032983697f, 0.000327913294f, 0.000325977715f, 0.000324030319f, 0.000322071166f, 0.000320100371f,
+    0.000318117964f, 0.000316124031f, 0.00031411869f, 0.000312101969f, 0.000310073956f, 0.000308034767f, 0.000305984431f, 0.000303923065f,
+    0.000301850756f, 0.000299767533f, 0.000297673512f, 0.000295568781f, 0.000293453399f, 0.000291327451f, 0.000289191055f, 0.00028704424f,
+    0.000284887123f, 0.00028271976f, 0.00028054227f, 0.000278354739f, 0.000276157196f, 0.000273949787f, 0.00027173257f, 0.000269505632f,
+    0.000267269032f, 0.000265022914f, 0.000262767338f, 0.000260502362f, 0.000258228101f, 0.000255944644f, 0.000253652077f, 0.000251350488f,
+    0.000249039964f, 0.000246720592f, 0.00024439246f, 0.000242055656f, 0.00023971028f, 0.000237356406f, 0.000234994135f, 0.000232623555f,
+    0.000230244754f, 0.000227857832f, 0.000225462863f, 0.000223059964f, 0.000220649206f, 0.000218230693f, 0.00021580451f, 0.000213370746f,
+    0.000210929502f, 0.00020848088f, 0.000206024954f, 0.000203561838f, 0.000201091607f, 0.000198614362f, 0.000196130204f, 0.000193639222f,
+    0.000191141502f, 0.000188637161f, 0.000186126272f, 0.00018360895f, 0.000181085285f, 0.000178555361f, 0.000176019297f, 0.000173477165f,
+    0.000170929066f, 0.000168375118f, 0.000165815407f, 0.000163250021f, 0.000160679061f, 0.00015810263f, 0.000155520815f, 0.000152933731f,
+    0.000150341468f, 0.000147744126f, 0.000145141792f, 0.000142534584f, 0.000139922588f, 0.000137305906f, 0.00013468464f, 0.000132058893f,
+    0.00012942875f, 0.00012679433f, 0.000124155704f, 0.000121513003f, 0.000118866315f, 0.000116215735f, 0.000113561371f, 0.000110903318f,
+    0.000108241678f, 0.000105576553f, 0.000102908045f, 0.000100236248f, 9.75612711e-05f, 9.48832167e-05f, 9.22021791e-05f, 8.95182602e-05f,
+    8.68315619e-05f, 8.41421934e-05f, 8.14502419e-05f, 7.87558238e-05f, 7.60590265e-05f, 7.33599663e-05f, 7.0658738e-05f, 6.7955436e-05f,
+    6.52501767e-05f, 6.25430475e-05f, 5.98341612e-05f, 5.71236196e-05f, 5.44115173e-05f, 5.16979599e-05f, 4.89830527e-05f, 4.62668941e-05f,
+    4.35495895e-05f, 4.08312371e-05f, 3.81119426e-05f, 3.53918076e-05f, 3.26709305e-05f, 2.99494186e-05f, 2.72273719e-05f, 2.45048923e-05f,
+    2.17820834e-05f, 1.90590472e-05f, 1.63358854e-05f, 1.36127001e-05f, 1.08895938e-05f, 8.16666852e-06f, 5.4440261e-06f, 2.72176931e-06f,
+    1.73760372e-18f, -2.72117995e-06f, -5.44166869e-06f, -8.16136344e-06f, -1.08801642e-05f, -1.35979672e-05f, -1.63146706e-05f, -1.90301744e-05f,
+    -2.17443758e-05f, -2.44571747e-05f, -2.71684676e-05f, -2.98781524e-05f, -3.25861329e-05f, -3.52923016e-05f, -3.79965568e-05f, -4.06988074e-05f,
+    -4.33989408e-05f, -4.60968622e-05f, -4.87924699e-05f, -5.1485662e-05f, -5.41763402e-05f, -5.68644027e-05f, -5.95497477e-05f, -6.22322768e-05f,
+    -6.49118956e-05f, -6.75884949e-05f, -7.02619727e-05f, -7.29322419e-05f, -7.55991932e-05f, -7.82627321e-05f, -8.09227568e-05f, -8.35791652e-05f,
+    -8.6231863e-05f, -8.88807554e-05f, -9.15257333e-05f, -9.41667095e-05f, -9.68035747e-05f, -9.94362417e-05f, -0.000102064609f, -0.000104688566f,
+    -0.000107308035f, -0.000109922912f, -0.000112533089f, -0.000115138486f, -0.000117738993f, -0.000120334524f, -0.000122924976f, -0.000125510254f,
+    -0.000128090265f, -0.000130664906f, -0.000133234076f, -0.000135797702f, -0.000138355681f, -0.000140907912f, -0.000143454294f, -0.000145994753f,
+    -0.000148529172f, -0.000151057466f, -0.00015357956f, -0.000156095339f, -0.0001586047f, -0.000161107586f, -0.00016360388f, -0.000166093479f,
+    -0.000168576327f, -0.000171052292f, -0.000173521315f, -0.000175983281f, -0.000178438117f, -0.000180885734f, -0.000183326018f, -0.000185758894f,
+    -0.000188184276f, -0.000190602077f, -0.000193012194f, -0.000195414541f, -0.000197809044f, -0.000200195602f, -0.000202574127f, -0.000204944532f,
+    -0.000207306744f, -0.000209660662f, -0.000212006198f, -0.000214343265f, -0.000216671775f, -0.00021899167f, -0.000221302835f, -0.000223605181f,
+    -0.00022589865f, -0.00022818314f, -0.00023045858f, -0.000232724866f, -0.000234981926f, -0.000237229688f, -0.000239468049f, -0.000241696951f,
+    -0.000243916293f, -0.000246126001f, -0.000248325989f, -0.000250516168f, -0.000252696482f, -0.000254866842f, -0.000257027161f, -0.000259177381f,
+    -0.000261317386f, -0.000263447117f, -0.000265566516f, -0.000267675496f, -0.00026977394f, -0.00027186182f, -0.000273939047f, -0.000276005536f,
+    -0.000278061227f, -0.000280106033f, -0.000282139867f, -0.000284162699f, -0.000286174385f, -0.000288174924f, -0.0002901642f, -0.000292142155f,
+    -0.00029410873f, -0.000296063838f, -0.000298007391f, -0.000299939333f, -0.000301859603f, -0.000303768145f, -0.000305664842f, -0.000307549664f,
+    -0.000309422554f, -0.000311283395f, -0.000313132157f, -0.000314968755f, -0.000316793157f, -0.000318605249f, -0.000320405001f, -0.000322192296f,
+    -0.000323967164f, -0.00032572943f, -0.000327479123f, -0.000329216127f, -0.000330940413f, -0.000332651893f, -0.000334350509f, -0.000336036202f,
+    -0.000337708916f, -0.000339368562f, -0.00034101514f, -0.000342648564f, -0.000344268745f, -0.000345875655f, -0.000347469235f, -0.000349049427f,
+    -0.000350616145f, -0.000352169387f, -0.000353709067f, -0.000355235126f, -0.000356747507f, -0.00035824618f, -0.000359731057f, -0.000361202139f,
+    -0.00036265931f, -0.00036410254f, -0.0003655318f, -0.000366947032f, -0.000368348148f, -0.000369735149f, -0.000371107977f, -0.000372466544f,
+    -0.00037381085f, -0.000375140837f, -0.000376456417f, -0.000377757591f, -0.000379044272f, -0.000380316458f, -0.000381574093f, -0.000382817117f,
+    -0.000384045503f, -0.000385259191f, -0.000386458152f, -0.000387642329f, -0.000388811692f, -0.000389966182f, -0.000391105801f, -0.00039223046f,
+    -0.00039334016f, -0.000394434843f, -0.000395514478f, -0.000396579009f, -0.000397628406f, -0.000398662669f, -0.00039968171f, -0.000400685502f,
+    -0.000401674042f, -0.000402647303f, -0.000403605198f, -0.000404547725f, -0.000405474857f, -0.000406386534f, -0.000407282787f, -0.000408163498f,
+    -0.000409028726f, -0.000409878383f, -0.00041071244f, -0.000411530898f, -0.000412333728f, -0.00041312087f, -0.000413892325f, -0.000414648064f,
+    -0.000415388087f, -0.000416112307f, -0.000416820752f, -0.000417513365f, -0.000418190146f, -0.000418851065f, -0.000419496093f, -0.00042012523f,
+    -0.000420738448f, -0.000421335717f, -0.000421917008f, -0.000422482321f, -0.000423031655f, -0.000423564954f, -0.000424082216f, -0.000424583443f,
+    -0.000425068574f, -0.00042553767f, -0.000425990642f, -0.00042642749f, -0.000426848244f, -0.000427252846f, -0.000427641295f, -0.000428013591f,
+    -0.000428369734f, -0.000428709667f, -0.000429033447f, -0.000429340987f, -0.000429632346f, -0.000429907494f, -0.000430166401f, -0.000430409098f,
+    -0.000430635555f, -0.000430845772f, -0.000431039749f, -0.000431217457f, -0.000431378925f, -0.000431524153f, -0.000431653112f, -0.000431765802f,
+    -0.000431862252f, -0.000431942433f, -0.000432006345f, -0.000432054017f, -0.00043208542f, -0.000432100554f, -0.000432099449f, -0.000432082103f,
+    -0.000432048517f, -0.000431998662f, -0.000431932567f, -0.000431850262f, -0.000431751716f, -0.00043163696f, -0.000431505992f, -0.000431358843f,
+    -0.000431195454f, -0.000431015913f, -0.00043082019f, -0.000430608314f, -0.000430380256f, -0.000430136075f, -0.00042987577f, -0.000429599342f,
+    -0.00042930679f, -0.000428998173f, -0.000428673462f, -0.000428332714f, -0.000427975931f, -0.000427603081f, -0.000427214254f, -0.00042680942f,
+    -0.000426388608f, -0.000425951846f, -0.000425499165f, -0.000425030565f, -0.000424546044f, -0.000424045662f, -0.000423529447f, -0.000422997371f,
+    -0.000422449521f, -0.000421885867f, -0.000421306439f, -0.000420711294f, -0.000420100463f, -0.000419473916f, -0.000418831711f, -0.000418173906f,
+    -0.000417500472f, -0.000416811468f, -0.000416106952f, -0.000415386894f, -0.000414651324f, -0.000413900329f, -0.000413133908f, -0.000412352092f,
+    -0.000411554938f, -0.000410742417f, -0.000409914646f, -0.000409071567f, -0.000408213295f, -0.00040733983f, -0.000406451203f, -0.000405547471f,
+    -0.000404628634f, -0.000403694779f, -0.000402745907f, -0.000401782047f, -0.000400803285f, -0.000399809622f, -0.000398801116f, -0.000397777796f,
+    -0.000396739691f, -0.00039568689f, -0.00039461939f, -0.000393537252f, -0.000392440503f, -0.000391329231f, -0.000390203408f, -0.000389063149f,
+    -0.000387908483f, -0.000386739412f, -0.000385556021f, -0.000384358369f, -0.000383146486f, -0.000381920399f, -0.000380680198f, -0.000379425881f,
+    -0.000378157565f, -0.00037687525f, -0.000375578995f, -0.000374268857f, -0.000372944865f, -0.000371607137f, -0.000370255642f, -0.000368890498f,
+    -0.000367511733f, -0.000366119377f, -0.000364713516f, -0.00036329421f, -0.000361861516f, -0.000360415463f, -0.000358956138f, -0.000357483572f,
+    -0.000355997821f, -0.000354498974f, -0.000352987059f, -0.000351462135f, -0.000349924288f, -0.000348373578f, -0.000346810033f, -0.000345233741f,
+    -0.000343644759f, -0.000342043117f, -0.000340428931f, -0.000338802231f, -0.000337163103f, -0.000335511577f, -0.00033384774f, -0.00033217165f,
+    -0.000330483395f, -0.000328783004f, -0.000327070535f, -0.000325346104f, -0.000323609769f, -0.00032186156f, -0.000320101564f, -0.00031832984f,
+    -0.000316546473f, -0.000314751553f, -0.000312945078f, -0.000311127194f, -0.000309297931f, -0.000307457376f, -0.000305605587f, -0.000303742621f,
+    -0.000301868597f, -0.000299983541f, -0.000298087572f, -0.000296180719f, -0.000294263067f, -0.000292334706f, -0.000290395692f, -0.000288446085f,
+    -0.000286486f, -0.000284515525f, -0.00028253466f, -0.000280543551f, -0.000278542255f, -0.000276530831f, -0.000274509366f, -0.000272477948f,
+    -0.000270436634f, -0.000268385542f, -0.0002663247f, -0.000264254224f, -0.000262174202f, -0.000260084664f, -0.000257985725f, -0.000255877472f,
+    -0.000253759965f, -0.00025163329f, -0.000249497534f, -0.000247352786f, -0.000245199102f, -0.000243036586f, -0.000240865309f, -0.000238685374f,
+    -0.000236496839f, -0.00023429982f, -0.00023209436f, -0.000229880578f, -0.000227658529f, -0.000225428317f, -0.000223190029f, -0.000220943752f,
+    -0.000218689558f, -0.000216427536f, -0.000214157772f, -0.000211880368f, -0.000209595382f, -0.000207302932f, -0.000205003089f, -0.000202695926f,
+    -0.000200381561f, -0.000198060079f, -0.00019573154f, -0.000193396059f, -0.000191053725f, -0.000188704595f, -0.0001863488f, -0.000183986413f,
+    -0.000181617506f, -0.000179242197f, -0.000176860558f, -0.000174472691f, -0.000172078682f, -0.00016967862f, -0.000167272592f, -0.000164860699f,
+    -0.00016244303f, -0.00016001967f, -0.000157590723f, -0.000155156275f, -0.000152716399f, -0.000150271226f, -0.000147820814f, -0.00014536528f,
+    -0.000142904697f, -0.000140439181f, -0.000137968804f, -0.000135493668f, -0.000133013862f, -0.000130529486f, -0.000128040643f, -0.000125547405f,
+    -0.000123049875f, -0.00012054816f, -0.000118042342f, -0.000115532523f, -0.000113018788f, -0.000110501234f, -0.000107979969f, -0.000105455067f,
+    -0.000102926642f, -0.000100394784f, -9.78595781e-05f, -9.53211347e-05f, -9.27795481e-05f, -9.02348984e-05f, -8.76873019e-05f, -8.51368459e-05f,
+    -8.25836178e-05f, -8.00277267e-05f, -7.74692671e-05f, -7.49083338e-05f, -7.23450212e-05f, -6.97794239e-05f, -6.72116439e-05f, -6.46417684e-05f,
+    -6.20699066e-05f, -5.9496153e-05f, -5.69205986e-05f, -5.43433453e-05f, -5.17644839e-05f, -4.91841201e-05f, -4.66023412e-05f, -4.40192525e-05f,
+    -4.14349452e-05f, -3.88495209e-05f, -3.62630781e-05f, -3.36757075e-05f, -3.10875075e-05f, -2.84985799e-05f, -2.59090211e-05f, -2.33189239e-05f,
+    -2.07283902e-05f, -1.81375144e-05f, -1.55463949e-05f, -1.2955129e-05f, -1.03638131e-05f, -7.77254536e-06f, -5.18142224e-06f, -2.5905415e-06f,
+    -6.20500396e-18f, 2.5901054e-06f, 5.17967737e-06f, 7.76861907e-06f, 1.03568327e-05f, 1.29442224e-05f, 1.55306916e-05f, 1.81161413e-05f,
+    2.07004778e-05f, 2.3283601e-05f, 2.58654163e-05f, 2.84458274e-05f, 3.10247342e-05f, 3.36020457e-05f, 3.61776656e-05f, 3.87514883e-05f,
+    4.13234302e-05f, 4.38933857e-05f, 4.6461264e-05f, 4.90269667e-05f, 5.15903957e-05f, 5.41514601e-05f, 5.67100615e-05f, 5.9266109e-05f,
+    6.18194972e-05f, 6.43701424e-05f, 6.69179426e-05f, 6.94627961e-05f, 7.20046228e-05f, 7.45433208e-05f, 7.70787956e-05f, 7.96109525e-05f,
+    8.2139697e-05f, 8.46649345e-05f, 8.71865705e-05f, 8.97045102e-05f, 9.22186591e-05f, 9.472893e-05f, 9.72352282e-05f, 9.97374518e-05f,
+    0.000102235514f, 0.000104729326f, 0.000107218788f, 0.000109703804f, 0.000112184294f, 0.00011466015f, 0.000117131298f, 0.000119597629f,
+    0.000122059064f, 0.0001245155f, 0.000126966857f, 0.000129413034f, 0.000131853958f, 0.000134289512f, 0.000136719624f, 0.000139144191f,
+    0.000141563141f, 0.000143976373f, 0.000146383798f, 0.000148785315f, 0.000151180866f, 0.000153570334f, 0.000155953632f, 0.000158330688f,
+    0.000160701398f, 0.000163065692f, 0.000165423466f, 0.000167774633f, 0.000170119107f, 0.000172456814f, 0.000174787652f, 0.000177111549f,
+    0.000179428403f, 0.000181738142f, 0.000184040677f, 0.000186335921f, 0.000188623788f, 0.000190904189f, 0.000193177038f, 0.000195442277f,
+    0.000197699788f, 0.000199949514f, 0.000202191353f, 0.000204425232f, 0.000206651064f, 0.000208868762f, 0.000211078266f, 0.000213279476f,
+    0.000215472304f, 0.000217656692f, 0.000219832538f, 0.00022199977f, 0.000224158313f, 0.000226308082f, 0.000228449004f, 0.00023058099f,
+    0.000232703969f, 0.000234817868f, 0.000236922584f, 0.000239018074f, 0.000241104237f, 0.000243180999f, 0.000245248288f, 0.000247306045f,
+    0.000249354169f, 0.000251392572f, 0.000253421225f, 0.000255440013f, 0.000257448875f, 0.000259447756f, 0.000261436566f, 0.000263415219f,
+    0.000265383656f, 0.00026734182f, 0.000269289594f, 0.000271226978f, 0.000273153826f, 0.00027507011f, 0.000276975741f, 0.000278870662f,
+    0.000280754815f, 0.000282628112f, 0.000284490496f, 0.000286341878f, 0.0002881822f, 0.000290011405f, 0.000291829405f, 0.000293636171f,
+    0.000295431615f, 0.000297215651f, 0.000298988249f, 0.000300749321f, 0.000302498811f, 0.000304236659f, 0.000305962778f, 0.000307677168f,
+    0.000309379684f, 0.000311070326f, 0.000312748976f, 0.000314415636f, 0.000316070218f, 0.000317712664f, 0.000319342886f, 0.000320960855f,
+    0.000322566513f, 0.000324159802f, 0.000325740635f, 0.000327308982f, 0.000328864786f, 0.000330407987f, 0.000331938529f, 0.000333456352f,
+    0.000334961398f, 0.000336453639f, 0.000337932957f, 0.000339399383f, 0.000340852799f, 0.000342293206f, 0.000343720487f, 0.000345134642f,
+    0.000346535613f, 0.000347923313f, 0.000349297741f, 0.000350658811f, 0.000352006493f, 0.000353340758f, 0.000354661519f, 0.000355968717f,
+    0.000357262354f, 0.000358542369f, 0.000359808706f, 0.000361061306f, 0.000362300168f, 0.000363525178f, 0.000364736363f, 0.000365933665f,
+    0.000367116998f, 0.000368286361f, 0.000369441696f, 0.000370582944f, 0.000371710106f, 0.000372823124f, 0.000373921968f, 0.000375006581f,
+    0.000376076903f, 0.000377132965f, 0.000378174649f, 0.000379201985f, 0.000380214886f, 0.000381213351f, 0.000382197351f, 0.0003831668f,
+    0.000384121726f, 0.000385062041f, 0.000385987747f, 0.000386898784f, 0.000387795182f, 0.000388676825f, 0.00038954374f, 0.000390395871f,
+    0.000391233189f, 0.000392055692f, 0.000392863323f, 0.000393656053f, 0.000394433882f, 0.000395196752f, 0.000395944633f, 0.000396677555f,
+    0.00039739543f, 0.000398098258f, 0.000398786011f, 0.000399458659f, 0.000400116201f, 0.00040075861f, 0.000401385827f, 0.000401997881f,
+    0.000402594742f, 0.000403176353f, 0.000403742742f, 0.000404293853f, 0.000404829654f, 0.000405350205f, 0.000405855419f, 0.000406345294f,
+    0.000406819803f, 0.000407278974f, 0.00040772275f, 0.000408151129f, 0.000408564112f, 0.000408961641f, 0.000409343775f, 0.000409710425f,
+    0.00041006165f, 0.000410397392f, 0.00041071765f, 0.000411022425f, 0.000411311688f, 0.000411585439f, 0.000411843706f, 0.000412086432f,
+    0.000412313617f, 0.000412525289f, 0.000412721391f, 0.000412901951f, 0.000413066969f, 0.000413216447f, 0.000413350353f, 0.00041346869f,
+    0.000413571484f, 0.000413658679f, 0.000413730333f, 0.000413786416f, 0.000413826929f, 0.000413851871f, 0.000413861271f, 0.000413855101f,
+    0.000413833361f, 0.00041379605f, 0.000413743197f, 0.000413674803f, 0.000413590868f, 0.000413491391f, 0.000413376372f, 0.000413245813f,
+    0.00041309977f, 0.000412938185f, 0.000412761117f, 0.000412568537f, 0.000412360474f, 0.000412136927f, 0.000411897927f, 0.000411643472f,
+    0.000411373592f, 0.000411088258f, 0.000410787528f, 0.000410471373f, 0.000410139852f, 0.000409792934f, 0.00040943065f, 0.000409053057f,
+    0.000408660097f, 0.000408251857f, 0.000407828309f, 0.000407389482f, 0.000406935404f, 0.000406466104f, 0.000405981555f, 0.000405481842f,
+    0.000404966937f, 0.000404436869f, 0.000403891667f, 0.000403331389f, 0.000402755977f, 0.000402165519f, 0.000401560043f, 0.00040093952f,
+    0.000400304038f, 0.000399653567f, 0.000398988166f, 0.000398307864f, 0.000397612661f, 0.000396902615f, 0.000396177755f, 0.000395438081f,
+    0.000394683651f, 0.000393914466f, 0.000393130584f, 0.000392332033f, 0.000391518843f, 0.000390691042f, 0.00038984869f, 0.000388991757f,
+    0.00038812033f, 0.00038723441f, 0.000386334083f, 0.000385419349f, 0.000384490239f, 0.00038354678f, 0.00038258906f, 0.00038161705f,
+    0.000380630867f, 0.000379630481f, 0.00037861595f, 0.000377587334f, 0.00037654466f, 0.000375487958f, 0.000374417286f, 0.000373332703f,
+    0.000372234208f, 0.00037112186f, 0.000369995716f, 0.000368855806f, 0.000367702189f, 0.000366534921f, 0.000365354004f, 0.000364159496f,
+    0.000362951483f, 0.000361729966f, 0.000360495033f, 0.000359246711f, 0.000357985031f, 0.000356710079f, 0.000355421857f, 0.000354120479f,
+    0.000352805917f, 0.000351478287f, 0.000350137649f, 0.000348783971f, 0.000347417401f, 0.000346037938f, 0.000344645639f, 0.000343240565f,
+    0.000341822801f, 0.000340392347f, 0.000338949292f, 0.000337493664f, 0.00033602555f, 0.00033454501f, 0.00033305207f, 0.00033154682f,
+    0.000330029288f, 0.000328499562f, 0.000326957699f, 0.0003254037f, 0.00032383771f, 0.00032225973f, 0.000320669846f, 0.000319068116f,
+    0.0003174546f, 0.000315829355f, 0.000314192468f, 0.000312543969f, 0.000310883916f, 0.000309212395f, 0.000307529495f, 0.000305835216f,
+    0.000304129673f, 0.000302412926f, 0.000300685031f, 0.000298946048f, 0.000297196064f, 0.000295435108f, 0.000293663295f, 0.000291880657f,
+    0.000290087279f, 0.00028828322f, 0.000286468567f, 0.000284643378f, 0.000282807712f, 0.000280961656f, 0.000279105268f, 0.000277238636f,
+    0.000275361788f, 0.00027347487f, 0.000271577883f, 0.000269670942f, 0.000267754105f, 0.000265827461f, 0.000263891037f, 0.000261944951f,
+    0.00025998929f, 0.000258024083f, 0.000256049418f, 0.00025406538f, 0.000252072059f, 0.000250069483f, 0.000248057797f, 0.000246037031f,
+    0.000244007242f, 0.000241968562f, 0.000239921035f, 0.000237864748f, 0.000235799787f, 0.000233726212f, 0.00023164411f, 0.000229553567f,
+    0.000227454642f, 0.000225347452f, 0.00022323204f, 0.000221108508f, 0.000218976929f, 0.000216837376f, 0.00021468995f, 0.000212534709f,
+    0.000210371756f, 0.000208201163f, 0.000206023018f, 0.000203837393f, 0.000201644376f, 0.000199444054f, 0.000197236513f, 0.000195021828f,
+    0.000192800086f, 0.000190571358f, 0.000188335762f, 0.000186093355f, 0.000183844226f, 0.000181588461f, 0.000179326147f, 0.000177057387f,
+    0.000174782239f, 0.000172500804f, 0.000170213156f, 0.000167919396f, 0.000165619611f, 0.000163313875f, 0.000161002288f, 0.000158684925f,
+    0.000156361886f, 0.000154033245f, 0.000151699103f, 0.000149359548f, 0.000147014667f, 0.000144664533f, 0.000142309247f, 0.000139948912f,
+    0.000137583585f, 0.000135213384f, 0.000132838395f, 0.000130458691f, 0.000128074375f, 0.000125685532f, 0.000123292251f, 0.000120894627f,
+    0.000118492746f, 0.000116086703f, 0.000113676586f, 0.000111262481f, 0.000108844491f, 0.000106422696f, 0.000103997198f, 0.000101568075f,
+    9.91354318e-05f, 9.66993466e-05f, 9.42599218e-05f, 9.18172445e-05f, 8.93714096e-05f, 8.69225114e-05f, 8.44706301e-05f, 8.20158748e-05f,
+    7.95583255e-05f, 7.70980769e-05f, 7.46352234e-05f, 7.21698525e-05f, 6.97020732e-05f, 6.72319584e-05f, 6.47596098e-05f, 6.22851221e-05f,
+    5.98085862e-05f, 5.73300931e-05f, 5.4849741e-05f, 5.23676172e-05f, 4.98838199e-05f, 4.73984401e-05f, 4.49115723e-05f, 4.24233076e-05f,
+    3.99337405e-05f, 3.74429692e-05f, 3.49510774e-05f, 3.2458167e-05f, 2.99643307e-05f, 2.74696577e-05f, 2.49742461e-05f, 2.2478187e-05f,
+    1.99815731e-05f, 1.74845009e-05f, 1.49870639e-05f, 1.24893531e-05f, 9.99146505e-06f, 7.49349192e-06f, 4.99552743e-06f, 2.49766572e-06f,
+    -1.19784996e-18f, -2.49737582e-06f, -4.99436828e-06f, -7.49088395e-06f, -9.98682845e-06f, -1.24821099e-05f, -1.49766329e-05f, -1.74703055e-05f,
+    -1.9963034e-05f, -2.24547239e-05f, -2.49452842e-05f, -2.74346185e-05f, -2.99226358e-05f, -3.24092434e-05f, -3.48943468e-05f, -3.7377853e-05f,
+    -3.98596712e-05f, -4.23397069e-05f, -4.48178653e-05f, -4.72940592e-05f, -4.97681904e-05f, -5.22401679e-05f, -5.47099007e-05f, -5.71772944e-05f,
+    -5.96422615e-05f, -6.21047002e-05f, -6.45645341e-05f, -6.70216541e-05f, -6.94759801e-05f, -7.19274176e-05f, -7.43758646e-05f, -7.68212485e-05f,
+    -7.92634673e-05f, -8.17024265e-05f, -8.41380388e-05f, -8.65702168e-05f, -8.89988733e-05f, -9.1423899e-05f, -9.38452213e-05f, -9.62627455e-05f,
+    -9.86763771e-05f, -0.000101086029f, -0.000103491613f, -0.000105893036f, -0.000108290209f, -0.000110683046f, -0.000113071459f, -0.000115455347f,
+    -0.000117834636f, -0.000120209224f, -0.000122579033f, -0.000124943967f, -0.000127303952f, -0.000129658874f, -0.000132008674f, -0.000134353249f,
+    -0.000136692513f, -0.000139026379f, -0.000141354758f, -0.000143677578f, -0.000145994738f, -0.00014830615f, -0.000150611726f, -0.000152911394f,
+    -0.000155205067f, -0.000157492643f, -0.000159774063f, -0.000162049211f, -0.000164318029f, -0.000166580416f, -0.000168836297f, -0.000171085587f,
+    -0.000173328197f, -0.000175564041f, -0.000177793045f, -0.000180015137f, -0.000182230215f, -0.000184438191f, -0.000186639008f, -0.000188832564f,
+    -0.000191018786f, -0.000193197586f, -0.000195368892f, -0.000197532616f, -0.000199688686f, -0.000201837014f, -0.000203977528f, -0.00020611014f,
+    -0.000208234778f, -0.000210351354f, -0.000212459796f, -0.00021456003f, -0.000216651984f, -0.000218735557f, -0.000220810689f, -0.000222877294f,
+    -0.000224935298f, -0.00022698463f, -0.000229025216f, -0.000231056983f, -0.000233079831f, -0.000235093714f, -0.000237098546f, -0.000239094239f,
+    -0.00024108075f, -0.000243057977f, -0.000245025876f, -0.000246984331f, -0.000248933298f, -0.000250872719f, -0.000252802507f, -0.000254722574f,
+    -0.000256632862f, -0.000258533313f, -0.00026042384f, -0.000262304384f, -0.000264174887f, -0.000266035233f, -0.000267885393f, -0.000269725308f,
+    -0.000271554862f, -0.000273374026f, -0.000275182741f, -0.000276980922f, -0.000278768479f, -0.000280545384f, -0.000282311579f, -0.000284066948f,
+    -0.000285811489f, -0.000287545059f, -0.000289267686f, -0.000290979253f, -0.000292679673f, -0.000294368947f, -0.000296046986f, -0.000297713705f,
+    -0.000299369072f, -0.000301013002f, -0.000302645465f, -0.000304266374f, -0.00030587567f, -0.000307473325f, -0.000309059222f, -0.00031063339f,
+    -0.000312195683f, -0.000313746103f, -0.00031528456f, -0.000316810998f, -0.000318325387f, -0.000319827639f, -0.000321317726f, -0.000322795589f,
+    -0.000324261171f, -0.000325714413f, -0.000327155256f, -0.000328583672f, -0.000329999573f, -0.000331402931f, -0.000332793687f, -0.000334171782f,
+    -0.000335537217f, -0.000336889876f, -0.000338229729f, -0.000339556747f, -0.000340870844f, -0.000342172018f, -0.000343460182f, -0.000344735337f,
+    -0.000345997367f, -0.000347246299f, -0.000348482019f, -0.000349704555f, -0.00035091379f, -0.000352109724f, -0.000353292329f, -0.000354461488f,
+    -0.000355617231f, -0.000356759498f, -0.000357888232f, -0.000359003403f, -0.000360104983f, -0.000361192913f, -0.000362267136f, -0.00036332765f,
+    -0.000364374398f, -0.000365407352f, -0.000366426451f, -0.000367431698f, -0.000368423032f, -0.000369400397f, -0.000370363792f, -0.000371313188f,
+    -0.000372248498f, -0.000373169751f, -0.000374076888f, -0.000374969852f, -0.000375848642f, -0.000376713229f, -0.000377563556f, -0.000378399622f,
+    -0.000379221368f, -0.000380028796f, -0.000380821846f, -0.00038160049f, -0.000382364728f, -0.00038311453f, -0.000383849838f, -0.000384570652f,
+    -0.000385276944f, -0.000385968684f, -0.000386645843f, -0.000387308421f, -0.000387956359f, -0.000388589659f, -0.00038920826f, -0.000389812194f,
+    -0.00039040143f, -0.000390975911f, -0.000391535665f, -0.000392080605f, -0.000392610789f, -0.00039312616f, -0.000393626688f, -0.000394112372f,
+    -0.000394583214f, -0.000395039155f, -0.000395480223f, -0.000395906362f, -0.00039631757f, -0.000396713847f, -0.000397095195f, -0.000397461554f,
+    -0.000397812953f, -0.000398149365f, -0.000398470758f, -0.000398777163f, -0.000399068522f, -0.000399344863f, -0.000399606186f, -0.000399852433f,
+    -0.000400083634f, -0.000400299759f, -0.000400500838f, -0.00040068684f, -0.000400857738f, -0.00040101356f, -0.000401154306f, -0.000401279947f,
+    -0.000401390484f, -0.000401485944f, -0.000401566271f, -0.000401631522f, -0.000401681638f, -0.00040171665f, -0.000401736586f, -0.000401741388f,
+    -0.000401731086f, -0.000401705707f, -0.000401665195f, -0.000401609606f, -0.000401538913f, -0.000401453144f, -0.00040135227f, -0.00040123635f,
+    -0.000401105324f, -0.000400959223f, -0.000400798075f, -0.000400621881f, -0.000400430639f, -0.000400224351f, -0.000400003017f, -0.000399766694f,
+    -0.000399515353f, -0.000399248995f, -0.000398967677f, -0.000398671371f, -0.000398360105f, -0.000398033881f, -0.000397692726f, -0.000397336669f,
+    -0.000396965683f, -0.000396579795f, -0.000396179035f, -0.000395763433f, -0.000395332987f, -0.000394887698f, -0.000394427596f, -0.000393952709f,
+    -0.000393463066f, -0.000392958667f, -0.000392439542f, -0.000391905691f, -0.000391357171f, -0.000390793954f, -0.000390216126f, -0.000389623659f,
+    -0.000389016583f, -0.000388394954f, -0.000387758773f, -0.00038710807f, -0.000386442844f, -0.000385763182f, -0.000385069055f, -0.000384360494f,
+    -0.000383637554f, -0.000382900267f, -0.000382148632f, -0.000381382677f, -0.000380602462f, -0.000379808014f, -0.000378999335f, -0.000378176483f,
+    -0.000377339486f, -0.000376488373f, -0.000375623174f, -0.000374743919f, -0.000373850635f, -0.000372943381f, -0.000372022187f, -0.000371087081f,
+    -0.000370138092f, -0.000369175279f, -0.000368198642f, -0.000367208268f, -0.000366204156f, -0.000365186366f, -0.000364154927f, -0.000363109866f,
+    -0.000362051243f, -0.000360979117f, -0.000359893485f, -0.000358794408f, -0.000357681944f, -0.00035655612f, -0.000355416967f, -0.000354264572f,
+    -0.000353098934f, -0.000351920113f, -0.000350728165f, -0.000349523092f, -0.00034830501f, -0.000347073918f, -0.000345829874f, -0.000344572938f,
+    -0.000343303138f, -0.000342020561f, -0.000340725179f, -0.000339417136f, -0.000338096404f, -0.000336763071f, -0.000335417193f, -0.000334058801f,
+    -0.000332687952f, -0.000331304705f, -0.000329909119f, -0.00032850125f, -0.000327081099f, -0.000325648813f, -0.00032420436f, -0.00032274783f,
+    -0.000321279309f, -0.000319798797f, -0.000318306382f, -0.000316802121f, -0.000315286074f, -0.000313758297f, -0.000312218821f, -0.000310667732f,
+    -0.00030910506f, -0.000307530921f, -0.000305945316f, -0.000304348359f, -0.000302740053f, -0.000301120512f, -0.000299489766f, -0.000297847873f,
+    -0.000296194921f, -0.000294530939f, -0.000292856043f, -0.000291170232f, -0.000289473624f, -0.000287766248f, -0.000286048191f, -0.000284319511f,
+    -0.000282580266f, -0.000280830514f, -0.000279070344f, -0.000277299812f, -0.000275519007f, -0.000273727957f, -0.00027192675f, -0.000270115474f,
+    -0.000268294156f, -0.000266462885f, -0.000264621747f, -0.000262770802f, -0.000260910107f, -0.00025903972f, -0.000257159758f, -0.00025527025f,
+    -0.000253371283f, -0.000251462945f, -0.000249545294f, -0.000247618387f, -0.000245682313f, -0.000243737144f, -0.000241782953f, -0.000239819827f,
+    -0.000237847809f, -0.000235867003f, -0.000233877479f, -0.000231879298f, -0.000229872545f, -0.000227857294f, -0.000225833617f, -0.000223801602f,
+    -0.000221761307f, -0.000219712834f, -0.000217656241f, -0.000215591615f, -0.00021351903f, -0.000211438572f, -0.000209350299f, -0.000207254314f,
+    -0.000205150689f, -0.000203039483f, -0.000200920811f, -0.000198794733f, -0.00019666132f, -0.000194520675f, -0.000192372856f, -0.000190217965f,
+    -0.000188056059f, -0.000185887257f, -0.0001837116f, -0.000181529191f, -0.000179340117f, -0.000177144451f, -0.000174942266f, -0.000172733664f,
+    -0.000170518731f, -0.000168297527f, -0.000166070153f, -0.000163836681f, -0.000161597214f, -0.000159351825f, -0.0001571006f, -0.000154843612f,
+    -0.000152580964f, -0.000150312742f, -0.00014803902f, -0.00014575987f, -0.000143475409f, -0.000141185708f, -0.000138890857f, -0.000136590941f,
+    -0.000134286034f, -0.000131976238f, -0.000129661639f, -0.000127342326f, -0.00012501837f, -0.000122689875f, -0.000120356919f, -0.000118019598f,
+    -0.000115677991f, -0.000113332193f, -0.000110982292f, -0.000108628374f, -0.000106270527f, -0.000103908838f, -0.000101543403f, -9.91743e-05f,
+    -9.6801632e-05f, -9.44254789e-05f, -9.20459279e-05f, -8.96630736e-05f, -8.72770033e-05f, -8.48878044e-05f, -8.24955787e-05f, -8.01003989e-05f,
+    -7.7702367e-05f, -7.53015702e-05f, -7.28980958e-05f, -7.04920312e-05f, -6.80834783e-05f, -6.56725169e-05f, -6.32592419e-05f, -6.08437476e-05f,
+    -5.84261179e-05f, -5.60064473e-05f, -5.3584823e-05f, -5.11613398e-05f, -4.87360885e-05f, -4.63091565e-05f, -4.38806383e-05f, -4.14506248e-05f,
+    -3.90192035e-05f, -3.65864726e-05f, -3.41525192e-05f, -3.17174308e-05f, -2.92813074e-05f, -2.68442327e-05f, -2.44063031e-05f, -2.19676076e-05f,
+    -1.95282373e-05f, -1.70882849e-05f, -1.46478424e-05f, -1.22069996e-05f, -9.76584943e-06f, -7.32448279e-06f, -4.88299111e-06f, -2.44146645e-06f,
+    0.0f, 0.0f,
+};
+
+const float* sinc_table_lookup(size_t window_size, size_t window_interp) {
+    if (window_size == 16 && window_interp == 64) {
+        return sinc_table_16_64;
+    }
+    if (window_size == 32 && window_interp == 128) {
+        return sinc_table_32_128;
+    }
+    if (window_size == 64 && window_interp == 512) {
+        return sinc_table_64_512;
+    }
+    return NULL;
+}
+
+} // namespace audio
+} // namespace roc
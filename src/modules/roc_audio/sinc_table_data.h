@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/sinc_table_data.h
+//! @brief Precomputed sinc tables.
+
+#ifndef ROC_AUDIO_SINC_TABLE_DATA_H_
+#define ROC_AUDIO_SINC_TABLE_DATA_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+//! Get precomputed sinc table for given parameters.
+//!
+//! The tables for the default resampler profiles are generated at build
+//! time by scripts/generate_sinc_tables.py and placed in read-only data,
+//! so they cost no startup computation and are shared across processes
+//! by the OS.
+//!
+//! The tables are float regardless of the sample_t type, since the sinc
+//! filter is float-only and is not available in fixed-point builds.
+//!
+//! @returns a pointer to an immutable table of (window_size * window_interp + 2)
+//! entries, or NULL if no table was precomputed for these parameters.
+const float* sinc_table_lookup(size_t window_size, size_t window_interp);
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_SINC_TABLE_DATA_H_
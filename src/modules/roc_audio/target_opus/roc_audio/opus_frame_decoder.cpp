@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/opus_frame_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+OpusFrameDecoder::OpusFrameDecoder()
+    : decoder_(NULL)
+    , stream_pos_(0)
+    , stream_avail_(0)
+    , frame_data_(NULL)
+    , frame_pos_(0) {
+    int err = 0;
+    decoder_ = opus_decoder_create(OpusSampleRate, OpusNumChannels, &err);
+    if (!decoder_) {
+        roc_log(LogError, "opus decoder: opus_decoder_create(): %s", opus_strerror(err));
+    }
+}
+
+OpusFrameDecoder::~OpusFrameDecoder() {
+    if (decoder_) {
+        opus_decoder_destroy(decoder_);
+    }
+}
+
+bool OpusFrameDecoder::valid() const {
+    return decoder_;
+}
+
+size_t OpusFrameDecoder::samples_from_payload_size(size_t payload_size) {
+    return payload_size * 8 * OpusSampleRate / OpusBitrate;
+}
+
+packet::timestamp_t OpusFrameDecoder::position() const {
+    return stream_pos_;
+}
+
+packet::timestamp_t OpusFrameDecoder::available() const {
+    return stream_avail_;
+}
+
+void OpusFrameDecoder::begin(packet::timestamp_t frame_position,
+                             const void* frame_data,
+                             size_t frame_size) {
+    roc_panic_if_not(frame_data);
+
+    if (frame_data_) {
+        roc_panic("opus decoder: unpaired begin/end");
+    }
+
+    size_t n_samples = samples_from_payload_size(frame_size);
+    if (n_samples > OpusMaxFrameSamples) {
+        n_samples = OpusMaxFrameSamples;
+    }
+
+#ifdef ROC_FIXED_POINT
+    // Q15 samples match the libopus 16-bit API, which also uses the
+    // fixed-point decoder internally when libopus is built for it
+    const int ret = opus_decode(decoder_, (const unsigned char*)frame_data,
+                                (opus_int32)frame_size, pcm_, OpusMaxFrameSamples, 0);
+#else
+    const int ret =
+        opus_decode_float(decoder_, (const unsigned char*)frame_data,
+                          (opus_int32)frame_size, pcm_, OpusMaxFrameSamples, 0);
+#endif
+
+    if (ret != (int)n_samples) {
+        // keep the stream position advancing as if the frame decoded, so
+        // that a corrupted payload costs silence instead of a desync
+        roc_log(LogError, "opus decoder: can't decode %lu bytes to %lu samples: %s",
+                (unsigned long)frame_size, (unsigned long)n_samples,
+                ret < 0 ? opus_strerror(ret) : "unexpected sample count");
+        memset(pcm_, 0, n_samples * OpusNumChannels * sizeof(sample_t));
+    }
+
+    stream_pos_ = frame_position;
+    stream_avail_ = (packet::timestamp_t)n_samples;
+
+    frame_data_ = frame_data;
+    frame_pos_ = 0;
+}
+
+size_t OpusFrameDecoder::read(sample_t* samples,
+                              size_t n_samples,
+                              packet::channel_mask_t channels) {
+    if (!frame_data_) {
+        roc_panic("opus decoder: read should be called only between begin/end");
+    }
+
+    if (n_samples > (size_t)stream_avail_) {
+        n_samples = (size_t)stream_avail_;
+    }
+
+    const packet::channel_mask_t in_chan_mask = OpusChannelMask;
+    const packet::channel_mask_t inout_chan_mask = in_chan_mask | channels;
+
+    const sample_t* in_samples = pcm_ + frame_pos_ * OpusNumChannels;
+
+    for (size_t ns = 0; ns < n_samples; ns++) {
+        for (packet::channel_mask_t ch = 1; ch <= inout_chan_mask && ch != 0; ch <<= 1) {
+            sample_t s = 0;
+            if (in_chan_mask & ch) {
+                s = *in_samples++;
+            }
+            if (channels & ch) {
+                *samples++ = s;
+            }
+        }
+    }
+
+    (void)shift(n_samples);
+
+    return n_samples;
+}
+
+size_t OpusFrameDecoder::shift(size_t n_samples) {
+    if (!frame_data_) {
+        roc_panic("opus decoder: shift should be called only between begin/end");
+    }
+
+    if (n_samples > (size_t)stream_avail_) {
+        n_samples = (size_t)stream_avail_;
+    }
+
+    stream_pos_ += (packet::timestamp_t)n_samples;
+    stream_avail_ -= (packet::timestamp_t)n_samples;
+
+    frame_pos_ += n_samples;
+
+    return n_samples;
+}
+
+void OpusFrameDecoder::end() {
+    if (!frame_data_) {
+        roc_panic("opus decoder: unpaired begin/end");
+    }
+
+    stream_avail_ = 0;
+
+    frame_data_ = NULL;
+    frame_pos_ = 0;
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_opus/roc_audio/opus_frame_decoder.h
+//! @brief Opus frame decoder.
+
+#ifndef ROC_AUDIO_OPUS_FRAME_DECODER_H_
+#define ROC_AUDIO_OPUS_FRAME_DECODER_H_
+
+#include "roc_audio/iframe_decoder.h"
+#include "roc_audio/opus_params.h"
+#include "roc_core/noncopyable.h"
+
+#include <opus/opus.h>
+
+namespace roc {
+namespace audio {
+
+//! Opus frame decoder.
+//! @remarks
+//!  Decodes the whole frame with a single libopus call on begin() and
+//!  serves read() and shift() from the decoded samples.
+class OpusFrameDecoder : public IFrameDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    OpusFrameDecoder();
+
+    virtual ~OpusFrameDecoder();
+
+    //! Check if the decoder was successfully constructed.
+    bool valid() const;
+
+    //! Get number of samples per channel in a payload of given size.
+    static size_t samples_from_payload_size(size_t payload_size);
+
+    //! Get current stream position.
+    virtual packet::timestamp_t position() const;
+
+    //! Get number of samples available for decoding.
+    virtual packet::timestamp_t available() const;
+
+    //! Start decoding a new frame.
+    virtual void
+    begin(packet::timestamp_t frame_position, const void* frame_data, size_t frame_size);
+
+    //! Read samples from current frame.
+    virtual size_t
+    read(sample_t* samples, size_t n_samples, packet::channel_mask_t channels);
+
+    //! Shift samples from current frame.
+    virtual size_t shift(size_t n_samples);
+
+    //! Finish decoding current frame.
+    virtual void end();
+
+private:
+    ::OpusDecoder* decoder_;
+
+    packet::timestamp_t stream_pos_;
+    packet::timestamp_t stream_avail_;
+
+    const void* frame_data_;
+    size_t frame_pos_;
+
+    // samples decoded from the current frame, interleaved
+    sample_t pcm_[OpusMaxFrameSamples * OpusNumChannels];
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_OPUS_FRAME_DECODER_H_
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/opus_frame_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+OpusFrameEncoder::OpusFrameEncoder()
+    : encoder_(NULL)
+    , frame_data_(NULL)
+    , frame_size_(0)
+    , pcm_pos_(0)
+    , pcm_len_(0) {
+    int err = 0;
+    encoder_ = opus_encoder_create(OpusSampleRate, OpusNumChannels,
+                                   OPUS_APPLICATION_AUDIO, &err);
+    if (!encoder_) {
+        roc_log(LogError, "opus encoder: opus_encoder_create(): %s", opus_strerror(err));
+        return;
+    }
+
+    // hard CBR, so that encoded_size() is exact; see opus_params.h
+    opus_encoder_ctl(encoder_, OPUS_SET_BITRATE(OpusBitrate));
+    opus_encoder_ctl(encoder_, OPUS_SET_VBR(0));
+}
+
+OpusFrameEncoder::~OpusFrameEncoder() {
+    if (encoder_) {
+        opus_encoder_destroy(encoder_);
+    }
+}
+
+bool OpusFrameEncoder::valid() const {
+    return encoder_;
+}
+
+size_t OpusFrameEncoder::encoded_size(size_t num_samples) const {
+    return num_samples * (OpusBitrate / 8) / OpusSampleRate;
+}
+
+void OpusFrameEncoder::begin(void* frame_data, size_t frame_size) {
+    roc_panic_if_not(frame_data);
+
+    if (frame_data_) {
+        roc_panic("opus encoder: unpaired begin/end");
+    }
+
+    frame_data_ = frame_data;
+    frame_size_ = frame_size;
+
+    pcm_pos_ = 0;
+    pcm_len_ = frame_size * 8 * OpusSampleRate / OpusBitrate;
+    if (pcm_len_ > OpusMaxFrameSamples) {
+        pcm_len_ = OpusMaxFrameSamples;
+    }
+}
+
+size_t OpusFrameEncoder::write(const sample_t* samples,
+                               size_t n_samples,
+                               packet::channel_mask_t channels) {
+    if (!frame_data_) {
+        roc_panic("opus encoder: write should be called only between begin/end");
+    }
+
+    if (n_samples > (pcm_len_ - pcm_pos_)) {
+        n_samples = (pcm_len_ - pcm_pos_);
+    }
+
+    const packet::channel_mask_t out_chan_mask = OpusChannelMask;
+    const packet::channel_mask_t inout_chan_mask = channels | out_chan_mask;
+
+    sample_t* out_samples = pcm_ + pcm_pos_ * OpusNumChannels;
+
+    for (size_t ns = 0; ns < n_samples; ns++) {
+        for (packet::channel_mask_t ch = 1; ch <= inout_chan_mask && ch != 0; ch <<= 1) {
+            if (channels & ch) {
+                if (out_chan_mask & ch) {
+                    *out_samples++ = *samples;
+                }
+                samples++;
+            } else {
+                if (out_chan_mask & ch) {
+                    *out_samples++ = 0;
+                }
+            }
+        }
+    }
+
+    pcm_pos_ += n_samples;
+    return n_samples;
+}
+
+void OpusFrameEncoder::end() {
+    if (!frame_data_) {
+        roc_panic("opus encoder: unpaired begin/end");
+    }
+
+    if (pcm_pos_ != 0) {
+        // in CBR mode libopus produces exactly this many bytes, provided
+        // that the sample count is a frame size allowed by Opus; Packetizer
+        // always fills whole packets, except the last one on flush
+        const size_t n_bytes = encoded_size(pcm_pos_);
+
+#ifdef ROC_FIXED_POINT
+        // Q15 samples match the libopus 16-bit API
+        int ret = opus_encode(encoder_, pcm_, (int)pcm_pos_,
+                              (unsigned char*)frame_data_, (opus_int32)n_bytes);
+#else
+        int ret =
+            opus_encode_float(encoder_, pcm_, (int)pcm_pos_,
+                              (unsigned char*)frame_data_, (opus_int32)n_bytes);
+#endif
+
+        if (ret > 0 && (size_t)ret < n_bytes) {
+            ret = opus_packet_pad((unsigned char*)frame_data_, ret, (opus_int32)n_bytes);
+            if (ret == OPUS_OK) {
+                ret = (int)n_bytes;
+            }
+        }
+
+        if (ret != (int)n_bytes) {
+            roc_log(LogError, "opus encoder: can't encode %lu samples to %lu bytes: %s",
+                    (unsigned long)pcm_pos_, (unsigned long)n_bytes,
+                    ret < 0 ? opus_strerror(ret) : "unexpected payload size");
+            memset(frame_data_, 0, n_bytes);
+        }
+    }
+
+    frame_data_ = NULL;
+    frame_size_ = 0;
+
+    pcm_pos_ = 0;
+    pcm_len_ = 0;
+}
+
+} // namespace audio
+} // namespace roc
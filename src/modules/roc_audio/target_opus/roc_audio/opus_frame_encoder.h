@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_opus/roc_audio/opus_frame_encoder.h
+//! @brief Opus frame encoder.
+
+#ifndef ROC_AUDIO_OPUS_FRAME_ENCODER_H_
+#define ROC_AUDIO_OPUS_FRAME_ENCODER_H_
+
+#include "roc_audio/iframe_encoder.h"
+#include "roc_audio/opus_params.h"
+#include "roc_core/noncopyable.h"
+
+#include <opus/opus.h>
+
+namespace roc {
+namespace audio {
+
+//! Opus frame encoder.
+//! @remarks
+//!  Accumulates interleaved samples between begin() and end() and encodes
+//!  them into the frame with a single libopus call on end().
+class OpusFrameEncoder : public IFrameEncoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    OpusFrameEncoder();
+
+    virtual ~OpusFrameEncoder();
+
+    //! Check if the encoder was successfully constructed.
+    bool valid() const;
+
+    //! Calculate encoded frame size for given number of samples per channel.
+    virtual size_t encoded_size(size_t num_samples) const;
+
+    //! Start encoding a new frame.
+    virtual void begin(void* frame, size_t frame_size);
+
+    //! Encode samples.
+    virtual size_t
+    write(const sample_t* samples, size_t n_samples, packet::channel_mask_t channels);
+
+    //! Finish encoding frame.
+    virtual void end();
+
+private:
+    ::OpusEncoder* encoder_;
+
+    void* frame_data_;
+    size_t frame_size_;
+
+    // samples accumulated for the current frame, interleaved
+    sample_t pcm_[OpusMaxFrameSamples * OpusNumChannels];
+    size_t pcm_pos_;
+    size_t pcm_len_;
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_OPUS_FRAME_ENCODER_H_
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_audio/target_opus/roc_audio/opus_params.h
+//! @brief Opus stream parameters.
+
+#ifndef ROC_AUDIO_OPUS_PARAMS_H_
+#define ROC_AUDIO_OPUS_PARAMS_H_
+
+namespace roc {
+namespace audio {
+
+//! Opus stream parameters.
+//!
+//! The encoder runs in hard CBR mode, so that the payload size is a fixed
+//! function of the number of samples. This is required by Packetizer, which
+//! allocates the payload before encoding into it, and it also keeps FEC
+//! block sizes constant.
+//!
+//! The bitrate is chosen so that every frame size allowed by Opus maps to
+//! a whole number of bytes and back without rounding.
+enum {
+    //! Sample rate, Hz.
+    OpusSampleRate = 48000,
+
+    //! Number of channels.
+    OpusNumChannels = 2,
+
+    //! Channel mask.
+    OpusChannelMask = 0x3,
+
+    //! Bitrate, bits per second.
+    OpusBitrate = 128000,
+
+    //! Maximum frame size allowed by Opus, samples per channel (60 ms).
+    OpusMaxFrameSamples = 2880
+};
+
+} // namespace audio
+} // namespace roc
+
+#endif // ROC_AUDIO_OPUS_PARAMS_H_
@@ -8,5 +8,14 @@
 
 #include "roc_audio/units.h"
 
+#ifdef ROC_FIXED_POINT
+
+const roc::audio::sample_t roc::audio::SampleMax = 32767;
+const roc::audio::sample_t roc::audio::SampleMin = -32768;
+
+#else // !ROC_FIXED_POINT
+
 const roc::audio::sample_t roc::audio::SampleMax = 1;
 const roc::audio::sample_t roc::audio::SampleMin = -1;
+
+#endif // ROC_FIXED_POINT
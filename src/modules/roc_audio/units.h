@@ -17,9 +17,20 @@
 namespace roc {
 namespace audio {
 
+#ifdef ROC_FIXED_POINT
+
+//! Audio sample.
+//! In fixed-point mode, samples are Q15 integers in [-32768; 32767], so
+//! that FPU-less targets can run the pipeline without soft-float calls.
+typedef int16_t sample_t;
+
+#else // !ROC_FIXED_POINT
+
 //! Audio sample.
 typedef float sample_t;
 
+#endif // ROC_FIXED_POINT
+
 //! Maximum possible value of a sample.
 extern const sample_t SampleMax;
 
@@ -7,6 +7,7 @@
  */
 
 #include "roc_audio/watchdog.h"
+#include "roc_core/flight_recorder.h"
 #include "roc_core/log.h"
 
 namespace roc {
@@ -76,15 +77,27 @@ bool Watchdog::valid() const {
 }
 
 void Watchdog::read(Frame& frame) {
+    if (!begin_read(frame)) {
+        return;
+    }
+
+    reader_.read(frame);
+
+    end_read(frame);
+}
+
+bool Watchdog::begin_read(Frame& frame) {
     if (!alive_) {
         if (frame.size() != 0) {
             memset(frame.data(), 0, frame.size() * sizeof(sample_t));
         }
-        return;
+        return false;
     }
 
-    reader_.read(frame);
+    return true;
+}
 
+void Watchdog::end_read(const Frame& frame) {
     const packet::timestamp_t next_read_pos =
         packet::timestamp_t(curr_read_pos_ + frame.size() / num_channels_);
 
@@ -96,6 +109,8 @@ void Watchdog::read(Frame& frame) {
 
     if (!check_drops_timeout_()) {
         flush_status_();
+        // preserve the packet flow leading up to the failure
+        core::FlightRecorder::instance().trigger();
         alive_ = false;
     }
 }
@@ -107,6 +122,7 @@ bool Watchdog::update() {
 
     if (!check_blank_timeout_()) {
         flush_status_();
+        core::FlightRecorder::instance().trigger();
         alive_ = false;
         return false;
     }
@@ -114,6 +130,23 @@ bool Watchdog::update() {
     return true;
 }
 
+bool Watchdog::alive() const {
+    return alive_;
+}
+
+packet::timestamp_t Watchdog::blank_timeout_remaining() const {
+    if (max_blank_duration_ == 0 || !alive_) {
+        return 0;
+    }
+
+    const packet::timestamp_t elapsed = curr_read_pos_ - last_pos_before_blank_;
+    if (elapsed >= max_blank_duration_) {
+        return 0;
+    }
+
+    return max_blank_duration_ - elapsed;
+}
+
 void Watchdog::update_blank_timeout_(const Frame& frame,
                                      packet::timestamp_t next_read_pos) {
     if (max_blank_duration_ == 0) {
@@ -79,6 +79,20 @@ public:
     //!  Updates stream state and reads frame from the input reader.
     virtual void read(Frame& frame);
 
+    //! Prepare for reading a frame, without the upstream hop.
+    //! @remarks
+    //!  Together with end_read(), allows compile-time composed chains
+    //!  (see FusedReader) to drive the watchdog around a direct upstream
+    //!  call instead of going through read().
+    //! @returns
+    //!  false if the session is already terminated; the frame is filled
+    //!  with zeros and should not be read from upstream.
+    bool begin_read(Frame& frame);
+
+    //! Update stream state with a frame read from upstream.
+    //! @see begin_read.
+    void end_read(const Frame& frame);
+
     //! Update stream.
     //! @returns
     //!  false if during the session timeout each frame has an empty flag or the maximum
@@ -86,6 +100,19 @@ public:
     //!  filled and contain dropped packets was exceeded.
     bool update();
 
+    //! Check if the stream is still considered alive.
+    //! @remarks
+    //!  Unlike update(), doesn't evaluate the blank timeout; to be used when
+    //!  the timeout deadline is tracked externally (see blank_timeout_remaining()).
+    bool alive() const;
+
+    //! Number of samples left until the blank timeout would fire if the
+    //! stream stays blank.
+    //! @remarks
+    //!  Allows to schedule a deadline instead of polling update() every
+    //!  frame. Returns zero if the blank timeout is disabled or reached.
+    packet::timestamp_t blank_timeout_remaining() const;
+
 private:
     void update_blank_timeout_(const Frame& frame, packet::timestamp_t next_read_pos);
     bool check_blank_timeout_() const;
@@ -32,6 +32,51 @@ inline size_t max_align(size_t sz) {
     return sz;
 }
 
+//! Size of a cache line in bytes.
+//! @remarks
+//!  Covers contemporary x86 and ARM cores; used to align hot data so that
+//!  it doesn't straddle cache lines and aligned SIMD loads are possible.
+enum { CacheLineSize = 64 };
+
+//! Align a variable or member on a cache line boundary.
+#define ROC_ALIGN_CACHELINE __attribute__((aligned(::roc::core::CacheLineSize)))
+
+//! A value aligned and padded to occupy whole cache line(s).
+//! @remarks
+//!  Wraps a member so that it doesn't share a cache line with adjacent
+//!  members. Used in cross-thread structures to keep state written by
+//!  one thread away from state read by another, so that writes on one
+//!  side don't invalidate the other side's line.
+template <class T> struct ROC_ALIGN_CACHELINE CacheAligned {
+    //! Wrapped value.
+    T value;
+
+    CacheAligned()
+        : value() {
+    }
+
+    //! Forward single-argument constructor.
+    template <class Arg>
+    explicit CacheAligned(Arg& arg)
+        : value(arg) {
+    }
+
+    //! Forward single-argument constructor.
+    template <class Arg>
+    explicit CacheAligned(const Arg& arg)
+        : value(arg) {
+    }
+};
+
+//! Adjust the given size to be cache-line aligned.
+inline size_t cache_line_align(size_t sz) {
+    enum { Align = CacheLineSize };
+    if (sz % Align != 0) {
+        sz += Align - sz % Align;
+    }
+    return sz;
+}
+
 //! Calculate padding required for given alignment.
 inline size_t padding(size_t size, size_t alignment) {
     if (alignment == 0) {
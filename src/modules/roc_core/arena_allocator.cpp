@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/arena_allocator.h"
+#include "roc_core/alignment.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+ArenaAllocator::ArenaAllocator(IAllocator& backing_allocator, size_t chunk_size)
+    : backing_allocator_(backing_allocator)
+    , chunk_size_(max_align(chunk_size))
+    , cur_chunk_(NULL) {
+    if (chunk_size == 0) {
+        roc_panic("arena allocator: chunk size is zero");
+    }
+}
+
+ArenaAllocator::~ArenaAllocator() {
+    while (Chunk* chunk = chunks_.front()) {
+        chunks_.remove(*chunk);
+        chunk->~Chunk();
+        backing_allocator_.deallocate(chunk);
+    }
+}
+
+void* ArenaAllocator::allocate(size_t size) {
+    size = max_align(size);
+
+    if (!cur_chunk_ || cur_chunk_->used + size > cur_chunk_->size) {
+        if (!next_chunk_(size)) {
+            return NULL;
+        }
+    }
+
+    void* ptr = chunk_data_(*cur_chunk_) + cur_chunk_->used;
+    cur_chunk_->used += size;
+
+    return ptr;
+}
+
+void ArenaAllocator::deallocate(void*) {
+    // no-op: the memory is reclaimed in bulk by reset() or destructor
+}
+
+void ArenaAllocator::reset() {
+    for (Chunk* chunk = chunks_.front(); chunk; chunk = chunks_.nextof(*chunk)) {
+        chunk->used = 0;
+    }
+
+    cur_chunk_ = NULL;
+}
+
+size_t ArenaAllocator::num_chunks() const {
+    return chunks_.size();
+}
+
+char* ArenaAllocator::chunk_data_(Chunk& chunk) {
+    return (char*)&chunk + max_align(sizeof(Chunk));
+}
+
+bool ArenaAllocator::next_chunk_(size_t size) {
+    // try to reuse a chunk retained by reset()
+    Chunk* next = cur_chunk_ ? chunks_.nextof(*cur_chunk_) : chunks_.front();
+
+    if (next && next->size >= size) {
+        cur_chunk_ = next;
+        return true;
+    }
+
+    const size_t data_size = size > chunk_size_ ? size : chunk_size_;
+
+    void* memory = backing_allocator_.allocate(max_align(sizeof(Chunk)) + data_size);
+    if (!memory) {
+        roc_log(LogError, "arena allocator: can't allocate chunk: chunk_size=%lu",
+                (unsigned long)data_size);
+        return false;
+    }
+
+    Chunk* chunk = new (memory) Chunk;
+    chunk->size = data_size;
+    chunk->used = 0;
+
+    if (next) {
+        chunks_.insert_before(*chunk, *next);
+    } else {
+        chunks_.push_back(*chunk);
+    }
+
+    cur_chunk_ = chunk;
+    return true;
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/arena_allocator.h
+//! @brief Arena allocator implementation.
+
+#ifndef ROC_CORE_ARENA_ALLOCATOR_H_
+#define ROC_CORE_ARENA_ALLOCATOR_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Arena allocator implementation.
+//!
+//! Serves allocations by bumping a pointer inside chunks obtained from the
+//! backing allocator. Individual deallocations are no-ops; all memory is
+//! reclaimed at once with reset(), which retains the chunks for reuse, so
+//! repetitive allocation patterns stop hitting the backing allocator at all.
+//!
+//! Intended for temporary allocations whose lifetime is bounded by a well
+//! defined scope, e.g. processing of a single frame or block. Not thread-safe.
+class ArenaAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Chunks of at least @p chunk_size bytes are obtained from
+    //!  @p backing_allocator on demand.
+    ArenaAllocator(IAllocator& backing_allocator, size_t chunk_size);
+
+    //! Destroy. Release all chunks.
+    ~ArenaAllocator();
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    //! @remarks
+    //!  No-op; the memory is reclaimed by reset() or destructor.
+    virtual void deallocate(void*);
+
+    //! Reclaim all allocated memory at once.
+    //! @remarks
+    //!  Chunks are not returned to the backing allocator but retained
+    //!  for future allocations.
+    void reset();
+
+    //! Get number of chunks obtained from the backing allocator.
+    size_t num_chunks() const;
+
+private:
+    struct Chunk : ListNode {
+        size_t size;
+        size_t used;
+    };
+
+    static char* chunk_data_(Chunk& chunk);
+
+    bool next_chunk_(size_t size);
+
+    IAllocator& backing_allocator_;
+    const size_t chunk_size_;
+
+    List<Chunk, NoOwnership> chunks_;
+    Chunk* cur_chunk_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_ARENA_ALLOCATOR_H_
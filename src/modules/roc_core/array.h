@@ -12,6 +12,7 @@
 #ifndef ROC_CORE_ARRAY_H_
 #define ROC_CORE_ARRAY_H_
 
+#include "roc_core/alignment.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/log.h"
 #include "roc_core/noncopyable.h"
@@ -22,7 +23,14 @@ namespace roc {
 namespace core {
 
 //! Dynamic array.
-template <class T> class Array : public NonCopyable<> {
+//!
+//! @tparam T defines the element type.
+//!
+//! @tparam EmbeddedCapacity defines the number of elements that are stored
+//! directly inside the array object. The allocator is used only when the
+//! array grows beyond the embedded capacity, so small arrays cost no
+//! allocations and no pointer chase.
+template <class T, size_t EmbeddedCapacity = 0> class Array : public NonCopyable<> {
 public:
     //! Initialize empty array.
     explicit Array(IAllocator& allocator)
@@ -30,12 +38,16 @@ public:
         , size_(0)
         , max_size_(0)
         , allocator_(allocator) {
+        if (EmbeddedCapacity != 0) {
+            data_ = (T*)embedded_data_.mem;
+            max_size_ = EmbeddedCapacity;
+        }
     }
 
     ~Array() {
         resize(0);
 
-        if (data_) {
+        if (data_ && !is_embedded_()) {
             allocator_.deallocate(data_);
         }
     }
@@ -174,7 +186,7 @@ public:
             data_[n - 1].~T();
         }
 
-        if (data_) {
+        if (data_ && !is_embedded_()) {
             allocator_.deallocate(data_);
         }
 
@@ -185,9 +197,19 @@ public:
     }
 
 private:
+    bool is_embedded_() const {
+        return (void*)data_ == (void*)embedded_data_.mem;
+    }
+
     T* data_;
     size_t size_;
     size_t max_size_;
+
+    union {
+        MaxAlign align;
+        char mem[EmbeddedCapacity != 0 ? EmbeddedCapacity * sizeof(T) : 1];
+    } embedded_data_;
+
     IAllocator& allocator_;
 };
 
@@ -12,6 +12,7 @@
 #ifndef ROC_CORE_BUFFER_H_
 #define ROC_CORE_BUFFER_H_
 
+#include "roc_core/alignment.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/refcnt.h"
 #include "roc_core/stddefs.h"
@@ -29,8 +30,12 @@ public:
     }
 
     //! Get buffer data.
+    //! @remarks
+    //!  The data always starts at a cache-line boundary: the pool allocates
+    //!  buffers with cache-line alignment and the header is padded to a
+    //!  whole number of cache lines.
     T* data() {
-        return (T*)(((char*)this) + sizeof(Buffer));
+        return (T*)(((char*)this) + cache_line_align(sizeof(Buffer)));
     }
 
     //! Get maximum number of elements.
@@ -40,7 +45,7 @@ public:
 
     //! Get pointer to buffer from the pointer to its data.
     static Buffer* container_of(void* data) {
-        return (Buffer*)((char*)data - sizeof(Buffer));
+        return (Buffer*)((char*)data - cache_line_align(sizeof(Buffer)));
     }
 
 private:
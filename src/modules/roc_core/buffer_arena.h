@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/buffer_arena.h
+//! @brief Buffer recycling arena.
+
+#ifndef ROC_CORE_BUFFER_ARENA_H_
+#define ROC_CORE_BUFFER_ARENA_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Buffer recycling arena.
+//!
+//! Retains a fixed set of buffers allocated from a buffer pool and hands
+//! them out again once all other references are gone, so that a consumer
+//! with a bounded working set of short-lived buffers performs pool
+//! operations only while the arena warms up, and none in steady state.
+//!
+//! Unlike the pool itself, the arena is not thread-safe; it is meant to
+//! be owned by a single consumer.
+template <class T> class BufferArena : public NonCopyable<> {
+public:
+    //! Initialize.
+    BufferArena(BufferPool<T>& pool, IAllocator& allocator)
+        : pool_(pool)
+        , slots_(allocator) {
+    }
+
+    //! Get number of retained buffers.
+    size_t size() const {
+        return slots_.size();
+    }
+
+    //! Set number of retained buffers.
+    //! @remarks
+    //!  Growing keeps the already retained buffers; shrinking releases the
+    //!  dropped slots back to the pool.
+    bool resize(size_t n_slots) {
+        return slots_.resize(n_slots);
+    }
+
+    //! Acquire a buffer of given size.
+    //! @remarks
+    //!  Reuses a retained buffer if one is no longer referenced outside the
+    //!  arena, and falls back to the pool otherwise. A buffer obtained from
+    //!  the pool is retained for future reuse if a free slot is available.
+    //! @returns
+    //!  an attached slice of @p size elements, or an empty slice if @p size
+    //!  exceeds the pool buffer size or the pool is exhausted.
+    Slice<T> acquire(size_t size) {
+        for (size_t n = 0; n < slots_.size(); n++) {
+            if (slots_[n] && slots_[n].buffer_refcount() == 1
+                && slots_[n].capacity() >= size) {
+                Slice<T> buffer = slots_[n];
+                buffer.resize(size);
+                return buffer;
+            }
+        }
+
+        Slice<T> buffer = new (pool_) Buffer<T>(pool_);
+        if (!buffer) {
+            return Slice<T>();
+        }
+
+        if (buffer.capacity() < size) {
+            return Slice<T>();
+        }
+        buffer.resize(size);
+
+        for (size_t n = 0; n < slots_.size(); n++) {
+            if (!slots_[n]) {
+                slots_[n] = buffer;
+                break;
+            }
+        }
+
+        return buffer;
+    }
+
+    //! Acquire a buffer spanning the whole pool buffer size.
+    Slice<T> acquire() {
+        return acquire(pool_.buffer_size());
+    }
+
+private:
+    BufferPool<T>& pool_;
+    Array<Slice<T> > slots_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_BUFFER_ARENA_H_
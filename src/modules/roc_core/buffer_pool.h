@@ -12,6 +12,7 @@
 #ifndef ROC_CORE_BUFFER_POOL_H_
 #define ROC_CORE_BUFFER_POOL_H_
 
+#include "roc_core/alignment.h"
 #include "roc_core/pool.h"
 
 namespace roc {
@@ -20,11 +21,19 @@ namespace core {
 template <class T> class Buffer;
 
 //! Buffer pool.
+//!
+//! Buffers are allocated with cache-line alignment and the buffer header
+//! is padded to a whole number of cache lines, so that the data returned
+//! by Buffer::data() always starts at a cache-line boundary; see
+//! CacheLineSize.
 template <class T> class BufferPool : public Pool<Buffer<T> > {
 public:
     //! Initialization.
     BufferPool(IAllocator& allocator, size_t buff_size, bool poison)
-        : Pool<Buffer<T> >(allocator, sizeof(Buffer<T>) + sizeof(T) * buff_size, poison)
+        : Pool<Buffer<T> >(allocator,
+                           cache_line_align(sizeof(Buffer<T>)) + sizeof(T) * buff_size,
+                           poison,
+                           CacheLineSize)
         , buff_size_(buff_size) {
     }
 
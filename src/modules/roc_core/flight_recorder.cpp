@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "roc_core/flight_recorder.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+const char* stage_to_str(uint32_t stage) {
+    switch (stage) {
+    case FlightRecorder::Stage_NetioRecv:
+        return "netio_recv";
+    case FlightRecorder::Stage_NetioSend:
+        return "netio_send";
+    case FlightRecorder::Stage_ReceiverPacket:
+        return "receiver_packet";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace
+
+FlightRecorder::FlightRecorder()
+    : dump_path_(getenv("ROC_FLIGHT_RECORDER_DUMP"))
+    , serial_(0) {
+    memset(ring_, 0, sizeof(ring_));
+
+    // slot zero would otherwise look like a valid record with serial zero
+    ring_[0].serial = (uint64_t)-1;
+}
+
+void FlightRecorder::record(Stage stage,
+                            uint32_t stream,
+                            uint32_t seqnum,
+                            uint32_t value) {
+    const uint64_t serial = (uint64_t)serial_.incr_relaxed() - 1;
+
+    Record& rec = ring_[serial % NumRecords];
+
+    rec.serial = serial;
+    rec.timestamp = (uint64_t)timestamp();
+    rec.stage = (uint32_t)stage;
+    rec.stream = stream;
+    rec.seqnum = seqnum;
+    rec.value = value;
+}
+
+bool FlightRecorder::dump(const char* path) {
+    FILE* fp = fopen(path, "w");
+    if (!fp) {
+        roc_log(LogError, "flight recorder: can't open dump file: %s", path);
+        return false;
+    }
+
+    const uint64_t end = (uint64_t)(long)serial_;
+    const uint64_t begin = end > NumRecords ? end - NumRecords : 0;
+
+    size_t n_records = 0;
+
+    for (uint64_t s = begin; s < end; s++) {
+        // racy copy; slots overwritten or being written while we read
+        // them carry a foreign serial and are skipped
+        const Record rec = ring_[s % NumRecords];
+        if (rec.serial != s) {
+            continue;
+        }
+
+        fprintf(fp, "%llu ts=%llu stage=%s stream=%lu seqnum=%lu value=%lu\n",
+                (unsigned long long)rec.serial, (unsigned long long)rec.timestamp,
+                stage_to_str(rec.stage), (unsigned long)rec.stream,
+                (unsigned long)rec.seqnum, (unsigned long)rec.value);
+
+        n_records++;
+    }
+
+    fclose(fp);
+
+    roc_log(LogInfo, "flight recorder: dumped %lu records to %s",
+            (unsigned long)n_records, path);
+
+    return true;
+}
+
+void FlightRecorder::trigger() {
+    if (!dump_path_ || !*dump_path_) {
+        return;
+    }
+
+    dump(dump_path_);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/flight_recorder.h
+//! @brief Flight recorder.
+
+#ifndef ROC_CORE_FLIGHT_RECORDER_H_
+#define ROC_CORE_FLIGHT_RECORDER_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Flight recorder.
+//!
+//! Always-on in-memory "black box": netio and pipeline stages append
+//! compact per-packet records into a fixed-size ring, so that the recent
+//! packet flow can be reconstructed after an incident without enabling
+//! verbose logs beforehand.
+//!
+//! Appending is lock-free and wait-free: a writer claims a slot with one
+//! relaxed atomic increment and fills it in place. A record may be torn
+//! only if its writer is preempted for a full lap of the ring; the serial
+//! number stored inside each record lets dump() detect and skip such
+//! slots, so a dump taken from a live process is best-effort but never
+//! blocks the writers.
+//!
+//! dump() writes the recorded history to a file on demand. If the
+//! ROC_FLIGHT_RECORDER_DUMP environment variable is set to a path,
+//! trigger() dumps there; it is invoked from watchdog-style failure
+//! paths, so the recording around an incident is preserved automatically.
+class FlightRecorder : public NonCopyable<> {
+public:
+    //! Stage that produced a record.
+    enum Stage {
+        Stage_NetioRecv = 1, //!< Datagram received from socket; value is size.
+        Stage_NetioSend,     //!< Datagram handed to socket; value is size.
+        Stage_ReceiverPacket //!< Packet entered receiver pipeline; value is
+                             //!< the incoming queue size.
+    };
+
+    //! Get flight recorder instance.
+    static FlightRecorder& instance() {
+        return Singleton<FlightRecorder>::instance();
+    }
+
+    //! Append a record.
+    //! @remarks
+    //!  May be called concurrently from any thread, never blocks.
+    void record(Stage stage, uint32_t stream, uint32_t seqnum, uint32_t value);
+
+    //! Dump recorded history to a file, oldest records first.
+    //! @returns
+    //!  false if the file can't be written.
+    bool dump(const char* path);
+
+    //! Dump to the path from the ROC_FLIGHT_RECORDER_DUMP environment
+    //! variable, if it is set; no-op otherwise.
+    //! @remarks
+    //!  Called from failure paths like watchdog session termination.
+    void trigger();
+
+private:
+    friend class Singleton<FlightRecorder>;
+
+    enum { NumRecords = 8192 };
+
+    struct Record {
+        uint64_t serial;    // claim counter value; identifies torn slots
+        uint64_t timestamp; // nanoseconds, same clock as core::timestamp()
+        uint32_t stage;
+        uint32_t stream; // stage-specific stream id, e.g. source or port
+        uint32_t seqnum; // stage-specific sequence number, zero if unknown
+        uint32_t value;  // stage-specific payload, e.g. size or queue depth
+    };
+
+    FlightRecorder();
+
+    const char* dump_path_;
+
+    Atomic serial_;
+    Record ring_[NumRecords];
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_FLIGHT_RECORDER_H_
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/hashmap.h
+//! @brief Intrusive hash map.
+
+#ifndef ROC_CORE_HASHMAP_H_
+#define ROC_CORE_HASHMAP_H_
+
+#include "roc_core/array.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Intrusive hash map node.
+//! @remarks
+//!  Embedded into the element; a copied node is not a member of the map.
+struct HashmapNode {
+    //! Next node in the bucket chain.
+    HashmapNode* hashmap_next;
+
+    //! Cached hash of the element key.
+    size_t hashmap_hash;
+
+    HashmapNode()
+        : hashmap_next(NULL)
+        , hashmap_hash(0) {
+    }
+};
+
+//! Intrusive hash map with a fixed number of buckets.
+//!
+//! @tparam T defines the element type; it should inherit HashmapNode and
+//! provide methods:
+//! @code
+//!   Key key() const;                       // element key
+//!   static size_t key_hash(const Key&);    // key hash function
+//! @endcode
+//!
+//! @tparam Key defines the key type; it should be comparable with ==.
+//!
+//! Multiple elements with equal keys may be inserted; they can be visited
+//! with find() and find_next(). The map doesn't own elements and doesn't
+//! allocate anything except the bucket array.
+template <class T, class Key> class Hashmap : public NonCopyable<> {
+public:
+    //! Initialize empty hash map.
+    explicit Hashmap(IAllocator& allocator)
+        : buckets_(allocator)
+        , size_(0) {
+    }
+
+    //! Allocate bucket array.
+    //! @remarks
+    //!  Should be called before inserting elements. The number of buckets
+    //!  doesn't limit the number of elements, only the chain lengths.
+    //! @returns
+    //!  false if the allocation failed.
+    bool grow(size_t n_buckets) {
+        if (n_buckets == 0) {
+            roc_panic("hashmap: number of buckets is zero");
+        }
+        return buckets_.resize(n_buckets);
+    }
+
+    //! Get number of elements in the map.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Find first element with given key.
+    //! @returns
+    //!  the element, or NULL if there is no such element.
+    T* find(const Key& key) {
+        const size_t hash = T::key_hash(key);
+
+        for (HashmapNode* node = bucket_(hash); node; node = node->hashmap_next) {
+            if (node->hashmap_hash == hash && elem_(node)->key() == key) {
+                return elem_(node);
+            }
+        }
+
+        return NULL;
+    }
+
+    //! Find next element with given key.
+    //! @returns
+    //!  the next element after @p element with the same key, or NULL.
+    T* find_next(T& element, const Key& key) {
+        for (HashmapNode* node = node_(element)->hashmap_next; node;
+             node = node->hashmap_next) {
+            if (node->hashmap_hash == node_(element)->hashmap_hash
+                && elem_(node)->key() == key) {
+                return elem_(node);
+            }
+        }
+
+        return NULL;
+    }
+
+    //! Insert element into the map.
+    void insert(T& element) {
+        if (buckets_.size() == 0) {
+            roc_panic("hashmap: attempting to insert into map without buckets");
+        }
+
+        HashmapNode* node = node_(element);
+
+        node->hashmap_hash = T::key_hash(element.key());
+        node->hashmap_next = bucket_(node->hashmap_hash);
+
+        bucket_(node->hashmap_hash) = node;
+        size_++;
+    }
+
+    //! Remove element from the map.
+    void remove(T& element) {
+        HashmapNode* node = node_(element);
+
+        HashmapNode** holder = &bucket_(node->hashmap_hash);
+
+        while (*holder != node) {
+            if (*holder == NULL) {
+                roc_panic("hashmap: attempting to remove element not in map");
+            }
+            holder = &(*holder)->hashmap_next;
+        }
+
+        *holder = node->hashmap_next;
+        node->hashmap_next = NULL;
+        size_--;
+    }
+
+private:
+    static HashmapNode* node_(T& element) {
+        return static_cast<HashmapNode*>(&element);
+    }
+
+    static T* elem_(HashmapNode* node) {
+        return static_cast<T*>(node);
+    }
+
+    HashmapNode*& bucket_(size_t hash) {
+        return buckets_[hash % buckets_.size()];
+    }
+
+    Array<HashmapNode*> buckets_;
+    size_t size_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_HASHMAP_H_
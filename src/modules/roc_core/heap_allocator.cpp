@@ -12,27 +12,27 @@ namespace roc {
 namespace core {
 
 HeapAllocator::~HeapAllocator() {
-    if (num_allocations_ != 0) {
+    if (num_allocations_.load_relaxed() != 0) {
         roc_panic("heap allocator: detected leak, num_allocations=%d",
-                  (int)num_allocations_);
+                  (int)num_allocations_.load_relaxed());
     }
 }
 
 void* HeapAllocator::allocate(size_t size) {
-    ++num_allocations_;
+    num_allocations_.incr_relaxed();
     return new char[size];
 }
 
 void HeapAllocator::deallocate(void* ptr) {
-    if (num_allocations_ <= 0) {
+    if (num_allocations_.load_relaxed() <= 0) {
         roc_panic("heap allocator: unpaired deallocate");
     }
-    --num_allocations_;
+    num_allocations_.decr_relaxed();
     delete[](char*) ptr;
 }
 
 size_t HeapAllocator::num_allocations() const {
-    return (size_t)num_allocations_;
+    return (size_t)num_allocations_.load_relaxed();
 }
 
 } // namespace core
@@ -154,17 +154,45 @@ public:
     //! @pre
     //!  @p element should be member of this list.
     void remove(T& element) {
-        ListNode::ListNodeData* data = element.list_node_data();
-        check_is_member_(data, this);
-
-        data->prev->next = data->next;
-        data->next->prev = data->prev;
+        detach_(element);
 
-        data->list = NULL;
+        Ownership<T>::release(element);
+    }
 
-        size_--;
+    //! Remove first element from list without releasing ownership.
+    //!
+    //! @remarks
+    //!  The ownership of the element held by the list is transferred to the
+    //!  caller, which should attach it to a smart pointer with adopt() or
+    //!  release it manually. Doesn't touch the reference counter.
+    //!
+    //! @returns
+    //!  raw pointer to the detached element or NULL if list is empty.
+    T* detach_front() {
+        if (size_ == 0) {
+            return NULL;
+        }
+        T* element = container_of_(head_.next);
+        detach_(*element);
+        return element;
+    }
 
-        Ownership<T>::release(element);
+    //! Remove last element from list without releasing ownership.
+    //!
+    //! @remarks
+    //!  The ownership of the element held by the list is transferred to the
+    //!  caller, which should attach it to a smart pointer with adopt() or
+    //!  release it manually. Doesn't touch the reference counter.
+    //!
+    //! @returns
+    //!  raw pointer to the detached element or NULL if list is empty.
+    T* detach_back() {
+        if (size_ == 0) {
+            return NULL;
+        }
+        T* element = container_of_(head_.prev);
+        detach_(*element);
+        return element;
     }
 
 private:
@@ -179,6 +207,18 @@ private:
         }
     }
 
+    void detach_(T& element) {
+        ListNode::ListNodeData* data = element.list_node_data();
+        check_is_member_(data, this);
+
+        data->prev->next = data->next;
+        data->next->prev = data->prev;
+
+        data->list = NULL;
+
+        size_--;
+    }
+
     void insert_(T& element, T* before) {
         ListNode::ListNodeData* data_new = element.list_node_data();
         check_is_member_(data_new, NULL);
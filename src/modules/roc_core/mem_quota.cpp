@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/mem_quota.h"
+
+namespace roc {
+namespace core {
+
+MemQuota::MemQuota(size_t max_bytes)
+    : used_(0)
+    , max_bytes_(max_bytes) {
+}
+
+bool MemQuota::acquire(size_t n_bytes) {
+    const long used = used_.add_relaxed((long)n_bytes);
+
+    if (max_bytes_ != 0 && (size_t)used > max_bytes_) {
+        used_.add_relaxed(-(long)n_bytes);
+        return false;
+    }
+
+    return true;
+}
+
+void MemQuota::release(size_t n_bytes) {
+    used_.add_relaxed(-(long)n_bytes);
+}
+
+size_t MemQuota::used() const {
+    return (size_t)used_.load_relaxed();
+}
+
+size_t MemQuota::max_bytes() const {
+    return max_bytes_;
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/mem_quota.h
+//! @brief Memory quota.
+
+#ifndef ROC_CORE_MEM_QUOTA_H_
+#define ROC_CORE_MEM_QUOTA_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Memory quota.
+//!
+//! Caps the total number of bytes obtained from a backing allocator by
+//! one or more consumers sharing the quota, so that worst-case memory
+//! usage is bounded by configuration instead of by the workload, e.g. a
+//! packet flood can't grow the packet pools until the OOM killer steps
+//! in. The counter is a relaxed atomic checked only on the rare
+//! chunk-growth paths, so enforcement costs nothing in steady state.
+//!
+//! Thread-safe.
+class MemQuota : public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  @p max_bytes of zero disables the cap; the usage is still counted.
+    explicit MemQuota(size_t max_bytes);
+
+    //! Account @p n_bytes against the quota.
+    //! @returns
+    //!  false if the cap would be exceeded, leaving the usage unchanged.
+    bool acquire(size_t n_bytes);
+
+    //! Return previously acquired bytes.
+    void release(size_t n_bytes);
+
+    //! Get the number of currently acquired bytes.
+    size_t used() const;
+
+    //! Get the configured cap, zero if unlimited.
+    size_t max_bytes() const;
+
+private:
+    Atomic used_;
+    const size_t max_bytes_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_MEM_QUOTA_H_
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/mpsc_queue.h
+//! @brief Multi-producer single-consumer queue.
+
+#ifndef ROC_CORE_MPSC_QUEUE_H_
+#define ROC_CORE_MPSC_QUEUE_H_
+
+#include "roc_core/alignment.h"
+#include "roc_core/mpsc_queue_node.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/ownership.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Intrusive multi-producer single-consumer queue.
+//!
+//! Based on Dmitry Vyukov's intrusive MPSC queue: multiple threads may
+//! call push_back() concurrently without blocking each other, and a
+//! single thread may call pop_front(). Producers synchronize with a CAS
+//! on the tail pointer only; no mutexes are involved.
+//!
+//! pop_front() may return NULL when the queue is not empty if it hits a
+//! producer between its two non-atomic steps; the producer is guaranteed
+//! to finish the push shortly, so the caller may either retry or treat
+//! the queue as empty and wait for the next push notification.
+//!
+//! @tparam T defines object type, it should inherit MpscQueueNode.
+//! @tparam Ownership defines ownership policy which is used to acquire an element
+//! ownership when it's added to the queue and release ownership when it's removed
+//! from the queue
+template <class T, template <class TT> class Ownership = RefCntOwnership>
+class MpscQueue : public NonCopyable<> {
+    typedef typename Ownership<T>::Pointer Pointer;
+
+public:
+    MpscQueue()
+        : head_(&stub_)
+        , tail_(&stub_) {
+    }
+
+    ~MpscQueue() {
+        // may not remove everything if a producer died mid-push,
+        // which is impossible if the queue is destroyed correctly
+        while (pop_front()) {
+        }
+    }
+
+    //! Append element to the end of the queue.
+    //! @remarks
+    //!  Acquires ownership of @p element. May be called concurrently
+    //!  from any number of threads.
+    void push_back(T& element) {
+        MpscQueueNode::MpscQueueData* node = element.mpsc_queue_data();
+
+        if (!__sync_bool_compare_and_swap(&node->queue, (void*)NULL, (void*)this)) {
+            roc_panic("mpsc queue: attempt to insert element which is already in queue");
+        }
+
+        Ownership<T>::acquire(element);
+
+        push_node_(node);
+    }
+
+    //! Remove first element from the queue.
+    //! @returns
+    //!  the first queue element or NULL if the queue is empty or a
+    //!  concurrent push is in progress. May be called only from one
+    //!  (consumer) thread.
+    Pointer pop_front() {
+        T* element = detach_front();
+        if (element == NULL) {
+            return NULL;
+        }
+
+        Pointer ptr = element;
+        Ownership<T>::release(*element);
+
+        return ptr;
+    }
+
+    //! Remove first element from the queue without releasing ownership.
+    //! @remarks
+    //!  Same as pop_front(), but the ownership of the element held by the
+    //!  queue is transferred to the caller, which should attach it to a
+    //!  smart pointer with adopt() or release it manually. Doesn't touch
+    //!  the reference counter. May be called only from one (consumer)
+    //!  thread.
+    //! @returns
+    //!  raw pointer to the detached element or NULL if the queue is empty
+    //!  or a concurrent push is in progress.
+    T* detach_front() {
+        MpscQueueNode::MpscQueueData* node = pop_node_();
+        if (node == NULL) {
+            return NULL;
+        }
+
+        node->queue = NULL;
+
+        return container_of_(node);
+    }
+
+private:
+    static T* container_of_(MpscQueueNode::MpscQueueData* data) {
+        return static_cast<T*>(data->container_of());
+    }
+
+    void push_node_(MpscQueueNode::MpscQueueData* node) {
+        node->next = NULL;
+
+        MpscQueueNode::MpscQueueData* prev;
+        for (;;) {
+            prev = tail_;
+            if (__sync_bool_compare_and_swap(&tail_, prev, node)) {
+                break;
+            }
+        }
+
+        // Between the CAS above and the link below the queue is in an
+        // inconsistent state: the consumer can't reach the new tail yet.
+        // pop_node_() detects this and reports the queue as empty.
+        prev->next = node;
+    }
+
+    MpscQueueNode::MpscQueueData* pop_node_() {
+        MpscQueueNode::MpscQueueData* head = head_;
+        MpscQueueNode::MpscQueueData* next = head->next;
+
+        if (head == &stub_) {
+            if (next == NULL) {
+                // queue is empty or a producer is mid-push
+                return NULL;
+            }
+            head_ = next;
+            head = next;
+            next = head->next;
+        }
+
+        if (next != NULL) {
+            head_ = next;
+            return head;
+        }
+
+        if (head != tail_) {
+            // a producer is mid-push after head
+            return NULL;
+        }
+
+        // head is the last element; re-insert the stub so that head
+        // stops being the tail and can be returned
+        push_node_(&stub_);
+
+        next = head->next;
+        if (next != NULL) {
+            head_ = next;
+            return head;
+        }
+
+        // a producer got between our push of the stub and the link
+        return NULL;
+    }
+
+    // The stub and the head pointer are owned by the consumer; the tail
+    // is CASed by producers on every push and gets its own cache line,
+    // so that producers don't invalidate the consumer's line (and vice
+    // versa) on every operation.
+    MpscQueueNode::MpscQueueData stub_;
+    MpscQueueNode::MpscQueueData* head_;
+
+    ROC_ALIGN_CACHELINE MpscQueueNode::MpscQueueData* volatile tail_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_MPSC_QUEUE_H_
@@ -12,14 +12,30 @@
 #ifndef ROC_CORE_POOL_H_
 #define ROC_CORE_POOL_H_
 
+#include <stdio.h>
+
 #include "roc_core/alignment.h"
+#include "roc_core/atomic.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/log.h"
-#include "roc_core/mutex.h"
+#include "roc_core/mem_quota.h"
+#include "roc_core/metrics_registry.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/panic.h"
+#include "roc_core/spin_mutex.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/tls_key.h"
+
+//! On 64-bit platforms the pool free list is a lock-free stack, so that
+//! allocate() and deallocate() on different threads don't serialize each
+//! other. On other platforms the free list falls back to the mutex that
+//! is anyway needed for chunk allocation.
+#if defined(UINTPTR_MAX) && (UINTPTR_MAX > 0xffffffffUL)
+#define ROC_POOL_LOCKFREE 1
+#else
+#define ROC_POOL_LOCKFREE 0
+#endif
 
 namespace roc {
 namespace core {
@@ -31,7 +47,23 @@ namespace core {
 //! Allocates chunks from given allocator containing a fixed number of fixed
 //! sized objects. Maintains a list of free objects.
 //!
-//! The memory is always maximum aligned. Thread-safe.
+//! The free list is a lock-free stack on 64-bit platforms; the current
+//! hardware doesn't use the upper 16 bits of virtual addresses, which are
+//! reused as an ABA counter so that a single-word CAS is enough. Chunk
+//! allocation, which is rare, is still protected with a mutex.
+//!
+//! In addition, every thread keeps a small private magazine of free
+//! elements, refilled from and flushed to the shared free list in batches.
+//! When one thread allocates objects and another thread frees them, e.g.
+//! packets travelling from the network thread to the pipeline thread, most
+//! allocations and deallocations are served from the magazine and don't
+//! ping-pong the shared list between the CPUs. The magazines need a TLS
+//! key, which is a limited per-process resource (PTHREAD_KEYS_MAX); if no
+//! key can be created, the pool operates directly on the shared free list
+//! instead of failing.
+//!
+//! The memory is always at least maximum aligned; a larger power-of-two
+//! alignment may be requested in the constructor. Thread-safe.
 template <class T> class Pool : public NonCopyable<> {
 public:
     //! Initialization.
@@ -40,32 +72,96 @@ public:
     //!  - @p allocator is used to allocate chunks
     //!  - @p object_size defines object size in bytes
     //!  - @p poison enables memory poisoning for debugging
-    Pool(IAllocator& allocator, size_t object_size, bool poison)
+    //!  - @p alignment defines object alignment in bytes; should be a power
+    //!    of two; memory is always at least maximum aligned
+    Pool(IAllocator& allocator,
+         size_t object_size,
+         bool poison,
+         size_t alignment = sizeof(MaxAlign))
         : allocator_(allocator)
+        , magazine_key_(&release_magazine_cb_)
+        , free_head_(0)
         , used_elems_(0)
-        , elem_size_(max_align(std::max(sizeof(Elem), object_size)))
+        , alignment_(std::max(alignment, sizeof(MaxAlign)))
+        , elem_size_(aligned_size_(max_align(std::max(sizeof(Elem), object_size)),
+                                   alignment_))
         , chunk_hdr_size_(max_align(sizeof(Chunk)))
         , chunk_n_elems_(1)
-        , poison_(poison) {
-        roc_log(LogDebug, "pool: initializing: object_size=%lu poison=%d",
-                (unsigned long)elem_size_, (int)poison);
+        , n_total_elems_(0)
+        , poison_(poison)
+        , metrics_used_(NULL)
+        , quota_(NULL)
+        , quota_bytes_(0)
+        , quota_logged_(false) {
+        if ((alignment_ & (alignment_ - 1)) != 0) {
+            roc_panic("pool: alignment is not power of two: alignment=%lu",
+                      (unsigned long)alignment_);
+        }
+        roc_log(LogDebug, "pool: initializing: object_size=%lu alignment=%lu poison=%d",
+                (unsigned long)elem_size_, (unsigned long)alignment_, (int)poison);
+
+        if (!magazine_key_.valid()) {
+            roc_log(LogInfo,
+                    "pool: can't create tls key, thread magazines disabled:"
+                    " object_size=%lu",
+                    (unsigned long)elem_size_);
+        }
+
+        char metrics_name[MetricsPage::MaxNameLen];
+        snprintf(metrics_name, sizeof(metrics_name), "pool_%lu_used",
+                 (unsigned long)elem_size_);
+        metrics_used_ = MetricsRegistry::instance().find_or_add_counter(metrics_name);
     }
 
     ~Pool() {
         deallocate_all_();
     }
 
+    //! Attach a memory quota.
+    //!
+    //! Chunk growth beyond the quota fails and allocate() returns NULL, so
+    //! that the caller sheds load instead of growing without bound. Several
+    //! pools may share one quota. Should be called before the pool is used.
+    void set_quota(MemQuota& quota) {
+        quota_ = &quota;
+    }
+
+    //! Pre-allocate chunks for at least @p n_objects objects.
+    //!
+    //! May be called at startup, so that the backing allocator is not hit
+    //! on a latency-sensitive path later, and, when the backing allocator
+    //! provides pre-faulted memory (see HugepageAllocator), steady-state
+    //! allocations never page fault.
+    //!
+    //! @returns
+    //!  false if memory can't be allocated.
+    bool reserve(size_t n_objects) {
+        SpinMutex::Lock lock(mutex_);
+
+        while (n_total_elems_ < n_objects) {
+            if (!allocate_chunk_locked_()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     //! Allocate new object.
     //! @returns
     //!  pointer to a maximum aligned uninitialized memory for a new object
     //!  or NULL if memory can't be allocated.
     void* allocate() {
-        Elem* elem = get_elem_();
+        Elem* elem = get_elem_cached_();
         if (elem == NULL) {
             return NULL;
         }
 
-        elem->~Elem();
+        ++used_elems_.value;
+
+        if (metrics_used_) {
+            metrics_used_->incr_relaxed();
+        }
 
         void* memory = elem;
 
@@ -84,12 +180,64 @@ public:
             roc_panic("pool: deallocating null pointer");
         }
 
+        if (used_elems_.value == 0) {
+            roc_panic("pool: unpaired deallocation");
+        }
+        --used_elems_.value;
+
+        if (metrics_used_) {
+            metrics_used_->decr_relaxed();
+        }
+
         if (poison_) {
             memset(memory, PoisonDeallocated, elem_size_);
         }
 
-        Elem* elem = new (memory) Elem;
-        put_elem_(elem);
+        put_elem_cached_((Elem*)memory);
+    }
+
+    //! Free a batch of previously allocated objects in one operation.
+    //!
+    //! Equivalent to calling deallocate() for every element of @p memory,
+    //! but the elements are linked into a private chain that is spliced
+    //! into the shared free list with a single operation, regardless of
+    //! the batch size. The thread magazine is bypassed: batches come from
+    //! teardown paths and would only flush it.
+    void deallocate_batch(void* const* memory, size_t n_objects) {
+        if (n_objects == 0) {
+            return;
+        }
+
+        if ((size_t)used_elems_.value.load_relaxed() < n_objects) {
+            roc_panic("pool: unpaired deallocation");
+        }
+        used_elems_.value.add_relaxed(-(long)n_objects);
+
+        if (metrics_used_) {
+            metrics_used_->add_relaxed(-(long)n_objects);
+        }
+
+        Elem* head = NULL;
+        Elem* tail = NULL;
+
+        for (size_t n = 0; n < n_objects; n++) {
+            if (memory[n] == NULL) {
+                roc_panic("pool: deallocating null pointer");
+            }
+
+            if (poison_) {
+                memset(memory[n], PoisonDeallocated, elem_size_);
+            }
+
+            Elem* elem = (Elem*)memory[n];
+            if (tail == NULL) {
+                tail = elem;
+            }
+            elem->next = head;
+            head = elem;
+        }
+
+        put_elem_chain_(head, tail);
     }
 
     //! Destroy object and deallocate its memory.
@@ -102,85 +250,397 @@ private:
     enum { PoisonAllocated = 0x7a, PoisonDeallocated = 0x7d };
 
     struct Chunk : ListNode {};
-    struct Elem : ListNode {};
+
+    struct Elem {
+        Elem* next;
+    };
+
+    enum { MagazineSize = 16 };
+
+    struct Magazine : ListNode {
+        Pool* pool;
+        size_t n_elems;
+        Elem* elems[MagazineSize];
+    };
+
+    // Serve allocation from the thread's magazine, falling back to the
+    // shared free list if the magazine can't be created.
+    Elem* get_elem_cached_() {
+        Magazine* mag = magazine_();
+        if (mag == NULL) {
+            return get_elem_();
+        }
+
+        if (mag->n_elems == 0) {
+            // Batched refill from elements that are already free, so that
+            // subsequent allocations on this thread don't touch the shared
+            // list; chunk growth is left to the slow path below.
+            while (mag->n_elems < MagazineSize / 2) {
+                Elem* elem = try_get_elem_();
+                if (elem == NULL) {
+                    break;
+                }
+                mag->elems[mag->n_elems++] = elem;
+            }
+            if (mag->n_elems == 0) {
+                return get_elem_();
+            }
+        }
+
+        return mag->elems[--mag->n_elems];
+    }
+
+    void put_elem_cached_(Elem* elem) {
+        Magazine* mag = magazine_();
+        if (mag == NULL) {
+            put_elem_(elem);
+            return;
+        }
+
+        if (mag->n_elems == MagazineSize) {
+            // Batched flush: splice half of the magazine into the shared
+            // list with a single operation, and keep the other half so that
+            // neither an allocation nor a deallocation coming next hits the
+            // shared list.
+            Elem* head = NULL;
+            Elem* tail = NULL;
+            while (mag->n_elems > MagazineSize / 2) {
+                Elem* e = mag->elems[--mag->n_elems];
+                if (tail == NULL) {
+                    tail = e;
+                }
+                e->next = head;
+                head = e;
+            }
+            put_elem_chain_(head, tail);
+        }
+
+        mag->elems[mag->n_elems++] = elem;
+    }
+
+    Magazine* magazine_() {
+        if (!magazine_key_.valid()) {
+            // no TLS key for this pool: the callers fall back to the
+            // shared free list
+            return NULL;
+        }
+        Magazine* mag = (Magazine*)magazine_key_.get();
+        if (mag == NULL) {
+            mag = create_magazine_();
+        }
+        return mag;
+    }
+
+    Magazine* create_magazine_() {
+        void* memory = allocator_.allocate(sizeof(Magazine));
+        if (memory == NULL) {
+            return NULL;
+        }
+
+        Magazine* mag = new (memory) Magazine;
+        mag->pool = this;
+        mag->n_elems = 0;
+
+        {
+            SpinMutex::Lock lock(mutex_);
+            magazines_.push_back(*mag);
+        }
+
+        magazine_key_.set(mag);
+        return mag;
+    }
+
+    static void release_magazine_cb_(void* arg) {
+        Magazine* mag = (Magazine*)arg;
+        mag->pool->release_magazine_(mag);
+    }
+
+    // Called when a thread that used the pool exits: return the cached
+    // elements to the shared free list and destroy the magazine.
+    void release_magazine_(Magazine* mag) {
+        while (mag->n_elems != 0) {
+            put_elem_(mag->elems[--mag->n_elems]);
+        }
+
+        {
+            SpinMutex::Lock lock(mutex_);
+            magazines_.remove(*mag);
+        }
+
+        allocator_.deallocate(mag);
+    }
+
+#if ROC_POOL_LOCKFREE
+    enum { TagShift = 48 };
+
+    static uintptr_t pack_(Elem* elem, uintptr_t tag) {
+        return (uintptr_t)elem | (tag << TagShift);
+    }
+
+    static Elem* unpack_elem_(uintptr_t head) {
+        return (Elem*)(head & (((uintptr_t)1 << TagShift) - 1));
+    }
+
+    static uintptr_t unpack_tag_(uintptr_t head) {
+        return (head >> TagShift);
+    }
+
+    Elem* try_get_elem_() {
+        for (;;) {
+            const uintptr_t head = __sync_add_and_fetch(&free_head_, 0);
+
+            Elem* elem = unpack_elem_(head);
+            if (elem == NULL) {
+                return NULL;
+            }
+
+            // It's safe to read elem->next even if another thread has already
+            // popped elem: chunks are never returned to the allocator until
+            // the pool is destroyed. If it happened, the tag has changed and
+            // CAS fails.
+            const uintptr_t next = pack_(elem->next, unpack_tag_(head) + 1);
+
+            if (__sync_bool_compare_and_swap(&free_head_, head, next)) {
+                return elem;
+            }
+        }
+    }
+
+    Elem* get_elem_() {
+        for (;;) {
+            Elem* elem = try_get_elem_();
+            if (elem != NULL) {
+                return elem;
+            }
+
+            if (!allocate_chunk_()) {
+                return NULL;
+            }
+        }
+    }
+
+    void put_elem_(Elem* elem) {
+        for (;;) {
+            const uintptr_t head = __sync_add_and_fetch(&free_head_, 0);
+
+            elem->next = unpack_elem_(head);
+
+            if (__sync_bool_compare_and_swap(&free_head_, head,
+                                             pack_(elem, unpack_tag_(head) + 1))) {
+                return;
+            }
+        }
+    }
+
+    // Splice a pre-linked chain of free elements into the free list; one
+    // CAS regardless of the chain length.
+    void put_elem_chain_(Elem* chain_head, Elem* chain_tail) {
+        for (;;) {
+            const uintptr_t head = __sync_add_and_fetch(&free_head_, 0);
+
+            chain_tail->next = unpack_elem_(head);
+
+            if (__sync_bool_compare_and_swap(
+                    &free_head_, head, pack_(chain_head, unpack_tag_(head) + 1))) {
+                return;
+            }
+        }
+    }
+#else  // !ROC_POOL_LOCKFREE
+    Elem* try_get_elem_() {
+        SpinMutex::Lock lock(mutex_);
+
+        Elem* elem = (Elem*)free_head_;
+        if (elem != NULL) {
+            free_head_ = (uintptr_t)elem->next;
+        }
+
+        return elem;
+    }
 
     Elem* get_elem_() {
-        Mutex::Lock lock(mutex_);
+        SpinMutex::Lock lock(mutex_);
 
-        if (free_elems_.size() == 0) {
-            allocate_chunk_();
+        if (free_head_ == 0) {
+            if (!allocate_chunk_locked_()) {
+                return NULL;
+            }
         }
 
-        Elem* elem = free_elems_.front();
+        Elem* elem = (Elem*)free_head_;
         if (elem != NULL) {
-            free_elems_.remove(*elem);
-            used_elems_++;
+            free_head_ = (uintptr_t)elem->next;
         }
 
         return elem;
     }
 
     void put_elem_(Elem* elem) {
-        Mutex::Lock lock(mutex_);
+        SpinMutex::Lock lock(mutex_);
 
-        if (used_elems_ == 0) {
-            roc_panic("pool: unpaired deallocation");
+        elem->next = (Elem*)free_head_;
+        free_head_ = (uintptr_t)elem;
+    }
+
+    // Splice a pre-linked chain of free elements into the free list; one
+    // lock acquisition regardless of the chain length.
+    void put_elem_chain_(Elem* chain_head, Elem* chain_tail) {
+        SpinMutex::Lock lock(mutex_);
+
+        chain_tail->next = (Elem*)free_head_;
+        free_head_ = (uintptr_t)chain_head;
+    }
+#endif // !ROC_POOL_LOCKFREE
+
+#if ROC_POOL_LOCKFREE
+    bool allocate_chunk_() {
+        SpinMutex::Lock lock(mutex_);
+
+        // Another thread may have allocated a chunk while we were
+        // acquiring the mutex.
+        if (unpack_elem_(__sync_add_and_fetch(&free_head_, 0)) != NULL) {
+            return true;
         }
 
-        used_elems_--;
-        free_elems_.push_front(*elem);
+        return allocate_chunk_locked_();
     }
+#endif // ROC_POOL_LOCKFREE
+
+    bool allocate_chunk_locked_() {
+        size_t n_elems = chunk_n_elems_;
+        size_t chunk_size = chunk_offset_(n_elems) + alignment_;
+
+        if (quota_) {
+            // retry with smaller chunks near the cap, so that the quota is
+            // filled up to the last element before allocations start failing
+            while (!quota_->acquire(chunk_size)) {
+                if (n_elems == 1) {
+                    if (!quota_logged_) {
+                        quota_logged_ = true;
+                        roc_log(LogError,
+                                "pool: memory quota exhausted: object_size=%lu"
+                                " quota=%lu",
+                                (unsigned long)elem_size_,
+                                (unsigned long)quota_->max_bytes());
+                    }
+                    return false;
+                }
+                n_elems /= 2;
+                chunk_size = chunk_offset_(n_elems) + alignment_;
+            }
+        }
 
-    void allocate_chunk_() {
-        void* memory = allocator_.allocate(chunk_offset_(chunk_n_elems_));
+        // The allocator guarantees only maximum alignment, so the chunk is
+        // over-allocated and the first element is shifted to the requested
+        // alignment; elem_size_ is a multiple of it, so all elements of the
+        // chunk are aligned too.
+        void* memory = allocator_.allocate(chunk_size);
         if (memory == NULL) {
-            return;
+            if (quota_) {
+                quota_->release(chunk_size);
+            }
+            return false;
         }
 
         Chunk* chunk = new (memory) Chunk;
         chunks_.push_back(*chunk);
 
-        for (size_t n = 0; n < chunk_n_elems_; n++) {
-            Elem* elem = new ((char*)chunk + chunk_offset_(n)) Elem;
-            free_elems_.push_back(*elem);
+        char* elems = (char*)chunk + chunk_hdr_size_;
+        elems += padding((size_t)(uintptr_t)elems, alignment_);
+
+        for (size_t n = 0; n < n_elems; n++) {
+            push_free_((Elem*)(elems + n * elem_size_));
         }
 
-        chunk_n_elems_ *= 2;
+        if (quota_) {
+            quota_bytes_ += chunk_size;
+        }
+
+        n_total_elems_ += n_elems;
+        chunk_n_elems_ = n_elems * 2;
+        return true;
+    }
+
+    void push_free_(Elem* elem) {
+#if ROC_POOL_LOCKFREE
+        for (;;) {
+            const uintptr_t head = __sync_add_and_fetch(&free_head_, 0);
+
+            elem->next = unpack_elem_(head);
+
+            if (__sync_bool_compare_and_swap(&free_head_, head,
+                                             pack_(elem, unpack_tag_(head) + 1))) {
+                return;
+            }
+        }
+#else
+        elem->next = (Elem*)free_head_;
+        free_head_ = (uintptr_t)elem;
+#endif
     }
 
     void deallocate_all_() {
-        if (used_elems_ != 0) {
-            roc_panic("pool: detected leak: used=%lu free=%lu",
-                      (unsigned long)used_elems_, (unsigned long)free_elems_.size());
+        if (used_elems_.value != 0) {
+            roc_panic("pool: detected leak: used=%lu",
+                      (unsigned long)(long)used_elems_.value);
         }
 
-        while (Elem* elem = free_elems_.front()) {
-            free_elems_.remove(*elem);
+        // Magazines hold only free elements at this point; their memory
+        // is released below together with the chunks.
+        while (Magazine* mag = magazines_.front()) {
+            magazines_.remove(*mag);
+            allocator_.deallocate(mag);
         }
 
         while (Chunk* chunk = chunks_.front()) {
             chunks_.remove(*chunk);
             allocator_.deallocate(chunk);
         }
+
+        if (quota_ && quota_bytes_ != 0) {
+            quota_->release(quota_bytes_);
+            quota_bytes_ = 0;
+        }
     }
 
     size_t chunk_offset_(size_t n) const {
         return chunk_hdr_size_ + n * elem_size_;
     }
 
-    Mutex mutex_;
+    static size_t aligned_size_(size_t size, size_t alignment) {
+        return size + padding(size, alignment);
+    }
+
+    SpinMutex mutex_;
 
     IAllocator& allocator_;
 
+    TlsKey magazine_key_;
+    List<Magazine, NoOwnership> magazines_;
+
     List<Chunk, NoOwnership> chunks_;
-    List<Elem, NoOwnership> free_elems_;
-    size_t used_elems_;
+    mutable uintptr_t free_head_;
+
+    // bumped on every allocation and free from any thread; padded so
+    // that it doesn't share a cache line with the free list state
+    CacheAligned<Atomic> used_elems_;
 
+    const size_t alignment_;
     const size_t elem_size_;
     const size_t chunk_hdr_size_;
     size_t chunk_n_elems_;
+    size_t n_total_elems_;
 
     const bool poison_;
+
+    // Exported occupancy counter, shared by pools with equal element size.
+    Atomic* metrics_used_;
+
+    // Optional byte cap, may be shared by several pools; quota_bytes_ is
+    // the amount acquired from it so far, returned when the pool dies.
+    MemQuota* quota_;
+    size_t quota_bytes_;
+    bool quota_logged_;
 };
 
 } // namespace core
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+
+#include "roc_core/profiled_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/metrics_registry.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+// upper bounds of the size histogram buckets; the last bucket is open
+const size_t BucketBounds[ProfiledAllocator::NumSizeBuckets - 1] = {
+    64, 256, 1024, 4096, 16384, 65536, 262144
+};
+
+} // namespace
+
+ProfiledAllocator::ProfiledAllocator(IAllocator& backend, const char* tag)
+    : backend_(backend)
+    , tag_(tag)
+    , enabled_(false)
+    , live_bytes_(&fallback_[0])
+    , peak_bytes_(&fallback_[1])
+    , num_allocs_(&fallback_[2]) {
+    for (size_t n = 0; n < NumSizeBuckets; n++) {
+        size_buckets_[n] = &fallback_[3 + n];
+    }
+
+    const char* env = getenv("ROC_MEMORY_PROFILING");
+    if (!env || !*env) {
+        return;
+    }
+    enabled_ = true;
+
+    char name[64] = {};
+
+    snprintf(name, sizeof(name), "mem.%s.live_bytes", tag_);
+    live_bytes_ = counter_(name, fallback_[0]);
+
+    snprintf(name, sizeof(name), "mem.%s.peak_bytes", tag_);
+    peak_bytes_ = counter_(name, fallback_[1]);
+
+    snprintf(name, sizeof(name), "mem.%s.num_allocs", tag_);
+    num_allocs_ = counter_(name, fallback_[2]);
+
+    for (size_t n = 0; n < NumSizeBuckets; n++) {
+        if (n < NumSizeBuckets - 1) {
+            snprintf(name, sizeof(name), "mem.%s.size_le_%lu", tag_,
+                     (unsigned long)BucketBounds[n]);
+        } else {
+            snprintf(name, sizeof(name), "mem.%s.size_gt_%lu", tag_,
+                     (unsigned long)BucketBounds[NumSizeBuckets - 2]);
+        }
+        size_buckets_[n] = counter_(name, fallback_[3 + n]);
+    }
+}
+
+ProfiledAllocator::~ProfiledAllocator() {
+    if (!enabled_) {
+        return;
+    }
+
+    roc_log(LogInfo,
+            "profiled allocator: tag=%s live=%lu peak=%lu allocs=%lu",
+            tag_, (unsigned long)live_bytes(), (unsigned long)peak_bytes(),
+            (unsigned long)num_allocations());
+}
+
+void* ProfiledAllocator::allocate(size_t size) {
+    if (!enabled_) {
+        return backend_.allocate(size);
+    }
+
+    Header* header = (Header*)backend_.allocate(sizeof(Header) + size);
+    if (!header) {
+        return NULL;
+    }
+    header->size = size;
+
+    const long live = live_bytes_->add_relaxed((long)size);
+
+    long peak = peak_bytes_->load_relaxed();
+    while (live > peak && !peak_bytes_->cas(peak, live)) {
+        peak = peak_bytes_->load_relaxed();
+    }
+
+    num_allocs_->incr_relaxed();
+    size_buckets_[bucket_(size)]->incr_relaxed();
+
+    return header + 1;
+}
+
+void ProfiledAllocator::deallocate(void* ptr) {
+    if (!enabled_) {
+        backend_.deallocate(ptr);
+        return;
+    }
+
+    Header* header = (Header*)ptr - 1;
+
+    live_bytes_->add_relaxed(-(long)header->size);
+
+    backend_.deallocate(header);
+}
+
+bool ProfiledAllocator::profiling() const {
+    return enabled_;
+}
+
+size_t ProfiledAllocator::live_bytes() const {
+    return (size_t)live_bytes_->load_relaxed();
+}
+
+size_t ProfiledAllocator::peak_bytes() const {
+    return (size_t)peak_bytes_->load_relaxed();
+}
+
+size_t ProfiledAllocator::num_allocations() const {
+    return (size_t)num_allocs_->load_relaxed();
+}
+
+size_t ProfiledAllocator::bucket_(size_t size) {
+    for (size_t n = 0; n < NumSizeBuckets - 1; n++) {
+        if (size <= BucketBounds[n]) {
+            return n;
+        }
+    }
+    return NumSizeBuckets - 1;
+}
+
+Atomic* ProfiledAllocator::counter_(const char* name, Atomic& fallback) {
+    if (Atomic* counter = MetricsRegistry::instance().find_or_add_counter(name)) {
+        return counter;
+    }
+    return &fallback;
+}
+
+} // namespace core
+} // namespace roc
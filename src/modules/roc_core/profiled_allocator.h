@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/profiled_allocator.h
+//! @brief Profiled allocator.
+
+#ifndef ROC_CORE_PROFILED_ALLOCATOR_H_
+#define ROC_CORE_PROFILED_ALLOCATOR_H_
+
+#include "roc_core/alignment.h"
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Profiled allocator.
+//!
+//! Wraps another allocator and attributes its traffic to a tag, so that
+//! every subsystem can get its own instrumented view of a shared
+//! allocator and memory regressions become attributable to a subsystem.
+//!
+//! When profiling is enabled (the ROC_MEMORY_PROFILING environment
+//! variable is set and non-empty), each allocation carries a small size
+//! header and the wrapper maintains live bytes, peak bytes, allocation
+//! counts, and a power-of-two size histogram with relaxed atomic
+//! counters, published through MetricsRegistry under "mem.<tag>.*".
+//! When profiling is disabled, allocate() and deallocate() forward to
+//! the underlying allocator unchanged.
+class ProfiledAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Number of power-of-two size histogram buckets.
+    enum { NumSizeBuckets = 8 };
+
+    //! Initialize.
+    //! @remarks
+    //!  @p tag should be a string literal or otherwise outlive the
+    //!  allocator; it names the counters for this instance.
+    ProfiledAllocator(IAllocator& backend, const char* tag);
+
+    //! Log a usage summary if profiling is enabled.
+    ~ProfiledAllocator();
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+    //! Check if profiling is enabled.
+    bool profiling() const;
+
+    //! Get number of currently allocated bytes.
+    size_t live_bytes() const;
+
+    //! Get maximum number of simultaneously allocated bytes.
+    size_t peak_bytes() const;
+
+    //! Get total number of allocations.
+    size_t num_allocations() const;
+
+private:
+    // prepended to every allocation; a union with MaxAlign so that the
+    // user data that follows remains maximum aligned
+    union Header {
+        size_t size;
+        MaxAlign align;
+    };
+
+    static size_t bucket_(size_t size);
+
+    Atomic* counter_(const char* name, Atomic& fallback);
+
+    IAllocator& backend_;
+    const char* tag_;
+    bool enabled_;
+
+    // registry slots when available, local fallbacks otherwise
+    Atomic fallback_[3 + NumSizeBuckets];
+    Atomic* live_bytes_;
+    Atomic* peak_bytes_;
+    Atomic* num_allocs_;
+    Atomic* size_buckets_[NumSizeBuckets];
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_PROFILED_ALLOCATOR_H_
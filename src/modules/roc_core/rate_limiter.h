@@ -35,7 +35,22 @@ public:
 
     //! Check whether an event is allowed to occur now.
     bool allow() {
-        const Ticker::Ticks elapsed = ticker_.elapsed();
+        return check_(ticker_.elapsed());
+    }
+
+    //! Same, using a clock value sampled by the caller.
+    //! @remarks
+    //!  @p now is in the core::timestamp() clock domain. Zero means the
+    //!  caller didn't sample the clock, and it is read here instead.
+    bool allow(nanoseconds_t now) {
+        if (now == 0) {
+            return allow();
+        }
+        return check_(ticker_.elapsed(now));
+    }
+
+private:
+    bool check_(Ticker::Ticks elapsed) {
         if (elapsed >= pos_) {
             pos_ = (elapsed / period_ + 1) * period_;
             return true;
@@ -44,7 +59,6 @@ public:
         }
     }
 
-private:
     const Ticker::Ticks period_;
     Ticker::Ticks pos_;
     Ticker ticker_;
@@ -29,37 +29,56 @@ public:
     }
 
     ~RefCnt() {
-        if (counter_ != 0) {
+        if (counter_.load_relaxed() != 0) {
             roc_panic("refcnt: reference counter is non-zero in destructor, counter=%d",
-                      (int)counter_);
+                      (int)counter_.load_relaxed());
         }
     }
 
     //! Get reference counter.
     long getref() const {
-        return counter_;
+        return counter_.load_relaxed();
     }
 
     //! Increment reference counter.
     void incref() const {
-        if (counter_ < 0) {
+        if (counter_.load_relaxed() < 0) {
             roc_panic("refcnt: attempting to call incref() on freed object");
         }
-        ++counter_;
+        counter_.incr_relaxed();
     }
 
     //! Decrement reference counter.
     //! @remarks
     //!  Calls free() if reference counter becomes zero.
     void decref() const {
-        if (counter_ <= 0) {
+        if (counter_.load_relaxed() <= 0) {
             roc_panic("refcnt: attempting to call decref() on destroyed object");
         }
-        if (--counter_ == 0) {
+        // acquire-release ensures that the thread dropping the counter to
+        // zero observes all writes made to the object by other threads
+        if (counter_.decr_acq_rel() == 0) {
             static_cast<T*>(const_cast<RefCnt*>(this))->destroy();
         }
     }
 
+    //! Drop the last reference without calling destroy().
+    //! @pre
+    //!  Reference counter should be exactly one, i.e. the caller should be
+    //!  the only owner.
+    //! @remarks
+    //!  Used for batched destruction: the owner detaches objects from
+    //!  their containers, drops the counters, and destroys the whole batch
+    //!  manually, e.g. returning the memory to a pool in one operation.
+    void dropref() const {
+        if (counter_.load_relaxed() != 1) {
+            roc_panic("refcnt: attempting to call dropref() on shared object,"
+                      " counter=%d",
+                      (int)counter_.load_relaxed());
+        }
+        counter_.decr_acq_rel();
+    }
+
 private:
     mutable Atomic counter_;
 };
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/scoped_arena.h
+//! @brief RAII arena reset.
+
+#ifndef ROC_CORE_SCOPED_ARENA_H_
+#define ROC_CORE_SCOPED_ARENA_H_
+
+#include "roc_core/arena_allocator.h"
+#include "roc_core/noncopyable.h"
+
+namespace roc {
+namespace core {
+
+//! RAII arena reset.
+//! @remarks
+//!  Resets an arena allocator when the scope is left, reclaiming all
+//!  memory allocated from it inside the scope.
+class ScopedArena : NonCopyable<> {
+public:
+    //! Attach to arena.
+    explicit ScopedArena(ArenaAllocator& arena)
+        : arena_(arena) {
+    }
+
+    //! Reset arena.
+    ~ScopedArena() {
+        arena_.reset();
+    }
+
+    //! Get arena allocator.
+    ArenaAllocator& allocator() const {
+        return arena_;
+    }
+
+private:
+    ArenaAllocator& arena_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_SCOPED_ARENA_H_
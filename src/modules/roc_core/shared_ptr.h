@@ -80,6 +80,29 @@ public:
         }
     }
 
+    //! Detach underlying pointer without releasing ownership.
+    //! @remarks
+    //!  The shared pointer becomes null and the reference it was holding is
+    //!  transferred to the caller, which should eventually pass it to adopt()
+    //!  or release it manually. Doesn't touch the reference counter.
+    //! @returns
+    //!  the underlying pointer or NULL.
+    T* transfer() {
+        T* ptr = ptr_;
+        ptr_ = NULL;
+        return ptr;
+    }
+
+    //! Reset shared pointer and attach an already acquired reference to it.
+    //! @remarks
+    //!  In contrast to reset(), doesn't increment the reference counter of
+    //!  @p ptr; the shared pointer takes over a reference previously obtained
+    //!  from transfer() or acquired manually. @p ptr may be NULL.
+    void adopt(T* ptr) {
+        release_();
+        ptr_ = ptr;
+    }
+
     //! Get underlying pointer.
     T* get() const {
         return ptr_;
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/slab_allocator.h"
+#include "roc_core/alignment.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+SlabAllocator::SlabAllocator(IAllocator& backing_allocator, size_t chunk_size)
+    : backing_allocator_(backing_allocator)
+    , chunk_size_(chunk_size)
+    , quota_(NULL)
+    , quota_bytes_(0)
+    , quota_logged_(false) {
+    if (chunk_size == 0) {
+        roc_panic("slab allocator: chunk size is zero");
+    }
+
+    for (size_t n = 0; n < NumClasses; n++) {
+        free_lists_[n] = NULL;
+    }
+}
+
+SlabAllocator::~SlabAllocator() {
+    while (Chunk* chunk = chunks_.front()) {
+        chunks_.remove(*chunk);
+        chunk->~Chunk();
+        backing_allocator_.deallocate(chunk);
+    }
+
+    if (quota_ && quota_bytes_ != 0) {
+        quota_->release(quota_bytes_);
+    }
+}
+
+void SlabAllocator::set_quota(MemQuota& quota) {
+    quota_ = &quota;
+}
+
+void* SlabAllocator::allocate(size_t size) {
+    const size_t block_size = max_align(sizeof(Header)) + size;
+
+    if (block_size > class_size_(NumClasses - 1)) {
+        if (quota_ && !quota_->acquire(block_size)) {
+            roc_log(LogError,
+                    "slab allocator: memory quota exhausted: block_size=%lu quota=%lu",
+                    (unsigned long)block_size, (unsigned long)quota_->max_bytes());
+            return NULL;
+        }
+
+        void* memory = backing_allocator_.allocate(block_size);
+        if (!memory) {
+            if (quota_) {
+                quota_->release(block_size);
+            }
+            return NULL;
+        }
+
+        Header* header = (Header*)memory;
+        header->class_index = OversizeClass;
+        header->block_size = block_size;
+
+        return (char*)memory + max_align(sizeof(Header));
+    }
+
+    const size_t index = class_index_(block_size);
+
+    Elem* elem;
+    {
+        SpinMutex::Lock lock(mutex_);
+
+        if (!free_lists_[index]) {
+            if (!refill_class_(index)) {
+                return NULL;
+            }
+        }
+
+        elem = free_lists_[index];
+        free_lists_[index] = elem->next;
+    }
+
+    Header* header = (Header*)elem;
+    header->class_index = index;
+
+    return (char*)elem + max_align(sizeof(Header));
+}
+
+void SlabAllocator::deallocate(void* ptr) {
+    if (!ptr) {
+        roc_panic("slab allocator: deallocating null pointer");
+    }
+
+    Header* header = (Header*)((char*)ptr - max_align(sizeof(Header)));
+
+    const size_t index = header->class_index;
+
+    if (index == OversizeClass) {
+        const size_t block_size = header->block_size;
+        backing_allocator_.deallocate(header);
+        if (quota_) {
+            quota_->release(block_size);
+        }
+        return;
+    }
+
+    if (index >= NumClasses) {
+        roc_panic("slab allocator: deallocating corrupted or foreign pointer");
+    }
+
+    Elem* elem = (Elem*)header;
+
+    SpinMutex::Lock lock(mutex_);
+
+    elem->next = free_lists_[index];
+    free_lists_[index] = elem;
+}
+
+size_t SlabAllocator::num_chunks() const {
+    SpinMutex::Lock lock(mutex_);
+
+    return chunks_.size();
+}
+
+size_t SlabAllocator::class_index_(size_t block_size) {
+    size_t index = 0;
+
+    while (class_size_(index) < block_size) {
+        index++;
+    }
+
+    return index;
+}
+
+size_t SlabAllocator::class_size_(size_t index) {
+    return (size_t)1 << (MinClassShift + index);
+}
+
+bool SlabAllocator::refill_class_(size_t index) {
+    const size_t block_size = class_size_(index);
+
+    const size_t data_size = block_size > chunk_size_ ? block_size : chunk_size_;
+    const size_t n_blocks = data_size / block_size;
+
+    const size_t alloc_size = max_align(sizeof(Chunk)) + data_size;
+
+    if (quota_ && !quota_->acquire(alloc_size)) {
+        if (!quota_logged_) {
+            quota_logged_ = true;
+            roc_log(LogError,
+                    "slab allocator: memory quota exhausted: class_size=%lu quota=%lu",
+                    (unsigned long)block_size, (unsigned long)quota_->max_bytes());
+        }
+        return false;
+    }
+
+    void* memory = backing_allocator_.allocate(alloc_size);
+    if (!memory) {
+        roc_log(LogError, "slab allocator: can't allocate chunk: chunk_size=%lu",
+                (unsigned long)data_size);
+        if (quota_) {
+            quota_->release(alloc_size);
+        }
+        return false;
+    }
+
+    Chunk* chunk = new (memory) Chunk;
+    chunks_.push_back(*chunk);
+
+    if (quota_) {
+        quota_bytes_ += alloc_size;
+    }
+
+    char* blocks = (char*)chunk + max_align(sizeof(Chunk));
+
+    for (size_t n = 0; n < n_blocks; n++) {
+        Elem* elem = (Elem*)(blocks + n * block_size);
+
+        elem->next = free_lists_[index];
+        free_lists_[index] = elem;
+    }
+
+    return true;
+}
+
+} // namespace core
+} // namespace roc
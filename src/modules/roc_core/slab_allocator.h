@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/slab_allocator.h
+//! @brief Slab allocator implementation.
+
+#ifndef ROC_CORE_SLAB_ALLOCATOR_H_
+#define ROC_CORE_SLAB_ALLOCATOR_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mem_quota.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/spin_mutex.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Slab allocator implementation.
+//!
+//! Rounds every allocation up to a power-of-two size class and serves it
+//! from a per-class free list. Free lists are refilled with whole chunks
+//! obtained from the backing allocator, and freed blocks go back to their
+//! class list, so steady-state allocations and deallocations are O(1) and
+//! never touch the backing allocator. Memory is returned to the backing
+//! allocator only on destruction, so long-running mixed-size allocation
+//! patterns don't fragment the heap.
+//!
+//! Allocations larger than the biggest size class are forwarded to the
+//! backing allocator.
+//!
+//! The memory is always maximum aligned. Thread-safe.
+class SlabAllocator : public IAllocator, public NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Free lists are refilled with chunks of at least @p chunk_size bytes
+    //!  obtained from @p backing_allocator.
+    SlabAllocator(IAllocator& backing_allocator, size_t chunk_size = 16384);
+
+    //! Destroy. Release all chunks.
+    ~SlabAllocator();
+
+    //! Attach a memory quota.
+    //! @remarks
+    //!  Chunk refills and oversize allocations beyond the quota fail and
+    //!  allocate() returns NULL. Should be called before the allocator
+    //!  is used.
+    void set_quota(MemQuota& quota);
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+    //! Get number of chunks obtained from the backing allocator.
+    size_t num_chunks() const;
+
+private:
+    enum {
+        MinClassShift = 5,  // smallest size class, 32 bytes
+        MaxClassShift = 16, // largest size class, 64 KB
+
+        NumClasses = MaxClassShift - MinClassShift + 1,
+
+        // pseudo-class for allocations forwarded to the backing allocator
+        OversizeClass = NumClasses
+    };
+
+    struct Chunk : ListNode {};
+
+    struct Elem {
+        Elem* next;
+    };
+
+    // precedes every returned block; remembers the block's size class
+    // and, for oversize blocks, the full block size for quota accounting
+    struct Header {
+        size_t class_index;
+        size_t block_size;
+    };
+
+    static size_t class_index_(size_t block_size);
+    static size_t class_size_(size_t index);
+
+    bool refill_class_(size_t index);
+
+    mutable SpinMutex mutex_;
+
+    IAllocator& backing_allocator_;
+    const size_t chunk_size_;
+
+    Elem* free_lists_[NumClasses];
+    List<Chunk, NoOwnership> chunks_;
+
+    // Optional byte cap; quota_bytes_ is the amount acquired for chunks,
+    // returned on destruction (oversize blocks are released individually).
+    MemQuota* quota_;
+    size_t quota_bytes_;
+    bool quota_logged_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_SLAB_ALLOCATOR_H_
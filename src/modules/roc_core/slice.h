@@ -107,6 +107,14 @@ public:
         return ret;
     }
 
+    //! Get number of references to the attached buffer.
+    //! @returns
+    //!  zero if the slice is not attached to a buffer. May be used to
+    //!  detect that this slice is the buffer's only owner.
+    long buffer_refcount() const {
+        return buffer_ ? buffer_->getref() : 0;
+    }
+
     //! Print slice to stderr.
     void print() const {
         if (buffer_) {
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/spsc_ring.h
+//! @brief Single-producer single-consumer ring.
+
+#ifndef ROC_CORE_SPSC_RING_H_
+#define ROC_CORE_SPSC_RING_H_
+
+#include "roc_core/alignment.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+//! Bounded single-producer single-consumer ring.
+//!
+//! A fixed-capacity FIFO of values for handing buffers or frames from one
+//! thread to exactly one other thread. push() and pop() are wait-free: the
+//! producer owns the write index, the consumer owns the read index, and
+//! the indices live on separate cache lines, so in the steady state the
+//! two sides never contend on a mutex or bounce each other's lines.
+//!
+//! The blocking variants sleep on a condvar when the ring is full (producer)
+//! or empty (consumer). Like in ConcurrentQueue, the mutex is touched only
+//! on such transitions: the opposite side checks a sleeper counter after
+//! each operation and takes the mutex only when someone is actually asleep.
+//!
+//! @tparam T defines the element type; elements are copied into and out of
+//! the ring slots, so T should be cheap to copy (e.g. a pointer or Slice).
+template <class T> class SpscRing : public NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p allocator is used to allocate the ring slots
+    //!  - @p capacity defines the maximum number of elements in the ring
+    SpscRing(IAllocator& allocator, size_t capacity)
+        : slots_(allocator)
+        , cond_(mutex_)
+        , valid_(false) {
+        if (capacity == 0) {
+            roc_panic("spsc ring: capacity is zero");
+        }
+        if (!slots_.resize(capacity)) {
+            return;
+        }
+        valid_ = true;
+    }
+
+    //! Check that initial allocation succeeded.
+    bool valid() const {
+        return valid_;
+    }
+
+    //! Get maximum number of elements in the ring.
+    size_t capacity() const {
+        return slots_.size();
+    }
+
+    //! Get number of elements in the ring.
+    //! @remarks
+    //!  Exact when called from the producer or the consumer thread
+    //!  relative to that side's own operations, approximate otherwise.
+    size_t size() const {
+        return (size_t)(tail_.value.load_acquire() - head_.value.load_acquire());
+    }
+
+    //! Append element to the ring.
+    //! @remarks
+    //!  Wait-free. May be called only from one (producer) thread.
+    //! @returns
+    //!  false if the ring is full and the element was not added.
+    bool push(const T& element) {
+        const long tail = tail_.value.load_relaxed();
+
+        if ((size_t)(tail - head_.value.load_acquire()) == slots_.size()) {
+            return false;
+        }
+
+        slots_[(size_t)tail % slots_.size()] = element;
+        tail_.value.store_release(tail + 1);
+
+        wake_();
+
+        return true;
+    }
+
+    //! Remove first element from the ring.
+    //! @remarks
+    //!  Wait-free. May be called only from one (consumer) thread.
+    //! @returns
+    //!  false if the ring is empty.
+    bool pop(T& element) {
+        const long head = head_.value.load_relaxed();
+
+        if (head == tail_.value.load_acquire()) {
+            return false;
+        }
+
+        element = slots_[(size_t)head % slots_.size()];
+        slots_[(size_t)head % slots_.size()] = T();
+        head_.value.store_release(head + 1);
+
+        wake_();
+
+        return true;
+    }
+
+    //! Append element to the ring, blocking while it's full.
+    //! @remarks
+    //!  May be called only from one (producer) thread.
+    void push_blocking(const T& element) {
+        for (;;) {
+            if (push(element)) {
+                return;
+            }
+
+            Mutex::Lock lock(mutex_);
+
+            // Tell the consumer that it should signal the condvar. The
+            // order is important: the counter is incremented before
+            // re-checking the ring, hence either we see free space here
+            // or the consumer sees the counter and wakes us up.
+            ++n_sleeping_;
+
+            if (push(element)) {
+                --n_sleeping_;
+                return;
+            }
+
+            cond_.wait();
+
+            --n_sleeping_;
+        }
+    }
+
+    //! Remove first element from the ring, blocking while it's empty.
+    //! @remarks
+    //!  May be called only from one (consumer) thread.
+    void pop_blocking(T& element) {
+        for (;;) {
+            if (pop(element)) {
+                return;
+            }
+
+            Mutex::Lock lock(mutex_);
+
+            ++n_sleeping_;
+
+            if (pop(element)) {
+                --n_sleeping_;
+                return;
+            }
+
+            cond_.wait();
+
+            --n_sleeping_;
+        }
+    }
+
+private:
+    void wake_() {
+        if (n_sleeping_ != 0) {
+            Mutex::Lock lock(mutex_);
+            cond_.broadcast();
+        }
+    }
+
+    Array<T> slots_;
+
+    // each index is owned (written) by one side only and padded apart,
+    // so that the producer and the consumer don't invalidate each
+    // other's cache lines on every operation
+    CacheAligned<Atomic> head_;
+    CacheAligned<Atomic> tail_;
+
+    // the sleep machinery is touched only on empty/full transitions
+    Mutex mutex_;
+    Cond cond_;
+    Atomic n_sleeping_;
+
+    bool valid_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_SPSC_RING_H_
@@ -18,6 +18,12 @@ namespace roc {
 namespace core {
 
 //! Atomic integer.
+//!
+//! The operators provide sequentially consistent operations built on the
+//! legacy __sync builtins, each of which implies a full memory barrier.
+//! The explicitly named methods provide operations with weaker ordering
+//! built on the __atomic builtins, for hot paths like reference counters
+//! and statistics counters where a full fence is unnecessary.
 class Atomic : public NonCopyable<> {
 public:
     //! Initialize with given value.
@@ -30,6 +36,61 @@ public:
         return __sync_add_and_fetch(&value_, 0);
     }
 
+    //! Atomic load (no ordering).
+    long load_relaxed() const {
+        return __atomic_load_n(&value_, __ATOMIC_RELAXED);
+    }
+
+    //! Atomic load (acquire ordering).
+    long load_acquire() const {
+        return __atomic_load_n(&value_, __ATOMIC_ACQUIRE);
+    }
+
+    //! Atomic store (no ordering).
+    void store_relaxed(long v) {
+        __atomic_store_n(&value_, v, __ATOMIC_RELAXED);
+    }
+
+    //! Atomic store (release ordering).
+    void store_release(long v) {
+        __atomic_store_n(&value_, v, __ATOMIC_RELEASE);
+    }
+
+    //! Atomic increment (no ordering).
+    //! @returns the new value.
+    long incr_relaxed() {
+        return __atomic_add_fetch(&value_, 1, __ATOMIC_RELAXED);
+    }
+
+    //! Atomic addition (no ordering).
+    //! @returns the new value.
+    long add_relaxed(long v) {
+        return __atomic_add_fetch(&value_, v, __ATOMIC_RELAXED);
+    }
+
+    //! Atomic decrement (no ordering).
+    //! @returns the new value.
+    long decr_relaxed() {
+        return __atomic_sub_fetch(&value_, 1, __ATOMIC_RELAXED);
+    }
+
+    //! Atomic decrement (acquire-release ordering).
+    //! @returns the new value.
+    //! @remarks
+    //!  Suitable for reference counters: earlier writes to the protected
+    //!  object can't be reordered after the decrement, and the thread that
+    //!  drops the counter to zero observes all such writes.
+    long decr_acq_rel() {
+        return __atomic_sub_fetch(&value_, 1, __ATOMIC_ACQ_REL);
+    }
+
+    //! Atomic compare-and-swap.
+    //! @returns
+    //!  true if the value was equal to @p expected and was set to @p desired.
+    bool cas(long expected, long desired) {
+        return __sync_bool_compare_and_swap(&value_, expected, desired);
+    }
+
     //! Atomic store.
     //! @remarks
     //!  Only boolean values may be implemented in a cross-platform way
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/cpu_features.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace core {
+
+CpuFeatures::CpuFeatures()
+    : ssse3_(false)
+    , avx2_(false)
+    , fma_(false)
+    , neon_(false) {
+#if defined(__x86_64__) || defined(__i386__)
+    ssse3_ = __builtin_cpu_supports("ssse3");
+    avx2_ = __builtin_cpu_supports("avx2");
+    fma_ = __builtin_cpu_supports("fma");
+#endif
+
+    // NEON support is a compile-time property: the NEON kernels are built
+    // only when the compiler targets a NEON-capable CPU
+#if defined(__ARM_NEON)
+    neon_ = true;
+#endif
+
+    roc_log(LogDebug, "cpu features: ssse3=%d avx2=%d fma=%d neon=%d", (int)ssse3_,
+            (int)avx2_, (int)fma_, (int)neon_);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_gcc/roc_core/cpu_features.h
+//! @brief CPU feature detection.
+
+#ifndef ROC_CORE_CPU_FEATURES_H_
+#define ROC_CORE_CPU_FEATURES_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+
+namespace roc {
+namespace core {
+
+//! CPU feature detection.
+//! @remarks
+//!  Detects the features of the CPU we're running on once, at first use.
+//!  Code with runtime-selected SIMD kernels should query this singleton
+//!  when building its function table, so that detection and logging live
+//!  in one place and kernels are selected once at initialization, with
+//!  no per-call branching.
+class CpuFeatures : public NonCopyable<> {
+public:
+    //! Get singleton instance.
+    static CpuFeatures& instance() {
+        return Singleton<CpuFeatures>::instance();
+    }
+
+    //! Check for SSSE3 support (x86).
+    bool has_ssse3() const {
+        return ssse3_;
+    }
+
+    //! Check for AVX2 support (x86).
+    bool has_avx2() const {
+        return avx2_;
+    }
+
+    //! Check for FMA support (x86).
+    bool has_fma() const {
+        return fma_;
+    }
+
+    //! Check for NEON support (ARM).
+    bool has_neon() const {
+        return neon_;
+    }
+
+private:
+    friend class Singleton<CpuFeatures>;
+
+    CpuFeatures();
+
+    bool ssse3_;
+    bool avx2_;
+    bool fma_;
+    bool neon_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_FEATURES_H_
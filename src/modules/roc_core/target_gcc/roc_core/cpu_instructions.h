@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_gcc/roc_core/cpu_instructions.h
+//! @brief CPU-specific instructions.
+
+#ifndef ROC_CORE_CPU_INSTRUCTIONS_H_
+#define ROC_CORE_CPU_INSTRUCTIONS_H_
+
+namespace roc {
+namespace core {
+
+//! CPU pause instruction for spin wait loops.
+//! @remarks
+//!  Hints the CPU that the caller is spinning on a flag, so that it can
+//!  reduce power consumption and let the sibling hyper-thread run. Also
+//!  acts as a compiler barrier, so the spin condition is re-read from
+//!  memory on every iteration.
+inline void cpu_relax() {
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause" ::: "memory");
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield" ::: "memory");
+#else
+    __asm__ __volatile__("" ::: "memory");
+#endif
+}
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_INSTRUCTIONS_H_
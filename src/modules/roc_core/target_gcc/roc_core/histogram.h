@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_gcc/roc_core/histogram.h
+//! @brief Lock-free histogram.
+
+#ifndef ROC_CORE_HISTOGRAM_H_
+#define ROC_CORE_HISTOGRAM_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+//! Lock-free histogram of nanosecond durations.
+//!
+//! Buckets are laid out HDR-style: the value range is split into octaves
+//! and every octave is split into a fixed number of linear sub-buckets,
+//! so that the relative error of a recorded value is bounded by the
+//! sub-bucket resolution regardless of its magnitude.
+//!
+//! add() is a single relaxed increment of a pre-sized counter array and
+//! is safe to call concurrently from multiple threads. The query methods
+//! may be called concurrently with add(); they observe a slightly stale
+//! but consistent-enough snapshot, which is fine for reporting.
+class Histogram : public NonCopyable<> {
+public:
+    //! Record a value.
+    //! @remarks
+    //!  Negative values are clamped to zero.
+    void add(nanoseconds_t value) {
+        counts_[bucket_index_(value)].incr_relaxed();
+    }
+
+    //! Get the number of recorded values.
+    uint64_t total() const {
+        uint64_t total = 0;
+        for (size_t n = 0; n < NumBuckets; n++) {
+            total += (uint64_t)counts_[n].load_relaxed();
+        }
+        return total;
+    }
+
+    //! Get an upper bound for the given percentile of the recorded values.
+    //! @remarks
+    //!  @p p should be in range (0; 100]. Returns the upper bound of the
+    //!  bucket holding the requested rank, or zero if the histogram is
+    //!  empty. percentile(100) reports an upper bound for the maximum
+    //!  recorded value.
+    nanoseconds_t percentile(double p) const {
+        if (p <= 0 || p > 100) {
+            roc_panic("histogram: percentile should be in range (0; 100], got %f", p);
+        }
+
+        const uint64_t n_values = total();
+        if (n_values == 0) {
+            return 0;
+        }
+
+        uint64_t rank = (uint64_t)(p / 100. * (double)n_values + 0.5);
+        if (rank == 0) {
+            rank = 1;
+        }
+        if (rank > n_values) {
+            rank = n_values;
+        }
+
+        uint64_t seen = 0;
+        for (size_t n = 0; n < NumBuckets; n++) {
+            seen += (uint64_t)counts_[n].load_relaxed();
+            if (seen >= rank) {
+                return bucket_bound_(n);
+            }
+        }
+
+        return bucket_bound_(NumBuckets - 1);
+    }
+
+private:
+    enum {
+        // Number of linear sub-buckets per octave. Bounds the relative
+        // error of a reported value by 1/SubBuckets.
+        SubBucketBits = 4,
+        SubBuckets = 1 << SubBucketBits,
+
+        // Octave 0 covers [0; SubBuckets) with unit-sized buckets; every
+        // following octave doubles the range and covers it with the upper
+        // half of the sub-buckets.
+        NumOctaves = 64 - SubBucketBits,
+        NumBuckets = SubBuckets + NumOctaves * (SubBuckets / 2)
+    };
+
+    static size_t bucket_index_(nanoseconds_t value) {
+        if (value < 0) {
+            value = 0;
+        }
+        const uint64_t v = (uint64_t)value;
+
+        if (v < SubBuckets) {
+            return (size_t)v;
+        }
+
+        const size_t octave = (size_t)(63 - __builtin_clzll(v)) - (SubBucketBits - 1);
+        const size_t sub = (size_t)(v >> octave);
+
+        return SubBuckets + (octave - 1) * (SubBuckets / 2) + (sub - SubBuckets / 2);
+    }
+
+    static nanoseconds_t bucket_bound_(size_t index) {
+        if (index < SubBuckets) {
+            return (nanoseconds_t)index;
+        }
+
+        const size_t octave = (index - SubBuckets) / (SubBuckets / 2) + 1;
+        const size_t sub = (index - SubBuckets) % (SubBuckets / 2) + SubBuckets / 2;
+
+        return (nanoseconds_t)(((uint64_t)(sub + 1) << octave) - 1);
+    }
+
+    Atomic counts_[NumBuckets];
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_HISTOGRAM_H_
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_gcc/roc_core/prefetch.h
+//! @brief Cache prefetching.
+
+#ifndef ROC_CORE_PREFETCH_H_
+#define ROC_CORE_PREFETCH_H_
+
+#include "roc_core/alignment.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Prefetch a memory region into the data cache for reading.
+//! @remarks
+//!  A hint: issues one prefetch per cache line of the region and never
+//!  faults, even for invalid addresses. Useful when the region is known
+//!  to be read soon but after enough independent work to hide the memory
+//!  latency behind.
+inline void prefetch_read(const void* data, size_t size) {
+    const char* ptr = (const char*)data;
+    for (size_t n = 0; n < size; n += CacheLineSize) {
+        __builtin_prefetch(ptr + n, 0, 1);
+    }
+}
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_PREFETCH_H_
@@ -17,6 +17,7 @@
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace core {
@@ -42,6 +43,18 @@ public:
         uv_cond_wait(&cond_, &mutex_);
     }
 
+    //! Wait with timeout.
+    //! @returns
+    //!  false if the timeout expired before the condition was signaled.
+    bool timed_wait(uint64_t timeout_ns) const {
+        return uv_cond_timedwait(&cond_, &mutex_, timeout_ns) == 0;
+    }
+
+    //! Wake up one pending wait.
+    void signal() const {
+        uv_cond_signal(&cond_);
+    }
+
     //! Wake up all pending waits.
     void broadcast() const {
         uv_cond_broadcast(&cond_);
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_libuv/roc_core/spin_mutex.h
+//! @brief Adaptive spinning mutex.
+
+#ifndef ROC_CORE_SPIN_MUTEX_H_
+#define ROC_CORE_SPIN_MUTEX_H_
+
+#include <uv.h>
+
+#include "roc_core/cpu_instructions.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/scoped_lock.h"
+
+namespace roc {
+namespace core {
+
+//! Adaptive spinning mutex.
+//!
+//! Intended for short critical sections on latency-sensitive paths. A
+//! contended acquire first spins for a bounded number of iterations,
+//! expecting the owner to leave the section in sub-microsecond time, and
+//! only then parks on the underlying mutex. This avoids the scheduler
+//! round-trip of an immediate sleep, while the bounded spin keeps the
+//! worst case no worse than a plain Mutex.
+//!
+//! Should not be used for sections that may block or take long, where
+//! spinning would just burn cycles; use Mutex for those.
+class SpinMutex : public NonCopyable<> {
+public:
+    //! RAII lock.
+    typedef ScopedLock<SpinMutex> Lock;
+
+    SpinMutex() {
+        if (int err = uv_mutex_init(&mutex_)) {
+            roc_panic("spin mutex: uv_mutex_init(): [%s] %s", uv_err_name(err),
+                      uv_strerror(err));
+        }
+    }
+
+    ~SpinMutex() {
+        uv_mutex_destroy(&mutex_);
+    }
+
+    //! Lock mutex, spinning briefly before parking.
+    void lock() const {
+        for (size_t n = 0; n < SpinIterations; n++) {
+            if (uv_mutex_trylock(&mutex_) == 0) {
+                return;
+            }
+            cpu_relax();
+        }
+
+        uv_mutex_lock(&mutex_);
+    }
+
+    //! Unlock mutex.
+    void unlock() const {
+        uv_mutex_unlock(&mutex_);
+    }
+
+private:
+    // roughly a few hundred nanoseconds of spinning; enough to cover the
+    // short sections this mutex is meant for, and short enough to lose
+    // almost nothing when the owner is actually descheduled
+    enum { SpinIterations = 100 };
+
+    mutable uv_mutex_t mutex_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_SPIN_MUTEX_H_
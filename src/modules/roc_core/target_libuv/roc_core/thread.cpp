@@ -7,9 +7,11 @@
  */
 
 #include "roc_core/thread.h"
+#include "roc_core/cpu_affinity.h"
 #include "roc_core/errno_to_str.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/thread_params.h"
 
 namespace roc {
 namespace core {
@@ -17,6 +19,7 @@ namespace core {
 Thread::Thread()
     : started_(0)
     , joinable_(0) {
+    name_[0] = '\0';
 }
 
 Thread::~Thread() {
@@ -30,13 +33,26 @@ bool Thread::joinable() const {
 }
 
 bool Thread::start() {
+    return start(ThreadConfig());
+}
+
+bool Thread::start(const ThreadConfig& config) {
     Mutex::Lock lock(mutex_);
 
     if (started_) {
-        roc_log(LogError, "thread: can't start thread more than once");
+        roc_log(LogError, "thread: can't start thread before joining previous one");
         return false;
     }
 
+    config_ = config;
+
+    // the name is copied, so the caller doesn't have to keep it alive
+    name_[0] = '\0';
+    if (config.name) {
+        strncpy(name_, config.name, sizeof(name_) - 1);
+        name_[sizeof(name_) - 1] = '\0';
+    }
+
     if (int err = uv_thread_create(&thread_, thread_runner_, this)) {
         roc_log(LogError, "thread: uv_thread_create(): [%s] %s", uv_err_name(err),
                 uv_strerror(err));
@@ -62,10 +78,30 @@ void Thread::join() {
     }
 
     joinable_ = 0;
+    started_ = 0;
 }
 
 void Thread::thread_runner_(void* ptr) {
-    static_cast<Thread*>(ptr)->run();
+    Thread& self = *static_cast<Thread*>(ptr);
+
+    self.apply_config_();
+    self.run();
+}
+
+// Runs in the new thread before run(). Failures are logged by the
+// helpers and ignored, since scheduling tweaks are best-effort.
+void Thread::apply_config_() {
+    if (name_[0] != '\0') {
+        (void)set_thread_name(name_);
+    }
+
+    if (config_.cpu >= 0) {
+        (void)pin_thread_to_cpu((unsigned)config_.cpu);
+    }
+
+    if (config_.realtime_priority > 0) {
+        (void)set_thread_realtime_priority(config_.realtime_priority);
+    }
 }
 
 } // namespace core
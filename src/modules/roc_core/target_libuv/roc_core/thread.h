@@ -17,10 +17,41 @@
 #include "roc_core/atomic.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
 
 namespace roc {
 namespace core {
 
+//! Thread scheduling parameters.
+//! @remarks
+//!  Applied by the new thread itself before run() is invoked. All
+//!  parameters are best-effort: a parameter that can't be applied is
+//!  logged and skipped, and the thread runs anyway.
+struct ThreadConfig {
+    //! Thread name, visible in process listings and profilers.
+    //! May be truncated by the OS (to 15 characters on Linux).
+    //! If NULL, the thread inherits the process name.
+    const char* name;
+
+    //! Real-time FIFO priority.
+    //! If positive, the thread is switched to the real-time FIFO policy
+    //! with this priority, so it can't be preempted by bulk work.
+    //! Usually requires privileges. If zero, the default time-sharing
+    //! policy is kept.
+    int realtime_priority;
+
+    //! Index of the CPU core to pin the thread to.
+    //! Pinning keeps the thread's working set in one core's caches and
+    //! on one NUMA node. If negative, the thread migrates freely.
+    int cpu;
+
+    ThreadConfig()
+        : name(NULL)
+        , realtime_priority(0)
+        , cpu(-1) {
+    }
+};
+
 //! Base class for thread objects.
 class Thread : public NonCopyable<Thread> {
 public:
@@ -29,14 +60,20 @@ public:
     //!  true if start() was called and join() was not called yet.
     bool joinable() const;
 
-    //! Start thread.
+    //! Start thread with default scheduling parameters.
     //! @remarks
     //!  Executes run() in new thread.
     bool start();
 
+    //! Start thread with given scheduling parameters.
+    //! @remarks
+    //!  The new thread applies @p config and then executes run().
+    bool start(const ThreadConfig& config);
+
     //! Join thread.
     //! @remarks
-    //!  Blocks until run() returns and thread terminates.
+    //!  Blocks until run() returns and thread terminates. After join()
+    //!  returns, the thread may be started again.
     void join();
 
 protected:
@@ -50,8 +87,13 @@ protected:
 private:
     static void thread_runner_(void* ptr);
 
+    void apply_config_();
+
     uv_thread_t thread_;
 
+    ThreadConfig config_;
+    char name_[16];
+
     int started_;
     Atomic joinable_;
 
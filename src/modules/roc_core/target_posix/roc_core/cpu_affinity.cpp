@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "roc_core/cpu_affinity.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace core {
+
+#ifdef CPU_SET
+
+bool pin_thread_to_cpu(unsigned cpu) {
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+
+    if (int err = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset)) {
+        roc_log(LogError, "cpu affinity: pthread_setaffinity_np(): cpu=%u err=%d", cpu,
+                err);
+        return false;
+    }
+
+    roc_log(LogDebug, "cpu affinity: pinned thread to cpu %u", cpu);
+
+    return true;
+}
+
+#else // !CPU_SET
+
+bool pin_thread_to_cpu(unsigned cpu) {
+    roc_log(LogError, "cpu affinity: pinning not supported on this platform: cpu=%u",
+            cpu);
+
+    return false;
+}
+
+#endif // CPU_SET
+
+} // namespace core
+} // namespace roc
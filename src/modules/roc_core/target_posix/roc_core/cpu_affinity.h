@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/cpu_affinity.h
+//! @brief CPU affinity.
+
+#ifndef ROC_CORE_CPU_AFFINITY_H_
+#define ROC_CORE_CPU_AFFINITY_H_
+
+namespace roc {
+namespace core {
+
+//! Pin the calling thread to a CPU core.
+//!
+//! Restricts the calling thread to the given core, so that the thread,
+//! the memory it touches first, and the interrupts it handles stay on
+//! one NUMA node. Typically used from Thread::run() of threads on the
+//! packet path, paired with pool buffers being allocated and freed on
+//! the same node by the first-touch policy.
+//!
+//! @returns
+//!  true on success or false if pinning is not supported or not
+//!  permitted on this platform.
+bool pin_thread_to_cpu(unsigned cpu);
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_CPU_AFFINITY_H_
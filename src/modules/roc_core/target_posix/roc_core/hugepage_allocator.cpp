@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "roc_core/alignment.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/hugepage_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace roc {
+namespace core {
+
+namespace {
+
+size_t round_up(size_t size, size_t multiple) {
+    return size + padding(size, multiple);
+}
+
+} // namespace
+
+HugepageAllocator::HugepageAllocator()
+    : page_size_((size_t)sysconf(_SC_PAGESIZE)) {
+}
+
+HugepageAllocator::~HugepageAllocator() {
+    if (num_allocations_.load_relaxed() != 0) {
+        roc_panic("hugepage allocator: detected leak, num_allocations=%d",
+                  (int)num_allocations_.load_relaxed());
+    }
+}
+
+void* HugepageAllocator::allocate(size_t size) {
+    const size_t full_size = max_align(sizeof(Header)) + size;
+
+    void* memory = NULL;
+    size_t mmap_size = 0;
+
+#ifdef MAP_HUGETLB
+    if (full_size >= DefaultHugePageSize / 2) {
+        mmap_size = round_up(full_size, DefaultHugePageSize);
+        memory = mmap_prefaulted_(mmap_size, true);
+        if (!memory) {
+            // typically no explicit huge pages are reserved in the system;
+            // transparent huge pages are requested below instead
+            roc_log(LogDebug, "hugepage allocator: mmap(MAP_HUGETLB): %s",
+                    errno_to_str().c_str());
+        }
+    }
+#endif // MAP_HUGETLB
+
+    if (!memory) {
+        mmap_size = round_up(full_size, page_size_);
+        memory = mmap_prefaulted_(mmap_size, false);
+        if (!memory) {
+            roc_log(LogError, "hugepage allocator: mmap(): %s", errno_to_str().c_str());
+            return NULL;
+        }
+    }
+
+    Header* header = (Header*)memory;
+    header->mmap_size = mmap_size;
+
+    num_allocations_.incr_relaxed();
+
+    return (char*)memory + max_align(sizeof(Header));
+}
+
+void HugepageAllocator::deallocate(void* ptr) {
+    if (ptr == NULL) {
+        roc_panic("hugepage allocator: deallocating null pointer");
+    }
+
+    if (num_allocations_.load_relaxed() <= 0) {
+        roc_panic("hugepage allocator: unpaired deallocate");
+    }
+    num_allocations_.decr_relaxed();
+
+    Header* header = (Header*)((char*)ptr - max_align(sizeof(Header)));
+
+    if (munmap(header, header->mmap_size) != 0) {
+        roc_panic("hugepage allocator: munmap(): %s", errno_to_str().c_str());
+    }
+}
+
+size_t HugepageAllocator::num_allocations() const {
+    return (size_t)num_allocations_.load_relaxed();
+}
+
+void* HugepageAllocator::mmap_prefaulted_(size_t mmap_size, bool hugetlb) {
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+    if (hugetlb) {
+#ifdef MAP_HUGETLB
+        flags |= MAP_HUGETLB;
+#ifdef MAP_POPULATE
+        // explicit huge pages are faulted in by the kernel right away
+        flags |= MAP_POPULATE;
+#endif
+#else // !MAP_HUGETLB
+        return NULL;
+#endif // !MAP_HUGETLB
+    }
+
+    void* memory = mmap(NULL, mmap_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (memory == MAP_FAILED) {
+        return NULL;
+    }
+
+    if (!hugetlb) {
+#ifdef MADV_HUGEPAGE
+        // ask for transparent huge pages before faulting the pages in, so
+        // that they may be mapped as huge right away
+        if (mmap_size >= DefaultHugePageSize) {
+            (void)madvise(memory, mmap_size, MADV_HUGEPAGE);
+        }
+#endif // MADV_HUGEPAGE
+
+        // touch every page so that nothing faults when the memory is used
+        for (size_t off = 0; off < mmap_size; off += page_size_) {
+            ((volatile char*)memory)[off] = 0;
+        }
+    }
+
+    return memory;
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/hugepage_allocator.h
+//! @brief Huge page allocator implementation.
+
+#ifndef ROC_CORE_HUGEPAGE_ALLOCATOR_H_
+#define ROC_CORE_HUGEPAGE_ALLOCATOR_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Huge page allocator implementation.
+//!
+//! Serves allocations with anonymous memory mappings that are pre-faulted
+//! at allocation time, so that the memory is never first-touched later on
+//! a latency-sensitive path. On Linux, large allocations are additionally
+//! backed with huge pages when possible, either explicitly (MAP_HUGETLB)
+//! or via transparent huge pages (MADV_HUGEPAGE), reducing TLB pressure.
+//!
+//! Intended as a backing allocator for pools, whose chunks can be reserved
+//! at startup with Pool::reserve(). Every allocation occupies at least one
+//! page, so the allocator is wasteful for small short-lived allocations.
+//!
+//! The memory is always maximum aligned. Thread-safe.
+class HugepageAllocator : public IAllocator, public NonCopyable<> {
+public:
+    HugepageAllocator();
+
+    ~HugepageAllocator();
+
+    //! Allocate memory.
+    virtual void* allocate(size_t size);
+
+    //! Deallocate previously allocated memory.
+    virtual void deallocate(void*);
+
+    //! Get number of allocated blocks.
+    size_t num_allocations() const;
+
+private:
+    enum {
+        //! Explicit huge pages are attempted only for allocations that
+        //! would waste at most half of the trailing huge page.
+        DefaultHugePageSize = 2 * 1024 * 1024
+    };
+
+    struct Header {
+        size_t mmap_size;
+    };
+
+    void* mmap_prefaulted_(size_t mmap_size, bool hugetlb);
+
+    const size_t page_size_;
+
+    Atomic num_allocations_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_HUGEPAGE_ALLOCATOR_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/metrics_reader.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+MetricsReader::MetricsReader(const char* shm_name)
+    : page_(NULL) {
+    if (!shm_name) {
+        roc_panic("metrics reader: null shared memory name");
+    }
+
+    const int fd = shm_open(shm_name, O_RDONLY, 0);
+    if (fd == -1) {
+        roc_log(LogError, "metrics reader: shm_open(%s): %s", shm_name,
+                errno_to_str().c_str());
+        return;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        roc_log(LogError, "metrics reader: fstat(): %s", errno_to_str().c_str());
+        close(fd);
+        return;
+    }
+
+    if ((size_t)st.st_size < sizeof(MetricsPage)) {
+        roc_log(LogError, "metrics reader: unexpected page size: expected=%lu got=%lu",
+                (unsigned long)sizeof(MetricsPage), (unsigned long)st.st_size);
+        close(fd);
+        return;
+    }
+
+    void* mem = mmap(NULL, sizeof(MetricsPage), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (mem == MAP_FAILED) {
+        roc_log(LogError, "metrics reader: mmap(): %s", errno_to_str().c_str());
+        return;
+    }
+
+    const MetricsPage* page = (const MetricsPage*)mem;
+
+    if (page->magic != MetricsPage::Magic || page->version != MetricsPage::Version) {
+        roc_log(LogError,
+                "metrics reader: bad page magic or version: magic=0x%lx version=%lu",
+                (unsigned long)page->magic, (unsigned long)page->version);
+        munmap(mem, sizeof(MetricsPage));
+        return;
+    }
+
+    page_ = page;
+}
+
+MetricsReader::~MetricsReader() {
+    if (page_) {
+        munmap((void*)page_, sizeof(MetricsPage));
+    }
+}
+
+bool MetricsReader::valid() const {
+    return page_;
+}
+
+size_t MetricsReader::num_counters() const {
+    roc_panic_if_not(valid());
+
+    // Pairs with the release store in MetricsRegistry::find_or_add_counter(),
+    // so slot names below the loaded count are fully written.
+    return (size_t)page_->num_counters.load_acquire();
+}
+
+const char* MetricsReader::counter_name(size_t index) const {
+    if (index >= num_counters()) {
+        roc_panic("metrics reader: counter index out of range: index=%lu count=%lu",
+                  (unsigned long)index, (unsigned long)num_counters());
+    }
+
+    return page_->slots[index].name;
+}
+
+long MetricsReader::counter_value(size_t index) const {
+    if (index >= num_counters()) {
+        roc_panic("metrics reader: counter index out of range: index=%lu count=%lu",
+                  (unsigned long)index, (unsigned long)num_counters());
+    }
+
+    return page_->slots[index].value.load_relaxed();
+}
+
+} // namespace core
+} // namespace roc
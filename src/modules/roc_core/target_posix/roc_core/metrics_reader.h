@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/metrics_reader.h
+//! @brief Metrics reader.
+
+#ifndef ROC_CORE_METRICS_READER_H_
+#define ROC_CORE_METRICS_READER_H_
+
+#include "roc_core/metrics_registry.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Metrics reader.
+//!
+//! Maps a metrics page exported by another process (see MetricsRegistry)
+//! and provides read-only access to the published counters. Reading takes
+//! no locks in either process, so the page may be polled at any frequency
+//! without perturbing the exporting process.
+class MetricsReader : public NonCopyable<> {
+public:
+    //! Open metrics page with given shared memory name.
+    explicit MetricsReader(const char* shm_name);
+
+    ~MetricsReader();
+
+    //! Check if the page was successfully mapped.
+    bool valid() const;
+
+    //! Get number of published counters.
+    size_t num_counters() const;
+
+    //! Get name of counter.
+    //! @pre
+    //!  @p index should be less than num_counters().
+    const char* counter_name(size_t index) const;
+
+    //! Get current value of counter.
+    //! @pre
+    //!  @p index should be less than num_counters().
+    long counter_value(size_t index) const;
+
+private:
+    const MetricsPage* page_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_METRICS_READER_H_
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/metrics_registry.h"
+#include "roc_core/panic.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+namespace roc {
+namespace core {
+
+MetricsRegistry::MetricsRegistry()
+    : page_(NULL)
+    , exported_(false) {
+    const char* shm_name = getenv("ROC_METRICS_SHM");
+
+    void* mem = MAP_FAILED;
+
+    if (shm_name) {
+        const int fd = shm_open(shm_name, O_CREAT | O_RDWR,
+                                S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        if (fd == -1) {
+            roc_log(LogError, "metrics registry: shm_open(%s): %s", shm_name,
+                    errno_to_str().c_str());
+            return;
+        }
+
+        if (ftruncate(fd, (off_t)sizeof(MetricsPage)) == -1) {
+            roc_log(LogError, "metrics registry: ftruncate(): %s",
+                    errno_to_str().c_str());
+            close(fd);
+            return;
+        }
+
+        mem = mmap(NULL, sizeof(MetricsPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                   0);
+        close(fd);
+
+        exported_ = true;
+    } else {
+        mem = mmap(NULL, sizeof(MetricsPage), PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    if (mem == MAP_FAILED) {
+        roc_log(LogError, "metrics registry: mmap(): %s", errno_to_str().c_str());
+        return;
+    }
+
+    // Always start from an empty page: a pre-existing shared memory object
+    // may contain counters of a dead process.
+    memset(mem, 0, sizeof(MetricsPage));
+
+    page_ = new (mem) MetricsPage;
+
+    page_->version = MetricsPage::Version;
+    page_->magic = MetricsPage::Magic;
+
+    roc_log(LogDebug, "metrics registry: initializing: exported=%d max_counters=%d",
+            (int)exported_, (int)MetricsPage::MaxCounters);
+}
+
+Atomic* MetricsRegistry::find_or_add_counter(const char* name) {
+    if (!name) {
+        roc_panic("metrics registry: null counter name");
+    }
+
+    Mutex::Lock lock(mutex_);
+
+    if (!page_) {
+        return NULL;
+    }
+
+    const size_t num = (size_t)page_->num_counters.load_relaxed();
+
+    for (size_t n = 0; n < num; n++) {
+        if (strcmp(page_->slots[n].name, name) == 0) {
+            return &page_->slots[n].value;
+        }
+    }
+
+    if (num == MetricsPage::MaxCounters) {
+        roc_log(LogError, "metrics registry: page is full: max_counters=%d",
+                (int)MetricsPage::MaxCounters);
+        return NULL;
+    }
+
+    MetricsPage::Slot& slot = page_->slots[num];
+
+    strncpy(slot.name, name, sizeof(slot.name) - 1);
+
+    // The slot becomes visible to the reader only after its name is
+    // fully written.
+    page_->num_counters.store_release((long)(num + 1));
+
+    return &slot.value;
+}
+
+} // namespace core
+} // namespace roc
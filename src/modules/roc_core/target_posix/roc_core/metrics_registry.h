@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/metrics_registry.h
+//! @brief Metrics registry.
+
+#ifndef ROC_CORE_METRICS_REGISTRY_H_
+#define ROC_CORE_METRICS_REGISTRY_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Metrics page layout.
+//!
+//! A fixed-size page of named counters shared between the process and an
+//! external scraping agent. The writer appends slots and publishes each
+//! one by bumping num_counters with a release store; slot names are
+//! immutable once published, so the reader needs no locks.
+struct MetricsPage {
+    enum {
+        //! Expected magic value.
+        Magic = 0x524d4554,
+
+        //! Current layout version.
+        Version = 1,
+
+        //! Maximum counter name length, including terminator.
+        MaxNameLen = 56,
+
+        //! Maximum number of counters in page.
+        MaxCounters = 128
+    };
+
+    //! Counter slot.
+    struct Slot {
+        char name[MaxNameLen]; //!< Zero-terminated counter name.
+        Atomic value;          //!< Counter value.
+    };
+
+    uint32_t magic;   //!< Magic value.
+    uint32_t version; //!< Layout version.
+
+    //! Number of published slots.
+    Atomic num_counters;
+
+    //! Counter slots.
+    Slot slots[MaxCounters];
+};
+
+//! Metrics registry.
+//!
+//! Subsystems register named counters once at construction time and then
+//! update them from hot paths with relaxed atomic operations, which cost
+//! a single store and never take locks. Counters with the same name share
+//! a slot, so per-instance statistics should be published as additive
+//! increments and decrements.
+//!
+//! If the ROC_METRICS_SHM environment variable is set, the page is backed
+//! by a POSIX shared memory object with that name, and an external agent
+//! may scrape the counters at any frequency without perturbing the
+//! process (see MetricsReader). Otherwise the page is process-private and
+//! the counters are maintained but not exported.
+class MetricsRegistry : public NonCopyable<> {
+public:
+    //! Get singleton instance.
+    static MetricsRegistry& instance() {
+        return Singleton<MetricsRegistry>::instance();
+    }
+
+    //! Get or create a counter with given name.
+    //!
+    //! Takes a lock and so should be called at construction time, not on
+    //! a hot path. Names longer than MetricsPage::MaxNameLen are truncated.
+    //!
+    //! @returns
+    //!  the counter, valid until the end of the process, or NULL if the
+    //!  page can't be created or is full.
+    Atomic* find_or_add_counter(const char* name);
+
+private:
+    friend class Singleton<MetricsRegistry>;
+
+    MetricsRegistry();
+
+    Mutex mutex_;
+    MetricsPage* page_;
+    bool exported_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_METRICS_REGISTRY_H_
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sched.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/realtime.h"
+
+namespace roc {
+namespace core {
+
+bool enable_realtime() {
+    const int pmin = sched_get_priority_min(SCHED_RR);
+    const int pmax = sched_get_priority_max(SCHED_RR);
+
+    if (pmin == -1 || pmax == -1) {
+        roc_log(LogError, "realtime: sched_get_priority_min(): %s",
+                errno_to_str().c_str());
+        return false;
+    }
+
+    struct sched_param param;
+    memset(&param, 0, sizeof(param));
+
+    // the middle of the real-time range: above every time-sharing task,
+    // but leaving room for more critical system threads
+    param.sched_priority = pmin + (pmax - pmin) / 2;
+
+    // round-robin rather than fifo, so that if some of our threads spins,
+    // it can't starve the others
+    if (sched_setscheduler(0, SCHED_RR, &param) == -1) {
+        roc_log(LogError, "realtime: sched_setscheduler(SCHED_RR): %s",
+                errno_to_str().c_str());
+        return false;
+    }
+
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) == -1) {
+        roc_log(LogError, "realtime: mlockall(): %s", errno_to_str().c_str());
+        return false;
+    }
+
+    roc_log(LogInfo,
+            "realtime: enabled real-time scheduling and memory locking (priority %d)",
+            param.sched_priority);
+
+    return true;
+}
+
+} // namespace core
+} // namespace roc
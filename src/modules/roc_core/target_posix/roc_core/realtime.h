@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/realtime.h
+//! @brief Real-time process setup.
+
+#ifndef ROC_CORE_REALTIME_H_
+#define ROC_CORE_REALTIME_H_
+
+namespace roc {
+namespace core {
+
+//! Switch the process to real-time mode.
+//!
+//! Applies the real-time round-robin scheduling policy to the calling
+//! thread, which is inherited by the threads it creates afterwards, and
+//! locks current and future process memory into RAM, so that neither the
+//! scheduler nor a page fault can stall audio processing.
+//!
+//! Requires appropriate privileges (e.g. CAP_SYS_NICE and a sufficient
+//! RLIMIT_MEMLOCK on Linux).
+//!
+//! @returns
+//!  true on success or false if the scheduling policy or memory locking
+//!  can't be applied.
+bool enable_realtime();
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_REALTIME_H_
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+#include "roc_core/log.h"
+#include "roc_core/thread_params.h"
+
+namespace roc {
+namespace core {
+
+#if defined(__linux__)
+
+bool set_thread_name(const char* name) {
+    if (int err = pthread_setname_np(pthread_self(), name)) {
+        roc_log(LogError, "thread params: pthread_setname_np(): name=%s err=%d", name,
+                err);
+        return false;
+    }
+
+    return true;
+}
+
+#else // !defined(__linux__)
+
+bool set_thread_name(const char* name) {
+    roc_log(LogDebug, "thread params: naming not supported on this platform: name=%s",
+            name);
+
+    return false;
+}
+
+#endif // defined(__linux__)
+
+bool set_thread_realtime_priority(int priority) {
+    struct sched_param param;
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = priority;
+
+    if (int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param)) {
+        roc_log(LogError,
+                "thread params: pthread_setschedparam(): priority=%d err=%d"
+                " (real-time scheduling usually requires privileges)",
+                priority, err);
+        return false;
+    }
+
+    roc_log(LogDebug, "thread params: set real-time priority %d", priority);
+
+    return true;
+}
+
+} // namespace core
+} // namespace roc
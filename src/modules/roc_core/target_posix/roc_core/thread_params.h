@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/thread_params.h
+//! @brief Per-thread scheduling controls.
+
+#ifndef ROC_CORE_THREAD_PARAMS_H_
+#define ROC_CORE_THREAD_PARAMS_H_
+
+namespace roc {
+namespace core {
+
+//! Set the name of the calling thread.
+//!
+//! The name shows up in process listings and profilers, which makes it
+//! much easier to attribute CPU time to the netio and pipeline threads.
+//! The OS may silently truncate long names (to 15 characters on Linux).
+//!
+//! @returns
+//!  true on success or false if naming is not supported on this platform.
+bool set_thread_name(const char* name);
+
+//! Switch the calling thread to the real-time FIFO scheduling policy.
+//!
+//! Real-time scheduling prevents the audio and network threads from
+//! being preempted by bulk work, reducing latency spikes under load.
+//! Usually requires elevated privileges or an rtprio rlimit.
+//!
+//! @returns
+//!  true on success or false if the policy is not permitted or not
+//!  supported on this platform.
+bool set_thread_realtime_priority(int priority);
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_THREAD_PARAMS_H_
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/target_posix/roc_core/tls_key.h
+//! @brief Thread-local storage key.
+
+#ifndef ROC_CORE_TLS_KEY_H_
+#define ROC_CORE_TLS_KEY_H_
+
+#include <pthread.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Thread-local storage key.
+//! @remarks
+//!  Provides a separate value slot for every thread. The value is a void
+//!  pointer, initially null in every thread.
+class TlsKey : public NonCopyable<> {
+public:
+    //! Destructor function for thread-local values.
+    typedef void (*DestructorFunc)(void*);
+
+    //! Create key.
+    //! @remarks
+    //!  If @p destructor is non-null, it is invoked with the stored value
+    //!  when a thread with a non-null value exits.
+    //!
+    //!  TLS keys are a limited per-process resource (PTHREAD_KEYS_MAX), so
+    //!  creation failure is not fatal; it is reported via valid() and the
+    //!  caller may degrade gracefully.
+    explicit TlsKey(DestructorFunc destructor = NULL)
+        : valid_(false) {
+        if (int err = pthread_key_create(&key_, destructor)) {
+            roc_log(LogError, "tls key: pthread_key_create(): %s",
+                    errno_to_str(err).c_str());
+            return;
+        }
+        valid_ = true;
+    }
+
+    ~TlsKey() {
+        if (!valid_) {
+            return;
+        }
+        if (int err = pthread_key_delete(key_)) {
+            roc_panic("tls key: pthread_key_delete(): %s", errno_to_str(err).c_str());
+        }
+    }
+
+    //! Check if the key was successfully created.
+    bool valid() const {
+        return valid_;
+    }
+
+    //! Get value for the calling thread.
+    void* get() const {
+        roc_panic_if(!valid_);
+        return pthread_getspecific(key_);
+    }
+
+    //! Set value for the calling thread.
+    void set(void* value) {
+        roc_panic_if(!valid_);
+        if (int err = pthread_setspecific(key_, value)) {
+            roc_panic("tls key: pthread_setspecific(): %s", errno_to_str(err).c_str());
+        }
+    }
+
+private:
+    pthread_key_t key_;
+    bool valid_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_TLS_KEY_H_
@@ -36,6 +36,21 @@ nanoseconds_t timestamp() {
 }
 #endif // defined(CLOCK_MONOTONIC)
 
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+nanoseconds_t thread_cputime() {
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == -1) {
+        roc_panic("time: clock_gettime(CLOCK_THREAD_CPUTIME_ID): %s",
+                  errno_to_str().c_str());
+    }
+    return nanoseconds_t(ts.tv_sec) * 1000000000 + nanoseconds_t(ts.tv_nsec);
+}
+#else  // !defined(CLOCK_THREAD_CPUTIME_ID)
+nanoseconds_t thread_cputime() {
+    return timestamp();
+}
+#endif // defined(CLOCK_THREAD_CPUTIME_ID)
+
 #if defined(CLOCK_MONOTONIC)
 void sleep_for(nanoseconds_t ns) {
     timespec ts;
@@ -77,7 +92,7 @@ void sleep_until(nanoseconds_t ns) {
 }
 #else  // !defined(CLOCK_MONOTONIC) || !defined(TIMER_ABSTIME)
 void sleep_until(nanoseconds_t ns) {
-    nanoseconds_t now = timestamp_ns();
+    nanoseconds_t now = timestamp();
     if (ns > now) {
         sleep_for(ns - now);
     }
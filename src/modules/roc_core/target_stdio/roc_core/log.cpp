@@ -12,20 +12,34 @@
 #include "roc_core/colors.h"
 #include "roc_core/format_time.h"
 #include "roc_core/log.h"
+#include "roc_core/time.h"
 
 namespace roc {
 namespace core {
 
 Logger::Logger()
-    : level_(DefaultLogLevel)
+    : async_cond_(mutex_)
+    , level_(DefaultLogLevel)
     , handler_(NULL)
-    , colors_(DefaultColorsMode) {
+    , colors_(DefaultColorsMode)
+    , async_thread_(*this)
+    , async_(0)
+    , started_(false)
+    , stop_(false)
+    , enqueue_pos_(0)
+    , dequeue_pos_(0)
+    , n_dropped_(0) {
+    for (size_t n = 0; n < RingSize; n++) {
+        ring_[n].seq.store_relaxed((long)n);
+    }
 }
 
-LogLevel Logger::level() {
-    Mutex::Lock lock(mutex_);
+Logger::~Logger() {
+    stop_thread_();
+}
 
-    return level_;
+LogLevel Logger::level() {
+    return (LogLevel)level_.load_relaxed();
 }
 
 void Logger::set_level(LogLevel level) {
@@ -39,7 +53,7 @@ void Logger::set_level(LogLevel level) {
         level = LogTrace;
     }
 
-    level_ = level;
+    level_.store_relaxed(level);
 }
 
 void Logger::set_handler(LogHandler handler) {
@@ -54,10 +68,32 @@ void Logger::set_colors(ColorsMode colors) {
     colors_ = colors;
 }
 
-void Logger::print(const char* module, LogLevel level, const char* format, ...) {
-    Mutex::Lock lock(mutex_);
+void Logger::set_async(bool enabled) {
+    {
+        Mutex::Lock lock(mutex_);
 
-    if (level > level_ || level == LogNone) {
+        if (enabled && !started_) {
+            if (!async_thread_.start()) {
+                fprintf(stderr,
+                        "can't start logger thread, using synchronous logging\n");
+                return;
+            }
+            started_ = true;
+        }
+
+        async_ = enabled;
+    }
+
+    if (!enabled) {
+        // deliver what's already in the ring before returning to the
+        // synchronous mode
+        drain_();
+    }
+}
+
+void Logger::print(const char* module, LogLevel level, const char* format, ...) {
+    // lock-free level filter, so that filtered-out messages are almost free
+    if (level == LogNone || level > (LogLevel)level_.load_relaxed()) {
         return;
     }
 
@@ -69,6 +105,19 @@ void Logger::print(const char* module, LogLevel level, const char* format, ...)
     }
     va_end(args);
 
+    if (async_.load_acquire()) {
+        if (!enqueue_(level, module, message)) {
+            n_dropped_.incr_relaxed();
+        }
+        return;
+    }
+
+    Mutex::Lock lock(mutex_);
+
+    output_(level, module, message);
+}
+
+void Logger::output_(LogLevel level, const char* module, const char* message) {
     if (handler_) {
         handler_(level, module, message);
     } else {
@@ -113,5 +162,127 @@ void Logger::print(const char* module, LogLevel level, const char* format, ...)
     }
 }
 
+// Bounded multi-producer ring; each slot carries a sequence number which
+// tells whether the slot is free for the producer at the given position
+// (seq == pos), or filled and not yet consumed. Producers race for a
+// position with CAS; the logger thread is the only consumer.
+bool Logger::enqueue_(LogLevel level, const char* module, const char* message) {
+    long pos = enqueue_pos_.load_relaxed();
+
+    Record* rec;
+
+    for (;;) {
+        rec = &ring_[(unsigned long)pos % RingSize];
+
+        const long seq = rec->seq.load_acquire();
+
+        if (seq == pos) {
+            if (enqueue_pos_.cas(pos, pos + 1)) {
+                break;
+            }
+            pos = enqueue_pos_.load_relaxed();
+        } else if (seq < pos) {
+            // the consumer didn't free the slot yet, the ring is full
+            return false;
+        } else {
+            pos = enqueue_pos_.load_relaxed();
+        }
+    }
+
+    rec->level = level;
+    rec->module = module;
+
+    strncpy(rec->message, message, sizeof(rec->message) - 1);
+    rec->message[sizeof(rec->message) - 1] = '\0';
+
+    // make the record visible to the consumer
+    rec->seq.store_release(pos + 1);
+
+    return true;
+}
+
+bool Logger::dequeue_(Record& out) {
+    Record* rec = &ring_[(unsigned long)dequeue_pos_ % RingSize];
+
+    const long seq = rec->seq.load_acquire();
+
+    if (seq != dequeue_pos_ + 1) {
+        return false;
+    }
+
+    out.level = rec->level;
+    out.module = rec->module;
+
+    strncpy(out.message, rec->message, sizeof(out.message) - 1);
+    out.message[sizeof(out.message) - 1] = '\0';
+
+    // free the slot for the producer that will wrap around to it
+    rec->seq.store_release(dequeue_pos_ + RingSize);
+    dequeue_pos_++;
+
+    return true;
+}
+
+// The mutex serializes consumers: normally the logger thread is the only
+// one, but set_async(false) drains the ring synchronously too.
+void Logger::drain_() {
+    Mutex::Lock lock(mutex_);
+
+    Record rec;
+
+    while (dequeue_(rec)) {
+        output_(rec.level, rec.module, rec.message);
+    }
+
+    long n_dropped = n_dropped_.load_relaxed();
+    while (n_dropped != 0 && !n_dropped_.cas(n_dropped, 0)) {
+        n_dropped = n_dropped_.load_relaxed();
+    }
+
+    if (n_dropped != 0) {
+        char message[64] = {};
+        snprintf(message, sizeof(message) - 1, "dropped %ld messages", n_dropped);
+
+        output_(LogError, ROC_STRINGIZE(ROC_MODULE), message);
+    }
+}
+
+void Logger::async_loop_() {
+    enum { PollIntervalNs = 10 * Millisecond };
+
+    for (;;) {
+        drain_();
+
+        Mutex::Lock lock(mutex_);
+        if (stop_) {
+            break;
+        }
+
+        // producers never touch the mutex or the condition variable, so
+        // the thread polls the ring instead of being signaled
+        (void)async_cond_.timed_wait(PollIntervalNs);
+    }
+}
+
+void Logger::stop_thread_() {
+    {
+        Mutex::Lock lock(mutex_);
+
+        if (!started_) {
+            return;
+        }
+
+        async_ = false;
+        stop_ = true;
+        async_cond_.broadcast();
+    }
+
+    async_thread_.join();
+    drain_();
+
+    started_ = false;
+    stop_ = false;
+}
+
 } // namespace core
 } // namespace roc
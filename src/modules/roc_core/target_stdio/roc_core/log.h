@@ -12,10 +12,13 @@
 #ifndef ROC_CORE_LOG_H_
 #define ROC_CORE_LOG_H_
 
+#include "roc_core/atomic.h"
 #include "roc_core/attributes.h"
+#include "roc_core/cond.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/singleton.h"
+#include "roc_core/thread.h"
 
 #ifndef ROC_MODULE
 #error "ROC_MODULE not defined"
@@ -90,16 +93,77 @@ public:
     //!  Default colors mode is ColorsAuto.
     void set_colors(ColorsMode mode);
 
+    //! Enable or disable asynchronous logging.
+    //!
+    //! @remarks
+    //!  In asynchronous mode the calling thread only formats the message and
+    //!  appends a fixed-size record to a lock-free ring, and a dedicated
+    //!  logger thread performs timestamping and I/O, so that verbose logging
+    //!  doesn't block real-time threads. If the ring is full, messages are
+    //!  dropped and the number of dropped messages is reported.
+    //!
+    //! @note
+    //!  Default mode is synchronous. A message logged concurrently with
+    //!  disabling asynchronous mode may be delayed until the mode is
+    //!  enabled again.
+    void set_async(bool enabled);
+
 private:
     friend class Singleton<Logger>;
 
+    class AsyncThread : public Thread {
+    public:
+        explicit AsyncThread(Logger& logger)
+            : logger_(logger) {
+        }
+
+    private:
+        virtual void run() {
+            logger_.async_loop_();
+        }
+
+        Logger& logger_;
+    };
+
+    friend class AsyncThread;
+
+    enum { RingSize = 128, MaxMessage = 256 };
+
+    struct Record {
+        Atomic seq;
+        LogLevel level;
+        const char* module;
+        char message[MaxMessage];
+    };
+
     Logger();
+    ~Logger();
+
+    bool enqueue_(LogLevel level, const char* module, const char* message);
+    bool dequeue_(Record& rec);
+
+    void async_loop_();
+    void drain_();
+    void stop_thread_();
+
+    void output_(LogLevel level, const char* module, const char* message);
 
     Mutex mutex_;
+    Cond async_cond_;
 
-    LogLevel level_;
+    Atomic level_;
     LogHandler handler_;
     ColorsMode colors_;
+
+    AsyncThread async_thread_;
+    Atomic async_;
+    bool started_;
+    bool stop_;
+
+    Record ring_[RingSize];
+    Atomic enqueue_pos_;
+    long dequeue_pos_;
+    Atomic n_dropped_;
 };
 
 } // namespace core
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/thread_pool.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace core {
+
+ThreadPool::Task::Task()
+    : next_(NULL)
+    , prev_(NULL)
+    , done_(true) {
+}
+
+ThreadPool::Task::~Task() {
+    if (!done_) {
+        roc_panic("thread pool: attempting to destroy task before it completed");
+    }
+}
+
+ThreadPool::Worker::Worker(ThreadPool& pool)
+    : pool_(pool)
+    , deque_head_(NULL)
+    , deque_tail_(NULL) {
+}
+
+void ThreadPool::Worker::run() {
+    pool_.work_(*this);
+
+    roc_log(LogDebug, "thread pool: worker thread consumed %lld ms of cpu time",
+            (long long)(thread_cputime() / Millisecond));
+}
+
+ThreadPool::ThreadPool(IAllocator& allocator, size_t n_threads)
+    : allocator_(allocator)
+    , task_cond_(mutex_)
+    , done_cond_(mutex_)
+    , n_pending_(0)
+    , rr_worker_(0)
+    , stop_(false)
+    , valid_(false) {
+    if (n_threads == 0) {
+        roc_panic("thread pool: number of threads is zero");
+    }
+
+    roc_log(LogDebug, "thread pool: initializing: n_threads=%lu",
+            (unsigned long)n_threads);
+
+    // All workers are added to the list before any thread is started,
+    // since worker threads traverse the list when stealing tasks.
+    for (size_t n = 0; n < n_threads; n++) {
+        Worker* worker = new (allocator_) Worker(*this);
+        if (!worker) {
+            roc_log(LogError, "thread pool: can't allocate worker");
+            return;
+        }
+
+        workers_.push_back(*worker);
+    }
+
+    for (Worker* worker = workers_.front(); worker; worker = workers_.nextof(*worker)) {
+        if (!worker->start()) {
+            roc_log(LogError, "thread pool: can't start worker thread");
+            return;
+        }
+    }
+
+    valid_ = true;
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        Mutex::Lock lock(mutex_);
+        stop_ = true;
+        task_cond_.broadcast();
+    }
+
+    // All workers are joined before any is removed from the list,
+    // since worker threads traverse the list when stealing tasks.
+    for (Worker* worker = workers_.front(); worker; worker = workers_.nextof(*worker)) {
+        worker->join();
+    }
+
+    while (Worker* worker = workers_.front()) {
+        workers_.remove(*worker);
+        allocator_.destroy(*worker);
+    }
+
+    if (n_pending_ != 0) {
+        roc_panic("thread pool: detected pending tasks in destructor");
+    }
+}
+
+bool ThreadPool::valid() const {
+    return valid_;
+}
+
+size_t ThreadPool::num_threads() const {
+    return workers_.size();
+}
+
+void ThreadPool::schedule(Task& task) {
+    Worker* worker = NULL;
+
+    {
+        Mutex::Lock lock(mutex_);
+
+        if (stop_) {
+            roc_panic("thread pool: attempting to schedule task during destruction");
+        }
+
+        if (!task.done_) {
+            roc_panic(
+                "thread pool: attempting to schedule task that is already scheduled");
+        }
+
+        if (workers_.size() == 0) {
+            roc_panic("thread pool: attempting to schedule task on invalid pool");
+        }
+
+        task.done_ = false;
+
+        // round-robin across worker deques
+        size_t n = rr_worker_++ % workers_.size();
+        worker = workers_.front();
+        while (n--) {
+            worker = workers_.nextof(*worker);
+        }
+    }
+
+    {
+        SpinMutex::Lock lock(worker->deque_mutex_);
+        deque_push_back_(*worker, task);
+    }
+
+    // The pending counter is incremented strictly after the task was pushed
+    // to a deque, and a worker starts searching the deques strictly after it
+    // decremented the counter, so every awoken worker is guaranteed to find
+    // a task.
+    {
+        Mutex::Lock lock(mutex_);
+        n_pending_++;
+        task_cond_.signal();
+    }
+}
+
+void ThreadPool::wait(Task& task) {
+    Mutex::Lock lock(mutex_);
+
+    while (!task.done_) {
+        done_cond_.wait();
+    }
+}
+
+void ThreadPool::work_(Worker& self) {
+    for (;;) {
+        {
+            Mutex::Lock lock(mutex_);
+
+            while (n_pending_ == 0 && !stop_) {
+                task_cond_.wait();
+            }
+
+            if (n_pending_ == 0) {
+                return;
+            }
+
+            n_pending_--;
+        }
+
+        Task* task = take_task_(self);
+
+        task->run();
+
+        {
+            Mutex::Lock lock(mutex_);
+            task->done_ = true;
+            done_cond_.broadcast();
+        }
+    }
+}
+
+ThreadPool::Task* ThreadPool::take_task_(Worker& self) {
+    // Since the pending counter is never incremented above the number of
+    // tasks residing in the deques and never decremented below the number
+    // of workers currently searching, the search always succeeds, though
+    // a concurrent steal may force another pass.
+    for (;;) {
+        {
+            SpinMutex::Lock lock(self.deque_mutex_);
+
+            // Newest own task first: it is the most cache-hot one.
+            if (Task* task = deque_pop_back_(self)) {
+                return task;
+            }
+        }
+
+        for (Worker* victim = workers_.front(); victim;
+             victim = workers_.nextof(*victim)) {
+            if (victim == &self) {
+                continue;
+            }
+
+            SpinMutex::Lock lock(victim->deque_mutex_);
+
+            // Steal the oldest task: the victim is the least likely to
+            // have it cache-hot.
+            if (Task* task = deque_pop_front_(*victim)) {
+                return task;
+            }
+        }
+    }
+}
+
+void ThreadPool::deque_push_back_(Worker& worker, Task& task) {
+    task.next_ = NULL;
+    task.prev_ = worker.deque_tail_;
+
+    if (worker.deque_tail_) {
+        worker.deque_tail_->next_ = &task;
+    } else {
+        worker.deque_head_ = &task;
+    }
+    worker.deque_tail_ = &task;
+}
+
+ThreadPool::Task* ThreadPool::deque_pop_back_(Worker& worker) {
+    Task* task = worker.deque_tail_;
+    if (!task) {
+        return NULL;
+    }
+
+    worker.deque_tail_ = task->prev_;
+    if (worker.deque_tail_) {
+        worker.deque_tail_->next_ = NULL;
+    } else {
+        worker.deque_head_ = NULL;
+    }
+
+    task->next_ = task->prev_ = NULL;
+    return task;
+}
+
+ThreadPool::Task* ThreadPool::deque_pop_front_(Worker& worker) {
+    Task* task = worker.deque_head_;
+    if (!task) {
+        return NULL;
+    }
+
+    worker.deque_head_ = task->next_;
+    if (worker.deque_head_) {
+        worker.deque_head_->prev_ = NULL;
+    } else {
+        worker.deque_tail_ = NULL;
+    }
+
+    task->next_ = task->prev_ = NULL;
+    return task;
+}
+
+} // namespace core
+} // namespace roc
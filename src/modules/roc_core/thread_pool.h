@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/thread_pool.h
+//! @brief Thread pool.
+
+#ifndef ROC_CORE_THREAD_POOL_H_
+#define ROC_CORE_THREAD_POOL_H_
+
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/spin_mutex.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+//! Thread pool.
+//!
+//! Executes scheduled tasks on a fixed set of worker threads. Intended for
+//! fork-join usage: the caller schedules a batch of independent tasks and
+//! then waits for every task of the batch.
+//!
+//! Tasks are distributed round-robin across per-worker deques. A worker
+//! pops the most recently scheduled task of its own deque, and when the
+//! deque is empty it steals the oldest task from another worker, so a
+//! burst of tasks scheduled to one worker is spread over all idle ones.
+class ThreadPool : public NonCopyable<> {
+public:
+    //! Base class for tasks executed on the pool.
+    //! @remarks
+    //!  A task may be scheduled again after the previous run completed.
+    class Task {
+    public:
+        Task();
+        virtual ~Task();
+
+    private:
+        friend class ThreadPool;
+
+        //! Task body, executed on one of the worker threads.
+        virtual void run() = 0;
+
+        Task* next_;
+        Task* prev_;
+        bool done_;
+    };
+
+    //! Initialize and start worker threads.
+    //!
+    //! @b Parameters
+    //!  - @p allocator is used to allocate workers
+    //!  - @p n_threads defines the number of worker threads
+    ThreadPool(IAllocator& allocator, size_t n_threads);
+
+    //! Stop and join worker threads.
+    ~ThreadPool();
+
+    //! Check if all worker threads were successfully started.
+    bool valid() const;
+
+    //! Get number of worker threads.
+    size_t num_threads() const;
+
+    //! Schedule task for execution.
+    //! @remarks
+    //!  The task is executed on one of the worker threads. It may not be
+    //!  scheduled again or destroyed until wait() returns.
+    void schedule(Task& task);
+
+    //! Wait until a scheduled task completes.
+    void wait(Task& task);
+
+private:
+    class Worker : public Thread, public ListNode {
+    public:
+        explicit Worker(ThreadPool& pool);
+
+    private:
+        friend class ThreadPool;
+
+        virtual void run();
+
+        ThreadPool& pool_;
+
+        SpinMutex deque_mutex_;
+        Task* deque_head_;
+        Task* deque_tail_;
+    };
+
+    void work_(Worker& self);
+    Task* take_task_(Worker& self);
+
+    static void deque_push_back_(Worker& worker, Task& task);
+    static Task* deque_pop_back_(Worker& worker);
+    static Task* deque_pop_front_(Worker& worker);
+
+    IAllocator& allocator_;
+
+    List<Worker, NoOwnership> workers_;
+
+    Mutex mutex_;
+    Cond task_cond_;
+    Cond done_cond_;
+
+    size_t n_pending_;
+    size_t rr_worker_;
+
+    bool stop_;
+    bool valid_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_THREAD_POOL_H_
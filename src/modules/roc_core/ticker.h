@@ -20,6 +20,12 @@ namespace roc {
 namespace core {
 
 //! Ticker.
+//!
+//! Paces the caller to a fixed tick frequency. Every deadline is computed
+//! from the start time with exact integer arithmetic and passed to
+//! sleep_until(), which waits for an absolute time point (TIMER_ABSTIME
+//! on POSIX), so neither wakeup latency nor rounding accumulates into
+//! drift: an oversleep on one tick is absorbed by the next one.
 class Ticker : public NonCopyable<> {
 public:
     //! Number of ticks.
@@ -29,9 +35,12 @@ public:
     //! @remarks
     //!  @p freq defines the number of ticks per second.
     explicit Ticker(Ticks freq)
-        : ratio_(double(freq) / Second)
+        : freq_(freq)
         , start_(0)
         , started_(false) {
+        if (freq == 0) {
+            roc_panic("ticker: frequency can't be zero");
+        }
     }
 
     //! Start ticker.
@@ -50,7 +59,21 @@ public:
             start();
             return 0;
         } else {
-            return Ticks(double(timestamp() - start_) * ratio_);
+            return ns_to_ticks_(nanoseconds_t(timestamp() - start_));
+        }
+    }
+
+    //! Returns number of ticks elapsed at the given time point.
+    //! @remarks
+    //!  Same as elapsed(), but uses a clock value sampled by the caller
+    //!  instead of reading the clock again.
+    Ticks elapsed(nanoseconds_t now) {
+        if (!started_) {
+            start_ = now;
+            started_ = true;
+            return 0;
+        } else {
+            return ns_to_ticks_(nanoseconds_t(now - start_));
         }
     }
 
@@ -60,11 +83,24 @@ public:
         if (!started_) {
             start();
         }
-        sleep_until(start_ + nanoseconds_t(ticks / ratio_));
+        sleep_until(start_ + ticks_to_ns_(ticks));
     }
 
 private:
-    const double ratio_;
+    // the second and sub-second parts are converted separately, so that
+    // the intermediate products can't overflow and the conversion error
+    // stays below one nanosecond no matter how long the ticker runs
+    nanoseconds_t ticks_to_ns_(Ticks ticks) const {
+        return nanoseconds_t(ticks / freq_ * uint64_t(Second)
+                             + ticks % freq_ * uint64_t(Second) / freq_);
+    }
+
+    Ticks ns_to_ticks_(nanoseconds_t ns) const {
+        return Ticks(uint64_t(ns) / uint64_t(Second) * freq_
+                     + uint64_t(ns) % uint64_t(Second) * freq_ / uint64_t(Second));
+    }
+
+    const Ticks freq_;
     nanoseconds_t start_;
     bool started_;
 };
@@ -41,6 +41,13 @@ const nanoseconds_t Hour = 60 * Minute;
 //! Get current timestamp in nanoseconds.
 nanoseconds_t timestamp();
 
+//! Get CPU time consumed by the calling thread, in nanoseconds.
+//! @remarks
+//!  Unlike timestamp(), doesn't advance while the thread is sleeping or
+//!  preempted, so deltas measure actual CPU cost. Falls back to wall
+//!  clock time on platforms without a per-thread CPU clock.
+nanoseconds_t thread_cputime();
+
 //! Sleep until the specified absolute time point has been reached.
 //! @remarks
 //!  @p timestamp specifies absolute time point in nanoseconds.
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/timer_wheel.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace core {
+
+TimerWheel::TimerWheel(uint64_t start_time)
+    : time_(start_time) {
+}
+
+uint64_t TimerWheel::time() const {
+    return time_;
+}
+
+void TimerWheel::schedule(Timer& timer, uint64_t deadline) {
+    if (timer.slot_) {
+        cancel(timer);
+    }
+
+    timer.deadline_ = deadline;
+
+    if (deadline <= time_) {
+        expired_.push_back(timer);
+        timer.slot_ = &expired_;
+        return;
+    }
+
+    insert_(timer);
+}
+
+void TimerWheel::cancel(Timer& timer) {
+    if (!timer.slot_) {
+        return;
+    }
+
+    timer.slot_->remove(timer);
+    timer.slot_ = NULL;
+}
+
+void TimerWheel::advance(uint64_t now) {
+    if (now < time_) {
+        roc_panic("timer wheel: attempt to advance time backwards:"
+                  " time=%llu now=%llu",
+                  (unsigned long long)time_, (unsigned long long)now);
+    }
+
+    while (time_ < now) {
+        time_++;
+
+        // when the lowest levels wrap around, pull the timers parked at the
+        // upper levels down into their exact slots
+        for (size_t level = 1; level < NumLevels; level++) {
+            if ((time_ & ((uint64_t(1) << (SlotBits * level)) - 1)) != 0) {
+                break;
+            }
+            cascade_(level, size_t(time_ >> (SlotBits * level)) & (NumSlots - 1));
+        }
+
+        List<Timer, NoOwnership>& slot = slots_[0][time_ & (NumSlots - 1)];
+
+        while (Timer* timer = slot.front()) {
+            slot.remove(*timer);
+
+            expired_.push_back(*timer);
+            timer->slot_ = &expired_;
+        }
+    }
+}
+
+TimerWheel::Timer* TimerWheel::next_expired() {
+    Timer* timer = expired_.front();
+    if (!timer) {
+        return NULL;
+    }
+
+    expired_.remove(*timer);
+    timer->slot_ = NULL;
+
+    return timer;
+}
+
+void TimerWheel::insert_(Timer& timer) {
+    const uint64_t delta = timer.deadline_ - time_;
+
+    // slot index is taken from the deadline bits of the level whose range
+    // covers the delta, so that the timer is reached exactly when the lower
+    // levels wrap around to its position
+    uint64_t target = timer.deadline_;
+
+    size_t level = 0;
+    while (delta >= (uint64_t(1) << (SlotBits * (level + 1)))) {
+        if (level == NumLevels - 1) {
+            // beyond the wheel horizon; park as far away as possible and
+            // let the cascades re-insert it until it comes into range
+            target = time_ + ((uint64_t(1) << (SlotBits * NumLevels)) - 1);
+            break;
+        }
+        level++;
+    }
+
+    List<Timer, NoOwnership>& slot =
+        slots_[level][size_t(target >> (SlotBits * level)) & (NumSlots - 1)];
+
+    slot.push_back(timer);
+    timer.slot_ = &slot;
+}
+
+void TimerWheel::cascade_(size_t level, size_t slot_index) {
+    List<Timer, NoOwnership>& slot = slots_[level][slot_index];
+
+    while (Timer* timer = slot.front()) {
+        slot.remove(*timer);
+        timer->slot_ = NULL;
+
+        if (timer->deadline_ <= time_) {
+            expired_.push_back(*timer);
+            timer->slot_ = &expired_;
+        } else {
+            insert_(*timer);
+        }
+    }
+}
+
+} // namespace core
+} // namespace roc
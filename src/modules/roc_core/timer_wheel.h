@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/timer_wheel.h
+//! @brief Hierarchical timer wheel.
+
+#ifndef ROC_CORE_TIMER_WHEEL_H_
+#define ROC_CORE_TIMER_WHEEL_H_
+
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/ownership.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! Hierarchical timer wheel.
+//!
+//! Keeps a set of timers scheduled for abstract deadlines and reports the
+//! expired ones as time advances. The time unit is up to the user; the wheel
+//! only requires it to be monotonically increasing.
+//!
+//! Scheduling and cancelling a timer is O(1). Advancing the wheel is O(1)
+//! per tick plus O(1) amortized per scheduled timer, independently of the
+//! number of timers, which makes the wheel suitable for keeping one rarely
+//! firing deadline per session with per-tick costs that don't grow with the
+//! session count.
+//!
+//! Should not be used concurrently.
+class TimerWheel : public NonCopyable<> {
+public:
+    //! Timer that can be scheduled in a wheel.
+    //! @remarks
+    //!  The timer is intrusive; it should stay alive while it's scheduled
+    //!  and should be cancelled before destruction.
+    class Timer : public ListNode {
+    public:
+        Timer()
+            : deadline_(0)
+            , slot_(NULL)
+            , data_(NULL) {
+        }
+
+        //! Get the deadline passed to the last schedule() call.
+        uint64_t deadline() const {
+            return deadline_;
+        }
+
+        //! Check if the timer is scheduled and didn't expire yet.
+        bool scheduled() const {
+            return slot_ != NULL;
+        }
+
+        //! Get opaque user data.
+        void* data() const {
+            return data_;
+        }
+
+        //! Set opaque user data.
+        void set_data(void* data) {
+            data_ = data;
+        }
+
+    private:
+        friend class TimerWheel;
+
+        uint64_t deadline_;
+        List<Timer, NoOwnership>* slot_;
+        void* data_;
+    };
+
+    //! Initialize empty wheel starting at the given time.
+    explicit TimerWheel(uint64_t start_time = 0);
+
+    //! Get current wheel time.
+    uint64_t time() const;
+
+    //! Schedule timer to expire at the given deadline.
+    //! @remarks
+    //!  If the timer is already scheduled, it's rescheduled. A deadline
+    //!  in the past expires at the next advance() call.
+    void schedule(Timer& timer, uint64_t deadline);
+
+    //! Remove timer from the wheel.
+    //! @remarks
+    //!  No-op if the timer is not scheduled.
+    void cancel(Timer& timer);
+
+    //! Advance wheel time.
+    //! @remarks
+    //!  Timers whose deadline is reached are collected and may be fetched
+    //!  with next_expired(). @p now should not be less than time().
+    void advance(uint64_t now);
+
+    //! Fetch one expired timer.
+    //! @returns
+    //!  an expired and not yet fetched timer, or NULL if there are none.
+    Timer* next_expired();
+
+private:
+    enum {
+        // Each level covers SlotBits more bits of the deadline; four levels
+        // of 64 slots cover deadlines up to 2^24 ticks ahead, and timers
+        // beyond that horizon are parked in the top level and re-inserted
+        // on cascade until they come into range.
+        SlotBits = 6,
+        NumSlots = 1 << SlotBits,
+        NumLevels = 4
+    };
+
+    void insert_(Timer& timer);
+    void cascade_(size_t level, size_t slot);
+
+    uint64_t time_;
+
+    List<Timer, NoOwnership> slots_[NumLevels][NumSlots];
+    List<Timer, NoOwnership> expired_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_TIMER_WHEEL_H_
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/trace.h
+//! @brief Static tracepoints.
+
+#ifndef ROC_CORE_TRACE_H_
+#define ROC_CORE_TRACE_H_
+
+//! @name Static tracepoints
+//!
+//! Lightweight USDT tracepoints for the "roc" provider, available when
+//! <sys/sdt.h> is present (systemtap-sdt-dev package on Linux). External
+//! tracers like bpftrace and perf can attach to them on a live process,
+//! e.g. to build per-stage latency distributions from begin/end probe
+//! pairs on the pipeline hot path.
+//!
+//! An untraced probe compiles to a single nop instruction and the payload
+//! arguments are not evaluated, so tracepoints are free in steady state.
+//! Probes may be disabled entirely by defining ROC_TRACE_DISABLE.
+//! @{
+
+#ifndef ROC_TRACE_DISABLE
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define ROC_TRACE_SDT 1
+#endif
+#endif
+#endif
+
+#ifdef ROC_TRACE_SDT
+
+#include <sys/sdt.h>
+
+//! Emit tracepoint with no payload.
+#define ROC_TRACE(name) DTRACE_PROBE(roc, name)
+
+//! Emit tracepoint with one payload argument.
+#define ROC_TRACE1(name, a0) DTRACE_PROBE1(roc, name, a0)
+
+//! Emit tracepoint with two payload arguments.
+#define ROC_TRACE2(name, a0, a1) DTRACE_PROBE2(roc, name, a0, a1)
+
+//! Emit tracepoint with three payload arguments.
+#define ROC_TRACE3(name, a0, a1, a2) DTRACE_PROBE3(roc, name, a0, a1, a2)
+
+#else // !ROC_TRACE_SDT
+
+// sizeof() silences unused variable warnings without evaluating the payload
+
+//! Emit tracepoint with no payload.
+#define ROC_TRACE(name) ((void)0)
+
+//! Emit tracepoint with one payload argument.
+#define ROC_TRACE1(name, a0) ((void)sizeof(a0))
+
+//! Emit tracepoint with two payload arguments.
+#define ROC_TRACE2(name, a0, a1) ((void)sizeof(a0), (void)sizeof(a1))
+
+//! Emit tracepoint with three payload arguments.
+#define ROC_TRACE3(name, a0, a1, a2)                                                     \
+    ((void)sizeof(a0), (void)sizeof(a1), (void)sizeof(a2))
+
+#endif // !ROC_TRACE_SDT
+
+//! @}
+
+#endif // ROC_CORE_TRACE_H_
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_core/view.h
+//! @brief View.
+
+#ifndef ROC_CORE_VIEW_H_
+#define ROC_CORE_VIEW_H_
+
+#include "roc_core/panic.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace core {
+
+//! View.
+//!
+//! A non-owning counterpart of Slice: a pointer plus a length, without a
+//! reference to the underlying Buffer. Copying a View is free, while
+//! every Slice copy increments and decrements the buffer reference
+//! counter. Use View for stack-scoped passing of data down call chains
+//! whose lifetime is bounded by an enclosing Slice or packet; keep Slice
+//! at storage boundaries, where the data should stay alive after the
+//! caller returns.
+template <class T> class View {
+public:
+    //! Construct empty view.
+    View()
+        : data_(NULL)
+        , size_(0) {
+    }
+
+    //! Construct view pointing to a memory region.
+    View(T* data, size_t size)
+        : data_(data)
+        , size_(size) {
+    }
+
+    //! Construct view pointing to slice contents.
+    //! @remarks
+    //!  The view doesn't hold a buffer reference; the caller should
+    //!  ensure that the slice or its buffer outlives the view.
+    View(const Slice<T>& slice)
+        : data_(NULL)
+        , size_(0) {
+        if (slice) {
+            data_ = slice.data();
+            size_ = slice.size();
+        }
+    }
+
+    //! Get view data.
+    T* data() const {
+        if (data_ == NULL) {
+            roc_panic("view: null view");
+        }
+        return data_;
+    }
+
+    //! Get number of elements in view.
+    size_t size() const {
+        return size_;
+    }
+
+    //! Construct a view pointing to a part of this view.
+    View range(size_t from, size_t to) const {
+        if (from > to) {
+            roc_panic("view: invalid range: [%lu,%lu)", (unsigned long)from,
+                      (unsigned long)to);
+        }
+        if (to > size_) {
+            roc_panic("view: out of bounds: available=[%lu,%lu), requested=[%lu,%lu)",
+                      (unsigned long)0, (unsigned long)size_, (unsigned long)from,
+                      (unsigned long)to);
+        }
+        return View(data_ + from, to - from);
+    }
+
+    //! Convert to bool.
+    //! @returns
+    //!  true if the view is attached to memory, even if it has zero length.
+    operator const struct unspecified_bool*() const {
+        return (const unspecified_bool*)data_;
+    }
+
+private:
+    T* data_;
+    size_t size_;
+};
+
+} // namespace core
+} // namespace roc
+
+#endif // ROC_CORE_VIEW_H_
@@ -13,16 +13,38 @@
 #define ROC_FEC_CODEC_CONFIG_H_
 
 #include "roc_core/stddefs.h"
+#include "roc_core/time.h"
 #include "roc_packet/fec.h"
 
 namespace roc {
 namespace fec {
 
+//! FEC codec backend.
+enum CodecBackend {
+    //! Select the default backend for the scheme.
+    CodecBackendDefault,
+
+    //! OpenFEC library.
+    CodecBackendOpenFEC,
+
+    //! Built-in SIMD Reed-Solomon codec.
+    CodecBackendRs8m,
+
+    //! Built-in single-parity XOR codec.
+    CodecBackendXor,
+
+    //! Built-in sliding-window RLC codec.
+    CodecBackendRlc
+};
+
 //! FEC codec parameters.
 struct CodecConfig {
     //! FEC scheme.
     packet::FECScheme scheme;
 
+    //! FEC codec backend.
+    CodecBackend backend;
+
     //! Seed for LDPC scheme.
     int32_t ldpc_prng_seed;
 
@@ -32,11 +54,21 @@ struct CodecConfig {
     //! Configuration for ReedSolomon scheme.
     uint16_t rs_m;
 
+    //! Maximum time a decoder may spend repairing a block within a single
+    //! call, or zero for no limit. Decoding cost of non-optimal codecs
+    //! (LDPC-Staircase) varies wildly with the loss pattern; when the budget
+    //! is exhausted, the decoder yields and resumes on the next call, so
+    //! that a pathological block can't stall the read path past the frame
+    //! deadline. Should be set below the pipeline frame budget.
+    core::nanoseconds_t decode_budget;
+
     CodecConfig()
         : scheme(packet::FEC_None)
+        , backend(CodecBackendDefault)
         , ldpc_prng_seed(1297501556)
         , ldpc_N1(7)
-        , rs_m(8) {
+        , rs_m(8)
+        , decode_budget(5 * core::Millisecond) {
     }
 };
 
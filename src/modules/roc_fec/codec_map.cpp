@@ -13,6 +13,13 @@
 #include "roc_core/unique_ptr.h"
 #include "roc_packet/fec_scheme_to_str.h"
 
+#include "roc_fec/rlc_decoder.h"
+#include "roc_fec/rlc_encoder.h"
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_fec/rs8m_encoder.h"
+#include "roc_fec/xor_decoder.h"
+#include "roc_fec/xor_encoder.h"
+
 #ifdef ROC_TARGET_OPENFEC
 #include "roc_fec/of_decoder.h"
 #include "roc_fec/of_encoder.h"
@@ -41,6 +48,7 @@ CodecMap::CodecMap()
 #ifdef ROC_TARGET_OPENFEC
     {
         Codec codec;
+        codec.backend = CodecBackendOpenFEC;
         codec.encoder_ctor = ctor_func<IBlockEncoder, OFEncoder>;
         codec.decoder_ctor = ctor_func<IBlockDecoder, OFDecoder>;
 
@@ -51,12 +59,42 @@ CodecMap::CodecMap()
         add_codec_(codec);
     }
 #endif // ROC_TARGET_OPENFEC
+
+    {
+        Codec codec;
+        codec.backend = CodecBackendRs8m;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, Rs8mEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, Rs8mDecoder>;
+
+        codec.scheme = packet::FEC_ReedSolomon_M8;
+        add_codec_(codec);
+    }
+
+    {
+        Codec codec;
+        codec.backend = CodecBackendXor;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, XorEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, XorDecoder>;
+
+        codec.scheme = packet::FEC_XOR;
+        add_codec_(codec);
+    }
+
+    {
+        Codec codec;
+        codec.backend = CodecBackendRlc;
+        codec.encoder_ctor = ctor_func<IBlockEncoder, RlcEncoder>;
+        codec.decoder_ctor = ctor_func<IBlockDecoder, RlcDecoder>;
+
+        codec.scheme = packet::FEC_RLC;
+        add_codec_(codec);
+    }
 }
 
 IBlockEncoder* CodecMap::new_encoder(const CodecConfig& config,
                                      core::BufferPool<uint8_t>& pool,
                                      core::IAllocator& allocator) const {
-    const Codec* codec = find_codec_(config.scheme);
+    const Codec* codec = find_codec_(config.scheme, config.backend);
     if (!codec) {
         return NULL;
     }
@@ -66,7 +104,7 @@ IBlockEncoder* CodecMap::new_encoder(const CodecConfig& config,
 IBlockDecoder* CodecMap::new_decoder(const CodecConfig& config,
                                      core::BufferPool<uint8_t>& pool,
                                      core::IAllocator& allocator) const {
-    const Codec* codec = find_codec_(config.scheme);
+    const Codec* codec = find_codec_(config.scheme, config.backend);
     if (!codec) {
         return NULL;
     }
@@ -78,11 +116,16 @@ void CodecMap::add_codec_(const Codec& codec) {
     codecs_[n_codecs_++] = codec;
 }
 
-const CodecMap::Codec* CodecMap::find_codec_(packet::FECScheme scheme) const {
+const CodecMap::Codec* CodecMap::find_codec_(packet::FECScheme scheme,
+                                             CodecBackend backend) const {
     for (size_t n = 0; n < n_codecs_; n++) {
-        if (codecs_[n].scheme == scheme) {
-            return &codecs_[n];
+        if (codecs_[n].scheme != scheme) {
+            continue;
+        }
+        if (backend != CodecBackendDefault && codecs_[n].backend != backend) {
+            continue;
         }
+        return &codecs_[n];
     }
 
     roc_log(LogError, "codec map: no codec available for fec scheme '%s'",
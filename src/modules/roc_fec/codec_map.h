@@ -51,10 +51,11 @@ public:
                                core::IAllocator& allocator) const;
 
 private:
-    enum { MaxCodecs = 2 };
+    enum { MaxCodecs = 5 };
 
     struct Codec {
         packet::FECScheme scheme;
+        CodecBackend backend;
 
         IBlockEncoder* (*encoder_ctor)(const CodecConfig& config,
                                        core::BufferPool<uint8_t>& pool,
@@ -66,7 +67,7 @@ private:
     };
 
     void add_codec_(const Codec& codec);
-    const Codec* find_codec_(packet::FECScheme scheme) const;
+    const Codec* find_codec_(packet::FECScheme scheme, CodecBackend backend) const;
 
     size_t n_codecs_;
     Codec codecs_[MaxCodecs];
@@ -30,7 +30,10 @@ public:
     //!  Composes FECFRAME header or footer and passes the rest to
     //!  @p inner_composer if it's not null.
     Composer(packet::IComposer* inner_composer)
-        : inner_composer_(inner_composer) {
+        : inner_composer_(inner_composer)
+        , template_sblen_(0)
+        , template_blen_(0)
+        , template_valid_(false) {
     }
 
     //! Adjust buffer to align payload.
@@ -145,19 +148,30 @@ public:
 
         PayloadID& payload_id = *(PayloadID*)fec.payload_id.data();
 
-        payload_id.clear();
+        // the block geometry (k and n) changes at most per-session, so it's
+        // composed once into a template, and per-packet work is one copy
+        // plus patching the fields that do change: esi and sbn
+        if (!template_valid_ || template_sblen_ != fec.source_block_length
+            || template_blen_ != fec.block_length) {
+            roc_panic_if((fec.source_block_length >> 16) != 0);
+            roc_panic_if((fec.block_length >> 16) != 0);
+
+            id_template_.clear();
+            id_template_.set_k((uint16_t)fec.source_block_length);
+            id_template_.set_n((uint16_t)fec.block_length);
+
+            template_sblen_ = fec.source_block_length;
+            template_blen_ = fec.block_length;
+            template_valid_ = true;
+        }
+
+        memcpy(&payload_id, &id_template_, sizeof(PayloadID));
 
         roc_panic_if((fec.encoding_symbol_id >> 16) != 0);
         payload_id.set_esi((uint16_t)fec.encoding_symbol_id);
 
         payload_id.set_sbn(fec.source_block_number);
 
-        roc_panic_if((fec.source_block_length >> 16) != 0);
-        payload_id.set_k((uint16_t)fec.source_block_length);
-
-        roc_panic_if((fec.block_length >> 16) != 0);
-        payload_id.set_n((uint16_t)fec.block_length);
-
         if (inner_composer_) {
             return inner_composer_->compose(packet);
         }
@@ -167,6 +181,13 @@ public:
 
 private:
     packet::IComposer* inner_composer_;
+
+    // Template of the payload id part that is invariant within a session
+    // (the block geometry), composed once and reused (see compose()).
+    PayloadID id_template_;
+    size_t template_sblen_;
+    size_t template_blen_;
+    bool template_valid_;
 };
 
 } // namespace fec
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/gf256.h"
+#include "roc_core/cpu_features.h"
+#include "roc_core/panic.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define ROC_GF256_X86_64 1
+#endif
+
+#if defined(__GNUC__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ROC_GF256_NEON 1
+#endif
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+// Logarithm table for GF(2^8) with the generator element 2 and the
+// field polynomial 0x11d. gf256_log_tab[0] is a sentinel and unused.
+const uint8_t gf256_log_tab[256] = {
+    0x00, 0x00, 0x01, 0x19, 0x02, 0x32, 0x1a, 0xc6, 0x03, 0xdf, 0x33, 0xee,
+    0x1b, 0x68, 0xc7, 0x4b, 0x04, 0x64, 0xe0, 0x0e, 0x34, 0x8d, 0xef, 0x81,
+    0x1c, 0xc1, 0x69, 0xf8, 0xc8, 0x08, 0x4c, 0x71, 0x05, 0x8a, 0x65, 0x2f,
+    0xe1, 0x24, 0x0f, 0x21, 0x35, 0x93, 0x8e, 0xda, 0xf0, 0x12, 0x82, 0x45,
+    0x1d, 0xb5, 0xc2, 0x7d, 0x6a, 0x27, 0xf9, 0xb9, 0xc9, 0x9a, 0x09, 0x78,
+    0x4d, 0xe4, 0x72, 0xa6, 0x06, 0xbf, 0x8b, 0x62, 0x66, 0xdd, 0x30, 0xfd,
+    0xe2, 0x98, 0x25, 0xb3, 0x10, 0x91, 0x22, 0x88, 0x36, 0xd0, 0x94, 0xce,
+    0x8f, 0x96, 0xdb, 0xbd, 0xf1, 0xd2, 0x13, 0x5c, 0x83, 0x38, 0x46, 0x40,
+    0x1e, 0x42, 0xb6, 0xa3, 0xc3, 0x48, 0x7e, 0x6e, 0x6b, 0x3a, 0x28, 0x54,
+    0xfa, 0x85, 0xba, 0x3d, 0xca, 0x5e, 0x9b, 0x9f, 0x0a, 0x15, 0x79, 0x2b,
+    0x4e, 0xd4, 0xe5, 0xac, 0x73, 0xf3, 0xa7, 0x57, 0x07, 0x70, 0xc0, 0xf7,
+    0x8c, 0x80, 0x63, 0x0d, 0x67, 0x4a, 0xde, 0xed, 0x31, 0xc5, 0xfe, 0x18,
+    0xe3, 0xa5, 0x99, 0x77, 0x26, 0xb8, 0xb4, 0x7c, 0x11, 0x44, 0x92, 0xd9,
+    0x23, 0x20, 0x89, 0x2e, 0x37, 0x3f, 0xd1, 0x5b, 0x95, 0xbc, 0xcf, 0xcd,
+    0x90, 0x87, 0x97, 0xb2, 0xdc, 0xfc, 0xbe, 0x61, 0xf2, 0x56, 0xd3, 0xab,
+    0x14, 0x2a, 0x5d, 0x9e, 0x84, 0x3c, 0x39, 0x53, 0x47, 0x6d, 0x41, 0xa2,
+    0x1f, 0x2d, 0x43, 0xd8, 0xb7, 0x7b, 0xa4, 0x76, 0xc4, 0x17, 0x49, 0xec,
+    0x7f, 0x0c, 0x6f, 0xf6, 0x6c, 0xa1, 0x3b, 0x52, 0x29, 0x9d, 0x55, 0xaa,
+    0xfb, 0x60, 0x86, 0xb1, 0xbb, 0xcc, 0x3e, 0x5a, 0xcb, 0x59, 0x5f, 0xb0,
+    0x9c, 0xa9, 0xa0, 0x51, 0x0b, 0xf5, 0x16, 0xeb, 0x7a, 0x75, 0x2c, 0xd7,
+    0x4f, 0xae, 0xd5, 0xe9, 0xe6, 0xe7, 0xad, 0xe8, 0x74, 0xd6, 0xf4, 0xea,
+    0xa8, 0x50, 0x58, 0xaf
+};
+
+// Anti-logarithm table, doubled so that the sum of two logarithms can be
+// used as an index without a modulo reduction.
+const uint8_t gf256_exp_tab[512] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d, 0x3a, 0x74, 0xe8,
+    0xcd, 0x87, 0x13, 0x26, 0x4c, 0x98, 0x2d, 0x5a, 0xb4, 0x75, 0xea, 0xc9,
+    0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d, 0x27, 0x4e, 0x9c,
+    0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee, 0xc1, 0x9f, 0x23,
+    0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d, 0xba, 0x69, 0xd2,
+    0xb9, 0x6f, 0xde, 0xa1, 0x5f, 0xbe, 0x61, 0xc2, 0x99, 0x2f, 0x5e, 0xbc,
+    0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd, 0xe7, 0xd3, 0xbb,
+    0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b, 0xb6, 0x71, 0xe2,
+    0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d, 0x1a, 0x34, 0x68,
+    0xd0, 0xbd, 0x67, 0xce, 0x81, 0x1f, 0x3e, 0x7c, 0xf8, 0xed, 0xc7, 0x93,
+    0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85, 0x17, 0x2e, 0x5c,
+    0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84, 0x15, 0x2a, 0x54,
+    0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49, 0x92, 0x39, 0x72,
+    0xe4, 0xd5, 0xb7, 0x73, 0xe6, 0xd1, 0xbf, 0x63, 0xc6, 0x91, 0x3f, 0x7e,
+    0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3, 0xdb, 0xab, 0x4b,
+    0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5, 0x57, 0xae, 0x41,
+    0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c, 0x38, 0x70, 0xe0,
+    0xdd, 0xa7, 0x53, 0xa6, 0x51, 0xa2, 0x59, 0xb2, 0x79, 0xf2, 0xf9, 0xef,
+    0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12, 0x24, 0x48, 0x90,
+    0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb, 0x8b, 0x0b, 0x16,
+    0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b, 0x36, 0x6c, 0xd8,
+    0xad, 0x47, 0x8e, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1d,
+    0x3a, 0x74, 0xe8, 0xcd, 0x87, 0x13, 0x26, 0x4c, 0x98, 0x2d, 0x5a, 0xb4,
+    0x75, 0xea, 0xc9, 0x8f, 0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x9d,
+    0x27, 0x4e, 0x9c, 0x25, 0x4a, 0x94, 0x35, 0x6a, 0xd4, 0xb5, 0x77, 0xee,
+    0xc1, 0x9f, 0x23, 0x46, 0x8c, 0x05, 0x0a, 0x14, 0x28, 0x50, 0xa0, 0x5d,
+    0xba, 0x69, 0xd2, 0xb9, 0x6f, 0xde, 0xa1, 0x5f, 0xbe, 0x61, 0xc2, 0x99,
+    0x2f, 0x5e, 0xbc, 0x65, 0xca, 0x89, 0x0f, 0x1e, 0x3c, 0x78, 0xf0, 0xfd,
+    0xe7, 0xd3, 0xbb, 0x6b, 0xd6, 0xb1, 0x7f, 0xfe, 0xe1, 0xdf, 0xa3, 0x5b,
+    0xb6, 0x71, 0xe2, 0xd9, 0xaf, 0x43, 0x86, 0x11, 0x22, 0x44, 0x88, 0x0d,
+    0x1a, 0x34, 0x68, 0xd0, 0xbd, 0x67, 0xce, 0x81, 0x1f, 0x3e, 0x7c, 0xf8,
+    0xed, 0xc7, 0x93, 0x3b, 0x76, 0xec, 0xc5, 0x97, 0x33, 0x66, 0xcc, 0x85,
+    0x17, 0x2e, 0x5c, 0xb8, 0x6d, 0xda, 0xa9, 0x4f, 0x9e, 0x21, 0x42, 0x84,
+    0x15, 0x2a, 0x54, 0xa8, 0x4d, 0x9a, 0x29, 0x52, 0xa4, 0x55, 0xaa, 0x49,
+    0x92, 0x39, 0x72, 0xe4, 0xd5, 0xb7, 0x73, 0xe6, 0xd1, 0xbf, 0x63, 0xc6,
+    0x91, 0x3f, 0x7e, 0xfc, 0xe5, 0xd7, 0xb3, 0x7b, 0xf6, 0xf1, 0xff, 0xe3,
+    0xdb, 0xab, 0x4b, 0x96, 0x31, 0x62, 0xc4, 0x95, 0x37, 0x6e, 0xdc, 0xa5,
+    0x57, 0xae, 0x41, 0x82, 0x19, 0x32, 0x64, 0xc8, 0x8d, 0x07, 0x0e, 0x1c,
+    0x38, 0x70, 0xe0, 0xdd, 0xa7, 0x53, 0xa6, 0x51, 0xa2, 0x59, 0xb2, 0x79,
+    0xf2, 0xf9, 0xef, 0xc3, 0x9b, 0x2b, 0x56, 0xac, 0x45, 0x8a, 0x09, 0x12,
+    0x24, 0x48, 0x90, 0x3d, 0x7a, 0xf4, 0xf5, 0xf7, 0xf3, 0xfb, 0xeb, 0xcb,
+    0x8b, 0x0b, 0x16, 0x2c, 0x58, 0xb0, 0x7d, 0xfa, 0xe9, 0xcf, 0x83, 0x1b,
+    0x36, 0x6c, 0xd8, 0xad, 0x47, 0x8e, 0x01, 0x02
+};
+
+// Build the two 16-entry shuffle tables for the constant @p c: products
+// of c with the low and high nibble of every possible byte. The product
+// of c with a byte is then lo[byte & 0xf] ^ hi[byte >> 4].
+void make_nibble_tabs(uint8_t c, uint8_t lo[16], uint8_t hi[16]) {
+    for (size_t n = 0; n < 16; n++) {
+        lo[n] = gf256_mul(c, (uint8_t)n);
+        hi[n] = gf256_mul(c, (uint8_t)(n << 4));
+    }
+}
+
+// Multiply-and-add kernels. Each kernel computes dst[i] ^= c * src[i]
+// using the nibble tables built by make_nibble_tabs().
+
+void madd_scalar(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    uint8_t lo[16], hi[16];
+    make_nibble_tabs(c, lo, hi);
+
+    for (size_t n = 0; n < size; n++) {
+        const uint8_t s = src[n];
+        dst[n] ^= (uint8_t)(lo[s & 0x0f] ^ hi[s >> 4]);
+    }
+}
+
+#ifdef ROC_GF256_X86_64
+
+__attribute__((target("ssse3"))) void
+madd_ssse3(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    uint8_t lo[16], hi[16];
+    make_nibble_tabs(c, lo, hi);
+
+    const __m128i vlo = _mm_loadu_si128((const __m128i*)lo);
+    const __m128i vhi = _mm_loadu_si128((const __m128i*)hi);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    size_t n = 0;
+
+    for (; n + 16 <= size; n += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + n));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + n));
+
+        const __m128i l = _mm_and_si128(s, mask);
+        const __m128i h = _mm_and_si128(_mm_srli_epi64(s, 4), mask);
+
+        const __m128i r =
+            _mm_xor_si128(_mm_shuffle_epi8(vlo, l), _mm_shuffle_epi8(vhi, h));
+
+        _mm_storeu_si128((__m128i*)(dst + n), _mm_xor_si128(d, r));
+    }
+
+    for (; n < size; n++) {
+        const uint8_t s = src[n];
+        dst[n] ^= (uint8_t)(lo[s & 0x0f] ^ hi[s >> 4]);
+    }
+}
+
+#endif // ROC_GF256_X86_64
+
+#ifdef ROC_GF256_NEON
+
+void madd_neon(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    uint8_t lo[16], hi[16];
+    make_nibble_tabs(c, lo, hi);
+
+    uint8x8x2_t vlo;
+    vlo.val[0] = vld1_u8(lo);
+    vlo.val[1] = vld1_u8(lo + 8);
+
+    uint8x8x2_t vhi;
+    vhi.val[0] = vld1_u8(hi);
+    vhi.val[1] = vld1_u8(hi + 8);
+
+    const uint8x8_t mask = vdup_n_u8(0x0f);
+
+    size_t n = 0;
+
+    for (; n + 8 <= size; n += 8) {
+        const uint8x8_t s = vld1_u8(src + n);
+        const uint8x8_t d = vld1_u8(dst + n);
+
+        const uint8x8_t l = vand_u8(s, mask);
+        const uint8x8_t h = vshr_n_u8(s, 4);
+
+        const uint8x8_t r = veor_u8(vtbl2_u8(vlo, l), vtbl2_u8(vhi, h));
+
+        vst1_u8(dst + n, veor_u8(d, r));
+    }
+
+    for (; n < size; n++) {
+        const uint8_t s = src[n];
+        dst[n] ^= (uint8_t)(lo[s & 0x0f] ^ hi[s >> 4]);
+    }
+}
+
+#endif // ROC_GF256_NEON
+
+// Plain xor kernels, used for addition (c == 1), where the nibble
+// tables would be an identity lookup.
+
+void xor_scalar(uint8_t* dst, const uint8_t* src, size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        dst[n] ^= src[n];
+    }
+}
+
+#ifdef ROC_GF256_X86_64
+
+// SSE2 is part of the x86_64 baseline, no runtime check needed.
+void xor_sse2(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + 16 <= size; n += 16) {
+        const __m128i s = _mm_loadu_si128((const __m128i*)(src + n));
+        const __m128i d = _mm_loadu_si128((const __m128i*)(dst + n));
+
+        _mm_storeu_si128((__m128i*)(dst + n), _mm_xor_si128(d, s));
+    }
+
+    xor_scalar(dst + n, src + n, size - n);
+}
+
+#endif // ROC_GF256_X86_64
+
+#ifdef ROC_GF256_NEON
+
+void xor_neon(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t n = 0;
+
+    for (; n + 16 <= size; n += 16) {
+        const uint8x16_t s = vld1q_u8(src + n);
+        const uint8x16_t d = vld1q_u8(dst + n);
+
+        vst1q_u8(dst + n, veorq_u8(d, s));
+    }
+
+    xor_scalar(dst + n, src + n, size - n);
+}
+
+#endif // ROC_GF256_NEON
+
+typedef void (*madd_fn_t)(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size);
+
+madd_fn_t select_madd_fn() {
+#ifdef ROC_GF256_X86_64
+    if (core::CpuFeatures::instance().has_ssse3()) {
+        return madd_ssse3;
+    }
+#endif // ROC_GF256_X86_64
+
+#ifdef ROC_GF256_NEON
+    return madd_neon;
+#else
+    return madd_scalar;
+#endif
+}
+
+const madd_fn_t madd_fn = select_madd_fn();
+
+} // namespace
+
+uint8_t gf256_mul(uint8_t a, uint8_t b) {
+    if (a == 0 || b == 0) {
+        return 0;
+    }
+    return gf256_exp_tab[(size_t)gf256_log_tab[a] + (size_t)gf256_log_tab[b]];
+}
+
+uint8_t gf256_inv(uint8_t a) {
+    if (a == 0) {
+        roc_panic("gf256: zero element has no inverse");
+    }
+    return gf256_exp_tab[255 - (size_t)gf256_log_tab[a]];
+}
+
+uint8_t gf256_cauchy(size_t sblen, size_t repair_index, size_t source_index) {
+    roc_panic_if_not(sblen + repair_index < 256);
+    roc_panic_if_not(source_index < sblen);
+
+    // x and y elements are disjoint, so the xor is never zero
+    return gf256_inv((uint8_t)(sblen + repair_index) ^ (uint8_t)source_index);
+}
+
+void gf256_add(uint8_t* dst, const uint8_t* src, size_t size) {
+#ifdef ROC_GF256_X86_64
+    xor_sse2(dst, src, size);
+#elif defined(ROC_GF256_NEON)
+    xor_neon(dst, src, size);
+#else
+    xor_scalar(dst, src, size);
+#endif
+}
+
+void gf256_madd(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    if (c == 0) {
+        return;
+    }
+    if (c == 1) {
+        gf256_add(dst, src, size);
+        return;
+    }
+    madd_fn(dst, src, c, size);
+}
+
+} // namespace fec
+} // namespace roc
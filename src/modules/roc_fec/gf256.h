@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/gf256.h
+//! @brief GF(2^8) arithmetic.
+
+#ifndef ROC_FEC_GF256_H_
+#define ROC_FEC_GF256_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! Multiply two GF(2^8) elements.
+//!
+//! The field is generated by the polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11d).
+uint8_t gf256_mul(uint8_t a, uint8_t b);
+
+//! Get multiplicative inverse of a GF(2^8) element.
+//! @pre
+//!  @p a should be non-zero.
+uint8_t gf256_inv(uint8_t a);
+
+//! Get Reed-Solomon generator matrix coefficient.
+//!
+//! Returns the Cauchy matrix element binding repair symbol @p repair_index to
+//! source symbol @p source_index in a block with @p sblen source symbols. Any
+//! square submatrix of a Cauchy matrix is invertible, which makes the code MDS.
+//!
+//! @pre
+//!  @p sblen plus @p repair_index should be less than 256.
+uint8_t gf256_cauchy(size_t sblen, size_t repair_index, size_t source_index);
+
+//! Add buffer to another buffer.
+//!
+//! Computes dst[i] ^= src[i] for each of @p size bytes; addition and
+//! subtraction over GF(2^8) are both plain xor. Uses a SIMD kernel when
+//! the CPU supports it.
+void gf256_add(uint8_t* dst, const uint8_t* src, size_t size);
+
+//! Multiply buffer by a constant and add it to another buffer.
+//!
+//! Computes dst[i] ^= c * src[i] over GF(2^8) for each of @p size bytes.
+//! Uses a shuffle-based SIMD kernel when the CPU supports it.
+void gf256_madd(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size);
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_GF256_H_
@@ -14,5 +14,9 @@ namespace fec {
 IBlockDecoder::~IBlockDecoder() {
 }
 
+bool IBlockDecoder::supports_partial_repair() const {
+    return false;
+}
+
 } // namespace fec
 } // namespace roc
@@ -26,6 +26,15 @@ public:
     //! Get the maximum number of encoding symbols for the scheme being used.
     virtual size_t max_block_length() const = 0;
 
+    //! Check if the decoder can repair packets from a partial block.
+    //!
+    //! @remarks
+    //!  Sliding-window decoders recover whatever subset of the lost packets
+    //!  is covered by the repair packets received so far, so repair may be
+    //!  attempted before the block is complete. Block decoders need the
+    //!  full quorum and always return false.
+    virtual bool supports_partial_repair() const;
+
     //! Start block.
     //!
     //! @remarks
@@ -7,6 +7,7 @@
  */
 
 #include "roc_fec/iblock_encoder.h"
+#include "roc_core/panic.h"
 
 namespace roc {
 namespace fec {
@@ -14,5 +15,13 @@ namespace fec {
 IBlockEncoder::~IBlockEncoder() {
 }
 
+bool IBlockEncoder::repair_ready(size_t, size_t) const {
+    return false;
+}
+
+void IBlockEncoder::fill_repair(size_t) {
+    roc_panic("block encoder: per-packet filling not supported");
+}
+
 } // namespace fec
 } // namespace roc
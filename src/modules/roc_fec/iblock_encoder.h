@@ -12,8 +12,8 @@
 #ifndef ROC_FEC_IBLOCK_ENCODER_H_
 #define ROC_FEC_IBLOCK_ENCODER_H_
 
-#include "roc_core/slice.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/view.h"
 
 namespace roc {
 namespace fec {
@@ -40,7 +40,7 @@ public:
     //!
     //! @pre
     //!  This method may be called only between begin() and end() calls.
-    virtual void set(size_t index, const core::Slice<uint8_t>& buffer) = 0;
+    virtual void set(size_t index, const core::View<uint8_t>& buffer) = 0;
 
     //! Fill all repair packets in current block.
     //!
@@ -48,6 +48,22 @@ public:
     //!  This method may be called only between begin() and end() calls.
     virtual void fill() = 0;
 
+    //! Check if a repair packet can be filled before the block ends.
+    //!
+    //! @remarks
+    //!  Sliding-window encoders return true once the first @p n_source_symbols
+    //!  source symbols cover the encoding window of @p repair_index, so that
+    //!  the repair packet can be filled and sent without waiting for the
+    //!  block end. Block encoders always return false.
+    virtual bool repair_ready(size_t repair_index, size_t n_source_symbols) const;
+
+    //! Fill a single repair packet.
+    //!
+    //! @pre
+    //!  This method may be called only between begin() and end() calls,
+    //!  and only for packets reported ready by repair_ready().
+    virtual void fill_repair(size_t repair_index);
+
     //! Finish block.
     //!
     //! @remarks
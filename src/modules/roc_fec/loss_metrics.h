@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/loss_metrics.h
+//! @brief FEC block loss metrics.
+
+#ifndef ROC_FEC_LOSS_METRICS_H_
+#define ROC_FEC_LOSS_METRICS_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! FEC block loss metrics.
+//!
+//! Maintained by the receiver-side fec::Reader and consumed by the
+//! sender-side fec::RedundancyController. All counters are cumulative
+//! and only grow; a consumer takes snapshots and computes differences.
+struct LossMetrics {
+    //! Number of fully processed source blocks.
+    size_t n_blocks;
+
+    //! Number of source packets expected in processed blocks.
+    size_t n_source_packets;
+
+    //! Number of source packets lost on the wire in processed blocks,
+    //! including packets that were later restored by the FEC decoder.
+    size_t n_lost_packets;
+
+    //! Number of lost source packets that were restored by the FEC decoder.
+    size_t n_recovered_packets;
+
+    LossMetrics()
+        : n_blocks(0)
+        , n_source_packets(0)
+        , n_lost_packets(0)
+        , n_recovered_packets(0) {
+    }
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_LOSS_METRICS_H_
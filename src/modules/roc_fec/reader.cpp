@@ -9,6 +9,7 @@
 #include "roc_fec/reader.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/trace.h"
 #include "roc_packet/fec_scheme_to_str.h"
 
 namespace roc {
@@ -27,26 +28,64 @@ Reader::Reader(const ReaderConfig& config,
     , repair_reader_(repair_reader)
     , parser_(parser)
     , packet_pool_(packet_pool)
-    , source_queue_(0)
-    , repair_queue_(0)
+    , source_queue_(0, allocator)
+    , repair_queue_(0, allocator)
     , source_block_(allocator)
     , repair_block_(allocator)
     , valid_(false)
     , alive_(true)
     , started_(false)
     , can_repair_(false)
+    , repair_enabled_(1)
     , next_packet_(0)
     , cur_sbn_(0)
+    , n_source_filled_(0)
+    , n_repair_filled_(0)
     , payload_size_(0)
     , source_block_resized_(false)
     , repair_block_resized_(false)
     , payload_resized_(false)
     , n_packets_(0)
+    , metrics_lost_(
+          core::MetricsRegistry::instance().find_or_add_counter("fec_lost_packets"))
+    , metrics_recovered_(core::MetricsRegistry::instance().find_or_add_counter(
+          "fec_recovered_packets"))
     , max_sbn_jump_(config.max_sbn_jump)
-    , fec_scheme_(fec_scheme) {
+    , fec_scheme_(fec_scheme)
+    , dec_cond_(dec_mutex_)
+    , dec_source_payloads_(allocator)
+    , dec_repair_payloads_(allocator)
+    , dec_repaired_(allocator)
+    , dec_payload_size_(0)
+    , dec_sbn_(0)
+    , dec_pending_(false)
+    , dec_done_(false)
+    , dec_failed_(false)
+    , dec_stop_(false) {
+    if (config.async_decoding) {
+        dec_thread_.reset(new (allocator) DecodeThread(*this), allocator);
+        if (!dec_thread_ || !dec_thread_->start()) {
+            roc_log(LogError, "fec reader: can't start decoder thread");
+            dec_thread_.reset();
+            return;
+        }
+        roc_log(LogDebug, "fec reader: using asynchronous decoding");
+    }
+
     valid_ = true;
 }
 
+Reader::~Reader() {
+    if (dec_thread_) {
+        {
+            core::Mutex::Lock lock(dec_mutex_);
+            dec_stop_ = true;
+            dec_cond_.broadcast();
+        }
+        dec_thread_->join();
+    }
+}
+
 bool Reader::valid() const {
     return valid_;
 }
@@ -59,15 +98,26 @@ bool Reader::alive() const {
     return alive_;
 }
 
+void Reader::set_repair_enabled(bool enabled) {
+    repair_enabled_.store_relaxed(enabled ? 1 : 0);
+}
+
+LossMetrics Reader::loss_metrics() const {
+    return loss_metrics_;
+}
+
 packet::PacketPtr Reader::read() {
     roc_panic_if_not(valid());
     if (!alive_) {
         return NULL;
     }
+    ROC_TRACE1(fec_reader_read_begin, n_packets_);
     packet::PacketPtr pp = read_();
     if (pp) {
         n_packets_++;
     }
+    ROC_TRACE2(fec_reader_read_end, n_packets_,
+               (unsigned long)(pp ? pp->begin() : 0));
     // check if alive_ has changed
     return (alive_ ? pp : NULL);
 }
@@ -129,6 +179,13 @@ packet::PacketPtr Reader::get_next_packet_() {
         if (!pp) {
             try_repair_();
 
+            if (dec_thread_ && decode_in_flight_()) {
+                // the solve for this block is still running on the decoder
+                // thread; don't give up on the gap yet, repaired packets may
+                // be spliced into it when the solve completes
+                return NULL;
+            }
+
             size_t pos;
             for (pos = next_packet_; pos < source_block_.size(); pos++) {
                 if (source_block_[pos]) {
@@ -160,6 +217,28 @@ packet::PacketPtr Reader::get_next_packet_() {
 void Reader::next_block_() {
     roc_log(LogTrace, "fec reader: next block: sbn=%lu", (unsigned long)cur_sbn_);
 
+    // account packets lost on the wire before the block is recycled;
+    // restored packets were lost too, they just could be repaired
+    loss_metrics_.n_blocks++;
+    loss_metrics_.n_source_packets += source_block_.size();
+
+    for (size_t n = 0; n < source_block_.size(); n++) {
+        if (source_block_[n]
+            && !(source_block_[n]->flags() & packet::Packet::FlagRestored)) {
+            continue;
+        }
+        loss_metrics_.n_lost_packets++;
+        if (metrics_lost_) {
+            metrics_lost_->incr_relaxed();
+        }
+        if (source_block_[n]) {
+            loss_metrics_.n_recovered_packets++;
+            if (metrics_recovered_) {
+                metrics_recovered_->incr_relaxed();
+            }
+        }
+    }
+
     for (size_t n = 0; n < source_block_.size(); n++) {
         source_block_[n] = NULL;
     }
@@ -171,6 +250,9 @@ void Reader::next_block_() {
     cur_sbn_++;
     next_packet_ = 0;
 
+    n_source_filled_ = 0;
+    n_repair_filled_ = 0;
+
     source_block_resized_ = false;
     repair_block_resized_ = false;
     payload_resized_ = false;
@@ -181,14 +263,46 @@ void Reader::next_block_() {
 }
 
 void Reader::try_repair_() {
+    if (dec_thread_) {
+        // collect the results of a completed solve, if any
+        splice_repaired_();
+    }
+
     if (!can_repair_) {
         return;
     }
 
+    // can_repair_ is kept, so that repair resumes from the current state
+    // when it is enabled again
+    if (repair_enabled_.load_relaxed() == 0) {
+        return;
+    }
+
     if (!source_block_resized_ || !repair_block_resized_ || !payload_resized_) {
         return;
     }
 
+    // constant-time completeness check using the slot counters: an
+    // incomplete block can be repaired only when the available symbols
+    // can cover all gaps, so don't run the decoder until then
+    if (n_source_filled_ + n_repair_filled_ < source_block_.size()) {
+        // sliding-window decoders can recover the covered subset of the
+        // losses from a partial block, so for them any received repair
+        // packet is worth an attempt
+        if (n_repair_filled_ == 0 || !decoder_.supports_partial_repair()) {
+            return;
+        }
+    }
+
+    if (dec_thread_) {
+        schedule_decode_();
+        return;
+    }
+
+    repair_sync_();
+}
+
+void Reader::repair_sync_() {
     if (!decoder_.begin(source_block_.size(), repair_block_.size(), payload_size_)) {
         roc_log(LogDebug,
                 "fec reader: can't begin decoder block, shutting down:"
@@ -229,12 +343,174 @@ void Reader::try_repair_() {
         }
 
         source_block_[n] = pp;
+        n_source_filled_++;
     }
 
     decoder_.end();
     can_repair_ = false;
 }
 
+void Reader::schedule_decode_() {
+    {
+        core::Mutex::Lock lock(dec_mutex_);
+        if (dec_pending_ || dec_done_) {
+            // the previous solve is still running or not yet spliced;
+            // can_repair_ is kept, so we retry when it completes
+            return;
+        }
+    }
+
+    if (!dec_source_payloads_.resize(source_block_.size())
+        || !dec_repair_payloads_.resize(repair_block_.size())
+        || !dec_repaired_.resize(source_block_.size())) {
+        roc_log(LogDebug,
+                "fec reader: can't allocate decoder job memory, shutting down:"
+                " sbl=%lu rbl=%lu",
+                (unsigned long)source_block_.size(),
+                (unsigned long)repair_block_.size());
+        alive_ = false;
+        return;
+    }
+
+    for (size_t n = 0; n < source_block_.size(); n++) {
+        dec_source_payloads_[n] = source_block_[n] ? source_block_[n]->fec()->payload
+                                                   : core::Slice<uint8_t>();
+        dec_repaired_[n] = core::Slice<uint8_t>();
+    }
+
+    for (size_t n = 0; n < repair_block_.size(); n++) {
+        dec_repair_payloads_[n] = repair_block_[n] ? repair_block_[n]->fec()->payload
+                                                   : core::Slice<uint8_t>();
+    }
+
+    dec_payload_size_ = payload_size_;
+    dec_sbn_ = cur_sbn_;
+    dec_failed_ = false;
+
+    {
+        core::Mutex::Lock lock(dec_mutex_);
+        dec_pending_ = true;
+        dec_cond_.broadcast();
+    }
+
+    can_repair_ = false;
+}
+
+void Reader::splice_repaired_() {
+    {
+        core::Mutex::Lock lock(dec_mutex_);
+        if (!dec_done_) {
+            return;
+        }
+        dec_done_ = false;
+    }
+
+    if (dec_failed_) {
+        alive_ = false;
+        return;
+    }
+
+    if (dec_sbn_ != cur_sbn_) {
+        roc_log(LogTrace,
+                "fec reader: dropping decoder results for previous block:"
+                " job_sbn=%lu cur_sbn=%lu",
+                (unsigned long)dec_sbn_, (unsigned long)cur_sbn_);
+        for (size_t n = 0; n < dec_repaired_.size(); n++) {
+            dec_repaired_[n] = core::Slice<uint8_t>();
+        }
+        return;
+    }
+
+    for (size_t n = 0; n < source_block_.size() && n < dec_repaired_.size(); n++) {
+        core::Slice<uint8_t> buffer = dec_repaired_[n];
+        dec_repaired_[n] = core::Slice<uint8_t>();
+
+        if (!buffer || source_block_[n]) {
+            continue;
+        }
+
+        packet::PacketPtr pp = parse_repaired_packet_(buffer);
+        if (!pp) {
+            continue;
+        }
+
+        source_block_[n] = pp;
+        n_source_filled_++;
+    }
+}
+
+void Reader::decode_loop_() {
+    for (;;) {
+        {
+            core::Mutex::Lock lock(dec_mutex_);
+
+            while (!dec_pending_ && !dec_stop_) {
+                dec_cond_.wait();
+            }
+
+            if (!dec_pending_) {
+                return;
+            }
+        }
+
+        decode_block_();
+
+        {
+            core::Mutex::Lock lock(dec_mutex_);
+
+            dec_pending_ = false;
+            dec_done_ = true;
+
+            if (dec_stop_) {
+                return;
+            }
+        }
+    }
+}
+
+void Reader::decode_block_() {
+    const size_t sblen = dec_source_payloads_.size();
+    const size_t rblen = dec_repair_payloads_.size();
+
+    if (!decoder_.begin(sblen, rblen, dec_payload_size_)) {
+        roc_log(LogDebug,
+                "fec reader: can't begin decoder block, shutting down:"
+                " sbl=%lu rbl=%lu payload_size=%lu",
+                (unsigned long)sblen, (unsigned long)rblen,
+                (unsigned long)dec_payload_size_);
+        dec_failed_ = true;
+        return;
+    }
+
+    for (size_t n = 0; n < sblen; n++) {
+        if (!dec_source_payloads_[n]) {
+            continue;
+        }
+        decoder_.set(n, dec_source_payloads_[n]);
+    }
+
+    for (size_t n = 0; n < rblen; n++) {
+        if (!dec_repair_payloads_[n]) {
+            continue;
+        }
+        decoder_.set(sblen + n, dec_repair_payloads_[n]);
+    }
+
+    for (size_t n = 0; n < sblen; n++) {
+        if (dec_source_payloads_[n]) {
+            continue;
+        }
+        dec_repaired_[n] = decoder_.repair(n);
+    }
+
+    decoder_.end();
+}
+
+bool Reader::decode_in_flight_() {
+    core::Mutex::Lock lock(dec_mutex_);
+    return dec_pending_;
+}
+
 packet::PacketPtr Reader::parse_repaired_packet_(const core::Slice<uint8_t>& buffer) {
     packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
     if (!pp) {
@@ -337,6 +613,7 @@ void Reader::fill_source_block_() {
         if (!source_block_[p_num]) {
             can_repair_ = true;
             source_block_[p_num] = pp;
+            n_source_filled_++;
             n_added++;
         }
     }
@@ -403,6 +680,7 @@ void Reader::fill_repair_block_() {
         if (!repair_block_[p_num]) {
             can_repair_ = true;
             repair_block_[p_num] = pp;
+            n_repair_filled_++;
             n_added++;
         }
     }
@@ -13,10 +13,17 @@
 #define ROC_FEC_READER_H_
 
 #include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/cond.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/metrics_registry.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/thread.h"
+#include "roc_core/unique_ptr.h"
 #include "roc_fec/iblock_decoder.h"
+#include "roc_fec/loss_metrics.h"
 #include "roc_packet/iparser.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/packet.h"
@@ -31,8 +38,18 @@ struct ReaderConfig {
     //! Maximum allowed source block number jump.
     size_t max_sbn_jump;
 
+    //! Repair lost packets on a separate thread.
+    //! @remarks
+    //!  When enabled, a repairable block is handed to a worker thread
+    //!  that runs the block decoder, so that the thread calling read()
+    //!  is not blocked by FEC math. While the solve is running, read()
+    //!  keeps returning packets that arrived natively; repaired packets
+    //!  are spliced into the block when the solve completes.
+    bool async_decoding;
+
     ReaderConfig()
-        : max_sbn_jump(100) {
+        : max_sbn_jump(100)
+        , async_decoding(false) {
     }
 };
 
@@ -57,6 +74,9 @@ public:
            packet::PacketPool& packet_pool,
            core::IAllocator& allocator);
 
+    //! Destroy. Stops the decoder thread if it was started.
+    ~Reader();
+
     //! Check if object is successfully constructed.
     bool valid() const;
 
@@ -66,12 +86,43 @@ public:
     //! Is decoder alive?
     bool alive() const;
 
+    //! Enable or disable block repair at runtime.
+    //! @remarks
+    //!  When disabled, lost packets are no longer restored and are handled
+    //!  as unrepairable; packets that arrived natively flow unaffected, and
+    //!  block bookkeeping continues, so repair of subsequent blocks resumes
+    //!  seamlessly when re-enabled. Used to shed FEC math when the host is
+    //!  overloaded. May be called from another thread.
+    void set_repair_enabled(bool enabled);
+
+    //! Get cumulative block loss metrics.
+    //! @remarks
+    //!  Updated each time the reader finishes a block. May be reported
+    //!  to the sender to drive fec::RedundancyController.
+    LossMetrics loss_metrics() const;
+
     //! Read packet.
     //! @remarks
     //!  When a packet loss is detected, try to restore it from repair packets.
     virtual packet::PacketPtr read();
 
 private:
+    class DecodeThread : public core::Thread {
+    public:
+        explicit DecodeThread(Reader& reader)
+            : reader_(reader) {
+        }
+
+    private:
+        virtual void run() {
+            reader_.decode_loop_();
+        }
+
+        Reader& reader_;
+    };
+
+    friend class DecodeThread;
+
     packet::PacketPtr read_();
 
     packet::PacketPtr get_first_packet_();
@@ -79,6 +130,13 @@ private:
 
     void next_block_();
     void try_repair_();
+    void repair_sync_();
+
+    void schedule_decode_();
+    void splice_repaired_();
+    void decode_loop_();
+    void decode_block_();
+    bool decode_in_flight_();
 
     packet::PacketPtr parse_repaired_packet_(const core::Slice<uint8_t>& buffer);
 
@@ -117,8 +175,10 @@ private:
     packet::SortedQueue source_queue_;
     packet::SortedQueue repair_queue_;
 
-    core::Array<packet::PacketPtr> source_block_;
-    core::Array<packet::PacketPtr> repair_block_;
+    // embedded capacities cover the default block sizes, so that typical
+    // blocks don't pay a heap allocation per reader
+    core::Array<packet::PacketPtr, 32> source_block_;
+    core::Array<packet::PacketPtr, 16> repair_block_;
 
     bool valid_;
 
@@ -126,9 +186,16 @@ private:
     bool started_;
     bool can_repair_;
 
+    core::Atomic repair_enabled_;
+
     size_t next_packet_;
     packet::blknum_t cur_sbn_;
 
+    // number of filled slots in the block arrays, maintained on insert,
+    // so that completeness checks are constant-time regardless of block size
+    size_t n_source_filled_;
+    size_t n_repair_filled_;
+
     size_t payload_size_;
 
     bool source_block_resized_;
@@ -137,8 +204,27 @@ private:
 
     unsigned n_packets_;
 
+    LossMetrics loss_metrics_;
+
+    //! Exported loss and recovery counters, shared by all fec readers.
+    core::Atomic* metrics_lost_;
+    core::Atomic* metrics_recovered_;
+
     const size_t max_sbn_jump_;
     const packet::FECScheme fec_scheme_;
+
+    core::Mutex dec_mutex_;
+    core::Cond dec_cond_;
+    core::Array<core::Slice<uint8_t> > dec_source_payloads_;
+    core::Array<core::Slice<uint8_t> > dec_repair_payloads_;
+    core::Array<core::Slice<uint8_t> > dec_repaired_;
+    size_t dec_payload_size_;
+    packet::blknum_t dec_sbn_;
+    bool dec_pending_;
+    bool dec_done_;
+    bool dec_failed_;
+    bool dec_stop_;
+    core::UniquePtr<DecodeThread> dec_thread_;
 };
 
 } // namespace fec
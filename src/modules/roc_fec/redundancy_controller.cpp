@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/redundancy_controller.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace fec {
+
+RedundancyController::RedundancyController(const RedundancyControllerConfig& config,
+                                           size_t n_source_packets,
+                                           size_t n_repair_packets)
+    : min_rblen_(config.min_repair_packets)
+    , max_rblen_(config.max_repair_packets)
+    , window_blocks_(config.window_blocks)
+    , safety_factor_(config.safety_factor)
+    , sblen_(n_source_packets)
+    , cur_rblen_(n_repair_packets) {
+    if (min_rblen_ > max_rblen_) {
+        roc_panic("redundancy controller: min_repair_packets should not be greater"
+                  " than max_repair_packets");
+    }
+
+    if (window_blocks_ == 0) {
+        roc_panic("redundancy controller: window_blocks should be non-zero");
+    }
+
+    if (cur_rblen_ < min_rblen_) {
+        cur_rblen_ = min_rblen_;
+    }
+
+    if (cur_rblen_ > max_rblen_) {
+        cur_rblen_ = max_rblen_;
+    }
+}
+
+size_t RedundancyController::n_repair_packets() const {
+    return cur_rblen_;
+}
+
+bool RedundancyController::update(const LossMetrics& metrics) {
+    if (metrics.n_blocks - last_metrics_.n_blocks < window_blocks_) {
+        return false;
+    }
+
+    const size_t d_packets = metrics.n_source_packets - last_metrics_.n_source_packets;
+    const size_t d_lost = metrics.n_lost_packets - last_metrics_.n_lost_packets;
+
+    last_metrics_ = metrics;
+
+    if (d_packets == 0) {
+        return false;
+    }
+
+    // number of repair packets needed to cover the observed loss ratio in
+    // a block of sblen_ source packets, with headroom, rounded up
+    const float need_f = (float)d_lost / (float)d_packets * safety_factor_ * sblen_;
+
+    size_t need = (size_t)need_f;
+    if ((float)need < need_f) {
+        need++;
+    }
+
+    if (need < min_rblen_) {
+        need = min_rblen_;
+    }
+
+    if (need > max_rblen_) {
+        need = max_rblen_;
+    }
+
+    size_t new_rblen = cur_rblen_;
+
+    if (need > cur_rblen_) {
+        // raise redundancy immediately
+        new_rblen = need;
+    } else if (need < cur_rblen_) {
+        // lower redundancy one packet per window, to stay robust against
+        // losses the receiver has not reported yet
+        new_rblen = cur_rblen_ - 1;
+    }
+
+    if (new_rblen == cur_rblen_) {
+        return false;
+    }
+
+    roc_log(LogDebug,
+            "redundancy controller: update repair block size:"
+            " cur_rbl=%lu new_rbl=%lu loss_ratio=%.5f",
+            (unsigned long)cur_rblen_, (unsigned long)new_rblen,
+            (double)d_lost / (double)d_packets);
+
+    cur_rblen_ = new_rblen;
+
+    return true;
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/redundancy_controller.h
+//! @brief Adaptive FEC redundancy controller.
+
+#ifndef ROC_FEC_REDUNDANCY_CONTROLLER_H_
+#define ROC_FEC_REDUNDANCY_CONTROLLER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_fec/loss_metrics.h"
+
+namespace roc {
+namespace fec {
+
+//! Redundancy controller parameters.
+struct RedundancyControllerConfig {
+    //! Minimum number of repair packets per block.
+    size_t min_repair_packets;
+
+    //! Maximum number of repair packets per block.
+    size_t max_repair_packets;
+
+    //! Number of completed blocks in the decision window.
+    //! @remarks
+    //!  The repair block size is re-evaluated at most once per window.
+    size_t window_blocks;
+
+    //! Multiplier applied to the observed loss ratio to provision
+    //! headroom for loss bursts.
+    float safety_factor;
+
+    RedundancyControllerConfig()
+        : min_repair_packets(1)
+        , max_repair_packets(20)
+        , window_blocks(20)
+        , safety_factor(2) {
+    }
+};
+
+//! Adaptive FEC redundancy controller.
+//!
+//! Maps block loss metrics reported by the receiver-side fec::Reader to the
+//! number of repair packets per block on the sender. The caller delivers
+//! receiver reports to update() and, when it returns true, applies the new
+//! size with fec::Writer::resize(), which picks it up on the next block
+//! boundary. How the reports travel from the receiver to the sender is up
+//! to the application.
+//!
+//! The repair block size is raised immediately when the observed loss ratio
+//! requires it, and lowered by one packet per decision window, so that a
+//! loss burst gets extra redundancy quickly, while on a clean network the
+//! redundancy gradually decays to the configured minimum.
+class RedundancyController : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p config defines block size bounds and the decision window
+    //!  - @p n_source_packets is the number of source packets per block
+    //!  - @p n_repair_packets is the initial number of repair packets
+    RedundancyController(const RedundancyControllerConfig& config,
+                         size_t n_source_packets,
+                         size_t n_repair_packets);
+
+    //! Get current number of repair packets per block.
+    size_t n_repair_packets() const;
+
+    //! Update number of repair packets from a receiver report.
+    //! @remarks
+    //!  @p metrics is a cumulative snapshot of the receiver loss metrics.
+    //!  Does nothing until the decision window is filled.
+    //! @returns
+    //!  true if the number of repair packets has changed.
+    bool update(const LossMetrics& metrics);
+
+private:
+    const size_t min_rblen_;
+    const size_t max_rblen_;
+    const size_t window_blocks_;
+    const float safety_factor_;
+
+    const size_t sblen_;
+    size_t cur_rblen_;
+
+    LossMetrics last_metrics_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_REDUNDANCY_CONTROLLER_H_
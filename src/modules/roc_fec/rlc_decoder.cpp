@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rlc_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+#include "roc_fec/rlc_scheme.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t NoPivot = (size_t)-1;
+
+} // namespace
+
+RlcDecoder::RlcDecoder(const CodecConfig& config,
+                       core::BufferPool<uint8_t>& buffer_pool,
+                       core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , wlen_(0)
+    , payload_size_(0)
+    , buffer_arena_(buffer_pool, allocator)
+    , buff_tab_(allocator)
+    , recv_tab_(allocator)
+    , coeff_tab_(allocator)
+    , row_tab_(allocator)
+    , pivot_tab_(allocator)
+    , n_rows_(0)
+    , status_(allocator)
+    , has_new_packets_(false)
+    , decoding_failed_(false)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_RLC) {
+        roc_panic("rlc decoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rlc decoder: initializing: codec=rlc");
+
+    valid_ = true;
+}
+
+RlcDecoder::~RlcDecoder() {
+}
+
+bool RlcDecoder::valid() const {
+    return valid_;
+}
+
+size_t RlcDecoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return MaxBlockLength;
+}
+
+bool RlcDecoder::supports_partial_repair() const {
+    return true;
+}
+
+bool RlcDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (rblen == 0) {
+        roc_log(LogError, "rlc decoder: repair block length can't be zero");
+        return false;
+    }
+
+    if (sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "rlc decoder: block length too large: sblen=%lu rblen=%lu",
+                (unsigned long)sblen, (unsigned long)rblen);
+        return false;
+    }
+
+    if (!resize_tabs_(sblen, rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    wlen_ = rlc_window_len(sblen, rblen);
+    payload_size_ = payload_size;
+
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+
+    return true;
+}
+
+void RlcDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rlc decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rlc decoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rlc decoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if (buff_tab_[index]) {
+        roc_panic("rlc decoder: can't overwrite buffer: index=%lu", (unsigned long)index);
+    }
+
+    buff_tab_[index] = buffer;
+    recv_tab_[index] = true;
+
+    has_new_packets_ = true;
+}
+
+core::Slice<uint8_t> RlcDecoder::repair(size_t index) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rlc decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buff_tab_[index] && has_new_packets_) {
+        try_repair_();
+        has_new_packets_ = false;
+    }
+
+    return buff_tab_[index];
+}
+
+void RlcDecoder::end() {
+    roc_panic_if_not(valid());
+
+    report_();
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+}
+
+bool RlcDecoder::resize_tabs_(size_t sblen, size_t rblen) {
+    const size_t blen = sblen + rblen;
+
+    // per attempt up to rblen elimination rows are alive next to the
+    // recovered buffers still referenced downstream, so size the arena
+    // with one extra repair block of slack
+    if (buffer_arena_.size() < blen + rblen
+        && !buffer_arena_.resize(blen + rblen)) {
+        return false;
+    }
+    if (!buff_tab_.resize(blen)) {
+        return false;
+    }
+    if (!recv_tab_.resize(blen)) {
+        return false;
+    }
+    if (!coeff_tab_.resize(rblen * sblen)) {
+        return false;
+    }
+    if (!row_tab_.resize(rblen)) {
+        return false;
+    }
+    if (!pivot_tab_.resize(sblen)) {
+        return false;
+    }
+    if (!status_.resize(blen + 2)) {
+        return false;
+    }
+
+    return true;
+}
+
+void RlcDecoder::reset_tabs_() {
+    for (size_t i = 0; i < buff_tab_.size(); i++) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+        recv_tab_[i] = false;
+    }
+    for (size_t n = 0; n < row_tab_.size(); n++) {
+        row_tab_[n] = core::Slice<uint8_t>();
+    }
+    n_rows_ = 0;
+}
+
+// Recover whatever subset of the lost source symbols the received repair
+// symbols can resolve.
+//
+// Every received repair symbol is one linear equation over the source
+// symbols of its window. The contributions of the received sources are
+// moved to the right-hand side, and the equation is reduced against the
+// pivots found so far as it's inserted; the leading remaining column
+// either becomes a new pivot or the equation is redundant. After
+// back-substitution every pivot row that involves a single lost symbol
+// yields that symbol; rows still involving several losses are kept for a
+// later attempt with more packets.
+void RlcDecoder::try_repair_() {
+    if (decoding_failed_) {
+        return;
+    }
+
+    size_t n_lost = 0;
+    for (size_t i = 0; i < sblen_; i++) {
+        if (!buff_tab_[i]) {
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    n_rows_ = 0;
+    for (size_t col = 0; col < sblen_; col++) {
+        pivot_tab_[col] = NoPivot;
+    }
+
+    for (size_t j = 0; j < rblen_; j++) {
+        if (!buff_tab_[sblen_ + j]) {
+            continue;
+        }
+        if (!insert_equation_(j)) {
+            decoding_failed_ = true;
+            break;
+        }
+    }
+
+    if (!decoding_failed_) {
+        back_substitute_();
+        extract_solved_();
+    }
+
+    for (size_t n = 0; n < row_tab_.size(); n++) {
+        row_tab_[n] = core::Slice<uint8_t>();
+    }
+}
+
+bool RlcDecoder::insert_equation_(size_t repair_index) {
+    uint8_t* rc = &coeff_tab_[n_rows_ * sblen_];
+
+    memset(rc, 0, sblen_);
+
+    core::Slice<uint8_t> data = make_buffer_();
+    if (!data) {
+        return false;
+    }
+
+    memcpy(data.data(), buff_tab_[sblen_ + repair_index].data(), payload_size_);
+
+    const size_t wend = rlc_window_end(repair_index, sblen_, rblen_);
+    const size_t wbegin = rlc_window_begin(wend, wlen_);
+
+    RlcCoeffGen gen(repair_index, sblen_, rblen_);
+
+    size_t n_unknown = 0;
+
+    for (size_t i = wbegin; i < wend; i++) {
+        const uint8_t c = gen.next();
+        if (buff_tab_[i]) {
+            gf256_madd(data.data(), buff_tab_[i].data(), c, payload_size_);
+        } else {
+            rc[i] = c;
+            n_unknown++;
+        }
+    }
+
+    if (n_unknown == 0) {
+        // all window symbols are known, nothing to learn from this equation
+        return true;
+    }
+
+    for (size_t col = wbegin; col < sblen_; col++) {
+        if (rc[col] == 0) {
+            continue;
+        }
+
+        const size_t r = pivot_tab_[col];
+
+        if (r == NoPivot) {
+            pivot_tab_[col] = n_rows_;
+            row_tab_[n_rows_] = data;
+            n_rows_++;
+            return true;
+        }
+
+        const uint8_t* pc = &coeff_tab_[r * sblen_];
+        const uint8_t factor = gf256_mul(rc[col], gf256_inv(pc[col]));
+
+        gf256_madd(rc, pc, factor, sblen_);
+        gf256_madd(data.data(), row_tab_[r].data(), factor, payload_size_);
+    }
+
+    // reduced to zero: linearly dependent on earlier equations
+    return true;
+}
+
+void RlcDecoder::back_substitute_() {
+    for (size_t col = sblen_; col-- > 0;) {
+        const size_t r = pivot_tab_[col];
+        if (r == NoPivot) {
+            continue;
+        }
+
+        uint8_t* rc = &coeff_tab_[r * sblen_];
+
+        for (size_t q = col + 1; q < sblen_; q++) {
+            if (rc[q] == 0) {
+                continue;
+            }
+
+            const size_t s = pivot_tab_[q];
+            if (s == NoPivot) {
+                continue;
+            }
+
+            const uint8_t* sc = &coeff_tab_[s * sblen_];
+            const uint8_t factor = gf256_mul(rc[q], gf256_inv(sc[q]));
+
+            gf256_madd(rc, sc, factor, sblen_);
+            gf256_madd(row_tab_[r].data(), row_tab_[s].data(), factor, payload_size_);
+        }
+    }
+}
+
+void RlcDecoder::extract_solved_() {
+    for (size_t col = 0; col < sblen_; col++) {
+        if (buff_tab_[col]) {
+            continue;
+        }
+
+        const size_t r = pivot_tab_[col];
+        if (r == NoPivot) {
+            continue;
+        }
+
+        const uint8_t* rc = &coeff_tab_[r * sblen_];
+
+        bool solved = true;
+        for (size_t q = 0; q < sblen_; q++) {
+            if (q != col && rc[q] != 0) {
+                // equation still involves other lost symbols
+                solved = false;
+                break;
+            }
+        }
+
+        if (!solved) {
+            continue;
+        }
+
+        core::Slice<uint8_t> buffer = make_buffer_();
+        if (!buffer) {
+            decoding_failed_ = true;
+            return;
+        }
+
+        memset(buffer.data(), 0, payload_size_);
+        gf256_madd(buffer.data(), row_tab_[r].data(), gf256_inv(rc[col]),
+                   payload_size_);
+
+        buff_tab_[col] = buffer;
+    }
+}
+
+core::Slice<uint8_t> RlcDecoder::make_buffer_() {
+    core::Slice<uint8_t> buffer = buffer_arena_.acquire(payload_size_);
+
+    if (!buffer) {
+        roc_log(LogError, "rlc decoder: can't allocate buffer: size=%lu",
+                (unsigned long)payload_size_);
+        return core::Slice<uint8_t>();
+    }
+
+    return buffer;
+}
+
+void RlcDecoder::report_() {
+    size_t n_lost = 0, n_repaired = 0;
+
+    status_[sblen_] = ' ';
+    status_[sblen_ + rblen_ + 1] = '\0';
+
+    for (size_t i = 0; i < sblen_ + rblen_; i++) {
+        char* status = (i < sblen_ ? &status_[i] : &status_[i + 1]);
+
+        if (buff_tab_[i]) {
+            if (recv_tab_[i]) {
+                *status = '.';
+            } else {
+                *status = 'r';
+                n_repaired++;
+                n_lost++;
+            }
+        } else {
+            if (i < sblen_) {
+                *status = 'X';
+            } else {
+                *status = 'x';
+            }
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    roc_log(LogDebug, "rlc decoder: repaired %u/%u/%u %s", (unsigned)n_repaired,
+            (unsigned)n_lost, (unsigned)buff_tab_.size(), &status_[0]);
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc_decoder.h
+//! @brief Built-in sliding-window RLC decoder.
+
+#ifndef ROC_FEC_RLC_DECODER_H_
+#define ROC_FEC_RLC_DECODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_arena.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_decoder.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in sliding-window RLC decoder.
+//!
+//! Counterpart of RlcEncoder. Every received repair packet is one linear
+//! equation over the source packets of its window; the equations are fed
+//! into a Gaussian elimination incrementally, each reduced against the
+//! pivots found so far, and every lost packet whose equation resolves is
+//! extracted. Unlike a block decoder, whatever subset of the losses is
+//! covered by the received equations is recovered without waiting for
+//! the rest of the block, see supports_partial_repair().
+class RlcDecoder : public IBlockDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit RlcDecoder(const CodecConfig& config,
+                        core::BufferPool<uint8_t>& buffer_pool,
+                        core::IAllocator& allocator);
+
+    virtual ~RlcDecoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Check if the decoder can repair packets from a partial block.
+    virtual bool supports_partial_repair() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store packet data for current block.
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Repair source packet buffer.
+    virtual core::Slice<uint8_t> repair(size_t index);
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { MaxBlockLength = 4096 };
+
+    bool resize_tabs_(size_t sblen, size_t rblen);
+    void reset_tabs_();
+
+    void try_repair_();
+    bool insert_equation_(size_t repair_index);
+    void back_substitute_();
+    void extract_solved_();
+
+    core::Slice<uint8_t> make_buffer_();
+
+    void report_();
+
+    size_t sblen_;
+    size_t rblen_;
+    size_t wlen_;
+
+    size_t payload_size_;
+
+    //! Recycles the recovered-symbol and elimination buffers across
+    //! blocks, so that steady-state decoding doesn't touch the pool.
+    core::BufferArena<uint8_t> buffer_arena_;
+
+    core::Array<core::Slice<uint8_t> > buff_tab_;
+    core::Array<bool> recv_tab_;
+
+    //! Elimination state, rebuilt on every repair attempt: one dense
+    //! coefficient row per received repair packet plus its partially
+    //! reduced payload, and the row holding the pivot of each column.
+    core::Array<uint8_t> coeff_tab_;
+    core::Array<core::Slice<uint8_t> > row_tab_;
+    core::Array<size_t> pivot_tab_;
+    size_t n_rows_;
+
+    core::Array<char> status_;
+
+    bool has_new_packets_;
+    bool decoding_failed_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_DECODER_H_
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rlc_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+#include "roc_fec/rlc_scheme.h"
+
+namespace roc {
+namespace fec {
+
+RlcEncoder::RlcEncoder(const CodecConfig& config,
+                       core::BufferPool<uint8_t>&,
+                       core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , wlen_(0)
+    , payload_size_(0)
+    , buff_tab_(allocator)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_RLC) {
+        roc_panic("rlc encoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rlc encoder: initializing: codec=rlc");
+
+    valid_ = true;
+}
+
+RlcEncoder::~RlcEncoder() {
+}
+
+bool RlcEncoder::valid() const {
+    return valid_;
+}
+
+size_t RlcEncoder::alignment() const {
+    return Alignment;
+}
+
+size_t RlcEncoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return MaxBlockLength;
+}
+
+bool RlcEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (rblen == 0) {
+        roc_log(LogError, "rlc encoder: repair block length can't be zero");
+        return false;
+    }
+
+    if (sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "rlc encoder: block length too large: sblen=%lu rblen=%lu",
+                (unsigned long)sblen, (unsigned long)rblen);
+        return false;
+    }
+
+    if (!buff_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    wlen_ = rlc_window_len(sblen, rblen);
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void RlcEncoder::set(size_t index, const core::View<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rlc encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rlc encoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rlc encoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    buff_tab_[index] = buffer;
+}
+
+void RlcEncoder::fill() {
+    roc_panic_if_not(valid());
+
+    for (size_t j = 0; j < rblen_; j++) {
+        fill_repair(j);
+    }
+}
+
+bool RlcEncoder::repair_ready(size_t repair_index, size_t n_source_symbols) const {
+    roc_panic_if_not(valid());
+
+    if (repair_index >= rblen_) {
+        roc_panic("rlc encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)repair_index, (unsigned long)rblen_);
+    }
+
+    return n_source_symbols >= rlc_window_end(repair_index, sblen_, rblen_);
+}
+
+void RlcEncoder::fill_repair(size_t repair_index) {
+    roc_panic_if_not(valid());
+
+    if (repair_index >= rblen_) {
+        roc_panic("rlc encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)repair_index, (unsigned long)rblen_);
+    }
+
+    const size_t wend = rlc_window_end(repair_index, sblen_, rblen_);
+    const size_t wbegin = rlc_window_begin(wend, wlen_);
+
+    if (!buff_tab_[sblen_ + repair_index]) {
+        roc_panic("rlc encoder: missing buffer: index=%lu",
+                  (unsigned long)(sblen_ + repair_index));
+    }
+
+    for (size_t i = wbegin; i < wend; i++) {
+        if (!buff_tab_[i]) {
+            roc_panic("rlc encoder: missing buffer: index=%lu", (unsigned long)i);
+        }
+    }
+
+    uint8_t* repair = buff_tab_[sblen_ + repair_index].data();
+
+    memset(repair, 0, payload_size_);
+
+    RlcCoeffGen gen(repair_index, sblen_, rblen_);
+
+    for (size_t i = wbegin; i < wend; i++) {
+        gf256_madd(repair, buff_tab_[i].data(), gen.next(), payload_size_);
+    }
+}
+
+void RlcEncoder::end() {
+    roc_panic_if_not(valid());
+
+    for (size_t i = 0; i < buff_tab_.size(); i++) {
+        buff_tab_[i] = core::View<uint8_t>();
+    }
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc_encoder.h
+//! @brief Built-in sliding-window RLC encoder.
+
+#ifndef ROC_FEC_RLC_ENCODER_H_
+#define ROC_FEC_RLC_ENCODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/view.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_encoder.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in sliding-window RLC encoder.
+//!
+//! Each repair packet is a random linear combination over GF(2^8) of a
+//! window of source packets, see rlc_scheme.h. The windows slide across
+//! the block, so a repair packet is ready as soon as its window is filled
+//! and can be sent without waiting for the block end, which keeps repair
+//! delay at a fraction of the block length.
+class RlcEncoder : public IBlockEncoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit RlcEncoder(const CodecConfig& config,
+                        core::BufferPool<uint8_t>& buffer_pool,
+                        core::IAllocator& allocator);
+
+    virtual ~RlcEncoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get buffer alignment requirement.
+    virtual size_t alignment() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store packet data for current block.
+    virtual void set(size_t index, const core::View<uint8_t>& buffer);
+
+    //! Fill all repair packets.
+    virtual void fill();
+
+    //! Check if a repair packet can be filled before the block ends.
+    virtual bool repair_ready(size_t repair_index, size_t n_source_symbols) const;
+
+    //! Fill a single repair packet.
+    virtual void fill_repair(size_t repair_index);
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { Alignment = 8, MaxBlockLength = 4096 };
+
+    size_t sblen_;
+    size_t rblen_;
+    size_t wlen_;
+
+    size_t payload_size_;
+
+    // non-owning: the writer holds the block packets while the
+    // encoder is between begin() and end()
+    core::Array<core::View<uint8_t> > buff_tab_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_ENCODER_H_
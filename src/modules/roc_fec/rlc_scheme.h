@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rlc_scheme.h
+//! @brief Sliding-window RLC scheme definitions.
+
+#ifndef ROC_FEC_RLC_SCHEME_H_
+#define ROC_FEC_RLC_SCHEME_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace fec {
+
+//! Get the exclusive end of the encoding window of a repair symbol.
+//!
+//! Window ends are spread evenly across the source block, so that repair
+//! symbol @p repair_index can be produced as soon as the first
+//! rlc_window_end() source symbols are known, instead of at the block end.
+//! The window of the last repair symbol always ends at @p sblen.
+inline size_t rlc_window_end(size_t repair_index, size_t sblen, size_t rblen) {
+    return ((repair_index + 1) * sblen + rblen - 1) / rblen;
+}
+
+//! Get the length of the encoding window.
+//!
+//! The window is twice the distance between consecutive window ends, so
+//! that every source symbol is covered by about two repair symbols. It is
+//! derived from the block geometry alone, so that the sender and the
+//! receiver agree on it without carrying it on the wire.
+inline size_t rlc_window_len(size_t sblen, size_t rblen) {
+    const size_t spacing = (sblen + rblen - 1) / rblen;
+
+    size_t wlen = spacing * 2;
+    if (wlen > sblen) {
+        wlen = sblen;
+    }
+
+    return wlen;
+}
+
+//! Get the inclusive begin of the encoding window with the given end.
+inline size_t rlc_window_begin(size_t wend, size_t wlen) {
+    return wend > wlen ? wend - wlen : 0;
+}
+
+//! Deterministic generator of the GF(2^8) window coefficients.
+//!
+//! Seeded from the repair symbol index and the block geometry, so that the
+//! encoder and the decoder derive identical coefficients without carrying
+//! them on the wire.
+class RlcCoeffGen {
+public:
+    //! Initialize generator for the given repair symbol.
+    RlcCoeffGen(size_t repair_index, size_t sblen, size_t rblen)
+        : state_(uint32_t(repair_index + 1) * 2654435761u ^ (uint32_t(sblen) << 16)
+                 ^ uint32_t(rblen)) {
+        if (state_ == 0) {
+            state_ = 1;
+        }
+    }
+
+    //! Get coefficient of the next source symbol in the window.
+    //! @remarks
+    //!  Never returns zero, so that every source symbol of the window
+    //!  contributes to the repair symbol.
+    uint8_t next() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return uint8_t(1 + state_ % 255);
+    }
+
+private:
+    uint32_t state_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RLC_SCHEME_H_
@@ -0,0 +1,368 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rs8m_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+Rs8mDecoder::Rs8mDecoder(const CodecConfig& config,
+                         core::BufferPool<uint8_t>& buffer_pool,
+                         core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , buffer_arena_(buffer_pool, allocator)
+    , buff_tab_(allocator)
+    , recv_tab_(allocator)
+    , rhs_tab_(allocator)
+    , lost_tab_(allocator)
+    , repair_tab_(allocator)
+    , mat_(allocator)
+    , inv_(allocator)
+    , status_(allocator)
+    , has_new_packets_(false)
+    , decoding_failed_(false)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_ReedSolomon_M8) {
+        roc_panic("rs8m decoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rs8m decoder: initializing: codec=rs8m");
+
+    valid_ = true;
+}
+
+Rs8mDecoder::~Rs8mDecoder() {
+}
+
+bool Rs8mDecoder::valid() const {
+    return valid_;
+}
+
+size_t Rs8mDecoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return MaxBlockLength;
+}
+
+bool Rs8mDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "rs8m decoder: block length too large: sblen=%lu rblen=%lu",
+                (unsigned long)sblen, (unsigned long)rblen);
+        return false;
+    }
+
+    if (!resize_tabs_(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+
+    return true;
+}
+
+void Rs8mDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rs8m decoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rs8m decoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if (buff_tab_[index]) {
+        roc_panic("rs8m decoder: can't overwrite buffer: index=%lu",
+                  (unsigned long)index);
+    }
+
+    buff_tab_[index] = buffer;
+    recv_tab_[index] = true;
+
+    has_new_packets_ = true;
+}
+
+core::Slice<uint8_t> Rs8mDecoder::repair(size_t index) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buff_tab_[index] && has_new_packets_) {
+        try_repair_();
+        has_new_packets_ = false;
+    }
+
+    return buff_tab_[index];
+}
+
+void Rs8mDecoder::end() {
+    roc_panic_if_not(valid());
+
+    report_();
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+}
+
+bool Rs8mDecoder::resize_tabs_(size_t size) {
+    // at most one scratch and one recovered buffer per block symbol can be
+    // alive at a time, so a block-sized arena makes steady-state decoding
+    // free of pool operations
+    if (buffer_arena_.size() < size && !buffer_arena_.resize(size)) {
+        return false;
+    }
+    if (!buff_tab_.resize(size)) {
+        return false;
+    }
+    if (!recv_tab_.resize(size)) {
+        return false;
+    }
+    if (!status_.resize(size + 2)) {
+        return false;
+    }
+
+    return true;
+}
+
+void Rs8mDecoder::reset_tabs_() {
+    for (size_t i = 0; i < buff_tab_.size(); i++) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+        recv_tab_[i] = false;
+    }
+}
+
+// Recover all lost source symbols at once.
+//
+// Every received repair symbol r is a known linear combination of the source
+// symbols: repair_r = sum_j cauchy(r, j) * src_j. Moving the received source
+// symbols to the right-hand side leaves a system of equations in the lost
+// sources only, whose matrix is a square submatrix of the Cauchy matrix and
+// therefore always invertible.
+void Rs8mDecoder::try_repair_() {
+    if (decoding_failed_) {
+        return;
+    }
+
+    size_t n_lost = 0;
+    for (size_t j = 0; j < sblen_; j++) {
+        if (!buff_tab_[j]) {
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    size_t n_repairs = 0;
+    for (size_t i = sblen_; i < sblen_ + rblen_; i++) {
+        if (buff_tab_[i]) {
+            n_repairs++;
+        }
+    }
+
+    if (n_repairs < n_lost) {
+        // not enough symbols yet, may succeed on a later call
+        return;
+    }
+
+    if (!lost_tab_.resize(n_lost) || !repair_tab_.resize(n_lost)
+        || !rhs_tab_.resize(n_lost) || !mat_.resize(n_lost * n_lost)
+        || !inv_.resize(n_lost * n_lost)) {
+        decoding_failed_ = true;
+        return;
+    }
+
+    size_t n = 0;
+    for (size_t j = 0; j < sblen_; j++) {
+        if (!buff_tab_[j]) {
+            lost_tab_[n++] = j;
+        }
+    }
+
+    n = 0;
+    for (size_t i = sblen_; i < sblen_ + rblen_ && n < n_lost; i++) {
+        if (buff_tab_[i]) {
+            repair_tab_[n++] = i - sblen_;
+        }
+    }
+
+    // right-hand sides: repair symbol minus contributions of received sources
+    for (size_t i = 0; i < n_lost; i++) {
+        rhs_tab_[i] = make_buffer_();
+        if (!rhs_tab_[i]) {
+            decoding_failed_ = true;
+            return;
+        }
+
+        uint8_t* rhs = rhs_tab_[i].data();
+
+        memcpy(rhs, buff_tab_[sblen_ + repair_tab_[i]].data(), payload_size_);
+
+        for (size_t j = 0; j < sblen_; j++) {
+            if (buff_tab_[j]) {
+                gf256_madd(rhs, buff_tab_[j].data(),
+                           gf256_cauchy(sblen_, repair_tab_[i], j), payload_size_);
+            }
+        }
+
+        for (size_t k = 0; k < n_lost; k++) {
+            mat_[i * n_lost + k] = gf256_cauchy(sblen_, repair_tab_[i], lost_tab_[k]);
+        }
+    }
+
+    if (!invert_matrix_(n_lost)) {
+        // can't happen for a Cauchy submatrix
+        roc_panic("rs8m decoder: can't invert recovery matrix");
+    }
+
+    for (size_t k = 0; k < n_lost; k++) {
+        core::Slice<uint8_t> buffer = make_buffer_();
+        if (!buffer) {
+            decoding_failed_ = true;
+            break;
+        }
+
+        uint8_t* data = buffer.data();
+
+        memset(data, 0, payload_size_);
+
+        for (size_t i = 0; i < n_lost; i++) {
+            gf256_madd(data, rhs_tab_[i].data(), inv_[k * n_lost + i], payload_size_);
+        }
+
+        buff_tab_[lost_tab_[k]] = buffer;
+    }
+
+    for (size_t i = 0; i < n_lost; i++) {
+        rhs_tab_[i] = core::Slice<uint8_t>();
+    }
+}
+
+// Gauss-Jordan elimination over GF(2^8): reduce mat_ to identity,
+// applying the same row operations to inv_.
+bool Rs8mDecoder::invert_matrix_(size_t n_lost) {
+    for (size_t i = 0; i < n_lost; i++) {
+        for (size_t k = 0; k < n_lost; k++) {
+            inv_[i * n_lost + k] = (i == k);
+        }
+    }
+
+    for (size_t col = 0; col < n_lost; col++) {
+        size_t row = col;
+        while (row < n_lost && mat_[row * n_lost + col] == 0) {
+            row++;
+        }
+        if (row == n_lost) {
+            return false;
+        }
+
+        if (row != col) {
+            for (size_t k = 0; k < n_lost; k++) {
+                const uint8_t tm = mat_[row * n_lost + k];
+                mat_[row * n_lost + k] = mat_[col * n_lost + k];
+                mat_[col * n_lost + k] = tm;
+
+                const uint8_t ti = inv_[row * n_lost + k];
+                inv_[row * n_lost + k] = inv_[col * n_lost + k];
+                inv_[col * n_lost + k] = ti;
+            }
+        }
+
+        const uint8_t pivot = gf256_inv(mat_[col * n_lost + col]);
+        for (size_t k = 0; k < n_lost; k++) {
+            mat_[col * n_lost + k] = gf256_mul(mat_[col * n_lost + k], pivot);
+            inv_[col * n_lost + k] = gf256_mul(inv_[col * n_lost + k], pivot);
+        }
+
+        for (size_t r = 0; r < n_lost; r++) {
+            const uint8_t factor = mat_[r * n_lost + col];
+            if (r == col || factor == 0) {
+                continue;
+            }
+            gf256_madd(&mat_[r * n_lost], &mat_[col * n_lost], factor, n_lost);
+            gf256_madd(&inv_[r * n_lost], &inv_[col * n_lost], factor, n_lost);
+        }
+    }
+
+    return true;
+}
+
+core::Slice<uint8_t> Rs8mDecoder::make_buffer_() {
+    core::Slice<uint8_t> buffer = buffer_arena_.acquire(payload_size_);
+
+    if (!buffer) {
+        roc_log(LogError, "rs8m decoder: can't allocate buffer: size=%lu",
+                (unsigned long)payload_size_);
+        return core::Slice<uint8_t>();
+    }
+
+    return buffer;
+}
+
+void Rs8mDecoder::report_() {
+    size_t n_lost = 0, n_repaired = 0;
+
+    status_[sblen_] = ' ';
+    status_[sblen_ + rblen_ + 1] = '\0';
+
+    for (size_t i = 0; i < sblen_ + rblen_; i++) {
+        char* status = (i < sblen_ ? &status_[i] : &status_[i + 1]);
+
+        if (buff_tab_[i]) {
+            if (recv_tab_[i]) {
+                *status = '.';
+            } else {
+                *status = 'r';
+                n_repaired++;
+                n_lost++;
+            }
+        } else {
+            if (i < sblen_) {
+                *status = 'X';
+            } else {
+                *status = 'x';
+            }
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    roc_log(LogDebug, "rs8m decoder: repaired %u/%u/%u %s", (unsigned)n_repaired,
+            (unsigned)n_lost, (unsigned)buff_tab_.size(), &status_[0]);
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs8m_decoder.h
+//! @brief Built-in Reed-Solomon decoder over GF(2^8).
+
+#ifndef ROC_FEC_RS8M_DECODER_H_
+#define ROC_FEC_RS8M_DECODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_arena.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_decoder.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in Reed-Solomon decoder over GF(2^8).
+//!
+//! Counterpart of Rs8mEncoder. The code is MDS, so any sblen received
+//! symbols are enough to recover the whole block. Recovery inverts only
+//! the small submatrix for the lost source symbols; the per-byte work is
+//! done by the vectorized GF multiply-accumulate from gf256.h.
+class Rs8mDecoder : public IBlockDecoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit Rs8mDecoder(const CodecConfig& config,
+                         core::BufferPool<uint8_t>& buffer_pool,
+                         core::IAllocator& allocator);
+
+    virtual ~Rs8mDecoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store packet data for current block.
+    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+
+    //! Repair source packet buffer.
+    virtual core::Slice<uint8_t> repair(size_t index);
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { MaxBlockLength = 255 };
+
+    bool resize_tabs_(size_t size);
+    void reset_tabs_();
+
+    void try_repair_();
+    bool invert_matrix_(size_t n_lost);
+    core::Slice<uint8_t> make_buffer_();
+
+    void report_();
+
+    size_t sblen_;
+    size_t rblen_;
+
+    size_t payload_size_;
+
+    //! Recycles the repair scratch and recovered-symbol buffers across
+    //! blocks, so that steady-state decoding doesn't touch the pool.
+    core::BufferArena<uint8_t> buffer_arena_;
+
+    core::Array<core::Slice<uint8_t> > buff_tab_;
+    core::Array<bool> recv_tab_;
+
+    //! Right-hand side buffers for the recovery equations.
+    core::Array<core::Slice<uint8_t> > rhs_tab_;
+
+    //! Lost source symbols and the repair symbols chosen to recover them.
+    core::Array<size_t> lost_tab_;
+    core::Array<size_t> repair_tab_;
+
+    //! Submatrix for the lost symbols and its inverse.
+    core::Array<uint8_t> mat_;
+    core::Array<uint8_t> inv_;
+
+    core::Array<char> status_;
+
+    bool has_new_packets_;
+    bool decoding_failed_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS8M_DECODER_H_
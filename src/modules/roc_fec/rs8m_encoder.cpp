@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/rs8m_encoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+Rs8mEncoder::Rs8mEncoder(const CodecConfig& config,
+                         core::BufferPool<uint8_t>&,
+                         core::IAllocator& allocator)
+    : sblen_(0)
+    , rblen_(0)
+    , payload_size_(0)
+    , buff_tab_(allocator)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_ReedSolomon_M8) {
+        roc_panic("rs8m encoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "rs8m encoder: initializing: codec=rs8m");
+
+    valid_ = true;
+}
+
+Rs8mEncoder::~Rs8mEncoder() {
+}
+
+bool Rs8mEncoder::valid() const {
+    return valid_;
+}
+
+size_t Rs8mEncoder::alignment() const {
+    return Alignment;
+}
+
+size_t Rs8mEncoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return MaxBlockLength;
+}
+
+bool Rs8mEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "rs8m encoder: block length too large: sblen=%lu rblen=%lu",
+                (unsigned long)sblen, (unsigned long)rblen);
+        return false;
+    }
+
+    if (!buff_tab_.resize(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    rblen_ = rblen;
+    payload_size_ = payload_size;
+
+    return true;
+}
+
+void Rs8mEncoder::set(size_t index, const core::View<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + rblen_) {
+        roc_panic("rs8m encoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + rblen_));
+    }
+
+    if (!buffer) {
+        roc_panic("rs8m encoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("rs8m encoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    buff_tab_[index] = buffer;
+}
+
+void Rs8mEncoder::fill() {
+    roc_panic_if_not(valid());
+
+    for (size_t i = 0; i < sblen_ + rblen_; i++) {
+        if (!buff_tab_[i]) {
+            roc_panic("rs8m encoder: missing buffer: index=%lu", (unsigned long)i);
+        }
+    }
+
+    for (size_t r = 0; r < rblen_; r++) {
+        uint8_t* repair = buff_tab_[sblen_ + r].data();
+
+        memset(repair, 0, payload_size_);
+
+        for (size_t j = 0; j < sblen_; j++) {
+            gf256_madd(repair, buff_tab_[j].data(), gf256_cauchy(sblen_, r, j),
+                       payload_size_);
+        }
+    }
+}
+
+void Rs8mEncoder::end() {
+    roc_panic_if_not(valid());
+
+    for (size_t i = 0; i < buff_tab_.size(); i++) {
+        buff_tab_[i] = core::View<uint8_t>();
+    }
+}
+
+} // namespace fec
+} // namespace roc
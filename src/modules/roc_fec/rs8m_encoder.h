@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_fec/rs8m_encoder.h
+//! @brief Built-in Reed-Solomon encoder over GF(2^8).
+
+#ifndef ROC_FEC_RS8M_ENCODER_H_
+#define ROC_FEC_RS8M_ENCODER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/view.h"
+#include "roc_fec/codec_config.h"
+#include "roc_fec/iblock_encoder.h"
+
+namespace roc {
+namespace fec {
+
+//! Built-in Reed-Solomon encoder over GF(2^8).
+//!
+//! Systematic MDS code based on a Cauchy generator matrix. The GF
+//! multiply-accumulate inner loop is vectorized with shuffle-based
+//! table lookups when the CPU supports it, see gf256.h.
+class Rs8mEncoder : public IBlockEncoder, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    explicit Rs8mEncoder(const CodecConfig& config,
+                         core::BufferPool<uint8_t>& buffer_pool,
+                         core::IAllocator& allocator);
+
+    virtual ~Rs8mEncoder();
+
+    //! Check if object is successfully constructed.
+    bool valid() const;
+
+    //! Get buffer alignment requirement.
+    virtual size_t alignment() const;
+
+    //! Get the maximum number of encoding symbols for the scheme being used.
+    virtual size_t max_block_length() const;
+
+    //! Start block.
+    virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
+
+    //! Store packet data for current block.
+    virtual void set(size_t index, const core::View<uint8_t>& buffer);
+
+    //! Fill repair packets.
+    virtual void fill();
+
+    //! Finish block.
+    virtual void end();
+
+private:
+    enum { Alignment = 8, MaxBlockLength = 255 };
+
+    size_t sblen_;
+    size_t rblen_;
+
+    size_t payload_size_;
+
+    // non-owning: the writer holds the block packets while the
+    // encoder is between begin() and end()
+    core::Array<core::View<uint8_t> > buff_tab_;
+
+    bool valid_;
+};
+
+} // namespace fec
+} // namespace roc
+
+#endif // ROC_FEC_RS8M_ENCODER_H_
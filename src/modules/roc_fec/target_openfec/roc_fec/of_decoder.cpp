@@ -35,6 +35,9 @@ OFDecoder::OFDecoder(const CodecConfig& config,
     , status_(allocator)
     , has_new_packets_(false)
     , decoding_finished_(false)
+    , decode_budget_(config.decode_budget)
+    , decode_suspended_(false)
+    , decode_pos_(0)
     , valid_(false) {
     if (config.scheme == packet::FEC_ReedSolomon_M8) {
         roc_log(LogDebug, "of decoder: initializing: codec=rs m=%u",
@@ -95,7 +98,6 @@ bool OFDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
     max_index_ = 0;
 
     update_session_params_(sblen, rblen, payload_size);
-    reset_session_();
 
     return true;
 }
@@ -127,15 +129,6 @@ void OFDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
     data_tab_[index] = buffer.data();
     recv_tab_[index] = true;
 
-    // register new packet and try to repair more packets
-    roc_log(LogTrace, "of decoder: of_decode_with_new_symbol(): index=%lu",
-            (unsigned long)index);
-
-    if (of_decode_with_new_symbol(of_sess_, data_tab_[index], (unsigned int)index)
-        != OF_STATUS_OK) {
-        roc_panic("of decoder: can't add packet to OF session");
-    }
-
     if (max_index_ < index) {
         max_index_ = index;
     }
@@ -153,8 +146,9 @@ core::Slice<uint8_t> OFDecoder::repair(size_t index) {
 }
 
 void OFDecoder::end() {
+    report_();
+
     if (of_sess_ != NULL) {
-        report_();
         destroy_session_();
     }
 
@@ -162,6 +156,8 @@ void OFDecoder::end() {
 
     has_new_packets_ = false;
     decoding_finished_ = false;
+    decode_suspended_ = false;
+    decode_pos_ = 0;
 }
 
 void OFDecoder::update_session_params_(size_t sblen, size_t rblen, size_t payload_size) {
@@ -196,17 +192,17 @@ bool OFDecoder::resize_tabs_(size_t size) {
 }
 
 void OFDecoder::update_() {
-    roc_panic_if(of_sess_ == NULL);
-
-    if (!has_new_packets_) {
+    if (!has_new_packets_ && !decode_suspended_) {
         return;
     }
 
     decode_();
 
-    roc_log(LogTrace, "of decoder: of_get_source_symbols_tab()");
+    if (of_sess_ != NULL) {
+        roc_log(LogTrace, "of decoder: of_get_source_symbols_tab()");
 
-    of_get_source_symbols_tab(of_sess_, &data_tab_[0]);
+        of_get_source_symbols_tab(of_sess_, &data_tab_[0]);
+    }
 
     has_new_packets_ = false;
 }
@@ -220,23 +216,100 @@ void OFDecoder::decode_() {
         return;
     }
 
-    if (decoding_finished_) {
-        // it's not allowed to decode twice, so we recreate the session
+    // the clock is read once per BudgetCheckInterval symbols against this
+    // deadline; zero means no limit
+    const core::nanoseconds_t deadline =
+        decode_budget_ > 0 ? core::timestamp() + decode_budget_ : 0;
+
+    // A suspended solve is resumed only if no packets arrived meanwhile:
+    // a half-fed session can't consume symbols at already-fed positions,
+    // so with new packets we start over with a fresh session, which also
+    // has better chances to complete quickly.
+    if (decode_suspended_ && has_new_packets_) {
+        decode_suspended_ = false;
+    }
+
+    if (!decode_suspended_) {
+        // OpenFEC sessions are single-shot: it's not allowed to decode twice,
+        // so every solve attempt gets a fresh session; it's created only here,
+        // when a solve is actually attempted, so that blocks that never gather
+        // enough packets don't pay for session setup and teardown
         reset_session_();
+        decode_pos_ = 0;
+    }
+    decode_suspended_ = false;
+
+    // Feed symbols one by one and stop as soon as every source symbol is
+    // known. Iterative decoding recovers symbols progressively, so with a
+    // few losses the decode typically completes here, after consuming just
+    // enough repair symbols, and the full-block solve below is skipped;
+    // repair cost then scales with the loss count instead of block size.
+    roc_log(LogTrace, "of decoder: of_decode_with_new_symbol()");
+
+    bool complete = false;
+
+    for (; decode_pos_ < data_tab_.size(); decode_pos_++) {
+        if (!data_tab_[decode_pos_]) {
+            continue;
+        }
+
+        if (deadline != 0 && decode_pos_ % BudgetCheckInterval == 0
+            && core::timestamp() >= deadline) {
+            roc_log(LogDebug,
+                    "of decoder: decode budget exhausted, yielding: fed=%lu/%lu",
+                    (unsigned long)decode_pos_, (unsigned long)data_tab_.size());
+            decode_suspended_ = true;
+            return;
+        }
 
-        roc_log(LogTrace, "of decoder: of_set_available_symbols()");
+        if (of_decode_with_new_symbol(of_sess_, data_tab_[decode_pos_],
+                                      (uint32_t)decode_pos_)
+            != OF_STATUS_OK) {
+            roc_log(LogTrace, "of decoder: of_decode_with_new_symbol() returned error");
+            return;
+        }
 
-        if (of_set_available_symbols(of_sess_, &data_tab_[0]) != OF_STATUS_OK) {
-            roc_panic("of decoder: can't add packets to OF session");
+        if (of_is_decoding_complete(of_sess_)) {
+            complete = true;
+            break;
         }
     }
 
-    // try to repair more packets
-    roc_log(LogTrace, "of decoder: of_finish_decoding()");
+    if (!complete) {
+        // iterative decoding wasn't enough, fall back to the
+        // full-block maximum-likelihood solve
+        if (deadline != 0 && core::timestamp() >= deadline) {
+            // no budget left for the solve; yield and run it on the next
+            // call (the solve itself is a single opaque OpenFEC call and
+            // can't be preempted once started)
+            roc_log(LogDebug,
+                    "of decoder: decode budget exhausted before full-block solve,"
+                    " yielding");
+            decode_suspended_ = true;
+            return;
+        }
 
-    if (of_finish_decoding(of_sess_) != OF_STATUS_OK) {
-        roc_log(LogTrace, "of decoder: of_finish_decoding() returned error");
-        return;
+        roc_log(LogTrace, "of decoder: of_finish_decoding()");
+
+        const core::nanoseconds_t solve_start = core::timestamp();
+
+        const of_status_t status = of_finish_decoding(of_sess_);
+
+        if (decode_budget_ > 0) {
+            const core::nanoseconds_t solve_time = core::timestamp() - solve_start;
+            if (solve_time > decode_budget_) {
+                roc_log(LogDebug,
+                        "of decoder: full-block solve overran decode budget:"
+                        " time=%ldms budget=%ldms",
+                        (long)(solve_time / core::Millisecond),
+                        (long)(decode_budget_ / core::Millisecond));
+            }
+        }
+
+        if (status != OF_STATUS_OK) {
+            roc_log(LogTrace, "of decoder: of_finish_decoding() returned error");
+            return;
+        }
     }
 
     decoding_finished_ = true;
@@ -327,6 +400,10 @@ void OFDecoder::destroy_session_() {
 }
 
 void OFDecoder::report_() {
+    if (buff_tab_.size() == 0) {
+        return;
+    }
+
     size_t n_lost = 0, n_repaired = 0;
 
     size_t tab_size = max_index_;
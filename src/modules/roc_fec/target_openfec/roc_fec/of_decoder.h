@@ -17,6 +17,7 @@
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/time.h"
 #include "roc_fec/codec_config.h"
 #include "roc_fec/iblock_decoder.h"
 #include "roc_packet/units.h"
@@ -73,6 +74,10 @@ public:
     virtual void end();
 
 private:
+    //! How many symbols are fed to the codec between checks of the decode
+    //! budget; keeps the clock readings off the per-symbol fast path.
+    enum { BudgetCheckInterval = 8 };
+
     void update_session_params_(size_t sblen, size_t rblen, size_t payload_size);
 
     void reset_tabs_();
@@ -106,7 +111,8 @@ private:
         of_ldpc_parameters ldpc_params_;
     } codec_params_;
 
-    // session is recreated for every new block
+    // sessions are single-shot: one is created lazily when a solve is
+    // attempted, and recreated for every following solve
     of_session_t* of_sess_;
     of_parameters_t* of_sess_params_;
 
@@ -128,6 +134,16 @@ private:
     bool has_new_packets_;
     bool decoding_finished_;
 
+    // per-call decode budget, or zero for no limit
+    const core::nanoseconds_t decode_budget_;
+
+    // true if the solve ran out of budget and yielded; the next call
+    // resumes it instead of starting over
+    bool decode_suspended_;
+
+    // index of the next symbol to feed into the suspended session
+    size_t decode_pos_;
+
     size_t max_block_length_;
 
     bool valid_;
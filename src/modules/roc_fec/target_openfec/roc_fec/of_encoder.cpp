@@ -94,7 +94,7 @@ bool OFEncoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
     return true;
 }
 
-void OFEncoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+void OFEncoder::set(size_t index, const core::View<uint8_t>& buffer) {
     roc_panic_if_not(valid());
 
     if (index >= sblen_ + rblen_) {
@@ -139,7 +139,7 @@ void OFEncoder::end() {
 
     for (size_t i = 0; i < buff_tab_.size(); ++i) {
         data_tab_[i] = NULL;
-        buff_tab_[i] = core::Slice<uint8_t>();
+        buff_tab_[i] = core::View<uint8_t>();
     }
 }
 
@@ -17,6 +17,7 @@
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/view.h"
 #include "roc_fec/codec_config.h"
 #include "roc_fec/iblock_encoder.h"
 #include "roc_packet/units.h"
@@ -63,7 +64,7 @@ public:
     virtual bool begin(size_t sblen, size_t rblen, size_t payload_size);
 
     //! Store packet data for current block.
-    virtual void set(size_t index, const core::Slice<uint8_t>& buffer);
+    virtual void set(size_t index, const core::View<uint8_t>& buffer);
 
     //! Fill repair packets.
     virtual void fill();
@@ -96,7 +97,9 @@ private:
         of_rs_2_m_parameters_t rs_params_;
     } codec_params_;
 
-    core::Array<core::Slice<uint8_t> > buff_tab_;
+    // non-owning: the writer holds the block packets while the
+    // encoder is between begin() and end()
+    core::Array<core::View<uint8_t> > buff_tab_;
     core::Array<void*> data_tab_;
 
     size_t max_block_length_;
@@ -34,21 +34,48 @@ Writer::Writer(const WriterConfig& config,
     , source_composer_(source_composer)
     , repair_composer_(repair_composer)
     , packet_pool_(packet_pool)
-    , buffer_pool_(buffer_pool)
+    , buffer_arena_(buffer_pool, allocator)
     , repair_block_(allocator)
     , first_packet_(true)
     , cur_sbn_((packet::blknum_t)core::random(packet::blknum_t(-1)))
     , cur_block_repair_sn_((packet::seqnum_t)core::random(packet::seqnum_t(-1)))
     , cur_packet_(0)
+    , streaming_(false)
+    , next_repair_(0)
     , fec_scheme_(fec_scheme)
+    , enc_cond_(enc_mutex_)
+    , enc_pending_(false)
+    , enc_stop_(false)
     , valid_(false)
     , alive_(true) {
     if (!resize(config.n_source_packets, config.n_repair_packets)) {
         return;
     }
+
+    if (config.async_encoding) {
+        enc_thread_.reset(new (allocator) EncodeThread(*this), allocator);
+        if (!enc_thread_ || !enc_thread_->start()) {
+            roc_log(LogError, "fec writer: can't start encoder thread");
+            enc_thread_.reset();
+            return;
+        }
+        roc_log(LogDebug, "fec writer: using asynchronous encoding");
+    }
+
     valid_ = true;
 }
 
+Writer::~Writer() {
+    if (enc_thread_) {
+        {
+            core::Mutex::Lock lock(enc_mutex_);
+            enc_stop_ = true;
+            enc_cond_.broadcast();
+        }
+        enc_thread_->join();
+    }
+}
+
 bool Writer::valid() const {
     return valid_;
 }
@@ -106,6 +133,11 @@ void Writer::write(const packet::PacketPtr& pp) {
     }
 
     if (cur_packet_ == 0) {
+        if (enc_thread_) {
+            // the encoder and the repair block are reused for the new
+            // block, wait until the previous block is fully encoded
+            wait_encoder_();
+        }
         if (!begin_block_(pp)) {
             return;
         }
@@ -119,6 +151,10 @@ void Writer::write(const packet::PacketPtr& pp) {
 
     cur_packet_++;
 
+    if (streaming_) {
+        emit_ready_repairs_();
+    }
+
     if (cur_packet_ == cur_sblen_) {
         end_block_();
         next_block_();
@@ -143,18 +179,123 @@ bool Writer::begin_block_(const packet::PacketPtr& pp) {
         return (alive_ = false);
     }
 
+    // sliding-window codecs report repair packets ready before the block
+    // ends; emit them inline as their windows complete, instead of in a
+    // burst at the block end
+    streaming_ = cur_rblen_ > 0 && encoder_.repair_ready(cur_rblen_ - 1, cur_sblen_);
+    next_repair_ = 0;
+
+    if (streaming_ && buffer_arena_.size() < cur_rblen_ * 2) {
+        (void)buffer_arena_.resize(cur_rblen_ * 2);
+    }
+
     return true;
 }
 
 void Writer::end_block_() {
-    make_repair_packets_();
-    encode_repair_packets_();
-    compose_repair_packets_();
-    write_repair_packets_();
+    if (streaming_) {
+        // all repair packets have been emitted inline by now
+        encoder_.end();
+        return;
+    }
+
+    BlockParams params;
+    params.sblen = cur_sblen_;
+    params.rblen = cur_rblen_;
+    params.payload_size = cur_payload_size_;
+    params.sbn = cur_sbn_;
+
+    if (enc_thread_) {
+        core::Mutex::Lock lock(enc_mutex_);
+
+        enc_job_ = params;
+        enc_pending_ = true;
+        enc_cond_.broadcast();
+
+        return;
+    }
+
+    encode_block_(params);
+}
+
+void Writer::encode_block_(const BlockParams& params) {
+    make_repair_packets_(params);
+    encode_repair_packets_(params);
+    compose_repair_packets_(params);
+    write_repair_packets_(params);
 
     encoder_.end();
 }
 
+void Writer::encode_loop_() {
+    for (;;) {
+        BlockParams params;
+        {
+            core::Mutex::Lock lock(enc_mutex_);
+
+            while (!enc_pending_ && !enc_stop_) {
+                enc_cond_.wait();
+            }
+
+            if (!enc_pending_) {
+                return;
+            }
+
+            params = enc_job_;
+        }
+
+        encode_block_(params);
+
+        {
+            core::Mutex::Lock lock(enc_mutex_);
+
+            enc_pending_ = false;
+            enc_cond_.broadcast();
+
+            if (enc_stop_) {
+                return;
+            }
+        }
+    }
+}
+
+void Writer::wait_encoder_() {
+    core::Mutex::Lock lock(enc_mutex_);
+
+    while (enc_pending_) {
+        enc_cond_.wait();
+    }
+}
+
+void Writer::emit_ready_repairs_() {
+    BlockParams params;
+    params.sblen = cur_sblen_;
+    params.rblen = cur_rblen_;
+    params.payload_size = cur_payload_size_;
+    params.sbn = cur_sbn_;
+
+    while (next_repair_ < cur_rblen_
+           && encoder_.repair_ready(next_repair_, cur_packet_)) {
+        packet::PacketPtr rp =
+            make_repair_packet_((packet::seqnum_t)next_repair_, params);
+
+        if (rp) {
+            encoder_.set(cur_sblen_ + next_repair_, rp->fec()->payload);
+            encoder_.fill_repair(next_repair_);
+
+            rp->add_flags(packet::Packet::FlagComposed);
+
+            if (!repair_composer_.compose(*rp)) {
+                roc_panic("fec writer: can't compose repair packet");
+            }
+
+            writer_.write(rp);
+        }
+
+        next_repair_++;
+    }
+}
+
 void Writer::next_block_() {
     cur_block_repair_sn_ += cur_rblen_;
     cur_sbn_++;
@@ -187,8 +328,14 @@ bool Writer::apply_sizes_(size_t sblen, size_t rblen, size_t payload_size) {
 void Writer::write_source_packet_(const packet::PacketPtr& pp) {
     encoder_.set(cur_packet_, pp->fec()->payload);
 
+    BlockParams params;
+    params.sblen = cur_sblen_;
+    params.rblen = cur_rblen_;
+    params.payload_size = cur_payload_size_;
+    params.sbn = cur_sbn_;
+
     pp->add_flags(packet::Packet::FlagComposed);
-    fill_packet_fec_fields_(pp, (packet::seqnum_t)cur_packet_);
+    fill_packet_fec_fields_(pp, (packet::seqnum_t)cur_packet_, params);
 
     if (!source_composer_.compose(*pp)) {
         roc_panic("fec writer: can't compose source packet");
@@ -197,9 +344,16 @@ void Writer::write_source_packet_(const packet::PacketPtr& pp) {
     writer_.write(pp);
 }
 
-void Writer::make_repair_packets_() {
-    for (size_t i = 0; i < cur_rblen_; i++) {
-        packet::PacketPtr rp = make_repair_packet_((packet::seqnum_t)i);
+void Writer::make_repair_packets_(const BlockParams& params) {
+    // the previous block's repair packets may still sit in the network
+    // queue, so two blocks of slack are retained; if the resize fails,
+    // the arena degrades to plain pool allocation
+    if (buffer_arena_.size() < params.rblen * 2) {
+        (void)buffer_arena_.resize(params.rblen * 2);
+    }
+
+    for (size_t i = 0; i < params.rblen; i++) {
+        packet::PacketPtr rp = make_repair_packet_((packet::seqnum_t)i, params);
         if (!rp) {
             continue;
         }
@@ -207,14 +361,15 @@ void Writer::make_repair_packets_() {
     }
 }
 
-packet::PacketPtr Writer::make_repair_packet_(packet::seqnum_t pack_n) {
+packet::PacketPtr Writer::make_repair_packet_(packet::seqnum_t pack_n,
+                                              const BlockParams& params) {
     packet::PacketPtr packet = new (packet_pool_) packet::Packet(packet_pool_);
     if (!packet) {
         roc_log(LogError, "fec writer: can't allocate packet");
         return NULL;
     }
 
-    core::Slice<uint8_t> data = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+    core::Slice<uint8_t> data = buffer_arena_.acquire();
     if (!data) {
         roc_log(LogError, "fec writer: can't allocate buffer");
         return NULL;
@@ -225,7 +380,7 @@ packet::PacketPtr Writer::make_repair_packet_(packet::seqnum_t pack_n) {
         return NULL;
     }
 
-    if (!repair_composer_.prepare(*packet, data, cur_payload_size_)) {
+    if (!repair_composer_.prepare(*packet, data, params.payload_size)) {
         roc_log(LogError, "fec writer: can't prepare packet");
         return NULL;
     }
@@ -238,23 +393,23 @@ packet::PacketPtr Writer::make_repair_packet_(packet::seqnum_t pack_n) {
     packet->set_data(data);
 
     validate_fec_packet_(packet);
-    fill_packet_fec_fields_(packet, (packet::seqnum_t)cur_sblen_ + pack_n);
+    fill_packet_fec_fields_(packet, (packet::seqnum_t)params.sblen + pack_n, params);
 
     return packet;
 }
 
-void Writer::encode_repair_packets_() {
-    for (size_t i = 0; i < cur_rblen_; i++) {
+void Writer::encode_repair_packets_(const BlockParams& params) {
+    for (size_t i = 0; i < params.rblen; i++) {
         packet::PacketPtr rp = repair_block_[i];
         if (rp) {
-            encoder_.set(cur_sblen_ + i, rp->fec()->payload);
+            encoder_.set(params.sblen + i, rp->fec()->payload);
         }
     }
     encoder_.fill();
 }
 
-void Writer::compose_repair_packets_() {
-    for (size_t i = 0; i < cur_rblen_; i++) {
+void Writer::compose_repair_packets_(const BlockParams& params) {
+    for (size_t i = 0; i < params.rblen; i++) {
         packet::PacketPtr rp = repair_block_[i];
         if (!rp) {
             continue;
@@ -268,8 +423,8 @@ void Writer::compose_repair_packets_() {
     }
 }
 
-void Writer::write_repair_packets_() {
-    for (size_t i = 0; i < cur_rblen_; i++) {
+void Writer::write_repair_packets_(const BlockParams& params) {
+    for (size_t i = 0; i < params.rblen; i++) {
         packet::PacketPtr rp = repair_block_[i];
         if (rp) {
             writer_.write(repair_block_[i]);
@@ -279,13 +434,14 @@ void Writer::write_repair_packets_() {
 }
 
 void Writer::fill_packet_fec_fields_(const packet::PacketPtr& packet,
-                                     packet::seqnum_t pack_n) {
+                                     packet::seqnum_t pack_n,
+                                     const BlockParams& params) {
     packet::FEC& fec = *packet->fec();
 
     fec.encoding_symbol_id = pack_n;
-    fec.source_block_number = cur_sbn_;
-    fec.source_block_length = cur_sblen_;
-    fec.block_length = cur_sblen_ + cur_rblen_;
+    fec.source_block_number = params.sbn;
+    fec.source_block_length = params.sblen;
+    fec.block_length = params.sblen + params.rblen;
 }
 
 void Writer::validate_fec_packet_(const packet::PacketPtr& pp) {
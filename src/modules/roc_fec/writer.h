@@ -13,10 +13,15 @@
 #define ROC_FEC_WRITER_H_
 
 #include "roc_core/array.h"
+#include "roc_core/buffer_arena.h"
 #include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
+#include "roc_core/thread.h"
+#include "roc_core/unique_ptr.h"
 #include "roc_fec/iblock_encoder.h"
 #include "roc_packet/icomposer.h"
 #include "roc_packet/iwriter.h"
@@ -34,9 +39,19 @@ struct WriterConfig {
     //! Number of FEC packets in block.
     size_t n_repair_packets;
 
+    //! Encode repair packets on a separate thread.
+    //! @remarks
+    //!  When enabled, completed source blocks are handed to a worker
+    //!  thread that runs the block encoder and writes repair packets to
+    //!  the output writer, so that the thread calling write() is not
+    //!  blocked by FEC math. The output writer should be thread-safe in
+    //!  this mode.
+    bool async_encoding;
+
     WriterConfig()
         : n_source_packets(20)
-        , n_repair_packets(10) {
+        , n_repair_packets(10)
+        , async_encoding(false) {
     }
 };
 
@@ -64,6 +79,9 @@ public:
            core::BufferPool<uint8_t>& buffer_pool,
            core::IAllocator& allocator);
 
+    //! Destroy. Stops the encoder thread if it was started.
+    ~Writer();
+
     //! Check if object is successfully constructed.
     bool valid() const;
 
@@ -80,19 +98,57 @@ public:
     virtual void write(const packet::PacketPtr&);
 
 private:
+    //! Parameters of a completed block, snapshotted for the encoder.
+    struct BlockParams {
+        size_t sblen;
+        size_t rblen;
+        size_t payload_size;
+        packet::blknum_t sbn;
+
+        BlockParams()
+            : sblen(0)
+            , rblen(0)
+            , payload_size(0)
+            , sbn(0) {
+        }
+    };
+
+    class EncodeThread : public core::Thread {
+    public:
+        explicit EncodeThread(Writer& writer)
+            : writer_(writer) {
+        }
+
+    private:
+        virtual void run() {
+            writer_.encode_loop_();
+        }
+
+        Writer& writer_;
+    };
+
+    friend class EncodeThread;
+
     bool begin_block_(const packet::PacketPtr& pp);
     void end_block_();
     void next_block_();
 
+    void emit_ready_repairs_();
+
     bool apply_sizes_(size_t sblen, size_t rblen, size_t payload_size);
 
     void write_source_packet_(const packet::PacketPtr&);
-    void make_repair_packets_();
-    packet::PacketPtr make_repair_packet_(packet::seqnum_t n);
-    void encode_repair_packets_();
-    void compose_repair_packets_();
-    void write_repair_packets_();
-    void fill_packet_fec_fields_(const packet::PacketPtr& packet, packet::seqnum_t n);
+    void encode_block_(const BlockParams& params);
+    void encode_loop_();
+    void wait_encoder_();
+    void make_repair_packets_(const BlockParams& params);
+    packet::PacketPtr make_repair_packet_(packet::seqnum_t n, const BlockParams& params);
+    void encode_repair_packets_(const BlockParams& params);
+    void compose_repair_packets_(const BlockParams& params);
+    void write_repair_packets_(const BlockParams& params);
+    void fill_packet_fec_fields_(const packet::PacketPtr& packet,
+                                 packet::seqnum_t pack_n,
+                                 const BlockParams& params);
 
     void validate_fec_packet_(const packet::PacketPtr&);
     bool validate_source_packet_(const packet::PacketPtr&);
@@ -112,9 +168,14 @@ private:
     packet::IComposer& repair_composer_;
 
     packet::PacketPool& packet_pool_;
-    core::BufferPool<uint8_t>& buffer_pool_;
 
-    core::Array<packet::PacketPtr> repair_block_;
+    // recycles repair packet payload buffers across blocks once the
+    // previous packets have been sent and released
+    core::BufferArena<uint8_t> buffer_arena_;
+
+    // embedded capacity covers the default block size, so that typical
+    // blocks don't pay a heap allocation per writer
+    core::Array<packet::PacketPtr, 16> repair_block_;
 
     bool first_packet_;
 
@@ -123,8 +184,22 @@ private:
 
     size_t cur_packet_;
 
+    // true if the encoder reports repair packets ready before the block
+    // ends (sliding-window codecs); such packets are encoded and written
+    // inline as their windows complete, instead of in a burst at the
+    // block end
+    bool streaming_;
+    size_t next_repair_;
+
     const packet::FECScheme fec_scheme_;
 
+    core::Mutex enc_mutex_;
+    core::Cond enc_cond_;
+    BlockParams enc_job_;
+    bool enc_pending_;
+    bool enc_stop_;
+    core::UniquePtr<EncodeThread> enc_thread_;
+
     bool valid_;
     bool alive_;
 };
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_fec/xor_decoder.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+XorDecoder::XorDecoder(const CodecConfig& config,
+                       core::BufferPool<uint8_t>& buffer_pool,
+                       core::IAllocator& allocator)
+    : sblen_(0)
+    , payload_size_(0)
+    , buffer_arena_(buffer_pool, allocator)
+    , buff_tab_(allocator)
+    , recv_tab_(allocator)
+    , status_(allocator)
+    , has_new_packets_(false)
+    , decoding_failed_(false)
+    , valid_(false) {
+    if (config.scheme != packet::FEC_XOR) {
+        roc_panic("xor decoder: unexpected fec scheme");
+    }
+
+    roc_log(LogDebug, "xor decoder: initializing: codec=xor");
+
+    valid_ = true;
+}
+
+XorDecoder::~XorDecoder() {
+}
+
+bool XorDecoder::valid() const {
+    return valid_;
+}
+
+size_t XorDecoder::max_block_length() const {
+    roc_panic_if_not(valid());
+
+    return MaxBlockLength;
+}
+
+bool XorDecoder::begin(size_t sblen, size_t rblen, size_t payload_size) {
+    roc_panic_if_not(valid());
+
+    if (rblen != 1) {
+        roc_log(LogError,
+                "xor decoder: scheme supports exactly one repair packet: rblen=%lu",
+                (unsigned long)rblen);
+        return false;
+    }
+
+    if (sblen + rblen > MaxBlockLength) {
+        roc_log(LogError, "xor decoder: block length too large: sblen=%lu rblen=%lu",
+                (unsigned long)sblen, (unsigned long)rblen);
+        return false;
+    }
+
+    if (!resize_tabs_(sblen + rblen)) {
+        return false;
+    }
+
+    sblen_ = sblen;
+    payload_size_ = payload_size;
+
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+
+    return true;
+}
+
+void XorDecoder::set(size_t index, const core::Slice<uint8_t>& buffer) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + 1) {
+        roc_panic("xor decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + 1));
+    }
+
+    if (!buffer) {
+        roc_panic("xor decoder: null buffer");
+    }
+
+    if (buffer.size() == 0 || buffer.size() != payload_size_) {
+        roc_panic("xor decoder: invalid payload size: cur=%lu new=%lu",
+                  (unsigned long)payload_size_, (unsigned long)buffer.size());
+    }
+
+    if (buff_tab_[index]) {
+        roc_panic("xor decoder: can't overwrite buffer: index=%lu", (unsigned long)index);
+    }
+
+    buff_tab_[index] = buffer;
+    recv_tab_[index] = true;
+
+    has_new_packets_ = true;
+}
+
+core::Slice<uint8_t> XorDecoder::repair(size_t index) {
+    roc_panic_if_not(valid());
+
+    if (index >= sblen_ + 1) {
+        roc_panic("xor decoder: index out of bounds: index=%lu size=%lu",
+                  (unsigned long)index, (unsigned long)(sblen_ + 1));
+    }
+
+    if (!buff_tab_[index] && has_new_packets_) {
+        try_repair_();
+        has_new_packets_ = false;
+    }
+
+    return buff_tab_[index];
+}
+
+void XorDecoder::end() {
+    roc_panic_if_not(valid());
+
+    report_();
+    reset_tabs_();
+
+    has_new_packets_ = false;
+    decoding_failed_ = false;
+}
+
+bool XorDecoder::resize_tabs_(size_t size) {
+    // recovered buffers from recent blocks may still be referenced
+    // downstream, so a block-sized arena leaves enough slack to keep
+    // steady-state decoding free of pool operations
+    if (buffer_arena_.size() < size && !buffer_arena_.resize(size)) {
+        return false;
+    }
+    if (!buff_tab_.resize(size)) {
+        return false;
+    }
+    if (!recv_tab_.resize(size)) {
+        return false;
+    }
+    if (!status_.resize(size + 2)) {
+        return false;
+    }
+
+    return true;
+}
+
+void XorDecoder::reset_tabs_() {
+    for (size_t i = 0; i < buff_tab_.size(); i++) {
+        buff_tab_[i] = core::Slice<uint8_t>();
+        recv_tab_[i] = false;
+    }
+}
+
+// Recover a single lost source packet by xoring the parity packet with
+// all received source packets. The parity packet is the xor of all
+// source packets, so what remains is the lost one.
+void XorDecoder::try_repair_() {
+    if (decoding_failed_) {
+        return;
+    }
+
+    if (!buff_tab_[sblen_]) {
+        // parity packet is lost, nothing to repair with
+        return;
+    }
+
+    size_t n_lost = 0;
+    size_t lost_index = 0;
+
+    for (size_t j = 0; j < sblen_; j++) {
+        if (!buff_tab_[j]) {
+            n_lost++;
+            lost_index = j;
+        }
+    }
+
+    if (n_lost != 1) {
+        // either nothing to do, or more losses than the code can repair
+        return;
+    }
+
+    core::Slice<uint8_t> buffer = make_buffer_();
+    if (!buffer) {
+        decoding_failed_ = true;
+        return;
+    }
+
+    uint8_t* data = buffer.data();
+
+    memcpy(data, buff_tab_[sblen_].data(), payload_size_);
+
+    for (size_t j = 0; j < sblen_; j++) {
+        if (buff_tab_[j]) {
+            gf256_add(data, buff_tab_[j].data(), payload_size_);
+        }
+    }
+
+    buff_tab_[lost_index] = buffer;
+}
+
+core::Slice<uint8_t> XorDecoder::make_buffer_() {
+    core::Slice<uint8_t> buffer = buffer_arena_.acquire(payload_size_);
+
+    if (!buffer) {
+        roc_log(LogError, "xor decoder: can't allocate buffer: size=%lu",
+                (unsigned long)payload_size_);
+        return core::Slice<uint8_t>();
+    }
+
+    return buffer;
+}
+
+void XorDecoder::report_() {
+    size_t n_lost = 0, n_repaired = 0;
+
+    status_[sblen_] = ' ';
+    status_[sblen_ + 2] = '\0';
+
+    for (size_t i = 0; i < sblen_ + 1; i++) {
+        char* status = (i < sblen_ ? &status_[i] : &status_[i + 1]);
+
+        if (buff_tab_[i]) {
+            if (recv_tab_[i]) {
+                *status = '.';
+            } else {
+                *status = 'r';
+                n_repaired++;
+                n_lost++;
+            }
+        } else {
+            if (i < sblen_) {
+                *status = 'X';
+            } else {
+                *status = 'x';
+            }
+            n_lost++;
+        }
+    }
+
+    if (n_lost == 0) {
+        return;
+    }
+
+    roc_log(LogDebug, "xor decoder: repaired %u/%u/%u %s", (unsigned)n_repaired,
+            (unsigned)n_lost, (unsigned)buff_tab_.size(), &status_[0]);
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/transceiver.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <ifaddrs.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+Transceiver::Transceiver(packet::PacketPool& packet_pool,
+                         core::BufferPool<uint8_t>& buffer_pool,
+                         core::IAllocator& allocator)
+    : packet_pool_(packet_pool)
+    , buffer_pool_(buffer_pool)
+    , allocator_(allocator)
+    , started_(false)
+    , wake_fd_(-1)
+    , cond_(mutex_) {
+    wake_fd_ = eventfd(0, EFD_NONBLOCK);
+    if (wake_fd_ < 0) {
+        roc_log(LogError, "transceiver: eventfd(): errno=%d", errno);
+        return;
+    }
+
+    started_ = Thread::start();
+}
+
+Transceiver::~Transceiver() {
+    if (started_) {
+        stop_ = 1;
+        wake_();
+
+        Thread::join();
+    }
+
+    // the loop thread is gone; close what remains inline
+    while (core::SharedPtr<BasicPort> port = open_ports_.front()) {
+        port->async_close();
+    }
+
+    while (core::SharedPtr<XdpInterface> iface = ifaces_.front()) {
+        ifaces_.remove(*iface);
+        iface->close();
+    }
+
+    if (wake_fd_ >= 0) {
+        ::close(wake_fd_);
+    }
+
+    roc_panic_if(joinable());
+    roc_panic_if(open_ports_.size());
+}
+
+bool Transceiver::valid() const {
+    return started_;
+}
+
+size_t Transceiver::num_ports() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return open_ports_.size();
+}
+
+bool Transceiver::add_udp_receiver(packet::Address& bind_address,
+                                   packet::IWriter& writer) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::add_udp_receiver_;
+    task.address = &bind_address;
+    task.writer = &writer;
+
+    run_task_(task);
+
+    return task.result;
+}
+
+packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::add_udp_sender_;
+    task.address = &bind_address;
+
+    run_task_(task);
+
+    if (!task.result) {
+        return NULL;
+    }
+
+    return static_cast<UDPSenderPort*>(task.port);
+}
+
+void Transceiver::remove_port(packet::Address bind_address) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::remove_port_;
+    task.address = &bind_address;
+
+    run_task_(task);
+
+    if (!task.result) {
+        roc_panic("transceiver: can't remove port %s: unknown port",
+                  packet::address_to_str(bind_address).c_str());
+    }
+}
+
+void Transceiver::handle_closed(BasicPort& port) {
+    // a port whose open() failed is closed before being added to the list
+    for (core::SharedPtr<BasicPort> p = open_ports_.front(); p;
+         p = open_ports_.nextof(*p)) {
+        if (p.get() == &port) {
+            open_ports_.remove(port);
+            return;
+        }
+    }
+}
+
+void Transceiver::run() {
+    roc_log(LogDebug, "transceiver: starting event loop");
+
+    while (!stop_) {
+        struct pollfd fds[MaxPollFds];
+        XdpInterface* fd_ifaces[MaxPollFds];
+        size_t fd_sockets[MaxPollFds];
+
+        fds[0].fd = wake_fd_;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+
+        size_t n_fds = 1;
+        for (core::SharedPtr<XdpInterface> iface = ifaces_.front(); iface;
+             iface = ifaces_.nextof(*iface)) {
+            for (size_t s = 0; s < iface->num_sockets() && n_fds < MaxPollFds; s++) {
+                fds[n_fds].fd = iface->socket_fd(s);
+                fds[n_fds].events = POLLIN;
+                fds[n_fds].revents = 0;
+                fd_ifaces[n_fds] = iface.get();
+                fd_sockets[n_fds] = s;
+                n_fds++;
+            }
+        }
+
+        if (poll(fds, (nfds_t)n_fds, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            roc_log(LogError, "transceiver: poll(): errno=%d", errno);
+            break;
+        }
+
+        if (fds[0].revents & POLLIN) {
+            uint64_t value = 0;
+            while (read(wake_fd_, &value, sizeof(value)) > 0) {
+            }
+            process_tasks_();
+        }
+
+        for (size_t n = 1; n < n_fds; n++) {
+            if (fds[n].revents & POLLIN) {
+                fd_ifaces[n]->process_socket(fd_sockets[n]);
+            }
+        }
+    }
+
+    process_tasks_();
+
+    roc_log(LogDebug, "transceiver: finishing event loop");
+}
+
+void Transceiver::wake_() {
+    const uint64_t value = 1;
+    if (write(wake_fd_, &value, sizeof(value)) != sizeof(value)) {
+        roc_panic("transceiver: can't write to wake descriptor");
+    }
+}
+
+void Transceiver::run_task_(Task& task) {
+    core::Mutex::Lock lock(mutex_);
+
+    tasks_.push_back(task);
+
+    wake_();
+
+    while (!task.done) {
+        cond_.wait();
+    }
+}
+
+void Transceiver::process_tasks_() {
+    core::Mutex::Lock lock(mutex_);
+
+    while (Task* task = tasks_.front()) {
+        tasks_.remove(*task);
+
+        task->result = (this->*(task->fn))(*task);
+        task->done = true;
+    }
+
+    cond_.broadcast();
+}
+
+bool Transceiver::add_udp_receiver_(Task& task) {
+    core::SharedPtr<XdpInterface> iface = find_iface_(*task.address);
+    if (!iface) {
+        return false;
+    }
+
+    core::SharedPtr<BasicPort> rp = new (allocator_)
+        UDPReceiverPort(*this, *task.address, iface, *task.writer, allocator_);
+
+    if (!rp) {
+        roc_log(LogError, "transceiver: can't add port %s: can't allocate receiver",
+                packet::address_to_str(*task.address).c_str());
+        return false;
+    }
+
+    if (!rp->open()) {
+        roc_log(LogError, "transceiver: can't add port %s: can't start receiver",
+                packet::address_to_str(*task.address).c_str());
+
+        rp->async_close();
+        return false;
+    }
+
+    open_ports_.push_back(*rp);
+
+    return true;
+}
+
+bool Transceiver::add_udp_sender_(Task& task) {
+    core::SharedPtr<BasicPort> sp =
+        new (allocator_) UDPSenderPort(*this, *task.address, allocator_);
+
+    if (!sp) {
+        roc_log(LogError, "transceiver: can't add port %s: can't allocate sender",
+                packet::address_to_str(*task.address).c_str());
+        return false;
+    }
+
+    if (!sp->open()) {
+        roc_log(LogError, "transceiver: can't add port %s: can't start sender",
+                packet::address_to_str(*task.address).c_str());
+
+        sp->async_close();
+        return false;
+    }
+
+    open_ports_.push_back(*sp);
+    task.port = sp.get();
+
+    // write the selected ephemeral port back to the caller
+    *task.address = sp->address();
+
+    return true;
+}
+
+bool Transceiver::remove_port_(Task& task) {
+    for (core::SharedPtr<BasicPort> port = open_ports_.front(); port;
+         port = open_ports_.nextof(*port)) {
+        if (port->address() == *task.address) {
+            port->async_close();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Find or create the per-interface state for the given bind address.
+core::SharedPtr<XdpInterface> Transceiver::find_iface_(
+    const packet::Address& bind_address) {
+    char ifname[IF_NAMESIZE] = {};
+    int ifindex = -1;
+
+    if (!resolve_iface_(bind_address, ifname, sizeof(ifname), ifindex)) {
+        roc_log(LogError,
+                "transceiver: can't add port %s:"
+                " bind address should be the explicit IPv4 address of an interface"
+                " and carry a non-zero port",
+                packet::address_to_str(bind_address).c_str());
+        return NULL;
+    }
+
+    for (core::SharedPtr<XdpInterface> iface = ifaces_.front(); iface;
+         iface = ifaces_.nextof(*iface)) {
+        if (iface->ifindex() == ifindex) {
+            return iface;
+        }
+    }
+
+    core::SharedPtr<XdpInterface> iface =
+        new (allocator_) XdpInterface(packet_pool_, buffer_pool_, allocator_);
+
+    if (!iface) {
+        roc_log(LogError, "transceiver: can't allocate interface state: if=%s", ifname);
+        return NULL;
+    }
+
+    if (!iface->open(ifname, ifindex)) {
+        return NULL;
+    }
+
+    ifaces_.push_back(*iface);
+
+    return iface;
+}
+
+// Map a bind address to the interface owning it.
+bool Transceiver::resolve_iface_(const packet::Address& bind_address,
+                                 char* ifname,
+                                 size_t ifname_size,
+                                 int& ifindex) {
+    if (bind_address.version() != 4 || bind_address.port() == 0) {
+        return false;
+    }
+
+    const struct sockaddr_in* bind_sa =
+        (const struct sockaddr_in*)bind_address.saddr();
+
+    if (bind_sa->sin_addr.s_addr == htonl(INADDR_ANY)) {
+        return false;
+    }
+
+    struct ifaddrs* addrs = NULL;
+    if (getifaddrs(&addrs) != 0) {
+        roc_log(LogError, "transceiver: getifaddrs(): errno=%d", errno);
+        return false;
+    }
+
+    bool found = false;
+
+    for (const struct ifaddrs* ifa = addrs; ifa; ifa = ifa->ifa_next) {
+        if (!ifa->ifa_addr || ifa->ifa_addr->sa_family != AF_INET) {
+            continue;
+        }
+
+        const struct sockaddr_in* if_sa = (const struct sockaddr_in*)ifa->ifa_addr;
+        if (if_sa->sin_addr.s_addr != bind_sa->sin_addr.s_addr) {
+            continue;
+        }
+
+        strncpy(ifname, ifa->ifa_name, ifname_size - 1);
+        ifindex = (int)if_nametoindex(ifa->ifa_name);
+
+        found = (ifindex > 0);
+        break;
+    }
+
+    freeifaddrs(addrs);
+
+    return found;
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/transceiver.h
+//! @brief Network sender/receiver.
+
+#ifndef ROC_NETIO_TRANSCEIVER_H_
+#define ROC_NETIO_TRANSCEIVER_H_
+
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/list_node.h"
+#include "roc_core/mutex.h"
+#include "roc_core/thread.h"
+#include "roc_netio/basic_port.h"
+#include "roc_netio/iclose_handler.h"
+#include "roc_netio/udp_receiver_port.h"
+#include "roc_netio/udp_sender_port.h"
+#include "roc_netio/xdp_interface.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace netio {
+
+//! Network sender/receiver.
+//!
+//! Experimental AF_XDP backend: receiver ports claim their UDP flows
+//! directly from the NIC receive queues with an XDP redirect program and
+//! AF_XDP sockets, bypassing the kernel network stack. Intended for
+//! dedicated receiver appliances terminating many streams on one
+//! interface.
+//!
+//! Restrictions compared to the default backend:
+//!  - receiver bind addresses must carry an explicit interface IPv4
+//!    address and a non-zero port;
+//!  - requires CAP_NET_ADMIN (or root) to attach the XDP program;
+//!  - IPv6, IP fragments and VLAN-tagged traffic are not accelerated
+//!    (such datagrams stay with the kernel stack and are not received);
+//!  - sending goes through regular kernel sockets.
+class Transceiver : private ICloseHandler, private core::Thread {
+public:
+    //! Initialize.
+    //!
+    //! @remarks
+    //!  Start background thread if the object was successfully constructed.
+    Transceiver(packet::PacketPool& packet_pool,
+                core::BufferPool<uint8_t>& buffer_pool,
+                core::IAllocator& allocator);
+
+    //! Destroy. Stop all receivers and senders.
+    //!
+    //! @remarks
+    //!  Wait until background thread finishes.
+    virtual ~Transceiver();
+
+    //! Check if transceiver was successfully constructed.
+    bool valid() const;
+
+    //! Get number of receiver and sender ports.
+    size_t num_ports() const;
+
+    //! Add UDP datagram receiver port.
+    //!
+    //! Creates a new UDP receiver for @p bind_address. The receiver will
+    //! pass packets to @p writer, called from the network thread; it
+    //! should not block.
+    //!
+    //! Unlike the default backend, @p bind_address must be the explicit
+    //! address of a network interface and carry a non-zero port.
+    //!
+    //! @returns
+    //!  true on success or false if error occurred
+    bool add_udp_receiver(packet::Address& bind_address, packet::IWriter& writer);
+
+    //! Add UDP datagram sender port.
+    //!
+    //! Creates a new UDP sender, bind to @p bind_address, and returns a writer
+    //! that may be used to send packets from this address. Writer may be called
+    //! from any thread. It will not block the caller.
+    //!
+    //! @returns
+    //!  a new packet writer on success or null if error occurred
+    packet::IWriter* add_udp_sender(packet::Address& bind_address);
+
+    //! Remove sender or receiver port. Wait until port will be removed.
+    void remove_port(packet::Address bind_address);
+
+private:
+    //! Maximum descriptors in one poll: the wake descriptor plus the
+    //! AF_XDP sockets of all interfaces.
+    enum { MaxPollFds = 1 + 4 * XdpInterface::MaxQueues };
+
+    struct Task : core::ListNode {
+        bool (Transceiver::*fn)(Task&);
+
+        packet::Address* address;
+        packet::IWriter* writer;
+        BasicPort* port;
+
+        bool result;
+        bool done;
+
+        Task()
+            : fn(NULL)
+            , address(NULL)
+            , writer(NULL)
+            , port(NULL)
+            , result(false)
+            , done(false) {
+        }
+    };
+
+    virtual void handle_closed(BasicPort&);
+    virtual void run();
+
+    void wake_();
+
+    void process_tasks_();
+    void run_task_(Task&);
+
+    bool add_udp_receiver_(Task&);
+    bool add_udp_sender_(Task&);
+    bool remove_port_(Task&);
+
+    core::SharedPtr<XdpInterface> find_iface_(const packet::Address& bind_address);
+    static bool resolve_iface_(const packet::Address& bind_address,
+                               char* ifname,
+                               size_t ifname_size,
+                               int& ifindex);
+
+    packet::PacketPool& packet_pool_;
+    core::BufferPool<uint8_t>& buffer_pool_;
+    core::IAllocator& allocator_;
+
+    bool started_;
+
+    int wake_fd_;
+    core::Atomic stop_;
+
+    core::List<XdpInterface> ifaces_;
+    core::List<BasicPort> open_ports_;
+
+    core::List<Task, core::NoOwnership> tasks_;
+
+    core::Mutex mutex_;
+    core::Cond cond_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_TRANSCEIVER_H_
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/udp_receiver_port.h"
+#include "roc_core/log.h"
+#include "roc_packet/address_to_str.h"
+
+namespace roc {
+namespace netio {
+
+UDPReceiverPort::UDPReceiverPort(ICloseHandler& close_handler,
+                                 const packet::Address& address,
+                                 const core::SharedPtr<XdpInterface>& iface,
+                                 packet::IWriter& writer,
+                                 core::IAllocator& allocator)
+    : BasicPort(allocator)
+    , close_handler_(close_handler)
+    , iface_(iface)
+    , address_(address)
+    , writer_(writer)
+    , registered_(false) {
+}
+
+UDPReceiverPort::~UDPReceiverPort() {
+}
+
+const packet::Address& UDPReceiverPort::address() const {
+    return address_;
+}
+
+bool UDPReceiverPort::open() {
+    if (!iface_->add_port(address_, writer_)) {
+        roc_log(LogError, "udp receiver: can't register port %s",
+                packet::address_to_str(address_).c_str());
+        return false;
+    }
+
+    registered_ = true;
+
+    roc_log(LogInfo, "udp receiver: opened port %s",
+            packet::address_to_str(address_).c_str());
+
+    return true;
+}
+
+void UDPReceiverPort::async_close() {
+    if (registered_) {
+        iface_->remove_port(address_);
+        registered_ = false;
+
+        roc_log(LogInfo, "udp receiver: closed port %s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    close_handler_.handle_closed(*this);
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/udp_receiver_port.h
+//! @brief UDP receiver.
+
+#ifndef ROC_NETIO_UDP_RECEIVER_PORT_H_
+#define ROC_NETIO_UDP_RECEIVER_PORT_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_netio/basic_port.h"
+#include "roc_netio/iclose_handler.h"
+#include "roc_netio/xdp_interface.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+
+namespace roc {
+namespace netio {
+
+//! UDP receiver.
+//!
+//! A thin registration handle: the actual receive path lives in
+//! XdpInterface, which the port registers its UDP port and writer with.
+//! The bind address must carry an explicit interface IPv4 address and a
+//! non-zero port, since datagrams are claimed from the NIC before the
+//! kernel socket layer and there is no kernel socket to pick a port or
+//! an interface for us.
+class UDPReceiverPort : public BasicPort {
+public:
+    //! Initialize.
+    UDPReceiverPort(ICloseHandler& close_handler,
+                    const packet::Address& address,
+                    const core::SharedPtr<XdpInterface>& iface,
+                    packet::IWriter& writer,
+                    core::IAllocator& allocator);
+
+    //! Destroy.
+    ~UDPReceiverPort();
+
+    //! Get bind address.
+    virtual const packet::Address& address() const;
+
+    //! Open receiver.
+    virtual bool open();
+
+    //! Asynchronously close receiver.
+    virtual void async_close();
+
+private:
+    ICloseHandler& close_handler_;
+
+    core::SharedPtr<XdpInterface> iface_;
+
+    packet::Address address_;
+    packet::IWriter& writer_;
+
+    bool registered_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_UDP_RECEIVER_PORT_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/udp_sender_port.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+UDPSenderPort::UDPSenderPort(ICloseHandler& close_handler,
+                             const packet::Address& address,
+                             core::IAllocator& allocator)
+    : BasicPort(allocator)
+    , close_handler_(close_handler)
+    , address_(address)
+    , fd_(-1) {
+}
+
+UDPSenderPort::~UDPSenderPort() {
+    if (fd_ >= 0) {
+        roc_panic("udp sender: sender was not fully closed before calling destructor");
+    }
+}
+
+const packet::Address& UDPSenderPort::address() const {
+    return address_;
+}
+
+bool UDPSenderPort::open() {
+    fd_ = socket(address_.version() == 6 ? AF_INET6 : AF_INET, SOCK_DGRAM, 0);
+    if (fd_ < 0) {
+        roc_log(LogError, "udp sender: socket(): errno=%d", errno);
+        return false;
+    }
+
+    if (fcntl(fd_, F_SETFL, O_NONBLOCK) != 0) {
+        roc_log(LogError, "udp sender: fcntl(O_NONBLOCK): errno=%d", errno);
+        return false;
+    }
+
+    if (bind(fd_, address_.saddr(), address_.slen()) != 0) {
+        roc_log(LogError, "udp sender: bind(): %s errno=%d",
+                packet::address_to_str(address_).c_str(), errno);
+        return false;
+    }
+
+    socklen_t addrlen = address_.slen();
+    if (getsockname(fd_, address_.saddr(), &addrlen) != 0) {
+        roc_log(LogError, "udp sender: getsockname(): errno=%d", errno);
+        return false;
+    }
+
+    roc_log(LogInfo, "udp sender: opened port %s",
+            packet::address_to_str(address_).c_str());
+
+    return true;
+}
+
+void UDPSenderPort::async_close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+
+        roc_log(LogInfo, "udp sender: closed port %s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    close_handler_.handle_closed(*this);
+}
+
+void UDPSenderPort::write(const packet::PacketPtr& pp) {
+    if (!pp) {
+        roc_panic("udp sender: unexpected null packet");
+    }
+    if (!pp->udp()) {
+        roc_panic("udp sender: unexpected non-udp packet");
+    }
+    if (!pp->data()) {
+        roc_panic("udp sender: unexpected packet w/o data");
+    }
+
+    const packet::Address& dst_addr = pp->udp()->dst_addr;
+
+    const ssize_t ret = sendto(fd_, pp->data().data(), pp->data().size(), 0,
+                               dst_addr.saddr(), dst_addr.slen());
+
+    if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+        roc_log(LogError, "udp sender: sendto(): dst=%s errno=%d",
+                packet::address_to_str(dst_addr).c_str(), errno);
+    }
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/udp_sender_port.h
+//! @brief UDP sender.
+
+#ifndef ROC_NETIO_UDP_SENDER_PORT_H_
+#define ROC_NETIO_UDP_SENDER_PORT_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_netio/basic_port.h"
+#include "roc_netio/iclose_handler.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+
+namespace roc {
+namespace netio {
+
+//! UDP sender.
+//!
+//! Sending goes through a regular non-blocking kernel socket: this
+//! backend targets receiver appliances, where the transmit path carries
+//! only occasional control and repair-request traffic and doesn't
+//! justify hand-built Ethernet/IP framing and ARP handling that AF_XDP
+//! transmit would require.
+class UDPSenderPort : public BasicPort, public packet::IWriter {
+public:
+    //! Initialize.
+    UDPSenderPort(ICloseHandler& close_handler,
+                  const packet::Address& address,
+                  core::IAllocator& allocator);
+
+    //! Destroy.
+    ~UDPSenderPort();
+
+    //! Get bind address.
+    virtual const packet::Address& address() const;
+
+    //! Open sender.
+    virtual bool open();
+
+    //! Asynchronously close sender.
+    virtual void async_close();
+
+    //! Write packet.
+    //! @remarks
+    //!  May be called from any thread. The datagram is handed to the
+    //!  kernel immediately; if the socket buffer is full, the datagram
+    //!  is dropped, like any other congestion loss.
+    virtual void write(const packet::PacketPtr&);
+
+private:
+    ICloseHandler& close_handler_;
+
+    packet::Address address_;
+
+    int fd_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_UDP_SENDER_PORT_H_
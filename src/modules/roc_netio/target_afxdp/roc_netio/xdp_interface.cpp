@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/xdp_interface.h"
+#include "roc_core/alignment.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/time.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <linux/ethtool.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+namespace {
+
+// Ethernet/IPv4/UDP header offsets; the XDP program redirects only
+// datagrams with this exact framing (no VLAN, no IP options)
+enum {
+    EthHdrLen = 14,
+    IpSrcOff = EthHdrLen + 12,
+    IpDstOff = EthHdrLen + 16,
+    UdpOff = EthHdrLen + 20,
+    PayloadOff = UdpOff + 8
+};
+
+} // namespace
+
+XdpInterface::XdpInterface(packet::PacketPool& packet_pool,
+                           core::BufferPool<uint8_t>& buffer_pool,
+                           core::IAllocator& allocator)
+    : packet_pool_(packet_pool)
+    , buffer_pool_(buffer_pool)
+    , allocator_(allocator)
+    , n_sockets_(0)
+    , n_ports_(0)
+    , pack_pos_(0)
+    , ifindex_(-1)
+    , open_(false) {
+}
+
+XdpInterface::~XdpInterface() {
+    close();
+}
+
+void XdpInterface::destroy() {
+    allocator_.destroy(*this);
+}
+
+bool XdpInterface::open(const char* ifname, int ifindex) {
+    roc_panic_if(open_);
+
+    ifindex_ = ifindex;
+
+    const unsigned n_queues = detect_queues_(ifname);
+
+    if (!program_.attach(ifindex, n_queues)) {
+        return false;
+    }
+
+    for (unsigned q = 0; q < n_queues; q++) {
+        sockets_[q].reset(new (allocator_) XskSocket(), allocator_);
+        if (!sockets_[q]) {
+            roc_log(LogError, "xdp interface: can't allocate socket: if=%s", ifname);
+            close();
+            return false;
+        }
+
+        if (!sockets_[q]->open(ifindex, q)) {
+            roc_log(LogError, "xdp interface: can't open socket: if=%s queue=%u", ifname,
+                    q);
+            close();
+            return false;
+        }
+
+        if (!program_.set_socket(q, sockets_[q]->fd())) {
+            close();
+            return false;
+        }
+
+        n_sockets_++;
+    }
+
+    roc_log(LogInfo, "xdp interface: opened interface: if=%s queues=%u", ifname,
+            n_queues);
+
+    open_ = true;
+
+    return true;
+}
+
+void XdpInterface::close() {
+    program_.detach();
+
+    for (size_t n = 0; n < MaxQueues; n++) {
+        sockets_[n].reset(NULL, allocator_);
+    }
+    n_sockets_ = 0;
+
+    open_ = false;
+}
+
+int XdpInterface::ifindex() const {
+    return ifindex_;
+}
+
+bool XdpInterface::add_port(const packet::Address& address, packet::IWriter& writer) {
+    if (n_ports_ == MaxPorts) {
+        roc_log(LogError, "xdp interface: too many ports: max=%d", (int)MaxPorts);
+        return false;
+    }
+
+    if (!program_.add_port((uint16_t)address.port())) {
+        return false;
+    }
+
+    ports_[n_ports_].address = address;
+    ports_[n_ports_].writer = &writer;
+    n_ports_++;
+
+    return true;
+}
+
+void XdpInterface::remove_port(const packet::Address& address) {
+    for (size_t n = 0; n < n_ports_; n++) {
+        if (ports_[n].address == address) {
+            program_.remove_port((uint16_t)address.port());
+
+            ports_[n] = ports_[n_ports_ - 1];
+            ports_[n_ports_ - 1] = PortEntry();
+            n_ports_--;
+
+            return;
+        }
+    }
+}
+
+size_t XdpInterface::num_ports() const {
+    return n_ports_;
+}
+
+size_t XdpInterface::num_sockets() const {
+    return n_sockets_;
+}
+
+int XdpInterface::socket_fd(size_t n) const {
+    roc_panic_if(n >= n_sockets_);
+
+    return sockets_[n]->fd();
+}
+
+void XdpInterface::process_socket(size_t n) {
+    roc_panic_if(n >= n_sockets_);
+
+    XskSocket& sock = *sockets_[n];
+
+    for (;;) {
+        XskSocket::Frame frames[RecvBatch];
+
+        const size_t n_frames = sock.recv_begin(frames, RecvBatch);
+        if (n_frames == 0) {
+            return;
+        }
+
+        for (size_t f = 0; f < n_frames; f++) {
+            handle_frame_(frames[f].data, frames[f].size);
+        }
+
+        sock.recv_end(frames, n_frames);
+    }
+}
+
+// Detect the number of NIC receive queues, since the redirect program
+// routes by the queue a datagram arrived on and every queue needs its
+// own socket.
+unsigned XdpInterface::detect_queues_(const char* ifname) {
+    unsigned n_queues = 1;
+
+    const int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock >= 0) {
+        struct ethtool_channels channels;
+        memset(&channels, 0, sizeof(channels));
+        channels.cmd = ETHTOOL_GCHANNELS;
+
+        struct ifreq ifr;
+        memset(&ifr, 0, sizeof(ifr));
+        strncpy(ifr.ifr_name, ifname, sizeof(ifr.ifr_name) - 1);
+        ifr.ifr_data = (char*)&channels;
+
+        if (ioctl(sock, SIOCETHTOOL, &ifr) == 0) {
+            if (channels.combined_count > n_queues) {
+                n_queues = channels.combined_count;
+            }
+            if (channels.rx_count > n_queues) {
+                n_queues = channels.rx_count;
+            }
+        }
+
+        ::close(sock);
+    }
+
+    if (n_queues > MaxQueues) {
+        roc_log(LogError,
+                "xdp interface: interface has more queues than supported,"
+                " using first %d: if=%s queues=%u",
+                (int)MaxQueues, ifname, n_queues);
+        n_queues = MaxQueues;
+    }
+
+    return n_queues;
+}
+
+void XdpInterface::handle_frame_(const uint8_t* data, size_t size) {
+    // the program redirects only well-formed Ethernet/IPv4/UDP datagrams,
+    // but the bounds are re-checked since the frame crossed the kernel
+    if (size < PayloadOff) {
+        return;
+    }
+
+    const size_t udp_len = ((size_t)data[UdpOff + 4] << 8) | data[UdpOff + 5];
+    if (udp_len < 8 || UdpOff + udp_len > size) {
+        return;
+    }
+    const size_t payload_len = udp_len - 8;
+
+    struct sockaddr_in saddr;
+    memset(&saddr, 0, sizeof(saddr));
+    saddr.sin_family = AF_INET;
+    memcpy(&saddr.sin_addr.s_addr, data + IpSrcOff, 4);
+    memcpy(&saddr.sin_port, data + UdpOff, 2);
+
+    packet::Address src_addr;
+    if (!src_addr.set_saddr((const struct sockaddr*)&saddr)) {
+        return;
+    }
+
+    const uint16_t dst_port =
+        (uint16_t)(((unsigned)data[UdpOff + 2] << 8) | data[UdpOff + 3]);
+
+    PortEntry* port = NULL;
+    for (size_t n = 0; n < n_ports_; n++) {
+        if (ports_[n].address.port() == (int)dst_port) {
+            port = &ports_[n];
+            break;
+        }
+    }
+    if (!port) {
+        // the port was removed after the datagram was redirected
+        return;
+    }
+
+    core::Slice<uint8_t> pdata = copy_data_(data + PayloadOff, payload_len);
+    if (!pdata) {
+        roc_log(LogError, "xdp interface: can't allocate buffer");
+        return;
+    }
+
+    packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!pp) {
+        roc_log(LogError, "xdp interface: can't allocate packet");
+        return;
+    }
+
+    pp->add_flags(packet::Packet::FlagUDP);
+
+    pp->udp()->src_addr = src_addr;
+    pp->udp()->dst_addr = port->address;
+
+    pp->set_receive_timestamp(core::timestamp());
+
+    pp->set_data(pdata);
+
+    port->writer->write(pp);
+}
+
+// Copy a datagram from its UMEM frame into a shared pool buffer and
+// return a slice referring it. UMEM frames belong to the NIC and must be
+// recycled to the fill ring promptly, so the payload is copied out; the
+// datagrams are small and several are packed per pool buffer.
+core::Slice<uint8_t> XdpInterface::copy_data_(const uint8_t* data, size_t size) {
+    if (pack_buffer_ && pack_pos_ + size > pack_buffer_->size()) {
+        pack_buffer_ = NULL;
+    }
+
+    if (!pack_buffer_) {
+        pack_buffer_ = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+        if (!pack_buffer_) {
+            return core::Slice<uint8_t>();
+        }
+        pack_pos_ = 0;
+    }
+
+    if (pack_pos_ + size > pack_buffer_->size()) {
+        return core::Slice<uint8_t>();
+    }
+
+    memcpy(pack_buffer_->data() + pack_pos_, data, size);
+
+    core::Slice<uint8_t> out(*pack_buffer_, pack_pos_, pack_pos_ + size);
+
+    pack_pos_ += core::max_align(size);
+
+    return out;
+}
+
+} // namespace netio
+} // namespace roc
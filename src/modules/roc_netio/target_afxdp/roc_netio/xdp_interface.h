@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/xdp_interface.h
+//! @brief Per-interface AF_XDP receive state.
+
+#ifndef ROC_NETIO_XDP_INTERFACE_H_
+#define ROC_NETIO_XDP_INTERFACE_H_
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/list_node.h"
+#include "roc_core/refcnt.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_netio/xdp_program.h"
+#include "roc_netio/xsk_socket.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace netio {
+
+//! Per-interface AF_XDP receive state, shared by all ports bound on the
+//! interface: the XDP redirect program and one AF_XDP socket per NIC
+//! receive queue, plus the userspace demux mapping UDP destination ports
+//! to packet writers.
+//!
+//! All methods should be called from the event loop thread; received
+//! datagrams are parsed, copied from UMEM frames into pool buffers, and
+//! passed to the writer of their destination port.
+class XdpInterface : public core::RefCnt<XdpInterface>, public core::ListNode {
+public:
+    //! Maximum supported NIC receive queues.
+    enum { MaxQueues = 16 };
+
+    //! Maximum ports bound per interface.
+    enum { MaxPorts = 64 };
+
+    //! Initialize.
+    XdpInterface(packet::PacketPool& packet_pool,
+                 core::BufferPool<uint8_t>& buffer_pool,
+                 core::IAllocator& allocator);
+
+    ~XdpInterface();
+
+    //! Attach the redirect program and open a socket per receive queue.
+    bool open(const char* ifname, int ifindex);
+
+    //! Detach the program and close the sockets.
+    void close();
+
+    //! Get interface index.
+    int ifindex() const;
+
+    //! Register a port: datagrams to its UDP port are redirected to our
+    //! sockets and routed to @p writer.
+    bool add_port(const packet::Address& address, packet::IWriter& writer);
+
+    //! Unregister a port.
+    void remove_port(const packet::Address& address);
+
+    //! Get number of registered ports.
+    size_t num_ports() const;
+
+    //! Get number of opened sockets (one per receive queue).
+    size_t num_sockets() const;
+
+    //! Get descriptor of the given socket, pollable for read.
+    int socket_fd(size_t n) const;
+
+    //! Drain the rx ring of the given socket, routing datagrams to the
+    //! registered writers.
+    void process_socket(size_t n);
+
+private:
+    //! Frames fetched from an rx ring per drain iteration.
+    enum { RecvBatch = 64 };
+
+    friend class core::RefCnt<XdpInterface>;
+
+    void destroy();
+
+    unsigned detect_queues_(const char* ifname);
+
+    void handle_frame_(const uint8_t* data, size_t size);
+
+    core::Slice<uint8_t> copy_data_(const uint8_t* data, size_t size);
+
+    packet::PacketPool& packet_pool_;
+    core::BufferPool<uint8_t>& buffer_pool_;
+    core::IAllocator& allocator_;
+
+    XdpProgram program_;
+
+    core::UniquePtr<XskSocket> sockets_[MaxQueues];
+    size_t n_sockets_;
+
+    struct PortEntry {
+        packet::Address address;
+        packet::IWriter* writer;
+
+        PortEntry()
+            : writer(NULL) {
+        }
+    };
+
+    PortEntry ports_[MaxPorts];
+    size_t n_ports_;
+
+    core::SharedPtr<core::Buffer<uint8_t> > pack_buffer_;
+    size_t pack_pos_;
+
+    int ifindex_;
+    bool open_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_XDP_INTERFACE_H_
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/xdp_program.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <linux/bpf.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+namespace {
+
+enum { MaxPorts = 64, MaxInsns = 64 };
+
+long sys_bpf(int cmd, union bpf_attr* attr) {
+    return syscall(__NR_bpf, cmd, attr, sizeof(*attr));
+}
+
+struct bpf_insn make_insn(uint8_t code, uint8_t dst, uint8_t src, int16_t off,
+                          int32_t imm) {
+    struct bpf_insn insn;
+    memset(&insn, 0, sizeof(insn));
+    insn.code = code;
+    insn.dst_reg = dst;
+    insn.src_reg = src;
+    insn.off = off;
+    insn.imm = imm;
+    return insn;
+}
+
+// jump offset placeholder, patched to the "pass" label after assembly
+enum { JumpToPass = INT16_MAX };
+
+} // namespace
+
+XdpProgram::XdpProgram()
+    : ifindex_(-1)
+    , port_map_fd_(-1)
+    , xsk_map_fd_(-1)
+    , prog_fd_(-1)
+    , attached_(false) {
+}
+
+XdpProgram::~XdpProgram() {
+    detach();
+}
+
+bool XdpProgram::attach(int ifindex, unsigned n_queues) {
+    roc_panic_if(attached_);
+
+    ifindex_ = ifindex;
+
+    if (!create_maps_(n_queues) || !load_program_()) {
+        detach();
+        return false;
+    }
+
+    // driver mode runs the program before skb allocation and is required
+    // for zero-copy; generic mode works with every driver
+    if (netlink_attach_(prog_fd_, XDP_FLAGS_UPDATE_IF_NOEXIST | XDP_FLAGS_DRV_MODE)) {
+        roc_log(LogInfo, "xdp program: attached in driver mode: if=%d", ifindex);
+    } else if (netlink_attach_(prog_fd_,
+                               XDP_FLAGS_UPDATE_IF_NOEXIST | XDP_FLAGS_SKB_MODE)) {
+        roc_log(LogInfo, "xdp program: attached in generic mode: if=%d", ifindex);
+    } else {
+        roc_log(LogError, "xdp program: can't attach program: if=%d", ifindex);
+        detach();
+        return false;
+    }
+
+    attached_ = true;
+
+    return true;
+}
+
+void XdpProgram::detach() {
+    if (attached_) {
+        // setting the program fd to -1 detaches
+        if (!netlink_attach_(-1, 0)) {
+            roc_log(LogError, "xdp program: can't detach program: if=%d", ifindex_);
+        }
+        attached_ = false;
+    }
+
+    if (prog_fd_ >= 0) {
+        ::close(prog_fd_);
+        prog_fd_ = -1;
+    }
+    if (xsk_map_fd_ >= 0) {
+        ::close(xsk_map_fd_);
+        xsk_map_fd_ = -1;
+    }
+    if (port_map_fd_ >= 0) {
+        ::close(port_map_fd_);
+        port_map_fd_ = -1;
+    }
+}
+
+bool XdpProgram::set_socket(unsigned queue_id, int xsk_fd) {
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    uint32_t key = queue_id;
+    uint32_t value = (uint32_t)xsk_fd;
+
+    attr.map_fd = (uint32_t)xsk_map_fd_;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)&value;
+    attr.flags = BPF_ANY;
+
+    if (sys_bpf(BPF_MAP_UPDATE_ELEM, &attr) != 0) {
+        roc_log(LogError, "xdp program: can't register socket: queue=%u errno=%d",
+                queue_id, errno);
+        return false;
+    }
+
+    return true;
+}
+
+bool XdpProgram::add_port(uint16_t port) {
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    // the program compares the raw big-endian port halfword, so the key
+    // is stored in network byte order
+    uint16_t key = htons(port);
+    uint8_t value = 1;
+
+    attr.map_fd = (uint32_t)port_map_fd_;
+    attr.key = (uint64_t)(uintptr_t)&key;
+    attr.value = (uint64_t)(uintptr_t)&value;
+    attr.flags = BPF_ANY;
+
+    if (sys_bpf(BPF_MAP_UPDATE_ELEM, &attr) != 0) {
+        roc_log(LogError, "xdp program: can't register port: port=%u errno=%d",
+                (unsigned)port, errno);
+        return false;
+    }
+
+    return true;
+}
+
+bool XdpProgram::remove_port(uint16_t port) {
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    uint16_t key = htons(port);
+
+    attr.map_fd = (uint32_t)port_map_fd_;
+    attr.key = (uint64_t)(uintptr_t)&key;
+
+    if (sys_bpf(BPF_MAP_DELETE_ELEM, &attr) != 0) {
+        roc_log(LogError, "xdp program: can't unregister port: port=%u errno=%d",
+                (unsigned)port, errno);
+        return false;
+    }
+
+    return true;
+}
+
+bool XdpProgram::create_maps_(unsigned n_queues) {
+    union bpf_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.map_type = BPF_MAP_TYPE_HASH;
+    attr.key_size = sizeof(uint16_t);
+    attr.value_size = sizeof(uint8_t);
+    attr.max_entries = MaxPorts;
+
+    port_map_fd_ = (int)sys_bpf(BPF_MAP_CREATE, &attr);
+    if (port_map_fd_ < 0) {
+        roc_log(LogError, "xdp program: can't create port map: errno=%d", errno);
+        return false;
+    }
+
+    memset(&attr, 0, sizeof(attr));
+    attr.map_type = BPF_MAP_TYPE_XSKMAP;
+    attr.key_size = sizeof(uint32_t);
+    attr.value_size = sizeof(uint32_t);
+    attr.max_entries = n_queues;
+
+    xsk_map_fd_ = (int)sys_bpf(BPF_MAP_CREATE, &attr);
+    if (xsk_map_fd_ < 0) {
+        roc_log(LogError, "xdp program: can't create socket map: errno=%d", errno);
+        return false;
+    }
+
+    return true;
+}
+
+// Assemble and load the redirect program:
+//
+//   if datagram is Ethernet/IPv4(no options, no fragment)/UDP
+//      and udp.dst_port is in the port map:
+//          return redirect_map(xsk_map, ctx->rx_queue_index, XDP_PASS)
+//   return XDP_PASS
+//
+// Halfword loads read the packet in host byte order of the CPU, so the
+// immediates for the EtherType and the fragment mask below are written
+// byte-swapped; like the rest of this backend, the program assumes a
+// little-endian host.
+bool XdpProgram::load_program_() {
+    struct bpf_insn insns[MaxInsns];
+    size_t n = 0;
+
+    // r6 = ctx
+    insns[n++] = make_insn(BPF_ALU64 | BPF_MOV | BPF_X, 6, 1, 0, 0);
+    // r2 = ctx->data, r3 = ctx->data_end
+    insns[n++] = make_insn(BPF_LDX | BPF_W | BPF_MEM, 2, 6, 0, 0);
+    insns[n++] = make_insn(BPF_LDX | BPF_W | BPF_MEM, 3, 6, 4, 0);
+    // pass if shorter than eth(14) + ipv4(20) + udp(8)
+    insns[n++] = make_insn(BPF_ALU64 | BPF_MOV | BPF_X, 4, 2, 0, 0);
+    insns[n++] = make_insn(BPF_ALU64 | BPF_ADD | BPF_K, 4, 0, 0, 42);
+    insns[n++] = make_insn(BPF_JMP | BPF_JGT | BPF_X, 4, 3, JumpToPass, 0);
+    // pass unless EtherType is IPv4 (0x0800 big-endian)
+    insns[n++] = make_insn(BPF_LDX | BPF_H | BPF_MEM, 5, 2, 12, 0);
+    insns[n++] = make_insn(BPF_JMP | BPF_JNE | BPF_K, 5, 0, JumpToPass, 0x0008);
+    // pass unless version 4 with no options
+    insns[n++] = make_insn(BPF_LDX | BPF_B | BPF_MEM, 5, 2, 14, 0);
+    insns[n++] = make_insn(BPF_JMP | BPF_JNE | BPF_K, 5, 0, JumpToPass, 0x45);
+    // pass unless protocol is UDP
+    insns[n++] = make_insn(BPF_LDX | BPF_B | BPF_MEM, 5, 2, 23, 0);
+    insns[n++] = make_insn(BPF_JMP | BPF_JNE | BPF_K, 5, 0, JumpToPass, 17);
+    // pass fragments (MF flag or nonzero offset; 0x3fff big-endian)
+    insns[n++] = make_insn(BPF_LDX | BPF_H | BPF_MEM, 5, 2, 20, 0);
+    insns[n++] = make_insn(BPF_JMP | BPF_JSET | BPF_K, 5, 0, JumpToPass, 0xff3f);
+    // key = udp.dst_port (kept big-endian), on the stack
+    insns[n++] = make_insn(BPF_LDX | BPF_H | BPF_MEM, 5, 2, 36, 0);
+    insns[n++] = make_insn(BPF_STX | BPF_H | BPF_MEM, 10, 5, -8, 0);
+    // r0 = bpf_map_lookup_elem(port_map, &key)
+    insns[n++] = make_insn(BPF_ALU64 | BPF_MOV | BPF_X, 2, 10, 0, 0);
+    insns[n++] = make_insn(BPF_ALU64 | BPF_ADD | BPF_K, 2, 0, 0, -8);
+    insns[n++] =
+        make_insn(BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, port_map_fd_);
+    insns[n++] = make_insn(0, 0, 0, 0, 0); // second half of the 64-bit load
+    insns[n++] = make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_map_lookup_elem);
+    // pass if the port is not ours
+    insns[n++] = make_insn(BPF_JMP | BPF_JEQ | BPF_K, 0, 0, JumpToPass, 0);
+    // return bpf_redirect_map(xsk_map, ctx->rx_queue_index, XDP_PASS)
+    insns[n++] = make_insn(BPF_LDX | BPF_W | BPF_MEM, 2, 6, 16, 0);
+    insns[n++] =
+        make_insn(BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, xsk_map_fd_);
+    insns[n++] = make_insn(0, 0, 0, 0, 0); // second half of the 64-bit load
+    insns[n++] = make_insn(BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS);
+    insns[n++] = make_insn(BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map);
+    insns[n++] = make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0);
+    // pass: return XDP_PASS
+    const size_t pass_label = n;
+    insns[n++] = make_insn(BPF_ALU64 | BPF_MOV | BPF_K, 0, 0, 0, XDP_PASS);
+    insns[n++] = make_insn(BPF_JMP | BPF_EXIT, 0, 0, 0, 0);
+
+    roc_panic_if(n > MaxInsns);
+
+    for (size_t i = 0; i < n; i++) {
+        if ((insns[i].code & 0x07) == BPF_JMP && insns[i].off == JumpToPass) {
+            insns[i].off = (int16_t)(pass_label - i - 1);
+        }
+    }
+
+    char log_buf[4096] = {};
+
+    union bpf_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.prog_type = BPF_PROG_TYPE_XDP;
+    attr.insns = (uint64_t)(uintptr_t)insns;
+    attr.insn_cnt = (uint32_t)n;
+    attr.license = (uint64_t)(uintptr_t) "GPL";
+    attr.log_buf = (uint64_t)(uintptr_t)log_buf;
+    attr.log_size = sizeof(log_buf);
+    attr.log_level = 1;
+
+    prog_fd_ = (int)sys_bpf(BPF_PROG_LOAD, &attr);
+    if (prog_fd_ < 0) {
+        roc_log(LogError, "xdp program: can't load program: errno=%d verifier=[%s]",
+                errno, log_buf);
+        return false;
+    }
+
+    return true;
+}
+
+// Attach or detach (fd == -1) the program via rtnetlink, the portable
+// equivalent of "ip link set dev X xdp".
+bool XdpProgram::netlink_attach_(int prog_fd, unsigned flags) {
+    const int sock = socket(AF_NETLINK, SOCK_RAW, NETLINK_ROUTE);
+    if (sock < 0) {
+        roc_log(LogError, "xdp program: socket(AF_NETLINK): errno=%d", errno);
+        return false;
+    }
+
+    struct {
+        struct nlmsghdr nh;
+        struct ifinfomsg ifinfo;
+        char attrs[64];
+    } req;
+    memset(&req, 0, sizeof(req));
+
+    req.nh.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+    req.nh.nlmsg_type = RTM_SETLINK;
+    req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK;
+    req.nh.nlmsg_seq = 1;
+    req.ifinfo.ifi_family = AF_UNSPEC;
+    req.ifinfo.ifi_index = ifindex_;
+
+    // nested IFLA_XDP { IFLA_XDP_FD, IFLA_XDP_FLAGS }
+    struct rtattr* xdp_attr = (struct rtattr*)((char*)&req + NLMSG_ALIGN(req.nh.nlmsg_len));
+    xdp_attr->rta_type = IFLA_XDP | NLA_F_NESTED;
+
+    struct rtattr* fd_attr = (struct rtattr*)((char*)xdp_attr + RTA_LENGTH(0));
+    fd_attr->rta_type = IFLA_XDP_FD;
+    fd_attr->rta_len = RTA_LENGTH(sizeof(int));
+    memcpy(RTA_DATA(fd_attr), &prog_fd, sizeof(int));
+
+    struct rtattr* flags_attr = (struct rtattr*)((char*)fd_attr + RTA_ALIGN(fd_attr->rta_len));
+    flags_attr->rta_type = IFLA_XDP_FLAGS;
+    flags_attr->rta_len = RTA_LENGTH(sizeof(unsigned));
+    memcpy(RTA_DATA(flags_attr), &flags, sizeof(unsigned));
+
+    xdp_attr->rta_len = (unsigned short)(RTA_LENGTH(0) + RTA_ALIGN(fd_attr->rta_len)
+                                         + RTA_ALIGN(flags_attr->rta_len));
+    req.nh.nlmsg_len = NLMSG_ALIGN(req.nh.nlmsg_len) + RTA_ALIGN(xdp_attr->rta_len);
+
+    bool result = false;
+
+    if (send(sock, &req, req.nh.nlmsg_len, 0) == (ssize_t)req.nh.nlmsg_len) {
+        char buf[4096];
+        size_t len = (size_t)recv(sock, buf, sizeof(buf), 0);
+
+        for (struct nlmsghdr* nh = (struct nlmsghdr*)buf;
+             (ssize_t)len > 0 && NLMSG_OK(nh, len); nh = NLMSG_NEXT(nh, len)) {
+            if (nh->nlmsg_type == NLMSG_ERROR) {
+                const struct nlmsgerr* err = (const struct nlmsgerr*)NLMSG_DATA(nh);
+                result = (err->error == 0);
+                if (!result) {
+                    roc_log(LogDebug, "xdp program: netlink: if=%d error=%d", ifindex_,
+                            -err->error);
+                }
+                break;
+            }
+        }
+    } else {
+        roc_log(LogError, "xdp program: netlink send: errno=%d", errno);
+    }
+
+    ::close(sock);
+
+    return result;
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/xdp_program.h
+//! @brief XDP redirect program.
+
+#ifndef ROC_NETIO_XDP_PROGRAM_H_
+#define ROC_NETIO_XDP_PROGRAM_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace netio {
+
+//! Kernel-side XDP program redirecting our UDP flows to AF_XDP sockets.
+//!
+//! The program is hand-assembled and loaded with raw bpf() syscalls, so
+//! no bpf library is required. It parses Ethernet/IPv4/UDP framing and
+//! redirects datagrams whose destination port is registered with
+//! add_port() to the AF_XDP socket of the receive queue they arrived on;
+//! everything else (other ports, non-UDP, IPv6, fragments, IP options)
+//! passes to the regular network stack untouched, so the host keeps
+//! working normally on the same interface.
+//!
+//! One program is attached per interface and shared by all ports bound
+//! on it; driver-mode attach is tried first, with a fallback to generic
+//! (skb) mode.
+class XdpProgram : public core::NonCopyable<> {
+public:
+    XdpProgram();
+    ~XdpProgram();
+
+    //! Create the maps, load the program, and attach it to the interface.
+    bool attach(int ifindex, unsigned n_queues);
+
+    //! Detach the program from the interface and release the maps.
+    void detach();
+
+    //! Register an AF_XDP socket for a receive queue.
+    bool set_socket(unsigned queue_id, int xsk_fd);
+
+    //! Start redirecting datagrams destined to the given UDP port
+    //! (host byte order).
+    bool add_port(uint16_t port);
+
+    //! Stop redirecting datagrams destined to the given UDP port.
+    bool remove_port(uint16_t port);
+
+private:
+    bool create_maps_(unsigned n_queues);
+    bool load_program_();
+    bool netlink_attach_(int prog_fd, unsigned flags);
+
+    int ifindex_;
+
+    int port_map_fd_;
+    int xsk_map_fd_;
+    int prog_fd_;
+
+    bool attached_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_XDP_PROGRAM_H_
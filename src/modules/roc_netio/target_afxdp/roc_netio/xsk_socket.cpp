@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/xsk_socket.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+#include <errno.h>
+#include <linux/if_xdp.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+namespace {
+
+// ring sizes; powers of two as required by the kernel
+enum {
+    FillRingSize = XskSocket::NumFrames,
+    CompRingSize = 64,
+    RxRingSize = 2048
+};
+
+} // namespace
+
+XskSocket::XskSocket()
+    : fd_(-1)
+    , umem_(NULL)
+    , umem_len_(0)
+    , rx_cached_cons_(0) {
+}
+
+XskSocket::~XskSocket() {
+    close();
+}
+
+bool XskSocket::open(int ifindex, unsigned queue_id) {
+    roc_panic_if(fd_ >= 0);
+
+    fd_ = ::socket(AF_XDP, SOCK_RAW, 0);
+    if (fd_ < 0) {
+        roc_log(LogError, "xsk socket: socket(AF_XDP): errno=%d", errno);
+        return false;
+    }
+
+    if (!setup_umem_() || !setup_rings_() || !bind_(ifindex, queue_id)) {
+        close();
+        return false;
+    }
+
+    populate_fill_ring_();
+
+    return true;
+}
+
+void XskSocket::close() {
+    unmap_ring_(fill_ring_);
+    unmap_ring_(comp_ring_);
+    unmap_ring_(rx_ring_);
+
+    if (umem_) {
+        munmap(umem_, umem_len_);
+        umem_ = NULL;
+    }
+
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+int XskSocket::fd() const {
+    return fd_;
+}
+
+bool XskSocket::setup_umem_() {
+    umem_len_ = (size_t)NumFrames * FrameSize;
+
+    // the UMEM slab is the packet pool of this socket: it must be a
+    // single contiguous page-aligned region registered with the kernel,
+    // hence it is mapped directly instead of coming from an allocator
+    umem_ = mmap(NULL, umem_len_, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (umem_ == MAP_FAILED) {
+        umem_ = NULL;
+        roc_log(LogError, "xsk socket: mmap(umem): errno=%d", errno);
+        return false;
+    }
+
+    struct xdp_umem_reg reg;
+    memset(&reg, 0, sizeof(reg));
+    reg.addr = (uint64_t)(uintptr_t)umem_;
+    reg.len = umem_len_;
+    reg.chunk_size = FrameSize;
+    reg.headroom = 0;
+
+    if (setsockopt(fd_, SOL_XDP, XDP_UMEM_REG, &reg, sizeof(reg)) != 0) {
+        roc_log(LogError, "xsk socket: setsockopt(XDP_UMEM_REG): errno=%d", errno);
+        return false;
+    }
+
+    return true;
+}
+
+bool XskSocket::setup_rings_() {
+    const int fill_size = FillRingSize;
+    const int comp_size = CompRingSize;
+    const int rx_size = RxRingSize;
+
+    if (setsockopt(fd_, SOL_XDP, XDP_UMEM_FILL_RING, &fill_size, sizeof(fill_size)) != 0
+        || setsockopt(fd_, SOL_XDP, XDP_UMEM_COMPLETION_RING, &comp_size,
+                      sizeof(comp_size))
+            != 0
+        || setsockopt(fd_, SOL_XDP, XDP_RX_RING, &rx_size, sizeof(rx_size)) != 0) {
+        roc_log(LogError, "xsk socket: setsockopt(ring sizes): errno=%d", errno);
+        return false;
+    }
+
+    struct xdp_mmap_offsets off;
+    socklen_t optlen = sizeof(off);
+    memset(&off, 0, sizeof(off));
+
+    if (getsockopt(fd_, SOL_XDP, XDP_MMAP_OFFSETS, &off, &optlen) != 0) {
+        roc_log(LogError, "xsk socket: getsockopt(XDP_MMAP_OFFSETS): errno=%d", errno);
+        return false;
+    }
+
+    fill_ring_.size = FillRingSize;
+    fill_ring_.map_len = off.fr.desc + FillRingSize * sizeof(uint64_t);
+    fill_ring_.map = mmap(NULL, fill_ring_.map_len, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd_, XDP_UMEM_PGOFF_FILL_RING);
+    if (fill_ring_.map == MAP_FAILED) {
+        fill_ring_.map = NULL;
+        roc_log(LogError, "xsk socket: mmap(fill ring): errno=%d", errno);
+        return false;
+    }
+    fill_ring_.producer = (volatile uint32_t*)((char*)fill_ring_.map + off.fr.producer);
+    fill_ring_.consumer = (volatile uint32_t*)((char*)fill_ring_.map + off.fr.consumer);
+    fill_ring_.desc = (char*)fill_ring_.map + off.fr.desc;
+
+    comp_ring_.size = CompRingSize;
+    comp_ring_.map_len = off.cr.desc + CompRingSize * sizeof(uint64_t);
+    comp_ring_.map = mmap(NULL, comp_ring_.map_len, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd_, XDP_UMEM_PGOFF_COMPLETION_RING);
+    if (comp_ring_.map == MAP_FAILED) {
+        comp_ring_.map = NULL;
+        roc_log(LogError, "xsk socket: mmap(completion ring): errno=%d", errno);
+        return false;
+    }
+    comp_ring_.producer = (volatile uint32_t*)((char*)comp_ring_.map + off.cr.producer);
+    comp_ring_.consumer = (volatile uint32_t*)((char*)comp_ring_.map + off.cr.consumer);
+    comp_ring_.desc = (char*)comp_ring_.map + off.cr.desc;
+
+    rx_ring_.size = RxRingSize;
+    rx_ring_.map_len = off.rx.desc + RxRingSize * sizeof(struct xdp_desc);
+    rx_ring_.map = mmap(NULL, rx_ring_.map_len, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd_, XDP_PGOFF_RX_RING);
+    if (rx_ring_.map == MAP_FAILED) {
+        rx_ring_.map = NULL;
+        roc_log(LogError, "xsk socket: mmap(rx ring): errno=%d", errno);
+        return false;
+    }
+    rx_ring_.producer = (volatile uint32_t*)((char*)rx_ring_.map + off.rx.producer);
+    rx_ring_.consumer = (volatile uint32_t*)((char*)rx_ring_.map + off.rx.consumer);
+    rx_ring_.desc = (char*)rx_ring_.map + off.rx.desc;
+
+    return true;
+}
+
+bool XskSocket::bind_(int ifindex, unsigned queue_id) {
+    struct sockaddr_xdp sxdp;
+    memset(&sxdp, 0, sizeof(sxdp));
+    sxdp.sxdp_family = AF_XDP;
+    sxdp.sxdp_ifindex = (uint32_t)ifindex;
+    sxdp.sxdp_queue_id = queue_id;
+
+    // zero-copy requires driver support; copy mode works with every
+    // driver and still bypasses the network stack
+    sxdp.sxdp_flags = XDP_ZEROCOPY;
+    if (bind(fd_, (const struct sockaddr*)&sxdp, sizeof(sxdp)) == 0) {
+        roc_log(LogInfo, "xsk socket: bound in zero-copy mode: if=%d queue=%u", ifindex,
+                queue_id);
+        return true;
+    }
+
+    sxdp.sxdp_flags = XDP_COPY;
+    if (bind(fd_, (const struct sockaddr*)&sxdp, sizeof(sxdp)) == 0) {
+        roc_log(LogInfo, "xsk socket: bound in copy mode: if=%d queue=%u", ifindex,
+                queue_id);
+        return true;
+    }
+
+    roc_log(LogError, "xsk socket: bind(): if=%d queue=%u errno=%d", ifindex, queue_id,
+            errno);
+    return false;
+}
+
+void XskSocket::populate_fill_ring_() {
+    uint64_t* descs = (uint64_t*)fill_ring_.desc;
+
+    uint32_t prod = *fill_ring_.producer;
+    for (size_t n = 0; n < (size_t)NumFrames; n++) {
+        descs[prod & (fill_ring_.size - 1)] = (uint64_t)n * FrameSize;
+        prod++;
+    }
+
+    __sync_synchronize();
+    *fill_ring_.producer = prod;
+}
+
+size_t XskSocket::recv_begin(Frame* frames, size_t max_frames) {
+    const uint32_t prod = *rx_ring_.producer;
+    uint32_t cons = *rx_ring_.consumer;
+
+    __sync_synchronize();
+
+    const struct xdp_desc* descs = (const struct xdp_desc*)rx_ring_.desc;
+
+    size_t n = 0;
+    while (cons != prod && n < max_frames) {
+        const struct xdp_desc& desc = descs[cons & (rx_ring_.size - 1)];
+
+        frames[n].data = (const uint8_t*)umem_ + desc.addr;
+        frames[n].size = desc.len;
+        frames[n].addr = desc.addr;
+
+        cons++;
+        n++;
+    }
+
+    rx_cached_cons_ = cons;
+
+    return n;
+}
+
+void XskSocket::recv_end(const Frame* frames, size_t n_frames) {
+    // release the rx descriptors
+    __sync_synchronize();
+    *rx_ring_.consumer = rx_cached_cons_;
+
+    // recycle the frames to the fill ring; the descriptor address may
+    // carry a headroom offset, so it is truncated to the frame start
+    uint64_t* descs = (uint64_t*)fill_ring_.desc;
+
+    uint32_t prod = *fill_ring_.producer;
+    for (size_t n = 0; n < n_frames; n++) {
+        descs[prod & (fill_ring_.size - 1)] = frames[n].addr & ~(uint64_t)(FrameSize - 1);
+        prod++;
+    }
+
+    __sync_synchronize();
+    *fill_ring_.producer = prod;
+}
+
+void XskSocket::unmap_ring_(Ring& ring) {
+    if (ring.map) {
+        munmap(ring.map, ring.map_len);
+        ring.map = NULL;
+    }
+    ring.producer = NULL;
+    ring.consumer = NULL;
+    ring.desc = NULL;
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_afxdp/roc_netio/xsk_socket.h
+//! @brief AF_XDP socket.
+
+#ifndef ROC_NETIO_XSK_SOCKET_H_
+#define ROC_NETIO_XSK_SOCKET_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace netio {
+
+//! AF_XDP socket bound to one receive queue of a network interface.
+//!
+//! Owns a UMEM slab shared between the kernel and userspace and the three
+//! rings that drive it: the fill ring feeds empty frames to the NIC, the
+//! rx ring returns received frames, and frames are recycled back to the
+//! fill ring after the payload is consumed. In zero-copy mode the NIC DMAs
+//! directly into the slab; if the driver doesn't support it, the kernel
+//! falls back to copy mode, which still bypasses the network stack.
+//!
+//! The raw kernel interface is used directly (setsockopt + mmap), so no
+//! extra library is required beyond the kernel headers.
+class XskSocket : public core::NonCopyable<> {
+public:
+    //! Number of frames in the UMEM slab.
+    enum { NumFrames = 4096 };
+
+    //! Size of a single UMEM frame; fits a full MTU-sized datagram with
+    //! the kernel headroom.
+    enum { FrameSize = 2048 };
+
+    //! Received frame.
+    struct Frame {
+        const uint8_t* data; //!< Frame payload, starting at the Ethernet header.
+        size_t size;         //!< Payload size.
+        uint64_t addr;       //!< UMEM address, used to recycle the frame.
+    };
+
+    XskSocket();
+    ~XskSocket();
+
+    //! Create the socket, register the UMEM, map the rings, and bind to
+    //! the given queue of the given interface. Zero-copy bind is tried
+    //! first, with a fallback to copy mode.
+    bool open(int ifindex, unsigned queue_id);
+
+    //! Close the socket and unmap the rings and the UMEM.
+    void close();
+
+    //! Get socket descriptor, pollable for read.
+    int fd() const;
+
+    //! Fetch up to @p max_frames received frames from the rx ring.
+    //! @returns the number of frames fetched. The frames stay valid until
+    //! recv_end() is called.
+    size_t recv_begin(Frame* frames, size_t max_frames);
+
+    //! Release the frames fetched by the last recv_begin() back to the
+    //! fill ring, making them available to the NIC again.
+    void recv_end(const Frame* frames, size_t n_frames);
+
+private:
+    struct Ring {
+        volatile uint32_t* producer;
+        volatile uint32_t* consumer;
+        void* desc;
+        uint32_t size;
+        void* map;
+        size_t map_len;
+
+        Ring()
+            : producer(NULL)
+            , consumer(NULL)
+            , desc(NULL)
+            , size(0)
+            , map(NULL)
+            , map_len(0) {
+        }
+    };
+
+    bool setup_umem_();
+    bool setup_rings_();
+    bool bind_(int ifindex, unsigned queue_id);
+
+    void populate_fill_ring_();
+    void unmap_ring_(Ring& ring);
+
+    int fd_;
+
+    void* umem_;
+    size_t umem_len_;
+
+    Ring fill_ring_;
+    Ring comp_ring_;
+    Ring rx_ring_;
+
+    uint32_t rx_cached_cons_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_XSK_SOCKET_H_
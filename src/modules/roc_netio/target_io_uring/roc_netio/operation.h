@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_io_uring/roc_netio/operation.h
+//! @brief Asynchronous I/O operation.
+
+#ifndef ROC_NETIO_OPERATION_H_
+#define ROC_NETIO_OPERATION_H_
+
+#include <liburing.h>
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace netio {
+
+//! Completion context of a single io_uring submission.
+//!
+//! A pointer to this struct is attached to the submission queue entry. The
+//! event loop reads it back from the completion queue entry and invokes the
+//! callback. The struct should stay alive until the operation completes.
+struct Operation {
+    //! Completion callback.
+    //!
+    //! @p arg is the user argument, @p res is the operation result (negative
+    //! errno on failure), @p cqe_flags are the completion queue entry flags.
+    void (*callback)(void* arg, int res, unsigned cqe_flags);
+
+    //! Callback argument.
+    void* arg;
+
+    Operation()
+        : callback(NULL)
+        , arg(NULL) {
+    }
+};
+
+//! Obtain a submission queue entry attached to @p op.
+//!
+//! @remarks
+//!  - Should be called from the event loop thread.
+//!  - If the submission queue is full, flushes it to the kernel and retries.
+//!  - The actual submission is deferred until the event loop flushes the
+//!    queue, so that multiple operations are submitted with a single syscall.
+inline io_uring_sqe* begin_operation(io_uring& ring, Operation& op) {
+    io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+
+    while (!sqe) {
+        io_uring_submit(&ring);
+        sqe = io_uring_get_sqe(&ring);
+    }
+
+    io_uring_sqe_set_data(sqe, &op);
+
+    return sqe;
+}
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_OPERATION_H_
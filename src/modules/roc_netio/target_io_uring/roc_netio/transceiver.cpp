@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2015 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/transceiver.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+Transceiver::Transceiver(packet::PacketPool& packet_pool,
+                         core::BufferPool<uint8_t>& buffer_pool,
+                         core::IAllocator& allocator)
+    : packet_pool_(packet_pool)
+    , buffer_pool_(buffer_pool)
+    , allocator_(allocator)
+    , started_(false)
+    , ring_initialized_(false)
+    , stop_sem_fd_(-1)
+    , task_sem_fd_(-1)
+    , stop_sem_value_(0)
+    , task_sem_value_(0)
+    , pending_sem_ops_(0)
+    , stop_requested_(false)
+    , next_buf_group_(1)
+    , cond_(mutex_) {
+    stop_sem_op_.callback = &stop_sem_cb_;
+    stop_sem_op_.arg = this;
+
+    task_sem_op_.callback = &task_sem_cb_;
+    task_sem_op_.arg = this;
+
+    cancel_op_.callback = &cancel_cb_;
+    cancel_op_.arg = this;
+
+    if (int err = io_uring_queue_init(SQEntries, &ring_, 0)) {
+        roc_log(LogError, "transceiver: io_uring_queue_init(): %s",
+                core::errno_to_str(-err).c_str());
+        return;
+    }
+    ring_initialized_ = true;
+
+    stop_sem_fd_ = ::eventfd(0, EFD_CLOEXEC);
+    if (stop_sem_fd_ < 0) {
+        roc_log(LogError, "transceiver: eventfd(): %s", core::errno_to_str().c_str());
+        return;
+    }
+
+    task_sem_fd_ = ::eventfd(0, EFD_CLOEXEC);
+    if (task_sem_fd_ < 0) {
+        roc_log(LogError, "transceiver: eventfd(): %s", core::errno_to_str().c_str());
+        return;
+    }
+
+    started_ = Thread::start();
+}
+
+Transceiver::~Transceiver() {
+    if (started_) {
+        post_sem_(stop_sem_fd_);
+        Thread::join();
+    }
+
+    close_sems_();
+
+    if (ring_initialized_) {
+        io_uring_queue_exit(&ring_);
+        ring_initialized_ = false;
+    }
+
+    roc_panic_if(joinable());
+    roc_panic_if(open_ports_.size());
+    roc_panic_if(closing_ports_.size());
+}
+
+bool Transceiver::valid() const {
+    return started_;
+}
+
+size_t Transceiver::num_ports() const {
+    core::Mutex::Lock lock(mutex_);
+
+    return open_ports_.size();
+}
+
+bool Transceiver::add_udp_receiver(packet::Address& bind_address,
+                                   packet::IWriter& writer) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::add_udp_receiver_;
+    task.address = &bind_address;
+    task.writer = &writer;
+
+    run_task_(task);
+
+    if (!task.result) {
+        if (task.port) {
+            wait_port_closed_(*task.port);
+        }
+    }
+
+    return task.result;
+}
+
+packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::add_udp_sender_;
+    task.address = &bind_address;
+    task.writer = NULL;
+
+    run_task_(task);
+
+    if (!task.result) {
+        if (task.port) {
+            wait_port_closed_(*task.port);
+        }
+    }
+
+    return task.writer;
+}
+
+void Transceiver::remove_port(packet::Address bind_address) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    Task task;
+    task.fn = &Transceiver::remove_port_;
+    task.address = &bind_address;
+    task.writer = NULL;
+
+    run_task_(task);
+
+    if (!task.result) {
+        roc_panic("transceiver: can't remove port %s: unknown port",
+                  packet::address_to_str(bind_address).c_str());
+    } else {
+        roc_panic_if_not(task.port);
+        wait_port_closed_(*task.port);
+    }
+}
+
+void Transceiver::handle_closed(BasicPort& port) {
+    core::Mutex::Lock lock(mutex_);
+
+    for (core::SharedPtr<BasicPort> pp = closing_ports_.front(); pp;
+         pp = closing_ports_.nextof(*pp)) {
+        if (pp.get() != &port) {
+            continue;
+        }
+
+        roc_log(LogDebug, "transceiver: asynchronous close finished: port %s",
+                packet::address_to_str(port.address()).c_str());
+
+        closing_ports_.remove(*pp);
+        cond_.broadcast();
+
+        break;
+    }
+}
+
+void Transceiver::run() {
+    roc_log(LogDebug, "transceiver: starting event loop");
+
+    arm_sem_read_(stop_sem_op_, stop_sem_fd_, stop_sem_value_);
+    arm_sem_read_(task_sem_op_, task_sem_fd_, task_sem_value_);
+
+    for (;;) {
+        const int err = io_uring_submit_and_wait(&ring_, 1);
+        if (err < 0 && err != -EINTR) {
+            roc_panic("transceiver: io_uring_submit_and_wait(): %s",
+                      core::errno_to_str(-err).c_str());
+        }
+
+        unsigned head = 0;
+        unsigned count = 0;
+        io_uring_cqe* cqe;
+
+        // dispatch all pending completions at once; callbacks only queue
+        // new submissions, which are flushed by the next submit_and_wait()
+        io_uring_for_each_cqe(&ring_, head, cqe) {
+            Operation& op = *(Operation*)io_uring_cqe_get_data(cqe);
+            const int res = cqe->res;
+            const unsigned cqe_flags = cqe->flags;
+
+            count++;
+
+            op.callback(op.arg, res, cqe_flags);
+        }
+
+        io_uring_cq_advance(&ring_, count);
+
+        if (should_stop_()) {
+            break;
+        }
+    }
+
+    roc_log(LogDebug, "transceiver: finishing event loop");
+}
+
+void Transceiver::task_sem_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    Transceiver& self = *(Transceiver*)arg;
+
+    self.pending_sem_ops_--;
+
+    if (res < 0) {
+        if (res != -ECANCELED) {
+            roc_log(LogError, "transceiver: eventfd read error: %s",
+                    core::errno_to_str(-res).c_str());
+        }
+        return;
+    }
+
+    self.process_tasks_();
+
+    if (!self.stop_requested_) {
+        self.arm_sem_read_(self.task_sem_op_, self.task_sem_fd_, self.task_sem_value_);
+    }
+}
+
+void Transceiver::stop_sem_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    Transceiver& self = *(Transceiver*)arg;
+
+    self.pending_sem_ops_--;
+
+    if (res < 0) {
+        roc_log(LogError, "transceiver: eventfd read error: %s",
+                core::errno_to_str(-res).c_str());
+        return;
+    }
+
+    self.stop_requested_ = true;
+
+    self.async_close_ports_();
+
+    // the task semaphore read is still in flight; cancel it so that the
+    // loop can drain all completions and exit
+    io_uring_prep_cancel(begin_operation(self.ring_, self.cancel_op_),
+                         &self.task_sem_op_, 0);
+    self.pending_sem_ops_++;
+
+    self.process_tasks_();
+}
+
+void Transceiver::cancel_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    Transceiver& self = *(Transceiver*)arg;
+
+    (void)res; // -ENOENT if the read completed before it was cancelled
+
+    self.pending_sem_ops_--;
+}
+
+void Transceiver::arm_sem_read_(Operation& op, int fd, uint64_t& value) {
+    io_uring_prep_read(begin_operation(ring_, op), fd, &value, sizeof(value), 0);
+    pending_sem_ops_++;
+}
+
+void Transceiver::post_sem_(int fd) {
+    const uint64_t value = 1;
+    while (::write(fd, &value, sizeof(value)) != sizeof(value)) {
+        if (errno != EINTR) {
+            roc_panic("transceiver: can't post eventfd: %s",
+                      core::errno_to_str().c_str());
+        }
+    }
+}
+
+void Transceiver::close_sems_() {
+    if (task_sem_fd_ >= 0) {
+        ::close(task_sem_fd_);
+        task_sem_fd_ = -1;
+    }
+
+    if (stop_sem_fd_ >= 0) {
+        ::close(stop_sem_fd_);
+        stop_sem_fd_ = -1;
+    }
+}
+
+void Transceiver::async_close_ports_() {
+    core::Mutex::Lock lock(mutex_);
+
+    while (core::SharedPtr<BasicPort> port = open_ports_.front()) {
+        open_ports_.remove(*port);
+        closing_ports_.push_back(*port);
+
+        port->async_close();
+    }
+}
+
+void Transceiver::run_task_(Task& task) {
+    core::Mutex::Lock lock(mutex_);
+
+    tasks_.push_back(task);
+
+    post_sem_(task_sem_fd_);
+
+    while (!task.done) {
+        cond_.wait();
+    }
+}
+
+void Transceiver::process_tasks_() {
+    core::Mutex::Lock lock(mutex_);
+
+    while (Task* task = tasks_.front()) {
+        tasks_.remove(*task);
+
+        task->result = (this->*(task->fn))(*task);
+        task->done = true;
+    }
+
+    cond_.broadcast();
+}
+
+bool Transceiver::add_udp_receiver_(Task& task) {
+    core::SharedPtr<BasicPort> rp = new (allocator_)
+        UDPReceiverPort(*this, *task.address, ring_, next_buf_group_++, *task.writer,
+                        packet_pool_, buffer_pool_, allocator_);
+
+    if (!rp) {
+        roc_log(LogError, "transceiver: can't add port %s: can't allocate receiver",
+                packet::address_to_str(*task.address).c_str());
+
+        return false;
+    }
+
+    task.port = rp.get();
+
+    if (!rp->open()) {
+        roc_log(LogError, "transceiver: can't add port %s: can't start receiver",
+                packet::address_to_str(*task.address).c_str());
+
+        closing_ports_.push_back(*rp);
+        rp->async_close();
+
+        return false;
+    }
+
+    *task.address = rp->address();
+    open_ports_.push_back(*rp);
+
+    return true;
+}
+
+bool Transceiver::add_udp_sender_(Task& task) {
+    core::SharedPtr<UDPSenderPort> sp =
+        new (allocator_) UDPSenderPort(*this, *task.address, ring_, allocator_);
+    if (!sp) {
+        roc_log(LogError, "transceiver: can't add port %s: can't allocate sender",
+                packet::address_to_str(*task.address).c_str());
+
+        return false;
+    }
+
+    task.port = sp.get();
+
+    if (!sp->open()) {
+        roc_log(LogError, "transceiver: can't add port %s: can't start sender",
+                packet::address_to_str(*task.address).c_str());
+
+        closing_ports_.push_back(*sp);
+        sp->async_close();
+
+        return false;
+    }
+
+    task.writer = sp.get();
+    *task.address = sp->address();
+
+    open_ports_.push_back(*sp);
+
+    return true;
+}
+
+bool Transceiver::remove_port_(Task& task) {
+    roc_log(LogDebug, "transceiver: removing port %s",
+            packet::address_to_str(*task.address).c_str());
+
+    core::SharedPtr<BasicPort> curr = open_ports_.front();
+    while (curr) {
+        core::SharedPtr<BasicPort> next = open_ports_.nextof(*curr);
+
+        if (curr->address() == *task.address) {
+            open_ports_.remove(*curr);
+            closing_ports_.push_back(*curr);
+
+            task.port = curr.get();
+            curr->async_close();
+
+            return true;
+        }
+
+        curr = next;
+    }
+
+    return false;
+}
+
+void Transceiver::wait_port_closed_(const BasicPort& port) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (port_is_closing_(port)) {
+        cond_.wait();
+    }
+}
+
+bool Transceiver::port_is_closing_(const BasicPort& port) {
+    for (core::SharedPtr<BasicPort> pp = closing_ports_.front(); pp;
+         pp = closing_ports_.nextof(*pp)) {
+        if (pp.get() == &port) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Transceiver::should_stop_() {
+    core::Mutex::Lock lock(mutex_);
+
+    return stop_requested_ && pending_sem_ops_ == 0 && open_ports_.size() == 0
+        && closing_ports_.size() == 0;
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2015 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/udp_receiver_port.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+UDPReceiverPort::UDPReceiverPort(ICloseHandler& close_handler,
+                                 const packet::Address& address,
+                                 io_uring& ring,
+                                 unsigned buf_group,
+                                 packet::IWriter& writer,
+                                 packet::PacketPool& packet_pool,
+                                 core::BufferPool<uint8_t>& buffer_pool,
+                                 core::IAllocator& allocator)
+    : BasicPort(allocator)
+    , close_handler_(close_handler)
+    , ring_(ring)
+    , buf_group_(buf_group)
+    , fd_(-1)
+    , buf_ring_(NULL)
+    , recv_armed_(false)
+    , cancel_armed_(false)
+    , multishot_(true)
+    , stopping_(false)
+    , closed_(false)
+    , address_(address)
+    , writer_(writer)
+    , packet_pool_(packet_pool)
+    , buffer_pool_(buffer_pool)
+    , packet_counter_(0) {
+    memset(&recv_msg_, 0, sizeof(recv_msg_));
+
+    recv_op_.callback = &recv_cb_;
+    recv_op_.arg = this;
+
+    cancel_op_.callback = &cancel_cb_;
+    cancel_op_.arg = this;
+}
+
+UDPReceiverPort::~UDPReceiverPort() {
+    if (fd_ >= 0) {
+        roc_panic(
+            "udp receiver: receiver was not fully closed before calling destructor");
+    }
+}
+
+const packet::Address& UDPReceiverPort::address() const {
+    return address_;
+}
+
+bool UDPReceiverPort::open() {
+    if (!open_socket_()) {
+        return false;
+    }
+
+    if (!setup_buf_ring_()) {
+        return false;
+    }
+
+    arm_recv_();
+
+    roc_log(LogInfo, "udp receiver: opened port %s (multishot receive)",
+            packet::address_to_str(address_).c_str());
+
+    return true;
+}
+
+void UDPReceiverPort::async_close() {
+    if (closed_ || stopping_) {
+        return; // handle_closed() was already called or will be called
+    }
+
+    stopping_ = true;
+
+    if (fd_ < 0) {
+        finish_close_();
+        return;
+    }
+
+    roc_log(LogInfo, "udp receiver: closing port %s",
+            packet::address_to_str(address_).c_str());
+
+    if (recv_armed_) {
+        io_uring_prep_cancel(begin_operation(ring_, cancel_op_), &recv_op_, 0);
+        cancel_armed_ = true;
+    } else {
+        finish_close_();
+    }
+}
+
+void UDPReceiverPort::recv_cb_(void* arg, int res, unsigned cqe_flags) {
+    roc_panic_if_not(arg);
+
+    UDPReceiverPort& self = *(UDPReceiverPort*)arg;
+
+    if (!(cqe_flags & IORING_CQE_F_MORE)) {
+        self.recv_armed_ = false;
+    }
+
+    bool rearm = true;
+
+    if (res >= 0) {
+        self.handle_datagram_(res, cqe_flags);
+    } else if (res == -ENOBUFS) {
+        roc_log(LogDebug, "udp receiver: no registered buffers left: dst=%s",
+                packet::address_to_str(self.address_).c_str());
+    } else if (res == -EINVAL && self.multishot_ && self.packet_counter_ == 0) {
+        // the kernel doesn't support multishot receive; fall back to
+        // re-arming a single-shot receive after every datagram
+        roc_log(LogDebug,
+                "udp receiver:"
+                " multishot receive not supported, falling back to single-shot");
+        self.multishot_ = false;
+    } else if (res != -ECANCELED) {
+        roc_log(LogError, "udp receiver: network error: num=%u dst=%s: %s",
+                self.packet_counter_, packet::address_to_str(self.address_).c_str(),
+                core::errno_to_str(-res).c_str());
+        rearm = false;
+    } else {
+        rearm = false;
+    }
+
+    if (self.stopping_) {
+        if (!self.recv_armed_ && !self.cancel_armed_) {
+            self.finish_close_();
+        }
+        return;
+    }
+
+    if (!self.recv_armed_ && rearm) {
+        self.arm_recv_();
+    }
+}
+
+void UDPReceiverPort::cancel_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    UDPReceiverPort& self = *(UDPReceiverPort*)arg;
+
+    (void)res; // -ENOENT if the receive completed before it was cancelled
+
+    self.cancel_armed_ = false;
+
+    if (!self.recv_armed_) {
+        self.finish_close_();
+    }
+}
+
+bool UDPReceiverPort::open_socket_() {
+    fd_ = ::socket(address_.version() == 6 ? AF_INET6 : AF_INET,
+                   SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        roc_log(LogError, "udp receiver: socket(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (address_.multicast() && address_.port() > 0) {
+        const int on = 1;
+        if (::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) < 0) {
+            roc_log(LogError, "udp receiver: setsockopt(SO_REUSEADDR): %s",
+                    core::errno_to_str().c_str());
+            return false;
+        }
+    }
+
+    if (address_.version() == 6) {
+        const int on = 1;
+        if (::setsockopt(fd_, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof(on)) < 0) {
+            roc_log(LogDebug, "udp receiver: setsockopt(IPV6_V6ONLY): %s",
+                    core::errno_to_str().c_str());
+        }
+    }
+
+    if (::bind(fd_, address_.saddr(), address_.slen()) < 0) {
+        roc_log(LogError, "udp receiver: bind(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    socklen_t addrlen = address_.slen();
+    if (::getsockname(fd_, address_.saddr(), &addrlen) < 0) {
+        roc_log(LogError, "udp receiver: getsockname(): %s",
+                core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (addrlen != address_.slen()) {
+        roc_log(LogError,
+                "udp receiver: getsockname(): unexpected len: got=%lu expected=%lu",
+                (unsigned long)addrlen, (unsigned long)address_.slen());
+        return false;
+    }
+
+    return true;
+}
+
+bool UDPReceiverPort::setup_buf_ring_() {
+    int err = 0;
+    buf_ring_ = io_uring_setup_buf_ring(&ring_, NumBuffers, (int)buf_group_, 0, &err);
+    if (!buf_ring_) {
+        roc_log(LogError, "udp receiver: io_uring_setup_buf_ring(): %s",
+                core::errno_to_str(-err).c_str());
+        return false;
+    }
+
+    for (size_t n = 0; n < NumBuffers; n++) {
+        bufs_[n] = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+        if (!bufs_[n]) {
+            roc_log(LogError, "udp receiver: can't allocate buffer");
+            return false;
+        }
+
+        io_uring_buf_ring_add(buf_ring_, bufs_[n]->data(), bufs_[n]->size(),
+                              (unsigned short)n, io_uring_buf_ring_mask(NumBuffers),
+                              (int)n);
+    }
+
+    io_uring_buf_ring_advance(buf_ring_, NumBuffers);
+
+    return true;
+}
+
+void UDPReceiverPort::arm_recv_() {
+    memset(&recv_msg_, 0, sizeof(recv_msg_));
+
+    // reserve room for the source address in the selected buffer
+    recv_msg_.msg_namelen = sizeof(sockaddr_storage);
+
+    io_uring_sqe* sqe = begin_operation(ring_, recv_op_);
+
+    if (multishot_) {
+        io_uring_prep_recvmsg_multishot(sqe, fd_, &recv_msg_, 0);
+    } else {
+        io_uring_prep_recvmsg(sqe, fd_, &recv_msg_, 0);
+    }
+
+    sqe->flags |= IOSQE_BUFFER_SELECT;
+    sqe->buf_group = (unsigned short)buf_group_;
+
+    recv_armed_ = true;
+}
+
+void UDPReceiverPort::handle_datagram_(int res, unsigned cqe_flags) {
+    if (!(cqe_flags & IORING_CQE_F_BUFFER)) {
+        // no buffer was selected, nothing was received
+        return;
+    }
+
+    const unsigned short bid = (unsigned short)(cqe_flags >> IORING_CQE_BUFFER_SHIFT);
+    roc_panic_if(bid >= NumBuffers);
+
+    core::SharedPtr<core::Buffer<uint8_t> > bp = bufs_[bid];
+    roc_panic_if(!bp);
+
+    // hand a fresh buffer to the kernel in place of the consumed one
+    replenish_buffer_(bid);
+
+    io_uring_recvmsg_out* out = io_uring_recvmsg_validate(bp->data(), res, &recv_msg_);
+    if (!out) {
+        roc_log(LogError, "udp receiver: can't parse receive completion: num=%u dst=%s",
+                packet_counter_, packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    packet::Address src_addr;
+    if (!src_addr.set_saddr((const sockaddr*)io_uring_recvmsg_name(out))) {
+        roc_log(LogError, "udp receiver: can't determine source address: num=%u dst=%s",
+                packet_counter_, packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    const size_t payload_len = io_uring_recvmsg_payload_length(out, res, &recv_msg_);
+
+    if (payload_len == 0) {
+        roc_log(LogTrace, "udp receiver: empty packet: num=%u src=%s dst=%s",
+                packet_counter_, packet::address_to_str(src_addr).c_str(),
+                packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    if (out->flags & MSG_TRUNC) {
+        roc_log(LogDebug,
+                "udp receiver:"
+                " ignoring truncated datagram: num=%u src=%s dst=%s",
+                packet_counter_, packet::address_to_str(src_addr).c_str(),
+                packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    packet_counter_++;
+
+    roc_log(LogTrace, "udp receiver: received packet: num=%u src=%s dst=%s nread=%ld",
+            packet_counter_, packet::address_to_str(src_addr).c_str(),
+            packet::address_to_str(address_).c_str(), (long)payload_len);
+
+    // the payload sits in the selected buffer after the completion header
+    // and the source address; reference it in-place instead of copying
+    const uint8_t* payload = (const uint8_t*)io_uring_recvmsg_payload(out, &recv_msg_);
+    const size_t offset = (size_t)(payload - bp->data());
+
+    if (offset + payload_len > bp->size()) {
+        roc_panic("udp receiver: unexpected buffer size: got %ld, max %ld",
+                  (long)(offset + payload_len), (long)bp->size());
+    }
+
+    packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!pp) {
+        roc_log(LogError, "udp receiver: can't allocate packet");
+        return;
+    }
+
+    pp->add_flags(packet::Packet::FlagUDP);
+
+    pp->udp()->src_addr = src_addr;
+    pp->udp()->dst_addr = address_;
+
+    pp->set_data(core::Slice<uint8_t>(*bp, offset, payload_len));
+
+    writer_.write(pp);
+}
+
+void UDPReceiverPort::replenish_buffer_(unsigned short bid) {
+    bufs_[bid] = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+    if (!bufs_[bid]) {
+        roc_log(LogError, "udp receiver: can't allocate buffer");
+        return;
+    }
+
+    io_uring_buf_ring_add(buf_ring_, bufs_[bid]->data(), bufs_[bid]->size(), bid,
+                          io_uring_buf_ring_mask(NumBuffers), 0);
+    io_uring_buf_ring_advance(buf_ring_, 1);
+}
+
+void UDPReceiverPort::finish_close_() {
+    if (closed_) {
+        return; // handle_closed() was already called
+    }
+
+    if (buf_ring_) {
+        io_uring_free_buf_ring(&ring_, buf_ring_, NumBuffers, (int)buf_group_);
+        buf_ring_ = NULL;
+    }
+
+    for (size_t n = 0; n < NumBuffers; n++) {
+        bufs_[n] = NULL;
+    }
+
+    if (fd_ >= 0) {
+        if (::close(fd_) < 0) {
+            roc_log(LogError, "udp receiver: close(): %s", core::errno_to_str().c_str());
+        }
+        fd_ = -1;
+
+        roc_log(LogInfo, "udp receiver: closed port %s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    closed_ = true;
+    close_handler_.handle_closed(*this);
+}
+
+} // namespace netio
+} // namespace roc
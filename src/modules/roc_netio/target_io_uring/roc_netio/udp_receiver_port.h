@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2015 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_io_uring/roc_netio/udp_receiver_port.h
+//! @brief UDP receiver.
+
+#ifndef ROC_NETIO_UDP_RECEIVER_PORT_H_
+#define ROC_NETIO_UDP_RECEIVER_PORT_H_
+
+#include <liburing.h>
+#include <sys/socket.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_netio/basic_port.h"
+#include "roc_netio/iclose_handler.h"
+#include "roc_netio/operation.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace netio {
+
+//! UDP receiver.
+class UDPReceiverPort : public BasicPort {
+public:
+    //! Initialize.
+    UDPReceiverPort(ICloseHandler& close_handler,
+                    const packet::Address&,
+                    io_uring& ring,
+                    unsigned buf_group,
+                    packet::IWriter& writer,
+                    packet::PacketPool& packet_pool,
+                    core::BufferPool<uint8_t>& buffer_pool,
+                    core::IAllocator& allocator);
+
+    //! Destroy.
+    ~UDPReceiverPort();
+
+    //! Get bind address.
+    virtual const packet::Address& address() const;
+
+    //! Open receiver.
+    virtual bool open();
+
+    //! Asynchronously close receiver.
+    virtual void async_close();
+
+private:
+    //! Number of buffers pre-registered with the kernel for incoming
+    //! datagrams. The kernel picks a free buffer for every datagram, so
+    //! no per-datagram allocation or copying happens on the I/O path.
+    enum { NumBuffers = 64 };
+
+    static void recv_cb_(void* arg, int res, unsigned cqe_flags);
+    static void cancel_cb_(void* arg, int res, unsigned cqe_flags);
+
+    bool open_socket_();
+    bool setup_buf_ring_();
+
+    void arm_recv_();
+
+    void handle_datagram_(int res, unsigned cqe_flags);
+    void replenish_buffer_(unsigned short bid);
+
+    void finish_close_();
+
+    ICloseHandler& close_handler_;
+
+    io_uring& ring_;
+    const unsigned buf_group_;
+
+    int fd_;
+
+    io_uring_buf_ring* buf_ring_;
+    core::SharedPtr<core::Buffer<uint8_t> > bufs_[NumBuffers];
+
+    msghdr recv_msg_;
+
+    Operation recv_op_;
+    Operation cancel_op_;
+
+    bool recv_armed_;
+    bool cancel_armed_;
+    bool multishot_;
+    bool stopping_;
+    bool closed_;
+
+    packet::Address address_;
+    packet::IWriter& writer_;
+
+    packet::PacketPool& packet_pool_;
+    core::BufferPool<uint8_t>& buffer_pool_;
+
+    unsigned packet_counter_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_UDP_RECEIVER_PORT_H_
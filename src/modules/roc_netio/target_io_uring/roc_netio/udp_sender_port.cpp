@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2015 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/udp_sender_port.h"
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/address_to_str.h"
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace roc {
+namespace netio {
+
+UDPSenderPort::UDPSenderPort(ICloseHandler& close_handler,
+                             const packet::Address& address,
+                             io_uring& ring,
+                             core::IAllocator& allocator)
+    : BasicPort(allocator)
+    , close_handler_(close_handler)
+    , ring_(ring)
+    , fd_(-1)
+    , sem_fd_(-1)
+    , sem_value_(0)
+    , sem_armed_(false)
+    , cancel_armed_(false)
+    , n_inflight_(0)
+    , address_(address)
+    , pending_(0)
+    , stopped_(true)
+    , closing_(false)
+    , closed_(false)
+    , packet_counter_(0) {
+    sem_op_.callback = &sem_cb_;
+    sem_op_.arg = this;
+
+    cancel_op_.callback = &cancel_cb_;
+    cancel_op_.arg = this;
+
+    for (size_t n = 0; n < SendQueue; n++) {
+        send_ops_[n].op.callback = &send_cb_;
+        send_ops_[n].op.arg = &send_ops_[n];
+        send_ops_[n].port = this;
+    }
+}
+
+UDPSenderPort::~UDPSenderPort() {
+    if (fd_ >= 0 || sem_fd_ >= 0) {
+        roc_panic("udp sender: sender was not fully closed before calling destructor");
+    }
+}
+
+const packet::Address& UDPSenderPort::address() const {
+    return address_;
+}
+
+bool UDPSenderPort::open() {
+    sem_fd_ = ::eventfd(0, EFD_CLOEXEC);
+    if (sem_fd_ < 0) {
+        roc_log(LogError, "udp sender: eventfd(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    arm_sem_read_();
+
+    if (!open_socket_()) {
+        return false;
+    }
+
+    roc_log(LogInfo, "udp sender: opened port %s (batched transmit)",
+            packet::address_to_str(address_).c_str());
+
+    stopped_ = false;
+
+    return true;
+}
+
+void UDPSenderPort::async_close() {
+    core::Mutex::Lock lock(mutex_);
+
+    stopped_ = true;
+
+    if (pending_ == 0) {
+        close_();
+    }
+}
+
+void UDPSenderPort::write(const packet::PacketPtr& pp) {
+    if (!pp) {
+        roc_panic("udp sender: unexpected null packet");
+    }
+
+    if (!pp->udp()) {
+        roc_panic("udp sender: unexpected non-udp packet");
+    }
+
+    if (!pp->data()) {
+        roc_panic("udp sender: unexpected packet w/o data");
+    }
+
+    core::Mutex::Lock lock(mutex_);
+
+    if (stopped_) {
+        return;
+    }
+
+    list_.push_back(*pp);
+    ++pending_;
+
+    // wake up the event loop; posting under the mutex guarantees that the
+    // eventfd can't be closed concurrently
+    const uint64_t value = 1;
+    while (::write(sem_fd_, &value, sizeof(value)) != sizeof(value)) {
+        if (errno != EINTR) {
+            roc_panic("udp sender: can't post eventfd: %s",
+                      core::errno_to_str().c_str());
+        }
+    }
+}
+
+void UDPSenderPort::sem_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    UDPSenderPort& self = *(UDPSenderPort*)arg;
+
+    self.sem_armed_ = false;
+
+    if (res < 0) {
+        if (res != -ECANCELED) {
+            roc_log(LogError, "udp sender: eventfd read error: src=%s: %s",
+                    packet::address_to_str(self.address_).c_str(),
+                    core::errno_to_str(-res).c_str());
+        }
+        if (self.closing_) {
+            self.finish_close_();
+        }
+        return;
+    }
+
+    self.process_queue_();
+
+    if (!self.closing_) {
+        self.arm_sem_read_();
+    } else {
+        self.finish_close_();
+    }
+}
+
+void UDPSenderPort::cancel_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    UDPSenderPort& self = *(UDPSenderPort*)arg;
+
+    (void)res; // -ENOENT if the read completed before it was cancelled
+
+    self.cancel_armed_ = false;
+    self.finish_close_();
+}
+
+void UDPSenderPort::send_cb_(void* arg, int res, unsigned) {
+    roc_panic_if_not(arg);
+
+    SendOp& op = *(SendOp*)arg;
+    UDPSenderPort& self = *op.port;
+
+    if (res < 0) {
+        roc_log(LogError,
+                "udp sender:"
+                " can't send packet: src=%s dst=%s sz=%ld: %s",
+                packet::address_to_str(self.address_).c_str(),
+                packet::address_to_str(op.pp->udp()->dst_addr).c_str(),
+                (long)op.pp->data().size(), core::errno_to_str(-res).c_str());
+    }
+
+    op.pp = NULL;
+    op.busy = false;
+    self.n_inflight_--;
+
+    self.finish_send_();
+
+    if (!self.closing_) {
+        self.process_queue_();
+    } else {
+        self.finish_close_();
+    }
+}
+
+bool UDPSenderPort::open_socket_() {
+    fd_ = ::socket(address_.version() == 6 ? AF_INET6 : AF_INET,
+                   SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        roc_log(LogError, "udp sender: socket(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (address_.multicast() && address_.port() > 0) {
+        const int on = 1;
+        if (::setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) < 0) {
+            roc_log(LogError, "udp sender: setsockopt(SO_REUSEADDR): %s",
+                    core::errno_to_str().c_str());
+            return false;
+        }
+    }
+
+    if (address_.version() == 6) {
+        const int on = 1;
+        if (::setsockopt(fd_, IPPROTO_IPV6, IPV6_V6ONLY, &on, sizeof(on)) < 0) {
+            roc_log(LogDebug, "udp sender: setsockopt(IPV6_V6ONLY): %s",
+                    core::errno_to_str().c_str());
+        }
+    }
+
+    if (::bind(fd_, address_.saddr(), address_.slen()) < 0) {
+        roc_log(LogError, "udp sender: bind(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    socklen_t addrlen = address_.slen();
+    if (::getsockname(fd_, address_.saddr(), &addrlen) < 0) {
+        roc_log(LogError, "udp sender: getsockname(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (addrlen != address_.slen()) {
+        roc_log(LogError,
+                "udp sender: getsockname(): unexpected len: got=%lu expected=%lu",
+                (unsigned long)addrlen, (unsigned long)address_.slen());
+        return false;
+    }
+
+    return true;
+}
+
+void UDPSenderPort::arm_sem_read_() {
+    io_uring_prep_read(begin_operation(ring_, sem_op_), sem_fd_, &sem_value_,
+                       sizeof(sem_value_), 0);
+    sem_armed_ = true;
+}
+
+void UDPSenderPort::process_queue_() {
+    while (n_inflight_ < SendQueue) {
+        packet::PacketPtr pp = read_();
+        if (!pp) {
+            return;
+        }
+
+        SendOp* op = NULL;
+        for (size_t n = 0; n < SendQueue; n++) {
+            if (!send_ops_[n].busy) {
+                op = &send_ops_[n];
+                break;
+            }
+        }
+        roc_panic_if_not(op);
+
+        submit_send_(*op, pp);
+    }
+}
+
+void UDPSenderPort::submit_send_(SendOp& op, const packet::PacketPtr& pp) {
+    packet::UDP& udp = *pp->udp();
+
+    packet_counter_++;
+
+    roc_log(LogTrace, "udp sender: sending packet: num=%u src=%s dst=%s sz=%ld",
+            packet_counter_, packet::address_to_str(address_).c_str(),
+            packet::address_to_str(udp.dst_addr).c_str(), (long)pp->data().size());
+
+    op.pp = pp; // keep the packet alive until the submission completes
+    op.busy = true;
+
+    op.iov.iov_base = pp->data().data();
+    op.iov.iov_len = pp->data().size();
+
+    memset(&op.msg, 0, sizeof(op.msg));
+    op.msg.msg_iov = &op.iov;
+    op.msg.msg_iovlen = 1;
+    op.msg.msg_name = udp.dst_addr.saddr();
+    op.msg.msg_namelen = udp.dst_addr.slen();
+
+    io_uring_prep_sendmsg(begin_operation(ring_, op.op), fd_, &op.msg, 0);
+
+    n_inflight_++;
+}
+
+void UDPSenderPort::finish_send_() {
+    core::Mutex::Lock lock(mutex_);
+
+    --pending_;
+
+    if (stopped_ && pending_ == 0) {
+        close_();
+    }
+}
+
+packet::PacketPtr UDPSenderPort::read_() {
+    core::Mutex::Lock lock(mutex_);
+
+    packet::PacketPtr pp = list_.front();
+    if (pp) {
+        list_.remove(*pp);
+    }
+
+    return pp;
+}
+
+void UDPSenderPort::close_() {
+    if (closing_) {
+        return;
+    }
+
+    closing_ = true;
+
+    if (fd_ >= 0) {
+        roc_log(LogInfo, "udp sender: closing port %s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    if (sem_armed_) {
+        io_uring_prep_cancel(begin_operation(ring_, cancel_op_), &sem_op_, 0);
+        cancel_armed_ = true;
+    }
+
+    finish_close_();
+}
+
+void UDPSenderPort::finish_close_() {
+    if (closed_) {
+        return; // handle_closed() was already called
+    }
+
+    if (sem_armed_ || cancel_armed_ || n_inflight_ != 0) {
+        return; // wait until all operations complete
+    }
+
+    if (fd_ >= 0) {
+        if (::close(fd_) < 0) {
+            roc_log(LogError, "udp sender: close(): %s", core::errno_to_str().c_str());
+        }
+        fd_ = -1;
+
+        roc_log(LogInfo, "udp sender: closed port %s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    if (sem_fd_ >= 0) {
+        if (::close(sem_fd_) < 0) {
+            roc_log(LogError, "udp sender: close(): %s", core::errno_to_str().c_str());
+        }
+        sem_fd_ = -1;
+    }
+
+    closed_ = true;
+    close_handler_.handle_closed(*this);
+}
+
+} // namespace netio
+} // namespace roc
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2015 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_io_uring/roc_netio/udp_sender_port.h
+//! @brief UDP sender.
+
+#ifndef ROC_NETIO_UDP_SENDER_PORT_H_
+#define ROC_NETIO_UDP_SENDER_PORT_H_
+
+#include <liburing.h>
+#include <sys/socket.h>
+
+#include "roc_core/iallocator.h"
+#include "roc_core/list.h"
+#include "roc_core/mutex.h"
+#include "roc_netio/basic_port.h"
+#include "roc_netio/iclose_handler.h"
+#include "roc_netio/operation.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+
+namespace roc {
+namespace netio {
+
+//! UDP sender.
+class UDPSenderPort : public BasicPort, public packet::IWriter {
+public:
+    //! Initialize.
+    UDPSenderPort(ICloseHandler& close_handler,
+                  const packet::Address&,
+                  io_uring& ring,
+                  core::IAllocator& allocator);
+
+    //! Destroy.
+    ~UDPSenderPort();
+
+    //! Get bind address.
+    virtual const packet::Address& address() const;
+
+    //! Open sender.
+    virtual bool open();
+
+    //! Asynchronously close sender.
+    virtual void async_close();
+
+    //! Write packet.
+    //! @remarks
+    //!  May be called from any thread.
+    virtual void write(const packet::PacketPtr&);
+
+private:
+    //! Maximum number of datagram submissions in flight. All of them are
+    //! flushed to the kernel with a single syscall.
+    enum { SendQueue = 32 };
+
+    //! In-flight datagram submission.
+    struct SendOp {
+        Operation op;           //!< Completion context.
+        UDPSenderPort* port;    //!< Parent port.
+        packet::PacketPtr pp;   //!< Packet being sent.
+        msghdr msg;             //!< Message header passed to the kernel.
+        iovec iov;              //!< Payload of the packet.
+        bool busy;              //!< Submission is in flight.
+
+        SendOp()
+            : port(NULL)
+            , busy(false) {
+            memset(&msg, 0, sizeof(msg));
+            memset(&iov, 0, sizeof(iov));
+        }
+    };
+
+    static void sem_cb_(void* arg, int res, unsigned cqe_flags);
+    static void cancel_cb_(void* arg, int res, unsigned cqe_flags);
+    static void send_cb_(void* arg, int res, unsigned cqe_flags);
+
+    bool open_socket_();
+
+    void arm_sem_read_();
+
+    packet::PacketPtr read_();
+    void process_queue_();
+    void submit_send_(SendOp& op, const packet::PacketPtr& pp);
+    void finish_send_();
+
+    void close_();
+    void finish_close_();
+
+    ICloseHandler& close_handler_;
+
+    io_uring& ring_;
+
+    int fd_;
+    int sem_fd_;
+
+    Operation sem_op_;
+    Operation cancel_op_;
+    uint64_t sem_value_;
+
+    bool sem_armed_;
+    bool cancel_armed_;
+
+    SendOp send_ops_[SendQueue];
+    size_t n_inflight_;
+
+    packet::Address address_;
+
+    core::List<packet::Packet> list_;
+    core::Mutex mutex_;
+
+    size_t pending_;
+    bool stopped_;
+    bool closing_;
+    bool closed_;
+
+    unsigned packet_counter_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_UDP_SENDER_PORT_H_
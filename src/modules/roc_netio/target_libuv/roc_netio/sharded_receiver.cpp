@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_netio/sharded_receiver.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_packet/address_to_str.h"
+
+namespace roc {
+namespace netio {
+
+ShardedReceiver::ShardedReceiver(packet::PacketPool& packet_pool,
+                                 core::BufferPool<uint8_t>& buffer_pool,
+                                 core::IAllocator& allocator,
+                                 size_t n_shards)
+    : allocator_(allocator)
+    , shards_(allocator)
+    , valid_(false) {
+    if (n_shards == 0) {
+        roc_panic("sharded receiver: number of shards is zero");
+    }
+
+    if (!shards_.resize(n_shards)) {
+        return;
+    }
+
+    for (size_t n = 0; n < n_shards; n++) {
+        shards_[n] =
+            new (allocator_) Transceiver(packet_pool, buffer_pool, allocator_);
+
+        if (!shards_[n]) {
+            roc_log(LogError, "sharded receiver: can't allocate transceiver");
+            return;
+        }
+
+        if (!shards_[n]->valid()) {
+            roc_log(LogError, "sharded receiver: can't start transceiver");
+            return;
+        }
+    }
+
+    roc_log(LogDebug, "sharded receiver: started %lu shards",
+            (unsigned long)n_shards);
+
+    valid_ = true;
+}
+
+ShardedReceiver::~ShardedReceiver() {
+    for (size_t n = 0; n < shards_.size(); n++) {
+        if (shards_[n]) {
+            allocator_.destroy(*shards_[n]);
+        }
+    }
+}
+
+bool ShardedReceiver::valid() const {
+    return valid_;
+}
+
+size_t ShardedReceiver::num_shards() const {
+    return shards_.size();
+}
+
+bool ShardedReceiver::add_udp_receiver(packet::Address& bind_address,
+                                       packet::IWriter& writer) {
+    if (!valid()) {
+        roc_panic("sharded receiver: can't use invalid sharded receiver");
+    }
+
+    // the first shard may bind to a random port, which is written back to
+    // bind_address, and the remaining shards are bound to the same endpoint
+    for (size_t n = 0; n < shards_.size(); n++) {
+        if (!shards_[n]->add_udp_receiver(bind_address, writer, true)) {
+            roc_log(LogError, "sharded receiver: can't add port %s to shard %lu",
+                    packet::address_to_str(bind_address).c_str(), (unsigned long)n);
+
+            while (n > 0) {
+                shards_[--n]->remove_port(bind_address);
+            }
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ShardedReceiver::remove_port(packet::Address bind_address) {
+    if (!valid()) {
+        roc_panic("sharded receiver: can't use invalid sharded receiver");
+    }
+
+    for (size_t n = 0; n < shards_.size(); n++) {
+        shards_[n]->remove_port(bind_address);
+    }
+}
+
+} // namespace netio
+} // namespace roc
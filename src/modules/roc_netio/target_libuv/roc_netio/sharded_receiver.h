@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_netio/target_libuv/roc_netio/sharded_receiver.h
+//! @brief Sharded network receiver.
+
+#ifndef ROC_NETIO_SHARDED_RECEIVER_H_
+#define ROC_NETIO_SHARDED_RECEIVER_H_
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/address.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace netio {
+
+//! Sharded network receiver.
+//!
+//! Owns a group of transceivers, each with its own event loop thread. Every
+//! endpoint added with add_udp_receiver() is opened with SO_REUSEPORT on all
+//! shards, so that the kernel hashes incoming flows across the shard threads
+//! instead of one thread handling all traffic of the endpoint.
+//!
+//! All shards feed the same writer, so it's called concurrently from
+//! multiple network threads and should be thread-safe.
+class ShardedReceiver : public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @remarks
+    //!  Starts @p n_shards event loop threads if the object was
+    //!  successfully constructed.
+    ShardedReceiver(packet::PacketPool& packet_pool,
+                    core::BufferPool<uint8_t>& buffer_pool,
+                    core::IAllocator& allocator,
+                    size_t n_shards);
+
+    //! Destroy. Stop all receivers.
+    ~ShardedReceiver();
+
+    //! Check if the receiver was successfully constructed.
+    bool valid() const;
+
+    //! Get number of shards.
+    size_t num_shards() const;
+
+    //! Add UDP datagram receiver port on every shard.
+    //!
+    //! See Transceiver::add_udp_receiver(). If port is zero, a random free
+    //! port is selected when binding the first shard and the remaining
+    //! shards are bound to it.
+    //!
+    //! @returns
+    //!  true on success or false if error occurred
+    bool add_udp_receiver(packet::Address& bind_address, packet::IWriter& writer);
+
+    //! Remove receiver port from every shard. Wait until it will be removed.
+    void remove_port(packet::Address bind_address);
+
+private:
+    core::IAllocator& allocator_;
+
+    core::Array<Transceiver*> shards_;
+
+    bool valid_;
+};
+
+} // namespace netio
+} // namespace roc
+
+#endif // ROC_NETIO_SHARDED_RECEIVER_H_
@@ -10,6 +10,7 @@
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
+#include "roc_core/time.h"
 #include "roc_packet/address_to_str.h"
 
 namespace roc {
@@ -17,14 +18,23 @@ namespace netio {
 
 Transceiver::Transceiver(packet::PacketPool& packet_pool,
                          core::BufferPool<uint8_t>& buffer_pool,
-                         core::IAllocator& allocator)
+                         core::IAllocator& allocator,
+                         int event_loop_core,
+                         bool threadless,
+                         bool lazy_start)
     : packet_pool_(packet_pool)
     , buffer_pool_(buffer_pool)
     , allocator_(allocator)
+    , event_loop_core_(event_loop_core)
+    , threadless_(threadless)
+    , lazy_start_(lazy_start && !threadless)
     , started_(false)
+    , thread_running_(false)
     , loop_initialized_(false)
     , stop_sem_initialized_(false)
     , task_sem_initialized_(false)
+    , quiesce_sem_initialized_(false)
+    , n_pending_tasks_(0)
     , cond_(mutex_) {
     if (int err = uv_loop_init(&loop_)) {
         roc_log(LogError, "transceiver: uv_loop_init(): [%s] %s", uv_err_name(err),
@@ -49,27 +59,61 @@ Transceiver::Transceiver(packet::PacketPool& packet_pool,
     task_sem_.data = this;
     task_sem_initialized_ = true;
 
-    started_ = Thread::start();
+    if (int err = uv_async_init(&loop_, &quiesce_sem_, quiesce_sem_cb_)) {
+        roc_log(LogError, "transceiver: uv_async_init(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return;
+    }
+    quiesce_sem_.data = this;
+    quiesce_sem_initialized_ = true;
+
+    if (threadless_) {
+        // no thread is started; the caller drives the loop via poll()
+        started_ = true;
+        return;
+    }
+
+    if (lazy_start_) {
+        // no thread is started yet; it's spawned when the first port
+        // is added (see begin_task_())
+        started_ = true;
+        return;
+    }
+
+    core::ThreadConfig thread_config;
+    thread_config.name = "roc-netio";
+    thread_config.cpu = event_loop_core_;
+
+    started_ = thread_running_ = Thread::start(thread_config);
 }
 
 Transceiver::~Transceiver() {
-    if (started_) {
+    if (threadless_) {
+        // close ports and semaphores on the caller's thread; the loop run
+        // below drains the close callbacks
+        async_close_ports_();
+        close_sems_();
+    } else if (thread_running_) {
         if (int err = uv_async_send(&stop_sem_)) {
             roc_panic("transceiver: uv_async_send(): [%s] %s", uv_err_name(err),
                       uv_strerror(err));
         }
     } else {
+        // the thread was never started or is quiesced; in both cases no
+        // ports are left, so only the semaphores should be closed
         close_sems_();
     }
 
     if (loop_initialized_) {
-        if (started_) {
+        if (thread_running_) {
             Thread::join();
         } else {
             // If the thread was never started we should manually run the loop to
             // wait all opened handles to be closed. Otherwise, uv_loop_close()
-            // will fail with EBUSY.
-            Transceiver::run(); // non-virtual call from dtor
+            // will fail with EBUSY. The loop is run directly, without the
+            // affinity setup done for the network thread, so that the calling
+            // thread is not pinned.
+            run_loop_();
         }
 
         if (int err = uv_loop_close(&loop_)) {
@@ -83,12 +127,25 @@ Transceiver::~Transceiver() {
     roc_panic_if(closing_ports_.size());
     roc_panic_if(task_sem_initialized_);
     roc_panic_if(stop_sem_initialized_);
+    roc_panic_if(quiesce_sem_initialized_);
 }
 
 bool Transceiver::valid() const {
     return started_;
 }
 
+bool Transceiver::poll() {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    if (!threadless_) {
+        roc_panic("transceiver: poll() may be called only in threadless mode");
+    }
+
+    return uv_run(&loop_, UV_RUN_NOWAIT) != 0;
+}
+
 size_t Transceiver::num_ports() const {
     core::Mutex::Lock lock(mutex_);
 
@@ -96,7 +153,12 @@ size_t Transceiver::num_ports() const {
 }
 
 bool Transceiver::add_udp_receiver(packet::Address& bind_address,
-                                   packet::IWriter& writer) {
+                                   packet::IWriter& writer,
+                                   bool reuseport,
+                                   int busy_poll_core,
+                                   size_t recv_buf_size,
+                                   bool kernel_filter,
+                                   const packet::Address& filter_src) {
     if (!valid()) {
         roc_panic("transceiver: can't use invalid transceiver");
     }
@@ -105,6 +167,11 @@ bool Transceiver::add_udp_receiver(packet::Address& bind_address,
     task.fn = &Transceiver::add_udp_receiver_;
     task.address = &bind_address;
     task.writer = &writer;
+    task.reuseport = reuseport;
+    task.busy_poll_core = busy_poll_core;
+    task.recv_buf_size = recv_buf_size;
+    task.kernel_filter = kernel_filter;
+    task.filter_src = filter_src;
 
     run_task_(task);
 
@@ -117,7 +184,11 @@ bool Transceiver::add_udp_receiver(packet::Address& bind_address,
     return task.result;
 }
 
-packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address) {
+packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address,
+                                             size_t pacing_rate,
+                                             unsigned dscp,
+                                             const core::Atomic** unreachable,
+                                             const core::Atomic** path_mtu) {
     if (!valid()) {
         roc_panic("transceiver: can't use invalid transceiver");
     }
@@ -126,6 +197,10 @@ packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address) {
     task.fn = &Transceiver::add_udp_sender_;
     task.address = &bind_address;
     task.writer = NULL;
+    task.pacing_rate = pacing_rate;
+    task.dscp = dscp;
+    task.unreachable = unreachable;
+    task.path_mtu = path_mtu;
 
     run_task_(task);
 
@@ -138,6 +213,115 @@ packet::IWriter* Transceiver::add_udp_sender(packet::Address& bind_address) {
     return task.writer;
 }
 
+size_t Transceiver::add_udp_ports(UdpPortDesc* descs, size_t n_descs) {
+    if (!valid()) {
+        roc_panic("transceiver: can't use invalid transceiver");
+    }
+
+    if (n_descs == 0) {
+        return 0;
+    }
+
+    Task* tasks = (Task*)allocator_.allocate(sizeof(Task) * n_descs);
+    if (!tasks) {
+        roc_log(LogError, "transceiver: can't add ports: can't allocate task batch");
+        for (size_t n = 0; n < n_descs; n++) {
+            descs[n].ok = false;
+        }
+        return 0;
+    }
+
+    for (size_t n = 0; n < n_descs; n++) {
+        Task& task = *new (&tasks[n]) Task;
+        UdpPortDesc& desc = descs[n];
+
+        task.address = &desc.address;
+
+        if (desc.is_receiver) {
+            if (!desc.writer) {
+                roc_panic("transceiver: receiver port without writer in batch");
+            }
+            task.fn = &Transceiver::add_udp_receiver_;
+            task.writer = desc.writer;
+            task.reuseport = desc.reuseport;
+            task.busy_poll_core = desc.busy_poll_core;
+            task.recv_buf_size = desc.recv_buf_size;
+            task.kernel_filter = desc.kernel_filter;
+            task.filter_src = desc.filter_src;
+        } else {
+            task.fn = &Transceiver::add_udp_sender_;
+            task.pacing_rate = desc.pacing_rate;
+            task.dscp = desc.dscp;
+            task.unreachable = desc.unreachable;
+            task.path_mtu = desc.path_mtu;
+        }
+    }
+
+    if (threadless_) {
+        for (size_t n = 0; n < n_descs; n++) {
+            tasks[n].result = (this->*(tasks[n].fn))(tasks[n]);
+            tasks[n].done = true;
+        }
+    } else if (!begin_task_()) {
+        for (size_t n = 0; n < n_descs; n++) {
+            tasks[n].result = false;
+            tasks[n].done = true;
+        }
+    } else {
+        // all tasks are queued before the single wakeup, so the loop drains
+        // the whole batch in one iteration (see process_tasks_()): one loop
+        // round-trip for the batch instead of one per port
+        for (size_t n = 0; n < n_descs; n++) {
+            tasks_.push_back(tasks[n]);
+        }
+
+        if (int err = uv_async_send(&task_sem_)) {
+            roc_panic("transceiver: uv_async_send(): [%s] %s", uv_err_name(err),
+                      uv_strerror(err));
+        }
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            for (size_t n = 0; n < n_descs; n++) {
+                while (!tasks[n].done) {
+                    cond_.wait();
+                }
+            }
+        }
+
+        end_task_();
+    }
+
+    size_t n_opened = 0;
+
+    for (size_t n = 0; n < n_descs; n++) {
+        Task& task = tasks[n];
+        UdpPortDesc& desc = descs[n];
+
+        desc.ok = task.result;
+
+        if (task.result) {
+            if (!desc.is_receiver) {
+                desc.writer = task.writer;
+            }
+            n_opened++;
+        } else if (task.port) {
+            wait_port_closed_(*task.port);
+        }
+    }
+
+    for (size_t n = 0; n < n_descs; n++) {
+        tasks[n].~Task();
+    }
+    allocator_.deallocate(tasks);
+
+    roc_log(LogDebug, "transceiver: opened port batch: n_ports=%lu n_opened=%lu",
+            (unsigned long)n_descs, (unsigned long)n_opened);
+
+    return n_opened;
+}
+
 void Transceiver::remove_port(packet::Address bind_address) {
     if (!valid()) {
         roc_panic("transceiver: can't use invalid transceiver");
@@ -157,6 +341,10 @@ void Transceiver::remove_port(packet::Address bind_address) {
         roc_panic_if_not(task.port);
         wait_port_closed_(*task.port);
     }
+
+    if (lazy_start_) {
+        quiesce_if_idle_();
+    }
 }
 
 void Transceiver::handle_closed(BasicPort& port) {
@@ -179,6 +367,14 @@ void Transceiver::handle_closed(BasicPort& port) {
 }
 
 void Transceiver::run() {
+    // naming and affinity are already applied via ThreadConfig
+    run_loop_();
+
+    roc_log(LogDebug, "transceiver: event loop thread consumed %lld ms of cpu time",
+            (long long)(core::thread_cputime() / core::Millisecond));
+}
+
+void Transceiver::run_loop_() {
     roc_log(LogDebug, "transceiver: starting event loop");
 
     int err = uv_run(&loop_, UV_RUN_DEFAULT);
@@ -205,6 +401,15 @@ void Transceiver::stop_sem_cb_(uv_async_t* handle) {
     self.process_tasks_();
 }
 
+void Transceiver::quiesce_sem_cb_(uv_async_t* handle) {
+    roc_panic_if_not(handle);
+
+    // break out of uv_run() without closing any handles, so that the
+    // loop can be resumed when the thread is spawned again
+    Transceiver& self = *(Transceiver*)handle->data;
+    uv_stop(&self.loop_);
+}
+
 void Transceiver::async_close_ports_() {
     core::Mutex::Lock lock(mutex_);
 
@@ -226,11 +431,30 @@ void Transceiver::close_sems_() {
         uv_close((uv_handle_t*)&stop_sem_, NULL);
         stop_sem_initialized_ = false;
     }
+
+    if (quiesce_sem_initialized_) {
+        uv_close((uv_handle_t*)&quiesce_sem_, NULL);
+        quiesce_sem_initialized_ = false;
+    }
 }
 
 void Transceiver::run_task_(Task& task) {
-    core::Mutex::Lock lock(mutex_);
+    if (threadless_) {
+        // the loop is driven by this same thread, so the task is executed
+        // in-place instead of being handed off to the loop thread
+        task.result = (this->*(task.fn))(task);
+        task.done = true;
+        return;
+    }
 
+    if (!begin_task_()) {
+        task.result = false;
+        task.done = true;
+        return;
+    }
+
+    // Submission is lock-free, so tasks from concurrent threads don't
+    // serialize on a mutex and are batched by the loop into one iteration.
     tasks_.push_back(task);
 
     if (int err = uv_async_send(&task_sem_)) {
@@ -238,17 +462,106 @@ void Transceiver::run_task_(Task& task) {
                   uv_strerror(err));
     }
 
-    while (!task.done) {
-        cond_.wait();
+    if (!task.done) {
+        core::Mutex::Lock lock(mutex_);
+
+        while (!task.done) {
+            cond_.wait();
+        }
+    }
+
+    end_task_();
+}
+
+bool Transceiver::begin_task_() {
+    if (!lazy_start_) {
+        return true;
+    }
+
+    core::Mutex::Lock lock(start_mutex_);
+
+    if (!ensure_thread_started_()) {
+        return false;
+    }
+
+    ++n_pending_tasks_;
+
+    return true;
+}
+
+void Transceiver::end_task_() {
+    if (!lazy_start_) {
+        return;
+    }
+
+    --n_pending_tasks_;
+}
+
+bool Transceiver::ensure_thread_started_() {
+    if (thread_running_) {
+        return true;
+    }
+
+    roc_log(LogDebug, "transceiver: spawning event loop thread");
+
+    core::ThreadConfig thread_config;
+    thread_config.name = "roc-netio";
+    thread_config.cpu = event_loop_core_;
+
+    if (!Thread::start(thread_config)) {
+        roc_log(LogError, "transceiver: can't start event loop thread");
+        return false;
+    }
+
+    thread_running_ = true;
+
+    return true;
+}
+
+void Transceiver::quiesce_if_idle_() {
+    core::Mutex::Lock lock(start_mutex_);
+
+    if (!thread_running_) {
+        return;
+    }
+
+    if (n_pending_tasks_ != 0) {
+        return;
+    }
+
+    {
+        core::Mutex::Lock port_lock(mutex_);
+
+        if (open_ports_.size() != 0 || closing_ports_.size() != 0) {
+            return;
+        }
     }
+
+    roc_log(LogDebug, "transceiver: quiescing event loop thread: no ports left");
+
+    if (int err = uv_async_send(&quiesce_sem_)) {
+        roc_panic("transceiver: uv_async_send(): [%s] %s", uv_err_name(err),
+                  uv_strerror(err));
+    }
+
+    // New tasks are blocked on start_mutex_ in begin_task_(), and the
+    // loop thread never takes start_mutex_, so joining here can't
+    // deadlock or abandon a task.
+    Thread::join();
+
+    thread_running_ = false;
 }
 
 void Transceiver::process_tasks_() {
+    // Submission is lock-free, but the handlers mutate the port lists,
+    // which are concurrently read by other threads under the mutex, so
+    // the handlers themselves still run under it.
     core::Mutex::Lock lock(mutex_);
 
-    while (Task* task = tasks_.front()) {
-        tasks_.remove(*task);
-
+    // A NULL from the queue may also mean that a producer is mid-push; its
+    // uv_async_send() comes after the push completes, so the callback will
+    // be invoked again and the remaining tasks are picked up then.
+    while (Task* task = tasks_.pop_front()) {
         task->result = (this->*(task->fn))(*task);
         task->done = true;
     }
@@ -257,9 +570,10 @@ void Transceiver::process_tasks_() {
 }
 
 bool Transceiver::add_udp_receiver_(Task& task) {
-    core::SharedPtr<BasicPort> rp =
-        new (allocator_) UDPReceiverPort(*this, *task.address, loop_, *task.writer,
-                                         packet_pool_, buffer_pool_, allocator_);
+    core::SharedPtr<BasicPort> rp = new (allocator_)
+        UDPReceiverPort(*this, *task.address, task.reuseport, task.busy_poll_core,
+                        task.recv_buf_size, task.kernel_filter, task.filter_src, loop_,
+                        *task.writer, packet_pool_, buffer_pool_, allocator_);
 
     if (!rp) {
         roc_log(LogError, "transceiver: can't add port %s: can't allocate receiver",
@@ -288,7 +602,9 @@ bool Transceiver::add_udp_receiver_(Task& task) {
 
 bool Transceiver::add_udp_sender_(Task& task) {
     core::SharedPtr<UDPSenderPort> sp =
-        new (allocator_) UDPSenderPort(*this, *task.address, loop_, allocator_);
+        new (allocator_)
+            UDPSenderPort(*this, *task.address, task.pacing_rate, task.dscp, loop_,
+                          allocator_);
     if (!sp) {
         roc_log(LogError, "transceiver: can't add port %s: can't allocate sender",
                 packet::address_to_str(*task.address).c_str());
@@ -311,6 +627,14 @@ bool Transceiver::add_udp_sender_(Task& task) {
     task.writer = sp.get();
     *task.address = sp->address();
 
+    if (task.unreachable) {
+        *task.unreachable = &sp->unreachable();
+    }
+
+    if (task.path_mtu) {
+        *task.path_mtu = &sp->path_mtu();
+    }
+
     open_ports_.push_back(*sp);
 
     return true;
@@ -341,6 +665,15 @@ bool Transceiver::remove_port_(Task& task) {
 }
 
 void Transceiver::wait_port_closed_(const BasicPort& port) {
+    if (threadless_) {
+        // close callbacks fire from the loop, which is driven by this same
+        // thread, so run the loop until the port is gone
+        while (port_is_closing_(port)) {
+            uv_run(&loop_, UV_RUN_ONCE);
+        }
+        return;
+    }
+
     core::Mutex::Lock lock(mutex_);
 
     while (port_is_closing_(port)) {
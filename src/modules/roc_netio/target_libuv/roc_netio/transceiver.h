@@ -14,11 +14,12 @@
 
 #include <uv.h>
 
+#include "roc_core/atomic.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/cond.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
-#include "roc_core/list_node.h"
+#include "roc_core/mpsc_queue.h"
 #include "roc_core/mutex.h"
 #include "roc_core/thread.h"
 #include "roc_netio/basic_port.h"
@@ -37,11 +38,31 @@ class Transceiver : private ICloseHandler, private core::Thread {
 public:
     //! Initialize.
     //!
+    //! If @p event_loop_core is non-negative, the network thread is pinned
+    //! to that core, so that on NUMA systems packets can be received,
+    //! processed, and freed on the node of the NIC.
+    //!
+    //! If @p threadless is true, no network thread is started. Instead, the
+    //! caller should regularly invoke poll() to drive the event loop, and
+    //! all methods should be called from the polling thread. This removes
+    //! the thread, its stack, and the cross-thread handoff for embedded
+    //! applications that already have an event loop. @p event_loop_core is
+    //! ignored in this mode.
+    //!
+    //! If @p lazy_start is true, the network thread is not started at
+    //! construction. Instead, it's spawned when the first port is added and
+    //! quiesced again when the last port is removed, so that applications
+    //! that keep a transceiver around but stream only occasionally don't
+    //! carry an idle thread and its wakeups. Ignored in threadless mode.
+    //!
     //! @remarks
     //!  Start background thread if the object was successfully constructed.
     Transceiver(packet::PacketPool& packet_pool,
                 core::BufferPool<uint8_t>& buffer_pool,
-                core::IAllocator& allocator);
+                core::IAllocator& allocator,
+                int event_loop_core = -1,
+                bool threadless = false,
+                bool lazy_start = false);
 
     //! Destroy. Stop all receivers and senders.
     //!
@@ -52,6 +73,16 @@ public:
     //! Check if transceiver was successfully constructed.
     bool valid() const;
 
+    //! Run one non-blocking iteration of the event loop.
+    //!
+    //! May be called only in threadless mode. Processes pending network I/O
+    //! on the calling thread: received packets are passed to the port
+    //! writers and queued outgoing packets are sent from here.
+    //!
+    //! @returns
+    //!  true if there are active handles or pending events left
+    bool poll();
+
     //! Get number of receiver and sender ports.
     size_t num_ports() const;
 
@@ -65,9 +96,30 @@ public:
     //! interfaces. If port is zero, a random free port is selected and written
     //! back to @p bind_address.
     //!
+    //! If @p reuseport is true, the socket is opened with SO_REUSEPORT, see
+    //! UDPReceiverPort.
+    //!
+    //! If @p busy_poll_core is non-negative, packets are received by a
+    //! dedicated busy-polling thread pinned to that core instead of the
+    //! event loop, see UDPReceiverPort.
+    //!
+    //! If @p recv_buf_size is non-zero, it defines the kernel socket
+    //! receive buffer size in bytes; see UDPReceiverPort.
+    //!
+    //! If @p kernel_filter is true, datagrams that can't be valid RTP
+    //! (and, if @p filter_src is a valid address, datagrams from other
+    //! sources) are dropped in-kernel with a BPF socket filter; should
+    //! be enabled only on RTP-framed ports, see UDPReceiverPort.
+    //!
     //! @returns
     //!  true on success or false if error occurred
-    bool add_udp_receiver(packet::Address& bind_address, packet::IWriter& writer);
+    bool add_udp_receiver(packet::Address& bind_address,
+                          packet::IWriter& writer,
+                          bool reuseport = false,
+                          int busy_poll_core = -1,
+                          size_t recv_buf_size = 0,
+                          bool kernel_filter = false,
+                          const packet::Address& filter_src = packet::Address());
 
     //! Add UDP datagram sender port.
     //!
@@ -79,46 +131,159 @@ public:
     //! interfaces. If port is zero, a random free port is selected and written
     //! back to @p bind_address.
     //!
+    //! If @p pacing_rate is non-zero, outgoing packets are smoothed by a
+    //! token bucket to at most that many bytes per second instead of
+    //! leaving in bursts, see UDPSenderPort.
+    //!
+    //! If @p dscp is non-zero, outgoing datagrams are marked with the
+    //! given DSCP value (IPv4 TOS and IPv6 traffic class), see
+    //! UDPSenderPort.
+    //!
+    //! If @p unreachable is non-NULL, it receives a pointer to the port's
+    //! destination reachability counter (see UDPSenderPort::unreachable()),
+    //! valid until the port is removed. The counter may be polled by the
+    //! pipeline to back off from a dead destination.
+    //!
+    //! If @p path_mtu is non-NULL, it receives a pointer to the port's
+    //! discovered path MTU (see UDPSenderPort::path_mtu()), valid until
+    //! the port is removed. The value may be polled by the pipeline to
+    //! grow packets up to the path capacity.
+    //!
     //! @returns
     //!  a new packet writer on success or null if error occurred
-    packet::IWriter* add_udp_sender(packet::Address& bind_address);
+    packet::IWriter* add_udp_sender(packet::Address& bind_address,
+                                    size_t pacing_rate = 0,
+                                    unsigned dscp = 0,
+                                    const core::Atomic** unreachable = NULL,
+                                    const core::Atomic** path_mtu = NULL);
+
+    //! Parameters and result of one port in a batched registration.
+    //! See add_udp_ports().
+    struct UdpPortDesc {
+        //! If true, the port is a receiver; otherwise it's a sender.
+        bool is_receiver;
+
+        //! Address to bind the port to; the actually bound address is
+        //! written back, see add_udp_receiver().
+        packet::Address address;
+
+        //! For receivers, the writer that receives incoming packets (required).
+        //! For senders, filled with the writer for outgoing packets on success.
+        packet::IWriter* writer;
+
+        //! Receiver options, see add_udp_receiver().
+        bool reuseport;
+        int busy_poll_core;         //!< Busy-polling core, -1 to disable.
+        size_t recv_buf_size;       //!< Kernel receive buffer size, 0 for default.
+        bool kernel_filter;         //!< Enable in-kernel BPF filter.
+        packet::Address filter_src; //!< Accepted source, invalid to accept all.
+
+        //! Sender options, see add_udp_sender().
+        size_t pacing_rate;
+        unsigned dscp;                     //!< DSCP mark, 0 to disable.
+        const core::Atomic** unreachable;  //!< Reachability counter, optional.
+        const core::Atomic** path_mtu;     //!< Discovered path MTU, optional.
+
+        //! Filled with the per-port result of the batch.
+        bool ok;
+
+        UdpPortDesc()
+            : is_receiver(false)
+            , writer(NULL)
+            , reuseport(false)
+            , busy_poll_core(-1)
+            , recv_buf_size(0)
+            , kernel_filter(false)
+            , pacing_rate(0)
+            , dscp(0)
+            , unreachable(NULL)
+            , path_mtu(NULL)
+            , ok(false) {
+        }
+    };
+
+    //! Add a batch of UDP ports at once.
+    //!
+    //! Equivalent to calling add_udp_receiver() or add_udp_sender() for every
+    //! element of @p descs, but the whole batch is opened, bound, and
+    //! configured in a single event loop iteration: one loop round-trip for
+    //! the batch instead of one per port. This makes reconfigurations with
+    //! many ports fast and minimally disruptive to traffic on ports that are
+    //! already running.
+    //!
+    //! Results are reported collectively: each port's outcome is written to
+    //! UdpPortDesc::ok, and ports that fail don't prevent the rest of the
+    //! batch from being opened.
+    //!
+    //! @returns
+    //!  the number of successfully opened ports
+    size_t add_udp_ports(UdpPortDesc* descs, size_t n_descs);
 
     //! Remove sender or receiver port. Wait until port will be removed.
     void remove_port(packet::Address bind_address);
 
 private:
-    struct Task : core::ListNode {
+    struct Task : core::MpscQueueNode {
         bool (Transceiver::*fn)(Task&);
 
         packet::Address* address;
         packet::IWriter* writer;
         BasicPort* port;
+        bool reuseport;
+        int busy_poll_core;
+        size_t recv_buf_size;
+        bool kernel_filter;
+        packet::Address filter_src;
+        size_t pacing_rate;
+        unsigned dscp;
+        const core::Atomic** unreachable;
+        const core::Atomic** path_mtu;
 
         bool result;
-        bool done;
+
+        // Completion flag, set by the loop thread after result is filled.
+        // The caller may destroy the task as soon as it becomes non-zero.
+        core::Atomic done;
 
         Task()
             : fn(NULL)
             , address(NULL)
             , writer(NULL)
             , port(NULL)
+            , reuseport(false)
+            , busy_poll_core(-1)
+            , recv_buf_size(0)
+            , kernel_filter(false)
+            , pacing_rate(0)
+            , dscp(0)
+            , unreachable(NULL)
+            , path_mtu(NULL)
             , result(false)
-            , done(false) {
+            , done(0) {
         }
     };
 
     static void task_sem_cb_(uv_async_t* handle);
     static void stop_sem_cb_(uv_async_t* handle);
+    static void quiesce_sem_cb_(uv_async_t* handle);
 
     virtual void handle_closed(BasicPort&);
     virtual void run();
 
+    void run_loop_();
+
     void close_sems_();
     void async_close_ports_();
 
     void process_tasks_();
     void run_task_(Task&);
 
+    bool begin_task_();
+    void end_task_();
+
+    bool ensure_thread_started_();
+    void quiesce_if_idle_();
+
     bool add_udp_receiver_(Task&);
     bool add_udp_sender_(Task&);
 
@@ -130,8 +295,17 @@ private:
     core::BufferPool<uint8_t>& buffer_pool_;
     core::IAllocator& allocator_;
 
+    const int event_loop_core_;
+    const bool threadless_;
+    const bool lazy_start_;
+
     bool started_;
 
+    // Whether the loop thread is currently running; differs from started_
+    // only in lazy mode, where the thread is spawned and quiesced on
+    // demand. Guarded by start_mutex_.
+    bool thread_running_;
+
     uv_loop_t loop_;
     bool loop_initialized_;
 
@@ -141,11 +315,24 @@ private:
     uv_async_t task_sem_;
     bool task_sem_initialized_;
 
-    core::List<Task, core::NoOwnership> tasks_;
+    uv_async_t quiesce_sem_;
+    bool quiesce_sem_initialized_;
+
+    // Tasks are submitted lock-free from any number of threads and
+    // drained by the loop thread once per loop iteration.
+    core::MpscQueue<Task, core::NoOwnership> tasks_;
 
     core::List<BasicPort> open_ports_;
     core::List<BasicPort> closing_ports_;
 
+    // Serializes lazy startup and quiescing of the loop thread. Never
+    // taken by the loop thread itself, so the thread may be joined while
+    // it's held. Tasks that were submitted but not yet completed are
+    // counted in n_pending_tasks_, and the thread is quiesced only when
+    // the counter is zero, so an in-flight task can't be abandoned.
+    core::Mutex start_mutex_;
+    core::Atomic n_pending_tasks_;
+
     core::Mutex mutex_;
     core::Cond cond_;
 };
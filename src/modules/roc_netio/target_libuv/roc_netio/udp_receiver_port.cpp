@@ -6,17 +6,73 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#ifdef __linux__
+// for recvmmsg()
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
 #include "roc_netio/udp_receiver_port.h"
+#include "roc_core/alignment.h"
+#include "roc_core/cpu_affinity.h"
+#include "roc_core/flight_recorder.h"
 #include "roc_core/log.h"
+#include "roc_core/metrics_registry.h"
 #include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
+#include "roc_core/time.h"
 #include "roc_packet/address_to_str.h"
 
+#include <sys/socket.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <linux/filter.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <time.h>
+#endif
+
 namespace roc {
 namespace netio {
 
+#ifdef SO_ATTACH_FILTER
+
+namespace {
+
+struct sock_filter bpf_stmt(uint16_t code, uint32_t k) {
+    struct sock_filter insn;
+    insn.code = code;
+    insn.jt = 0;
+    insn.jf = 0;
+    insn.k = k;
+    return insn;
+}
+
+struct sock_filter bpf_jump(uint16_t code, uint32_t k, uint8_t jt, uint8_t jf) {
+    struct sock_filter insn;
+    insn.code = code;
+    insn.jt = jt;
+    insn.jf = jf;
+    insn.k = k;
+    return insn;
+}
+
+} // namespace
+
+#endif // SO_ATTACH_FILTER
+
 UDPReceiverPort::UDPReceiverPort(ICloseHandler& close_handler,
                                  const packet::Address& address,
+                                 bool reuseport,
+                                 int busy_poll_core,
+                                 size_t recv_buf_size,
+                                 bool kernel_filter,
+                                 const packet::Address& filter_src,
                                  uv_loop_t& event_loop,
                                  packet::IWriter& writer,
                                  packet::PacketPool& packet_pool,
@@ -24,15 +80,31 @@ UDPReceiverPort::UDPReceiverPort(ICloseHandler& close_handler,
                                  core::IAllocator& allocator)
     : BasicPort(allocator)
     , close_handler_(close_handler)
+    , allocator_(allocator)
     , loop_(event_loop)
     , handle_initialized_(false)
+    , poll_initialized_(false)
+    , recv_fd_(-1)
+    , reuseport_(reuseport)
+    , kernel_filter_(kernel_filter)
+    , filter_src_(filter_src)
+    , busy_poll_core_(busy_poll_core)
+    , spin_started_(false)
     , recv_started_(false)
     , closed_(false)
     , address_(address)
     , writer_(writer)
     , packet_pool_(packet_pool)
     , buffer_pool_(buffer_pool)
-    , packet_counter_(0) {
+    , pack_pos_(0)
+    , gro_bufs_(NULL)
+    , packet_counter_(0)
+    , recv_buf_size_(recv_buf_size != 0 ? recv_buf_size : (size_t)DefaultRecvBufSize)
+    , drop_sample_limiter_(core::Second)
+    , last_kernel_drops_(0)
+    , metrics_kernel_drops_(NULL) {
+    metrics_kernel_drops_ =
+        core::MetricsRegistry::instance().find_or_add_counter("udp_rx_kernel_drops");
 }
 
 UDPReceiverPort::~UDPReceiverPort() {
@@ -40,6 +112,10 @@ UDPReceiverPort::~UDPReceiverPort() {
         roc_panic(
             "udp receiver: receiver was not fully closed before calling destructor");
     }
+
+    if (gro_bufs_) {
+        allocator_.deallocate(gro_bufs_);
+    }
 }
 
 const packet::Address& UDPReceiverPort::address() const {
@@ -47,15 +123,10 @@ const packet::Address& UDPReceiverPort::address() const {
 }
 
 bool UDPReceiverPort::open() {
-    if (int err = uv_udp_init(&loop_, &handle_)) {
-        roc_log(LogError, "udp receiver: uv_udp_init(): [%s] %s", uv_err_name(err),
-                uv_strerror(err));
+    if (!init_handle_()) {
         return false;
     }
 
-    handle_.data = this;
-    handle_initialized_ = true;
-
     unsigned flags = 0;
     if (address_.multicast() && address_.port() > 0) {
         flags |= UV_UDP_REUSEADDR;
@@ -89,6 +160,36 @@ bool UDPReceiverPort::open() {
         return false;
     }
 
+    tune_recv_buf_();
+
+    if (kernel_filter_) {
+        attach_kernel_filter_();
+    }
+
+    if (busy_poll_core_ >= 0) {
+        if (start_busy_poll_()) {
+            roc_log(LogInfo, "udp receiver: opened port %s (busy-poll receive, core %d)",
+                    packet::address_to_str(address_).c_str(), busy_poll_core_);
+
+            recv_started_ = true;
+
+            return true;
+        }
+
+        roc_log(LogError, "udp receiver: can't start busy-poll receive: dst=%s",
+                packet::address_to_str(address_).c_str());
+        return false;
+    }
+
+    if (start_batch_recv_()) {
+        roc_log(LogInfo, "udp receiver: opened port %s (batched receive)",
+                packet::address_to_str(address_).c_str());
+
+        recv_started_ = true;
+
+        return true;
+    }
+
     if (int err = uv_udp_recv_start(&handle_, alloc_cb_, recv_cb_)) {
         roc_log(LogError, "udp receiver: uv_udp_recv_start(): [%s] %s", uv_err_name(err),
                 uv_strerror(err));
@@ -119,25 +220,280 @@ void UDPReceiverPort::async_close() {
             packet::address_to_str(address_).c_str());
 
     if (recv_started_) {
-        if (int err = uv_udp_recv_stop(&handle_)) {
-            roc_log(LogError, "udp receiver: uv_udp_recv_stop(): [%s] %s",
-                    uv_err_name(err), uv_strerror(err));
+        if (spin_started_) {
+            // the spin thread checks the flag between reads, so
+            // the join is quick
+            spin_stop_ = 1;
+            join();
+            spin_started_ = false;
+        } else if (poll_initialized_) {
+            if (int err = uv_poll_stop(&poll_handle_)) {
+                roc_log(LogError, "udp receiver: uv_poll_stop(): [%s] %s",
+                        uv_err_name(err), uv_strerror(err));
+            }
+        } else {
+            if (int err = uv_udp_recv_stop(&handle_)) {
+                roc_log(LogError, "udp receiver: uv_udp_recv_stop(): [%s] %s",
+                        uv_err_name(err), uv_strerror(err));
+            }
         }
 
         recv_started_ = false;
     }
 
+    if (poll_initialized_ && !uv_is_closing((uv_handle_t*)&poll_handle_)) {
+        uv_close((uv_handle_t*)&poll_handle_, close_cb_);
+    }
+
     if (!uv_is_closing((uv_handle_t*)&handle_)) {
         uv_close((uv_handle_t*)&handle_, close_cb_);
     }
 }
 
+bool UDPReceiverPort::init_handle_() {
+    if (!reuseport_) {
+        if (int err = uv_udp_init(&loop_, &handle_)) {
+            roc_log(LogError, "udp receiver: uv_udp_init(): [%s] %s", uv_err_name(err),
+                    uv_strerror(err));
+            return false;
+        }
+
+        handle_.data = this;
+        handle_initialized_ = true;
+
+        return true;
+    }
+
+#ifdef SO_REUSEPORT
+    // create the socket eagerly, so that SO_REUSEPORT can be set before bind
+    if (int err = uv_udp_init_ex(&loop_, &handle_,
+                                 address_.version() == 6 ? AF_INET6 : AF_INET)) {
+        roc_log(LogError, "udp receiver: uv_udp_init_ex(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    handle_.data = this;
+    handle_initialized_ = true;
+
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+        roc_log(LogError, "udp receiver: uv_fileno(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    const int on = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0) {
+        roc_log(LogError, "udp receiver: setsockopt(SO_REUSEPORT): dst=%s",
+                packet::address_to_str(address_).c_str());
+        return false;
+    }
+
+    return true;
+#else // !SO_REUSEPORT
+    roc_log(LogError, "udp receiver: SO_REUSEPORT is not supported on this platform");
+    return false;
+#endif // !SO_REUSEPORT
+}
+
+// Grow the socket receive buffer, so that a burst accumulating while the
+// process is not scheduled is queued by the kernel instead of dropped. The
+// kernel may clamp the request (net.core.rmem_max on Linux), hence the
+// actual size is read back and logged.
+void UDPReceiverPort::tune_recv_buf_() {
+    int buf_size = (int)recv_buf_size_;
+    if (int err = uv_recv_buffer_size((uv_handle_t*)&handle_, &buf_size)) {
+        roc_log(LogDebug, "udp receiver: uv_recv_buffer_size(): [%s] %s",
+                uv_err_name(err), uv_strerror(err));
+        return;
+    }
+
+    buf_size = 0;
+    (void)uv_recv_buffer_size((uv_handle_t*)&handle_, &buf_size);
+
+    roc_log(LogDebug, "udp receiver: socket receive buffer: requested=%lu actual=%d",
+            (unsigned long)recv_buf_size_, buf_size);
+}
+
+// Attach a classic BPF program that rejects datagrams which can't be
+// valid RTP before the kernel queues them to the socket: too short to
+// hold the fixed header plus the CSRC list, or wrong version bits. With
+// the optional source pin, datagrams from other endpoints are rejected
+// too. This way junk traffic (port scans, chatty middleboxes) is dropped
+// in-kernel, before it costs a wakeup, a pool allocation and a parse.
+void UDPReceiverPort::attach_kernel_filter_() {
+#ifdef SO_ATTACH_FILTER
+    // on a UDP socket the filter sees the datagram starting from the UDP
+    // header; the RTP header starts right after it
+    enum { UdpHdrLen = 8, RtpHdrLen = 12, MaxInsns = 32 };
+
+    struct sock_filter insns[MaxInsns];
+    size_t n = 0;
+
+    // X = 4 * CC, the size of the CSRC list; the MSH load was designed
+    // for the IPv4 IHL nibble, but the RTP CC nibble sits in the same
+    // position; an out-of-range load makes the program drop, which takes
+    // care of empty payloads
+    insns[n++] = bpf_stmt(BPF_LDX | BPF_B | BPF_MSH, UdpHdrLen);
+
+    // drop if the datagram minus the CSRC list can't hold the UDP header
+    // and the fixed RTP header
+    insns[n++] = bpf_stmt(BPF_LD | BPF_W | BPF_LEN, 0);
+    insns[n++] = bpf_stmt(BPF_ALU | BPF_SUB | BPF_X, 0);
+    insns[n++] = bpf_jump(BPF_JMP | BPF_JGE | BPF_K, UdpHdrLen + RtpHdrLen, 1, 0);
+    insns[n++] = bpf_stmt(BPF_RET | BPF_K, 0);
+
+    // drop unless the version bits of the first RTP octet are 2
+    insns[n++] = bpf_stmt(BPF_LD | BPF_B | BPF_ABS, UdpHdrLen);
+    insns[n++] = bpf_stmt(BPF_ALU | BPF_AND | BPF_K, 0xc0);
+    insns[n++] = bpf_jump(BPF_JMP | BPF_JEQ | BPF_K, 0x80, 1, 0);
+    insns[n++] = bpf_stmt(BPF_RET | BPF_K, 0);
+
+    if (filter_src_.valid()) {
+        if (filter_src_.version() != address_.version()) {
+            roc_log(LogError,
+                    "udp receiver:"
+                    " source filter address family mismatch, filtering framing only:"
+                    " src=%s dst=%s",
+                    packet::address_to_str(filter_src_).c_str(),
+                    packet::address_to_str(address_).c_str());
+        } else {
+            if (filter_src_.port() > 0) {
+                // the source port is the first UDP header field
+                insns[n++] = bpf_stmt(BPF_LD | BPF_H | BPF_ABS, 0);
+                insns[n++] = bpf_jump(BPF_JMP | BPF_JEQ | BPF_K,
+                                      (uint32_t)filter_src_.port(), 1, 0);
+                insns[n++] = bpf_stmt(BPF_RET | BPF_K, 0);
+            }
+
+            // the source address lives in the network header, reachable
+            // through the SKF_NET_OFF ancillary offset
+            if (filter_src_.version() == 4) {
+                const struct sockaddr_in* sa =
+                    (const struct sockaddr_in*)filter_src_.saddr();
+
+                insns[n++] =
+                    bpf_stmt(BPF_LD | BPF_W | BPF_ABS, (uint32_t)(SKF_NET_OFF + 12));
+                insns[n++] = bpf_jump(BPF_JMP | BPF_JEQ | BPF_K,
+                                      ntohl(sa->sin_addr.s_addr), 1, 0);
+                insns[n++] = bpf_stmt(BPF_RET | BPF_K, 0);
+            } else {
+                const struct sockaddr_in6* sa =
+                    (const struct sockaddr_in6*)filter_src_.saddr();
+
+                uint32_t words[4];
+                memcpy(words, &sa->sin6_addr, sizeof(words));
+
+                for (size_t i = 0; i < 4; i++) {
+                    insns[n++] = bpf_stmt(BPF_LD | BPF_W | BPF_ABS,
+                                          (uint32_t)(SKF_NET_OFF + 8) + (uint32_t)i * 4);
+                    insns[n++] =
+                        bpf_jump(BPF_JMP | BPF_JEQ | BPF_K, ntohl(words[i]), 1, 0);
+                    insns[n++] = bpf_stmt(BPF_RET | BPF_K, 0);
+                }
+            }
+        }
+    }
+
+    // accept; the verdict is the number of bytes to keep
+    insns[n++] = bpf_stmt(BPF_RET | BPF_K, (uint32_t)-1);
+
+    roc_panic_if(n > MaxInsns);
+
+    if (recv_fd_ < 0) {
+        uv_os_fd_t fd;
+        if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+            roc_log(LogError, "udp receiver: uv_fileno(): [%s] %s", uv_err_name(err),
+                    uv_strerror(err));
+            return;
+        }
+        recv_fd_ = fd;
+    }
+
+    struct sock_fprog prog;
+    prog.len = (unsigned short)n;
+    prog.filter = insns;
+
+    if (setsockopt(recv_fd_, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) != 0) {
+        roc_log(LogError, "udp receiver: setsockopt(SO_ATTACH_FILTER): dst=%s errno=%d",
+                packet::address_to_str(address_).c_str(), errno);
+        return;
+    }
+
+    roc_log(LogDebug,
+            "udp receiver: attached kernel packet filter: dst=%s insns=%lu src_pin=%s",
+            packet::address_to_str(address_).c_str(), (unsigned long)n,
+            filter_src_.valid() ? packet::address_to_str(filter_src_).c_str() : "none");
+#else  // !SO_ATTACH_FILTER
+    roc_log(LogError,
+            "udp receiver: kernel packet filter is not supported on this platform:"
+            " dst=%s",
+            packet::address_to_str(address_).c_str());
+#endif // !SO_ATTACH_FILTER
+}
+
+// Periodically read the kernel per-socket drop counter and publish the
+// delta, so that datagrams dropped before they ever reach userspace are
+// visible in the statistics instead of surfacing only as FEC losses.
+void UDPReceiverPort::sample_kernel_drops_() {
+    if (!drop_sample_limiter_.allow()) {
+        return;
+    }
+
+#ifdef SO_MEMINFO
+    // index of the drop counter in the SO_MEMINFO array (SK_MEMINFO_DROPS)
+    enum { SkMeminfoDrops = 7 };
+
+    if (recv_fd_ < 0) {
+        uv_os_fd_t fd;
+        if (uv_fileno((uv_handle_t*)&handle_, &fd) != 0) {
+            return;
+        }
+        recv_fd_ = fd;
+    }
+
+    uint32_t meminfo[16] = { 0 };
+    socklen_t len = sizeof(meminfo);
+
+    if (getsockopt(recv_fd_, SOL_SOCKET, SO_MEMINFO, meminfo, &len) != 0
+        || len < (SkMeminfoDrops + 1) * sizeof(uint32_t)) {
+        return;
+    }
+
+    const uint32_t drops = meminfo[SkMeminfoDrops];
+
+    if (drops != last_kernel_drops_) {
+        const uint32_t delta = drops - last_kernel_drops_;
+        last_kernel_drops_ = drops;
+
+        if (metrics_kernel_drops_) {
+            metrics_kernel_drops_->add_relaxed((long)delta);
+        }
+
+        roc_log(LogDebug,
+                "udp receiver: kernel dropped datagrams: dst=%s dropped=%lu total=%lu;"
+                " consider increasing the socket receive buffer",
+                packet::address_to_str(address_).c_str(), (unsigned long)delta,
+                (unsigned long)drops);
+    }
+#endif // SO_MEMINFO
+}
+
 void UDPReceiverPort::close_cb_(uv_handle_t* handle) {
     roc_panic_if_not(handle);
 
     UDPReceiverPort& self = *(UDPReceiverPort*)handle->data;
 
-    self.handle_initialized_ = false;
+    if (handle == (uv_handle_t*)&self.poll_handle_) {
+        self.poll_initialized_ = false;
+    } else {
+        self.handle_initialized_ = false;
+    }
+
+    if (self.handle_initialized_ || self.poll_initialized_) {
+        return;
+    }
 
     roc_log(LogInfo, "udp receiver: closed port %s",
             packet::address_to_str(self.address_).c_str());
@@ -184,6 +540,8 @@ void UDPReceiverPort::recv_cb_(uv_udp_t* handle,
 
     UDPReceiverPort& self = *(UDPReceiverPort*)handle->data;
 
+    self.sample_kernel_drops_();
+
     packet::Address src_addr;
     if (sockaddr) {
         if (!src_addr.set_saddr(sockaddr)) {
@@ -258,10 +616,465 @@ void UDPReceiverPort::recv_cb_(uv_udp_t* handle,
     pp->udp()->src_addr = src_addr;
     pp->udp()->dst_addr = self.address_;
 
-    pp->set_data(core::Slice<uint8_t>(*bp, 0, (size_t)nread));
+    // kernel timestamps are not available through libuv; the time of the
+    // read callback is the closest approximation of the arrival time
+    pp->set_receive_timestamp(core::timestamp());
+
+    pp->set_data(self.make_data_(bp, (size_t)nread));
+
+    core::FlightRecorder::instance().record(core::FlightRecorder::Stage_NetioRecv,
+                                            (uint32_t)src_addr.port(), 0,
+                                            (uint32_t)nread);
 
     self.writer_.write(pp);
 }
 
+// Small datagrams are copied into a shared buffer and returned as disjoint
+// slices of it, so that a short packet doesn't pin a whole max-size buffer
+// until the packet is released. The shared buffer is returned to the pool
+// automatically when the last slice referring it is freed.
+core::Slice<uint8_t>
+UDPReceiverPort::make_data_(const core::SharedPtr<core::Buffer<uint8_t> >& bp,
+                            size_t size) {
+    if (size * PackRatio > bp->size()) {
+        // packing wouldn't reclaim much slack; hand over the receive
+        // buffer without copying
+        return core::Slice<uint8_t>(*bp, 0, size);
+    }
+
+    core::Slice<uint8_t> data = copy_data_(bp->data(), size);
+    if (!data) {
+        // the pool is exhausted; better keep an oversized buffer
+        // than drop the packet
+        return core::Slice<uint8_t>(*bp, 0, size);
+    }
+
+    return data;
+}
+
+// Copy a datagram into the shared buffer and return a slice referring it.
+// Returns an empty slice if the pool is exhausted or the datagram doesn't
+// fit into a pool buffer.
+core::Slice<uint8_t> UDPReceiverPort::copy_data_(const uint8_t* data, size_t size) {
+    if (pack_buffer_ && pack_pos_ + size > pack_buffer_->size()) {
+        pack_buffer_ = NULL;
+    }
+
+    if (!pack_buffer_) {
+        pack_buffer_ = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+        if (!pack_buffer_) {
+            return core::Slice<uint8_t>();
+        }
+        pack_pos_ = 0;
+    }
+
+    if (pack_pos_ + size > pack_buffer_->size()) {
+        return core::Slice<uint8_t>();
+    }
+
+    memcpy(pack_buffer_->data() + pack_pos_, data, size);
+
+    core::Slice<uint8_t> out(*pack_buffer_, pack_pos_, pack_pos_ + size);
+
+    // keep every datagram maximum aligned, like a freshly allocated buffer
+    pack_pos_ += core::max_align(size);
+
+    return out;
+}
+
+#ifdef __linux__
+
+bool UDPReceiverPort::init_recv_fd_() {
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+        roc_log(LogError, "udp receiver: uv_fileno(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    recv_fd_ = fd;
+
+#ifdef SO_TIMESTAMPNS
+    // let the kernel stamp every datagram with its actual arrival time, so
+    // that the latency estimation downstream is not skewed by the delay
+    // between the arrival and the moment we read the datagram
+    const int on = 1;
+    if (setsockopt(recv_fd_, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) != 0) {
+        roc_log(LogDebug, "udp receiver: setsockopt(SO_TIMESTAMPNS): dst=%s errno=%d",
+                packet::address_to_str(address_).c_str(), errno);
+    }
+#endif // SO_TIMESTAMPNS
+
+#ifdef UDP_GRO
+    // let the kernel coalesce bursts of datagrams from one sender into a
+    // single aggregate (GRO), so that the stack is traversed once per
+    // aggregate; aggregates are split back into datagrams after reading
+    {
+        const int on = 1;
+        if (setsockopt(recv_fd_, SOL_UDP, UDP_GRO, &on, sizeof(on)) == 0) {
+            gro_bufs_ = allocator_.allocate(GroRecvBatch * GroBufSize);
+            if (!gro_bufs_) {
+                roc_log(LogError, "udp receiver: can't allocate gro buffers: dst=%s",
+                        packet::address_to_str(address_).c_str());
+
+                const int off = 0;
+                (void)setsockopt(recv_fd_, SOL_UDP, UDP_GRO, &off, sizeof(off));
+            }
+        } else {
+            roc_log(LogDebug, "udp receiver: setsockopt(UDP_GRO): dst=%s errno=%d",
+                    packet::address_to_str(address_).c_str(), errno);
+        }
+    }
+#endif // UDP_GRO
+
+    return true;
+}
+
+bool UDPReceiverPort::start_batch_recv_() {
+    if (!init_recv_fd_()) {
+        return false;
+    }
+
+    // The udp handle is used only for binding; reads are done by us, so
+    // polling its descriptor doesn't conflict with libuv.
+    if (int err = uv_poll_init(&loop_, &poll_handle_, recv_fd_)) {
+        roc_log(LogError, "udp receiver: uv_poll_init(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    poll_handle_.data = this;
+    poll_initialized_ = true;
+
+    if (int err = uv_poll_start(&poll_handle_, UV_READABLE, poll_cb_)) {
+        roc_log(LogError, "udp receiver: uv_poll_start(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool UDPReceiverPort::start_busy_poll_() {
+    if (!init_recv_fd_()) {
+        return false;
+    }
+
+#ifdef SO_BUSY_POLL
+    // let the kernel poll the device queue for a while before giving up
+    // on a read, so that an arriving packet is picked up without waiting
+    // for an interrupt; requires CAP_NET_ADMIN on older kernels
+    const int timeout_us = BusyPollTimeoutUs;
+    if (setsockopt(recv_fd_, SOL_SOCKET, SO_BUSY_POLL, &timeout_us, sizeof(timeout_us))
+        != 0) {
+        roc_log(LogDebug, "udp receiver: setsockopt(SO_BUSY_POLL): dst=%s errno=%d",
+                packet::address_to_str(address_).c_str(), errno);
+    }
+#endif // SO_BUSY_POLL
+
+    if (!Thread::start()) {
+        roc_log(LogError, "udp receiver: can't start busy-poll thread: dst=%s",
+                packet::address_to_str(address_).c_str());
+        return false;
+    }
+
+    spin_started_ = true;
+
+    return true;
+}
+
+void UDPReceiverPort::run() {
+    core::pin_thread_to_cpu((unsigned)busy_poll_core_);
+
+    while (!spin_stop_) {
+        // the socket is non-blocking, so the call returns immediately
+        // when the socket is drained and we spin to the next read
+        batch_recv_();
+    }
+}
+
+void UDPReceiverPort::poll_cb_(uv_poll_t* handle, int status, int events) {
+    roc_panic_if_not(handle);
+
+    UDPReceiverPort& self = *(UDPReceiverPort*)handle->data;
+
+    if (status < 0) {
+        roc_log(LogError, "udp receiver: poll error: dst=%s: [%s] %s",
+                packet::address_to_str(self.address_).c_str(), uv_err_name(status),
+                uv_strerror(status));
+        return;
+    }
+
+    if (!(events & UV_READABLE)) {
+        return;
+    }
+
+    self.batch_recv_();
+}
+
+void UDPReceiverPort::batch_recv_() {
+    sample_kernel_drops_();
+
+    for (;;) {
+        core::SharedPtr<core::Buffer<uint8_t> > bufs[RecvBatch];
+
+        struct mmsghdr msgs[RecvBatch];
+        struct iovec iovecs[RecvBatch];
+        struct sockaddr_storage addrs[RecvBatch];
+
+        union {
+            struct cmsghdr align;
+            char data[CMSG_SPACE(sizeof(struct timespec)) + CMSG_SPACE(sizeof(int))];
+        } ctrls[RecvBatch];
+
+        memset(msgs, 0, sizeof(msgs));
+
+        const size_t max_msgs = gro_bufs_ ? (size_t)GroRecvBatch : (size_t)RecvBatch;
+
+        size_t n_bufs = 0;
+        for (; n_bufs < max_msgs; n_bufs++) {
+            if (gro_bufs_) {
+                iovecs[n_bufs].iov_base = (char*)gro_bufs_ + n_bufs * GroBufSize;
+                iovecs[n_bufs].iov_len = GroBufSize;
+            } else {
+                bufs[n_bufs] = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+                if (!bufs[n_bufs]) {
+                    break;
+                }
+
+                iovecs[n_bufs].iov_base = bufs[n_bufs]->data();
+                iovecs[n_bufs].iov_len = bufs[n_bufs]->size();
+            }
+
+            msgs[n_bufs].msg_hdr.msg_iov = &iovecs[n_bufs];
+            msgs[n_bufs].msg_hdr.msg_iovlen = 1;
+            msgs[n_bufs].msg_hdr.msg_name = &addrs[n_bufs];
+            msgs[n_bufs].msg_hdr.msg_namelen = sizeof(addrs[n_bufs]);
+            msgs[n_bufs].msg_hdr.msg_control = ctrls[n_bufs].data;
+            msgs[n_bufs].msg_hdr.msg_controllen = sizeof(ctrls[n_bufs].data);
+        }
+
+        if (n_bufs == 0) {
+            roc_log(LogError, "udp receiver: can't allocate buffer");
+            return;
+        }
+
+        const int n_recv = recvmmsg(recv_fd_, msgs, (unsigned)n_bufs, 0, NULL);
+
+        if (n_recv < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                roc_log(LogError, "udp receiver: recvmmsg(): dst=%s errno=%d",
+                        packet::address_to_str(address_).c_str(), errno);
+            }
+            return;
+        }
+
+        // kernel timestamps are taken from the realtime clock, while
+        // core::timestamp() is monotonic; measure the current offset
+        // between the two clocks to convert them
+        const core::nanoseconds_t recv_time = core::timestamp();
+
+        core::nanoseconds_t realtime_offset = 0;
+        bool have_offset = false;
+
+        struct timespec rt;
+        if (clock_gettime(CLOCK_REALTIME, &rt) == 0) {
+            realtime_offset = recv_time
+                - (core::nanoseconds_t(rt.tv_sec) * core::Second
+                   + core::nanoseconds_t(rt.tv_nsec));
+            have_offset = true;
+        }
+
+        for (int n = 0; n < n_recv; n++) {
+            handle_datagram_(
+                bufs[n], (const uint8_t*)iovecs[n].iov_base, msgs[n],
+                msg_gro_size_(msgs[n]),
+                msg_timestamp_(msgs[n], recv_time, realtime_offset, have_offset));
+        }
+
+        // the socket was drained
+        if ((size_t)n_recv < n_bufs) {
+            return;
+        }
+    }
+}
+
+// Extract the kernel arrival timestamp of a datagram, converted to the
+// core::timestamp() clock; falls back to the time the batch was read if
+// the kernel didn't provide a timestamp.
+core::nanoseconds_t UDPReceiverPort::msg_timestamp_(struct mmsghdr& msg,
+                                                    core::nanoseconds_t fallback,
+                                                    core::nanoseconds_t realtime_offset,
+                                                    bool have_offset) {
+#ifdef SCM_TIMESTAMPNS
+    if (have_offset) {
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg.msg_hdr); cmsg != NULL;
+             cmsg = CMSG_NXTHDR(&msg.msg_hdr, cmsg)) {
+            if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_TIMESTAMPNS) {
+                continue;
+            }
+
+            struct timespec ts;
+            memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+
+            return core::nanoseconds_t(ts.tv_sec) * core::Second
+                + core::nanoseconds_t(ts.tv_nsec) + realtime_offset;
+        }
+    }
+#else  // !SCM_TIMESTAMPNS
+    (void)msg;
+    (void)realtime_offset;
+    (void)have_offset;
+#endif // !SCM_TIMESTAMPNS
+
+    return fallback;
+}
+
+// Extract the GRO segment size of a message; zero means that the message
+// carries a single datagram and should be handled as is.
+size_t UDPReceiverPort::msg_gro_size_(struct mmsghdr& msg) {
+#ifdef UDP_GRO
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg.msg_hdr); cmsg != NULL;
+         cmsg = CMSG_NXTHDR(&msg.msg_hdr, cmsg)) {
+        if (cmsg->cmsg_level != SOL_UDP || cmsg->cmsg_type != UDP_GRO) {
+            continue;
+        }
+
+        int seg_size = 0;
+        memcpy(&seg_size, CMSG_DATA(cmsg), sizeof(seg_size));
+
+        if (seg_size > 0) {
+            return (size_t)seg_size;
+        }
+    }
+#else  // !UDP_GRO
+    (void)msg;
+#endif // !UDP_GRO
+
+    return 0;
+}
+
+void UDPReceiverPort::handle_datagram_(const core::SharedPtr<core::Buffer<uint8_t> >& bp,
+                                       const uint8_t* data,
+                                       const struct mmsghdr& msg,
+                                       size_t gro_size,
+                                       core::nanoseconds_t recv_time) {
+    packet::Address src_addr;
+    if (!src_addr.set_saddr((const sockaddr*)msg.msg_hdr.msg_name)) {
+        roc_log(LogError, "udp receiver: can't determine source address: num=%u dst=%s",
+                packet_counter_, packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    if (msg.msg_len == 0) {
+        roc_log(LogTrace, "udp receiver: empty packet: num=%u src=%s dst=%s",
+                packet_counter_, packet::address_to_str(src_addr).c_str(),
+                packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    if (msg.msg_hdr.msg_flags & MSG_TRUNC) {
+        roc_log(LogDebug,
+                "udp receiver:"
+                " ignoring truncated datagram: num=%u src=%s dst=%s",
+                packet_counter_, packet::address_to_str(src_addr).c_str(),
+                packet::address_to_str(address_).c_str());
+        return;
+    }
+
+    if (bp && msg.msg_len > bp->size()) {
+        roc_panic("udp receiver: unexpected buffer size: got %ld, max %ld",
+                  (long)msg.msg_len, (long)bp->size());
+    }
+
+    if (gro_size == 0 || gro_size >= msg.msg_len) {
+        // the message carries a single datagram
+        core::Slice<uint8_t> pdata =
+            bp ? make_data_(bp, (size_t)msg.msg_len) : copy_data_(data, msg.msg_len);
+        if (!pdata) {
+            roc_log(LogError, "udp receiver: can't allocate buffer");
+            return;
+        }
+
+        write_packet_(src_addr, pdata, recv_time);
+        return;
+    }
+
+    // The message is an aggregate of several datagrams coalesced by the
+    // kernel; split it back. All datagrams have the same size, except the
+    // last one, which may be shorter.
+    roc_log(LogTrace, "udp receiver: received aggregate: src=%s dst=%s sz=%ld seg=%ld",
+            packet::address_to_str(src_addr).c_str(),
+            packet::address_to_str(address_).c_str(), (long)msg.msg_len,
+            (long)gro_size);
+
+    for (size_t off = 0; off < msg.msg_len; off += gro_size) {
+        size_t seg_len = msg.msg_len - off;
+        if (seg_len > gro_size) {
+            seg_len = gro_size;
+        }
+
+        core::Slice<uint8_t> pdata = copy_data_(data + off, seg_len);
+        if (!pdata) {
+            roc_log(LogError, "udp receiver: can't allocate buffer");
+            return;
+        }
+
+        write_packet_(src_addr, pdata, recv_time);
+    }
+}
+
+void UDPReceiverPort::write_packet_(const packet::Address& src_addr,
+                                    const core::Slice<uint8_t>& data,
+                                    core::nanoseconds_t recv_time) {
+    packet_counter_++;
+
+    roc_log(LogTrace, "udp receiver: received packet: num=%u src=%s dst=%s nread=%ld",
+            packet_counter_, packet::address_to_str(src_addr).c_str(),
+            packet::address_to_str(address_).c_str(), (long)data.size());
+
+    packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!pp) {
+        roc_log(LogError, "udp receiver: can't allocate packet");
+        return;
+    }
+
+    pp->add_flags(packet::Packet::FlagUDP);
+
+    pp->udp()->src_addr = src_addr;
+    pp->udp()->dst_addr = address_;
+
+    pp->set_receive_timestamp(recv_time);
+
+    pp->set_data(data);
+
+    core::FlightRecorder::instance().record(core::FlightRecorder::Stage_NetioRecv,
+                                            (uint32_t)src_addr.port(), 0,
+                                            (uint32_t)data.size());
+
+    writer_.write(pp);
+}
+
+#else // !__linux__
+
+bool UDPReceiverPort::start_batch_recv_() {
+    return false;
+}
+
+bool UDPReceiverPort::start_busy_poll_() {
+    return false;
+}
+
+void UDPReceiverPort::run() {
+}
+
+void UDPReceiverPort::poll_cb_(uv_poll_t*, int, int) {
+}
+
+void UDPReceiverPort::batch_recv_() {
+}
+
+#endif // !__linux__
+
 } // namespace netio
 } // namespace roc
@@ -14,26 +14,63 @@
 
 #include <uv.h>
 
+#include "roc_core/atomic.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/list_node.h"
+#include "roc_core/rate_limiter.h"
 #include "roc_core/refcnt.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
 #include "roc_netio/basic_port.h"
 #include "roc_netio/iclose_handler.h"
 #include "roc_packet/address.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet_pool.h"
 
+#ifdef __linux__
+struct mmsghdr;
+#endif
+
 namespace roc {
 namespace netio {
 
 //! UDP receiver.
-class UDPReceiverPort : public BasicPort {
+class UDPReceiverPort : public BasicPort, private core::Thread {
 public:
     //! Initialize.
+    //!
+    //! If @p reuseport is true, the socket is opened with SO_REUSEPORT, so
+    //! that multiple receivers may be bound to the same endpoint and the
+    //! kernel will distribute incoming flows across them.
+    //!
+    //! If @p busy_poll_core is non-negative, packets are received by a
+    //! dedicated thread pinned to that core, spinning on the socket with
+    //! SO_BUSY_POLL, instead of the event loop; this removes the event
+    //! loop wakeup latency from the receive path at the cost of a fully
+    //! loaded core.
+    //!
+    //! @p recv_buf_size defines the kernel socket receive buffer size in
+    //! bytes; callers that know the stream rate should size it as
+    //! rate * latency with some headroom, so that a scheduling hiccup of
+    //! up to the session latency doesn't make the kernel drop datagrams.
+    //! Zero selects a generous default.
+    //!
+    //! If @p kernel_filter is true, a classic BPF program is attached to
+    //! the socket that drops datagrams which can't be valid RTP (too
+    //! short, wrong version bits) in-kernel, before they cost a wakeup,
+    //! a pool allocation and a parse; should be enabled only on ports
+    //! whose protocol is RTP-framed. If @p filter_src is additionally a
+    //! valid address, datagrams from other sources are dropped too.
     UDPReceiverPort(ICloseHandler& close_handler,
                     const packet::Address&,
+                    bool reuseport,
+                    int busy_poll_core,
+                    size_t recv_buf_size,
+                    bool kernel_filter,
+                    const packet::Address& filter_src,
                     uv_loop_t& event_loop,
                     packet::IWriter& writer,
                     packet::PacketPool& packet_pool,
@@ -53,6 +90,33 @@ public:
     virtual void async_close();
 
 private:
+    //! Number of datagrams read from the socket with a single syscall
+    //! in batched receive mode.
+    enum { RecvBatch = 32 };
+
+    //! Datagrams at most 1/PackRatio of the buffer size are packed into
+    //! a shared buffer instead of pinning a whole buffer each.
+    enum { PackRatio = 2 };
+
+    //! Size of the receive buffer of a single message in GRO mode,
+    //! enough for a maximum size aggregate.
+    enum { GroBufSize = 65536 };
+
+    //! Number of messages read from the socket with a single syscall in
+    //! GRO mode; smaller than RecvBatch since every message may carry a
+    //! whole aggregate and needs a large dedicated buffer.
+    enum { GroRecvBatch = 4 };
+
+    //! How long the kernel polls the device queue before giving up on a
+    //! read in busy-poll mode, in microseconds.
+    enum { BusyPollTimeoutUs = 50 };
+
+    //! Default socket receive buffer size: enough for several seconds of
+    //! a typical CD-quality stream or a second of a multi-stream burst,
+    //! so that distro defaults (often a couple hundred KB) don't make the
+    //! kernel silently drop datagrams under load.
+    enum { DefaultRecvBufSize = 4 * 1024 * 1024 };
+
     static void close_cb_(uv_handle_t* handle);
     static void alloc_cb_(uv_handle_t* handle, size_t size, uv_buf_t* buf);
     static void recv_cb_(uv_udp_t* handle,
@@ -60,14 +124,68 @@ private:
                          const uv_buf_t* buf,
                          const sockaddr* addr,
                          unsigned flags);
+    static void poll_cb_(uv_poll_t* handle, int status, int events);
+
+    bool init_handle_();
+
+    bool init_recv_fd_();
+
+    void tune_recv_buf_();
+    void attach_kernel_filter_();
+    void sample_kernel_drops_();
+
+    bool start_batch_recv_();
+    void batch_recv_();
+
+    bool start_busy_poll_();
+    virtual void run();
+
+    core::Slice<uint8_t> make_data_(const core::SharedPtr<core::Buffer<uint8_t> >& bp,
+                                    size_t size);
+
+    core::Slice<uint8_t> copy_data_(const uint8_t* data, size_t size);
+
+#ifdef __linux__
+    static core::nanoseconds_t msg_timestamp_(::mmsghdr& msg,
+                                              core::nanoseconds_t fallback,
+                                              core::nanoseconds_t realtime_offset,
+                                              bool have_offset);
+
+    static size_t msg_gro_size_(::mmsghdr& msg);
+
+    void handle_datagram_(const core::SharedPtr<core::Buffer<uint8_t> >& bp,
+                          const uint8_t* data,
+                          const ::mmsghdr& msg,
+                          size_t gro_size,
+                          core::nanoseconds_t recv_time);
+
+    void write_packet_(const packet::Address& src_addr,
+                       const core::Slice<uint8_t>& data,
+                       core::nanoseconds_t recv_time);
+#endif
 
     ICloseHandler& close_handler_;
 
+    core::IAllocator& allocator_;
+
     uv_loop_t& loop_;
 
     uv_udp_t handle_;
     bool handle_initialized_;
 
+    uv_poll_t poll_handle_;
+    bool poll_initialized_;
+    int recv_fd_;
+
+    bool reuseport_;
+
+    const bool kernel_filter_;
+    const packet::Address filter_src_;
+
+    int busy_poll_core_;
+    bool spin_started_;
+    core::Atomic spin_stop_;
+
     bool recv_started_;
     bool closed_;
 
@@ -77,7 +195,25 @@ private:
     packet::PacketPool& packet_pool_;
     core::BufferPool<uint8_t>& buffer_pool_;
 
+    core::SharedPtr<core::Buffer<uint8_t> > pack_buffer_;
+    size_t pack_pos_;
+
+    //! Receive buffers for GRO mode, or NULL if GRO is not enabled.
+    //! Aggregates may be much larger than a pool buffer, so they are
+    //! received into dedicated buffers, and the extracted datagrams are
+    //! copied into pool buffers.
+    void* gro_bufs_;
+
     unsigned packet_counter_;
+
+    const size_t recv_buf_size_;
+
+    //! Periodic sampling of the kernel per-socket drop counter, so that
+    //! datagrams dropped before we ever see them show up in the exported
+    //! statistics instead of surfacing later as unexplained FEC losses.
+    core::RateLimiter drop_sample_limiter_;
+    uint32_t last_kernel_drops_;
+    core::Atomic* metrics_kernel_drops_;
 };
 
 } // namespace netio
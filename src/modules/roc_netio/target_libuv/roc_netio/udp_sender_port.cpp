@@ -6,17 +6,36 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#ifdef __linux__
+// for sendmmsg()
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#endif
+
 #include "roc_netio/udp_sender_port.h"
+#include "roc_core/flight_recorder.h"
 #include "roc_core/helpers.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/trace.h"
 #include "roc_packet/address_to_str.h"
 
+#include <errno.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
+
 namespace roc {
 namespace netio {
 
 UDPSenderPort::UDPSenderPort(ICloseHandler& close_handler,
                              const packet::Address& address,
+                             size_t pacing_rate,
+                             unsigned dscp,
                              uv_loop_t& event_loop,
                              core::IAllocator& allocator)
     : BasicPort(allocator)
@@ -24,15 +43,33 @@ UDPSenderPort::UDPSenderPort(ICloseHandler& close_handler,
     , loop_(event_loop)
     , write_sem_initialized_(false)
     , handle_initialized_(false)
+    , pacing_rate_(pacing_rate)
+    , pacing_burst_(pacing_rate / 1000 * PacingBurstMs > (size_t)PacingMinBurst
+                        ? pacing_rate / 1000 * PacingBurstMs
+                        : (size_t)PacingMinBurst)
+    , dscp_(dscp)
+    , pacing_tokens_(0)
+    , pacing_refilled_at_(0)
+    , pacing_timer_initialized_(false)
+    , send_fd_(-1)
+    , gso_supported_(false)
+    , connected_(false)
+    , connect_disabled_(false)
     , address_(address)
     , pending_(0)
+    , dropped_overflow_(0)
+    , unreachable_(0)
+    , path_mtu_(0)
     , stopped_(true)
     , closed_(false)
     , packet_counter_(0) {
+    if (dscp > 63) {
+        roc_panic("udp sender: dscp should be in range [0; 63], got %u", dscp);
+    }
 }
 
 UDPSenderPort::~UDPSenderPort() {
-    if (handle_initialized_ || write_sem_initialized_) {
+    if (handle_initialized_ || write_sem_initialized_ || pacing_timer_initialized_) {
         roc_panic("udp sender: sender was not fully closed before calling destructor");
     }
 }
@@ -41,6 +78,19 @@ const packet::Address& UDPSenderPort::address() const {
     return address_;
 }
 
+const core::Atomic& UDPSenderPort::unreachable() const {
+    return unreachable_;
+}
+
+const core::Atomic& UDPSenderPort::path_mtu() const {
+    return path_mtu_;
+}
+
+bool UDPSenderPort::status_unreachable_(int status) {
+    return status == UV_ECONNREFUSED || status == UV_EHOSTUNREACH
+        || status == UV_ENETUNREACH;
+}
+
 bool UDPSenderPort::open() {
     if (int err = uv_async_init(&loop_, &write_sem_, write_sem_cb_)) {
         roc_log(LogError, "udp sender: uv_async_init(): [%s] %s", uv_err_name(err),
@@ -60,6 +110,20 @@ bool UDPSenderPort::open() {
     handle_.data = this;
     handle_initialized_ = true;
 
+    if (pacing_rate_ > 0) {
+        if (int err = uv_timer_init(&loop_, &pacing_timer_)) {
+            roc_log(LogError, "udp sender: uv_timer_init(): [%s] %s", uv_err_name(err),
+                    uv_strerror(err));
+            return false;
+        }
+
+        pacing_timer_.data = this;
+        pacing_timer_initialized_ = true;
+
+        pacing_tokens_ = (double)pacing_burst_;
+        pacing_refilled_at_ = core::timestamp();
+    }
+
     unsigned flags = 0;
     if (address_.multicast() && address_.port() > 0) {
         flags |= UV_UDP_REUSEADDR;
@@ -92,8 +156,59 @@ bool UDPSenderPort::open() {
         return false;
     }
 
-    roc_log(LogInfo, "udp sender: opened port %s",
-            packet::address_to_str(address_).c_str());
+    if (dscp_ != 0 && !setup_dscp_()) {
+        return false;
+    }
+
+    // grow the socket send buffer, so that a burst from the pipeline is
+    // queued by the kernel instead of rejected; the kernel may clamp the
+    // request (net.core.wmem_max on Linux)
+    {
+        int buf_size = (int)SendBufSize;
+        if (int err = uv_send_buffer_size((uv_handle_t*)&handle_, &buf_size)) {
+            roc_log(LogDebug, "udp sender: uv_send_buffer_size(): [%s] %s",
+                    uv_err_name(err), uv_strerror(err));
+        }
+    }
+
+#ifdef __linux__
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+        roc_log(LogError, "udp sender: uv_fileno(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+    } else {
+        send_fd_ = fd;
+    }
+
+#ifdef UDP_SEGMENT
+    if (send_fd_ >= 0) {
+        // probe for segmentation offload support; zero just clears the
+        // per-socket segment size, actual sizes are passed per message
+        const int zero = 0;
+        if (setsockopt(send_fd_, SOL_UDP, UDP_SEGMENT, &zero, sizeof(zero)) == 0) {
+            gso_supported_ = true;
+        } else {
+            roc_log(LogDebug, "udp sender: setsockopt(UDP_SEGMENT): src=%s errno=%d",
+                    packet::address_to_str(address_).c_str(), errno);
+        }
+    }
+#endif // UDP_SEGMENT
+#endif // __linux__
+
+    const char* mode = "";
+    if (send_fd_ >= 0) {
+        mode = gso_supported_ ? " (batched transmit, segmentation offload)"
+                              : " (batched transmit)";
+    }
+
+    roc_log(LogInfo, "udp sender: opened port %s%s",
+            packet::address_to_str(address_).c_str(), mode);
+
+    if (pacing_rate_ > 0) {
+        roc_log(LogInfo, "udp sender: pacing enabled: src=%s rate=%lu burst=%lu",
+                packet::address_to_str(address_).c_str(), (unsigned long)pacing_rate_,
+                (unsigned long)pacing_burst_);
+    }
 
     stopped_ = false;
 
@@ -123,6 +238,12 @@ void UDPSenderPort::write(const packet::PacketPtr& pp) {
         roc_panic("udp sender: unexpected packet w/o data");
     }
 
+    ROC_TRACE2(udp_sender_write, (unsigned long)pp->begin(), pp->data().size());
+
+    core::FlightRecorder::instance().record(core::FlightRecorder::Stage_NetioSend,
+                                            (uint32_t)pp->udp()->dst_addr.port(), 0,
+                                            (uint32_t)pp->data().size());
+
     {
         core::Mutex::Lock lock(mutex_);
 
@@ -130,6 +251,10 @@ void UDPSenderPort::write(const packet::PacketPtr& pp) {
             return;
         }
 
+        if (list_.size() >= MaxQueue && !make_room_(*pp)) {
+            return;
+        }
+
         list_.push_back(*pp);
         ++pending_;
     }
@@ -147,11 +272,14 @@ void UDPSenderPort::close_cb_(uv_handle_t* handle) {
 
     if (handle == (uv_handle_t*)&self.handle_) {
         self.handle_initialized_ = false;
-    } else {
+    } else if (handle == (uv_handle_t*)&self.write_sem_) {
         self.write_sem_initialized_ = false;
+    } else {
+        self.pacing_timer_initialized_ = false;
     }
 
-    if (self.handle_initialized_ || self.write_sem_initialized_) {
+    if (self.handle_initialized_ || self.write_sem_initialized_
+        || self.pacing_timer_initialized_) {
         return;
     }
 
@@ -167,33 +295,386 @@ void UDPSenderPort::write_sem_cb_(uv_async_t* handle) {
 
     UDPSenderPort& self = *(UDPSenderPort*)handle->data;
 
-    while (packet::PacketPtr pp = self.read_()) {
-        packet::UDP& udp = *pp->udp();
+    self.process_queue_();
+}
+
+void UDPSenderPort::pacing_timer_cb_(uv_timer_t* handle) {
+    roc_panic_if_not(handle);
+
+    UDPSenderPort& self = *(UDPSenderPort*)handle->data;
+
+    self.process_queue_();
+}
 
-        self.packet_counter_++;
+void UDPSenderPort::process_queue_() {
+    if (send_fd_ >= 0) {
+        batch_send_();
+        return;
+    }
 
-        roc_log(LogTrace, "udp sender: sending packet: num=%u src=%s dst=%s sz=%ld",
-                self.packet_counter_, packet::address_to_str(self.address_).c_str(),
-                packet::address_to_str(udp.dst_addr).c_str(), (long)pp->data().size());
+    while (packet::PacketPtr pp = read_()) {
+        send_one_(pp);
+    }
+}
 
-        uv_buf_t buf;
-        buf.base = (char*)pp->data().data();
-        buf.len = pp->data().size();
+void UDPSenderPort::send_one_(const packet::PacketPtr& pp) {
+    packet::UDP& udp = *pp->udp();
 
-        udp.request.data = &self;
+    packet_counter_++;
 
-        if (int err = uv_udp_send(&udp.request, &self.handle_, &buf, 1,
-                                  udp.dst_addr.saddr(), send_cb_)) {
-            roc_log(LogError, "udp sender: uv_udp_send(): [%s] %s", uv_err_name(err),
-                    uv_strerror(err));
-            continue;
+    roc_log(LogTrace, "udp sender: sending packet: num=%u src=%s dst=%s sz=%ld",
+            packet_counter_, packet::address_to_str(address_).c_str(),
+            packet::address_to_str(udp.dst_addr).c_str(), (long)pp->data().size());
+
+    uv_buf_t buf;
+    buf.base = (char*)pp->data().data();
+    buf.len = pp->data().size();
+
+    udp.request.data = this;
+
+    if (int err
+        = uv_udp_send(&udp.request, &handle_, &buf, 1, udp.dst_addr.saddr(), send_cb_)) {
+        roc_log(LogError, "udp sender: uv_udp_send(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        if (status_unreachable_(err)) {
+            unreachable_.incr_relaxed();
+        }
+        finish_send_();
+        return;
+    }
+
+    // will be decremented in send_cb_()
+    pp->incref();
+}
+
+#ifdef __linux__
+
+void UDPSenderPort::batch_send_() {
+    for (;;) {
+        packet::PacketPtr pkts[SendBatch];
+
+        struct mmsghdr msgs[SendBatch];
+        struct iovec iovecs[SendBatch];
+
+#ifdef UDP_SEGMENT
+        union {
+            struct cmsghdr align;
+            char data[CMSG_SPACE(sizeof(uint16_t))];
+        } ctrls[SendBatch];
+
+        memset(ctrls, 0, sizeof(ctrls));
+#endif // UDP_SEGMENT
+
+        // index of the first packet and number of packets of every message
+        size_t msg_first[SendBatch];
+        size_t msg_npkts[SendBatch];
+
+        memset(msgs, 0, sizeof(msgs));
+
+        size_t n_pkts = 0;
+        while (n_pkts < SendBatch && (pkts[n_pkts] = read_())) {
+            iovecs[n_pkts].iov_base = pkts[n_pkts]->data().data();
+            iovecs[n_pkts].iov_len = pkts[n_pkts]->data().size();
+            n_pkts++;
+        }
+
+        if (n_pkts == 0) {
+            return;
+        }
+
+        size_t n_msgs = 0;
+
+        const packet::Address* run_dst = NULL; // destination of the current message
+        size_t run_seg_size = 0;               // segment size of the current message
+        size_t run_payload = 0;                // total payload of the current message
+        bool run_open = false;                 // whether segments may be appended
+
+        for (size_t n = 0; n < n_pkts; n++) {
+            packet::UDP& udp = *pkts[n]->udp();
+            const size_t size = pkts[n]->data().size();
+
+            // A run of consecutive datagrams to one destination is passed to
+            // the kernel as a single message carrying the concatenated payload
+            // and the segment size; the kernel splits it back into datagrams
+            // on transmit (GSO), so the stack is traversed once per run. All
+            // datagrams in a run have the same size, except the last one,
+            // which may be shorter.
+            if (run_open && udp.dst_addr == *run_dst && size <= run_seg_size
+                && run_payload + size <= GsoMaxPayload) {
+                msgs[n_msgs - 1].msg_hdr.msg_iovlen++;
+                msg_npkts[n_msgs - 1]++;
+                run_payload += size;
+                if (size < run_seg_size) {
+                    // a shorter datagram can only be the last segment
+                    run_open = false;
+                }
+                continue;
+            }
+
+            // Typically a sender port streams to a single fixed destination,
+            // so the socket is connected to the destination of the first
+            // packet; subsequent packets are sent without an address,
+            // avoiding a route lookup per datagram.
+            if (!connect_disabled_) {
+                if (!connected_) {
+                    connect_(udp.dst_addr);
+                } else if (udp.dst_addr != connected_addr_) {
+                    // the port sends to multiple destinations; the actual
+                    // disconnect is deferred until the batch is sent, since
+                    // earlier packets in it rely on the connection
+                    connect_disabled_ = true;
+                }
+            }
+
+            msgs[n_msgs].msg_hdr.msg_iov = &iovecs[n];
+            msgs[n_msgs].msg_hdr.msg_iovlen = 1;
+
+            if (connected_ && udp.dst_addr == connected_addr_) {
+                msgs[n_msgs].msg_hdr.msg_name = NULL;
+                msgs[n_msgs].msg_hdr.msg_namelen = 0;
+            } else {
+                msgs[n_msgs].msg_hdr.msg_name = udp.dst_addr.saddr();
+                msgs[n_msgs].msg_hdr.msg_namelen = udp.dst_addr.slen();
+            }
+
+            msg_first[n_msgs] = n;
+            msg_npkts[n_msgs] = 1;
+
+            run_dst = &udp.dst_addr;
+            run_seg_size = size;
+            run_payload = size;
+            run_open = gso_supported_;
+
+            n_msgs++;
+        }
+
+        bool have_gso_msgs = false;
+
+#ifdef UDP_SEGMENT
+        for (size_t m = 0; m < n_msgs; m++) {
+            if (msg_npkts[m] < 2) {
+                continue;
+            }
+
+            msgs[m].msg_hdr.msg_control = ctrls[m].data;
+            msgs[m].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+            struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs[m].msg_hdr);
+            cmsg->cmsg_level = SOL_UDP;
+            cmsg->cmsg_type = UDP_SEGMENT;
+            cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+            const uint16_t seg_size = (uint16_t)pkts[msg_first[m]]->data().size();
+            memcpy(CMSG_DATA(cmsg), &seg_size, sizeof(seg_size));
+
+            have_gso_msgs = true;
+        }
+#endif // UDP_SEGMENT
+
+        size_t n_sent_msgs = 0;
+
+        const int ret = sendmmsg(send_fd_, msgs, (unsigned)n_msgs, 0);
+        if (ret > 0) {
+            n_sent_msgs = (size_t)ret;
+            unreachable_.store_relaxed(0);
+        } else if (errno == ECONNREFUSED || errno == EHOSTUNREACH
+                   || errno == ENETUNREACH) {
+            // ICMP errors from the destination are reported on the
+            // connected socket; count them so that observers can tell
+            // a dead destination from a transient send failure
+            unreachable_.incr_relaxed();
+
+            roc_log(LogDebug, "udp sender: destination unreachable: src=%s errno=%d",
+                    packet::address_to_str(address_).c_str(), errno);
+        } else if (errno == EMSGSIZE) {
+            // a datagram exceeded the path MTU, i.e. the path shrank;
+            // refresh the estimate so that observers re-size packets
+            roc_log(LogDebug, "udp sender: datagram exceeds path mtu: src=%s",
+                    packet::address_to_str(address_).c_str());
+
+            query_path_mtu_();
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            roc_log(LogError, "udp sender: sendmmsg(): src=%s errno=%d",
+                    packet::address_to_str(address_).c_str(), errno);
+
+            if (have_gso_msgs) {
+                // the kernel or the driver refused a segmented send;
+                // don't try segmentation again on this socket
+                roc_log(LogInfo, "udp sender: disabling segmentation offload: src=%s",
+                        packet::address_to_str(address_).c_str());
+                gso_supported_ = false;
+            }
         }
 
-        // will be decremented in send_cb_()
-        pp->incref();
+        size_t n_sent = 0;
+
+        for (size_t m = 0; m < n_sent_msgs; m++) {
+            for (size_t i = 0; i < msg_npkts[m]; i++) {
+                const packet::PacketPtr& pp = pkts[msg_first[m] + i];
+
+                packet_counter_++;
+
+                roc_log(LogTrace, "udp sender: sent packet: num=%u src=%s dst=%s sz=%ld",
+                        packet_counter_, packet::address_to_str(address_).c_str(),
+                        packet::address_to_str(pp->udp()->dst_addr).c_str(),
+                        (long)pp->data().size());
+            }
+            n_sent += msg_npkts[m];
+        }
+
+        // one lock for the whole batch; the packet references held in
+        // pkts[] are released in a group as well when the batch iteration
+        // ends, returning the buffers to their pools together
+        if (n_sent != 0) {
+            finish_sends_(n_sent);
+        }
+
+        // Packets that didn't make it into the batch (socket buffer full or
+        // transient error) are handed to libuv, which queues them until the
+        // socket becomes writable again.
+        for (size_t n = n_sent; n < n_pkts; n++) {
+            send_one_(pkts[n]);
+        }
+
+        if (connected_ && connect_disabled_) {
+            disconnect_();
+        }
+
+        // the queue was drained
+        if (n_pkts < SendBatch) {
+            return;
+        }
+    }
+}
+
+// Mark outgoing datagrams with the configured DSCP value. The DSCP
+// occupies the upper six bits of the IPv4 TOS byte and of the IPv6
+// traffic class; the lower two (ECN) bits are left zero.
+bool UDPSenderPort::setup_dscp_() {
+    uv_os_fd_t fd;
+    if (int err = uv_fileno((uv_handle_t*)&handle_, &fd)) {
+        roc_log(LogError, "udp sender: uv_fileno(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+        return false;
+    }
+
+    const int tos = (int)(dscp_ << 2);
+
+    int ret = -1;
+    if (address_.version() == 6) {
+        ret = setsockopt(fd, IPPROTO_IPV6, IPV6_TCLASS, &tos, sizeof(tos));
+    } else {
+        ret = setsockopt(fd, IPPROTO_IP, IP_TOS, &tos, sizeof(tos));
+    }
+
+    if (ret != 0) {
+        roc_log(LogError, "udp sender: setsockopt(%s): src=%s errno=%d",
+                address_.version() == 6 ? "IPV6_TCLASS" : "IP_TOS",
+                packet::address_to_str(address_).c_str(), errno);
+        return false;
+    }
+
+    roc_log(LogInfo, "udp sender: dscp marking enabled: src=%s dscp=%u",
+            packet::address_to_str(address_).c_str(), dscp_);
+
+    return true;
+}
+
+bool UDPSenderPort::connect_(const packet::Address& address) {
+    if (::connect(send_fd_, address.saddr(), address.slen()) == -1) {
+        roc_log(LogError, "udp sender: connect(): src=%s dst=%s errno=%d",
+                packet::address_to_str(address_).c_str(),
+                packet::address_to_str(address).c_str(), errno);
+        connect_disabled_ = true;
+        return false;
+    }
+
+    connected_ = true;
+    connected_addr_ = address;
+
+    roc_log(LogInfo, "udp sender: connected port %s to %s",
+            packet::address_to_str(address_).c_str(),
+            packet::address_to_str(connected_addr_).c_str());
+
+    // let the kernel track the path MTU towards the destination instead
+    // of fragmenting; a datagram that doesn't fit fails with EMSGSIZE
+    if (connected_addr_.version() == 6) {
+        const int pmtud = IPV6_PMTUDISC_DO;
+        if (setsockopt(send_fd_, IPPROTO_IPV6, IPV6_MTU_DISCOVER, &pmtud,
+                       sizeof(pmtud))
+            == -1) {
+            roc_log(LogDebug, "udp sender: setsockopt(IPV6_MTU_DISCOVER): errno=%d",
+                    errno);
+        }
+    } else {
+        const int pmtud = IP_PMTUDISC_DO;
+        if (setsockopt(send_fd_, IPPROTO_IP, IP_MTU_DISCOVER, &pmtud, sizeof(pmtud))
+            == -1) {
+            roc_log(LogDebug, "udp sender: setsockopt(IP_MTU_DISCOVER): errno=%d",
+                    errno);
+        }
+    }
+
+    query_path_mtu_();
+
+    return true;
+}
+
+void UDPSenderPort::query_path_mtu_() {
+    int mtu = 0;
+    socklen_t len = sizeof(mtu);
+
+    if (connected_addr_.version() == 6) {
+        if (getsockopt(send_fd_, IPPROTO_IPV6, IPV6_MTU, &mtu, &len) == -1) {
+            roc_log(LogDebug, "udp sender: getsockopt(IPV6_MTU): errno=%d", errno);
+            return;
+        }
+    } else {
+        if (getsockopt(send_fd_, IPPROTO_IP, IP_MTU, &mtu, &len) == -1) {
+            roc_log(LogDebug, "udp sender: getsockopt(IP_MTU): errno=%d", errno);
+            return;
+        }
+    }
+
+    if (mtu <= 0) {
+        return;
+    }
+
+    if (path_mtu_.load_relaxed() != mtu) {
+        roc_log(LogInfo, "udp sender: path mtu: src=%s dst=%s mtu=%d",
+                packet::address_to_str(address_).c_str(),
+                packet::address_to_str(connected_addr_).c_str(), mtu);
     }
+
+    path_mtu_.store_relaxed(mtu);
 }
 
+void UDPSenderPort::disconnect_() {
+    sockaddr sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_family = AF_UNSPEC;
+
+    if (::connect(send_fd_, &sa, sizeof(sa)) == -1) {
+        roc_log(LogError, "udp sender: disconnect: connect(): src=%s errno=%d",
+                packet::address_to_str(address_).c_str(), errno);
+    }
+
+    connected_ = false;
+
+    // the estimate was for the connected destination only
+    path_mtu_.store_relaxed(0);
+
+    roc_log(LogInfo, "udp sender: disconnected port %s: multiple destinations",
+            packet::address_to_str(address_).c_str());
+}
+
+#else // !__linux__
+
+void UDPSenderPort::batch_send_() {
+}
+
+#endif // !__linux__
+
 void UDPSenderPort::send_cb_(uv_udp_send_t* req, int status) {
     roc_panic_if_not(req);
 
@@ -216,34 +697,121 @@ void UDPSenderPort::send_cb_(uv_udp_send_t* req, int status) {
                 packet::address_to_str(self.address_).c_str(),
                 packet::address_to_str(pp->udp()->dst_addr).c_str(),
                 (long)pp->data().size(), uv_err_name(status), uv_strerror(status));
+        if (status_unreachable_(status)) {
+            self.unreachable_.incr_relaxed();
+        }
+    } else {
+        self.unreachable_.store_relaxed(0);
     }
 
-    core::Mutex::Lock lock(self.mutex_);
+    self.finish_send_();
+}
+
+void UDPSenderPort::finish_send_() {
+    finish_sends_(1);
+}
+
+void UDPSenderPort::finish_sends_(size_t n) {
+    core::Mutex::Lock lock(mutex_);
 
-    --self.pending_;
+    pending_ -= n;
 
-    if (self.stopped_ && self.pending_ == 0) {
-        self.close_();
+    if (stopped_ && pending_ == 0) {
+        close_();
     }
 }
 
+// Called with mutex_ held when the transmit queue is full. Tries to free a
+// slot for the incoming packet by dropping the newest queued repair packet;
+// FEC redundancy is the most expendable payload in the queue. If there is
+// nothing to evict, the incoming packet itself is dropped (when everything
+// queued is audio, the newest packet is the one to lose).
+bool UDPSenderPort::make_room_(const packet::Packet& incoming) {
+    if (dropped_overflow_++ == 0) {
+        roc_log(LogDebug, "udp sender: transmit queue is full, dropping packets: src=%s",
+                packet::address_to_str(address_).c_str());
+    }
+
+    if (incoming.flags() & packet::Packet::FlagRepair) {
+        // the incoming packet is the newest repair packet
+        return false;
+    }
+
+    packet::PacketPtr victim;
+    for (packet::PacketPtr pp = list_.front(); pp; pp = list_.nextof(*pp)) {
+        if (pp->flags() & packet::Packet::FlagRepair) {
+            victim = pp;
+        }
+    }
+
+    if (!victim) {
+        return false;
+    }
+
+    list_.remove(*victim);
+    --pending_;
+
+    return true;
+}
+
 packet::PacketPtr UDPSenderPort::read_() {
     core::Mutex::Lock lock(mutex_);
 
     packet::PacketPtr pp = list_.front();
     if (pp) {
+        if (pacing_rate_ > 0 && !pacing_admit_(pp->data().size())) {
+            return NULL;
+        }
         list_.remove(*pp);
     }
 
     return pp;
 }
 
+bool UDPSenderPort::pacing_admit_(size_t size) {
+    const core::nanoseconds_t now = core::timestamp();
+
+    pacing_tokens_ +=
+        (double)pacing_rate_ * (double)(now - pacing_refilled_at_) / core::Second;
+    if (pacing_tokens_ > (double)pacing_burst_) {
+        pacing_tokens_ = (double)pacing_burst_;
+    }
+    pacing_refilled_at_ = now;
+
+    // a packet larger than the bucket is released when the bucket is full,
+    // so that it can't get stuck at the head of the queue forever
+    if (pacing_tokens_ >= (double)size || pacing_tokens_ >= (double)pacing_burst_) {
+        pacing_tokens_ -= (double)size;
+        if (pacing_tokens_ < 0) {
+            pacing_tokens_ = 0;
+        }
+        return true;
+    }
+
+    // wake up when enough tokens have accumulated for the head packet;
+    // libuv timers have millisecond resolution, so round the wait up to
+    // avoid a busy loop of immediate wakeups
+    const double deficit = (double)size - pacing_tokens_;
+    uint64_t timeout_ms =
+        (uint64_t)(deficit * core::Second / (double)pacing_rate_ / core::Millisecond);
+    if (timeout_ms == 0) {
+        timeout_ms = 1;
+    }
+
+    if (int err = uv_timer_start(&pacing_timer_, pacing_timer_cb_, timeout_ms, 0)) {
+        roc_log(LogError, "udp sender: uv_timer_start(): [%s] %s", uv_err_name(err),
+                uv_strerror(err));
+    }
+
+    return false;
+}
+
 void UDPSenderPort::close_() {
     if (closed_) {
         return; // handle_closed() was already called
     }
 
-    if (!handle_initialized_ && !write_sem_initialized_) {
+    if (!handle_initialized_ && !write_sem_initialized_ && !pacing_timer_initialized_) {
         closed_ = true;
         close_handler_.handle_closed(*this);
 
@@ -260,6 +828,10 @@ void UDPSenderPort::close_() {
     if (write_sem_initialized_ && !uv_is_closing((uv_handle_t*)&write_sem_)) {
         uv_close((uv_handle_t*)&write_sem_, close_cb_);
     }
+
+    if (pacing_timer_initialized_ && !uv_is_closing((uv_handle_t*)&pacing_timer_)) {
+        uv_close((uv_handle_t*)&pacing_timer_, close_cb_);
+    }
 }
 
 } // namespace netio
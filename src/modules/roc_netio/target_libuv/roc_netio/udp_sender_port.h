@@ -14,9 +14,11 @@
 
 #include <uv.h>
 
+#include "roc_core/atomic.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/mutex.h"
 #include "roc_core/refcnt.h"
+#include "roc_core/time.h"
 #include "roc_netio/basic_port.h"
 #include "roc_netio/iclose_handler.h"
 #include "roc_packet/address.h"
@@ -29,8 +31,22 @@ namespace netio {
 class UDPSenderPort : public BasicPort, public packet::IWriter {
 public:
     //! Initialize.
+    //!
+    //! If @p pacing_rate is non-zero, it defines the maximum transmit rate in
+    //! bytes per second. Packets handed to the port in a burst (e.g. a whole
+    //! FEC block flushed at once) are then released by a token bucket spread
+    //! over the block interval instead of leaving back-to-back, so that
+    //! shallow switch and WiFi queues along the path are not overflown.
+    //! Zero disables pacing.
+    //!
+    //! If @p dscp is non-zero, outgoing datagrams are marked with the given
+    //! DSCP value (via IPv4 TOS or IPv6 traffic class), so that
+    //! DiffServ-aware networks can prioritize them, e.g. 46 (EF) for
+    //! low-latency audio. Zero keeps the default class.
     UDPSenderPort(ICloseHandler& close_handler,
                   const packet::Address&,
+                  size_t pacing_rate,
+                  unsigned dscp,
                   uv_loop_t& event_loop,
                   core::IAllocator& allocator);
 
@@ -51,14 +67,83 @@ public:
     //!  May be called from any thread.
     virtual void write(const packet::PacketPtr&);
 
+    //! Get destination reachability counter.
+    //! @remarks
+    //!  Counts consecutive send attempts that failed with a
+    //!  destination-unreachable error. ICMP errors are reported by the
+    //!  kernel on the connected socket, so the counter grows while the
+    //!  destination keeps answering with ICMP unreachable and is reset
+    //!  to zero by the first send that goes through. May be polled from
+    //!  any thread, e.g. by the sender pipeline to back off from a dead
+    //!  destination.
+    const core::Atomic& unreachable() const;
+
+    //! Get discovered path MTU.
+    //! @remarks
+    //!  Holds the kernel's path MTU estimate towards the connected
+    //!  destination, in bytes, or zero while it is unknown. Discovered
+    //!  when the socket is connected and refreshed when the kernel
+    //!  reports that a datagram exceeded the path MTU. May be polled
+    //!  from any thread, e.g. by the sender pipeline to grow packets up
+    //!  to the path capacity. Stays zero on platforms without batched
+    //!  transmit and for ports sending to multiple destinations.
+    const core::Atomic& path_mtu() const;
+
 private:
+    //! Number of datagrams written to the socket with a single syscall
+    //! in batched transmit mode.
+    enum { SendBatch = 32 };
+
+    //! Maximum number of packets waiting in the transmit queue. On a
+    //! throttled uplink the queue would otherwise grow without bound,
+    //! pinning packet buffers and adding seconds of staleness to what is
+    //! eventually transmitted. When the limit is reached, repair packets
+    //! are dropped first (redundancy is more expendable than audio),
+    //! newest first; if there are none, the incoming packet is dropped.
+    enum { MaxQueue = 256 };
+
+    //! Maximum total payload of a single segmented send; the kernel
+    //! limits it to the maximum size of a UDP datagram.
+    enum { GsoMaxPayload = 65535 };
+
+    //! Socket send buffer size: large enough to absorb a whole FEC block
+    //! flushed at once on top of the in-flight stream, so that bursts
+    //! from the pipeline are queued by the kernel instead of rejected.
+    enum { SendBufSize = 1 * 1024 * 1024 };
+
+    //! Token bucket depth, in milliseconds of transmission at the pacing
+    //! rate: how much the sender may burst after an idle period.
+    enum { PacingBurstMs = 5 };
+
+    //! Minimum depth of the token bucket, in bytes; keeps the bucket
+    //! useful at very low pacing rates. A packet larger than the bucket
+    //! is released when the bucket is full.
+    enum { PacingMinBurst = 2048 };
+
     static void close_cb_(uv_handle_t* handle);
     static void write_sem_cb_(uv_async_t* handle);
+    static void pacing_timer_cb_(uv_timer_t* handle);
     static void send_cb_(uv_udp_send_t* req, int status);
 
+    static bool status_unreachable_(int status);
+
     packet::PacketPtr read_();
+    bool pacing_admit_(size_t size);
+    bool make_room_(const packet::Packet& incoming);
+    void process_queue_();
+    void batch_send_();
+    void send_one_(const packet::PacketPtr& pp);
+    void finish_send_();
+    void finish_sends_(size_t n);
     void close_();
 
+    bool setup_dscp_();
+
+    bool connect_(const packet::Address& address);
+    void disconnect_();
+
+    void query_path_mtu_();
+
     ICloseHandler& close_handler_;
 
     uv_loop_t& loop_;
@@ -69,12 +154,65 @@ private:
     uv_udp_t handle_;
     bool handle_initialized_;
 
+    //! Maximum transmit rate in bytes per second, or zero if pacing
+    //! is disabled.
+    const size_t pacing_rate_;
+
+    //! Token bucket depth in bytes.
+    const size_t pacing_burst_;
+
+    //! DSCP value for outgoing datagrams, or zero to keep the default
+    //! traffic class.
+    const unsigned dscp_;
+
+    //! Bytes currently available in the token bucket. Touched only on
+    //! the event loop thread.
+    double pacing_tokens_;
+
+    //! Time of the last token refill.
+    core::nanoseconds_t pacing_refilled_at_;
+
+    //! Fires when enough tokens have accumulated to release the packet
+    //! at the head of the queue.
+    uv_timer_t pacing_timer_;
+    bool pacing_timer_initialized_;
+
+    //! Socket descriptor for batched transmit, or -1 if batched
+    //! transmit is not available.
+    int send_fd_;
+
+    //! True if the kernel supports UDP segmentation offload, so that a
+    //! run of equal-size datagrams to one destination can be passed to
+    //! the kernel as a single payload that is split back into datagrams
+    //! on transmit.
+    bool gso_supported_;
+
+    //! True if the socket is connected to connected_addr_, so that the
+    //! kernel doesn't re-run route lookup for every datagram.
+    bool connected_;
+
+    //! True if the port sends to multiple destinations and thus the
+    //! socket should not be connected.
+    bool connect_disabled_;
+
+    //! Destination address the socket is connected to.
+    packet::Address connected_addr_;
+
     packet::Address address_;
 
     core::List<packet::Packet> list_;
     core::Mutex mutex_;
 
     size_t pending_;
+    size_t dropped_overflow_;
+
+    //! Consecutive sends failed with a destination-unreachable error;
+    //! see unreachable().
+    core::Atomic unreachable_;
+
+    //! Discovered path MTU in bytes, or zero; see path_mtu().
+    core::Atomic path_mtu_;
+
     bool stopped_;
     bool closed_;
 
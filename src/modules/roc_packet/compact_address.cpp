@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/compact_address.h"
+
+namespace roc {
+namespace packet {
+
+size_t CompactAddress::hash() const {
+    // FNV-1a over the fixed-size blob; cheap and spreads nearby addresses
+    // and ports across the buckets
+    uint32_t h = 2166136261u;
+
+    const uint8_t* data = (const uint8_t*)this;
+    for (size_t n = 0; n < sizeof(*this); n++) {
+        h = (h ^ data[n]) * 16777619u;
+    }
+
+    return (size_t)h;
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/compact_address.h
+//! @brief Compact network address.
+
+#ifndef ROC_PACKET_COMPACT_ADDRESS_H_
+#define ROC_PACKET_COMPACT_ADDRESS_H_
+
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace packet {
+
+//! Compact canonical network address.
+//!
+//! POD holding only the IP and port, suitable for storing per-packet and
+//! for use as a lookup key. IPv4 addresses are stored in the IPv4-mapped
+//! IPv6 form (::ffff:a.b.c.d), so that the same endpoint always has the
+//! same byte representation regardless of the socket family it was
+//! received with. All bytes of an invalid address are zero.
+//!
+//! Every byte of the struct is always initialized, hence two addresses
+//! are equal iff their bytes are equal, and comparison and hashing work
+//! on the raw bytes, without inspecting the address family.
+//!
+//! @see Address::compact(), Address::set_compact().
+struct CompactAddress {
+    //! IP address, in network byte order.
+    uint8_t ip[16];
+
+    //! Port, in network byte order.
+    uint8_t port[2];
+
+    //! Padding, always zero; rounds the size up to a multiple of four
+    //! bytes so that comparison and hashing may use whole words.
+    uint8_t pad[2];
+
+    //! Compare addresses.
+    bool operator==(const CompactAddress& other) const {
+        return memcmp(this, &other, sizeof(*this)) == 0;
+    }
+
+    //! Compare addresses.
+    bool operator!=(const CompactAddress& other) const {
+        return !(*this == other);
+    }
+
+    //! Get address hash, e.g. for core::Hashmap bucket selection.
+    size_t hash() const;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_COMPACT_ADDRESS_H_
@@ -7,26 +7,61 @@
  */
 
 #include "roc_packet/concurrent_queue.h"
+#include "roc_core/log.h"
 #include "roc_core/panic.h"
 
 namespace roc {
 namespace packet {
 
-ConcurrentQueue::ConcurrentQueue()
-    : cond_(mutex_) {
+ConcurrentQueue::ConcurrentQueue(size_t max_size, core::nanoseconds_t max_age)
+    : max_size_(max_size)
+    , max_age_(max_age)
+    , cond_(mutex_) {
 }
 
 PacketPtr ConcurrentQueue::read() {
-    core::Mutex::Lock lock(mutex_);
-
     PacketPtr packet;
-    while (!(packet = list_.front())) {
-        cond_.wait();
-    }
 
-    list_.remove(*packet);
+    for (;;) {
+        packet.adopt(queue_.detach_front());
+        if (packet) {
+            size_.value.decr_relaxed();
+            if (is_stale_(*packet)) {
+                if (n_dropped_stale_.value.incr_relaxed() == 1) {
+                    roc_log(LogDebug, "concurrent queue: dropping stale packets");
+                }
+                packet = NULL;
+                continue;
+            }
+            return packet;
+        }
+
+        core::Mutex::Lock lock(mutex_);
+
+        // Tell writers that they should signal the condvar. The order is
+        // important: the flag is set before re-checking the queue, and
+        // writers check the flag after pushing, hence either we see the
+        // packet here or the writer sees the flag and wakes us up.
+        ++n_sleeping_;
+
+        packet.adopt(queue_.detach_front());
+        if (packet) {
+            --n_sleeping_;
+            size_.value.decr_relaxed();
+            if (is_stale_(*packet)) {
+                if (n_dropped_stale_.value.incr_relaxed() == 1) {
+                    roc_log(LogDebug, "concurrent queue: dropping stale packets");
+                }
+                packet = NULL;
+                continue;
+            }
+            return packet;
+        }
+
+        cond_.wait();
 
-    return packet;
+        --n_sleeping_;
+    }
 }
 
 void ConcurrentQueue::write(const PacketPtr& packet) {
@@ -34,10 +69,80 @@ void ConcurrentQueue::write(const PacketPtr& packet) {
         roc_panic("concurrent queue: packet is null");
     }
 
-    core::Mutex::Lock lock(mutex_);
+    // The check and the increment are not atomic together, so concurrent
+    // writers may overshoot the limit by one packet each, which is fine
+    // for an overload guard; what matters is that the queue can't grow
+    // without bound while the reader is stalled.
+    if (max_size_ != 0 && (size_t)size_.value.load_relaxed() >= max_size_) {
+        if (n_dropped_overflow_.incr_relaxed() == 1) {
+            roc_log(LogDebug, "concurrent queue: queue is full, dropping packets");
+        }
+        return;
+    }
+
+    size_.value.incr_relaxed();
+    queue_.push_back(*packet);
+
+    if (n_sleeping_ != 0) {
+        core::Mutex::Lock lock(mutex_);
+        cond_.broadcast();
+    }
+}
+
+size_t ConcurrentQueue::drain(Queue& out) {
+    size_t n_moved = 0;
+    long n_popped = 0;
+    long n_stale = 0;
+
+    for (;;) {
+        PacketPtr packet;
+        packet.adopt(queue_.detach_front());
+        if (!packet) {
+            break;
+        }
+        n_popped++;
+        if (is_stale_(*packet)) {
+            n_stale++;
+            continue;
+        }
+        out.write(packet);
+        n_moved++;
+    }
+
+    if (n_popped != 0) {
+        size_.value.add_relaxed(-n_popped);
+    }
+
+    if (n_stale != 0) {
+        if (n_dropped_stale_.value.add_relaxed(n_stale) == n_stale) {
+            roc_log(LogDebug, "concurrent queue: dropping stale packets");
+        }
+    }
+
+    return n_moved;
+}
+
+size_t ConcurrentQueue::n_dropped_overflow() const {
+    return (size_t)n_dropped_overflow_.load_relaxed();
+}
+
+size_t ConcurrentQueue::n_dropped_stale() const {
+    return (size_t)n_dropped_stale_.value.load_relaxed();
+}
+
+bool ConcurrentQueue::is_stale_(const Packet& packet) const {
+    if (max_age_ == 0) {
+        return false;
+    }
+
+    // Packets that were not received from network, e.g. restored by FEC
+    // decoder, have no receive timestamp and are never considered stale.
+    const core::nanoseconds_t rts = packet.receive_timestamp();
+    if (rts == 0) {
+        return false;
+    }
 
-    list_.push_back(*packet);
-    cond_.broadcast();
+    return core::timestamp() - rts > max_age_;
 }
 
 } // namespace packet
@@ -12,37 +12,92 @@
 #ifndef ROC_PACKET_CONCURRENT_QUEUE_H_
 #define ROC_PACKET_CONCURRENT_QUEUE_H_
 
+#include "roc_core/alignment.h"
+#include "roc_core/atomic.h"
 #include "roc_core/cond.h"
-#include "roc_core/list.h"
+#include "roc_core/mpsc_queue.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet.h"
+#include "roc_packet/queue.h"
 
 namespace roc {
 namespace packet {
 
 //! Concurrent blocking packet queue.
+//!
+//! The underlying queue is lock-free: writers never take a mutex, and
+//! the reader takes it only when the queue is empty and it has to go to
+//! sleep. This way the netio thread and the pipeline thread don't bounce
+//! a mutex cache line on every packet handoff.
 class ConcurrentQueue : public IReader, public IWriter, public core::NonCopyable<> {
 public:
-    ConcurrentQueue();
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p max_size limits the number of queued packets; when the limit is
+    //!    reached, writers drop incoming packets; zero means no limit
+    //!  - @p max_age limits how long a packet may sit in the queue; the reader
+    //!    drops packets whose receive timestamp is older; zero means no limit
+    //!
+    //! If the reader stalls, @p max_size keeps the queue memory bounded, and
+    //! @p max_age lets the reader shed the stale backlog when it resumes,
+    //! instead of feeding it to the pipeline.
+    ConcurrentQueue(size_t max_size = 0, core::nanoseconds_t max_age = 0);
 
     //! Read next packet.
     //! @remarks
     //!  Blocks until the queue becomes non-empty and returns the first
-    //!  packet from the queue.
+    //!  packet from the queue. Should be called from a single thread.
     virtual PacketPtr read();
 
     //! Add packet to the queue.
     //! @remarks
-    //!  Adds packet to the end of the queue.
+    //!  Adds packet to the end of the queue. May be called from any thread.
     virtual void write(const PacketPtr& packet);
 
+    //! Move all pending packets to another queue.
+    //! @remarks
+    //!  Non-blocking: appends every packet that is in the queue at the time
+    //!  of the call to the end of @p out, applying the same age filtering
+    //!  as read(). The whole intake is one pass over the lock-free queue
+    //!  with no mutex acquisitions, and the shared counters are updated
+    //!  once per call instead of once per packet. Should be called from
+    //!  the same single thread as read().
+    //! @returns
+    //!  number of packets moved to @p out.
+    size_t drain(Queue& out);
+
+    //! Get number of packets dropped because the queue was full.
+    size_t n_dropped_overflow() const;
+
+    //! Get number of packets dropped because they got too old in the queue.
+    size_t n_dropped_stale() const;
+
 private:
+    bool is_stale_(const Packet& packet) const;
+
+    const size_t max_size_;
+    const core::nanoseconds_t max_age_;
+
+    // the sleep machinery is touched only on empty-queue transitions
     core::Mutex mutex_;
     core::Cond cond_;
-    core::List<Packet> list_;
+    core::Atomic n_sleeping_;
+
+    // the queue itself keeps its producer and consumer state on
+    // separate cache lines
+    core::MpscQueue<Packet> queue_;
+
+    // size_ is shared by design (incremented on push, decremented on
+    // pop); the drop counters are each written by one side only and
+    // padded apart so the hot counters don't share a line
+    core::CacheAligned<core::Atomic> size_;
+    core::Atomic n_dropped_overflow_;
+    core::CacheAligned<core::Atomic> n_dropped_stale_;
 };
 
 } // namespace packet
@@ -80,6 +80,10 @@ PacketPtr DelayedReader::read_queued_packet_() {
     return pp;
 }
 
+// Timespan of the queue, in samples. Computed in O(1) from the first and
+// last queued packets, so delay checks don't depend on queue depth. The
+// timestamp span is used instead of summing per-packet durations because
+// it also accounts for gaps left by lost packets.
 timestamp_t DelayedReader::queue_size_() const {
     if (queue_.size() == 0) {
         return 0;
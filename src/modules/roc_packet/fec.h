@@ -28,7 +28,13 @@ enum FECScheme {
     FEC_ReedSolomon_M8,
 
     //! LDPC-Staircase.
-    FEC_LDPC_Staircase
+    FEC_LDPC_Staircase,
+
+    //! Single-parity XOR.
+    FEC_XOR,
+
+    //! Sliding-window random linear code.
+    FEC_RLC
 };
 
 //! FECFRAME packet.
@@ -19,6 +19,15 @@ namespace roc {
 namespace packet {
 
 //! Packet composer interface.
+//!
+//! Composition is single-copy. prepare() lays out all headers and the payload
+//! as sub-slices of one contiguous buffer, with header space reserved up
+//! front, so the payload encoder writes payload bytes directly into their
+//! final position. compose() then formats the headers in place and never
+//! moves or copies the payload; by send time the packet data is already one
+//! contiguous datagram. Nested composers (e.g. an RTP composer inside a
+//! FECFRAME composer) preserve this: each level carves its header slice out
+//! of the buffer and hands the remainder to the inner composer.
 class IComposer {
 public:
     virtual ~IComposer();
@@ -60,7 +69,8 @@ public:
     //! Compose packet to buffer.
     //! @remarks
     //!  Formats @p packet headers and payloads to the buffer attached to it during
-    //!  a previous prepare() call.
+    //!  a previous prepare() call. Only the header slices are written; the
+    //!  payload stays where the encoder produced it.
     //! @returns
     //!  true if the packet was successfully composed or false if an error occured.
     virtual bool compose(Packet& packet) = 0;
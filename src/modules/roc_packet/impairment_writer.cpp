@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/impairment_writer.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace packet {
+
+ImpairmentWriter::ImpairmentWriter(IWriter& output,
+                                   PacketPool& packet_pool,
+                                   const ImpairmentConfig& config)
+    : output_(output)
+    , packet_pool_(packet_pool)
+    , config_(config)
+    , rand_state_(config.seed != 0 ? config.seed : 1)
+    , in_burst_(false)
+    , held_countdown_(0)
+    , n_total_(0)
+    , n_dropped_(0)
+    , n_duplicated_(0)
+    , n_reordered_(0) {
+    if (config.reorder_rate > 0 && config.reorder_window == 0) {
+        roc_panic("impairment writer: reorder window is zero");
+    }
+}
+
+void ImpairmentWriter::write(const PacketPtr& packet) {
+    n_total_++;
+
+    if (drop_()) {
+        n_dropped_++;
+        return;
+    }
+
+    if (config_.duplicate_rate > 0 && next_float_() < config_.duplicate_rate) {
+        if (PacketPtr copy = clone_(packet)) {
+            n_duplicated_++;
+            forward_(packet);
+            forward_(copy);
+            return;
+        }
+    }
+
+    if (!held_packet_ && config_.reorder_rate > 0
+        && next_float_() < config_.reorder_rate) {
+        n_reordered_++;
+        held_packet_ = packet;
+        held_countdown_ = config_.reorder_window;
+        return;
+    }
+
+    forward_(packet);
+}
+
+void ImpairmentWriter::flush() {
+    if (held_packet_) {
+        PacketPtr packet = held_packet_;
+        held_packet_ = NULL;
+        output_.write(packet);
+    }
+}
+
+size_t ImpairmentWriter::n_total() const {
+    return n_total_;
+}
+
+size_t ImpairmentWriter::n_dropped() const {
+    return n_dropped_;
+}
+
+size_t ImpairmentWriter::n_duplicated() const {
+    return n_duplicated_;
+}
+
+size_t ImpairmentWriter::n_reordered() const {
+    return n_reordered_;
+}
+
+// xorshift32; self-contained so that the impairment pattern depends only
+// on the seed, not on other users of the global generator
+float ImpairmentWriter::next_float_() {
+    uint32_t x = rand_state_;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rand_state_ = x;
+
+    return (float)(x >> 8) / (float)(1 << 24);
+}
+
+bool ImpairmentWriter::drop_() {
+    // two-state Gilbert-Elliott chain: the good state loses packets with
+    // loss_rate, the burst state with burst_loss_rate
+    if (in_burst_) {
+        if (config_.burst_exit_rate > 0 && next_float_() < config_.burst_exit_rate) {
+            in_burst_ = false;
+        }
+    } else {
+        if (config_.burst_enter_rate > 0 && next_float_() < config_.burst_enter_rate) {
+            in_burst_ = true;
+        }
+    }
+
+    if (in_burst_) {
+        return config_.burst_loss_rate > 0 && next_float_() < config_.burst_loss_rate;
+    }
+
+    return config_.loss_rate > 0 && next_float_() < config_.loss_rate;
+}
+
+// A packet can't be written to an intrusive queue twice, so a duplicate
+// is a fresh packet sharing the payload of the original.
+PacketPtr ImpairmentWriter::clone_(const PacketPtr& packet) {
+    PacketPtr copy = new (packet_pool_) Packet(packet_pool_);
+    if (!copy) {
+        return NULL;
+    }
+
+    copy->add_flags(packet->flags());
+
+    if (packet->rtp()) {
+        *copy->rtp() = *packet->rtp();
+    }
+    if (packet->fec()) {
+        *copy->fec() = *packet->fec();
+    }
+    if (packet->udp()) {
+        copy->udp()->src_addr = packet->udp()->src_addr;
+        copy->udp()->dst_addr = packet->udp()->dst_addr;
+    }
+
+    copy->set_receive_timestamp(packet->receive_timestamp());
+    copy->set_data(packet->data());
+
+    return copy;
+}
+
+void ImpairmentWriter::forward_(const PacketPtr& packet) {
+    output_.write(packet);
+
+    if (held_packet_) {
+        if (--held_countdown_ == 0) {
+            PacketPtr held = held_packet_;
+            held_packet_ = NULL;
+            output_.write(held);
+        }
+    }
+}
+
+} // namespace packet
+} // namespace roc
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/impairment_writer.h
+//! @brief Network-condition emulation writer.
+
+#ifndef ROC_PACKET_IMPAIRMENT_WRITER_H_
+#define ROC_PACKET_IMPAIRMENT_WRITER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace packet {
+
+//! Network impairment parameters.
+//! @remarks
+//!  All rates are probabilities in [0; 1]. Zero disables an impairment.
+struct ImpairmentConfig {
+    //! Seed of the internal pseudo-random generator.
+    //! @remarks
+    //!  The same seed always produces the same impairment pattern, so
+    //!  results are reproducible across runs.
+    uint32_t seed;
+
+    //! Independent random loss probability, applied to every packet.
+    float loss_rate;
+
+    //! Gilbert-Elliott model: probability to enter the burst state,
+    //! checked on every packet in the good state.
+    float burst_enter_rate;
+
+    //! Gilbert-Elliott model: probability to leave the burst state,
+    //! checked on every packet in the burst state.
+    float burst_exit_rate;
+
+    //! Gilbert-Elliott model: loss probability in the burst state.
+    float burst_loss_rate;
+
+    //! Probability to hold a packet back and deliver it late.
+    float reorder_rate;
+
+    //! How many subsequent packets are delivered before a held packet,
+    //! i.e. how far the packet is displaced from its original position.
+    size_t reorder_window;
+
+    //! Probability to deliver a packet twice.
+    float duplicate_rate;
+
+    ImpairmentConfig()
+        : seed(1)
+        , loss_rate(0)
+        , burst_enter_rate(0)
+        , burst_exit_rate(0)
+        , burst_loss_rate(0)
+        , reorder_rate(0)
+        , reorder_window(5)
+        , duplicate_rate(0) {
+    }
+};
+
+//! Network-condition emulation writer.
+//!
+//! Decorates an output writer and injects configurable impairments into
+//! the packet stream: independent random loss, Gilbert-Elliott loss
+//! bursts, bounded reordering, and duplication. The pseudo-random
+//! generator is owned by the writer and deterministically seeded, so a
+//! given configuration reproduces the same impairment pattern on every
+//! run.
+//!
+//! Intended for tests and benchmarks, e.g. measuring FEC and interleaver
+//! recovery rate and CPU cost against realistic loss patterns entirely
+//! in-process.
+class ImpairmentWriter : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Packets passed to write() are forwarded to @p output, after
+    //!  applying the impairments defined by @p config. @p packet_pool
+    //!  is used to clone duplicated packets, since a packet can't be
+    //!  enqueued twice.
+    ImpairmentWriter(IWriter& output,
+                     PacketPool& packet_pool,
+                     const ImpairmentConfig& config);
+
+    //! Write next packet.
+    virtual void write(const PacketPtr& packet);
+
+    //! Deliver the held packet, if any.
+    //! @remarks
+    //!  Should be called after the last write(), so that a packet held
+    //!  for reordering at the end of the stream is not lost.
+    void flush();
+
+    //! Get number of packets passed to write().
+    size_t n_total() const;
+
+    //! Get number of dropped packets.
+    size_t n_dropped() const;
+
+    //! Get number of duplicated packets.
+    size_t n_duplicated() const;
+
+    //! Get number of reordered packets.
+    size_t n_reordered() const;
+
+private:
+    float next_float_();
+
+    bool drop_();
+    void forward_(const PacketPtr& packet);
+    PacketPtr clone_(const PacketPtr& packet);
+
+    IWriter& output_;
+    PacketPool& packet_pool_;
+    const ImpairmentConfig config_;
+
+    uint32_t rand_state_;
+    bool in_burst_;
+
+    PacketPtr held_packet_;
+    size_t held_countdown_;
+
+    size_t n_total_;
+    size_t n_dropped_;
+    size_t n_duplicated_;
+    size_t n_reordered_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_IMPAIRMENT_WRITER_H_
@@ -13,9 +13,20 @@
 namespace roc {
 namespace packet {
 
+namespace {
+
+// How many consecutive clean feedback periods it takes to halve the depth.
+const size_t CleanPeriodsPerShrink = 8;
+
+} // namespace
+
 Interleaver::Interleaver(IWriter& writer, core::IAllocator& allocator, size_t block_sz)
     : writer_(writer)
     , block_size_(block_sz)
+    , depth_(block_sz)
+    , pending_depth_(block_sz)
+    , clean_periods_(0)
+    , held_(0)
     , send_seq_(allocator)
     , packets_(allocator)
     , next_2_put_(0)
@@ -49,20 +60,33 @@ bool Interleaver::valid() const {
 void Interleaver::write(const PacketPtr& p) {
     roc_panic_if_not(valid());
 
+    // Depth changes are applied only when the delay line is empty, so
+    // that no held packet changes its position in the output sequence.
+    if (pending_depth_ != depth_ && held_ == 0) {
+        roc_log(LogDebug, "interleaver: changing depth: old=%u new=%u", (unsigned)depth_,
+                (unsigned)pending_depth_);
+
+        depth_ = pending_depth_;
+        next_2_put_ = next_2_send_ = 0;
+        reinit_seq_();
+    }
+
     packets_[next_2_put_] = p;
-    next_2_put_ = (next_2_put_ + 1) % block_size_;
+    next_2_put_ = (next_2_put_ + 1) % depth_;
+    held_++;
 
     while (packets_[send_seq_[next_2_send_]]) {
         writer_.write(packets_[send_seq_[next_2_send_]]);
         packets_[send_seq_[next_2_send_]] = NULL;
-        next_2_send_ = (next_2_send_ + 1) % block_size_;
+        next_2_send_ = (next_2_send_ + 1) % depth_;
+        held_--;
     }
 }
 
 void Interleaver::flush() {
     roc_panic_if_not(valid());
 
-    for (size_t i = 0; i < block_size_; ++i) {
+    for (size_t i = 0; i < depth_; ++i) {
         if (packets_[i]) {
             writer_.write(packets_[i]);
             packets_[i] = NULL;
@@ -70,17 +94,47 @@ void Interleaver::flush() {
     }
 
     next_2_put_ = next_2_send_ = 0;
+    held_ = 0;
+}
+
+void Interleaver::update_link_stats(size_t max_burst) {
+    roc_panic_if_not(valid());
+
+    if (max_burst > 0) {
+        // Deepen quickly: at least double, and at least enough to spread
+        // the observed burst across different positions.
+        size_t target = depth_ * 2;
+        if (target < max_burst * 2) {
+            target = max_burst * 2;
+        }
+        if (target > block_size_) {
+            target = block_size_;
+        }
+        pending_depth_ = target;
+        clean_periods_ = 0;
+    } else if (++clean_periods_ >= CleanPeriodsPerShrink) {
+        // Shrink slowly: halve the depth after a series of clean periods,
+        // eventually reaching pass-through.
+        if (pending_depth_ > 1) {
+            pending_depth_ /= 2;
+        }
+        clean_periods_ = 0;
+    }
 }
 
 size_t Interleaver::block_size() const {
     return block_size_;
 }
 
+size_t Interleaver::depth() const {
+    return depth_;
+}
+
 void Interleaver::reinit_seq_() {
-    for (size_t i = 0; i < block_size_; ++i) {
+    for (size_t i = 0; i < depth_; ++i) {
         send_seq_[i] = i;
     }
-    for (size_t i = block_size_; i > 0; --i) {
+    for (size_t i = depth_; i > 0; --i) {
         const size_t j = core::random(0, (unsigned int)i - 1);
         const size_t buff = send_seq_[i - 1];
         send_seq_[i - 1] = send_seq_[j];
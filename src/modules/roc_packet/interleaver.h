@@ -22,6 +22,12 @@ namespace roc {
 namespace packet {
 
 //! Interleaves packets to transmit them in pseudo random order.
+//!
+//! Interleaving depth adapts to the observed link quality. The depth
+//! starts at the configured block size and shrinks towards pass-through
+//! while update_link_stats() keeps reporting clean periods, reclaiming
+//! both latency and the held-packet memory. A reported loss burst
+//! re-deepens it quickly.
 class Interleaver : public IWriter, public core::NonCopyable<> {
 public:
     //! Initialize.
@@ -42,10 +48,25 @@ public:
     //! Send all buffered packets to output writer.
     void flush();
 
+    //! Update observed link loss statistics.
+    //! @remarks
+    //!  Called with feedback from the receiver. @p max_burst is the longest
+    //!  run of consecutively lost packets observed during the feedback
+    //!  period, or zero if the period was clean. A burst doubles the
+    //!  interleaving depth (at least enough to break the burst up), while
+    //!  a series of clean periods gradually halves it down to pass-through.
+    //!  Depth changes are applied when the delay line drains empty.
+    void update_link_stats(size_t max_burst);
+
     //! Maximum delay between writing packet and moment we get it in output
     //! in terms of packets number.
     size_t block_size() const;
 
+    //! Current interleaving depth.
+    //! @remarks
+    //!  Varies between one (pass-through) and block_size().
+    size_t depth() const;
+
 private:
     //! Initialize tx_seq_ to a new randomized sequence.
     void reinit_seq_();
@@ -53,9 +74,19 @@ private:
     // Output writer.
     IWriter& writer_;
 
-    // Number of packets in block.
+    // Maximum number of packets in block.
     size_t block_size_;
 
+    // Current and requested interleaving depth.
+    size_t depth_;
+    size_t pending_depth_;
+
+    // Number of consecutive clean feedback periods.
+    size_t clean_periods_;
+
+    // Number of packets currently held in the delay line.
+    size_t held_;
+
     // Output sequence.
     core::Array<size_t> send_seq_;
 
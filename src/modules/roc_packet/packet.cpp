@@ -14,7 +14,8 @@ namespace packet {
 
 Packet::Packet(PacketPool& pool)
     : pool_(pool)
-    , flags_(0) {
+    , flags_(0)
+    , receive_timestamp_(0) {
 }
 
 void Packet::add_flags(unsigned fl) {
@@ -70,6 +71,10 @@ FEC* Packet::fec() {
     return NULL;
 }
 
+bool Packet::has_data() const {
+    return data_;
+}
+
 const core::Slice<uint8_t>& Packet::data() const {
     if (!data_) {
         roc_panic("packet: data is null");
@@ -84,6 +89,25 @@ void Packet::set_data(const core::Slice<uint8_t>& d) {
     data_ = d;
 }
 
+void Packet::replace_data(const core::Slice<uint8_t>& d) {
+    if (!data_) {
+        roc_panic("packet: can't replace data before it's set");
+    }
+    if (d.size() != data_.size()) {
+        roc_panic("packet: can't replace data with different size: old=%lu new=%lu",
+                  (unsigned long)data_.size(), (unsigned long)d.size());
+    }
+    data_ = d;
+}
+
+core::nanoseconds_t Packet::receive_timestamp() const {
+    return receive_timestamp_;
+}
+
+void Packet::set_receive_timestamp(core::nanoseconds_t timestamp) {
+    receive_timestamp_ = timestamp;
+}
+
 source_t Packet::source() const {
     if (const RTP* r = rtp()) {
         return r->source;
@@ -128,5 +152,40 @@ void Packet::destroy() {
     pool_.destroy(*this);
 }
 
+void Packet::destroy_batch(Packet* const* packets, size_t n_packets) {
+    enum { ChunkSize = 32 };
+
+    void* memory[ChunkSize];
+    size_t n_chunk = 0;
+
+    core::Pool<Packet>* pool = NULL;
+
+    for (size_t n = 0; n < n_packets; n++) {
+        Packet* packet = packets[n];
+
+        // packets of one queue normally share a pool, but flush the
+        // chunk if they don't, since a batch can't span pools
+        if (pool != &packet->pool_ && n_chunk != 0) {
+            pool->deallocate_batch(memory, n_chunk);
+            n_chunk = 0;
+        }
+        pool = &packet->pool_;
+
+        packet->dropref();
+        packet->~Packet();
+
+        memory[n_chunk++] = packet;
+
+        if (n_chunk == ChunkSize) {
+            pool->deallocate_batch(memory, n_chunk);
+            n_chunk = 0;
+        }
+    }
+
+    if (n_chunk != 0) {
+        pool->deallocate_batch(memory, n_chunk);
+    }
+}
+
 } // namespace packet
 } // namespace roc
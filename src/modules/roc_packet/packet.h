@@ -14,9 +14,11 @@
 
 #include "roc_core/helpers.h"
 #include "roc_core/list_node.h"
+#include "roc_core/mpsc_queue_node.h"
 #include "roc_core/pool.h"
 #include "roc_core/refcnt.h"
 #include "roc_core/shared_ptr.h"
+#include "roc_core/time.h"
 #include "roc_packet/fec.h"
 #include "roc_packet/print.h"
 #include "roc_packet/rtp.h"
@@ -32,7 +34,9 @@ class Packet;
 typedef core::SharedPtr<Packet> PacketPtr;
 
 //! Packet.
-class Packet : public core::RefCnt<Packet>, public core::ListNode {
+class Packet : public core::RefCnt<Packet>,
+               public core::ListNode,
+               public core::MpscQueueNode {
 public:
     //! Constructor.
     explicit Packet(PacketPool&);
@@ -72,12 +76,33 @@ public:
     //! FEC packet.
     FEC* fec();
 
+    //! Check if packet data is set.
+    bool has_data() const;
+
     //! Get packet data.
     const core::Slice<uint8_t>& data() const;
 
     //! Set packet data.
     void set_data(const core::Slice<uint8_t>& data);
 
+    //! Replace packet data with an equal-sized slice.
+    //! @remarks
+    //!  Re-points the packet at another buffer holding the same bytes,
+    //!  e.g. a smaller one after payload compaction. The caller is
+    //!  responsible for remapping the sub-slices stored in the RTP and
+    //!  FEC parts to the new buffer.
+    void replace_data(const core::Slice<uint8_t>& data);
+
+    //! Get receive timestamp.
+    //! @remarks
+    //!  Time when the packet was received from network, in the
+    //!  core::timestamp() clock domain. Zero for packets that were not
+    //!  received from network, e.g. restored by FEC decoder.
+    core::nanoseconds_t receive_timestamp() const;
+
+    //! Set receive timestamp.
+    void set_receive_timestamp(core::nanoseconds_t timestamp);
+
     //! Return packet stream identifier.
     //! @remarks
     //!  The returning value depends on packet type. For some packet types, may
@@ -108,6 +133,17 @@ public:
         packet::print(*this, flags);
     }
 
+    //! Destroy a batch of packets, returning their memory to the pool in
+    //! one operation per pool.
+    //! @pre
+    //!  Each packet should be exclusively owned by the caller, i.e. have
+    //!  a reference counter of one, e.g. after core::List::detach_front()
+    //!  on a list holding the only reference.
+    //! @remarks
+    //!  Used by packet queues to release their contents on teardown
+    //!  without paying one pool operation per packet.
+    static void destroy_batch(Packet* const* packets, size_t n_packets);
+
     //! Get pointer to packet from a pointer to its UDP part.
     static Packet* container_of(UDP* udp) {
         return ROC_CONTAINER_OF(udp, Packet, udp_);
@@ -118,15 +154,22 @@ private:
 
     void destroy();
 
+    // Hot fields first: queue traversals and sorted insertions touch only
+    // flags, RTP ordering fields, and the payload slice, so they are packed
+    // together at the head of the object to span as few cache lines as
+    // possible. The UDP part is the coldest and by far the largest (it
+    // embeds two addresses and the sender request state), so it trails.
     PacketPool& pool_;
 
     unsigned flags_;
 
-    UDP udp_;
-    RTP rtp_;
-    FEC fec_;
+    core::nanoseconds_t receive_timestamp_;
 
     core::Slice<uint8_t> data_;
+
+    RTP rtp_;
+    FEC fec_;
+    UDP udp_;
 };
 
 } // namespace packet
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_packet/payload_compactor.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace packet {
+
+PayloadCompactor::PayloadCompactor(IWriter& output,
+                                   core::BufferPool<uint8_t>& compact_pool,
+                                   PacketPool* packet_pool)
+    : output_(output)
+    , compact_pool_(compact_pool)
+    , packet_pool_(packet_pool) {
+}
+
+void PayloadCompactor::write(const PacketPtr& packet) {
+    const core::Slice<uint8_t> old_data = packet->data();
+
+    core::Slice<uint8_t> new_data;
+
+    if (old_data.size() <= compact_pool_.buffer_size()) {
+        new_data = new (compact_pool_) core::Buffer<uint8_t>(compact_pool_);
+        // allocation failures shouldn't lose packets; better keep the
+        // large buffer pinned than drop audio
+        if (new_data) {
+            new_data.resize(old_data.size());
+            memcpy(new_data.data(), old_data.data(), old_data.size());
+        }
+    }
+
+    PacketPtr pp = packet;
+
+    if (packet_pool_) {
+        // migrate the packet object to the dedicated pool; on allocation
+        // failure keep the original object and compact in-place as usual
+        if (PacketPtr np = rehome_(*packet)) {
+            pp = np;
+        }
+    }
+
+    if (new_data) {
+        // the parsed sub-slices point into the old buffer; remap them
+        if (RTP* rtp = pp->rtp()) {
+            rtp->header = remap_(rtp->header, old_data, new_data);
+            rtp->csrc = remap_(rtp->csrc, old_data, new_data);
+            rtp->extension = remap_(rtp->extension, old_data, new_data);
+            rtp->payload = remap_(rtp->payload, old_data, new_data);
+            rtp->padding = remap_(rtp->padding, old_data, new_data);
+        }
+
+        if (FEC* fec = pp->fec()) {
+            fec->payload_id = remap_(fec->payload_id, old_data, new_data);
+            fec->payload = remap_(fec->payload, old_data, new_data);
+        }
+
+        pp->replace_data(new_data);
+    }
+
+    output_.write(pp);
+}
+
+PacketPtr PayloadCompactor::rehome_(const Packet& packet) {
+    PacketPtr pp = new (*packet_pool_) Packet(*packet_pool_);
+    if (!pp) {
+        return NULL;
+    }
+
+    pp->add_flags(packet.flags());
+
+    if (const UDP* udp = packet.udp()) {
+        *pp->udp() = *udp;
+    }
+    if (const RTP* rtp = packet.rtp()) {
+        *pp->rtp() = *rtp;
+    }
+    if (const FEC* fec = packet.fec()) {
+        *pp->fec() = *fec;
+    }
+
+    pp->set_data(packet.data());
+    pp->set_receive_timestamp(packet.receive_timestamp());
+
+    return pp;
+}
+
+core::Slice<uint8_t> PayloadCompactor::remap_(const core::Slice<uint8_t>& sub,
+                                              const core::Slice<uint8_t>& old_data,
+                                              const core::Slice<uint8_t>& new_data) {
+    if (!sub) {
+        return sub;
+    }
+
+    const size_t off = size_t(sub.data() - old_data.data());
+
+    return new_data.range(off, off + sub.size());
+}
+
+} // namespace packet
+} // namespace roc
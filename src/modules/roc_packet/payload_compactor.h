@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_packet/payload_compactor.h
+//! @brief Payload compactor.
+
+#ifndef ROC_PACKET_PAYLOAD_COMPACTOR_H_
+#define ROC_PACKET_PAYLOAD_COMPACTOR_H_
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+
+namespace roc {
+namespace packet {
+
+//! Payload compactor.
+//!
+//! Received packets pin a full-size receive buffer (max packet size) even
+//! when the actual payload is a couple hundred bytes. With deep jitter
+//! buffers holding hundreds of packets per session, this inflates memory
+//! usage several-fold. The compactor copies the packet bytes into a
+//! tightly sized buffer from a dedicated pool and releases the original
+//! receive buffer, trading one small copy per packet for the queue-memory
+//! reduction. Packets that don't fit the compact buffer size are passed
+//! through unchanged.
+//!
+//! Optionally, the packet object itself is migrated to a dedicated packet
+//! pool too. Packets of all flows interleave in the global pool, so the
+//! queued packets of one flow scatter across its chunks; with a private
+//! pool per flow they stay contiguous, and queue traversals walk nearby
+//! addresses instead of hopping the whole pool.
+class PayloadCompactor : public IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //! @remarks
+    //!  Packets passed to write() are re-pointed at buffers from
+    //!  @p compact_pool, whose buffer size defines the largest packet
+    //!  that is compacted, and then forwarded to @p output. If
+    //!  @p packet_pool is non-NULL, the packet object is replaced with a
+    //!  copy drawn from it and the original packet is released.
+    PayloadCompactor(IWriter& output,
+                     core::BufferPool<uint8_t>& compact_pool,
+                     PacketPool* packet_pool = NULL);
+
+    //! Compact packet data and write packet to output writer.
+    virtual void write(const PacketPtr& packet);
+
+private:
+    PacketPtr rehome_(const Packet& packet);
+
+    static core::Slice<uint8_t> remap_(const core::Slice<uint8_t>& sub,
+                                       const core::Slice<uint8_t>& old_data,
+                                       const core::Slice<uint8_t>& new_data);
+
+    IWriter& output_;
+    core::BufferPool<uint8_t>& compact_pool_;
+    PacketPool* packet_pool_;
+};
+
+} // namespace packet
+} // namespace roc
+
+#endif // ROC_PACKET_PAYLOAD_COMPACTOR_H_
@@ -11,12 +11,47 @@
 namespace roc {
 namespace packet {
 
+Queue::Queue()
+    : metrics_depth_(
+        core::MetricsRegistry::instance().find_or_add_counter("packet_queue_depth")) {
+}
+
+Queue::~Queue() {
+    if (metrics_depth_ && list_.size() != 0) {
+        metrics_depth_->add_relaxed(-(long)list_.size());
+    }
+
+    // batched teardown: hand exclusively owned packets back to the pool
+    // a batch at a time instead of one by one (see Packet::destroy_batch)
+    enum { ReleaseBatch = 32 };
+
+    Packet* batch[ReleaseBatch];
+    size_t n_batch = 0;
+
+    while (Packet* packet = list_.detach_front()) {
+        if (packet->getref() != 1) {
+            packet->decref();
+            continue;
+        }
+
+        batch[n_batch++] = packet;
+        if (n_batch == ReleaseBatch) {
+            Packet::destroy_batch(batch, n_batch);
+            n_batch = 0;
+        }
+    }
+
+    if (n_batch != 0) {
+        Packet::destroy_batch(batch, n_batch);
+    }
+}
+
 PacketPtr Queue::read() {
-    PacketPtr packet = list_.front();
-    if (!packet) {
-        return NULL;
+    PacketPtr packet;
+    packet.adopt(list_.detach_front());
+    if (packet && metrics_depth_) {
+        metrics_depth_->decr_relaxed();
     }
-    list_.remove(*packet);
     return packet;
 }
 
@@ -25,6 +60,29 @@ void Queue::write(const PacketPtr& packet) {
         roc_panic("queue: null packet");
     }
     list_.push_back(*packet);
+    if (metrics_depth_) {
+        metrics_depth_->incr_relaxed();
+    }
+}
+
+size_t Queue::drain(Queue& out) {
+    size_t n_moved = 0;
+
+    for (;;) {
+        PacketPtr packet;
+        packet.adopt(list_.detach_front());
+        if (!packet) {
+            break;
+        }
+        out.write(packet);
+        n_moved++;
+    }
+
+    if (metrics_depth_ && n_moved != 0) {
+        metrics_depth_->add_relaxed(-(long)n_moved);
+    }
+
+    return n_moved;
 }
 
 size_t Queue::size() const {
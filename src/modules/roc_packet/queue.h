@@ -13,6 +13,7 @@
 #define ROC_PACKET_QUEUE_H_
 
 #include "roc_core/list.h"
+#include "roc_core/metrics_registry.h"
 #include "roc_core/noncopyable.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
@@ -24,6 +25,10 @@ namespace packet {
 //! Packet queue.
 class Queue : public IReader, public IWriter, public core::NonCopyable<> {
 public:
+    Queue();
+
+    ~Queue();
+
     //! Read next packet.
     //! @returns
     //!  the first packet in the queue or null if there are no packets.
@@ -34,11 +39,22 @@ public:
     //!  Adds packet to the end of the queue.
     virtual void write(const PacketPtr& packet);
 
+    //! Move all packets to another queue.
+    //! @remarks
+    //!  Appends every queued packet to the end of @p out, leaving this
+    //!  queue empty.
+    //! @returns
+    //!  number of packets moved.
+    size_t drain(Queue& out);
+
     //! Get number of packets in queue.
     size_t size() const;
 
 private:
     core::List<Packet> list_;
+
+    //! Exported depth counter, shared by all packet queues.
+    core::Atomic* metrics_depth_;
 };
 
 } // namespace packet
@@ -15,10 +15,14 @@ namespace packet {
 
 Router::Router(core::IAllocator& allocator, size_t max_routes)
     : routes_(allocator)
+    , route_map_(allocator)
     , valid_(false) {
     if (!routes_.grow(max_routes)) {
         return;
     }
+    if (!route_map_.grow(max_routes * 2)) {
+        return;
+    }
     valid_ = true;
 }
 
@@ -26,7 +30,7 @@ bool Router::valid() const {
     return valid_;
 }
 
-bool Router::add_route(IWriter& writer, unsigned flags) {
+bool Router::add_route(IWriter& writer, unsigned flags, bool dedup) {
     roc_panic_if_not(valid());
 
     if (routes_.size() == routes_.max_size()) {
@@ -40,11 +44,28 @@ bool Router::add_route(IWriter& writer, unsigned flags) {
     r.flags = flags;
     r.source = 0;
     r.has_source = false;
+    r.dedup = dedup;
+    r.has_dedup_pos = false;
+    r.dedup_pos = 0;
+    r.dedup_mask = 0;
+    r.dedup_dropped = 0;
 
     routes_.push_back(r);
     return true;
 }
 
+bool Router::has_source(source_t source) const {
+    roc_panic_if_not(valid());
+
+    for (size_t n = 0; n < routes_.size(); n++) {
+        if (routes_[n].has_source && routes_[n].source == source) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void Router::write(const PacketPtr& packet) {
     roc_panic_if_not(valid());
 
@@ -52,10 +73,30 @@ void Router::write(const PacketPtr& packet) {
         roc_panic("router: unexpected null packet");
     }
 
+    const unsigned pkt_flags = packet->flags();
+    const source_t pkt_source = packet->source();
+
+    // fast path: routes that already detected their stream are indexed
+    // by the stream source
+    for (Route* r = route_map_.find(pkt_source); r;
+         r = route_map_.find_next(*r, pkt_source)) {
+        if (r->flags != 0) {
+            if ((r->flags & pkt_flags) != r->flags) {
+                continue;
+            }
+        }
+
+        deliver_(*r, packet);
+        return;
+    }
+
+    // slow path: scan routes that didn't detect their stream yet
     for (size_t n = 0; n < routes_.size(); n++) {
         Route& r = routes_[n];
 
-        const unsigned pkt_flags = packet->flags();
+        if (r.has_source) {
+            continue;
+        }
 
         if (r.flags != 0) {
             if ((r.flags & pkt_flags) != r.flags) {
@@ -63,26 +104,90 @@ void Router::write(const PacketPtr& packet) {
             }
         }
 
-        const source_t pkt_source = packet->source();
+        r.source = pkt_source;
+        r.has_source = true;
 
-        if (r.has_source) {
-            if (r.source != pkt_source) {
-                continue;
-            }
-        } else {
-            r.source = pkt_source;
-            r.has_source = true;
+        route_map_.insert(r);
 
-            roc_log(LogDebug, "router: detected new stream: source=%lu flags=0x%xu",
-                    (unsigned long)r.source, (unsigned int)r.flags);
-        }
+        roc_log(LogDebug, "router: detected new stream: source=%lu flags=0x%xu",
+                (unsigned long)r.source, (unsigned int)r.flags);
 
-        r.writer->write(packet);
+        deliver_(r, packet);
         return;
     }
 
     roc_log(LogDebug, "router: can't route packet, dropping");
 }
 
+void Router::deliver_(Route& route, const PacketPtr& packet) {
+    if (route.dedup && is_duplicate_(route, *packet)) {
+        route.dedup_dropped++;
+        roc_log(LogTrace, "router: dropping duplicate packet: dropped=%lu",
+                (unsigned long)route.dedup_dropped);
+        return;
+    }
+
+    route.writer->write(packet);
+}
+
+bool Router::is_duplicate_(Route& route, const Packet& packet) {
+    // The stream position is the RTP seqnum for source packets, and block
+    // number plus symbol id for FEC-only repair packets; both advance
+    // monotonically inside a route, so a 64-entry sliding window is enough
+    // to absorb any realistic cross-path reordering.
+    uint32_t pos = 0;
+    long dist = 0;
+
+    if (const RTP* rtp = packet.rtp()) {
+        pos = rtp->seqnum;
+        if (route.has_dedup_pos) {
+            dist = seqnum_diff((seqnum_t)pos, (seqnum_t)route.dedup_pos);
+        }
+    } else if (const FEC* fec = packet.fec()) {
+        pos = ((uint32_t)fec->source_block_number << 16)
+            | ((uint32_t)fec->encoding_symbol_id & 0xffff);
+        if (route.has_dedup_pos) {
+            dist = (int32_t)(pos - route.dedup_pos);
+        }
+    } else {
+        // no way to identify the packet position, pass it through
+        return false;
+    }
+
+    if (!route.has_dedup_pos) {
+        route.has_dedup_pos = true;
+        route.dedup_pos = pos;
+        route.dedup_mask = 1;
+        return false;
+    }
+
+    if (dist > 0) {
+        // packet is ahead of the window, slide it forward
+        if (dist >= 64) {
+            route.dedup_mask = 0;
+        } else {
+            route.dedup_mask <<= dist;
+        }
+        route.dedup_mask |= 1;
+        route.dedup_pos = pos;
+        return false;
+    }
+
+    if (dist <= -64) {
+        // too old to tell; pass it through, the sorted queues downstream
+        // drop exact duplicates that are still queued
+        return false;
+    }
+
+    const uint64_t bit = (uint64_t)1 << (-dist);
+
+    if (route.dedup_mask & bit) {
+        return true;
+    }
+
+    route.dedup_mask |= bit;
+    return false;
+}
+
 } // namespace packet
 } // namespace roc
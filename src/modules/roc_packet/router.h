@@ -13,6 +13,7 @@
 #define ROC_PACKET_ROUTER_H_
 
 #include "roc_core/array.h"
+#include "roc_core/hashmap.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/stddefs.h"
@@ -34,7 +35,15 @@ public:
     //! Add route.
     //! @remarks
     //!  Packets that has given @p flags set will be routed to @p writer.
-    bool add_route(IWriter& writer, unsigned flags);
+    //!  If @p dedup is true, packets whose position in the stream was already
+    //!  seen by this route are dropped; enable it when the same stream may
+    //!  arrive over multiple network paths, e.g. with multipath senders.
+    bool add_route(IWriter& writer, unsigned flags, bool dedup = false);
+
+    //! Check if some route has detected the given stream.
+    //! @remarks
+    //!  A stream is attached to a route when its first packet is routed.
+    bool has_source(source_t source) const;
 
     //! Write next packet.
     //! @remarks
@@ -42,14 +51,43 @@ public:
     virtual void write(const PacketPtr& packet);
 
 private:
-    struct Route {
+    struct Route;
+
+    void deliver_(Route& route, const PacketPtr& packet);
+    bool is_duplicate_(Route& route, const Packet& packet);
+
+    struct Route : core::HashmapNode {
         IWriter* writer;
         unsigned flags;
         source_t source;
         bool has_source;
+
+        // duplicate suppression: sliding window over recent stream positions;
+        // bit N of dedup_mask is set if position (dedup_pos - N) was delivered
+        bool dedup;
+        bool has_dedup_pos;
+        uint32_t dedup_pos;
+        uint64_t dedup_mask;
+        uint64_t dedup_dropped;
+
+        source_t key() const {
+            return source;
+        }
+
+        static size_t key_hash(source_t source) {
+            // Knuth multiplicative hash; sources are often consecutive
+            return (size_t)(source * 2654435761u);
+        }
     };
 
-    core::Array<Route> routes_;
+    // Routes are stored in the array; once a route has detected its stream,
+    // it is also indexed in the map by the stream source, so that dispatch
+    // stays O(1) as the number of streams grows. The array capacity is
+    // preallocated, so elements never move and may be safely linked into
+    // the map. The embedded capacity covers the usual case of one route
+    // for source packets plus one for repair packets.
+    core::Array<Route, 2> routes_;
+    core::Hashmap<Route, source_t> route_map_;
 
     bool valid_;
 };
@@ -56,6 +56,20 @@ struct RTP {
     //! Packet header.
     core::Slice<uint8_t> header;
 
+    //! Contributing source list.
+    //! @remarks
+    //!  View into the CSRC section of the packet header, empty if the packet
+    //!  has no contributing sources. The identifiers are not decoded during
+    //!  parsing; the consumer interprets the view only when it needs them.
+    core::Slice<uint8_t> csrc;
+
+    //! Header extension.
+    //! @remarks
+    //!  View into the header extension, including the extension header, empty
+    //!  if the packet has no extension. Not decoded during parsing; the
+    //!  consumer interprets the view only when it needs it.
+    core::Slice<uint8_t> extension;
+
     //! Packet payload.
     //! @remarks
     //!  Doesn't include RTP headers and padding.
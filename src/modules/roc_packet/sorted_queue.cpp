@@ -9,21 +9,99 @@
 #include "roc_packet/sorted_queue.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/random.h"
 
 namespace roc {
 namespace packet {
 
 SortedQueue::SortedQueue(size_t max_size)
-    : max_size_(max_size) {
+    : tail_node_(NULL)
+    , level_(1)
+    , size_(0)
+    , byte_size_(0)
+    , max_size_(max_size) {
+}
+
+SortedQueue::SortedQueue(size_t max_size, core::IAllocator& allocator)
+    : tail_node_(NULL)
+    , level_(1)
+    , size_(0)
+    , byte_size_(0)
+    , max_size_(max_size) {
+    node_pool_.reset(new (allocator) core::Pool<Node>(allocator, sizeof(Node), false),
+                     allocator);
+    if (!node_pool_) {
+        roc_log(LogError,
+                "sorted queue: can't allocate node pool, falling back to linear scan");
+    }
+}
+
+SortedQueue::~SortedQueue() {
+    // Batched teardown: hand the queued packets back to the pool a batch
+    // at a time instead of one by one, so that destroying a deep queue,
+    // e.g. when a dead session is reaped mid-stream, doesn't stall the
+    // pipeline on hundreds of sequential pool operations. Packets still
+    // referenced from elsewhere (e.g. by latest_) are released normally.
+    enum { ReleaseBatch = 32 };
+
+    Packet* batch[ReleaseBatch];
+    size_t n_batch = 0;
+
+    void* node_batch[ReleaseBatch];
+    size_t n_nodes = 0;
+
+    for (;;) {
+        Packet* packet = NULL;
+
+        if (node_pool_) {
+            // walk the level-0 chain directly: the skiplist invariants
+            // don't have to be maintained during teardown
+            Node* node = head_node_.next[0];
+            if (node) {
+                head_node_.next[0] = node->next[0];
+
+                packet = node->packet.transfer();
+                node->~Node();
+
+                node_batch[n_nodes++] = node;
+                if (n_nodes == ReleaseBatch) {
+                    node_pool_->deallocate_batch(node_batch, n_nodes);
+                    n_nodes = 0;
+                }
+            }
+        } else {
+            packet = list_.detach_front();
+        }
+
+        if (!packet) {
+            break;
+        }
+
+        if (packet->getref() != 1) {
+            packet->decref();
+        } else {
+            batch[n_batch++] = packet;
+            if (n_batch == ReleaseBatch) {
+                Packet::destroy_batch(batch, n_batch);
+                n_batch = 0;
+            }
+        }
+    }
+
+    if (n_nodes != 0) {
+        node_pool_->deallocate_batch(node_batch, n_nodes);
+    }
+    if (n_batch != 0) {
+        Packet::destroy_batch(batch, n_batch);
+    }
 }
 
 PacketPtr SortedQueue::read() {
-    if (PacketPtr packet = list_.back()) {
-        list_.remove(*packet);
-        return packet;
+    if (node_pool_) {
+        return read_indexed_();
     }
 
-    return NULL;
+    return read_list_();
 }
 
 void SortedQueue::write(const PacketPtr& packet) {
@@ -31,7 +109,7 @@ void SortedQueue::write(const PacketPtr& packet) {
         roc_panic("sorted queue: attempting to add null packet");
     }
 
-    if (max_size_ > 0 && list_.size() == max_size_) {
+    if (max_size_ > 0 && size() == max_size_) {
         roc_log(LogDebug,
                 "sorted queue: queue is full, dropping packet:"
                 " max_size=%u",
@@ -43,6 +121,55 @@ void SortedQueue::write(const PacketPtr& packet) {
         latest_ = packet;
     }
 
+    if (node_pool_) {
+        write_indexed_(packet);
+    } else {
+        write_list_(packet);
+    }
+}
+
+size_t SortedQueue::size() const {
+    if (node_pool_) {
+        return size_;
+    }
+
+    return list_.size();
+}
+
+size_t SortedQueue::byte_size() const {
+    return byte_size_;
+}
+
+PacketPtr SortedQueue::head() const {
+    if (node_pool_) {
+        return head_node_.next[0] ? head_node_.next[0]->packet : PacketPtr();
+    }
+
+    return list_.back();
+}
+
+PacketPtr SortedQueue::tail() const {
+    if (node_pool_) {
+        return tail_node_ ? tail_node_->packet : PacketPtr();
+    }
+
+    return list_.front();
+}
+
+PacketPtr SortedQueue::latest() const {
+    return latest_;
+}
+
+PacketPtr SortedQueue::read_list_() {
+    PacketPtr packet;
+    packet.adopt(list_.detach_back());
+    if (packet && packet->has_data()) {
+        byte_size_ -= packet->data().size();
+    }
+    return packet;
+}
+
+void SortedQueue::write_list_(const PacketPtr& packet) {
     PacketPtr pos = list_.front();
 
     for (; pos; pos = list_.nextof(*pos)) {
@@ -65,22 +192,107 @@ void SortedQueue::write(const PacketPtr& packet) {
     } else {
         list_.push_back(*packet);
     }
-}
 
-size_t SortedQueue::size() const {
-    return list_.size();
+    if (packet->has_data()) {
+        byte_size_ += packet->data().size();
+    }
 }
 
-PacketPtr SortedQueue::head() const {
-    return list_.back();
+PacketPtr SortedQueue::read_indexed_() {
+    Node* node = head_node_.next[0];
+    if (!node) {
+        return NULL;
+    }
+
+    // take over the reference held by the node instead of copying it,
+    // so that destroying the node below doesn't touch the counter
+    PacketPtr packet;
+    packet.adopt(node->packet.transfer());
+
+    // the first node may be referenced only from the head node
+    for (size_t n = 0; n < node->level; n++) {
+        head_node_.next[n] = node->next[n];
+    }
+
+    if (tail_node_ == node) {
+        tail_node_ = NULL;
+    }
+
+    while (level_ > 1 && !head_node_.next[level_ - 1]) {
+        level_--;
+    }
+
+    node_pool_->destroy(*node);
+    size_--;
+
+    if (packet->has_data()) {
+        byte_size_ -= packet->data().size();
+    }
+
+    return packet;
 }
 
-PacketPtr SortedQueue::tail() const {
-    return list_.front();
+void SortedQueue::write_indexed_(const PacketPtr& packet) {
+    Node* update[MaxLevel];
+
+    Node* pos = &head_node_;
+
+    for (size_t n = level_; n-- > 0;) {
+        while (pos->next[n] && pos->next[n]->packet->compare(*packet) < 0) {
+            pos = pos->next[n];
+        }
+        update[n] = pos;
+    }
+
+    Node* succ = update[0]->next[0];
+
+    if (succ && succ->packet->compare(*packet) == 0) {
+        roc_log(LogDebug, "sorted queue: dropping duplicate packet");
+        return;
+    }
+
+    Node* node = new (*node_pool_) Node;
+    if (!node) {
+        roc_log(LogError, "sorted queue: can't allocate node, dropping packet");
+        return;
+    }
+
+    const size_t level = random_level_();
+
+    if (level > level_) {
+        for (size_t n = level_; n < level; n++) {
+            update[n] = &head_node_;
+        }
+        level_ = level;
+    }
+
+    node->packet = packet;
+    node->level = level;
+
+    for (size_t n = 0; n < level; n++) {
+        node->next[n] = update[n]->next[n];
+        update[n]->next[n] = node;
+    }
+
+    if (!node->next[0]) {
+        tail_node_ = node;
+    }
+
+    size_++;
+
+    if (packet->has_data()) {
+        byte_size_ += packet->data().size();
+    }
 }
 
-PacketPtr SortedQueue::latest() const {
-    return latest_;
+size_t SortedQueue::random_level_() {
+    size_t level = 1;
+
+    while (level < MaxLevel && core::random(2) == 0) {
+        level++;
+    }
+
+    return level;
 }
 
 } // namespace packet
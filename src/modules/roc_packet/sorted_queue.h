@@ -12,8 +12,11 @@
 #ifndef ROC_PACKET_SORTED_QUEUE_H_
 #define ROC_PACKET_SORTED_QUEUE_H_
 
+#include "roc_core/iallocator.h"
 #include "roc_core/list.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/pool.h"
+#include "roc_core/unique_ptr.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet.h"
@@ -31,6 +34,17 @@ public:
     //!  If @p max_size is non-zero, it specifies maximum number of packets in queue.
     explicit SortedQueue(size_t max_size);
 
+    //! Construct empty indexed queue.
+    //! @remarks
+    //!  Same as the first constructor, but additionally maintains a skiplist
+    //!  index with nodes allocated from a pool on top of @p allocator, so that
+    //!  insertion cost stays logarithmic when packets are heavily reordered
+    //!  and the queue is deep.
+    SortedQueue(size_t max_size, core::IAllocator& allocator);
+
+    //! Destroy queue.
+    ~SortedQueue();
+
     //! Add packet to the queue.
     //! @remarks
     //!  - if the maximum queue size is reached, packet is dropped
@@ -48,6 +62,9 @@ public:
     //! Get number of packets in queue.
     size_t size() const;
 
+    //! Get total size of packet data in queue, in bytes.
+    size_t byte_size() const;
+
     //! Get first packet in the queue.
     //! @returns
     //!  the first packet in the queue or null if there are no packets
@@ -70,7 +87,41 @@ public:
     PacketPtr latest() const;
 
 private:
+    //! Maximum number of levels in the skiplist index.
+    enum { MaxLevel = 16 };
+
+    //! Skiplist node.
+    //! @remarks
+    //!  Nodes are ordered ascending, i.e. the first node holds the packet
+    //!  returned by the next read() call.
+    struct Node {
+        PacketPtr packet;    //!< Packet that the node refers to.
+        size_t level;        //!< Number of levels the node participates in.
+        Node* next[MaxLevel]; //!< Next node on each level.
+
+        Node()
+            : level(0) {
+            memset(next, 0, sizeof(next));
+        }
+    };
+
+    void write_list_(const PacketPtr& packet);
+    void write_indexed_(const PacketPtr& packet);
+
+    PacketPtr read_list_();
+    PacketPtr read_indexed_();
+
+    static size_t random_level_();
+
     core::List<Packet> list_;
+
+    core::UniquePtr<core::Pool<Node> > node_pool_;
+    Node head_node_;
+    Node* tail_node_;
+    size_t level_;
+    size_t size_;
+    size_t byte_size_;
+
     PacketPtr latest_;
     const size_t max_size_;
 };
@@ -124,6 +124,57 @@ bool Address::get_ip(char* buf, size_t bufsz) const {
     return true;
 }
 
+CompactAddress Address::compact() const {
+    CompactAddress ca;
+    memset(&ca, 0, sizeof(ca));
+
+    switch (family_()) {
+    case AF_INET:
+        // IPv4-mapped IPv6 (::ffff:a.b.c.d)
+        ca.ip[10] = 0xff;
+        ca.ip[11] = 0xff;
+        memcpy(ca.ip + 12, &sa_.addr4.sin_addr, 4);
+        memcpy(ca.port, &sa_.addr4.sin_port, sizeof(ca.port));
+        break;
+
+    case AF_INET6:
+        memcpy(ca.ip, &sa_.addr6.sin6_addr, sizeof(ca.ip));
+        memcpy(ca.port, &sa_.addr6.sin6_port, sizeof(ca.port));
+        break;
+
+    default:
+        break;
+    }
+
+    return ca;
+}
+
+bool Address::set_compact(const CompactAddress& ca) {
+    static const uint8_t v4_prefix[12] = { 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0xff, 0xff };
+
+    CompactAddress zero;
+    memset(&zero, 0, sizeof(zero));
+
+    if (ca == zero) {
+        return false;
+    }
+
+    memset(&sa_, 0, sizeof(sa_));
+
+    if (memcmp(ca.ip, v4_prefix, sizeof(v4_prefix)) == 0) {
+        sa_.addr4.sin_family = AF_INET;
+        memcpy(&sa_.addr4.sin_addr, ca.ip + 12, 4);
+        memcpy(&sa_.addr4.sin_port, ca.port, sizeof(ca.port));
+    } else {
+        sa_.addr6.sin6_family = AF_INET6;
+        memcpy(&sa_.addr6.sin6_addr, ca.ip, sizeof(ca.ip));
+        memcpy(&sa_.addr6.sin6_port, ca.port, sizeof(ca.port));
+    }
+
+    return true;
+}
+
 bool Address::operator==(const Address& other) const {
     if (family_() != other.family_()) {
         return false;
@@ -16,6 +16,7 @@
 #include <sys/socket.h>
 
 #include "roc_core/stddefs.h"
+#include "roc_packet/compact_address.h"
 
 namespace roc {
 namespace packet {
@@ -59,6 +60,17 @@ public:
     //! Get IP address.
     bool get_ip(char* buf, size_t bufsz) const;
 
+    //! Get compact canonical form of the address.
+    //! @remarks
+    //!  An invalid address maps to the all-zero compact form.
+    CompactAddress compact() const;
+
+    //! Set address from its compact canonical form.
+    //! @returns
+    //!  false if @p compact is all-zero, i.e. was produced from an
+    //!  invalid address.
+    bool set_compact(const CompactAddress& compact);
+
     //! Compare addresses.
     bool operator==(const Address& other) const;
 
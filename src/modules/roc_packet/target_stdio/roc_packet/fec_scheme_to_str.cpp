@@ -19,6 +19,10 @@ const char* fec_scheme_to_str(FECScheme scheme) {
         return "rs8m";
     case FEC_LDPC_Staircase:
         return "ldpc";
+    case FEC_XOR:
+        return "xor";
+    case FEC_RLC:
+        return "rlc";
     }
     return "?";
 }
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/chunked_converter.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace pipeline {
+
+ChunkedConverter::ChunkJob::Collector::Collector(core::Array<audio::sample_t>& out)
+    : out_(out)
+    , discard_(0) {
+}
+
+void ChunkedConverter::ChunkJob::Collector::begin(size_t discard) {
+    discard_ = discard;
+}
+
+void ChunkedConverter::ChunkJob::Collector::write(audio::Frame& frame) {
+    const audio::sample_t* data = frame.data();
+    size_t size = frame.size();
+
+    if (discard_ >= size) {
+        discard_ -= size;
+        return;
+    }
+
+    data += discard_;
+    size -= discard_;
+    discard_ = 0;
+
+    const size_t pos = out_.size();
+    if (!out_.resize(pos + size)) {
+        roc_panic("chunked converter: can't allocate chunk output");
+    }
+
+    memcpy(&out_[pos], data, size * sizeof(audio::sample_t));
+}
+
+ChunkedConverter::ChunkJob::ChunkJob(const ConverterConfig& config,
+                                     core::BufferPool<audio::sample_t>& pool,
+                                     core::IAllocator& allocator)
+    : in_(allocator)
+    , out_(allocator)
+    , collector_(out_)
+    , chunk_writer_(NULL)
+    , config_(config)
+    , pool_(pool)
+    , allocator_(allocator)
+    , frame_size_(config.internal_frame_size)
+    , valid_(false) {
+    audio::IWriter* awriter = &collector_;
+
+    if (config.poisoning) {
+        poisoner_.reset(new (allocator) audio::PoisonWriter(*awriter), allocator);
+        if (!poisoner_) {
+            return;
+        }
+        awriter = poisoner_.get();
+    }
+
+    if (!rebuild_resampler_()) {
+        return;
+    }
+
+    const size_t max_input = (PrimeFrames + ChunkFrames + TailFrames) * frame_size_;
+    const size_t max_output = (size_t)((uint64_t)max_input * config.output_sample_rate
+                                       / config.input_sample_rate)
+        + frame_size_ * 2;
+
+    if (!in_.grow(max_input)) {
+        return;
+    }
+    if (!out_.grow(max_output)) {
+        return;
+    }
+
+    valid_ = true;
+}
+
+bool ChunkedConverter::ChunkJob::valid() const {
+    return valid_;
+}
+
+bool ChunkedConverter::ChunkJob::rebuild_resampler_() {
+    audio::IWriter* awriter = poisoner_ ? (audio::IWriter*)poisoner_.get()
+                                        : (audio::IWriter*)&collector_;
+
+    resampler_.reset(new (allocator_) audio::ResamplerWriter(
+                         *awriter, pool_, allocator_, config_.resampler,
+                         config_.output_channels, config_.internal_frame_size),
+                     allocator_);
+    if (!resampler_ || !resampler_->valid()) {
+        return false;
+    }
+    if (!resampler_->set_scaling(float(config_.input_sample_rate)
+                                 / config_.output_sample_rate)) {
+        return false;
+    }
+    chunk_writer_ = resampler_.get();
+
+    return true;
+}
+
+bool ChunkedConverter::ChunkJob::prepare(const audio::sample_t* data,
+                                         size_t size,
+                                         size_t discard) {
+    // recreate the resampler so that every chunk starts from the same
+    // deterministic state and the chunk outputs line up exactly; this is
+    // cheap since the sinc tables are shared through the table cache
+    if (!rebuild_resampler_()) {
+        return false;
+    }
+
+    if (!in_.resize(size)) {
+        return false;
+    }
+    memcpy(&in_[0], data, size * sizeof(audio::sample_t));
+
+    out_.resize(0);
+    collector_.begin(discard);
+
+    return true;
+}
+
+audio::sample_t* ChunkedConverter::ChunkJob::output_data() {
+    return out_.size() != 0 ? &out_[0] : NULL;
+}
+
+size_t ChunkedConverter::ChunkJob::output_size() const {
+    return out_.size();
+}
+
+void ChunkedConverter::ChunkJob::run() {
+    size_t pos = 0;
+
+    while (pos < in_.size()) {
+        size_t sz = in_.size() - pos;
+        if (sz > frame_size_) {
+            sz = frame_size_;
+        }
+
+        audio::Frame frame(&in_[pos], sz);
+        chunk_writer_->write(frame);
+
+        pos += sz;
+    }
+}
+
+ChunkedConverter::ChunkedConverter(const ConverterConfig& config,
+                                   audio::IWriter* output_writer,
+                                   core::ThreadPool& thread_pool,
+                                   core::BufferPool<audio::sample_t>& pool,
+                                   core::IAllocator& allocator)
+    : allocator_(allocator)
+    , thread_pool_(thread_pool)
+    , output_writer_(output_writer ? output_writer : &null_writer_)
+    , jobs_(allocator)
+    , stream_(allocator)
+    , splice_tail_(allocator)
+    , num_channels_(packet::num_channels(config.output_channels))
+    , chunk_size_(ChunkFrames * config.internal_frame_size)
+    , prime_size_(PrimeFrames * config.internal_frame_size)
+    , tail_size_(TailFrames * config.internal_frame_size)
+    , chunk_input_pos_(0)
+    , config_(config)
+    , valid_(false) {
+    if (!config.resampling) {
+        roc_log(LogError, "chunked converter: resampling should be enabled");
+        return;
+    }
+
+    const size_t n_jobs = thread_pool.num_threads();
+    if (n_jobs == 0) {
+        roc_log(LogError, "chunked converter: thread pool has no workers");
+        return;
+    }
+
+    if (!jobs_.grow(n_jobs)) {
+        return;
+    }
+    for (size_t n = 0; n < n_jobs; n++) {
+        ChunkJob* job = new (allocator) ChunkJob(config_, pool, allocator);
+        if (!job) {
+            roc_log(LogError, "chunked converter: can't allocate chunk job");
+            return;
+        }
+        jobs_.push_back(job);
+        if (!job->valid()) {
+            return;
+        }
+    }
+
+    if (!stream_.grow(prime_size_ + n_jobs * chunk_size_ + tail_size_
+                      + config.internal_frame_size)) {
+        return;
+    }
+    if (!splice_tail_.grow(output_len_(tail_size_) + config.internal_frame_size)) {
+        return;
+    }
+
+    // silent history for priming the very first chunk
+    if (!stream_.resize(prime_size_)) {
+        return;
+    }
+
+    valid_ = true;
+}
+
+ChunkedConverter::~ChunkedConverter() {
+    for (size_t n = 0; n < jobs_.size(); n++) {
+        allocator_.destroy(*jobs_[n]);
+    }
+}
+
+bool ChunkedConverter::valid() {
+    return valid_;
+}
+
+size_t ChunkedConverter::sample_rate() const {
+    return config_.output_sample_rate;
+}
+
+bool ChunkedConverter::has_clock() const {
+    return false;
+}
+
+void ChunkedConverter::write(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    const audio::sample_t* data = frame.data();
+    size_t size = frame.size();
+
+    const size_t batch_size =
+        prime_size_ + jobs_.size() * chunk_size_ + tail_size_;
+
+    while (size > 0) {
+        const size_t pos = stream_.size();
+
+        size_t sz = size;
+        if (sz > stream_.max_size() - pos) {
+            sz = stream_.max_size() - pos;
+        }
+
+        if (!stream_.resize(pos + sz)) {
+            roc_panic("chunked converter: can't buffer input");
+        }
+        memcpy(&stream_[pos], data, sz * sizeof(audio::sample_t));
+
+        data += sz;
+        size -= sz;
+
+        if (stream_.size() >= batch_size) {
+            process_batch_(jobs_.size(), false);
+        }
+    }
+}
+
+void ChunkedConverter::flush() {
+    roc_panic_if(!valid());
+
+    while (stream_.size() > prime_size_ + chunk_size_ + tail_size_) {
+        process_batch_(1, false);
+    }
+
+    if (stream_.size() > prime_size_) {
+        process_batch_(1, true);
+    } else if (splice_tail_.size() != 0) {
+        write_out_(&splice_tail_[0], splice_tail_.size());
+        splice_tail_.resize(0);
+    }
+}
+
+size_t ChunkedConverter::output_len_(uint64_t input_len) const {
+    const size_t len =
+        (size_t)(input_len * config_.output_sample_rate / config_.input_sample_rate);
+    return len - len % num_channels_;
+}
+
+void ChunkedConverter::process_batch_(size_t n_chunks, bool last) {
+    for (size_t n = 0; n < n_chunks; n++) {
+        const size_t base = n * chunk_size_;
+
+        size_t span = prime_size_ + chunk_size_ + tail_size_;
+        if (last && n == n_chunks - 1) {
+            span = stream_.size() - base;
+        }
+
+        if (!jobs_[n]->prepare(&stream_[base], span, output_len_(prime_size_))) {
+            roc_panic("chunked converter: can't prepare chunk");
+        }
+        thread_pool_.schedule(*jobs_[n]);
+    }
+
+    for (size_t n = 0; n < n_chunks; n++) {
+        thread_pool_.wait(*jobs_[n]);
+    }
+
+    for (size_t n = 0; n < n_chunks; n++) {
+        splice_write_(*jobs_[n], last && n == n_chunks - 1);
+    }
+
+    if (last) {
+        stream_.resize(0);
+    } else {
+        // drop processed chunks, keeping history for priming the next one
+        const size_t consumed = n_chunks * chunk_size_;
+        const size_t remaining = stream_.size() - consumed;
+
+        memmove(&stream_[0], &stream_[consumed],
+                remaining * sizeof(audio::sample_t));
+        stream_.resize(remaining);
+    }
+}
+
+void ChunkedConverter::splice_write_(ChunkJob& job, bool last) {
+    audio::sample_t* out = job.output_data();
+    const size_t out_size = job.output_size();
+
+    // blend the chunk start with the withheld tail of the previous chunk
+    size_t cross = splice_tail_.size();
+    if (cross > out_size) {
+        cross = out_size;
+    }
+
+    const size_t cross_frames = cross / num_channels_;
+    if (cross_frames == 0) {
+        cross = 0;
+    }
+
+    for (size_t n = 0; n < cross; n++) {
+        const float t = float(n / num_channels_) / cross_frames;
+        out[n] = splice_tail_[n] * (1 - t) + out[n] * t;
+    }
+
+    // withhold everything collected past the chunk boundary, so that the
+    // chunk contributes exactly the output up to the boundary and the next
+    // chunk starts writing right at it; boundaries are computed from the
+    // cumulative input position to avoid accumulating rounding errors
+    size_t keep = 0;
+    if (!last) {
+        const size_t chunk_out = output_len_(chunk_input_pos_ + chunk_size_)
+            - output_len_(chunk_input_pos_);
+        if (out_size > chunk_out) {
+            keep = out_size - chunk_out;
+        }
+        chunk_input_pos_ += chunk_size_;
+    }
+
+    write_out_(out, out_size - keep);
+
+    splice_tail_.resize(keep);
+    if (keep != 0) {
+        memcpy(&splice_tail_[0], out + out_size - keep,
+               keep * sizeof(audio::sample_t));
+    }
+}
+
+void ChunkedConverter::write_out_(audio::sample_t* data, size_t size) {
+    size_t pos = 0;
+
+    while (pos < size) {
+        size_t sz = size - pos;
+        if (sz > config_.internal_frame_size) {
+            sz = config_.internal_frame_size;
+        }
+
+        audio::Frame frame(data + pos, sz);
+        output_writer_->write(frame);
+
+        pos += sz;
+    }
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/chunked_converter.h
+//! @brief Chunked converter pipeline.
+
+#ifndef ROC_PIPELINE_CHUNKED_CONVERTER_H_
+#define ROC_PIPELINE_CHUNKED_CONVERTER_H_
+
+#include "roc_audio/null_writer.h"
+#include "roc_audio/poison_writer.h"
+#include "roc_audio/resampler_writer.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/thread_pool.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_packet/units.h"
+#include "roc_pipeline/config.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Chunked converter pipeline.
+//!
+//! Parallel variant of Converter for offline conversion: the input stream is
+//! split into chunks which are resampled concurrently on a thread pool, and
+//! the chunk outputs are spliced back together in order.
+//!
+//! Each chunk is resampled by its own resampler, primed with a portion of the
+//! preceding input so that the resampler window is warmed up before the chunk
+//! starts, and extended with a portion of the following input so that
+//! consecutive chunk outputs overlap. The overlapping region is blended with a
+//! short linear crossfade, which makes the parallel output not bit-identical
+//! to the serial one, but keeps chunk boundaries inaudible.
+//!
+//! write() only buffers the input; buffered chunks are processed and written
+//! to the output when enough of them are accumulated to occupy every worker
+//! thread. flush() should be called after the last write() to process the
+//! buffered remainder.
+class ChunkedConverter : public sndio::ISink, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    ChunkedConverter(const ConverterConfig& config,
+                     audio::IWriter* output_writer,
+                     core::ThreadPool& thread_pool,
+                     core::BufferPool<audio::sample_t>& pool,
+                     core::IAllocator& allocator);
+
+    ~ChunkedConverter();
+
+    //! Check if the pipeline was successfully constructed.
+    bool valid();
+
+    //! Get sink sample rate.
+    virtual size_t sample_rate() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+    //! Process and write all buffered input.
+    void flush();
+
+private:
+    enum {
+        // number of internal frames per chunk
+        ChunkFrames = 256,
+
+        // number of internal frames used to warm up the chunk resampler;
+        // should cover the whole resampler window
+        PrimeFrames = 3,
+
+        // number of internal frames by which consecutive chunk inputs overlap;
+        // should exceed the resampler latency so that each chunk produces
+        // output up to and past its own boundary
+        TailFrames = 4
+    };
+
+    class ChunkJob : public core::ThreadPool::Task, public core::NonCopyable<> {
+    public:
+        ChunkJob(const ConverterConfig& config,
+                 core::BufferPool<audio::sample_t>& pool,
+                 core::IAllocator& allocator);
+
+        bool valid() const;
+
+        bool prepare(const audio::sample_t* data, size_t size, size_t discard);
+
+        audio::sample_t* output_data();
+        size_t output_size() const;
+
+    private:
+        virtual void run();
+
+        bool rebuild_resampler_();
+
+        class Collector : public audio::IWriter, public core::NonCopyable<> {
+        public:
+            explicit Collector(core::Array<audio::sample_t>& out);
+
+            void begin(size_t discard);
+
+            virtual void write(audio::Frame& frame);
+
+        private:
+            core::Array<audio::sample_t>& out_;
+            size_t discard_;
+        };
+
+        core::Array<audio::sample_t> in_;
+        core::Array<audio::sample_t> out_;
+
+        Collector collector_;
+
+        core::UniquePtr<audio::PoisonWriter> poisoner_;
+        core::UniquePtr<audio::ResamplerWriter> resampler_;
+
+        audio::IWriter* chunk_writer_;
+
+        const ConverterConfig& config_;
+        core::BufferPool<audio::sample_t>& pool_;
+        core::IAllocator& allocator_;
+
+        const size_t frame_size_;
+        bool valid_;
+    };
+
+    size_t output_len_(uint64_t input_len) const;
+
+    void process_batch_(size_t n_chunks, bool last);
+    void splice_write_(ChunkJob& job, bool last);
+    void write_out_(audio::sample_t* data, size_t size);
+
+    core::IAllocator& allocator_;
+    core::ThreadPool& thread_pool_;
+
+    audio::NullWriter null_writer_;
+    audio::IWriter* output_writer_;
+
+    core::Array<ChunkJob*> jobs_;
+
+    // prime_size_ samples of input history followed by buffered input
+    core::Array<audio::sample_t> stream_;
+
+    // output withheld from the previous chunk for crossfading
+    core::Array<audio::sample_t> splice_tail_;
+
+    const size_t num_channels_;
+    const size_t chunk_size_;
+    const size_t prime_size_;
+    const size_t tail_size_;
+
+    // total input consumed by completed chunks, used to compute exact
+    // per-chunk output boundaries without accumulating rounding errors
+    uint64_t chunk_input_pos_;
+
+    ConverterConfig config_;
+
+    bool valid_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_CHUNKED_CONVERTER_H_
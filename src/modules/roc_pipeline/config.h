@@ -15,6 +15,7 @@
 #include "roc_audio/latency_monitor.h"
 #include "roc_audio/resampler.h"
 #include "roc_audio/watchdog.h"
+#include "roc_core/atomic.h"
 #include "roc_core/stddefs.h"
 #include "roc_core/time.h"
 #include "roc_fec/codec_config.h"
@@ -49,6 +50,15 @@ const int DefaultMinLatencyFactor = -1;
 //! Default maximum latency relative to target latency.
 const int DefaultMaxLatencyFactor = 2;
 
+//! Default per-cycle packet ingest budget of a session (see
+//! ReceiverSessionConfig::max_packets_per_cycle). Two orders of magnitude
+//! above the rate of a well-behaved sender with default packet length.
+const size_t DefaultSessionPacketBudget = 128;
+
+//! Default number of consecutive blank frames after which a session
+//! is hibernated.
+const size_t DefaultHibernationFrames = 64;
+
 //! Port parameters.
 //! @remarks
 //!  On receiver, defines a listened port parameters. On sender,
@@ -85,9 +95,60 @@ struct SenderConfig {
     //! Number of samples for internal frames.
     size_t internal_frame_size;
 
+    //! Number of internal frames buffered between write() and the sender
+    //! thread in asynchronous mode.
+    //! @see async_write.
+    size_t async_write_frames;
+
     //! Packet length, in nanoseconds.
     core::nanoseconds_t packet_length;
 
+    //! Keepalive interval for silence suppression (DTX), in nanoseconds.
+    //! If non-zero, packets are not emitted while the input is silent,
+    //! except one keepalive packet per interval.
+    core::nanoseconds_t dtx_keepalive;
+
+    //! Flush deadline for partially filled packets, in nanoseconds.
+    //! If non-zero, the in-progress packet is emitted with a shorter
+    //! payload when its oldest sample exceeds this age, instead of
+    //! waiting for a full packet. Zero always waits for a full packet.
+    core::nanoseconds_t flush_deadline;
+
+    //! Destination reachability counter reported by the network layer,
+    //! or NULL.
+    //! @remarks
+    //!  Should count consecutive sends that failed with a destination-
+    //!  unreachable error and be reset to zero on a successful send (see
+    //!  netio::Transceiver::add_udp_sender()). When set, the sender
+    //!  suspends packetization and FEC encoding after persistent
+    //!  unreachable errors, keeps sending periodic probe frames, and
+    //!  resumes as soon as a probe goes through, so that a dead stream
+    //!  doesn't keep burning CPU and bandwidth. NULL disables backoff.
+    const core::Atomic* dst_unreachable;
+
+    //! Discovered path MTU reported by the network layer, or NULL.
+    //! @remarks
+    //!  Should hold the path MTU towards the destination in bytes, or
+    //!  zero while it is unknown (see
+    //!  netio::Transceiver::add_udp_sender()). When set together with
+    //!  mtu_packet_sizing, packets are grown to the largest whole
+    //!  multiple of packet_length that fits the path, so jumbo-capable
+    //!  networks carry fewer, larger packets.
+    const core::Atomic* path_mtu;
+
+    //! Grow packets up to the discovered path MTU.
+    //! @remarks
+    //!  Has no effect unless path_mtu is provided. The configured
+    //!  packet_length remains the minimum packet size and the sizing
+    //!  granularity.
+    bool mtu_packet_sizing;
+
+    //! DSCP value for outgoing packets (IPv4 TOS and IPv6 traffic class).
+    //! If non-zero, outgoing datagrams are marked with this value so that
+    //! DiffServ-aware networks can prioritize them. Zero keeps the
+    //! default class.
+    unsigned dscp;
+
     //! RTP payload type for audio packets.
     rtp::PayloadType payload_type;
 
@@ -97,21 +158,50 @@ struct SenderConfig {
     //! Interleave packets.
     bool interleaving;
 
+    //! Piggyback each packet's payload on the next packet (RFC 2198).
+    //! @remarks
+    //!  Every source packet additionally carries the payload of the
+    //!  previous packet as a redundant block, so the receiver repairs a
+    //!  single lost packet from the packet that follows it: one packet
+    //!  interval of recovery latency instead of a FEC block duration, at
+    //!  the cost of doubling the payload bandwidth. Suits interactive
+    //!  links whose dominant loss pattern is isolated single packets.
+    //!  The receiver should enable redundant_encoding as well.
+    bool redundant_encoding;
+
     //! Constrain receiver speed using a CPU timer according to the sample rate.
     bool timing;
 
+    //! Process frames on a dedicated sender thread.
+    //! @remarks
+    //!  If enabled, write() copies the frame into a ring and returns
+    //!  immediately, and packetization, FEC encoding, and netio submit run
+    //!  on an internal thread, keeping the caller's worst case flat. If a
+    //!  frame arrives when the ring is full, it is dropped.
+    bool async_write;
+
     //! Fill unitialized data with large values to make them more noticable.
+    //! Has no effect if debug stages were disabled at compile time.
     bool poisoning;
 
     SenderConfig()
         : input_sample_rate(DefaultSampleRate)
         , input_channels(DefaultChannelMask)
         , internal_frame_size(DefaultInternalFrameSize)
+        , async_write_frames(8)
         , packet_length(DefaultPacketLength)
+        , dtx_keepalive(0)
+        , flush_deadline(0)
+        , dst_unreachable(NULL)
+        , path_mtu(NULL)
+        , mtu_packet_sizing(false)
+        , dscp(0)
         , payload_type(rtp::PayloadType_L16_Stereo)
         , resampling(false)
         , interleaving(false)
+        , redundant_encoding(false)
         , timing(false)
+        , async_write(false)
         , poisoning(false) {
     }
 };
@@ -127,6 +217,12 @@ struct ReceiverSessionConfig {
     packet::channel_mask_t channels;
 
     //! Packet payload type.
+    //! @remarks
+    //!  For sessions created on packet arrival, overwritten with the type
+    //!  parsed from the first packet. The default matters for sessions
+    //!  pre-constructed into the session pool (see session_pool_size):
+    //!  they can only be pre-built for one payload type, and a pooled
+    //!  session is used only if the arriving stream matches it.
     unsigned int payload_type;
 
     //! FEC reader parameters.
@@ -147,10 +243,100 @@ struct ReceiverSessionConfig {
     //! Resampler parameters.
     audio::ResamplerConfig resampler;
 
+    //! Number of consecutive blank frames after which the session is
+    //! hibernated: its chain is not read and doesn't contribute to the
+    //! mixer until a new packet arrives. Zero disables hibernation.
+    size_t hibernation_frames;
+
+    //! Maximum packet size for payload compaction, in bytes.
+    //! @remarks
+    //!  If non-zero, queued packets up to this size are copied into
+    //!  tightly sized per-session buffers and the full-size receive
+    //!  buffer is released, which reduces queue memory several-fold
+    //!  with deep jitter buffers. Zero disables compaction.
+    size_t compact_payload_size;
+
+    //! Draw the session's queued packets from a private per-session pool.
+    //! @remarks
+    //!  Packets of all sessions interleave in the global packet pool, so
+    //!  one session's queued packets scatter across its chunks and queue
+    //!  traversals hop unpredictable addresses. With a private pool the
+    //!  session's packets stay contiguous, and at teardown the whole
+    //!  arena is returned to the allocator chunk-wise instead of being
+    //!  drained element by element. Most effective together with
+    //!  @p compact_payload_size, which keeps the payload bytes in a
+    //!  per-session pool as well.
+    bool private_packet_pool;
+
+    //! Maximum number of packets accepted from the session's sender per
+    //! pipeline cycle.
+    //! @remarks
+    //!  Works as a per-session token bucket refilled on every cycle, with
+    //!  unused budget carried over for a few cycles to absorb bursts. Once
+    //!  the budget is exhausted, further packets of this session are
+    //!  dropped and counted, so a sender flooding packets at many times
+    //!  the expected rate degrades only its own session instead of
+    //!  monopolizing the receiver packet fetching. Zero disables the cap.
+    size_t max_packets_per_cycle;
+
+    //! Maximum number of bytes queued inside the session.
+    //! @remarks
+    //!  Counts packet data held in the source and repair queues. When the
+    //!  limit is reached, new packets are dropped and counted, bounding
+    //!  the queue memory a single flooding sender can consume. Zero
+    //!  disables the cap.
+    size_t max_queued_bytes;
+
+    //! Accept the stream from multiple sender addresses.
+    //! @remarks
+    //!  Used with multipath senders that duplicate packets across
+    //!  redundant links. When enabled, packets of an already detected
+    //!  stream are accepted from any sender address, matched by the
+    //!  stream id instead, and duplicates delivered over several paths
+    //!  are dropped before they reach the queues and the FEC reader.
+    bool multipath;
+
+    //! Drop provably-late packets at session ingest.
+    //! @remarks
+    //!  A packet whose samples are entirely behind the session playback
+    //!  position would be discarded by the depacketizer anyway, after
+    //!  traveling through queue insertion and the FEC reader; triage at
+    //!  ingest drops it before it consumes those resources.
+    bool late_packet_triage;
+
+    //! Expect RFC 2198 redundant encoding in source packets.
+    //! @remarks
+    //!  The sender piggybacks each packet's payload on the next packet
+    //!  (see SenderConfig::redundant_encoding). The redundant framing is
+    //!  stripped before decoding, and a single-packet gap is filled from
+    //!  the redundant copy of the packet that follows it, without waiting
+    //!  for FEC block repair. Both ends should agree on this setting,
+    //!  like on the FEC scheme.
+    bool redundant_encoding;
+
+    //! Bit-exact passthrough mode.
+    //! @remarks
+    //!  Payload samples flow from the depacketizer to the output
+    //!  untouched, and clock drift is compensated with packet-level
+    //!  slips (see LatencyMonitorConfig) instead of resampling. For
+    //!  studio interconnects with external clock sync, where formats
+    //!  match end to end and drift is marginal. Requires resampling to
+    //!  be disabled on the receiver.
+    bool passthrough;
+
     ReceiverSessionConfig()
         : target_latency(DefaultLatency)
         , channels(DefaultChannelMask)
-        , payload_type(0) {
+        , payload_type(rtp::PayloadType_L16_Stereo)
+        , hibernation_frames(DefaultHibernationFrames)
+        , compact_payload_size(0)
+        , private_packet_pool(false)
+        , max_packets_per_cycle(DefaultSessionPacketBudget)
+        , max_queued_bytes(0)
+        , multipath(false)
+        , late_packet_triage(true)
+        , redundant_encoding(false)
+        , passthrough(false) {
         latency_monitor.min_latency = target_latency * DefaultMinLatencyFactor;
         latency_monitor.max_latency = target_latency * DefaultMaxLatencyFactor;
     }
@@ -169,26 +355,77 @@ struct ReceiverCommonConfig {
     //! Number of samples for internal frames.
     size_t internal_frame_size;
 
+    //! Number of worker threads used to run session pipelines in parallel.
+    //! Zero means all sessions are processed on the thread calling read().
+    size_t n_session_threads;
+
+    //! Number of pre-constructed sessions kept ready for new senders.
+    //! Pre-constructed sessions are built with the default session parameters
+    //! outside of the packet path and bound to a sender on demand, so that
+    //! admitting a new sender doesn't build the whole pipeline inline.
+    //! Zero disables pre-construction.
+    size_t session_pool_size;
+
     //! Perform resampling to compensate sender and receiver frequency difference.
     bool resampling;
 
+    //! Share one post-mix resampler between all sessions.
+    //! @remarks
+    //!  Sessions are mixed at their native rate and a single resampler
+    //!  after the mixer applies the rate conversion and the average drift
+    //!  correction, collapsing N per-session resampler runs into one.
+    //!  Intended for senders sharing one clock domain (e.g. a PTP-synced
+    //!  facility); individual clock drift can't be corrected per session
+    //!  in this mode, and all senders must use the same sample rate.
+    //!  Has no effect unless resampling is enabled.
+    bool shared_resampling;
+
     //! Constrain receiver speed using a CPU timer according to the sample rate.
     bool timing;
 
     //! Fill uninitialized data with large values to make them more noticeable.
+    //! Has no effect if debug stages were disabled at compile time.
     bool poisoning;
 
     //! Insert weird beeps instead of silence on packet loss.
     bool beeping;
 
+    //! Measure CPU time consumed by every session pipeline.
+    //! The counters are reported via get_stats() and allow to see which
+    //! sender is eating the receiver CPU on a live system.
+    bool profiling;
+
+    //! Shed quality instead of underrunning when the host is CPU-starved.
+    //! @remarks
+    //!  Monitors the deadline headroom of every output frame and, under
+    //!  sustained overload, steps down expensive stages one by one:
+    //!  session admission, FEC repair, shared resampling. The stages are
+    //!  restored when headroom returns. See QualityGovernor.
+    bool quality_governor;
+
+    //! Expose every session as an individually readable stream.
+    //! @remarks
+    //!  Sessions are not attached to the mixer; their frames are read
+    //!  one by one via Receiver::read_sessions() and read() may not be
+    //!  used. Shared resampling is implicitly disabled, since there is
+    //!  no post-mix stream: each session keeps a private resampler for
+    //!  its own drift correction.
+    bool unmixed;
+
     ReceiverCommonConfig()
         : output_sample_rate(DefaultSampleRate)
         , output_channels(DefaultChannelMask)
         , internal_frame_size(DefaultInternalFrameSize)
+        , n_session_threads(0)
+        , session_pool_size(1)
         , resampling(false)
+        , shared_resampling(false)
         , timing(false)
         , poisoning(false)
-        , beeping(false) {
+        , beeping(false)
+        , profiling(false)
+        , quality_governor(false)
+        , unmixed(false) {
     }
 };
 
@@ -225,6 +462,7 @@ struct ConverterConfig {
     bool resampling;
 
     //! Fill unitialized data with large values to make them more noticable.
+    //! Has no effect if debug stages were disabled at compile time.
     bool poisoning;
 
     ConverterConfig()
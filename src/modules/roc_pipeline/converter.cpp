@@ -25,6 +25,7 @@ Converter::Converter(const ConverterConfig& config,
     }
 
     if (config.resampling) {
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
         if (config.poisoning) {
             resampler_poisoner_.reset(new (allocator) audio::PoisonWriter(*awriter),
                                       allocator);
@@ -33,6 +34,7 @@ Converter::Converter(const ConverterConfig& config,
             }
             awriter = resampler_poisoner_.get();
         }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
         resampler_.reset(new (allocator) audio::ResamplerWriter(
                              *awriter, pool, allocator, config.resampler,
                              config.output_channels, config.internal_frame_size),
@@ -47,6 +49,7 @@ Converter::Converter(const ConverterConfig& config,
         awriter = resampler_.get();
     }
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     profiler_.reset(new (allocator) audio::ProfilingWriter(
                         *awriter, config.input_channels, config.input_sample_rate),
                     allocator);
@@ -63,6 +66,7 @@ Converter::Converter(const ConverterConfig& config,
         }
         awriter = pipeline_poisoner_.get();
     }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
 
     audio_writer_ = awriter;
 }
@@ -13,13 +13,12 @@
 #define ROC_PIPELINE_CONVERTER_H_
 
 #include "roc_audio/null_writer.h"
-#include "roc_audio/poison_writer.h"
-#include "roc_audio/profiling_writer.h"
 #include "roc_audio/resampler_profile.h"
 #include "roc_audio/resampler_writer.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/debug_stages.h"
 #include "roc_sndio/isink.h"
 
 namespace roc {
@@ -49,12 +48,16 @@ public:
 private:
     audio::NullWriter null_writer_;
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonWriter> resampler_poisoner_;
+#endif
     core::UniquePtr<audio::ResamplerWriter> resampler_;
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::ProfilingWriter> profiler_;
 
     core::UniquePtr<audio::PoisonWriter> pipeline_poisoner_;
+#endif
 
     audio::IWriter* audio_writer_;
 
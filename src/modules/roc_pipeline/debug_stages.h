@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/debug_stages.h
+//! @brief Compile-time policy for debug pipeline stages.
+
+#ifndef ROC_PIPELINE_DEBUG_STAGES_H_
+#define ROC_PIPELINE_DEBUG_STAGES_H_
+
+// Debug stages (poison readers and writers, profiling writers) add a
+// virtual hop and a full-frame pass per stage to the pipelines. By default
+// they are compiled in and controlled by runtime config flags; defining
+// ROC_PIPELINE_DISABLE_DEBUG_STAGES strips them from the build entirely,
+// turning the corresponding config flags into no-ops.
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
+#include "roc_audio/poison_reader.h"
+#include "roc_audio/poison_writer.h"
+#include "roc_audio/profiling_writer.h"
+#endif
+
+#endif // ROC_PIPELINE_DEBUG_STAGES_H_
@@ -42,7 +42,19 @@ enum PortProtocol {
     Proto_RTP_LDPC_Source,
 
     //! FEC repair packet + FECFRAME LDPC header.
-    Proto_LDPC_Repair
+    Proto_LDPC_Repair,
+
+    //! RTP source packet + single-parity XOR footer.
+    Proto_RTP_XOR_Source,
+
+    //! FEC repair packet + single-parity XOR header.
+    Proto_XOR_Repair,
+
+    //! RTP source packet + sliding-window RLC footer.
+    Proto_RTP_RLC_Source,
+
+    //! FEC repair packet + sliding-window RLC header.
+    Proto_RLC_Repair
 };
 
 } // namespace pipeline
@@ -33,6 +33,18 @@ packet::FECScheme port_fec_scheme(PortProtocol proto) {
 
     case Proto_LDPC_Repair:
         return packet::FEC_LDPC_Staircase;
+
+    case Proto_RTP_XOR_Source:
+        return packet::FEC_XOR;
+
+    case Proto_XOR_Repair:
+        return packet::FEC_XOR;
+
+    case Proto_RTP_RLC_Source:
+        return packet::FEC_RLC;
+
+    case Proto_RLC_Repair:
+        return packet::FEC_RLC;
     }
 
     return packet::FEC_None;
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_pipeline/quality_governor.h"
+#include "roc_core/log.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+// Busy fraction of the frame period above which a frame counts as
+// overloaded; the remaining headroom is too thin to absorb a scheduling
+// hiccup without underrunning.
+const double OverloadBusyRatio = 0.75;
+
+// Busy fraction below which a frame counts as relaxed. The gap between
+// the two ratios is a dead band where neither counter advances.
+const double RecoverBusyRatio = 0.5;
+
+// Consecutive overloaded frames before degrading one level: short enough
+// to react within a fraction of a second at typical frame sizes, long
+// enough to ignore a single slow frame.
+const size_t DegradeFrames = 32;
+
+// Consecutive relaxed frames before restoring one level. Restoring
+// re-adds load, so it must be much more conservative than degrading.
+const size_t RestoreFrames = 2048;
+
+const char* level_to_str(QualityGovernor::Level level) {
+    switch (level) {
+    case QualityGovernor::Level_Full:
+        return "full";
+    case QualityGovernor::Level_NoAdmission:
+        return "no_admission";
+    case QualityGovernor::Level_NoRepair:
+        return "no_repair";
+    case QualityGovernor::Level_NoResampling:
+        return "no_resampling";
+    }
+    return "?";
+}
+
+} // namespace
+
+QualityGovernor::QualityGovernor()
+    : level_(Level_Full)
+    , n_overloaded_(0)
+    , n_relaxed_(0) {
+}
+
+bool QualityGovernor::update(core::nanoseconds_t busy_time,
+                             core::nanoseconds_t frame_period) {
+    if (frame_period <= 0) {
+        return false;
+    }
+
+    const double busy_ratio = (double)busy_time / (double)frame_period;
+
+    if (busy_ratio > OverloadBusyRatio) {
+        n_overloaded_++;
+        n_relaxed_ = 0;
+    } else if (busy_ratio < RecoverBusyRatio) {
+        n_relaxed_++;
+        n_overloaded_ = 0;
+    } else {
+        n_overloaded_ = 0;
+        n_relaxed_ = 0;
+    }
+
+    if (n_overloaded_ >= DegradeFrames && level_ != Level_NoResampling) {
+        level_ = Level(level_ + 1);
+        n_overloaded_ = 0;
+
+        roc_log(LogInfo, "quality governor: sustained overload, degrading to %s",
+                level_to_str(level_));
+
+        return true;
+    }
+
+    if (n_relaxed_ >= RestoreFrames && level_ != Level_Full) {
+        level_ = Level(level_ - 1);
+        n_relaxed_ = 0;
+
+        roc_log(LogInfo, "quality governor: headroom restored, stepping up to %s",
+                level_to_str(level_));
+
+        return true;
+    }
+
+    return false;
+}
+
+QualityGovernor::Level QualityGovernor::level() const {
+    return level_;
+}
+
+bool QualityGovernor::allow_admission() const {
+    return level_ < Level_NoAdmission;
+}
+
+bool QualityGovernor::allow_fec_repair() const {
+    return level_ < Level_NoRepair;
+}
+
+bool QualityGovernor::allow_resampling() const {
+    return level_ < Level_NoResampling;
+}
+
+} // namespace pipeline
+} // namespace roc
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/quality_governor.h
+//! @brief Overload-adaptive quality governor.
+
+#ifndef ROC_PIPELINE_QUALITY_GOVERNOR_H_
+#define ROC_PIPELINE_QUALITY_GOVERNOR_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/time.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Overload-adaptive quality governor.
+//!
+//! Watches how much of every frame period the receiver spends producing
+//! the frame. When the host is CPU-starved and the headroom stays
+//! exhausted for many consecutive frames, the governor steps down one
+//! degradation level, shedding the most expendable work first; when
+//! headroom stays restored for much longer, it steps back up one level.
+//! Degrading is deliberately much faster than restoring, so a recovering
+//! receiver doesn't oscillate on the overload boundary.
+//!
+//! The governor only decides; the receiver applies the decision to the
+//! stages it owns (see Receiver).
+class QualityGovernor : public core::NonCopyable<> {
+public:
+    //! Degradation level, from full quality to maximum shedding.
+    //! Each level includes the degradations of the previous ones.
+    enum Level {
+        //! All stages run at full quality.
+        Level_Full,
+
+        //! New sessions are not admitted and the session pool is not
+        //! refilled; connected sessions are unaffected.
+        Level_NoAdmission,
+
+        //! FEC block decoding is disabled; lost packets that repair
+        //! could have restored are rendered as silence.
+        Level_NoRepair,
+
+        //! The shared post-mix resampler is bypassed when the conversion
+        //! is drift-only, suspending clock drift correction.
+        Level_NoResampling
+    };
+
+    QualityGovernor();
+
+    //! Account one output frame.
+    //!
+    //! @b Parameters
+    //!  - @p busy_time is how long producing the frame took
+    //!  - @p frame_period is the real-time duration of the frame
+    //!
+    //! @returns
+    //!  true if the degradation level changed.
+    bool update(core::nanoseconds_t busy_time, core::nanoseconds_t frame_period);
+
+    //! Get current degradation level.
+    Level level() const;
+
+    //! Check if new sessions may be admitted.
+    bool allow_admission() const;
+
+    //! Check if FEC block decoding may run.
+    bool allow_fec_repair() const;
+
+    //! Check if the shared resampler may run.
+    bool allow_resampling() const;
+
+private:
+    Level level_;
+
+    size_t n_overloaded_;
+    size_t n_relaxed_;
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_QUALITY_GOVERNOR_H_
@@ -7,15 +7,28 @@
  */
 
 #include "roc_pipeline/receiver.h"
+#include "roc_core/flight_recorder.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
 #include "roc_core/shared_ptr.h"
+#include "roc_core/trace.h"
 #include "roc_packet/address_to_str.h"
 #include "roc_pipeline/port_to_str.h"
 
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+const core::nanoseconds_t SharedScalingLogInterval = 5 * core::Second;
+
+// Sessions sharing the post-mix resampler are expected to share a clock
+// domain; when the spread of their drift estimates exceeds this, their
+// clocks demonstrably diverge and per-session correction is impossible.
+const float SharedScalingDivergence = 0.0005f;
+
+} // namespace
+
 Receiver::Receiver(const ReceiverConfig& config,
                    const fec::CodecMap& codec_map,
                    const rtp::FormatMap& format_map,
@@ -29,20 +42,64 @@ Receiver::Receiver(const ReceiverConfig& config,
     , byte_buffer_pool_(byte_buffer_pool)
     , sample_buffer_pool_(sample_buffer_pool)
     , allocator_(allocator)
+    , timer_pos_(0)
+    , timer_samples_(0)
+    , session_pool_enabled_(config.common.session_pool_size != 0)
     , ticker_(config.common.output_sample_rate)
+    , shared_scaling_limiter_(SharedScalingLogInterval)
+    , resampler_bypassed_(false)
     , audio_reader_(NULL)
     , config_(config)
     , timestamp_(0)
     , num_channels_(packet::num_channels(config.common.output_channels))
+    , cycle_time_(0)
+    , metrics_sessions_(
+          core::MetricsRegistry::instance().find_or_add_counter("receiver_sessions"))
+    , ready_fn_(NULL)
+    , ready_arg_(NULL)
     , active_cond_(control_mutex_) {
-    mixer_.reset(new (allocator_)
-                     audio::Mixer(sample_buffer_pool, config.common.internal_frame_size),
-                 allocator_);
+    if (config_.common.unmixed) {
+        // per-session streams are read individually, so the post-mix shared
+        // resampler can't serve them; sessions keep private resamplers
+        config_.common.shared_resampling = false;
+    }
+
+    if (config.common.n_session_threads != 0) {
+        worker_pool_.reset(new (allocator_) core::ThreadPool(
+                               allocator_, config.common.n_session_threads),
+                           allocator_);
+        if (!worker_pool_ || !worker_pool_->valid()) {
+            return;
+        }
+
+        mixer_.reset(new (allocator_) audio::Mixer(sample_buffer_pool,
+                                                   config.common.internal_frame_size,
+                                                   *worker_pool_, allocator_),
+                     allocator_);
+    } else {
+        mixer_.reset(new (allocator_) audio::Mixer(sample_buffer_pool,
+                                                   config.common.internal_frame_size),
+                     allocator_);
+    }
     if (!mixer_ || !mixer_->valid()) {
         return;
     }
     audio::IReader* areader = mixer_.get();
 
+    if (config_.common.resampling && config_.common.shared_resampling) {
+        shared_resampler_.reset(new (allocator_) audio::ResamplerReader(
+                                    *areader, sample_buffer_pool, allocator_,
+                                    config.default_session.resampler,
+                                    config.common.output_channels,
+                                    config.common.internal_frame_size),
+                                allocator_);
+        if (!shared_resampler_ || !shared_resampler_->valid()) {
+            return;
+        }
+        areader = shared_resampler_.get();
+    }
+
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     if (config.common.poisoning) {
         poisoner_.reset(new (allocator_) audio::PoisonReader(*areader), allocator_);
         if (!poisoner_) {
@@ -50,8 +107,27 @@ Receiver::Receiver(const ReceiverConfig& config,
         }
         areader = poisoner_.get();
     }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
+
+    if (config.common.quality_governor) {
+        governor_.reset(new (allocator_) QualityGovernor, allocator_);
+        if (!governor_) {
+            return;
+        }
+    }
+
+    if (config.common.unmixed) {
+        discard_frame_ = new (sample_buffer_pool) core::Buffer<audio::sample_t>(
+            sample_buffer_pool);
+        if (!discard_frame_) {
+            return;
+        }
+        discard_frame_.resize(config.common.internal_frame_size);
+    }
 
     audio_reader_ = areader;
+
+    refill_session_pool_();
 }
 
 bool Receiver::valid() {
@@ -91,6 +167,22 @@ size_t Receiver::num_sessions() const {
     return sessions_.size();
 }
 
+void Receiver::get_stats(ReceiverStats& stats) const {
+    core::Mutex::Lock lock(control_mutex_);
+
+    stats = ReceiverStats();
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        sess->add_stats(stats);
+    }
+
+    if (governor_) {
+        stats.quality_level = (size_t)governor_->level();
+    }
+}
+
 size_t Receiver::sample_rate() const {
     return config_.common.output_sample_rate;
 }
@@ -113,31 +205,198 @@ void Receiver::wait_active() const {
     }
 }
 
-void Receiver::write(const packet::PacketPtr& packet) {
+void Receiver::set_ready_callback(void (*fn)(void* arg), void* arg) {
     core::Mutex::Lock lock(control_mutex_);
 
-    const State old_state = state_();
+    ready_fn_ = fn;
+    ready_arg_ = arg;
+}
 
-    packets_.push_back(*packet);
+void Receiver::write(const packet::PacketPtr& packet) {
+    void (*ready_fn)(void*) = NULL;
+    void* ready_arg = NULL;
 
-    if (old_state != Active) {
-        active_cond_.broadcast();
+    {
+        core::Mutex::Lock lock(control_mutex_);
+
+        const State old_state = state_();
+
+        packets_.push_back(*packet);
+
+        if (old_state != Active) {
+            active_cond_.broadcast();
+
+            ready_fn = ready_fn_;
+            ready_arg = ready_arg_;
+        }
+    }
+
+    // invoked outside of the lock, so that the callback may call back
+    // into the receiver without deadlocking
+    if (ready_fn) {
+        ready_fn(ready_arg);
     }
 }
 
 bool Receiver::read(audio::Frame& frame) {
+    if (config_.common.unmixed) {
+        roc_panic("receiver: read() may not be used in unmixed mode,"
+                  " use read_sessions()");
+    }
+
+    core::Mutex::Lock lock(pipeline_mutex_);
+
+    read_frame_(frame);
+
+    return true;
+}
+
+bool Receiver::read_batch(audio::sample_t* const* frame_data,
+                          const size_t* frame_sizes,
+                          size_t n_frames) {
+    if (config_.common.unmixed) {
+        roc_panic("receiver: read_batch() may not be used in unmixed mode,"
+                  " use read_sessions()");
+    }
+
+    core::Mutex::Lock lock(pipeline_mutex_);
+
+    for (size_t n = 0; n < n_frames; n++) {
+        audio::Frame frame(frame_data[n], frame_sizes[n]);
+        read_frame_(frame);
+    }
+
+    return true;
+}
+
+size_t Receiver::read_sessions(audio::sample_t* const* frame_data,
+                               const size_t* frame_sizes,
+                               size_t n_frames,
+                               packet::Address* session_addrs) {
+    if (!config_.common.unmixed) {
+        roc_panic("receiver: read_sessions() may be used only in unmixed mode");
+    }
+
     core::Mutex::Lock lock(pipeline_mutex_);
 
+    // all streams advance by the same amount per cycle, so the frames
+    // should be equally sized
+    const size_t frame_size =
+        n_frames != 0 ? frame_sizes[0] : config_.common.internal_frame_size;
+
+    for (size_t n = 1; n < n_frames; n++) {
+        if (frame_sizes[n] != frame_size) {
+            roc_panic("receiver: read_sessions() requires equally sized frames");
+        }
+    }
+
+    if (config_.common.timing) {
+        ticker_.wait(timestamp_);
+    }
+
+    cycle_time_ = core::timestamp();
+
+    ROC_TRACE1(receiver_read_begin, (unsigned long)timestamp_);
+
+    prepare_();
+
+    size_t n_streams = 0;
+
+    // safe without control_mutex_: the list is mutated only under the
+    // pipeline lock, which we hold; concurrent walkers only read
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (sess->hibernating()) {
+            continue;
+        }
+
+        if (n_streams < n_frames) {
+            audio::Frame frame(frame_data[n_streams], frame_size);
+            frame.set_cycle_time(cycle_time_);
+
+            sess->reader().read(frame);
+
+            if (session_addrs) {
+                session_addrs[n_streams] = sess->address();
+            }
+            n_streams++;
+        } else {
+            discard_stream_(sess->reader(), frame_size);
+        }
+    }
+
+    timestamp_ += frame_size / num_channels_;
+
+    ROC_TRACE2(receiver_read_end, (unsigned long)timestamp_, frame_size);
+
+    if (governor_) {
+        update_governor_(core::timestamp() - cycle_time_, frame_size);
+    }
+
+    {
+        core::Mutex::Lock control_lock(control_mutex_);
+        refill_session_pool_();
+    }
+
+    return n_streams;
+}
+
+void Receiver::discard_stream_(audio::IReader& reader, size_t frame_size) {
+    // more connected senders than caller buffers; the stream is still
+    // decoded, so that its pipeline keeps advancing, and dropped
+    while (frame_size != 0) {
+        size_t ns = frame_size;
+        if (ns > discard_frame_.size()) {
+            ns = discard_frame_.size();
+        }
+
+        audio::Frame frame(discard_frame_.data(), ns);
+        frame.set_cycle_time(cycle_time_);
+
+        reader.read(frame);
+
+        frame_size -= ns;
+    }
+}
+
+void Receiver::read_frame_(audio::Frame& frame) {
     if (config_.common.timing) {
         ticker_.wait(timestamp_);
     }
 
+    if (frame.cycle_time() == 0) {
+        frame.set_cycle_time(core::timestamp());
+    }
+    cycle_time_ = frame.cycle_time();
+
+    ROC_TRACE1(receiver_read_begin, (unsigned long)timestamp_);
+
+    const core::nanoseconds_t busy_started = governor_ ? core::timestamp() : 0;
+
     prepare_();
 
-    audio_reader_->read(frame);
+    // while the governor bypasses the shared resampler, read directly
+    // from the mixer; all active sessions are known to run at the output
+    // rate, so only the drift correction is suspended
+    audio::IReader* areader = audio_reader_;
+    if (resampler_bypassed_) {
+        areader = mixer_.get();
+    }
+
+    areader->read(frame);
     timestamp_ += frame.size() / num_channels_;
 
-    return true;
+    ROC_TRACE2(receiver_read_end, (unsigned long)timestamp_, frame.size());
+
+    if (governor_) {
+        update_governor_(core::timestamp() - busy_started, frame.size());
+    }
+
+    {
+        core::Mutex::Lock lock(control_mutex_);
+        refill_session_pool_();
+    }
 }
 
 void Receiver::prepare_() {
@@ -178,6 +437,12 @@ void Receiver::fetch_packets_() {
             continue;
         }
 
+        if (const packet::RTP* rtp = packet->rtp()) {
+            core::FlightRecorder::instance().record(
+                core::FlightRecorder::Stage_ReceiverPacket, rtp->source,
+                (uint32_t)rtp->seqnum, (uint32_t)packets_.size());
+        }
+
         if (!route_packet_(packet)) {
             continue;
         }
@@ -220,6 +485,12 @@ bool Receiver::can_create_session_(const packet::PacketPtr& packet) {
         return false;
     }
 
+    if (governor_ && !governor_->allow_admission()) {
+        roc_log(LogDebug,
+                "receiver: not admitting session, quality governor is shedding load");
+        return false;
+    }
+
     return true;
 }
 
@@ -243,13 +514,20 @@ bool Receiver::create_session_(const packet::PacketPtr& packet) {
             packet::address_to_str(src_address).c_str(),
             packet::address_to_str(dst_address).c_str());
 
-    core::SharedPtr<ReceiverSession> sess = new (allocator_)
-        ReceiverSession(sess_config, config_.common, src_address, codec_map_, format_map_,
-                        packet_pool_, byte_buffer_pool_, sample_buffer_pool_, allocator_);
+    core::SharedPtr<ReceiverSession> sess = take_pooled_session_(sess_config);
 
-    if (!sess || !sess->valid()) {
-        roc_log(LogError, "receiver: can't create session, initialization failed");
-        return false;
+    if (sess) {
+        sess->rebind(src_address);
+    } else {
+        sess = new (allocator_)
+            ReceiverSession(sess_config, config_.common, src_address, codec_map_,
+                            format_map_, packet_pool_, byte_buffer_pool_,
+                            sample_buffer_pool_, allocator_);
+
+        if (!sess || !sess->valid()) {
+            roc_log(LogError, "receiver: can't create session, initialization failed");
+            return false;
+        }
     }
 
     if (!sess->handle(packet)) {
@@ -257,29 +535,246 @@ bool Receiver::create_session_(const packet::PacketPtr& packet) {
         return false;
     }
 
-    mixer_->add(sess->reader());
+    // sessions created while repair is shed must start degraded too
+    if (governor_ && !governor_->allow_fec_repair()) {
+        sess->set_fec_repair(false);
+    }
+
+    if (!config_.common.unmixed) {
+        mixer_->add(sess->reader());
+    }
     sessions_.push_back(*sess);
 
+    sess->attach_timer(session_timers_);
+
+    if (metrics_sessions_) {
+        metrics_sessions_->incr_relaxed();
+    }
+
     return true;
 }
 
 void Receiver::remove_session_(ReceiverSession& sess) {
     roc_log(LogInfo, "receiver: removing session");
 
-    mixer_->remove(sess.reader());
+    sess.detach_timer();
+
+    // hibernating sessions are already detached from the mixer
+    if (!config_.common.unmixed && !sess.hibernating()) {
+        mixer_->remove(sess.reader());
+    }
     sessions_.remove(sess);
+
+    if (metrics_sessions_) {
+        metrics_sessions_->decr_relaxed();
+    }
+}
+
+core::SharedPtr<ReceiverSession>
+Receiver::take_pooled_session_(const ReceiverSessionConfig& sess_config) {
+    // pooled sessions are constructed with the default session parameters;
+    // only these two fields may differ, since they are taken from the first
+    // packet of the stream
+    if (sess_config.payload_type != config_.default_session.payload_type) {
+        return NULL;
+    }
+    if (sess_config.fec_decoder.scheme != config_.default_session.fec_decoder.scheme) {
+        return NULL;
+    }
+
+    core::SharedPtr<ReceiverSession> sess = session_pool_.front();
+    if (sess) {
+        session_pool_.remove(*sess);
+    }
+
+    return sess;
+}
+
+void Receiver::refill_session_pool_() {
+    if (governor_ && !governor_->allow_admission()) {
+        return;
+    }
+
+    while (session_pool_enabled_
+           && session_pool_.size() < config_.common.session_pool_size) {
+        core::SharedPtr<ReceiverSession> sess = new (allocator_) ReceiverSession(
+            config_.default_session, config_.common, packet::Address(), codec_map_,
+            format_map_, packet_pool_, byte_buffer_pool_, sample_buffer_pool_,
+            allocator_);
+
+        if (!sess || !sess->valid()) {
+            roc_log(LogError,
+                    "receiver: can't pre-construct session, disabling session pool");
+            session_pool_enabled_ = false;
+            return;
+        }
+
+        session_pool_.push_back(*sess);
+    }
 }
 
 void Receiver::update_sessions_() {
+    // the timestamp may wrap, so the wheel runs on an accumulated 64-bit
+    // sample counter instead
+    timer_samples_ +=
+        (packet::timestamp_t)packet::timestamp_diff(timestamp_, timer_pos_);
+    timer_pos_ = timestamp_;
+
+    session_timers_.advance(timer_samples_);
+
+    while (core::TimerWheel::Timer* timer = session_timers_.next_expired()) {
+        ReceiverSession* sess = (ReceiverSession*)timer->data();
+
+        if (!sess->check_timer(timestamp_)) {
+            remove_session_(*sess);
+        }
+    }
+
     core::SharedPtr<ReceiverSession> curr, next;
 
     for (curr = sessions_.front(); curr; curr = next) {
         next = sessions_.nextof(*curr);
 
-        if (!curr->update(timestamp_)) {
+        const bool was_hibernating = curr->hibernating();
+
+        if (!curr->update(timestamp_, cycle_time_)) {
             remove_session_(*curr);
+            continue;
+        }
+
+        // park or resume the session; hibernating sessions are detached
+        // from the mixer, so their chains are not walked just to mix zeros
+        if (!config_.common.unmixed && curr->hibernating() != was_hibernating) {
+            if (curr->hibernating()) {
+                mixer_->remove(curr->reader());
+            } else {
+                mixer_->add(curr->reader());
+            }
+        }
+    }
+
+    if (shared_resampler_ && !resampler_bypassed_) {
+        update_shared_scaling_();
+    }
+}
+
+void Receiver::update_shared_scaling_() {
+    size_t input_rate = 0;
+
+    float coeff_sum = 0;
+    float coeff_min = 0;
+    float coeff_max = 0;
+    size_t coeff_count = 0;
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        if (sess->hibernating()) {
+            continue;
+        }
+
+        if (input_rate == 0) {
+            input_rate = sess->sample_rate();
+        } else if (sess->sample_rate() != input_rate) {
+            if (shared_scaling_limiter_.allow(cycle_time_)) {
+                roc_log(LogError,
+                        "receiver: session rate %lu differs from the mixed rate %lu,"
+                        " shared resampling can't serve it",
+                        (unsigned long)sess->sample_rate(), (unsigned long)input_rate);
+            }
+            continue;
+        }
+
+        const float coeff = sess->freq_coeff();
+
+        if (coeff_count == 0) {
+            coeff_min = coeff_max = coeff;
+        } else {
+            if (coeff < coeff_min) {
+                coeff_min = coeff;
+            }
+            if (coeff > coeff_max) {
+                coeff_max = coeff;
+            }
+        }
+        coeff_sum += coeff;
+        coeff_count++;
+    }
+
+    if (input_rate == 0 || coeff_count == 0) {
+        return;
+    }
+
+    if (coeff_max - coeff_min > SharedScalingDivergence
+        && shared_scaling_limiter_.allow(cycle_time_)) {
+        roc_log(LogInfo,
+                "receiver: session drift estimates diverge: min=%.6f max=%.6f,"
+                " shared resampling corrects only their average",
+                (double)coeff_min, (double)coeff_max);
+    }
+
+    float coeff = coeff_sum / coeff_count;
+
+    const float max_delta = config_.default_session.latency_monitor.max_scaling_delta;
+    if (coeff < 1.0f - max_delta) {
+        coeff = 1.0f - max_delta;
+    } else if (coeff > 1.0f + max_delta) {
+        coeff = 1.0f + max_delta;
+    }
+
+    const float scaling =
+        (float)input_rate / config_.common.output_sample_rate * coeff;
+
+    if (!shared_resampler_->set_scaling(scaling)) {
+        if (shared_scaling_limiter_.allow(cycle_time_)) {
+            roc_log(LogError, "receiver: shared scaling out of bounds: scaling=%.5f",
+                    (double)scaling);
+        }
+    }
+}
+
+void Receiver::update_governor_(core::nanoseconds_t busy_time, size_t frame_size) {
+    const core::nanoseconds_t frame_period = (core::nanoseconds_t)(
+        frame_size / num_channels_) * core::Second / config_.common.output_sample_rate;
+
+    if (governor_->update(busy_time, frame_period)) {
+        apply_governor_();
+    }
+}
+
+void Receiver::apply_governor_() {
+    core::Mutex::Lock lock(control_mutex_);
+
+    const bool repair = governor_->allow_fec_repair();
+
+    core::SharedPtr<ReceiverSession> sess;
+
+    for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+        sess->set_fec_repair(repair);
+    }
+
+    // bypassing the resampler is only safe when the conversion is
+    // drift-only, i.e. every active session already runs at the output
+    // rate; otherwise the resampler keeps running even at this level
+    bool bypass = false;
+
+    if (shared_resampler_ && !governor_->allow_resampling()) {
+        bypass = true;
+
+        for (sess = sessions_.front(); sess; sess = sessions_.nextof(*sess)) {
+            if (!sess->hibernating()
+                && sess->sample_rate() != config_.common.output_sample_rate) {
+                bypass = false;
+                break;
+            }
         }
     }
+
+    if (bypass != resampler_bypassed_) {
+        roc_log(LogInfo, "receiver: %s shared resampler",
+                bypass ? "bypassing" : "restoring");
+        resampler_bypassed_ = bypass;
+    }
 }
 
 ReceiverSessionConfig
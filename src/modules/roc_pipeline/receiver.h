@@ -14,19 +14,28 @@
 
 #include "roc_audio/ireader.h"
 #include "roc_audio/mixer.h"
-#include "roc_audio/poison_reader.h"
+#include "roc_audio/resampler_reader.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/cond.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list.h"
+#include "roc_core/metrics_registry.h"
 #include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/slice.h"
+#include "roc_core/thread_pool.h"
+#include "roc_core/time.h"
+#include "roc_core/timer_wheel.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_fec/codec_map.h"
 #include "roc_packet/ireader.h"
 #include "roc_packet/iwriter.h"
 #include "roc_packet/packet_pool.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/debug_stages.h"
+#include "roc_pipeline/quality_governor.h"
 #include "roc_pipeline/receiver_port.h"
 #include "roc_pipeline/receiver_session.h"
 #include "roc_rtp/format_map.h"
@@ -61,6 +70,24 @@ public:
     //! Get number of alive sessions.
     size_t num_sessions() const;
 
+    //! Set activity callback.
+    //! @remarks
+    //!  The callback is invoked with the given argument whenever the
+    //!  receiver becomes active, i.e. a packet arrives while there were
+    //!  no sessions and no queued packets. It is called from the thread
+    //!  that delivered the packet, typically the network thread, and so
+    //!  should not block; it is meant to wake up the thread that reads
+    //!  frames from multiple inactive receivers.
+    void set_ready_callback(void (*fn)(void* arg), void* arg);
+
+    //! Get receiver statistics.
+    //! @remarks
+    //!  Aggregated over the currently connected sessions. Cheap enough to
+    //!  poll frequently: it only walks the session list; the counters are
+    //!  read without stopping the pipeline, so values from a session that
+    //!  is decoding right now may be slightly stale.
+    void get_stats(ReceiverStats& stats) const;
+
     //! Get current receiver state.
     virtual State state() const;
 
@@ -79,9 +106,37 @@ public:
     //! Read frame.
     virtual bool read(audio::Frame&);
 
+    //! Read several frames at once.
+    //! @remarks
+    //!  Reads @p n_frames frames, where the n-th frame is described by the
+    //!  @p frame_data and @p frame_sizes arrays, acquiring the pipeline
+    //!  lock only once for the whole batch.
+    bool read_batch(audio::sample_t* const* frame_data,
+                    const size_t* frame_sizes,
+                    size_t n_frames);
+
+    //! Read one frame from each session, without mixing.
+    //! @remarks
+    //!  May be used instead of read() when unmixed mode is enabled (see
+    //!  ReceiverCommonConfig::unmixed). Runs one pipeline cycle and fills
+    //!  up to @p n_frames equally sized frames, one per connected session,
+    //!  in session creation order. If @p session_addrs is non-NULL, its
+    //!  n-th element is set to the address of the sender the n-th frame
+    //!  came from. Hibernating sessions are skipped; sessions that don't
+    //!  fit into @p n_frames still advance, with their samples dropped.
+    //! @returns
+    //!  the number of frames actually filled.
+    size_t read_sessions(audio::sample_t* const* frame_data,
+                         const size_t* frame_sizes,
+                         size_t n_frames,
+                         packet::Address* session_addrs = NULL);
+
 private:
     State state_() const;
 
+    void read_frame_(audio::Frame& frame);
+    void discard_stream_(audio::IReader& reader, size_t frame_size);
+
     void prepare_();
 
     void fetch_packets_();
@@ -94,7 +149,16 @@ private:
     bool create_session_(const packet::PacketPtr& packet);
     void remove_session_(ReceiverSession& sess);
 
+    core::SharedPtr<ReceiverSession>
+    take_pooled_session_(const ReceiverSessionConfig& sess_config);
+
+    void refill_session_pool_();
+
     void update_sessions_();
+    void update_shared_scaling_();
+
+    void update_governor_(core::nanoseconds_t busy_time, size_t frame_size);
+    void apply_governor_();
 
     ReceiverSessionConfig make_session_config_(const packet::PacketPtr& packet) const;
 
@@ -107,22 +171,70 @@ private:
     core::IAllocator& allocator_;
 
     core::List<ReceiverPort> ports_;
+
+    // Session timeout deadlines (blank and hibernation) are scheduled here
+    // instead of being polled per session on every cycle; the wheel runs on
+    // the sample clock and is advanced once per cycle in update_sessions_().
+    // The sample counter is 64-bit so the wheel survives timestamp_
+    // wraparound.
+    // Declared before the session lists, so that the sessions, whose timers
+    // are registered in the wheel, are destroyed first.
+    core::TimerWheel session_timers_;
+    packet::timestamp_t timer_pos_;
+    uint64_t timer_samples_;
+
     core::List<ReceiverSession> sessions_;
 
+    // Pre-constructed sessions waiting to be bound to a sender. The pool is
+    // refilled after a frame is read, when there is slack until the next
+    // frame deadline, so that session construction doesn't delay the output.
+    core::List<ReceiverSession> session_pool_;
+    bool session_pool_enabled_;
+
     core::List<packet::Packet> packets_;
 
     core::Ticker ticker_;
 
+    core::UniquePtr<core::ThreadPool> worker_pool_;
+
     core::UniquePtr<audio::Mixer> mixer_;
+
+    // Post-mix resampler shared by all sessions; sessions are then built
+    // without private resamplers and only feed it their drift estimates.
+    core::UniquePtr<audio::ResamplerReader> shared_resampler_;
+    core::RateLimiter shared_scaling_limiter_;
+
+    // Overload governor (see ReceiverCommonConfig::quality_governor).
+    // While resampler_bypassed_ is set, frames are read directly from
+    // the mixer instead of the full chain.
+    core::UniquePtr<QualityGovernor> governor_;
+    bool resampler_bypassed_;
+
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonReader> poisoner_;
+#endif
 
     audio::IReader* audio_reader_;
 
+    // scratch frame used in unmixed mode for decoding-and-dropping the
+    // streams that don't fit into the caller's buffers
+    core::Slice<audio::sample_t> discard_frame_;
+
     ReceiverConfig config_;
 
     packet::timestamp_t timestamp_;
     size_t num_channels_;
 
+    // clock value sampled once per read cycle and shared by all per-frame
+    // consumers, so that they agree on "now" and don't repeat the clock call
+    core::nanoseconds_t cycle_time_;
+
+    // Exported session counter, shared by all receivers.
+    core::Atomic* metrics_sessions_;
+
+    void (*ready_fn_)(void*);
+    void* ready_arg_;
+
     core::Mutex control_mutex_;
     core::Mutex pipeline_mutex_;
     core::Cond active_cond_;
@@ -28,6 +28,8 @@ ReceiverPort::ReceiverPort(const PortConfig& config,
     case Proto_RTP:
     case Proto_RTP_LDPC_Source:
     case Proto_RTP_RSm8_Source:
+    case Proto_RTP_XOR_Source:
+    case Proto_RTP_RLC_Source:
         rtp_parser_.reset(new (allocator) rtp::Parser(format_map, NULL), allocator);
         if (!rtp_parser_) {
             return;
@@ -77,6 +79,46 @@ ReceiverPort::ReceiverPort(const PortConfig& config,
         }
         parser = fec_parser_.get();
         break;
+    case Proto_RTP_XOR_Source:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::XOR_PayloadID, fec::Source, fec::Footer>(parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
+    case Proto_XOR_Repair:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::XOR_PayloadID, fec::Repair, fec::Header>(parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
+    case Proto_RTP_RLC_Source:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::RLC_PayloadID, fec::Source, fec::Footer>(parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
+    case Proto_RLC_Repair:
+        fec_parser_.reset(
+            new (allocator)
+                fec::Parser<fec::RLC_PayloadID, fec::Repair, fec::Header>(parser),
+            allocator);
+        if (!fec_parser_) {
+            return;
+        }
+        parser = fec_parser_.get();
+        break;
     }
 
     parser_ = parser;
@@ -111,6 +153,17 @@ bool ReceiverPort::handle(packet::Packet& packet) {
         return false;
     }
 
+    // The parser chain has just walked the packet headers and filled the packet
+    // flags, so the route classification is completed in the same pass. A packet
+    // that got neither the audio nor the repair flag (e.g. an RTP packet with an
+    // unknown payload type) can't be routed by any session, so it is dropped
+    // right here, instead of being offered to every session in the list and
+    // triggering a doomed session creation attempt.
+    if (!(packet.flags() & (packet::Packet::FlagAudio | packet::Packet::FlagRepair))) {
+        roc_log(LogDebug, "receiver port: dropping unroutable packet");
+        return false;
+    }
+
     return true;
 }
 
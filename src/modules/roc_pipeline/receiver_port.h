@@ -41,6 +41,9 @@ public:
     const PortConfig& config() const;
 
     //! Try to handle packet on this port.
+    //! @remarks
+    //!  Performs parsing, sanity checking, and route classification in a
+    //!  single pass over the packet headers.
     //! @returns
     //!  true if the packet is dedicated for this port
     bool handle(packet::Packet& packet);
@@ -9,10 +9,26 @@
 #include "roc_pipeline/receiver_session.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_packet/address_to_str.h"
 
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// With FEC, a late source packet may still help the block decoder recover
+// not-yet-played packets from its block, so it's kept until the whole block
+// is provably in the past; the guard is measured in packet durations and
+// covers the largest block sizes used in practice.
+const packet::timestamp_t LateTriageFecGuardPackets = 64;
+
+// Unused per-cycle ingest budget is carried over up to this many cycles,
+// so that a short burst after a network hiccup is not mistaken for a
+// flooding sender.
+const size_t IngestBurstCycles = 4;
+
+} // namespace
+
 ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
                                  const ReceiverCommonConfig& common_config,
                                  const packet::Address& src_address,
@@ -24,25 +40,91 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
                                  core::IAllocator& allocator)
     : src_address_(src_address)
     , allocator_(allocator)
-    , audio_reader_(NULL) {
+    , hibernation_frames_(session_config.hibernation_frames)
+    , max_hibernation_duration_((packet::timestamp_t)packet::timestamp_from_ns(
+          session_config.watchdog.no_playback_timeout,
+          common_config.output_sample_rate))
+    , late_triage_(session_config.late_packet_triage)
+    , multipath_(session_config.multipath)
+    , max_packets_per_cycle_(session_config.max_packets_per_cycle)
+    , max_queued_bytes_(session_config.max_queued_bytes)
+    , timer_wheel_(NULL)
+    , hibernating_(false)
+    , has_new_packets_(false)
+    , blank_start_time_(0)
+    , late_dropped_packets_(0)
+    , ingest_tokens_(session_config.max_packets_per_cycle)
+    , overflow_dropped_packets_(0)
+    , overflow_logged_(false)
+    , sample_rate_(0)
+    , audio_reader_(NULL)
+    , packet_writer_(NULL) {
     const rtp::Format* format = format_map.format(session_config.payload_type);
     if (!format) {
         return;
     }
 
+    sample_rate_ = format->sample_rate;
+
+    if (session_config.passthrough && common_config.resampling) {
+        roc_log(LogError,
+                "receiver session: passthrough requires resampling"
+                " to be disabled");
+        return;
+    }
+
+    // with shared resampling the session runs at the native packet rate
+    // end-to-end and the rate conversion happens in the post-mix resampler
+    const bool private_resampling =
+        common_config.resampling && !common_config.shared_resampling;
+
     queue_router_.reset(new (allocator_) packet::Router(allocator_, 2), allocator_);
     if (!queue_router_ || !queue_router_->valid()) {
         return;
     }
+    packet_writer_ = queue_router_.get();
+
+    if (session_config.private_packet_pool) {
+        session_packet_pool_.reset(
+            new (allocator_) packet::PacketPool(allocator_, false), allocator_);
+        if (!session_packet_pool_) {
+            return;
+        }
+    }
+
+    // without compaction the private arena still needs the packets to
+    // pass through the compactor, so full-size per-session buffers are
+    // used in place of the compact ones
+    const size_t compact_buffer_size = session_config.compact_payload_size != 0
+        ? session_config.compact_payload_size
+        : (session_packet_pool_ ? byte_buffer_pool.buffer_size() : 0);
+
+    if (compact_buffer_size != 0) {
+        compact_buffer_pool_.reset(new (allocator_) core::BufferPool<uint8_t>(
+                                       allocator_, compact_buffer_size, false),
+                                   allocator_);
+        if (!compact_buffer_pool_) {
+            return;
+        }
+
+        payload_compactor_.reset(
+            new (allocator_) packet::PayloadCompactor(
+                *packet_writer_, *compact_buffer_pool_, session_packet_pool_.get()),
+            allocator_);
+        if (!payload_compactor_) {
+            return;
+        }
+        packet_writer_ = payload_compactor_.get();
+    }
 
-    source_queue_.reset(new (allocator_) packet::SortedQueue(0), allocator_);
+    source_queue_.reset(new (allocator_) packet::SortedQueue(0, allocator_), allocator_);
     if (!source_queue_) {
         return;
     }
 
     packet::IWriter* pwriter = source_queue_.get();
 
-    if (!queue_router_->add_route(*pwriter, packet::Packet::FlagAudio)) {
+    if (!queue_router_->add_route(*pwriter, packet::Packet::FlagAudio, multipath_)) {
         return;
     }
 
@@ -66,11 +148,13 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
     preader = validator_.get();
 
     if (session_config.fec_decoder.scheme != packet::FEC_None) {
-        repair_queue_.reset(new (allocator_) packet::SortedQueue(0), allocator_);
+        repair_queue_.reset(new (allocator_) packet::SortedQueue(0, allocator_),
+                            allocator_);
         if (!repair_queue_) {
             return;
         }
-        if (!queue_router_->add_route(*repair_queue_, packet::Packet::FlagRepair)) {
+        if (!queue_router_->add_route(*repair_queue_, packet::Packet::FlagRepair,
+                                      multipath_)) {
             return;
         }
 
@@ -89,7 +173,9 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         fec_reader_.reset(new (allocator_) fec::Reader(
                               session_config.fec_reader,
                               session_config.fec_decoder.scheme, *fec_decoder_, *preader,
-                              *repair_queue_, *fec_parser_, packet_pool, allocator_),
+                              *repair_queue_, *fec_parser_,
+                              session_packet_pool_ ? *session_packet_pool_ : packet_pool,
+                              allocator_),
                           allocator_);
         if (!fec_reader_ || !fec_reader_->valid()) {
             return;
@@ -106,6 +192,17 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         preader = fec_validator_.get();
     }
 
+    if (session_config.redundant_encoding) {
+        redundancy_reader_.reset(
+            new (allocator_) rtp::RedundancyReader(
+                *preader, session_packet_pool_ ? *session_packet_pool_ : packet_pool),
+            allocator_);
+        if (!redundancy_reader_) {
+            return;
+        }
+        preader = redundancy_reader_.get();
+    }
+
     payload_decoder_.reset(format->new_decoder(allocator_), allocator_);
     if (!payload_decoder_) {
         return;
@@ -135,7 +232,22 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         areader = watchdog_.get();
     }
 
-    if (common_config.resampling) {
+    if (!private_resampling && !common_config.poisoning && !common_config.profiling) {
+        // the chain shape is known at build time: fuse the depacketizer
+        // and watchdog into a single stage driven with non-virtual calls,
+        // so the compiler can inline across them
+        fused_reader_.reset(
+            new (allocator_) audio::FusedReader<audio::Depacketizer, audio::Watchdog>(
+                *depacketizer_, watchdog_.get()),
+            allocator_);
+        if (!fused_reader_) {
+            return;
+        }
+        areader = fused_reader_.get();
+    }
+
+    if (private_resampling) {
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
         if (common_config.poisoning) {
             resampler_poisoner_.reset(new (allocator_) audio::PoisonReader(*areader),
                                       allocator_);
@@ -144,6 +256,7 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
             }
             areader = resampler_poisoner_.get();
         }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
         resampler_.reset(new (allocator_) audio::ResamplerReader(
                              *areader, sample_buffer_pool, allocator,
                              session_config.resampler, session_config.channels,
@@ -155,6 +268,7 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         areader = resampler_.get();
     }
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     if (common_config.poisoning) {
         session_poisoner_.reset(new (allocator_) audio::PoisonReader(*areader),
                                 allocator_);
@@ -163,21 +277,53 @@ ReceiverSession::ReceiverSession(const ReceiverSessionConfig& session_config,
         }
         areader = session_poisoner_.get();
     }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
+
+    audio::LatencyMonitorConfig monitor_config = session_config.latency_monitor;
+    size_t monitor_output_rate = common_config.output_sample_rate;
+
+    if (session_config.passthrough) {
+        // no resampler to absorb clock drift; compensate it with
+        // packet-level slips and keep the samples bit-exact in between
+        monitor_config.slip_compensation = true;
+    }
+
+    if (common_config.resampling && common_config.shared_resampling) {
+        // the monitor doesn't own a resampler, but keeps estimating the
+        // drift so that the shared post-mix resampler can consume it
+        monitor_config.standalone_estimator = true;
+        monitor_output_rate = format->sample_rate;
+    }
 
     latency_monitor_.reset(new (allocator_) audio::LatencyMonitor(
                                *source_queue_, *depacketizer_, resampler_.get(),
-                               session_config.latency_monitor,
-                               session_config.target_latency, format->sample_rate,
-                               common_config.output_sample_rate),
+                               monitor_config, session_config.target_latency,
+                               format->sample_rate, monitor_output_rate),
                            allocator_);
     if (!latency_monitor_ || !latency_monitor_->valid()) {
         return;
     }
 
+    if (common_config.profiling) {
+        profiling_reader_.reset(new (allocator_) audio::ProfilingReader(*areader),
+                                allocator_);
+        if (!profiling_reader_) {
+            return;
+        }
+        areader = profiling_reader_.get();
+    }
+
     audio_reader_ = areader;
 }
 
 void ReceiverSession::destroy() {
+    detach_timer();
+
+    if (profiling_reader_) {
+        roc_log(LogInfo, "session: consumed %lld ms of pipeline cpu time",
+                (long long)(profiling_reader_->cpu_time() / core::Millisecond));
+    }
+
     allocator_.destroy(*this);
 }
 
@@ -185,6 +331,12 @@ bool ReceiverSession::valid() const {
     return audio_reader_;
 }
 
+void ReceiverSession::rebind(const packet::Address& src_address) {
+    roc_panic_if(!valid());
+
+    src_address_ = src_address;
+}
+
 bool ReceiverSession::handle(const packet::PacketPtr& packet) {
     roc_panic_if(!valid());
 
@@ -194,24 +346,147 @@ bool ReceiverSession::handle(const packet::PacketPtr& packet) {
     }
 
     if (udp->src_addr != src_address_) {
-        return false;
+        // with multipath bonding the same stream arrives from several sender
+        // addresses; match the packet to the session by its stream id instead
+        if (!multipath_) {
+            return false;
+        }
+
+        const packet::RTP* rtp = packet->rtp();
+        if (!rtp || !queue_router_->has_source(rtp->source)) {
+            return false;
+        }
     }
 
-    queue_router_->write(packet);
+    // a packet whose samples are entirely behind the playback position
+    // would be dropped by the depacketizer anyway; dropping it here saves
+    // the queue insert and the walk through the FEC reader
+    if (late_triage_ && !hibernating_ && depacketizer_->started()
+        && (packet->flags() & packet::Packet::FlagAudio)) {
+        if (const packet::RTP* rtp = packet->rtp()) {
+            const packet::timestamp_t pkt_end = rtp->timestamp + rtp->duration;
+            const packet::timestamp_diff_t guard = fec_reader_
+                ? (packet::timestamp_diff_t)(rtp->duration * LateTriageFecGuardPackets)
+                : 0;
+
+            if (packet::timestamp_diff(depacketizer_->timestamp(), pkt_end) >= guard) {
+                roc_log(LogDebug,
+                        "session: dropping late packet at ingest: ts=%lu pkt_ts=%lu",
+                        (unsigned long)depacketizer_->timestamp(),
+                        (unsigned long)rtp->timestamp);
+                late_dropped_packets_++;
+                return true;
+            }
+        }
+    }
+
+    // the packet belongs to this session; check it against the session
+    // ingest budget, so that a sender flooding packets degrades its own
+    // session instead of the whole receiver
+    if (max_packets_per_cycle_ != 0) {
+        if (ingest_tokens_ == 0) {
+            if (!overflow_logged_) {
+                roc_log(LogDebug,
+                        "session: ingest budget exhausted, dropping packets:"
+                        " src_addr=%s budget=%lu",
+                        packet::address_to_str(src_address_).c_str(),
+                        (unsigned long)max_packets_per_cycle_);
+                overflow_logged_ = true;
+            }
+            overflow_dropped_packets_++;
+            return true;
+        }
+        ingest_tokens_--;
+    }
+
+    if (max_queued_bytes_ != 0) {
+        size_t queued_bytes = source_queue_->byte_size();
+        if (repair_queue_) {
+            queued_bytes += repair_queue_->byte_size();
+        }
+
+        if (queued_bytes + packet->data().size() > max_queued_bytes_) {
+            if (!overflow_logged_) {
+                roc_log(LogDebug,
+                        "session: queued bytes limit reached, dropping packets:"
+                        " src_addr=%s queued=%lu limit=%lu",
+                        packet::address_to_str(src_address_).c_str(),
+                        (unsigned long)queued_bytes,
+                        (unsigned long)max_queued_bytes_);
+                overflow_logged_ = true;
+            }
+            overflow_dropped_packets_++;
+            return true;
+        }
+    }
+
+    packet_writer_->write(packet);
+    has_new_packets_ = true;
+
     return true;
 }
 
-bool ReceiverSession::update(packet::timestamp_t time) {
+bool ReceiverSession::update(packet::timestamp_t time, core::nanoseconds_t cycle_time) {
     roc_panic_if(!valid());
 
+    if (max_packets_per_cycle_ != 0) {
+        ingest_tokens_ += max_packets_per_cycle_;
+        if (ingest_tokens_ > max_packets_per_cycle_ * IngestBurstCycles) {
+            ingest_tokens_ = max_packets_per_cycle_ * IngestBurstCycles;
+        }
+    }
+    overflow_logged_ = false;
+
+    if (has_new_packets_) {
+        has_new_packets_ = false;
+
+        if (hibernating_) {
+            roc_log(LogDebug, "session: resuming hibernating session: src_addr=%s",
+                    packet::address_to_str(src_address_).c_str());
+            hibernating_ = false;
+        }
+    } else if (!hibernating_ && hibernation_frames_ != 0
+               && depacketizer_->n_blank_frames() >= hibernation_frames_) {
+        roc_log(LogDebug, "session: hibernating idle session: src_addr=%s",
+                packet::address_to_str(src_address_).c_str());
+        hibernating_ = true;
+    }
+
+    if (!hibernating_ && depacketizer_->n_blank_frames() == 0) {
+        blank_start_time_ = time;
+    }
+
+    if (hibernating_) {
+        // while hibernating the chain is not read and the watchdog can't
+        // observe time passing, so dead sessions are timed out here; the
+        // timeout is counted from the moment the stream became blank to
+        // keep the same deadline the watchdog would have
+        if (!timer_wheel_ && max_hibernation_duration_ != 0
+            && (packet::timestamp_t)packet::timestamp_diff(time, blank_start_time_)
+                >= max_hibernation_duration_) {
+            roc_log(LogDebug, "session: terminating hibernating session: src_addr=%s",
+                    packet::address_to_str(src_address_).c_str());
+            return false;
+        }
+
+        return true;
+    }
+
     if (watchdog_) {
-        if (!watchdog_->update()) {
+        if (timer_wheel_) {
+            // the blank deadline is scheduled in the timer wheel and
+            // evaluated in check_timer(); only the drops death, which
+            // is detected during the frame read itself, is polled here
+            if (!watchdog_->alive()) {
+                return false;
+            }
+        } else if (!watchdog_->update()) {
             return false;
         }
     }
 
     if (latency_monitor_) {
-        if (!latency_monitor_->update(time)) {
+        if (!latency_monitor_->update(time, cycle_time)) {
             return false;
         }
     }
@@ -219,11 +494,142 @@ bool ReceiverSession::update(packet::timestamp_t time) {
     return true;
 }
 
+void ReceiverSession::attach_timer(core::TimerWheel& wheel) {
+    roc_panic_if(!valid());
+    roc_panic_if(timer_wheel_);
+
+    timer_wheel_ = &wheel;
+    timer_.set_data(this);
+
+    if (watchdog_) {
+        const packet::timestamp_t remaining = watchdog_->blank_timeout_remaining();
+        if (remaining != 0) {
+            arm_timer_(remaining);
+        }
+    }
+}
+
+void ReceiverSession::detach_timer() {
+    if (!timer_wheel_) {
+        return;
+    }
+
+    timer_wheel_->cancel(timer_);
+    timer_wheel_ = NULL;
+}
+
+bool ReceiverSession::check_timer(packet::timestamp_t time) {
+    roc_panic_if(!valid());
+    roc_panic_if(!timer_wheel_);
+
+    packet::timestamp_t remaining = 0;
+
+    if (hibernating_) {
+        const packet::timestamp_t elapsed =
+            (packet::timestamp_t)packet::timestamp_diff(time, blank_start_time_);
+
+        if (max_hibernation_duration_ != 0) {
+            if (elapsed >= max_hibernation_duration_) {
+                roc_log(LogDebug,
+                        "session: terminating hibernating session: src_addr=%s",
+                        packet::address_to_str(src_address_).c_str());
+                return false;
+            }
+            remaining = max_hibernation_duration_ - elapsed;
+        }
+    } else if (watchdog_) {
+        if (!watchdog_->update()) {
+            return false;
+        }
+        remaining = watchdog_->blank_timeout_remaining();
+    }
+
+    if (remaining != 0) {
+        arm_timer_(remaining);
+    }
+
+    return true;
+}
+
+void ReceiverSession::arm_timer_(packet::timestamp_t remaining) {
+    timer_wheel_->schedule(timer_, timer_wheel_->time() + remaining);
+}
+
+bool ReceiverSession::hibernating() const {
+    roc_panic_if(!valid());
+
+    return hibernating_;
+}
+
 audio::IReader& ReceiverSession::reader() {
     roc_panic_if(!valid());
 
     return *audio_reader_;
 }
 
+const packet::Address& ReceiverSession::address() const {
+    return src_address_;
+}
+
+size_t ReceiverSession::sample_rate() const {
+    roc_panic_if(!valid());
+
+    return sample_rate_;
+}
+
+float ReceiverSession::freq_coeff() const {
+    roc_panic_if(!valid());
+
+    return latency_monitor_->freq_coeff();
+}
+
+void ReceiverSession::set_fec_repair(bool enabled) {
+    roc_panic_if(!valid());
+
+    if (fec_reader_) {
+        fec_reader_->set_repair_enabled(enabled);
+    }
+}
+
+void ReceiverSession::add_stats(ReceiverStats& stats) const {
+    roc_panic_if(!valid());
+
+    stats.num_sessions++;
+
+    packet::timestamp_diff_t latency = 0;
+    if (latency_monitor_->get_latency(latency) && latency > 0) {
+        if ((packet::timestamp_t)latency > stats.niq_latency) {
+            stats.niq_latency = (packet::timestamp_t)latency;
+        }
+    }
+
+    if (fec_reader_) {
+        const fec::LossMetrics metrics = fec_reader_->loss_metrics();
+        stats.lost_packets += metrics.n_lost_packets;
+        stats.recovered_packets += metrics.n_recovered_packets;
+    }
+
+    if (redundancy_reader_) {
+        stats.recovered_packets += redundancy_reader_->n_restored();
+    }
+
+    stats.missing_samples += (size_t)depacketizer_->n_missing_samples();
+    stats.late_packets += late_dropped_packets_;
+    stats.overflow_packets += overflow_dropped_packets_;
+
+    if (resampler_) {
+        stats.scaling_sum += latency_monitor_->freq_coeff();
+        stats.scaling_count++;
+    }
+
+    if (profiling_reader_) {
+        const core::nanoseconds_t cpu_time = profiling_reader_->cpu_time();
+        stats.cpu_time_sum += cpu_time;
+        if (cpu_time > stats.cpu_time_max) {
+            stats.cpu_time_max = cpu_time;
+        }
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
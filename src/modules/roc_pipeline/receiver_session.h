@@ -13,16 +13,18 @@
 #define ROC_PIPELINE_RECEIVER_SESSION_H_
 
 #include "roc_audio/depacketizer.h"
+#include "roc_audio/fused_reader.h"
 #include "roc_audio/iframe_decoder.h"
 #include "roc_audio/ireader.h"
 #include "roc_audio/latency_monitor.h"
-#include "roc_audio/poison_reader.h"
+#include "roc_audio/profiling_reader.h"
 #include "roc_audio/resampler_reader.h"
 #include "roc_audio/watchdog.h"
 #include "roc_core/buffer_pool.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/list_node.h"
 #include "roc_core/refcnt.h"
+#include "roc_core/timer_wheel.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_fec/codec_map.h"
 #include "roc_fec/iblock_decoder.h"
@@ -33,11 +35,15 @@
 #include "roc_packet/ireader.h"
 #include "roc_packet/packet.h"
 #include "roc_packet/packet_pool.h"
+#include "roc_packet/payload_compactor.h"
 #include "roc_packet/router.h"
 #include "roc_packet/sorted_queue.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/debug_stages.h"
+#include "roc_pipeline/stats.h"
 #include "roc_rtp/format_map.h"
 #include "roc_rtp/parser.h"
+#include "roc_rtp/redundancy_reader.h"
 #include "roc_rtp/validator.h"
 
 namespace roc {
@@ -62,32 +68,125 @@ public:
     //! Check if the session pipeline was succefully constructed.
     bool valid() const;
 
+    //! Rebind session to a new sender address.
+    //! @remarks
+    //!  Used for pre-constructed sessions that are bound to a sender
+    //!  when it appears. Should be called before the session received
+    //!  any packets.
+    void rebind(const packet::Address& src_address);
+
     //! Try to route a packet to this session.
     //! @returns
     //!  true if the packet is dedicated for this session
     bool handle(const packet::PacketPtr& packet);
 
     //! Update session.
+    //! @remarks
+    //!  @p cycle_time is the clock value sampled once by the driving
+    //!  caller for this pipeline cycle, or zero if it wasn't sampled.
+    //! @returns
+    //!  false if the session is terminated
+    bool update(packet::timestamp_t time, core::nanoseconds_t cycle_time = 0);
+
+    //! Attach session timeouts to a timer wheel.
+    //! @remarks
+    //!  The blank and hibernation deadlines are scheduled into @p wheel
+    //!  instead of being polled inside every update() call; the wheel is
+    //!  expected to run on the stream sample clock. The session stays
+    //!  attached until detach_timer() or destruction.
+    void attach_timer(core::TimerWheel& wheel);
+
+    //! Cancel the scheduled deadline and detach from the timer wheel.
+    void detach_timer();
+
+    //! Evaluate the session timeouts after the scheduled deadline fired.
+    //! @remarks
+    //!  Re-schedules the next deadline if the session survived.
     //! @returns
     //!  false if the session is terminated
-    bool update(packet::timestamp_t time);
+    bool check_timer(packet::timestamp_t time);
+
+    //! Check if the session is hibernating.
+    //! @remarks
+    //!  The session hibernates after producing a number of consecutive
+    //!  blank frames and resumes when a new packet arrives. A hibernating
+    //!  session should be detached from the mixer, so that its chain is
+    //!  not walked just to produce zeros. State transitions happen only
+    //!  inside update().
+    bool hibernating() const;
 
     //! Get audio reader.
     audio::IReader& reader();
 
+    //! Get the address of the connected sender.
+    const packet::Address& address() const;
+
+    //! Get native sample rate of the session stream.
+    size_t sample_rate() const;
+
+    //! Get the drift estimate of the latency monitor.
+    //! @remarks
+    //!  Used to drive the shared post-mix resampler when sessions are
+    //!  built without private resamplers.
+    float freq_coeff() const;
+
+    //! Enable or disable FEC block repair at runtime.
+    //! @remarks
+    //!  No-op for sessions without FEC. Used by the receiver quality
+    //!  governor to shed FEC math under overload.
+    void set_fec_repair(bool enabled);
+
+    //! Add session statistics to @p stats.
+    void add_stats(ReceiverStats& stats) const;
+
 private:
     friend class core::RefCnt<ReceiverSession>;
 
     void destroy();
 
-    const packet::Address src_address_;
+    void arm_timer_(packet::timestamp_t remaining);
+
+    packet::Address src_address_;
 
     core::IAllocator& allocator_;
 
+    const size_t hibernation_frames_;
+    const packet::timestamp_t max_hibernation_duration_;
+    const bool late_triage_;
+    const bool multipath_;
+
+    // per-cycle ingest budget (see ReceiverSessionConfig); tokens are
+    // refilled in update() and consumed in handle()
+    const size_t max_packets_per_cycle_;
+    const size_t max_queued_bytes_;
+
+    // while attached to a wheel, the blank and hibernation deadlines are
+    // evaluated in check_timer() when the scheduled timer fires, instead
+    // of being re-checked inside every update()
+    core::TimerWheel* timer_wheel_;
+    core::TimerWheel::Timer timer_;
+
+    bool hibernating_;
+    bool has_new_packets_;
+    packet::timestamp_t blank_start_time_;
+    size_t late_dropped_packets_;
+    size_t ingest_tokens_;
+    size_t overflow_dropped_packets_;
+    bool overflow_logged_;
+    size_t sample_rate_;
+
     audio::IReader* audio_reader_;
+    packet::IWriter* packet_writer_;
 
     core::UniquePtr<packet::Router> queue_router_;
 
+    // private packet arena; declared before the queues and readers so
+    // that it outlives every packet drawn from it
+    core::UniquePtr<packet::PacketPool> session_packet_pool_;
+
+    core::UniquePtr<core::BufferPool<uint8_t> > compact_buffer_pool_;
+    core::UniquePtr<packet::PayloadCompactor> payload_compactor_;
+
     core::UniquePtr<packet::SortedQueue> source_queue_;
     core::UniquePtr<packet::SortedQueue> repair_queue_;
 
@@ -100,15 +199,28 @@ private:
     core::UniquePtr<fec::Reader> fec_reader_;
     core::UniquePtr<rtp::Validator> fec_validator_;
 
+    core::UniquePtr<rtp::RedundancyReader> redundancy_reader_;
+
     core::UniquePtr<audio::IFrameDecoder> payload_decoder_;
     core::UniquePtr<audio::Depacketizer> depacketizer_;
 
+    // compile-time composed depacketizer + watchdog chain, used instead
+    // of the stacked readers when the session shape allows it
+    core::UniquePtr<audio::FusedReader<audio::Depacketizer, audio::Watchdog> >
+        fused_reader_;
+
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonReader> resampler_poisoner_;
+#endif
     core::UniquePtr<audio::ResamplerReader> resampler_;
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonReader> session_poisoner_;
+#endif
 
     core::UniquePtr<audio::LatencyMonitor> latency_monitor_;
+
+    core::UniquePtr<audio::ProfilingReader> profiling_reader_;
 };
 
 } // namespace pipeline
@@ -15,6 +15,26 @@
 namespace roc {
 namespace pipeline {
 
+namespace {
+
+// The destination is declared dead after this many consecutive sends
+// failed with an unreachable error: low enough to stop wasting CPU and
+// bandwidth quickly, high enough that a stray ICMP doesn't interrupt
+// the stream.
+const long UnreachableSuspendThreshold = 16;
+
+// While suspended, one frame per this interval is still packetized and
+// sent, probing whether the path has returned; a probe that goes through
+// resets the error counter and resumes the stream.
+const core::nanoseconds_t UnreachableProbeInterval = 500 * core::Millisecond;
+
+// Transport overhead that shares the path MTU with the RTP payload:
+// IPv6, UDP, and RTP headers plus the FEC payload ID, rounded up.
+// Erring on the large side only leaves a few bytes of the MTU unused.
+const size_t PacketSizingOverhead = 80;
+
+} // namespace
+
 Sender::Sender(const SenderConfig& config,
                const PortConfig& source_port_config,
                packet::IWriter& source_writer,
@@ -28,8 +48,27 @@ Sender::Sender(const SenderConfig& config,
                core::IAllocator& allocator)
     : audio_writer_(NULL)
     , config_(config)
+    , source_port_config_(source_port_config)
+    , repair_port_config_(repair_port_config)
     , timestamp_(0)
-    , num_channels_(packet::num_channels(config.input_channels)) {
+    , num_channels_(packet::num_channels(config.input_channels))
+    , suspended_(false)
+    , next_probe_(0)
+    , suspended_frames_(0)
+    , max_payload_limit_(byte_buffer_pool.buffer_size() > PacketSizingOverhead
+                             ? byte_buffer_pool.buffer_size() - PacketSizingOverhead
+                             : 0)
+    , applied_path_mtu_(0)
+    , ring_frames_(allocator)
+    , ring_sizes_(allocator)
+    , ring_tail_(0)
+    , ring_size_(0)
+    , ring_dropped_(0)
+    , ring_cond_(ring_mutex_)
+    , stop_(0)
+    , started_(false)
+    , sample_buffer_pool_(sample_buffer_pool)
+    , allocator_(allocator) {
     roc_log(LogInfo, "sender: using remote source port %s",
             port_to_str(source_port_config).c_str());
     roc_log(LogInfo, "sender: using remote repair port %s",
@@ -52,8 +91,8 @@ Sender::Sender(const SenderConfig& config,
         }
     }
 
-    source_port_.reset(new (allocator)
-                           SenderPort(source_port_config, source_writer, allocator),
+    source_port_.reset(new (allocator) SenderPort(source_port_config, source_writer,
+                                                  packet_pool, allocator),
                        allocator);
     if (!source_port_ || !source_port_->valid()) {
         return;
@@ -70,8 +109,8 @@ Sender::Sender(const SenderConfig& config,
     }
 
     if (config.fec_encoder.scheme != packet::FEC_None) {
-        repair_port_.reset(new (allocator)
-                               SenderPort(repair_port_config, repair_writer, allocator),
+        repair_port_.reset(new (allocator) SenderPort(repair_port_config, repair_writer,
+                                                      packet_pool, allocator),
                            allocator);
         if (!repair_port_ || !repair_port_->valid()) {
             return;
@@ -112,6 +151,17 @@ Sender::Sender(const SenderConfig& config,
         pwriter = fec_writer_.get();
     }
 
+    if (config.redundant_encoding) {
+        redundancy_writer_.reset(new (allocator) rtp::RedundancyWriter(
+                                     *pwriter, source_port_->composer(), packet_pool,
+                                     byte_buffer_pool),
+                                 allocator);
+        if (!redundancy_writer_) {
+            return;
+        }
+        pwriter = redundancy_writer_.get();
+    }
+
     payload_encoder_.reset(format->new_encoder(allocator), allocator);
     if (!payload_encoder_) {
         return;
@@ -120,7 +170,9 @@ Sender::Sender(const SenderConfig& config,
     packetizer_.reset(new (allocator) audio::Packetizer(
                           *pwriter, source_port_->composer(), *payload_encoder_,
                           packet_pool, byte_buffer_pool, config.input_channels,
-                          config.packet_length, format->sample_rate, config.payload_type),
+                          config.packet_length, config.dtx_keepalive,
+                          format->sample_rate, config.payload_type,
+                          config.flush_deadline),
                       allocator);
     if (!packetizer_) {
         return;
@@ -129,6 +181,7 @@ Sender::Sender(const SenderConfig& config,
     audio::IWriter* awriter = packetizer_.get();
 
     if (config.resampling && config.input_sample_rate != format->sample_rate) {
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
         if (config.poisoning) {
             resampler_poisoner_.reset(new (allocator) audio::PoisonWriter(*awriter),
                                       allocator);
@@ -137,6 +190,7 @@ Sender::Sender(const SenderConfig& config,
             }
             awriter = resampler_poisoner_.get();
         }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
         resampler_.reset(new (allocator) audio::ResamplerWriter(
                              *awriter, sample_buffer_pool, allocator, config.resampler,
                              config.input_channels, config.internal_frame_size),
@@ -151,6 +205,7 @@ Sender::Sender(const SenderConfig& config,
         awriter = resampler_.get();
     }
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     if (config.poisoning) {
         pipeline_poisoner_.reset(new (allocator) audio::PoisonWriter(*awriter),
                                  allocator);
@@ -159,14 +214,150 @@ Sender::Sender(const SenderConfig& config,
         }
         awriter = pipeline_poisoner_.get();
     }
+#endif // !ROC_PIPELINE_DISABLE_DEBUG_STAGES
 
     audio_writer_ = awriter;
+
+    if (config.async_write) {
+        if (config.async_write_frames == 0
+            || sample_buffer_pool.buffer_size() < config.internal_frame_size) {
+            roc_log(LogError, "sender: bad async mode parameters");
+            audio_writer_ = NULL;
+            return;
+        }
+
+        if (!ring_frames_.resize(config.async_write_frames)
+            || !ring_sizes_.resize(config.async_write_frames)) {
+            audio_writer_ = NULL;
+            return;
+        }
+
+        for (size_t n = 0; n < config.async_write_frames; n++) {
+            ring_frames_[n] =
+                new (sample_buffer_pool) core::Buffer<audio::sample_t>(
+                    sample_buffer_pool);
+            if (!ring_frames_[n]) {
+                audio_writer_ = NULL;
+                return;
+            }
+            ring_frames_[n].resize(config.internal_frame_size);
+        }
+
+        core::ThreadConfig thread_config;
+        thread_config.name = "roc-sender";
+
+        if (!Thread::start(thread_config)) {
+            roc_log(LogError, "sender: can't start sender thread");
+            audio_writer_ = NULL;
+            return;
+        }
+        started_ = true;
+    }
+}
+
+Sender::~Sender() {
+    if (started_) {
+        stop_ = 1;
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+            ring_cond_.broadcast();
+        }
+
+        Thread::join();
+
+        if (ring_dropped_ != 0) {
+            roc_log(LogInfo, "sender: dropped %lu frames in async mode",
+                    (unsigned long)ring_dropped_);
+        }
+    }
 }
 
 bool Sender::valid() {
     return audio_writer_;
 }
 
+bool Sender::add_destination(const PortConfig& source_port,
+                             packet::IWriter& source_writer,
+                             const PortConfig& repair_port,
+                             packet::IWriter& repair_writer) {
+    roc_panic_if(!valid());
+
+    if (source_port.protocol != source_port_config_.protocol) {
+        roc_log(LogError,
+                "sender: destination source port %s doesn't match primary port %s",
+                port_to_str(source_port).c_str(),
+                port_to_str(source_port_config_).c_str());
+        return false;
+    }
+
+    if (repair_port_) {
+        if (repair_port.protocol != repair_port_config_.protocol) {
+            roc_log(LogError,
+                    "sender: destination repair port %s doesn't match primary port %s",
+                    port_to_str(repair_port).c_str(),
+                    port_to_str(repair_port_config_).c_str());
+            return false;
+        }
+    }
+
+    if (!source_port_->add_destination(source_port.address, source_writer)) {
+        return false;
+    }
+
+    if (repair_port_) {
+        if (!repair_port_->add_destination(repair_port.address, repair_writer)) {
+            return false;
+        }
+    }
+
+    roc_log(LogInfo, "sender: added destination source port %s",
+            port_to_str(source_port).c_str());
+    if (repair_port_) {
+        roc_log(LogInfo, "sender: added destination repair port %s",
+                port_to_str(repair_port).c_str());
+    }
+
+    return true;
+}
+
+audio::IWriter* Sender::add_input() {
+    roc_panic_if(!valid());
+
+    if (!input_mixer_) {
+        // buffering of a few frames per input absorbs the scheduling jitter
+        // between the threads that drive the inputs; an input further ahead
+        // than this has its oldest samples dropped
+        enum { MaxBufferedFrames = 8 };
+
+        input_mixer_.reset(new (allocator_) audio::MixerWriter(
+                               *this, sample_buffer_pool_, config_.internal_frame_size,
+                               config_.internal_frame_size * MaxBufferedFrames,
+                               allocator_),
+                           allocator_);
+        if (!input_mixer_ || !input_mixer_->valid()) {
+            roc_log(LogError, "sender: can't create input mixer");
+            input_mixer_.reset(NULL, allocator_);
+            return NULL;
+        }
+    }
+
+    return input_mixer_->create_input();
+}
+
+void Sender::get_stats(SenderStats& stats) const {
+    stats = SenderStats();
+
+    // the counters are updated from the writer thread without locking;
+    // occasionally stale values are fine for statistics
+    if (packetizer_) {
+        stats.num_packets = packetizer_->n_packets();
+        stats.num_samples = packetizer_->n_samples();
+    }
+
+    stats.suspended_frames = suspended_frames_;
+}
+
 size_t Sender::sample_rate() const {
     return config_.input_sample_rate;
 }
@@ -178,13 +369,162 @@ bool Sender::has_clock() const {
 void Sender::write(audio::Frame& frame) {
     roc_panic_if(!valid());
 
+    if (!started_) {
+        write_frame_(frame);
+        return;
+    }
+
+    // oversized frames are split, so that a ring slot always fits a chunk
+    for (size_t off = 0; off < frame.size(); off += config_.internal_frame_size) {
+        size_t chunk = frame.size() - off;
+        if (chunk > config_.internal_frame_size) {
+            chunk = config_.internal_frame_size;
+        }
+        push_frame_(frame.data() + off, chunk);
+    }
+}
+
+void Sender::write_frame_(audio::Frame& frame) {
     if (ticker_) {
         ticker_->wait(timestamp_);
     }
 
-    audio_writer_->write(frame);
+    if (config_.mtu_packet_sizing && config_.path_mtu) {
+        update_packet_sizing_();
+    }
+
+    if (backoff_allows_frame_(frame.cycle_time())) {
+        audio_writer_->write(frame);
+    } else {
+        suspended_frames_++;
+    }
     timestamp_ += frame.size() / num_channels_;
 }
 
+bool Sender::backoff_allows_frame_(core::nanoseconds_t now) {
+    if (!config_.dst_unreachable) {
+        return true;
+    }
+
+    const long n_errors = config_.dst_unreachable->load_relaxed();
+
+    if (!suspended_) {
+        if (n_errors < UnreachableSuspendThreshold) {
+            return true;
+        }
+
+        roc_log(LogInfo,
+                "sender: destination unreachable, suspending encoding:"
+                " probing every %ld ms",
+                (long)(UnreachableProbeInterval / core::Millisecond));
+
+        suspended_ = true;
+        next_probe_ = 0;
+    } else if (n_errors < UnreachableSuspendThreshold) {
+        // a probe went through and the network layer reset the counter
+        roc_log(LogInfo, "sender: destination reachable again, resuming encoding");
+
+        suspended_ = false;
+        return true;
+    }
+
+    if (now == 0) {
+        now = core::timestamp();
+    }
+
+    if (now >= next_probe_) {
+        next_probe_ = now + UnreachableProbeInterval;
+        return true;
+    }
+
+    return false;
+}
+
+void Sender::update_packet_sizing_() {
+    const long mtu = config_.path_mtu->load_relaxed();
+
+    if (mtu <= 0 || (size_t)mtu == applied_path_mtu_) {
+        return;
+    }
+    applied_path_mtu_ = (size_t)mtu;
+
+    if ((size_t)mtu <= PacketSizingOverhead) {
+        return;
+    }
+
+    size_t payload_limit = (size_t)mtu - PacketSizingOverhead;
+    if (max_payload_limit_ != 0 && payload_limit > max_payload_limit_) {
+        payload_limit = max_payload_limit_;
+    }
+
+    roc_log(LogInfo, "sender: applying path mtu to packet sizing: mtu=%ld limit=%lu",
+            mtu, (unsigned long)payload_limit);
+
+    packetizer_->set_payload_limit(payload_limit);
+}
+
+void Sender::push_frame_(const audio::sample_t* data, size_t size) {
+    size_t slot = 0;
+
+    {
+        core::Mutex::Lock lock(ring_mutex_);
+
+        if (ring_size_ == ring_frames_.size()) {
+            // the sender thread has fallen behind; drop the frame instead
+            // of blocking the caller, which may be a real-time thread
+            if (ring_dropped_++ == 0) {
+                roc_log(LogDebug, "sender: ring is full, dropping frames");
+            }
+            return;
+        }
+
+        slot = (ring_tail_ + ring_size_) % ring_frames_.size();
+    }
+
+    // the slot is owned exclusively by this thread until it's published
+    // below, so the copy doesn't need the lock
+    memcpy(ring_frames_[slot].data(), data, size * sizeof(audio::sample_t));
+    ring_sizes_[slot] = size;
+
+    {
+        core::Mutex::Lock lock(ring_mutex_);
+
+        ring_size_++;
+        ring_cond_.broadcast();
+    }
+}
+
+void Sender::run() {
+    for (;;) {
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            while (ring_size_ == 0 && !stop_) {
+                ring_cond_.wait();
+            }
+
+            if (ring_size_ == 0 && stop_) {
+                return;
+            }
+
+            slot = ring_tail_;
+        }
+
+        // the tail slot is owned exclusively by this thread until it's
+        // released below, so the pipeline write doesn't need the lock
+        audio::Frame frame(ring_frames_[slot].data(), ring_sizes_[slot]);
+        write_frame_(frame);
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            ring_tail_ = (ring_tail_ + 1) % ring_frames_.size();
+            ring_size_--;
+        }
+    }
+}
+
 } // namespace pipeline
 } // namespace roc
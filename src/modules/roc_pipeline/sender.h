@@ -13,12 +13,18 @@
 #define ROC_PIPELINE_SENDER_H_
 
 #include "roc_audio/iframe_encoder.h"
+#include "roc_audio/mixer_writer.h"
 #include "roc_audio/packetizer.h"
-#include "roc_audio/poison_writer.h"
 #include "roc_audio/resampler_writer.h"
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
 #include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/thread.h"
 #include "roc_core/ticker.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_fec/codec_map.h"
@@ -28,15 +34,18 @@
 #include "roc_packet/packet_pool.h"
 #include "roc_packet/router.h"
 #include "roc_pipeline/config.h"
+#include "roc_pipeline/debug_stages.h"
 #include "roc_pipeline/sender_port.h"
+#include "roc_pipeline/stats.h"
 #include "roc_rtp/format_map.h"
+#include "roc_rtp/redundancy_writer.h"
 #include "roc_sndio/isink.h"
 
 namespace roc {
 namespace pipeline {
 
 //! Sender pipeline.
-class Sender : public sndio::ISink, public core::NonCopyable<> {
+class Sender : public sndio::ISink, private core::Thread, public core::NonCopyable<> {
 public:
     //! Initialize.
     Sender(const SenderConfig& config,
@@ -51,9 +60,44 @@ public:
            core::BufferPool<audio::sample_t>& sample_buffer_pool,
            core::IAllocator& allocator);
 
+    //! Stop and join the sender thread, if asynchronous mode is enabled.
+    ~Sender();
+
     //! Check if the pipeline was successfully constructed.
     bool valid();
 
+    //! Add extra destination.
+    //! @remarks
+    //!  Frames are packetized and FEC-encoded only once; the composed
+    //!  packets are additionally addressed to the given ports and written
+    //!  to the given writers, so that an extra receiver costs only the
+    //!  extra sends. Port protocols should match the primary ports.
+    bool add_destination(const PortConfig& source_port,
+                         packet::IWriter& source_writer,
+                         const PortConfig& repair_port,
+                         packet::IWriter& repair_writer);
+
+    //! Create an additional mixed input.
+    //! @remarks
+    //!  Frames written to the returned writer are mixed with the frames of
+    //!  the other inputs before packetization, so that N capture sources
+    //!  produce one stream with a single encode and FEC pass. When mixed
+    //!  inputs are used, all audio should be fed through them instead of
+    //!  write(); each input may be driven from its own thread, and a mixed
+    //!  frame is pushed down the pipeline whenever every input has
+    //!  delivered its share (see audio::MixerWriter). All inputs should be
+    //!  created before the streaming starts.
+    //! @returns
+    //!  a writer feeding the new input, valid until the sender is
+    //!  destroyed, or null if allocation failed.
+    audio::IWriter* add_input();
+
+    //! Get sender statistics.
+    //! @remarks
+    //!  Cheap enough to poll frequently: it only reads the packetizer
+    //!  counters, without stopping the pipeline.
+    void get_stats(SenderStats& stats) const;
+
     //! Get sink sample rate.
     virtual size_t sample_rate() const;
 
@@ -61,9 +105,21 @@ public:
     virtual bool has_clock() const;
 
     //! Write audio frame.
+    //! @remarks
+    //!  In asynchronous mode (see SenderConfig::async_write), copies the
+    //!  frame into the ring and returns without waiting for packetization.
     virtual void write(audio::Frame& frame);
 
 private:
+    virtual void run();
+
+    void write_frame_(audio::Frame& frame);
+    void push_frame_(const audio::sample_t* data, size_t size);
+
+    bool backoff_allows_frame_(core::nanoseconds_t now);
+
+    void update_packet_sizing_();
+
     core::UniquePtr<SenderPort> source_port_;
     core::UniquePtr<SenderPort> repair_port_;
 
@@ -74,13 +130,19 @@ private:
     core::UniquePtr<fec::IBlockEncoder> fec_encoder_;
     core::UniquePtr<fec::Writer> fec_writer_;
 
+    core::UniquePtr<rtp::RedundancyWriter> redundancy_writer_;
+
     core::UniquePtr<audio::IFrameEncoder> payload_encoder_;
     core::UniquePtr<audio::Packetizer> packetizer_;
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonWriter> resampler_poisoner_;
+#endif
     core::UniquePtr<audio::ResamplerWriter> resampler_;
 
+#ifndef ROC_PIPELINE_DISABLE_DEBUG_STAGES
     core::UniquePtr<audio::PoisonWriter> pipeline_poisoner_;
+#endif
 
     core::UniquePtr<core::Ticker> ticker_;
 
@@ -88,8 +150,45 @@ private:
 
     SenderConfig config_;
 
+    PortConfig source_port_config_;
+    PortConfig repair_port_config_;
+
     packet::timestamp_t timestamp_;
     size_t num_channels_;
+
+    // unreachable-destination backoff (see SenderConfig::dst_unreachable):
+    // while suspended, frames are dropped before packetization except
+    // periodic probes
+    bool suspended_;
+    core::nanoseconds_t next_probe_;
+    size_t suspended_frames_;
+
+    // path-MTU-aware packet sizing (see SenderConfig::mtu_packet_sizing):
+    // the payload budget is capped by the byte buffer pool, since a
+    // composed packet must fit one pooled buffer
+    const size_t max_payload_limit_;
+    size_t applied_path_mtu_;
+
+    // asynchronous mode: frames written by the caller are copied into
+    // this ring and drained by the internal sender thread
+    core::Array<core::Slice<audio::sample_t> > ring_frames_;
+    core::Array<size_t> ring_sizes_;
+    size_t ring_tail_;
+    size_t ring_size_;
+    size_t ring_dropped_;
+
+    core::Mutex ring_mutex_;
+    core::Cond ring_cond_;
+
+    core::Atomic stop_;
+
+    bool started_;
+
+    // mixed-input front-end (see add_input()); declared last, so that it
+    // is destroyed before the pipeline it writes into
+    core::BufferPool<audio::sample_t>& sample_buffer_pool_;
+    core::IAllocator& allocator_;
+    core::UniquePtr<audio::MixerWriter> input_mixer_;
 };
 
 } // namespace pipeline
@@ -17,16 +17,21 @@ namespace pipeline {
 
 SenderPort::SenderPort(const PortConfig& config,
                        packet::IWriter& writer,
+                       packet::PacketPool& packet_pool,
                        core::IAllocator& allocator)
     : dst_address_(config.address)
     , writer_(writer)
-    , composer_(NULL) {
+    , composer_(NULL)
+    , packet_pool_(packet_pool)
+    , destinations_(allocator) {
     packet::IComposer* composer = NULL;
 
     switch ((unsigned)config.protocol) {
     case Proto_RTP:
     case Proto_RTP_LDPC_Source:
     case Proto_RTP_RSm8_Source:
+    case Proto_RTP_XOR_Source:
+    case Proto_RTP_RLC_Source:
         rtp_composer_.reset(new (allocator) rtp::Composer(NULL), allocator);
         if (!rtp_composer_) {
             return;
@@ -78,6 +83,46 @@ SenderPort::SenderPort(const PortConfig& config,
         }
         composer = fec_composer_.get();
         break;
+    case Proto_RTP_XOR_Source:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::XOR_PayloadID, fec::Source, fec::Footer>(composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
+    case Proto_XOR_Repair:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::XOR_PayloadID, fec::Repair, fec::Header>(composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
+    case Proto_RTP_RLC_Source:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::RLC_PayloadID, fec::Source, fec::Footer>(composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
+    case Proto_RLC_Repair:
+        fec_composer_.reset(
+            new (allocator)
+                fec::Composer<fec::RLC_PayloadID, fec::Repair, fec::Header>(composer),
+            allocator);
+        if (!fec_composer_) {
+            return;
+        }
+        composer = fec_composer_.get();
+        break;
     }
 
     composer_ = composer;
@@ -93,6 +138,25 @@ packet::IComposer& SenderPort::composer() {
     return *composer_;
 }
 
+bool SenderPort::add_destination(const packet::Address& address,
+                                 packet::IWriter& writer) {
+    roc_panic_if(!valid());
+
+    if (destinations_.size() == destinations_.max_size()) {
+        if (!destinations_.grow(destinations_.size() + 1)) {
+            return false;
+        }
+    }
+
+    Destination dest;
+    dest.address = address;
+    dest.writer = &writer;
+
+    destinations_.push_back(dest);
+
+    return true;
+}
+
 void SenderPort::write(const packet::PacketPtr& packet) {
     roc_panic_if(!valid());
 
@@ -109,8 +173,36 @@ void SenderPort::write(const packet::PacketPtr& packet) {
         packet->add_flags(packet::Packet::FlagComposed);
     }
 
+    // the payload is composed only once and shared between all destinations
+    for (size_t n = 0; n < destinations_.size(); n++) {
+        packet::PacketPtr pp = copy_packet_(*packet);
+        if (!pp) {
+            break;
+        }
+
+        pp->udp()->dst_addr = destinations_[n].address;
+
+        destinations_[n].writer->write(pp);
+    }
+
     writer_.write(packet);
 }
 
+packet::PacketPtr SenderPort::copy_packet_(const packet::Packet& packet) {
+    packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!pp) {
+        roc_log(LogError, "sender port: can't allocate packet");
+        return NULL;
+    }
+
+    pp->add_flags(packet::Packet::FlagUDP | packet::Packet::FlagComposed);
+
+    *pp->udp() = *packet.udp();
+
+    pp->set_data(packet.data());
+
+    return pp;
+}
+
 } // namespace pipeline
 } // namespace roc
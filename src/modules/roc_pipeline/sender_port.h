@@ -12,11 +12,13 @@
 #ifndef ROC_PIPELINE_SENDER_PORT_H_
 #define ROC_PIPELINE_SENDER_PORT_H_
 
+#include "roc_core/array.h"
 #include "roc_core/iallocator.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_packet/icomposer.h"
 #include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
 #include "roc_pipeline/config.h"
 #include "roc_rtp/composer.h"
 
@@ -31,6 +33,7 @@ public:
     //! Initialize.
     SenderPort(const PortConfig& config,
                packet::IWriter& writer,
+               packet::PacketPool& packet_pool,
                core::IAllocator& allocator);
 
     //! Check if the port pipeline was succefully constructed.
@@ -39,15 +42,34 @@ public:
     //! Get packet composer.
     packet::IComposer& composer();
 
+    //! Add extra destination address.
+    //! @remarks
+    //!  Every packet written to the port is sent to @p address via
+    //!  @p writer too, reusing the payload composed for the primary
+    //!  destination. The destination should speak the protocol the
+    //!  port was created with.
+    bool add_destination(const packet::Address& address, packet::IWriter& writer);
+
     //! Write packet.
     void write(const packet::PacketPtr& packet);
 
 private:
+    struct Destination {
+        packet::Address address;
+        packet::IWriter* writer;
+    };
+
+    packet::PacketPtr copy_packet_(const packet::Packet& packet);
+
     const packet::Address dst_address_;
 
     packet::IWriter& writer_;
     packet::IComposer* composer_;
 
+    packet::PacketPool& packet_pool_;
+
+    core::Array<Destination> destinations_;
+
     core::UniquePtr<rtp::Composer> rtp_composer_;
     core::UniquePtr<packet::IComposer> fec_composer_;
 };
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_pipeline/stats.h
+//! @brief Pipeline statistics.
+
+#ifndef ROC_PIPELINE_STATS_H_
+#define ROC_PIPELINE_STATS_H_
+
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/units.h"
+
+namespace roc {
+namespace pipeline {
+
+//! Receiver pipeline statistics.
+//!
+//! Filled by Receiver::get_stats(). Counters are aggregated over the
+//! currently connected sessions; cumulative counters only grow for the
+//! lifetime of a session and drop when the session is removed.
+struct ReceiverStats {
+    //! Number of currently connected sessions.
+    size_t num_sessions;
+
+    //! Network incoming queue latency, in samples per channel.
+    //! Maximum across sessions.
+    packet::timestamp_t niq_latency;
+
+    //! Cumulative number of packets lost on the wire, including packets
+    //! later recovered by FEC. Summed across sessions.
+    size_t lost_packets;
+
+    //! Cumulative number of packets recovered by FEC. Summed across sessions.
+    size_t recovered_packets;
+
+    //! Cumulative number of samples per channel rendered as silence because
+    //! the packets were missing. Summed across sessions.
+    size_t missing_samples;
+
+    //! Cumulative number of provably-late packets dropped at session
+    //! ingest. Summed across sessions.
+    size_t late_packets;
+
+    //! Cumulative number of packets dropped at session ingest because the
+    //! session exceeded its packet budget or queued bytes limit. Summed
+    //! across sessions.
+    size_t overflow_packets;
+
+    //! Sum of per-session resampler scaling factors.
+    float scaling_sum;
+
+    //! Number of sessions that employ resampling.
+    size_t scaling_count;
+
+    //! Cumulative CPU time consumed by session pipelines, in nanoseconds.
+    //! Summed across sessions. Zero unless profiling is enabled in config.
+    core::nanoseconds_t cpu_time_sum;
+
+    //! CPU time consumed by the most expensive session, in nanoseconds.
+    //! Zero unless profiling is enabled in config.
+    core::nanoseconds_t cpu_time_max;
+
+    //! Current degradation level of the quality governor, zero meaning
+    //! full quality. Zero unless the governor is enabled in config.
+    size_t quality_level;
+
+    ReceiverStats()
+        : num_sessions(0)
+        , niq_latency(0)
+        , lost_packets(0)
+        , recovered_packets(0)
+        , missing_samples(0)
+        , late_packets(0)
+        , overflow_packets(0)
+        , scaling_sum(0)
+        , scaling_count(0)
+        , cpu_time_sum(0)
+        , cpu_time_max(0)
+        , quality_level(0) {
+    }
+};
+
+//! Sender pipeline statistics.
+//!
+//! Filled by Sender::get_stats(). All counters are cumulative.
+struct SenderStats {
+    //! Number of packets written to the output writer.
+    size_t num_packets;
+
+    //! Number of samples per channel written to packets.
+    size_t num_samples;
+
+    //! Number of frames dropped before packetization while sending was
+    //! suspended because the destination was unreachable.
+    size_t suspended_frames;
+
+    SenderStats()
+        : num_packets(0)
+        , num_samples(0)
+        , suspended_frames(0) {
+    }
+};
+
+} // namespace pipeline
+} // namespace roc
+
+#endif // ROC_PIPELINE_STATS_H_
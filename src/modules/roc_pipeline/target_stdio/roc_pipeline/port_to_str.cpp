@@ -38,6 +38,14 @@ const char* port_proto_to_str(PortProtocol proto) {
         return "rtp+ldpc";
     case Proto_LDPC_Repair:
         return "ldpc";
+    case Proto_RTP_XOR_Source:
+        return "rtp+xor";
+    case Proto_XOR_Repair:
+        return "xor";
+    case Proto_RTP_RLC_Source:
+        return "rtp+rlc";
+    case Proto_RLC_Repair:
+        return "rlc";
     }
     return "?";
 }
@@ -15,7 +15,10 @@ namespace roc {
 namespace rtp {
 
 Composer::Composer(packet::IComposer* inner_composer)
-    : inner_composer_(inner_composer) {
+    : inner_composer_(inner_composer)
+    , template_ssrc_(0)
+    , template_pt_(0)
+    , template_valid_(false) {
 }
 
 bool Composer::align(core::Slice<uint8_t>& buffer,
@@ -129,13 +132,27 @@ bool Composer::compose(packet::Packet& packet) {
 
     Header& header = *(Header*)rtp->header.data();
 
-    header.clear();
-    header.set_version(V2);
-    header.set_ssrc(rtp->source);
+    // version, SSRC, and payload type change at most per-session, so
+    // they are composed once into a template, and per-packet work is one
+    // header copy plus patching the fields that do change: the sequence
+    // number, the timestamp, and the marker bit
+    if (!template_valid_ || template_ssrc_ != rtp->source
+        || template_pt_ != rtp->payload_type) {
+        header_template_.clear();
+        header_template_.set_version(V2);
+        header_template_.set_ssrc(rtp->source);
+        header_template_.set_payload_type(PayloadType(rtp->payload_type));
+
+        template_ssrc_ = rtp->source;
+        template_pt_ = rtp->payload_type;
+        template_valid_ = true;
+    }
+
+    memcpy(&header, &header_template_, sizeof(Header));
+
     header.set_seqnum(rtp->seqnum);
     header.set_timestamp(rtp->timestamp);
     header.set_marker(rtp->marker);
-    header.set_payload_type(PayloadType(rtp->payload_type));
 
     if (rtp->padding.size() > 0) {
         header.set_padding(true);
@@ -14,6 +14,7 @@
 
 #include "roc_core/noncopyable.h"
 #include "roc_packet/icomposer.h"
+#include "roc_rtp/headers.h"
 
 namespace roc {
 namespace rtp {
@@ -42,6 +43,15 @@ public:
 
 private:
     packet::IComposer* inner_composer_;
+
+    // Template of the header part that is invariant within a session
+    // (version, SSRC, payload type), composed once and reused, so that
+    // per-packet composition is one header copy plus patching the fields
+    // that do change (see compose()).
+    Header header_template_;
+    uint32_t template_ssrc_;
+    unsigned int template_pt_;
+    bool template_valid_;
 };
 
 } // namespace rtp
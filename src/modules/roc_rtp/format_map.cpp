@@ -10,7 +10,15 @@
 #include "roc_audio/pcm_decoder.h"
 #include "roc_audio/pcm_encoder.h"
 #include "roc_audio/pcm_funcs.h"
+#include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_core/stddefs.h"
+
+#ifdef ROC_TARGET_OPUS
+#include "roc_audio/opus_frame_decoder.h"
+#include "roc_audio/opus_frame_encoder.h"
+#include "roc_core/unique_ptr.h"
+#endif // ROC_TARGET_OPUS
 
 namespace roc {
 namespace rtp {
@@ -25,10 +33,36 @@ template <class I, class T> I* new_codec_pcm_int16_2ch(core::IAllocator& allocat
     return new (allocator) T(audio::PCM_int16_2ch);
 }
 
+template <class I, class T> I* new_codec_pcm_int24_1ch(core::IAllocator& allocator) {
+    return new (allocator) T(audio::PCM_int24_1ch);
+}
+
+template <class I, class T> I* new_codec_pcm_int24_2ch(core::IAllocator& allocator) {
+    return new (allocator) T(audio::PCM_int24_2ch);
+}
+
+template <class I, class T> I* new_codec_pcm_float32_1ch(core::IAllocator& allocator) {
+    return new (allocator) T(audio::PCM_float32_1ch);
+}
+
+template <class I, class T> I* new_codec_pcm_float32_2ch(core::IAllocator& allocator) {
+    return new (allocator) T(audio::PCM_float32_2ch);
+}
+
+#ifdef ROC_TARGET_OPUS
+template <class I, class T> I* new_codec_opus(core::IAllocator& allocator) {
+    core::UniquePtr<T> codec(new (allocator) T, allocator);
+    if (!codec || !codec->valid()) {
+        return NULL;
+    }
+    return codec.release();
+}
+#endif // ROC_TARGET_OPUS
+
 } // namespace
 
-FormatMap::FormatMap()
-    : n_formats_(0) {
+FormatMap::FormatMap() {
+    memset(enabled_, 0, sizeof(enabled_));
     {
         Format fmt;
         fmt.payload_type = PayloadType_L16_Mono;
@@ -40,7 +74,7 @@ FormatMap::FormatMap()
             new_codec_pcm_int16_1ch<audio::IFrameEncoder, audio::PCMEncoder>;
         fmt.new_decoder =
             new_codec_pcm_int16_1ch<audio::IFrameDecoder, audio::PCMDecoder>;
-        add_(fmt);
+        roc_panic_if(!add_format(fmt));
     }
     {
         Format fmt;
@@ -53,23 +87,106 @@ FormatMap::FormatMap()
             new_codec_pcm_int16_2ch<audio::IFrameEncoder, audio::PCMEncoder>;
         fmt.new_decoder =
             new_codec_pcm_int16_2ch<audio::IFrameDecoder, audio::PCMDecoder>;
-        add_(fmt);
+        roc_panic_if(!add_format(fmt));
+    }
+    {
+        Format fmt;
+        fmt.payload_type = PayloadType_L24_Stereo;
+        fmt.flags = packet::Packet::FlagAudio;
+        fmt.sample_rate = 44100;
+        fmt.channel_mask = 0x3;
+        fmt.get_num_samples = audio::PCM_int24_2ch.samples_from_payload_size;
+        fmt.new_encoder =
+            new_codec_pcm_int24_2ch<audio::IFrameEncoder, audio::PCMEncoder>;
+        fmt.new_decoder =
+            new_codec_pcm_int24_2ch<audio::IFrameDecoder, audio::PCMDecoder>;
+        roc_panic_if(!add_format(fmt));
+    }
+    {
+        Format fmt;
+        fmt.payload_type = PayloadType_L24_Mono;
+        fmt.flags = packet::Packet::FlagAudio;
+        fmt.sample_rate = 44100;
+        fmt.channel_mask = 0x1;
+        fmt.get_num_samples = audio::PCM_int24_1ch.samples_from_payload_size;
+        fmt.new_encoder =
+            new_codec_pcm_int24_1ch<audio::IFrameEncoder, audio::PCMEncoder>;
+        fmt.new_decoder =
+            new_codec_pcm_int24_1ch<audio::IFrameDecoder, audio::PCMDecoder>;
+        roc_panic_if(!add_format(fmt));
     }
+    {
+        Format fmt;
+        fmt.payload_type = PayloadType_F32_Stereo;
+        fmt.flags = packet::Packet::FlagAudio;
+        fmt.sample_rate = 44100;
+        fmt.channel_mask = 0x3;
+        fmt.get_num_samples = audio::PCM_float32_2ch.samples_from_payload_size;
+        fmt.new_encoder =
+            new_codec_pcm_float32_2ch<audio::IFrameEncoder, audio::PCMEncoder>;
+        fmt.new_decoder =
+            new_codec_pcm_float32_2ch<audio::IFrameDecoder, audio::PCMDecoder>;
+        roc_panic_if(!add_format(fmt));
+    }
+    {
+        Format fmt;
+        fmt.payload_type = PayloadType_F32_Mono;
+        fmt.flags = packet::Packet::FlagAudio;
+        fmt.sample_rate = 44100;
+        fmt.channel_mask = 0x1;
+        fmt.get_num_samples = audio::PCM_float32_1ch.samples_from_payload_size;
+        fmt.new_encoder =
+            new_codec_pcm_float32_1ch<audio::IFrameEncoder, audio::PCMEncoder>;
+        fmt.new_decoder =
+            new_codec_pcm_float32_1ch<audio::IFrameDecoder, audio::PCMDecoder>;
+        roc_panic_if(!add_format(fmt));
+    }
+#ifdef ROC_TARGET_OPUS
+    {
+        Format fmt;
+        fmt.payload_type = PayloadType_Opus;
+        fmt.flags = packet::Packet::FlagAudio;
+        fmt.sample_rate = audio::OpusSampleRate;
+        fmt.channel_mask = audio::OpusChannelMask;
+        fmt.get_num_samples = audio::OpusFrameDecoder::samples_from_payload_size;
+        fmt.new_encoder = new_codec_opus<audio::IFrameEncoder, audio::OpusFrameEncoder>;
+        fmt.new_decoder = new_codec_opus<audio::IFrameDecoder, audio::OpusFrameDecoder>;
+        roc_panic_if(!add_format(fmt));
+    }
+#endif // ROC_TARGET_OPUS
 }
 
 const Format* FormatMap::format(unsigned int pt) const {
-    for (size_t n = 0; n < n_formats_; n++) {
-        if ((unsigned int)formats_[n].payload_type == pt) {
-            return &formats_[n];
-        }
+    if (pt > MaxPayloadType) {
+        return NULL;
+    }
+
+    if (!enabled_[pt]) {
+        return NULL;
     }
 
-    return NULL;
+    return &formats_[pt];
 }
 
-void FormatMap::add_(const Format& fmt) {
-    roc_panic_if(n_formats_ == MaxFormats);
-    formats_[n_formats_++] = fmt;
+bool FormatMap::add_format(const Format& fmt) {
+    const unsigned int pt = (unsigned int)fmt.payload_type;
+
+    if (pt > MaxPayloadType) {
+        roc_log(LogError, "format map: can't register format: bad payload type %u", pt);
+        return false;
+    }
+
+    if (enabled_[pt]) {
+        roc_log(LogError,
+                "format map: can't register format: payload type %u already in use",
+                pt);
+        return false;
+    }
+
+    formats_[pt] = fmt;
+    enabled_[pt] = true;
+
+    return true;
 }
 
 } // namespace rtp
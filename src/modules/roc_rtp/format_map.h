@@ -19,6 +19,9 @@ namespace roc {
 namespace rtp {
 
 //! RTP payload format map.
+//! @remarks
+//!  Formats are stored in a table indexed directly by payload type, so
+//!  that the per-packet lookup in the parser is a single array load.
 class FormatMap : public core::NonCopyable<> {
 public:
     FormatMap();
@@ -29,13 +32,21 @@ public:
     //!  registered for this payload type.
     const Format* format(unsigned int pt) const;
 
-private:
-    enum { MaxFormats = 2 };
+    //! Register a format.
+    //! @remarks
+    //!  May be used to register formats with dynamic payload types at
+    //!  runtime. Not thread-safe; all formats should be registered before
+    //!  the map is shared with running pipelines.
+    //! @returns
+    //!  false if the payload type is out of range or already registered.
+    bool add_format(const Format& fmt);
 
-    Format formats_[MaxFormats];
-    size_t n_formats_;
+private:
+    // payload types are 7-bit
+    enum { MaxPayloadType = 127 };
 
-    void add_(const Format& fmt);
+    Format formats_[MaxPayloadType + 1];
+    bool enabled_[MaxPayloadType + 1];
 };
 
 } // namespace rtp
@@ -28,7 +28,12 @@ enum Version {
 //! RTP payload type.
 enum PayloadType {
     PayloadType_L16_Stereo = 10, //!< Audio, 16-bit samples, 2 channels, 44100 Hz.
-    PayloadType_L16_Mono = 11    //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    PayloadType_L16_Mono = 11,   //!< Audio, 16-bit samples, 1 channel, 44100 Hz.
+    PayloadType_Opus = 100,      //!< Audio, Opus, 2 channels, 48000 Hz (dynamic).
+    PayloadType_L24_Stereo = 101, //!< Audio, 24-bit samples, 2 channels, 44100 Hz.
+    PayloadType_L24_Mono = 102,   //!< Audio, 24-bit samples, 1 channel, 44100 Hz.
+    PayloadType_F32_Stereo = 103, //!< Audio, float samples, 2 channels, 44100 Hz.
+    PayloadType_F32_Mono = 104    //!< Audio, float samples, 1 channel, 44100 Hz.
 };
 
 //! RTP header.
@@ -252,6 +257,106 @@ public:
     }
 };
 
+//! Redundant encoding block header (RFC 2198).
+//! @remarks
+//!  A redundant payload consists of one such 4-byte header per redundant
+//!  block, then a final 1-byte header holding the primary payload type
+//!  with the F bit cleared, then the block data in the same order, with
+//!  the primary data last.
+//!
+//! @code
+//!    0             1               2               3               4
+//!    0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7 0 1 2 3 4 5 6 7
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//!   |F|   block PT  |   timestamp offset        |   block length    |
+//!   +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+//! @endcode
+class ROC_ATTR_PACKED RedundancyBlockHeader {
+private:
+    enum {
+        //! @name Follow flag.
+        //! @remarks
+        //!  If this flag is set, another block header follows this one.
+        // @{
+        FPT_FollowShift = 7,
+        FPT_FollowMask = 0x1,
+        // @}
+
+        //! @name Block payload type.
+        // @{
+        FPT_PayloadTypeShift = 0,
+        FPT_PayloadTypeMask = 0x7f
+        // @}
+    };
+
+    //! Packed follow flag and block payload type (FPT_*).
+    uint8_t fpt_;
+
+    //! Packed timestamp offset (14 bits) and block length (10 bits).
+    uint8_t packed_[3];
+
+public:
+    enum {
+        //! Maximum representable timestamp offset.
+        MaxTimestampOffset = 0x3fff,
+
+        //! Maximum representable block length, in bytes.
+        MaxBlockLength = 0x3ff
+    };
+
+    //! Clear header.
+    void clear() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    //! Get follow flag.
+    bool follow() const {
+        return (fpt_ & (FPT_FollowMask << FPT_FollowShift));
+    }
+
+    //! Set follow flag.
+    void set_follow(bool f) {
+        fpt_ &= ~(FPT_FollowMask << FPT_FollowShift);
+        fpt_ |= ((!!f) << FPT_FollowShift);
+    }
+
+    //! Get block payload type.
+    uint8_t payload_type() const {
+        return ((fpt_ >> FPT_PayloadTypeShift) & FPT_PayloadTypeMask);
+    }
+
+    //! Set block payload type.
+    void set_payload_type(uint8_t pt) {
+        roc_panic_if((pt & FPT_PayloadTypeMask) != pt);
+        fpt_ &= ~(FPT_PayloadTypeMask << FPT_PayloadTypeShift);
+        fpt_ |= (pt << FPT_PayloadTypeShift);
+    }
+
+    //! Get timestamp offset of the block relative to the primary data.
+    uint16_t timestamp_offset() const {
+        return uint16_t((packed_[0] << 6) | (packed_[1] >> 2));
+    }
+
+    //! Set timestamp offset.
+    void set_timestamp_offset(uint16_t off) {
+        roc_panic_if((off & MaxTimestampOffset) != off);
+        packed_[0] = uint8_t(off >> 6);
+        packed_[1] = uint8_t((packed_[1] & 0x3) | ((off & 0x3f) << 2));
+    }
+
+    //! Get block length in bytes.
+    uint16_t block_length() const {
+        return uint16_t(((packed_[1] & 0x3) << 8) | packed_[2]);
+    }
+
+    //! Set block length.
+    void set_block_length(uint16_t len) {
+        roc_panic_if((len & MaxBlockLength) != len);
+        packed_[1] = uint8_t((packed_[1] & ~0x3) | (len >> 8));
+        packed_[2] = uint8_t(len & 0xff);
+    }
+};
+
 } // namespace rtp
 } // namespace roc
 
@@ -100,6 +100,16 @@ bool Parser::parse(packet::Packet& packet, const core::Slice<uint8_t>& buffer) {
     rtp.header = buffer.range(0, header_size);
     rtp.payload = buffer.range(payload_begin, payload_end);
 
+    // store views into the remaining header regions without decoding them;
+    // the consumer decodes them lazily using the structs from headers.h
+    if (header.num_csrc() != 0) {
+        rtp.csrc = buffer.range(sizeof(Header), header.header_size());
+    }
+
+    if (header.has_extension()) {
+        rtp.extension = buffer.range(header.header_size(), header_size);
+    }
+
     if (pad_size) {
         rtp.padding = buffer.range(payload_end, payload_end + pad_size);
     }
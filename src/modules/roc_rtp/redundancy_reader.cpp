@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/redundancy_reader.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+#include "roc_rtp/headers.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+// A payload that doesn't parse as RFC 2198 framing means the sender
+// doesn't use redundant encoding (or the stream is corrupted); worth
+// a log line, not a log line per packet.
+const core::nanoseconds_t BadLogInterval = 20 * core::Second;
+
+} // namespace
+
+RedundancyReader::RedundancyReader(packet::IReader& reader,
+                                   packet::PacketPool& packet_pool)
+    : reader_(reader)
+    , packet_pool_(packet_pool)
+    , prev_seqnum_(0)
+    , has_prev_(false)
+    , n_restored_(0)
+    , bad_limiter_(BadLogInterval) {
+}
+
+packet::PacketPtr RedundancyReader::read() {
+    if (next_packet_) {
+        packet::PacketPtr pp = next_packet_;
+        next_packet_ = NULL;
+        return pp;
+    }
+
+    packet::PacketPtr pp = reader_.read();
+    if (!pp) {
+        return NULL;
+    }
+
+    packet::RTP* rtp = pp->rtp();
+    if (!rtp) {
+        return pp;
+    }
+
+    core::Slice<uint8_t> red_data;
+    size_t red_ts_off = 0;
+    unsigned red_pt = 0;
+
+    if (!strip_(*rtp, red_data, red_ts_off, red_pt)) {
+        if (bad_limiter_.allow()) {
+            roc_log(LogDebug,
+                    "redundancy reader: bad redundant payload, passing through:"
+                    " does the sender use redundant encoding?");
+        }
+        return pp;
+    }
+
+    // only a single-packet gap can be repaired: the packet at hand carries
+    // one redundant copy, of the packet immediately preceding it
+    const bool gap = has_prev_ && packet::seqnum_diff(rtp->seqnum, prev_seqnum_) == 2;
+
+    has_prev_ = true;
+    prev_seqnum_ = rtp->seqnum;
+
+    if (gap && red_data.size() != 0 && red_ts_off != 0) {
+        packet::PacketPtr restored = restore_(*pp, red_data, red_ts_off, red_pt);
+        if (restored) {
+            n_restored_++;
+
+            // the restored packet precedes its carrier in the stream
+            next_packet_ = pp;
+            return restored;
+        }
+    }
+
+    return pp;
+}
+
+size_t RedundancyReader::n_restored() const {
+    return n_restored_;
+}
+
+bool RedundancyReader::strip_(packet::RTP& rtp,
+                              core::Slice<uint8_t>& red_data,
+                              size_t& red_ts_off,
+                              unsigned& red_pt) {
+    const core::Slice<uint8_t> payload = rtp.payload;
+    const uint8_t* d = payload.data();
+
+    size_t pos = 0;
+
+    // walk the block header chain; our writer emits at most one redundant
+    // block, but the framing allows several, in which case the last one
+    // (the most recent packet) is the one a single-packet gap needs
+    size_t red_total = 0;
+    size_t last_before = 0;
+    size_t last_len = 0;
+    size_t last_off = 0;
+    unsigned last_pt = 0;
+    bool have_red = false;
+
+    while (pos < payload.size() && (d[pos] & 0x80)) {
+        if (pos + sizeof(RedundancyBlockHeader) > payload.size()) {
+            return false;
+        }
+        const RedundancyBlockHeader& blk = *(const RedundancyBlockHeader*)&d[pos];
+
+        last_before = red_total;
+        last_pt = blk.payload_type();
+        last_off = blk.timestamp_offset();
+        last_len = blk.block_length();
+        red_total += last_len;
+        have_red = true;
+
+        pos += sizeof(RedundancyBlockHeader);
+    }
+
+    if (pos >= payload.size()) {
+        return false;
+    }
+
+    const unsigned primary_pt = (d[pos] & 0x7f);
+    pos++;
+
+    if (pos + red_total > payload.size()) {
+        return false;
+    }
+
+    if (have_red) {
+        red_data = payload.range(pos + last_before, pos + last_before + last_len);
+        red_ts_off = last_off;
+        red_pt = last_pt;
+    }
+
+    rtp.payload = payload.range(pos + red_total, payload.size());
+    rtp.payload_type = primary_pt;
+
+    return true;
+}
+
+packet::PacketPtr RedundancyReader::restore_(const packet::Packet& carrier,
+                                             const core::Slice<uint8_t>& red_data,
+                                             size_t ts_off,
+                                             unsigned pt) {
+    packet::PacketPtr packet = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!packet) {
+        roc_log(LogError, "redundancy reader: can't allocate packet");
+        return NULL;
+    }
+
+    packet->add_flags(packet::Packet::FlagRTP | packet::Packet::FlagAudio
+                      | packet::Packet::FlagRestored);
+
+    // share the carrier packet buffer; the redundant block is used in place
+    packet->set_data(carrier.data());
+
+    const packet::RTP& carrier_rtp = *carrier.rtp();
+
+    packet::RTP& rtp = *packet->rtp();
+
+    rtp.source = carrier_rtp.source;
+    rtp.seqnum = packet::seqnum_t(carrier_rtp.seqnum - 1);
+    rtp.timestamp = packet::timestamp_t(carrier_rtp.timestamp - ts_off);
+    rtp.duration = (packet::timestamp_t)ts_off;
+    rtp.payload_type = pt;
+    rtp.payload = red_data;
+
+    return packet;
+}
+
+} // namespace rtp
+} // namespace roc
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/redundancy_reader.h
+//! @brief RTP redundant encoding reader.
+
+#ifndef ROC_RTP_REDUNDANCY_READER_H_
+#define ROC_RTP_REDUNDANCY_READER_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/slice.h"
+#include "roc_packet/ireader.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP redundant encoding reader.
+//! Counterpart of RedundancyWriter: strips the RFC 2198 framing from the
+//! packets it forwards, leaving the primary payload, and when a packet is
+//! found to be missing, restores it from the redundant block of the packet
+//! that follows, before the gap ever reaches the depacketizer or engages
+//! block-level FEC repair. The restored packet shares the carrier packet
+//! buffer, so restoration costs one packet object and no payload copy.
+class RedundancyReader : public packet::IReader, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p reader is used to read packets with redundant blocks
+    //!  - @p packet_pool is used to allocate restored packets
+    RedundancyReader(packet::IReader& reader, packet::PacketPool& packet_pool);
+
+    //! Read packet.
+    virtual packet::PacketPtr read();
+
+    //! Get number of packets restored from redundant blocks.
+    size_t n_restored() const;
+
+private:
+    bool strip_(packet::RTP& rtp,
+                core::Slice<uint8_t>& red_data,
+                size_t& red_ts_off,
+                unsigned& red_pt);
+
+    packet::PacketPtr restore_(const packet::Packet& carrier,
+                               const core::Slice<uint8_t>& red_data,
+                               size_t ts_off,
+                               unsigned pt);
+
+    packet::IReader& reader_;
+    packet::PacketPool& packet_pool_;
+
+    packet::PacketPtr next_packet_;
+
+    packet::seqnum_t prev_seqnum_;
+    bool has_prev_;
+
+    size_t n_restored_;
+
+    core::RateLimiter bad_limiter_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_REDUNDANCY_READER_H_
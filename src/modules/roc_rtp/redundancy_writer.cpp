@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_rtp/redundancy_writer.h"
+#include "roc_core/log.h"
+#include "roc_core/time.h"
+#include "roc_rtp/headers.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+// Blocks skipped because they don't fit the header fields indicate a
+// misconfiguration (huge packets or long silence gaps) that is worth
+// knowing about, but shouldn't flood the log on every packet.
+const core::nanoseconds_t SkipLogInterval = 20 * core::Second;
+
+} // namespace
+
+RedundancyWriter::RedundancyWriter(packet::IWriter& output,
+                                   packet::IComposer& composer,
+                                   packet::PacketPool& packet_pool,
+                                   core::BufferPool<uint8_t>& buffer_pool)
+    : output_(output)
+    , composer_(composer)
+    , packet_pool_(packet_pool)
+    , buffer_pool_(buffer_pool)
+    , prev_timestamp_(0)
+    , prev_pt_(0)
+    , skip_limiter_(SkipLogInterval) {
+}
+
+void RedundancyWriter::write(const packet::PacketPtr& pp) {
+    packet::RTP* rtp = pp->rtp();
+    if (!rtp) {
+        output_.write(pp);
+        return;
+    }
+
+    bool have_red = (prev_payload_.size() != 0);
+    size_t ts_off = 0;
+
+    if (have_red) {
+        const packet::timestamp_diff_t d =
+            packet::timestamp_diff(rtp->timestamp, prev_timestamp_);
+
+        if (d <= 0 || d > (packet::timestamp_diff_t)RedundancyBlockHeader::MaxTimestampOffset
+            || prev_payload_.size() > RedundancyBlockHeader::MaxBlockLength) {
+            if (skip_limiter_.allow()) {
+                roc_log(LogDebug,
+                        "redundancy writer: block doesn't fit header fields, skipping:"
+                        " ts_off=%ld block_size=%lu",
+                        (long)d, (unsigned long)prev_payload_.size());
+            }
+            have_red = false;
+        } else {
+            ts_off = (size_t)d;
+        }
+    }
+
+    packet::PacketPtr red_packet = compose_red_packet_(*rtp, have_red, ts_off);
+
+    if (red_packet) {
+        output_.write(red_packet);
+    } else {
+        // allocation failed; better send the packet without redundancy
+        // than not at all
+        output_.write(pp);
+    }
+
+    prev_payload_ = rtp->payload;
+    prev_timestamp_ = rtp->timestamp;
+    prev_pt_ = rtp->payload_type;
+}
+
+packet::PacketPtr RedundancyWriter::compose_red_packet_(const packet::RTP& rtp,
+                                                        bool have_red,
+                                                        size_t ts_off) {
+    const size_t red_size =
+        have_red ? sizeof(RedundancyBlockHeader) + prev_payload_.size() : 0;
+    const size_t payload_size = red_size + 1 + rtp.payload.size();
+
+    packet::PacketPtr packet = new (packet_pool_) packet::Packet(packet_pool_);
+    if (!packet) {
+        roc_log(LogError, "redundancy writer: can't allocate packet");
+        return NULL;
+    }
+
+    packet->add_flags(packet::Packet::FlagAudio);
+
+    core::Slice<uint8_t> data = new (buffer_pool_) core::Buffer<uint8_t>(buffer_pool_);
+    if (!data) {
+        roc_log(LogError, "redundancy writer: can't allocate buffer");
+        return NULL;
+    }
+
+    if (!composer_.prepare(*packet, data, payload_size)) {
+        roc_log(LogError, "redundancy writer: can't prepare packet");
+        return NULL;
+    }
+
+    packet->set_data(data);
+
+    packet::RTP& red_rtp = *packet->rtp();
+
+    red_rtp.source = rtp.source;
+    red_rtp.seqnum = rtp.seqnum;
+    red_rtp.timestamp = rtp.timestamp;
+    red_rtp.duration = rtp.duration;
+    red_rtp.marker = rtp.marker;
+    red_rtp.payload_type = rtp.payload_type;
+
+    uint8_t* pos = red_rtp.payload.data();
+
+    if (have_red) {
+        RedundancyBlockHeader& blk = *(RedundancyBlockHeader*)pos;
+        blk.clear();
+        blk.set_follow(true);
+        blk.set_payload_type((uint8_t)prev_pt_);
+        blk.set_timestamp_offset((uint16_t)ts_off);
+        blk.set_block_length((uint16_t)prev_payload_.size());
+        pos += sizeof(RedundancyBlockHeader);
+    }
+
+    *pos++ = uint8_t(rtp.payload_type & 0x7f);
+
+    if (have_red) {
+        memcpy(pos, prev_payload_.data(), prev_payload_.size());
+        pos += prev_payload_.size();
+    }
+
+    memcpy(pos, rtp.payload.data(), rtp.payload.size());
+
+    return packet;
+}
+
+} // namespace rtp
+} // namespace roc
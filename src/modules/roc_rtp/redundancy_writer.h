@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_rtp/redundancy_writer.h
+//! @brief RTP redundant encoding writer.
+
+#ifndef ROC_RTP_REDUNDANCY_WRITER_H_
+#define ROC_RTP_REDUNDANCY_WRITER_H_
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/rate_limiter.h"
+#include "roc_core/slice.h"
+#include "roc_packet/icomposer.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet.h"
+#include "roc_packet/packet_pool.h"
+
+namespace roc {
+namespace rtp {
+
+//! RTP redundant encoding writer.
+//! Embeds the payload of the previous packet into every packet as an
+//! RFC 2198 redundant block, so that a single lost packet can be repaired
+//! from the packet that follows it, with a recovery latency of one packet
+//! interval instead of a FEC block duration. Doubles the payload
+//! bandwidth; the receiver should enable redundant encoding as well (see
+//! RedundancyReader). A payload that doesn't fit the block length field,
+//! or a timestamp gap that doesn't fit the offset field (e.g. after DTX
+//! silence), is not embedded and that loss falls back to concealment.
+class RedundancyWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p output is used to write the re-composed packets
+    //!  - @p composer is used to prepare the re-composed packets
+    //!  - @p packet_pool is used to allocate packets
+    //!  - @p buffer_pool is used to allocate packet buffers
+    RedundancyWriter(packet::IWriter& output,
+                     packet::IComposer& composer,
+                     packet::PacketPool& packet_pool,
+                     core::BufferPool<uint8_t>& buffer_pool);
+
+    //! Re-compose packet with a redundant block and write it to output.
+    virtual void write(const packet::PacketPtr&);
+
+private:
+    packet::PacketPtr
+    compose_red_packet_(const packet::RTP& rtp, bool have_red, size_t ts_off);
+
+    packet::IWriter& output_;
+    packet::IComposer& composer_;
+
+    packet::PacketPool& packet_pool_;
+    core::BufferPool<uint8_t>& buffer_pool_;
+
+    core::Slice<uint8_t> prev_payload_;
+    packet::timestamp_t prev_timestamp_;
+    unsigned int prev_pt_;
+
+    core::RateLimiter skip_limiter_;
+};
+
+} // namespace rtp
+} // namespace roc
+
+#endif // ROC_RTP_REDUNDANCY_WRITER_H_
@@ -9,11 +9,24 @@
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_core/log.h"
 #include "roc_core/panic.h"
+#include "roc_sndio/synth_backend.h"
+
+#ifdef ROC_TARGET_ALSA
+#include "roc_sndio/alsa_backend.h"
+#endif // ROC_TARGET_ALSA
 
 #ifdef ROC_TARGET_PULSEAUDIO
 #include "roc_sndio/pulseaudio_backend.h"
 #endif // ROC_TARGET_PULSEAUDIO
 
+#ifdef ROC_TARGET_COREAUDIO
+#include "roc_sndio/coreaudio_backend.h"
+#endif // ROC_TARGET_COREAUDIO
+
+#ifdef ROC_TARGET_POSIX
+#include "roc_sndio/wav_backend.h"
+#endif // ROC_TARGET_POSIX
+
 #ifdef ROC_TARGET_SOX
 #include "roc_sndio/sox_backend.h"
 #endif // ROC_TARGET_SOX
@@ -21,20 +34,82 @@
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// Factories delay backend singleton construction (and thus e.g. libsox
+// global initialization) until a backend is actually used.
+#ifdef ROC_TARGET_POSIX
+IBackend& wav_backend_factory() {
+    return WavBackend::instance();
+}
+#endif // ROC_TARGET_POSIX
+
+#ifdef ROC_TARGET_ALSA
+IBackend& alsa_backend_factory() {
+    return AlsaBackend::instance();
+}
+#endif // ROC_TARGET_ALSA
+
+#ifdef ROC_TARGET_PULSEAUDIO
+IBackend& pulseaudio_backend_factory() {
+    return PulseaudioBackend::instance();
+}
+#endif // ROC_TARGET_PULSEAUDIO
+
+#ifdef ROC_TARGET_COREAUDIO
+IBackend& coreaudio_backend_factory() {
+    return CoreaudioBackend::instance();
+}
+#endif // ROC_TARGET_COREAUDIO
+
+#ifdef ROC_TARGET_SOX
+IBackend& sox_backend_factory() {
+    return SoxBackend::instance();
+}
+#endif // ROC_TARGET_SOX
+
+IBackend& synth_backend_factory() {
+    return SynthBackend::instance();
+}
+
+} // namespace
+
 BackendDispatcher::BackendDispatcher()
-    : n_backends_(0) {
+    : n_backends_(0)
+    , frame_size_(0) {
+    // registered before other backends, so that it wins probing for WAV files
+#ifdef ROC_TARGET_POSIX
+    add_backend_(&wav_backend_factory);
+#endif // ROC_TARGET_POSIX
+#ifdef ROC_TARGET_ALSA
+    add_backend_(&alsa_backend_factory);
+#endif // ROC_TARGET_ALSA
 #ifdef ROC_TARGET_PULSEAUDIO
-    add_backend_(PulseaudioBackend::instance());
+    add_backend_(&pulseaudio_backend_factory);
 #endif // ROC_TARGET_PULSEAUDIO
+#ifdef ROC_TARGET_COREAUDIO
+    add_backend_(&coreaudio_backend_factory);
+#endif // ROC_TARGET_COREAUDIO
 #ifdef ROC_TARGET_SOX
-    add_backend_(SoxBackend::instance());
+    add_backend_(&sox_backend_factory);
 #endif // ROC_TARGET_SOX
+    // matches only the explicit "synth" driver or a "synth://" input, so
+    // its position doesn't affect file and device probing
+    add_backend_(&synth_backend_factory);
 }
 
 void BackendDispatcher::set_frame_size(size_t frame_size) {
-    (void)frame_size;
+    core::Mutex::Lock lock(mutex_);
+
+    // remembered and applied when (and if) the SoX backend is created
+    frame_size_ = frame_size;
+
 #ifdef ROC_TARGET_SOX
-    SoxBackend::instance().set_frame_size(frame_size);
+    for (size_t n = 0; n < n_backends_; n++) {
+        if (backends_[n].factory == &sox_backend_factory && backends_[n].backend) {
+            SoxBackend::instance().set_frame_size(frame_size);
+        }
+    }
 #endif // ROC_TARGET_SOX
 }
 
@@ -63,7 +138,7 @@ ISource* BackendDispatcher::open_source(core::IAllocator& allocator,
 bool BackendDispatcher::get_device_drivers(core::Array<DriverInfo>& arr) {
     arr.resize(0);
     for (size_t n = 0; n < n_backends_; n++) {
-        if (!backends_[n]->get_drivers(arr, IBackend::FilterDevice)) {
+        if (!resolve_backend_(backends_[n]).get_drivers(arr, IBackend::FilterDevice)) {
             return false;
         }
     }
@@ -73,7 +148,7 @@ bool BackendDispatcher::get_device_drivers(core::Array<DriverInfo>& arr) {
 bool BackendDispatcher::get_file_drivers(core::Array<DriverInfo>& arr) {
     arr.resize(0);
     for (size_t n = 0; n < n_backends_; n++) {
-        if (!backends_[n]->get_drivers(arr, IBackend::FilterFile)) {
+        if (!resolve_backend_(backends_[n]).get_drivers(arr, IBackend::FilterFile)) {
             return false;
         }
     }
@@ -99,16 +174,38 @@ BackendDispatcher::select_backend_(const char* driver, const char* inout, int fl
 IBackend*
 BackendDispatcher::probe_backends_(const char* driver, const char* inout, int flags) {
     for (size_t n = 0; n < n_backends_; n++) {
-        if (backends_[n]->probe(driver, inout, flags)) {
-            return backends_[n];
+        IBackend& backend = resolve_backend_(backends_[n]);
+        if (backend.probe(driver, inout, flags)) {
+            return &backend;
         }
     }
     return NULL;
 }
 
-void BackendDispatcher::add_backend_(IBackend& backend) {
+IBackend& BackendDispatcher::resolve_backend_(BackendSlot& slot) {
+    core::Mutex::Lock lock(mutex_);
+
+    if (!slot.backend) {
+        slot.backend = &slot.factory();
+
+#ifdef ROC_TARGET_SOX
+        if (slot.factory == &sox_backend_factory && frame_size_ != 0) {
+            SoxBackend::instance().set_frame_size(frame_size_);
+        }
+#endif // ROC_TARGET_SOX
+    }
+
+    return *slot.backend;
+}
+
+void BackendDispatcher::add_backend_(BackendFactory factory) {
     roc_panic_if(n_backends_ == MaxBackends);
-    backends_[n_backends_++] = &backend;
+
+    BackendSlot slot;
+    slot.factory = factory;
+    slot.backend = NULL;
+
+    backends_[n_backends_++] = slot;
 }
 
 } // namespace sndio
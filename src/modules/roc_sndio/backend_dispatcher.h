@@ -14,6 +14,7 @@
 
 #include "roc_core/array.h"
 #include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/shared_ptr.h"
 #include "roc_core/singleton.h"
@@ -25,6 +26,11 @@ namespace roc {
 namespace sndio {
 
 //! Backend dispatcher.
+//! @remarks
+//!  Backends are initialized lazily: a backend singleton is created the
+//!  first time it's actually probed or asked for its drivers, so e.g.
+//!  libsox global initialization is skipped entirely in processes that
+//!  only ever use another backend.
 class BackendDispatcher : public core::NonCopyable<> {
 public:
     //! Get instance.
@@ -58,15 +64,28 @@ private:
 
     BackendDispatcher();
 
+    // Creates the backend singleton; called at most once per backend.
+    typedef IBackend& (*BackendFactory)();
+
+    struct BackendSlot {
+        BackendFactory factory;
+        IBackend* backend; // NULL until first used
+    };
+
     IBackend* select_backend_(const char* driver, const char* inout, int flags);
     IBackend* probe_backends_(const char* driver, const char* inout, int flags);
 
-    void add_backend_(IBackend& backend);
+    IBackend& resolve_backend_(BackendSlot& slot);
+    void add_backend_(BackendFactory factory);
 
     enum { MaxBackends = 8 };
 
-    IBackend* backends_[MaxBackends];
+    core::Mutex mutex_;
+
+    BackendSlot backends_[MaxBackends];
     size_t n_backends_;
+
+    size_t frame_size_;
 };
 
 } // namespace sndio
@@ -7,6 +7,7 @@
  */
 
 #include "roc_sndio/isink.h"
+#include "roc_core/panic.h"
 
 namespace roc {
 namespace sndio {
@@ -14,5 +15,17 @@ namespace sndio {
 ISink::~ISink() {
 }
 
+size_t ISink::preferred_frame_size() const {
+    return 0;
+}
+
+audio::sample_t* ISink::begin_write(size_t) {
+    return NULL;
+}
+
+void ISink::end_write(size_t) {
+    roc_panic("isink: end_write() called without begin_write()");
+}
+
 } // namespace sndio
 } // namespace roc
@@ -27,6 +27,28 @@ public:
 
     //! Check if the sink has own clock.
     virtual bool has_clock() const = 0;
+
+    //! Get preferred number of samples per frame.
+    //! @remarks
+    //!  Returns the native period of the underlying device in samples, or
+    //!  zero if the sink consumes frames of any size equally well. Used
+    //!  by the pump to negotiate a common frame size at setup, so that
+    //!  frames don't have to be split and re-buffered at the boundary.
+    virtual size_t preferred_frame_size() const;
+
+    //! Begin writing a frame directly into sink-owned memory.
+    //! @remarks
+    //!  Returns a buffer of @p size samples owned by the sink, or NULL if
+    //!  direct writing is not available at the moment; in the latter case
+    //!  the caller should fall back to write(). The returned buffer should
+    //!  be filled and committed with end_write() before the next call.
+    virtual audio::sample_t* begin_write(size_t size);
+
+    //! Commit or cancel a buffer obtained from begin_write().
+    //! @remarks
+    //!  @p size is the number of samples actually written, or zero to
+    //!  cancel the write.
+    virtual void end_write(size_t size);
 };
 
 } // namespace sndio
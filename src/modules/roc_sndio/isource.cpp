@@ -7,6 +7,7 @@
  */
 
 #include "roc_sndio/isource.h"
+#include "roc_core/panic.h"
 
 namespace roc {
 namespace sndio {
@@ -14,5 +15,17 @@ namespace sndio {
 ISource::~ISource() {
 }
 
+size_t ISource::preferred_frame_size() const {
+    return 0;
+}
+
+audio::sample_t* ISource::begin_read(size_t) {
+    return NULL;
+}
+
+void ISource::end_read() {
+    roc_panic("isource: end_read() called without begin_read()");
+}
+
 } // namespace sndio
 } // namespace roc
@@ -28,6 +28,14 @@ public:
     //! Check if the source has own clock.
     virtual bool has_clock() const = 0;
 
+    //! Get preferred number of samples per frame.
+    //! @remarks
+    //!  Returns the native period of the underlying device in samples, or
+    //!  zero if the source produces frames of any size equally well. Used
+    //!  by the pump to negotiate a common frame size at setup, so that
+    //!  frames don't have to be split and re-buffered at the boundary.
+    virtual size_t preferred_frame_size() const;
+
     //! Source state.
     enum State {
         //! Source is active and is producing some sound.
@@ -49,6 +57,18 @@ public:
     //! @returns
     //!  false if there is nothing to read anymore.
     virtual bool read(audio::Frame&) = 0;
+
+    //! Begin reading a frame directly from source-owned memory.
+    //! @remarks
+    //!  Returns a buffer of @p size samples owned by the source, filled
+    //!  with the next samples of the stream, or NULL if direct reading is
+    //!  not available at the moment; in the latter case the caller should
+    //!  fall back to read(). The returned buffer stays valid until it's
+    //!  released with end_read().
+    virtual audio::sample_t* begin_read(size_t size);
+
+    //! Release a buffer obtained from begin_read().
+    virtual void end_read();
 };
 
 } // namespace sndio
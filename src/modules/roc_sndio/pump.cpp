@@ -8,26 +8,94 @@
 
 #include "roc_sndio/pump.h"
 #include "roc_core/log.h"
+#include "roc_core/metrics_registry.h"
+#include "roc_core/panic.h"
 
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// Number of cycles between adaptive sizing decisions.
+const size_t AdaptCycles = 32;
+
+// Maximum growth factor of the adaptive frame size over the configured one.
+const size_t AdaptMaxFactor = 8;
+
+// Utilization thresholds for adaptive sizing. The gap between them gives
+// hysteresis: halving the frame size roughly doubles the overhead share,
+// so a shrink triggered below AdaptLowUtil can't immediately trigger a
+// grow above AdaptHighUtil, and the size doesn't flap.
+const double AdaptHighUtil = 0.5;
+const double AdaptLowUtil = 0.15;
+
+size_t gcd_size(size_t a, size_t b) {
+    while (b != 0) {
+        const size_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+} // namespace
+
 Pump::Pump(core::BufferPool<audio::sample_t>& buffer_pool,
            ISource& source,
            ISink& sink,
            size_t frame_size,
-           Mode mode)
+           Mode mode,
+           Threading threading,
+           Sizing sizing)
     : source_(source)
     , sink_(sink)
     , n_bufs_(0)
     , oneshot_(mode == ModeOneshot)
+    , pipelined_(threading == ThreadingPipelined)
+    , adaptive_(sizing == SizingAdaptive)
+    , cur_frame_size_(frame_size)
+    , min_frame_size_(frame_size)
+    , max_frame_size_(frame_size)
+    , prev_cycle_start_(0)
+    , accum_busy_(0)
+    , accum_cycle_(0)
+    , accum_cycles_(0)
+    , valid_(false)
+    , ring_cond_(ring_mutex_)
+    , ring_tail_(0)
+    , ring_size_(0)
+    , ring_eof_(false)
     , stop_(0) {
+    // agree with the source and the sink on a frame size that is an
+    // integral multiple of their native periods, so that frames don't
+    // have to be split and re-buffered at either boundary
+    frame_size = negotiate_frame_size_(frame_size, buffer_pool.buffer_size());
+
+    cur_frame_size_ = min_frame_size_ = max_frame_size_ = frame_size;
+
+    if (core::Atomic* metric =
+            core::MetricsRegistry::instance().find_or_add_counter("pump_frame_size")) {
+        metric->store_relaxed((long)frame_size);
+    }
+
     if (buffer_pool.buffer_size() < frame_size) {
         roc_log(LogError, "pump: buffer size is too small: required=%lu actual=%lu",
                 (unsigned long)frame_size, (unsigned long)buffer_pool.buffer_size());
         return;
     }
 
+    if (adaptive_ && pipelined_) {
+        roc_log(LogError, "pump: adaptive sizing requires serial threading");
+        return;
+    }
+
+    if (adaptive_) {
+        while (max_frame_size_ * 2 <= frame_size * AdaptMaxFactor
+               && max_frame_size_ * 2 <= buffer_pool.buffer_size()) {
+            max_frame_size_ *= 2;
+        }
+    }
+
     frame_buffer_ = new (buffer_pool) core::Buffer<audio::sample_t>(buffer_pool);
 
     if (!frame_buffer_) {
@@ -35,16 +103,185 @@ Pump::Pump(core::BufferPool<audio::sample_t>& buffer_pool,
         return;
     }
 
-    frame_buffer_.resize(frame_size);
+    frame_buffer_.resize(max_frame_size_);
+
+    if (pipelined_) {
+        for (size_t n = 0; n < NumRingFrames; n++) {
+            ring_frames_[n] =
+                new (buffer_pool) core::Buffer<audio::sample_t>(buffer_pool);
+
+            if (!ring_frames_[n]) {
+                roc_log(LogError, "pump: can't allocate ring frame");
+                return;
+            }
+
+            ring_frames_[n].resize(frame_size);
+        }
+    }
+
+    valid_ = true;
 }
 
 bool Pump::valid() const {
-    return frame_buffer_;
+    return valid_;
+}
+
+size_t Pump::negotiate_frame_size_(size_t frame_size, size_t max_size) const {
+    const size_t source_period = source_.preferred_frame_size();
+    const size_t sink_period = sink_.preferred_frame_size();
+
+    // the smallest size that is an integral multiple of both periods
+    size_t step = 1;
+    if (source_period != 0) {
+        step = source_period;
+    }
+    if (sink_period != 0) {
+        step = step / gcd_size(step, sink_period) * sink_period;
+    }
+
+    if (step <= 1) {
+        return frame_size;
+    }
+
+    if (step > max_size) {
+        roc_log(LogInfo,
+                "pump: can't align frame size to endpoint periods:"
+                " frame_size=%lu source_period=%lu sink_period=%lu buffer_size=%lu",
+                (unsigned long)frame_size, (unsigned long)source_period,
+                (unsigned long)sink_period, (unsigned long)max_size);
+        return frame_size;
+    }
+
+    // nearest multiple of the step, clamped to the frame buffer size
+    size_t aligned = (frame_size + step / 2) / step * step;
+    if (aligned < step) {
+        aligned = step;
+    }
+    while (aligned > max_size) {
+        aligned -= step;
+    }
+
+    if (aligned != frame_size) {
+        roc_log(LogInfo,
+                "pump: negotiated frame size:"
+                " configured=%lu aligned=%lu source_period=%lu sink_period=%lu",
+                (unsigned long)frame_size, (unsigned long)aligned,
+                (unsigned long)source_period, (unsigned long)sink_period);
+    }
+
+    return aligned;
 }
 
 bool Pump::run() {
+    if (pipelined_) {
+        return run_pipelined_();
+    }
+
+    return run_serial_();
+}
+
+void Pump::stop() {
+    stop_ = 1;
+
+    core::Mutex::Lock lock(ring_mutex_);
+    ring_cond_.broadcast();
+}
+
+bool Pump::run_serial_() {
     roc_log(LogDebug, "pump: starting main loop");
 
+    if (adaptive_ && !source_.has_clock() && !sink_.has_clock()) {
+        // without a clock-driven endpoint there is no cycle period to
+        // measure headroom against
+        roc_log(LogInfo,
+                "pump: neither source nor sink is clock-driven,"
+                " disabling adaptive frame sizing");
+        adaptive_ = false;
+    }
+
+    while (!stop_) {
+        if (source_.state() == ISource::Inactive) {
+            if (oneshot_ && n_bufs_ != 0) {
+                roc_log(LogInfo, "pump: got inactive status in oneshot mode");
+                break;
+            }
+        } else {
+            n_bufs_++;
+        }
+
+        // sampled once per cycle and passed down with the frame, so that
+        // per-frame consumers in the pipeline don't repeat the clock call
+        const core::nanoseconds_t t_start = core::timestamp();
+        core::nanoseconds_t t_read = 0;
+
+        // render the frame directly into the sink memory when the sink
+        // supports it; otherwise hand the source memory directly to the
+        // sink when the source supports it; fall back to an intermediate
+        // buffer when neither side does
+        if (audio::sample_t* sink_buf = sink_.begin_write(cur_frame_size_)) {
+            audio::Frame frame(sink_buf, cur_frame_size_);
+            frame.set_cycle_time(t_start);
+            if (!source_.read(frame)) {
+                sink_.end_write(0);
+                roc_log(LogDebug, "pump: got eof from source");
+                break;
+            }
+            if (adaptive_) {
+                t_read = core::timestamp();
+            }
+            sink_.end_write(cur_frame_size_);
+        } else if (audio::sample_t* source_buf = source_.begin_read(cur_frame_size_)) {
+            if (adaptive_) {
+                t_read = core::timestamp();
+            }
+            audio::Frame frame(source_buf, cur_frame_size_);
+            frame.set_cycle_time(t_start);
+            sink_.write(frame);
+            source_.end_read();
+        } else {
+            audio::Frame frame(frame_buffer_.data(), cur_frame_size_);
+            frame.set_cycle_time(t_start);
+            if (!source_.read(frame)) {
+                roc_log(LogDebug, "pump: got eof from source");
+                break;
+            }
+            if (adaptive_) {
+                t_read = core::timestamp();
+            }
+            sink_.write(frame);
+        }
+
+        if (adaptive_) {
+            // the clock-driven endpoint absorbs the idle part of the cycle
+            // inside its blocking call, so processing time is the time
+            // spent on the other side of the pump
+            const core::nanoseconds_t busy = sink_.has_clock()
+                ? (t_read - t_start)
+                : (core::timestamp() - t_read);
+
+            update_sizing_(t_start, busy);
+        }
+    }
+
+    roc_log(LogDebug, "pump: exiting main loop, wrote %lu buffers",
+            (unsigned long)n_bufs_);
+
+    return !stop_;
+}
+
+bool Pump::run_pipelined_() {
+    roc_log(LogDebug, "pump: starting pipelined main loop");
+
+    SinkThread sink_thread(*this);
+
+    core::ThreadConfig thread_config;
+    thread_config.name = "roc-pump-sink";
+
+    if (!sink_thread.start(thread_config)) {
+        roc_log(LogError, "pump: can't start sink thread");
+        return false;
+    }
+
     while (!stop_) {
         if (source_.state() == ISource::Inactive) {
             if (oneshot_ && n_bufs_ != 0) {
@@ -55,23 +292,123 @@ bool Pump::run() {
             n_bufs_++;
         }
 
-        audio::Frame frame(frame_buffer_.data(), frame_buffer_.size());
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            while (ring_size_ == NumRingFrames && !stop_) {
+                ring_cond_.wait();
+            }
+
+            if (stop_) {
+                break;
+            }
+
+            slot = (ring_tail_ + ring_size_) % NumRingFrames;
+        }
+
+        // the slot is owned exclusively by this thread until it's
+        // published below, so the source can fill it without the lock
+        audio::Frame frame(ring_frames_[slot].data(), ring_frames_[slot].size());
+        frame.set_cycle_time(core::timestamp());
         if (!source_.read(frame)) {
             roc_log(LogDebug, "pump: got eof from source");
             break;
         }
 
-        sink_.write(frame);
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            ring_size_++;
+            ring_cond_.broadcast();
+        }
     }
 
-    roc_log(LogDebug, "pump: exiting main loop, wrote %lu buffers",
+    {
+        core::Mutex::Lock lock(ring_mutex_);
+
+        ring_eof_ = true;
+        ring_cond_.broadcast();
+    }
+
+    sink_thread.join();
+
+    roc_log(LogDebug, "pump: exiting pipelined main loop, wrote %lu buffers",
             (unsigned long)n_bufs_);
 
     return !stop_;
 }
 
-void Pump::stop() {
-    stop_ = 1;
+void Pump::update_sizing_(core::nanoseconds_t cycle_start,
+                          core::nanoseconds_t busy_time) {
+    if (prev_cycle_start_ != 0) {
+        accum_busy_ += busy_time;
+        accum_cycle_ += cycle_start - prev_cycle_start_;
+        accum_cycles_++;
+    }
+    prev_cycle_start_ = cycle_start;
+
+    if (accum_cycles_ < AdaptCycles || accum_cycle_ <= 0) {
+        return;
+    }
+
+    const double util = (double)accum_busy_ / (double)accum_cycle_;
+
+    accum_busy_ = 0;
+    accum_cycle_ = 0;
+    accum_cycles_ = 0;
+
+    size_t new_size = cur_frame_size_;
+
+    if (util > AdaptHighUtil && cur_frame_size_ * 2 <= max_frame_size_) {
+        // per-frame overhead eats too much of the cycle: larger frames
+        // amortize it over more samples
+        new_size = cur_frame_size_ * 2;
+    } else if (util < AdaptLowUtil && cur_frame_size_ / 2 >= min_frame_size_) {
+        // plenty of headroom: shrink back towards the configured size
+        // to recover latency
+        new_size = cur_frame_size_ / 2;
+    }
+
+    if (new_size != cur_frame_size_) {
+        roc_log(LogDebug, "pump: adapting frame size: %lu -> %lu samples (util=%.3f)",
+                (unsigned long)cur_frame_size_, (unsigned long)new_size, util);
+
+        cur_frame_size_ = new_size;
+    }
+}
+
+void Pump::sink_loop_() {
+    for (;;) {
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            while (ring_size_ == 0 && !ring_eof_ && !stop_) {
+                ring_cond_.wait();
+            }
+
+            if (stop_ || ring_size_ == 0) {
+                break;
+            }
+
+            slot = ring_tail_;
+        }
+
+        audio::Frame frame(ring_frames_[slot].data(), ring_frames_[slot].size());
+        frame.set_cycle_time(core::timestamp());
+        sink_.write(frame);
+
+        {
+            core::Mutex::Lock lock(ring_mutex_);
+
+            ring_tail_ = (ring_tail_ + 1) % NumRingFrames;
+            ring_size_--;
+            ring_cond_.broadcast();
+        }
+    }
 }
 
 } // namespace sndio
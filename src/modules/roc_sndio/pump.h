@@ -14,9 +14,13 @@
 
 #include "roc_core/atomic.h"
 #include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
+#include "roc_core/mutex.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/slice.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
 #include "roc_sndio/isink.h"
 #include "roc_sndio/isource.h"
 
@@ -37,12 +41,45 @@ public:
         ModeOneshot = 1
     };
 
+    //! Pump threading.
+    enum Threading {
+        //! Read and write frames in turn on the thread calling run().
+        ThreadingSerial = 0,
+
+        //! Overlap source reads and sink writes using a second thread.
+        //! @remarks
+        //!  Frames are read on the thread calling run() and handed to the
+        //!  sink through a small ring of pre-allocated buffers, so that
+        //!  the pipeline keeps working while the sink blocks on the device
+        //!  and smaller device periods can be used without underruns.
+        ThreadingPipelined = 1
+    };
+
+    //! Pump frame sizing.
+    enum Sizing {
+        //! Use the configured frame size for the whole run.
+        SizingFixed = 0,
+
+        //! Adapt frame size to measured headroom.
+        //! @remarks
+        //!  Per-cycle processing time is measured against the cycle period
+        //!  dictated by the device clock, and the frame size is doubled or
+        //!  halved within bounds: small frames keep latency low but pay
+        //!  per-frame overhead on every cycle, so when the measured
+        //!  utilization is high the frames grow, and when plenty of
+        //!  headroom remains they shrink back towards the configured size.
+        //!  Requires a clock-driven source or sink and serial threading.
+        SizingAdaptive = 1
+    };
+
     //! Initialize.
     Pump(core::BufferPool<audio::sample_t>& buffer_pool,
          ISource& source,
          ISink& sink,
          size_t frame_size,
-         Mode mode);
+         Mode mode,
+         Threading threading = ThreadingSerial,
+         Sizing sizing = SizingFixed);
 
     //! Check if the object was successfulyl constructed.
     bool valid() const;
@@ -59,13 +96,68 @@ public:
     void stop();
 
 private:
+    enum { NumRingFrames = 4 };
+
+    class SinkThread : public core::Thread {
+    public:
+        SinkThread(Pump& pump)
+            : pump_(pump) {
+        }
+
+    private:
+        virtual void run() {
+            pump_.sink_loop_();
+        }
+
+        Pump& pump_;
+    };
+
+    size_t negotiate_frame_size_(size_t frame_size, size_t max_size) const;
+
+    bool run_serial_();
+    bool run_pipelined_();
+
+    void sink_loop_();
+
+    void update_sizing_(core::nanoseconds_t cycle_start, core::nanoseconds_t busy_time);
+
     ISource& source_;
     ISink& sink_;
 
     core::Slice<audio::sample_t> frame_buffer_;
+    core::Slice<audio::sample_t> ring_frames_[NumRingFrames];
 
     size_t n_bufs_;
     const bool oneshot_;
+    const bool pipelined_;
+
+    //! True if frame size is adapted to measured headroom.
+    bool adaptive_;
+
+    //! Current frame size, always configured size times a power of two.
+    size_t cur_frame_size_;
+
+    //! Sizing bounds: the configured size and the largest multiple of it
+    //! that fits the frame buffer.
+    size_t min_frame_size_;
+    size_t max_frame_size_;
+
+    //! Start of the previous cycle, for measuring the cycle period.
+    core::nanoseconds_t prev_cycle_start_;
+
+    //! Busy and total time accumulated since the last sizing decision.
+    core::nanoseconds_t accum_busy_;
+    core::nanoseconds_t accum_cycle_;
+    size_t accum_cycles_;
+
+    bool valid_;
+
+    core::Mutex ring_mutex_;
+    core::Cond ring_cond_;
+
+    size_t ring_tail_;
+    size_t ring_size_;
+    bool ring_eof_;
 
     core::Atomic stop_;
 };
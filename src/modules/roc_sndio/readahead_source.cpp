@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/readahead_source.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+ReadaheadSource::ReadaheadSource(core::IAllocator& allocator,
+                                 core::BufferPool<audio::sample_t>& buffer_pool,
+                                 ISource& source,
+                                 size_t frame_size,
+                                 size_t n_frames)
+    : source_(source)
+    , frames_(allocator)
+    , n_frames_(n_frames)
+    , cond_(mutex_)
+    , ring_tail_(0)
+    , ring_size_(0)
+    , ring_eof_(false)
+    , tail_pos_(0)
+    , stop_(0)
+    , valid_(false) {
+    if (n_frames_ == 0) {
+        roc_log(LogError, "readahead source: # of frames is zero");
+        return;
+    }
+
+    if (buffer_pool.buffer_size() < frame_size) {
+        roc_log(LogError,
+                "readahead source: buffer size is too small: required=%lu actual=%lu",
+                (unsigned long)frame_size, (unsigned long)buffer_pool.buffer_size());
+        return;
+    }
+
+    if (!frames_.resize(n_frames_)) {
+        roc_log(LogError, "readahead source: can't allocate frame array");
+        return;
+    }
+
+    for (size_t n = 0; n < n_frames_; n++) {
+        frames_[n] = new (buffer_pool) core::Buffer<audio::sample_t>(buffer_pool);
+
+        if (!frames_[n]) {
+            roc_log(LogError, "readahead source: can't allocate frame buffer");
+            return;
+        }
+
+        frames_[n].resize(frame_size);
+    }
+
+    core::ThreadConfig thread_config;
+    thread_config.name = "roc-readahead";
+
+    if (!start(thread_config)) {
+        roc_log(LogError, "readahead source: can't start prefetch thread");
+        return;
+    }
+
+    valid_ = true;
+}
+
+ReadaheadSource::~ReadaheadSource() {
+    stop_ = 1;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+        cond_.broadcast();
+    }
+
+    if (joinable()) {
+        join();
+    }
+}
+
+bool ReadaheadSource::valid() const {
+    return valid_;
+}
+
+size_t ReadaheadSource::sample_rate() const {
+    return source_.sample_rate();
+}
+
+bool ReadaheadSource::has_clock() const {
+    return source_.has_clock();
+}
+
+size_t ReadaheadSource::preferred_frame_size() const {
+    return source_.preferred_frame_size();
+}
+
+ISource::State ReadaheadSource::state() const {
+    return source_.state();
+}
+
+void ReadaheadSource::wait_active() const {
+    source_.wait_active();
+}
+
+bool ReadaheadSource::read(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    audio::sample_t* out = frame.data();
+    size_t out_pos = 0;
+
+    while (out_pos < frame.size()) {
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            while (ring_size_ == 0 && !ring_eof_ && !stop_) {
+                cond_.wait();
+            }
+
+            if (stop_ || ring_size_ == 0) {
+                break;
+            }
+
+            slot = ring_tail_;
+        }
+
+        // the tail slot is owned exclusively by this thread until it's
+        // released below, so the copy doesn't need the lock
+        const core::Slice<audio::sample_t>& buf = frames_[slot];
+
+        size_t n_samples = buf.size() - tail_pos_;
+        if (n_samples > frame.size() - out_pos) {
+            n_samples = frame.size() - out_pos;
+        }
+
+        memcpy(out + out_pos, buf.data() + tail_pos_,
+               n_samples * sizeof(audio::sample_t));
+
+        out_pos += n_samples;
+        tail_pos_ += n_samples;
+
+        if (tail_pos_ == buf.size()) {
+            tail_pos_ = 0;
+
+            core::Mutex::Lock lock(mutex_);
+
+            ring_tail_ = (ring_tail_ + 1) % n_frames_;
+            ring_size_--;
+            cond_.broadcast();
+        }
+    }
+
+    if (out_pos == 0) {
+        return false;
+    }
+
+    // the last frame before eof is padded with silence
+    if (out_pos < frame.size()) {
+        memset(out + out_pos, 0, (frame.size() - out_pos) * sizeof(audio::sample_t));
+    }
+
+    return true;
+}
+
+audio::sample_t* ReadaheadSource::begin_read(size_t size) {
+    roc_panic_if(!valid());
+
+    size_t slot = 0;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        while (ring_size_ == 0 && !ring_eof_ && !stop_) {
+            cond_.wait();
+        }
+
+        if (stop_ || ring_size_ == 0) {
+            return NULL;
+        }
+
+        slot = ring_tail_;
+    }
+
+    // a partially consumed or differently sized tail frame can't be
+    // handed out whole; read() resumes from the stored position
+    if (tail_pos_ != 0 || frames_[slot].size() != size) {
+        return NULL;
+    }
+
+    // the tail slot is owned exclusively by this thread until it's
+    // released in end_read(), so the caller doesn't need the lock
+    return frames_[slot].data();
+}
+
+void ReadaheadSource::end_read() {
+    core::Mutex::Lock lock(mutex_);
+
+    ring_tail_ = (ring_tail_ + 1) % n_frames_;
+    ring_size_--;
+    cond_.broadcast();
+}
+
+void ReadaheadSource::run() {
+    roc_log(LogDebug, "readahead source: starting prefetch thread");
+
+    while (!stop_) {
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            while (ring_size_ == n_frames_ && !stop_) {
+                cond_.wait();
+            }
+
+            if (stop_) {
+                break;
+            }
+
+            slot = (ring_tail_ + ring_size_) % n_frames_;
+        }
+
+        // the slot is owned exclusively by this thread until it's
+        // published below, so the source can fill it without the lock
+        audio::Frame frame(frames_[slot].data(), frames_[slot].size());
+        if (!source_.read(frame)) {
+            roc_log(LogDebug, "readahead source: got eof from source");
+            break;
+        }
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            ring_size_++;
+            cond_.broadcast();
+        }
+    }
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        ring_eof_ = true;
+        cond_.broadcast();
+    }
+
+    roc_log(LogDebug, "readahead source: exiting prefetch thread");
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/readahead_source.h
+//! @brief Readahead source.
+
+#ifndef ROC_SNDIO_READAHEAD_SOURCE_H_
+#define ROC_SNDIO_READAHEAD_SOURCE_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! Readahead source.
+//! @remarks
+//!  Decorator for another source. A prefetch thread keeps up to the
+//!  configured number of frames decoded ahead in a ring, so that a
+//!  latency spike in the underlying source, e.g. a storage stall when
+//!  reading from a network file system, is absorbed by the ring instead
+//!  of blocking the thread that consumes the samples.
+//!
+//!  Intended for file sources without own clock; for a device source
+//!  the readahead would only add latency.
+class ReadaheadSource : public ISource,
+                        private core::Thread,
+                        private core::NonCopyable<> {
+public:
+    //! Initialize and start the prefetch thread.
+    //!
+    //! @b Parameters
+    //!  - @p n_frames defines the ring size, i.e. how many frames may be
+    //!    decoded ahead of the consumer.
+    ReadaheadSource(core::IAllocator& allocator,
+                    core::BufferPool<audio::sample_t>& buffer_pool,
+                    ISource& source,
+                    size_t frame_size,
+                    size_t n_frames);
+
+    //! Stop and join the prefetch thread.
+    virtual ~ReadaheadSource();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Get sample rate of the underlying source.
+    virtual size_t sample_rate() const;
+
+    //! Check if the underlying source has own clock.
+    virtual bool has_clock() const;
+
+    //! Get preferred frame size of the underlying source.
+    virtual size_t preferred_frame_size() const;
+
+    //! Get current state of the underlying source.
+    virtual State state() const;
+
+    //! Wait until the underlying source state becomes active.
+    virtual void wait_active() const;
+
+    //! Read frame.
+    //! @remarks
+    //!  Copies prefetched samples from the ring. Blocks only if the
+    //!  prefetch thread has fallen behind and the ring is empty.
+    virtual bool read(audio::Frame&);
+
+    //! Begin reading a frame directly from the ring.
+    //! @remarks
+    //!  Hands out the frame at the ring tail without copying, when it's
+    //!  unconsumed and matches the requested size; otherwise the caller
+    //!  falls back to read().
+    virtual audio::sample_t* begin_read(size_t size);
+
+    //! Release the ring frame obtained from begin_read().
+    virtual void end_read();
+
+private:
+    virtual void run();
+
+    ISource& source_;
+
+    core::Array<core::Slice<audio::sample_t> > frames_;
+    size_t n_frames_;
+
+    core::Mutex mutex_;
+    core::Cond cond_;
+
+    size_t ring_tail_;
+    size_t ring_size_;
+    bool ring_eof_;
+
+    // read position in the frame at the ring tail
+    size_t tail_pos_;
+
+    core::Atomic stop_;
+
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_READAHEAD_SOURCE_H_
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_sndio/splitter_sink.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+
+namespace roc {
+namespace sndio {
+
+SplitterSink::Output::Output(ISink& sink,
+                             core::BufferPool<audio::sample_t>& buffer_pool,
+                             size_t frame_size,
+                             size_t n_frames,
+                             core::IAllocator& allocator)
+    : sink_(sink)
+    , frames_(allocator)
+    , frame_sizes_(allocator)
+    , n_frames_(n_frames)
+    , cond_(mutex_)
+    , ring_tail_(0)
+    , ring_size_(0)
+    , n_dropped_(0)
+    , stop_(0)
+    , valid_(false) {
+    if (!frames_.resize(n_frames_) || !frame_sizes_.resize(n_frames_)) {
+        roc_log(LogError, "splitter sink: can't allocate frame array");
+        return;
+    }
+
+    for (size_t n = 0; n < n_frames_; n++) {
+        frames_[n] = new (buffer_pool) core::Buffer<audio::sample_t>(buffer_pool);
+
+        if (!frames_[n]) {
+            roc_log(LogError, "splitter sink: can't allocate frame buffer");
+            return;
+        }
+
+        frames_[n].resize(frame_size);
+    }
+
+    core::ThreadConfig thread_config;
+    thread_config.name = "roc-splitter";
+
+    if (!start(thread_config)) {
+        roc_log(LogError, "splitter sink: can't start output thread");
+        return;
+    }
+
+    valid_ = true;
+}
+
+SplitterSink::Output::~Output() {
+    stop();
+
+    if (n_dropped_ != 0) {
+        roc_log(LogInfo, "splitter sink: dropped %lu frames for lagging sink",
+                (unsigned long)n_dropped_);
+    }
+}
+
+bool SplitterSink::Output::valid() const {
+    return valid_;
+}
+
+ISink& SplitterSink::Output::sink() {
+    return sink_;
+}
+
+void SplitterSink::Output::push(const audio::sample_t* data, size_t size) {
+    size_t slot = 0;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        if (ring_size_ == n_frames_) {
+            // this sink has fallen behind; drop the frame for it instead
+            // of stalling the pipeline and the other sinks
+            if (n_dropped_++ == 0) {
+                roc_log(LogDebug, "splitter sink: ring is full, dropping frames");
+            }
+            return;
+        }
+
+        slot = (ring_tail_ + ring_size_) % n_frames_;
+    }
+
+    // the slot is owned exclusively by this thread until it's published
+    // below, so the copy doesn't need the lock
+    memcpy(frames_[slot].data(), data, size * sizeof(audio::sample_t));
+    frame_sizes_[slot] = size;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+
+        ring_size_++;
+        cond_.broadcast();
+    }
+}
+
+void SplitterSink::Output::stop() {
+    stop_ = 1;
+
+    {
+        core::Mutex::Lock lock(mutex_);
+        cond_.broadcast();
+    }
+
+    if (joinable()) {
+        join();
+    }
+}
+
+void SplitterSink::Output::run() {
+    for (;;) {
+        size_t slot = 0;
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            while (ring_size_ == 0 && !stop_) {
+                cond_.wait();
+            }
+
+            if (ring_size_ == 0 && stop_) {
+                return;
+            }
+
+            slot = ring_tail_;
+        }
+
+        // the tail slot is owned exclusively by this thread until it's
+        // released below, so the sink write doesn't need the lock
+        audio::Frame frame(frames_[slot].data(), frame_sizes_[slot]);
+        sink_.write(frame);
+
+        {
+            core::Mutex::Lock lock(mutex_);
+
+            ring_tail_ = (ring_tail_ + 1) % n_frames_;
+            ring_size_--;
+            cond_.broadcast();
+        }
+    }
+}
+
+SplitterSink::SplitterSink(core::IAllocator& allocator,
+                           core::BufferPool<audio::sample_t>& buffer_pool,
+                           size_t frame_size,
+                           size_t n_frames)
+    : allocator_(allocator)
+    , buffer_pool_(buffer_pool)
+    , frame_size_(frame_size)
+    , n_frames_(n_frames)
+    , outputs_(allocator)
+    , valid_(false) {
+    if (frame_size_ == 0 || n_frames_ == 0) {
+        roc_log(LogError, "splitter sink: frame size or # of frames is zero");
+        return;
+    }
+
+    if (buffer_pool.buffer_size() < frame_size) {
+        roc_log(LogError,
+                "splitter sink: buffer size is too small: required=%lu actual=%lu",
+                (unsigned long)frame_size, (unsigned long)buffer_pool.buffer_size());
+        return;
+    }
+
+    valid_ = true;
+}
+
+SplitterSink::~SplitterSink() {
+    for (size_t n = 0; n < outputs_.size(); n++) {
+        allocator_.destroy(*outputs_[n]);
+    }
+}
+
+bool SplitterSink::valid() const {
+    return valid_;
+}
+
+bool SplitterSink::add_output(ISink& sink) {
+    roc_panic_if(!valid());
+
+    Output* output =
+        new (allocator_) Output(sink, buffer_pool_, frame_size_, n_frames_, allocator_);
+
+    if (!output) {
+        roc_log(LogError, "splitter sink: can't allocate output");
+        return false;
+    }
+
+    if (!output->valid()) {
+        allocator_.destroy(*output);
+        return false;
+    }
+
+    if (!outputs_.grow(outputs_.size() + 1)) {
+        allocator_.destroy(*output);
+        roc_log(LogError, "splitter sink: can't grow output array");
+        return false;
+    }
+
+    outputs_.push_back(output);
+
+    return true;
+}
+
+size_t SplitterSink::sample_rate() const {
+    roc_panic_if(outputs_.size() == 0);
+
+    return outputs_[0]->sink().sample_rate();
+}
+
+bool SplitterSink::has_clock() const {
+    roc_panic_if(outputs_.size() == 0);
+
+    return outputs_[0]->sink().has_clock();
+}
+
+void SplitterSink::write(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    // oversized frames are split, so that a ring slot always fits a chunk
+    for (size_t off = 0; off < frame.size(); off += frame_size_) {
+        size_t chunk = frame.size() - off;
+        if (chunk > frame_size_) {
+            chunk = frame_size_;
+        }
+
+        for (size_t n = 0; n < outputs_.size(); n++) {
+            outputs_[n]->push(frame.data() + off, chunk);
+        }
+    }
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/splitter_sink.h
+//! @brief Splitter sink.
+
+#ifndef ROC_SNDIO_SPLITTER_SINK_H_
+#define ROC_SNDIO_SPLITTER_SINK_H_
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/slice.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/thread.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! Splitter sink.
+//! @remarks
+//!  Fans one decoded stream out to multiple sinks, so that e.g. a device
+//!  output, a file recorder, and a network re-send all consume a single
+//!  receiver pipeline instead of each running its own. Every frame
+//!  written to the splitter is copied into a per-sink ring drained by a
+//!  dedicated thread, so the timing of one sink doesn't affect the
+//!  others; if a sink falls behind until its ring is full, frames are
+//!  dropped for that sink only.
+//!
+//!  The first added sink is the primary one: its clock and sample rate
+//!  are reported to the pump, so its timing drives the pipeline.
+class SplitterSink : public ISink, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    //!
+    //! @b Parameters
+    //!  - @p frame_size is the maximum number of samples per write
+    //!  - @p n_frames defines the per-sink ring size, i.e. how far the
+    //!    slowest sink may fall behind before its frames are dropped
+    SplitterSink(core::IAllocator& allocator,
+                 core::BufferPool<audio::sample_t>& buffer_pool,
+                 size_t frame_size,
+                 size_t n_frames);
+
+    //! Stop and join all output threads.
+    ~SplitterSink();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Add an output sink and start its thread.
+    //! @remarks
+    //!  Should be called before the first write(). The first added sink
+    //!  becomes the primary one.
+    bool add_output(ISink& sink);
+
+    //! Get sample rate of the primary sink.
+    virtual size_t sample_rate() const;
+
+    //! Check if the primary sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write audio frame.
+    //! @remarks
+    //!  Copies the frame into every per-sink ring and returns without
+    //!  waiting for the sinks.
+    virtual void write(audio::Frame& frame);
+
+private:
+    // Per-sink ring and its draining thread.
+    class Output : public core::Thread, public core::NonCopyable<> {
+    public:
+        Output(ISink& sink,
+               core::BufferPool<audio::sample_t>& buffer_pool,
+               size_t frame_size,
+               size_t n_frames,
+               core::IAllocator& allocator);
+        ~Output();
+
+        bool valid() const;
+
+        ISink& sink();
+
+        void push(const audio::sample_t* data, size_t size);
+        void stop();
+
+    private:
+        virtual void run();
+
+        ISink& sink_;
+
+        core::Array<core::Slice<audio::sample_t> > frames_;
+        core::Array<size_t> frame_sizes_;
+        size_t n_frames_;
+
+        core::Mutex mutex_;
+        core::Cond cond_;
+
+        size_t ring_tail_;
+        size_t ring_size_;
+
+        size_t n_dropped_;
+
+        core::Atomic stop_;
+        bool valid_;
+    };
+
+    core::IAllocator& allocator_;
+    core::BufferPool<audio::sample_t>& buffer_pool_;
+
+    const size_t frame_size_;
+    const size_t n_frames_;
+
+    core::Array<Output*> outputs_;
+
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_SPLITTER_SINK_H_
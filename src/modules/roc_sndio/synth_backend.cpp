@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_sndio/synth_backend.h"
+#include "roc_sndio/synth_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const char* SynthPrefix = "synth://";
+
+// returns the signal spec if the driver/input pair selects this backend,
+// NULL otherwise
+const char* match_synth(const char* driver, const char* inout) {
+    if (driver) {
+        if (strcmp(driver, "synth") != 0) {
+            return NULL;
+        }
+        return inout;
+    }
+
+    if (inout && strncmp(inout, SynthPrefix, strlen(SynthPrefix)) == 0) {
+        return inout + strlen(SynthPrefix);
+    }
+
+    return NULL;
+}
+
+} // namespace
+
+SynthBackend::SynthBackend() {
+    roc_log(LogDebug, "initializing synth backend");
+}
+
+bool SynthBackend::probe(const char* driver, const char* inout, int filter_flags) {
+    if ((filter_flags & FilterSource) == 0) {
+        return false;
+    }
+
+    return match_synth(driver, inout) != NULL;
+}
+
+ISink* SynthBackend::open_sink(core::IAllocator& allocator,
+                               const char* driver,
+                               const char* output,
+                               const Config& config) {
+    (void)allocator;
+    (void)driver;
+    (void)output;
+    (void)config;
+
+    roc_log(LogError, "synth backend: sinks are not supported");
+    return NULL;
+}
+
+ISource* SynthBackend::open_source(core::IAllocator& allocator,
+                                   const char* driver,
+                                   const char* input,
+                                   const Config& config) {
+    const char* spec = match_synth(driver, input);
+    if (!spec) {
+        return NULL;
+    }
+
+    core::UniquePtr<SynthSource> source(new (allocator) SynthSource(allocator, config),
+                                        allocator);
+    if (!source) {
+        return NULL;
+    }
+
+    if (!source->open(spec)) {
+        return NULL;
+    }
+
+    return source.release();
+}
+
+bool SynthBackend::get_drivers(core::Array<DriverInfo>& arr, int filter_flags) {
+    if (filter_flags & FilterFile) {
+        if (!add_driver_uniq(arr, "synth")) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/synth_backend.h
+//! @brief Synth backend.
+
+#ifndef ROC_SNDIO_SYNTH_BACKEND_H_
+#define ROC_SNDIO_SYNTH_BACKEND_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_core/singleton.h"
+#include "roc_sndio/ibackend.h"
+
+namespace roc {
+namespace sndio {
+
+//! Synth backend.
+//! @remarks
+//!  Provides generated test signals as sources, selected with the "synth"
+//!  driver or a "synth://" input, e.g. "synth://sine/1000". Used to drive
+//!  sender pipelines at maximum rate with negligible source cost, so that
+//!  pipeline benchmarks and soak tests don't depend on input files or the
+//!  decoding backends. Has no sinks.
+class SynthBackend : public IBackend, core::NonCopyable<> {
+public:
+    //! Get instance.
+    static SynthBackend& instance() {
+        return core::Singleton<SynthBackend>::instance();
+    }
+
+    //! Check whether the backend can handle given input or output.
+    virtual bool probe(const char* driver, const char* inout, int flags);
+
+    //! Create and open a sink.
+    virtual ISink* open_sink(core::IAllocator& allocator,
+                             const char* driver,
+                             const char* output,
+                             const Config& config);
+
+    //! Create and open a source.
+    virtual ISource* open_source(core::IAllocator& allocator,
+                                 const char* driver,
+                                 const char* input,
+                                 const Config& config);
+
+    //! Append supported dirvers to the list.
+    virtual bool get_drivers(core::Array<DriverInfo>& arr, int filter_flags);
+
+private:
+    friend class core::Singleton<SynthBackend>;
+
+    SynthBackend();
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_SYNTH_BACKEND_H_
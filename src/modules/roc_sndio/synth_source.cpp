@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_audio/units.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/synth_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const size_t DefaultSampleRate = 44100;
+const size_t DefaultChannels = 2;
+
+const float DefaultSineFrequency = 440;
+const float SweepLowFrequency = 20;
+const float SweepDuration = 10; // seconds
+
+const float Pi = 3.14159265358979323846f;
+
+// signal amplitude relative to full scale, leaving headroom so that the
+// pipeline under test never sees clipped input
+const float Amplitude = 0.5f;
+
+} // namespace
+
+SynthSource::SynthSource(core::IAllocator& allocator, const Config& config)
+    : signal_(Sig_None)
+    , sample_rate_(config.sample_rate != 0 ? config.sample_rate : DefaultSampleRate)
+    , n_channels_(packet::num_channels(config.channels) != 0
+                      ? packet::num_channels(config.channels)
+                      : DefaultChannels)
+    , frequency_(0)
+    , phase_(0)
+    , sweep_freq_(0)
+    , sweep_step_(0)
+    , noise_state_(1) {
+    (void)allocator;
+}
+
+bool SynthSource::open(const char* input) {
+    if (signal_ != Sig_None) {
+        roc_panic("synth source: can't call open() twice");
+    }
+
+    if (!input) {
+        roc_log(LogError, "synth source: signal spec is null");
+        return false;
+    }
+
+    char name[16] = {};
+    float frequency = 0;
+
+    const char* slash = strchr(input, '/');
+    const size_t name_len = slash ? size_t(slash - input) : strlen(input);
+
+    if (name_len == 0 || name_len > sizeof(name) - 1) {
+        roc_log(LogError, "synth source: bad signal spec: %s", input);
+        return false;
+    }
+    memcpy(name, input, name_len);
+
+    if (slash) {
+        char* end = NULL;
+        frequency = (float)strtod(slash + 1, &end);
+        if (!end || *end || frequency <= 0 || frequency >= (float)sample_rate_ / 2) {
+            roc_log(LogError,
+                    "synth source: bad frequency: expected a number in (0; %lu): %s",
+                    (unsigned long)(sample_rate_ / 2), input);
+            return false;
+        }
+    }
+
+    if (strcmp(name, "sine") == 0) {
+        signal_ = Sig_Sine;
+        frequency_ = frequency != 0 ? frequency : DefaultSineFrequency;
+    } else if (strcmp(name, "sweep") == 0) {
+        signal_ = Sig_Sweep;
+        frequency_ = frequency != 0 ? frequency : (float)sample_rate_ / 4;
+        if (frequency_ <= SweepLowFrequency) {
+            roc_log(LogError, "synth source: sweep frequency should be above %d Hz",
+                    (int)SweepLowFrequency);
+            signal_ = Sig_None;
+            return false;
+        }
+        sweep_freq_ = SweepLowFrequency;
+        sweep_step_ =
+            (frequency_ - SweepLowFrequency) / (SweepDuration * (float)sample_rate_);
+    } else if (strcmp(name, "noise") == 0) {
+        if (frequency != 0) {
+            roc_log(LogError, "synth source: noise doesn't accept a frequency: %s",
+                    input);
+            return false;
+        }
+        signal_ = Sig_Noise;
+    } else {
+        roc_log(LogError,
+                "synth source: unknown signal '%s': expected sine, noise, or sweep",
+                name);
+        return false;
+    }
+
+    roc_log(LogInfo, "synth source: opened generator: %s (%lu Hz, %lu ch)", input,
+            (unsigned long)sample_rate_, (unsigned long)n_channels_);
+
+    return true;
+}
+
+size_t SynthSource::sample_rate() const {
+    if (signal_ == Sig_None) {
+        roc_panic("synth source: sample_rate: non-open generator");
+    }
+
+    return sample_rate_;
+}
+
+bool SynthSource::has_clock() const {
+    return false;
+}
+
+ISource::State SynthSource::state() const {
+    return Active;
+}
+
+void SynthSource::wait_active() const {
+    // always active
+}
+
+bool SynthSource::read(audio::Frame& frame) {
+    if (signal_ == Sig_None) {
+        roc_panic("synth source: read: non-open generator");
+    }
+
+    audio::sample_t* out = frame.data();
+    const size_t n_samples = frame.size();
+
+    for (size_t n = 0; n < n_samples;) {
+        const float value = next_value_();
+        const audio::sample_t sample =
+            (audio::sample_t)(value * (float)audio::SampleMax);
+
+        for (size_t ch = 0; ch < n_channels_ && n < n_samples; ch++) {
+            out[n++] = sample;
+        }
+    }
+
+    return true;
+}
+
+float SynthSource::next_value_() {
+    switch (signal_) {
+    case Sig_Sine:
+        phase_ += 2 * Pi * frequency_ / (float)sample_rate_;
+        if (phase_ > 2 * Pi) {
+            phase_ -= 2 * Pi;
+        }
+        return Amplitude * std::sin(phase_);
+
+    case Sig_Sweep:
+        phase_ += 2 * Pi * sweep_freq_ / (float)sample_rate_;
+        if (phase_ > 2 * Pi) {
+            phase_ -= 2 * Pi;
+        }
+        sweep_freq_ += sweep_step_;
+        if (sweep_freq_ >= frequency_) {
+            sweep_freq_ = SweepLowFrequency;
+        }
+        return Amplitude * std::sin(phase_);
+
+    case Sig_Noise: {
+        // xorshift32; cheap enough to keep the source invisible in
+        // pipeline CPU profiles
+        noise_state_ ^= noise_state_ << 13;
+        noise_state_ ^= noise_state_ >> 17;
+        noise_state_ ^= noise_state_ << 5;
+        return Amplitude * ((float)noise_state_ / 2147483648.f - 1.f);
+    }
+
+    case Sig_None:
+        break;
+    }
+
+    roc_panic("synth source: bad signal type");
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/synth_source.h
+//! @brief Synthetic signal source.
+
+#ifndef ROC_SNDIO_SYNTH_SOURCE_H_
+#define ROC_SNDIO_SYNTH_SOURCE_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! Synthetic signal source.
+//! @remarks
+//!  Generates a test signal directly into the frame, with no file or
+//!  device behind it. Like a file source, it has no clock, so a sender
+//!  pipeline driven from it runs at the maximum rate the pipeline can
+//!  sustain, which makes the source cost negligible in pipeline CPU
+//!  measurements and allows headless soak tests without input files.
+class SynthSource : public ISource, private core::NonCopyable<> {
+public:
+    //! Initialize.
+    SynthSource(core::IAllocator& allocator, const Config& config);
+
+    //! Open generator for the given signal spec.
+    //!
+    //! @b Parameters
+    //!  - @p input is the signal spec: "sine", "noise", or "sweep",
+    //!    optionally followed by a slash and a frequency in hertz,
+    //!    e.g. "sine/1000".
+    //!
+    //! @remarks
+    //!  For "sine", the frequency selects the tone (default 440 Hz). For
+    //!  "sweep", it selects the upper frequency of the sweep (default a
+    //!  quarter of the sample rate); the sweep rises from 20 Hz and
+    //!  repeats. For "noise", the frequency is not accepted.
+    bool open(const char* input);
+
+    //! Get sample rate of the generated signal.
+    virtual size_t sample_rate() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Get current source state.
+    virtual State state() const;
+
+    //! Wait until the source state becomes active.
+    virtual void wait_active() const;
+
+    //! Read frame.
+    virtual bool read(audio::Frame&);
+
+private:
+    enum Signal { Sig_None, Sig_Sine, Sig_Noise, Sig_Sweep };
+
+    float next_value_();
+
+    Signal signal_;
+
+    const size_t sample_rate_;
+    const size_t n_channels_;
+
+    float frequency_;
+
+    // oscillator phase, radians; wrapped every cycle so that the float
+    // doesn't lose precision during long runs
+    float phase_;
+
+    // current sweep frequency and its per-sample increment
+    float sweep_freq_;
+    float sweep_step_;
+
+    uint32_t noise_state_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_SYNTH_SOURCE_H_
@@ -0,0 +1,446 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "roc_core/helpers.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/alsa_device.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const core::nanoseconds_t DefaultLatency = core::Millisecond * 60;
+
+const int MinWaitTimeoutMs = 100;
+
+// Preferred formats, in order. The first one supported by the device is
+// used. Floats are preferred since they're our internal representation
+// and require no conversion when packed into the period.
+const snd_pcm_format_t PreferredFormats[] = {
+    SND_PCM_FORMAT_FLOAT_LE,
+    SND_PCM_FORMAT_S32_LE,
+    SND_PCM_FORMAT_S16_LE,
+};
+
+void pack_samples(uint8_t* dst,
+                  const audio::sample_t* src,
+                  size_t n_samples,
+                  snd_pcm_format_t format) {
+    switch (format) {
+    case SND_PCM_FORMAT_FLOAT_LE:
+        memcpy(dst, src, n_samples * sizeof(audio::sample_t));
+        break;
+
+    case SND_PCM_FORMAT_S32_LE:
+        for (size_t n = 0; n < n_samples; n++) {
+            audio::sample_t s = src[n];
+            if (s > 1.0f) {
+                s = 1.0f;
+            } else if (s < -1.0f) {
+                s = -1.0f;
+            }
+            ((int32_t*)dst)[n] = (int32_t)(s * 2147483647.0f);
+        }
+        break;
+
+    case SND_PCM_FORMAT_S16_LE:
+        for (size_t n = 0; n < n_samples; n++) {
+            audio::sample_t s = src[n];
+            if (s > 1.0f) {
+                s = 1.0f;
+            } else if (s < -1.0f) {
+                s = -1.0f;
+            }
+            ((int16_t*)dst)[n] = (int16_t)(s * 32767.0f);
+        }
+        break;
+
+    default:
+        roc_panic("alsa device: unexpected format in pack_samples()");
+    }
+}
+
+void unpack_samples(audio::sample_t* dst,
+                    const uint8_t* src,
+                    size_t n_samples,
+                    snd_pcm_format_t format) {
+    switch (format) {
+    case SND_PCM_FORMAT_FLOAT_LE:
+        memcpy(dst, src, n_samples * sizeof(audio::sample_t));
+        break;
+
+    case SND_PCM_FORMAT_S32_LE:
+        for (size_t n = 0; n < n_samples; n++) {
+            dst[n] = (audio::sample_t)((const int32_t*)src)[n] / 2147483648.0f;
+        }
+        break;
+
+    case SND_PCM_FORMAT_S16_LE:
+        for (size_t n = 0; n < n_samples; n++) {
+            dst[n] = (audio::sample_t)((const int16_t*)src)[n] / 32768.0f;
+        }
+        break;
+
+    default:
+        roc_panic("alsa device: unexpected format in unpack_samples()");
+    }
+}
+
+} // namespace
+
+AlsaDevice::AlsaDevice(const char* type, const Config& config)
+    : type_(type)
+    , num_channels_(packet::num_channels(config.channels))
+    , sample_rate_(config.sample_rate)
+    , frame_size_(config.frame_size)
+    , pcm_(NULL)
+    , dir_(SND_PCM_STREAM_PLAYBACK)
+    , format_(SND_PCM_FORMAT_UNKNOWN)
+    , period_size_(0)
+    , buffer_size_(0) {
+    if (config.latency != 0) {
+        latency_ = config.latency;
+    } else {
+        latency_ = DefaultLatency;
+    }
+    wait_timeout_ms_ = (int)(latency_ * 2 / core::Millisecond);
+    if (wait_timeout_ms_ < MinWaitTimeoutMs) {
+        wait_timeout_ms_ = MinWaitTimeoutMs;
+    }
+}
+
+AlsaDevice::~AlsaDevice() {
+    close_();
+}
+
+size_t AlsaDevice::sample_rate() const {
+    ensure_opened_();
+
+    return sample_rate_;
+}
+
+size_t AlsaDevice::period_size() const {
+    return (size_t)period_size_ * num_channels_;
+}
+
+bool AlsaDevice::open_(const char* device, snd_pcm_stream_t dir) {
+    if (pcm_) {
+        roc_panic("alsa %s: can't call open() twice", type_);
+    }
+
+    if (!device || !*device || strcmp(device, "default") == 0) {
+        device = "default";
+    }
+
+    roc_log(LogDebug, "alsa %s: opening: device=%s", type_, device);
+
+    if (!check_params_()) {
+        return false;
+    }
+
+    dir_ = dir;
+
+    if (int err = snd_pcm_open(&pcm_, device, dir, 0)) {
+        roc_log(LogError, "alsa %s: snd_pcm_open(): %s", type_, snd_strerror(err));
+        pcm_ = NULL;
+        return false;
+    }
+
+    if (!set_hw_params_()) {
+        close_();
+        return false;
+    }
+
+    if (!set_sw_params_()) {
+        close_();
+        return false;
+    }
+
+    if (dir_ == SND_PCM_STREAM_CAPTURE) {
+        if (int err = snd_pcm_start(pcm_)) {
+            roc_log(LogError, "alsa %s: snd_pcm_start(): %s", type_, snd_strerror(err));
+            close_();
+            return false;
+        }
+    }
+
+    roc_log(LogInfo,
+            "alsa %s: opened: device=%s rate=%lu channels=%lu format=%s"
+            " period=%lu buffer=%lu",
+            type_, device, (unsigned long)sample_rate_, (unsigned long)num_channels_,
+            snd_pcm_format_name(format_), (unsigned long)period_size_,
+            (unsigned long)buffer_size_);
+
+    return true;
+}
+
+void AlsaDevice::close_() {
+    if (!pcm_) {
+        return;
+    }
+
+    if (dir_ == SND_PCM_STREAM_PLAYBACK
+        && snd_pcm_state(pcm_) == SND_PCM_STATE_RUNNING) {
+        snd_pcm_drain(pcm_);
+    }
+
+    snd_pcm_close(pcm_);
+    pcm_ = NULL;
+}
+
+ssize_t AlsaDevice::mmap_transfer_(audio::sample_t* read_buf,
+                                   const audio::sample_t* write_buf,
+                                   size_t size) {
+    roc_panic_if(!read_buf == !write_buf);
+
+    const snd_pcm_state_t state = snd_pcm_state(pcm_);
+
+    if (state == SND_PCM_STATE_XRUN) {
+        if (!recover_(-EPIPE)) {
+            return -1;
+        }
+    } else if (state == SND_PCM_STATE_SUSPENDED) {
+        if (!recover_(-ESTRPIPE)) {
+            return -1;
+        }
+    }
+
+    snd_pcm_sframes_t avail = snd_pcm_avail_update(pcm_);
+    if (avail < 0) {
+        if (!recover_((int)avail)) {
+            return -1;
+        }
+        return 0;
+    }
+
+    if ((snd_pcm_uframes_t)avail < period_size_) {
+        if (int err = snd_pcm_wait(pcm_, wait_timeout_ms_)) {
+            if (err < 0 && !recover_(err)) {
+                return -1;
+            }
+        }
+        return 0;
+    }
+
+    snd_pcm_uframes_t offset = 0;
+    snd_pcm_uframes_t frames = size / num_channels_;
+
+    if (frames > (snd_pcm_uframes_t)avail) {
+        frames = (snd_pcm_uframes_t)avail;
+    }
+
+    const snd_pcm_channel_area_t* areas = NULL;
+
+    if (int err = snd_pcm_mmap_begin(pcm_, &areas, &offset, &frames)) {
+        if (!recover_(err)) {
+            return -1;
+        }
+        return 0;
+    }
+
+    // with interleaved access all channels share a single area and a
+    // frame occupies one contiguous step
+    uint8_t* period_data = (uint8_t*)areas[0].addr + areas[0].first / 8
+        + offset * (areas[0].step / 8);
+
+    const size_t n_samples = (size_t)frames * num_channels_;
+
+    if (write_buf) {
+        pack_samples(period_data, write_buf, n_samples, format_);
+    } else {
+        unpack_samples(read_buf, period_data, n_samples, format_);
+    }
+
+    const snd_pcm_sframes_t committed = snd_pcm_mmap_commit(pcm_, offset, frames);
+    if (committed < 0 || (snd_pcm_uframes_t)committed != frames) {
+        if (!recover_(committed < 0 ? (int)committed : -EPIPE)) {
+            return -1;
+        }
+        return 0;
+    }
+
+    if (write_buf && snd_pcm_state(pcm_) == SND_PCM_STATE_PREPARED) {
+        if (int err = snd_pcm_start(pcm_)) {
+            if (!recover_(err)) {
+                return -1;
+            }
+        }
+    }
+
+    return (ssize_t)n_samples;
+}
+
+void AlsaDevice::ensure_opened_() const {
+    if (!pcm_) {
+        roc_panic("alsa %s: can't use unopened device", type_);
+    }
+}
+
+bool AlsaDevice::check_params_() const {
+    if (num_channels_ == 0) {
+        roc_log(LogError, "alsa %s: # of channels is zero", type_);
+        return false;
+    }
+
+    if (frame_size_ == 0) {
+        roc_log(LogError, "alsa %s: frame size is zero", type_);
+        return false;
+    }
+
+    if (sample_rate_ == 0) {
+        roc_log(LogError, "alsa %s: sample rate is zero", type_);
+        return false;
+    }
+
+    if (latency_ <= 0) {
+        roc_log(LogError, "alsa %s: latency should be positive", type_);
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::set_hw_params_() {
+    snd_pcm_hw_params_t* hw_params = NULL;
+    snd_pcm_hw_params_alloca(&hw_params);
+
+    if (int err = snd_pcm_hw_params_any(pcm_, hw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_any(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_hw_params_set_access(pcm_, hw_params,
+                                               SND_PCM_ACCESS_MMAP_INTERLEAVED)) {
+        roc_log(LogError, "alsa %s: mmap interleaved access not supported: %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    format_ = SND_PCM_FORMAT_UNKNOWN;
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(PreferredFormats); n++) {
+        if (snd_pcm_hw_params_set_format(pcm_, hw_params, PreferredFormats[n]) == 0) {
+            format_ = PreferredFormats[n];
+            break;
+        }
+    }
+    if (format_ == SND_PCM_FORMAT_UNKNOWN) {
+        roc_log(LogError, "alsa %s: no supported sample format", type_);
+        return false;
+    }
+
+    if (int err =
+            snd_pcm_hw_params_set_channels(pcm_, hw_params, (unsigned)num_channels_)) {
+        roc_log(LogError, "alsa %s: can't set # of channels to %lu: %s", type_,
+                (unsigned long)num_channels_, snd_strerror(err));
+        return false;
+    }
+
+    unsigned int rate = (unsigned int)sample_rate_;
+    if (int err = snd_pcm_hw_params_set_rate_near(pcm_, hw_params, &rate, NULL)) {
+        roc_log(LogError, "alsa %s: can't set sample rate to %lu: %s", type_,
+                (unsigned long)sample_rate_, snd_strerror(err));
+        return false;
+    }
+    sample_rate_ = rate;
+
+    unsigned int buffer_us = (unsigned int)(latency_ / core::Microsecond);
+    if (int err =
+            snd_pcm_hw_params_set_buffer_time_near(pcm_, hw_params, &buffer_us, NULL)) {
+        roc_log(LogError, "alsa %s: can't set buffer time: %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    snd_pcm_uframes_t period = frame_size_ / num_channels_;
+    if (int err =
+            snd_pcm_hw_params_set_period_size_near(pcm_, hw_params, &period, NULL)) {
+        roc_log(LogError, "alsa %s: can't set period size: %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_hw_params(pcm_, hw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params(): %s", type_, snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_hw_params_get_period_size(hw_params, &period_size_, NULL)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_get_period_size(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_hw_params_get_buffer_size(hw_params, &buffer_size_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_hw_params_get_buffer_size(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::set_sw_params_() {
+    snd_pcm_sw_params_t* sw_params = NULL;
+    snd_pcm_sw_params_alloca(&sw_params);
+
+    if (int err = snd_pcm_sw_params_current(pcm_, sw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_current(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_sw_params_set_avail_min(pcm_, sw_params, period_size_)) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_set_avail_min(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    // playback is started manually after the first period is committed
+    const snd_pcm_uframes_t start_threshold =
+        dir_ == SND_PCM_STREAM_PLAYBACK ? buffer_size_ * 2 : 1;
+
+    if (int err =
+            snd_pcm_sw_params_set_start_threshold(pcm_, sw_params, start_threshold)) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params_set_start_threshold(): %s", type_,
+                snd_strerror(err));
+        return false;
+    }
+
+    if (int err = snd_pcm_sw_params(pcm_, sw_params)) {
+        roc_log(LogError, "alsa %s: snd_pcm_sw_params(): %s", type_, snd_strerror(err));
+        return false;
+    }
+
+    return true;
+}
+
+bool AlsaDevice::recover_(int err) {
+    roc_log(LogDebug, "alsa %s: recovering from error: %s", type_, snd_strerror(err));
+
+    if (int ret = snd_pcm_recover(pcm_, err, 1)) {
+        roc_log(LogError, "alsa %s: snd_pcm_recover(): %s", type_, snd_strerror(ret));
+        return false;
+    }
+
+    if (dir_ == SND_PCM_STREAM_CAPTURE) {
+        if (int ret = snd_pcm_start(pcm_)) {
+            roc_log(LogError, "alsa %s: snd_pcm_start(): %s", type_, snd_strerror(ret));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
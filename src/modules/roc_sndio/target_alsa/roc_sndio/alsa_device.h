@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_alsa/roc_sndio/alsa_device.h
+//! @brief ALSA device.
+
+#ifndef ROC_SNDIO_ALSA_DEVICE_H_
+#define ROC_SNDIO_ALSA_DEVICE_H_
+
+#include <alsa/asoundlib.h>
+
+#include "roc_audio/units.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/units.h"
+#include "roc_sndio/config.h"
+
+namespace roc {
+namespace sndio {
+
+//! ALSA device.
+//! @remarks
+//!  Base class for ALSA sink and source. Owns a PCM handle opened in
+//!  mmap interleaved access mode, so that samples are converted directly
+//!  into (or from) the period being exchanged with the driver, without
+//!  an intermediate buffer.
+class AlsaDevice : public core::NonCopyable<> {
+public:
+    //! Get sample rate of the device.
+    size_t sample_rate() const;
+
+    //! Get native period size of the device in samples.
+    //! @remarks
+    //!  Zero until the device is opened.
+    size_t period_size() const;
+
+protected:
+    //! Initialize.
+    AlsaDevice(const char* type, const Config& config);
+
+    virtual ~AlsaDevice();
+
+    //! Open PCM device.
+    bool open_(const char* device, snd_pcm_stream_t dir);
+
+    //! Close PCM device.
+    void close_();
+
+    //! Transfer samples through the mmap'ed ring buffer.
+    //! @remarks
+    //!  Exactly one of @p read_buf and @p write_buf should be non-NULL.
+    //!  @p size is the number of samples for all channels.
+    //! @returns
+    //!  the number of samples transferred, zero if the call should be
+    //!  retried, or -1 if the stream can't be recovered.
+    ssize_t mmap_transfer_(audio::sample_t* read_buf,
+                           const audio::sample_t* write_buf,
+                           size_t size);
+
+    //! Panic if the device is not open.
+    void ensure_opened_() const;
+
+    //! Device type used in log messages, "sink" or "source".
+    const char* type_;
+
+    //! Number of channels.
+    const size_t num_channels_;
+
+private:
+    bool check_params_() const;
+
+    bool set_hw_params_();
+    bool set_sw_params_();
+
+    bool recover_(int err);
+
+    size_t sample_rate_;
+    const size_t frame_size_;
+
+    core::nanoseconds_t latency_;
+    int wait_timeout_ms_;
+
+    snd_pcm_t* pcm_;
+    snd_pcm_stream_t dir_;
+    snd_pcm_format_t format_;
+
+    snd_pcm_uframes_t period_size_;
+    snd_pcm_uframes_t buffer_size_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_ALSA_DEVICE_H_
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/alsa_sink.h"
+
+namespace roc {
+namespace sndio {
+
+AlsaSink::AlsaSink(const Config& config)
+    : AlsaDevice("sink", config) {
+}
+
+bool AlsaSink::open(const char* device) {
+    return open_(device, SND_PCM_STREAM_PLAYBACK);
+}
+
+size_t AlsaSink::sample_rate() const {
+    return AlsaDevice::sample_rate();
+}
+
+size_t AlsaSink::preferred_frame_size() const {
+    return AlsaDevice::period_size();
+}
+
+bool AlsaSink::has_clock() const {
+    return true;
+}
+
+void AlsaSink::write(audio::Frame& frame) {
+    ensure_opened_();
+
+    if (frame.size() % num_channels_ != 0) {
+        roc_panic("alsa sink: unexpected frame size");
+    }
+
+    const audio::sample_t* data = frame.data();
+    size_t size = frame.size();
+
+    while (size > 0) {
+        const ssize_t ret = mmap_transfer_(NULL, data, size);
+
+        if (ret < 0) {
+            roc_panic("alsa sink: can't recover stream");
+        }
+
+        data += (size_t)ret;
+        size -= (size_t)ret;
+    }
+}
+
+} // namespace sndio
+} // namespace roc
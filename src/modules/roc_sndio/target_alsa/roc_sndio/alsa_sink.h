@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_alsa/roc_sndio/alsa_sink.h
+//! @brief ALSA sink.
+
+#ifndef ROC_SNDIO_ALSA_SINK_H_
+#define ROC_SNDIO_ALSA_SINK_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_sndio/alsa_device.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! ALSA sink.
+//! @remarks
+//!  Writes frames directly into the mmap'ed playback ring buffer.
+class AlsaSink : public ISink, public AlsaDevice {
+public:
+    //! Initialize.
+    AlsaSink(const Config& config);
+
+    //! Open output device.
+    bool open(const char* device);
+
+    //! Get sample rate of the sink.
+    virtual size_t sample_rate() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Get native period size of the device in samples.
+    virtual size_t preferred_frame_size() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_ALSA_SINK_H_
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/alsa_source.h"
+
+namespace roc {
+namespace sndio {
+
+AlsaSource::AlsaSource(const Config& config)
+    : AlsaDevice("source", config) {
+}
+
+bool AlsaSource::open(const char* device) {
+    return open_(device, SND_PCM_STREAM_CAPTURE);
+}
+
+size_t AlsaSource::sample_rate() const {
+    return AlsaDevice::sample_rate();
+}
+
+size_t AlsaSource::preferred_frame_size() const {
+    return AlsaDevice::period_size();
+}
+
+bool AlsaSource::has_clock() const {
+    return true;
+}
+
+ISource::State AlsaSource::state() const {
+    return Active;
+}
+
+void AlsaSource::wait_active() const {
+    // always active
+}
+
+bool AlsaSource::read(audio::Frame& frame) {
+    ensure_opened_();
+
+    if (frame.size() % num_channels_ != 0) {
+        roc_panic("alsa source: unexpected frame size");
+    }
+
+    audio::sample_t* data = frame.data();
+    size_t size = frame.size();
+
+    while (size > 0) {
+        const ssize_t ret = mmap_transfer_(data, NULL, size);
+
+        if (ret < 0) {
+            roc_log(LogError, "alsa source: can't recover stream");
+            return false;
+        }
+
+        data += (size_t)ret;
+        size -= (size_t)ret;
+    }
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
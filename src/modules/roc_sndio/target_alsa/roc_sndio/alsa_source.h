@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_alsa/roc_sndio/alsa_source.h
+//! @brief ALSA source.
+
+#ifndef ROC_SNDIO_ALSA_SOURCE_H_
+#define ROC_SNDIO_ALSA_SOURCE_H_
+
+#include "roc_core/noncopyable.h"
+#include "roc_sndio/alsa_device.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! ALSA source.
+//! @remarks
+//!  Reads frames directly from the mmap'ed capture ring buffer.
+class AlsaSource : public ISource, public AlsaDevice {
+public:
+    //! Initialize.
+    AlsaSource(const Config& config);
+
+    //! Open input device.
+    bool open(const char* device);
+
+    //! Get sample rate of the source.
+    virtual size_t sample_rate() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Get native period size of the device in samples.
+    virtual size_t preferred_frame_size() const;
+
+    //! Get current source state.
+    virtual State state() const;
+
+    //! Wait until the source state becomes active.
+    virtual void wait_active() const;
+
+    //! Read audio frame.
+    virtual bool read(audio::Frame& frame);
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_ALSA_SOURCE_H_
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_sndio/coreaudio_backend.h"
+#include "roc_sndio/coreaudio_sink.h"
+#include "roc_sndio/coreaudio_source.h"
+#include "roc_sndio/driver_info.h"
+
+namespace roc {
+namespace sndio {
+
+CoreaudioBackend::CoreaudioBackend() {
+    roc_log(LogDebug, "initializing coreaudio backend");
+}
+
+bool CoreaudioBackend::probe(const char* driver, const char*, int filter_flags) {
+    if ((filter_flags & FilterDevice) == 0) {
+        return false;
+    }
+
+    return driver && strcmp(driver, "coreaudio") == 0;
+}
+
+ISink* CoreaudioBackend::open_sink(core::IAllocator& allocator,
+                                   const char*,
+                                   const char* output,
+                                   const Config& config) {
+    core::UniquePtr<CoreaudioSink> sink(new (allocator) CoreaudioSink(config, allocator),
+                                        allocator);
+    if (!sink) {
+        return NULL;
+    }
+
+    if (!sink->open(output)) {
+        return NULL;
+    }
+
+    return sink.release();
+}
+
+ISource* CoreaudioBackend::open_source(core::IAllocator& allocator,
+                                       const char*,
+                                       const char* input,
+                                       const Config& config) {
+    core::UniquePtr<CoreaudioSource> source(
+        new (allocator) CoreaudioSource(config, allocator), allocator);
+    if (!source) {
+        return NULL;
+    }
+
+    if (!source->open(input)) {
+        return NULL;
+    }
+
+    return source.release();
+}
+
+bool CoreaudioBackend::get_drivers(core::Array<DriverInfo>& arr, int filter_flags) {
+    if (filter_flags & FilterDevice) {
+        return add_driver_uniq(arr, "coreaudio");
+    }
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,538 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <string.h>
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/coreaudio_device.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+const core::nanoseconds_t DefaultLatency = core::Millisecond * 60;
+
+// HAL output unit bus numbers.
+enum { OutputElement = 0, InputElement = 1 };
+
+bool get_device_name(AudioDeviceID device_id, char* name, size_t name_size) {
+    AudioObjectPropertyAddress addr;
+    addr.mSelector = kAudioObjectPropertyName;
+    addr.mScope = kAudioObjectPropertyScopeGlobal;
+    addr.mElement = kAudioObjectPropertyElementMaster;
+
+    CFStringRef str = NULL;
+    UInt32 size = sizeof(str);
+
+    if (AudioObjectGetPropertyData(device_id, &addr, 0, NULL, &size, &str) != noErr
+        || !str) {
+        return false;
+    }
+
+    const bool ok = CFStringGetCString(str, name, (CFIndex)name_size,
+                                       kCFStringEncodingUTF8);
+    CFRelease(str);
+
+    return ok;
+}
+
+bool device_has_dir(AudioDeviceID device_id, bool input) {
+    AudioObjectPropertyAddress addr;
+    addr.mSelector = kAudioDevicePropertyStreams;
+    addr.mScope =
+        input ? kAudioDevicePropertyScopeInput : kAudioDevicePropertyScopeOutput;
+    addr.mElement = kAudioObjectPropertyElementMaster;
+
+    UInt32 size = 0;
+    if (AudioObjectGetPropertyDataSize(device_id, &addr, 0, NULL, &size) != noErr) {
+        return false;
+    }
+
+    return size > 0;
+}
+
+} // namespace
+
+CoreaudioDevice::CoreaudioDevice(const char* type,
+                                 const Config& config,
+                                 core::IAllocator& allocator)
+    : type_(type)
+    , num_channels_(packet::num_channels(config.channels))
+    , sample_rate_(config.sample_rate)
+    , frame_size_(config.frame_size)
+    , dir_(Dir_Playback)
+    , unit_(NULL)
+    , unit_started_(false)
+    , ring_(allocator)
+    , ring_pos_(0)
+    , ring_len_(0)
+    , n_overruns_(0)
+    , capture_buf_(allocator)
+    , cond_(mutex_) {
+    if (config.latency != 0) {
+        latency_ = config.latency;
+    } else {
+        latency_ = DefaultLatency;
+    }
+}
+
+CoreaudioDevice::~CoreaudioDevice() {
+    close_();
+}
+
+size_t CoreaudioDevice::sample_rate() const {
+    ensure_opened_();
+
+    return sample_rate_;
+}
+
+bool CoreaudioDevice::open_(const char* device, Dir dir) {
+    if (unit_) {
+        roc_panic("coreaudio %s: can't call open() twice", type_);
+    }
+
+    if (!device || !*device || strcmp(device, "default") == 0) {
+        device = "default";
+    }
+
+    roc_log(LogDebug, "coreaudio %s: opening: device=%s", type_, device);
+
+    if (!check_params_()) {
+        return false;
+    }
+
+    dir_ = dir;
+
+    AudioDeviceID device_id = kAudioObjectUnknown;
+    if (!find_device_(device, device_id)) {
+        roc_log(LogError, "coreaudio %s: can't find device: device=%s", type_, device);
+        return false;
+    }
+
+    // when the rate is not forced, follow the device nominal rate, so that
+    // CoreAudio doesn't insert its own resampler
+    if (sample_rate_ == 0) {
+        if (!device_sample_rate_(device_id, sample_rate_)) {
+            return false;
+        }
+    }
+
+    if (!setup_unit_(device_id)) {
+        close_();
+        return false;
+    }
+
+    if (!setup_ring_()) {
+        close_();
+        return false;
+    }
+
+    if (OSStatus err = AudioOutputUnitStart(unit_)) {
+        roc_log(LogError, "coreaudio %s: AudioOutputUnitStart(): err=%ld", type_,
+                (long)err);
+        close_();
+        return false;
+    }
+    unit_started_ = true;
+
+    roc_log(LogInfo,
+            "coreaudio %s: opened: device=%s rate=%lu channels=%lu ring=%lu", type_,
+            device, (unsigned long)sample_rate_, (unsigned long)num_channels_,
+            (unsigned long)ring_.size());
+
+    return true;
+}
+
+void CoreaudioDevice::close_() {
+    if (!unit_) {
+        return;
+    }
+
+    if (unit_started_) {
+        AudioOutputUnitStop(unit_);
+        unit_started_ = false;
+    }
+
+    AudioUnitUninitialize(unit_);
+    AudioComponentInstanceDispose(unit_);
+    unit_ = NULL;
+
+    if (n_overruns_ != 0) {
+        roc_log(LogDebug, "coreaudio %s: dropped samples on overrun: n_samples=%lu",
+                type_, (unsigned long)n_overruns_);
+    }
+}
+
+bool CoreaudioDevice::check_params_() const {
+    if (num_channels_ == 0) {
+        roc_log(LogError, "coreaudio %s: # of channels is zero", type_);
+        return false;
+    }
+    return true;
+}
+
+bool CoreaudioDevice::find_device_(const char* device, AudioDeviceID& device_id) const {
+    const bool input = (dir_ == Dir_Capture);
+
+    if (strcmp(device, "default") == 0) {
+        AudioObjectPropertyAddress addr;
+        addr.mSelector = input ? kAudioHardwarePropertyDefaultInputDevice
+                               : kAudioHardwarePropertyDefaultOutputDevice;
+        addr.mScope = kAudioObjectPropertyScopeGlobal;
+        addr.mElement = kAudioObjectPropertyElementMaster;
+
+        UInt32 size = sizeof(device_id);
+        if (OSStatus err = AudioObjectGetPropertyData(kAudioObjectSystemObject, &addr,
+                                                      0, NULL, &size, &device_id)) {
+            roc_log(LogError,
+                    "coreaudio %s: can't get default device: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+
+        return device_id != kAudioObjectUnknown;
+    }
+
+    AudioObjectPropertyAddress addr;
+    addr.mSelector = kAudioHardwarePropertyDevices;
+    addr.mScope = kAudioObjectPropertyScopeGlobal;
+    addr.mElement = kAudioObjectPropertyElementMaster;
+
+    UInt32 size = 0;
+    if (AudioObjectGetPropertyDataSize(kAudioObjectSystemObject, &addr, 0, NULL, &size)
+        != noErr) {
+        return false;
+    }
+
+    enum { MaxDevices = 64 };
+    AudioDeviceID devices[MaxDevices];
+
+    if (size > sizeof(devices)) {
+        size = sizeof(devices);
+    }
+
+    if (AudioObjectGetPropertyData(kAudioObjectSystemObject, &addr, 0, NULL, &size,
+                                   devices)
+        != noErr) {
+        return false;
+    }
+
+    const size_t n_devices = size / sizeof(AudioDeviceID);
+
+    for (size_t n = 0; n < n_devices; n++) {
+        if (!device_has_dir(devices[n], input)) {
+            continue;
+        }
+
+        char name[256] = {};
+        if (!get_device_name(devices[n], name, sizeof(name))) {
+            continue;
+        }
+
+        if (strcmp(name, device) == 0) {
+            device_id = devices[n];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CoreaudioDevice::device_sample_rate_(AudioDeviceID device_id, size_t& rate) const {
+    AudioObjectPropertyAddress addr;
+    addr.mSelector = kAudioDevicePropertyNominalSampleRate;
+    addr.mScope = kAudioObjectPropertyScopeGlobal;
+    addr.mElement = kAudioObjectPropertyElementMaster;
+
+    Float64 nominal_rate = 0;
+    UInt32 size = sizeof(nominal_rate);
+
+    if (OSStatus err =
+            AudioObjectGetPropertyData(device_id, &addr, 0, NULL, &size, &nominal_rate)) {
+        roc_log(LogError, "coreaudio %s: can't get device sample rate: err=%ld", type_,
+                (long)err);
+        return false;
+    }
+
+    rate = (size_t)nominal_rate;
+
+    return rate != 0;
+}
+
+bool CoreaudioDevice::setup_unit_(AudioDeviceID device_id) {
+    AudioComponentDescription desc;
+    memset(&desc, 0, sizeof(desc));
+    desc.componentType = kAudioUnitType_Output;
+    desc.componentSubType = kAudioUnitSubType_HALOutput;
+    desc.componentManufacturer = kAudioUnitManufacturer_Apple;
+
+    AudioComponent comp = AudioComponentFindNext(NULL, &desc);
+    if (!comp) {
+        roc_log(LogError, "coreaudio %s: can't find HAL output component", type_);
+        return false;
+    }
+
+    if (OSStatus err = AudioComponentInstanceNew(comp, &unit_)) {
+        roc_log(LogError, "coreaudio %s: AudioComponentInstanceNew(): err=%ld", type_,
+                (long)err);
+        unit_ = NULL;
+        return false;
+    }
+
+    if (dir_ == Dir_Capture) {
+        // a HAL output unit does playback by default; flip it to capture
+        UInt32 enable = 1;
+        if (OSStatus err = AudioUnitSetProperty(
+                unit_, kAudioOutputUnitProperty_EnableIO, kAudioUnitScope_Input,
+                InputElement, &enable, sizeof(enable))) {
+            roc_log(LogError, "coreaudio %s: can't enable input: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+
+        UInt32 disable = 0;
+        if (OSStatus err = AudioUnitSetProperty(
+                unit_, kAudioOutputUnitProperty_EnableIO, kAudioUnitScope_Output,
+                OutputElement, &disable, sizeof(disable))) {
+            roc_log(LogError, "coreaudio %s: can't disable output: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+    }
+
+    if (OSStatus err = AudioUnitSetProperty(
+            unit_, kAudioOutputUnitProperty_CurrentDevice, kAudioUnitScope_Global, 0,
+            &device_id, sizeof(device_id))) {
+        roc_log(LogError, "coreaudio %s: can't set device: err=%ld", type_, (long)err);
+        return false;
+    }
+
+    // interleaved native-endian floats, matching our internal representation
+    AudioStreamBasicDescription fmt;
+    memset(&fmt, 0, sizeof(fmt));
+    fmt.mSampleRate = (Float64)sample_rate_;
+    fmt.mFormatID = kAudioFormatLinearPCM;
+    fmt.mFormatFlags = kAudioFormatFlagIsFloat | kAudioFormatFlagIsPacked;
+    fmt.mFramesPerPacket = 1;
+    fmt.mChannelsPerFrame = (UInt32)num_channels_;
+    fmt.mBitsPerChannel = 32;
+    fmt.mBytesPerFrame = (UInt32)(num_channels_ * sizeof(Float32));
+    fmt.mBytesPerPacket = fmt.mBytesPerFrame;
+
+    if (dir_ == Dir_Playback) {
+        if (OSStatus err = AudioUnitSetProperty(unit_, kAudioUnitProperty_StreamFormat,
+                                                kAudioUnitScope_Input, OutputElement,
+                                                &fmt, sizeof(fmt))) {
+            roc_log(LogError, "coreaudio %s: can't set stream format: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+
+        AURenderCallbackStruct cb;
+        cb.inputProc = render_cb_;
+        cb.inputProcRefCon = this;
+
+        if (OSStatus err = AudioUnitSetProperty(
+                unit_, kAudioUnitProperty_SetRenderCallback, kAudioUnitScope_Input,
+                OutputElement, &cb, sizeof(cb))) {
+            roc_log(LogError, "coreaudio %s: can't set render callback: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+    } else {
+        if (OSStatus err = AudioUnitSetProperty(unit_, kAudioUnitProperty_StreamFormat,
+                                                kAudioUnitScope_Output, InputElement,
+                                                &fmt, sizeof(fmt))) {
+            roc_log(LogError, "coreaudio %s: can't set stream format: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+
+        AURenderCallbackStruct cb;
+        cb.inputProc = input_cb_;
+        cb.inputProcRefCon = this;
+
+        if (OSStatus err = AudioUnitSetProperty(
+                unit_, kAudioOutputUnitProperty_SetInputCallback,
+                kAudioUnitScope_Global, 0, &cb, sizeof(cb))) {
+            roc_log(LogError, "coreaudio %s: can't set input callback: err=%ld", type_,
+                    (long)err);
+            return false;
+        }
+    }
+
+    UInt32 max_frames = MaxIOFrames;
+    if (OSStatus err = AudioUnitSetProperty(
+            unit_, kAudioUnitProperty_MaximumFramesPerSlice, kAudioUnitScope_Global, 0,
+            &max_frames, sizeof(max_frames))) {
+        roc_log(LogError, "coreaudio %s: can't set maximum frames per slice: err=%ld",
+                type_, (long)err);
+        return false;
+    }
+
+    if (OSStatus err = AudioUnitInitialize(unit_)) {
+        roc_log(LogError, "coreaudio %s: AudioUnitInitialize(): err=%ld", type_,
+                (long)err);
+        return false;
+    }
+
+    return true;
+}
+
+bool CoreaudioDevice::setup_ring_() {
+    // the ring keeps up to twice the configured latency, so that the
+    // steady-state fill level is around one latency
+    size_t ring_size =
+        (size_t)((double)sample_rate_ * (double)latency_ / core::Second) * num_channels_
+        * 2;
+
+    if (ring_size < frame_size_ * 2) {
+        ring_size = frame_size_ * 2;
+    }
+
+    if (!ring_.resize(ring_size)) {
+        return false;
+    }
+
+    if (dir_ == Dir_Capture) {
+        if (!capture_buf_.resize(MaxIOFrames * num_channels_)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void CoreaudioDevice::ensure_opened_() const {
+    if (!unit_) {
+        roc_panic("coreaudio %s: non-open device used", type_);
+    }
+}
+
+void CoreaudioDevice::write_samples_(const audio::sample_t* samples, size_t n_samples) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_samples > 0) {
+        while (ring_len_ == ring_.size()) {
+            cond_.wait();
+        }
+
+        while (n_samples > 0 && ring_len_ < ring_.size()) {
+            ring_[(ring_pos_ + ring_len_) % ring_.size()] = *samples++;
+            ring_len_++;
+            n_samples--;
+        }
+    }
+}
+
+void CoreaudioDevice::read_samples_(audio::sample_t* samples, size_t n_samples) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_samples > 0) {
+        while (ring_len_ == 0) {
+            cond_.wait();
+        }
+
+        while (n_samples > 0 && ring_len_ > 0) {
+            *samples++ = ring_[ring_pos_];
+            ring_pos_ = (ring_pos_ + 1) % ring_.size();
+            ring_len_--;
+            n_samples--;
+        }
+    }
+}
+
+// Called on the CoreAudio I/O thread; pops the ring, padding with silence
+// on underrun instead of blocking.
+void CoreaudioDevice::render_samples_(audio::sample_t* samples, size_t n_samples) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_samples > 0 && ring_len_ > 0) {
+        *samples++ = ring_[ring_pos_];
+        ring_pos_ = (ring_pos_ + 1) % ring_.size();
+        ring_len_--;
+        n_samples--;
+    }
+
+    while (n_samples > 0) {
+        *samples++ = 0;
+        n_samples--;
+    }
+
+    cond_.broadcast();
+}
+
+// Called on the CoreAudio I/O thread; pushes to the ring, dropping samples
+// on overrun instead of blocking.
+void CoreaudioDevice::capture_samples_(const audio::sample_t* samples,
+                                       size_t n_samples) {
+    core::Mutex::Lock lock(mutex_);
+
+    while (n_samples > 0 && ring_len_ < ring_.size()) {
+        ring_[(ring_pos_ + ring_len_) % ring_.size()] = *samples++;
+        ring_len_++;
+        n_samples--;
+    }
+
+    n_overruns_ += n_samples;
+
+    cond_.broadcast();
+}
+
+OSStatus CoreaudioDevice::render_cb_(void* inRefCon,
+                                     AudioUnitRenderActionFlags*,
+                                     const AudioTimeStamp*,
+                                     UInt32,
+                                     UInt32,
+                                     AudioBufferList* ioData) {
+    CoreaudioDevice& self = *(CoreaudioDevice*)inRefCon;
+
+    for (UInt32 n = 0; n < ioData->mNumberBuffers; n++) {
+        self.render_samples_((audio::sample_t*)ioData->mBuffers[n].mData,
+                             ioData->mBuffers[n].mDataByteSize / sizeof(Float32));
+    }
+
+    return noErr;
+}
+
+OSStatus CoreaudioDevice::input_cb_(void* inRefCon,
+                                    AudioUnitRenderActionFlags* ioActionFlags,
+                                    const AudioTimeStamp* inTimeStamp,
+                                    UInt32 inBusNumber,
+                                    UInt32 inNumberFrames,
+                                    AudioBufferList*) {
+    CoreaudioDevice& self = *(CoreaudioDevice*)inRefCon;
+
+    if (inNumberFrames > MaxIOFrames) {
+        inNumberFrames = MaxIOFrames;
+    }
+
+    AudioBufferList buf_list;
+    buf_list.mNumberBuffers = 1;
+    buf_list.mBuffers[0].mNumberChannels = (UInt32)self.num_channels_;
+    buf_list.mBuffers[0].mDataByteSize =
+        (UInt32)(inNumberFrames * self.num_channels_ * sizeof(Float32));
+    buf_list.mBuffers[0].mData = &self.capture_buf_[0];
+
+    if (OSStatus err = AudioUnitRender(self.unit_, ioActionFlags, inTimeStamp,
+                                       inBusNumber, inNumberFrames, &buf_list)) {
+        roc_log(LogDebug, "coreaudio %s: AudioUnitRender(): err=%ld", self.type_,
+                (long)err);
+        return err;
+    }
+
+    self.capture_samples_((const audio::sample_t*)buf_list.mBuffers[0].mData,
+                          buf_list.mBuffers[0].mDataByteSize / sizeof(Float32));
+
+    return noErr;
+}
+
+} // namespace sndio
+} // namespace roc
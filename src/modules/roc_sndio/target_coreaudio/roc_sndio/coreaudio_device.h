@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_coreaudio/roc_sndio/coreaudio_device.h
+//! @brief CoreAudio device.
+
+#ifndef ROC_SNDIO_COREAUDIO_DEVICE_H_
+#define ROC_SNDIO_COREAUDIO_DEVICE_H_
+
+#include <AudioUnit/AudioUnit.h>
+#include <CoreAudio/CoreAudio.h>
+
+#include "roc_audio/units.h"
+#include "roc_core/array.h"
+#include "roc_core/cond.h"
+#include "roc_core/iallocator.h"
+#include "roc_core/mutex.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_core/time.h"
+#include "roc_packet/units.h"
+#include "roc_sndio/config.h"
+
+namespace roc {
+namespace sndio {
+
+//! CoreAudio device.
+//! @remarks
+//!  Base class for CoreAudio sink and source. Owns a HAL output AudioUnit
+//!  whose I/O callbacks exchange interleaved float samples (our internal
+//!  representation, so no conversion is needed) with the pipeline through
+//!  a small ring buffer sized from the configured latency.
+class CoreaudioDevice : public core::NonCopyable<> {
+public:
+    //! Get sample rate of the device.
+    size_t sample_rate() const;
+
+protected:
+    //! Device direction.
+    enum Dir {
+        Dir_Playback, //!< Render to output device.
+        Dir_Capture   //!< Capture from input device.
+    };
+
+    //! Initialize.
+    CoreaudioDevice(const char* type, const Config& config, core::IAllocator& allocator);
+
+    virtual ~CoreaudioDevice();
+
+    //! Open audio unit.
+    bool open_(const char* device, Dir dir);
+
+    //! Close audio unit.
+    void close_();
+
+    //! Push samples to the playback ring buffer.
+    //! @remarks
+    //!  Blocks until the render callback makes enough room.
+    void write_samples_(const audio::sample_t* samples, size_t n_samples);
+
+    //! Pop samples from the capture ring buffer.
+    //! @remarks
+    //!  Blocks until the input callback delivers enough samples.
+    void read_samples_(audio::sample_t* samples, size_t n_samples);
+
+    //! Panic if the device is not open.
+    void ensure_opened_() const;
+
+    //! Device type used in log messages, "sink" or "source".
+    const char* type_;
+
+    //! Number of channels.
+    const size_t num_channels_;
+
+private:
+    //! Maximum frames the HAL may deliver in one callback.
+    enum { MaxIOFrames = 4096 };
+
+    static OSStatus render_cb_(void* inRefCon,
+                               AudioUnitRenderActionFlags* ioActionFlags,
+                               const AudioTimeStamp* inTimeStamp,
+                               UInt32 inBusNumber,
+                               UInt32 inNumberFrames,
+                               AudioBufferList* ioData);
+
+    static OSStatus input_cb_(void* inRefCon,
+                              AudioUnitRenderActionFlags* ioActionFlags,
+                              const AudioTimeStamp* inTimeStamp,
+                              UInt32 inBusNumber,
+                              UInt32 inNumberFrames,
+                              AudioBufferList* ioData);
+
+    bool check_params_() const;
+
+    bool find_device_(const char* device, AudioDeviceID& device_id) const;
+    bool device_sample_rate_(AudioDeviceID device_id, size_t& rate) const;
+
+    bool setup_unit_(AudioDeviceID device_id);
+    bool setup_ring_();
+
+    void render_samples_(audio::sample_t* samples, size_t n_samples);
+    void capture_samples_(const audio::sample_t* samples, size_t n_samples);
+
+    size_t sample_rate_;
+    const size_t frame_size_;
+
+    core::nanoseconds_t latency_;
+
+    Dir dir_;
+    AudioUnit unit_;
+    bool unit_started_;
+
+    core::Array<audio::sample_t> ring_;
+    size_t ring_pos_;
+    size_t ring_len_;
+    size_t n_overruns_;
+
+    core::Array<audio::sample_t> capture_buf_;
+
+    core::Mutex mutex_;
+    core::Cond cond_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_COREAUDIO_DEVICE_H_
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/coreaudio_sink.h"
+
+namespace roc {
+namespace sndio {
+
+CoreaudioSink::CoreaudioSink(const Config& config, core::IAllocator& allocator)
+    : CoreaudioDevice("sink", config, allocator) {
+}
+
+bool CoreaudioSink::open(const char* device) {
+    return open_(device, Dir_Playback);
+}
+
+size_t CoreaudioSink::sample_rate() const {
+    return CoreaudioDevice::sample_rate();
+}
+
+bool CoreaudioSink::has_clock() const {
+    return true;
+}
+
+void CoreaudioSink::write(audio::Frame& frame) {
+    ensure_opened_();
+
+    if (frame.size() % num_channels_ != 0) {
+        roc_panic("coreaudio sink: unexpected frame size");
+    }
+
+    write_samples_(frame.data(), frame.size());
+}
+
+} // namespace sndio
+} // namespace roc
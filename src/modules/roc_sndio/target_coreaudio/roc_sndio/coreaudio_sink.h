@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_coreaudio/roc_sndio/coreaudio_sink.h
+//! @brief CoreAudio sink.
+
+#ifndef ROC_SNDIO_COREAUDIO_SINK_H_
+#define ROC_SNDIO_COREAUDIO_SINK_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/coreaudio_device.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! CoreAudio sink.
+//! @remarks
+//!  Feeds frames to the AudioUnit render callback of the output device.
+class CoreaudioSink : public ISink, public CoreaudioDevice {
+public:
+    //! Initialize.
+    CoreaudioSink(const Config& config, core::IAllocator& allocator);
+
+    //! Open output device.
+    bool open(const char* device);
+
+    //! Get sample rate of the sink.
+    virtual size_t sample_rate() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_COREAUDIO_SINK_H_
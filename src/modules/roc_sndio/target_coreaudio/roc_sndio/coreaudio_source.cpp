@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/coreaudio_source.h"
+
+namespace roc {
+namespace sndio {
+
+CoreaudioSource::CoreaudioSource(const Config& config, core::IAllocator& allocator)
+    : CoreaudioDevice("source", config, allocator) {
+}
+
+bool CoreaudioSource::open(const char* device) {
+    return open_(device, Dir_Capture);
+}
+
+size_t CoreaudioSource::sample_rate() const {
+    return CoreaudioDevice::sample_rate();
+}
+
+bool CoreaudioSource::has_clock() const {
+    return true;
+}
+
+ISource::State CoreaudioSource::state() const {
+    return Active;
+}
+
+void CoreaudioSource::wait_active() const {
+    // always active
+}
+
+bool CoreaudioSource::read(audio::Frame& frame) {
+    ensure_opened_();
+
+    if (frame.size() % num_channels_ != 0) {
+        roc_panic("coreaudio source: unexpected frame size");
+    }
+
+    read_samples_(frame.data(), frame.size());
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_coreaudio/roc_sndio/coreaudio_source.h
+//! @brief CoreAudio source.
+
+#ifndef ROC_SNDIO_COREAUDIO_SOURCE_H_
+#define ROC_SNDIO_COREAUDIO_SOURCE_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/coreaudio_device.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! CoreAudio source.
+//! @remarks
+//!  Fills frames from the AudioUnit input callback of the capture device.
+class CoreaudioSource : public ISource, public CoreaudioDevice {
+public:
+    //! Initialize.
+    CoreaudioSource(const Config& config, core::IAllocator& allocator);
+
+    //! Open input device.
+    bool open(const char* device);
+
+    //! Get sample rate of the source.
+    virtual size_t sample_rate() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Get current source state.
+    virtual State state() const;
+
+    //! Wait until the source state becomes active.
+    virtual void wait_active() const;
+
+    //! Read audio frame.
+    virtual bool read(audio::Frame& frame);
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_COREAUDIO_SOURCE_H_
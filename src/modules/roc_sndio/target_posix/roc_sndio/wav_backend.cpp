@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "roc_core/log.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_sndio/wav_backend.h"
+#include "roc_sndio/wav_sink.h"
+#include "roc_sndio/wav_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+bool has_wav_extension(const char* inout) {
+    if (!inout) {
+        return false;
+    }
+
+    const size_t len = strlen(inout);
+    if (len < 4) {
+        return false;
+    }
+
+    return strcmp(inout + len - 4, ".wav") == 0;
+}
+
+bool match_wav(const char* driver, const char* inout) {
+    if (driver) {
+        return strcmp(driver, "wav") == 0;
+    }
+
+    return has_wav_extension(inout);
+}
+
+} // namespace
+
+WavBackend::WavBackend() {
+    roc_log(LogDebug, "initializing wav backend");
+}
+
+bool WavBackend::probe(const char* driver, const char* inout, int filter_flags) {
+    if ((filter_flags & FilterFile) == 0) {
+        return false;
+    }
+
+    // "-" (stdin/stdout) can't be mapped; let another backend handle it
+    if (!inout || strcmp(inout, "-") == 0) {
+        return false;
+    }
+
+    return match_wav(driver, inout);
+}
+
+ISink* WavBackend::open_sink(core::IAllocator& allocator,
+                             const char* driver,
+                             const char* output,
+                             const Config& config) {
+    (void)driver;
+
+    core::UniquePtr<WavSink> sink(new (allocator) WavSink(allocator, config), allocator);
+    if (!sink) {
+        return NULL;
+    }
+
+    if (!sink->valid()) {
+        return NULL;
+    }
+
+    if (!sink->open(output)) {
+        return NULL;
+    }
+
+    return sink.release();
+}
+
+ISource* WavBackend::open_source(core::IAllocator& allocator,
+                                 const char* driver,
+                                 const char* input,
+                                 const Config& config) {
+    (void)driver;
+
+    core::UniquePtr<WavSource> source(new (allocator) WavSource(allocator, config),
+                                      allocator);
+    if (!source) {
+        return NULL;
+    }
+
+    if (!source->valid()) {
+        return NULL;
+    }
+
+    if (!source->open(input)) {
+        return NULL;
+    }
+
+    return source.release();
+}
+
+bool WavBackend::get_drivers(core::Array<DriverInfo>& arr, int filter_flags) {
+    if (filter_flags & FilterFile) {
+        if (!add_driver_uniq(arr, "wav")) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/wav_sink.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum {
+    HeaderSize = 44,
+
+    // initial file mapping; doubled every time the data outgrows it
+    InitialMapSize = 1 * 1024 * 1024
+};
+
+void write_le16(uint8_t* p, uint16_t v) {
+    p[0] = uint8_t(v & 0xff);
+    p[1] = uint8_t(v >> 8);
+}
+
+void write_le32(uint8_t* p, uint32_t v) {
+    p[0] = uint8_t(v & 0xff);
+    p[1] = uint8_t((v >> 8) & 0xff);
+    p[2] = uint8_t((v >> 16) & 0xff);
+    p[3] = uint8_t(v >> 24);
+}
+
+} // namespace
+
+WavSink::WavSink(core::IAllocator& allocator, const Config& config)
+    : fd_(-1)
+    , map_(NULL)
+    , map_size_(0)
+    , data_size_(0)
+    , sample_rate_(config.sample_rate)
+    , n_channels_(packet::num_channels(config.channels))
+    , valid_(false) {
+    (void)allocator;
+
+    if (sample_rate_ == 0) {
+        roc_log(LogError, "wav sink: sample rate is zero");
+        return;
+    }
+
+    if (n_channels_ == 0) {
+        roc_log(LogError, "wav sink: # of channels is zero");
+        return;
+    }
+
+    valid_ = true;
+}
+
+WavSink::~WavSink() {
+    close_();
+}
+
+bool WavSink::valid() const {
+    return valid_;
+}
+
+bool WavSink::open(const char* output) {
+    roc_panic_if(!valid());
+
+    if (fd_ != -1) {
+        roc_panic("wav sink: can't call open() twice");
+    }
+
+    if (!output) {
+        roc_log(LogError, "wav sink: output file name is null");
+        return false;
+    }
+
+    fd_ = ::open(output, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ == -1) {
+        roc_log(LogError, "wav sink: open(%s): %s", output, core::errno_to_str().c_str());
+        return false;
+    }
+
+    if (!grow_(InitialMapSize)) {
+        close_();
+        return false;
+    }
+
+    if (!write_header_()) {
+        close_();
+        return false;
+    }
+
+    roc_log(LogInfo, "wav sink: opened output file: %s (%lu Hz, %lu ch, s16)", output,
+            (unsigned long)sample_rate_, (unsigned long)n_channels_);
+
+    return true;
+}
+
+bool WavSink::write_header_() {
+    uint8_t* p = map_;
+
+    // chunk sizes are patched with the actual data size in close_()
+    memcpy(p, "RIFF", 4);
+    write_le32(p + 4, HeaderSize - 8);
+    memcpy(p + 8, "WAVE", 4);
+
+    memcpy(p + 12, "fmt ", 4);
+    write_le32(p + 16, 16);
+    write_le16(p + 20, 1); // PCM
+    write_le16(p + 22, (uint16_t)n_channels_);
+    write_le32(p + 24, (uint32_t)sample_rate_);
+    write_le32(p + 28, uint32_t(sample_rate_ * n_channels_ * 2));
+    write_le16(p + 32, uint16_t(n_channels_ * 2));
+    write_le16(p + 34, 16);
+
+    memcpy(p + 36, "data", 4);
+    write_le32(p + 40, 0);
+
+    return true;
+}
+
+bool WavSink::grow_(size_t min_size) {
+    size_t new_size = map_size_ ? map_size_ : (size_t)InitialMapSize;
+    while (new_size < min_size) {
+        new_size *= 2;
+    }
+
+    if (map_) {
+        munmap(map_, map_size_);
+        map_ = NULL;
+    }
+
+    if (ftruncate(fd_, (off_t)new_size) == -1) {
+        roc_log(LogError, "wav sink: ftruncate(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    map_ = (uint8_t*)mmap(NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (map_ == MAP_FAILED) {
+        map_ = NULL;
+        roc_log(LogError, "wav sink: mmap(): %s", core::errno_to_str().c_str());
+        return false;
+    }
+
+    map_size_ = new_size;
+
+    return true;
+}
+
+size_t WavSink::sample_rate() const {
+    roc_panic_if(!valid());
+
+    return sample_rate_;
+}
+
+bool WavSink::has_clock() const {
+    return false;
+}
+
+void WavSink::write(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    if (fd_ == -1) {
+        roc_panic("wav sink: write: non-open output file");
+    }
+
+    const audio::sample_t* in = frame.data();
+    const size_t n_samples = frame.size();
+
+    if (HeaderSize + data_size_ + n_samples * 2 > map_size_) {
+        if (!grow_(HeaderSize + data_size_ + n_samples * 2)) {
+            roc_panic("wav sink: can't grow output file");
+        }
+    }
+
+    uint8_t* out = map_ + HeaderSize + data_size_;
+
+    for (size_t n = 0; n < n_samples; n++) {
+#ifdef ROC_FIXED_POINT
+        // Q15 samples match the 16-bit wav format exactly
+        write_le16(out + n * 2, (uint16_t)in[n]);
+#else
+        float s = in[n];
+
+        s *= 32768.0f;
+        s = std::min(s, +32767.0f);
+        s = std::max(s, -32768.0f);
+
+        write_le16(out + n * 2, (uint16_t)(int16_t)s);
+#endif
+    }
+
+    data_size_ += n_samples * 2;
+}
+
+void WavSink::close_() {
+    if (map_) {
+        // patch the chunk sizes written as zero in write_header_()
+        write_le32(map_ + 4, uint32_t(HeaderSize - 8 + data_size_));
+        write_le32(map_ + 40, (uint32_t)data_size_);
+
+        munmap(map_, map_size_);
+        map_ = NULL;
+    }
+
+    if (fd_ != -1) {
+        // trim the unused tail of the mapping
+        if (ftruncate(fd_, off_t(HeaderSize + data_size_)) == -1) {
+            roc_log(LogError, "wav sink: ftruncate(): %s", core::errno_to_str().c_str());
+        }
+
+        ::close(fd_);
+        fd_ = -1;
+
+        roc_log(LogInfo, "wav sink: closed output file (%lu samples)",
+                (unsigned long)(data_size_ / 2));
+    }
+}
+
+} // namespace sndio
+} // namespace roc
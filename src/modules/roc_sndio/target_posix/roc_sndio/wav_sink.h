@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_posix/roc_sndio/wav_sink.h
+//! @brief WAV sink.
+
+#ifndef ROC_SNDIO_WAV_SINK_H_
+#define ROC_SNDIO_WAV_SINK_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isink.h"
+
+namespace roc {
+namespace sndio {
+
+//! WAV sink.
+//! @remarks
+//!  Writes samples to a 16-bit PCM WAV file. The file is memory-mapped
+//!  and samples are converted directly into the mapping, so writes never
+//!  block on write(2); the kernel flushes the pages in background. The
+//!  mapping is grown with ftruncate() and remapped when it fills up, and
+//!  the file is trimmed to the actual data size when the sink is closed.
+class WavSink : public ISink, public core::NonCopyable<> {
+public:
+    //! Initialize.
+    WavSink(core::IAllocator& allocator, const Config& config);
+
+    virtual ~WavSink();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Open output file.
+    //!
+    //! @b Parameters
+    //!  - @p output is the output file name.
+    bool open(const char* output);
+
+    //! Get sample rate of the sink.
+    virtual size_t sample_rate() const;
+
+    //! Check if the sink has own clock.
+    virtual bool has_clock() const;
+
+    //! Write audio frame.
+    virtual void write(audio::Frame& frame);
+
+private:
+    bool write_header_();
+    bool grow_(size_t min_size);
+    void close_();
+
+    int fd_;
+
+    uint8_t* map_;
+    size_t map_size_;
+
+    size_t data_size_;
+
+    const size_t sample_rate_;
+    const size_t n_channels_;
+
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_WAV_SINK_H_
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "roc_core/errno_to_str.h"
+#include "roc_core/log.h"
+#include "roc_core/panic.h"
+#include "roc_sndio/wav_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+// WAV is little-endian; the fields are composed from bytes so that the
+// reads are portable and don't require alignment
+uint16_t read_le16(const uint8_t* p) {
+    return uint16_t(p[0] | (p[1] << 8));
+}
+
+uint32_t read_le32(const uint8_t* p) {
+    return uint32_t(p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+bool chunk_id_is(const uint8_t* p, const char* id) {
+    return memcmp(p, id, 4) == 0;
+}
+
+} // namespace
+
+WavSource::WavSource(core::IAllocator& allocator, const Config& config)
+    : fd_(-1)
+    , map_(NULL)
+    , map_size_(0)
+    , data_off_(0)
+    , data_size_(0)
+    , pos_(0)
+    , encoding_(Enc_None)
+    , sample_rate_(0)
+    , n_channels_(0)
+    , requested_channels_(packet::num_channels(config.channels))
+    , eof_(false)
+    , valid_(true) {
+    (void)allocator;
+}
+
+WavSource::~WavSource() {
+    close_();
+}
+
+bool WavSource::valid() const {
+    return valid_;
+}
+
+bool WavSource::open(const char* input) {
+    roc_panic_if(!valid());
+
+    if (fd_ != -1) {
+        roc_panic("wav source: can't call open() twice");
+    }
+
+    if (!input) {
+        roc_log(LogError, "wav source: input file name is null");
+        return false;
+    }
+
+    fd_ = ::open(input, O_RDONLY);
+    if (fd_ == -1) {
+        roc_log(LogError, "wav source: open(%s): %s", input, core::errno_to_str().c_str());
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd_, &st) == -1) {
+        roc_log(LogError, "wav source: fstat(%s): %s", input, core::errno_to_str().c_str());
+        close_();
+        return false;
+    }
+
+    map_size_ = (size_t)st.st_size;
+
+    map_ = (const uint8_t*)mmap(NULL, map_size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (map_ == MAP_FAILED) {
+        map_ = NULL;
+        roc_log(LogError, "wav source: mmap(%s): %s", input, core::errno_to_str().c_str());
+        close_();
+        return false;
+    }
+
+    if (!parse_header_()) {
+        close_();
+        return false;
+    }
+
+    roc_log(LogInfo,
+            "wav source: opened input file:"
+            " %s (%lu Hz, %lu ch, %s, %lu samples)",
+            input, (unsigned long)sample_rate_, (unsigned long)n_channels_,
+            encoding_ == Enc_Pcm16 ? "s16" : "f32",
+            (unsigned long)(data_size_ / (encoding_ == Enc_Pcm16 ? 2 : 4)));
+
+    return true;
+}
+
+bool WavSource::parse_header_() {
+    if (map_size_ < 12 || !chunk_id_is(map_, "RIFF") || !chunk_id_is(map_ + 8, "WAVE")) {
+        roc_log(LogError, "wav source: input file is not a WAV file");
+        return false;
+    }
+
+    size_t pos = 12;
+    size_t bits = 0;
+
+    while (pos + 8 <= map_size_) {
+        const uint8_t* chunk = map_ + pos;
+        const size_t chunk_size = read_le32(chunk + 4);
+
+        if (pos + 8 + chunk_size > map_size_) {
+            break;
+        }
+
+        if (chunk_id_is(chunk, "fmt ") && chunk_size >= 16) {
+            encoding_ = (Encoding)read_le16(chunk + 8);
+            n_channels_ = read_le16(chunk + 10);
+            sample_rate_ = read_le32(chunk + 12);
+            bits = read_le16(chunk + 22);
+        } else if (chunk_id_is(chunk, "data")) {
+            data_off_ = pos + 8;
+            data_size_ = chunk_size;
+        }
+
+        // chunks are 2-byte aligned
+        pos += 8 + chunk_size + (chunk_size & 1);
+    }
+
+    if (sample_rate_ == 0 || n_channels_ == 0 || data_off_ == 0) {
+        roc_log(LogError, "wav source: bad or missing fmt/data chunks");
+        return false;
+    }
+
+    if (!((encoding_ == Enc_Pcm16 && bits == 16)
+          || (encoding_ == Enc_Float32 && bits == 32))) {
+        roc_log(LogError,
+                "wav source: unsupported WAV encoding (format=%d bits=%lu),"
+                " use the sox driver for this file",
+                (int)encoding_, (unsigned long)bits);
+        return false;
+    }
+
+    if (requested_channels_ != 0 && n_channels_ != requested_channels_) {
+        roc_log(LogError,
+                "wav source: file has %lu channels, %lu requested,"
+                " use the sox driver for channel conversion",
+                (unsigned long)n_channels_, (unsigned long)requested_channels_);
+        return false;
+    }
+
+    return true;
+}
+
+size_t WavSource::sample_rate() const {
+    roc_panic_if(!valid());
+
+    if (fd_ == -1) {
+        roc_panic("wav source: sample_rate: non-open input file");
+    }
+
+    return sample_rate_;
+}
+
+bool WavSource::has_clock() const {
+    return false;
+}
+
+ISource::State WavSource::state() const {
+    return Active;
+}
+
+void WavSource::wait_active() const {
+    // always active
+}
+
+bool WavSource::read(audio::Frame& frame) {
+    roc_panic_if(!valid());
+
+    if (fd_ == -1) {
+        roc_panic("wav source: read: non-open input file");
+    }
+
+    if (eof_) {
+        return false;
+    }
+
+    const size_t sample_size = encoding_ == Enc_Pcm16 ? 2 : 4;
+    const size_t avail = (data_size_ - pos_) / sample_size;
+
+    if (avail == 0) {
+        eof_ = true;
+        return false;
+    }
+
+    audio::sample_t* out = frame.data();
+    const size_t n_samples = frame.size() < avail ? frame.size() : avail;
+
+    const uint8_t* in = map_ + data_off_ + pos_;
+
+    if (encoding_ == Enc_Pcm16) {
+        for (size_t n = 0; n < n_samples; n++) {
+#ifdef ROC_FIXED_POINT
+            // Q15 samples match the 16-bit wav format exactly
+            out[n] = (audio::sample_t)(int16_t)read_le16(in + n * 2);
+#else
+            out[n] = float((int16_t)read_le16(in + n * 2)) / 32768.0f;
+#endif
+        }
+    } else {
+        for (size_t n = 0; n < n_samples; n++) {
+            const uint32_t bits = read_le32(in + n * 4);
+            float f;
+            memcpy(&f, &bits, sizeof(f));
+#ifdef ROC_FIXED_POINT
+            f *= 32768.0f;
+            f = std::min(f, +32767.0f);
+            f = std::max(f, -32768.0f);
+            out[n] = (audio::sample_t)f;
+#else
+            out[n] = f;
+#endif
+        }
+    }
+
+    // the last frame is padded with silence
+    for (size_t n = n_samples; n < frame.size(); n++) {
+        out[n] = 0;
+    }
+
+    pos_ += n_samples * sample_size;
+
+    return true;
+}
+
+void WavSource::close_() {
+    if (map_) {
+        munmap((void*)map_, map_size_);
+        map_ = NULL;
+    }
+
+    if (fd_ != -1) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+//! @file roc_sndio/target_posix/roc_sndio/wav_source.h
+//! @brief WAV source.
+
+#ifndef ROC_SNDIO_WAV_SOURCE_H_
+#define ROC_SNDIO_WAV_SOURCE_H_
+
+#include "roc_core/iallocator.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/stddefs.h"
+#include "roc_packet/units.h"
+#include "roc_sndio/config.h"
+#include "roc_sndio/isource.h"
+
+namespace roc {
+namespace sndio {
+
+//! WAV source.
+//! @remarks
+//!  Reads samples from a PCM WAV file. The file is memory-mapped and
+//!  samples are converted directly from the mapping into the frame,
+//!  without the per-sample buffering a generic decoding library does.
+class WavSource : public ISource, private core::NonCopyable<> {
+public:
+    //! Initialize.
+    WavSource(core::IAllocator& allocator, const Config& config);
+
+    virtual ~WavSource();
+
+    //! Check if the object was successfully constructed.
+    bool valid() const;
+
+    //! Open input file.
+    //!
+    //! @b Parameters
+    //!  - @p input is the input file name.
+    //!
+    //! @remarks
+    //!  Fails if the file is not a PCM or IEEE-float WAV, or if its
+    //!  channel count doesn't match the one requested in config; an
+    //!  explicit sox driver may be used for such files instead.
+    bool open(const char* input);
+
+    //! Get sample rate of the input file.
+    virtual size_t sample_rate() const;
+
+    //! Check if the source has own clock.
+    virtual bool has_clock() const;
+
+    //! Get current source state.
+    virtual State state() const;
+
+    //! Wait until the source state becomes active.
+    virtual void wait_active() const;
+
+    //! Read frame.
+    virtual bool read(audio::Frame&);
+
+private:
+    bool parse_header_();
+    void close_();
+
+    // sample encodings, values match the WAV format tag
+    enum Encoding { Enc_None = 0, Enc_Pcm16 = 1, Enc_Float32 = 3 };
+
+    int fd_;
+
+    const uint8_t* map_;
+    size_t map_size_;
+
+    size_t data_off_;
+    size_t data_size_;
+    size_t pos_;
+
+    Encoding encoding_;
+    size_t sample_rate_;
+    size_t n_channels_;
+
+    const size_t requested_channels_;
+
+    bool eof_;
+    bool valid_;
+};
+
+} // namespace sndio
+} // namespace roc
+
+#endif // ROC_SNDIO_WAV_SOURCE_H_
@@ -41,6 +41,8 @@ PulseaudioSink::PulseaudioSink(const Config& config)
     , stream_(NULL)
     , timer_(NULL)
     , timer_deadline_(0)
+    , direct_data_(NULL)
+    , direct_size_(0)
     , rate_limiter_(ReportInterval) {
     if (config.latency != 0) {
         latency_ = config.latency;
@@ -118,6 +120,86 @@ void PulseaudioSink::write(audio::Frame& frame) {
     }
 }
 
+audio::sample_t* PulseaudioSink::begin_write(size_t size) {
+    ensure_started_();
+
+    if (direct_data_) {
+        roc_panic("pulseaudio sink: can't call begin_write() twice");
+    }
+
+    pa_threaded_mainloop_lock(mainloop_);
+
+    ensure_opened_();
+
+    const size_t n_bytes = size * sizeof(audio::sample_t);
+
+    const ssize_t writable_size = wait_stream_();
+
+    if (writable_size < 0 || (size_t)writable_size < n_bytes) {
+        pa_threaded_mainloop_unlock(mainloop_);
+        return NULL;
+    }
+
+    void* data = NULL;
+    size_t data_size = n_bytes;
+
+    if (int err = pa_stream_begin_write(stream_, &data, &data_size)) {
+        roc_log(LogError, "pulseaudio sink: pa_stream_begin_write(): %s",
+                pa_strerror(err));
+        pa_threaded_mainloop_unlock(mainloop_);
+        return NULL;
+    }
+
+    if (!data || data_size < n_bytes) {
+        // the server-shared buffer is too small for the whole frame;
+        // give it back and let the caller use the copying path
+        if (data) {
+            pa_stream_cancel_write(stream_);
+        }
+        pa_threaded_mainloop_unlock(mainloop_);
+        return NULL;
+    }
+
+    direct_data_ = data;
+    direct_size_ = size;
+
+    pa_threaded_mainloop_unlock(mainloop_);
+
+    return (audio::sample_t*)data;
+}
+
+void PulseaudioSink::end_write(size_t size) {
+    ensure_started_();
+
+    if (!direct_data_) {
+        roc_panic("pulseaudio sink: end_write() called without begin_write()");
+    }
+
+    if (size > direct_size_) {
+        roc_panic("pulseaudio sink: end_write() size is larger than requested");
+    }
+
+    pa_threaded_mainloop_lock(mainloop_);
+
+    int err = 0;
+
+    if (size == 0) {
+        err = pa_stream_cancel_write(stream_);
+    } else {
+        err = pa_stream_write(stream_, direct_data_, size * sizeof(audio::sample_t),
+                              NULL, 0, PA_SEEK_RELATIVE);
+    }
+
+    direct_data_ = NULL;
+    direct_size_ = 0;
+
+    pa_threaded_mainloop_unlock(mainloop_);
+
+    if (err != 0) {
+        roc_log(LogError, "pulseaudio sink: pa_stream_write(): %s", pa_strerror(err));
+    }
+}
+
 bool PulseaudioSink::write_frame_(audio::Frame& frame) {
     const audio::sample_t* data = frame.data();
     size_t size = frame.size();
@@ -44,6 +44,15 @@ public:
     //! Write audio frame.
     virtual void write(audio::Frame& frame);
 
+    //! Begin writing a frame directly into a server-shared buffer.
+    //! @remarks
+    //!  Returns NULL if a buffer of the requested size can't be obtained
+    //!  right now, in which case the caller should fall back to write().
+    virtual audio::sample_t* begin_write(size_t size);
+
+    //! Commit or cancel a buffer obtained from begin_write().
+    virtual void end_write(size_t size);
+
 private:
     static void context_state_cb_(pa_context* context, void* userdata);
 
@@ -110,6 +119,9 @@ private:
     pa_sample_spec sample_spec_;
     pa_buffer_attr buffer_attrs_;
 
+    void* direct_data_;
+    size_t direct_size_;
+
     core::RateLimiter rate_limiter_;
 };
 
@@ -14,6 +14,15 @@
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// If the sox and roc sample widths match, the sox I/O buffer can be handed
+// out to the pipeline as a frame buffer and the sample conversion is done
+// in place, without an intermediate copy (see begin_write()).
+enum { DirectIO = (sizeof(sox_sample_t) == sizeof(audio::sample_t)) };
+
+} // namespace
+
 SoxSink::SoxSink(core::IAllocator& allocator, const Config& config)
     : output_(NULL)
     , allocator_(allocator)
@@ -123,6 +132,41 @@ void SoxSink::write(audio::Frame& frame) {
     write_(buffer_data, buffer_pos);
 }
 
+audio::sample_t* SoxSink::begin_write(size_t size) {
+    roc_panic_if(!valid_);
+
+    if (!DirectIO || !buffer_ || size > buffer_size_) {
+        return NULL;
+    }
+
+    return (audio::sample_t*)buffer_.get();
+}
+
+void SoxSink::end_write(size_t size) {
+    roc_panic_if(!valid_);
+
+    if (size == 0) {
+        return;
+    }
+
+    if (size > buffer_size_) {
+        roc_panic("sox sink: end_write() size is larger than begin_write() buffer");
+    }
+
+    const audio::sample_t* frame_data = (const audio::sample_t*)buffer_.get();
+    sox_sample_t* buffer_data = buffer_.get();
+
+    SOX_SAMPLE_LOCALS;
+
+    size_t clips = 0;
+
+    for (size_t n = 0; n < size; n++) {
+        buffer_data[n] = SOX_FLOAT_32BIT_TO_SAMPLE(frame_data[n], clips);
+    }
+
+    write_(buffer_data, size);
+}
+
 bool SoxSink::prepare_() {
     buffer_.reset(new (allocator_) sox_sample_t[buffer_size_], allocator_);
 
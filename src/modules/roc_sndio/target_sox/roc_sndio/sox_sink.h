@@ -58,6 +58,16 @@ public:
     //! Write audio frame.
     virtual void write(audio::Frame& frame);
 
+    //! Begin writing a frame directly into the sox I/O buffer.
+    //! @remarks
+    //!  The caller fills the buffer with native samples and end_write()
+    //!  converts them to sox samples in place, so the samples move from
+    //!  the pipeline to sox without an intermediate copy.
+    virtual audio::sample_t* begin_write(size_t size);
+
+    //! Commit or cancel a buffer obtained from begin_write().
+    virtual void end_write(size_t size);
+
 private:
     bool prepare_();
     bool open_(const char* driver, const char* output);
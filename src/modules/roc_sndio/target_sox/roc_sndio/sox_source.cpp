@@ -14,6 +14,15 @@
 namespace roc {
 namespace sndio {
 
+namespace {
+
+// If the sox and roc sample widths match, sox can use roc frames as its
+// I/O buffers directly and the sample conversion is done in place, without
+// an intermediate buffer and an extra pass over every sample.
+enum { DirectIO = (sizeof(sox_sample_t) == sizeof(audio::sample_t)) };
+
+} // namespace
+
 SoxSource::SoxSource(core::IAllocator& allocator, const Config& config)
     : input_(NULL)
     , allocator_(allocator)
@@ -124,19 +133,32 @@ bool SoxSource::read(audio::Frame& frame) {
 
     while (frame_left != 0) {
         size_t n_samples = frame_left;
-        if (n_samples > buffer_size_) {
-            n_samples = buffer_size_;
+
+        if (DirectIO) {
+            // read sox samples straight into the frame and convert in place
+            n_samples = sox_read(input_, (sox_sample_t*)frame_data, n_samples);
+        } else {
+            if (n_samples > buffer_size_) {
+                n_samples = buffer_size_;
+            }
+            n_samples = sox_read(input_, buffer_data, n_samples);
         }
 
-        n_samples = sox_read(input_, buffer_data, n_samples);
         if (n_samples == 0) {
             roc_log(LogDebug, "sox source: got eof from sox");
             eof_ = true;
             break;
         }
 
-        for (size_t n = 0; n < n_samples; n++) {
-            frame_data[n] = (float)SOX_SAMPLE_TO_FLOAT_32BIT(buffer_data[n], clips);
+        if (DirectIO) {
+            for (size_t n = 0; n < n_samples; n++) {
+                const sox_sample_t s = ((sox_sample_t*)frame_data)[n];
+                frame_data[n] = (float)SOX_SAMPLE_TO_FLOAT_32BIT(s, clips);
+            }
+        } else {
+            for (size_t n = 0; n < n_samples; n++) {
+                frame_data[n] = (float)SOX_SAMPLE_TO_FLOAT_32BIT(buffer_data[n], clips);
+            }
         }
 
         frame_data += n_samples;
@@ -155,6 +177,11 @@ bool SoxSource::read(audio::Frame& frame) {
 }
 
 bool SoxSource::prepare_() {
+    if (DirectIO) {
+        // samples are read directly into frames, see read()
+        return true;
+    }
+
     buffer_.reset(new (allocator_) sox_sample_t[buffer_size_], allocator_);
 
     if (!buffer_) {
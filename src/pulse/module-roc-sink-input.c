@@ -96,14 +96,15 @@ static int pop_cb(pa_sink_input* i, size_t length, pa_memchunk* chunk) {
     /* start writing memblock */
     char *buf = pa_memblock_acquire(chunk->memblock);
 
-    /* prepare audio frame */
+    /* prepare audio frame pointing directly into the memblock, so that the
+     * receiver pipeline decodes samples in place, without a staging copy */
     roc_frame frame;
     memset(&frame, 0, sizeof(frame));
 
     frame.samples = buf;
     frame.samples_size = length;
 
-    /* read samples from file to memblock */
+    /* read samples from roc receiver directly into the memblock */
     int ret = roc_receiver_read(u->receiver, &frame);
 
     /* finish writing memblock */
@@ -91,7 +91,9 @@ static void process_samples(struct roc_sink_userdata* u, uint64_t expected_bytes
         /* start reading chunk's memblock */
         char *buf = pa_memblock_acquire(chunk.memblock);
 
-        /* prepare audio frame */
+        /* prepare audio frame pointing directly into the memblock; the
+         * sender pipeline packetizes samples straight from it, so there is
+         * no staging copy between pulseaudio and roc */
         roc_frame frame;
         memset(&frame, 0, sizeof(frame));
 
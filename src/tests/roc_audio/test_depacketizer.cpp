@@ -317,6 +317,60 @@ TEST(depacketizer, zeros_after_packet) {
                   0.00f);
 }
 
+TEST(depacketizer, dirty_region) {
+    audio::PCMEncoder encoder(pcm_funcs);
+    audio::PCMDecoder decoder(pcm_funcs);
+
+    CHECK(SamplesPerPacket % 2 == 0);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, ChMask, false);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+
+    core::Slice<sample_t> b1 = new_buffer(SamplesPerPacket);
+    core::Slice<sample_t> b2 = new_buffer(SamplesPerPacket);
+
+    Frame f1(b1.data(), b1.size());
+    Frame f2(b2.data(), b2.size());
+
+    dp.read(f1);
+    dp.read(f2);
+
+    UNSIGNED_LONGS_EQUAL(0, f1.dirty_begin());
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket * NumCh, f1.dirty_end());
+
+    UNSIGNED_LONGS_EQUAL(0, f2.dirty_begin());
+    UNSIGNED_LONGS_EQUAL(0, f2.dirty_end());
+}
+
+TEST(depacketizer, dirty_region_partial) {
+    audio::PCMEncoder encoder(pcm_funcs);
+    audio::PCMDecoder decoder(pcm_funcs);
+
+    CHECK(SamplesPerPacket % 2 == 0);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, ChMask, false);
+
+    queue.write(new_packet(encoder, 0, 0.11f));
+    queue.write(new_packet(encoder, SamplesPerPacket + SamplesPerPacket / 2, 0.22f));
+
+    expect_output(dp, SamplesPerPacket, 0.11f);
+
+    core::Slice<sample_t> buf = new_buffer(SamplesPerPacket);
+
+    Frame frame(buf.data(), buf.size());
+    dp.read(frame);
+
+    expect_values(frame.data(), SamplesPerPacket / 2 * NumCh, 0.00f);
+    expect_values(frame.data() + SamplesPerPacket / 2 * NumCh,
+                  SamplesPerPacket / 2 * NumCh, 0.22f);
+
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket / 2 * NumCh, frame.dirty_begin());
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket * NumCh, frame.dirty_end());
+}
+
 TEST(depacketizer, packet_after_zeros) {
     audio::PCMEncoder encoder(pcm_funcs);
     audio::PCMDecoder decoder(pcm_funcs);
@@ -509,5 +563,65 @@ TEST(depacketizer, timestamp) {
     }
 }
 
+TEST(depacketizer, slip_forward) {
+    enum { StartTimestamp = 1000, NumPackets = 4 };
+
+    audio::PCMEncoder encoder(pcm_funcs);
+    audio::PCMDecoder decoder(pcm_funcs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, ChMask, false);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(encoder,
+                               StartTimestamp + packet::timestamp_t(n * SamplesPerPacket),
+                               0.1f));
+    }
+
+    expect_output(dp, SamplesPerPacket, 0.1f);
+
+    // skip one packet worth of samples; the skipped packet is dropped
+    // as late and the stream continues from the packet after it
+    dp.slip(SamplesPerPacket);
+
+    expect_output(dp, SamplesPerPacket, 0.1f);
+    expect_output(dp, SamplesPerPacket, 0.1f);
+
+    UNSIGNED_LONGS_EQUAL(StartTimestamp + SamplesPerPacket * 4, dp.timestamp());
+
+    expect_output(dp, SamplesPerPacket, 0.0f);
+}
+
+TEST(depacketizer, slip_backward) {
+    enum { StartTimestamp = 1000, NumPackets = 3 };
+
+    audio::PCMEncoder encoder(pcm_funcs);
+    audio::PCMDecoder decoder(pcm_funcs);
+
+    packet::Queue queue;
+    Depacketizer dp(queue, decoder, ChMask, false);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(encoder,
+                               StartTimestamp + packet::timestamp_t(n * SamplesPerPacket),
+                               0.1f));
+    }
+
+    expect_output(dp, SamplesPerPacket, 0.1f);
+
+    // insert one packet worth of silence; the stream position doesn't
+    // advance during the inserted range
+    dp.slip(-(packet::timestamp_diff_t)SamplesPerPacket);
+
+    expect_output(dp, SamplesPerPacket, 0.0f);
+
+    UNSIGNED_LONGS_EQUAL(StartTimestamp + SamplesPerPacket, dp.timestamp());
+
+    expect_output(dp, SamplesPerPacket, 0.1f);
+    expect_output(dp, SamplesPerPacket, 0.1f);
+
+    UNSIGNED_LONGS_EQUAL(StartTimestamp + SamplesPerPacket * 3, dp.timestamp());
+}
+
 } // namespace audio
 } // namespace roc
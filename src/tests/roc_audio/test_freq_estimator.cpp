@@ -55,5 +55,23 @@ TEST(freq_estimator, small_queue_size) {
     } while (fe.freq_coeff() > 0.99f);
 }
 
+TEST(freq_estimator, set_target) {
+    FreqEstimator fe(Target);
+
+    for (size_t n = 0; n < 1000; n++) {
+        fe.update(Target);
+    }
+
+    DOUBLES_EQUAL(1.0, (double)fe.freq_coeff(), Epsilon);
+
+    fe.set_target(Target * 2);
+
+    // the queue is now below the target, so the coefficient should drop
+    // to let the queue grow
+    do {
+        fe.update(Target);
+    } while (fe.freq_coeff() > 0.99f);
+}
+
 } // namespace audio
 } // namespace roc
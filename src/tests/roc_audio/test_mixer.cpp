@@ -12,6 +12,7 @@
 #include "roc_core/buffer_pool.h"
 #include "roc_core/heap_allocator.h"
 #include "roc_core/stddefs.h"
+#include "roc_core/thread_pool.h"
 
 #include "test_mock_reader.h"
 
@@ -102,6 +103,53 @@ TEST(mixer, two_readers) {
     CHECK(reader2.num_unread() == 0);
 }
 
+TEST(mixer, two_readers_parallel) {
+    core::ThreadPool thread_pool(allocator, 2);
+    CHECK(thread_pool.valid());
+
+    MockReader reader1;
+    MockReader reader2;
+
+    Mixer mixer(buffer_pool, MaxSz, thread_pool, allocator);
+    CHECK(mixer.valid());
+
+    mixer.add(reader1);
+    mixer.add(reader2);
+
+    reader1.add(MaxSz * 2, 0.11f);
+    reader2.add(MaxSz * 2, 0.22f);
+
+    expect_output(mixer, MaxSz * 2, 0.33f);
+
+    CHECK(reader1.num_unread() == 0);
+    CHECK(reader2.num_unread() == 0);
+}
+
+// Enough readers to engage the tree reduction of the per-reader buffers.
+TEST(mixer, many_readers_parallel) {
+    enum { NumReaders = 11 };
+
+    core::ThreadPool thread_pool(allocator, 4);
+    CHECK(thread_pool.valid());
+
+    MockReader readers[NumReaders];
+
+    Mixer mixer(buffer_pool, MaxSz, thread_pool, allocator);
+    CHECK(mixer.valid());
+
+    for (size_t n = 0; n < NumReaders; n++) {
+        mixer.add(readers[n]);
+        readers[n].add(MaxSz * 2, 0.01f * (sample_t)(n + 1));
+    }
+
+    // 0.01 * (1 + 2 + ... + NumReaders)
+    expect_output(mixer, MaxSz * 2, 0.01f * (NumReaders * (NumReaders + 1) / 2));
+
+    for (size_t n = 0; n < NumReaders; n++) {
+        CHECK(readers[n].num_unread() == 0);
+    }
+}
+
 TEST(mixer, remove_reader) {
     MockReader reader1;
     MockReader reader2;
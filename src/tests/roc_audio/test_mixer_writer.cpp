@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/mixer_writer.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/stddefs.h"
+
+namespace roc {
+namespace audio {
+
+namespace {
+
+enum { BufSz = 100, MaxBuf = BufSz * 4, MaxSz = 500 };
+
+core::HeapAllocator allocator;
+core::BufferPool<sample_t> buffer_pool(allocator, MaxSz, true);
+
+class CollectWriter : public IWriter, public core::NonCopyable<> {
+public:
+    CollectWriter()
+        : samples_(allocator)
+        , n_frames_(0) {
+    }
+
+    virtual void write(Frame& frame) {
+        for (size_t n = 0; n < frame.size(); n++) {
+            CHECK(samples_.grow(samples_.size() + 1));
+            samples_.push_back(frame.data()[n]);
+        }
+        n_frames_++;
+    }
+
+    size_t n_frames() const {
+        return n_frames_;
+    }
+
+    size_t n_samples() const {
+        return samples_.size();
+    }
+
+    sample_t sample(size_t n) const {
+        return samples_[n];
+    }
+
+private:
+    core::Array<sample_t> samples_;
+    size_t n_frames_;
+};
+
+} // namespace
+
+TEST_GROUP(mixer_writer) {
+    void write_samples(IWriter& input, size_t sz, sample_t value) {
+        core::Slice<sample_t> buf =
+            new (buffer_pool) core::Buffer<sample_t>(buffer_pool);
+        CHECK(buf);
+        buf.resize(sz);
+
+        for (size_t n = 0; n < sz; n++) {
+            buf.data()[n] = value;
+        }
+
+        Frame frame(buf.data(), buf.size());
+        input.write(frame);
+    }
+
+    void expect_samples(const CollectWriter& output, size_t from, size_t sz,
+                        sample_t value) {
+        for (size_t n = 0; n < sz; n++) {
+            DOUBLES_EQUAL((double)value, (double)output.sample(from + n), 0.0001);
+        }
+    }
+};
+
+TEST(mixer_writer, one_input) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input = mixer.create_input();
+    CHECK(input);
+
+    write_samples(*input, BufSz, 0.11f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+    UNSIGNED_LONGS_EQUAL(BufSz, output.n_samples());
+    expect_samples(output, 0, BufSz, 0.11f);
+}
+
+TEST(mixer_writer, two_inputs) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input1 = mixer.create_input();
+    IWriter* input2 = mixer.create_input();
+    CHECK(input1);
+    CHECK(input2);
+
+    write_samples(*input1, BufSz, 0.11f);
+
+    // the mix waits for the second input
+    UNSIGNED_LONGS_EQUAL(0, output.n_frames());
+
+    write_samples(*input2, BufSz, 0.22f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+    expect_samples(output, 0, BufSz, 0.33f);
+}
+
+TEST(mixer_writer, partial_frames) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input1 = mixer.create_input();
+    IWriter* input2 = mixer.create_input();
+    CHECK(input1);
+    CHECK(input2);
+
+    write_samples(*input1, BufSz / 2, 0.11f);
+    write_samples(*input2, BufSz, 0.22f);
+
+    UNSIGNED_LONGS_EQUAL(0, output.n_frames());
+
+    write_samples(*input1, BufSz / 2, 0.11f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+    expect_samples(output, 0, BufSz, 0.33f);
+}
+
+TEST(mixer_writer, uneven_inputs) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input1 = mixer.create_input();
+    IWriter* input2 = mixer.create_input();
+    CHECK(input1);
+    CHECK(input2);
+
+    write_samples(*input1, BufSz * 2, 0.11f);
+    write_samples(*input2, BufSz, 0.22f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+
+    write_samples(*input2, BufSz, 0.33f);
+
+    UNSIGNED_LONGS_EQUAL(2, output.n_frames());
+    expect_samples(output, 0, BufSz, 0.33f);
+    expect_samples(output, BufSz, BufSz, 0.44f);
+}
+
+TEST(mixer_writer, clamp) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input1 = mixer.create_input();
+    IWriter* input2 = mixer.create_input();
+    CHECK(input1);
+    CHECK(input2);
+
+    write_samples(*input1, BufSz, 0.9f);
+    write_samples(*input2, BufSz, 0.9f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+    expect_samples(output, 0, BufSz, SampleMax);
+}
+
+TEST(mixer_writer, input_overrun) {
+    CollectWriter output;
+
+    MixerWriter mixer(output, buffer_pool, BufSz, MaxBuf, allocator);
+    CHECK(mixer.valid());
+
+    IWriter* input1 = mixer.create_input();
+    IWriter* input2 = mixer.create_input();
+    CHECK(input1);
+    CHECK(input2);
+
+    // the first input runs far ahead; its backlog is capped at MaxBuf,
+    // so the oldest samples are dropped and the newest are mixed
+    for (size_t n = 0; n < 10; n++) {
+        write_samples(*input1, BufSz, 0.01f * (n + 1));
+    }
+
+    write_samples(*input2, BufSz, 0.5f);
+
+    UNSIGNED_LONGS_EQUAL(1, output.n_frames());
+    expect_samples(output, 0, BufSz, 0.57f);
+}
+
+} // namespace audio
+} // namespace roc
@@ -132,7 +132,7 @@ public:
         : value_(0) {
     }
 
-    void write(IWriter& writer, size_t num_samples) {
+    void write(IWriter& writer, size_t num_samples, core::nanoseconds_t cycle_time = 0) {
         core::Slice<sample_t> buf =
             new (sample_buffer_pool) core::Buffer<sample_t>(sample_buffer_pool);
         CHECK(buf);
@@ -147,6 +147,7 @@ public:
         }
 
         Frame frame(buf.data(), buf.size());
+        frame.set_cycle_time(cycle_time);
         writer.write(frame);
     }
 
@@ -167,7 +168,7 @@ TEST(packetizer, one_buffer_one_packet) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
-                          byte_buffer_pool, ChMask, PacketDuration, SampleRate,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
                           PayloadType);
 
     FrameMaker frame_maker;
@@ -193,7 +194,7 @@ TEST(packetizer, one_buffer_multiple_packets) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
-                          byte_buffer_pool, ChMask, PacketDuration, SampleRate,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
                           PayloadType);
 
     FrameMaker frame_maker;
@@ -219,7 +220,7 @@ TEST(packetizer, multiple_buffers_one_packet) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
-                          byte_buffer_pool, ChMask, PacketDuration, SampleRate,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
                           PayloadType);
 
     FrameMaker frame_maker;
@@ -251,7 +252,7 @@ TEST(packetizer, multiple_buffers_multiple_packets) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
-                          byte_buffer_pool, ChMask, PacketDuration, SampleRate,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
                           PayloadType);
 
     FrameMaker frame_maker;
@@ -277,7 +278,7 @@ TEST(packetizer, flush) {
     packet::Queue packet_queue;
 
     Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
-                          byte_buffer_pool, ChMask, PacketDuration, SampleRate,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
                           PayloadType);
 
     FrameMaker frame_maker;
@@ -301,5 +302,151 @@ TEST(packetizer, flush) {
     }
 }
 
+TEST(packetizer, flush_deadline) {
+    const core::nanoseconds_t Deadline = PacketDuration / 2;
+
+    audio::PCMEncoder encoder(pcm_funcs);
+    audio::PCMDecoder decoder(pcm_funcs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
+                          PayloadType, Deadline);
+
+    FrameMaker frame_maker;
+    PacketChecker packet_checker(decoder);
+
+    // the packet is far from complete and its oldest sample is young
+    frame_maker.write(packetizer, SamplesPerPacket / 4, core::Second);
+    UNSIGNED_LONGS_EQUAL(0, packet_queue.size());
+
+    frame_maker.write(packetizer, SamplesPerPacket / 4, core::Second + Deadline / 2);
+    UNSIGNED_LONGS_EQUAL(0, packet_queue.size());
+
+    // the oldest buffered sample reaches the deadline and the
+    // partially filled packet is emitted
+    frame_maker.write(packetizer, SamplesPerPacket / 4, core::Second + Deadline);
+    UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+
+    packet_checker.read(packet_queue, SamplesPerPacket / 4 * 3);
+
+    // a complete packet is still emitted on size, before its deadline
+    frame_maker.write(packetizer, SamplesPerPacket, core::Second + Deadline * 2);
+    UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+
+    packet_checker.read(packet_queue, SamplesPerPacket);
+}
+
+TEST(packetizer, dtx) {
+    enum { KeepalivePackets = 3 };
+
+    const core::nanoseconds_t KeepaliveDuration = PacketDuration * KeepalivePackets;
+
+    audio::PCMEncoder encoder(pcm_funcs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
+                          byte_buffer_pool, ChMask, PacketDuration, KeepaliveDuration,
+                          SampleRate, PayloadType);
+
+    sample_t silence[SamplesPerPacket * NumCh] = {};
+
+    // silent frames are suppressed until the keepalive interval expires
+    for (size_t n = 0; n < KeepalivePackets - 1; n++) {
+        Frame frame(silence, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+
+        UNSIGNED_LONGS_EQUAL(0, packet_queue.size());
+    }
+
+    // this frame completes the keepalive interval and is emitted
+    {
+        Frame frame(silence, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+
+        UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+    }
+
+    packet::PacketPtr keepalive = packet_queue.read();
+    CHECK(keepalive);
+    CHECK(keepalive->rtp()->marker);
+
+    // an emitted packet restarts the keepalive interval
+    for (size_t n = 0; n < KeepalivePackets - 1; n++) {
+        Frame frame(silence, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+
+        UNSIGNED_LONGS_EQUAL(0, packet_queue.size());
+    }
+
+    // a frame with signal is packetized immediately
+    {
+        sample_t signal[SamplesPerPacket * NumCh];
+        for (size_t n = 0; n < SamplesPerPacket * NumCh; n++) {
+            signal[n] = 0.5f;
+        }
+
+        Frame frame(signal, SamplesPerPacket * NumCh);
+        packetizer.write(frame);
+
+        UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+    }
+
+    packet::PacketPtr pp = packet_queue.read();
+    CHECK(pp);
+    CHECK(pp->rtp()->marker);
+
+    // the sequence number is contiguous, so the gap is not seen as loss,
+    // while the timestamp accounts for the suppressed silence
+    UNSIGNED_LONGS_EQUAL(packet::seqnum_t(keepalive->rtp()->seqnum + 1),
+                         pp->rtp()->seqnum);
+    UNSIGNED_LONGS_EQUAL(packet::timestamp_t(keepalive->rtp()->timestamp
+                                             + SamplesPerPacket * KeepalivePackets),
+                         pp->rtp()->timestamp);
+}
+
+TEST(packetizer, payload_limit) {
+    enum { Mult = 2 };
+
+    audio::PCMEncoder encoder(pcm_funcs);
+
+    packet::Queue packet_queue;
+
+    Packetizer packetizer(packet_queue, rtp_composer, encoder, packet_pool,
+                          byte_buffer_pool, ChMask, PacketDuration, 0, SampleRate,
+                          PayloadType);
+
+    FrameMaker frame_maker;
+
+    const size_t base_payload = encoder.encoded_size(SamplesPerPacket);
+
+    // the packet grows to the largest whole multiple of the configured
+    // length that fits the budget
+    packetizer.set_payload_limit(base_payload * Mult + base_payload / 2);
+
+    frame_maker.write(packetizer, SamplesPerPacket * Mult);
+
+    UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+
+    packet::PacketPtr pp = packet_queue.read();
+    CHECK(pp);
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket * Mult, pp->rtp()->duration);
+    UNSIGNED_LONGS_EQUAL(base_payload * Mult, pp->rtp()->payload.size());
+
+    // a budget below one packet never shrinks below the configured length
+    packetizer.set_payload_limit(base_payload / 2);
+
+    frame_maker.write(packetizer, SamplesPerPacket);
+
+    UNSIGNED_LONGS_EQUAL(1, packet_queue.size());
+
+    pp = packet_queue.read();
+    CHECK(pp);
+    UNSIGNED_LONGS_EQUAL(SamplesPerPacket, pp->rtp()->duration);
+    UNSIGNED_LONGS_EQUAL(base_payload, pp->rtp()->payload.size());
+}
+
 } // namespace audio
 } // namespace roc
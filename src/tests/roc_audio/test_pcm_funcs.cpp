@@ -104,6 +104,24 @@ TEST(pcm_funcs, payload_size_2ch) {
                          funcs->payload_size_from_samples(NumSamples));
 }
 
+TEST(pcm_funcs, payload_size_2ch_24bit) {
+    enum { NumSamples = 77 };
+
+    use(PCM_int24_2ch);
+
+    UNSIGNED_LONGS_EQUAL(NumSamples * 2 * 3,
+                         funcs->payload_size_from_samples(NumSamples));
+}
+
+TEST(pcm_funcs, payload_size_2ch_float) {
+    enum { NumSamples = 77 };
+
+    use(PCM_float32_2ch);
+
+    UNSIGNED_LONGS_EQUAL(NumSamples * 2 * sizeof(float),
+                         funcs->payload_size_from_samples(NumSamples));
+}
+
 TEST(pcm_funcs, encode_decode_1ch) {
     enum { NumSamples = 5 };
 
@@ -146,6 +164,77 @@ TEST(pcm_funcs, encode_decode_2ch) {
     check(samples, NumSamples, 0x3);
 }
 
+TEST(pcm_funcs, encode_decode_2ch_24bit) {
+    enum { NumSamples = 5 };
+
+    use(PCM_int24_2ch);
+
+    core::Slice<uint8_t> bp = new_buffer(NumSamples);
+
+    const audio::sample_t samples[NumSamples * 2] = {
+        -0.1f, 0.1f, //
+        -0.2f, 0.2f, //
+        -0.3f, 0.3f, //
+        -0.4f, 0.4f, //
+        -0.5f, 0.5f, //
+    };
+
+    encode(bp, samples, 0, NumSamples, 0x3);
+    decode(bp, 0, NumSamples, 0x3);
+
+    check(samples, NumSamples, 0x3);
+}
+
+TEST(pcm_funcs, encode_decode_2ch_float) {
+    enum { NumSamples = 5 };
+
+    use(PCM_float32_2ch);
+
+    core::Slice<uint8_t> bp = new_buffer(NumSamples);
+
+    const audio::sample_t samples[NumSamples * 2] = {
+        -0.1f, 0.1f, //
+        -0.2f, 0.2f, //
+        -0.3f, 0.3f, //
+        -0.4f, 0.4f, //
+        -0.5f, 0.5f, //
+    };
+
+    encode(bp, samples, 0, NumSamples, 0x3);
+    decode(bp, 0, NumSamples, 0x3);
+
+    check(samples, NumSamples, 0x3);
+}
+
+TEST(pcm_funcs, encode_mask_subset_24bit) {
+    enum { NumSamples = 5 };
+
+    use(PCM_int24_2ch);
+
+    core::Slice<uint8_t> bp = new_buffer(NumSamples);
+
+    const audio::sample_t input[NumSamples] = {
+        0.1f, //
+        0.2f, //
+        0.3f, //
+        0.4f, //
+        0.5f, //
+    };
+
+    encode(bp, input, 0, NumSamples, 0x2);
+    decode(bp, 0, NumSamples, 0x3);
+
+    const audio::sample_t output[NumSamples * 2] = {
+        0.0f, 0.1f, //
+        0.0f, 0.2f, //
+        0.0f, 0.3f, //
+        0.0f, 0.4f, //
+        0.0f, 0.5f, //
+    };
+
+    check(output, NumSamples, 0x3);
+}
+
 TEST(pcm_funcs, encode_mask_subset) {
     enum { NumSamples = 5 };
 
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_audio/sinc_table_cache.h"
+
+namespace roc {
+namespace audio {
+
+TEST_GROUP(sinc_table_cache) {};
+
+TEST(sinc_table_cache, same_config_shares_table) {
+    const float* t1 = SincTableCache::instance().get(32, 128);
+    const float* t2 = SincTableCache::instance().get(32, 128);
+
+    CHECK(t1);
+    CHECK(t1 == t2);
+}
+
+TEST(sinc_table_cache, different_config_different_table) {
+    const float* t1 = SincTableCache::instance().get(32, 128);
+    const float* t2 = SincTableCache::instance().get(16, 64);
+
+    CHECK(t1);
+    CHECK(t2);
+    CHECK(t1 != t2);
+}
+
+TEST(sinc_table_cache, table_contents) {
+    enum { WindowSize = 16, WindowInterp = 64 };
+
+    const float* table = SincTableCache::instance().get(WindowSize, WindowInterp);
+    CHECK(table);
+
+    // sinc(0) == 1, and the last two entries are zero padding.
+    DOUBLES_EQUAL(1.0, (double)table[0], 1e-9);
+    DOUBLES_EQUAL(0.0, (double)table[WindowSize * WindowInterp], 1e-9);
+    DOUBLES_EQUAL(0.0, (double)table[WindowSize * WindowInterp + 1], 1e-9);
+}
+
+} // namespace audio
+} // namespace roc
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/alignment.h"
+#include "roc_core/hugepage_allocator.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(hugepage_allocator) {};
+
+TEST(hugepage_allocator, allocate_deallocate) {
+    HugepageAllocator allocator;
+
+    void* small = allocator.allocate(64);
+    CHECK(small);
+
+    // larger than the default huge page size
+    void* large = allocator.allocate(3 * 1024 * 1024);
+    CHECK(large);
+
+    LONGS_EQUAL(2, allocator.num_allocations());
+
+    memset(small, 0xaa, 64);
+    memset(large, 0xbb, 3 * 1024 * 1024);
+
+    allocator.deallocate(small);
+    allocator.deallocate(large);
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+}
+
+TEST(hugepage_allocator, alignment) {
+    HugepageAllocator allocator;
+
+    void* memory = allocator.allocate(1);
+    CHECK(memory);
+
+    UNSIGNED_LONGS_EQUAL(0, (uintptr_t)memory % sizeof(MaxAlign));
+
+    allocator.deallocate(memory);
+}
+
+} // namespace core
+} // namespace roc
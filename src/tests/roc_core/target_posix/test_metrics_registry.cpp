@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/metrics_registry.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(metrics_registry) {};
+
+TEST(metrics_registry, find_or_add) {
+    Atomic* counter = MetricsRegistry::instance().find_or_add_counter("test_counter");
+    CHECK(counter);
+
+    counter->store_relaxed(0);
+
+    counter->incr_relaxed();
+    counter->add_relaxed(10);
+    counter->decr_relaxed();
+
+    LONGS_EQUAL(10, counter->load_relaxed());
+
+    // The same name maps to the same counter.
+    POINTERS_EQUAL(counter,
+                   MetricsRegistry::instance().find_or_add_counter("test_counter"));
+
+    // A different name maps to a different counter.
+    Atomic* other = MetricsRegistry::instance().find_or_add_counter("test_counter_2");
+    CHECK(other);
+    CHECK(other != counter);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/alignment.h"
+#include "roc_core/arena_allocator.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/scoped_arena.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { ChunkSize = 1024 };
+
+} // namespace
+
+TEST_GROUP(arena_allocator) {
+    HeapAllocator heap;
+};
+
+TEST(arena_allocator, allocate_aligned) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    void* ptr1 = arena.allocate(1);
+    CHECK(ptr1);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr1 % sizeof(MaxAlign));
+
+    void* ptr2 = arena.allocate(3);
+    CHECK(ptr2);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr2 % sizeof(MaxAlign));
+
+    CHECK(ptr1 != ptr2);
+}
+
+TEST(arena_allocator, allocate_one_chunk) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    LONGS_EQUAL(0, heap.num_allocations());
+
+    for (size_t n = 0; n < ChunkSize / sizeof(MaxAlign); n++) {
+        CHECK(arena.allocate(sizeof(MaxAlign)));
+    }
+
+    UNSIGNED_LONGS_EQUAL(1, arena.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+}
+
+TEST(arena_allocator, allocate_many_chunks) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    for (size_t n = 0; n < 10; n++) {
+        CHECK(arena.allocate(ChunkSize));
+    }
+
+    UNSIGNED_LONGS_EQUAL(10, arena.num_chunks());
+    LONGS_EQUAL(10, heap.num_allocations());
+}
+
+TEST(arena_allocator, allocate_oversized) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    void* ptr = arena.allocate(ChunkSize * 10);
+    CHECK(ptr);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr % sizeof(MaxAlign));
+
+    UNSIGNED_LONGS_EQUAL(1, arena.num_chunks());
+}
+
+TEST(arena_allocator, reset_reuses_chunks) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    void* ptr1 = arena.allocate(ChunkSize);
+    CHECK(ptr1);
+
+    arena.reset();
+
+    void* ptr2 = arena.allocate(ChunkSize);
+    CHECK(ptr2);
+
+    CHECK(ptr1 == ptr2);
+
+    UNSIGNED_LONGS_EQUAL(1, arena.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+}
+
+TEST(arena_allocator, destructor_releases_chunks) {
+    {
+        ArenaAllocator arena(heap, ChunkSize);
+
+        for (size_t n = 0; n < 10; n++) {
+            CHECK(arena.allocate(ChunkSize));
+        }
+
+        LONGS_EQUAL(10, heap.num_allocations());
+    }
+
+    LONGS_EQUAL(0, heap.num_allocations());
+}
+
+TEST(arena_allocator, scoped_arena) {
+    ArenaAllocator arena(heap, ChunkSize);
+
+    void* ptr1 = NULL;
+
+    {
+        ScopedArena scope(arena);
+
+        ptr1 = scope.allocator().allocate(ChunkSize);
+        CHECK(ptr1);
+    }
+
+    void* ptr2 = arena.allocate(ChunkSize);
+    CHECK(ptr1 == ptr2);
+
+    UNSIGNED_LONGS_EQUAL(1, arena.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+}
+
+} // namespace core
+} // namespace roc
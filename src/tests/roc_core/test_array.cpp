@@ -120,6 +120,53 @@ TEST(array, front_back) {
     }
 }
 
+TEST(array, embedded_capacity) {
+    LONGS_EQUAL(0, allocator.num_allocations());
+
+    {
+        Array<Object, 3> array(allocator);
+
+        LONGS_EQUAL(3, array.max_size());
+        LONGS_EQUAL(0, array.size());
+
+        array.push_back(Object(1));
+        array.push_back(Object(2));
+        array.push_back(Object(3));
+
+        LONGS_EQUAL(0, allocator.num_allocations());
+        LONGS_EQUAL(3, Object::n_objects);
+
+        for (size_t n = 0; n < 3; n++) {
+            LONGS_EQUAL(n + 1, array[n].value);
+        }
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+    LONGS_EQUAL(0, Object::n_objects);
+}
+
+TEST(array, embedded_overflow) {
+    LONGS_EQUAL(0, allocator.num_allocations());
+
+    {
+        Array<Object, 3> array(allocator);
+
+        CHECK(array.resize(3));
+
+        LONGS_EQUAL(0, allocator.num_allocations());
+
+        CHECK(array.resize(5));
+
+        LONGS_EQUAL(1, allocator.num_allocations());
+        LONGS_EQUAL(5, array.max_size());
+        LONGS_EQUAL(5, array.size());
+        LONGS_EQUAL(5, Object::n_objects);
+    }
+
+    LONGS_EQUAL(0, allocator.num_allocations());
+    LONGS_EQUAL(0, Object::n_objects);
+}
+
 TEST(array, constructor_destructor) {
     LONGS_EQUAL(0, allocator.num_allocations());
 
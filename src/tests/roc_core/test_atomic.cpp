@@ -40,5 +40,42 @@ TEST(atomic, inc_dec) {
     CHECK(a == 0);
 }
 
+TEST(atomic, explicit_load_store) {
+    Atomic a(1);
+
+    CHECK(a.load_relaxed() == 1);
+    CHECK(a.load_acquire() == 1);
+
+    a.store_relaxed(2);
+    CHECK(a == 2);
+
+    a.store_release(3);
+    CHECK(a == 3);
+}
+
+TEST(atomic, cas) {
+    Atomic a(1);
+
+    CHECK(!a.cas(2, 3));
+    CHECK(a == 1);
+
+    CHECK(a.cas(1, 3));
+    CHECK(a == 3);
+}
+
+TEST(atomic, explicit_inc_dec) {
+    Atomic a;
+
+    CHECK(a.incr_relaxed() == 1);
+    CHECK(a == 1);
+
+    CHECK(a.decr_relaxed() == 0);
+    CHECK(a == 0);
+
+    CHECK(a.incr_relaxed() == 1);
+    CHECK(a.decr_acq_rel() == 0);
+    CHECK(a == 0);
+}
+
 } // namespace core
 } // namespace roc
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/alignment.h"
+#include "roc_core/buffer.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/slice.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(buffer) {
+    HeapAllocator allocator;
+};
+
+TEST(buffer, data_cache_line_aligned) {
+    enum { BufSize = 200, NumBuffers = 10 };
+
+    BufferPool<float> pool(allocator, BufSize, true);
+
+    Slice<float> slices[NumBuffers];
+
+    for (size_t n = 0; n < NumBuffers; n++) {
+        Buffer<float>* buffer = new (pool) Buffer<float>(pool);
+        CHECK(buffer);
+
+        slices[n] = Slice<float>(buffer);
+
+        UNSIGNED_LONGS_EQUAL(0, (uintptr_t)buffer->data() % CacheLineSize);
+    }
+}
+
+TEST(buffer, container_of) {
+    BufferPool<uint8_t> pool(allocator, 100, true);
+
+    Buffer<uint8_t>* buffer = new (pool) Buffer<uint8_t>(pool);
+    CHECK(buffer);
+
+    Slice<uint8_t> slice(buffer);
+
+    CHECK(Buffer<uint8_t>::container_of(buffer->data()) == buffer);
+}
+
+} // namespace core
+} // namespace roc
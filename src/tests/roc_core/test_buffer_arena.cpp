@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_arena.h"
+#include "roc_core/heap_allocator.h"
+
+namespace roc {
+namespace core {
+
+enum { BufferSize = 100, NumSlots = 4 };
+
+TEST_GROUP(buffer_arena) {
+    HeapAllocator allocator;
+};
+
+TEST(buffer_arena, acquire) {
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    Slice<uint8_t> buffer = arena.acquire(50);
+
+    CHECK(buffer);
+    UNSIGNED_LONGS_EQUAL(50, buffer.size());
+}
+
+TEST(buffer_arena, acquire_too_large) {
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    CHECK(!arena.acquire(BufferSize + 1));
+}
+
+TEST(buffer_arena, recycle) {
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    uint8_t* data = NULL;
+
+    {
+        Slice<uint8_t> buffer = arena.acquire(50);
+        CHECK(buffer);
+        data = buffer.data();
+    }
+
+    // the buffer was released, so the arena reuses it instead of
+    // going to the pool
+    Slice<uint8_t> buffer = arena.acquire(70);
+
+    CHECK(buffer);
+    UNSIGNED_LONGS_EQUAL(70, buffer.size());
+    POINTERS_EQUAL(data, buffer.data());
+}
+
+TEST(buffer_arena, no_recycle_while_referenced) {
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    Slice<uint8_t> held = arena.acquire(50);
+    CHECK(held);
+
+    Slice<uint8_t> buffer = arena.acquire(50);
+    CHECK(buffer);
+
+    CHECK(held.data() != buffer.data());
+}
+
+TEST(buffer_arena, steady_state) {
+    enum { NumIterations = 10 };
+
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    uint8_t* data[NumSlots] = {};
+
+    for (size_t i = 0; i < NumIterations; i++) {
+        Slice<uint8_t> buffers[NumSlots];
+
+        for (size_t n = 0; n < NumSlots; n++) {
+            buffers[n] = arena.acquire(BufferSize);
+            CHECK(buffers[n]);
+
+            if (i == 0) {
+                data[n] = buffers[n].data();
+            } else {
+                // after warm-up, every buffer comes from one of the
+                // retained slots, none from the pool
+                size_t slot = 0;
+                for (; slot < NumSlots; slot++) {
+                    if (data[slot] == buffers[n].data()) {
+                        break;
+                    }
+                }
+                CHECK(slot != NumSlots);
+            }
+        }
+    }
+}
+
+TEST(buffer_arena, overflow_falls_back_to_pool) {
+    BufferPool<uint8_t> pool(allocator, BufferSize, true);
+    BufferArena<uint8_t> arena(pool, allocator);
+
+    CHECK(arena.resize(NumSlots));
+
+    Slice<uint8_t> buffers[NumSlots + 1];
+
+    for (size_t n = 0; n < NumSlots + 1; n++) {
+        buffers[n] = arena.acquire(BufferSize);
+        CHECK(buffers[n]);
+
+        for (size_t k = 0; k < n; k++) {
+            CHECK(buffers[k].data() != buffers[n].data());
+        }
+    }
+}
+
+} // namespace core
+} // namespace roc
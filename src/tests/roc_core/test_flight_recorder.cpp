@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "roc_core/flight_recorder.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(flight_recorder) {};
+
+TEST(flight_recorder, record_and_dump) {
+    FlightRecorder& fr = FlightRecorder::instance();
+
+    // more records than the ring holds; old ones are silently overwritten
+    for (uint32_t n = 0; n < 10000; n++) {
+        fr.record(FlightRecorder::Stage_NetioRecv, 1, n, n % 1400);
+    }
+
+    char path[64] = {};
+    snprintf(path, sizeof(path), "/tmp/roc_flight_%d.txt", (int)getpid());
+
+    CHECK(fr.dump(path));
+
+    FILE* fp = fopen(path, "r");
+    CHECK(fp);
+
+    size_t n_lines = 0;
+    int ch;
+    while ((ch = fgetc(fp)) != EOF) {
+        if (ch == '\n') {
+            n_lines++;
+        }
+    }
+    fclose(fp);
+    remove(path);
+
+    CHECK(n_lines > 0);
+}
+
+TEST(flight_recorder, dump_bad_path) {
+    CHECK(!FlightRecorder::instance().dump("/nonexistent_dir/flight.txt"));
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/hashmap.h"
+#include "roc_core/heap_allocator.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct Object : HashmapNode {
+    size_t value;
+
+    Object()
+        : value(0) {
+    }
+
+    size_t key() const {
+        return value;
+    }
+
+    static size_t key_hash(size_t key) {
+        return key;
+    }
+};
+
+} // namespace
+
+TEST_GROUP(hashmap) {
+    HeapAllocator allocator;
+};
+
+TEST(hashmap, empty) {
+    Hashmap<Object, size_t> hashmap(allocator);
+    CHECK(hashmap.grow(8));
+
+    UNSIGNED_LONGS_EQUAL(0, hashmap.size());
+    CHECK(hashmap.find(0) == NULL);
+}
+
+TEST(hashmap, insert_find_remove) {
+    Hashmap<Object, size_t> hashmap(allocator);
+    CHECK(hashmap.grow(8));
+
+    Object obj;
+    obj.value = 12345;
+
+    hashmap.insert(obj);
+
+    UNSIGNED_LONGS_EQUAL(1, hashmap.size());
+    CHECK(hashmap.find(12345) == &obj);
+    CHECK(hashmap.find(54321) == NULL);
+
+    hashmap.remove(obj);
+
+    UNSIGNED_LONGS_EQUAL(0, hashmap.size());
+    CHECK(hashmap.find(12345) == NULL);
+}
+
+TEST(hashmap, many_elements_few_buckets) {
+    enum { NumObjects = 100, NumBuckets = 8 };
+
+    Hashmap<Object, size_t> hashmap(allocator);
+    CHECK(hashmap.grow(NumBuckets));
+
+    Object objs[NumObjects];
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        objs[n].value = n;
+        hashmap.insert(objs[n]);
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumObjects, hashmap.size());
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        CHECK(hashmap.find(n) == &objs[n]);
+    }
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        hashmap.remove(objs[n]);
+        CHECK(hashmap.find(n) == NULL);
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, hashmap.size());
+}
+
+TEST(hashmap, duplicate_keys) {
+    Hashmap<Object, size_t> hashmap(allocator);
+    CHECK(hashmap.grow(8));
+
+    Object obj1;
+    Object obj2;
+
+    obj1.value = obj2.value = 7;
+
+    hashmap.insert(obj1);
+    hashmap.insert(obj2);
+
+    Object* first = hashmap.find(7);
+    CHECK(first == &obj1 || first == &obj2);
+
+    Object* second = hashmap.find_next(*first, 7);
+    CHECK(second != NULL);
+    CHECK(second != first);
+    CHECK(second == &obj1 || second == &obj2);
+
+    CHECK(hashmap.find_next(*second, 7) == NULL);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/helpers.h"
+#include "roc_core/histogram.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(histogram) {};
+
+TEST(histogram, empty) {
+    Histogram h;
+
+    UNSIGNED_LONGS_EQUAL(0, h.total());
+    LONGS_EQUAL(0, h.percentile(50));
+    LONGS_EQUAL(0, h.percentile(100));
+}
+
+TEST(histogram, exact_small_values) {
+    Histogram h;
+
+    for (nanoseconds_t v = 1; v <= 10; v++) {
+        h.add(v);
+    }
+
+    UNSIGNED_LONGS_EQUAL(10, h.total());
+
+    LONGS_EQUAL(1, h.percentile(10));
+    LONGS_EQUAL(5, h.percentile(50));
+    LONGS_EQUAL(9, h.percentile(90));
+    LONGS_EQUAL(10, h.percentile(100));
+}
+
+TEST(histogram, bounded_error) {
+    const nanoseconds_t values[] = {
+        100, 1000, 12345, 1000000, 123456789, 10000000000ll,
+    };
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(values); n++) {
+        Histogram h;
+
+        h.add(values[n]);
+
+        const nanoseconds_t bound = h.percentile(100);
+
+        CHECK(bound >= values[n]);
+        CHECK(bound <= values[n] + values[n] / 8);
+    }
+}
+
+TEST(histogram, tail_percentiles) {
+    Histogram h;
+
+    for (size_t n = 0; n < 998; n++) {
+        h.add(Millisecond);
+    }
+    h.add(Second);
+    h.add(Second);
+
+    UNSIGNED_LONGS_EQUAL(1000, h.total());
+
+    CHECK(h.percentile(99) < 2 * Millisecond);
+    CHECK(h.percentile(99.9) >= Second / 2);
+    CHECK(h.percentile(100) >= Second);
+}
+
+TEST(histogram, negative_clamped) {
+    Histogram h;
+
+    h.add(-1);
+
+    UNSIGNED_LONGS_EQUAL(1, h.total());
+    LONGS_EQUAL(0, h.percentile(100));
+}
+
+} // namespace core
+} // namespace roc
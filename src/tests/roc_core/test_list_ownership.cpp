@@ -79,6 +79,50 @@ TEST(list_ownership, remove) {
     LONGS_EQUAL(0, obj.getref());
 }
 
+TEST(list_ownership, detach) {
+    Object obj1;
+    Object obj2;
+
+    TestList list;
+
+    list.push_back(obj1);
+    list.push_back(obj2);
+
+    LONGS_EQUAL(1, obj1.getref());
+    LONGS_EQUAL(1, obj2.getref());
+
+    POINTERS_EQUAL(&obj1, list.detach_front());
+    POINTERS_EQUAL(&obj2, list.detach_back());
+
+    // references held by the list were transferred to the caller
+    LONGS_EQUAL(1, obj1.getref());
+    LONGS_EQUAL(1, obj2.getref());
+
+    POINTERS_EQUAL(NULL, list.detach_front());
+    POINTERS_EQUAL(NULL, list.detach_back());
+
+    obj1.decref();
+    obj2.decref();
+}
+
+TEST(list_ownership, detach_adopt) {
+    Object obj;
+
+    TestList list;
+
+    list.push_back(obj);
+
+    {
+        SharedPtr<Object> ptr;
+        ptr.adopt(list.detach_front());
+
+        POINTERS_EQUAL(&obj, ptr.get());
+        LONGS_EQUAL(1, obj.getref());
+    }
+
+    LONGS_EQUAL(0, obj.getref());
+}
+
 TEST(list_ownership, destructor) {
     Object obj;
 
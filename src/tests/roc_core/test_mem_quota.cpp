@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/mem_quota.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(mem_quota) {};
+
+TEST(mem_quota, acquire_release) {
+    MemQuota quota(100);
+
+    UNSIGNED_LONGS_EQUAL(100, quota.max_bytes());
+    UNSIGNED_LONGS_EQUAL(0, quota.used());
+
+    CHECK(quota.acquire(60));
+    UNSIGNED_LONGS_EQUAL(60, quota.used());
+
+    CHECK(quota.acquire(40));
+    UNSIGNED_LONGS_EQUAL(100, quota.used());
+
+    // a failed acquire leaves the usage unchanged
+    CHECK(!quota.acquire(1));
+    UNSIGNED_LONGS_EQUAL(100, quota.used());
+
+    quota.release(40);
+    UNSIGNED_LONGS_EQUAL(60, quota.used());
+
+    CHECK(quota.acquire(40));
+
+    quota.release(100);
+    UNSIGNED_LONGS_EQUAL(0, quota.used());
+}
+
+TEST(mem_quota, unlimited) {
+    MemQuota quota(0);
+
+    UNSIGNED_LONGS_EQUAL(0, quota.max_bytes());
+
+    // zero cap disables enforcement, but the usage is still counted
+    CHECK(quota.acquire(1000000));
+    UNSIGNED_LONGS_EQUAL(1000000, quota.used());
+
+    quota.release(1000000);
+    UNSIGNED_LONGS_EQUAL(0, quota.used());
+}
+
+} // namespace core
+} // namespace roc
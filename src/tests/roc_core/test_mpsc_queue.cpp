@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/mpsc_queue.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct Object : MpscQueueNode {
+    size_t producer;
+    size_t seqnum;
+
+    Object()
+        : producer(0)
+        , seqnum(0) {
+    }
+};
+
+class ProducerThread : public Thread {
+public:
+    ProducerThread(MpscQueue<Object, NoOwnership>& queue,
+                   Object* objects,
+                   size_t n_objects,
+                   size_t producer)
+        : queue_(queue)
+        , objects_(objects)
+        , n_objects_(n_objects)
+        , producer_(producer) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < n_objects_; n++) {
+            objects_[n].producer = producer_;
+            objects_[n].seqnum = n;
+            queue_.push_back(objects_[n]);
+        }
+    }
+
+    MpscQueue<Object, NoOwnership>& queue_;
+    Object* objects_;
+    size_t n_objects_;
+    size_t producer_;
+};
+
+} // namespace
+
+TEST_GROUP(mpsc_queue) {};
+
+TEST(mpsc_queue, empty) {
+    MpscQueue<Object, NoOwnership> queue;
+
+    CHECK(!queue.pop_front());
+}
+
+TEST(mpsc_queue, push_pop) {
+    MpscQueue<Object, NoOwnership> queue;
+
+    Object obj1;
+    Object obj2;
+
+    queue.push_back(obj1);
+    queue.push_back(obj2);
+
+    POINTERS_EQUAL(&obj1, queue.pop_front());
+    POINTERS_EQUAL(&obj2, queue.pop_front());
+    CHECK(!queue.pop_front());
+}
+
+TEST(mpsc_queue, detach) {
+    MpscQueue<Object, NoOwnership> queue;
+
+    Object obj1;
+    Object obj2;
+
+    queue.push_back(obj1);
+    queue.push_back(obj2);
+
+    POINTERS_EQUAL(&obj1, queue.detach_front());
+    POINTERS_EQUAL(&obj2, queue.detach_front());
+    CHECK(!queue.detach_front());
+
+    // detached elements may be inserted again
+    queue.push_back(obj1);
+    POINTERS_EQUAL(&obj1, queue.pop_front());
+}
+
+TEST(mpsc_queue, push_pop_interleaved) {
+    MpscQueue<Object, NoOwnership> queue;
+
+    Object objects[5];
+
+    queue.push_back(objects[0]);
+    queue.push_back(objects[1]);
+    POINTERS_EQUAL(&objects[0], queue.pop_front());
+
+    queue.push_back(objects[2]);
+    POINTERS_EQUAL(&objects[1], queue.pop_front());
+    POINTERS_EQUAL(&objects[2], queue.pop_front());
+    CHECK(!queue.pop_front());
+
+    queue.push_back(objects[3]);
+    queue.push_back(objects[4]);
+    POINTERS_EQUAL(&objects[3], queue.pop_front());
+    POINTERS_EQUAL(&objects[4], queue.pop_front());
+    CHECK(!queue.pop_front());
+}
+
+TEST(mpsc_queue, concurrent_producers) {
+    enum { NumProducers = 4, NumObjects = 10000 };
+
+    MpscQueue<Object, NoOwnership> queue;
+
+    static Object objects[NumProducers][NumObjects];
+
+    ProducerThread* producers[NumProducers] = {};
+
+    for (size_t n = 0; n < NumProducers; n++) {
+        producers[n] = new ProducerThread(queue, objects[n], NumObjects, n);
+        CHECK(producers[n]->start());
+    }
+
+    size_t last_seqnum[NumProducers];
+    for (size_t n = 0; n < NumProducers; n++) {
+        last_seqnum[n] = (size_t)-1;
+    }
+
+    size_t n_popped = 0;
+    while (n_popped != NumProducers * NumObjects) {
+        Object* obj = queue.pop_front();
+        if (!obj) {
+            continue;
+        }
+
+        // per-producer FIFO order is preserved
+        LONGS_EQUAL((long)(last_seqnum[obj->producer] + 1), (long)obj->seqnum);
+        last_seqnum[obj->producer] = obj->seqnum;
+
+        n_popped++;
+    }
+
+    CHECK(!queue.pop_front());
+
+    for (size_t n = 0; n < NumProducers; n++) {
+        producers[n]->join();
+        delete producers[n];
+    }
+}
+
+} // namespace core
+} // namespace roc
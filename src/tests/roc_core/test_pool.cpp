@@ -9,8 +9,10 @@
 #include <CppUTest/TestHarness.h>
 
 #include "roc_core/heap_allocator.h"
+#include "roc_core/mem_quota.h"
 #include "roc_core/noncopyable.h"
 #include "roc_core/pool.h"
+#include "roc_core/thread.h"
 
 namespace roc {
 namespace core {
@@ -33,6 +35,57 @@ struct Object : NonCopyable<> {
 
 long Object::n_objects = 0;
 
+class AllocThread : public Thread {
+public:
+    AllocThread(Pool<Object>& pool)
+        : pool_(pool) {
+    }
+
+private:
+    enum { NumSlots = 16, NumIterations = 10000 };
+
+    virtual void run() {
+        void* slots[NumSlots] = {};
+
+        for (size_t i = 0; i < NumIterations; i++) {
+            const size_t s = i % NumSlots;
+            if (slots[s]) {
+                pool_.deallocate(slots[s]);
+            }
+            slots[s] = pool_.allocate();
+            CHECK(slots[s]);
+        }
+
+        for (size_t s = 0; s < NumSlots; s++) {
+            if (slots[s]) {
+                pool_.deallocate(slots[s]);
+            }
+        }
+    }
+
+    Pool<Object>& pool_;
+};
+
+class DeallocThread : public Thread {
+public:
+    DeallocThread(Pool<Object>& pool, void** slots, size_t n_slots)
+        : pool_(pool)
+        , slots_(slots)
+        , n_slots_(n_slots) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t s = 0; s < n_slots_; s++) {
+            pool_.deallocate(slots_[s]);
+        }
+    }
+
+    Pool<Object>& pool_;
+    void** slots_;
+    size_t n_slots_;
+};
+
 } // namespace
 
 TEST_GROUP(pool) {
@@ -77,12 +130,13 @@ TEST(pool, new_destroy_many) {
 
         size_t n_objs = 0;
 
+        // one extra allocation is the calling thread's magazine
         for (; n_objs < 1; n_objs++) {
             objects[n_objs] = new (pool) Object;
             CHECK(objects[n_objs]);
         }
 
-        LONGS_EQUAL(1, allocator.num_allocations());
+        LONGS_EQUAL(1 + 1, allocator.num_allocations());
         LONGS_EQUAL(1, Object::n_objects);
 
         for (; n_objs < 1 + 2; n_objs++) {
@@ -90,7 +144,7 @@ TEST(pool, new_destroy_many) {
             CHECK(objects[n_objs]);
         }
 
-        LONGS_EQUAL(2, allocator.num_allocations());
+        LONGS_EQUAL(2 + 1, allocator.num_allocations());
         LONGS_EQUAL(1 + 2, Object::n_objects);
 
         for (; n_objs < 1 + 2 + 4; n_objs++) {
@@ -98,19 +152,178 @@ TEST(pool, new_destroy_many) {
             CHECK(objects[n_objs]);
         }
 
-        LONGS_EQUAL(3, allocator.num_allocations());
+        LONGS_EQUAL(3 + 1, allocator.num_allocations());
         LONGS_EQUAL(1 + 2 + 4, Object::n_objects);
 
         for (size_t n = 0; n < n_objs; n++) {
             pool.destroy(*objects[n]);
         }
 
-        LONGS_EQUAL(3, allocator.num_allocations());
+        LONGS_EQUAL(3 + 1, allocator.num_allocations());
         LONGS_EQUAL(0, Object::n_objects);
     }
 
     LONGS_EQUAL(0, allocator.num_allocations());
 }
 
+TEST(pool, aligned_allocate) {
+    enum { Alignment = 64, NumObjects = 16 };
+
+    Pool<Object> pool(allocator, sizeof(Object), true, Alignment);
+
+    void* slots[NumObjects] = {};
+
+    for (size_t s = 0; s < NumObjects; s++) {
+        slots[s] = pool.allocate();
+        CHECK(slots[s]);
+        UNSIGNED_LONGS_EQUAL(0, (uintptr_t)slots[s] % Alignment);
+    }
+
+    for (size_t s = 0; s < NumObjects; s++) {
+        pool.deallocate(slots[s]);
+    }
+}
+
+TEST(pool, deallocate_on_other_thread) {
+    enum { NumObjects = 100 };
+
+    Pool<Object> pool(allocator, sizeof(Object), true);
+
+    void* slots[NumObjects] = {};
+
+    for (size_t s = 0; s < NumObjects; s++) {
+        slots[s] = pool.allocate();
+        CHECK(slots[s]);
+    }
+
+    const long n_allocations = allocator.num_allocations();
+
+    // when the thread exits, its magazine is flushed back to the pool
+    DeallocThread thread(pool, slots, NumObjects);
+    CHECK(thread.start());
+    thread.join();
+
+    // all elements are back in the pool, so it shouldn't grow
+    for (size_t s = 0; s < NumObjects; s++) {
+        slots[s] = pool.allocate();
+        CHECK(slots[s]);
+    }
+
+    LONGS_EQUAL(n_allocations, allocator.num_allocations());
+
+    for (size_t s = 0; s < NumObjects; s++) {
+        pool.deallocate(slots[s]);
+    }
+}
+
+TEST(pool, deallocate_batch) {
+    enum { NumObjects = 10 };
+
+    Pool<Object> pool(allocator, sizeof(Object), true);
+
+    void* memory[NumObjects] = {};
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        memory[n] = pool.allocate();
+        CHECK(memory[n]);
+    }
+
+    pool.deallocate_batch(memory, NumObjects);
+
+    // the batch went back to the free list and is reused; the batch
+    // bypasses the thread magazine, so no allocator growth is needed
+    const long n_allocations = allocator.num_allocations();
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        void* reused = pool.allocate();
+        CHECK(reused);
+        memory[n] = reused;
+    }
+
+    LONGS_EQUAL(n_allocations, allocator.num_allocations());
+
+    pool.deallocate_batch(memory, NumObjects);
+}
+
+TEST(pool, reserve) {
+    enum { NumObjects = 1 + 2 + 4 };
+
+    Pool<Object> pool(allocator, sizeof(Object), true);
+
+    CHECK(pool.reserve(NumObjects));
+
+    // at least three chunks were pre-allocated
+    const long n_allocations = allocator.num_allocations();
+    CHECK(n_allocations >= 3);
+
+    Object* objects[NumObjects] = {};
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        objects[n] = new (pool) Object;
+        CHECK(objects[n]);
+    }
+
+    // reserved chunks serve all allocations without hitting the allocator;
+    // one extra allocation is the calling thread's magazine
+    LONGS_EQUAL(n_allocations + 1, allocator.num_allocations());
+
+    for (size_t n = 0; n < NumObjects; n++) {
+        pool.destroy(*objects[n]);
+    }
+}
+
+TEST(pool, quota) {
+    enum { MaxObjects = 256 };
+
+    MemQuota quota(16 * 1024);
+
+    Pool<Object> pool(allocator, sizeof(Object), true);
+    pool.set_quota(quota);
+
+    void* slots[MaxObjects] = {};
+    size_t n_objs = 0;
+
+    // the pool grows until the quota is exhausted, then allocate()
+    // starts returning NULL
+    for (; n_objs < MaxObjects; n_objs++) {
+        slots[n_objs] = pool.allocate();
+        if (!slots[n_objs]) {
+            break;
+        }
+    }
+
+    CHECK(n_objs > 0);
+    CHECK(n_objs < MaxObjects);
+    CHECK(quota.used() <= quota.max_bytes());
+
+    // freed elements are reused without touching the quota again
+    pool.deallocate(slots[--n_objs]);
+    slots[n_objs] = pool.allocate();
+    CHECK(slots[n_objs]);
+    n_objs++;
+
+    while (n_objs > 0) {
+        pool.deallocate(slots[--n_objs]);
+    }
+}
+
+TEST(pool, concurrent_allocate_deallocate) {
+    enum { NumThreads = 4 };
+
+    Pool<Object> pool(allocator, sizeof(Object), true);
+
+    AllocThread* threads[NumThreads] = {};
+
+    for (size_t n = 0; n < NumThreads; n++) {
+        threads[n] = new AllocThread(pool);
+        CHECK(threads[n]->start());
+    }
+
+    for (size_t n = 0; n < NumThreads; n++) {
+        threads[n]->join();
+        delete threads[n];
+    }
+}
+
 } // namespace core
 } // namespace roc
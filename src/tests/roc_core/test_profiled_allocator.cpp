@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdlib.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/profiled_allocator.h"
+
+namespace roc {
+namespace core {
+
+TEST_GROUP(profiled_allocator) {
+    HeapAllocator heap_allocator;
+
+    void setup() {
+        setenv("ROC_MEMORY_PROFILING", "1", 1);
+    }
+
+    void teardown() {
+        unsetenv("ROC_MEMORY_PROFILING");
+    }
+};
+
+TEST(profiled_allocator, counters) {
+    ProfiledAllocator allocator(heap_allocator, "test_counters");
+
+    CHECK(allocator.profiling());
+
+    void* p1 = allocator.allocate(100);
+    CHECK(p1);
+
+    UNSIGNED_LONGS_EQUAL(100, allocator.live_bytes());
+    UNSIGNED_LONGS_EQUAL(100, allocator.peak_bytes());
+    UNSIGNED_LONGS_EQUAL(1, allocator.num_allocations());
+
+    void* p2 = allocator.allocate(50);
+    CHECK(p2);
+
+    UNSIGNED_LONGS_EQUAL(150, allocator.live_bytes());
+    UNSIGNED_LONGS_EQUAL(150, allocator.peak_bytes());
+    UNSIGNED_LONGS_EQUAL(2, allocator.num_allocations());
+
+    allocator.deallocate(p1);
+
+    // peak stays at the high-water mark after frees
+    UNSIGNED_LONGS_EQUAL(50, allocator.live_bytes());
+    UNSIGNED_LONGS_EQUAL(150, allocator.peak_bytes());
+
+    allocator.deallocate(p2);
+
+    UNSIGNED_LONGS_EQUAL(0, allocator.live_bytes());
+    UNSIGNED_LONGS_EQUAL(150, allocator.peak_bytes());
+    UNSIGNED_LONGS_EQUAL(2, allocator.num_allocations());
+}
+
+TEST(profiled_allocator, disabled) {
+    unsetenv("ROC_MEMORY_PROFILING");
+
+    ProfiledAllocator allocator(heap_allocator, "test_disabled");
+
+    CHECK(!allocator.profiling());
+
+    void* ptr = allocator.allocate(100);
+    CHECK(ptr);
+
+    // counters are not maintained in passthrough mode
+    UNSIGNED_LONGS_EQUAL(0, allocator.live_bytes());
+    UNSIGNED_LONGS_EQUAL(0, allocator.num_allocations());
+
+    allocator.deallocate(ptr);
+}
+
+TEST(profiled_allocator, backend_pairing) {
+    const size_t n_before = heap_allocator.num_allocations();
+
+    ProfiledAllocator allocator(heap_allocator, "test_pairing");
+
+    void* ptr = allocator.allocate(100);
+    CHECK(ptr);
+
+    UNSIGNED_LONGS_EQUAL(n_before + 1, heap_allocator.num_allocations());
+
+    allocator.deallocate(ptr);
+
+    UNSIGNED_LONGS_EQUAL(n_before, heap_allocator.num_allocations());
+}
+
+} // namespace core
+} // namespace roc
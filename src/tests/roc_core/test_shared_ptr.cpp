@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/refcnt.h"
+#include "roc_core/shared_ptr.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct Object : RefCnt<Object> {
+    void destroy() {
+    }
+};
+
+} // namespace
+
+TEST_GROUP(shared_ptr) {};
+
+TEST(shared_ptr, empty) {
+    SharedPtr<Object> ptr;
+
+    CHECK(!ptr);
+    POINTERS_EQUAL(NULL, ptr.get());
+}
+
+TEST(shared_ptr, acquire_release) {
+    Object obj;
+
+    {
+        SharedPtr<Object> ptr(&obj);
+
+        LONGS_EQUAL(1, obj.getref());
+    }
+
+    LONGS_EQUAL(0, obj.getref());
+}
+
+TEST(shared_ptr, copy) {
+    Object obj;
+
+    SharedPtr<Object> ptr1(&obj);
+
+    {
+        SharedPtr<Object> ptr2 = ptr1;
+
+        LONGS_EQUAL(2, obj.getref());
+    }
+
+    LONGS_EQUAL(1, obj.getref());
+}
+
+TEST(shared_ptr, transfer) {
+    Object obj;
+
+    SharedPtr<Object> ptr(&obj);
+
+    LONGS_EQUAL(1, obj.getref());
+
+    POINTERS_EQUAL(&obj, ptr.transfer());
+
+    CHECK(!ptr);
+    LONGS_EQUAL(1, obj.getref());
+
+    obj.decref();
+}
+
+TEST(shared_ptr, adopt) {
+    Object obj;
+
+    obj.incref();
+
+    {
+        SharedPtr<Object> ptr;
+        ptr.adopt(&obj);
+
+        POINTERS_EQUAL(&obj, ptr.get());
+        LONGS_EQUAL(1, obj.getref());
+    }
+
+    LONGS_EQUAL(0, obj.getref());
+}
+
+TEST(shared_ptr, adopt_releases_previous) {
+    Object obj1;
+    Object obj2;
+
+    obj2.incref();
+
+    SharedPtr<Object> ptr(&obj1);
+
+    LONGS_EQUAL(1, obj1.getref());
+
+    ptr.adopt(&obj2);
+
+    LONGS_EQUAL(0, obj1.getref());
+    LONGS_EQUAL(1, obj2.getref());
+}
+
+TEST(shared_ptr, transfer_adopt_roundtrip) {
+    Object obj;
+
+    SharedPtr<Object> ptr1(&obj);
+    SharedPtr<Object> ptr2;
+
+    ptr2.adopt(ptr1.transfer());
+
+    CHECK(!ptr1);
+    POINTERS_EQUAL(&obj, ptr2.get());
+    LONGS_EQUAL(1, obj.getref());
+}
+
+TEST(shared_ptr, adopt_null) {
+    Object obj;
+
+    SharedPtr<Object> ptr(&obj);
+
+    ptr.adopt(NULL);
+
+    CHECK(!ptr);
+    LONGS_EQUAL(0, obj.getref());
+}
+
+} // namespace core
+} // namespace roc
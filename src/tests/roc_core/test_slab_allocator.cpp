@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/alignment.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/mem_quota.h"
+#include "roc_core/slab_allocator.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { ChunkSize = 1024 };
+
+} // namespace
+
+TEST_GROUP(slab_allocator) {
+    HeapAllocator heap;
+};
+
+TEST(slab_allocator, allocate_aligned) {
+    SlabAllocator slab(heap, ChunkSize);
+
+    void* ptr1 = slab.allocate(1);
+    CHECK(ptr1);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr1 % sizeof(MaxAlign));
+
+    void* ptr2 = slab.allocate(3);
+    CHECK(ptr2);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr2 % sizeof(MaxAlign));
+
+    CHECK(ptr1 != ptr2);
+
+    slab.deallocate(ptr1);
+    slab.deallocate(ptr2);
+}
+
+TEST(slab_allocator, reuse_same_class) {
+    SlabAllocator slab(heap, ChunkSize);
+
+    void* ptr1 = slab.allocate(10);
+    CHECK(ptr1);
+
+    slab.deallocate(ptr1);
+
+    // a freed block goes back to its class free list and is reused,
+    // without hitting the backing allocator again
+    void* ptr2 = slab.allocate(10);
+    CHECK(ptr1 == ptr2);
+
+    slab.deallocate(ptr2);
+
+    UNSIGNED_LONGS_EQUAL(1, slab.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+}
+
+TEST(slab_allocator, different_classes) {
+    SlabAllocator slab(heap, ChunkSize);
+
+    void* small_ptr = slab.allocate(10);
+    CHECK(small_ptr);
+
+    void* large_ptr = slab.allocate(500);
+    CHECK(large_ptr);
+
+    UNSIGNED_LONGS_EQUAL(2, slab.num_chunks());
+
+    slab.deallocate(small_ptr);
+    slab.deallocate(large_ptr);
+}
+
+TEST(slab_allocator, refill_in_chunks) {
+    SlabAllocator slab(heap, ChunkSize);
+
+    enum { BlockSize = 32, NumBlocks = ChunkSize / BlockSize };
+
+    void* ptrs[NumBlocks];
+
+    // the whole chunk is carved into blocks upfront, so all allocations
+    // within it cost a single backing allocation
+    for (size_t n = 0; n < NumBlocks; n++) {
+        ptrs[n] = slab.allocate(1);
+        CHECK(ptrs[n]);
+    }
+
+    UNSIGNED_LONGS_EQUAL(1, slab.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+
+    for (size_t n = 0; n < NumBlocks; n++) {
+        slab.deallocate(ptrs[n]);
+    }
+}
+
+TEST(slab_allocator, allocate_oversized) {
+    SlabAllocator slab(heap, ChunkSize);
+
+    void* ptr = slab.allocate(1024 * 1024);
+    CHECK(ptr);
+    UNSIGNED_LONGS_EQUAL(0, (unsigned long)ptr % sizeof(MaxAlign));
+
+    UNSIGNED_LONGS_EQUAL(0, slab.num_chunks());
+    LONGS_EQUAL(1, heap.num_allocations());
+
+    slab.deallocate(ptr);
+
+    LONGS_EQUAL(0, heap.num_allocations());
+}
+
+TEST(slab_allocator, quota) {
+    MemQuota quota(4 * 1024);
+
+    SlabAllocator slab(heap, ChunkSize);
+    slab.set_quota(quota);
+
+    // chunk refills are charged against the quota
+    void* ptr = slab.allocate(10);
+    CHECK(ptr);
+    CHECK(quota.used() > 0);
+    CHECK(quota.used() <= quota.max_bytes());
+
+    // an oversize allocation that doesn't fit into the remaining
+    // quota fails instead of growing past the cap
+    CHECK(!slab.allocate(1024 * 1024));
+
+    slab.deallocate(ptr);
+}
+
+TEST(slab_allocator, quota_oversized) {
+    MemQuota quota(8 * 1024);
+
+    SlabAllocator slab(heap, ChunkSize);
+    slab.set_quota(quota);
+
+    // oversize allocations bypass the chunks but not the quota
+    void* ptr = slab.allocate(5 * 1024);
+    CHECK(ptr);
+    CHECK(quota.used() >= 5 * 1024);
+
+    slab.deallocate(ptr);
+    UNSIGNED_LONGS_EQUAL(0, quota.used());
+}
+
+TEST(slab_allocator, destructor_releases_chunks) {
+    {
+        SlabAllocator slab(heap, ChunkSize);
+
+        void* ptr = slab.allocate(10);
+        CHECK(ptr);
+        slab.deallocate(ptr);
+
+        LONGS_EQUAL(1, heap.num_allocations());
+    }
+
+    LONGS_EQUAL(0, heap.num_allocations());
+}
+
+} // namespace core
+} // namespace roc
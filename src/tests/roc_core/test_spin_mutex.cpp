@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/spin_mutex.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumThreads = 4, NumIterations = 10000 };
+
+class Incrementer : public Thread {
+public:
+    Incrementer(SpinMutex& mutex, long& counter)
+        : mutex_(mutex)
+        , counter_(counter) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < NumIterations; n++) {
+            SpinMutex::Lock lock(mutex_);
+            counter_++;
+        }
+    }
+
+    SpinMutex& mutex_;
+    long& counter_;
+};
+
+} // namespace
+
+TEST_GROUP(spin_mutex) {};
+
+TEST(spin_mutex, lock_unlock) {
+    SpinMutex mutex;
+
+    mutex.lock();
+    mutex.unlock();
+
+    SpinMutex::Lock lock(mutex);
+}
+
+TEST(spin_mutex, contention) {
+    SpinMutex mutex;
+    long counter = 0;
+
+    Incrementer* threads[NumThreads];
+
+    for (size_t n = 0; n < NumThreads; n++) {
+        threads[n] = new Incrementer(mutex, counter);
+        CHECK(threads[n]->start());
+    }
+
+    for (size_t n = 0; n < NumThreads; n++) {
+        threads[n]->join();
+        delete threads[n];
+    }
+
+    LONGS_EQUAL(NumThreads * NumIterations, counter);
+}
+
+} // namespace core
+} // namespace roc
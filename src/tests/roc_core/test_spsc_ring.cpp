@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/spsc_ring.h"
+#include "roc_core/thread.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumObjects = 100000, RingCapacity = 16 };
+
+HeapAllocator allocator;
+
+class ProducerThread : public Thread {
+public:
+    ProducerThread(SpscRing<size_t>& ring)
+        : ring_(ring) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < NumObjects; n++) {
+            ring_.push_blocking(n);
+        }
+    }
+
+    SpscRing<size_t>& ring_;
+};
+
+} // namespace
+
+TEST_GROUP(spsc_ring) {};
+
+TEST(spsc_ring, empty) {
+    SpscRing<size_t> ring(allocator, RingCapacity);
+    CHECK(ring.valid());
+
+    UNSIGNED_LONGS_EQUAL(RingCapacity, ring.capacity());
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+
+    size_t value = 0;
+    CHECK(!ring.pop(value));
+}
+
+TEST(spsc_ring, push_pop) {
+    SpscRing<size_t> ring(allocator, RingCapacity);
+    CHECK(ring.valid());
+
+    CHECK(ring.push(11));
+    CHECK(ring.push(22));
+
+    UNSIGNED_LONGS_EQUAL(2, ring.size());
+
+    size_t value = 0;
+    CHECK(ring.pop(value));
+    UNSIGNED_LONGS_EQUAL(11, value);
+
+    CHECK(ring.pop(value));
+    UNSIGNED_LONGS_EQUAL(22, value);
+
+    CHECK(!ring.pop(value));
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+}
+
+TEST(spsc_ring, full) {
+    SpscRing<size_t> ring(allocator, RingCapacity);
+    CHECK(ring.valid());
+
+    for (size_t n = 0; n < RingCapacity; n++) {
+        CHECK(ring.push(n));
+    }
+
+    CHECK(!ring.push(0));
+    UNSIGNED_LONGS_EQUAL(RingCapacity, ring.size());
+
+    size_t value = 0;
+    CHECK(ring.pop(value));
+    UNSIGNED_LONGS_EQUAL(0, value);
+
+    CHECK(ring.push(0));
+    CHECK(!ring.push(0));
+}
+
+TEST(spsc_ring, wraparound) {
+    SpscRing<size_t> ring(allocator, RingCapacity);
+    CHECK(ring.valid());
+
+    for (size_t n = 0; n < RingCapacity * 10; n++) {
+        CHECK(ring.push(n));
+
+        size_t value = 0;
+        CHECK(ring.pop(value));
+        UNSIGNED_LONGS_EQUAL(n, value);
+    }
+
+    UNSIGNED_LONGS_EQUAL(0, ring.size());
+}
+
+TEST(spsc_ring, concurrent) {
+    SpscRing<size_t> ring(allocator, RingCapacity);
+    CHECK(ring.valid());
+
+    ProducerThread producer(ring);
+    CHECK(producer.start());
+
+    // FIFO order is preserved across threads
+    for (size_t n = 0; n < NumObjects; n++) {
+        size_t value = 0;
+        ring.pop_blocking(value);
+        UNSIGNED_LONGS_EQUAL(n, value);
+    }
+
+    producer.join();
+
+    size_t value = 0;
+    CHECK(!ring.pop(value));
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/heap_allocator.h"
+#include "roc_core/thread_pool.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+struct CounterTask : ThreadPool::Task {
+    long* counter;
+
+    CounterTask()
+        : counter(NULL) {
+    }
+
+    virtual void run() {
+        __sync_add_and_fetch(counter, 1);
+    }
+};
+
+} // namespace
+
+TEST_GROUP(thread_pool) {
+    HeapAllocator allocator;
+};
+
+TEST(thread_pool, num_threads) {
+    ThreadPool pool(allocator, 3);
+    CHECK(pool.valid());
+
+    UNSIGNED_LONGS_EQUAL(3, pool.num_threads());
+}
+
+TEST(thread_pool, schedule_wait) {
+    ThreadPool pool(allocator, 2);
+    CHECK(pool.valid());
+
+    long counter = 0;
+
+    CounterTask task;
+    task.counter = &counter;
+
+    pool.schedule(task);
+    pool.wait(task);
+
+    LONGS_EQUAL(1, counter);
+}
+
+TEST(thread_pool, schedule_batch) {
+    enum { NumTasks = 20, NumRounds = 100 };
+
+    ThreadPool pool(allocator, 4);
+    CHECK(pool.valid());
+
+    long counter = 0;
+
+    CounterTask tasks[NumTasks];
+
+    for (size_t r = 0; r < NumRounds; r++) {
+        for (size_t n = 0; n < NumTasks; n++) {
+            tasks[n].counter = &counter;
+            pool.schedule(tasks[n]);
+        }
+
+        for (size_t n = 0; n < NumTasks; n++) {
+            pool.wait(tasks[n]);
+        }
+    }
+
+    LONGS_EQUAL(NumTasks * NumRounds, counter);
+}
+
+TEST(thread_pool, wait_completed) {
+    ThreadPool pool(allocator, 2);
+    CHECK(pool.valid());
+
+    long counter = 0;
+
+    CounterTask task;
+    task.counter = &counter;
+
+    pool.schedule(task);
+    pool.wait(task);
+    pool.wait(task);
+
+    LONGS_EQUAL(1, counter);
+}
+
+} // namespace core
+} // namespace roc
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/timer_wheel.h"
+
+namespace roc {
+namespace core {
+
+namespace {
+
+enum { NumTimers = 16 };
+
+} // namespace
+
+TEST_GROUP(timer_wheel) {
+    TimerWheel wheel;
+
+    TimerWheel::Timer timers[NumTimers];
+};
+
+TEST(timer_wheel, empty) {
+    LONGS_EQUAL(0, wheel.time());
+
+    CHECK(wheel.next_expired() == NULL);
+
+    wheel.advance(12345);
+
+    LONGS_EQUAL(12345, wheel.time());
+
+    CHECK(wheel.next_expired() == NULL);
+}
+
+TEST(timer_wheel, schedule_expire) {
+    wheel.schedule(timers[0], 100);
+
+    CHECK(timers[0].scheduled());
+    LONGS_EQUAL(100, timers[0].deadline());
+
+    wheel.advance(99);
+    CHECK(wheel.next_expired() == NULL);
+    CHECK(timers[0].scheduled());
+
+    wheel.advance(100);
+    POINTERS_EQUAL(&timers[0], wheel.next_expired());
+    CHECK(wheel.next_expired() == NULL);
+
+    CHECK(!timers[0].scheduled());
+}
+
+TEST(timer_wheel, expire_order) {
+    for (size_t i = 0; i < NumTimers; i++) {
+        wheel.schedule(timers[i], (NumTimers - i) * 10);
+    }
+
+    for (size_t i = 0; i < NumTimers; i++) {
+        wheel.advance((i + 1) * 10);
+
+        POINTERS_EQUAL(&timers[NumTimers - 1 - i], wheel.next_expired());
+        CHECK(wheel.next_expired() == NULL);
+    }
+}
+
+TEST(timer_wheel, past_deadline) {
+    wheel.advance(100);
+
+    wheel.schedule(timers[0], 50);
+
+    POINTERS_EQUAL(&timers[0], wheel.next_expired());
+    CHECK(wheel.next_expired() == NULL);
+}
+
+TEST(timer_wheel, cancel) {
+    wheel.schedule(timers[0], 100);
+    wheel.schedule(timers[1], 100);
+
+    wheel.cancel(timers[0]);
+    CHECK(!timers[0].scheduled());
+
+    // cancelling an unscheduled timer is a no-op
+    wheel.cancel(timers[0]);
+
+    wheel.advance(200);
+
+    POINTERS_EQUAL(&timers[1], wheel.next_expired());
+    CHECK(wheel.next_expired() == NULL);
+}
+
+TEST(timer_wheel, reschedule) {
+    wheel.schedule(timers[0], 100);
+    wheel.schedule(timers[0], 300);
+
+    LONGS_EQUAL(300, timers[0].deadline());
+
+    wheel.advance(200);
+    CHECK(wheel.next_expired() == NULL);
+
+    wheel.advance(300);
+    POINTERS_EQUAL(&timers[0], wheel.next_expired());
+    CHECK(wheel.next_expired() == NULL);
+}
+
+TEST(timer_wheel, far_deadlines) {
+    // deadlines beyond the lowest level, exercising the cascades, and beyond
+    // the whole wheel horizon, exercising the parking and re-insertion
+    const uint64_t deadlines[NumTimers] = {
+        1,        63,       64,        65,        4095,     4096,
+        4097,     100000,   262143,    262144,    262145,   10000000,
+        16777215, 16777216, 100000000, 0x123456789ULL,
+    };
+
+    for (size_t i = 0; i < NumTimers; i++) {
+        wheel.schedule(timers[i], deadlines[i]);
+    }
+
+    uint64_t now = 0;
+
+    for (size_t i = 0; i < NumTimers; i++) {
+        // uneven strides, so that the advances don't align with the slots
+        while (now < deadlines[i]) {
+            CHECK(wheel.next_expired() == NULL);
+            now += (now % 777) + 1;
+            if (now > deadlines[i]) {
+                now = deadlines[i];
+            }
+            wheel.advance(now);
+        }
+
+        POINTERS_EQUAL(&timers[i], wheel.next_expired());
+        CHECK(wheel.next_expired() == NULL);
+    }
+}
+
+TEST(timer_wheel, data) {
+    int payload = 0;
+
+    CHECK(timers[0].data() == NULL);
+
+    timers[0].set_data(&payload);
+    POINTERS_EQUAL(&payload, timers[0].data());
+
+    wheel.schedule(timers[0], 10);
+    wheel.advance(10);
+
+    TimerWheel::Timer* expired = wheel.next_expired();
+    POINTERS_EQUAL(&timers[0], expired);
+    POINTERS_EQUAL(&payload, expired->data());
+}
+
+TEST(timer_wheel, start_time) {
+    TimerWheel late_wheel(1000);
+
+    LONGS_EQUAL(1000, late_wheel.time());
+
+    TimerWheel::Timer timer;
+    late_wheel.schedule(timer, 1500);
+
+    late_wheel.advance(1499);
+    CHECK(late_wheel.next_expired() == NULL);
+
+    late_wheel.advance(1500);
+    POINTERS_EQUAL(&timer, late_wheel.next_expired());
+}
+
+} // namespace core
+} // namespace roc
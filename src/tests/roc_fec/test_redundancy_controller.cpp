@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_fec/redundancy_controller.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+enum { SourcePackets = 20, RepairPackets = 10 };
+
+RedundancyControllerConfig make_config() {
+    RedundancyControllerConfig config;
+    config.min_repair_packets = 1;
+    config.max_repair_packets = 20;
+    config.window_blocks = 10;
+    config.safety_factor = 2;
+    return config;
+}
+
+// cumulative metrics after n_blocks blocks with the given loss ratio
+LossMetrics make_metrics(size_t n_blocks, size_t n_lost_per_block) {
+    LossMetrics metrics;
+    metrics.n_blocks = n_blocks;
+    metrics.n_source_packets = n_blocks * SourcePackets;
+    metrics.n_lost_packets = n_blocks * n_lost_per_block;
+    return metrics;
+}
+
+} // namespace
+
+TEST_GROUP(redundancy_controller) {};
+
+TEST(redundancy_controller, initial_size) {
+    RedundancyController controller(make_config(), SourcePackets, RepairPackets);
+
+    UNSIGNED_LONGS_EQUAL(RepairPackets, controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, initial_size_clamped) {
+    RedundancyController controller(make_config(), SourcePackets, 100);
+
+    UNSIGNED_LONGS_EQUAL(make_config().max_repair_packets,
+                         controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, no_update_before_window) {
+    RedundancyController controller(make_config(), SourcePackets, RepairPackets);
+
+    CHECK(!controller.update(make_metrics(9, 10)));
+    UNSIGNED_LONGS_EQUAL(RepairPackets, controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, no_loss_decays_to_min) {
+    RedundancyController controller(make_config(), SourcePackets, RepairPackets);
+
+    // one packet less per window until the minimum is reached
+    for (size_t n = 1; n <= RepairPackets - 1; n++) {
+        CHECK(controller.update(make_metrics(n * 10, 0)));
+        UNSIGNED_LONGS_EQUAL(RepairPackets - n, controller.n_repair_packets());
+    }
+
+    CHECK(!controller.update(make_metrics(100, 0)));
+    UNSIGNED_LONGS_EQUAL(1, controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, loss_raises_immediately) {
+    RedundancyController controller(make_config(), SourcePackets, 1);
+
+    // 10% loss, safety factor 2: 0.1 * 2 * 20 = 4 repair packets
+    CHECK(controller.update(make_metrics(10, 2)));
+    UNSIGNED_LONGS_EQUAL(4, controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, loss_clamped_to_max) {
+    RedundancyController controller(make_config(), SourcePackets, 1);
+
+    // 75% loss would require more repair packets than the maximum
+    CHECK(controller.update(make_metrics(10, 15)));
+    UNSIGNED_LONGS_EQUAL(make_config().max_repair_packets,
+                         controller.n_repair_packets());
+}
+
+TEST(redundancy_controller, steady_loss_keeps_size) {
+    RedundancyController controller(make_config(), SourcePackets, 1);
+
+    CHECK(controller.update(make_metrics(10, 2)));
+    UNSIGNED_LONGS_EQUAL(4, controller.n_repair_packets());
+
+    // same loss ratio in the next window, no change
+    CHECK(!controller.update(make_metrics(20, 2)));
+    UNSIGNED_LONGS_EQUAL(4, controller.n_repair_packets());
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/random.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_fec/rlc_scheme.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t MaxPayloadSize = 1024;
+
+core::HeapAllocator allocator;
+core::BufferPool<uint8_t> buffer_pool(allocator, MaxPayloadSize, true);
+
+CodecMap codec_map;
+
+core::Slice<uint8_t> make_buffer(size_t p_size) {
+    core::Slice<uint8_t> buf = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    CHECK(buf);
+    buf.resize(p_size);
+    for (size_t n = 0; n < buf.size(); n++) {
+        buf.data()[n] = (uint8_t)core::random(0, 0xff);
+    }
+    return buf;
+}
+
+} // namespace
+
+TEST_GROUP(rlc_codec) {
+    CodecConfig config;
+
+    void setup() {
+        config.scheme = packet::FEC_RLC;
+        config.backend = CodecBackendRlc;
+    }
+};
+
+TEST(rlc_codec, window_geometry) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10 };
+
+    const size_t wlen = rlc_window_len(NumSourcePackets, NumRepairPackets);
+
+    size_t prev_end = 0;
+
+    for (size_t j = 0; j < NumRepairPackets; j++) {
+        const size_t wend = rlc_window_end(j, NumSourcePackets, NumRepairPackets);
+        const size_t wbegin = rlc_window_begin(wend, wlen);
+
+        // windows are non-empty, advance monotonically, and stay in bounds
+        CHECK(wbegin < wend);
+        CHECK(wend <= NumSourcePackets);
+        CHECK(wend >= prev_end);
+
+        prev_end = wend;
+    }
+
+    // the last window ends exactly at the block boundary
+    UNSIGNED_LONGS_EQUAL(
+        NumSourcePackets,
+        rlc_window_end(NumRepairPackets - 1, NumSourcePackets, NumRepairPackets));
+}
+
+TEST(rlc_codec, coeff_gen_deterministic) {
+    RlcCoeffGen gen1(3, 20, 10);
+    RlcCoeffGen gen2(3, 20, 10);
+
+    for (size_t n = 0; n < 100; n++) {
+        const uint8_t c1 = gen1.next();
+        const uint8_t c2 = gen2.next();
+
+        // same (repair, geometry) always yields the same non-zero sequence
+        UNSIGNED_LONGS_EQUAL(c1, c2);
+        CHECK(c1 != 0);
+    }
+}
+
+TEST(rlc_codec, encode_decode_loss) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 251 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    // drop each source packet in turn and check that it's repaired
+    for (size_t lost = 0; lost < NumSourcePackets; lost++) {
+        CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+            if (i != lost) {
+                decoder->set(i, buffers[i]);
+            }
+        }
+
+        core::Slice<uint8_t> decoded = decoder->repair(lost);
+        CHECK(decoded);
+
+        UNSIGNED_LONGS_EQUAL(PayloadSize, decoded.size());
+        CHECK(memcmp(buffers[lost].data(), decoded.data(), PayloadSize) == 0);
+
+        decoder->end();
+    }
+}
+
+TEST(rlc_codec, decode_adjacent_losses) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 100 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // drop two adjacent packets covered by overlapping windows
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        if (i != 4 && i != 5) {
+            decoder->set(i, buffers[i]);
+        }
+    }
+
+    for (size_t lost = 4; lost <= 5; lost++) {
+        core::Slice<uint8_t> decoded = decoder->repair(lost);
+        CHECK(decoded);
+        CHECK(memcmp(buffers[lost].data(), decoded.data(), PayloadSize) == 0);
+    }
+
+    decoder->end();
+}
+
+TEST(rlc_codec, decode_uncovered_losses) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 100 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // the two last packets are covered only by the last window: two
+    // unknowns in a single equation can't be solved
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        if (i != 18 && i != 19) {
+            decoder->set(i, buffers[i]);
+        }
+    }
+
+    CHECK(!decoder->repair(18));
+    CHECK(!decoder->repair(19));
+
+    decoder->end();
+}
+
+TEST(rlc_codec, streaming_repair) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 100 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // feed source packets one by one and fill each repair packet as soon
+    // as its encoding window completes
+    size_t next_repair = 0;
+
+    for (size_t i = 0; i < NumSourcePackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+
+        while (next_repair < NumRepairPackets
+               && encoder->repair_ready(next_repair, i + 1)) {
+            const size_t j = NumSourcePackets + next_repair;
+            buffers[j] = make_buffer(PayloadSize);
+            encoder->set(j, buffers[j]);
+            encoder->fill_repair(next_repair);
+            next_repair++;
+        }
+    }
+
+    // all repair packets are ready once the block is complete
+    UNSIGNED_LONGS_EQUAL(NumRepairPackets, next_repair);
+
+    encoder->end();
+
+    // partial repair: a loss in the first half is recovered from the
+    // first half of the block alone, before the block completes
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets / 2; i++) {
+        if (i != 3) {
+            decoder->set(i, buffers[i]);
+        }
+    }
+    for (size_t j = 0; j < NumRepairPackets / 2; j++) {
+        decoder->set(NumSourcePackets + j, buffers[NumSourcePackets + j]);
+    }
+
+    core::Slice<uint8_t> decoded = decoder->repair(3);
+    CHECK(decoded);
+    CHECK(memcmp(buffers[3].data(), decoded.data(), PayloadSize) == 0);
+
+    decoder->end();
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/random.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t MaxPayloadSize = 1024;
+
+core::HeapAllocator allocator;
+core::BufferPool<uint8_t> buffer_pool(allocator, MaxPayloadSize, true);
+
+CodecMap codec_map;
+
+core::Slice<uint8_t> make_buffer(size_t p_size) {
+    core::Slice<uint8_t> buf = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    CHECK(buf);
+    buf.resize(p_size);
+    for (size_t n = 0; n < buf.size(); n++) {
+        buf.data()[n] = (uint8_t)core::random(0, 0xff);
+    }
+    return buf;
+}
+
+} // namespace
+
+TEST_GROUP(rs8m_codec) {
+    CodecConfig config;
+
+    void setup() {
+        config.scheme = packet::FEC_ReedSolomon_M8;
+        config.backend = CodecBackendRs8m;
+    }
+};
+
+TEST(rs8m_codec, gf256_mul_inv) {
+    for (size_t a = 1; a < 256; a++) {
+        UNSIGNED_LONGS_EQUAL(1, gf256_mul((uint8_t)a, gf256_inv((uint8_t)a)));
+    }
+
+    for (size_t a = 0; a < 256; a++) {
+        UNSIGNED_LONGS_EQUAL(0, gf256_mul((uint8_t)a, 0));
+        UNSIGNED_LONGS_EQUAL(a, gf256_mul((uint8_t)a, 1));
+    }
+}
+
+TEST(rs8m_codec, gf256_madd) {
+    enum { BufSize = 100 };
+
+    uint8_t src[BufSize];
+    uint8_t dst[BufSize];
+    uint8_t exp[BufSize];
+
+    for (size_t c = 0; c < 256; c += 17) {
+        for (size_t n = 0; n < BufSize; n++) {
+            src[n] = (uint8_t)core::random(0, 0xff);
+            dst[n] = (uint8_t)core::random(0, 0xff);
+            exp[n] = (uint8_t)(dst[n] ^ gf256_mul((uint8_t)c, src[n]));
+        }
+
+        gf256_madd(dst, src, (uint8_t)c, BufSize);
+
+        for (size_t n = 0; n < BufSize; n++) {
+            UNSIGNED_LONGS_EQUAL(exp[n], dst[n]);
+        }
+    }
+}
+
+TEST(rs8m_codec, encode_decode_losses) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 10, PayloadSize = 251 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // drop as many packets as there are repair packets
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        if (i % 3 == 1 && i / 3 < NumRepairPackets) {
+            continue;
+        }
+        decoder->set(i, buffers[i]);
+    }
+
+    for (size_t i = 0; i < NumSourcePackets; i++) {
+        core::Slice<uint8_t> decoded = decoder->repair(i);
+        CHECK(decoded);
+
+        UNSIGNED_LONGS_EQUAL(PayloadSize, decoded.size());
+        CHECK(memcmp(buffers[i].data(), decoded.data(), PayloadSize) == 0);
+    }
+
+    decoder->end();
+}
+
+TEST(rs8m_codec, decode_not_enough_packets) {
+    enum { NumSourcePackets = 10, NumRepairPackets = 3, PayloadSize = 100 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // drop one more packet than the code can repair
+    for (size_t i = NumRepairPackets + 1; i < NumSourcePackets + NumRepairPackets; i++) {
+        decoder->set(i, buffers[i]);
+    }
+
+    for (size_t i = 0; i <= NumRepairPackets; i++) {
+        CHECK(!decoder->repair(i));
+    }
+
+    decoder->end();
+}
+
+TEST(rs8m_codec, block_length_limit) {
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+
+    UNSIGNED_LONGS_EQUAL(255, encoder->max_block_length());
+
+    CHECK(!encoder->begin(200, 100, 100));
+    CHECK(encoder->begin(200, 55, 100));
+    encoder->end();
+}
+
+} // namespace fec
+} // namespace roc
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/random.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_fec/gf256.h"
+
+namespace roc {
+namespace fec {
+
+namespace {
+
+const size_t MaxPayloadSize = 1024;
+
+core::HeapAllocator allocator;
+core::BufferPool<uint8_t> buffer_pool(allocator, MaxPayloadSize, true);
+
+CodecMap codec_map;
+
+core::Slice<uint8_t> make_buffer(size_t p_size) {
+    core::Slice<uint8_t> buf = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    CHECK(buf);
+    buf.resize(p_size);
+    for (size_t n = 0; n < buf.size(); n++) {
+        buf.data()[n] = (uint8_t)core::random(0, 0xff);
+    }
+    return buf;
+}
+
+} // namespace
+
+TEST_GROUP(xor_codec) {
+    CodecConfig config;
+
+    void setup() {
+        config.scheme = packet::FEC_XOR;
+        config.backend = CodecBackendXor;
+    }
+};
+
+TEST(xor_codec, gf256_add) {
+    enum { BufSize = 100 };
+
+    uint8_t src[BufSize];
+    uint8_t dst[BufSize];
+    uint8_t exp[BufSize];
+
+    for (size_t n = 0; n < BufSize; n++) {
+        src[n] = (uint8_t)core::random(0, 0xff);
+        dst[n] = (uint8_t)core::random(0, 0xff);
+        exp[n] = (uint8_t)(dst[n] ^ src[n]);
+    }
+
+    gf256_add(dst, src, BufSize);
+
+    for (size_t n = 0; n < BufSize; n++) {
+        UNSIGNED_LONGS_EQUAL(exp[n], dst[n]);
+    }
+}
+
+TEST(xor_codec, encode_decode_loss) {
+    enum { NumSourcePackets = 20, NumRepairPackets = 1, PayloadSize = 251 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    // drop each source packet in turn and check that it's repaired
+    for (size_t lost = 0; lost < NumSourcePackets; lost++) {
+        CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+        for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+            if (i != lost) {
+                decoder->set(i, buffers[i]);
+            }
+        }
+
+        core::Slice<uint8_t> decoded = decoder->repair(lost);
+        CHECK(decoded);
+
+        UNSIGNED_LONGS_EQUAL(PayloadSize, decoded.size());
+        CHECK(memcmp(buffers[lost].data(), decoded.data(), PayloadSize) == 0);
+
+        decoder->end();
+    }
+}
+
+TEST(xor_codec, decode_two_losses) {
+    enum { NumSourcePackets = 10, NumRepairPackets = 1, PayloadSize = 100 };
+
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    core::Slice<uint8_t> buffers[NumSourcePackets + NumRepairPackets];
+
+    CHECK(encoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    for (size_t i = 0; i < NumSourcePackets + NumRepairPackets; i++) {
+        buffers[i] = make_buffer(PayloadSize);
+        encoder->set(i, buffers[i]);
+    }
+    encoder->fill();
+    encoder->end();
+
+    CHECK(decoder->begin(NumSourcePackets, NumRepairPackets, PayloadSize));
+
+    // drop one more packet than the code can repair
+    for (size_t i = 2; i < NumSourcePackets + NumRepairPackets; i++) {
+        decoder->set(i, buffers[i]);
+    }
+
+    CHECK(!decoder->repair(0));
+    CHECK(!decoder->repair(1));
+
+    decoder->end();
+}
+
+TEST(xor_codec, single_repair_packet_limit) {
+    core::UniquePtr<IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    CHECK(encoder);
+    CHECK(decoder);
+
+    CHECK(!encoder->begin(20, 2, 100));
+    CHECK(!decoder->begin(20, 2, 100));
+
+    CHECK(encoder->begin(20, 1, 100));
+    encoder->end();
+
+    CHECK(decoder->begin(20, 1, 100));
+    decoder->end();
+}
+
+} // namespace fec
+} // namespace roc
@@ -26,6 +26,18 @@ TEST(context, open_close) {
     LONGS_EQUAL(0, roc_context_close(context));
 }
 
+TEST(context, open_close_prealloc) {
+    roc_context_config config;
+    memset(&config, 0, sizeof(config));
+    config.prealloc_packets = 100;
+    config.prealloc_frames = 10;
+
+    roc_context* context = roc_context_open(&config);
+    CHECK(context);
+
+    LONGS_EQUAL(0, roc_context_close(context));
+}
+
 TEST(context, close_null) {
     LONGS_EQUAL(-1, roc_context_close(NULL));
 }
@@ -51,12 +51,58 @@ enum {
     Timeout = TotalSamples * 10
 };
 
-enum { FlagFEC = (1 << 0) };
+enum {
+    FlagFEC = (1 << 0),
+    FlagBatch = (1 << 1),
+    FlagInt16 = (1 << 2),
+    FlagPlanar = (1 << 3)
+};
 
 core::HeapAllocator allocator;
 packet::PacketPool packet_pool(allocator, true);
 core::BufferPool<uint8_t> byte_buffer_pool(allocator, MaxBufSize, true);
 
+size_t user_sample_size(unsigned flags) {
+    return (flags & FlagInt16) ? sizeof(int16_t) : sizeof(float);
+}
+
+// convert a native (interleaved float) frame into the layout selected
+// by the flags; the inverse of from_user_frame()
+void to_user_frame(const float* in, void* out, size_t n_samples, unsigned flags) {
+    const size_t plane_sz = n_samples / NumChans;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        size_t index = n;
+        if (flags & FlagPlanar) {
+            index = (n % NumChans) * plane_sz + n / NumChans;
+        }
+        if (flags & FlagInt16) {
+            float s = in[n] * 32768.0f;
+            s = std::min(s, +32767.0f);
+            s = std::max(s, -32768.0f);
+            ((int16_t*)out)[index] = (int16_t)s;
+        } else {
+            ((float*)out)[index] = in[n];
+        }
+    }
+}
+
+void from_user_frame(const void* in, float* out, size_t n_samples, unsigned flags) {
+    const size_t plane_sz = n_samples / NumChans;
+
+    for (size_t n = 0; n < n_samples; n++) {
+        size_t index = n;
+        if (flags & FlagPlanar) {
+            index = (n % NumChans) * plane_sz + n / NumChans;
+        }
+        if (flags & FlagInt16) {
+            out[n] = float(((const int16_t*)in)[index]) / 32768.0f;
+        } else {
+            out[n] = ((const float*)in)[index];
+        }
+    }
+}
+
 class Context : public core::NonCopyable<> {
 public:
     Context() {
@@ -91,7 +137,8 @@ public:
            unsigned flags)
         : samples_(samples)
         , total_samples_(total_samples)
-        , frame_size_(frame_size) {
+        , frame_size_(frame_size)
+        , flags_(flags) {
         roc_address addr;
         CHECK(roc_address_init(&addr, ROC_AF_AUTO, "127.0.0.1", 0) == 0);
         sndr_ = roc_sender_open(context.get(), &config);
@@ -117,26 +164,69 @@ public:
 
 private:
     virtual void run() {
+        if (flags_ & FlagBatch) {
+            run_batch_();
+        } else {
+            run_single_();
+        }
+    }
+
+    void run_single_() {
         for (size_t off = 0; off < total_samples_; off += frame_size_) {
             if (off + frame_size_ > total_samples_) {
                 off = total_samples_ - frame_size_;
             }
 
+            char tx_buff[MaxBufSize * sizeof(float)];
+
             roc_frame frame;
             memset(&frame, 0, sizeof(frame));
 
-            frame.samples = samples_ + off;
-            frame.samples_size = frame_size_ * sizeof(float);
+            if (flags_ & (FlagInt16 | FlagPlanar)) {
+                to_user_frame(samples_ + off, tx_buff, frame_size_, flags_);
+                frame.samples = tx_buff;
+                frame.samples_size = frame_size_ * user_sample_size(flags_);
+            } else {
+                frame.samples = samples_ + off;
+                frame.samples_size = frame_size_ * sizeof(float);
+            }
 
             const int ret = roc_sender_write(sndr_, &frame);
             roc_panic_if_not(ret == 0);
         }
     }
 
+    void run_batch_() {
+        enum { NumFrames = 4 };
+
+        size_t off = 0;
+
+        while (off < total_samples_) {
+            roc_frame frames[NumFrames];
+            memset(frames, 0, sizeof(frames));
+
+            size_t n_frames = 0;
+
+            for (; n_frames < NumFrames && off < total_samples_;
+                 n_frames++, off += frame_size_) {
+                if (off + frame_size_ > total_samples_) {
+                    off = total_samples_ - frame_size_;
+                }
+
+                frames[n_frames].samples = samples_ + off;
+                frames[n_frames].samples_size = frame_size_ * sizeof(float);
+            }
+
+            const int ret = roc_sender_write_batch(sndr_, frames, n_frames);
+            roc_panic_if_not(ret == 0);
+        }
+    }
+
     roc_sender* sndr_;
     float* samples_;
     const size_t total_samples_;
     const size_t frame_size_;
+    const unsigned flags_;
 };
 
 class Receiver {
@@ -149,7 +239,9 @@ public:
              unsigned flags)
         : samples_(samples)
         , total_samples_(total_samples)
-        , frame_size_(frame_size) {
+        , frame_size_(frame_size)
+        , flags_(flags)
+        , epsilon_((flags & FlagInt16) ? 2. / 32768. : 1e-9) {
         CHECK(roc_address_init(&source_addr_, ROC_AF_AUTO, "127.0.0.1", 0) == 0);
         CHECK(roc_address_init(&repair_addr_, ROC_AF_AUTO, "127.0.0.1", 0) == 0);
         recv_ = roc_receiver_open(context.get(), &config);
@@ -183,6 +275,11 @@ public:
     void run() {
         float rx_buff[MaxBufSize];
 
+        const size_t n_read_frames = (flags_ & FlagBatch) ? 2 : 1;
+        const size_t read_size = frame_size_ * n_read_frames;
+
+        roc_panic_if_not(read_size <= MaxBufSize);
+
         size_t leading_zeros = 0;
         size_t sample_num = 0;
         size_t frame_num = 0;
@@ -194,25 +291,49 @@ public:
             size_t i = 0;
             frame_num++;
 
-            roc_frame frame;
-            memset(&frame, 0, sizeof(frame));
+            if (n_read_frames == 1) {
+                roc_frame frame;
+                memset(&frame, 0, sizeof(frame));
+
+                if (flags_ & (FlagInt16 | FlagPlanar)) {
+                    char raw_buff[MaxBufSize * sizeof(float)];
 
-            frame.samples = rx_buff;
-            frame.samples_size = frame_size_ * sizeof(float);
+                    frame.samples = raw_buff;
+                    frame.samples_size = frame_size_ * user_sample_size(flags_);
 
-            roc_panic_if_not(roc_receiver_read(recv_, &frame) == 0);
+                    roc_panic_if_not(roc_receiver_read(recv_, &frame) == 0);
+
+                    from_user_frame(raw_buff, rx_buff, frame_size_, flags_);
+                } else {
+                    frame.samples = rx_buff;
+                    frame.samples_size = frame_size_ * sizeof(float);
+
+                    roc_panic_if_not(roc_receiver_read(recv_, &frame) == 0);
+                }
+            } else {
+                roc_frame frames[MaxBufSize / FrameSamples];
+                memset(frames, 0, sizeof(frames));
+
+                for (size_t n = 0; n < n_read_frames; n++) {
+                    frames[n].samples = rx_buff + n * frame_size_;
+                    frames[n].samples_size = frame_size_ * sizeof(float);
+                }
+
+                roc_panic_if_not(roc_receiver_read_batch(recv_, frames, n_read_frames)
+                                 == 0);
+            }
 
             if (seek_first) {
-                for (; i < frame_size_ && is_zero_(rx_buff[i]); i++, leading_zeros++) {
+                for (; i < read_size && is_zero_(rx_buff[i]); i++, leading_zeros++) {
                 }
                 roc_panic_if_not(leading_zeros < Timeout);
-                if (i < frame_size_) {
+                if (i < read_size) {
                     seek_first = false;
                 }
             }
 
             if (!seek_first) {
-                for (; i < frame_size_; i++) {
+                for (; i < read_size; i++) {
                     if (sample_num >= total_samples_) {
                         roc_panic_if_not(is_zero_(rx_buff[i]));
                         finish = true;
@@ -238,8 +359,10 @@ public:
     }
 
 private:
-    static inline bool is_zero_(float s) {
-        return fabs(double(s)) < 1e-9;
+    // int16 encoding quantizes the samples, so the comparison
+    // tolerance depends on the negotiated frame layout
+    bool is_zero_(float s) const {
+        return fabs(double(s)) < epsilon_;
     }
 
     roc_receiver* recv_;
@@ -250,6 +373,8 @@ private:
     const float* samples_;
     const size_t total_samples_;
     const size_t frame_size_;
+    const unsigned flags_;
+    const double epsilon_;
 };
 
 class Proxy : private packet::IWriter {
@@ -382,7 +507,10 @@ TEST_GROUP(sender_receiver) {
         memset(&sender_conf, 0, sizeof(sender_conf));
         sender_conf.frame_sample_rate = SampleRate;
         sender_conf.frame_channels = ROC_CHANNEL_SET_STEREO;
-        sender_conf.frame_encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+        sender_conf.frame_encoding = (flags & FlagInt16) ? ROC_FRAME_ENCODING_PCM_INT16
+                                                         : ROC_FRAME_ENCODING_PCM_FLOAT;
+        sender_conf.frame_layout = (flags & FlagPlanar) ? ROC_FRAME_LAYOUT_PLANAR
+                                                        : ROC_FRAME_LAYOUT_INTERLEAVED;
         sender_conf.automatic_timing = 1;
         sender_conf.resampler_profile = ROC_RESAMPLER_DISABLE;
         sender_conf.packet_length =
@@ -398,7 +526,11 @@ TEST_GROUP(sender_receiver) {
         memset(&receiver_conf, 0, sizeof(receiver_conf));
         receiver_conf.frame_sample_rate = SampleRate;
         receiver_conf.frame_channels = ROC_CHANNEL_SET_STEREO;
-        receiver_conf.frame_encoding = ROC_FRAME_ENCODING_PCM_FLOAT;
+        receiver_conf.frame_encoding = (flags & FlagInt16)
+            ? ROC_FRAME_ENCODING_PCM_INT16
+            : ROC_FRAME_ENCODING_PCM_FLOAT;
+        receiver_conf.frame_layout = (flags & FlagPlanar) ? ROC_FRAME_LAYOUT_PLANAR
+                                                          : ROC_FRAME_LAYOUT_INTERLEAVED;
         receiver_conf.automatic_timing = 1;
         receiver_conf.resampler_profile = ROC_RESAMPLER_DISABLE;
         receiver_conf.target_latency = Latency * 1000000000ul / SampleRate;
@@ -423,6 +555,74 @@ TEST(sender_receiver, bare_rtp) {
     sender.join();
 }
 
+TEST(sender_receiver, batch_io) {
+    enum { Flags = FlagBatch };
+
+    init_config(Flags);
+
+    Context context;
+
+    Receiver receiver(context, receiver_conf, samples, TotalSamples, FrameSamples, Flags);
+
+    Sender sender(context, sender_conf, receiver.source_addr(), receiver.repair_addr(),
+                  samples, TotalSamples, FrameSamples, Flags);
+
+    sender.start();
+    receiver.run();
+    sender.join();
+}
+
+TEST(sender_receiver, interleaved_int16) {
+    enum { Flags = FlagInt16 };
+
+    init_config(Flags);
+
+    Context context;
+
+    Receiver receiver(context, receiver_conf, samples, TotalSamples, FrameSamples, Flags);
+
+    Sender sender(context, sender_conf, receiver.source_addr(), receiver.repair_addr(),
+                  samples, TotalSamples, FrameSamples, Flags);
+
+    sender.start();
+    receiver.run();
+    sender.join();
+}
+
+TEST(sender_receiver, planar_float) {
+    enum { Flags = FlagPlanar };
+
+    init_config(Flags);
+
+    Context context;
+
+    Receiver receiver(context, receiver_conf, samples, TotalSamples, FrameSamples, Flags);
+
+    Sender sender(context, sender_conf, receiver.source_addr(), receiver.repair_addr(),
+                  samples, TotalSamples, FrameSamples, Flags);
+
+    sender.start();
+    receiver.run();
+    sender.join();
+}
+
+TEST(sender_receiver, planar_int16) {
+    enum { Flags = FlagInt16 | FlagPlanar };
+
+    init_config(Flags);
+
+    Context context;
+
+    Receiver receiver(context, receiver_conf, samples, TotalSamples, FrameSamples, Flags);
+
+    Sender sender(context, sender_conf, receiver.source_addr(), receiver.repair_addr(),
+                  samples, TotalSamples, FrameSamples, Flags);
+
+    sender.start();
+    receiver.run();
+    sender.join();
+}
+
 #ifdef ROC_TARGET_OPENFEC
 TEST(sender_receiver, fec_without_losses) {
     enum { Flags = FlagFEC };
@@ -181,5 +181,112 @@ TEST(transceiver, add_duplicate) {
     UNSIGNED_LONGS_EQUAL(0, trx.num_ports());
 }
 
+// A batch of ports is opened in one loop iteration; results are reported
+// per-port and one failure doesn't prevent the rest from being opened.
+TEST(transceiver, add_batch) {
+    enum { NumPorts = 8 };
+
+    packet::ConcurrentQueue queue;
+
+    Transceiver trx(packet_pool, buffer_pool, allocator);
+
+    CHECK(trx.valid());
+
+    Transceiver::UdpPortDesc descs[NumPorts];
+
+    for (size_t n = 0; n < NumPorts; n++) {
+        descs[n].is_receiver = (n % 2 == 0);
+        descs[n].address = make_address("127.0.0.1", 0);
+        if (descs[n].is_receiver) {
+            descs[n].writer = &queue;
+        }
+    }
+
+    UNSIGNED_LONGS_EQUAL(NumPorts, trx.add_udp_ports(descs, NumPorts));
+    UNSIGNED_LONGS_EQUAL(NumPorts, trx.num_ports());
+
+    for (size_t n = 0; n < NumPorts; n++) {
+        CHECK(descs[n].ok);
+        CHECK(descs[n].address.port() != 0);
+        CHECK(descs[n].writer);
+    }
+
+    // a port that can't be bound fails, the rest of the batch succeeds
+    Transceiver::UdpPortDesc descs2[2];
+
+    descs2[0].address = descs[1].address; // already in use
+    descs2[1].address = make_address("127.0.0.1", 0);
+
+    UNSIGNED_LONGS_EQUAL(1, trx.add_udp_ports(descs2, 2));
+
+    CHECK(!descs2[0].ok);
+    CHECK(descs2[1].ok);
+
+    for (size_t n = 0; n < NumPorts; n++) {
+        trx.remove_port(descs[n].address);
+    }
+    trx.remove_port(descs2[1].address);
+
+    UNSIGNED_LONGS_EQUAL(0, trx.num_ports());
+}
+
+// In threadless mode there is no network thread: ports are added and
+// removed in-place and the loop is driven by poll().
+TEST(transceiver, threadless_add_remove) {
+    packet::ConcurrentQueue queue;
+
+    Transceiver trx(packet_pool, buffer_pool, allocator, -1, true);
+
+    CHECK(trx.valid());
+
+    packet::Address tx_addr = make_address("127.0.0.1", 0);
+    packet::Address rx_addr = make_address("127.0.0.1", 0);
+
+    CHECK(trx.add_udp_sender(tx_addr));
+    CHECK(trx.add_udp_receiver(rx_addr, queue));
+
+    UNSIGNED_LONGS_EQUAL(2, trx.num_ports());
+
+    for (int i = 0; i < 10; i++) {
+        trx.poll();
+    }
+
+    trx.remove_port(tx_addr);
+    trx.remove_port(rx_addr);
+
+    UNSIGNED_LONGS_EQUAL(0, trx.num_ports());
+}
+
+TEST(transceiver, lazy_add_remove) {
+    packet::ConcurrentQueue queue;
+
+    Transceiver trx(packet_pool, buffer_pool, allocator, -1, false, true);
+
+    CHECK(trx.valid());
+
+    // the loop thread is spawned on first port creation and quiesced when
+    // the last port is removed; repeat to cover the restart
+    for (int i = 0; i < 3; i++) {
+        packet::Address tx_addr = make_address("127.0.0.1", 0);
+        packet::Address rx_addr = make_address("127.0.0.1", 0);
+
+        CHECK(trx.add_udp_sender(tx_addr));
+        CHECK(trx.add_udp_receiver(rx_addr, queue));
+
+        UNSIGNED_LONGS_EQUAL(2, trx.num_ports());
+
+        trx.remove_port(tx_addr);
+        trx.remove_port(rx_addr);
+
+        UNSIGNED_LONGS_EQUAL(0, trx.num_ports());
+    }
+}
+
+TEST(transceiver, lazy_init_destroy) {
+    Transceiver trx(packet_pool, buffer_pool, allocator, -1, false, true);
+
+    CHECK(trx.valid());
+}
+
 } // namespace netio
 } // namespace roc
@@ -127,6 +127,64 @@ TEST(address, eq_ipv6) {
     CHECK(addr1 != addr4);
 }
 
+TEST(address, compact_eq) {
+    Address addr1;
+    CHECK(addr1.set_ipv4("1.2.3.4", 123));
+
+    Address addr2;
+    CHECK(addr2.set_ipv4("1.2.3.4", 123));
+
+    Address addr3;
+    CHECK(addr3.set_ipv4("1.2.3.4", 456));
+
+    Address addr4;
+    CHECK(addr4.set_ipv6("2001:db8::1", 123));
+
+    CHECK(addr1.compact() == addr2.compact());
+    CHECK(addr1.compact() != addr3.compact());
+    CHECK(addr1.compact() != addr4.compact());
+
+    CHECK(addr1.compact().hash() == addr2.compact().hash());
+}
+
+// An IPv4 address and its IPv4-mapped IPv6 spelling refer to the same
+// endpoint and share one canonical compact form.
+TEST(address, compact_v4_mapped) {
+    Address addr1;
+    CHECK(addr1.set_ipv4("1.2.3.4", 123));
+
+    Address addr2;
+    CHECK(addr2.set_ipv6("::ffff:1.2.3.4", 123));
+
+    CHECK(addr1.compact() == addr2.compact());
+}
+
+TEST(address, compact_round_trip) {
+    Address addr1;
+    CHECK(addr1.set_ipv4("1.2.3.4", 123));
+
+    Address addr2;
+    CHECK(addr2.set_compact(addr1.compact()));
+
+    CHECK(addr2.valid());
+    UNSIGNED_LONGS_EQUAL(4, addr2.version());
+    CHECK(addr1 == addr2);
+
+    Address addr3;
+    CHECK(addr3.set_ipv6("2001:db8::1", 456));
+
+    Address addr4;
+    CHECK(addr4.set_compact(addr3.compact()));
+
+    CHECK(addr4.valid());
+    UNSIGNED_LONGS_EQUAL(6, addr4.version());
+    CHECK(addr3 == addr4);
+
+    Address invalid;
+    Address addr5;
+    CHECK(!addr5.set_compact(invalid.compact()));
+}
+
 TEST(address, multicast_ipv4) {
     {
         Address addr;
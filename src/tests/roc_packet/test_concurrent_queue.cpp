@@ -43,5 +43,91 @@ TEST(concurrent_queue, write_read) {
     CHECK(queue.read() == p2);
 }
 
+TEST(concurrent_queue, max_size) {
+    ConcurrentQueue queue(2);
+
+    PacketPtr p1 = new_packet();
+    PacketPtr p2 = new_packet();
+    PacketPtr p3 = new_packet();
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(1, queue.n_dropped_overflow());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+
+    queue.write(p3);
+
+    LONGS_EQUAL(1, queue.n_dropped_overflow());
+
+    CHECK(queue.read() == p3);
+}
+
+TEST(concurrent_queue, max_age) {
+    ConcurrentQueue queue(0, core::Second);
+
+    PacketPtr p1 = new_packet();
+    PacketPtr p2 = new_packet();
+    PacketPtr p3 = new_packet();
+
+    p1->set_receive_timestamp(core::timestamp() - core::Second * 2);
+    p2->set_receive_timestamp(core::timestamp());
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    CHECK(queue.read() == p2);
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(1, queue.n_dropped_stale());
+}
+
+TEST(concurrent_queue, drain) {
+    ConcurrentQueue queue;
+    Queue out;
+
+    PacketPtr p1 = new_packet();
+    PacketPtr p2 = new_packet();
+    PacketPtr p3 = new_packet();
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(3, queue.drain(out));
+    LONGS_EQUAL(3, out.size());
+
+    CHECK(out.read() == p1);
+    CHECK(out.read() == p2);
+    CHECK(out.read() == p3);
+
+    LONGS_EQUAL(0, queue.drain(out));
+    LONGS_EQUAL(0, out.size());
+}
+
+TEST(concurrent_queue, drain_stale) {
+    ConcurrentQueue queue(0, core::Second);
+    Queue out;
+
+    PacketPtr p1 = new_packet();
+    PacketPtr p2 = new_packet();
+
+    p1->set_receive_timestamp(core::timestamp() - core::Second * 2);
+    p2->set_receive_timestamp(core::timestamp());
+
+    queue.write(p1);
+    queue.write(p2);
+
+    LONGS_EQUAL(1, queue.drain(out));
+
+    CHECK(out.read() == p2);
+
+    LONGS_EQUAL(1, queue.n_dropped_stale());
+}
+
 } // namespace packet
 } // namespace roc
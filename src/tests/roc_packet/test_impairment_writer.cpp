@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/impairment_writer.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_packet/queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { NumPackets = 10000 };
+
+core::HeapAllocator allocator;
+PacketPool pool(allocator, true);
+core::BufferPool<uint8_t> buffer_pool(allocator, 100, true);
+
+} // namespace
+
+TEST_GROUP(impairment_writer) {
+    PacketPtr new_packet(seqnum_t sn) {
+        PacketPtr packet = new (pool) Packet(pool);
+        CHECK(packet);
+        packet->add_flags(Packet::FlagRTP);
+        packet->rtp()->seqnum = sn;
+        core::Slice<uint8_t> data = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+        CHECK(data);
+        data.resize(10);
+        packet->set_data(data);
+        return packet;
+    }
+};
+
+TEST(impairment_writer, no_impairments) {
+    Queue queue;
+    ImpairmentConfig config;
+    ImpairmentWriter writer(queue, pool, config);
+
+    for (seqnum_t n = 0; n < 100; n++) {
+        writer.write(new_packet(n));
+    }
+    writer.flush();
+
+    UNSIGNED_LONGS_EQUAL(100, queue.size());
+
+    for (seqnum_t n = 0; n < 100; n++) {
+        PacketPtr packet = queue.read();
+        CHECK(packet);
+        UNSIGNED_LONGS_EQUAL(n, packet->rtp()->seqnum);
+    }
+}
+
+TEST(impairment_writer, random_loss) {
+    Queue queue;
+    ImpairmentConfig config;
+    config.loss_rate = 0.1f;
+    ImpairmentWriter writer(queue, pool, config);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        writer.write(new_packet(n));
+    }
+    writer.flush();
+
+    UNSIGNED_LONGS_EQUAL(NumPackets, writer.n_total());
+    UNSIGNED_LONGS_EQUAL(NumPackets - writer.n_dropped(), queue.size());
+
+    // the observed loss rate should be close to the configured one
+    CHECK(writer.n_dropped() > NumPackets / 10 * 8 / 10);
+    CHECK(writer.n_dropped() < NumPackets / 10 * 12 / 10);
+}
+
+TEST(impairment_writer, deterministic_seed) {
+    ImpairmentConfig config;
+    config.seed = 42;
+    config.loss_rate = 0.1f;
+
+    Queue queue1;
+    ImpairmentWriter writer1(queue1, pool, config);
+
+    Queue queue2;
+    ImpairmentWriter writer2(queue2, pool, config);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        writer1.write(new_packet(n));
+        writer2.write(new_packet(n));
+    }
+
+    UNSIGNED_LONGS_EQUAL(writer1.n_dropped(), writer2.n_dropped());
+    UNSIGNED_LONGS_EQUAL(queue1.size(), queue2.size());
+
+    while (queue1.size() != 0) {
+        PacketPtr p1 = queue1.read();
+        PacketPtr p2 = queue2.read();
+        CHECK(p1);
+        CHECK(p2);
+        UNSIGNED_LONGS_EQUAL(p1->rtp()->seqnum, p2->rtp()->seqnum);
+    }
+}
+
+TEST(impairment_writer, burst_loss) {
+    Queue queue;
+    ImpairmentConfig config;
+    config.burst_enter_rate = 0.01f;
+    config.burst_exit_rate = 0.3f;
+    config.burst_loss_rate = 1.0f;
+    ImpairmentWriter writer(queue, pool, config);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        writer.write(new_packet(n));
+    }
+    writer.flush();
+
+    CHECK(writer.n_dropped() > 0);
+
+    // with burst_loss_rate of one, losses come in runs of consecutive
+    // sequence numbers; verify that at least one run is longer than one
+    size_t max_gap = 0;
+    seqnum_t prev = 0;
+    bool has_prev = false;
+
+    while (queue.size() != 0) {
+        PacketPtr packet = queue.read();
+        CHECK(packet);
+        if (has_prev) {
+            const size_t gap = (size_t)(packet->rtp()->seqnum - prev) - 1;
+            if (gap > max_gap) {
+                max_gap = gap;
+            }
+        }
+        prev = packet->rtp()->seqnum;
+        has_prev = true;
+    }
+
+    CHECK(max_gap > 1);
+}
+
+TEST(impairment_writer, reordering) {
+    Queue queue;
+    ImpairmentConfig config;
+    config.reorder_rate = 0.05f;
+    config.reorder_window = 3;
+    ImpairmentWriter writer(queue, pool, config);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        writer.write(new_packet(n));
+    }
+    writer.flush();
+
+    CHECK(writer.n_reordered() > 0);
+    UNSIGNED_LONGS_EQUAL(NumPackets, queue.size());
+
+    // all packets are delivered, some of them out of order
+    size_t n_out_of_order = 0;
+    seqnum_t prev = 0;
+    bool has_prev = false;
+
+    while (queue.size() != 0) {
+        PacketPtr packet = queue.read();
+        CHECK(packet);
+        if (has_prev && seqnum_lt(packet->rtp()->seqnum, prev)) {
+            n_out_of_order++;
+        }
+        prev = packet->rtp()->seqnum;
+        has_prev = true;
+    }
+
+    UNSIGNED_LONGS_EQUAL(writer.n_reordered(), n_out_of_order);
+}
+
+TEST(impairment_writer, duplication) {
+    Queue queue;
+    ImpairmentConfig config;
+    config.duplicate_rate = 0.05f;
+    ImpairmentWriter writer(queue, pool, config);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        writer.write(new_packet(n));
+    }
+    writer.flush();
+
+    CHECK(writer.n_duplicated() > 0);
+    UNSIGNED_LONGS_EQUAL(NumPackets + writer.n_duplicated(), queue.size());
+}
+
+} // namespace packet
+} // namespace roc
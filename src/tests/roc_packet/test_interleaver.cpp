@@ -112,5 +112,52 @@ TEST(interleaver, flush) {
     }
 }
 
+TEST(interleaver, adaptive_depth) {
+    enum { BlockSize = 8, CleanPeriodsPerShrink = 8 };
+
+    Queue queue;
+    Interleaver intrlvr(queue, allocator, BlockSize);
+
+    CHECK(intrlvr.valid());
+
+    LONGS_EQUAL(BlockSize, intrlvr.depth());
+
+    // Report enough clean periods to shrink down to pass-through.
+    for (size_t d = BlockSize; d > 1; d /= 2) {
+        for (size_t n = 0; n < CleanPeriodsPerShrink; n++) {
+            intrlvr.update_link_stats(0);
+        }
+    }
+
+    // Depth change is applied on the next write.
+    intrlvr.write(new_packet(0));
+    LONGS_EQUAL(1, intrlvr.depth());
+
+    // In pass-through mode every packet is forwarded immediately.
+    for (seqnum_t n = 1; n < BlockSize; n++) {
+        intrlvr.write(new_packet(n));
+    }
+    LONGS_EQUAL(BlockSize, queue.size());
+
+    for (seqnum_t n = 0; n < BlockSize; n++) {
+        PacketPtr p = queue.read();
+        CHECK(p);
+        LONGS_EQUAL(n, p->rtp()->seqnum);
+    }
+
+    // A loss burst re-deepens the interleaver.
+    intrlvr.update_link_stats(3);
+    intrlvr.write(new_packet(100));
+    LONGS_EQUAL(6, intrlvr.depth());
+
+    // Depth never exceeds the configured block size.
+    intrlvr.update_link_stats(100);
+    intrlvr.flush();
+    intrlvr.write(new_packet(101));
+    LONGS_EQUAL(BlockSize, intrlvr.depth());
+
+    intrlvr.flush();
+}
+
 } // namespace packet
 } // namespace roc
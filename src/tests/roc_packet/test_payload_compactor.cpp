@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_packet/payload_compactor.h"
+#include "roc_packet/queue.h"
+
+namespace roc {
+namespace packet {
+
+namespace {
+
+enum { LargeBufSize = 2000, CompactBufSize = 200 };
+
+core::HeapAllocator allocator;
+PacketPool pool(allocator, true);
+core::BufferPool<uint8_t> large_buffer_pool(allocator, LargeBufSize, true);
+core::BufferPool<uint8_t> compact_buffer_pool(allocator, CompactBufSize, true);
+
+} // namespace
+
+TEST_GROUP(payload_compactor) {
+    PacketPtr new_packet(size_t data_size, size_t header_size) {
+        PacketPtr packet = new (pool) Packet(pool);
+        CHECK(packet);
+
+        core::Slice<uint8_t> data =
+            new (large_buffer_pool) core::Buffer<uint8_t>(large_buffer_pool);
+        CHECK(data);
+        data.resize(data_size);
+
+        for (size_t n = 0; n < data_size; n++) {
+            data.data()[n] = uint8_t(n);
+        }
+
+        packet->set_data(data);
+
+        packet->add_flags(Packet::FlagRTP);
+        packet->rtp()->header = data.range(0, header_size);
+        packet->rtp()->payload = data.range(header_size, data_size);
+
+        return packet;
+    }
+};
+
+TEST(payload_compactor, compact_small_packet) {
+    Queue queue;
+    PayloadCompactor compactor(queue, compact_buffer_pool);
+
+    PacketPtr packet = new_packet(100, 12);
+    const uint8_t* old_ptr = packet->data().data();
+
+    compactor.write(packet);
+
+    UNSIGNED_LONGS_EQUAL(1, queue.size());
+
+    PacketPtr rp = queue.read();
+    CHECK(rp);
+
+    // the packet is re-pointed at a new, smaller buffer with the same bytes
+    CHECK(rp->data().data() != old_ptr);
+    UNSIGNED_LONGS_EQUAL(100, rp->data().size());
+
+    for (size_t n = 0; n < 100; n++) {
+        UNSIGNED_LONGS_EQUAL(uint8_t(n), rp->data().data()[n]);
+    }
+
+    // the parsed sub-slices are remapped into the new buffer
+    CHECK(rp->rtp()->header.data() == rp->data().data());
+    UNSIGNED_LONGS_EQUAL(12, rp->rtp()->header.size());
+
+    CHECK(rp->rtp()->payload.data() == rp->data().data() + 12);
+    UNSIGNED_LONGS_EQUAL(100 - 12, rp->rtp()->payload.size());
+}
+
+TEST(payload_compactor, passthrough_large_packet) {
+    Queue queue;
+    PayloadCompactor compactor(queue, compact_buffer_pool);
+
+    PacketPtr packet = new_packet(CompactBufSize + 1, 12);
+    const uint8_t* old_ptr = packet->data().data();
+
+    compactor.write(packet);
+
+    PacketPtr rp = queue.read();
+    CHECK(rp);
+
+    // packets that don't fit the compact buffer are passed through unchanged
+    CHECK(rp->data().data() == old_ptr);
+    UNSIGNED_LONGS_EQUAL(CompactBufSize + 1, rp->data().size());
+}
+
+TEST(payload_compactor, rehome_packet) {
+    Queue queue;
+    PacketPool session_pool(allocator, true);
+    PayloadCompactor compactor(queue, compact_buffer_pool, &session_pool);
+
+    PacketPtr packet = new_packet(100, 12);
+    packet->rtp()->seqnum = 42;
+    packet->set_receive_timestamp(12345);
+
+    compactor.write(packet);
+
+    PacketPtr rp = queue.read();
+    CHECK(rp);
+
+    // the packet object is replaced with a copy from the session pool
+    CHECK(rp != packet);
+    CHECK(rp->flags() == packet->flags());
+    UNSIGNED_LONGS_EQUAL(42, rp->rtp()->seqnum);
+    LONGS_EQUAL(12345, rp->receive_timestamp());
+
+    // the payload is compacted and the sub-slices remapped as usual
+    CHECK(rp->data().data() != packet->data().data());
+    UNSIGNED_LONGS_EQUAL(100, rp->data().size());
+    CHECK(rp->rtp()->payload.data() == rp->data().data() + 12);
+
+    for (size_t n = 0; n < 100; n++) {
+        UNSIGNED_LONGS_EQUAL(uint8_t(n), rp->data().data()[n]);
+    }
+
+    rp = NULL;
+}
+
+TEST(payload_compactor, empty_subslices) {
+    Queue queue;
+    PayloadCompactor compactor(queue, compact_buffer_pool);
+
+    PacketPtr packet = new_packet(50, 12);
+
+    // csrc, extension, and padding are left empty by the parser
+    CHECK(!packet->rtp()->csrc);
+
+    compactor.write(packet);
+
+    PacketPtr rp = queue.read();
+    CHECK(rp);
+
+    CHECK(!rp->rtp()->csrc);
+    CHECK(!rp->rtp()->extension);
+    CHECK(!rp->rtp()->padding);
+}
+
+} // namespace packet
+} // namespace roc
@@ -26,11 +26,12 @@ PacketPool pool(allocator, true);
 } // namespace
 
 TEST_GROUP(router) {
-    PacketPtr new_packet(source_t source, unsigned flags) {
+    PacketPtr new_packet(source_t source, unsigned flags, seqnum_t seqnum = 0) {
         PacketPtr packet = new(pool) Packet(pool);
         CHECK(packet);
         packet->add_flags(Packet::FlagRTP | flags);
         packet->rtp()->source = source;
+        packet->rtp()->seqnum = seqnum;
         return packet;
     }
 };
@@ -184,5 +185,59 @@ TEST(router, different_routes_different_sources) {
     UNSIGNED_LONGS_EQUAL(1, queue_f.size());
 }
 
+TEST(router, dedup_duplicates) {
+    Router router(allocator, MaxRoutes);
+
+    CHECK(router.valid());
+
+    Queue queue;
+    CHECK(router.add_route(queue, Packet::FlagAudio, true));
+
+    router.write(new_packet(11, Packet::FlagAudio, 100));
+    router.write(new_packet(11, Packet::FlagAudio, 101));
+    UNSIGNED_LONGS_EQUAL(2, queue.size());
+
+    // duplicates delivered over another path
+    router.write(new_packet(11, Packet::FlagAudio, 100));
+    router.write(new_packet(11, Packet::FlagAudio, 101));
+    UNSIGNED_LONGS_EQUAL(2, queue.size());
+
+    // reordered, but not seen yet
+    router.write(new_packet(11, Packet::FlagAudio, 99));
+    UNSIGNED_LONGS_EQUAL(3, queue.size());
+
+    router.write(new_packet(11, Packet::FlagAudio, 99));
+    UNSIGNED_LONGS_EQUAL(3, queue.size());
+}
+
+TEST(router, dedup_disabled) {
+    Router router(allocator, MaxRoutes);
+
+    CHECK(router.valid());
+
+    Queue queue;
+    CHECK(router.add_route(queue, Packet::FlagAudio));
+
+    router.write(new_packet(11, Packet::FlagAudio, 100));
+    router.write(new_packet(11, Packet::FlagAudio, 100));
+    UNSIGNED_LONGS_EQUAL(2, queue.size());
+}
+
+TEST(router, has_source) {
+    Router router(allocator, MaxRoutes);
+
+    CHECK(router.valid());
+
+    Queue queue;
+    CHECK(router.add_route(queue, Packet::FlagAudio));
+
+    CHECK(!router.has_source(11));
+
+    router.write(new_packet(11, Packet::FlagAudio));
+
+    CHECK(router.has_source(11));
+    CHECK(!router.has_source(22));
+}
+
 } // namespace packet
 } // namespace roc
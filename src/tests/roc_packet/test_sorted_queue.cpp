@@ -8,6 +8,7 @@
 
 #include <CppUTest/TestHarness.h>
 
+#include "roc_core/buffer_pool.h"
 #include "roc_core/heap_allocator.h"
 #include "roc_packet/packet_pool.h"
 #include "roc_packet/sorted_queue.h"
@@ -393,5 +394,171 @@ TEST(sorted_queue, latest) {
     CHECK(queue.latest() == p4);
 }
 
+TEST(sorted_queue, indexed_two_packets) {
+    SortedQueue queue(0, allocator);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+
+    queue.write(p2);
+    queue.write(p1);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.tail() == p2);
+    CHECK(queue.head() == p1);
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.tail());
+    CHECK(!queue.head());
+
+    CHECK(!queue.read());
+}
+
+TEST(sorted_queue, indexed_duplicates) {
+    const size_t NumPackets = 10;
+
+    SortedQueue queue(0, allocator);
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(n));
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        queue.write(new_packet(n));
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read()->rtp()->seqnum == n);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(sorted_queue, indexed_max_size) {
+    SortedQueue queue(2, allocator);
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+    PacketPtr p3 = new_packet(3);
+
+    queue.write(p1);
+    queue.write(p2);
+    queue.write(p3);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p1);
+    CHECK(queue.tail() == p2);
+
+    CHECK(queue.read() == p1);
+
+    LONGS_EQUAL(1, queue.size());
+
+    queue.write(p3);
+
+    LONGS_EQUAL(2, queue.size());
+
+    CHECK(queue.head() == p2);
+    CHECK(queue.tail() == p3);
+}
+
+TEST(sorted_queue, indexed_out_of_order_many_packets) {
+    enum { NumPackets = 100 };
+
+    SortedQueue queue(0, allocator);
+
+    PacketPtr packets[NumPackets];
+
+    for (seqnum_t n = 0; n < NumPackets; n++) {
+        packets[n] = new_packet(n);
+    }
+
+    // insert in a scattered order
+    for (size_t step = 0; step < 10; step++) {
+        for (size_t n = step; n < NumPackets; n += 10) {
+            queue.write(packets[n]);
+        }
+    }
+
+    LONGS_EQUAL(NumPackets, queue.size());
+
+    CHECK(queue.head() == packets[0]);
+    CHECK(queue.tail() == packets[NumPackets - 1]);
+
+    for (size_t n = 0; n < NumPackets; n++) {
+        CHECK(queue.read() == packets[n]);
+    }
+
+    LONGS_EQUAL(0, queue.size());
+}
+
+TEST(sorted_queue, indexed_overflow_sorting) {
+    const seqnum_t sn = seqnum_t(-1);
+
+    SortedQueue queue(0, allocator);
+
+    PacketPtr p1 = new_packet(seqnum_t(sn - 10));
+    PacketPtr p2 = new_packet(sn);
+    PacketPtr p3 = new_packet(seqnum_t(sn + 10));
+
+    queue.write(p2);
+    queue.write(p1);
+    queue.write(p3);
+
+    LONGS_EQUAL(3, queue.size());
+
+    CHECK(queue.read() == p1);
+    CHECK(queue.read() == p2);
+    CHECK(queue.read() == p3);
+
+    LONGS_EQUAL(0, queue.size());
+
+    CHECK(!queue.read());
+}
+
+TEST(sorted_queue, byte_size) {
+    core::BufferPool<uint8_t> buffer_pool(allocator, 100, true);
+
+    SortedQueue queue(0);
+
+    LONGS_EQUAL(0, queue.byte_size());
+
+    PacketPtr p1 = new_packet(1);
+    PacketPtr p2 = new_packet(2);
+
+    core::Slice<uint8_t> b1 = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    b1.resize(10);
+    p1->set_data(b1);
+
+    core::Slice<uint8_t> b2 = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+    b2.resize(20);
+    p2->set_data(b2);
+
+    queue.write(p1);
+    LONGS_EQUAL(10, queue.byte_size());
+
+    queue.write(p2);
+    LONGS_EQUAL(30, queue.byte_size());
+
+    // duplicates are dropped and not counted
+    queue.write(p1);
+    LONGS_EQUAL(30, queue.byte_size());
+
+    CHECK(queue.read() == p1);
+    LONGS_EQUAL(20, queue.byte_size());
+
+    CHECK(queue.read() == p2);
+    LONGS_EQUAL(0, queue.byte_size());
+}
+
 } // namespace packet
 } // namespace roc
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <math.h>
+
+#include "roc_audio/resampler_writer.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/thread_pool.h"
+#include "roc_pipeline/chunked_converter.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+enum {
+    InRate = 44100,
+    OutRate = 48000,
+
+    ChMask = 0x3,
+    NumCh = 2,
+
+    FrameSize = 128,
+    NumThreads = 2,
+
+    // a few seconds, enough to cover several chunk batches
+    NumSamples = InRate * 3 * NumCh
+};
+
+core::HeapAllocator allocator;
+core::BufferPool<audio::sample_t> sample_buffer_pool(allocator, FrameSize, true);
+
+class CollectWriter : public audio::IWriter, public core::NonCopyable<> {
+public:
+    CollectWriter()
+        : samples_(allocator) {
+    }
+
+    virtual void write(audio::Frame& frame) {
+        const size_t pos = samples_.size();
+        CHECK(samples_.resize(pos + frame.size()));
+        memcpy(&samples_[pos], frame.data(), frame.size() * sizeof(audio::sample_t));
+    }
+
+    const core::Array<audio::sample_t>& samples() const {
+        return samples_;
+    }
+
+private:
+    core::Array<audio::sample_t> samples_;
+};
+
+void generate_sine(core::Array<audio::sample_t>& samples) {
+    CHECK(samples.resize(NumSamples));
+    for (size_t i = 0; i < NumSamples; i += NumCh) {
+        const audio::sample_t v =
+            (audio::sample_t)sin(2 * M_PI * 110 * double(i / NumCh) / InRate);
+        for (size_t ch = 0; ch < NumCh; ch++) {
+            samples[i + ch] = v;
+        }
+    }
+}
+
+void write_frames(audio::IWriter& writer, core::Array<audio::sample_t>& samples) {
+    for (size_t pos = 0; pos < samples.size(); pos += FrameSize) {
+        size_t sz = samples.size() - pos;
+        if (sz > FrameSize) {
+            sz = FrameSize;
+        }
+        audio::Frame frame(&samples[pos], sz);
+        writer.write(frame);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(chunked_converter) {
+    ConverterConfig config;
+
+    void setup() {
+        config.input_channels = ChMask;
+        config.output_channels = ChMask;
+
+        config.input_sample_rate = InRate;
+        config.output_sample_rate = OutRate;
+
+        config.internal_frame_size = FrameSize;
+
+        config.resampling = true;
+        config.poisoning = false;
+    }
+};
+
+TEST(chunked_converter, matches_serial_output) {
+    core::Array<audio::sample_t> input(allocator);
+    generate_sine(input);
+
+    // serial reference
+    CollectWriter serial_out;
+    {
+        audio::ResamplerWriter resampler(serial_out, sample_buffer_pool, allocator,
+                                         config.resampler, config.output_channels,
+                                         FrameSize);
+        CHECK(resampler.valid());
+        CHECK(resampler.set_scaling(float(InRate) / OutRate));
+
+        write_frames(resampler, input);
+    }
+
+    // parallel conversion
+    CollectWriter parallel_out;
+    {
+        core::ThreadPool thread_pool(allocator, NumThreads);
+        CHECK(thread_pool.valid());
+
+        ChunkedConverter converter(config, &parallel_out, thread_pool,
+                                   sample_buffer_pool, allocator);
+        CHECK(converter.valid());
+
+        write_frames(converter, input);
+        converter.flush();
+    }
+
+    const core::Array<audio::sample_t>& serial = serial_out.samples();
+    const core::Array<audio::sample_t>& parallel = parallel_out.samples();
+
+    // both variants lose up to a resampler window at stream edges
+    long len_diff = (long)serial.size() - (long)parallel.size();
+    if (len_diff < 0) {
+        len_diff = -len_diff;
+    }
+    CHECK((size_t)len_diff < FrameSize * 8);
+
+    size_t size = serial.size();
+    if (size > parallel.size()) {
+        size = parallel.size();
+    }
+    CHECK(size > (size_t)NumSamples / 2);
+
+    // chunk splicing may shift the signal by a sample, so compare with
+    // a tolerance instead of expecting bit-exact output
+    double max_diff = 0;
+    for (size_t i = 0; i < size; i++) {
+        const double d = fabs((double)serial[i] - (double)parallel[i]);
+        if (d > max_diff) {
+            max_diff = d;
+        }
+    }
+    CHECK(max_diff < 0.1);
+}
+
+TEST(chunked_converter, small_input) {
+    core::Array<audio::sample_t> input(allocator);
+    CHECK(input.resize(FrameSize * 10));
+
+    CollectWriter out;
+
+    core::ThreadPool thread_pool(allocator, NumThreads);
+    CHECK(thread_pool.valid());
+
+    ChunkedConverter converter(config, &out, thread_pool, sample_buffer_pool,
+                               allocator);
+    CHECK(converter.valid());
+
+    write_frames(converter, input);
+    converter.flush();
+
+    // no more output than the resampled input size
+    CHECK(out.samples().size()
+          <= (size_t)((uint64_t)input.size() * OutRate / InRate) + FrameSize);
+}
+
+} // namespace pipeline
+} // namespace roc
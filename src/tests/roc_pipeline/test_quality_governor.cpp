@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_pipeline/quality_governor.h"
+
+namespace roc {
+namespace pipeline {
+
+namespace {
+
+const core::nanoseconds_t FramePeriod = 10 * core::Millisecond;
+
+const core::nanoseconds_t OverloadedBusy = 9 * core::Millisecond;
+const core::nanoseconds_t RelaxedBusy = core::Millisecond;
+
+enum { MaxDegradeFrames = 1000, MaxRestoreFrames = 10000 };
+
+// Feed frames with the given busy time until the level changes.
+// Returns false if it never changes within max_frames.
+bool feed_until_change(QualityGovernor& governor,
+                       core::nanoseconds_t busy,
+                       size_t max_frames) {
+    for (size_t n = 0; n < max_frames; n++) {
+        if (governor.update(busy, FramePeriod)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_GROUP(quality_governor) {};
+
+TEST(quality_governor, full_quality_by_default) {
+    QualityGovernor governor;
+
+    CHECK_EQUAL(QualityGovernor::Level_Full, governor.level());
+    CHECK(governor.allow_admission());
+    CHECK(governor.allow_fec_repair());
+    CHECK(governor.allow_resampling());
+}
+
+TEST(quality_governor, stays_full_under_light_load) {
+    QualityGovernor governor;
+
+    for (size_t n = 0; n < MaxRestoreFrames; n++) {
+        CHECK(!governor.update(RelaxedBusy, FramePeriod));
+    }
+
+    CHECK_EQUAL(QualityGovernor::Level_Full, governor.level());
+}
+
+TEST(quality_governor, degrades_step_by_step) {
+    QualityGovernor governor;
+
+    CHECK(feed_until_change(governor, OverloadedBusy, MaxDegradeFrames));
+    CHECK_EQUAL(QualityGovernor::Level_NoAdmission, governor.level());
+    CHECK(!governor.allow_admission());
+    CHECK(governor.allow_fec_repair());
+    CHECK(governor.allow_resampling());
+
+    CHECK(feed_until_change(governor, OverloadedBusy, MaxDegradeFrames));
+    CHECK_EQUAL(QualityGovernor::Level_NoRepair, governor.level());
+    CHECK(!governor.allow_fec_repair());
+    CHECK(governor.allow_resampling());
+
+    CHECK(feed_until_change(governor, OverloadedBusy, MaxDegradeFrames));
+    CHECK_EQUAL(QualityGovernor::Level_NoResampling, governor.level());
+    CHECK(!governor.allow_resampling());
+
+    // the lowest level is a floor
+    CHECK(!feed_until_change(governor, OverloadedBusy, MaxDegradeFrames));
+    CHECK_EQUAL(QualityGovernor::Level_NoResampling, governor.level());
+}
+
+TEST(quality_governor, restores_after_sustained_recovery) {
+    QualityGovernor governor;
+
+    CHECK(feed_until_change(governor, OverloadedBusy, MaxDegradeFrames));
+    CHECK_EQUAL(QualityGovernor::Level_NoAdmission, governor.level());
+
+    CHECK(feed_until_change(governor, RelaxedBusy, MaxRestoreFrames));
+    CHECK_EQUAL(QualityGovernor::Level_Full, governor.level());
+    CHECK(governor.allow_admission());
+}
+
+TEST(quality_governor, brief_spikes_dont_degrade) {
+    QualityGovernor governor;
+
+    // bursts shorter than the degrade threshold, separated by relaxed
+    // frames, must never trigger a step down
+    for (size_t burst = 0; burst < 500; burst++) {
+        for (size_t n = 0; n < 16; n++) {
+            CHECK(!governor.update(OverloadedBusy, FramePeriod));
+        }
+        governor.update(RelaxedBusy, FramePeriod);
+    }
+
+    CHECK_EQUAL(QualityGovernor::Level_Full, governor.level());
+}
+
+} // namespace pipeline
+} // namespace roc
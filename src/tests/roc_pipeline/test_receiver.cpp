@@ -56,6 +56,10 @@ fec::CodecMap codec_map;
 rtp::FormatMap format_map;
 rtp::Composer rtp_composer(NULL);
 
+void increment_counter(void* arg) {
+    (*(size_t*)arg)++;
+}
+
 } // namespace
 
 TEST_GROUP(receiver) {
@@ -167,6 +171,68 @@ TEST(receiver, one_session) {
     }
 }
 
+TEST(receiver, ready_callback) {
+    Receiver receiver(config, codec_map, format_map, packet_pool, byte_buffer_pool,
+                      sample_buffer_pool, allocator);
+
+    CHECK(receiver.valid());
+    CHECK(receiver.add_port(port1));
+
+    size_t counter = 0;
+    receiver.set_ready_callback(increment_counter, &counter);
+
+    PacketWriter packet_writer(allocator, receiver, rtp_composer, format_map, packet_pool,
+                               byte_buffer_pool, PayloadType, src1, port1.address);
+
+    UNSIGNED_LONGS_EQUAL(0, counter);
+
+    // the first packet activates the receiver and fires the callback
+    packet_writer.write_packets(1, SamplesPerPacket, ChMask);
+
+    UNSIGNED_LONGS_EQUAL(1, counter);
+
+    // the receiver stays active, so further packets don't fire it
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket, ChMask);
+
+    UNSIGNED_LONGS_EQUAL(1, counter);
+}
+
+TEST(receiver, get_stats) {
+    Receiver receiver(config, codec_map, format_map, packet_pool, byte_buffer_pool,
+                      sample_buffer_pool, allocator);
+
+    CHECK(receiver.valid());
+    CHECK(receiver.add_port(port1));
+
+    ReceiverStats stats;
+    receiver.get_stats(stats);
+
+    UNSIGNED_LONGS_EQUAL(0, stats.num_sessions);
+    UNSIGNED_LONGS_EQUAL(0, stats.niq_latency);
+
+    FrameReader frame_reader(receiver, sample_buffer_pool);
+
+    PacketWriter packet_writer(allocator, receiver, rtp_composer, format_map, packet_pool,
+                               byte_buffer_pool, PayloadType, src1, port1.address);
+
+    packet_writer.write_packets(Latency / SamplesPerPacket, SamplesPerPacket, ChMask);
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            frame_reader.read_samples(SamplesPerFrame * NumCh, 1);
+        }
+
+        packet_writer.write_packets(1, SamplesPerPacket, ChMask);
+
+        receiver.get_stats(stats);
+
+        UNSIGNED_LONGS_EQUAL(1, stats.num_sessions);
+        CHECK(stats.niq_latency > 0);
+        UNSIGNED_LONGS_EQUAL(0, stats.lost_packets);
+        UNSIGNED_LONGS_EQUAL(0, stats.missing_samples);
+    }
+}
+
 TEST(receiver, one_session_long_run) {
     enum { NumIterations = 10 };
 
@@ -344,6 +410,72 @@ TEST(receiver, two_sessions_synchronous) {
     }
 }
 
+TEST(receiver, two_sessions_unmixed) {
+    enum { NumSess = 2, Offset2 = 100 };
+
+    config.common.unmixed = true;
+
+    Receiver receiver(config, codec_map, format_map, packet_pool, byte_buffer_pool,
+                      sample_buffer_pool, allocator);
+
+    CHECK(receiver.valid());
+    CHECK(receiver.add_port(port1));
+
+    PacketWriter packet_writer1(allocator, receiver, rtp_composer, format_map,
+                                packet_pool, byte_buffer_pool, PayloadType, src1,
+                                port1.address);
+
+    PacketWriter packet_writer2(allocator, receiver, rtp_composer, format_map,
+                                packet_pool, byte_buffer_pool, PayloadType, src2,
+                                port1.address);
+
+    packet_writer2.set_offset(Offset2);
+
+    for (size_t np = 0; np < Latency / SamplesPerPacket; np++) {
+        packet_writer1.write_packets(1, SamplesPerPacket, ChMask);
+        packet_writer2.write_packets(1, SamplesPerPacket, ChMask);
+    }
+
+    audio::sample_t samples1[SamplesPerFrame * NumCh];
+    audio::sample_t samples2[SamplesPerFrame * NumCh];
+
+    audio::sample_t* frame_data[NumSess] = { samples1, samples2 };
+    const size_t frame_sizes[NumSess] = { SamplesPerFrame * NumCh,
+                                          SamplesPerFrame * NumCh };
+
+    packet::Address session_addrs[NumSess];
+
+    uint8_t offset1 = 0;
+    uint8_t offset2 = Offset2;
+
+    for (size_t np = 0; np < ManyPackets; np++) {
+        for (size_t nf = 0; nf < FramesPerPacket; nf++) {
+            UNSIGNED_LONGS_EQUAL(
+                NumSess,
+                receiver.read_sessions(frame_data, frame_sizes, NumSess,
+                                       session_addrs));
+
+            UNSIGNED_LONGS_EQUAL(NumSess, receiver.num_sessions());
+
+            // every stream carries its own sender's samples, not a mix
+            for (size_t ns = 0; ns < NumSess; ns++) {
+                CHECK(session_addrs[ns] == src1 || session_addrs[ns] == src2);
+
+                uint8_t& offset = session_addrs[ns] == src1 ? offset1 : offset2;
+
+                for (size_t n = 0; n < SamplesPerFrame * NumCh; n++) {
+                    DOUBLES_EQUAL((double)nth_sample(offset),
+                                  (double)frame_data[ns][n], Epsilon);
+                    offset++;
+                }
+            }
+        }
+
+        packet_writer1.write_packets(1, SamplesPerPacket, ChMask);
+        packet_writer2.write_packets(1, SamplesPerPacket, ChMask);
+    }
+}
+
 TEST(receiver, two_sessions_overlapping) {
     Receiver receiver(config, codec_map, format_map, packet_pool, byte_buffer_pool,
                       sample_buffer_pool, allocator);
@@ -97,6 +97,75 @@ TEST(sender, write) {
     CHECK(!queue.read());
 }
 
+TEST(sender, write_async) {
+    packet::Queue queue;
+
+    config.async_write = true;
+    // the ring fits the whole stream, so the test never hits the drop path
+    config.async_write_frames = ManyFrames;
+
+    {
+        Sender sender(config, source_port, queue, repair_port, queue, codec_map,
+                      format_map, packet_pool, byte_buffer_pool, sample_buffer_pool,
+                      allocator);
+
+        CHECK(sender.valid());
+
+        FrameWriter frame_writer(sender, sample_buffer_pool);
+
+        for (size_t nf = 0; nf < ManyFrames; nf++) {
+            frame_writer.write_samples(SamplesPerFrame * NumCh);
+        }
+
+        // destructor drains the ring and joins the sender thread
+    }
+
+    PacketReader packet_reader(allocator, queue, rtp_parser, format_map, packet_pool,
+                               PayloadType, source_port.address);
+
+    for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+        packet_reader.read_packet(SamplesPerPacket, ChMask);
+    }
+
+    CHECK(!queue.read());
+}
+
+TEST(sender, write_multiple_destinations) {
+    packet::Queue queue1;
+    packet::Queue queue2;
+
+    PortConfig source_port2;
+    source_port2.address = new_address(2);
+    source_port2.protocol = Proto_RTP;
+
+    Sender sender(config, source_port, queue1, repair_port, queue1, codec_map,
+                  format_map, packet_pool, byte_buffer_pool, sample_buffer_pool,
+                  allocator);
+
+    CHECK(sender.valid());
+    CHECK(sender.add_destination(source_port2, queue2, repair_port, queue2));
+
+    FrameWriter frame_writer(sender, sample_buffer_pool);
+
+    for (size_t nf = 0; nf < ManyFrames; nf++) {
+        frame_writer.write_samples(SamplesPerFrame * NumCh);
+    }
+
+    // both destinations receive an identical packet stream
+    PacketReader packet_reader1(allocator, queue1, rtp_parser, format_map, packet_pool,
+                                PayloadType, source_port.address);
+    PacketReader packet_reader2(allocator, queue2, rtp_parser, format_map, packet_pool,
+                                PayloadType, source_port2.address);
+
+    for (size_t np = 0; np < ManyFrames / FramesPerPacket; np++) {
+        packet_reader1.read_packet(SamplesPerPacket, ChMask);
+        packet_reader2.read_packet(SamplesPerPacket, ChMask);
+    }
+
+    CHECK(!queue1.read());
+    CHECK(!queue2.read());
+}
+
 TEST(sender, frame_size_small) {
     enum {
         SamplesPerSmallFrame = SamplesPerFrame / 2,
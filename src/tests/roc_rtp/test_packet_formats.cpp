@@ -15,6 +15,7 @@
 #include "roc_packet/packet_pool.h"
 #include "roc_rtp/composer.h"
 #include "roc_rtp/format_map.h"
+#include "roc_rtp/headers.h"
 #include "roc_rtp/parser.h"
 
 #include "test_packets/rtp_l16_1ch_10s_12ext.h"
@@ -94,6 +95,33 @@ TEST_GROUP(packet_formats) {
         UNSIGNED_LONGS_EQUAL(pi.padding, (packet.rtp()->padding.size() != 0));
     }
 
+    void check_packet_views(const packet::Packet& packet, const PacketInfo& pi) {
+        const packet::RTP& rtp = *packet.rtp();
+
+        UNSIGNED_LONGS_EQUAL(pi.num_csrc != 0, !!rtp.csrc);
+        UNSIGNED_LONGS_EQUAL(pi.num_csrc * sizeof(uint32_t), rtp.csrc.size());
+
+        for (size_t n = 0; n < pi.num_csrc; n++) {
+            uint32_t id;
+            memcpy(&id, rtp.csrc.data() + n * sizeof(uint32_t), sizeof(id));
+            UNSIGNED_LONGS_EQUAL(pi.csrc[n], core::ntoh32(id));
+        }
+
+        UNSIGNED_LONGS_EQUAL(pi.extension, !!rtp.extension);
+        UNSIGNED_LONGS_EQUAL(pi.extension_size, rtp.extension.size());
+
+        if (pi.extension) {
+            const ExtentionHeader& ext = *(const ExtentionHeader*)rtp.extension.data();
+
+            UNSIGNED_LONGS_EQUAL(pi.ext_type, ext.type());
+            UNSIGNED_LONGS_EQUAL(pi.ext_data_size, ext.data_size());
+
+            CHECK(memcmp(rtp.extension.data() + sizeof(ExtentionHeader), pi.ext_data,
+                         pi.ext_data_size)
+                  == 0);
+        }
+    }
+
     void set_packet_fields(packet::Packet& packet, const PacketInfo& pi) {
         CHECK(packet.rtp());
 
@@ -197,6 +225,7 @@ TEST_GROUP(packet_formats) {
 
         check_format_info(*format, pi);
         check_packet_fields(*packet, pi);
+        check_packet_views(*packet, pi);
         check_packet_data(*packet, pi);
 
         decode_samples(*decoder, *packet, pi);
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_packet/queue.h"
+#include "roc_rtp/composer.h"
+#include "roc_rtp/headers.h"
+#include "roc_rtp/redundancy_reader.h"
+#include "roc_rtp/redundancy_writer.h"
+
+namespace roc {
+namespace rtp {
+
+namespace {
+
+enum { Src = 55, PayloadSz = 20, TsStep = 10, MaxBufSz = 500 };
+
+const PayloadType Pt = PayloadType_L16_Stereo;
+
+core::HeapAllocator allocator;
+core::BufferPool<uint8_t> buffer_pool(allocator, MaxBufSz, true);
+packet::PacketPool packet_pool(allocator, true);
+
+Composer composer(NULL);
+
+} // namespace
+
+TEST_GROUP(redundancy) {
+    packet::PacketPtr new_packet(packet::seqnum_t sn) {
+        packet::PacketPtr packet = new (packet_pool) packet::Packet(packet_pool);
+        CHECK(packet);
+
+        packet->add_flags(packet::Packet::FlagAudio);
+
+        core::Slice<uint8_t> data =
+            new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+        CHECK(data);
+
+        CHECK(composer.prepare(*packet, data, PayloadSz));
+        packet->set_data(data);
+
+        packet::RTP& rtp = *packet->rtp();
+
+        rtp.source = Src;
+        rtp.seqnum = sn;
+        rtp.timestamp = packet::timestamp_t(sn * TsStep);
+        rtp.duration = TsStep;
+        rtp.payload_type = Pt;
+
+        for (size_t n = 0; n < PayloadSz; n++) {
+            rtp.payload.data()[n] = uint8_t(sn);
+        }
+
+        return packet;
+    }
+
+    void expect_packet(const packet::PacketPtr& packet, packet::seqnum_t sn) {
+        CHECK(packet);
+
+        const packet::RTP* rtp = packet->rtp();
+        CHECK(rtp);
+
+        UNSIGNED_LONGS_EQUAL(sn, rtp->seqnum);
+        UNSIGNED_LONGS_EQUAL(sn * TsStep, rtp->timestamp);
+        UNSIGNED_LONGS_EQUAL(TsStep, rtp->duration);
+        UNSIGNED_LONGS_EQUAL(Pt, rtp->payload_type);
+
+        UNSIGNED_LONGS_EQUAL(PayloadSz, rtp->payload.size());
+        for (size_t n = 0; n < PayloadSz; n++) {
+            UNSIGNED_LONGS_EQUAL(uint8_t(sn), rtp->payload.data()[n]);
+        }
+    }
+};
+
+TEST(redundancy, block_header) {
+    RedundancyBlockHeader blk;
+    blk.clear();
+
+    blk.set_follow(true);
+    blk.set_payload_type(Pt);
+    blk.set_timestamp_offset(RedundancyBlockHeader::MaxTimestampOffset);
+    blk.set_block_length(RedundancyBlockHeader::MaxBlockLength);
+
+    CHECK(blk.follow());
+    UNSIGNED_LONGS_EQUAL(Pt, blk.payload_type());
+    UNSIGNED_LONGS_EQUAL(RedundancyBlockHeader::MaxTimestampOffset,
+                         blk.timestamp_offset());
+    UNSIGNED_LONGS_EQUAL(RedundancyBlockHeader::MaxBlockLength, blk.block_length());
+
+    blk.set_timestamp_offset(TsStep);
+    blk.set_block_length(PayloadSz);
+
+    UNSIGNED_LONGS_EQUAL(TsStep, blk.timestamp_offset());
+    UNSIGNED_LONGS_EQUAL(PayloadSz, blk.block_length());
+}
+
+TEST(redundancy, no_loss) {
+    packet::Queue wire;
+    RedundancyWriter writer(wire, composer, packet_pool, buffer_pool);
+
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        writer.write(new_packet(sn));
+    }
+
+    RedundancyReader reader(wire, packet_pool);
+
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        expect_packet(reader.read(), sn);
+    }
+
+    CHECK(!reader.read());
+    UNSIGNED_LONGS_EQUAL(0, reader.n_restored());
+}
+
+TEST(redundancy, single_loss_restored) {
+    packet::Queue wire;
+    RedundancyWriter writer(wire, composer, packet_pool, buffer_pool);
+
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        writer.write(new_packet(sn));
+    }
+
+    packet::Queue lossy;
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        packet::PacketPtr packet = wire.read();
+        CHECK(packet);
+        if (sn != 3) {
+            lossy.write(packet);
+        }
+    }
+
+    RedundancyReader reader(lossy, packet_pool);
+
+    expect_packet(reader.read(), 1);
+    expect_packet(reader.read(), 2);
+
+    packet::PacketPtr restored = reader.read();
+    expect_packet(restored, 3);
+    CHECK(restored->flags() & packet::Packet::FlagRestored);
+
+    expect_packet(reader.read(), 4);
+    expect_packet(reader.read(), 5);
+
+    CHECK(!reader.read());
+    UNSIGNED_LONGS_EQUAL(1, reader.n_restored());
+}
+
+TEST(redundancy, burst_loss_not_restored) {
+    packet::Queue wire;
+    RedundancyWriter writer(wire, composer, packet_pool, buffer_pool);
+
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        writer.write(new_packet(sn));
+    }
+
+    // two adjacent packets are lost; one redundant copy per packet can't
+    // repair a burst
+    packet::Queue lossy;
+    for (packet::seqnum_t sn = 1; sn <= 5; sn++) {
+        packet::PacketPtr packet = wire.read();
+        CHECK(packet);
+        if (sn != 2 && sn != 3) {
+            lossy.write(packet);
+        }
+    }
+
+    RedundancyReader reader(lossy, packet_pool);
+
+    expect_packet(reader.read(), 1);
+    expect_packet(reader.read(), 4);
+    expect_packet(reader.read(), 5);
+
+    CHECK(!reader.read());
+    UNSIGNED_LONGS_EQUAL(0, reader.n_restored());
+}
+
+TEST(redundancy, first_packet_loss) {
+    packet::Queue wire;
+    RedundancyWriter writer(wire, composer, packet_pool, buffer_pool);
+
+    for (packet::seqnum_t sn = 1; sn <= 3; sn++) {
+        writer.write(new_packet(sn));
+    }
+
+    // the reader has no history before the first packet it sees, so a
+    // loss at the very start of the stream is not detected
+    packet::Queue lossy;
+    for (packet::seqnum_t sn = 1; sn <= 3; sn++) {
+        packet::PacketPtr packet = wire.read();
+        CHECK(packet);
+        if (sn != 1) {
+            lossy.write(packet);
+        }
+    }
+
+    RedundancyReader reader(lossy, packet_pool);
+
+    expect_packet(reader.read(), 2);
+    expect_packet(reader.read(), 3);
+
+    CHECK(!reader.read());
+    UNSIGNED_LONGS_EQUAL(0, reader.n_restored());
+}
+
+} // namespace rtp
+} // namespace roc
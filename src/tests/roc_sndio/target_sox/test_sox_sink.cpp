@@ -60,6 +60,26 @@ TEST(sox_sink, sample_rate_auto) {
     CHECK(sox_sink.sample_rate() != 0);
 }
 
+TEST(sox_sink, direct_write) {
+    SoxSink sox_sink(allocator, sink_config);
+
+    core::TempFile file("test.wav");
+    CHECK(sox_sink.open(NULL, file.path()));
+
+    // the sox buffer is handed out for direct writing, so samples go to
+    // sox without an intermediate copy
+    audio::sample_t* buf = sox_sink.begin_write(FrameSize);
+    CHECK(buf);
+
+    for (size_t n = 0; n < FrameSize; n++) {
+        buf[n] = 0;
+    }
+    sox_sink.end_write(FrameSize);
+
+    // a request larger than the sox buffer falls back to write()
+    CHECK(!sox_sink.begin_write(FrameSize * 10));
+}
+
 TEST(sox_sink, sample_rate_force) {
     sink_config.sample_rate = SampleRate;
     SoxSink sox_sink(allocator, sink_config);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_sndio/readahead_source.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+enum { FrameSize = 128, NumFrames = 20, RingFrames = 4 };
+
+core::HeapAllocator allocator;
+core::BufferPool<audio::sample_t> buffer_pool(allocator, FrameSize, true);
+
+audio::sample_t nth_sample(size_t n) {
+    return audio::sample_t(uint8_t(n)) / audio::sample_t(1 << 8);
+}
+
+class MockSource : public ISource, public core::NonCopyable<> {
+public:
+    MockSource()
+        : pos_(0) {
+    }
+
+    virtual size_t sample_rate() const {
+        return 44100;
+    }
+
+    virtual bool has_clock() const {
+        return false;
+    }
+
+    virtual State state() const {
+        return Active;
+    }
+
+    virtual void wait_active() const {
+    }
+
+    virtual bool read(audio::Frame& frame) {
+        if (pos_ == NumFrames * FrameSize) {
+            return false;
+        }
+
+        for (size_t n = 0; n < frame.size(); n++) {
+            frame.data()[n] = nth_sample(pos_++);
+        }
+
+        return true;
+    }
+
+private:
+    size_t pos_;
+};
+
+void expect_samples(const audio::sample_t* samples, size_t offset, size_t size) {
+    for (size_t n = 0; n < size; n++) {
+        DOUBLES_EQUAL((double)nth_sample(offset + n), (double)samples[n], 0.0001);
+    }
+}
+
+} // namespace
+
+TEST_GROUP(readahead_source) {};
+
+TEST(readahead_source, read) {
+    MockSource source;
+
+    ReadaheadSource readahead(allocator, buffer_pool, source, FrameSize, RingFrames);
+    CHECK(readahead.valid());
+
+    audio::sample_t buf[FrameSize];
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        audio::Frame frame(buf, FrameSize);
+        CHECK(readahead.read(frame));
+
+        expect_samples(buf, n * FrameSize, FrameSize);
+    }
+
+    audio::Frame frame(buf, FrameSize);
+    CHECK(!readahead.read(frame));
+}
+
+TEST(readahead_source, direct_read) {
+    MockSource source;
+
+    ReadaheadSource readahead(allocator, buffer_pool, source, FrameSize, RingFrames);
+    CHECK(readahead.valid());
+
+    for (size_t n = 0; n < NumFrames; n++) {
+        audio::sample_t* buf = readahead.begin_read(FrameSize);
+        CHECK(buf);
+
+        expect_samples(buf, n * FrameSize, FrameSize);
+
+        readahead.end_read();
+    }
+
+    // eof
+    CHECK(!readahead.begin_read(FrameSize));
+}
+
+TEST(readahead_source, direct_read_size_mismatch) {
+    MockSource source;
+
+    ReadaheadSource readahead(allocator, buffer_pool, source, FrameSize, RingFrames);
+    CHECK(readahead.valid());
+
+    // the tail frame can't be handed out whole with a different size
+    CHECK(!readahead.begin_read(FrameSize / 2));
+
+    audio::sample_t* buf = readahead.begin_read(FrameSize);
+    CHECK(buf);
+
+    expect_samples(buf, 0, FrameSize);
+
+    readahead.end_read();
+}
+
+TEST(readahead_source, direct_read_after_partial_read) {
+    MockSource source;
+
+    ReadaheadSource readahead(allocator, buffer_pool, source, FrameSize, RingFrames);
+    CHECK(readahead.valid());
+
+    audio::sample_t buf[FrameSize];
+
+    // leave the tail frame half-consumed
+    audio::Frame half(buf, FrameSize / 2);
+    CHECK(readahead.read(half));
+
+    expect_samples(buf, 0, FrameSize / 2);
+
+    // a partially consumed frame is not handed out
+    CHECK(!readahead.begin_read(FrameSize));
+
+    // read() resumes from the stored position
+    audio::Frame rest(buf, FrameSize / 2);
+    CHECK(readahead.read(rest));
+
+    expect_samples(buf, FrameSize / 2, FrameSize / 2);
+
+    // the next frame is unconsumed and is handed out again
+    audio::sample_t* direct_buf = readahead.begin_read(FrameSize);
+    CHECK(direct_buf);
+
+    expect_samples(direct_buf, FrameSize, FrameSize);
+
+    readahead.end_read();
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_sndio/splitter_sink.h"
+
+namespace roc {
+namespace sndio {
+
+namespace {
+
+// the ring fits the whole stream, so the tests never hit the drop path
+// and every sink deterministically receives all samples
+enum { FrameSize = 128, NumFrames = 100, RingFrames = NumFrames * 2 };
+
+core::HeapAllocator allocator;
+core::BufferPool<audio::sample_t> buffer_pool(allocator, FrameSize, true);
+
+class MockSink : public ISink, public core::NonCopyable<> {
+public:
+    MockSink()
+        : pos_(0) {
+    }
+
+    virtual size_t sample_rate() const {
+        return 44100;
+    }
+
+    virtual bool has_clock() const {
+        return true;
+    }
+
+    virtual void write(audio::Frame& frame) {
+        CHECK(pos_ + frame.size() <= MaxSz);
+
+        memcpy(samples_ + pos_, frame.data(), frame.size() * sizeof(audio::sample_t));
+        pos_ += frame.size();
+    }
+
+    void check(size_t size) {
+        UNSIGNED_LONGS_EQUAL(size, pos_);
+
+        for (size_t n = 0; n < size; n++) {
+            DOUBLES_EQUAL((double)nth_sample_(n), (double)samples_[n], 0.0001);
+        }
+    }
+
+private:
+    enum { MaxSz = FrameSize * NumFrames * 2 };
+
+    audio::sample_t nth_sample_(size_t n) {
+        return audio::sample_t(uint8_t(n)) / audio::sample_t(1 << 8);
+    }
+
+    audio::sample_t samples_[MaxSz];
+    size_t pos_;
+};
+
+void write_samples(SplitterSink& splitter, size_t offset, size_t size) {
+    audio::sample_t buf[FrameSize * 2];
+    CHECK(size <= FrameSize * 2);
+
+    for (size_t n = 0; n < size; n++) {
+        buf[n] = audio::sample_t(uint8_t(offset + n)) / audio::sample_t(1 << 8);
+    }
+
+    audio::Frame frame(buf, size);
+    splitter.write(frame);
+}
+
+} // namespace
+
+TEST_GROUP(splitter_sink) {};
+
+TEST(splitter_sink, primary_sink) {
+    MockSink sink;
+
+    SplitterSink splitter(allocator, buffer_pool, FrameSize, RingFrames);
+    CHECK(splitter.valid());
+    CHECK(splitter.add_output(sink));
+
+    UNSIGNED_LONGS_EQUAL(44100, splitter.sample_rate());
+    CHECK(splitter.has_clock());
+}
+
+TEST(splitter_sink, single_output) {
+    MockSink sink;
+
+    {
+        SplitterSink splitter(allocator, buffer_pool, FrameSize, RingFrames);
+        CHECK(splitter.valid());
+        CHECK(splitter.add_output(sink));
+
+        for (size_t n = 0; n < NumFrames; n++) {
+            write_samples(splitter, n * FrameSize, FrameSize);
+        }
+
+        // destructor drains the rings and joins the threads
+    }
+
+    sink.check(NumFrames * FrameSize);
+}
+
+TEST(splitter_sink, multiple_outputs) {
+    MockSink sink1;
+    MockSink sink2;
+
+    {
+        SplitterSink splitter(allocator, buffer_pool, FrameSize, RingFrames);
+        CHECK(splitter.valid());
+        CHECK(splitter.add_output(sink1));
+        CHECK(splitter.add_output(sink2));
+
+        for (size_t n = 0; n < NumFrames; n++) {
+            write_samples(splitter, n * FrameSize, FrameSize);
+        }
+    }
+
+    sink1.check(NumFrames * FrameSize);
+    sink2.check(NumFrames * FrameSize);
+}
+
+TEST(splitter_sink, oversized_frame) {
+    MockSink sink;
+
+    {
+        SplitterSink splitter(allocator, buffer_pool, FrameSize, RingFrames);
+        CHECK(splitter.valid());
+        CHECK(splitter.add_output(sink));
+
+        // frames larger than frame_size are split into chunks
+        write_samples(splitter, 0, FrameSize * 2);
+    }
+
+    sink.check(FrameSize * 2);
+}
+
+} // namespace sndio
+} // namespace roc
@@ -0,0 +1,710 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/helpers.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/pool.h"
+#include "roc_core/refcnt.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/shared_ptr.h"
+#include "roc_core/spsc_ring.h"
+#include "roc_core/thread.h"
+#include "roc_core/time.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/address.h"
+#include "roc_packet/concurrent_queue.h"
+#include "roc_packet/packet_pool.h"
+
+#include "roc_bench_contention/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+enum {
+    MaxSweepValues = 16,
+    MaxWorkers = 64,
+
+    // Per-worker cap on recorded latencies; above it only every n-th
+    // operation is timed, so the timing overhead stays bounded.
+    MaxSamplesPerWorker = 4096,
+
+    // Capacity of the rings that pass pool objects between workers.
+    PoolRingCapacity = 256,
+
+    // Payload size of the objects allocated in the pool benchmark,
+    // roughly a cache line.
+    PoolObjectSize = 64,
+
+    // A transceiver task round-trip involves the event loop thread and a
+    // socket bind, so the tasks benchmark runs this many times fewer
+    // operations than the others.
+    TasksOpDivisor = 1000,
+
+    // Maximum packet size for the byte buffer pool backing the
+    // transceiver in the tasks benchmark.
+    TasksMaxPacketSize = 2048
+};
+
+// Base class for benchmark workers. A started worker spins on the shared
+// start gate, so that thread creation is excluded from the measured
+// interval, and then performs the configured number of operations,
+// timing a uniform subset of them for the latency percentiles.
+class Worker : public core::Thread, public core::NonCopyable<> {
+public:
+    Worker(core::IAllocator& allocator, const core::Atomic& go, size_t n_ops)
+        : samples_(allocator)
+        , n_samples_(0)
+        , go_(go)
+        , n_ops_(n_ops)
+        , stride_(n_ops / MaxSamplesPerWorker + 1) {
+    }
+
+    virtual ~Worker() {
+    }
+
+    // Pre-allocate the sample buffer, outside of the measured interval.
+    bool init_samples() {
+        return samples_.resize(n_ops_ / stride_ + 1);
+    }
+
+    //! Recorded operation latencies, in nanoseconds.
+    const core::nanoseconds_t* samples() const {
+        return n_samples_ ? &samples_[0] : NULL;
+    }
+
+    //! Number of recorded latencies.
+    size_t n_samples() const {
+        return n_samples_;
+    }
+
+private:
+    virtual void run() {
+        while (go_.load_relaxed() == 0) {
+            // spin until the gate opens
+        }
+
+        for (size_t n = 0; n < n_ops_; n++) {
+            if (n % stride_ == 0) {
+                const core::nanoseconds_t started = core::timestamp();
+                op(n);
+                samples_[n_samples_++] = core::timestamp() - started;
+            } else {
+                op(n);
+            }
+        }
+    }
+
+    virtual void op(size_t n) = 0;
+
+    core::Array<core::nanoseconds_t> samples_;
+    size_t n_samples_;
+
+    const core::Atomic& go_;
+    const size_t n_ops_;
+    const size_t stride_;
+};
+
+struct PoolObject {
+    char payload[PoolObjectSize];
+};
+
+// Allocates objects from the shared pool and hands each one to the next
+// worker over a ring, deallocating the objects received from the
+// previous worker. With one worker, allocation and deallocation stay on
+// the same thread, which is the magazine fast path and serves as the
+// baseline; with more workers every object is freed on a foreign thread,
+// which is the contended path.
+class PoolWorker : public Worker {
+public:
+    PoolWorker(core::IAllocator& allocator,
+               const core::Atomic& go,
+               size_t n_ops,
+               core::Pool<PoolObject>& pool,
+               core::SpscRing<PoolObject*>& out_ring,
+               core::SpscRing<PoolObject*>& in_ring)
+        : Worker(allocator, go, n_ops)
+        , pool_(pool)
+        , out_ring_(out_ring)
+        , in_ring_(in_ring) {
+    }
+
+private:
+    virtual void op(size_t) {
+        PoolObject* obj = new (pool_) PoolObject;
+        if (!obj) {
+            roc_panic("bench: can't allocate pool object");
+        }
+        out_ring_.push_blocking(obj);
+
+        PoolObject* in = NULL;
+        in_ring_.pop_blocking(in);
+        pool_.destroy(*in);
+    }
+
+    core::Pool<PoolObject>& pool_;
+    core::SpscRing<PoolObject*>& out_ring_;
+    core::SpscRing<PoolObject*>& in_ring_;
+};
+
+// Allocates packets and writes them to the shared concurrent queue.
+class QueueProducer : public Worker {
+public:
+    QueueProducer(core::IAllocator& allocator,
+                  const core::Atomic& go,
+                  size_t n_ops,
+                  packet::PacketPool& packet_pool,
+                  packet::ConcurrentQueue& queue)
+        : Worker(allocator, go, n_ops)
+        , packet_pool_(packet_pool)
+        , queue_(queue) {
+    }
+
+private:
+    virtual void op(size_t) {
+        packet::PacketPtr packet = new (packet_pool_) packet::Packet(packet_pool_);
+        if (!packet) {
+            roc_panic("bench: can't allocate packet");
+        }
+        queue_.write(packet);
+    }
+
+    packet::PacketPool& packet_pool_;
+    packet::ConcurrentQueue& queue_;
+};
+
+// Drains the queue from a single thread, per the ConcurrentQueue
+// contract. Not sampled: the benchmark measures the producer side, and
+// the blocking read keeps the consumer roughly in pace with it.
+class QueueConsumer : public core::Thread, public core::NonCopyable<> {
+public:
+    QueueConsumer(packet::ConcurrentQueue& queue, size_t n_packets)
+        : queue_(queue)
+        , n_packets_(n_packets) {
+    }
+
+private:
+    virtual void run() {
+        for (size_t n = 0; n < n_packets_; n++) {
+            queue_.read();
+        }
+    }
+
+    packet::ConcurrentQueue& queue_;
+    const size_t n_packets_;
+};
+
+// Target object for the refcount benchmark. The benchmark holds a base
+// reference for its whole duration, so the counter never drops to zero
+// while the workers run and destroy() is a no-op.
+class CountedObject : public core::RefCnt<CountedObject> {
+public:
+    CountedObject() {
+    }
+
+private:
+    friend class core::RefCnt<CountedObject>;
+
+    void destroy() {
+    }
+};
+
+// Bounces the reference counter of the shared object: each operation is
+// one incref() and one decref() of the same cache line from all workers.
+class RefcountWorker : public Worker {
+public:
+    RefcountWorker(core::IAllocator& allocator,
+                   const core::Atomic& go,
+                   size_t n_ops,
+                   CountedObject& object)
+        : Worker(allocator, go, n_ops)
+        , object_(object) {
+    }
+
+private:
+    virtual void op(size_t) {
+        core::SharedPtr<CountedObject> ptr(&object_);
+        (void)ptr;
+    }
+
+    CountedObject& object_;
+};
+
+// Each operation submits an add-port and a remove-port task to the
+// shared transceiver and waits for their completion, measuring the task
+// submission round-trip under contention from the other workers.
+class TasksWorker : public Worker {
+public:
+    TasksWorker(core::IAllocator& allocator,
+                const core::Atomic& go,
+                size_t n_ops,
+                netio::Transceiver& trx)
+        : Worker(allocator, go, n_ops)
+        , trx_(trx) {
+    }
+
+private:
+    virtual void op(size_t) {
+        packet::Address addr;
+        if (!addr.set_ipv4("127.0.0.1", 0)) {
+            roc_panic("bench: can't initialize address");
+        }
+        if (!trx_.add_udp_sender(addr)) {
+            roc_panic("bench: can't add udp sender");
+        }
+        trx_.remove_port(addr);
+    }
+
+    netio::Transceiver& trx_;
+};
+
+struct BenchResult {
+    double ops_per_sec;
+    core::nanoseconds_t p50;
+    core::nanoseconds_t p90;
+    core::nanoseconds_t p99;
+    core::nanoseconds_t max;
+
+    BenchResult()
+        : ops_per_sec(0)
+        , p50(0)
+        , p90(0)
+        , p99(0)
+        , max(0) {
+    }
+};
+
+int compare_ns(const void* a, const void* b) {
+    const core::nanoseconds_t lhs = *(const core::nanoseconds_t*)a;
+    const core::nanoseconds_t rhs = *(const core::nanoseconds_t*)b;
+
+    if (lhs < rhs) {
+        return -1;
+    }
+    if (lhs > rhs) {
+        return 1;
+    }
+    return 0;
+}
+
+// Starts the prepared workers, opens the gate, joins them, and folds the
+// per-worker latency samples into percentiles. The measured interval is
+// from opening the gate to the last join.
+bool run_workers(core::IAllocator& allocator,
+                 Worker* const* workers,
+                 size_t n_workers,
+                 core::Atomic& go,
+                 size_t total_ops,
+                 int pin_core,
+                 BenchResult& result) {
+    for (size_t n = 0; n < n_workers; n++) {
+        if (!workers[n]->init_samples()) {
+            roc_log(LogError, "can't allocate sample buffer");
+            return false;
+        }
+    }
+
+    size_t n_started = 0;
+    for (; n_started < n_workers; n_started++) {
+        core::ThreadConfig config;
+        config.name = "bench_worker";
+        if (pin_core >= 0) {
+            config.cpu = pin_core + (int)n_started;
+        }
+        if (!workers[n_started]->start(config)) {
+            roc_log(LogError, "can't start worker thread");
+            break;
+        }
+    }
+
+    const core::nanoseconds_t started = core::timestamp();
+    go.store_relaxed(1);
+
+    for (size_t n = 0; n < n_started; n++) {
+        workers[n]->join();
+    }
+
+    const core::nanoseconds_t elapsed = core::timestamp() - started;
+
+    if (n_started != n_workers) {
+        return false;
+    }
+
+    result.ops_per_sec =
+        (double)total_ops / ((double)elapsed / (double)core::Second);
+
+    size_t total_samples = 0;
+    for (size_t n = 0; n < n_workers; n++) {
+        total_samples += workers[n]->n_samples();
+    }
+
+    core::Array<core::nanoseconds_t> all_samples(allocator);
+    if (!all_samples.resize(total_samples)) {
+        roc_log(LogError, "can't allocate merged sample buffer");
+        return false;
+    }
+
+    size_t pos = 0;
+    for (size_t n = 0; n < n_workers; n++) {
+        for (size_t i = 0; i < workers[n]->n_samples(); i++) {
+            all_samples[pos++] = workers[n]->samples()[i];
+        }
+    }
+
+    if (total_samples != 0) {
+        qsort(&all_samples[0], total_samples, sizeof(core::nanoseconds_t), compare_ns);
+
+        result.p50 = all_samples[(total_samples - 1) * 50 / 100];
+        result.p90 = all_samples[(total_samples - 1) * 90 / 100];
+        result.p99 = all_samples[(total_samples - 1) * 99 / 100];
+        result.max = all_samples[total_samples - 1];
+    }
+
+    return true;
+}
+
+bool bench_pool(core::IAllocator& allocator,
+                size_t n_threads,
+                size_t n_ops,
+                int pin_core,
+                BenchResult& result) {
+    core::Pool<PoolObject> pool(allocator, sizeof(PoolObject), false);
+    core::Atomic go;
+
+    core::UniquePtr<core::SpscRing<PoolObject*> > rings[MaxWorkers];
+    for (size_t n = 0; n < n_threads; n++) {
+        rings[n].reset(new (allocator)
+                           core::SpscRing<PoolObject*>(allocator, PoolRingCapacity),
+                       allocator);
+        if (!rings[n]) {
+            roc_log(LogError, "can't allocate ring");
+            return false;
+        }
+    }
+
+    core::UniquePtr<PoolWorker> workers[MaxWorkers];
+    Worker* worker_ptrs[MaxWorkers];
+
+    for (size_t n = 0; n < n_threads; n++) {
+        // worker n produces into ring n and consumes from ring n-1, so
+        // that every ring has exactly one producer and one consumer
+        core::SpscRing<PoolObject*>& in_ring =
+            *rings[(n + n_threads - 1) % n_threads];
+
+        workers[n].reset(new (allocator) PoolWorker(allocator, go, n_ops, pool,
+                                                    *rings[n], in_ring),
+                         allocator);
+        if (!workers[n]) {
+            roc_log(LogError, "can't allocate worker");
+            return false;
+        }
+        worker_ptrs[n] = workers[n].get();
+    }
+
+    return run_workers(allocator, worker_ptrs, n_threads, go, n_threads * n_ops,
+                       pin_core, result);
+}
+
+bool bench_queue(core::IAllocator& allocator,
+                 size_t n_threads,
+                 size_t n_ops,
+                 int pin_core,
+                 BenchResult& result) {
+    packet::PacketPool packet_pool(allocator, false);
+    packet::ConcurrentQueue queue;
+    core::Atomic go;
+
+    QueueConsumer consumer(queue, n_threads * n_ops);
+
+    core::ThreadConfig consumer_config;
+    consumer_config.name = "bench_consumer";
+    if (pin_core >= 0) {
+        consumer_config.cpu = pin_core + (int)n_threads;
+    }
+    if (!consumer.start(consumer_config)) {
+        roc_log(LogError, "can't start consumer thread");
+        return false;
+    }
+
+    core::UniquePtr<QueueProducer> workers[MaxWorkers];
+    Worker* worker_ptrs[MaxWorkers];
+
+    for (size_t n = 0; n < n_threads; n++) {
+        workers[n].reset(new (allocator)
+                             QueueProducer(allocator, go, n_ops, packet_pool, queue),
+                         allocator);
+        if (!workers[n]) {
+            roc_log(LogError, "can't allocate worker");
+            consumer.join();
+            return false;
+        }
+        worker_ptrs[n] = workers[n].get();
+    }
+
+    const bool ok = run_workers(allocator, worker_ptrs, n_threads, go,
+                                n_threads * n_ops, pin_core, result);
+
+    // outside of the measured interval: when the producers are done, the
+    // consumer only has to drain what is already in the queue
+    consumer.join();
+
+    return ok;
+}
+
+bool bench_refcount(core::IAllocator& allocator,
+                    size_t n_threads,
+                    size_t n_ops,
+                    int pin_core,
+                    BenchResult& result) {
+    CountedObject object;
+    core::SharedPtr<CountedObject> base_ref(&object);
+    core::Atomic go;
+
+    core::UniquePtr<RefcountWorker> workers[MaxWorkers];
+    Worker* worker_ptrs[MaxWorkers];
+
+    for (size_t n = 0; n < n_threads; n++) {
+        workers[n].reset(new (allocator) RefcountWorker(allocator, go, n_ops, object),
+                         allocator);
+        if (!workers[n]) {
+            roc_log(LogError, "can't allocate worker");
+            return false;
+        }
+        worker_ptrs[n] = workers[n].get();
+    }
+
+    return run_workers(allocator, worker_ptrs, n_threads, go, n_threads * n_ops,
+                       pin_core, result);
+}
+
+bool bench_tasks(core::IAllocator& allocator,
+                 size_t n_threads,
+                 size_t n_ops,
+                 int pin_core,
+                 BenchResult& result) {
+    packet::PacketPool packet_pool(allocator, false);
+    core::BufferPool<uint8_t> byte_buffer_pool(allocator, TasksMaxPacketSize, false);
+
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    if (!trx.valid()) {
+        roc_log(LogError, "can't create transceiver");
+        return false;
+    }
+
+    core::Atomic go;
+
+    core::UniquePtr<TasksWorker> workers[MaxWorkers];
+    Worker* worker_ptrs[MaxWorkers];
+
+    for (size_t n = 0; n < n_threads; n++) {
+        workers[n].reset(new (allocator) TasksWorker(allocator, go, n_ops, trx),
+                         allocator);
+        if (!workers[n]) {
+            roc_log(LogError, "can't allocate worker");
+            return false;
+        }
+        worker_ptrs[n] = workers[n].get();
+    }
+
+    return run_workers(allocator, worker_ptrs, n_threads, go, n_threads * n_ops,
+                       pin_core, result);
+}
+
+bool parse_size_list(const char* str, size_t* out, size_t max_len, size_t& out_len) {
+    out_len = 0;
+
+    while (*str) {
+        if (out_len == max_len) {
+            return false;
+        }
+
+        char* end = NULL;
+        const long value = strtol(str, &end, 10);
+
+        if (end == str || value <= 0) {
+            return false;
+        }
+        out[out_len++] = (size_t)value;
+
+        str = end;
+        if (*str == ',') {
+            str++;
+        } else if (*str) {
+            return false;
+        }
+    }
+
+    return out_len != 0;
+}
+
+typedef bool (*bench_fn)(
+    core::IAllocator&, size_t, size_t, int, BenchResult&);
+
+struct BenchEntry {
+    const char* name;
+    bench_fn fn;
+};
+
+const BenchEntry BenchTable[] = {
+    { "pool", bench_pool },
+    { "queue", bench_queue },
+    { "refcount", bench_refcount },
+    { "tasks", bench_tasks },
+};
+
+bool parse_bench_list(const char* str,
+                      const BenchEntry** out,
+                      size_t max_len,
+                      size_t& out_len) {
+    out_len = 0;
+
+    while (*str) {
+        if (out_len == max_len) {
+            return false;
+        }
+
+        const char* end = strchr(str, ',');
+        const size_t len = end ? (size_t)(end - str) : strlen(str);
+
+        const BenchEntry* entry = NULL;
+        for (size_t n = 0; n < ROC_ARRAY_SIZE(BenchTable); n++) {
+            if (strlen(BenchTable[n].name) == len
+                && memcmp(BenchTable[n].name, str, len) == 0) {
+                entry = &BenchTable[n];
+                break;
+            }
+        }
+        if (!entry) {
+            return false;
+        }
+        out[out_len++] = entry;
+
+        str = end ? end + 1 : str + len;
+    }
+
+    return out_len != 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    const BenchEntry* benches[MaxSweepValues];
+    size_t n_benches = 0;
+    if (!parse_bench_list(args.benches_arg, benches, MaxSweepValues, n_benches)) {
+        roc_log(LogError, "invalid --benches: %s", args.benches_arg);
+        return 1;
+    }
+
+    size_t thread_counts[MaxSweepValues];
+    size_t n_thread_counts = 0;
+    if (!parse_size_list(args.threads_arg, thread_counts, MaxSweepValues,
+                         n_thread_counts)) {
+        roc_log(LogError, "invalid --threads: %s", args.threads_arg);
+        return 1;
+    }
+    for (size_t n = 0; n < n_thread_counts; n++) {
+        if (thread_counts[n] > MaxWorkers) {
+            roc_log(LogError, "invalid --threads: should be <= %d", (int)MaxWorkers);
+            return 1;
+        }
+    }
+
+    if (args.ops_arg <= 0) {
+        roc_log(LogError, "invalid --ops: should be > 0");
+        return 1;
+    }
+    const size_t n_ops = (size_t)args.ops_arg;
+
+    int pin_core = -1;
+    if (args.pin_given) {
+        if (args.pin_arg < 0) {
+            roc_log(LogError, "invalid --pin: should be >= 0");
+            return 1;
+        }
+        pin_core = args.pin_arg;
+    }
+
+    core::HeapAllocator allocator;
+
+    printf("bench,threads,ops_per_thread,total_ops,ops_per_sec,p50_ns,p90_ns,p99_ns,"
+           "max_ns\n");
+
+    for (size_t b = 0; b < n_benches; b++) {
+        for (size_t t = 0; t < n_thread_counts; t++) {
+            size_t bench_ops = n_ops;
+            if (benches[b]->fn == bench_tasks) {
+                bench_ops = (n_ops + TasksOpDivisor - 1) / TasksOpDivisor;
+            }
+
+            roc_log(LogInfo, "benchmarking: bench=%s threads=%lu ops=%lu",
+                    benches[b]->name, (unsigned long)thread_counts[t],
+                    (unsigned long)bench_ops);
+
+            BenchResult result;
+            if (!benches[b]->fn(allocator, thread_counts[t], bench_ops, pin_core,
+                                result)) {
+                roc_log(LogError, "skipping point: benchmark failed");
+                continue;
+            }
+
+            printf("%s,%lu,%lu,%lu,%.0f,%lld,%lld,%lld,%lld\n", benches[b]->name,
+                   (unsigned long)thread_counts[t], (unsigned long)bench_ops,
+                   (unsigned long)(thread_counts[t] * bench_ops), result.ops_per_sec,
+                   (long long)result.p50, (long long)result.p90, (long long)result.p99,
+                   (long long)result.max);
+            fflush(stdout);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/helpers.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/random.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/time.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_packet/fec_scheme_to_str.h"
+#include "roc_packet/impairment_writer.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+
+#include "roc_bench_fec/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+enum { MaxSweepValues = 16, MaxBlockLength = 256, MaxPayloadSize = 4096 };
+
+// Schemes to sweep; schemes whose codec is not built in are skipped.
+const packet::FECScheme SweepSchemes[] = {
+    packet::FEC_ReedSolomon_M8,
+    packet::FEC_LDPC_Staircase,
+    packet::FEC_XOR,
+    packet::FEC_RLC,
+};
+
+// Collects the packets that survived the impairment writer, so that the
+// loss pattern of a block can be recovered by pointer comparison.
+class CollectWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    CollectWriter()
+        : n_packets_(0) {
+    }
+
+    void clear() {
+        for (size_t n = 0; n < n_packets_; n++) {
+            packets_[n] = NULL;
+        }
+        n_packets_ = 0;
+    }
+
+    virtual void write(const packet::PacketPtr& packet) {
+        if (n_packets_ == MaxBlockLength * 2) {
+            roc_panic("bench: unexpected number of delivered packets");
+        }
+        packets_[n_packets_++] = packet;
+    }
+
+    bool contains(const packet::PacketPtr& packet) const {
+        for (size_t n = 0; n < n_packets_; n++) {
+            if (packets_[n] == packet) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    packet::PacketPtr packets_[MaxBlockLength * 2];
+    size_t n_packets_;
+};
+
+// Results of one sweep point, accumulated over all blocks.
+struct PointResults {
+    uint64_t enc_ns;
+    uint64_t dec_ns;
+
+    size_t n_packets;
+    size_t n_lost;
+
+    size_t n_lost_source;
+    size_t n_repaired_source;
+
+    PointResults()
+        : enc_ns(0)
+        , dec_ns(0)
+        , n_packets(0)
+        , n_lost(0)
+        , n_lost_source(0)
+        , n_repaired_source(0) {
+    }
+};
+
+bool parse_size_list(const char* str, size_t* out, size_t max_len, size_t& out_len) {
+    out_len = 0;
+
+    while (*str) {
+        if (out_len == max_len) {
+            return false;
+        }
+
+        char* end = NULL;
+        const long value = strtol(str, &end, 10);
+
+        if (end == str || value <= 0) {
+            return false;
+        }
+        out[out_len++] = (size_t)value;
+
+        str = end;
+        if (*str == ',') {
+            str++;
+        } else if (*str) {
+            return false;
+        }
+    }
+
+    return out_len != 0;
+}
+
+// Runs all blocks of one sweep point. The impairment writer persists
+// across blocks, so that loss bursts may span block boundaries like they
+// do on a real network. Returns false if the codec rejects the geometry.
+bool bench_point(core::IAllocator& allocator,
+                 core::BufferPool<uint8_t>& buffer_pool,
+                 packet::PacketPool& packet_pool,
+                 const fec::CodecMap& codec_map,
+                 const fec::CodecConfig& config,
+                 const packet::ImpairmentConfig& imp_config,
+                 size_t sblen,
+                 size_t rblen,
+                 size_t payload_size,
+                 size_t n_blocks,
+                 PointResults& results) {
+    core::UniquePtr<fec::IBlockEncoder> encoder(
+        codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+    core::UniquePtr<fec::IBlockDecoder> decoder(
+        codec_map.new_decoder(config, buffer_pool, allocator), allocator);
+
+    if (!encoder || !decoder) {
+        return false;
+    }
+
+    if (sblen + rblen > encoder->max_block_length()
+        || sblen + rblen > decoder->max_block_length()) {
+        return false;
+    }
+
+    CollectWriter collector;
+    packet::ImpairmentWriter network(collector, packet_pool, imp_config);
+
+    core::Slice<uint8_t> buffers[MaxBlockLength];
+    packet::PacketPtr packets[MaxBlockLength];
+    bool received[MaxBlockLength];
+
+    for (size_t block = 0; block < n_blocks; block++) {
+        for (size_t i = 0; i < sblen + rblen; i++) {
+            buffers[i] = new (buffer_pool) core::Buffer<uint8_t>(buffer_pool);
+            if (!buffers[i]) {
+                roc_log(LogError, "can't allocate buffer");
+                return false;
+            }
+            buffers[i].resize(payload_size);
+
+            if (i < sblen) {
+                for (size_t n = 0; n < payload_size; n++) {
+                    buffers[i].data()[n] = (uint8_t)core::random(0, 0xff);
+                }
+            }
+        }
+
+        { // encode
+            const core::nanoseconds_t started = core::timestamp();
+
+            if (!encoder->begin(sblen, rblen, payload_size)) {
+                return false;
+            }
+            for (size_t i = 0; i < sblen + rblen; i++) {
+                encoder->set(i, buffers[i]);
+            }
+            encoder->fill();
+            encoder->end();
+
+            results.enc_ns += (uint64_t)(core::timestamp() - started);
+        }
+
+        // pass one blank packet per symbol through the loss model and
+        // recover the loss pattern from the survivors
+        collector.clear();
+
+        for (size_t i = 0; i < sblen + rblen; i++) {
+            packets[i] = new (packet_pool) packet::Packet(packet_pool);
+            if (!packets[i]) {
+                roc_log(LogError, "can't allocate packet");
+                return false;
+            }
+            network.write(packets[i]);
+        }
+
+        size_t n_lost_source = 0;
+
+        for (size_t i = 0; i < sblen + rblen; i++) {
+            received[i] = collector.contains(packets[i]);
+            if (!received[i]) {
+                results.n_lost++;
+                if (i < sblen) {
+                    n_lost_source++;
+                }
+            }
+            results.n_packets++;
+        }
+
+        results.n_lost_source += n_lost_source;
+
+        { // decode
+            const core::nanoseconds_t started = core::timestamp();
+
+            if (!decoder->begin(sblen, rblen, payload_size)) {
+                return false;
+            }
+            for (size_t i = 0; i < sblen + rblen; i++) {
+                if (received[i]) {
+                    decoder->set(i, buffers[i]);
+                }
+            }
+
+            size_t n_repaired = 0;
+
+            for (size_t i = 0; i < sblen; i++) {
+                if (!received[i] && decoder->repair(i)) {
+                    n_repaired++;
+                }
+            }
+            decoder->end();
+
+            results.dec_ns += (uint64_t)(core::timestamp() - started);
+            results.n_repaired_source += n_repaired;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    size_t sblens[MaxSweepValues];
+    size_t n_sblens = 0;
+    if (!parse_size_list(args.sblens_arg, sblens, MaxSweepValues, n_sblens)) {
+        roc_log(LogError, "invalid --sblens: %s", args.sblens_arg);
+        return 1;
+    }
+
+    size_t rblens[MaxSweepValues];
+    size_t n_rblens = 0;
+    if (!parse_size_list(args.rblens_arg, rblens, MaxSweepValues, n_rblens)) {
+        roc_log(LogError, "invalid --rblens: %s", args.rblens_arg);
+        return 1;
+    }
+
+    if (args.payload_size_arg <= 0 || args.payload_size_arg > MaxPayloadSize) {
+        roc_log(LogError, "invalid --payload-size: should be in range [1; %d]",
+                MaxPayloadSize);
+        return 1;
+    }
+    const size_t payload_size = (size_t)args.payload_size_arg;
+
+    if (args.blocks_arg <= 0) {
+        roc_log(LogError, "invalid --blocks: should be > 0");
+        return 1;
+    }
+    const size_t n_blocks = (size_t)args.blocks_arg;
+
+    packet::ImpairmentConfig imp_config;
+    imp_config.seed = (uint32_t)args.seed_arg;
+    imp_config.loss_rate = args.loss_rate_arg;
+    imp_config.burst_enter_rate = args.burst_enter_arg;
+    imp_config.burst_exit_rate = args.burst_exit_arg;
+    imp_config.burst_loss_rate = args.burst_loss_arg;
+
+    core::HeapAllocator allocator;
+    core::BufferPool<uint8_t> buffer_pool(allocator, payload_size, false);
+    packet::PacketPool packet_pool(allocator, false);
+
+    fec::CodecMap codec_map;
+
+    printf("scheme,sblen,rblen,payload_size,overhead_pct,enc_us_per_block,"
+           "dec_us_per_block,loss_pct,residual_loss_pct\n");
+
+    for (size_t s = 0; s < ROC_ARRAY_SIZE(SweepSchemes); s++) {
+        fec::CodecConfig config;
+        config.scheme = SweepSchemes[s];
+
+        { // probe once per scheme, so that a missing codec is reported once
+            core::UniquePtr<fec::IBlockEncoder> probe(
+                codec_map.new_encoder(config, buffer_pool, allocator), allocator);
+            if (!probe) {
+                roc_log(LogInfo, "skipping %s: no codec available",
+                        packet::fec_scheme_to_str(config.scheme));
+                continue;
+            }
+        }
+
+        for (size_t sb = 0; sb < n_sblens; sb++) {
+            for (size_t rb = 0; rb < n_rblens; rb++) {
+                if (config.scheme == packet::FEC_XOR && rblens[rb] != 1) {
+                    // the scheme supports exactly one repair packet
+                    continue;
+                }
+
+                if (sblens[sb] + rblens[rb] > MaxBlockLength) {
+                    roc_log(LogError, "skipping point: block too long: sblen=%lu"
+                            " rblen=%lu",
+                            (unsigned long)sblens[sb], (unsigned long)rblens[rb]);
+                    continue;
+                }
+
+                roc_log(LogInfo, "benchmarking: scheme=%s sblen=%lu rblen=%lu",
+                        packet::fec_scheme_to_str(config.scheme),
+                        (unsigned long)sblens[sb], (unsigned long)rblens[rb]);
+
+                PointResults results;
+
+                if (!bench_point(allocator, buffer_pool, packet_pool, codec_map,
+                                 config, imp_config, sblens[sb], rblens[rb],
+                                 payload_size, n_blocks, results)) {
+                    roc_log(LogError, "skipping point: codec rejected geometry");
+                    continue;
+                }
+
+                printf("%s,%lu,%lu,%lu,%.1f,%.1f,%.1f,%.2f,%.2f\n",
+                       packet::fec_scheme_to_str(config.scheme),
+                       (unsigned long)sblens[sb], (unsigned long)rblens[rb],
+                       (unsigned long)payload_size,
+                       (double)rblens[rb] / (double)sblens[sb] * 100,
+                       (double)results.enc_ns / (double)n_blocks / 1000,
+                       (double)results.dec_ns / (double)n_blocks / 1000,
+                       (double)results.n_lost / (double)results.n_packets * 100,
+                       (double)(results.n_lost_source - results.n_repaired_source)
+                           / (double)(n_blocks * sblens[sb]) * 100);
+                fflush(stdout);
+            }
+        }
+    }
+
+    return 0;
+}
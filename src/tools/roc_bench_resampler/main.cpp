@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "roc_audio/frame.h"
+#include "roc_audio/ireader.h"
+#include "roc_audio/resampler_reader.h"
+#include "roc_audio/units.h"
+#include "roc_core/array.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/helpers.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/time.h"
+
+#include "roc_bench_resampler/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+enum { MaxSweepValues = 16, WarmupFrames = 4, MeasureFrames = 8 };
+
+// Fractions of the usable band at which the quality tones are placed.
+const double TestToneFractions[] = { 0.2, 0.5, 0.8 };
+
+// Generates an endless mono sine tone with the given normalized frequency
+// (cycles per sample).
+class ToneReader : public audio::IReader, public core::NonCopyable<> {
+public:
+    explicit ToneReader(double freq)
+        : freq_(freq)
+        , pos_(0) {
+    }
+
+    virtual void read(audio::Frame& frame) {
+        for (size_t n = 0; n < frame.size(); n++) {
+            frame.data()[n] =
+                (audio::sample_t)sin(2 * M_PI * freq_ * (double)pos_++);
+        }
+    }
+
+private:
+    const double freq_;
+    unsigned long pos_;
+};
+
+// Least-squares fits a sinusoid with the given normalized frequency to the
+// buffer and returns the ratio of the fitted power to the residual power,
+// in decibels.
+double tone_snr(const audio::sample_t* buf, size_t len, double freq) {
+    double sin_corr = 0, cos_corr = 0;
+
+    for (size_t n = 0; n < len; n++) {
+        const double ph = 2 * M_PI * freq * (double)n;
+        sin_corr += (double)buf[n] * sin(ph);
+        cos_corr += (double)buf[n] * cos(ph);
+    }
+
+    const double a = 2 * sin_corr / (double)len;
+    const double b = 2 * cos_corr / (double)len;
+
+    double signal = 0, noise = 0;
+
+    for (size_t n = 0; n < len; n++) {
+        const double ph = 2 * M_PI * freq * (double)n;
+        const double fit = a * sin(ph) + b * cos(ph);
+
+        signal += fit * fit;
+        noise += ((double)buf[n] - fit) * ((double)buf[n] - fit);
+    }
+
+    if (noise < 1e-12) {
+        noise = 1e-12;
+    }
+
+    return 10 * log10(signal / noise);
+}
+
+bool parse_double_list(const char* str, double* out, size_t max_len, size_t& out_len) {
+    out_len = 0;
+
+    while (*str) {
+        if (out_len == max_len) {
+            return false;
+        }
+
+        char* end = NULL;
+        out[out_len] = strtod(str, &end);
+
+        if (end == str || out[out_len] <= 0) {
+            return false;
+        }
+        out_len++;
+
+        str = end;
+        if (*str == ',') {
+            str++;
+        } else if (*str) {
+            return false;
+        }
+    }
+
+    return out_len != 0;
+}
+
+bool parse_size_list(const char* str, size_t* out, size_t max_len, size_t& out_len) {
+    double values[MaxSweepValues];
+
+    if (!parse_double_list(str, values, max_len, out_len)) {
+        return false;
+    }
+
+    for (size_t n = 0; n < out_len; n++) {
+        out[n] = (size_t)values[n];
+        if ((double)out[n] != values[n]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Measures throughput and worst-case tone SNR for one sweep point. Returns
+// false if the resampler rejects the configuration or the ratio.
+bool bench_point(core::IAllocator& allocator,
+                 core::BufferPool<audio::sample_t>& buffer_pool,
+                 const audio::ResamplerConfig& config,
+                 double ratio,
+                 size_t frame_size,
+                 size_t n_frames,
+                 double& samples_per_sec,
+                 double& snr_db) {
+    core::Array<audio::sample_t> out_buf(allocator);
+    if (!out_buf.resize(frame_size * MeasureFrames)) {
+        roc_log(LogError, "can't allocate output buffer");
+        return false;
+    }
+
+    { // throughput: time a long run of reads on a mid-band tone
+        ToneReader tone(0.05);
+
+        audio::ResamplerReader resampler(tone, buffer_pool, allocator, config, 0x1,
+                                         frame_size);
+        if (!resampler.valid() || !resampler.set_scaling((float)ratio)) {
+            return false;
+        }
+
+        audio::Frame frame(&out_buf[0], frame_size);
+
+        const core::nanoseconds_t started = core::timestamp();
+
+        for (size_t n = 0; n < n_frames; n++) {
+            resampler.read(frame);
+        }
+
+        const core::nanoseconds_t elapsed = core::timestamp() - started;
+
+        samples_per_sec = (double)(frame_size * n_frames)
+            / ((double)elapsed / (double)core::Second);
+    }
+
+    // quality: the worst SNR across tones spread over the usable band;
+    // a tone at input frequency f appears at f * ratio in the output, so
+    // both ends of the conversion constrain the highest test frequency
+    const double max_freq = 0.4 / (ratio > 1 ? ratio : 1);
+
+    snr_db = 0;
+
+    for (size_t n = 0; n < ROC_ARRAY_SIZE(TestToneFractions); n++) {
+        const double freq = max_freq * TestToneFractions[n];
+
+        ToneReader tone(freq);
+
+        audio::ResamplerReader resampler(tone, buffer_pool, allocator, config, 0x1,
+                                         frame_size);
+        if (!resampler.valid() || !resampler.set_scaling((float)ratio)) {
+            return false;
+        }
+
+        audio::Frame frame(&out_buf[0], frame_size);
+
+        for (size_t i = 0; i < WarmupFrames; i++) {
+            resampler.read(frame);
+        }
+
+        for (size_t i = 0; i < MeasureFrames; i++) {
+            audio::Frame chunk(&out_buf[0] + i * frame_size, frame_size);
+            resampler.read(chunk);
+        }
+
+        const double snr =
+            tone_snr(&out_buf[0], out_buf.size(), freq * ratio);
+
+        if (n == 0 || snr < snr_db) {
+            snr_db = snr;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    if (args.rate_arg <= 0) {
+        roc_log(LogError, "invalid --rate: should be > 0");
+        return 1;
+    }
+
+    if (args.frame_size_arg <= 0) {
+        roc_log(LogError, "invalid --frame-size: should be > 0");
+        return 1;
+    }
+    const size_t frame_size = (size_t)args.frame_size_arg;
+
+    if (args.frames_arg <= 0) {
+        roc_log(LogError, "invalid --frames: should be > 0");
+        return 1;
+    }
+    const size_t n_frames = (size_t)args.frames_arg;
+
+    double ratios[MaxSweepValues];
+    size_t n_ratios = 0;
+    if (!parse_double_list(args.ratios_arg, ratios, MaxSweepValues, n_ratios)) {
+        roc_log(LogError, "invalid --ratios: %s", args.ratios_arg);
+        return 1;
+    }
+
+    size_t window_sizes[MaxSweepValues];
+    size_t n_window_sizes = 0;
+    if (!parse_size_list(args.window_sizes_arg, window_sizes, MaxSweepValues,
+                         n_window_sizes)) {
+        roc_log(LogError, "invalid --window-sizes: %s", args.window_sizes_arg);
+        return 1;
+    }
+
+    size_t window_interps[MaxSweepValues];
+    size_t n_window_interps = 0;
+    if (!parse_size_list(args.window_interps_arg, window_interps, MaxSweepValues,
+                         n_window_interps)) {
+        roc_log(LogError, "invalid --window-interps: %s", args.window_interps_arg);
+        return 1;
+    }
+
+    core::HeapAllocator allocator;
+    core::BufferPool<audio::sample_t> buffer_pool(allocator, frame_size, false);
+
+    printf("window_size,window_interp,int16_table,ratio,samples_per_sec,snr_db\n");
+
+    for (size_t ws = 0; ws < n_window_sizes; ws++) {
+        for (size_t wi = 0; wi < n_window_interps; wi++) {
+            for (int q16 = 0; q16 <= (args.int16_tables_flag ? 1 : 0); q16++) {
+                for (size_t r = 0; r < n_ratios; r++) {
+                    audio::ResamplerConfig config;
+                    config.window_size = window_sizes[ws];
+                    config.window_interp = window_interps[wi];
+                    config.int16_table = (q16 != 0);
+
+                    roc_log(LogInfo,
+                            "benchmarking: window_size=%lu window_interp=%lu"
+                            " int16_table=%d ratio=%f",
+                            (unsigned long)config.window_size,
+                            (unsigned long)config.window_interp, q16, ratios[r]);
+
+                    double samples_per_sec = 0;
+                    double snr_db = 0;
+
+                    if (!bench_point(allocator, buffer_pool, config, ratios[r],
+                                     frame_size, n_frames, samples_per_sec, snr_db)) {
+                        roc_log(LogError,
+                                "skipping point: resampler rejected configuration");
+                        continue;
+                    }
+
+                    printf("%lu,%lu,%d,%.6f,%.0f,%.2f\n",
+                           (unsigned long)config.window_size,
+                           (unsigned long)config.window_interp, q16, ratios[r],
+                           samples_per_sec, snr_db);
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
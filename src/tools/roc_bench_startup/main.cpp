@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/buffer_pool.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/parse_duration.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/slice.h"
+#include "roc_core/time.h"
+#include "roc_core/unique_ptr.h"
+#include "roc_fec/codec_map.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/address.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_pipeline/receiver.h"
+#include "roc_pipeline/sender.h"
+#include "roc_rtp/format_map.h"
+#include "roc_sndio/backend_dispatcher.h"
+#include "roc_sndio/isink.h"
+
+#include "roc_bench_startup/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+enum {
+    MaxPacketSize = 2048,
+
+    // Matches the pre-faulting done by roc-recv in real-time mode, so the
+    // pools phase reflects the startup cost a deployment actually pays.
+    PoolPrealloc = 64,
+
+};
+
+// Upper bound on the wall-clock time spent waiting for session admission
+// or for the first audible frame. Reaching it means the pipeline never
+// went audible and the run is reported as failed instead of spinning
+// forever.
+const core::nanoseconds_t MaxPhaseTime = 10 * core::Second;
+
+// Per-phase cold-start timings of a single run, in nanoseconds. The
+// phases are consecutive, so their sum is the full time from "process
+// decided to start" to the first audible frame leaving the pipeline.
+struct RunTimes {
+    core::nanoseconds_t pools;
+    core::nanoseconds_t output;
+    core::nanoseconds_t pipeline;
+    core::nanoseconds_t netio;
+    core::nanoseconds_t bind;
+    core::nanoseconds_t session;
+    core::nanoseconds_t prefill;
+
+    RunTimes()
+        : pools(0)
+        , output(0)
+        , pipeline(0)
+        , netio(0)
+        , bind(0)
+        , session(0)
+        , prefill(0) {
+    }
+
+    core::nanoseconds_t total() const {
+        return pools + output + pipeline + netio + bind + session + prefill;
+    }
+};
+
+// Performs one complete cold start: construct the pools, optionally open
+// the output sink, build the receiver pipeline, start the network thread,
+// bind a port, and then drive packets from a local sender pipeline over
+// loopback UDP until the receiver produces its first non-silent frame.
+//
+// The sender-side setup is deliberately excluded from the measured
+// intervals: it stands in for the remote peer, which in a real deployment
+// is already streaming when the receiver starts.
+bool run_once(const gengetopt_args_info& args,
+              const pipeline::ReceiverConfig& receiver_config,
+              RunTimes& times) {
+    core::HeapAllocator allocator;
+
+    fec::CodecMap codec_map;
+    rtp::FormatMap format_map;
+
+    pipeline::ReceiverConfig config = receiver_config;
+
+    core::nanoseconds_t started = core::timestamp();
+
+    core::BufferPool<uint8_t> byte_buffer_pool(allocator, MaxPacketSize, false);
+    core::BufferPool<audio::sample_t> sample_buffer_pool(
+        allocator, config.common.internal_frame_size, false);
+    packet::PacketPool packet_pool(allocator, false);
+
+    if (!byte_buffer_pool.reserve(PoolPrealloc)
+        || !sample_buffer_pool.reserve(PoolPrealloc)
+        || !packet_pool.reserve(PoolPrealloc)) {
+        roc_log(LogError, "can't preallocate pools");
+        return false;
+    }
+
+    times.pools = core::timestamp() - started;
+
+    // The sink is opened and probed, but not pumped: the remaining phases
+    // read frames directly, so that the measurement doesn't depend on the
+    // output device clock.
+    core::UniquePtr<sndio::ISink> sink;
+
+    if (args.output_given) {
+        sndio::Config sink_config;
+        sink_config.channels = config.common.output_channels;
+        sink_config.frame_size = config.common.internal_frame_size;
+        sink_config.sample_rate =
+            args.rate_given ? (size_t)args.rate_arg : config.common.output_sample_rate;
+
+        started = core::timestamp();
+
+        sink.reset(sndio::BackendDispatcher::instance().open_sink(
+                       allocator, args.driver_given ? args.driver_arg : NULL,
+                       args.output_arg, sink_config),
+                   allocator);
+        if (!sink) {
+            roc_log(LogError, "can't open output file or device: driver=%s output=%s",
+                    args.driver_given ? args.driver_arg : "(null)", args.output_arg);
+            return false;
+        }
+
+        times.output = core::timestamp() - started;
+
+        if (sink->sample_rate() != 0) {
+            config.common.output_sample_rate = sink->sample_rate();
+        }
+    }
+
+    started = core::timestamp();
+
+    pipeline::Receiver receiver(config, codec_map, format_map, packet_pool,
+                                byte_buffer_pool, sample_buffer_pool, allocator);
+    if (!receiver.valid()) {
+        roc_log(LogError, "can't create receiver pipeline");
+        return false;
+    }
+
+    times.pipeline = core::timestamp() - started;
+
+    started = core::timestamp();
+
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    if (!trx.valid()) {
+        roc_log(LogError, "can't create network transceiver");
+        return false;
+    }
+
+    times.netio = core::timestamp() - started;
+
+    started = core::timestamp();
+
+    pipeline::PortConfig recv_port;
+    recv_port.protocol = pipeline::Proto_RTP;
+    recv_port.address.set_ipv4("127.0.0.1", 0);
+
+    if (!trx.add_udp_receiver(recv_port.address, receiver)) {
+        roc_log(LogError, "can't bind receiver port");
+        return false;
+    }
+
+    if (!receiver.add_port(recv_port)) {
+        roc_log(LogError, "can't initialize receiver port");
+        return false;
+    }
+
+    times.bind = core::timestamp() - started;
+
+    // unmeasured: the remote peer
+    packet::Address sender_addr;
+    sender_addr.set_ipv4("127.0.0.1", 0);
+
+    packet::IWriter* udp_sender = trx.add_udp_sender(sender_addr);
+    if (!udp_sender) {
+        roc_log(LogError, "can't create udp sender");
+        return false;
+    }
+
+    pipeline::SenderConfig sender_config;
+    sender_config.timing = false;
+    sender_config.resampling = false;
+    sender_config.input_sample_rate = config.common.output_sample_rate;
+    sender_config.input_channels = config.common.output_channels;
+    sender_config.internal_frame_size = config.common.internal_frame_size;
+
+    pipeline::PortConfig repair_port;
+    repair_port.protocol = pipeline::Proto_None;
+
+    pipeline::Sender sender(sender_config, recv_port, *udp_sender, repair_port,
+                            *udp_sender, codec_map, format_map, packet_pool,
+                            byte_buffer_pool, sample_buffer_pool, allocator);
+    if (!sender.valid()) {
+        roc_log(LogError, "can't create sender pipeline");
+        return false;
+    }
+
+    core::Slice<audio::sample_t> in_buf(
+        new (sample_buffer_pool) core::Buffer<audio::sample_t>(sample_buffer_pool));
+    core::Slice<audio::sample_t> out_buf(
+        new (sample_buffer_pool) core::Buffer<audio::sample_t>(sample_buffer_pool));
+
+    if (!in_buf || !out_buf) {
+        roc_log(LogError, "can't allocate frame buffers");
+        return false;
+    }
+
+    in_buf.resize(config.common.internal_frame_size);
+    out_buf.resize(config.common.internal_frame_size);
+
+    for (size_t n = 0; n < in_buf.size(); n++) {
+        in_buf.data()[n] = (audio::sample_t)((float)audio::SampleMax * 0.5f);
+    }
+
+    const size_t n_channels = packet::num_channels(config.common.output_channels);
+
+    const size_t latency_frames = (size_t)((unsigned long long)config.default_session
+                                               .target_latency
+                                           * config.common.output_sample_rate
+                                           / (unsigned long long)core::Second
+                                           * n_channels / in_buf.size())
+        + 1;
+
+    // Session admission: send the first frame of the stream and read until
+    // the receiver creates a session for it. This covers loopback delivery
+    // of the first packets, routing, and session construction including
+    // the resampler initialization.
+    started = core::timestamp();
+
+    {
+        audio::Frame frame(in_buf.data(), in_buf.size());
+        sender.write(frame);
+    }
+
+    size_t frames_sent = 1;
+
+    while (receiver.num_sessions() == 0) {
+        if (core::timestamp() - started > MaxPhaseTime) {
+            roc_log(LogError, "receiver didn't create a session");
+            return false;
+        }
+
+        audio::Frame out_frame(out_buf.data(), out_buf.size());
+        if (!receiver.read(out_frame)) {
+            roc_log(LogError, "can't read frame from receiver");
+            return false;
+        }
+    }
+
+    const core::nanoseconds_t session_at = core::timestamp();
+
+    // Prefill: keep the stream flowing until the session accumulates the
+    // target latency and the silence gives way to the signal.
+    bool audible = false;
+
+    while (!audible) {
+        if (core::timestamp() - session_at > MaxPhaseTime) {
+            roc_log(LogError, "receiver didn't produce an audible frame");
+            return false;
+        }
+
+        if (frames_sent < latency_frames * 2) {
+            audio::Frame in_frame(in_buf.data(), in_buf.size());
+            sender.write(in_frame);
+            frames_sent++;
+        }
+
+        audio::Frame out_frame(out_buf.data(), out_buf.size());
+        if (!receiver.read(out_frame)) {
+            roc_log(LogError, "can't read frame from receiver");
+            return false;
+        }
+
+        for (size_t ns = 0; ns < out_buf.size(); ns++) {
+            if (out_buf.data()[ns] != 0) {
+                audible = true;
+                break;
+            }
+        }
+    }
+
+    times.session = session_at - started;
+    times.prefill = core::timestamp() - session_at;
+
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    if (args.runs_arg <= 0) {
+        roc_log(LogError, "invalid --runs: should be > 0");
+        return 1;
+    }
+    const size_t n_runs = (size_t)args.runs_arg;
+
+    pipeline::ReceiverConfig config;
+
+    config.common.timing = false;
+    config.common.resampling = !args.no_resampling_flag;
+
+    if (args.rate_given) {
+        if (args.rate_arg <= 0) {
+            roc_log(LogError, "invalid --rate: should be > 0");
+            return 1;
+        }
+        config.common.output_sample_rate = (size_t)args.rate_arg;
+    }
+
+    if (args.sess_latency_given) {
+        if (!core::parse_duration(args.sess_latency_arg,
+                                  config.default_session.target_latency)) {
+            roc_log(LogError, "invalid --sess-latency");
+            return 1;
+        }
+        config.default_session.latency_monitor.min_latency =
+            config.default_session.target_latency * pipeline::DefaultMinLatencyFactor;
+        config.default_session.latency_monitor.max_latency =
+            config.default_session.target_latency * pipeline::DefaultMaxLatencyFactor;
+    }
+
+    sndio::BackendDispatcher::instance().set_frame_size(
+        config.common.internal_frame_size);
+
+    printf("run,pools_ns,output_ns,pipeline_ns,netio_ns,bind_ns,session_ns,"
+           "prefill_ns,total_ns\n");
+
+    for (size_t run = 0; run < n_runs; run++) {
+        RunTimes times;
+
+        if (!run_once(args, config, times)) {
+            roc_log(LogError, "startup run %lu failed", (unsigned long)run);
+            return 1;
+        }
+
+        printf("%lu,%lld,%lld,%lld,%lld,%lld,%lld,%lld,%lld\n", (unsigned long)run,
+               (long long)times.pools, (long long)times.output,
+               (long long)times.pipeline, (long long)times.netio,
+               (long long)times.bind, (long long)times.session,
+               (long long)times.prefill, (long long)times.total());
+    }
+
+    return 0;
+}
@@ -13,6 +13,8 @@
 #include "roc_core/log.h"
 #include "roc_core/scoped_destructor.h"
 #include "roc_core/unique_ptr.h"
+#include "roc_core/thread_pool.h"
+#include "roc_pipeline/chunked_converter.h"
 #include "roc_pipeline/converter.h"
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_sndio/print_drivers.h"
@@ -107,6 +109,10 @@ int main(int argc, char** argv) {
     }
 
     switch ((unsigned)args.resampler_profile_arg) {
+    case resampler_profile_arg_ultralow:
+        config.resampler = audio::resampler_profile(audio::ResamplerProfile_UltraLow);
+        break;
+
     case resampler_profile_arg_low:
         config.resampler = audio::resampler_profile(audio::ResamplerProfile_Low);
         break;
@@ -133,6 +139,19 @@ int main(int argc, char** argv) {
     config.resampling = !args.no_resampling_flag;
     config.poisoning = args.poisoning_flag;
 
+    size_t n_jobs = 1;
+    if (args.jobs_given) {
+        if (args.jobs_arg <= 0) {
+            roc_log(LogError, "invalid --jobs: should be > 0");
+            return 1;
+        }
+        n_jobs = (size_t)args.jobs_arg;
+    }
+    if (n_jobs > 1 && !config.resampling) {
+        roc_log(LogInfo, "parallel conversion requires resampling, using one job");
+        n_jobs = 1;
+    }
+
     audio::IWriter* output_writer = NULL;
 
     sndio::Config sink_config;
@@ -156,13 +175,40 @@ int main(int argc, char** argv) {
         output_writer = sink.get();
     }
 
-    pipeline::Converter converter(config, output_writer, pool, allocator);
-    if (!converter.valid()) {
-        roc_log(LogError, "can't create converter pipeline");
-        return 1;
+    core::UniquePtr<core::ThreadPool> thread_pool;
+    core::UniquePtr<pipeline::ChunkedConverter> chunked_converter;
+    core::UniquePtr<pipeline::Converter> converter;
+
+    sndio::ISink* converter_sink = NULL;
+
+    if (n_jobs > 1) {
+        thread_pool.reset(new (allocator) core::ThreadPool(allocator, n_jobs),
+                          allocator);
+        if (!thread_pool || !thread_pool->valid()) {
+            roc_log(LogError, "can't create thread pool");
+            return 1;
+        }
+        chunked_converter.reset(new (allocator) pipeline::ChunkedConverter(
+                                    config, output_writer, *thread_pool, pool,
+                                    allocator),
+                                allocator);
+        if (!chunked_converter || !chunked_converter->valid()) {
+            roc_log(LogError, "can't create converter pipeline");
+            return 1;
+        }
+        converter_sink = chunked_converter.get();
+    } else {
+        converter.reset(new (allocator)
+                            pipeline::Converter(config, output_writer, pool, allocator),
+                        allocator);
+        if (!converter || !converter->valid()) {
+            roc_log(LogError, "can't create converter pipeline");
+            return 1;
+        }
+        converter_sink = converter.get();
     }
 
-    sndio::Pump pump(pool, *source, converter, config.internal_frame_size,
+    sndio::Pump pump(pool, *source, *converter_sink, config.internal_frame_size,
                      sndio::Pump::ModePermanent);
     if (!pump.valid()) {
         roc_log(LogError, "can't create audio pump");
@@ -171,5 +217,9 @@ int main(int argc, char** argv) {
 
     const bool ok = pump.run();
 
+    if (ok && chunked_converter) {
+        chunked_converter->flush();
+    }
+
     return ok ? 0 : 1;
 }
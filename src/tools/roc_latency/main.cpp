@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/array.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/parse_duration.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/iwriter.h"
+#include "roc_pipeline/parse_port.h"
+#include "roc_pipeline/port_utils.h"
+#include "roc_pipeline/receiver.h"
+#include "roc_pipeline/sender.h"
+
+#include "roc_latency/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+// A marker is a short burst of full-scale samples with alternating sign on
+// an otherwise silent stream; it survives lossy hops in the pipeline and is
+// trivially detectable with a threshold on the receiver side.
+enum { MarkerGroups = 16, MaxPendingMarkers = 64 };
+
+const float MarkerAmplitude = 0.9f;
+const float DetectThreshold = 0.45f;
+
+int compare_samples(const void* a, const void* b) {
+    const double lhs = *(const double*)a;
+    const double rhs = *(const double*)b;
+    if (lhs < rhs) {
+        return -1;
+    }
+    if (lhs > rhs) {
+        return 1;
+    }
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    core::HeapAllocator allocator;
+
+    pipeline::PortConfig source_port;
+    if (!pipeline::parse_port(pipeline::Port_AudioSource, args.source_arg,
+                              source_port)) {
+        roc_log(LogError, "can't parse source port: %s", args.source_arg);
+        return 1;
+    }
+
+    pipeline::PortConfig repair_port;
+    if (args.repair_given) {
+        if (!pipeline::parse_port(pipeline::Port_AudioRepair, args.repair_arg,
+                                  repair_port)) {
+            roc_log(LogError, "can't parse repair port: %s", args.repair_arg);
+            return 1;
+        }
+    }
+
+    core::nanoseconds_t marker_interval = 250 * core::Millisecond;
+    if (args.interval_given) {
+        if (!core::parse_duration(args.interval_arg, marker_interval)
+            || marker_interval <= 0) {
+            roc_log(LogError, "invalid --interval");
+            return 1;
+        }
+    }
+
+    core::nanoseconds_t report_interval = 5 * core::Second;
+    if (args.report_given) {
+        if (!core::parse_duration(args.report_arg, report_interval)
+            || report_interval <= 0) {
+            roc_log(LogError, "invalid --report");
+            return 1;
+        }
+    }
+
+    core::nanoseconds_t duration = 0;
+    if (args.duration_given) {
+        if (!core::parse_duration(args.duration_arg, duration)) {
+            roc_log(LogError, "invalid --duration");
+            return 1;
+        }
+    }
+
+    pipeline::SenderConfig sender_config;
+    pipeline::ReceiverConfig receiver_config;
+
+    // the loop below is the only clock: both pipelines run in lockstep, one
+    // frame written and one frame read per tick, so neither should sleep or
+    // resample on its own
+    sender_config.timing = false;
+    sender_config.resampling = false;
+    receiver_config.common.timing = false;
+    receiver_config.common.resampling = false;
+
+    // the stream is silence between markers; a hibernating session would
+    // stop contributing to the output and swallow them
+    receiver_config.default_session.hibernation_frames = 0;
+
+    if (args.rate_given) {
+        if (args.rate_arg <= 0) {
+            roc_log(LogError, "invalid --rate: should be > 0");
+            return 1;
+        }
+        sender_config.input_sample_rate = (size_t)args.rate_arg;
+        receiver_config.common.output_sample_rate = (size_t)args.rate_arg;
+    }
+
+    if (args.sess_latency_given) {
+        if (!core::parse_duration(args.sess_latency_arg,
+                                  receiver_config.default_session.target_latency)) {
+            roc_log(LogError, "invalid --sess-latency");
+            return 1;
+        }
+        receiver_config.default_session.latency_monitor.min_latency =
+            receiver_config.default_session.target_latency
+            * pipeline::DefaultMinLatencyFactor;
+        receiver_config.default_session.latency_monitor.max_latency =
+            receiver_config.default_session.target_latency
+            * pipeline::DefaultMaxLatencyFactor;
+    }
+
+    sender_config.fec_encoder.scheme = pipeline::port_fec_scheme(source_port.protocol);
+
+    if (args.nbsrc_given) {
+        if (sender_config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--nbsrc can't be used when fec is disabled");
+            return 1;
+        }
+        if (args.nbsrc_arg <= 0) {
+            roc_log(LogError, "invalid --nbsrc: should be > 0");
+            return 1;
+        }
+        sender_config.fec_writer.n_source_packets = (size_t)args.nbsrc_arg;
+    }
+
+    if (args.nbrpr_given) {
+        if (sender_config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--nbrpr can't be used when fec is disabled");
+            return 1;
+        }
+        if (args.nbrpr_arg <= 0) {
+            roc_log(LogError, "invalid --nbrpr: should be > 0");
+            return 1;
+        }
+        sender_config.fec_writer.n_repair_packets = (size_t)args.nbrpr_arg;
+    }
+
+    const size_t sample_rate = sender_config.input_sample_rate;
+    const size_t num_channels = packet::num_channels(sender_config.input_channels);
+    const size_t frame_size = sender_config.internal_frame_size;
+    const size_t frame_groups = frame_size / num_channels;
+
+    const uint64_t marker_step =
+        (uint64_t)((core::nanoseconds_t)sample_rate * marker_interval / core::Second);
+    const uint64_t report_step =
+        (uint64_t)((core::nanoseconds_t)sample_rate * report_interval / core::Second);
+
+    if (marker_step < MarkerGroups * 2) {
+        roc_log(LogError, "invalid --interval: too short for marker length");
+        return 1;
+    }
+
+    // a marker not seen within four target latencies plus a second is lost
+    const uint64_t stale_groups = (uint64_t)((core::nanoseconds_t)sample_rate
+                                             * receiver_config.default_session
+                                                   .target_latency
+                                             / core::Second)
+            * 4
+        + sample_rate;
+
+    const size_t max_packet_size = 2048;
+
+    core::BufferPool<uint8_t> byte_buffer_pool(allocator, max_packet_size, false);
+    core::BufferPool<audio::sample_t> sample_buffer_pool(allocator, frame_size, false);
+    packet::PacketPool packet_pool(allocator, false);
+
+    fec::CodecMap codec_map;
+    rtp::FormatMap format_map;
+
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    if (!trx.valid()) {
+        roc_log(LogError, "can't create network transceiver");
+        return 1;
+    }
+
+    pipeline::Receiver receiver(receiver_config, codec_map, format_map, packet_pool,
+                                byte_buffer_pool, sample_buffer_pool, allocator);
+    if (!receiver.valid()) {
+        roc_log(LogError, "can't create receiver pipeline");
+        return 1;
+    }
+
+    if (!trx.add_udp_receiver(source_port.address, receiver)) {
+        roc_log(LogError, "can't bind source port: %s", args.source_arg);
+        return 1;
+    }
+    if (!receiver.add_port(source_port)) {
+        roc_log(LogError, "can't initialize source port: %s", args.source_arg);
+        return 1;
+    }
+
+    if (args.repair_given) {
+        if (!trx.add_udp_receiver(repair_port.address, receiver)) {
+            roc_log(LogError, "can't bind repair port: %s", args.repair_arg);
+            return 1;
+        }
+        if (!receiver.add_port(repair_port)) {
+            roc_log(LogError, "can't initialize repair port: %s", args.repair_arg);
+            return 1;
+        }
+    }
+
+    packet::Address local_addr;
+    if (source_port.address.version() == 6) {
+        local_addr.set_ipv6("::", 0);
+    } else {
+        local_addr.set_ipv4("0.0.0.0", 0);
+    }
+    if (!local_addr.valid()) {
+        roc_panic("can't initialize local address");
+    }
+
+    packet::IWriter* udp_sender = trx.add_udp_sender(local_addr);
+    if (!udp_sender) {
+        roc_log(LogError, "can't create udp sender");
+        return 1;
+    }
+
+    pipeline::Sender sender(sender_config, source_port, *udp_sender, repair_port,
+                            *udp_sender, codec_map, format_map, packet_pool,
+                            byte_buffer_pool, sample_buffer_pool, allocator);
+    if (!sender.valid()) {
+        roc_log(LogError, "can't create sender pipeline");
+        return 1;
+    }
+
+    core::Array<audio::sample_t> send_samples(allocator);
+    core::Array<audio::sample_t> recv_samples(allocator);
+    if (!send_samples.resize(frame_size) || !recv_samples.resize(frame_size)) {
+        return 1;
+    }
+
+    // latencies recorded since the last report, milliseconds
+    core::Array<double> window(allocator);
+    core::Array<double> sorted(allocator);
+    const size_t window_max = (size_t)(report_step / marker_step) + 2;
+    if (!window.grow(window_max) || !sorted.grow(window_max)) {
+        return 1;
+    }
+
+    roc_log(LogInfo,
+            "starting measurement: rate=%lu interval=%ld ms report=%ld s"
+            " sess_latency=%ld ms",
+            (unsigned long)sample_rate, (long)(marker_interval / core::Millisecond),
+            (long)(report_interval / core::Second),
+            (long)(receiver_config.default_session.target_latency
+                   / core::Millisecond));
+
+    core::Ticker ticker(sample_rate);
+    ticker.start();
+
+    const uint64_t total_groups = duration != 0
+        ? (uint64_t)((core::nanoseconds_t)sample_rate * duration / core::Second)
+        : 0;
+
+    // positions are in sample groups of the lockstep stream clock
+    uint64_t stream_pos = 0;
+    uint64_t next_marker = sample_rate; // let the session settle first
+    uint64_t next_report = report_step;
+    uint64_t refractory_until = 0;
+
+    uint64_t pending[MaxPendingMarkers];
+    size_t pending_head = 0;
+    size_t pending_size = 0;
+
+    unsigned long n_detected = 0;
+    unsigned long n_lost = 0;
+    unsigned long n_spurious = 0;
+
+    double total_min = 0, total_max = 0;
+    bool have_first_median = false;
+    double first_median = 0;
+    uint64_t first_median_pos = 0;
+
+    while (total_groups == 0 || stream_pos < total_groups) {
+        memset(&send_samples[0], 0, frame_size * sizeof(audio::sample_t));
+
+        if (stream_pos + frame_groups > next_marker && stream_pos <= next_marker
+            && pending_size < MaxPendingMarkers) {
+            // place the burst at the start of this frame and remember where
+            // the stream clock stood
+            for (size_t g = 0; g < MarkerGroups; g++) {
+                const audio::sample_t v =
+                    (g % 2) ? -MarkerAmplitude : MarkerAmplitude;
+                for (size_t ch = 0; ch < num_channels; ch++) {
+                    send_samples[g * num_channels + ch] = v;
+                }
+            }
+            pending[(pending_head + pending_size) % MaxPendingMarkers] = stream_pos;
+            pending_size++;
+            next_marker += marker_step;
+        }
+
+        audio::Frame send_frame(&send_samples[0], frame_size);
+        sender.write(send_frame);
+
+        audio::Frame recv_frame(&recv_samples[0], frame_size);
+        receiver.read(recv_frame);
+
+        for (size_t g = 0; g < frame_groups; g++) {
+            const uint64_t pos = stream_pos + g;
+            if (pos < refractory_until) {
+                continue;
+            }
+            audio::sample_t v = recv_samples[g * num_channels];
+            if (v < 0) {
+                v = -v;
+            }
+            if (v < DetectThreshold) {
+                continue;
+            }
+            refractory_until = pos + marker_step / 2;
+
+            if (pending_size == 0) {
+                n_spurious++;
+                continue;
+            }
+
+            const uint64_t sent_pos = pending[pending_head];
+            pending_head = (pending_head + 1) % MaxPendingMarkers;
+            pending_size--;
+
+            const double latency_ms =
+                (double)(pos - sent_pos) * 1000.0 / (double)sample_rate;
+
+            if (n_detected == 0) {
+                total_min = total_max = latency_ms;
+            } else {
+                if (latency_ms < total_min) {
+                    total_min = latency_ms;
+                }
+                if (latency_ms > total_max) {
+                    total_max = latency_ms;
+                }
+            }
+            n_detected++;
+
+            if (window.size() < window_max) {
+                window.push_back(latency_ms);
+            }
+        }
+
+        stream_pos += frame_groups;
+
+        // markers that never showed up in the output
+        while (pending_size != 0 && pending[pending_head] + stale_groups < stream_pos) {
+            pending_head = (pending_head + 1) % MaxPendingMarkers;
+            pending_size--;
+            n_lost++;
+        }
+
+        if (stream_pos >= next_report) {
+            next_report += report_step;
+
+            if (window.size() == 0) {
+                roc_log(LogInfo, "latency: no markers detected, lost=%lu", n_lost);
+            } else {
+                sorted.resize(0);
+                for (size_t n = 0; n < window.size(); n++) {
+                    sorted.push_back(window[n]);
+                }
+                qsort(&sorted[0], sorted.size(), sizeof(double), compare_samples);
+
+                const double cur_min = sorted[0];
+                const double cur_max = sorted[sorted.size() - 1];
+                const double cur_median = sorted[sorted.size() / 2];
+                const double cur_p95 = sorted[sorted.size() * 95 / 100];
+
+                roc_log(LogInfo,
+                        "latency: n=%lu min=%.3f ms med=%.3f ms p95=%.3f ms"
+                        " max=%.3f ms lost=%lu",
+                        (unsigned long)window.size(), cur_min, cur_median, cur_p95,
+                        cur_max, n_lost);
+
+                if (!have_first_median) {
+                    have_first_median = true;
+                    first_median = cur_median;
+                    first_median_pos = stream_pos;
+                } else {
+                    const double elapsed_sec =
+                        (double)(stream_pos - first_median_pos) / (double)sample_rate;
+                    roc_log(LogInfo, "drift: %+.2f us/s (%+.3f ms over %.0f s)",
+                            (cur_median - first_median) * 1000.0 / elapsed_sec,
+                            cur_median - first_median, elapsed_sec);
+                }
+            }
+
+            window.resize(0);
+        }
+
+        ticker.wait(stream_pos);
+    }
+
+    roc_log(LogInfo,
+            "finished: detected=%lu lost=%lu spurious=%lu min=%.3f ms max=%.3f ms",
+            n_detected, n_lost, n_spurious, total_min, total_max);
+
+    return 0;
+}
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <math.h>
+
+#include "roc_core/array.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/parse_duration.h"
+#include "roc_core/random.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/ticker.h"
+#include "roc_core/time.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/iwriter.h"
+#include "roc_pipeline/parse_port.h"
+#include "roc_pipeline/port_utils.h"
+#include "roc_pipeline/sender.h"
+
+#include "roc_loadgen/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+// Applies configurable loss, reorder, and jitter to a packet stream
+// before handing it to the underlying writer.
+class ImpairedWriter : public packet::IWriter, public core::NonCopyable<> {
+public:
+    ImpairedWriter(packet::IWriter& writer,
+                   unsigned loss_percent,
+                   unsigned reorder_percent,
+                   core::nanoseconds_t max_jitter,
+                   core::IAllocator& allocator)
+        : writer_(writer)
+        , loss_percent_(loss_percent)
+        , reorder_percent_(reorder_percent)
+        , max_jitter_(max_jitter)
+        , delayed_(allocator)
+        , n_sent_(0)
+        , n_dropped_(0) {
+    }
+
+    ~ImpairedWriter() {
+        drain();
+    }
+
+    virtual void write(const packet::PacketPtr& packet) {
+        if (loss_percent_ != 0 && core::random(100) < loss_percent_) {
+            n_dropped_++;
+            return;
+        }
+
+        if (max_jitter_ != 0) {
+            unsigned jitter_us = (unsigned)(max_jitter_ / core::Microsecond);
+            if (jitter_us == 0) {
+                jitter_us = 1;
+            }
+            const core::nanoseconds_t delay =
+                (core::nanoseconds_t)core::random(jitter_us) * core::Microsecond;
+
+            Entry entry;
+            entry.packet = packet;
+            entry.deadline = core::timestamp() + delay;
+
+            if (delayed_.size() == delayed_.max_size()) {
+                if (!delayed_.grow(delayed_.max_size() * 2 + 16)) {
+                    roc_log(LogError, "impaired writer: can't grow delay line");
+                    send_(packet);
+                    return;
+                }
+            }
+            delayed_.push_back(entry);
+            return;
+        }
+
+        if (reorder_percent_ != 0 && core::random(100) < reorder_percent_) {
+            if (held_) {
+                // swap the held packet with the current one
+                const packet::PacketPtr prev = held_;
+                held_ = packet;
+                send_(prev);
+            } else {
+                held_ = packet;
+            }
+            return;
+        }
+
+        if (held_) {
+            const packet::PacketPtr prev = held_;
+            held_ = NULL;
+            send_(packet);
+            send_(prev);
+            return;
+        }
+
+        send_(packet);
+    }
+
+    //! Release delayed packets whose deadline has passed.
+    void flush(core::nanoseconds_t now) {
+        for (size_t n = 0; n < delayed_.size();) {
+            if (delayed_[n].deadline <= now) {
+                send_(delayed_[n].packet);
+                delayed_[n] = delayed_.back();
+                delayed_.resize(delayed_.size() - 1);
+            } else {
+                n++;
+            }
+        }
+    }
+
+    //! Release everything that is still held back.
+    void drain() {
+        for (size_t n = 0; n < delayed_.size(); n++) {
+            send_(delayed_[n].packet);
+        }
+        delayed_.resize(0);
+
+        if (held_) {
+            const packet::PacketPtr prev = held_;
+            held_ = NULL;
+            send_(prev);
+        }
+    }
+
+    unsigned long n_sent() const {
+        return n_sent_;
+    }
+
+    unsigned long n_dropped() const {
+        return n_dropped_;
+    }
+
+private:
+    struct Entry {
+        packet::PacketPtr packet;
+        core::nanoseconds_t deadline;
+
+        Entry()
+            : deadline(0) {
+        }
+    };
+
+    void send_(const packet::PacketPtr& packet) {
+        n_sent_++;
+        writer_.write(packet);
+    }
+
+    packet::IWriter& writer_;
+
+    const unsigned loss_percent_;
+    const unsigned reorder_percent_;
+    const core::nanoseconds_t max_jitter_;
+
+    packet::PacketPtr held_;
+    core::Array<Entry> delayed_;
+
+    unsigned long n_sent_;
+    unsigned long n_dropped_;
+};
+
+// Destroys allocator-backed objects collected in an array.
+template <class T> class ArrayDestroyer : public core::NonCopyable<> {
+public:
+    ArrayDestroyer(core::Array<T*>& array, core::IAllocator& allocator)
+        : array_(array)
+        , allocator_(allocator) {
+    }
+
+    ~ArrayDestroyer() {
+        for (size_t n = 0; n < array_.size(); n++) {
+            allocator_.destroy(*array_[n]);
+        }
+        array_.resize(0);
+    }
+
+private:
+    core::Array<T*>& array_;
+    core::IAllocator& allocator_;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    core::HeapAllocator allocator;
+
+    pipeline::PortConfig source_port;
+    if (!pipeline::parse_port(pipeline::Port_AudioSource, args.source_arg,
+                              source_port)) {
+        roc_log(LogError, "can't parse remote source port: %s", args.source_arg);
+        return 1;
+    }
+
+    pipeline::PortConfig repair_port;
+    if (args.repair_given) {
+        if (!pipeline::parse_port(pipeline::Port_AudioRepair, args.repair_arg,
+                                  repair_port)) {
+            roc_log(LogError, "can't parse remote repair port: %s", args.repair_arg);
+            return 1;
+        }
+    }
+
+    if (args.streams_arg <= 0) {
+        roc_log(LogError, "invalid --streams: should be > 0");
+        return 1;
+    }
+    const size_t n_streams = (size_t)args.streams_arg;
+
+    if (args.pps_arg <= 0) {
+        roc_log(LogError, "invalid --pps: should be > 0");
+        return 1;
+    }
+    const size_t pps = (size_t)args.pps_arg;
+
+    core::nanoseconds_t duration = 0;
+    if (args.duration_given) {
+        if (!core::parse_duration(args.duration_arg, duration)) {
+            roc_log(LogError, "invalid --duration");
+            return 1;
+        }
+    }
+
+    if (args.loss_arg < 0 || args.loss_arg > 100) {
+        roc_log(LogError, "invalid --loss: should be in range [0; 100]");
+        return 1;
+    }
+    if (args.reorder_arg < 0 || args.reorder_arg > 100) {
+        roc_log(LogError, "invalid --reorder: should be in range [0; 100]");
+        return 1;
+    }
+
+    core::nanoseconds_t max_jitter = 0;
+    if (args.jitter_given) {
+        if (!core::parse_duration(args.jitter_arg, max_jitter)) {
+            roc_log(LogError, "invalid --jitter");
+            return 1;
+        }
+    }
+
+    pipeline::SenderConfig config;
+
+    config.timing = false;
+    config.resampling = false;
+    config.packet_length = core::Second / (core::nanoseconds_t)pps;
+
+    if (args.rate_given) {
+        if (args.rate_arg <= 0) {
+            roc_log(LogError, "invalid --rate: should be > 0");
+            return 1;
+        }
+        config.input_sample_rate = (size_t)args.rate_arg;
+    }
+
+    config.fec_encoder.scheme = pipeline::port_fec_scheme(source_port.protocol);
+
+    if (args.nbsrc_given) {
+        if (config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--nbsrc can't be used when fec is disabled");
+            return 1;
+        }
+        if (args.nbsrc_arg <= 0) {
+            roc_log(LogError, "invalid --nbsrc: should be > 0");
+            return 1;
+        }
+        config.fec_writer.n_source_packets = (size_t)args.nbsrc_arg;
+    }
+
+    if (args.nbrpr_given) {
+        if (config.fec_encoder.scheme == packet::FEC_None) {
+            roc_log(LogError, "--nbrpr can't be used when fec is disabled");
+            return 1;
+        }
+        if (args.nbrpr_arg <= 0) {
+            roc_log(LogError, "invalid --nbrpr: should be > 0");
+            return 1;
+        }
+        config.fec_writer.n_repair_packets = (size_t)args.nbrpr_arg;
+    }
+
+    const size_t num_channels = packet::num_channels(config.input_channels);
+    const size_t samples_per_tick =
+        config.input_sample_rate / pps * num_channels;
+
+    if (samples_per_tick == 0) {
+        roc_log(LogError, "invalid --pps: higher than sample rate");
+        return 1;
+    }
+
+    const size_t max_packet_size = 2048;
+
+    core::BufferPool<uint8_t> byte_buffer_pool(allocator, max_packet_size, false);
+    core::BufferPool<audio::sample_t> sample_buffer_pool(
+        allocator,
+        samples_per_tick > config.internal_frame_size ? samples_per_tick
+                                                      : config.internal_frame_size,
+        false);
+    packet::PacketPool packet_pool(allocator, false);
+
+    fec::CodecMap codec_map;
+    rtp::FormatMap format_map;
+
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    if (!trx.valid()) {
+        roc_log(LogError, "can't create network transceiver");
+        return 1;
+    }
+
+    core::Array<ImpairedWriter*> impaired_writers(allocator);
+    core::Array<pipeline::Sender*> senders(allocator);
+
+    ArrayDestroyer<pipeline::Sender> senders_destroyer(senders, allocator);
+    ArrayDestroyer<ImpairedWriter> writers_destroyer(impaired_writers, allocator);
+
+    if (!impaired_writers.grow(n_streams) || !senders.grow(n_streams)) {
+        return 1;
+    }
+
+    for (size_t n = 0; n < n_streams; n++) {
+        packet::Address local_addr;
+        if (source_port.address.version() == 6) {
+            local_addr.set_ipv6("::", 0);
+        } else {
+            local_addr.set_ipv4("0.0.0.0", 0);
+        }
+        if (!local_addr.valid()) {
+            roc_panic("can't initialize local address");
+        }
+
+        packet::IWriter* udp_sender = trx.add_udp_sender(local_addr);
+        if (!udp_sender) {
+            roc_log(LogError, "can't create udp sender for stream %lu",
+                    (unsigned long)n);
+            return 1;
+        }
+
+        ImpairedWriter* impaired = new (allocator)
+            ImpairedWriter(*udp_sender, (unsigned)args.loss_arg,
+                           (unsigned)args.reorder_arg, max_jitter, allocator);
+        if (!impaired) {
+            roc_log(LogError, "can't allocate impaired writer");
+            return 1;
+        }
+        impaired_writers.push_back(impaired);
+
+        pipeline::Sender* sender = new (allocator)
+            pipeline::Sender(config, source_port, *impaired, repair_port, *impaired,
+                             codec_map, format_map, packet_pool, byte_buffer_pool,
+                             sample_buffer_pool, allocator);
+        if (!sender) {
+            roc_log(LogError, "can't allocate sender pipeline");
+            return 1;
+        }
+        senders.push_back(sender);
+        if (!sender->valid()) {
+            roc_log(LogError, "can't create sender pipeline for stream %lu",
+                    (unsigned long)n);
+            return 1;
+        }
+    }
+
+    core::Array<audio::sample_t> samples(allocator);
+    if (!samples.resize(samples_per_tick)) {
+        return 1;
+    }
+
+    roc_log(LogInfo,
+            "starting load: streams=%lu pps=%lu loss=%d%% reorder=%d%%"
+            " jitter=%ld usec",
+            (unsigned long)n_streams, (unsigned long)pps, (int)args.loss_arg,
+            (int)args.reorder_arg, (long)(max_jitter / core::Microsecond));
+
+    core::Ticker ticker(pps);
+    ticker.start();
+
+    const uint64_t total_ticks = duration != 0
+        ? (uint64_t)duration * pps / core::Second
+        : 0;
+
+    double phase = 0;
+    unsigned long last_sent = 0;
+    core::nanoseconds_t report_time = core::timestamp();
+
+    for (uint64_t tick = 0; total_ticks == 0 || tick < total_ticks; tick++) {
+        // continuous sine, same content for every stream
+        for (size_t i = 0; i < samples_per_tick; i += num_channels) {
+            const audio::sample_t v = (audio::sample_t)sin(phase);
+            phase += 2 * M_PI * 440 / config.input_sample_rate;
+            for (size_t ch = 0; ch < num_channels; ch++) {
+                samples[i + ch] = v;
+            }
+        }
+
+        for (size_t n = 0; n < n_streams; n++) {
+            audio::Frame frame(&samples[0], samples.size());
+            senders[n]->write(frame);
+        }
+
+        const core::nanoseconds_t now = core::timestamp();
+
+        for (size_t n = 0; n < n_streams; n++) {
+            impaired_writers[n]->flush(now);
+        }
+
+        if (now - report_time >= core::Second) {
+            unsigned long sent = 0, dropped = 0;
+            for (size_t n = 0; n < n_streams; n++) {
+                sent += impaired_writers[n]->n_sent();
+                dropped += impaired_writers[n]->n_dropped();
+            }
+            roc_log(LogInfo,
+                    "rate: %lu pkt/sec, total: sent=%lu dropped=%lu",
+                    (unsigned long)((double)(sent - last_sent) * core::Second
+                                    / (double)(now - report_time)),
+                    sent, dropped);
+            last_sent = sent;
+            report_time = now;
+        }
+
+        ticker.wait(tick + 1);
+    }
+
+    for (size_t n = 0; n < n_streams; n++) {
+        impaired_writers[n]->drain();
+    }
+
+    unsigned long sent = 0, dropped = 0;
+    for (size_t n = 0; n < n_streams; n++) {
+        sent += impaired_writers[n]->n_sent();
+        dropped += impaired_writers[n]->n_dropped();
+    }
+    roc_log(LogInfo, "finished: sent=%lu dropped=%lu", sent, dropped);
+
+    return 0;
+}
@@ -11,8 +11,10 @@
 #include "roc_core/colors.h"
 #include "roc_core/crash.h"
 #include "roc_core/heap_allocator.h"
+#include "roc_core/hugepage_allocator.h"
 #include "roc_core/log.h"
 #include "roc_core/parse_duration.h"
+#include "roc_core/realtime.h"
 #include "roc_core/scoped_destructor.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_netio/transceiver.h"
@@ -60,6 +62,16 @@ int main(int argc, char** argv) {
         break;
     }
 
+    if (args.realtime_flag) {
+        // before any thread is started or any memory is allocated, so that
+        // the threads inherit the scheduling policy and the allocations are
+        // locked into RAM
+        if (!core::enable_realtime()) {
+            roc_log(LogError, "can't enable real-time mode");
+            return 1;
+        }
+    }
+
     core::HeapAllocator allocator;
 
     if (args.list_drivers_given) {
@@ -121,6 +133,16 @@ int main(int argc, char** argv) {
             config.default_session.target_latency * pipeline::DefaultMaxLatencyFactor;
     }
 
+    if (args.adaptive_latency_given) {
+        if (!core::parse_duration(
+                args.adaptive_latency_arg,
+                config.default_session.latency_monitor.min_target_latency)) {
+            roc_log(LogError, "invalid --adaptive-latency");
+            return 1;
+        }
+        config.default_session.latency_monitor.adaptive_latency = true;
+    }
+
     if (args.np_timeout_given) {
         if (!core::parse_duration(args.np_timeout_arg,
                                   config.default_session.watchdog.no_playback_timeout)) {
@@ -148,8 +170,14 @@ int main(int argc, char** argv) {
     }
 
     config.common.resampling = !args.no_resampling_flag;
+    config.common.shared_resampling = args.shared_resampling_flag;
 
     switch ((unsigned)args.resampler_profile_arg) {
+    case resampler_profile_arg_ultralow:
+        config.default_session.resampler =
+            audio::resampler_profile(audio::ResamplerProfile_UltraLow);
+        break;
+
     case resampler_profile_arg_low:
         config.default_session.resampler =
             audio::resampler_profile(audio::ResamplerProfile_Low);
@@ -212,12 +240,31 @@ int main(int argc, char** argv) {
 
     config.common.poisoning = args.poisoning_flag;
     config.common.beeping = args.beeping_flag;
+    config.default_session.redundant_encoding = args.red_flag;
 
-    core::BufferPool<uint8_t> byte_buffer_pool(allocator, max_packet_size,
+    core::HugepageAllocator hugepage_allocator;
+    core::IAllocator& pool_allocator = args.hugepages_flag
+        ? (core::IAllocator&)hugepage_allocator
+        : (core::IAllocator&)allocator;
+
+    core::BufferPool<uint8_t> byte_buffer_pool(pool_allocator, max_packet_size,
                                                args.poisoning_flag);
     core::BufferPool<audio::sample_t> sample_buffer_pool(
-        allocator, config.common.internal_frame_size, args.poisoning_flag);
-    packet::PacketPool packet_pool(allocator, args.poisoning_flag);
+        pool_allocator, config.common.internal_frame_size, args.poisoning_flag);
+    packet::PacketPool packet_pool(pool_allocator, args.poisoning_flag);
+
+    if (args.hugepages_flag || args.realtime_flag) {
+        // pre-fault the steady-state working set at startup, so that pool
+        // chunks are not allocated on the audio path later
+        enum { PoolPrealloc = 64 };
+
+        if (!byte_buffer_pool.reserve(PoolPrealloc)
+            || !sample_buffer_pool.reserve(PoolPrealloc)
+            || !packet_pool.reserve(PoolPrealloc)) {
+            roc_log(LogError, "can't preallocate pools");
+            return 1;
+        }
+    }
 
     core::UniquePtr<sndio::ISink> sink(
         sndio::BackendDispatcher::instance().open_sink(allocator, args.driver_arg,
@@ -251,13 +298,18 @@ int main(int argc, char** argv) {
 
     sndio::Pump pump(
         sample_buffer_pool, receiver, *sink, config.common.internal_frame_size,
-        args.oneshot_flag ? sndio::Pump::ModeOneshot : sndio::Pump::ModePermanent);
+        args.oneshot_flag ? sndio::Pump::ModeOneshot : sndio::Pump::ModePermanent,
+        args.pipelined_flag ? sndio::Pump::ThreadingPipelined
+                            : sndio::Pump::ThreadingSerial,
+        args.adaptive_frames_flag ? sndio::Pump::SizingAdaptive
+                                  : sndio::Pump::SizingFixed);
     if (!pump.valid()) {
         roc_log(LogError, "can't create pump");
         return 1;
     }
 
-    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator,
+                           args.netio_core_given ? args.netio_core_arg : -1);
     if (!trx.valid()) {
         roc_log(LogError, "can't create network transceiver");
         return 1;
@@ -274,7 +326,11 @@ int main(int argc, char** argv) {
             roc_log(LogError, "can't parse source port: %s", args.source_arg[n]);
             return 1;
         }
-        if (!trx.add_udp_receiver(port.address, receiver)) {
+        // repair ports are not RTP-framed, so the kernel filter is
+        // enabled only on source ports
+        if (!trx.add_udp_receiver(port.address, receiver, false,
+                                  args.poll_core_given ? args.poll_core_arg : -1, 0,
+                                  args.kernel_filter_flag)) {
             roc_log(LogError, "can't bind source port: %s", args.source_arg[n]);
             return 1;
         }
@@ -290,7 +346,8 @@ int main(int argc, char** argv) {
             roc_log(LogError, "can't parse repair port: %s", args.repair_arg[n]);
             return 1;
         }
-        if (!trx.add_udp_receiver(port.address, receiver)) {
+        if (!trx.add_udp_receiver(port.address, receiver, false,
+                                  args.poll_core_given ? args.poll_core_arg : -1)) {
             roc_log(LogError, "can't bind repair port: %s", args.repair_arg[n]);
             return 1;
         }
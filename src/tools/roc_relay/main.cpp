@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2019 Roc authors
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "roc_core/array.h"
+#include "roc_core/atomic.h"
+#include "roc_core/buffer_pool.h"
+#include "roc_core/colors.h"
+#include "roc_core/crash.h"
+#include "roc_core/heap_allocator.h"
+#include "roc_core/log.h"
+#include "roc_core/noncopyable.h"
+#include "roc_core/parse_duration.h"
+#include "roc_core/scoped_destructor.h"
+#include "roc_core/time.h"
+#include "roc_netio/transceiver.h"
+#include "roc_packet/address.h"
+#include "roc_packet/address_to_str.h"
+#include "roc_packet/iwriter.h"
+#include "roc_packet/packet_pool.h"
+#include "roc_pipeline/parse_port.h"
+#include "roc_rtp/format_map.h"
+#include "roc_rtp/parser.h"
+
+#include "roc_relay/cmdline.h"
+
+using namespace roc;
+
+namespace {
+
+enum {
+    // Maximum number of distinct streams identified per port; packets of
+    // further streams are still forwarded, just not reported individually.
+    MaxFlows = 16
+};
+
+// Forwards every incoming packet to a list of downstream destinations,
+// without decoding it. Invoked on the network thread; the copies share
+// the payload buffer of the original packet, so a relay hop costs one
+// packet object per destination and no payload copies.
+//
+// If a parser is given (source ports), packets are minimally parsed to
+// identify flows, and packets that don't parse are dropped instead of
+// being multiplied towards the downstream hosts. Repair ports are not
+// RTP-framed and forward everything.
+class RelayWriter : public packet::IWriter, private core::NonCopyable<> {
+public:
+    RelayWriter(const char* name,
+                packet::PacketPool& packet_pool,
+                packet::IParser* parser,
+                core::IAllocator& allocator)
+        : name_(name)
+        , packet_pool_(packet_pool)
+        , parser_(parser)
+        , destinations_(allocator)
+        , n_flows_(0) {
+    }
+
+    bool add_destination(const packet::Address& address, packet::IWriter& writer) {
+        if (destinations_.size() == destinations_.max_size()) {
+            if (!destinations_.grow(destinations_.size() + 1)) {
+                return false;
+            }
+        }
+
+        Destination dest;
+        dest.address = address;
+        dest.writer = &writer;
+
+        destinations_.push_back(dest);
+        return true;
+    }
+
+    virtual void write(const packet::PacketPtr& packet) {
+        n_received_.incr_relaxed();
+
+        if (parser_) {
+            if (!parser_->parse(*packet, packet->data())) {
+                n_dropped_.incr_relaxed();
+                return;
+            }
+            identify_flow_(*packet);
+        }
+
+        for (size_t n = 0; n < destinations_.size(); n++) {
+            packet::PacketPtr pp = new (packet_pool_) packet::Packet(packet_pool_);
+            if (!pp) {
+                roc_log(LogError, "relay: %s: can't allocate packet", name_);
+                n_dropped_.incr_relaxed();
+                return;
+            }
+
+            pp->add_flags(packet::Packet::FlagUDP | packet::Packet::FlagComposed);
+            pp->udp()->dst_addr = destinations_[n].address;
+            pp->set_data(packet->data());
+
+            destinations_[n].writer->write(pp);
+            n_forwarded_.incr_relaxed();
+        }
+    }
+
+    unsigned long n_received() const {
+        return (unsigned long)n_received_.load_relaxed();
+    }
+
+    unsigned long n_forwarded() const {
+        return (unsigned long)n_forwarded_.load_relaxed();
+    }
+
+    unsigned long n_dropped() const {
+        return (unsigned long)n_dropped_.load_relaxed();
+    }
+
+private:
+    void identify_flow_(const packet::Packet& packet) {
+        const packet::source_t ssrc = packet.rtp()->source;
+
+        for (size_t n = 0; n < n_flows_; n++) {
+            if (flows_[n] == ssrc) {
+                return;
+            }
+        }
+
+        if (n_flows_ == MaxFlows) {
+            return;
+        }
+        flows_[n_flows_++] = ssrc;
+
+        roc_log(LogInfo, "relay: %s: new flow: ssrc=%lu src_addr=%s", name_,
+                (unsigned long)ssrc,
+                packet::address_to_str(packet.udp()->src_addr).c_str());
+    }
+
+    struct Destination {
+        packet::Address address;
+        packet::IWriter* writer;
+
+        Destination()
+            : writer(NULL) {
+        }
+    };
+
+    const char* name_;
+
+    packet::PacketPool& packet_pool_;
+    packet::IParser* parser_;
+
+    core::Array<Destination> destinations_;
+
+    // accessed only from the network thread
+    packet::source_t flows_[MaxFlows];
+    size_t n_flows_;
+
+    core::Atomic n_received_;
+    core::Atomic n_forwarded_;
+    core::Atomic n_dropped_;
+};
+
+} // namespace
+
+int main(int argc, char** argv) {
+    core::CrashHandler crash_handler;
+
+    gengetopt_args_info args;
+
+    const int code = cmdline_parser(argc, argv, &args);
+    if (code != 0) {
+        return code;
+    }
+
+    core::ScopedDestructor<gengetopt_args_info*, cmdline_parser_free> args_destructor(
+        &args);
+
+    core::Logger::instance().set_level(
+        LogLevel(core::DefaultLogLevel + args.verbose_given));
+
+    switch ((unsigned)args.color_arg) {
+    case color_arg_auto:
+        core::Logger::instance().set_colors(
+            core::colors_available() ? core::ColorsEnabled : core::ColorsDisabled);
+        break;
+
+    case color_arg_always:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsEnabled));
+        break;
+
+    case color_arg_never:
+        core::Logger::instance().set_colors(core::ColorsMode(core::ColorsDisabled));
+        break;
+
+    default:
+        break;
+    }
+
+    pipeline::PortConfig source_port;
+    if (!pipeline::parse_port(pipeline::Port_AudioSource, args.source_arg,
+                              source_port)) {
+        roc_log(LogError, "can't parse local source port: %s", args.source_arg);
+        return 1;
+    }
+
+    pipeline::PortConfig repair_port;
+    if (args.repair_given) {
+        if (!pipeline::parse_port(pipeline::Port_AudioRepair, args.repair_arg,
+                                  repair_port)) {
+            roc_log(LogError, "can't parse local repair port: %s", args.repair_arg);
+            return 1;
+        }
+    }
+
+    if (args.dst_repair_given != 0 && !args.repair_given) {
+        roc_log(LogError, "--dst-repair can't be used without --repair");
+        return 1;
+    }
+
+    if (args.repair_given && args.dst_repair_given != args.dst_source_given) {
+        roc_log(LogError,
+                "there should be one --dst-repair per --dst-source: %lu vs %lu",
+                (unsigned long)args.dst_repair_given,
+                (unsigned long)args.dst_source_given);
+        return 1;
+    }
+
+    core::nanoseconds_t duration = 0;
+    if (args.duration_given) {
+        if (!core::parse_duration(args.duration_arg, duration)) {
+            roc_log(LogError, "invalid --duration");
+            return 1;
+        }
+    }
+
+    if (args.packet_limit_arg <= 0) {
+        roc_log(LogError, "invalid --packet-limit: should be > 0");
+        return 1;
+    }
+    const size_t max_packet_size = (size_t)args.packet_limit_arg;
+
+    core::HeapAllocator allocator;
+
+    core::BufferPool<uint8_t> byte_buffer_pool(allocator, max_packet_size, false);
+    packet::PacketPool packet_pool(allocator, false);
+
+    rtp::FormatMap format_map;
+    rtp::Parser rtp_parser(format_map, NULL);
+
+    // declared before the transceiver, so that they outlive the network
+    // thread that writes into them
+    RelayWriter source_relay("source", packet_pool, &rtp_parser, allocator);
+    RelayWriter repair_relay("repair", packet_pool, NULL, allocator);
+
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    if (!trx.valid()) {
+        roc_log(LogError, "can't create network transceiver");
+        return 1;
+    }
+
+    packet::Address sender_addr;
+    if (source_port.address.version() == 6) {
+        sender_addr.set_ipv6("::", 0);
+    } else {
+        sender_addr.set_ipv4("0.0.0.0", 0);
+    }
+
+    packet::IWriter* udp_sender = trx.add_udp_sender(sender_addr);
+    if (!udp_sender) {
+        roc_log(LogError, "can't create udp sender");
+        return 1;
+    }
+
+    for (size_t n = 0; n < args.dst_source_given; n++) {
+        pipeline::PortConfig dst;
+        if (!pipeline::parse_port(pipeline::Port_AudioSource, args.dst_source_arg[n],
+                                  dst)) {
+            roc_log(LogError, "can't parse source destination: %s",
+                    args.dst_source_arg[n]);
+            return 1;
+        }
+        if (!source_relay.add_destination(dst.address, *udp_sender)) {
+            roc_log(LogError, "can't add source destination");
+            return 1;
+        }
+    }
+
+    for (size_t n = 0; n < args.dst_repair_given; n++) {
+        pipeline::PortConfig dst;
+        if (!pipeline::parse_port(pipeline::Port_AudioRepair, args.dst_repair_arg[n],
+                                  dst)) {
+            roc_log(LogError, "can't parse repair destination: %s",
+                    args.dst_repair_arg[n]);
+            return 1;
+        }
+        if (!repair_relay.add_destination(dst.address, *udp_sender)) {
+            roc_log(LogError, "can't add repair destination");
+            return 1;
+        }
+    }
+
+    // repair packets are not RTP-framed, so the kernel filter is enabled
+    // only on the source port
+    if (!trx.add_udp_receiver(source_port.address, source_relay)) {
+        roc_log(LogError, "can't bind source port: %s", args.source_arg);
+        return 1;
+    }
+
+    if (args.repair_given) {
+        if (!trx.add_udp_receiver(repair_port.address, repair_relay)) {
+            roc_log(LogError, "can't bind repair port: %s", args.repair_arg);
+            return 1;
+        }
+    }
+
+    roc_log(LogInfo, "relaying: source=%s repair=%s destinations=%lu",
+            packet::address_to_str(source_port.address).c_str(),
+            args.repair_given ? packet::address_to_str(repair_port.address).c_str()
+                              : "(none)",
+            (unsigned long)args.dst_source_given);
+
+    const core::nanoseconds_t started = core::timestamp();
+
+    unsigned long last_forwarded = 0;
+    core::nanoseconds_t report_time = started;
+
+    for (;;) {
+        core::sleep_for(core::Second);
+
+        const core::nanoseconds_t now = core::timestamp();
+
+        if (duration != 0 && now - started >= duration) {
+            break;
+        }
+
+        const unsigned long forwarded =
+            source_relay.n_forwarded() + repair_relay.n_forwarded();
+
+        roc_log(LogInfo,
+                "rate: %lu pkt/sec, source: recv=%lu fwd=%lu drop=%lu,"
+                " repair: recv=%lu fwd=%lu",
+                (unsigned long)((double)(forwarded - last_forwarded) * core::Second
+                                / (double)(now - report_time)),
+                source_relay.n_received(), source_relay.n_forwarded(),
+                source_relay.n_dropped(), repair_relay.n_received(),
+                repair_relay.n_forwarded());
+
+        last_forwarded = forwarded;
+        report_time = now;
+    }
+
+    roc_log(LogInfo, "total: source: recv=%lu fwd=%lu drop=%lu, repair: recv=%lu fwd=%lu",
+            source_relay.n_received(), source_relay.n_forwarded(),
+            source_relay.n_dropped(), repair_relay.n_received(),
+            repair_relay.n_forwarded());
+
+    return 0;
+}
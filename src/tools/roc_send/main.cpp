@@ -13,6 +13,7 @@
 #include "roc_core/heap_allocator.h"
 #include "roc_core/log.h"
 #include "roc_core/parse_duration.h"
+#include "roc_core/realtime.h"
 #include "roc_core/scoped_destructor.h"
 #include "roc_core/unique_ptr.h"
 #include "roc_netio/transceiver.h"
@@ -22,6 +23,7 @@
 #include "roc_sndio/backend_dispatcher.h"
 #include "roc_sndio/print_drivers.h"
 #include "roc_sndio/pump.h"
+#include "roc_sndio/readahead_source.h"
 
 #include "roc_send/cmdline.h"
 
@@ -61,6 +63,16 @@ int main(int argc, char** argv) {
         break;
     }
 
+    if (args.realtime_flag) {
+        // before any thread is started or any memory is allocated, so that
+        // the threads inherit the scheduling policy and the allocations are
+        // locked into RAM
+        if (!core::enable_realtime()) {
+            roc_log(LogError, "can't enable real-time mode");
+            return 1;
+        }
+    }
+
     core::HeapAllocator allocator;
 
     if (args.list_drivers_given) {
@@ -79,6 +91,22 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (args.dtx_given) {
+        if (!core::parse_duration(args.dtx_arg, config.dtx_keepalive)
+            || config.dtx_keepalive <= 0) {
+            roc_log(LogError, "invalid --dtx");
+            return 1;
+        }
+    }
+
+    if (args.flush_deadline_given) {
+        if (!core::parse_duration(args.flush_deadline_arg, config.flush_deadline)
+            || config.flush_deadline <= 0) {
+            roc_log(LogError, "invalid --flush-deadline");
+            return 1;
+        }
+    }
+
     size_t max_packet_size = 2048;
     if (args.packet_limit_given) {
         if (args.packet_limit_arg <= 0) {
@@ -145,6 +173,10 @@ int main(int argc, char** argv) {
     config.resampling = !args.no_resampling_flag;
 
     switch ((unsigned)args.resampler_profile_arg) {
+    case resampler_profile_arg_ultralow:
+        config.resampler = audio::resampler_profile(audio::ResamplerProfile_UltraLow);
+        break;
+
     case resampler_profile_arg_low:
         config.resampler = audio::resampler_profile(audio::ResamplerProfile_Low);
         break;
@@ -194,6 +226,7 @@ int main(int argc, char** argv) {
     }
 
     config.interleaving = args.interleaving_flag;
+    config.redundant_encoding = args.red_flag;
     config.poisoning = args.poisoning_flag;
 
     core::BufferPool<uint8_t> byte_buffer_pool(allocator, max_packet_size,
@@ -202,6 +235,19 @@ int main(int argc, char** argv) {
         allocator, config.internal_frame_size, args.poisoning_flag);
     packet::PacketPool packet_pool(allocator, args.poisoning_flag);
 
+    if (args.realtime_flag) {
+        // pre-fault the steady-state working set at startup, so that pool
+        // chunks are not allocated on the audio path later
+        enum { PoolPrealloc = 64 };
+
+        if (!byte_buffer_pool.reserve(PoolPrealloc)
+            || !sample_buffer_pool.reserve(PoolPrealloc)
+            || !packet_pool.reserve(PoolPrealloc)) {
+            roc_log(LogError, "can't preallocate pools");
+            return 1;
+        }
+    }
+
     core::UniquePtr<sndio::ISource> source(
         sndio::BackendDispatcher::instance().open_source(allocator, args.driver_arg,
                                                          args.input_arg, source_config),
@@ -215,10 +261,35 @@ int main(int argc, char** argv) {
     config.timing = !source->has_clock();
     config.input_sample_rate = source->sample_rate();
 
+    sndio::ISource* input_source = source.get();
+
+    core::UniquePtr<sndio::ReadaheadSource> readahead_source;
+    if (args.readahead_given) {
+        if (args.readahead_arg <= 0) {
+            roc_log(LogError, "invalid --readahead: should be > 0");
+            return 1;
+        }
+        if (source->has_clock()) {
+            roc_log(LogError, "--readahead can't be used with a device input");
+            return 1;
+        }
+        readahead_source.reset(new (allocator) sndio::ReadaheadSource(
+                                   allocator, sample_buffer_pool, *source,
+                                   config.internal_frame_size,
+                                   (size_t)args.readahead_arg),
+                               allocator);
+        if (!readahead_source || !readahead_source->valid()) {
+            roc_log(LogError, "can't create readahead source");
+            return 1;
+        }
+        input_source = readahead_source.get();
+    }
+
     fec::CodecMap codec_map;
     rtp::FormatMap format_map;
 
-    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator);
+    netio::Transceiver trx(packet_pool, byte_buffer_pool, allocator,
+                           args.netio_core_given ? args.netio_core_arg : -1);
     if (!trx.valid()) {
         roc_log(LogError, "can't create network transceiver");
         return 1;
@@ -234,11 +305,17 @@ int main(int argc, char** argv) {
         roc_panic("can't initialize local address");
     }
 
-    packet::IWriter* udp_sender = trx.add_udp_sender(local_addr);
+    const core::Atomic* dst_unreachable = NULL;
+    const core::Atomic* path_mtu = NULL;
+    packet::IWriter* udp_sender =
+        trx.add_udp_sender(local_addr, 0, 0, &dst_unreachable, &path_mtu);
     if (!udp_sender) {
         roc_log(LogError, "can't create udp sender");
         return 1;
     }
+    config.dst_unreachable = dst_unreachable;
+    config.path_mtu = path_mtu;
+    config.mtu_packet_sizing = args.mtu_sizing_flag;
 
     pipeline::Sender sender(config, source_port, *udp_sender, repair_port, *udp_sender,
                             codec_map, format_map, packet_pool, byte_buffer_pool,
@@ -248,8 +325,8 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    sndio::Pump pump(sample_buffer_pool, *source, sender, config.internal_frame_size,
-                     sndio::Pump::ModePermanent);
+    sndio::Pump pump(sample_buffer_pool, *input_source, sender,
+                     config.internal_frame_size, sndio::Pump::ModePermanent);
     if (!pump.valid()) {
         roc_log(LogError, "can't create audio pump");
         return 1;